@@ -0,0 +1,86 @@
+#!/usr/bin/env python
+# *****************************************************************************
+#  Copyright 2017-2020 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+# *****************************************************************************
+"""Compares two result files of ngraph_benchmarks and reports regressions.
+
+Both files are written by
+  ngraph_benchmarks --benchmark_format=json --benchmark_out=FILE
+usually a stored baseline from the last release and a run of the current tree. Benchmarks are
+matched by name and compared by real time. The exit code is 1 if any benchmark got slower by more
+than the threshold, so the script can gate a CI job.
+"""
+
+import argparse
+import json
+import sys
+
+TIME_UNITS = {'ns': 1.0, 'us': 1e3, 'ms': 1e6, 's': 1e9}
+
+
+def load_times(path):  # type: (str) -> dict
+    """Return the real time in nanoseconds of each benchmark in a result file."""
+    with open(path) as f:
+        results = json.load(f)
+    times = {}
+    for benchmark in results['benchmarks']:
+        # Skip the mean/median/stddev rows written with --benchmark_repetitions
+        if benchmark.get('run_type', 'iteration') != 'iteration':
+            continue
+        unit = TIME_UNITS[benchmark.get('time_unit', 'ns')]
+        times[benchmark['name']] = benchmark['real_time'] * unit
+    return times
+
+
+def main():  # type: () -> int
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('baseline', help='result file to compare against')
+    parser.add_argument('current', help='result file of the run being checked')
+    parser.add_argument('--threshold', type=float, default=0.1,
+                        help='largest tolerated slowdown as a fraction (default: 0.1)')
+    args = parser.parse_args()
+
+    baseline = load_times(args.baseline)
+    current = load_times(args.current)
+
+    regressions = 0
+    name_width = max([len(name) for name in current] + [len('benchmark')])
+    print('{:<{w}} {:>14} {:>14} {:>8}'.format('benchmark', 'baseline (ns)', 'current (ns)',
+                                              'change', w=name_width))
+    for name in sorted(current):
+        if name not in baseline:
+            print('{:<{w}} {:>14} {:>14.0f} {:>8}'.format(name, '-', current[name], 'new',
+                                                         w=name_width))
+            continue
+        change = current[name] / baseline[name] - 1
+        flag = ''
+        if change > args.threshold:
+            flag = '  REGRESSION'
+            regressions += 1
+        print('{:<{w}} {:>14.0f} {:>14.0f} {:>+7.1%}{}'.format(name, baseline[name], current[name],
+                                                               change, flag, w=name_width))
+    for name in sorted(set(baseline) - set(current)):
+        print('{:<{w}} {:>14.0f} {:>14} {:>8}'.format(name, baseline[name], '-', 'missing',
+                                                     w=name_width))
+
+    if regressions:
+        print('{} benchmark(s) slower than the baseline by more than {:.0%}'.format(
+            regressions, args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,70 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <benchmark/benchmark.h>
+
+#include "ngraph/coordinate_transform.hpp"
+
+using namespace ngraph;
+
+// Iterates a 4D tensor of range(0)^4 elements and maps each coordinate to its index, the inner
+// loop of most reference kernels
+static void coordinate_transform_iterate(benchmark::State& state)
+{
+    size_t d = state.range(0);
+    Shape shape{d, d, d, d};
+    CoordinateTransform transform(shape);
+    while (state.KeepRunning())
+    {
+        size_t sum = 0;
+        for (const Coordinate& c : transform)
+        {
+            sum += transform.index(c);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * shape_size(shape));
+}
+BENCHMARK(coordinate_transform_iterate)->Arg(8)->Arg(16)->Arg(32);
+
+// Same as above over a strided, padded and transposed view, as used by convolution and pooling
+static void coordinate_transform_padded(benchmark::State& state)
+{
+    size_t d = state.range(0);
+    Shape shape{d, d, d, d};
+    CoordinateTransform transform(shape,
+                                  Coordinate{0, 0, 0, 0},
+                                  Coordinate{d, d, d, d},
+                                  Strides{1, 1, 2, 2},
+                                  AxisVector{0, 1, 3, 2},
+                                  CoordinateDiff{0, 0, 1, 1},
+                                  CoordinateDiff{0, 0, 1, 1},
+                                  Strides{1, 1, 1, 1});
+    while (state.KeepRunning())
+    {
+        size_t sum = 0;
+        for (const Coordinate& c : transform)
+        {
+            if (transform.has_source_coordinate(c))
+            {
+                sum += transform.index(c);
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * shape_size(transform.get_target_shape()));
+}
+BENCHMARK(coordinate_transform_padded)->Arg(8)->Arg(16)->Arg(32);
@@ -0,0 +1,124 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "ngraph/runtime/cpu/kernel/add.hpp"
+#include "ngraph/runtime/cpu/kernel/dot.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_sum.hpp"
+#include "ngraph/runtime/cpu/kernel/relu.hpp"
+#include "ngraph/runtime/cpu/kernel/softmax.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace kernel = ngraph::runtime::cpu::kernel;
+
+// The kernels run on the device of this arena of the CPU executor
+static const int s_arena = 0;
+
+static vector<float> random_vector(size_t size)
+{
+    // Fixed seed so every run measures the same data
+    default_random_engine engine(0);
+    uniform_real_distribution<float> dist(-1, 1);
+    vector<float> v(size);
+    for (float& x : v)
+    {
+        x = dist(engine);
+    }
+    return v;
+}
+
+static void cpu_add(benchmark::State& state)
+{
+    size_t count = state.range(0);
+    auto a = random_vector(count);
+    auto b = random_vector(count);
+    vector<float> out(count);
+    while (state.KeepRunning())
+    {
+        kernel::add<float>(a.data(), b.data(), out.data(), count, s_arena);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * count * 3 * sizeof(float));
+}
+BENCHMARK(cpu_add)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+static void cpu_relu(benchmark::State& state)
+{
+    size_t count = state.range(0);
+    auto in = random_vector(count);
+    vector<float> out(count);
+    while (state.KeepRunning())
+    {
+        kernel::relu<float>(in.data(), out.data(), count, s_arena);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * count * 2 * sizeof(float));
+}
+BENCHMARK(cpu_relu)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+static void cpu_dot(benchmark::State& state)
+{
+    size_t n = state.range(0);
+    Shape shape{n, n};
+    auto a = random_vector(n * n);
+    auto b = random_vector(n * n);
+    vector<float> out(n * n);
+    while (state.KeepRunning())
+    {
+        kernel::dot<float, 2, 2, 1>(a.data(), b.data(), out.data(), shape, shape, shape, s_arena);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * n * n * n);
+}
+BENCHMARK(cpu_dot)->Arg(64)->Arg(256);
+
+static void cpu_reduce_sum(benchmark::State& state)
+{
+    size_t n = state.range(0);
+    Shape in_shape{n, n};
+    Shape out_shape{n};
+    auto in = random_vector(n * n);
+    vector<float> out(n);
+    while (state.KeepRunning())
+    {
+        kernel::reduce_sum_innermost_1rd<float, 2>(
+            in.data(), out.data(), in_shape, out_shape, s_arena);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * sizeof(float));
+}
+BENCHMARK(cpu_reduce_sum)->Arg(64)->Arg(512);
+
+static void cpu_softmax(benchmark::State& state)
+{
+    size_t rows = state.range(0);
+    size_t cols = 1000;
+    auto in = random_vector(rows * cols);
+    vector<float> out(rows * cols);
+    while (state.KeepRunning())
+    {
+        kernel::softmax_rows<float>(in.data(), out.data(), rows, cols, s_arena);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * rows * cols);
+}
+BENCHMARK(cpu_softmax)->Arg(1)->Arg(64);
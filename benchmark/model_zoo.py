@@ -0,0 +1,183 @@
+#!/usr/bin/env python
+# *****************************************************************************
+#  Copyright 2017-2020 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+# *****************************************************************************
+"""Benchmarks every model under test/models on each available backend.
+
+Each backend configuration runs
+  nbench -d MODELS -b BACKEND -i ITERATIONS --compile_stats --json FILE
+over the serialized nGraph models (MXNet, PaddlePaddle and TensorFlow exports) and, when nbench
+is built with the ONNX importer, the ONNX models. The results are merged into one table of
+import and compile time, throughput, latency percentiles, peak RSS during compile and executable
+memory. A backend that is not built into nbench produces no results and is reported as skipped.
+
+With --history, each run is appended to a JSON lines file and the throughput and compile time
+are compared against the previous run in that file. The exit code is 1 if any model got slower
+by more than the threshold, so the script can gate a CI job.
+"""
+
+import argparse
+import datetime
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+# (configuration name, nbench backend name, extra environment)
+CONFIGURATIONS = [
+    ('CPU', 'CPU', {}),
+    ('CPU-codegen', 'CPU', {'NGRAPH_CODEGEN': '1'}),
+    ('INTERPRETER', 'INTERPRETER', {}),
+    ('GCPU', 'GCPU', {}),
+    ('PlaidML', 'PlaidML', {}),
+]
+
+
+def run_nbench(nbench, models, backend, env, iterations):  # type: (...) -> list
+    """Run nbench over a model directory and return its JSON reports."""
+    fd, json_path = tempfile.mkstemp(suffix='.json')
+    os.close(fd)
+    try:
+        command = [nbench, '-d', models, '-b', backend, '-i', str(iterations), '--compile_stats',
+                   '--json', json_path]
+        with open(os.devnull, 'w') as devnull:
+            subprocess.call(command, env=env, stdout=devnull, stderr=devnull)
+        try:
+            with open(json_path) as f:
+                return json.load(f)
+        except ValueError:
+            return []
+    finally:
+        os.remove(json_path)
+
+
+def summarize(report, models):  # type: (dict, str) -> dict
+    """Reduce an nbench report to the columns of the table."""
+    compile_stats = report.get('compile', {})
+    latency = report.get('latency_us', {})
+    return {
+        'model': os.path.relpath(report['model'], models),
+        'import_ms': compile_stats.get('deserialize_us', 0) / 1e3,
+        'compile_ms': compile_stats.get('compile_us', 0) / 1e3,
+        'throughput': report.get('throughput', 0),
+        'p50_us': latency.get('p50', 0),
+        'p99_us': latency.get('p99', 0),
+        'peak_rss_mb': compile_stats.get('peak_rss_bytes', 0) / 2.0**20,
+        'executable_mb': compile_stats.get('executable_bytes', 0) / 2.0**20,
+    }
+
+
+def load_previous(path):  # type: (str) -> dict
+    """Return the results of the last run in a history file, keyed by (config, model)."""
+    if not path or not os.path.exists(path):
+        return {}
+    last = None
+    with open(path) as f:
+        for line in f:
+            if line.strip():
+                last = json.loads(line)
+    if last is None:
+        return {}
+    return dict(((r['config'], r['model']), r) for r in last['results'])
+
+
+def change(current, previous, key):  # type: (dict, dict, str) -> float
+    """Relative change of a column, or None without a previous value."""
+    if previous is None or not previous.get(key):
+        return None
+    return current[key] / previous[key] - 1
+
+
+def format_change(value):  # type: (float) -> str
+    return '-' if value is None else '{:+.1%}'.format(value)
+
+
+def main():  # type: () -> int
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--nbench', default='nbench', help='path to the nbench executable')
+    parser.add_argument('--models', default=os.path.join(root, 'test', 'models'),
+                        help='directory of models (default: test/models)')
+    parser.add_argument('--configs', default=','.join(c[0] for c in CONFIGURATIONS),
+                        help='comma separated backend configurations to run (default: all)')
+    parser.add_argument('--iterations', type=int, default=20,
+                        help='timed executions per model (default: 20)')
+    parser.add_argument('--history', help='JSON lines file to compare against and append to')
+    parser.add_argument('--threshold', type=float, default=0.1,
+                        help='largest tolerated slowdown as a fraction (default: 0.1)')
+    args = parser.parse_args()
+
+    selected = args.configs.split(',')
+    previous = load_previous(args.history)
+    results = []
+    for name, backend, extra_env in CONFIGURATIONS:
+        if name not in selected:
+            continue
+        env = dict(os.environ)
+        env.update(extra_env)
+        reports = run_nbench(args.nbench, args.models, backend, env, args.iterations)
+        if not reports:
+            print('{}: no results, skipped (backend not available?)'.format(name))
+            continue
+        for report in reports:
+            result = summarize(report, args.models)
+            result['config'] = name
+            results.append(result)
+
+    columns = [('import_ms', 'import ms', '{:.1f}'), ('compile_ms', 'compile ms', '{:.1f}'),
+               ('throughput', 'runs/s', '{:.1f}'), ('p50_us', 'p50 us', '{:.0f}'),
+               ('p99_us', 'p99 us', '{:.0f}'), ('peak_rss_mb', 'rss MB', '{:.1f}'),
+               ('executable_mb', 'exec MB', '{:.1f}')]
+    model_width = max([len(r['model']) for r in results] + [len('model')])
+    config_width = max([len(r['config']) for r in results] + [len('backend')])
+    header = '{:<{mw}} {:<{cw}}'.format('model', 'backend', mw=model_width, cw=config_width)
+    header += ''.join(' {:>11}'.format(title) for _, title, _ in columns)
+    header += ' {:>10} {:>10}'.format('d runs/s', 'd compile')
+    print(header)
+
+    regressions = 0
+    for result in sorted(results, key=lambda r: (r['model'], r['config'])):
+        before = previous.get((result['config'], result['model']))
+        throughput_change = change(result, before, 'throughput')
+        compile_change = change(result, before, 'compile_ms')
+        line = '{:<{mw}} {:<{cw}}'.format(result['model'], result['config'], mw=model_width,
+                                         cw=config_width)
+        line += ''.join(' {:>11}'.format(fmt.format(result[key])) for key, _, fmt in columns)
+        line += ' {:>10} {:>10}'.format(format_change(throughput_change),
+                                        format_change(compile_change))
+        # A drop in throughput of x is a slowdown of 1 / (1 - x) - 1
+        slower = compile_change is not None and compile_change > args.threshold
+        if throughput_change is not None:
+            slower |= throughput_change <= -1 or 1 / (1 + throughput_change) - 1 > args.threshold
+        if slower:
+            line += '  REGRESSION'
+            regressions += 1
+        print(line)
+
+    if args.history:
+        with open(args.history, 'a') as f:
+            run = {'time': datetime.datetime.utcnow().isoformat(), 'results': results}
+            f.write(json.dumps(run) + '\n')
+
+    if regressions:
+        print('{} result(s) slower than the previous run by more than {:.0%}'.format(
+            regressions, args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
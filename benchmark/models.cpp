@@ -0,0 +1,44 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <vector>
+
+#include "models.hpp"
+#include "ngraph/ngraph.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+shared_ptr<Function> make_mlp(size_t layers)
+{
+    const size_t width = 64;
+    auto x = make_shared<op::Parameter>(element::f32, Shape{1, width});
+    Output<Node> h = x;
+    for (size_t i = 0; i < layers; i++)
+    {
+        auto w = op::Constant::create(
+            element::f32, Shape{width, width}, vector<float>(width * width, 0.5f));
+        auto scale = op::Constant::create(
+            element::f32, Shape{width, width}, vector<float>(width * width, 2.0f));
+        auto b = op::Constant::create(element::f32, Shape{width}, vector<float>(width, 0.1f));
+        auto dot = make_shared<op::Dot>(h, make_shared<op::Multiply>(w, scale));
+        auto bias0 = make_shared<op::Broadcast>(b, Shape{1, width}, AxisSet{0});
+        auto bias1 = make_shared<op::Broadcast>(b, Shape{1, width}, AxisSet{0});
+        auto sum = make_shared<op::Add>(make_shared<op::Add>(dot, bias0), bias1);
+        h = make_shared<op::Relu>(sum);
+    }
+    return make_shared<Function>(OutputVector{h}, ParameterVector{x});
+}
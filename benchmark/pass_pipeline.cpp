@@ -0,0 +1,69 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <benchmark/benchmark.h>
+
+#include "models.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/pass/algebraic_simplification.hpp"
+#include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/core_fusion.hpp"
+#include "ngraph/pass/cse.hpp"
+#include "ngraph/pass/liveness.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/nop_elimination.hpp"
+#include "ngraph/pass/reshape_elimination.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Runs a typical backend pass pipeline on a fresh copy of an MLP of range(0) layers
+static void pass_pipeline(benchmark::State& state)
+{
+    auto f = make_mlp(state.range(0));
+    while (state.KeepRunning())
+    {
+        state.PauseTiming();
+        auto clone = clone_function(*f);
+        state.ResumeTiming();
+
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::ConstantFolding>();
+        pass_manager.register_pass<pass::AlgebraicSimplification>();
+        pass_manager.register_pass<pass::NopElimination>();
+        pass_manager.register_pass<pass::ReshapeElimination>();
+        pass_manager.register_pass<pass::CoreFusion>();
+        pass_manager.register_pass<pass::CommonSubexpressionElimination>();
+        pass_manager.register_pass<pass::Liveness>();
+        pass_manager.register_pass<pass::MemoryLayout>();
+        pass_manager.run_passes(clone);
+    }
+    state.SetItemsProcessed(state.iterations() * f->get_ops().size());
+}
+BENCHMARK(pass_pipeline)->Arg(8)->Arg(64)->Unit(benchmark::kMicrosecond);
+
+// Cost of clone_function alone, which most compile paths start with
+static void clone_mlp(benchmark::State& state)
+{
+    auto f = make_mlp(state.range(0));
+    while (state.KeepRunning())
+    {
+        benchmark::DoNotOptimize(clone_function(*f));
+    }
+    state.SetItemsProcessed(state.iterations() * f->get_ops().size());
+}
+BENCHMARK(clone_mlp)->Arg(8)->Arg(64)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,134 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "ngraph/runtime/reference/add.hpp"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/softmax.hpp"
+#include "ngraph/runtime/reference/sum.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static vector<float> random_vector(size_t size)
+{
+    // Fixed seed so every run measures the same data
+    default_random_engine engine(0);
+    uniform_real_distribution<float> dist(-1, 1);
+    vector<float> v(size);
+    for (float& x : v)
+    {
+        x = dist(engine);
+    }
+    return v;
+}
+
+static void reference_add(benchmark::State& state)
+{
+    size_t count = state.range(0);
+    auto a = random_vector(count);
+    auto b = random_vector(count);
+    vector<float> out(count);
+    while (state.KeepRunning())
+    {
+        runtime::reference::add(a.data(), b.data(), out.data(), count);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * count * 3 * sizeof(float));
+}
+BENCHMARK(reference_add)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+static void reference_dot(benchmark::State& state)
+{
+    size_t n = state.range(0);
+    Shape shape{n, n};
+    auto a = random_vector(n * n);
+    auto b = random_vector(n * n);
+    vector<float> out(n * n);
+    while (state.KeepRunning())
+    {
+        runtime::reference::dot(a.data(), b.data(), out.data(), shape, shape, shape, 1);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * n * n * n);
+}
+BENCHMARK(reference_dot)->Arg(64)->Arg(256);
+
+// 3x3 convolution with 16 input and output channels over a range(0)^2 image
+static void reference_convolution(benchmark::State& state)
+{
+    size_t d = state.range(0);
+    Shape in_shape{1, 16, d, d};
+    Shape filter_shape{16, 16, 3, 3};
+    Shape out_shape{1, 16, d - 2, d - 2};
+    auto in = random_vector(shape_size(in_shape));
+    auto filter = random_vector(shape_size(filter_shape));
+    vector<float> out(shape_size(out_shape));
+    while (state.KeepRunning())
+    {
+        runtime::reference::convolution(in.data(),
+                                        filter.data(),
+                                        out.data(),
+                                        in_shape,
+                                        filter_shape,
+                                        out_shape,
+                                        Strides{1, 1},
+                                        Strides{1, 1},
+                                        CoordinateDiff{0, 0},
+                                        CoordinateDiff{0, 0},
+                                        Strides{1, 1});
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * shape_size(out_shape) * 16 * 9);
+}
+BENCHMARK(reference_convolution)->Arg(16)->Arg(56);
+
+// Sum of a range(0) x range(0) matrix over its inner axis
+static void reference_sum(benchmark::State& state)
+{
+    size_t n = state.range(0);
+    Shape in_shape{n, n};
+    Shape out_shape{n};
+    auto in = random_vector(n * n);
+    vector<float> out(n);
+    while (state.KeepRunning())
+    {
+        runtime::reference::sum(in.data(), out.data(), in_shape, out_shape, AxisSet{1});
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * sizeof(float));
+}
+BENCHMARK(reference_sum)->Arg(64)->Arg(512);
+
+// Softmax over the rows of a range(0) x 1000 matrix, as in a classifier head
+static void reference_softmax(benchmark::State& state)
+{
+    Shape shape{static_cast<size_t>(state.range(0)), 1000};
+    auto in = random_vector(shape_size(shape));
+    vector<float> out(shape_size(shape));
+    while (state.KeepRunning())
+    {
+        runtime::reference::softmax(in.data(), out.data(), shape, AxisSet{1});
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * shape_size(shape));
+}
+BENCHMARK(reference_softmax)->Arg(1)->Arg(64);
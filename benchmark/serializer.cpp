@@ -0,0 +1,63 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <sstream>
+
+#include <benchmark/benchmark.h>
+
+#include "models.hpp"
+#include "ngraph/serializer.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static void serialize_mlp(benchmark::State& state)
+{
+    auto f = make_mlp(state.range(0));
+    size_t bytes = 0;
+    while (state.KeepRunning())
+    {
+        string js = serialize(f);
+        bytes += js.size();
+        benchmark::DoNotOptimize(js);
+    }
+    state.SetBytesProcessed(bytes);
+}
+BENCHMARK(serialize_mlp)->Arg(8)->Arg(64)->Unit(benchmark::kMicrosecond);
+
+static void deserialize_mlp(benchmark::State& state)
+{
+    string js = serialize(make_mlp(state.range(0)));
+    while (state.KeepRunning())
+    {
+        benchmark::DoNotOptimize(deserialize(js));
+    }
+    state.SetBytesProcessed(state.iterations() * js.size());
+}
+BENCHMARK(deserialize_mlp)->Arg(8)->Arg(64)->Unit(benchmark::kMicrosecond);
+
+// Serializes to and deserializes from a stream, the path taken by model files
+static void round_trip_mlp(benchmark::State& state)
+{
+    auto f = make_mlp(state.range(0));
+    while (state.KeepRunning())
+    {
+        stringstream stream;
+        serialize(stream, f);
+        benchmark::DoNotOptimize(deserialize(stream));
+    }
+}
+BENCHMARK(round_trip_mlp)->Arg(8)->Arg(64)->Unit(benchmark::kMicrosecond);
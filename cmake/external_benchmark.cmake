@@ -0,0 +1,71 @@
+# ******************************************************************************
+# Copyright 2017-2020 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ******************************************************************************
+
+
+# Enable ExternalProject CMake module
+include(ExternalProject)
+
+#------------------------------------------------------------------------------
+# Download and install Google Benchmark ...
+#------------------------------------------------------------------------------
+
+SET(BENCHMARK_GIT_REPO_URL https://github.com/google/benchmark.git)
+SET(BENCHMARK_GIT_LABEL v1.5.0)
+
+set(BENCHMARK_OUTPUT_DIR ${EXTERNAL_PROJECTS_ROOT}/benchmark/build/src)
+set(BENCHMARK_LIB
+    ${BENCHMARK_OUTPUT_DIR}/${CMAKE_STATIC_LIBRARY_PREFIX}benchmark${CMAKE_STATIC_LIBRARY_SUFFIX})
+
+if(CMAKE_BUILD_TYPE)
+    list(APPEND BENCHMARK_CMAKE_ARGS
+        -DCMAKE_BUILD_TYPE=${CMAKE_BUILD_TYPE}
+    )
+endif()
+
+ExternalProject_Add(
+    ext_benchmark
+    PREFIX benchmark
+    GIT_REPOSITORY ${BENCHMARK_GIT_REPO_URL}
+    GIT_TAG ${BENCHMARK_GIT_LABEL}
+    # Disable install step
+    INSTALL_COMMAND ""
+    UPDATE_COMMAND ""
+    CMAKE_GENERATOR ${CMAKE_GENERATOR}
+    CMAKE_GENERATOR_PLATFORM ${CMAKE_GENERATOR_PLATFORM}
+    CMAKE_GENERATOR_TOOLSET ${CMAKE_GENERATOR_TOOLSET}
+    CMAKE_ARGS
+        ${NGRAPH_FORWARD_CMAKE_ARGS}
+        -DCMAKE_CXX_FLAGS=${CMAKE_ORIGINAL_CXX_FLAGS}
+        -DBENCHMARK_ENABLE_TESTING=OFF
+        -DBENCHMARK_ENABLE_GTEST_TESTS=OFF
+        -DBENCHMARK_ENABLE_INSTALL=OFF
+        ${BENCHMARK_CMAKE_ARGS}
+    BINARY_DIR "${EXTERNAL_PROJECTS_ROOT}/benchmark/build"
+    EXCLUDE_FROM_ALL TRUE
+    BUILD_BYPRODUCTS ${BENCHMARK_LIB}
+    )
+
+#------------------------------------------------------------------------------
+
+ExternalProject_Get_Property(ext_benchmark SOURCE_DIR)
+
+add_library(libbenchmark INTERFACE)
+add_dependencies(libbenchmark ext_benchmark)
+target_include_directories(libbenchmark SYSTEM INTERFACE ${SOURCE_DIR}/include)
+target_link_libraries(libbenchmark INTERFACE ${BENCHMARK_LIB})
+if(NOT WIN32)
+    target_link_libraries(libbenchmark INTERFACE pthread)
+endif()
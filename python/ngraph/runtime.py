@@ -19,7 +19,7 @@ from typing import List, Union
 
 import numpy as np
 
-from ngraph.impl import Function, Node, Shape, serialize, util
+from ngraph.impl import Function, Node, Shape, serialize
 from ngraph.impl.runtime import Backend, Executable, Tensor
 from ngraph.utils.types import get_dtype, NumericData
 from ngraph.exceptions import UserInputError
@@ -70,37 +70,33 @@ class Computation(object):
         self.results = ng_function.get_results()
         self.handle = self.runtime.backend.compile(self.function)
 
-        self.tensor_views = []  # type: List[Tensor]
-        for parameter in self.parameters:
-            shape = parameter.get_shape()
-            element_type = parameter.get_element_type()
-            self.tensor_views.append(runtime.backend.create_tensor(element_type, shape))
-
-        self.result_views = []  # type: List[Tensor]
-        for result in self.results:
-            shape = result.get_shape()
-            element_type = result.get_element_type()
-            self.result_views.append(runtime.backend.create_tensor(element_type, shape))
-
     def __repr__(self):  # type: () -> str
         params_string = ', '.join([param.name for param in self.parameters])
         return '<Computation: {}({})>'.format(self.function.get_name(), params_string)
 
     def __call__(self, *input_values):  # type: (*NumericData) -> List[NumericData]
-        """Run computation on input values and return result."""
-        for tensor_view, value in zip(self.tensor_views, input_values):
-            if not isinstance(value, np.ndarray):
-                value = np.array(value)
-            Computation._write_ndarray_to_tensor_view(value, tensor_view)
+        """Run computation on input values and return result.
 
-        self.handle.call(self.result_views, self.tensor_views)
+        Input and result arrays are bound to the computation in place, without copying. The
+        Python GIL is released while the computation runs, so several threads may run
+        computations concurrently.
+        """
+        input_views = []  # type: List[Tensor]
+        for parameter, value in zip(self.parameters, input_values):
+            value = Computation._to_ndarray(value, parameter)
+            input_views.append(self.runtime.backend.create_tensor(
+                parameter.get_element_type(), parameter.get_shape(), value))
 
         results = []
-        for result_view in self.result_views:
-            result = np.ndarray(result_view.shape, dtype=get_dtype(result_view.element_type))
-            Computation._read_tensor_view_to_ndarray(result_view, result)
-            results.append(result)
+        result_views = []  # type: List[Tensor]
+        for result in self.results:
+            element_type = result.get_element_type()
+            output = np.ndarray(result.get_shape(), dtype=get_dtype(element_type))
+            result_views.append(self.runtime.backend.create_tensor(
+                element_type, result.get_shape(), output))
+            results.append(output)
 
+        self.handle.call(result_views, input_views)
         return results
 
     def serialize(self, indent=0):  # type: (int) -> str
@@ -112,32 +108,20 @@ class Computation(object):
         return serialize(self.function, indent)
 
     @staticmethod
-    def _get_buffer_size(element_type, element_count):  # type: (Tensor, int) -> int
-        return int((element_type.bitwidth / 8.0) * element_count)
-
-    @staticmethod
-    def _write_ndarray_to_tensor_view(value, tensor_view):
-        # type: (np.ndarray, Tensor) -> None
-        tensor_view_dtype = get_dtype(tensor_view.element_type)
-        if list(tensor_view.shape) != list(value.shape) and len(value.shape) > 0:
-            raise UserInputError("Provided tensor's shape: %s does not match the expected: %s.",
-                                 list(value.shape), list(tensor_view.shape))
-        if value.dtype != tensor_view_dtype:
+    def _to_ndarray(value, parameter):  # type: (NumericData, Node) -> np.ndarray
+        """Return value as a C-contiguous array of the parameter's shape and type."""
+        value = np.asarray(value)
+        shape = list(parameter.get_shape())
+        if shape != list(value.shape):
+            if len(value.shape) > 0:
+                raise UserInputError('Provided tensor\'s shape: %s does not match the expected: '
+                                     '%s.', list(value.shape), shape)
+            value = np.broadcast_to(value, shape)
+        parameter_dtype = get_dtype(parameter.get_element_type())
+        if value.dtype != parameter_dtype:
             log.warning(
                 'Attempting to write a %s value to a %s tensor. Will attempt type conversion.',
                 value.dtype,
-                tensor_view.element_type)
-            value = value.astype(tensor_view_dtype)
-
-        buffer_size = Computation._get_buffer_size(
-            tensor_view.element_type, tensor_view.element_count)
-
-        nparray = np.ascontiguousarray(value)
-        tensor_view.write(util.numpy_to_c(nparray), buffer_size)
-
-    @staticmethod
-    def _read_tensor_view_to_ndarray(tensor_view, output):
-        # type: (Tensor, np.ndarray) -> None
-        buffer_size = Computation._get_buffer_size(
-            tensor_view.element_type, tensor_view.element_count)
-        tensor_view.read(util.numpy_to_c(output), buffer_size)
+                parameter.get_element_type())
+            value = value.astype(parameter_dtype)
+        return np.ascontiguousarray(value)
@@ -16,6 +16,7 @@
 
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <stdexcept>
 
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/tensor.hpp"
@@ -30,6 +31,33 @@ static std::shared_ptr<ngraph::runtime::Executable> compile(ngraph::runtime::Bac
     return self->compile(func, enable_performance_data);
 }
 
+// Creates a tensor that uses the memory of a C-contiguous buffer, such as a NumPy array, in
+// place. The binding keeps the buffer alive for as long as the tensor.
+static std::shared_ptr<ngraph::runtime::Tensor>
+    create_tensor_from_buffer(ngraph::runtime::Backend* self,
+                              const ngraph::element::Type& element_type,
+                              const ngraph::Shape& shape,
+                              py::buffer buffer)
+{
+    py::buffer_info info = buffer.request();
+    if (static_cast<size_t>(info.itemsize) != element_type.size() ||
+        static_cast<size_t>(info.size) != ngraph::shape_size(shape))
+    {
+        throw std::invalid_argument("Buffer does not hold the elements of a " +
+                                    element_type.c_type_string() + " tensor of the given shape");
+    }
+    py::ssize_t stride = info.itemsize;
+    for (py::ssize_t i = info.ndim - 1; i >= 0; --i)
+    {
+        if (info.shape[i] != 1 && info.strides[i] != stride)
+        {
+            throw std::invalid_argument("Buffer is not C-contiguous");
+        }
+        stride *= info.shape[i];
+    }
+    return self->create_tensor(element_type, shape, info.ptr);
+}
+
 static std::shared_ptr<ngraph::runtime::Backend> create(const std::string& type)
 {
     bool must_support_dynamic = false;
@@ -47,5 +75,9 @@ void regclass_pyngraph_runtime_Backend(py::module m)
                 (std::shared_ptr<ngraph::runtime::Tensor>(ngraph::runtime::Backend::*)(
                     const ngraph::element::Type&, const ngraph::Shape&)) &
                     ngraph::runtime::Backend::create_tensor);
+    backend.def("create_tensor",
+                &create_tensor_from_buffer,
+                py::keep_alive<0, 4>(),
+                "Create a tensor using the memory of a C-contiguous buffer without copying it");
     backend.def("compile", &compile);
 }
@@ -17,7 +17,10 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <stdexcept>
+
 #include "ngraph/descriptor/tensor.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "pyngraph/runtime/tensor.hpp"
 
@@ -33,11 +36,60 @@ static void write_(ngraph::runtime::Tensor* self, void* p, size_t n)
     self->write(p, n);
 }
 
+static std::string get_format(const ngraph::element::Type& element_type)
+{
+    switch (element_type)
+    {
+    case ngraph::element::Type_t::boolean: return py::format_descriptor<bool>::format();
+    case ngraph::element::Type_t::f16: return "e";
+    case ngraph::element::Type_t::f32: return py::format_descriptor<float>::format();
+    case ngraph::element::Type_t::f64: return py::format_descriptor<double>::format();
+    case ngraph::element::Type_t::i8: return py::format_descriptor<int8_t>::format();
+    case ngraph::element::Type_t::i16: return py::format_descriptor<int16_t>::format();
+    case ngraph::element::Type_t::i32: return py::format_descriptor<int32_t>::format();
+    case ngraph::element::Type_t::i64: return py::format_descriptor<int64_t>::format();
+    case ngraph::element::Type_t::u8: return py::format_descriptor<uint8_t>::format();
+    case ngraph::element::Type_t::u16: return py::format_descriptor<uint16_t>::format();
+    case ngraph::element::Type_t::u32: return py::format_descriptor<uint32_t>::format();
+    case ngraph::element::Type_t::u64: return py::format_descriptor<uint64_t>::format();
+    default:
+        throw std::invalid_argument("Element type " + element_type.c_type_string() +
+                                    " has no buffer format");
+    }
+}
+
+// Exposes the memory of host tensors, so that e.g. numpy.asarray(tensor) views it without
+// copying. The memory of other tensors is not accessible; use read() instead.
+static py::buffer_info get_buffer(ngraph::runtime::Tensor& self)
+{
+    auto host_tensor = dynamic_cast<ngraph::runtime::HostTensor*>(&self);
+    if (host_tensor == nullptr)
+    {
+        throw std::runtime_error("Tensor memory is not accessible from the host");
+    }
+    const auto& element_type = self.get_element_type();
+    const auto& shape = self.get_shape();
+    std::vector<py::ssize_t> strides(shape.size());
+    py::ssize_t stride = element_type.size();
+    for (size_t i = shape.size(); i > 0; --i)
+    {
+        strides[i - 1] = stride;
+        stride *= shape[i - 1];
+    }
+    return py::buffer_info(host_tensor->get_data_ptr(),
+                           element_type.size(),
+                           get_format(element_type),
+                           shape.size(),
+                           std::vector<py::ssize_t>(shape.begin(), shape.end()),
+                           strides);
+}
+
 void regclass_pyngraph_runtime_Tensor(py::module m)
 {
-    py::class_<ngraph::runtime::Tensor, std::shared_ptr<ngraph::runtime::Tensor>> tensor(m,
-                                                                                         "Tensor");
+    py::class_<ngraph::runtime::Tensor, std::shared_ptr<ngraph::runtime::Tensor>> tensor(
+        m, "Tensor", py::buffer_protocol());
     tensor.doc() = "ngraph.impl.runtime.Tensor wraps ngraph::runtime::Tensor";
+    tensor.def_buffer(&get_buffer);
     tensor.def("write", &write_);
     tensor.def("read", &read_);
 
@@ -19,6 +19,7 @@ import json
 
 import ngraph as ng
 from ngraph.exceptions import UserInputError
+from ngraph.impl import Shape, Type
 
 import test
 from test.ngraph.util import get_runtime, run_op_node
@@ -211,3 +212,18 @@ def test_constant_get_data_unsigned_integer(data_type):
     node = ng.constant(input_data, dtype=data_type)
     retrieved_data = node.get_data()
     assert np.allclose(input_data, retrieved_data)
+
+
+def test_tensor_from_ndarray_shares_memory():
+    backend = ng.runtime(backend_name='INTERPRETER').backend
+    value = np.arange(6, dtype=np.float32).reshape(2, 3)
+    tensor = backend.create_tensor(Type.f32, Shape([2, 3]), value)
+    view = np.asarray(tensor)
+    assert np.shares_memory(view, value)
+    value[0, 0] = 42
+    assert view[0, 0] == 42
+
+    with pytest.raises(ValueError):
+        backend.create_tensor(Type.f32, Shape([3, 2]), value.T)
+    with pytest.raises(ValueError):
+        backend.create_tensor(Type.f64, Shape([2, 3]), value)
@@ -21,6 +21,7 @@
 #include "contrib/mlir/core/compiler.hpp"
 #include "contrib/mlir/core/ngraph_dialect/ops.hpp"
 #include "contrib/mlir/core/ngraph_dialect/type.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 
 #include <llvm/ADT/BitVector.h>
 #include <llvm/ADT/DenseSet.h>
@@ -50,6 +51,14 @@ static llvm::cl::opt<bool>
                              llvm::cl::init(true),
                              llvm::cl::desc("Enable inplace element wise optimization"));
 
+static llvm::cl::opt<bool> clEnableNgMemoryArena(
+    "ngraph-memory-arena",
+    llvm::cl::init(true),
+    llvm::cl::desc("Place all temporaries in a single arena passed in by the runtime"));
+
+// Alignment of each temporary within the arena, in bytes
+static const unsigned s_arenaAlignment = 64;
+
 // anonymous namespace
 // no need to expose any of the following outside of this file
 namespace
@@ -129,10 +138,29 @@ namespace
         MemoryAnalysis* m_memAnalysis;
     };
 
+    // Arena planner
+    // Runs after MemoryAssignment. Gives every temporary that has no buffer yet a buffer of its
+    // own, computes the live range of each buffer over the (single) block and packs the buffers
+    // into one arena so that buffers whose live ranges do not overlap share memory.
+    class ArenaPlanner
+    {
+    public:
+        ArenaPlanner(MemoryAnalysis* memAnalysis)
+            : m_memAnalysis(memAnalysis)
+        {
+        }
+        void run(ModuleOp* module);
+
+    private:
+        MemoryAnalysis* m_memAnalysis;
+    };
+
     // helpers
     // Determines the buffer size a value needs based on its type
     // offset is where that value should start in the buffer
     static unsigned getBufferSizeForOperand(mlir::Value* value, int offset);
+    // Checks if the value is an argument or a result of the sub-graph
+    static bool isInputOrOutputValue(mlir::Value* value);
 
     // Go backwards over instructions
     //
@@ -448,6 +476,11 @@ namespace
         }
     }
     bool MemoryAssignment::isInputOrOutputValue(mlir::Value* value)
+    {
+        return ::isInputOrOutputValue(value);
+    }
+
+    bool isInputOrOutputValue(mlir::Value* value)
     {
         auto defOp = value->getDefiningOp();
         // If no defining op, then this is a block arg, skip operand
@@ -482,6 +515,100 @@ namespace
         return it != m_inplaceOps.end() ? it->second : false;
     }
 
+    // Buffers are placed in program order:
+    //      - Every single-result op defining a temporary without a buffer assignment gets a new
+    //        buffer id at offset 0.
+    //      - A buffer is live from its first definition to the last use of any value in it.
+    //      - Buffers are allocated before the buffers dying at the same op are freed, so the
+    //        result of an op never overlaps its operands unless MemoryAssignment made it in-place.
+    void ArenaPlanner::run(ModuleOp* module)
+    {
+        if (!clEnableNgMemoryArena)
+        {
+            return;
+        }
+        SmallVector<FuncOp, 2> funcOps(module->getOps<FuncOp>());
+        if (funcOps.size() != 1 || funcOps.back().getBlocks().size() != 1)
+        {
+            // single block func for now
+            return;
+        }
+        auto& block = funcOps.back().getBlocks().front();
+
+        unsigned nextBufferId = m_memAnalysis->getNumBuffers();
+        std::map<unsigned, std::pair<unsigned, unsigned>> liveRanges;
+        std::unordered_map<Operation*, unsigned> opIndex;
+        unsigned index = 0;
+        for (auto& op : block)
+        {
+            opIndex[&op] = index++;
+        }
+        for (auto& op : block)
+        {
+            if (op.getNumResults() != 1 || !op.getResult(0)->getType().isa<NGTensorType>())
+            {
+                continue;
+            }
+            auto bufferInfo = m_memAnalysis->getBufferInfo(&op);
+            if (!bufferInfo.isValid())
+            {
+                if (isInputOrOutputValue(op.getResult(0)))
+                {
+                    continue;
+                }
+                bufferInfo = {static_cast<int>(nextBufferId++), 0};
+                m_memAnalysis->setBufferInfo(&op, bufferInfo);
+                m_memAnalysis->setBufferSize(bufferInfo.m_bufferId,
+                                             getBufferSizeForOperand(op.getResult(0), 0));
+            }
+            unsigned begin = opIndex[&op];
+            unsigned end = begin;
+            for (auto& use : op.getResult(0)->getUses())
+            {
+                end = std::max(end, opIndex[use.getOwner()]);
+            }
+            auto it = liveRanges.find(bufferInfo.m_bufferId);
+            if (it == liveRanges.end())
+            {
+                liveRanges[bufferInfo.m_bufferId] = {begin, end};
+            }
+            else
+            {
+                it->second.first = std::min(it->second.first, begin);
+                it->second.second = std::max(it->second.second, end);
+            }
+        }
+        if (liveRanges.empty())
+        {
+            return;
+        }
+
+        std::vector<std::vector<unsigned>> starts(index), ends(index);
+        for (auto& entry : liveRanges)
+        {
+            starts[entry.second.first].push_back(entry.first);
+            ends[entry.second.second].push_back(entry.first);
+        }
+        ngraph::pass::MemoryPacker packer(s_arenaAlignment);
+        std::unordered_map<unsigned, size_t> packerIds;
+        for (unsigned i = 0; i < index; i++)
+        {
+            for (auto bufferId : starts[i])
+            {
+                packerIds[bufferId] = packer.allocate(m_memAnalysis->getBufferSize(bufferId));
+            }
+            for (auto bufferId : ends[i])
+            {
+                packer.free(packerIds[bufferId]);
+            }
+        }
+        m_memAnalysis->setArenaSize(packer.pack());
+        for (auto& entry : packerIds)
+        {
+            m_memAnalysis->setArenaOffset(entry.first, packer.get_offset(entry.second));
+        }
+    }
+
     void AliasRelation::init(std::unordered_set<Value*>& symbols)
     {
         unsigned numSyms = symbols.size();
@@ -609,5 +736,7 @@ namespace mlir
         auto moduleOp = dyn_cast<ModuleOp>(op);
         NGRAPH_CHECK(moduleOp != nullptr, "Expecting FuncOp for anaylsis");
         memoryAssignment.run(&moduleOp);
+        ArenaPlanner arenaPlanner(this);
+        arenaPlanner.run(&moduleOp);
     }
 } // namespace mlir
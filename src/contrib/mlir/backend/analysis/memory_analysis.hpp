@@ -69,11 +69,31 @@ namespace mlir
             NGRAPH_CHECK(it != m_bufferSize.end(), "Buffer has no size!");
             return it->second;
         }
+        // Number of buffer ids assigned so far
+        unsigned getNumBuffers() const { return m_bufferSize.size(); }
+        // When an arena is planned, every buffer lives at a fixed byte offset in one arena that
+        // the caller passes to the function. An arena size of zero means buffers are allocated
+        // individually.
+        void setArenaOffset(unsigned bufferId, unsigned offset)
+        {
+            m_arenaOffset[bufferId] = offset;
+        }
+        unsigned getArenaOffset(unsigned bufferId)
+        {
+            auto it = m_arenaOffset.find(bufferId);
+            NGRAPH_CHECK(it != m_arenaOffset.end(), "Buffer is not in the arena!");
+            return it->second;
+        }
+        void setArenaSize(unsigned size) { m_arenaSize = size; }
+        unsigned getArenaSize() const { return m_arenaSize; }
 
     private:
         // Records assignment of BufferInfo to each inplace op
         BufferInfoMap m_bufferInfo;
         // Records buffer size required for each buffer id in bytes
         BufferSizeMap m_bufferSize;
+        // Records the arena byte offset of each buffer id
+        BufferSizeMap m_arenaOffset;
+        unsigned m_arenaSize = 0;
     };
 }
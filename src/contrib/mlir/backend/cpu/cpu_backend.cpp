@@ -50,12 +50,12 @@ static llvm::cl::opt<bool> clEnableNgInPlaceMemoryOpt(
 
 static llvm::cl::opt<bool>
     clEnableAffineLoopFusion("ngraph-affine-loop-fusion",
-                             llvm::cl::init(false),
+                             llvm::cl::init(true),
                              llvm::cl::desc("Enable loop fusion optimization in Affine dialect"));
 
 static llvm::cl::opt<bool>
     clEnableAffineLoopTiling("ngraph-affine-loop-tile",
-                             llvm::cl::init(false),
+                             llvm::cl::init(true),
                              llvm::cl::desc("Enable loop tiling optimization in Affine dialect"));
 
 static llvm::cl::opt<unsigned>
@@ -71,6 +71,16 @@ static llvm::cl::opt<unsigned> clLoopTilingCacheSize(
         "inferred from the host CPU using for the cache level specified by "
         "-ngraph-loop-tile-cache-level."));
 
+static llvm::cl::opt<bool> clEnableAffineUnrollJam(
+    "ngraph-affine-unroll-jam",
+    llvm::cl::init(true),
+    llvm::cl::desc("Enable loop unroll-and-jam optimization in Affine dialect"));
+
+static llvm::cl::opt<int> clUnrollJamFactor(
+    "ngraph-affine-unroll-jam-factor",
+    llvm::cl::init(4),
+    llvm::cl::desc("Unroll-and-jam factor. If negative, the factor is chosen by the pass."));
+
 using namespace ngraph::runtime::ngmlir;
 
 // Default optimization level.
@@ -247,6 +257,14 @@ void MLIRCPUBackend::optimizeAffineDialect()
         pm.addPass(mlir::createLoopTilingPass(cacheLevelSize));
     }
 
+    // Unroll-and-jam the outer loop of the (tiled) nests so that the innermost loop body reuses
+    // values across several outer iterations. The innermost loops are left for the LLVM loop
+    // vectorizer, which runs as part of the optimizing transformer at JIT time.
+    if (clEnableAffineUnrollJam)
+    {
+        pm.addPass(mlir::createLoopUnrollAndJamPass(clUnrollJamFactor));
+    }
+
     // Populate pass manager with affine dialect to Std dialect conversion.
     pm.addPass(mlir::createLowerAffinePass());
 
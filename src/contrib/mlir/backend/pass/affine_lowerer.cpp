@@ -96,9 +96,10 @@ namespace
     class FuncOpSignatureConversion : public ConversionPattern
     {
     public:
-        FuncOpSignatureConversion(MLIRContext* ctx, TypeConverter& converter)
+        FuncOpSignatureConversion(MLIRContext* ctx, TypeConverter& converter, unsigned arenaSize)
             : ConversionPattern(FuncOp::getOperationName(), 1, ctx)
             , converter(converter)
+            , arenaSize(arenaSize)
         {
         }
 
@@ -134,6 +135,13 @@ namespace
                 result.addInputs(convertedResults);
             }
 
+            if (arenaSize > 0)
+            {
+                // The arena holding all the temporaries is the last arg
+                result.addInputs(
+                    MemRefType::get({arenaSize}, IntegerType::get(8, funcOp.getContext()), {}));
+            }
+
             // Create a new function with an updated signature.
             auto newFuncOp = rewriter.cloneWithoutRegions(funcOp);
             rewriter.inlineRegionBefore(funcOp.getBody(), newFuncOp.getBody(), newFuncOp.end());
@@ -148,6 +156,8 @@ namespace
 
         /// The type converter to use when rewriting the signature.
         TypeConverter& converter;
+        /// Size in bytes of the temporaries arena, zero if there is none.
+        unsigned arenaSize;
     };
 
     // Helpers
@@ -157,6 +167,12 @@ namespace
                              PatternRewriter& rewriter,
                              DialectLoweringPass& pass);
 
+    template <typename RedOp>
+    void lowerAxisReduction(Operation* op,
+                            ArrayRef<Value*> operands,
+                            PatternRewriter& rewriter,
+                            DialectLoweringPass& pass);
+
     template <typename OP>
     void lowerBinaryElementwise(Operation* op,
                                 ArrayRef<Value*> operands,
@@ -232,6 +248,8 @@ namespace
         /// Allocates a linear buffer for a temporary memref that shares its
         /// underlying memory. Used in conjunction with createTempMemref
         Value* createTempBuffer(int bufferId, PatternRewriter& rewriter);
+        /// Returns the function arg holding the temporaries arena
+        Value* getArena(FuncOp f);
         /// Creates an allocation or view of a memref.
         /// type     MemRef Type
         /// buffer   Optional buffer value to create view over
@@ -281,11 +299,19 @@ namespace
         NGraphTypeConverter converter;
         OwningRewritePatternList patterns;
 
-        populateNGraphToAffineConversionPatterns(patterns);
-
         // Get Memory analysis for in-place memory optimizations
         m_memAnalysis = &getAnalysis<MemoryAnalysis>();
 
+        populateNGraphToAffineConversionPatterns(patterns);
+
+        // The runtime allocates the arena and passes it as the last argument
+        if (m_memAnalysis->getArenaSize() > 0)
+        {
+            auto arenaSize = m_memAnalysis->getArenaSize();
+            getModule().setAttr("ngraph.arena_size",
+                                IntegerAttr::get(IntegerType::get(64, &getContext()), arenaSize));
+        }
+
         // Create target that defines legal ops for nGraph dialect to be lowered to.
         ConversionTarget target(getContext());
 
@@ -336,7 +362,8 @@ namespace
             >(&getContext(), *this);
 
         // FuncOp pattern
-        patterns.insert<FuncOpSignatureConversion>(&getContext(), typeConverter);
+        patterns.insert<FuncOpSignatureConversion>(
+            &getContext(), typeConverter, m_memAnalysis->getArenaSize());
     }
 
     void DialectLoweringPass::findOutputValues()
@@ -401,6 +428,16 @@ namespace
                     // Allocate new memref
                     newResult = createTempMemref(memRefType, nullptr, 0, rewriter);
                 }
+                else if (m_memAnalysis->getArenaSize() > 0)
+                {
+                    // Create a view at the planned offset of the buffer in the arena
+                    unsigned elemBytes = std::max(
+                        1u, memRefType.cast<MemRefType>().getElementTypeBitWidth() / 8);
+                    unsigned offset =
+                        m_memAnalysis->getArenaOffset(bufferInfo.m_bufferId) / elemBytes +
+                        bufferInfo.m_offset;
+                    newResult = createTempMemref(memRefType, getArena(f), offset, rewriter);
+                }
                 else
                 {
                     unsigned bufferId = bufferInfo.m_bufferId;
@@ -455,6 +492,13 @@ namespace
         return alloc;
     }
 
+    Value* DialectLoweringPass::getArena(FuncOp f)
+    {
+        mlir::Block* entryBlock = &*(f.begin());
+        NGRAPH_CHECK(entryBlock->getNumArguments() > 0, "Arena arg not found");
+        return entryBlock->getArgument(entryBlock->getNumArguments() - 1);
+    }
+
     Value* DialectLoweringPass::createTempMemref(Type type,
                                                  Value* buffer,
                                                  unsigned offset,
@@ -480,8 +524,10 @@ namespace
 
             auto map = makeStridedLinearLayoutMap(strides, offset, rewriter.getContext());
             MemRefType newMemRefType = MemRefType::get(shape, memRefType.getElementType(), map);
-            auto viewOp = rewriter.create<mlir::ViewOp>(
-                buffer->getDefiningOp()->getLoc(), newMemRefType, buffer, llvm::None);
+            // The arena is a function arg and has no defining op
+            auto loc = buffer->getDefiningOp() ? buffer->getDefiningOp()->getLoc()
+                                               : rewriter.getUnknownLoc();
+            auto viewOp = rewriter.create<mlir::ViewOp>(loc, newMemRefType, buffer, llvm::None);
             return viewOp.getResult();
         }
 
@@ -669,6 +715,69 @@ namespace
         return matchSuccess();
     }
 
+    REWRITER(NGSumRedOp)
+    {
+        lowerAxisReduction<mlir::NGSumRedOp>(op, operands, rewriter, pass);
+        return matchSuccess();
+    }
+
+    REWRITER(NGProdRedOp)
+    {
+        lowerAxisReduction<mlir::NGProdRedOp>(op, operands, rewriter, pass);
+        return matchSuccess();
+    }
+
+    REWRITER(NGMaxRedOp)
+    {
+        lowerAxisReduction<mlir::NGMaxRedOp>(op, operands, rewriter, pass);
+        return matchSuccess();
+    }
+
+    REWRITER(NGMinRedOp)
+    {
+        lowerAxisReduction<mlir::NGMinRedOp>(op, operands, rewriter, pass);
+        return matchSuccess();
+    }
+
+    // Broadcast
+    REWRITER(NGBroadcastOp)
+    {
+        auto broadcast = cast<NGBroadcastOp>(op);
+        auto loc = broadcast.getLoc();
+
+        ScopedContext scope(rewriter, loc);
+        Value* arg = operands[0];
+        Value* result = pass.buildOutputDefs(op, rewriter)[0];
+        NGRAPH_CHECK(arg && result, "Unexpected null values in BroadcastOp");
+
+        MemRefView vRes(result);
+        IndexedValue iRes(result), iArg(arg);
+        SmallVector<bool, 4> isBroadcastAxis(vRes.rank(), false);
+        for (auto axis : broadcast.axisSet().getValue())
+        {
+            isBroadcastAxis[axis.cast<IntegerAttr>().getInt()] = true;
+        }
+
+        // for <r_0 .. r_n> : <0 .. 0> -> <R_0 .. R_n>
+        //   Result[r_0 .. r_n] = Arg[r_i for each i not in axisSet]
+        auto ivs = makeIndexHandles(vRes.rank());
+        auto pivs = makeHandlePointers(MutableArrayRef<IndexHandle>(ivs));
+        SmallVector<IndexHandle, 8> argIVs;
+        AffineLoopNestBuilder(pivs, vRes.getLbs(), vRes.getUbs(), vRes.getSteps())([&] {
+            for (auto i = 0; i < vRes.rank(); i++)
+            {
+                if (!isBroadcastAxis[i])
+                {
+                    argIVs.push_back(ivs[i]);
+                }
+            }
+            iRes(ivs) = iArg(argIVs);
+        });
+
+        rewriter.replaceOp(op, result);
+        return matchSuccess();
+    }
+
     // Relu
     REWRITER(NGReluOp)
     {
@@ -2067,6 +2176,106 @@ namespace
         rewriter.replaceOp(op, result);
     }
 
+    template <typename RedOp>
+    void lowerAxisReduction(Operation* op,
+                            ArrayRef<Value*> operands,
+                            PatternRewriter& rewriter,
+                            DialectLoweringPass& pass)
+    {
+        static_assert(std::is_same<RedOp, NGSumRedOp>() || std::is_same<RedOp, NGProdRedOp>() ||
+                          std::is_same<RedOp, NGMaxRedOp>() || std::is_same<RedOp, NGMinRedOp>(),
+                      "Template parameter is not supported by lowerAxisReduction");
+
+        RedOp redOp = cast<RedOp>(op);
+        auto loc = redOp.getLoc();
+
+        NGRAPH_CHECK(operands.size() == 1 && operands[0] != nullptr,
+                     "Expected one non-null operand in Axis Reduction op");
+
+        // Retrieve/generate Values for operands and result.
+        ScopedContext scope(rewriter, loc);
+        Value* arg = operands[0];
+        Value* result = pass.buildOutputDefs(op, rewriter)[0];
+
+        // Views
+        MemRefView vRes(result), vArg(arg);
+        // Index Values
+        IndexedValue iRes(result), iArg(arg);
+        StdIndexedValue stdArg(arg);
+        SmallVector<bool, 4> isRedAxis(vArg.rank(), false);
+        for (auto axis : redOp.axes().getValue())
+        {
+            isRedAxis[axis.template cast<IntegerAttr>().getInt()] = true;
+        }
+
+        Type elemTy = result->getType().cast<MemRefType>().getElementType();
+        // Generate loop nest that initializes the result. Sum and product start from their
+        // identity, max and min from the first element along the reduced axes.
+        {
+            auto ivs = makeIndexHandles(vRes.rank());
+            auto pivs = makeHandlePointers(MutableArrayRef<IndexHandle>(ivs));
+            AffineLoopNestBuilder(pivs, vRes.getLbs(), vRes.getUbs(), vRes.getSteps())([&] {
+                if (std::is_same<RedOp, NGSumRedOp>())
+                {
+                    iRes(ivs) = createZeroConstant(elemTy);
+                }
+                else if (std::is_same<RedOp, NGProdRedOp>())
+                {
+                    iRes(ivs) = createOneConstant(elemTy);
+                }
+                else
+                {
+                    SmallVector<IndexHandle, 8> firstIVs;
+                    for (auto i = 0, j = 0; i < vArg.rank(); i++)
+                    {
+                        firstIVs.push_back(isRedAxis[i] ? IndexHandle(vArg.lb(i)) : ivs[j++]);
+                    }
+                    iRes(ivs) = stdArg(firstIVs);
+                }
+            });
+        }
+
+        // Generate loop nest that computes the actual reduction.
+        {
+            auto allIVs = makeIndexHandles(vArg.rank());
+            auto pAllIVs = makeHandlePointers(MutableArrayRef<IndexHandle>(allIVs));
+            SmallVector<IndexHandle, 8> nonRedIVs;
+
+            // iterate over all argument dimensions
+            AffineLoopNestBuilder(pAllIVs, vArg.getLbs(), vArg.getUbs(), vArg.getSteps())([&] {
+                // build a list of non-reduction IVs
+                for (auto i = 0; i < vArg.rank(); i++)
+                {
+                    if (!isRedAxis[i])
+                    {
+                        nonRedIVs.push_back(allIVs[i]);
+                    }
+                }
+
+                ValueHandle curr = iRes(nonRedIVs);
+                ValueHandle val = iArg(allIVs);
+                if (std::is_same<RedOp, NGSumRedOp>())
+                {
+                    iRes(nonRedIVs) = curr + val;
+                }
+                else if (std::is_same<RedOp, NGProdRedOp>())
+                {
+                    iRes(nonRedIVs) = curr * val;
+                }
+                else if (std::is_same<RedOp, NGMaxRedOp>())
+                {
+                    iRes(nonRedIVs) = edsc::intrinsics::select(curr < val, val, curr);
+                }
+                else
+                {
+                    iRes(nonRedIVs) = edsc::intrinsics::select(val < curr, val, curr);
+                }
+            });
+        }
+
+        rewriter.replaceOp(op, result);
+    }
+
     template <typename OP>
     void lowerPooling(Operation* op,
                       ArrayRef<Value*> operands,
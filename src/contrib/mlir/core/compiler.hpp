@@ -19,7 +19,6 @@
 
 #pragma once
 
-#include "contrib/mlir/runtime/cpu/memory_manager.hpp"
 #include "ngraph/check.hpp"
 #include "ngraph/descriptor/tensor.hpp"
 #include "ngraph/node.hpp"
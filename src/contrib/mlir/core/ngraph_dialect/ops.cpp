@@ -92,7 +92,17 @@ static mlir::LogicalResult verifyBinaryArithOp(T* op)
 template <typename T>
 static mlir::LogicalResult verifyAxisReductionOp(T* op)
 {
-    return mlir::failure();
+    auto operandType = op->operand()->getType().template cast<NGTensorType>();
+    auto resType = op->res()->getType().template cast<NGTensorType>();
+    auto axes = op->axes().getValue();
+    for (auto axis : axes)
+    {
+        if (axis.template cast<mlir::IntegerAttr>().getInt() >= operandType.getRank())
+            return op->emitOpError("Reduction axis is larger than operand rank");
+    }
+    if (resType.getRank() + (int)axes.size() != operandType.getRank())
+        return op->emitOpError("Incompatible result shape and/or type");
+    return mlir::success();
 }
 
 template <typename T>
@@ -180,6 +190,16 @@ static mlir::LogicalResult verifyCmpOp(T* op)
     return mlir::success();
 }
 
+template <>
+mlir::LogicalResult verifyOp(NGBroadcastOp* op)
+{
+    NGTensorType argType = op->arg()->getType().cast<NGTensorType>();
+    NGTensorType resType = op->res()->getType().cast<NGTensorType>();
+    if (resType.getRank() != argType.getRank() + (int)op->axisSet().size())
+        return op->emitOpError("Incompatible result shape and/or type");
+    return mlir::success();
+}
+
 template <>
 mlir::LogicalResult verifyOp(NGGatherOp* op)
 {
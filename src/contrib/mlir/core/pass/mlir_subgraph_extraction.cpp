@@ -78,6 +78,7 @@ void MLIRSubgraphExtractionPass::MLIRSubgraph::add_node(std::shared_ptr<Node> no
 bool MLIRSubgraphExtractionPass::run_on_function(std::shared_ptr<Function> func)
 {
     build_subgraphs(func);
+    remove_unprofitable_subgraphs();
     auto ck_nodes = build_ck_nodes(func);
 
 #ifdef NGRAPH_DEBUG_ENABLE
@@ -364,6 +365,66 @@ ngraph::NodeVector MLIRSubgraphExtractionPass::build_ck_nodes(std::shared_ptr<Fu
     return ck_nodes;
 }
 
+bool MLIRSubgraphExtractionPass::is_profitable(MLIRSubgraph& sg)
+{
+    static const size_t kernel_overhead_bytes = []() -> size_t {
+        const auto env = std::getenv("NGRAPH_MLIR_KERNEL_OVERHEAD_BYTES");
+        return env == nullptr ? 1024 : std::atoi(env);
+    }();
+
+    auto& nodes = sg.get_nodes();
+    std::unordered_set<Node*> node_set;
+    for (auto& node : nodes)
+    {
+        node_set.insert(node.get());
+    }
+
+    size_t internal_bytes = 0;
+    for (auto& node : nodes)
+    {
+        if (TI(ngraph::op::Dot) == TI(*node) || TI(ngraph::op::MatMul) == TI(*node) ||
+            TI(ngraph::op::Gemm) == TI(*node) || TI(ngraph::op::Convolution) == TI(*node) ||
+            TI(ngraph::op::GroupConvolution) == TI(*node))
+        {
+            return true;
+        }
+        // Tensors produced and consumed inside the sub-graph no longer cross a kernel boundary
+        for (auto output : node->outputs())
+        {
+            for (auto input : output.get_target_inputs())
+            {
+                if (node_set.count(input.get_node()) != 0)
+                {
+                    internal_bytes +=
+                        shape_size(output.get_shape()) * output.get_element_type().size();
+                    break;
+                }
+            }
+        }
+    }
+    return internal_bytes >= kernel_overhead_bytes;
+}
+
+void MLIRSubgraphExtractionPass::remove_unprofitable_subgraphs()
+{
+    // Dropping a sub-graph leaves its nodes in the function. This cannot introduce cycles since
+    // the remaining sub-graphs were already acyclic with respect to each other.
+    for (auto it = m_id_to_graph.begin(); it != m_id_to_graph.end();)
+    {
+        if (is_profitable(it->second))
+        {
+            it++;
+            continue;
+        }
+        NGRAPH_DEBUG << "[CK Extract] Dropping unprofitable sub-graph " << it->first;
+        for (auto& node : it->second.get_nodes())
+        {
+            m_node_to_graph.erase(node);
+        }
+        it = m_id_to_graph.erase(it);
+    }
+}
+
 // Do a sanity check on graph invariants
 //  - no cycles
 //  - inputs to sub-graph are inputs to CK
@@ -557,6 +618,17 @@ bool MLIRSubgraphExtractionPass::is_supported_mlir_op(std::shared_ptr<Node> node
                node->get_input_element_type(0) == element::f32;
     }
 
+    if (TI(ngraph::op::Sum) == TI(*node) || TI(ngraph::op::Product) == TI(*node) ||
+        TI(ngraph::op::Max) == TI(*node) || TI(ngraph::op::Min) == TI(*node))
+    {
+        // Reduction axes must be constant. Reductions to a scalar are not lowered yet.
+        auto reduction = static_cast<ngraph::op::util::ArithmeticReduction*>(node.get());
+        auto et = node->get_element_type();
+        return reduction->reduction_axes_constant() && node->get_shape().size() > 0 &&
+               (et == element::f32 || et == element::f64 ||
+                (et.is_integral() && et != element::boolean));
+    }
+
     if (TI(ngraph::op::MatMul) == TI(*node))
     {
         // MatMul is only supported through callback
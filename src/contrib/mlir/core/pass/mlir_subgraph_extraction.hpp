@@ -104,6 +104,11 @@ namespace ngraph
             void build_subgraphs(std::shared_ptr<Function> func);
             NodeVector build_ck_nodes(std::shared_ptr<Function> func);
             void process_supported_op(std::shared_ptr<ngraph::Node> node, int current_subgraph_id);
+            /// Cost model: a sub-graph is worth a CompiledKernel if it contains a compute bound
+            /// op, or if the bytes of the tensors it keeps internal cover the overhead of a kernel
+            /// boundary (NGRAPH_MLIR_KERNEL_OVERHEAD_BYTES, 1024 by default).
+            bool is_profitable(MLIRSubgraph& sg);
+            void remove_unprofitable_subgraphs();
 
             void sanity_check(std::shared_ptr<Function> func, NodeVector& ck_nodes);
             void clean_up();
@@ -103,6 +103,9 @@ namespace
         template <typename RedOp>
         mlir::Operation* createIndexReduction(const ngraph::Node* ngNode);
 
+        template <typename RedOp>
+        mlir::Operation* createAxisReduction(const ngraph::Node* ngNode);
+
         void createReturn();
 
         /// Converts nGraph shape-like types \p ng_shape to MLIR shape \p mlir_shape.
@@ -401,6 +404,41 @@ mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::ArgMin)
     return NgDialectObj.createIndexReduction<mlir::NGArgMinRedOp>(ngNode);
 }
 
+template <>
+mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::Sum)
+{
+    return NgDialectObj.createAxisReduction<mlir::NGSumRedOp>(ngNode);
+}
+
+template <>
+mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::Product)
+{
+    return NgDialectObj.createAxisReduction<mlir::NGProdRedOp>(ngNode);
+}
+
+template <>
+mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::Max)
+{
+    return NgDialectObj.createAxisReduction<mlir::NGMaxRedOp>(ngNode);
+}
+
+template <>
+mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::Min)
+{
+    return NgDialectObj.createAxisReduction<mlir::NGMinRedOp>(ngNode);
+}
+
+template <>
+mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::Broadcast)
+{
+    auto broadcastNode = static_cast<const ngraph::op::Broadcast*>(ngNode);
+    auto op = NgDialectObj.createGenericOp<mlir::NGBroadcastOp>(ngNode);
+    auto broadcastOp = llvm::cast<mlir::NGBroadcastOp>(op);
+    broadcastOp.setShape(NgDialectObj.getShapeAsAttr(broadcastNode->get_broadcast_shape()));
+    broadcastOp.setAxisSet(NgDialectObj.getShapeAsAttr(broadcastNode->get_broadcast_axes()));
+    return op;
+}
+
 template <>
 mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::Dot)
 {
@@ -682,6 +720,17 @@ mlir::Operation* NgDialectConversionPass::createIndexReduction(const ngraph::Nod
     return op;
 }
 
+template <typename RedOp>
+mlir::Operation* NgDialectConversionPass::createAxisReduction(const ngraph::Node* ngNode)
+{
+    // Reduction axes are a constant input outside of the sub-graph. Only the data is an operand.
+    auto op = createGenericOp<RedOp>(ngNode, 1);
+    auto originArg = getOriginArg(ngNode->input_value(1).get_node());
+    auto constOp = static_cast<ngraph::op::Constant*>(originArg);
+    op->setAttr("axes", getShapeAsAttr(constOp->get_axis_set_val()));
+    return op;
+}
+
 std::unique_ptr<mlir::Pass>
     ngraph::pass::createNgDialectConversionPass(const ngraph::op::CompiledKernel* compiledKernel,
                                                 mlir::MLIRContext* context)
@@ -53,81 +53,113 @@ static llvm::cl::opt<std::string>
     clObjectFilename("ngraph-mlir-object-filename",
                      llvm::cl::desc("Dump MLIR JITted-compiled object to file jitted_mlir.o"));
 
-void MLIRCPURuntime::run(const std::vector<MemRefArg>& args)
+void MLIRCPURuntime::compile()
 {
-    // run_internal(*reinterpret_cast<std::vector<void*>*>(args), shapeVec, stridesVec);
-    run_internal(args);
-}
+    std::call_once(m_compileOnce, [this]() {
+        NGRAPH_CHECK(m_module, "MLIR module is not ready.");
+        auto func = m_module->lookupSymbol<mlir::LLVM::LLVMFuncOp>("main");
+        NGRAPH_CHECK(func && !func.getBlocks().empty(), "Function not found");
+        if (auto arenaSize = m_module->getAttrOfType<mlir::IntegerAttr>("ngraph.arena_size"))
+        {
+            m_arenaSize = arenaSize.getInt();
+        }
 
-void MLIRCPURuntime::run_internal(const std::vector<MemRefArg>& args)
-{
-    // Create an MLIR execution engine. We use a null MLIR pass manager for now to make sure we
-    // don't run MLIR passes that were already run. We also pass a default transformer created with
-    // the default or user-provided optimization level.
-
-    auto llvmTransformer = mlir::makeOptimizingTransformer(
-        MLIRCPUBackend::mlirOptLevel, /*sizeLevel=*/0, MLIRCPUBackend::targetMachine.get());
-    auto maybeEngine = mlir::ExecutionEngine::create(
-        m_module.get(), llvmTransformer, MLIRCPUBackend::mlirOptLevel);
-    NGRAPH_CHECK(maybeEngine, "failed to construct an execution engine");
-    m_engine = std::move(maybeEngine.get());
-
-    bindArguments(args);
-    execute();
-    cleanup();
+        // Create an MLIR execution engine. We use a null MLIR pass manager for now to make sure we
+        // don't run MLIR passes that were already run. We also pass a default transformer created
+        // with the default or user-provided optimization level.
+        auto llvmTransformer = mlir::makeOptimizingTransformer(
+            MLIRCPUBackend::mlirOptLevel, /*sizeLevel=*/0, MLIRCPUBackend::targetMachine.get());
+        auto maybeEngine = mlir::ExecutionEngine::create(
+            m_module.get(), llvmTransformer, MLIRCPUBackend::mlirOptLevel);
+        NGRAPH_CHECK(maybeEngine, "failed to construct an execution engine");
+        m_engine = std::move(maybeEngine.get());
+    });
 }
 
-// Binds MLIR function arguments to the proper values. This includes externally allocated tensors
-// helpers to be used inside the function.
-void MLIRCPURuntime::bindArguments(const std::vector<MemRefArg>& args)
+void MLIRCPURuntime::run(const std::vector<MemRefArg>& args)
 {
-    NGRAPH_CHECK(m_module, "MLIR module is not ready.");
+    compile();
 
-    auto func = m_module->lookupSymbol<mlir::LLVM::LLVMFuncOp>("main");
-    NGRAPH_CHECK(func && !func.getBlocks().empty(), "Function not found");
+    // Concurrent calls each take their own invocation arguments and arena
+    auto state = acquireCallState(args);
+    bindArguments(args, state->invokeArgs);
+    execute(state->invokeArgs);
+    releaseCallState(std::move(state));
+}
 
-    // Set external arguments
-    m_externalTensors = &args;
+std::unique_ptr<MLIRCPURuntime::CallState>
+    MLIRCPURuntime::acquireCallState(const std::vector<MemRefArg>& args)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_callStatesMutex);
+        if (!m_callStates.empty())
+        {
+            auto state = std::move(m_callStates.back());
+            m_callStates.pop_back();
+            return state;
+        }
+    }
 
     // Create list with a type-erased double pointer for each invocation arguments.
     // We currently use 'allocateMemrefArgs', which creates the arguments list per call ABI (see
     // comment below).
     // StaticMemRef is just a struct with the actual pointer to the data.
-
-    for (auto i = 0; i < m_externalTensors->size(); i++)
+    std::unique_ptr<CallState> state(new CallState());
+    state->invokeArgs = allocateMemrefArgs(args);
+    NGRAPH_CHECK(state->invokeArgs.size(), "Arguments can't be created");
+    if (m_arenaSize > 0)
     {
-        m_ranks.push_back((*m_externalTensors)[i].m_shape.size());
+        // The arena is the last function argument. Its descriptor never changes.
+        state->arena.reset(new AlignedBuffer(m_arenaSize, 64));
+        auto* arena = allocateMemrefDescriptor(1);
+        arena->allocatedPtr = state->arena->get_ptr();
+        arena->alignedPtr = state->arena->get_ptr();
+        arena->shapeAndStrides[0] = m_arenaSize;
+        arena->shapeAndStrides[1] = 1;
+        StaticMemRef** arg = reinterpret_cast<StaticMemRef**>(malloc(sizeof(StaticMemRef*)));
+        *arg = arena;
+        state->invokeArgs.push_back(arg);
     }
-    auto expectedArguments = allocateMemrefArgs();
-    NGRAPH_CHECK(expectedArguments.size(), "Arguments can't be created");
-    m_invokeArgs = std::move(expectedArguments);
+    return state;
+}
 
-    NGRAPH_CHECK(m_invokeArgs.size() == m_externalTensors->size(),
+void MLIRCPURuntime::releaseCallState(std::unique_ptr<CallState> state)
+{
+    std::lock_guard<std::mutex> lock(m_callStatesMutex);
+    m_callStates.push_back(std::move(state));
+}
+
+// Binds MLIR function arguments to the proper values. This includes externally allocated tensors
+// helpers to be used inside the function.
+void MLIRCPURuntime::bindArguments(const std::vector<MemRefArg>& args,
+                                   SmallVector<void*, 8>& invokeArgs)
+{
+    NGRAPH_CHECK(invokeArgs.size() == args.size() + (m_arenaSize > 0 ? 1 : 0),
                  "Number of external tensors doesn't match number of function arguments");
 
     // Assign external tensor pointers to invocation arguments.
-    for (size_t i = 0, numArgs = m_invokeArgs.size(); i < numArgs; ++i)
+    for (size_t i = 0, numArgs = args.size(); i < numArgs; ++i)
     {
-        auto* memRefArg = *(reinterpret_cast<StaticMemRef**>(m_invokeArgs[i]));
-        memRefArg->allocatedPtr = (*m_externalTensors)[i].m_tensor;
-        memRefArg->alignedPtr = (*m_externalTensors)[i].m_tensor;
-        auto rank = m_ranks[i];
+        auto* memRefArg = *(reinterpret_cast<StaticMemRef**>(invokeArgs[i]));
+        memRefArg->allocatedPtr = args[i].m_tensor;
+        memRefArg->alignedPtr = args[i].m_tensor;
+        auto rank = args[i].m_shape.size();
         for (auto j = 0; j < rank; j++)
         {
-            memRefArg->shapeAndStrides[j] = (*m_externalTensors)[i].m_shape[j];
-            memRefArg->shapeAndStrides[rank + j] = (*m_externalTensors)[i].m_strides[j];
+            memRefArg->shapeAndStrides[j] = args[i].m_shape[j];
+            memRefArg->shapeAndStrides[rank + j] = args[i].m_strides[j];
         }
     }
 }
 
 // Lowers standard dialect to LLVM dialect and uses the MLIR execution engine to execute the code.
-void MLIRCPURuntime::execute()
+void MLIRCPURuntime::execute(SmallVector<void*, 8>& invokeArgs)
 {
     // Invoke the JIT-compiled function with the arguments. Note that, for API
     // uniformity reasons, it takes a list of type-erased pointers to arguments.
     // Please, note that 'invoke' method is overloaded with a parameter pack version.
     // Make sure the MutableArrayRef version is invoked.
-    auto invocationResult = m_engine->invoke("main", llvm::MutableArrayRef<void*>(m_invokeArgs));
+    auto invocationResult = m_engine->invoke("main", llvm::MutableArrayRef<void*>(invokeArgs));
 
     if (clDumpObjectFile)
     {
@@ -137,11 +169,10 @@ void MLIRCPURuntime::execute()
     NGRAPH_CHECK(!invocationResult, "JIT invocation of 'main' failed\n");
 }
 
-void MLIRCPURuntime::cleanup()
+MLIRCPURuntime::CallState::~CallState()
 {
     // Free void double pointer arguments without freeing external tensor data.
-    int i = 0;
-    for (auto* arg : m_invokeArgs)
+    for (auto* arg : invokeArgs)
     {
         auto* memRefArg = *(reinterpret_cast<StaticMemRef**>(arg));
         free(memRefArg);
@@ -156,17 +187,17 @@ void MLIRCPURuntime::cleanup()
 // argPtr-> arg[0]-> StaticMemRef -> <data>
 //          arg[1]-> StaticMemRef -> <data>
 //          ...
-SmallVector<void*, 8> MLIRCPURuntime::allocateMemrefArgs()
+SmallVector<void*, 8> MLIRCPURuntime::allocateMemrefArgs(const std::vector<MemRefArg>& args)
 {
-    SmallVector<void*, 8> args;
-    for (auto i = 0; i < m_externalTensors->size(); i++)
+    SmallVector<void*, 8> invokeArgs;
+    for (auto i = 0; i < args.size(); i++)
     {
-        auto descriptor = allocateMemrefDescriptor(m_ranks[i]);
+        auto descriptor = allocateMemrefDescriptor(args[i].m_shape.size());
         StaticMemRef** arg = reinterpret_cast<StaticMemRef**>(malloc(sizeof(StaticMemRef*)));
         *arg = descriptor;
-        args.push_back(arg);
+        invokeArgs.push_back(arg);
     }
-    return args;
+    return invokeArgs;
 }
 
 StaticMemRef* MLIRCPURuntime::allocateMemrefDescriptor(size_t rank)
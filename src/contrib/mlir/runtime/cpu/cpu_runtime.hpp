@@ -20,12 +20,14 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <mlir/ExecutionEngine/ExecutionEngine.h>
 #include <mlir/IR/Builders.h>
 #include <mlir/IR/Module.h>
 #include <mlir/IR/Types.h>
 #include "contrib/mlir/backend/backend.hpp"
 #include "contrib/mlir/runtime/runtime.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 
 namespace ngraph
 {
@@ -51,34 +53,54 @@ namespace ngraph
             /// The module should be in LLVM dialect and ready to be lowered via an MLIR
             /// ExecutionEngine. The runtime owns the context and must out-live any MLIR
             /// code Compilation and execution.
+            ///
+            /// The module is JIT-compiled once, by compile() or by the first run(). After that
+            /// run() may be called concurrently, so one runtime can be shared by all the
+            /// contexts and executables that run the same module.
+            ///
+            /// When the module keeps its temporaries in an arena, the arena is allocated along
+            /// with the argument descriptors of a call and both are pooled, so that a call only
+            /// allocates when more calls than ever before run concurrently.
             class MLIRCPURuntime : public MLIRRuntime
             {
             public:
+                /// JIT-compiles the module. Does nothing if it is already compiled.
+                void compile();
                 /// Executes a pre-compiled subgraph
                 void run(const std::vector<MemRefArg>& args) override;
 
             private:
-                void run_internal(const std::vector<MemRefArg>& args);
+                // Invocation arguments and arena of one call
+                struct CallState
+                {
+                    ~CallState();
+                    llvm::SmallVector<void*, 8> invokeArgs;
+                    std::unique_ptr<AlignedBuffer> arena;
+                };
+
+                // Takes a call state from the pool, or creates one if the pool is empty
+                std::unique_ptr<CallState> acquireCallState(const std::vector<MemRefArg>& args);
+                // Returns a call state to the pool
+                void releaseCallState(std::unique_ptr<CallState> state);
                 // Bind external tensors to MLIR module entry point
-                void bindArguments(const std::vector<MemRefArg>& args);
+                void bindArguments(const std::vector<MemRefArg>& args,
+                                   llvm::SmallVector<void*, 8>& invokeArgs);
                 // Invokes an MLIR module entry point with bound arguments
-                void execute();
-                // Cleans up allocated args
-                void cleanup();
+                void execute(llvm::SmallVector<void*, 8>& invokeArgs);
 
                 /// Helper to create memref arguments for MLIR function signature
-                llvm::SmallVector<void*, 8> allocateMemrefArgs();
+                llvm::SmallVector<void*, 8> allocateMemrefArgs(const std::vector<MemRefArg>& args);
 
                 /// Helper to allocate a mem ref object. Handles static shapes only for now.
                 StaticMemRef* allocateMemrefDescriptor(size_t);
 
             private:
-                // Pointers to externally allocated memory for sub-graph's input and output tensors.
-                const std::vector<MemRefArg>* m_externalTensors;
-                // Arguments for the MLIR function generated for the nGraph sub-graph.
-                llvm::SmallVector<void*, 8> m_invokeArgs;
                 std::unique_ptr<mlir::ExecutionEngine> m_engine;
-                std::vector<size_t> m_ranks;
+                std::once_flag m_compileOnce;
+                // Size in bytes of the temporaries arena, zero if the module has none
+                size_t m_arenaSize = 0;
+                std::mutex m_callStatesMutex;
+                std::vector<std::unique_ptr<CallState>> m_callStates;
             };
         }
     }
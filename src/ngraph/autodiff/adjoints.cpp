@@ -25,10 +25,13 @@
 #include "ngraph/node.hpp"
 #include "ngraph/op/add.hpp"
 #include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/convert.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/replace_slice.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/scatter_add.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/strides.hpp"
 
@@ -125,10 +128,11 @@ autodiff::Adjoints::Adjoints(const OutputVector& ys, const OutputVector& cs)
                 nodes_to_check.push_front(input_source_node);
             }
         }
-        OutputVector deltas = m_adjoint_map[node.get()];
+        OutputVector deltas(node->get_output_size());
         for (size_t i = 0; i < node->get_output_size(); ++i)
         {
             auto& delta = deltas[i];
+            delta = accumulate(node->output(i));
             if (delta == Output<Node>())
             {
                 delta = make_broadcast_zero(node->output(i));
@@ -140,43 +144,131 @@ autodiff::Adjoints::Adjoints(const OutputVector& ys, const OutputVector& cs)
 
 Output<Node> autodiff::Adjoints::backprop_output(const Output<Node>& x)
 {
-    auto node = x.get_node();
-    auto adjoint_it = m_adjoint_map.find(node);
-    Output<Node> result;
-    OutputVector deltas;
-    if (m_adjoint_map.end() == adjoint_it)
+    Output<Node> result = accumulate(x);
+    if (result == Output<Node>())
     {
-        deltas = OutputVector(node->get_output_size());
-        m_adjoint_map[node] = deltas;
+        result = make_broadcast_zero(x);
     }
-    else
+    return result;
+}
+
+autodiff::Adjoints::Contributions& autodiff::Adjoints::get_contributions(const Output<Node>& x)
+{
+    auto& contributions = m_contributions[x.get_node()];
+    if (contributions.size() <= x.get_index())
     {
-        deltas = adjoint_it->second;
+        contributions.resize(x.get_node()->get_output_size());
     }
-    if (deltas.at(x.get_index()) == Output<Node>())
+    return contributions[x.get_index()];
+}
+
+void autodiff::Adjoints::add_delta(const Output<Node>& x, const Output<Node>& delta)
+{
+    get_contributions(x).deltas.push_back(delta);
+}
+
+void autodiff::Adjoints::add_delta_to_rows(const Output<Node>& x,
+                                           const Output<Node>& indices,
+                                           const Output<Node>& delta)
+{
+    if (!(x.get_element_type().compatible(delta.get_element_type())))
     {
-        deltas.at(x.get_index()) = make_broadcast_zero(x);
+        throw ngraph_error(
+            "Autodiff internal error: Mismatch on backprop and op in add_delta_to_rows.");
+    }
+
+    // ScatterAdd takes integer indices only
+    Output<Node> row_indices = indices;
+    if (indices.get_element_type() != element::i32 && indices.get_element_type() != element::i64)
+    {
+        row_indices = std::make_shared<op::Convert>(indices, element::i64);
     }
-    return deltas.at(x.get_index());
+    auto& contributions = get_contributions(x);
+    contributions.row_indices.push_back(row_indices);
+    contributions.row_deltas.push_back(delta);
 }
 
-void autodiff::Adjoints::add_delta(const Output<Node>& x, const Output<Node>& delta)
+// Collapses the first `axes` axes of value into one
+static Output<Node> flatten_leading_axes(const Output<Node>& value, size_t axes)
 {
-    auto adjoint_it = m_adjoint_map.find(x.get_node());
-    if (adjoint_it == m_adjoint_map.end())
+    auto& shape = value.get_shape();
+    Shape flat_shape{shape_size(Shape(shape.begin(), shape.begin() + axes))};
+    flat_shape.insert(flat_shape.end(), shape.begin() + axes, shape.end());
+    if (flat_shape == shape)
     {
-        m_adjoint_map[x.get_node()] = OutputVector(x.get_node()->get_output_size());
-        adjoint_it = m_adjoint_map.find(x.get_node());
+        return value;
     }
-    auto& deltas = adjoint_it->second[x.get_index()];
-    if (deltas == Output<Node>())
+    return std::make_shared<op::Reshape>(value, get_default_order(shape), flat_shape);
+}
+
+Output<Node> autodiff::Adjoints::accumulate(const Output<Node>& x)
+{
+    auto node = x.get_node();
+    auto& adjoints = m_adjoint_map[node];
+    if (adjoints.size() <= x.get_index())
     {
-        deltas = delta;
+        adjoints.resize(node->get_output_size());
     }
-    else
+    auto& adjoint = adjoints[x.get_index()];
+
+    auto contributions_it = m_contributions.find(node);
+    if (contributions_it == m_contributions.end() ||
+        contributions_it->second.size() <= x.get_index())
+    {
+        return adjoint;
+    }
+    auto& pending = contributions_it->second[x.get_index()];
+
+    for (auto& delta : pending.deltas)
+    {
+        if (adjoint == Output<Node>())
+        {
+            adjoint = delta;
+        }
+        else
+        {
+            adjoint = std::make_shared<op::Add>(adjoint, delta);
+        }
+    }
+
+    if (!pending.row_deltas.empty())
     {
-        deltas = std::make_shared<op::Add>(deltas, delta);
+        Output<Node> indices = pending.row_indices.at(0);
+        Output<Node> deltas = pending.row_deltas.at(0);
+        if (pending.row_deltas.size() > 1)
+        {
+            // Concatenate the index lists and their rows, so that every lookup of a shared
+            // table is accumulated by one scatter
+            element::Type index_type = indices.get_element_type();
+            for (auto& row_indices : pending.row_indices)
+            {
+                if (row_indices.get_element_type() != index_type)
+                {
+                    index_type = element::i64;
+                }
+            }
+            OutputVector flat_indices;
+            OutputVector flat_deltas;
+            for (size_t i = 0; i < pending.row_deltas.size(); i++)
+            {
+                Output<Node> row_indices = pending.row_indices[i];
+                if (row_indices.get_element_type() != index_type)
+                {
+                    row_indices = std::make_shared<op::Convert>(row_indices, index_type);
+                }
+                size_t index_rank = row_indices.get_shape().size();
+                flat_indices.push_back(flatten_leading_axes(row_indices, index_rank));
+                flat_deltas.push_back(flatten_leading_axes(pending.row_deltas[i], index_rank));
+            }
+            indices = std::make_shared<op::Concat>(flat_indices, 0);
+            deltas = std::make_shared<op::Concat>(flat_deltas, 0);
+        }
+        Output<Node> base = adjoint == Output<Node>() ? make_broadcast_zero(x) : adjoint;
+        adjoint = std::make_shared<op::ScatterAdd>(base, indices, deltas);
     }
+
+    pending = Contributions();
+    return adjoint;
 }
 
 // This doesn't need an index since slice can only sit on top of GOE
@@ -193,8 +285,8 @@ void autodiff::Adjoints::add_delta_to_slice(const Output<Node>& x,
             "Autodiff internal error: Mismatch on backprop and op in add_delta_to_slice.");
     }
 
-    auto adjoint_it = m_adjoint_map.find(x.get_node());
-    auto& deltas = adjoint_it->second[x.get_index()];
+    accumulate(x);
+    auto& deltas = m_adjoint_map[x.get_node()][x.get_index()];
     if (deltas == Output<Node>())
     {
         auto zero = make_broadcast_zero(x);
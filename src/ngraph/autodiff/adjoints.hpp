@@ -19,6 +19,7 @@
 #include <map>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "ngraph/coordinate.hpp"
 #include "ngraph/output_vector.hpp"
@@ -66,13 +67,47 @@ namespace ngraph
                                     const Coordinate& upper_bounds,
                                     const Strides& strides);
 
+            /// \brief Add a backprop contribution to rows of x's adjoint
+            ///
+            /// Row i of delta, in the row-major order of indices, is added to row indices[i] of
+            /// x's adjoint, so delta has the shape of indices followed by the shape of a row of
+            /// x. All the row contributions to an adjoint are gathered into a single ScatterAdd
+            /// when the adjoint is needed.
+            ///
+            /// \param x The adjoint node
+            /// \param indices Indices of the rows of x
+            /// \param delta A backprop contribution for each index
+            void add_delta_to_rows(const Output<Node>& x,
+                                   const Output<Node>& indices,
+                                   const Output<Node>& delta);
+
             /// \brief (dy/dx)(c)
             ///
             /// \param x The output whose adjoint is desired.
             Output<Node> backprop_output(const Output<Node>& x);
 
         protected:
+            /// \brief Contributions to an adjoint that have not been summed yet
+            struct Contributions
+            {
+                OutputVector deltas;
+                OutputVector row_indices;
+                OutputVector row_deltas;
+            };
+
+            /// \brief Sums the pending contributions to x's adjoint into m_adjoint_map
+            ///
+            /// The dense contributions are added in one chain, so each partial sum dies at the
+            /// next add and backends can accumulate into a single buffer. The row contributions
+            /// are then added by one ScatterAdd.
+            ///
+            /// \return x's adjoint, or a null output if nothing contributed to it
+            Output<Node> accumulate(const Output<Node>& x);
+
+            Contributions& get_contributions(const Output<Node>& x);
+
             std::map<Node*, OutputVector> m_adjoint_map;
+            std::map<Node*, std::vector<Contributions>> m_contributions;
         };
     }
 }
@@ -37,6 +37,11 @@ ngraph::AxisSet::AxisSet(const std::vector<size_t>& axes)
 {
 }
 
+ngraph::AxisSet::AxisSet(const DimensionVector& axes)
+    : std::set<size_t>(axes.begin(), axes.end())
+{
+}
+
 ngraph::AxisSet::AxisSet(const AxisSet& axes)
     : std::set<size_t>(axes)
 {
@@ -23,6 +23,7 @@
 
 #include "ngraph/attribute_adapter.hpp"
 #include "ngraph/ngraph_visibility.hpp"
+#include "ngraph/inline_vector.hpp"
 
 namespace ngraph
 {
@@ -38,6 +39,8 @@ namespace ngraph
 
         NGRAPH_API AxisSet(const std::vector<size_t>& axes);
 
+        NGRAPH_API AxisSet(const DimensionVector& axes);
+
         NGRAPH_API AxisSet(const AxisSet& axes);
 
         NGRAPH_API AxisSet& operator=(const AxisSet& v);
@@ -26,22 +26,27 @@ std::ostream& ngraph::operator<<(std::ostream& s, const AxisVector& axis_vector)
 }
 
 ngraph::AxisVector::AxisVector(const std::initializer_list<size_t>& axes)
-    : std::vector<size_t>(axes)
+    : DimensionVector(axes)
 {
 }
 
 ngraph::AxisVector::AxisVector(const std::vector<size_t>& axes)
-    : std::vector<size_t>(axes)
+    : DimensionVector(axes)
+{
+}
+
+ngraph::AxisVector::AxisVector(const DimensionVector& axes)
+    : DimensionVector(axes)
 {
 }
 
 ngraph::AxisVector::AxisVector(const AxisVector& axes)
-    : std::vector<size_t>(axes)
+    : DimensionVector(axes)
 {
 }
 
 ngraph::AxisVector::AxisVector(size_t n)
-    : std::vector<size_t>(n)
+    : DimensionVector(n)
 {
 }
 
@@ -55,12 +60,12 @@ ngraph::AxisVector::~AxisVector()
 
 ngraph::AxisVector& ngraph::AxisVector::operator=(const AxisVector& v)
 {
-    static_cast<std::vector<size_t>*>(this)->operator=(v);
+    static_cast<DimensionVector*>(this)->operator=(v);
     return *this;
 }
 
 ngraph::AxisVector& ngraph::AxisVector::operator=(AxisVector&& v) noexcept
 {
-    static_cast<std::vector<size_t>*>(this)->operator=(v);
+    static_cast<DimensionVector*>(this)->operator=(std::move(v));
     return *this;
 }
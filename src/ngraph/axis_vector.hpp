@@ -21,24 +21,27 @@
 #include <vector>
 
 #include "ngraph/ngraph_visibility.hpp"
+#include "ngraph/inline_vector.hpp"
 
 namespace ngraph
 {
     /// \brief A vector of axes.
-    class AxisVector : public std::vector<size_t>
+    class AxisVector : public DimensionVector
     {
     public:
         NGRAPH_API AxisVector(const std::initializer_list<size_t>& axes);
 
         NGRAPH_API AxisVector(const std::vector<size_t>& axes);
 
+        NGRAPH_API AxisVector(const DimensionVector& axes);
+
         NGRAPH_API AxisVector(const AxisVector& axes);
 
         NGRAPH_API explicit AxisVector(size_t n);
 
         template <class InputIterator>
         AxisVector(InputIterator first, InputIterator last)
-            : std::vector<size_t>(first, last)
+            : DimensionVector(first, last)
         {
         }
 
@@ -207,5 +207,20 @@ namespace ngraph
             return {arg1_out, arg2_out};
         }
 
+        op::AutoBroadcastSpec detail::numpy_autobroadcast_spec(const Output<Node>& operand1,
+                                                               const Output<Node>& operand2)
+        {
+            const ngraph::Shape& shape1 = operand1.get_shape();
+            const ngraph::Shape& shape2 = operand2.get_shape();
+            if (shape1 == shape2)
+            {
+                return op::AutoBroadcastSpec::NONE;
+            }
+
+            // Throws for the shapes numpy_broadcast would reject
+            compute_shapes_and_broadcast_axes(shape1, shape2);
+            return op::AutoBroadcastSpec::NUMPY;
+        }
+
     } // namespace builder
 } // namespace ngraph
@@ -18,8 +18,10 @@
 
 #include "ngraph/except.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/op/util/attr_types.hpp"
 
 #include <memory>
+#include <type_traits>
 #include <utility>
 
 namespace ngraph
@@ -73,9 +75,44 @@ namespace ngraph
         std::pair<std::shared_ptr<Node>, std::shared_ptr<Node>>
             numpy_broadcast(const std::pair<Output<Node>, Output<Node>>& args);
 
+        namespace detail
+        {
+            /// \return AutoBroadcastSpec::NONE if the operands have the same shape, NUMPY
+            ///         otherwise.
+            ///
+            /// \exception ngraph::builder::autobroadcast_incompatible_shapes
+            op::AutoBroadcastSpec numpy_autobroadcast_spec(const Output<Node>& operand1,
+                                                           const Output<Node>& operand2);
+
+            /// \brief \p NodeType broadcasts its operands itself, so it is created with
+            ///        AutoBroadcastSpec::NUMPY instead of Reshape and Broadcast nodes.
+            template <typename NodeType>
+            std::shared_ptr<NodeType> make_with_numpy_broadcast(const Output<Node>& operand1,
+                                                                const Output<Node>& operand2,
+                                                                std::true_type)
+            {
+                return std::make_shared<NodeType>(
+                    operand1, operand2, numpy_autobroadcast_spec(operand1, operand2));
+            }
+
+            template <typename NodeType>
+            std::shared_ptr<NodeType>
+                make_with_numpy_broadcast(const Output<Node>& operand1_reshapeable,
+                                          const Output<Node>& operand2_reshapeable,
+                                          std::false_type)
+            {
+                auto shaped_op1_op2 =
+                    numpy_broadcast({operand1_reshapeable, operand2_reshapeable});
+                return std::make_shared<NodeType>(shaped_op1_op2.first, shaped_op1_op2.second);
+            }
+        } // namespace detail
+
         /// Create a new \p NodeType node, and any additional nodes required to simulate NumPy-style
         /// autobroadcast semantics.  Intended for binary operations such as "Add".
         ///
+        /// If \p NodeType takes an AutoBroadcastSpec, no additional nodes are created: the node
+        /// is given the operands as they are and broadcasts them itself.
+        ///
         /// \param [in] operand1_reshapeable The first operand to supply to the \p NodeType
         ///                                  constructor.  Subject to being wrapped with additional
         ///                                  nodes required for autobroadcasting.  Must not be null.
@@ -92,8 +129,13 @@ namespace ngraph
             make_with_numpy_broadcast(const Output<Node>& operand1_reshapeable,
                                       const Output<Node>& operand2_reshapeable)
         {
-            auto shaped_op1_op2 = numpy_broadcast({operand1_reshapeable, operand2_reshapeable});
-            return std::make_shared<NodeType>(shaped_op1_op2.first, shaped_op1_op2.second);
+            return detail::make_with_numpy_broadcast<NodeType>(
+                operand1_reshapeable,
+                operand2_reshapeable,
+                std::is_constructible<NodeType,
+                                      const Output<Node>&,
+                                      const Output<Node>&,
+                                      const op::AutoBroadcastSpec&>());
         }
 
         /// Create a new \p NodeType node, and any additional nodes required to simulate NumPy-style
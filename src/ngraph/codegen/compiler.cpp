@@ -14,7 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <functional>
 #include <iostream>
+#include <mutex>
+#include <sstream>
 #include <string>
 
 #include <clang/Basic/DiagnosticOptions.h>
@@ -41,6 +44,7 @@
 #include <llvm/Option/ArgList.h>
 #include <llvm/Option/OptTable.h>
 #include <llvm/Support/ErrorHandling.h>
+#include <llvm/Support/FileSystem.h>
 #include <llvm/Support/ManagedStatic.h>
 #include <llvm/Support/Signals.h>
 #include <llvm/Support/TargetSelect.h>
@@ -77,10 +81,17 @@ class CompilerInfo
 {
 public:
     std::string pch_file;
+    // pch_file is kept in the cache directory for later processes
+    bool keep_pch = false;
+    // pch_file was built by an earlier process
+    bool pch_from_cache = false;
     shared_ptr<codegen::CompilerCore> compiler;
 };
 
 static unordered_map<std::string, CompilerInfo> s_compiler_info;
+// The compilers in s_compiler_info are shared by every Compiler, so functions compiled on
+// several threads are compiled one at a time
+static mutex s_compiler_mutex;
 
 static class StaticHandler
 {
@@ -90,11 +101,82 @@ public:
     {
         for (const auto& p : s_compiler_info)
         {
-            file_util::remove_file(p.second.pch_file);
+            if (!p.second.keep_pch)
+            {
+                file_util::remove_file(p.second.pch_file);
+            }
         }
     }
 } s_static_init;
 
+// Hash of everything besides the sources that changes the code clang generates
+static size_t get_configuration_hash()
+{
+    static const size_t s_hash = []() {
+        std::hash<std::string> hasher;
+        vector<size_t> hashes{hasher(NGRAPH_VERSION),
+                              hasher(sys::getHostCPUName().str()),
+                              std::getenv("NGRAPH_COMPILER_DEBUGINFO_ENABLE") != nullptr};
+#ifdef _WIN32
+        for (const pair<std::string, vector<std::string>>& header_info : builtin_headers)
+        {
+            hashes.push_back(hasher(header_info.first));
+            for (const std::string& line : header_info.second)
+            {
+                hashes.push_back(hasher(line));
+            }
+        }
+#else
+        for (const pair<std::string, std::string>& header_info : builtin_headers)
+        {
+            hashes.push_back(hasher(header_info.first));
+            hashes.push_back(hasher(header_info.second));
+        }
+#endif
+        return ngraph::hash_combine(hashes);
+    }();
+    return s_hash;
+}
+
+static std::string get_cache_name(const std::vector<std::string>& sources)
+{
+    std::hash<std::string> hasher;
+    vector<size_t> hashes{get_configuration_hash()};
+    size_t size = 0;
+    for (const std::string& source : sources)
+    {
+        hashes.push_back(hasher(source));
+        size += source.size();
+    }
+    stringstream ss;
+    ss << std::hex << ngraph::hash_combine(hashes) << "_" << size;
+    return ss.str();
+}
+
+const std::string& codegen::Compiler::get_cache_directory()
+{
+    static const std::string s_cache_directory = []() -> std::string {
+        const char* env = std::getenv("NGRAPH_CODEGEN_CACHE_DIR");
+        if (env == nullptr || *env == 0)
+        {
+            return "";
+        }
+        if (!file_util::exists(env))
+        {
+            file_util::make_directory(env);
+        }
+        return env;
+    }();
+    return s_cache_directory;
+}
+
+std::string codegen::Compiler::get_cache_key(const std::string& source) const
+{
+    vector<std::string> sources{source, m_precompiled_header_source};
+    sources.insert(sources.end(), m_header_search_paths.begin(), m_header_search_paths.end());
+    return get_cache_name(sources);
+}
+
 codegen::Module::Module(std::unique_ptr<llvm::Module> module)
     : m_module(move(module))
 {
@@ -132,7 +214,7 @@ void codegen::Compiler::add_header_search_path(const std::string& path)
 
 std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& source)
 {
-    // lock_guard<mutex> lock(m_mutex);
+    lock_guard<mutex> lock(s_compiler_mutex);
     CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
     if (!compiler_info.compiler)
     {
@@ -335,7 +417,7 @@ std::unique_ptr<codegen::Module>
     CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
     if (!m_precompiled_header_source.empty() && compiler_info.pch_file.empty())
     {
-        compiler_info.pch_file = generate_pch(m_precompiled_header_source);
+        generate_pch(m_precompiled_header_source);
     }
     if (!compiler_info.pch_file.empty())
     {
@@ -382,6 +464,17 @@ std::unique_ptr<codegen::Module>
     if (reinitialize)
     {
         codegen::CompilerCore::initialize();
+        if (compiler_info.pch_from_cache)
+        {
+            // A precompiled header left by an earlier process may not be usable here, so
+            // rebuild it and try once more
+            NGRAPH_DEBUG << "Compiling with cached " << compiler_info.pch_file << " failed";
+            file_util::remove_file(compiler_info.pch_file);
+            compiler_info.pch_file = "";
+            compiler_info.keep_pch = false;
+            compiler_info.pch_from_cache = false;
+            return compile(m_compiler_action, source);
+        }
     }
 
     return result;
@@ -390,7 +483,35 @@ std::unique_ptr<codegen::Module>
 std::string codegen::CompilerCore::generate_pch(const std::string& source)
 {
     PreprocessorOptions& preprocessor_options = m_compiler->getInvocation().getPreprocessorOpts();
-    std::string pch_path = file_util::tmp_filename();
+    CompilerInfo& compiler_info = s_compiler_info[source];
+
+    // With a cache directory the header is built under a unique name next to its final path and
+    // renamed, so processes sharing the directory never see a partly written file
+    std::string cache_path;
+    std::string pch_path;
+    const std::string& cache_directory = codegen::Compiler::get_cache_directory();
+    if (!cache_directory.empty())
+    {
+        std::string name = get_cache_name({source, ngraph::join(m_extra_search_path_list)});
+        cache_path = file_util::path_join(cache_directory, name + ".pch");
+        if (file_util::exists(cache_path))
+        {
+            compiler_info.pch_file = cache_path;
+            compiler_info.keep_pch = true;
+            compiler_info.pch_from_cache = true;
+            return cache_path;
+        }
+        SmallString<256> unique_path;
+        if (!sys::fs::createUniqueFile(cache_path + ".%%%%%%.tmp", unique_path))
+        {
+            pch_path = unique_path.str().str();
+        }
+    }
+    if (pch_path.empty())
+    {
+        cache_path = "";
+        pch_path = file_util::tmp_filename();
+    }
     m_compiler->getFrontendOpts().OutputFile = pch_path;
 
     // Map code filename to a memoryBuffer
@@ -405,9 +526,15 @@ std::string codegen::CompilerCore::generate_pch(const std::string& source)
         file_util::remove_file(pch_path);
         pch_path = "";
     }
+    else if (!cache_path.empty() && !sys::fs::rename(pch_path, cache_path))
+    {
+        pch_path = cache_path;
+        compiler_info.pch_file = pch_path;
+        compiler_info.keep_pch = true;
+    }
     else
     {
-        s_compiler_info[source].pch_file = pch_path;
+        compiler_info.pch_file = pch_path;
     }
 
     buffer.release();
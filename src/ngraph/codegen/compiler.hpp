@@ -61,6 +61,15 @@ public:
     void add_header_search_path(const std::string& path);
     std::unique_ptr<ngraph::codegen::Module> compile(const std::string& source);
     std::unique_ptr<clang::CodeGenAction>& get_compiler_action() { return m_compiler_action; }
+    /// \brief Returns the name under which the code compiled from `source` is cached. It covers
+    ///        the source, the precompiled header source, the header search paths, the embedded
+    ///        headers, the compiler options and the host CPU.
+    std::string get_cache_key(const std::string& source) const;
+
+    /// \brief Returns the directory in which compiled code and precompiled headers are kept
+    ///        across processes, set with NGRAPH_CODEGEN_CACHE_DIR. Empty if caching is disabled.
+    static const std::string& get_cache_directory();
+
 private:
     std::unique_ptr<clang::CodeGenAction> m_compiler_action;
     std::shared_ptr<CompilerCore> m_compiler_core;
@@ -14,12 +14,72 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/raw_ostream.h>
 
 #include "ngraph/codegen/execution_engine.hpp"
+#include "ngraph/file_util.hpp"
 
 using namespace ngraph;
 
+static std::string get_cache_path(const std::string& cache_key, const std::string& extension)
+{
+    return file_util::path_join(codegen::Compiler::get_cache_directory(), cache_key + extension);
+}
+
+// Writes to a uniquely named file next to `path` and renames it, so that processes sharing the
+// cache directory never read a partly written file
+static void write_cache_file(const std::string& path, llvm::StringRef data)
+{
+    int fd;
+    llvm::SmallString<256> unique_path;
+    if (llvm::sys::fs::createUniqueFile(path + ".%%%%%%.tmp", fd, unique_path))
+    {
+        return;
+    }
+    bool written;
+    {
+        llvm::raw_fd_ostream out(fd, true);
+        out << data;
+        out.close();
+        written = !out.has_error();
+        out.clear_error();
+    }
+    if (!written || llvm::sys::fs::rename(unique_path, path))
+    {
+        llvm::sys::fs::remove(unique_path);
+    }
+}
+
+namespace
+{
+    // Stores the object code of each module in the cache directory under the module's identifier
+    class CacheDirectoryObjectCache : public llvm::ObjectCache
+    {
+    public:
+        void notifyObjectCompiled(const llvm::Module* module,
+                                  llvm::MemoryBufferRef object) override
+        {
+            write_cache_file(get_cache_path(module->getModuleIdentifier(), ".o"),
+                             object.getBuffer());
+        }
+
+        std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override
+        {
+            auto buffer =
+                llvm::MemoryBuffer::getFile(get_cache_path(module->getModuleIdentifier(), ".o"));
+            return buffer ? std::move(*buffer) : nullptr;
+        }
+    };
+}
+
 codegen::ExecutionEngine::ExecutionEngine()
     : m_execution_engine{nullptr}
 {
@@ -33,30 +93,77 @@ codegen::ExecutionEngine::~ExecutionEngine()
     }
 }
 
-bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Module>& module)
+bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Module>& module,
+                                          const std::string& cache_key)
 {
-    if (module)
+    if (!module)
     {
-        if (!m_execution_engine)
-        {
-            m_execution_engine.reset(llvm::EngineBuilder(module->take_module())
-                                         .setEngineKind(llvm::EngineKind::JIT)
-                                         .setOptLevel(llvm::CodeGenOpt::Aggressive)
-                                         .setMCPU(llvm::sys::getHostCPUName())
-                                         //  .setCodeModel(llvm::CodeModel::Medium)
-                                         .setErrorStr(&m_jit_error)
-                                         .create());
-
-            if (!m_execution_engine)
-            {
-                return false;
-            }
-        }
+        return false;
     }
-    else
+
+    std::unique_ptr<llvm::Module> llvm_module = module->take_module();
+    bool use_cache = !cache_key.empty() && !Compiler::get_cache_directory().empty();
+    if (use_cache)
+    {
+        // The object cache finds the module's object code by its identifier
+        llvm_module->setModuleIdentifier(cache_key);
+        std::string bitcode;
+        llvm::raw_string_ostream out(bitcode);
+        llvm::WriteBitcodeToFile(*llvm_module, out);
+        write_cache_file(get_cache_path(cache_key, ".bc"), out.str());
+    }
+    return create_engine(std::move(llvm_module), use_cache);
+}
+
+bool codegen::ExecutionEngine::add_cached_module(const std::string& cache_key)
+{
+    if (Compiler::get_cache_directory().empty())
+    {
+        return false;
+    }
+    auto buffer = llvm::MemoryBuffer::getFile(get_cache_path(cache_key, ".bc"));
+    if (!buffer)
+    {
+        return false;
+    }
+
+    if (!m_context)
     {
+        m_context.reset(new llvm::LLVMContext());
+    }
+    auto module = llvm::parseBitcodeFile((*buffer)->getMemBufferRef(), *m_context);
+    if (!module)
+    {
+        llvm::consumeError(module.takeError());
         return false;
     }
+    (*module)->setModuleIdentifier(cache_key);
+    return create_engine(std::move(*module), true);
+}
+
+bool codegen::ExecutionEngine::create_engine(std::unique_ptr<llvm::Module> module, bool use_cache)
+{
+    if (!m_execution_engine)
+    {
+        m_execution_engine.reset(llvm::EngineBuilder(std::move(module))
+                                     .setEngineKind(llvm::EngineKind::JIT)
+                                     .setOptLevel(llvm::CodeGenOpt::Aggressive)
+                                     .setMCPU(llvm::sys::getHostCPUName())
+                                     //  .setCodeModel(llvm::CodeModel::Medium)
+                                     .setErrorStr(&m_jit_error)
+                                     .create());
+
+        if (!m_execution_engine)
+        {
+            return false;
+        }
+        if (use_cache)
+        {
+            // Machine code is generated in finalize(), where the object cache is consulted
+            m_object_cache.reset(new CacheDirectoryObjectCache());
+            m_execution_engine->setObjectCache(m_object_cache.get());
+        }
+    }
 
     return true;
 }
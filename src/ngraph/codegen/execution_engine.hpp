@@ -33,6 +33,8 @@ namespace llvm
 {
     class Module;
     class ExecutionEngine;
+    class LLVMContext;
+    class ObjectCache;
 }
 
 class ngraph::codegen::ExecutionEngine
@@ -41,7 +43,13 @@ public:
     ExecutionEngine();
     ~ExecutionEngine();
 
-    bool add_module(std::unique_ptr<ngraph::codegen::Module>& module);
+    /// \brief Adds a compiled module. With a `cache_key` and a cache directory, the module's
+    ///        bitcode and object code are also stored in the cache under that key.
+    bool add_module(std::unique_ptr<ngraph::codegen::Module>& module,
+                    const std::string& cache_key = "");
+    /// \brief Adds the module stored in the cache under `cache_key`, without compiling it again
+    /// \returns false if caching is disabled or nothing is stored under `cache_key`
+    bool add_cached_module(const std::string& cache_key);
     void finalize();
 
     template <typename ftype>
@@ -51,9 +59,14 @@ public:
     }
 
 private:
+    // Declared before m_execution_engine so that they outlive it
+    std::unique_ptr<llvm::LLVMContext> m_context;
+    std::unique_ptr<llvm::ObjectCache> m_object_cache;
     std::unique_ptr<llvm::ExecutionEngine> m_execution_engine;
     std::string m_jit_error;
 
+    bool create_engine(std::unique_ptr<llvm::Module> module, bool use_cache);
+
     void* get_pointer_to_named_function(const std::string& func_name);
     template <typename signature>
     std::function<signature> f_cast(void* f)
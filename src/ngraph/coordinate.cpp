@@ -33,27 +33,32 @@ ngraph::Coordinate::Coordinate()
 }
 
 ngraph::Coordinate::Coordinate(const std::initializer_list<size_t>& axes)
-    : std::vector<size_t>(axes)
+    : DimensionVector(axes)
 {
 }
 
 ngraph::Coordinate::Coordinate(const Shape& shape)
-    : std::vector<size_t>(static_cast<const std::vector<size_t>&>(shape))
+    : DimensionVector(shape)
 {
 }
 
 ngraph::Coordinate::Coordinate(const std::vector<size_t>& axes)
-    : std::vector<size_t>(axes)
+    : DimensionVector(axes)
+{
+}
+
+ngraph::Coordinate::Coordinate(const DimensionVector& axes)
+    : DimensionVector(axes)
 {
 }
 
 ngraph::Coordinate::Coordinate(const Coordinate& axes)
-    : std::vector<size_t>(axes)
+    : DimensionVector(axes)
 {
 }
 
 ngraph::Coordinate::Coordinate(size_t n, size_t initial_value)
-    : std::vector<size_t>(n, initial_value)
+    : DimensionVector(n, initial_value)
 {
 }
 
@@ -63,13 +68,13 @@ ngraph::Coordinate::~Coordinate()
 
 ngraph::Coordinate& ngraph::Coordinate::operator=(const Coordinate& v)
 {
-    static_cast<std::vector<size_t>*>(this)->operator=(v);
+    static_cast<DimensionVector*>(this)->operator=(v);
     return *this;
 }
 
 ngraph::Coordinate& ngraph::Coordinate::operator=(Coordinate&& v) noexcept
 {
-    static_cast<std::vector<size_t>*>(this)->operator=(v);
+    static_cast<DimensionVector*>(this)->operator=(std::move(v));
     return *this;
 }
 
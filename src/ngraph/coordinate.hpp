@@ -26,7 +26,7 @@
 namespace ngraph
 {
     /// \brief Coordinates for a tensor element
-    class Coordinate : public std::vector<size_t>
+    class Coordinate : public DimensionVector
     {
     public:
         NGRAPH_API Coordinate();
@@ -36,6 +36,8 @@ namespace ngraph
 
         NGRAPH_API Coordinate(const std::vector<size_t>& axes);
 
+        NGRAPH_API Coordinate(const DimensionVector& axes);
+
         NGRAPH_API Coordinate(const Coordinate& axes);
 
         NGRAPH_API Coordinate(size_t n, size_t initial_value = 0);
@@ -44,7 +46,7 @@ namespace ngraph
 
         template <class InputIterator>
         Coordinate(InputIterator first, InputIterator last)
-            : std::vector<size_t>(first, last)
+            : DimensionVector(first, last)
         {
         }
 
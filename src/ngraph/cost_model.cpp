@@ -0,0 +1,309 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/cost_model.hpp"
+#include "ngraph/op/avg_pool.hpp"
+#include "ngraph/op/batch_norm.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/experimental/batch_mat_mul.hpp"
+#include "ngraph/op/fused/batch_mat_mul_transpose.hpp"
+#include "ngraph/op/fused/gemm.hpp"
+#include "ngraph/op/fused/gru_cell.hpp"
+#include "ngraph/op/fused/lstm_cell.hpp"
+#include "ngraph/op/fused/lstm_sequence.hpp"
+#include "ngraph/op/fused/matmul.hpp"
+#include "ngraph/op/fused/optimizer_update.hpp"
+#include "ngraph/op/fused/rnn_cell.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/util/arithmetic_reduction.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+double NodeCost::arithmetic_intensity() const
+{
+    return bytes() == 0 ? 0 : static_cast<double>(flops) / bytes();
+}
+
+double FunctionCost::arithmetic_intensity() const
+{
+    return bytes == 0 ? 0 : static_cast<double>(flops) / bytes;
+}
+
+// Multiply-adds per output element of a convolution with the given filters. Filters are
+// [C_out, C_in, spatial...], or [groups, C_out, C_in, spatial...] when the groups are part
+// of the filter shape.
+static size_t conv_macs_per_output(const Shape& filter_shape, size_t data_rank)
+{
+    size_t leading_dims = filter_shape.size() > data_rank ? 2 : 1;
+    if (filter_shape.size() <= leading_dims)
+    {
+        return 0;
+    }
+    size_t leading_size = 1;
+    for (size_t i = 0; i < leading_dims; i++)
+    {
+        leading_size *= filter_shape[i];
+    }
+    return leading_size == 0 ? 0 : shape_size(filter_shape) / leading_size;
+}
+
+// The number of gates of a recurrent cell and the elementwise flops per hidden unit of its state
+// update; gates = 0 if `node` is not a recurrent cell
+static void rnn_cell_shape(const Node& node, size_t& gates, size_t& update_flops)
+{
+    gates = 0;
+    update_flops = 0;
+    if (is_type<op::v0::LSTMCell>(&node) || is_type<op::v0::LSTMSequence>(&node))
+    {
+        // C = f * C + i * c; H = o * tanh(C)
+        gates = 4;
+        update_flops = 5;
+    }
+    else if (is_type<op::v0::GRUCell>(&node))
+    {
+        // H = (1 - z) * h + z * H, and the reset gate applied to the recurrence
+        gates = 3;
+        update_flops = 4;
+    }
+    else if (is_type<op::v0::RNNCell>(&node))
+    {
+        gates = 1;
+    }
+}
+
+// The flops of one step of a recurrent cell: the input and recurrence products of every gate,
+// a bias add and an activation per gate element, and the state update
+static size_t rnn_step_flops(
+    size_t batch, size_t input_size, size_t hidden_size, size_t gates, size_t update_flops)
+{
+    return batch * hidden_size *
+           (2 * gates * (input_size + hidden_size) + 2 * gates + update_flops);
+}
+
+static size_t estimate_flops(const Node& node)
+{
+    size_t out_size = shape_size(node.get_output_shape(0));
+
+    if (auto dot = as_type<const op::v0::Dot>(&node))
+    {
+        // One multiply and one add per output element and reduced element
+        const Shape& arg0_shape = dot->get_input_shape(0);
+        size_t reduction_size = 1;
+        for (size_t i = arg0_shape.size() - dot->get_reduction_axes_count();
+             i < arg0_shape.size();
+             i++)
+        {
+            reduction_size *= arg0_shape[i];
+        }
+        return 2 * out_size * reduction_size;
+    }
+    if (auto matmul = as_type<const op::v0::MatMul>(&node))
+    {
+        const Shape& arg0_shape = matmul->get_input_shape(0);
+        if (arg0_shape.empty())
+        {
+            return out_size;
+        }
+        size_t k = arg0_shape.size() == 1 || !matmul->get_transpose_a()
+                       ? arg0_shape.back()
+                       : arg0_shape[arg0_shape.size() - 2];
+        return 2 * out_size * k;
+    }
+    if (is_type<const op::BatchMatMul>(&node))
+    {
+        // [batch, n, k] x [batch, k, m]
+        return 2 * out_size * node.get_input_shape(0).at(2);
+    }
+    if (auto bmm = as_type<const op::BatchMatMulTranspose>(&node))
+    {
+        const Shape& arg0_shape = bmm->get_input_shape(0);
+        return 2 * out_size * (bmm->get_transpose_arg0() ? arg0_shape.at(1) : arg0_shape.at(2));
+    }
+    if (auto gemm = as_type<const op::v0::Gemm>(&node))
+    {
+        // alpha * A * B + beta * C
+        const Shape& a_shape = gemm->get_input_shape(0);
+        size_t k = gemm->get_transA() ? a_shape.at(0) : a_shape.at(1);
+        return 2 * out_size * k + 3 * out_size;
+    }
+
+    // Core and backend convolutions alike take the data as input 0 and the filters as input 1
+    const string& description = node.description();
+    bool is_convolution = description.compare(0, 11, "Convolution") == 0 ||
+                          description.compare(0, 16, "GroupConvolution") == 0;
+    if (is_convolution && description.find("Backprop") == string::npos &&
+        node.get_input_size() > 1)
+    {
+        return 2 * out_size *
+               conv_macs_per_output(node.get_input_shape(1), node.get_input_shape(0).size());
+    }
+    // Backprop convolutions do the multiply-adds of the forward convolution
+    if (auto conv = as_type<const op::v0::ConvolutionBackpropData>(&node))
+    {
+        const Shape& filter_shape = conv->get_input_shape(0);
+        const Shape& delta_shape = conv->get_input_shape(1);
+        return 2 * shape_size(delta_shape) *
+               conv_macs_per_output(filter_shape, delta_shape.size());
+    }
+    if (auto conv = as_type<const op::v1::ConvolutionBackpropData>(&node))
+    {
+        const Shape& delta_shape = conv->get_input_shape(0);
+        const Shape& filter_shape = conv->get_input_shape(1);
+        return 2 * shape_size(delta_shape) *
+               conv_macs_per_output(filter_shape, delta_shape.size());
+    }
+    if (is_type<const op::v0::ConvolutionBackpropFilters>(&node) ||
+        is_type<const op::v1::ConvolutionBackpropFilters>(&node))
+    {
+        const Shape& delta_shape = node.get_input_shape(1);
+        return 2 * shape_size(delta_shape) *
+               conv_macs_per_output(node.get_output_shape(0), delta_shape.size());
+    }
+
+    size_t gates;
+    size_t update_flops;
+    rnn_cell_shape(node, gates, update_flops);
+    if (gates > 0)
+    {
+        if (auto sequence = as_type<const op::v0::LSTMSequence>(&node))
+        {
+            // X holds batch * sequence length steps of input_size; W is
+            // [num_directions, 4 * hidden_size, input_size]
+            const Shape& x_shape = sequence->get_input_shape(0);
+            const Shape& w_shape = sequence->get_input_shape(4);
+            size_t input_size = x_shape.at(2);
+            size_t steps = x_shape.at(0) * x_shape.at(1);
+            return w_shape.at(0) * rnn_step_flops(steps,
+                                                  input_size,
+                                                  sequence->get_hidden_size(),
+                                                  gates,
+                                                  update_flops);
+        }
+        // X is [batch_size, input_size]
+        const Shape& x_shape = node.get_input_shape(0);
+        auto cell = dynamic_cast<const op::util::RNNCellBase*>(&node);
+        return rnn_step_flops(
+            x_shape.at(0), x_shape.at(1), cell->get_hidden_size(), gates, update_flops);
+    }
+
+    if (auto pool = as_type<const op::v0::AvgPool>(&node))
+    {
+        return out_size * shape_size(pool->get_window_shape());
+    }
+    if (auto pool = as_type<const op::v1::AvgPool>(&node))
+    {
+        return out_size * shape_size(pool->get_kernel());
+    }
+    if (auto pool = as_type<const op::v0::MaxPool>(&node))
+    {
+        return out_size * shape_size(pool->get_window_shape());
+    }
+    if (auto pool = as_type<const op::v1::MaxPool>(&node))
+    {
+        return out_size * shape_size(pool->get_kernel());
+    }
+    if (is_type<const op::v0::Softmax>(&node) || is_type<const op::v1::Softmax>(&node))
+    {
+        // max, subtract, exp, sum and divide
+        return 5 * out_size;
+    }
+    if (is_type<const op::v0::BatchNormInference>(&node))
+    {
+        // (x - mean) / sqrt(variance + eps) * gamma + beta, with the per-channel terms folded
+        return 2 * out_size;
+    }
+    if (is_type<const op::v0::BatchNormTraining>(&node))
+    {
+        // The mean and variance reductions, then the normalization
+        return 6 * out_size;
+    }
+    if (auto sgd = as_type<const op::v0::SGDMomentumUpdate>(&node))
+    {
+        // The velocity and parameter updates, plus the Nesterov look-ahead
+        return (sgd->get_nesterov() ? 6 : 4) * out_size;
+    }
+    if (is_type<const op::v0::AdamUpdate>(&node))
+    {
+        // Both moment updates, then the scaled step divided by sqrt(v) + epsilon
+        return 12 * out_size;
+    }
+    if (dynamic_cast<const op::util::ArithmeticReduction*>(&node))
+    {
+        return shape_size(node.get_input_shape(0));
+    }
+    if (dynamic_cast<const op::util::BinaryElementwiseArithmetic*>(&node) ||
+        dynamic_cast<const op::util::UnaryElementwiseArithmetic*>(&node))
+    {
+        return out_size;
+    }
+    return 0;
+}
+
+NodeCost ngraph::estimate_cost(const Node& node)
+{
+    NodeCost cost;
+    for (auto& input : node.inputs())
+    {
+        if (input.get_partial_shape().is_dynamic() || input.get_element_type().is_dynamic())
+        {
+            return NodeCost();
+        }
+        cost.input_bytes += shape_size(input.get_shape()) * input.get_element_type().size();
+    }
+    for (auto& output : node.outputs())
+    {
+        if (output.get_partial_shape().is_dynamic() || output.get_element_type().is_dynamic())
+        {
+            return NodeCost();
+        }
+        cost.output_bytes += shape_size(output.get_shape()) * output.get_element_type().size();
+    }
+    if (node.get_output_size() > 0)
+    {
+        cost.flops = estimate_flops(node);
+    }
+    return cost;
+}
+
+FunctionCost ngraph::estimate_cost(const Function& function)
+{
+    FunctionCost cost;
+    for (auto& node : function.get_ordered_ops())
+    {
+        NodeCost node_cost = estimate_cost(*node);
+        if (node->is_parameter())
+        {
+            cost.parameter_bytes += node_cost.output_bytes;
+        }
+        else if (node->is_constant())
+        {
+            cost.constant_bytes += node_cost.output_bytes;
+        }
+        else if (!node->is_output())
+        {
+            cost.flops += node_cost.flops;
+            cost.bytes += node_cost.bytes();
+            cost.activation_bytes += node_cost.output_bytes;
+            cost.nodes.emplace_back(node, node_cost);
+        }
+    }
+    return cost;
+}
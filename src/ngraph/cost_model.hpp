@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/node.hpp"
+
+namespace ngraph
+{
+    /// \brief The static cost of one call of a node, estimated from its type and shapes
+    struct NGRAPH_API NodeCost
+    {
+        /// \brief Floating point operations; a multiply-add counts as two. Zero for nodes
+        ///        without an estimate, such as data movement.
+        size_t flops = 0;
+        /// \brief Bytes read from the inputs
+        size_t input_bytes = 0;
+        /// \brief Bytes written to the outputs
+        size_t output_bytes = 0;
+
+        size_t bytes() const { return input_bytes + output_bytes; }
+        /// \returns flops per byte moved, or zero if no bytes are moved
+        double arithmetic_intensity() const;
+    };
+
+    /// \brief The static cost of one call of a function
+    struct NGRAPH_API FunctionCost
+    {
+        /// \brief The cost of each node that computes something, in execution order.
+        ///        Parameters, constants and results are left out.
+        std::vector<std::pair<std::shared_ptr<Node>, NodeCost>> nodes;
+        size_t flops = 0;
+        /// \brief Bytes read and written by all nodes
+        size_t bytes = 0;
+        /// \brief Bytes of the parameters
+        size_t parameter_bytes = 0;
+        /// \brief Bytes of the constants, usually the weights
+        size_t constant_bytes = 0;
+        /// \brief Bytes of the outputs of all nodes in `nodes`
+        size_t activation_bytes = 0;
+
+        /// \returns flops per byte moved, or zero if no bytes are moved
+        double arithmetic_intensity() const;
+    };
+
+    /// \brief Estimates the cost of one call of `node`. Nodes with dynamic shapes or types
+    ///        cost nothing.
+    ///
+    /// FLOPs are estimated for convolutions (including grouped and backprop ones), Dot,
+    /// MatMul, BatchMatMul, Gemm, RNN, GRU and LSTM cells and sequences, pooling, softmax,
+    /// batch norm, arithmetic reductions and arithmetic elementwise ops.
+    NGRAPH_API
+    NodeCost estimate_cost(const Node& node);
+
+    /// \brief Estimates the cost of one call of `function`
+    NGRAPH_API
+    FunctionCost estimate_cost(const Function& function);
+}
@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cstring>
+
 #include "ngraph/cpio.hpp"
 #include "ngraph/log.hpp"
 
@@ -50,6 +53,13 @@ static uint32_t read_u32(istream& stream, bool big_endian = false)
     return rc;
 }
 
+static uint64_t read_u64(istream& stream)
+{
+    uint64_t high = read_u32(stream);
+    uint64_t low = read_u32(stream);
+    return (high << 32) + low;
+}
+
 static void write_u16(ostream& stream, uint16_t value)
 {
     const char* p = reinterpret_cast<const char*>(&value);
@@ -63,6 +73,17 @@ static void write_u32(ostream& stream, uint32_t value)
     write_u16(stream, v[0]);
 }
 
+static void write_u64(ostream& stream, uint64_t value)
+{
+    write_u32(stream, static_cast<uint32_t>(value >> 32));
+    write_u32(stream, static_cast<uint32_t>(value));
+}
+
+// The index is u32 count, then u16 name size + name, u32 size and u64 offset per record. It
+// is followed by u64 offset of the index and the magic.
+static const char s_index_magic[8] = {'N', 'G', 'C', 'P', 'I', 'O', 'I', 'X'};
+static const size_t s_index_footer_size = sizeof(uint64_t) + sizeof(s_index_magic);
+
 cpio::Header cpio::Header::read(istream& stream)
 {
     uint8_t ch;
@@ -115,10 +136,10 @@ cpio::Header cpio::Header::read(istream& stream)
     return rc;
 }
 
-void cpio::Header::write(ostream& stream, const string& name, uint32_t size)
+void cpio::Header::write(ostream& stream, const string& name, uint32_t size, uint16_t namesize)
 {
     // namesize includes the null string terminator so + 1
-    uint16_t namesize = static_cast<uint16_t>(name.size()) + 1;
+    namesize = max<uint16_t>(namesize, static_cast<uint16_t>(name.size()) + 1);
     write_u16(stream, 0x71C7);   // magic
     write_u16(stream, 0);        // dev
     write_u16(stream, 0);        // ino
@@ -130,7 +151,10 @@ void cpio::Header::write(ostream& stream, const string& name, uint32_t size)
     write_u32(stream, 0);        // mtime
     write_u16(stream, namesize); // namesize
     write_u32(stream, size);     // filesize
-    stream.write(name.c_str(), namesize + (namesize % 2));
+    // The name is followed by null characters up to namesize plus the pad to an even size
+    stream.write(name.c_str(), name.size());
+    string pad(namesize + (namesize % 2) - name.size(), '\0');
+    stream.write(pad.data(), pad.size());
 }
 
 cpio::Writer::Writer()
@@ -152,7 +176,8 @@ cpio::Writer::Writer(const string& filename)
 
 cpio::Writer::~Writer()
 {
-    write("TRAILER!!!", nullptr, 0);
+    write_record("TRAILER!!!", nullptr, 0, 0);
+    write_index();
     if (m_my_stream.is_open())
     {
         m_my_stream.close();
@@ -170,11 +195,61 @@ void cpio::Writer::open(const string& filename)
     m_my_stream.open(filename, ios_base::binary | ios_base::out);
 }
 
-void cpio::Writer::write(const string& record_name, const void* data, uint32_t size_in_bytes)
+void cpio::Writer::write(const string& record_name,
+                         const void* data,
+                         uint32_t size_in_bytes,
+                         size_t alignment)
 {
+    streamoff offset = write_record(record_name, data, size_in_bytes, alignment);
+    if (offset >= 0)
+    {
+        m_index.emplace_back(record_name, size_in_bytes, static_cast<size_t>(offset));
+    }
+    else
+    {
+        m_index_valid = false;
+    }
+}
+
+void cpio::Writer::write_index()
+{
+    streamoff index_offset = m_stream->tellp();
+    if (!m_index_valid || index_offset < 0)
+    {
+        return;
+    }
+    write_u32(*m_stream, static_cast<uint32_t>(m_index.size()));
+    for (const FileInfo& info : m_index)
+    {
+        write_u16(*m_stream, static_cast<uint16_t>(info.get_name().size()));
+        m_stream->write(info.get_name().data(), info.get_name().size());
+        write_u32(*m_stream, static_cast<uint32_t>(info.get_size()));
+        write_u64(*m_stream, info.get_offset());
+    }
+    write_u64(*m_stream, static_cast<uint64_t>(index_offset));
+    m_stream->write(s_index_magic, sizeof(s_index_magic));
+}
+
+streamoff cpio::Writer::write_record(const string& record_name,
+                                     const void* data,
+                                     uint32_t size_in_bytes,
+                                     size_t alignment)
+{
+    streamoff data_offset = -1;
     if (m_stream)
     {
-        Header::write(*m_stream, record_name, size_in_bytes);
+        uint16_t namesize = 0;
+        streamoff offset = m_stream->tellp();
+        if (alignment > 1 && offset >= 0)
+        {
+            // Records always start on an even offset and the header is 26 bytes
+            size_t name_offset = static_cast<size_t>(offset) + 26;
+            size_t data_offset = name_offset + record_name.size() + 1;
+            data_offset += (alignment - data_offset % alignment) % alignment;
+            namesize = static_cast<uint16_t>(data_offset - name_offset);
+        }
+        Header::write(*m_stream, record_name, size_in_bytes, namesize);
+        data_offset = m_stream->tellp();
         m_stream->write(static_cast<const char*>(data), size_in_bytes);
         if (size_in_bytes % 2)
         {
@@ -186,6 +261,7 @@ void cpio::Writer::write(const string& record_name, const void* data, uint32_t s
     {
         throw runtime_error("cpio writer output not set");
     }
+    return data_offset;
 }
 
 cpio::Reader::Reader()
@@ -229,9 +305,46 @@ void cpio::Reader::close()
     }
 }
 
+bool cpio::Reader::read_index()
+{
+    m_stream->clear();
+    m_stream->seekg(0, ios_base::end);
+    streamoff end = m_stream->tellg();
+    bool rc = false;
+    if (end >= static_cast<streamoff>(s_index_footer_size))
+    {
+        m_stream->seekg(end - static_cast<streamoff>(s_index_footer_size), ios_base::beg);
+        uint64_t index_offset = read_u64(*m_stream);
+        char magic[sizeof(s_index_magic)] = {};
+        m_stream->read(magic, sizeof(magic));
+        rc = *m_stream && memcmp(magic, s_index_magic, sizeof(magic)) == 0 &&
+             index_offset < static_cast<uint64_t>(end);
+        if (rc)
+        {
+            m_stream->seekg(static_cast<streamoff>(index_offset), ios_base::beg);
+            for (uint32_t count = read_u32(*m_stream); *m_stream && count > 0; count--)
+            {
+                string file_name(read_u16(*m_stream), '\0');
+                m_stream->read(&file_name[0], file_name.size());
+                size_t size = read_u32(*m_stream);
+                size_t offset = static_cast<size_t>(read_u64(*m_stream));
+                m_file_info.emplace_back(file_name, size, offset);
+            }
+            rc = static_cast<bool>(*m_stream);
+        }
+    }
+    if (!rc)
+    {
+        m_file_info.clear();
+    }
+    m_stream->clear();
+    m_stream->seekg(0, ios_base::beg);
+    return rc;
+}
+
 const vector<cpio::FileInfo>& cpio::Reader::get_file_info()
 {
-    if (m_file_info.empty())
+    if (m_file_info.empty() && !read_index())
     {
         while (*m_stream)
         {
@@ -239,8 +352,8 @@ const vector<cpio::FileInfo>& cpio::Reader::get_file_info()
 
             auto buffer = new char[header.namesize];
             m_stream->read(buffer, header.namesize);
-            // namesize includes the null string terminator so -1
-            string file_name = string(buffer, header.namesize - 1);
+            // namesize includes the null string terminator and any alignment padding
+            string file_name = string(buffer, strnlen(buffer, header.namesize));
             delete[] buffer;
             // skip any pad characters
             if (header.namesize % 2)
@@ -263,22 +376,34 @@ const vector<cpio::FileInfo>& cpio::Reader::get_file_info()
     return m_file_info;
 }
 
+const cpio::FileInfo* cpio::Reader::find(const string& file_name)
+{
+    if (m_file_index.empty())
+    {
+        const vector<FileInfo>& file_info = get_file_info();
+        for (size_t i = 0; i < file_info.size(); i++)
+        {
+            // The first record of a name wins, as for a scan
+            m_file_index.insert({file_info[i].get_name(), i});
+        }
+    }
+    auto it = m_file_index.find(file_name);
+    return it == m_file_index.end() ? nullptr : &m_file_info[it->second];
+}
+
 bool cpio::Reader::read(const string& file_name, void* data, size_t size_in_bytes)
 {
     bool rc = false;
-    for (const FileInfo& info : get_file_info())
+    if (const FileInfo* info = find(file_name))
     {
-        if (info.get_name() == file_name)
+        if (size_in_bytes != info->get_size())
         {
-            if (size_in_bytes != info.get_size())
-            {
-                throw runtime_error("Buffer size does not match file size");
-            }
-            m_stream->seekg(info.get_offset(), ios_base::beg);
-            m_stream->read(reinterpret_cast<char*>(data), size_in_bytes);
-            rc = true;
-            break;
+            throw runtime_error("Buffer size does not match file size");
         }
+        m_stream->clear();
+        m_stream->seekg(info->get_offset(), ios_base::beg);
+        m_stream->read(reinterpret_cast<char*>(data), size_in_bytes);
+        rc = true;
     }
     return rc;
 }
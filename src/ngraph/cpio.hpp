@@ -19,10 +19,15 @@
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // The CPIO file format can be found at
 // https://www.mkssoftware.com/docs/man4/cpio.4.asp
+//
+// Archives written by Writer are followed by an index of their records, placed after the
+// trailer where cpio tools ignore it. Reader uses the index, when there is one, to locate
+// records without reading the headers of the records before them.
 
 namespace ngraph
 {
@@ -54,7 +59,10 @@ public:
     uint32_t filesize;
 
     static Header read(std::istream&);
-    static void write(std::ostream&, const std::string& name, uint32_t size);
+    static void write(std::ostream&,
+                      const std::string& name,
+                      uint32_t size,
+                      uint16_t namesize = 0);
 
 private:
 };
@@ -88,11 +96,29 @@ public:
 
     void open(std::ostream& out);
     void open(const std::string& filename);
-    void write(const std::string& file_name, const void* data, uint32_t size_in_bytes);
+    /// \brief Writes a record.
+    ///
+    /// \param alignment If nonzero, the record name is padded with null characters so the
+    ///                  data starts at a multiple of `alignment` bytes from the start of the
+    ///                  stream, which lets readers map it in place.
+    void write(const std::string& file_name,
+               const void* data,
+               uint32_t size_in_bytes,
+               size_t alignment = 0);
 
 private:
+    // Returns the offset of the record's data, or -1 if the stream has no position
+    std::streamoff write_record(const std::string& file_name,
+                                const void* data,
+                                uint32_t size_in_bytes,
+                                size_t alignment);
+    void write_index();
+
     std::ostream* m_stream;
     std::ofstream m_my_stream;
+    std::vector<FileInfo> m_index;
+    // False if the offset of a record is unknown, in which case no index is written
+    bool m_index_valid{true};
 };
 
 class ngraph::cpio::Reader
@@ -107,11 +133,17 @@ public:
     void open(const std::string& filename);
     void close();
     const std::vector<FileInfo>& get_file_info();
+    /// \brief Returns the record named `file_name`, or nullptr if there is none
+    const FileInfo* find(const std::string& file_name);
     bool read(const std::string& file_name, void* data, size_t size_in_bytes);
     std::vector<char> read(const FileInfo& info);
 
 private:
+    // Reads the index that follows the archive. Returns false if there is none.
+    bool read_index();
+
     std::istream* m_stream;
     std::ifstream m_my_stream;
     std::vector<cpio::FileInfo> m_file_info;
+    std::unordered_map<std::string, size_t> m_file_index;
 };
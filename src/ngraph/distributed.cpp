@@ -14,12 +14,20 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "ngraph/check.hpp"
 #include "ngraph/distributed.hpp"
 #include "ngraph/distributed/mlsl.hpp"
 #include "ngraph/distributed/null.hpp"
 #include "ngraph/distributed/open_mpi.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/type.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
 
 using namespace ngraph;
 
@@ -37,6 +45,31 @@ namespace ngraph
     }
 
     constexpr DiscreteTypeInfo AttributeAdapter<reduction::Type>::type_info;
+
+    template <>
+    EnumNames<reduction::Algorithm>& EnumNames<reduction::Algorithm>::get()
+    {
+        static auto enum_names = EnumNames<reduction::Algorithm>(
+            "reduction::Algorithm",
+            {{"FLAT", reduction::Algorithm::FLAT},
+             {"HIERARCHICAL", reduction::Algorithm::HIERARCHICAL}});
+        return enum_names;
+    }
+
+    constexpr DiscreteTypeInfo AttributeAdapter<reduction::Algorithm>::type_info;
+
+    template <>
+    EnumNames<reduction::Compression>& EnumNames<reduction::Compression>::get()
+    {
+        static auto enum_names =
+            EnumNames<reduction::Compression>("reduction::Compression",
+                                              {{"NONE", reduction::Compression::NONE},
+                                               {"BF16", reduction::Compression::BF16},
+                                               {"F16", reduction::Compression::F16}});
+        return enum_names;
+    }
+
+    constexpr DiscreteTypeInfo AttributeAdapter<reduction::Compression>::type_info;
 }
 
 std::ostream& reduction::operator<<(std::ostream& out, const reduction::Type& obj)
@@ -44,6 +77,182 @@ std::ostream& reduction::operator<<(std::ostream& out, const reduction::Type& ob
     return out << as_string(obj);
 }
 
+std::ostream& reduction::operator<<(std::ostream& out, const reduction::Algorithm& obj)
+{
+    return out << as_string(obj);
+}
+
+std::ostream& reduction::operator<<(std::ostream& out, const reduction::Compression& obj)
+{
+    return out << as_string(obj);
+}
+
+namespace
+{
+    class CompletedRequest : public DistributedRequest
+    {
+    public:
+        void wait() override {}
+    };
+}
+
+std::unique_ptr<DistributedRequest> DistributedInterface::all_reduce_start(
+    void* in, void* out, element::Type_t element_type, reduction::Type reduce_type, size_t count)
+{
+    all_reduce(in, out, element_type, reduce_type, count);
+    return std::unique_ptr<DistributedRequest>(new CompletedRequest());
+}
+
+std::unique_ptr<DistributedRequest> DistributedInterface::send_start(const void* in,
+                                                                   element::Type_t element_type,
+                                                                   size_t count,
+                                                                   int dest_id,
+                                                                   size_t /* chunk_count */)
+{
+    send(in, element_type, count, dest_id);
+    return std::unique_ptr<DistributedRequest>(new CompletedRequest());
+}
+
+std::unique_ptr<DistributedRequest> DistributedInterface::recv_start(void* in,
+                                                                   element::Type_t element_type,
+                                                                   size_t count,
+                                                                   int src_id,
+                                                                   size_t /* chunk_count */)
+{
+    recv(in, element_type, count, src_id);
+    return std::unique_ptr<DistributedRequest>(new CompletedRequest());
+}
+
+void DistributedInterface::broadcast(void* in,
+                                     element::Type_t element_type,
+                                     size_t count,
+                                     int root_id,
+                                     const BroadcastOptions& /* options */)
+{
+    broadcast(in, element_type, count, root_id);
+}
+
+std::unique_ptr<DistributedRequest>
+    DistributedInterface::broadcast_start(void* in,
+                                          element::Type_t element_type,
+                                          size_t count,
+                                          int root_id,
+                                          const BroadcastOptions& options)
+{
+    broadcast(in, element_type, count, root_id, options);
+    return std::unique_ptr<DistributedRequest>(new CompletedRequest());
+}
+
+BroadcastOptions BroadcastOptions::get_default(size_t element_size)
+{
+    static const BroadcastOptions s_options = []() -> BroadcastOptions {
+        BroadcastOptions options;
+        const char* algorithm = std::getenv("NGRAPH_BROADCAST_ALGORITHM");
+        if (algorithm != nullptr && std::string(algorithm) == "RING")
+        {
+            options.algorithm = Algorithm::RING;
+        }
+        const char* chunk_bytes = std::getenv("NGRAPH_BROADCAST_CHUNK_BYTES");
+        // Held in bytes until the element size is known
+        options.chunk_count = chunk_bytes != nullptr
+                                  ? static_cast<size_t>(std::strtoull(chunk_bytes, nullptr, 10))
+                                  : size_t(4) << 20;
+        return options;
+    }();
+    BroadcastOptions options = s_options;
+    if (options.chunk_count != 0)
+    {
+        options.chunk_count = std::max<size_t>(options.chunk_count / element_size, 1);
+    }
+    return options;
+}
+
+void DistributedInterface::reduce_scatter(void* in,
+                                          void* out,
+                                          element::Type_t element_type,
+                                          reduction::Type reduce_type,
+                                          size_t count)
+{
+    size_t block_bytes = count * element::Type(element_type).size();
+    std::vector<char> reduced(block_bytes * get_size());
+    all_reduce(in, reduced.data(), element_type, reduce_type, count * get_size());
+    std::memcpy(out, reduced.data() + block_bytes * get_rank(), block_bytes);
+}
+
+void DistributedInterface::all_gather(void* in,
+                                      void* out,
+                                      element::Type_t element_type,
+                                      size_t count)
+{
+    size_t block_bytes = count * element::Type(element_type).size();
+    std::vector<char> blocks(block_bytes * get_size(), 0);
+    std::memcpy(blocks.data() + block_bytes * get_rank(), in, block_bytes);
+    all_reduce(blocks.data(), out, element_type, reduction::Type::SUM, count * get_size());
+}
+
+void DistributedInterface::all_reduce(void* in,
+                                      void* out,
+                                      element::Type_t element_type,
+                                      reduction::Type reduce_type,
+                                      size_t count,
+                                      reduction::Algorithm /* algorithm */,
+                                      reduction::Compression compression,
+                                      float* residual)
+{
+    if (compression == reduction::Compression::NONE)
+    {
+        all_reduce(in, out, element_type, reduce_type, count);
+        return;
+    }
+    NGRAPH_CHECK(element_type == element::Type_t::f32 && reduce_type == reduction::Type::SUM,
+                 "Only f32 sums can be compressed");
+    std::vector<uint16_t> wire(count);
+    std::vector<float> rounded(count);
+    compress(static_cast<float*>(in), residual, wire.data(), count, compression);
+    decompress(wire.data(), rounded.data(), count, compression);
+    all_reduce(rounded.data(), out, element_type, reduce_type, count);
+}
+
+void DistributedInterface::compress(const float* in,
+                                    float* residual,
+                                    uint16_t* wire,
+                                    size_t count,
+                                    reduction::Compression compression)
+{
+    bool bf16 = compression == reduction::Compression::BF16;
+    for (size_t i = 0; i < count; i++)
+    {
+        float value = in[i] + residual[i];
+        float rounded;
+        if (bf16)
+        {
+            bfloat16 w(value);
+            wire[i] = w.to_bits();
+            rounded = w;
+        }
+        else
+        {
+            float16 w(value);
+            wire[i] = w.to_bits();
+            rounded = w;
+        }
+        residual[i] = value - rounded;
+    }
+}
+
+void DistributedInterface::decompress(const uint16_t* wire,
+                                      float* out,
+                                      size_t count,
+                                      reduction::Compression compression)
+{
+    bool bf16 = compression == reduction::Compression::BF16;
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i] = bf16 ? static_cast<float>(bfloat16::from_bits(wire[i]))
+                      : static_cast<float>(float16::from_bits(wire[i]));
+    }
+}
+
 static std::unique_ptr<DistributedInterface> s_distributed_interface;
 
 void ngraph::set_distributed_interface(std::unique_ptr<DistributedInterface> distributed_interface)
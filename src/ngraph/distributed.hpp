@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -37,6 +38,28 @@ namespace ngraph
         };
 
         std::ostream& operator<<(std::ostream& out, const Type& obj);
+
+        /// \brief How the processes of an AllReduce exchange their values
+        enum class Algorithm
+        {
+            /// One collective over all processes
+            FLAT,
+            /// Reduce within each node through shared memory, all-reduce across one process
+            /// per node, then broadcast within each node
+            HIERARCHICAL,
+        };
+
+        std::ostream& operator<<(std::ostream& out, const Algorithm& obj);
+
+        /// \brief Precision in which f32 values of an AllReduce are exchanged
+        enum class Compression
+        {
+            NONE,
+            BF16,
+            F16,
+        };
+
+        std::ostream& operator<<(std::ostream& out, const Compression& obj);
     }
 
     template <>
@@ -53,6 +76,68 @@ namespace ngraph
         const DiscreteTypeInfo& get_type_info() const override { return type_info; }
     };
 
+    template <>
+    class AttributeAdapter<reduction::Algorithm>
+        : public EnumAttributeAdapterBase<reduction::Algorithm>
+    {
+    public:
+        AttributeAdapter(reduction::Algorithm& value)
+            : EnumAttributeAdapterBase<reduction::Algorithm>(value)
+        {
+        }
+
+        NGRAPH_API
+        static constexpr DiscreteTypeInfo type_info{"AttributeAdapter<reduction::Algorithm>", 0};
+        const DiscreteTypeInfo& get_type_info() const override { return type_info; }
+    };
+
+    template <>
+    class AttributeAdapter<reduction::Compression>
+        : public EnumAttributeAdapterBase<reduction::Compression>
+    {
+    public:
+        AttributeAdapter(reduction::Compression& value)
+            : EnumAttributeAdapterBase<reduction::Compression>(value)
+        {
+        }
+
+        NGRAPH_API
+        static constexpr DiscreteTypeInfo type_info{"AttributeAdapter<reduction::Compression>",
+                                                    0};
+        const DiscreteTypeInfo& get_type_info() const override { return type_info; }
+    };
+
+    /// \brief How DistributedInterface::broadcast moves the values of the root to the other
+    ///        processes
+    struct NGRAPH_API BroadcastOptions
+    {
+        enum class Algorithm
+        {
+            /// The library's own broadcast, issued for every chunk at once
+            TREE,
+            /// Each process receives the chunks from the previous rank and forwards every chunk
+            /// to the next rank while the following ones arrive
+            RING,
+        };
+
+        Algorithm algorithm{Algorithm::TREE};
+        /// Values per message, or 0 to send all values in one message
+        size_t chunk_count{0};
+
+        /// \brief Options for values of `element_size` bytes, from NGRAPH_BROADCAST_ALGORITHM
+        ///        (TREE or RING) and NGRAPH_BROADCAST_CHUNK_BYTES (default 4 MiB)
+        static BroadcastOptions get_default(size_t element_size);
+    };
+
+    /// \brief Handle to a collective started by DistributedInterface that may still be running
+    class DistributedRequest
+    {
+    public:
+        virtual ~DistributedRequest() {}
+        /// \brief Blocks until the collective has completed and its output can be read
+        virtual void wait() = 0;
+    };
+
     class DistributedInterface
     {
     public:
@@ -67,11 +152,95 @@ namespace ngraph
                                 element::Type_t element_type,
                                 reduction::Type reduce_type,
                                 size_t count) = 0;
+        /// \brief AllReduce with a choice of exchange algorithm and wire precision.
+        ///
+        /// With compression, f32 values are rounded to 16 bits before they are exchanged. The
+        /// rounding error is kept in `residual`, `count` floats owned by the caller and zeroed
+        /// before the first call, and added to the input of the next call so that no part of a
+        /// gradient is lost over time. Only reduction::Type::SUM can be compressed. The default
+        /// ignores the algorithm and emulates the compression around the full precision
+        /// all_reduce.
+        virtual void all_reduce(void* in,
+                                void* out,
+                                element::Type_t element_type,
+                                reduction::Type reduce_type,
+                                size_t count,
+                                reduction::Algorithm algorithm,
+                                reduction::Compression compression,
+                                float* residual);
+        /// \brief Starts an AllReduce and returns without waiting for it to finish, so that
+        ///        computation can overlap with communication. `in` and `out` must stay valid and
+        ///        unmodified until wait() has returned on the request. The default runs the
+        ///        blocking all_reduce and returns a request that is already complete.
+        virtual std::unique_ptr<DistributedRequest> all_reduce_start(void* in,
+                                                                     void* out,
+                                                                     element::Type_t element_type,
+                                                                     reduction::Type reduce_type,
+                                                                     size_t count);
+        /// \brief Reduces `count * get_size()` values across processes and leaves the `count`
+        ///        values of block get_rank() in `out`, so each process holds one shard of the
+        ///        result. The default runs all_reduce on the whole input and keeps its block.
+        virtual void reduce_scatter(void* in,
+                                    void* out,
+                                    element::Type_t element_type,
+                                    reduction::Type reduce_type,
+                                    size_t count);
+        /// \brief Concatenates the `count` values of every process in rank order into `out`,
+        ///        which holds `count * get_size()` values. The default sums buffers that are
+        ///        zero outside each process's block with all_reduce.
+        virtual void all_gather(void* in, void* out, element::Type_t element_type, size_t count);
         virtual void
             broadcast(void* in, element::Type_t element_type, size_t count, int root_id) = 0;
+        /// \brief Broadcast that splits the values into chunks of `options.chunk_count` and
+        ///        moves them with `options.algorithm`. The default ignores the options.
+        virtual void broadcast(void* in,
+                               element::Type_t element_type,
+                               size_t count,
+                               int root_id,
+                               const BroadcastOptions& options);
+        /// \brief Starts a broadcast and returns without waiting for it to finish, so that
+        ///        several tensors can be in flight at once. `in` must not be accessed until
+        ///        wait() has returned on the request. The default runs the blocking broadcast
+        ///        and returns a request that is already complete.
+        virtual std::unique_ptr<DistributedRequest>
+            broadcast_start(void* in,
+                            element::Type_t element_type,
+                            size_t count,
+                            int root_id,
+                            const BroadcastOptions& options);
         virtual void recv(void* in, element::Type_t element_type, size_t count, int src_id) = 0;
         virtual void
             send(const void* in, element::Type_t element_type, size_t count, int dest_id) = 0;
+        /// \brief Starts sending `count` values to `dest_id` in messages of at most `chunk_count`
+        ///        values, so that the receiver can make progress on early chunks. `in` must stay
+        ///        unmodified until the request completes. The receiver must call recv_start with
+        ///        the same count and chunk_count. The default runs the blocking send.
+        virtual std::unique_ptr<DistributedRequest> send_start(const void* in,
+                                                               element::Type_t element_type,
+                                                               size_t count,
+                                                               int dest_id,
+                                                               size_t chunk_count);
+        /// \brief Starts receiving values sent with send_start into `in`, which must not be
+        ///        read until the request completes. The default runs the blocking recv.
+        virtual std::unique_ptr<DistributedRequest> recv_start(void* in,
+                                                               element::Type_t element_type,
+                                                               size_t count,
+                                                               int src_id,
+                                                               size_t chunk_count);
+
+    protected:
+        /// \brief Rounds `in` plus `residual` to the 16-bit `wire` format of `compression` and
+        ///        stores the rounding error back in `residual`
+        static void compress(const float* in,
+                             float* residual,
+                             uint16_t* wire,
+                             size_t count,
+                             reduction::Compression compression);
+        /// \brief Widens the 16-bit `wire` values of `compression` back to f32
+        static void decompress(const uint16_t* wire,
+                               float* out,
+                               size_t count,
+                               reduction::Compression compression);
     };
 
     void set_distributed_interface(std::unique_ptr<DistributedInterface> distributed_interface);
@@ -17,6 +17,7 @@
 #pragma once
 
 #ifdef NGRAPH_DISTRIBUTED_MLSL_ENABLE
+#include <memory>
 #include <string>
 
 #include <mlsl.hpp>
@@ -65,58 +66,77 @@ namespace ngraph
                 std::printf("%s [MLSL RANK: %d]: %s\n", timestamp.c_str(), get_rank(), buf.data());
             }
 
+            // Hierarchical exchange is left to MLSL's own topology handling; compression is
+            // emulated by the base class
+            using DistributedInterface::all_reduce;
             void all_reduce(void* in,
                             void* out,
                             element::Type_t element_type,
                             reduction::Type reduce_type,
                             size_t count) override
             {
-                auto data_type = MLSL::DT_FLOAT;
-
-                if (element_type == element::Type_t::f32)
-                {
-                    data_type = MLSL::DT_FLOAT;
-                }
-                else if (element_type == element::Type_t::f64)
-                {
-                    data_type = MLSL::DT_DOUBLE;
-                }
-                else
-                {
-                    throw std::runtime_error("AllReduce op supports only f32 and f64 types");
-                }
-
-                decltype(MLSL::RT_SUM) mlsl_reduce_type;
-#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic error "-Wswitch"
-#pragma GCC diagnostic error "-Wswitch-enum"
-#endif
-                switch (reduce_type)
-                {
-                case reduction::Type::SUM: mlsl_reduce_type = MLSL::RT_SUM; break;
-                case reduction::Type::PROD:
-                    throw std::runtime_error("MLSL doesn't support allreduce prod");
-                    break;
-                case reduction::Type::MIN: mlsl_reduce_type = MLSL::RT_MIN; break;
-                case reduction::Type::MAX: mlsl_reduce_type = MLSL::RT_MAX; break;
-                }
-#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
-#pragma GCC diagnostic pop
-#endif
+                all_reduce_start(in, out, element_type, reduce_type, count)->wait();
+            }
 
+            std::unique_ptr<DistributedRequest> all_reduce_start(void* in,
+                                                                 void* out,
+                                                                 element::Type_t element_type,
+                                                                 reduction::Type reduce_type,
+                                                                 size_t count) override
+            {
+                auto data_type = get_data_type(element_type);
+                auto mlsl_reduce_type = get_reduce_type(reduce_type);
                 MLSL::Environment& env = MLSL::Environment::GetEnv();
                 MLSL::Distribution* distribution = env.CreateDistribution(env.GetProcessCount(), 1);
                 MLSL::CommReq* req = distribution->AllReduce(
                     in, out, count, data_type, mlsl_reduce_type, MLSL::GT_DATA);
-                env.Wait(req);
-                env.DeleteDistribution(distribution);
+                return std::unique_ptr<DistributedRequest>(new MLSLRequest(distribution, req));
+            }
+
+            void reduce_scatter(void* in,
+                                void* out,
+                                element::Type_t element_type,
+                                reduction::Type reduce_type,
+                                size_t count) override
+            {
+                auto data_type = get_data_type(element_type);
+                auto mlsl_reduce_type = get_reduce_type(reduce_type);
+                MLSL::Environment& env = MLSL::Environment::GetEnv();
+                MLSL::Distribution* distribution = env.CreateDistribution(env.GetProcessCount(), 1);
+                MLSL::CommReq* req = distribution->ReduceScatter(
+                    in, out, count, data_type, mlsl_reduce_type, MLSL::GT_DATA);
+                MLSLRequest(distribution, req).wait();
             }
 
+            void all_gather(void* in,
+                            void* out,
+                            element::Type_t element_type,
+                            size_t count) override
+            {
+                auto data_type = get_data_type(element_type);
+                MLSL::Environment& env = MLSL::Environment::GetEnv();
+                MLSL::Distribution* distribution = env.CreateDistribution(env.GetProcessCount(), 1);
+                MLSL::CommReq* req =
+                    distribution->AllGather(in, count, out, data_type, MLSL::GT_DATA);
+                MLSLRequest(distribution, req).wait();
+            }
+
+            // MLSL picks its own algorithm and message sizes, so the options are ignored
+            using DistributedInterface::broadcast;
             void broadcast(void* in,
                            element::Type_t element_type,
                            size_t count,
                            int root_id) override
+            {
+                broadcast_start(in, element_type, count, root_id, BroadcastOptions())->wait();
+            }
+
+            std::unique_ptr<DistributedRequest>
+                broadcast_start(void* in,
+                                element::Type_t element_type,
+                                size_t count,
+                                int root_id,
+                                const BroadcastOptions& /* options */) override
             {
                 auto data_type = MLSL::DT_FLOAT;
 
@@ -134,8 +154,7 @@ namespace ngraph
                 MLSL::Distribution* distribution = env.CreateDistribution(env.GetProcessCount(), 1);
                 MLSL::CommReq* req =
                     distribution->Bcast(in, count, data_type, root_id, MLSL::GT_DATA);
-                env.Wait(req);
-                env.DeleteDistribution(distribution);
+                return std::unique_ptr<DistributedRequest>(new MLSLRequest(distribution, req));
             }
 
             void recv(void* /* in */,
@@ -155,6 +174,67 @@ namespace ngraph
             }
 
         protected:
+            class MLSLRequest : public DistributedRequest
+            {
+            public:
+                MLSLRequest(MLSL::Distribution* distribution, MLSL::CommReq* req)
+                    : m_distribution(distribution)
+                    , m_req(req)
+                {
+                }
+                ~MLSLRequest() override { wait(); }
+                void wait() override
+                {
+                    if (m_distribution != nullptr)
+                    {
+                        MLSL::Environment& env = MLSL::Environment::GetEnv();
+                        env.Wait(m_req);
+                        env.DeleteDistribution(m_distribution);
+                        m_distribution = nullptr;
+                    }
+                }
+
+            private:
+                MLSL::Distribution* m_distribution;
+                MLSL::CommReq* m_req;
+            };
+
+            MLSL::DataType get_data_type(element::Type_t element_type)
+            {
+                if (element_type == element::Type_t::f32)
+                {
+                    return MLSL::DT_FLOAT;
+                }
+                else if (element_type == element::Type_t::f64)
+                {
+                    return MLSL::DT_DOUBLE;
+                }
+                throw std::runtime_error("MLSL collectives support only f32 and f64 types");
+            }
+
+            decltype(MLSL::RT_SUM) get_reduce_type(reduction::Type reduce_type)
+            {
+                decltype(MLSL::RT_SUM) mlsl_reduce_type;
+#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic error "-Wswitch"
+#pragma GCC diagnostic error "-Wswitch-enum"
+#endif
+                switch (reduce_type)
+                {
+                case reduction::Type::SUM: mlsl_reduce_type = MLSL::RT_SUM; break;
+                case reduction::Type::PROD:
+                    throw std::runtime_error("MLSL doesn't support allreduce prod");
+                    break;
+                case reduction::Type::MIN: mlsl_reduce_type = MLSL::RT_MIN; break;
+                case reduction::Type::MAX: mlsl_reduce_type = MLSL::RT_MAX; break;
+                }
+#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
+#pragma GCC diagnostic pop
+#endif
+                return mlsl_reduce_type;
+            }
+
             std::string m_name{"MLSL"};
             bool m_initialized_mlsl = false;
         };
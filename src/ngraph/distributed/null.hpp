@@ -35,6 +35,7 @@ namespace ngraph
             {
                 std::printf("%s: %s\n", timestamp.c_str(), buf.data());
             }
+            using DistributedInterface::all_reduce;
             void all_reduce(void* /* in */,
                             void* /* out */,
                             element::Type_t /* element_type */,
@@ -44,6 +45,7 @@ namespace ngraph
                 throw ngraph_error("Distributed Library not supported/mentioned");
             }
 
+            using DistributedInterface::broadcast;
             void broadcast(void* /* in */,
                            element::Type_t /* element_type */,
                            size_t /* count */,
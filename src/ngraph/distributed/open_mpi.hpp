@@ -22,10 +22,16 @@
 #include "ngraph/distributed.hpp"
 
 #ifdef NGRAPH_DISTRIBUTED_OMPI_ENABLE
+#include <algorithm>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <mpi.h>
 
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
+
 namespace ngraph
 {
     namespace distributed
@@ -49,6 +55,10 @@ namespace ngraph
             {
                 int is_mpi_finalized = 0;
                 MPI_Finalized(&is_mpi_finalized);
+                if (!is_mpi_finalized)
+                {
+                    free_resources();
+                }
                 if (!is_mpi_finalized && m_initialized_mpi)
                 {
                     MPI_Finalize();
@@ -83,39 +93,111 @@ namespace ngraph
                             reduction::Type reduce_type,
                             size_t count) override
             {
-                auto data_type = MPI_FLOAT;
+                MPI_Allreduce(in,
+                              out,
+                              count,
+                              get_all_reduce_data_type(element_type),
+                              get_all_reduce_op(reduce_type),
+                              MPI_COMM_WORLD);
+            }
 
-                if (element_type == element::Type_t::f32)
+            void all_reduce(void* in,
+                            void* out,
+                            element::Type_t element_type,
+                            reduction::Type reduce_type,
+                            size_t count,
+                            reduction::Algorithm algorithm,
+                            reduction::Compression compression,
+                            float* residual) override
+            {
+                void* send_buffer = in;
+                void* recv_buffer = out;
+                MPI_Datatype data_type;
+                MPI_Op op;
+                std::vector<uint16_t> wire_in;
+                std::vector<uint16_t> wire_out;
+                if (compression == reduction::Compression::NONE)
                 {
-                    data_type = MPI_FLOAT;
+                    data_type = get_all_reduce_data_type(element_type);
+                    op = get_all_reduce_op(reduce_type);
                 }
-                else if (element_type == element::Type_t::f64)
+                else
+                {
+                    if (element_type != element::Type_t::f32 ||
+                        reduce_type != reduction::Type::SUM)
+                    {
+                        throw std::runtime_error("Only f32 sums can be compressed");
+                    }
+                    wire_in.resize(count);
+                    wire_out.resize(count);
+                    compress(static_cast<float*>(in), residual, wire_in.data(), count, compression);
+                    send_buffer = wire_in.data();
+                    recv_buffer = wire_out.data();
+                    data_type = MPI_UINT16_T;
+                    op = get_compressed_sum_op(compression);
+                }
+
+                if (algorithm == reduction::Algorithm::HIERARCHICAL)
                 {
-                    data_type = MPI_DOUBLE;
+                    create_node_communicators();
+                    // Sum within the node into its leader, across leaders, then back out
+                    MPI_Reduce(send_buffer, recv_buffer, count, data_type, op, 0, m_node_comm);
+                    if (m_leader_comm != MPI_COMM_NULL)
+                    {
+                        MPI_Allreduce(
+                            MPI_IN_PLACE, recv_buffer, count, data_type, op, m_leader_comm);
+                    }
+                    MPI_Bcast(recv_buffer, count, data_type, 0, m_node_comm);
                 }
                 else
                 {
-                    throw std::runtime_error("AllReduce op supports only f32 and f64 types");
+                    MPI_Allreduce(send_buffer, recv_buffer, count, data_type, op, MPI_COMM_WORLD);
                 }
 
-                decltype(MPI_SUM) mpi_reduce_type;
-#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic error "-Wswitch"
-#pragma GCC diagnostic error "-Wswitch-enum"
-#endif
-                switch (reduce_type)
+                if (compression != reduction::Compression::NONE)
                 {
-                case reduction::Type::SUM: mpi_reduce_type = MPI_SUM; break;
-                case reduction::Type::PROD: mpi_reduce_type = MPI_PROD; break;
-                case reduction::Type::MIN: mpi_reduce_type = MPI_MIN; break;
-                case reduction::Type::MAX: mpi_reduce_type = MPI_MAX; break;
+                    decompress(wire_out.data(), static_cast<float*>(out), count, compression);
                 }
-#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
-#pragma GCC diagnostic pop
-#endif
+            }
+
+            std::unique_ptr<DistributedRequest> all_reduce_start(void* in,
+                                                                 void* out,
+                                                                 element::Type_t element_type,
+                                                                 reduction::Type reduce_type,
+                                                                 size_t count) override
+            {
+                std::unique_ptr<OpenMPIRequest> request(new OpenMPIRequest(1));
+                MPI_Iallreduce(in,
+                               out,
+                               count,
+                               get_all_reduce_data_type(element_type),
+                               get_all_reduce_op(reduce_type),
+                               MPI_COMM_WORLD,
+                               &request->m_requests[0]);
+                return std::move(request);
+            }
 
-                MPI_Allreduce(in, out, count, data_type, mpi_reduce_type, MPI_COMM_WORLD);
+            void reduce_scatter(void* in,
+                                void* out,
+                                element::Type_t element_type,
+                                reduction::Type reduce_type,
+                                size_t count) override
+            {
+                MPI_Reduce_scatter_block(in,
+                                         out,
+                                         count,
+                                         get_all_reduce_data_type(element_type),
+                                         get_all_reduce_op(reduce_type),
+                                         MPI_COMM_WORLD);
+            }
+
+            void all_gather(void* in,
+                            void* out,
+                            element::Type_t element_type,
+                            size_t count) override
+            {
+                auto data_type = ngraph_type_to_mpi_type(element_type);
+                MPI_Allgather(in, count, data_type, out, count, data_type, MPI_COMM_WORLD);
             }
 
             void broadcast(void* in,
@@ -123,34 +205,94 @@ namespace ngraph
                            size_t count,
                            int root_id) override
             {
-                auto data_type = MPI_FLOAT;
+                MPI_Bcast(
+                    in, count, get_broadcast_data_type(element_type), root_id, MPI_COMM_WORLD);
+            }
+
+            void broadcast(void* in,
+                           element::Type_t element_type,
+                           size_t count,
+                           int root_id,
+                           const BroadcastOptions& options) override
+            {
+                broadcast_start(in, element_type, count, root_id, options)->wait();
+            }
 
-                if (element_type == element::Type_t::f64)
+            std::unique_ptr<DistributedRequest>
+                broadcast_start(void* in,
+                                element::Type_t element_type,
+                                size_t count,
+                                int root_id,
+                                const BroadcastOptions& options) override
+            {
+                auto data_type = get_broadcast_data_type(element_type);
+                auto element_size = element::Type(element_type).size();
+                size_t chunk_count = options.chunk_count == 0 ? count : options.chunk_count;
+                size_t num_chunks = count == 0 ? 0 : (count + chunk_count - 1) / chunk_count;
+                auto chunk = [&](size_t i) -> std::pair<char*, int> {
+                    size_t offset = i * chunk_count;
+                    return {static_cast<char*>(in) + offset * element_size,
+                            static_cast<int>(std::min(chunk_count, count - offset))};
+                };
+
+                if (options.algorithm == BroadcastOptions::Algorithm::TREE)
                 {
-                    data_type = MPI_DOUBLE;
+                    std::unique_ptr<OpenMPIRequest> request(new OpenMPIRequest(num_chunks));
+                    for (size_t i = 0; i < num_chunks; i++)
+                    {
+                        auto c = chunk(i);
+                        MPI_Ibcast(c.first,
+                                   c.second,
+                                   data_type,
+                                   root_id,
+                                   MPI_COMM_WORLD,
+                                   &request->m_requests[i]);
+                    }
+                    return std::move(request);
                 }
-                else if (element_type != element::Type_t::f32)
+
+                // Ring ordered from the root; the last process does not forward
+                int size = get_size();
+                int rank = get_rank();
+                int position = (rank - root_id + size) % size;
+                std::unique_ptr<RingBroadcastRequest> request(new RingBroadcastRequest());
+                request->m_data_type = data_type;
+                request->m_next = position + 1 < size ? (rank + 1) % size : -1;
+                for (size_t i = 0; i < num_chunks; i++)
                 {
-                    throw std::runtime_error(
-                        "BroadcastDistributed op supports only f32 and f64 types");
+                    request->m_chunks.push_back(chunk(i));
                 }
-                MPI_Bcast(in, count, data_type, root_id, MPI_COMM_WORLD);
-            }
-
-            void recv(void* in, element::Type_t element_type, size_t count, int src_id) override
-            {
-                auto data_type = MPI_FLOAT;
-                // for send/recv bf16 and f16 can be treat as MPI_SHORT since all are 16bits
-                if (element_type == element::Type_t::bf16 || element_type == element::Type_t::f16)
+                if (position == 0)
                 {
-                    data_type = MPI_SHORT;
+                    request->forward_all();
                 }
                 else
                 {
-                    data_type = ngraph_type_to_mpi_type(element_type);
+                    request->m_recvs.resize(num_chunks, MPI_REQUEST_NULL);
+                    for (size_t i = 0; i < num_chunks; i++)
+                    {
+                        auto& c = request->m_chunks[i];
+                        MPI_Irecv(c.first,
+                                  c.second,
+                                  data_type,
+                                  (rank - 1 + size) % size,
+                                  s_broadcast_tag,
+                                  MPI_COMM_WORLD,
+                                  &request->m_recvs[i]);
+                    }
                 }
+                return std::move(request);
+            }
 
-                MPI_Recv(in, count, data_type, src_id, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            void recv(void* in, element::Type_t element_type, size_t count, int src_id) override
+            {
+                MPI_Recv(in,
+                         count,
+                         get_point_to_point_type(element_type),
+                         src_id,
+                         0,
+                         MPI_COMM_WORLD,
+                         MPI_STATUS_IGNORE);
             }
 
             void send(const void* in,
@@ -158,21 +300,256 @@ namespace ngraph
                       size_t count,
                       int dest_id) override
             {
-                auto data_type = MPI_FLOAT;
+                MPI_Send(
+                    in, count, get_point_to_point_type(element_type), dest_id, 0, MPI_COMM_WORLD);
+            }
+
+            std::unique_ptr<DistributedRequest> send_start(const void* in,
+                                                           element::Type_t element_type,
+                                                           size_t count,
+                                                           int dest_id,
+                                                           size_t chunk_count) override
+            {
+                auto data_type = get_point_to_point_type(element_type);
+                auto element_size = element::Type(element_type).size();
+                chunk_count = chunk_count == 0 ? count : chunk_count;
+                std::unique_ptr<OpenMPIRequest> request(
+                    new OpenMPIRequest((count + chunk_count - 1) / chunk_count));
+                for (size_t i = 0; i < request->m_requests.size(); i++)
+                {
+                    size_t offset = i * chunk_count;
+                    MPI_Isend(static_cast<const char*>(in) + offset * element_size,
+                              std::min(chunk_count, count - offset),
+                              data_type,
+                              dest_id,
+                              0,
+                              MPI_COMM_WORLD,
+                              &request->m_requests[i]);
+                }
+                return std::move(request);
+            }
+
+            std::unique_ptr<DistributedRequest> recv_start(void* in,
+                                                           element::Type_t element_type,
+                                                           size_t count,
+                                                           int src_id,
+                                                           size_t chunk_count) override
+            {
+                auto data_type = get_point_to_point_type(element_type);
+                auto element_size = element::Type(element_type).size();
+                chunk_count = chunk_count == 0 ? count : chunk_count;
+                std::unique_ptr<OpenMPIRequest> request(
+                    new OpenMPIRequest((count + chunk_count - 1) / chunk_count));
+                for (size_t i = 0; i < request->m_requests.size(); i++)
+                {
+                    size_t offset = i * chunk_count;
+                    MPI_Irecv(static_cast<char*>(in) + offset * element_size,
+                              std::min(chunk_count, count - offset),
+                              data_type,
+                              src_id,
+                              0,
+                              MPI_COMM_WORLD,
+                              &request->m_requests[i]);
+                }
+                return std::move(request);
+            }
+
+        protected:
+            class OpenMPIRequest : public DistributedRequest
+            {
+            public:
+                OpenMPIRequest(size_t size)
+                    : m_requests(size, MPI_REQUEST_NULL)
+                {
+                }
+                ~OpenMPIRequest() override { wait(); }
+                // MPI_Waitall returns immediately once the requests have been reset to
+                // MPI_REQUEST_NULL
+                void wait() override
+                {
+                    MPI_Waitall(static_cast<int>(m_requests.size()),
+                                m_requests.data(),
+                                MPI_STATUSES_IGNORE);
+                }
+                std::vector<MPI_Request> m_requests;
+            };
+
+            // Messages of ring broadcasts are kept apart from those of send and recv
+            static constexpr int s_broadcast_tag = 1;
+
+            // Ring broadcast of one process: receives each chunk from the previous rank and
+            // passes it on to the next. Forwarding happens in wait(), so chunks reach the next
+            // rank once this process waits, while all receives are posted up front.
+            class RingBroadcastRequest : public DistributedRequest
+            {
+            public:
+                ~RingBroadcastRequest() override { wait(); }
+                void wait() override
+                {
+                    if (!m_recvs.empty())
+                    {
+                        for (size_t i = 0; i < m_chunks.size(); i++)
+                        {
+                            MPI_Wait(&m_recvs[i], MPI_STATUS_IGNORE);
+                            forward(i);
+                        }
+                        m_recvs.clear();
+                    }
+                    MPI_Waitall(
+                        static_cast<int>(m_sends.size()), m_sends.data(), MPI_STATUSES_IGNORE);
+                }
+                void forward_all()
+                {
+                    for (size_t i = 0; i < m_chunks.size(); i++)
+                    {
+                        forward(i);
+                    }
+                }
+                void forward(size_t i)
+                {
+                    if (m_next >= 0)
+                    {
+                        m_sends.push_back(MPI_REQUEST_NULL);
+                        MPI_Isend(m_chunks[i].first,
+                                  m_chunks[i].second,
+                                  m_data_type,
+                                  m_next,
+                                  s_broadcast_tag,
+                                  MPI_COMM_WORLD,
+                                  &m_sends.back());
+                    }
+                }
+
+                MPI_Datatype m_data_type;
+                int m_next;
+                std::vector<std::pair<char*, int>> m_chunks;
+                std::vector<MPI_Request> m_recvs;
+                std::vector<MPI_Request> m_sends;
+            };
+
+            MPI_Datatype get_broadcast_data_type(element::Type_t element_type)
+            {
+                if (element_type == element::Type_t::f32)
+                {
+                    return MPI_FLOAT;
+                }
+                else if (element_type == element::Type_t::f64)
+                {
+                    return MPI_DOUBLE;
+                }
+                throw std::runtime_error("BroadcastDistributed op supports only f32 and f64 types");
+            }
+
+            MPI_Datatype get_point_to_point_type(element::Type_t element_type)
+            {
                 // for send/recv bf16 and f16 can be treat as MPI_SHORT since all are 16bits
                 if (element_type == element::Type_t::bf16 || element_type == element::Type_t::f16)
                 {
-                    data_type = MPI_SHORT;
+                    return MPI_SHORT;
                 }
-                else
+                return ngraph_type_to_mpi_type(element_type);
+            }
+
+            template <typename T>
+            static void compressed_sum(void* in, void* inout, int* len, MPI_Datatype*)
+            {
+                auto a = static_cast<const uint16_t*>(in);
+                auto b = static_cast<uint16_t*>(inout);
+                for (int i = 0; i < *len; i++)
                 {
-                    data_type = ngraph_type_to_mpi_type(element_type);
+                    float sum = static_cast<float>(T::from_bits(a[i])) +
+                                static_cast<float>(T::from_bits(b[i]));
+                    b[i] = T(sum).to_bits();
                 }
+            }
 
-                MPI_Send(in, count, data_type, dest_id, 0, MPI_COMM_WORLD);
+            MPI_Op get_compressed_sum_op(reduction::Compression compression)
+            {
+                MPI_Op& op =
+                    compression == reduction::Compression::BF16 ? m_bf16_sum_op : m_f16_sum_op;
+                if (op == MPI_OP_NULL)
+                {
+                    if (compression == reduction::Compression::BF16)
+                    {
+                        MPI_Op_create(&compressed_sum<bfloat16>, 1, &op);
+                    }
+                    else
+                    {
+                        MPI_Op_create(&compressed_sum<float16>, 1, &op);
+                    }
+                }
+                return op;
+            }
+
+            // Collective over all processes, so it runs on the first hierarchical AllReduce,
+            // which every process reaches
+            void create_node_communicators()
+            {
+                if (m_node_comm != MPI_COMM_NULL)
+                {
+                    return;
+                }
+                int rank = get_rank();
+                MPI_Comm_split_type(
+                    MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &m_node_comm);
+                int node_rank;
+                MPI_Comm_rank(m_node_comm, &node_rank);
+                MPI_Comm_split(
+                    MPI_COMM_WORLD, node_rank == 0 ? 0 : MPI_UNDEFINED, rank, &m_leader_comm);
+            }
+
+            void free_resources()
+            {
+                for (MPI_Comm* comm : {&m_node_comm, &m_leader_comm})
+                {
+                    if (*comm != MPI_COMM_NULL)
+                    {
+                        MPI_Comm_free(comm);
+                    }
+                }
+                for (MPI_Op* op : {&m_bf16_sum_op, &m_f16_sum_op})
+                {
+                    if (*op != MPI_OP_NULL)
+                    {
+                        MPI_Op_free(op);
+                    }
+                }
+            }
+
+            MPI_Datatype get_all_reduce_data_type(element::Type_t element_type)
+            {
+                if (element_type == element::Type_t::f32)
+                {
+                    return MPI_FLOAT;
+                }
+                else if (element_type == element::Type_t::f64)
+                {
+                    return MPI_DOUBLE;
+                }
+                throw std::runtime_error("AllReduce op supports only f32 and f64 types");
+            }
+
+            decltype(MPI_SUM) get_all_reduce_op(reduction::Type reduce_type)
+            {
+                decltype(MPI_SUM) mpi_reduce_type;
+#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic error "-Wswitch"
+#pragma GCC diagnostic error "-Wswitch-enum"
+#endif
+                switch (reduce_type)
+                {
+                case reduction::Type::SUM: mpi_reduce_type = MPI_SUM; break;
+                case reduction::Type::PROD: mpi_reduce_type = MPI_PROD; break;
+                case reduction::Type::MIN: mpi_reduce_type = MPI_MIN; break;
+                case reduction::Type::MAX: mpi_reduce_type = MPI_MAX; break;
+                }
+#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
+#pragma GCC diagnostic pop
+#endif
+                return mpi_reduce_type;
             }
 
-        protected:
             MPI_Datatype ngraph_type_to_mpi_type(element::Type_t& n_type)
             {
                 MPI_Datatype m_type = MPI_FLOAT;
@@ -208,6 +585,11 @@ namespace ngraph
 
             std::string m_name;
             bool m_initialized_mpi = false;
+            // Processes sharing this node's memory, and one leader process per node
+            MPI_Comm m_node_comm = MPI_COMM_NULL;
+            MPI_Comm m_leader_comm = MPI_COMM_NULL;
+            MPI_Op m_bf16_sum_op = MPI_OP_NULL;
+            MPI_Op m_f16_sum_op = MPI_OP_NULL;
         };
     }
 }
@@ -0,0 +1,322 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "ngraph/attribute_visitor.hpp"
+#include "ngraph/fingerprint.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/tensor_iterator.hpp"
+#include "ngraph/serializer.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Fixed mixing constants rather than std::hash, whose values may differ between standard
+    // libraries and runs
+    class Hasher
+    {
+    public:
+        void add(uint64_t value)
+        {
+            m_hash = (m_hash ^ value) * 0xff51afd7ed558ccdULL;
+            m_hash ^= m_hash >> 32;
+        }
+        void add(const char* data, size_t size)
+        {
+            add(size);
+            size_t i = 0;
+            for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+            {
+                uint64_t word;
+                memcpy(&word, data + i, sizeof(word));
+                add(word);
+            }
+            uint64_t tail = 0;
+            memcpy(&tail, data + i, size - i);
+            add(tail);
+        }
+        void add(const string& value) { add(value.data(), value.size()); }
+        void add(const element::Type& type) { add(type.get_type_name()); }
+        void add(const PartialShape& shape)
+        {
+            // Dynamic ranks and dimensions get a value no static size takes
+            const uint64_t dynamic = ~0ULL;
+            if (shape.rank().is_dynamic())
+            {
+                add(dynamic);
+                return;
+            }
+            add(static_cast<uint64_t>(static_cast<size_t>(shape.rank())));
+            for (size_t i = 0; i < static_cast<size_t>(shape.rank()); i++)
+            {
+                add(shape[i].is_static() ? static_cast<uint64_t>(static_cast<int64_t>(shape[i]))
+                                         : dynamic);
+            }
+        }
+        uint64_t get() const { return m_hash; }
+
+    private:
+        uint64_t m_hash{0x9e3779b97f4a7c15ULL};
+    };
+
+    class FingerprintVisitor : public AttributeVisitor
+    {
+    public:
+        FingerprintVisitor(Hasher& hasher)
+            : m_hasher(hasher)
+        {
+        }
+
+        void on_attribute(const string& name, string& value) override
+        {
+            m_hasher.add(name);
+            m_hasher.add(value);
+        }
+        void on_attribute(const string& name, bool& value) override
+        {
+            m_hasher.add(name);
+            m_hasher.add(value ? 1 : 0);
+        }
+        void on_adapter(const string& name, ValueAccessor<void>& adapter) override
+        {
+            m_hasher.add(name);
+            if (auto a = as_type<AttributeAdapter<element::Type>>(&adapter))
+            {
+                m_hasher.add(static_cast<element::Type&>(*a));
+            }
+            else if (auto a = as_type<AttributeAdapter<PartialShape>>(&adapter))
+            {
+                m_hasher.add(static_cast<PartialShape&>(*a));
+            }
+            else if (auto a = as_type<AttributeAdapter<op::AutoBroadcastSpec>>(&adapter))
+            {
+                auto& autob = static_cast<op::AutoBroadcastSpec&>(*a);
+                m_hasher.add(static_cast<uint64_t>(autob.m_type));
+                m_hasher.add(static_cast<uint64_t>(autob.m_axis));
+            }
+            else
+            {
+                // The value cannot be read through the void adapter
+                m_hasher.add(adapter.get_type_info().name);
+            }
+        }
+        void on_adapter(const string& name, ValueAccessor<string>& adapter) override
+        {
+            m_hasher.add(name);
+            m_hasher.add(adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int64_t>>& adapter) override
+        {
+            m_hasher.add(name);
+            const vector<int64_t>& values = adapter.get();
+            m_hasher.add(values.size());
+            for (int64_t value : values)
+            {
+                m_hasher.add(static_cast<uint64_t>(value));
+            }
+        }
+        void on_adapter(const string& name, ValueAccessor<int64_t>& adapter) override
+        {
+            m_hasher.add(name);
+            m_hasher.add(static_cast<uint64_t>(adapter.get()));
+        }
+        void on_adapter(const string& name, ValueAccessor<double>& adapter) override
+        {
+            m_hasher.add(name);
+            double value = adapter.get();
+            uint64_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            m_hasher.add(bits);
+        }
+
+    private:
+        Hasher& m_hasher;
+    };
+}
+
+Fingerprinter::Fingerprinter(const ParameterVector& parameters, bool include_constant_data)
+    : m_include_constant_data(include_constant_data)
+{
+    for (size_t i = 0; i < parameters.size(); i++)
+    {
+        m_parameter_positions[parameters[i].get()] = i;
+    }
+}
+
+uint64_t Fingerprinter::get_fingerprint(const Node* node)
+{
+    auto it = m_fingerprints.find(node);
+    if (it != m_fingerprints.end())
+    {
+        return it->second.second;
+    }
+
+    // Walks the graph with an explicit stack, since long chains of nodes would overflow the
+    // call stack. A node is pushed again, marked, to be hashed once its inputs are.
+    vector<pair<const Node*, bool>> stack{{node, false}};
+    while (!stack.empty())
+    {
+        const Node* n = stack.back().first;
+        if (m_fingerprints.count(n) != 0)
+        {
+            stack.pop_back();
+            continue;
+        }
+        if (stack.back().second)
+        {
+            stack.pop_back();
+            uint64_t fingerprint = compute_fingerprint(n);
+            m_fingerprints[n] = {n->shared_from_this(), fingerprint};
+            continue;
+        }
+        stack.back().second = true;
+        for (auto& input : n->inputs())
+        {
+            const Node* source = input.get_source_output().get_node();
+            if (m_fingerprints.count(source) == 0)
+            {
+                stack.push_back({source, false});
+            }
+        }
+        for (auto& control_dep : n->get_control_dependencies())
+        {
+            if (m_fingerprints.count(control_dep.get()) == 0)
+            {
+                stack.push_back({control_dep.get(), false});
+            }
+        }
+    }
+    return m_fingerprints.at(node).second;
+}
+
+uint64_t Fingerprinter::get_fingerprint(const ResultVector& results)
+{
+    Hasher hasher;
+    hasher.add(results.size());
+    for (auto& result : results)
+    {
+        hasher.add(get_fingerprint(result.get()));
+    }
+    return hasher.get();
+}
+
+uint64_t Fingerprinter::compute_fingerprint(const Node* node)
+{
+    Hasher hasher;
+    const NodeTypeInfo& type_info = node->get_type_info();
+    hasher.add(type_info.name);
+    hasher.add(type_info.version);
+
+    hasher.add(node->get_input_size());
+    for (auto& input : node->inputs())
+    {
+        Output<Node> source = input.get_source_output();
+        hasher.add(m_fingerprints.at(source.get_node()).second);
+        hasher.add(source.get_index());
+    }
+    hasher.add(node->get_control_dependencies().size());
+    for (auto& control_dep : node->get_control_dependencies())
+    {
+        hasher.add(m_fingerprints.at(control_dep.get()).second);
+    }
+    hasher.add(node->get_output_size());
+    for (auto& output : node->outputs())
+    {
+        hasher.add(output.get_element_type());
+        hasher.add(output.get_partial_shape());
+    }
+
+    if (auto constant = as_type<const op::Constant>(node))
+    {
+        if (m_include_constant_data)
+        {
+            size_t size =
+                shape_size(constant->get_shape()) * constant->get_element_type().size();
+            hasher.add(static_cast<const char*>(constant->get_data_ptr()), size);
+        }
+    }
+    else if (auto tensor_iterator = as_type<const op::TensorIterator>(node))
+    {
+        hasher.add(static_cast<uint64_t>(tensor_iterator->get_num_iterations()));
+        for (auto& input : tensor_iterator->get_input_descriptions())
+        {
+            hasher.add(input->get_type_info().name);
+            hasher.add(input->m_input_index);
+            hasher.add(input->m_body_parameter_index);
+            if (auto slice = as_type<const op::TensorIterator::SliceInputDescription>(
+                    input.get()))
+            {
+                for (int64_t value : {slice->m_start,
+                                      slice->m_stride,
+                                      slice->m_part_size,
+                                      slice->m_end,
+                                      slice->m_axis})
+                {
+                    hasher.add(static_cast<uint64_t>(value));
+                }
+            }
+            else if (auto merged = as_type<const op::TensorIterator::MergedInputDescription>(
+                         input.get()))
+            {
+                hasher.add(merged->m_body_value_index);
+            }
+        }
+        for (auto& output : tensor_iterator->get_output_descriptions())
+        {
+            hasher.add(output->get_type_info().name);
+            hasher.add(output->m_body_value_index);
+            hasher.add(output->m_output_index);
+            if (auto concat = as_type<const op::TensorIterator::ConcatOutputDescription>(
+                    output.get()))
+            {
+                for (int64_t value : {concat->m_start,
+                                      concat->m_stride,
+                                      concat->m_part_size,
+                                      concat->m_end,
+                                      concat->m_axis})
+                {
+                    hasher.add(static_cast<uint64_t>(value));
+                }
+            }
+            else if (auto body_output =
+                         as_type<const op::TensorIterator::BodyOutputDescription>(output.get()))
+            {
+                hasher.add(static_cast<uint64_t>(body_output->m_iteration));
+            }
+        }
+        auto body = tensor_iterator->get_body();
+        Fingerprinter body_fingerprinter(body->get_parameters(), m_include_constant_data);
+        hasher.add(body_fingerprinter.get_fingerprint(body->get_results()));
+    }
+    else
+    {
+        // Parameters in the list count by position; 0 is left for all other nodes
+        auto position = m_parameter_positions.find(node);
+        hasher.add(position == m_parameter_positions.end() ? 0 : position->second + 1);
+        FingerprintVisitor visitor(hasher);
+        if (!const_cast<Node*>(node)->visit_attributes(visitor))
+        {
+            hasher.add(serialize_node_attributes(*node));
+        }
+    }
+    return hasher.get();
+}
@@ -0,0 +1,71 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+#include "ngraph/node.hpp"
+#include "ngraph/op/parameter.hpp"
+
+namespace ngraph
+{
+    /// \brief Computes stable structural fingerprints of nodes.
+    ///
+    /// The fingerprint of a node combines its op type and version, its attributes, the element
+    /// types and shapes of its outputs, and the fingerprints of the outputs it reads and of its
+    /// control dependencies. Parameters count by their position in the parameter list. Names
+    /// are left out, so two graphs built the same way have the same fingerprints in any
+    /// process, and the fingerprints only change between releases when an op changes.
+    /// Fingerprints are 64-bit hashes, not unique ids.
+    ///
+    /// Attributes come from Node::visit_attributes. Ops that do not visit their attributes
+    /// are hashed through the attributes the json serializer writes for them, or by type and
+    /// shapes alone in builds without the serializer.
+    ///
+    /// The fingerprints of the nodes visited so far are kept, so asking for those of several
+    /// nodes of a graph computes each node once.
+    class NGRAPH_API Fingerprinter
+    {
+    public:
+        /// \param parameters The parameters of the graph, in order
+        /// \param include_constant_data Hash the data of Constants. Without it Constants only
+        ///        count by element type and shape, which is faster for large models but
+        ///        ignores the weights.
+        Fingerprinter(const ParameterVector& parameters = ParameterVector{},
+                      bool include_constant_data = true);
+
+        /// \returns the fingerprint of `node`, computing those of its inputs as needed
+        uint64_t get_fingerprint(const Node* node);
+
+        /// \returns the fingerprint of a graph with the given results, in order
+        uint64_t get_fingerprint(const ResultVector& results);
+
+    private:
+        uint64_t compute_fingerprint(const Node* node);
+
+        bool m_include_constant_data;
+        std::unordered_map<const Node*, uint64_t> m_parameter_positions;
+        // Holds on to the nodes so that their addresses are not reused by other nodes while
+        // their fingerprints are kept
+        std::unordered_map<const Node*, std::pair<std::shared_ptr<const Node>, uint64_t>>
+            m_fingerprints;
+    };
+}
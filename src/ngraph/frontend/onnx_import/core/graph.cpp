@@ -14,9 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <exception>
 #include <functional>
+#include <mutex>
 #include <numeric>
 #include <sstream>
+#include <thread>
 
 #include "graph.hpp"
 #include "node.hpp"
@@ -90,27 +96,70 @@ namespace ngraph
                 return std::string{"<ONNX " + onnx_node.op_type() + " (" + node_name + "-> " +
                                    output_names + ")>"};
             }
+
+            /// \brief Returns the number of threads that convert initializers to constants.
+            ///        Defaults to NGRAPH_ONNX_IMPORT_THREADS, or the number of hardware threads.
+            static std::size_t get_import_thread_count()
+            {
+                static const std::size_t s_thread_count = []() -> std::size_t {
+                    const char* env = std::getenv("NGRAPH_ONNX_IMPORT_THREADS");
+                    return env ? static_cast<std::size_t>(std::strtoull(env, nullptr, 10))
+                               : std::thread::hardware_concurrency();
+                }();
+                return std::max<std::size_t>(s_thread_count, 1);
+            }
         } // namespace detail
 
         Graph::Graph(const onnx::GraphProto& graph_proto, Model& model, const Weights& weights)
+            : Graph(graph_proto, nullptr, model, weights)
+        {
+        }
+
+        Graph::Graph(onnx::GraphProto* graph_proto, Model& model, const Weights& weights)
+            : Graph(*graph_proto, graph_proto, model, weights)
+        {
+        }
+
+        Graph::Graph(const onnx::GraphProto& graph_proto,
+                     onnx::GraphProto* releasable_proto,
+                     Model& model,
+                     const Weights& weights)
             : m_graph_proto{&graph_proto}
             , m_model{&model}
         {
             // Process all initializers in the graph
-            for (const auto& initializer_tensor : m_graph_proto->initializer())
+            std::vector<Tensor> initializers;
+            std::vector<std::string*> releasable_data;
+            for (int i = 0; i < m_graph_proto->initializer_size(); i++)
             {
+                const auto& initializer_tensor = m_graph_proto->initializer(i);
                 if (initializer_tensor.has_name())
                 {
-                    Tensor tensor = Tensor{initializer_tensor};
-                    m_initializers.emplace(initializer_tensor.name(), tensor);
-
-                    // For each initializer, create a Constant node and store in cache
-                    auto ng_constant = tensor.get_ng_constant();
-                    add_provenance_tag_to_initializer(tensor, ng_constant);
-                    m_ng_node_cache.emplace(initializer_tensor.name(), std::move(ng_constant));
+                    initializers.emplace_back(initializer_tensor,
+                                              &model.get_external_data_files());
+                    m_initializers.emplace(initializer_tensor.name(), initializers.back());
+                    if (releasable_proto)
+                    {
+                        // mutable_raw_data() would mark tensors without raw data as having it
+                        releasable_data.push_back(
+                            initializer_tensor.has_raw_data()
+                                ? releasable_proto->mutable_initializer(i)->mutable_raw_data()
+                                : nullptr);
+                    }
                 }
             }
 
+            // For each initializer, create a Constant node and store in cache
+            for (auto& ng_constant : make_ng_constants(initializers, releasable_data))
+            {
+                m_ng_node_cache.emplace(ng_constant.first, std::move(ng_constant.second));
+            }
+            if (releasable_proto)
+            {
+                // The released tensors can not be converted again
+                m_initializers.clear();
+            }
+
             // Process all ONNX graph inputs, convert them to nGraph nodes and store in cache
             for (const auto& input : m_graph_proto->input())
             {
@@ -183,6 +232,65 @@ namespace ngraph
             }
         }
 
+        std::vector<std::pair<std::string, std::shared_ptr<ngraph::Node>>>
+            Graph::make_ng_constants(const std::vector<Tensor>& initializers,
+                                     const std::vector<std::string*>& releasable_data) const
+        {
+            // Constants do not depend on each other or on the rest of the graph, and copying or
+            // converting their data dominates the import of large models, so they are made on
+            // several threads.
+            std::vector<std::pair<std::string, std::shared_ptr<ngraph::Node>>> ng_constants(
+                initializers.size());
+            std::atomic<std::size_t> next_initializer{0};
+            std::exception_ptr error;
+            std::mutex error_mutex;
+            auto convert_initializers = [&]() {
+                try
+                {
+                    for (std::size_t i = next_initializer++; i < initializers.size();
+                         i = next_initializer++)
+                    {
+                        const Tensor& tensor = initializers[i];
+                        auto ng_constant = tensor.get_ng_constant();
+                        add_provenance_tag_to_initializer(tensor, ng_constant);
+                        ng_constants[i] = {tensor.get_name(), std::move(ng_constant)};
+                        if (!releasable_data.empty() && releasable_data[i])
+                        {
+                            // Swapping, unlike clearing, frees the string's memory
+                            std::string().swap(*releasable_data[i]);
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error)
+                    {
+                        error = std::current_exception();
+                    }
+                    next_initializer = initializers.size();
+                }
+            };
+
+            std::vector<std::thread> threads;
+            for (std::size_t i = 1;
+                 i < std::min(detail::get_import_thread_count(), initializers.size());
+                 i++)
+            {
+                threads.emplace_back(convert_initializers);
+            }
+            convert_initializers();
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+            return ng_constants;
+        }
+
         NodeVector Graph::get_ng_outputs() const
         {
             NodeVector results;
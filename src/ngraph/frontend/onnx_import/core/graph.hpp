@@ -18,6 +18,7 @@
 
 #include <onnx/onnx_pb.h>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "default_opset.hpp"
@@ -35,6 +36,10 @@ namespace ngraph
         {
         public:
             Graph(const onnx::GraphProto& proto, Model& model, const Weights& weights = {});
+            /// \brief Converts `proto` as above, but frees the raw data of each initializer as
+            ///        soon as it has been copied into its Constant, which lowers the peak memory
+            ///        use of importing large models.
+            Graph(onnx::GraphProto* proto, Model& model, const Weights& weights = {});
             const std::vector<Node>& get_nodes() const { return m_nodes; }
             const std::vector<ValueInfo>& get_inputs() const { return m_inputs; }
             const std::vector<ValueInfo>& get_outputs() const { return m_outputs; }
@@ -48,6 +53,13 @@ namespace ngraph
             NodeVector make_ng_nodes(const Node& onnx_node) const;
 
         protected:
+            /// \brief Converts initializers to named Constants, in order.
+            /// \param releasable_data If not empty, the raw data of each initializer, or
+            ///        nullptr if it has none. The data is freed once its Constant has been made.
+            std::vector<std::pair<std::string, std::shared_ptr<ngraph::Node>>>
+                make_ng_constants(const std::vector<Tensor>& initializers,
+                                  const std::vector<std::string*>& releasable_data = {}) const;
+
             void add_provenance_tag_to_initializer(
                 const Tensor& initializer, std::shared_ptr<default_opset::Constant> node) const;
 
@@ -57,6 +69,11 @@ namespace ngraph
             void add_provenance_tags(const Node& onnx_node, const NodeVector& ng_node_vector) const;
 
         private:
+            Graph(const onnx::GraphProto& proto,
+                  onnx::GraphProto* releasable_proto,
+                  Model& model,
+                  const Weights& weights);
+
             const onnx::GraphProto* m_graph_proto;
             std::vector<Node> m_nodes;
             std::vector<ValueInfo> m_inputs;
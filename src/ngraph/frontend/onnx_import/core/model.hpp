@@ -16,12 +16,14 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <ostream>
 #include <string>
 #include <unordered_map>
 
 #include "operator_set.hpp"
+#include "tensor.hpp"
 
 namespace ngraph
 {
@@ -31,7 +33,10 @@ namespace ngraph
         {
         public:
             Model() = delete;
-            explicit Model(const onnx::ModelProto& model_proto);
+            /// \param model_dir Directory of the model file, which locations of external
+            ///        tensor data are relative to.
+            explicit Model(const onnx::ModelProto& model_proto,
+                           const std::string& model_dir = {});
 
             Model(const Model&) = default;
             Model(Model&&) = default;
@@ -47,6 +52,9 @@ namespace ngraph
                 return m_model_proto->producer_version();
             }
 
+            /// \brief Files holding external tensor data, shared by all graphs of the model.
+            ExternalDataFiles& get_external_data_files() const { return *m_external_data_files; }
+
             /// \brief Access an operator object by its type name and domain name
             /// The function will return the operator object if it exists, or report an error
             /// in case of domain or operator absence.
@@ -75,6 +83,7 @@ namespace ngraph
         private:
             const onnx::ModelProto* m_model_proto;
             std::unordered_map<std::string, OperatorSet> m_opset;
+            std::shared_ptr<ExternalDataFiles> m_external_data_files;
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Model& model)
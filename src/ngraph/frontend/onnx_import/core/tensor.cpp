@@ -0,0 +1,112 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+#include <fstream>
+
+#include "ngraph/file_util.hpp"
+#include "tensor.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        std::shared_ptr<runtime::AlignedBuffer> ExternalDataFiles::load(
+            const std::string& location, std::size_t offset, std::size_t length)
+        {
+            static const bool s_mmap_disabled =
+                std::getenv("NGRAPH_DISABLE_CONSTANT_MMAP") != nullptr;
+            const std::string path = file_util::path_join(m_model_dir, location);
+            if (s_mmap_disabled)
+            {
+                auto buffer = std::make_shared<runtime::AlignedBuffer>(length);
+                std::ifstream in{path, std::ios::in | std::ios::binary};
+                in.seekg(offset, std::ios::beg);
+                in.read(buffer->get_ptr<char>(), length);
+                if (!in)
+                {
+                    throw ngraph_error{"Failure reading " + std::to_string(length) +
+                                       " bytes at offset " + std::to_string(offset) + " of " +
+                                       path};
+                }
+                return buffer;
+            }
+
+            std::shared_ptr<runtime::MappedFile> file;
+            {
+                std::lock_guard<std::mutex> lock(m_files_mutex);
+                auto& mapped_file = m_files[path];
+                if (!mapped_file)
+                {
+                    mapped_file = std::make_shared<runtime::MappedFile>(path);
+                }
+                file = mapped_file;
+            }
+            if (offset > file->size() || length > file->size() - offset)
+            {
+                throw ngraph_error{"External data region [" + std::to_string(offset) + ", " +
+                                   std::to_string(offset + length) + ") is outside of " + path};
+            }
+            return std::make_shared<runtime::MappedBuffer>(file, offset, length);
+        }
+
+        std::shared_ptr<ngraph::op::Constant> Tensor::make_external_ng_constant() const
+        {
+            const auto& name = m_tensor_proto->name();
+            if (m_external_data_files == nullptr)
+            {
+                throw error::tensor::invalid_external_data{name, "not supported here"};
+            }
+
+            const auto& type = get_ng_type();
+            const std::size_t byte_size = shape_size(m_shape) * type.size();
+            std::string location;
+            std::size_t offset = 0;
+            std::size_t length = byte_size;
+            for (const auto& entry : m_tensor_proto->external_data())
+            {
+                if (entry.key() == "location")
+                {
+                    location = entry.value();
+                }
+                else if (entry.key() == "offset")
+                {
+                    offset = std::strtoull(entry.value().c_str(), nullptr, 10);
+                }
+                else if (entry.key() == "length")
+                {
+                    length = std::strtoull(entry.value().c_str(), nullptr, 10);
+                }
+            }
+            if (location.empty())
+            {
+                throw error::tensor::invalid_external_data{name, "no location specified"};
+            }
+            if (length != byte_size)
+            {
+                throw error::tensor::invalid_external_data{
+                    name,
+                    "length " + std::to_string(length) + " does not match the " +
+                        std::to_string(byte_size) + " bytes of the tensor"};
+            }
+
+            return std::make_shared<ngraph::op::Constant>(
+                type, m_shape, m_external_data_files->load(location, offset, length));
+        }
+
+    } // namespace onnx_import
+
+} // namespace ngraph
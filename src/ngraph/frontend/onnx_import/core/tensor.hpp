@@ -16,11 +16,16 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
+#include <mutex>
 #include <onnx/onnx_pb.h>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/mapped_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 
@@ -90,6 +95,14 @@ namespace ngraph
                     {
                     }
                 };
+
+                struct invalid_external_data : ngraph_error
+                {
+                    invalid_external_data(const std::string& name, const std::string& reason)
+                        : ngraph_error{"invalid external data of tensor " + name + ": " + reason}
+                    {
+                    }
+                };
             }
         }
 
@@ -337,6 +350,35 @@ namespace ngraph
             }
         }
 
+        /// \brief Files holding the data of tensors stored outside of the model
+        ///        (TensorProto::EXTERNAL).
+        ///
+        /// Each file is mapped once and shared by all the tensors stored in it. Constants are
+        /// backed by the mapping directly, so their data is only paged in when it is read.
+        /// Set NGRAPH_DISABLE_CONSTANT_MMAP to read the data instead. Data may be loaded from
+        /// several threads.
+        class ExternalDataFiles
+        {
+        public:
+            /// \param model_dir Directory that external data locations are relative to.
+            explicit ExternalDataFiles(const std::string& model_dir)
+                : m_model_dir{model_dir}
+            {
+            }
+
+            ExternalDataFiles(const ExternalDataFiles&) = delete;
+            ExternalDataFiles& operator=(const ExternalDataFiles&) = delete;
+
+            /// \brief Returns `length` bytes at `offset` of the file at `location`.
+            std::shared_ptr<runtime::AlignedBuffer>
+                load(const std::string& location, std::size_t offset, std::size_t length);
+
+        private:
+            std::string m_model_dir;
+            std::map<std::string, std::shared_ptr<runtime::MappedFile>> m_files;
+            std::mutex m_files_mutex;
+        };
+
         class Tensor
         {
         public:
@@ -361,9 +403,13 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const onnx::TensorProto& tensor)
+            /// \param external_data_files Where to load external data from. Tensors with
+            ///        external data can only be converted to constants if it is given.
+            explicit Tensor(const onnx::TensorProto& tensor,
+                            ExternalDataFiles* external_data_files = nullptr)
                 : m_tensor_proto{&tensor}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
+                , m_external_data_files{external_data_files}
             {
             }
 
@@ -429,8 +475,31 @@ namespace ngraph
             }
 
             operator TensorProto_DataType() const { return m_tensor_proto->data_type(); }
+            bool has_external_data() const
+            {
+                return m_tensor_proto->has_data_location() &&
+                       m_tensor_proto->data_location() ==
+                           onnx::TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL;
+            }
+
             std::shared_ptr<ngraph::op::Constant> get_ng_constant() const
             {
+                if (has_external_data())
+                {
+                    return make_external_ng_constant();
+                }
+                // Raw data already has the layout of the constant, so it is copied straight
+                // into the constant's buffer.
+                if (m_tensor_proto->has_raw_data() && !m_tensor_proto->has_segment())
+                {
+                    const auto& type = get_ng_type();
+                    const auto& raw_data = m_tensor_proto->raw_data();
+                    if (raw_data.size() == shape_size(m_shape) * type.size())
+                    {
+                        return std::make_shared<ngraph::op::Constant>(
+                            type, m_shape, raw_data.data());
+                    }
+                }
                 switch (m_tensor_proto->data_type())
                 {
                 case onnx::TensorProto_DataType::TensorProto_DataType_BOOL:
@@ -468,8 +537,11 @@ namespace ngraph
                 return std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
             }
 
+            std::shared_ptr<ngraph::op::Constant> make_external_ng_constant() const;
+
             const onnx::TensorProto* m_tensor_proto;
             Shape m_shape;
+            ExternalDataFiles* m_external_data_files;
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor)
@@ -14,14 +14,19 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <climits>
 #include <fstream>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 #include <google/protobuf/text_format.h>
 #include <memory>
 
 #include "core/graph.hpp"
 #include "core/model.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/runtime/mapped_buffer.hpp"
 #include "onnx.hpp"
 #include "ops_bridge.hpp"
 
@@ -49,45 +54,126 @@ namespace ngraph
                     }
                 };
 
+                struct buffer_parse : ngraph_error
+                {
+                    buffer_parse()
+                        : ngraph_error{"Failure parsing data from the provided buffer"}
+                    {
+                    }
+                };
+
             } // namespace error
-        }     // namespace detail
 
-        std::shared_ptr<Function> import_onnx_model(std::istream& sin, const Weights& weights)
-        {
-            onnx::ModelProto model_proto;
-            // Try parsing input as a binary protobuf message
-            if (!model_proto.ParseFromIstream(&sin))
+            /// \brief Converts `model_proto`, whose initializer data is freed as it is
+            ///        converted.
+            static std::shared_ptr<Function> convert_model(onnx::ModelProto& model_proto,
+                                                           const Weights& weights,
+                                                           const std::string& model_dir)
             {
-                // Rewind to the beginning and clear stream state.
-                sin.clear();
-                sin.seekg(0);
-                google::protobuf::io::IstreamInputStream iistream(&sin);
-                // Try parsing input as a prototxt message
-                if (!google::protobuf::TextFormat::Parse(&iistream, &model_proto))
+                Model model{model_proto, model_dir};
+                Graph graph{model_proto.mutable_graph(), model, weights};
+                auto function = std::make_shared<Function>(
+                    graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
+                for (std::size_t i{0}; i < function->get_output_size(); ++i)
                 {
-                    throw detail::error::stream_parse{sin};
+                    function->get_output_op(i)->set_friendly_name(
+                        graph.get_outputs().at(i).get_name());
                 }
+                return function;
             }
 
-            Model model{model_proto};
-            Graph graph{model_proto.graph(), model, weights};
-            auto function = std::make_shared<Function>(
-                graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
-            for (std::size_t i{0}; i < function->get_output_size(); ++i)
+            // The protobuf representation of a model is allocated on an arena, which is freed
+            // in one go once the model has been converted.
+            static std::shared_ptr<Function> import_onnx_model(std::istream& sin,
+                                                               const Weights& weights,
+                                                               const std::string& model_dir)
             {
-                function->get_output_op(i)->set_friendly_name(graph.get_outputs().at(i).get_name());
+                google::protobuf::Arena arena;
+                auto model_proto = google::protobuf::Arena::Create<onnx::ModelProto>(&arena);
+                // Try parsing input as a binary protobuf message
+                if (!model_proto->ParseFromIstream(&sin))
+                {
+                    // Rewind to the beginning and clear stream state.
+                    sin.clear();
+                    sin.seekg(0);
+                    google::protobuf::io::IstreamInputStream iistream(&sin);
+                    // Try parsing input as a prototxt message
+                    if (!google::protobuf::TextFormat::Parse(&iistream, model_proto))
+                    {
+                        throw error::stream_parse{sin};
+                    }
+                }
+                return convert_model(*model_proto, weights, model_dir);
+            }
+
+            static std::shared_ptr<Function> import_onnx_model(const void* data,
+                                                               std::size_t size,
+                                                               const Weights& weights,
+                                                               const std::string& model_dir)
+            {
+                // Protobuf sizes are int
+                if (size > static_cast<std::size_t>(INT_MAX))
+                {
+                    throw error::buffer_parse{};
+                }
+                google::protobuf::Arena arena;
+                auto model_proto = google::protobuf::Arena::Create<onnx::ModelProto>(&arena);
+                bool parsed = false;
+                {
+                    // Try parsing input as a binary protobuf message
+                    google::protobuf::io::ArrayInputStream array_stream{data,
+                                                                        static_cast<int>(size)};
+                    google::protobuf::io::CodedInputStream coded_stream{&array_stream};
+                    // Models are often larger than the default limit of 64 MB
+#if GOOGLE_PROTOBUF_VERSION >= 3006000
+                    coded_stream.SetTotalBytesLimit(INT_MAX);
+#else
+                    coded_stream.SetTotalBytesLimit(INT_MAX, INT_MAX);
+#endif
+                    parsed = model_proto->ParseFromCodedStream(&coded_stream) &&
+                             coded_stream.ConsumedEntireMessage();
+                }
+                if (!parsed)
+                {
+                    // Try parsing input as a prototxt message
+                    model_proto->Clear();
+                    google::protobuf::io::ArrayInputStream array_stream{data,
+                                                                        static_cast<int>(size)};
+                    if (!google::protobuf::TextFormat::Parse(&array_stream, model_proto))
+                    {
+                        throw error::buffer_parse{};
+                    }
+                }
+                return convert_model(*model_proto, weights, model_dir);
             }
-            return function;
+        } // namespace detail
+
+        std::shared_ptr<Function> import_onnx_model(std::istream& sin, const Weights& weights)
+        {
+            return detail::import_onnx_model(sin, weights, "");
+        }
+
+        std::shared_ptr<Function>
+            import_onnx_model(const void* data, std::size_t size, const Weights& weights)
+        {
+            return detail::import_onnx_model(data, size, weights, "");
         }
 
         std::shared_ptr<Function> import_onnx_model(const std::string& path, const Weights& weights)
         {
-            std::ifstream ifs{path, std::ios::in | std::ios::binary};
-            if (!ifs.is_open())
             {
-                throw detail::error::file_open{path};
+                std::ifstream ifs{path, std::ios::in | std::ios::binary};
+                if (!ifs.is_open())
+                {
+                    throw detail::error::file_open{path};
+                }
             }
-            return import_onnx_model(ifs, weights);
+            const auto slash = path.find_last_of('/');
+            const std::string model_dir =
+                slash == std::string::npos ? std::string{} : path.substr(0, slash);
+            // The model is parsed from the page cache instead of being read into a buffer
+            runtime::MappedFile file{path};
+            return detail::import_onnx_model(file.get_ptr(), file.size(), weights, model_dir);
         }
 
         void register_operator(const std::string& name,
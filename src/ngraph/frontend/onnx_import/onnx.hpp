@@ -69,7 +69,8 @@ namespace ngraph
 
         /// \brief Convert an ONNX model to nGraph function
         /// The function translated serialized ONNX model to nGraph function. The serialized
-        /// ONNX model is read from input stream.
+        /// ONNX model is read from input stream. Locations of external tensor data are
+        /// relative to the current directory.
         /// \param sin       input stream (e.g. file stream, memory stream, etc),
         /// \param weights  weights associated with the model. If weights are embedded into
         ///                   the model this parameter shall be empty. Having weights in a model
@@ -79,9 +80,25 @@ namespace ngraph
         NGRAPH_API
         std::shared_ptr<Function> import_onnx_model(std::istream& sin, const Weights& weights = {});
 
+        /// \brief Convert an ONNX model to nGraph function
+        /// The function translated serialized ONNX model to nGraph function. The serialized
+        /// ONNX model is parsed straight from memory, without copying it into a stream.
+        /// Locations of external tensor data are relative to the current directory.
+        /// \param data     the serialized model, in binary or text format,
+        /// \param size     size of the serialized model in bytes,
+        /// \param weights  weights associated with the model. If weights are embedded into
+        ///                   the model this parameter shall be empty. Having weights in a model
+        ///                   and providing through this parameters is invalid (the weights from
+        ///                   the model  will take precedence).
+        /// \return The function returns a nGraph function representing single output from graph.
+        NGRAPH_API
+        std::shared_ptr<Function>
+            import_onnx_model(const void* data, std::size_t size, const Weights& weights = {});
+
         /// \brief Convert an ONNX model to nGraph functions
         /// The function translated serialized ONNX model to nGraph functions. The ONNX model
-        /// is read from ONNX file.
+        /// is read from ONNX file, which is mapped into memory and parsed in place. External
+        /// tensor data is mapped from files next to it.
         /// \param filename  file name (relative or absolute path name),
         /// \param weights  weights associated with the model. If weights are embedded into
         ///                   the model this parameter shall be empty. Having weights in a model
@@ -53,6 +53,14 @@ namespace ngraph
                 return get().compile(function);
             }
 
+            /// \brief Create a tensor using the caller's buffer, without copying it
+            std::shared_ptr<runtime::Tensor> create_tensor(const element::Type& type,
+                                                           const Shape& shape,
+                                                           void* memory_pointer) const
+            {
+                return get().create_tensor(type, shape, memory_pointer);
+            }
+
         private:
             std::string m_type{};
             mutable std::shared_ptr<runtime::Backend> m_backend{nullptr};
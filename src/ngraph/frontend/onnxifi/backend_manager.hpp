@@ -22,6 +22,7 @@
 #include <onnx/onnxifi.h>
 
 #include "backend.hpp"
+#include "exceptions.hpp"
 #include "ngraph/runtime/backend.hpp"
 
 namespace ngraph
@@ -81,7 +82,12 @@ namespace ngraph
             const Backend& get_backend(std::uintptr_t id) const
             {
                 std::lock_guard<decltype(m_mutex)> lock{m_mutex};
-                return m_registered_backends.at(id);
+                auto it = m_registered_backends.find(id);
+                if (it == std::end(m_registered_backends))
+                {
+                    throw status::invalid_id{};
+                }
+                return it->second;
             }
 
             const Backend& get_backend(::onnxBackendID id) const
@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <utility> // std::move
+
+#include "event.hpp"
+#include "exceptions.hpp"
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        void Event::signal(::onnxStatus status)
+        {
+            std::vector<std::function<void()>> callbacks;
+            {
+                std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+                if (m_signalled)
+                {
+                    throw status::invalid_state{};
+                }
+                m_signalled = true;
+                m_status = status;
+                callbacks.swap(m_callbacks);
+            }
+            m_condition.notify_all();
+            // Callbacks may start work that signals other events, so they run unlocked
+            for (const auto& callback : callbacks)
+            {
+                callback();
+            }
+        }
+
+        ::onnxStatus Event::wait() const
+        {
+            std::unique_lock<decltype(m_mutex)> lock{m_mutex};
+            m_condition.wait(lock, [this] { return m_signalled; });
+            return m_status;
+        }
+
+        bool Event::is_signalled() const
+        {
+            std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+            return m_signalled;
+        }
+
+        void Event::on_signal(std::function<void()> callback)
+        {
+            {
+                std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+                if (!m_signalled)
+                {
+                    m_callbacks.push_back(std::move(callback));
+                    return;
+                }
+            }
+            callback();
+        }
+
+    } // namespace onnxifi
+
+} // namespace ngraph
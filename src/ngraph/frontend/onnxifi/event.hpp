@@ -0,0 +1,72 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable> // std::condition_variable
+#include <functional>         // std::function
+#include <mutex>              // std::mutex
+#include <onnx/onnxifi.h>
+#include <vector> // std::vector
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        /// \brief ONNXIFI event
+        /// An event starts non-signalled and is signalled once, either by the user with
+        /// onnxSignalEvent(), or by the backend when the graph run it fences completes.
+        class Event
+        {
+        public:
+            Event(const Event&) = delete;
+            Event& operator=(const Event&) = delete;
+
+            Event(Event&&) = delete;
+            Event& operator=(Event&&) = delete;
+
+            Event() = default;
+
+            /// \brief Signal the event
+            /// Wakes up the threads waiting for the event and runs the callbacks queued with
+            /// on_signal(), on the calling thread.
+            /// \param status  status reported by wait(); anything other than
+            ///                ONNXIFI_STATUS_SUCCESS means the fenced operation failed.
+            /// \throw status::invalid_state  the event is already signalled.
+            void signal(::onnxStatus status = ONNXIFI_STATUS_SUCCESS);
+
+            /// \brief Wait until the event is signalled
+            /// \return The status the event was signalled with.
+            ::onnxStatus wait() const;
+
+            bool is_signalled() const;
+
+            /// \brief Run a function once the event is signalled
+            /// The function runs on the thread signalling the event, or on the calling thread
+            /// if the event is already signalled.
+            void on_signal(std::function<void()> callback);
+
+        private:
+            mutable std::mutex m_mutex{};
+            mutable std::condition_variable m_condition{};
+            bool m_signalled{false};
+            ::onnxStatus m_status{ONNXIFI_STATUS_SUCCESS};
+            std::vector<std::function<void()>> m_callbacks{};
+        };
+
+    } // namespace onnxifi
+
+} // namespace ngraph
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <future>  // std::future
 #include <memory>  // std::shared_ptr
 #include <string>  // std::string
 #include <utility> // std::move
@@ -58,6 +59,14 @@ namespace ngraph
                 return m_executable->call_with_validate(outputs, inputs);
             }
 
+            std::future<bool>
+                call_async(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                           const runtime::Executable::AsyncCallback& callback) const
+            {
+                return m_executable->call_async(outputs, inputs, callback);
+            }
+
         private:
             mutable std::shared_ptr<runtime::Executable> m_executable{nullptr};
         };
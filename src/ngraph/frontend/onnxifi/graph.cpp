@@ -0,0 +1,185 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm> // std::find_if, std::remove_if
+#include <chrono>    // std::chrono::seconds
+#include <sstream>   // std::istringstream
+#include <string>    // std::string
+#include <utility>   // std::move
+
+#include "exceptions.hpp"
+#include "graph.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/frontend/onnx_import/onnx.hpp"
+#include "tensor.hpp"
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        namespace
+        {
+            std::shared_ptr<Function> import_model(const Span<char>& model,
+                                                   const Span<::onnxTensorDescriptorV1>& weights)
+            {
+                onnx_import::Weights ng_weights;
+                for (const auto& descriptor : weights)
+                {
+                    Tensor weight{descriptor};
+                    const auto& type = weight.get_ng_type();
+                    const char* data = reinterpret_cast<const char*>(weight.data());
+                    std::vector<char> buffer(data, data + weight.size() * type.size());
+                    ng_weights.emplace(
+                        weight.get_name(),
+                        onnx_import::Weight{type, weight.get_shape(), std::move(buffer)});
+                }
+                std::istringstream stream{std::string{model.data(), model.size()}};
+                try
+                {
+                    return onnx_import::import_onnx_model(stream, ng_weights);
+                }
+                catch (const ngraph_error&)
+                {
+                    throw status::invalid_model{};
+                }
+            }
+
+            /// \brief Create backend tensors using the buffers of the descriptors, in the order
+            ///        of the nodes they are named after.
+            template <typename NodeVector>
+            std::vector<std::shared_ptr<runtime::Tensor>>
+                bind(const Backend& backend,
+                     const Span<::onnxTensorDescriptorV1>& descriptors,
+                     const NodeVector& nodes)
+            {
+                std::vector<std::shared_ptr<runtime::Tensor>> tensors(nodes.size());
+                for (const auto& descriptor : descriptors)
+                {
+                    Tensor tensor{descriptor};
+                    auto it = std::find_if(
+                        std::begin(nodes),
+                        std::end(nodes),
+                        [&tensor](const typename NodeVector::value_type& node) {
+                            return node->get_friendly_name() == tensor.get_name();
+                        });
+                    if (it == std::end(nodes))
+                    {
+                        throw status::unidentified_name{};
+                    }
+                    const auto& node = *it;
+                    if (tensor.get_ng_type() != node->get_output_element_type(0))
+                    {
+                        throw status::invalid_datatype{};
+                    }
+                    // Descriptors of scalars have no dimensions
+                    const auto& shape = node->get_output_shape(0);
+                    if ((tensor.get_shape() != shape) &&
+                        ((shape_size(shape) != 1) || (tensor.size() != 1)))
+                    {
+                        throw status::invalid_shape{};
+                    }
+                    tensors[std::distance(std::begin(nodes), it)] = backend.create_tensor(
+                        node->get_output_element_type(0), shape, const_cast<void*>(tensor.data()));
+                }
+                for (const auto& tensor : tensors)
+                {
+                    if (tensor == nullptr)
+                    {
+                        throw status::invalid_size{};
+                    }
+                }
+                return tensors;
+            }
+        }
+
+        Graph::Graph(const Backend& backend,
+                     const Span<char>& model,
+                     const Span<::onnxTensorDescriptorV1>& weights)
+            : m_backend{backend}
+            , m_function{import_model(model, weights)}
+            , m_executable{backend.compile(m_function)}
+        {
+        }
+
+        void Graph::set_io(const Span<::onnxTensorDescriptorV1>& inputs,
+                           const Span<::onnxTensorDescriptorV1>& outputs)
+        {
+            auto ng_inputs = bind(m_backend, inputs, m_function->get_parameters());
+            auto ng_outputs = bind(m_backend, outputs, m_function->get_results());
+            std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+            m_inputs = std::move(ng_inputs);
+            m_outputs = std::move(ng_outputs);
+            m_io_set = true;
+        }
+
+        void Graph::run(const std::shared_ptr<Event>& input_event,
+                        const std::shared_ptr<Event>& output_event)
+        {
+            std::vector<std::shared_ptr<runtime::Tensor>> inputs;
+            std::vector<std::shared_ptr<runtime::Tensor>> outputs;
+            {
+                std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+                if (!m_io_set)
+                {
+                    throw status::invalid_state{};
+                }
+                inputs = m_inputs;
+                outputs = m_outputs;
+            }
+            if (input_event == nullptr)
+            {
+                start(inputs, outputs, output_event);
+                return;
+            }
+            auto graph = shared_from_this();
+            input_event->on_signal([graph, inputs, outputs, output_event]() {
+                graph->start(inputs, outputs, output_event);
+            });
+        }
+
+        void Graph::start(const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                          const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                          const std::shared_ptr<Event>& output_event)
+        {
+            // This may run on the thread signalling the input event, so failures are reported
+            // through the output event rather than thrown.
+            std::future<bool> run;
+            try
+            {
+                run = m_executable.call_async(outputs, inputs, [output_event](bool result) {
+                    output_event->signal(result ? ONNXIFI_STATUS_SUCCESS
+                                                : ONNXIFI_STATUS_INTERNAL_ERROR);
+                });
+            }
+            catch (...)
+            {
+                output_event->signal(ONNXIFI_STATUS_INTERNAL_ERROR);
+                return;
+            }
+            std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+            m_runs.erase(std::remove_if(std::begin(m_runs),
+                                        std::end(m_runs),
+                                        [](const std::future<bool>& future) {
+                                            return future.wait_for(std::chrono::seconds{0}) ==
+                                                   std::future_status::ready;
+                                        }),
+                         std::end(m_runs));
+            m_runs.push_back(std::move(run));
+        }
+
+    } // namespace onnxifi
+
+} // namespace ngraph
@@ -0,0 +1,95 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef> // std::size_t
+#include <future>  // std::future
+#include <memory>  // std::shared_ptr, std::enable_shared_from_this
+#include <mutex>   // std::mutex
+#include <onnx/onnxifi.h>
+#include <vector> // std::vector
+
+#include "backend.hpp"
+#include "event.hpp"
+#include "executable.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "span.hpp"
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        /// \brief ONNXIFI graph
+        /// An ONNX model compiled for a backend, together with the buffers its inputs are read
+        /// from and its outputs are written to.
+        class Graph : public std::enable_shared_from_this<Graph>
+        {
+        public:
+            Graph(const Graph&) = delete;
+            Graph& operator=(const Graph&) = delete;
+
+            Graph(Graph&&) = delete;
+            Graph& operator=(Graph&&) = delete;
+
+            Graph() = delete;
+
+            /// \brief Import and compile an ONNX model
+            /// \param backend  the backend to compile for,
+            /// \param model    serialized ONNX model,
+            /// \param weights  values of static inputs of the model.
+            /// \throw status::invalid_model  the model could not be imported.
+            Graph(const Backend& backend,
+                  const Span<char>& model,
+                  const Span<::onnxTensorDescriptorV1>& weights);
+
+            /// \brief Bind the buffers of the graph inputs and outputs
+            /// The buffers are used in place by the following runs; they are not copied.
+            /// \throw status::unidentified_name  a descriptor names no input or output,
+            /// \throw status::invalid_size       an input or output has no descriptor,
+            /// \throw status::invalid_datatype   a descriptor has the wrong data type,
+            /// \throw status::invalid_shape      a descriptor has the wrong shape.
+            void set_io(const Span<::onnxTensorDescriptorV1>& inputs,
+                        const Span<::onnxTensorDescriptorV1>& outputs);
+
+            /// \brief Start a run of the graph and return without waiting for it
+            /// \param input_event   if not null, the run starts once it is signalled,
+            /// \param output_event  signalled once the outputs are written.
+            /// \throw status::invalid_state  the inputs and outputs are not set.
+            void run(const std::shared_ptr<Event>& input_event,
+                     const std::shared_ptr<Event>& output_event);
+
+        private:
+            const Backend& m_backend;
+            std::shared_ptr<Function> m_function{nullptr};
+            Executable m_executable;
+            std::vector<std::shared_ptr<runtime::Tensor>> m_inputs{};
+            std::vector<std::shared_ptr<runtime::Tensor>> m_outputs{};
+            bool m_io_set{false};
+            std::mutex m_mutex{};
+            // Destroying a future of an asynchronous call blocks until the call completes,
+            // so the futures of runs in flight are kept here
+            std::vector<std::future<bool>> m_runs{};
+
+            void start(const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                       const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                       const std::shared_ptr<Event>& output_event);
+        };
+
+    } // namespace onnxifi
+
+} // namespace ngraph
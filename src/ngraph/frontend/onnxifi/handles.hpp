@@ -0,0 +1,82 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>     // std::map
+#include <memory>  // std::shared_ptr
+#include <mutex>   // std::mutex
+#include <utility> // std::move
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        /// \brief Objects handed out to the user as opaque ONNXIFI handles
+        /// The handle of an object is its address. Looking up a handle which was not added,
+        /// or was already removed, throws `Invalid`, so stale handles are reported rather than
+        /// dereferenced. The objects are shared, so an object still in use by the backend
+        /// outlives the removal of its handle.
+        /// \tparam T        type of the objects,
+        /// \tparam Invalid  exception thrown for unknown handles.
+        template <typename T, typename Invalid>
+        class Handles
+        {
+        public:
+            Handles(const Handles&) = delete;
+            Handles& operator=(const Handles&) = delete;
+
+            Handles(Handles&&) = delete;
+            Handles& operator=(Handles&&) = delete;
+
+            Handles() = default;
+
+            void* add(std::shared_ptr<T> object)
+            {
+                void* handle = object.get();
+                std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+                m_objects.emplace(handle, std::move(object));
+                return handle;
+            }
+
+            std::shared_ptr<T> get(const void* handle) const
+            {
+                std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+                auto it = m_objects.find(handle);
+                if (it == std::end(m_objects))
+                {
+                    throw Invalid{};
+                }
+                return it->second;
+            }
+
+            void remove(const void* handle)
+            {
+                std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+                if (m_objects.erase(handle) == 0)
+                {
+                    throw Invalid{};
+                }
+            }
+
+        private:
+            mutable std::mutex m_mutex{};
+            std::map<const void*, std::shared_ptr<T>> m_objects{};
+        };
+
+    } // namespace onnxifi
+
+} // namespace ngraph
@@ -16,38 +16,96 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <onnx/onnxifi.h>
 #include <stdexcept>
 
 #include "backend_manager.hpp"
+#include "event.hpp"
 #include "exceptions.hpp"
+#include "graph.hpp"
+#include "handles.hpp"
+#include "span.hpp"
 
 using namespace ngraph::onnxifi;
 
-extern "C" {
-
-ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
-    onnxGetBackendIDs(onnxBackendID* backendIDs, std::size_t* numBackends)
+namespace
 {
-    try
+    Handles<Event, status::invalid_event>& events()
+    {
+        static Handles<Event, status::invalid_event> handles;
+        return handles;
+    }
+
+    Handles<Graph, status::invalid_graph>& graphs()
     {
-        BackendManager::get_backend_ids(backendIDs, numBackends);
-        return ONNXIFI_STATUS_SUCCESS;
+        static Handles<Graph, status::invalid_graph> handles;
+        return handles;
     }
-    catch (const status::runtime& e)
+
+    // Backends are owned by the BackendManager for the whole session, so the handle of an
+    // initialized backend is its ID.
+    const Backend& get_backend(::onnxBackend backend)
     {
-        return e.get_status();
+        try
+        {
+            return BackendManager::get(reinterpret_cast<::onnxBackendID>(backend));
+        }
+        catch (const status::invalid_id&)
+        {
+            throw status::invalid_backend{};
+        }
     }
-    catch (const std::bad_alloc&)
+
+    /// \brief Run an ONNXIFI function, translating exceptions to its status
+    template <typename Function>
+    ::onnxStatus invoke(Function&& function)
     {
-        return ONNXIFI_STATUS_NO_SYSTEM_MEMORY;
+        try
+        {
+            function();
+            return ONNXIFI_STATUS_SUCCESS;
+        }
+        catch (const status::runtime& e)
+        {
+            return e.get_status();
+        }
+        catch (const std::bad_alloc&)
+        {
+            return ONNXIFI_STATUS_NO_SYSTEM_MEMORY;
+        }
+        catch (...)
+        {
+            return ONNXIFI_STATUS_INTERNAL_ERROR;
+        }
     }
-    catch (...)
+
+    void check_fence(const ::onnxMemoryFenceV1* fence)
     {
-        return ONNXIFI_STATUS_INTERNAL_ERROR;
+        if (fence == nullptr)
+        {
+            throw status::null_pointer{};
+        }
+        if (fence->tag != ONNXIFI_TAG_MEMORY_FENCE_V1)
+        {
+            throw status::unsupported_tag{};
+        }
+        if ((fence->type != ONNXIFI_SYNCHRONIZATION_EVENT) &&
+            (fence->type != ONNXIFI_SYNCHRONIZATION_IMPLICIT))
+        {
+            throw status::invalid_fence_type{};
+        }
     }
 }
 
+extern "C" {
+
+ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
+    onnxGetBackendIDs(onnxBackendID* backendIDs, std::size_t* numBackends)
+{
+    return invoke([&] { BackendManager::get_backend_ids(backendIDs, numBackends); });
+}
+
 ONNXIFI_PUBLIC
 ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseBackendID(onnxBackendID /* backendID */)
 {
@@ -70,73 +128,130 @@ ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxGetBackendCompati
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
-    onnxInitBackend(onnxBackendID /* backendID */,
+    onnxInitBackend(onnxBackendID backendID,
                     const uint64_t* /* auxPropertiesList */,
-                    onnxBackend* /* backend */)
+                    onnxBackend* backend)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return invoke([&] {
+        if (backend == nullptr)
+        {
+            throw status::null_pointer{};
+        }
+        BackendManager::get(backendID);
+        *backend = reinterpret_cast<onnxBackend>(backendID);
+    });
 }
 
 ONNXIFI_PUBLIC
-ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseBackend(onnxBackend /* backend */)
+ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseBackend(onnxBackend backend)
 {
-    return ONNXIFI_STATUS_INTERNAL_ERROR;
+    return invoke([&] { get_backend(backend); });
 }
 
-ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxInitEvent(onnxBackend /* backend */,
-                                                                         onnxEvent* /* event */)
+ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxInitEvent(onnxBackend backend,
+                                                                         onnxEvent* event)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return invoke([&] {
+        if (event == nullptr)
+        {
+            throw status::null_pointer{};
+        }
+        get_backend(backend);
+        *event = reinterpret_cast<onnxEvent>(events().add(std::make_shared<Event>()));
+    });
 }
 
-ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxSignalEvent(onnxEvent /* event */)
+ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxSignalEvent(onnxEvent event)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return invoke([&] { events().get(event)->signal(); });
 }
 
-ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxWaitEvent(onnxEvent /* event */)
+ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxWaitEvent(onnxEvent event)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    ::onnxStatus result{ONNXIFI_STATUS_SUCCESS};
+    ::onnxStatus rc{invoke([&] { result = events().get(event)->wait(); })};
+    return (rc == ONNXIFI_STATUS_SUCCESS) ? result : rc;
 }
 
-ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseEvent(onnxEvent /* event */)
+ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseEvent(onnxEvent event)
 {
-    return ONNXIFI_STATUS_INTERNAL_ERROR;
+    return invoke([&] { events().remove(event); });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
-    onnxInitGraph(onnxBackend /* backend */,
+    onnxInitGraph(onnxBackend backend,
                   const uint64_t* /* auxPropertiesList */,
-                  std::size_t /* onnxModelSize */,
-                  const void* /* onnxModel */,
-                  uint32_t /* weightsCount */,
-                  const onnxTensorDescriptorV1* /* weightDescriptors */,
-                  onnxGraph* /* graph */)
+                  std::size_t onnxModelSize,
+                  const void* onnxModel,
+                  uint32_t weightsCount,
+                  const onnxTensorDescriptorV1* weightDescriptors,
+                  onnxGraph* graph)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return invoke([&] {
+        if ((graph == nullptr) || (onnxModel == nullptr) ||
+            ((weightsCount != 0) && (weightDescriptors == nullptr)))
+        {
+            throw status::null_pointer{};
+        }
+        if (onnxModelSize == 0)
+        {
+            throw status::invalid_size{};
+        }
+        auto ng_graph = std::make_shared<Graph>(
+            get_backend(backend),
+            Span<char>{reinterpret_cast<const char*>(onnxModel), onnxModelSize},
+            Span<onnxTensorDescriptorV1>{weightDescriptors, weightsCount});
+        *graph = reinterpret_cast<onnxGraph>(graphs().add(ng_graph));
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
-    onnxSetGraphIO(onnxGraph /* graph */,
-                   std::uint32_t /* inputsCount */,
-                   const onnxTensorDescriptorV1* /* inputDescriptors */,
-                   std::uint32_t /* outputsCount */,
-                   const onnxTensorDescriptorV1* /* outputDescriptors */)
+    onnxSetGraphIO(onnxGraph graph,
+                   std::uint32_t inputsCount,
+                   const onnxTensorDescriptorV1* inputDescriptors,
+                   std::uint32_t outputsCount,
+                   const onnxTensorDescriptorV1* outputDescriptors)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return invoke([&] {
+        if (((inputsCount != 0) && (inputDescriptors == nullptr)) ||
+            ((outputsCount != 0) && (outputDescriptors == nullptr)))
+        {
+            throw status::null_pointer{};
+        }
+        graphs().get(graph)->set_io(
+            Span<onnxTensorDescriptorV1>{inputDescriptors, inputsCount},
+            Span<onnxTensorDescriptorV1>{outputDescriptors, outputsCount});
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
-    onnxRunGraph(onnxGraph /* graph */,
-                 const onnxMemoryFenceV1* /* inputFence */,
-                 onnxMemoryFenceV1* /* outputFence */)
+    onnxRunGraph(onnxGraph graph,
+                 const onnxMemoryFenceV1* inputFence,
+                 onnxMemoryFenceV1* outputFence)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return invoke([&] {
+        check_fence(inputFence);
+        check_fence(outputFence);
+        if (outputFence->type != ONNXIFI_SYNCHRONIZATION_EVENT)
+        {
+            throw status::unsupported_fence_type{};
+        }
+        auto ng_graph = graphs().get(graph);
+        std::shared_ptr<Event> input_event;
+        if (inputFence->type == ONNXIFI_SYNCHRONIZATION_EVENT)
+        {
+            input_event = events().get(inputFence->event);
+        }
+        // The output event is created by the backend and released by the user
+        auto output_event = std::make_shared<Event>();
+        ng_graph->run(input_event, output_event);
+        outputFence->event = reinterpret_cast<onnxEvent>(events().add(output_event));
+    });
 }
 
-ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseGraph(onnxGraph /* graph */)
+ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseGraph(onnxGraph graph)
 {
-    return ONNXIFI_STATUS_INTERNAL_ERROR;
+    return invoke([&] { graphs().remove(graph); });
 }
 
 } // extern "C"
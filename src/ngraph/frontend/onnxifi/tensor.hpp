@@ -52,6 +52,10 @@ namespace ngraph
             /// \param tensor     nGraph tensor to copy from.
             void from_ng(const runtime::Tensor& tensor);
 
+            /// \brief Element type of the tensor
+            /// \throw status::unsupported_datatype  the type has no nGraph equivalent.
+            const element::Type& get_ng_type() const;
+
             const void* data() const { return reinterpret_cast<const void*>(m_tensor->buffer); }
             std::size_t size() const { return m_size; }
             const Shape& get_shape() const { return m_shape; }
@@ -18,6 +18,7 @@
 #include <list>
 #include <memory>
 
+#include "ngraph/fingerprint.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
@@ -78,6 +79,17 @@ void Function::validate_nodes_and_infer_types()
     ngraph::validate_nodes_and_infer_types(get_ops());
 }
 
+void Function::validate_changed_nodes_and_infer_types()
+{
+    for (auto& node : get_ordered_ops())
+    {
+        if (node->get_needs_revalidation())
+        {
+            node->revalidate_and_infer_types();
+        }
+    }
+}
+
 void Function::init()
 {
     validate_nodes_and_infer_types();
@@ -108,7 +120,33 @@ std::list<shared_ptr<Node>> Function::get_ordered_ops(bool include_control_deps)
         nodes.push_back(param);
     }
 
-    return topological_sort(nodes, include_control_deps);
+    if (m_topological_sorter)
+    {
+        return m_topological_sorter(nodes, include_control_deps);
+    }
+
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    auto& cache = m_ordered_ops_cache[include_control_deps ? 1 : 0];
+    size_t graph_version = Node::get_graph_version();
+    if (cache.valid && cache.graph_version == graph_version)
+    {
+        list<shared_ptr<Node>> result;
+        for (Node* node : cache.ops)
+        {
+            result.push_back(node->shared_from_this());
+        }
+        return result;
+    }
+
+    auto result = topological_sort(nodes, include_control_deps);
+    cache.ops.clear();
+    for (auto& node : result)
+    {
+        cache.ops.push_back(node.get());
+    }
+    cache.graph_version = graph_version;
+    cache.valid = true;
+    return result;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -258,6 +296,11 @@ size_t Function::get_graph_size() const
     return total_size;
 }
 
+uint64_t Function::get_fingerprint(bool include_constant_data) const
+{
+    return Fingerprinter(get_parameters(), include_constant_data).get_fingerprint(get_results());
+}
+
 size_t Function::get_placement() const
 {
     return m_placement;
@@ -294,4 +337,5 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    Node::increment_graph_version();
 }
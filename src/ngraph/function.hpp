@@ -17,9 +17,11 @@
 #pragma once
 
 #include <atomic>
+#include <functional>
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -93,7 +95,19 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::list<std::shared_ptr<Node>> get_ops(bool include_control_deps = true) const;
+        /// \brief Returns the ops in topological order. Without a custom topological sort the
+        ///        order is cached until an edge or control dependency in any graph changes.
         std::list<std::shared_ptr<Node>> get_ordered_ops(bool include_control_deps = true) const;
+        /// \brief Orders the nodes needed to compute root_nodes for get_ordered_ops()
+        using topological_sort_t = std::function<std::list<std::shared_ptr<Node>>(
+            const NodeVector& root_nodes, bool include_control_deps)>;
+        /// \brief Replaces the default topological sort used by get_ordered_ops(), for example
+        ///        with one that reorders independent ops to lower peak memory
+        void set_topological_sort(topological_sort_t topological_sort)
+        {
+            m_topological_sorter = topological_sort;
+        }
+        const topological_sort_t& get_topological_sort() const { return m_topological_sorter; }
         void map_unordered_ops(std::function<void(Node*)> f) const;
 
         friend std::ostream& operator<<(std::ostream&, const Function&);
@@ -104,12 +118,22 @@ namespace ngraph
         void replace_node(std::shared_ptr<Node> old, std::shared_ptr<Node> repl);
 
         void validate_nodes_and_infer_types();
+        /// \brief Revalidates, in topological order, only the nodes whose inputs were replaced
+        ///        or whose input types changed since they were last validated. Revalidating a
+        ///        node whose output types change schedules its users in turn.
+        void validate_changed_nodes_and_infer_types();
 
         /// \brief Returns the sum of the size of all nodes in the graph plus the size of
         /// all constant data. This has little value beyond comparing the relative size of
         /// graphs and should not be considered the actual memory consumption of a graph.
         size_t get_graph_size() const;
 
+        /// \brief Returns a hash of the ops, attributes and topology of the graph which is
+        ///        the same for graphs built the same way, in any process. See Fingerprinter.
+        /// \param include_constant_data Hash the data of Constants as well as their types
+        ///        and shapes
+        uint64_t get_fingerprint(bool include_constant_data = true) const;
+
         size_t get_placement() const;
         void set_placement(size_t placement);
 
@@ -139,5 +163,17 @@ namespace ngraph
         std::string m_name;
         const std::string m_unique_name;
         size_t m_placement{0};
+        topological_sort_t m_topological_sorter;
+
+        struct OrderedOpsCache
+        {
+            bool valid{false};
+            size_t graph_version{0};
+            // Nodes in the cached order stay reachable from the results, and therefore alive,
+            // for as long as the graph version is unchanged
+            std::vector<Node*> ops;
+        };
+        mutable std::mutex m_ordered_ops_mutex;
+        mutable OrderedOpsCache m_ordered_ops_cache[2];
     };
 }
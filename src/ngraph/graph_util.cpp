@@ -261,48 +261,60 @@ bool ngraph::is_post_dominated(Node* X, Node* Y)
     return true;
 }
 
-std::list<std::shared_ptr<ngraph::Node>>
-    ngraph::clone_nodes(const std::list<std::shared_ptr<ngraph::Node>>& nodes, NodeMap& node_map)
+// Clones the nodes of a list in topological order that are not in node_map yet
+static void clone_sorted_nodes(const std::list<std::shared_ptr<Node>>& sorted_nodes,
+                               NodeMap& node_map)
 {
-    // for each node in topological order
-    auto sorted_nodes = topological_sort(nodes, true);
-    for (auto node : sorted_nodes)
+    node_map.reserve(node_map.size() + sorted_nodes.size());
+    OutputVector cloned_args;
+    std::vector<std::shared_ptr<Node>> cloned_dependencies;
+    for (auto& node : sorted_nodes)
     {
-        if (node_map.count(node.get()) == 0)
+        auto it = node_map.find(node.get());
+        if (it != node_map.end())
         {
-            // get (already) cloned arguments and clone the node
-            OutputVector cloned_args;
-            for (auto input : node->inputs())
-            {
-                Output<Node> output = input.get_source_output();
-                cloned_args.push_back(output.for_node(node_map.at(output.get_node())));
-            }
-            std::vector<std::shared_ptr<Node>> cloned_dependencies;
-            for (auto& dependency : node->get_control_dependencies())
-            {
-                shared_ptr<Node>& dependent = node_map.at(dependency.get());
-                if (find(cloned_dependencies.begin(), cloned_dependencies.end(), dependent) ==
-                    cloned_dependencies.end())
-                {
-                    cloned_dependencies.push_back(dependent);
-                }
-            }
-            auto cloned_node = node->copy_with_new_inputs(cloned_args, cloned_dependencies);
-            if (node->get_friendly_name() != node->get_name())
-            {
-                // There is a friendly name for this node so copy it
-                cloned_node->set_friendly_name(node->get_friendly_name());
-            }
+            continue;
+        }
 
-            for (auto tag : node->get_provenance_tags())
+        // get (already) cloned arguments and clone the node
+        cloned_args.clear();
+        for (auto input : node->inputs())
+        {
+            Output<Node> output = input.get_source_output();
+            cloned_args.push_back(output.for_node(node_map.at(output.get_node())));
+        }
+        cloned_dependencies.clear();
+        for (auto& dependency : node->get_control_dependencies())
+        {
+            shared_ptr<Node>& dependent = node_map.at(dependency.get());
+            if (find(cloned_dependencies.begin(), cloned_dependencies.end(), dependent) ==
+                cloned_dependencies.end())
             {
-                cloned_node->add_provenance_tag(tag);
+                cloned_dependencies.push_back(dependent);
             }
-            cloned_node->set_op_annotations(node->get_op_annotations());
+        }
+        auto cloned_node = node->copy_with_new_inputs(cloned_args, cloned_dependencies);
+        if (node->get_friendly_name() != node->get_name())
+        {
+            // There is a friendly name for this node so copy it
+            cloned_node->set_friendly_name(node->get_friendly_name());
+        }
 
-            node_map[node.get()] = cloned_node;
+        for (auto& tag : node->get_provenance_tags())
+        {
+            cloned_node->add_provenance_tag(tag);
         }
+        cloned_node->set_op_annotations(node->get_op_annotations());
+
+        node_map.emplace(node.get(), std::move(cloned_node));
     }
+}
+
+std::list<std::shared_ptr<ngraph::Node>>
+    ngraph::clone_nodes(const std::list<std::shared_ptr<ngraph::Node>>& nodes, NodeMap& node_map)
+{
+    // for each node in topological order
+    clone_sorted_nodes(topological_sort(nodes, true), node_map);
 
     // create and return list of cloned nodes
     // order matches input list (not necessarily topological)
@@ -323,8 +335,8 @@ std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function&
 std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function& func,
                                                          NodeMap& node_map)
 {
-    // clone function operations
-    clone_nodes(func.get_ops(true), node_map);
+    // clone function operations, reusing the function's cached topological order
+    clone_sorted_nodes(func.get_ordered_ops(true), node_map);
 
     // get cloned function results and parameters
     ResultVector cloned_results;
@@ -344,7 +356,9 @@ std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function&
     }
 
     // create and return cloned function
-    return std::make_shared<ngraph::Function>(cloned_results, cloned_params);
+    auto result = std::make_shared<ngraph::Function>(cloned_results, cloned_params);
+    result->set_topological_sort(func.get_topological_sort());
+    return result;
 }
 
 bool ngraph::is_equal_to_const_value(std::string const_value, const Output<Node>& reduce_constant)
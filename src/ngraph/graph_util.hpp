@@ -251,57 +251,67 @@ namespace ngraph
     NodeVector find_common_args(std::shared_ptr<Node> target, std::shared_ptr<Node> replacement);
 
     /// Topological sort of nodes needed to compute root_nodes
+    ///
+    /// This is a depth-first search that emits each node after its dependencies. Roots are
+    /// visited last to first and, for each node, control dependencies last to first before its
+    /// inputs in order. Each node is looked up once when first reached and each edge is followed
+    /// once.
     template <typename T>
     std::list<std::shared_ptr<Node>> topological_sort(T root_nodes,
                                                       bool include_control_deps = false)
     {
-        std::stack<Node*, std::vector<Node*>> nodes_to_do;
-        std::unordered_set<Node*> nodes_done;
+        struct Frame
+        {
+            Node* node;
+            // Number of the node's dependencies that have been visited
+            size_t next_dep;
+            size_t control_dep_count;
+            size_t dep_count;
+        };
+        std::vector<Frame> stack;
+        std::unordered_set<Node*> nodes_seen;
         std::list<std::shared_ptr<Node>> result;
 
+        auto visit = [&](Node* node) {
+            if (nodes_seen.insert(node).second)
+            {
+                size_t control_dep_count =
+                    include_control_deps ? node->get_control_dependencies().size() : 0;
+                stack.push_back(Frame{node,
+                                      0,
+                                      control_dep_count,
+                                      control_dep_count + node->get_input_size()});
+            }
+        };
+
+        std::vector<Node*> roots;
         for (auto& node : root_nodes)
         {
-            nodes_to_do.push(node.get());
+            roots.push_back(node.get());
         }
-        while (nodes_to_do.size() > 0)
+        for (auto it = roots.rbegin(); it != roots.rend(); ++it)
         {
-            Node* node = nodes_to_do.top();
-            if (nodes_done.count(node) == 0)
+            visit(*it);
+            while (!stack.empty())
             {
-                bool can_add = true;
-                size_t arg_count = node->get_input_size();
-                for (size_t i = 0; i < arg_count; ++i)
+                Frame& frame = stack.back();
+                if (frame.next_dep == frame.dep_count)
                 {
-                    Node* dep = node->input(arg_count - i - 1).get_source_output().get_node();
-                    if (nodes_done.count(dep) == 0)
-                    {
-                        can_add = false;
-                        nodes_to_do.push(dep);
-                    }
+                    result.push_back(frame.node->shared_from_this());
+                    stack.pop_back();
+                    continue;
                 }
-                if (include_control_deps)
+                size_t i = frame.next_dep++;
+                if (i < frame.control_dep_count)
                 {
-                    for (auto& depptr : node->get_control_dependencies())
-                    {
-                        Node* dep = depptr.get();
-                        if (nodes_done.count(dep) == 0)
-                        {
-                            can_add = false;
-                            nodes_to_do.push(dep);
-                        }
-                    }
+                    auto& control_deps = frame.node->get_control_dependencies();
+                    visit(control_deps[frame.control_dep_count - i - 1].get());
                 }
-                if (can_add)
+                else
                 {
-                    result.push_back(node->shared_from_this());
-                    nodes_to_do.pop();
-                    nodes_done.insert(node);
+                    visit(frame.node->get_input_node_ptr(i - frame.control_dep_count));
                 }
             }
-            else
-            {
-                nodes_to_do.pop();
-            }
         }
         return result;
     }
@@ -0,0 +1,383 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace ngraph
+{
+    /// \brief A vector of trivially copyable values that keeps up to N elements inline and only
+    ///        allocates when it grows past them.
+    ///
+    /// It has the interface of std::vector that nGraph uses and converts to and from std::vector,
+    /// so that types such as Shape can be built on it without allocating in the common case.
+    template <typename T, size_t N>
+    class InlineVector
+    {
+        static_assert(std::is_trivial<T>::value, "InlineVector only holds trivial types");
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = T*;
+        using const_iterator = const T*;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        InlineVector() {}
+        explicit InlineVector(size_t n) { assign(n, T()); }
+        InlineVector(size_t n, const T& value) { assign(n, value); }
+        template <class InputIterator,
+                  typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+        InlineVector(InputIterator first, InputIterator last)
+        {
+            assign(first, last);
+        }
+        InlineVector(std::initializer_list<T> values) { assign(values.begin(), values.end()); }
+        InlineVector(const std::vector<T>& values) { assign(values.begin(), values.end()); }
+        InlineVector(const InlineVector& other) { assign(other.begin(), other.end()); }
+        InlineVector(InlineVector&& other) noexcept { take(other); }
+        ~InlineVector() { release(); }
+        InlineVector& operator=(const InlineVector& other)
+        {
+            if (this != &other)
+            {
+                assign(other.begin(), other.end());
+            }
+            return *this;
+        }
+        InlineVector& operator=(InlineVector&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                take(other);
+            }
+            return *this;
+        }
+        InlineVector& operator=(std::initializer_list<T> values)
+        {
+            assign(values.begin(), values.end());
+            return *this;
+        }
+
+        operator std::vector<T>() const { return std::vector<T>(begin(), end()); }
+        iterator begin() { return m_data; }
+        const_iterator begin() const { return m_data; }
+        const_iterator cbegin() const { return m_data; }
+        iterator end() { return m_data + m_size; }
+        const_iterator end() const { return m_data + m_size; }
+        const_iterator cend() const { return m_data + m_size; }
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        reverse_iterator rend() { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+        size_t size() const { return m_size; }
+        size_t capacity() const { return m_capacity; }
+        size_t max_size() const { return std::vector<T>().max_size(); }
+        bool empty() const { return m_size == 0; }
+        T* data() { return m_data; }
+        const T* data() const { return m_data; }
+        T& operator[](size_t i) { return m_data[i]; }
+        const T& operator[](size_t i) const { return m_data[i]; }
+        T& at(size_t i)
+        {
+            check_index(i);
+            return m_data[i];
+        }
+        const T& at(size_t i) const
+        {
+            check_index(i);
+            return m_data[i];
+        }
+        T& front() { return m_data[0]; }
+        const T& front() const { return m_data[0]; }
+        T& back() { return m_data[m_size - 1]; }
+        const T& back() const { return m_data[m_size - 1]; }
+        void reserve(size_t n)
+        {
+            if (n > m_capacity)
+            {
+                T* data = new T[n];
+                std::copy(begin(), end(), data);
+                release();
+                m_data = data;
+                m_capacity = n;
+            }
+        }
+        void shrink_to_fit() {}
+        void clear() { m_size = 0; }
+        void resize(size_t n) { resize(n, T()); }
+        void resize(size_t n, const T& value)
+        {
+            reserve(n);
+            if (n > m_size)
+            {
+                std::fill(end(), m_data + n, value);
+            }
+            m_size = n;
+        }
+        void assign(size_t n, const T& value)
+        {
+            m_size = 0;
+            resize(n, value);
+        }
+        template <class InputIterator,
+                  typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+        void assign(InputIterator first, InputIterator last)
+        {
+            if (first != last && aliases(first))
+            {
+                *this = InlineVector(first, last);
+            }
+            else
+            {
+                m_size = 0;
+                insert(end(), first, last);
+            }
+        }
+        void assign(std::initializer_list<T> values) { assign(values.begin(), values.end()); }
+        void push_back(const T& value)
+        {
+            // value may refer to an element of this vector
+            T copy = value;
+            grow(m_size + 1);
+            m_data[m_size++] = copy;
+        }
+        template <typename... Args>
+        void emplace_back(Args&&... args)
+        {
+            push_back(T(std::forward<Args>(args)...));
+        }
+        void pop_back() { m_size--; }
+        iterator insert(const_iterator position, const T& value)
+        {
+            return insert(position, size_t(1), value);
+        }
+        iterator insert(const_iterator position, size_t n, const T& value)
+        {
+            T copy = value;
+            iterator it = open(position, n);
+            std::fill(it, it + n, copy);
+            return it;
+        }
+        template <class InputIterator,
+                  typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+        iterator insert(const_iterator position, InputIterator first, InputIterator last)
+        {
+            if (first != last && aliases(first))
+            {
+                // open() moves the elements of this vector, so copy a range of them first
+                std::vector<T> values(first, last);
+                return insert_range(
+                    position, values.begin(), values.end(), std::forward_iterator_tag());
+            }
+            return insert_range(position,
+                                first,
+                                last,
+                                typename std::iterator_traits<InputIterator>::iterator_category());
+        }
+        iterator insert(const_iterator position, std::initializer_list<T> values)
+        {
+            return insert(position, values.begin(), values.end());
+        }
+        iterator erase(const_iterator position) { return erase(position, position + 1); }
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            iterator it = begin() + (first - begin());
+            std::copy(last, const_iterator(end()), it);
+            m_size -= last - first;
+            return it;
+        }
+        void swap(InlineVector& other)
+        {
+            InlineVector tmp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(tmp);
+        }
+
+    private:
+        void check_index(size_t i) const
+        {
+            if (i >= m_size)
+            {
+                throw std::out_of_range("InlineVector index out of range");
+            }
+        }
+        void grow(size_t n)
+        {
+            if (n > m_capacity)
+            {
+                reserve(std::max(n, 2 * m_capacity));
+            }
+        }
+        template <class ForwardIterator>
+        iterator insert_range(const_iterator position,
+                              ForwardIterator first,
+                              ForwardIterator last,
+                              std::forward_iterator_tag)
+        {
+            iterator it = open(position, std::distance(first, last));
+            std::copy(first, last, it);
+            return it;
+        }
+        template <class InputIterator>
+        iterator insert_range(const_iterator position,
+                              InputIterator first,
+                              InputIterator last,
+                              std::input_iterator_tag)
+        {
+            // A single pass range is appended and rotated into place
+            size_t offset = position - begin();
+            size_t old_size = m_size;
+            for (; first != last; ++first)
+            {
+                push_back(*first);
+            }
+            std::rotate(begin() + offset, begin() + old_size, end());
+            return begin() + offset;
+        }
+        // Whether a non-empty range starting at it lies in this vector. Ranges of other
+        // containers cannot.
+        bool aliases(const T* it) const
+        {
+            return !std::less<const T*>()(it, m_data) &&
+                   std::less<const T*>()(it, m_data + m_size);
+        }
+        bool aliases(T* it) const { return aliases(const_cast<const T*>(it)); }
+        template <class Iterator>
+        bool aliases(const std::reverse_iterator<Iterator>& it) const
+        {
+            return aliases(&*it);
+        }
+        template <class Iterator>
+        bool aliases(const Iterator&) const
+        {
+            return false;
+        }
+        // Makes room for n elements at position and returns an iterator to the first of them
+        iterator open(const_iterator position, size_t n)
+        {
+            size_t offset = position - begin();
+            grow(m_size + n);
+            std::copy_backward(begin() + offset, end(), end() + n);
+            m_size += n;
+            return begin() + offset;
+        }
+        void release()
+        {
+            if (m_data != m_inline)
+            {
+                delete[] m_data;
+                m_data = m_inline;
+                m_capacity = N;
+            }
+        }
+        // Takes the elements of other and leaves it empty
+        void take(InlineVector& other)
+        {
+            if (other.m_data == other.m_inline)
+            {
+                std::copy(other.begin(), other.end(), m_inline);
+                m_data = m_inline;
+                m_capacity = N;
+            }
+            else
+            {
+                m_data = other.m_data;
+                m_capacity = other.m_capacity;
+                other.m_data = other.m_inline;
+                other.m_capacity = N;
+            }
+            m_size = other.m_size;
+            other.m_size = 0;
+        }
+
+        T* m_data = m_inline;
+        size_t m_size = 0;
+        size_t m_capacity = N;
+        T m_inline[N];
+    };
+
+    /// \brief Storage of Shape, Strides, Coordinate and AxisVector, which keeps tensors of up to
+    ///        six dimensions off the heap
+    using DimensionVector = InlineVector<size_t, 6>;
+
+    template <typename T, size_t N>
+    bool operator==(const InlineVector<T, N>& a, const InlineVector<T, N>& b)
+    {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+    }
+    template <typename T, size_t N>
+    bool operator!=(const InlineVector<T, N>& a, const InlineVector<T, N>& b)
+    {
+        return !(a == b);
+    }
+    template <typename T, size_t N>
+    bool operator<(const InlineVector<T, N>& a, const InlineVector<T, N>& b)
+    {
+        return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+    }
+    template <typename T, size_t N>
+    bool operator>(const InlineVector<T, N>& a, const InlineVector<T, N>& b)
+    {
+        return b < a;
+    }
+    template <typename T, size_t N>
+    bool operator<=(const InlineVector<T, N>& a, const InlineVector<T, N>& b)
+    {
+        return !(b < a);
+    }
+    template <typename T, size_t N>
+    bool operator>=(const InlineVector<T, N>& a, const InlineVector<T, N>& b)
+    {
+        return !(a < b);
+    }
+    template <typename T, size_t N>
+    bool operator==(const InlineVector<T, N>& a, const std::vector<T>& b)
+    {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+    }
+    template <typename T, size_t N>
+    bool operator==(const std::vector<T>& a, const InlineVector<T, N>& b)
+    {
+        return b == a;
+    }
+    template <typename T, size_t N>
+    bool operator!=(const InlineVector<T, N>& a, const std::vector<T>& b)
+    {
+        return !(a == b);
+    }
+    template <typename T, size_t N>
+    bool operator!=(const std::vector<T>& a, const InlineVector<T, N>& b)
+    {
+        return !(b == a);
+    }
+}
@@ -83,6 +83,7 @@ namespace ngraph
 #include "ngraph/dimension.hpp"
 #include "ngraph/except.hpp"
 #include "ngraph/factory.hpp"
+#include "ngraph/fingerprint.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/lambda.hpp"
 #include "ngraph/node.hpp"
@@ -33,6 +33,7 @@ using namespace std;
 using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
+atomic<size_t> Node::m_graph_version(0);
 
 Node::Node(size_t output_size)
     : Node()
@@ -200,6 +201,7 @@ void Node::set_arguments(const OutputVector& arguments)
         auto& output_descriptor = output_node->get_outputs().at(output.get_index());
         m_inputs.emplace_back(this, i++, output_descriptor);
     }
+    increment_graph_version();
 }
 
 descriptor::Input& Node::get_input_descriptor(size_t position)
@@ -284,15 +286,25 @@ void Node::set_input_is_relevant_to_value(size_t i, bool relevant)
 
 void Node::set_output_type(size_t i, const element::Type& element_type, const PartialShape& pshape)
 {
-    get_output_descriptor(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
+    descriptor::Output& output = get_output_descriptor(i);
+    descriptor::Tensor& tensor = output.get_tensor();
+    if (tensor.get_element_type() != element_type ||
+        !tensor.get_partial_shape().same_scheme(pshape))
+    {
+        for (descriptor::Input* input : output.get_inputs())
+        {
+            input->get_raw_pointer_node()->m_needs_revalidation = true;
+        }
+    }
+    tensor.set_tensor_type(element_type, pshape);
 }
 
-std::deque<descriptor::Output>& Node::get_outputs()
+Node::OutputDescriptors& Node::get_outputs()
 {
     return m_outputs;
 }
 
-const std::deque<descriptor::Output>& Node::get_outputs() const
+const Node::OutputDescriptors& Node::get_outputs() const
 {
     return m_outputs;
 }
@@ -362,14 +374,37 @@ void Node::set_placement_index(size_t placement)
     m_placement_index = placement;
 }
 
+Node::SideTable& Node::get_side_table()
+{
+    if (!m_side_table)
+    {
+        m_side_table.reset(new SideTable());
+    }
+    return *m_side_table;
+}
+
+Node::RTMap& Node::get_rt_info()
+{
+    return get_side_table().rt_info;
+}
+
+const Node::RTMap& Node::get_rt_info() const
+{
+    static const RTMap empty;
+    return m_side_table ? m_side_table->rt_info : empty;
+}
+
 void Node::add_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.insert(node);
+    get_side_table().provenance_group.insert(node);
 }
 
 void Node::remove_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.erase(node);
+    if (m_side_table)
+    {
+        m_side_table->provenance_group.erase(node);
+    }
 }
 
 void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
@@ -388,7 +423,8 @@ void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
 
 const set<shared_ptr<Node>>& Node::get_provenance_group_members() const
 {
-    return m_provenance_group;
+    static const set<shared_ptr<Node>> empty;
+    return m_side_table ? m_side_table->provenance_group : empty;
 }
 
 shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& base)
@@ -420,7 +456,7 @@ shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& ba
         add_provenance_group_member(node->shared_from_this());
         for (auto value : node->input_values())
         {
-            if (m_provenance_group.count(value.get_node_shared_ptr()) == 0)
+            if (get_side_table().provenance_group.count(value.get_node_shared_ptr()) == 0)
             {
                 todo.push_back(value.get_node());
             }
@@ -458,13 +494,15 @@ void Node::add_provenance_tags_above(const OutputVector& base,
 
 const std::unordered_set<std::string>& Node::get_provenance_tags() const
 {
-    return m_provenance_tags;
+    static const unordered_set<string> empty;
+    return m_side_table ? m_side_table->provenance_tags : empty;
 }
 
 void Node::add_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.insert(tag);
-    for (auto node : m_provenance_group)
+    auto& side_table = get_side_table();
+    side_table.provenance_tags.insert(tag);
+    for (auto node : side_table.provenance_group)
     {
         node->add_provenance_tag(tag);
     }
@@ -472,7 +510,10 @@ void Node::add_provenance_tag(const std::string& tag)
 
 void Node::remove_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.erase(tag);
+    if (m_side_table)
+    {
+        m_side_table->provenance_tags.erase(tag);
+    }
 }
 
 void Node::merge_provenance_tags_from(const std::shared_ptr<const Node>& source)
@@ -518,6 +559,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
         m_control_dependencies.end())
     {
         m_control_dependencies.push_back(node);
+        increment_graph_version();
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
         {
@@ -549,6 +591,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         if (it != m_control_dependencies.end())
         {
             m_control_dependencies.erase(it);
+            increment_graph_version();
         }
     }
     {
@@ -570,7 +613,11 @@ void Node::clear_control_dependencies()
             node->m_control_dependents.erase(it);
         }
     }
-    m_control_dependencies.clear();
+    if (!m_control_dependencies.empty())
+    {
+        m_control_dependencies.clear();
+        increment_graph_version();
+    }
 }
 
 void Node::clear_control_dependents()
@@ -762,6 +809,13 @@ const string& Node::get_input_tensor_name(size_t i) const
     return m_inputs[i].get_tensor().get_name();
 }
 
+Node* Node::get_input_node_ptr(size_t i) const
+{
+    NGRAPH_CHECK(
+        i < m_inputs.size(), "index '", i, "' out of range in get_input_node_ptr(size_t i)");
+    return m_inputs[i].get_output().get_raw_pointer_node();
+}
+
 bool Node::has_same_type(std::shared_ptr<const Node> node) const
 {
     if (get_output_size() != node->get_output_size())
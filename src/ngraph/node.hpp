@@ -18,7 +18,6 @@
 
 #include <atomic>
 #include <cstring>
-#include <deque>
 #include <iostream>
 #include <memory>
 #include <set>
@@ -40,6 +39,7 @@
 #include "ngraph/op/util/op_annotations.hpp"
 #include "ngraph/output_vector.hpp"
 #include "ngraph/placement.hpp"
+#include "ngraph/stable_vector.hpp"
 #include "ngraph/strides.hpp"
 #include "ngraph/type.hpp"
 
@@ -122,6 +122,11 @@ namespace ngraph
 
         using type_info_t = DiscreteTypeInfo;
 
+        /// Input and output descriptors refer to each other by address, so they are kept in a
+        /// container that never moves its elements. Most nodes fit in the inline part.
+        using InputDescriptors = StableVector<descriptor::Input, 2>;
+        using OutputDescriptors = StableVector<descriptor::Output, 1>;
+
     protected:
         std::tuple<element::Type, PartialShape> validate_and_infer_elementwise_args(
             const op::AutoBroadcastSpec& autob = op::AutoBroadcastSpec());
@@ -193,7 +198,17 @@ namespace ngraph
         /// Sets the number of outputs
         void set_output_size(size_t output_size);
 
-        void revalidate_and_infer_types() { validate_and_infer_types(); }
+        void revalidate_and_infer_types()
+        {
+            validate_and_infer_types();
+            m_needs_revalidation = false;
+        }
+        /// \brief True if an input of this node was replaced, or the type of one of its input
+        ///        values changed, since it was last revalidated
+        bool get_needs_revalidation() const { return m_needs_revalidation; }
+        /// \brief Schedules this node for Function::validate_changed_nodes_and_infer_types. Only
+        ///        needed after changing an attribute of the node that affects its validation.
+        void set_needs_revalidation() { m_needs_revalidation = true; }
         // Called after transition
         void delayed_validate_and_infer_types();
 
@@ -264,22 +279,25 @@ namespace ngraph
         virtual bool is_dynamic() const;
         virtual bool has_state() const { return false; }
         size_t get_instance_id() const { return m_instance_id; }
+        /// \brief Returns a counter that changes whenever an input edge or a control dependency of
+        ///        any node changes. Traversal orders computed at the same version are still valid.
+        static size_t get_graph_version() { return m_graph_version.load(); }
+        /// \brief Records that the structure of some graph has changed
+        static void increment_graph_version() { m_graph_version.fetch_add(1); }
         friend NGRAPH_API std::ostream& operator<<(std::ostream&, const Node&);
         virtual std::ostream& write_short_description(std::ostream&) const;
         virtual std::ostream& write_long_description(std::ostream&) const;
 
-        std::deque<descriptor::Input>& get_inputs() NGRAPH_DEPRECATED("use inputs() instead")
+        InputDescriptors& get_inputs() NGRAPH_DEPRECATED("use inputs() instead")
         {
             return m_inputs;
         }
-        const std::deque<descriptor::Input>& get_inputs() const
-            NGRAPH_DEPRECATED("use inputs() instead")
+        const InputDescriptors& get_inputs() const NGRAPH_DEPRECATED("use inputs() instead")
         {
             return m_inputs;
         }
-        std::deque<descriptor::Output>& get_outputs() NGRAPH_DEPRECATED("use outputs() instead");
-        const std::deque<descriptor::Output>& get_outputs() const
-            NGRAPH_DEPRECATED("use outputs() instead");
+        OutputDescriptors& get_outputs() NGRAPH_DEPRECATED("use outputs() instead");
+        const OutputDescriptors& get_outputs() const NGRAPH_DEPRECATED("use outputs() instead");
 
         /// Get control dependencies registered on the node
         const std::vector<std::shared_ptr<Node>>& get_control_dependencies() const;
@@ -379,6 +397,9 @@ namespace ngraph
         /// Returns the tensor name for input i
         const std::string& get_input_tensor_name(size_t i) const;
 
+        /// Returns the node that produces input i, without taking a reference to it
+        Node* get_input_node_ptr(size_t i) const;
+
         std::unordered_set<descriptor::Tensor*> liveness_new_list;
         std::unordered_set<descriptor::Tensor*> liveness_free_list;
 
@@ -415,8 +436,8 @@ namespace ngraph
 
         using RTMap = std::map<std::string, std::shared_ptr<Variant>>;
 
-        RTMap& get_rt_info() { return m_rt_info; }
-        const RTMap& get_rt_info() const { return m_rt_info; }
+        RTMap& get_rt_info();
+        const RTMap& get_rt_info() const;
         const std::unordered_set<std::string>& get_provenance_tags() const;
         void add_provenance_tag(const std::string& tag);
         template <typename T>
@@ -512,16 +533,24 @@ namespace ngraph
         size_t m_instance_id{m_next_instance_id.fetch_add(1)};
         std::string m_friendly_name;
         std::string m_unique_name;
+        bool m_needs_revalidation{false};
         static std::atomic<size_t> m_next_instance_id;
-        std::unordered_set<std::string> m_provenance_tags;
-        std::set<std::shared_ptr<Node>> m_provenance_group;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
-        std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
+        static std::atomic<size_t> m_graph_version;
+        InputDescriptors m_inputs;
+        OutputDescriptors m_outputs;
         Placement m_placement = Placement::DEFAULT;
         size_t m_placement_index = placement_invalid;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
-        std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
+        // Members that most nodes never use are kept in a side table that is only allocated on
+        // first write, which keeps the node itself small.
+        struct SideTable
+        {
+            std::unordered_set<std::string> provenance_tags;
+            std::set<std::shared_ptr<Node>> provenance_group;
+            RTMap rt_info;
+        };
+        SideTable& get_side_table();
+        std::unique_ptr<SideTable> m_side_table;
     };
 
     using NodeTypeInfo = Node::type_info_t;
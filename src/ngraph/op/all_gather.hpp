@@ -0,0 +1,52 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        namespace v0
+        {
+            /// \brief Concatenates the argument of every process along the first dimension, in
+            ///        rank order.
+            class NGRAPH_API AllGather : public Op
+            {
+            public:
+                static constexpr NodeTypeInfo type_info{"AllGather", 0};
+                const NodeTypeInfo& get_type_info() const override { return type_info; }
+                AllGather() = default;
+                /// \param num_ranks Number of processes taking part
+                AllGather(const Output<Node>& arg, int64_t num_ranks);
+
+                void validate_and_infer_types() override;
+
+                std::shared_ptr<Node> copy_with_new_args(const NodeVector& new_args) const override;
+                int64_t get_num_ranks() const { return m_num_ranks; }
+                bool visit_attributes(AttributeVisitor& visitor) override;
+
+            private:
+                int64_t m_num_ranks{1};
+            };
+        }
+        using v0::AllGather;
+    }
+}
@@ -23,9 +23,14 @@ using namespace ngraph;
 
 constexpr NodeTypeInfo op::AllReduce::type_info;
 
-op::AllReduce::AllReduce(const Output<Node>& arg, reduction::Type reduce_type)
+op::AllReduce::AllReduce(const Output<Node>& arg,
+                         reduction::Type reduce_type,
+                         reduction::Algorithm algorithm,
+                         reduction::Compression compression)
     : Op({arg})
     , m_reduce_type(reduce_type)
+    , m_algorithm(algorithm)
+    , m_compression(compression)
 {
     constructor_validate_and_infer_types();
 }
@@ -40,18 +45,31 @@ void op::AllReduce::validate_and_infer_types()
                           get_input_element_type(0),
                           ").");
 
+    NODE_VALIDATION_CHECK(this,
+                          m_compression == reduction::Compression::NONE ||
+                              ((get_input_element_type(0).is_dynamic() ||
+                                get_input_element_type(0) == element::f32) &&
+                               m_reduce_type == reduction::Type::SUM),
+                          "Compression is only supported for f32 sums (argument element type: ",
+                          get_input_element_type(0),
+                          ", reduction: ",
+                          m_reduce_type,
+                          ").");
+
     set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
 }
 
 shared_ptr<Node> op::AllReduce::copy_with_new_args(const NodeVector& new_args) const
 {
     check_new_args_count(this, new_args);
-    return make_shared<AllReduce>(new_args.at(0), get_reduce_type());
+    return make_shared<AllReduce>(new_args.at(0), m_reduce_type, m_algorithm, m_compression);
 }
 
 bool op::AllReduce::visit_attributes(AttributeVisitor& visitor)
 {
     visitor.on_attribute("reduce_type", m_reduce_type);
+    visitor.on_attribute("algorithm", m_algorithm);
+    visitor.on_attribute("compression", m_compression);
     return true;
 }
 
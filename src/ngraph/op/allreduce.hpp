@@ -31,18 +31,31 @@ namespace ngraph
                 static constexpr NodeTypeInfo type_info{"AllReduce", 0};
                 const NodeTypeInfo& get_type_info() const override { return type_info; }
                 AllReduce() = default;
+                /// \param algorithm How processes exchange values, see reduction::Algorithm
+                /// \param compression Wire precision of the values. Requires f32 and SUM.
                 AllReduce(const Output<Node>& arg,
-                          reduction::Type reduce_type = reduction::Type::SUM);
+                          reduction::Type reduce_type = reduction::Type::SUM,
+                          reduction::Algorithm algorithm = reduction::Algorithm::FLAT,
+                          reduction::Compression compression = reduction::Compression::NONE);
 
                 void validate_and_infer_types() override;
 
                 std::shared_ptr<Node> copy_with_new_args(const NodeVector& new_args) const override;
                 reduction::Type get_reduce_type() const;
                 void set_reduce_type(reduction::Type reduce_type);
+                reduction::Algorithm get_algorithm() const { return m_algorithm; }
+                void set_algorithm(reduction::Algorithm algorithm) { m_algorithm = algorithm; }
+                reduction::Compression get_compression() const { return m_compression; }
+                void set_compression(reduction::Compression compression)
+                {
+                    m_compression = compression;
+                }
                 bool visit_attributes(AttributeVisitor& visitor) override;
 
             private:
                 reduction::Type m_reduce_type{reduction::Type::SUM};
+                reduction::Algorithm m_algorithm{reduction::Algorithm::FLAT};
+                reduction::Compression m_compression{reduction::Compression::NONE};
             };
         }
         using v0::AllReduce;
@@ -19,6 +19,7 @@
 
 #include "ngraph/log.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/constant_store.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph;
@@ -113,6 +114,36 @@ op::Constant::Constant(const element::Type& type, const Shape& shape, const void
     m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
 }
 
+op::Constant::Constant(const element::Type& type,
+                       const Shape& shape,
+                       const shared_ptr<runtime::AlignedBuffer>& data)
+    : m_element_type(type)
+    , m_shape(shape)
+    , m_data(data)
+{
+    size_t size = std::ceil(shape_size(m_shape) * m_element_type.bitwidth() / 8.f);
+    NODE_VALIDATION_CHECK(this,
+                          m_data && m_data->size() >= size,
+                          "Constant data buffer is smaller than the ",
+                          size,
+                          " bytes required for shape ",
+                          m_shape);
+    constructor_validate_and_infer_types();
+    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+}
+
+op::Constant::Constant(const element::Type& type,
+                       const Shape& shape,
+                       const shared_ptr<runtime::AlignedBuffer>& data,
+                       bool all_elements_bitwise_identical)
+    : m_element_type(type)
+    , m_shape(shape)
+    , m_data(data)
+    , m_all_elements_bitwise_identical(all_elements_bitwise_identical)
+{
+    constructor_validate_and_infer_types();
+}
+
 op::Constant::~Constant()
 {
 }
@@ -330,7 +361,25 @@ AxisSet op::Constant::get_axis_set_val() const
 shared_ptr<Node> op::Constant::copy_with_new_args(const NodeVector& new_args) const
 {
     check_new_args_count(this, new_args);
-    return make_shared<Constant>(m_element_type, m_shape, m_data->get_ptr());
+    // Constant data is immutable, so the copy shares the buffer rather than duplicating it
+    return shared_ptr<Constant>(
+        new Constant(m_element_type, m_shape, m_data, m_all_elements_bitwise_identical));
+}
+
+void op::Constant::intern_data()
+{
+    m_data = runtime::ConstantStore::get().intern(m_data);
+}
+
+shared_ptr<op::Constant> op::Constant::with_shape(const Shape& shape) const
+{
+    NGRAPH_CHECK(shape_size(shape) == shape_size(m_shape),
+                 "Cannot view a constant of shape ",
+                 m_shape,
+                 " as shape ",
+                 shape);
+    return shared_ptr<Constant>(
+        new Constant(m_element_type, shape, m_data, m_all_elements_bitwise_identical));
 }
 
 template <typename T>
@@ -77,6 +77,13 @@ namespace ngraph
                     m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
                 }
 
+                /// \brief Constructs a tensor constant from the values of a Shape, Strides,
+                ///        Coordinate or AxisVector.
+                Constant(const element::Type& type, Shape shape, const DimensionVector& values)
+                    : Constant(type, shape, std::vector<size_t>(values.begin(), values.end()))
+                {
+                }
+
                 /// \brief Constructs a tensor constant
                 ///        This constructor is mainly to support deserialization of constants.
                 ///
@@ -96,6 +103,17 @@ namespace ngraph
                 /// \param data A void* to constant data.
                 Constant(const element::Type& type, const Shape& shape, const void* data);
 
+                /// \brief Constructs a tensor constant that uses `data` in place instead of
+                ///        copying it, for example a runtime::MappedBuffer over a model file.
+                ///        The contents of `data` must not be modified afterwards.
+                ///
+                /// \param type The element type of the tensor constant.
+                /// \param shape The shape of the tensor constant.
+                /// \param data A buffer holding at least the constant's data.
+                Constant(const element::Type& type,
+                         const Shape& shape,
+                         const std::shared_ptr<runtime::AlignedBuffer>& data);
+
                 virtual ~Constant() override;
 
                 void validate_and_infer_types() override
@@ -148,6 +166,20 @@ namespace ngraph
                     return result;
                 }
 
+                /// \brief Wrapper around constructing a shared_ptr of a Constant
+                ///
+                /// \param type The element type of the tensor constant.
+                /// \param shape The shape of the tensor constant.
+                /// \param values A Shape, Strides, Coordinate or AxisVector to use as the constant
+                ///               data.
+                static std::shared_ptr<op::v0::Constant>
+                    create(const element::Type& type, Shape shape, const DimensionVector& values)
+                {
+                    auto result = std::make_shared<op::v0::Constant>(type, shape, values);
+                    result->validate_and_infer_types();
+                    return result;
+                }
+
                 /// \brief Wrapper around constructing a shared_ptr of a Constant
                 ///
                 /// \param type The element type of the tensor constant.
@@ -275,6 +307,13 @@ namespace ngraph
                 }
 
                 bool is_constant() const override { return true; }
+                /// \brief Share the data of this constant with identical constants elsewhere in
+                ///        the process through runtime::ConstantStore. Called by backends when
+                ///        they compile a function; the data is read-only afterwards.
+                void intern_data();
+                /// \brief Returns a constant with this constant's data viewed as `shape`, which
+                ///        must have the same number of elements. The data is shared, not copied.
+                std::shared_ptr<Constant> with_shape(const Shape& shape) const;
                 bool get_all_data_elements_bitwise_identical() const
                 {
                     return m_all_elements_bitwise_identical;
@@ -376,9 +415,15 @@ namespace ngraph
                 static constexpr size_t host_alignment() { return 64; }
                 element::Type m_element_type;
                 Shape m_shape{};
-                std::unique_ptr<runtime::AlignedBuffer> m_data;
+                std::shared_ptr<runtime::AlignedBuffer> m_data;
                 bool m_all_elements_bitwise_identical;
                 bool are_all_data_elements_bitwise_identical() const;
+                /// \brief Constructs a constant over the data of another constant whose element
+                ///        uniformity is already known, so that copies do not rescan the data.
+                Constant(const element::Type& type,
+                         const Shape& shape,
+                         const std::shared_ptr<runtime::AlignedBuffer>& data,
+                         bool all_elements_bitwise_identical);
                 Constant(const Constant&) = delete;
                 Constant operator=(const Constant&) = delete;
             };
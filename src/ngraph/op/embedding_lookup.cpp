@@ -59,3 +59,10 @@ shared_ptr<Node> op::EmbeddingLookup::copy_with_new_args(const NodeVector& new_a
     check_new_args_count(this, new_args);
     return make_shared<EmbeddingLookup>(new_args.at(0), new_args.at(1));
 }
+
+void op::EmbeddingLookup::generate_adjoints(autodiff::Adjoints& adjoints,
+                                            const OutputVector& deltas)
+{
+    // Only the looked up rows of the weights receive a gradient
+    adjoints.add_delta_to_rows(input_value(1), input_value(0), deltas.at(0));
+}
@@ -0,0 +1,187 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/fused/optimizer_update.hpp"
+#include "ngraph/builder/make_constant.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Checks that all inputs but the last, the parameters and the optimizer state, agree in element
+// type and shape, and that the last input is a scalar learning rate of the same element type.
+// Sets every output to the merged type and shape.
+static void infer_optimizer_update_types(Node* node)
+{
+    size_t tensor_count = node->get_input_size() - 1;
+    element::Type element_type = element::dynamic;
+    PartialShape shape = PartialShape::dynamic();
+    for (size_t i = 0; i <= tensor_count; i++)
+    {
+        NODE_VALIDATION_CHECK(node,
+                              element::Type::merge(element_type,
+                                                   element_type,
+                                                   node->get_input_element_type(i)),
+                              "Argument element types are inconsistent (input ",
+                              i,
+                              " is ",
+                              node->get_input_element_type(i),
+                              ").");
+    }
+    for (size_t i = 0; i < tensor_count; i++)
+    {
+        NODE_VALIDATION_CHECK(node,
+                              PartialShape::merge_into(shape, node->get_input_partial_shape(i)),
+                              "Argument shapes are inconsistent (input ",
+                              i,
+                              " has shape ",
+                              node->get_input_partial_shape(i),
+                              ").");
+    }
+    NODE_VALIDATION_CHECK(node,
+                          element_type.is_dynamic() || element_type.is_real(),
+                          "Argument element type must be f16, bf16, f32, f64 or dynamic (got ",
+                          element_type,
+                          ").");
+    NODE_VALIDATION_CHECK(node,
+                          node->get_input_partial_shape(tensor_count).compatible(PartialShape{}),
+                          "Learning rate must be a scalar (got shape ",
+                          node->get_input_partial_shape(tensor_count),
+                          ").");
+
+    node->set_output_size(tensor_count - 1);
+    for (size_t i = 0; i < tensor_count - 1; i++)
+    {
+        node->set_output_type(i, element_type, shape);
+    }
+}
+
+static shared_ptr<Node> broadcast_scalar(const Output<Node>& scalar, const Shape& shape)
+{
+    AxisSet axes;
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        axes.insert(i);
+    }
+    return make_shared<op::Broadcast>(scalar, shape, axes);
+}
+
+constexpr NodeTypeInfo op::SGDMomentumUpdate::type_info;
+
+op::SGDMomentumUpdate::SGDMomentumUpdate(const Output<Node>& param,
+                                         const Output<Node>& grad,
+                                         const Output<Node>& velocity,
+                                         const Output<Node>& learning_rate,
+                                         double momentum,
+                                         bool nesterov)
+    : FusedOp({param, grad, velocity, learning_rate})
+    , m_momentum(momentum)
+    , m_nesterov(nesterov)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::SGDMomentumUpdate::pre_validate_and_infer_types()
+{
+    infer_optimizer_update_types(this);
+}
+
+NodeVector op::SGDMomentumUpdate::decompose_op() const
+{
+    auto param = input_value(0);
+    auto grad = input_value(1);
+    auto velocity = input_value(2);
+    auto& shape = param.get_shape();
+    auto element_type = param.get_element_type();
+
+    auto learning_rate = broadcast_scalar(input_value(3), shape);
+    auto momentum = builder::make_constant(element_type, shape, m_momentum);
+
+    auto new_velocity = momentum * velocity + grad;
+    auto step = m_nesterov ? grad + momentum * new_velocity : new_velocity;
+    auto new_param = param - learning_rate * step;
+    return {new_param, new_velocity};
+}
+
+shared_ptr<Node> op::SGDMomentumUpdate::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<SGDMomentumUpdate>(
+        new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), m_momentum, m_nesterov);
+}
+
+constexpr NodeTypeInfo op::AdamUpdate::type_info;
+
+op::AdamUpdate::AdamUpdate(const Output<Node>& param,
+                           const Output<Node>& grad,
+                           const Output<Node>& m,
+                           const Output<Node>& v,
+                           const Output<Node>& learning_rate,
+                           double beta1,
+                           double beta2,
+                           double epsilon)
+    : FusedOp({param, grad, m, v, learning_rate})
+    , m_beta1(beta1)
+    , m_beta2(beta2)
+    , m_epsilon(epsilon)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::AdamUpdate::pre_validate_and_infer_types()
+{
+    infer_optimizer_update_types(this);
+}
+
+NodeVector op::AdamUpdate::decompose_op() const
+{
+    auto param = input_value(0);
+    auto grad = input_value(1);
+    auto m = input_value(2);
+    auto v = input_value(3);
+    auto& shape = param.get_shape();
+    auto element_type = param.get_element_type();
+
+    auto learning_rate = broadcast_scalar(input_value(4), shape);
+    auto beta1 = builder::make_constant(element_type, shape, m_beta1);
+    auto one_minus_beta1 = builder::make_constant(element_type, shape, 1 - m_beta1);
+    auto beta2 = builder::make_constant(element_type, shape, m_beta2);
+    auto one_minus_beta2 = builder::make_constant(element_type, shape, 1 - m_beta2);
+    auto epsilon = builder::make_constant(element_type, shape, m_epsilon);
+
+    auto new_m = beta1 * m + one_minus_beta1 * grad;
+    auto new_v = beta2 * v + one_minus_beta2 * grad * grad;
+    auto new_param = param - learning_rate * new_m / (make_shared<op::Sqrt>(new_v) + epsilon);
+    return {new_param, new_m, new_v};
+}
+
+shared_ptr<Node> op::AdamUpdate::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<AdamUpdate>(new_args.at(0),
+                                   new_args.at(1),
+                                   new_args.at(2),
+                                   new_args.at(3),
+                                   new_args.at(4),
+                                   m_beta1,
+                                   m_beta2,
+                                   m_epsilon);
+}
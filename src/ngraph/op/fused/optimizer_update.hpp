@@ -0,0 +1,127 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/node.hpp"
+#include "ngraph/op/op.hpp"
+#include "ngraph/op/util/fused_op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        namespace v0
+        {
+            /// \brief One step of stochastic gradient descent with momentum.
+            ///
+            /// velocity' = momentum * velocity + grad
+            /// param' = param - learning_rate * velocity', or with Nesterov momentum
+            /// param' = param - learning_rate * (grad + momentum * velocity')
+            ///
+            /// Output 0 is param' and output 1 is velocity'. Each output element depends only on
+            /// the input elements at the same index, so backends may write the outputs over the
+            /// param and velocity buffers.
+            class NGRAPH_API SGDMomentumUpdate : public ngraph::op::util::FusedOp
+            {
+            public:
+                static constexpr NodeTypeInfo type_info{"SGDMomentumUpdate", 0};
+                const NodeTypeInfo& get_type_info() const override { return type_info; }
+                SGDMomentumUpdate() = default;
+                /// \brief Constructs a SGDMomentumUpdate operation.
+                ///
+                /// \param param Parameters to update
+                /// \param grad Gradient of the loss with respect to param
+                /// \param velocity Velocity from the previous step, same shape as param
+                /// \param learning_rate Scalar learning rate
+                /// \param momentum Decay of the velocity
+                /// \param nesterov Use Nesterov momentum, default false
+                SGDMomentumUpdate(const Output<Node>& param,
+                                  const Output<Node>& grad,
+                                  const Output<Node>& velocity,
+                                  const Output<Node>& learning_rate,
+                                  double momentum,
+                                  bool nesterov = false);
+
+                virtual NodeVector decompose_op() const override;
+
+                void pre_validate_and_infer_types() override;
+
+                virtual std::shared_ptr<Node>
+                    copy_with_new_args(const NodeVector& new_args) const override;
+
+                double get_momentum() const { return m_momentum; }
+                bool get_nesterov() const { return m_nesterov; }
+            private:
+                double m_momentum{0.9};
+                bool m_nesterov{false};
+            };
+
+            /// \brief One step of the Adam optimizer.
+            ///
+            /// m' = beta1 * m + (1 - beta1) * grad
+            /// v' = beta2 * v + (1 - beta2) * grad * grad
+            /// param' = param - learning_rate * m' / (sqrt(v') + epsilon)
+            ///
+            /// The learning rate is the bias corrected step size of the current step,
+            /// lr * sqrt(1 - beta2^t) / (1 - beta1^t), so that the step count stays out of the
+            /// graph. Output 0 is param', output 1 is m' and output 2 is v'. As with
+            /// SGDMomentumUpdate, backends may write the outputs over the param, m and v buffers.
+            class NGRAPH_API AdamUpdate : public ngraph::op::util::FusedOp
+            {
+            public:
+                static constexpr NodeTypeInfo type_info{"AdamUpdate", 0};
+                const NodeTypeInfo& get_type_info() const override { return type_info; }
+                AdamUpdate() = default;
+                /// \brief Constructs an AdamUpdate operation.
+                ///
+                /// \param param Parameters to update
+                /// \param grad Gradient of the loss with respect to param
+                /// \param m First moment estimate from the previous step
+                /// \param v Second moment estimate from the previous step
+                /// \param learning_rate Scalar bias corrected step size
+                /// \param beta1 Decay of the first moment, default 0.9
+                /// \param beta2 Decay of the second moment, default 0.999
+                /// \param epsilon Small number added to the denominator, default 1e-8
+                AdamUpdate(const Output<Node>& param,
+                           const Output<Node>& grad,
+                           const Output<Node>& m,
+                           const Output<Node>& v,
+                           const Output<Node>& learning_rate,
+                           double beta1 = 0.9,
+                           double beta2 = 0.999,
+                           double epsilon = 1e-8);
+
+                virtual NodeVector decompose_op() const override;
+
+                void pre_validate_and_infer_types() override;
+
+                virtual std::shared_ptr<Node>
+                    copy_with_new_args(const NodeVector& new_args) const override;
+
+                double get_beta1() const { return m_beta1; }
+                double get_beta2() const { return m_beta2; }
+                double get_epsilon() const { return m_epsilon; }
+            private:
+                double m_beta1{0.9};
+                double m_beta2{0.999};
+                double m_epsilon{1e-8};
+            };
+        }
+        using v0::AdamUpdate;
+        using v0::SGDMomentumUpdate;
+    }
+}
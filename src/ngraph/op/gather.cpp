@@ -96,10 +96,13 @@ void op::v0::Gather::validate_and_infer_types()
     set_output_type(0, result_et, result_shape);
 }
 
-void op::v0::Gather::generate_adjoints(autodiff::Adjoints& /* adjoints */,
-                                       const OutputVector& /* deltas */)
+void op::v0::Gather::generate_adjoints(autodiff::Adjoints& adjoints, const OutputVector& deltas)
 {
-    throw ngraph_error("Not yet implemented");
+    if (m_axis != 0)
+    {
+        throw ngraph_error("Autodiff of Gather is only supported along axis 0");
+    }
+    adjoints.add_delta_to_rows(input_value(PARAMS), input_value(INDICES), deltas.at(0));
 }
 
 constexpr NodeTypeInfo op::v1::Gather::type_info;
@@ -196,10 +199,13 @@ size_t op::v1::Gather::get_axis() const
     return static_cast<size_t>(axis);
 }
 
-void op::v1::Gather::generate_adjoints(autodiff::Adjoints& /* adjoints */,
-                                       const OutputVector& /* deltas */)
+void op::v1::Gather::generate_adjoints(autodiff::Adjoints& adjoints, const OutputVector& deltas)
 {
-    throw ngraph_error("Not yet implemented");
+    if (get_axis() != 0)
+    {
+        throw ngraph_error("Autodiff of Gather is only supported along a constant axis 0");
+    }
+    adjoints.add_delta_to_rows(input_value(PARAMS), input_value(INDICES), deltas.at(0));
 }
 
 shared_ptr<Node> op::v1::Gather::copy_with_new_args(const NodeVector& new_args) const
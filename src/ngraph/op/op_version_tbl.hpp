@@ -28,9 +28,11 @@
 
 NGRAPH_OP(Abs, ngraph::op::v0, 0)
 NGRAPH_OP(Acos, ngraph::op::v0, 0)
+NGRAPH_OP(AdamUpdate, ngraph::op::v0, 0)
 NGRAPH_OP(Add, ngraph::op::v0, 0)
 NGRAPH_OP(Add, ngraph::op::v1, 1)
 NGRAPH_OP(All, ngraph::op::v0, 0)
+NGRAPH_OP(AllGather, ngraph::op::v0, 0)
 NGRAPH_OP(AllReduce, ngraph::op::v0, 0)
 NGRAPH_OP(And, ngraph::op::v0, 0)
 NGRAPH_OP(Any, ngraph::op, 0)
@@ -192,6 +194,7 @@ NGRAPH_OP(ReduceLogicalOr, ngraph::op::v1, 1)
 NGRAPH_OP(ReduceMean, ngraph::op::v1, 1)
 NGRAPH_OP(ReduceMin, ngraph::op::v1, 1)
 NGRAPH_OP(ReduceProd, ngraph::op::v1, 1)
+NGRAPH_OP(ReduceScatter, ngraph::op::v0, 0)
 NGRAPH_OP(ReduceSum, ngraph::op::v1, 1)
 NGRAPH_OP(RegionYolo, ngraph::op::v0, 0)
 NGRAPH_OP(Relu, ngraph::op::v0, 0)
@@ -205,6 +208,7 @@ NGRAPH_OP(Reverse, ngraph::op::v0, 0)
 NGRAPH_OP(Reverse, ngraph::op::v1, 1)
 NGRAPH_OP(ReverseSequence, ngraph::op::v0, 0)
 NGRAPH_OP(Round, ngraph::op::v0, 0)
+NGRAPH_OP(SGDMomentumUpdate, ngraph::op::v0, 0)
 NGRAPH_OP(ScalarConstantLike, ngraph::op::v0, 0)
 NGRAPH_OP(ScaleShift, ngraph::op::v0, 0)
 NGRAPH_OP(ScatterAdd, ngraph::op::v0, 0)
@@ -0,0 +1,80 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/reduce_scatter.hpp"
+#include "ngraph/attribute_visitor.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::ReduceScatter::type_info;
+
+op::ReduceScatter::ReduceScatter(const Output<Node>& arg,
+                                 int64_t num_ranks,
+                                 reduction::Type reduce_type)
+    : Op({arg})
+    , m_num_ranks(num_ranks)
+    , m_reduce_type(reduce_type)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::ReduceScatter::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(0).is_dynamic() ||
+                              get_input_element_type(0) == element::f32 ||
+                              get_input_element_type(0) == element::f64,
+                          "Only element types f32 and f64 are supported (argument element type: ",
+                          get_input_element_type(0),
+                          ").");
+    NODE_VALIDATION_CHECK(
+        this, m_num_ranks > 0, "Number of ranks must be positive (got ", m_num_ranks, ").");
+
+    PartialShape shape = get_input_partial_shape(0);
+    if (shape.rank().is_static())
+    {
+        NODE_VALIDATION_CHECK(this,
+                              static_cast<size_t>(shape.rank()) > 0,
+                              "Argument must have at least one dimension.");
+        if (shape[0].is_static())
+        {
+            size_t rows = static_cast<size_t>(shape[0]);
+            NODE_VALIDATION_CHECK(this,
+                                  rows % m_num_ranks == 0,
+                                  "First dimension of the argument (",
+                                  rows,
+                                  ") is not divisible by the number of ranks (",
+                                  m_num_ranks,
+                                  ").");
+            shape[0] = rows / m_num_ranks;
+        }
+    }
+    set_output_type(0, get_input_element_type(0), shape);
+}
+
+shared_ptr<Node> op::ReduceScatter::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<ReduceScatter>(new_args.at(0), m_num_ranks, m_reduce_type);
+}
+
+bool op::ReduceScatter::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("num_ranks", m_num_ranks);
+    visitor.on_attribute("reduce_type", m_reduce_type);
+    return true;
+}
@@ -0,0 +1,59 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        namespace v0
+        {
+            /// \brief Reduces the argument across processes and keeps one shard of the result.
+            ///
+            /// The first dimension of the argument is split into `num_ranks` equal blocks and
+            /// process r receives the reduction of block r over all processes.
+            class NGRAPH_API ReduceScatter : public Op
+            {
+            public:
+                static constexpr NodeTypeInfo type_info{"ReduceScatter", 0};
+                const NodeTypeInfo& get_type_info() const override { return type_info; }
+                ReduceScatter() = default;
+                /// \param num_ranks Number of processes taking part, which must divide the
+                ///        first dimension of `arg`
+                ReduceScatter(const Output<Node>& arg,
+                              int64_t num_ranks,
+                              reduction::Type reduce_type = reduction::Type::SUM);
+
+                void validate_and_infer_types() override;
+
+                std::shared_ptr<Node> copy_with_new_args(const NodeVector& new_args) const override;
+                int64_t get_num_ranks() const { return m_num_ranks; }
+                reduction::Type get_reduce_type() const { return m_reduce_type; }
+                bool visit_attributes(AttributeVisitor& visitor) override;
+
+            private:
+                int64_t m_num_ranks{1};
+                reduction::Type m_reduce_type{reduction::Type::SUM};
+            };
+        }
+        using v0::ReduceScatter;
+    }
+}
@@ -52,8 +52,10 @@
 
 NGRAPH_OP(Abs, ngraph::op)
 NGRAPH_OP(Acos, ngraph::op)
+NGRAPH_OP(AdamUpdate, ngraph::op)
 NGRAPH_OP(Add, ngraph::op)
 NGRAPH_OP(All, ngraph::op)
+NGRAPH_OP(AllGather, ngraph::op)
 NGRAPH_OP(AllReduce, ngraph::op)
 NGRAPH_OP(And, ngraph::op)
 NGRAPH_OP(Any, ngraph::op)
@@ -163,6 +165,7 @@ NGRAPH_OP(QuantizedDot, ngraph::op)
 NGRAPH_OP(QuantizedDotBias, ngraph::op)
 NGRAPH_OP(RandomUniform, ngraph::op)
 NGRAPH_OP(Recv, ngraph::op)
+NGRAPH_OP(ReduceScatter, ngraph::op)
 NGRAPH_OP(Range, ngraph::op)
 NGRAPH_OP(Relu, ngraph::op)
 NGRAPH_OP(ReluBackprop, ngraph::op)
@@ -173,6 +176,7 @@ NGRAPH_OP(Reverse, ngraph::op)
 NGRAPH_OP(ReverseSequence, ngraph::op)
 NGRAPH_OP(RNNCell, ngraph::op)
 NGRAPH_OP(Round, ngraph::op)
+NGRAPH_OP(SGDMomentumUpdate, ngraph::op)
 NGRAPH_OP(ScalarConstantLike, ngraph::op)
 NGRAPH_OP(ScaleShift, ngraph::op)
 NGRAPH_OP(ScatterAdd, ngraph::op)
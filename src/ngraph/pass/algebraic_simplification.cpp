@@ -14,11 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cmath>
 #include <memory>
 #include <set>
 
 #include "algebraic_simplification.hpp"
 #include "ngraph/axis_vector.hpp"
+#include "ngraph/builder/make_constant.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/add.hpp"
@@ -29,9 +31,11 @@
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/log.hpp"
 #include "ngraph/op/multiply.hpp"
+#include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/slice.hpp"
+#include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
 #include "ngraph/pattern/matcher.hpp"
@@ -331,6 +335,143 @@ static bool simplify_log(shared_ptr<Node> n)
     return false;
 }
 
+// The constant under `node`, looking through a Broadcast
+static shared_ptr<op::Constant> get_constant(shared_ptr<Node> node)
+{
+    if (auto broadcast = as_type_ptr<op::Broadcast>(node))
+    {
+        node = broadcast->get_argument(0);
+    }
+    return as_type_ptr<op::Constant>(node);
+}
+
+//`simplify_power` replaces a power by a constant exponent that has a cheaper equivalent,
+// since Power runs through std::pow
+//
+// x ^ 1 -> x
+// x ^ 2 -> x * x
+// x ^ 0.5 -> sqrt(x)
+// x ^ -0.5 -> 1 / sqrt(x)
+// x ^ -1 -> 1 / x
+//
+// The square root forms differ from std::pow for a negative zero and a negative infinity:
+// pow(-0, 0.5) is +0 where sqrt gives -0, pow(-inf, 0.5) is +inf where sqrt gives NaN, and
+// the reciprocals of those follow, so x ^ -0.5 gives -inf and NaN for them instead of +inf and
+// +0. Other inputs, including negative ones that give NaN, agree up to the rounding of std::pow.
+static bool simplify_power(shared_ptr<Node> n)
+{
+    auto x = n->get_argument(0);
+    auto exponent_cnst = get_constant(n->get_argument(1));
+    if (!exponent_cnst || shape_size(exponent_cnst->get_shape()) == 0 ||
+        !exponent_cnst->get_all_data_elements_bitwise_identical() ||
+        x->get_shape() != n->get_shape())
+    {
+        return false;
+    }
+    double exponent = exponent_cnst->cast_vector<double>().at(0);
+    const element::Type& type = n->get_element_type();
+    auto reciprocal = [&](shared_ptr<Node> arg) -> shared_ptr<Node> {
+        return make_shared<op::Divide>(builder::make_constant(type, n->get_shape(), 1), arg);
+    };
+
+    shared_ptr<Node> replacement;
+    if (exponent == 1)
+    {
+        replacement = x;
+    }
+    else if (exponent == 2)
+    {
+        replacement = make_shared<op::Multiply>(x, x);
+    }
+    else if (type.is_real() && exponent == 0.5)
+    {
+        replacement = make_shared<op::Sqrt>(x);
+    }
+    else if (type.is_real() && exponent == -0.5)
+    {
+        replacement = reciprocal(make_shared<op::Sqrt>(x));
+    }
+    else if (type.is_real() && exponent == -1)
+    {
+        replacement = reciprocal(x);
+    }
+    else
+    {
+        return false;
+    }
+    NGRAPH_DEBUG << " Replacing " << n->get_name() << " with " << replacement->get_name();
+    replace_node(n, replacement);
+    return true;
+}
+
+// 1 / c, or 1 / sqrt(c) for `root`, when every element is finite in the type of c
+static shared_ptr<op::Constant> get_reciprocal_constant(shared_ptr<op::Constant> cnst, bool root)
+{
+    const element::Type& type = cnst->get_element_type();
+    vector<double> values = cnst->cast_vector<double>();
+    for (double& value : values)
+    {
+        value = 1 / (root ? std::sqrt(value) : value);
+        if (!std::isfinite(type == element::f32 ? static_cast<float>(value) : value))
+        {
+            return nullptr;
+        }
+    }
+    return op::Constant::create(type, cnst->get_shape(), values);
+}
+
+//`simplify_divide` turns a division by a constant into a multiplication
+//
+// x / c -> x * (1 / c)
+// x / broadcast(c) -> x * broadcast(1 / c)
+// x / sqrt(c) -> x * (1 / sqrt(c))
+//
+// The reciprocal is rounded once, so results can differ from the division in the last bit.
+static bool simplify_divide(shared_ptr<Node> n)
+{
+    auto divide = static_pointer_cast<op::Divide>(n);
+    const element::Type& type = n->get_element_type();
+    if (type != element::f32 && type != element::f64)
+    {
+        return false;
+    }
+    auto x = n->get_argument(0);
+    // Leave exp(x) / c to simplify_log when it is the argument of a Log
+    if (is_type<op::Exp>(x))
+    {
+        for (auto& user : n->get_users())
+        {
+            if (is_type<op::Log>(user))
+            {
+                return false;
+            }
+        }
+    }
+
+    auto divisor = n->get_argument(1);
+    auto sqrt = as_type_ptr<op::Sqrt>(divisor);
+    auto broadcast = as_type_ptr<op::Broadcast>(sqrt ? sqrt->get_argument(0) : divisor);
+    auto cnst = get_constant(sqrt ? sqrt->get_argument(0) : divisor);
+    if (!cnst)
+    {
+        return false;
+    }
+    shared_ptr<Node> factor = get_reciprocal_constant(cnst, sqrt != nullptr);
+    if (!factor)
+    {
+        NGRAPH_DEBUG << cnst->get_name() << " has no finite reciprocal";
+        return false;
+    }
+    if (broadcast)
+    {
+        factor = broadcast->copy_with_new_args({factor});
+    }
+    auto multiply = make_shared<op::Multiply>(x, factor, divide->get_autob());
+    NGRAPH_DEBUG << " Replacing " << n->get_name() << " with " << multiply->get_name();
+    replace_node(n, multiply);
+    return true;
+}
+
 static size_t reduction_shape_size(const AxisSet& axes, const Shape& shape)
 {
     size_t prod = 1;
@@ -465,7 +606,9 @@ static unordered_map<type_index, function<bool(shared_ptr<Node>)>> initialize_op
           function<bool(shared_ptr<Node>)>{simplify_reduction<op::Sum, get_sum_constant>}},
          {TI(op::Product),
           function<bool(shared_ptr<Node>)>{simplify_reduction<op::Product, get_prod_constant>}},
-         {TI(op::Log), simplify_log}});
+         {TI(op::Log), simplify_log},
+         {TI(op::Power), simplify_power},
+         {TI(op::Divide), simplify_divide}});
 }
 
 static unordered_map<type_index, function<bool(shared_ptr<Node>)>> ops_to_simplifiers =
@@ -482,6 +625,10 @@ bool pass::AlgebraicSimplification::run_on_function(shared_ptr<Function> f)
         }
 
         const Node& node = *n;
+        if (!m_reciprocal_divide && is_type<op::Divide>(n))
+        {
+            continue;
+        }
         auto eh = ops_to_simplifiers.find(TI(node));
         if (eh == ops_to_simplifiers.end())
         {
@@ -30,10 +30,17 @@ namespace ngraph
 class NGRAPH_API ngraph::pass::AlgebraicSimplification : public FunctionPass
 {
 public:
-    AlgebraicSimplification()
+    /// \param reciprocal_divide Also turn divisions by a constant into multiplications by its
+    ///        reciprocal. Backends turn it off while fusions that match those divisions have
+    ///        yet to run.
+    AlgebraicSimplification(bool reciprocal_divide = true)
         : FunctionPass()
+        , m_reciprocal_divide(reciprocal_divide)
     {
         set_property(PassProperty::REQUIRE_STATIC_SHAPE, true);
     }
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
+
+private:
+    bool m_reciprocal_divide;
 };
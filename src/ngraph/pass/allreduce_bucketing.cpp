@@ -0,0 +1,172 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+#include <unordered_map>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+size_t pass::AllReduceBucketing::get_default_bucket_bytes()
+{
+    static const size_t s_bucket_bytes = []() -> size_t {
+        const char* env = getenv("NGRAPH_ALLREDUCE_BUCKET_BYTES");
+        return env ? static_cast<size_t>(strtoull(env, nullptr, 10)) : size_t(25) << 20;
+    }();
+    return s_bucket_bytes;
+}
+
+namespace
+{
+    struct Bucket
+    {
+        element::Type element_type;
+        reduction::Type reduce_type;
+        reduction::Algorithm algorithm;
+        reduction::Compression compression;
+        // Execution index of the first AllReduce in the bucket
+        size_t first_index;
+        size_t bytes;
+        vector<shared_ptr<op::AllReduce>> members;
+    };
+}
+
+static Output<Node> flatten(const Output<Node>& value)
+{
+    auto& shape = value.get_shape();
+    if (shape.size() == 1)
+    {
+        return value;
+    }
+    return make_shared<op::Reshape>(
+               value, get_default_order(shape.size()), Shape{shape_size(shape)})
+        ->output(0);
+}
+
+static void fuse_bucket(const Bucket& bucket)
+{
+    OutputVector flattened;
+    for (auto& member : bucket.members)
+    {
+        flattened.push_back(flatten(member->input_value(0)));
+    }
+    auto concat = make_shared<op::Concat>(flattened, 0);
+    auto allreduce = make_shared<op::AllReduce>(
+        concat, bucket.reduce_type, bucket.algorithm, bucket.compression);
+    NGRAPH_DEBUG << "Fusing " << bucket.members.size() << " AllReduces of " << bucket.bytes
+                 << " bytes into " << allreduce->get_name();
+
+    size_t offset = 0;
+    for (auto& member : bucket.members)
+    {
+        auto& shape = member->get_shape();
+        size_t count = shape_size(shape);
+        shared_ptr<Node> replacement =
+            make_shared<op::Slice>(allreduce, Coordinate{offset}, Coordinate{offset + count});
+        if (shape.size() != 1)
+        {
+            replacement = make_shared<op::Reshape>(replacement, AxisVector{0}, shape);
+        }
+        replace_node(member, replacement);
+        offset += count;
+    }
+}
+
+bool pass::AllReduceBucketing::run_on_function(shared_ptr<Function> f)
+{
+    // For each node, the execution index of the last AllReduce it depends on, if any. An
+    // AllReduce may only join a bucket if none of the AllReduces it depends on were added after
+    // the bucket was opened.
+    unordered_map<Node*, size_t> last_allreduce;
+    size_t allreduce_count = 0;
+
+    vector<Bucket> open_buckets;
+    vector<Bucket> closed_buckets;
+
+    for (auto& node : f->get_ordered_ops())
+    {
+        size_t last = 0;
+        for (auto& input : node->inputs())
+        {
+            auto it = last_allreduce.find(input.get_source_output().get_node());
+            if (it != last_allreduce.end())
+            {
+                last = max(last, it->second);
+            }
+        }
+
+        auto allreduce = as_type_ptr<op::AllReduce>(node);
+        if (!allreduce)
+        {
+            if (last != 0)
+            {
+                last_allreduce[node.get()] = last;
+            }
+            continue;
+        }
+
+        // Execution indices start at 1 so that 0 means "depends on no AllReduce"
+        size_t index = ++allreduce_count;
+        last_allreduce[node.get()] = index;
+
+        auto element_type = allreduce->get_element_type();
+        auto reduce_type = allreduce->get_reduce_type();
+        auto algorithm = allreduce->get_algorithm();
+        auto compression = allreduce->get_compression();
+        size_t bytes = shape_size(allreduce->get_shape()) * element_type.size();
+
+        auto bucket = find_if(open_buckets.begin(), open_buckets.end(), [&](const Bucket& b) {
+            return b.element_type == element_type && b.reduce_type == reduce_type &&
+                   b.algorithm == algorithm && b.compression == compression;
+        });
+        if (bucket != open_buckets.end() &&
+            (last >= bucket->first_index || bucket->bytes + bytes > m_bucket_bytes))
+        {
+            closed_buckets.push_back(move(*bucket));
+            open_buckets.erase(bucket);
+            bucket = open_buckets.end();
+        }
+        if (bucket == open_buckets.end())
+        {
+            open_buckets.push_back(
+                Bucket{element_type, reduce_type, algorithm, compression, index, 0, {}});
+            bucket = prev(open_buckets.end());
+        }
+        bucket->bytes += bytes;
+        bucket->members.push_back(allreduce);
+    }
+    closed_buckets.insert(closed_buckets.end(), open_buckets.begin(), open_buckets.end());
+
+    bool modified = false;
+    for (auto& bucket : closed_buckets)
+    {
+        if (bucket.members.size() > 1)
+        {
+            fuse_bucket(bucket);
+            modified = true;
+        }
+    }
+    return modified;
+}
@@ -0,0 +1,56 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class AllReduceBucketing;
+    }
+}
+
+/// \brief Packs AllReduce ops into size-bounded buckets so that many small gradients are reduced
+///        by a single collective call.
+///
+/// AllReduces with the same element type, reduction type, algorithm and compression are grouped
+/// in execution order. The inputs of a bucket are flattened and concatenated into one buffer,
+/// which is reduced once and sliced back into the original tensors. An AllReduce whose input
+/// depends on a member of the open bucket starts a new bucket, so the rewrite never introduces
+/// cycles.
+class NGRAPH_API ngraph::pass::AllReduceBucketing : public FunctionPass
+{
+public:
+    /// \param bucket_bytes Largest size of a bucket in bytes. Defaults to
+    ///        NGRAPH_ALLREDUCE_BUCKET_BYTES, or 25 MiB. Tensors larger than this are reduced on
+    ///        their own.
+    AllReduceBucketing(size_t bucket_bytes = get_default_bucket_bytes())
+        : FunctionPass()
+        , m_bucket_bytes(bucket_bytes)
+    {
+        set_property(PassProperty::REQUIRE_STATIC_SHAPE, true);
+    }
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+    static size_t get_default_bucket_bytes();
+
+private:
+    size_t m_bucket_bytes;
+};
@@ -0,0 +1,199 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <map>
+#include <unordered_set>
+
+#include "ngraph/distributed.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/all_gather.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/op/fused/optimizer_update.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/reduce_scatter.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/pass/allreduce_sharding.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Whether node computes each output element from the input elements at the same index, with
+// every input and output either of the full shape or a scalar
+static bool is_shardable(const Node& node, const Shape& shape)
+{
+    if (!node.is_unary_elementwise_arithmetic() && !node.is_binary_elementwise_arithmetic() &&
+        !is_type<op::GetOutputElement>(&node) && !is_type<op::SGDMomentumUpdate>(&node) &&
+        !is_type<op::AdamUpdate>(&node))
+    {
+        return false;
+    }
+    for (auto& input : node.inputs())
+    {
+        if (input.get_shape() != shape && !input.get_shape().empty())
+        {
+            return false;
+        }
+    }
+    for (auto& output : node.outputs())
+    {
+        if (output.get_shape() != shape)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// `replaced` holds the nodes of updates sharded before. They stay connected to the inputs they
+// share with later updates, but no longer compute anything.
+static bool shard_update(const shared_ptr<op::AllReduce>& allreduce,
+                         const list<shared_ptr<Node>>& ordered_ops,
+                         size_t num_ranks,
+                         size_t rank,
+                         unordered_set<Node*>& replaced)
+{
+    const Shape& shape = allreduce->get_shape();
+
+    // The update is every shardable node reached from the AllReduce through shardable nodes
+    unordered_set<Node*> update;
+    vector<Node*> stack{allreduce.get()};
+    while (!stack.empty())
+    {
+        Node* node = stack.back();
+        stack.pop_back();
+        for (auto& output : node->outputs())
+        {
+            for (auto& input : output.get_target_inputs())
+            {
+                Node* user = input.get_node();
+                if (update.count(user) == 0 && replaced.count(user) == 0 &&
+                    is_shardable(*user, shape))
+                {
+                    update.insert(user);
+                    stack.push_back(user);
+                }
+            }
+        }
+    }
+    if (update.empty())
+    {
+        // Splitting a bare AllReduce only adds latency
+        return false;
+    }
+
+    Coordinate lower(shape.size(), 0);
+    Coordinate upper(shape);
+    size_t rows = shape[0] / num_ranks;
+    lower[0] = rank * rows;
+    upper[0] = (rank + 1) * rows;
+
+    map<Output<Node>, Output<Node>> sharded;
+    sharded[allreduce->output(0)] =
+        make_shared<op::ReduceScatter>(
+            allreduce->input_value(0), num_ranks, allreduce->get_reduce_type())
+            ->output(0);
+    vector<Node*> sharded_nodes{allreduce.get()};
+    for (auto& node : ordered_ops)
+    {
+        if (update.count(node.get()) == 0)
+        {
+            continue;
+        }
+        OutputVector args;
+        for (auto& value : node->input_values())
+        {
+            auto it = sharded.find(value);
+            if (it != sharded.end())
+            {
+                args.push_back(it->second);
+            }
+            else if (value.get_shape().empty())
+            {
+                args.push_back(value);
+            }
+            else
+            {
+                auto slice = make_shared<op::Slice>(value, lower, upper)->output(0);
+                sharded[value] = slice;
+                args.push_back(slice);
+            }
+        }
+        auto clone = node->copy_with_new_inputs(args);
+        for (size_t i = 0; i < node->get_output_size(); i++)
+        {
+            sharded[node->output(i)] = clone->output(i);
+        }
+        sharded_nodes.push_back(node.get());
+    }
+    replaced.insert(sharded_nodes.begin(), sharded_nodes.end());
+
+    // Users outside of the update read the full values back
+    for (Node* node : sharded_nodes)
+    {
+        for (auto& output : node->outputs())
+        {
+            shared_ptr<Node> gather;
+            for (auto& input : output.get_target_inputs())
+            {
+                if (update.count(input.get_node()) != 0)
+                {
+                    continue;
+                }
+                if (!gather)
+                {
+                    gather = make_shared<op::AllGather>(sharded.at(output), num_ranks);
+                }
+                input.replace_source_output(gather->output(0));
+            }
+        }
+    }
+    NGRAPH_DEBUG << "Sharded " << update.size() << " update nodes of " << allreduce->get_name()
+                 << " over " << num_ranks << " ranks";
+    return true;
+}
+
+bool pass::AllReduceSharding::run_on_function(shared_ptr<Function> f)
+{
+    size_t num_ranks = m_num_ranks;
+    size_t rank = m_rank;
+    if (num_ranks == 0)
+    {
+        auto distributed = get_distributed_interface();
+        num_ranks = static_cast<size_t>(distributed->get_size());
+        rank = static_cast<size_t>(distributed->get_rank());
+    }
+    if (num_ranks < 2)
+    {
+        return false;
+    }
+
+    bool modified = false;
+    unordered_set<Node*> replaced;
+    auto ordered_ops = f->get_ordered_ops();
+    for (auto& node : ordered_ops)
+    {
+        auto allreduce = as_type_ptr<op::AllReduce>(node);
+        if (!allreduce || allreduce->get_algorithm() != reduction::Algorithm::FLAT ||
+            allreduce->get_compression() != reduction::Compression::NONE ||
+            allreduce->get_shape().empty() || allreduce->get_shape()[0] % num_ranks != 0)
+        {
+            continue;
+        }
+        modified |= shard_update(allreduce, ordered_ops, num_ranks, rank, replaced);
+    }
+    return modified;
+}
@@ -0,0 +1,59 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class AllReduceSharding;
+    }
+}
+
+/// \brief Splits the update that follows an AllReduce across the data-parallel ranks.
+///
+/// An AllReduce whose result only feeds elementwise ops and optimizer updates
+/// (SGDMomentumUpdate, AdamUpdate) is replaced by a ReduceScatter. Each rank then runs the
+/// update on its shard of the first dimension, reading the matching slices of the other
+/// operands such as parameters and optimizer state, and an AllGather rebuilds every full
+/// tensor that is used outside of the update. Per rank, the update computes and stores a
+/// 1/N share of the values, and the gradient is exchanged in two halves of an all-reduce.
+///
+/// Compressed or hierarchical AllReduces, and those whose first dimension does not divide
+/// by the number of ranks, are left alone.
+class NGRAPH_API ngraph::pass::AllReduceSharding : public FunctionPass
+{
+public:
+    /// \param num_ranks Number of data-parallel ranks, or 0 to use the size of the
+    ///        distributed interface
+    /// \param rank Rank of this process; only used when num_ranks is given
+    AllReduceSharding(size_t num_ranks = 0, size_t rank = 0)
+        : FunctionPass()
+        , m_num_ranks(num_ranks)
+        , m_rank(rank)
+    {
+        set_property(PassProperty::REQUIRE_STATIC_SHAPE, true);
+    }
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    size_t m_num_ranks;
+    size_t m_rank;
+};
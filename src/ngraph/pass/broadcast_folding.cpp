@@ -0,0 +1,129 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/pass/broadcast_folding.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/binary_elementwise_comparison.hpp"
+#include "ngraph/op/util/binary_elementwise_logical.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+pass::BroadcastFolding::BroadcastFolding(op_query_t callback)
+    : NodePass()
+    , m_supports_implicit_broadcast(callback)
+{
+}
+
+static void set_numpy_autob(Node& node)
+{
+    op::AutoBroadcastSpec numpy(op::AutoBroadcastType::NUMPY);
+    if (node.is_binary_elementwise_arithmetic())
+    {
+        static_cast<op::util::BinaryElementwiseArithmetic&>(node).set_autob(numpy);
+    }
+    else if (node.is_binary_elementwise_comparison())
+    {
+        static_cast<op::util::BinaryElementwiseComparison&>(node).set_autob(numpy);
+    }
+    else
+    {
+        static_cast<op::util::BinaryElementwiseLogical&>(node).set_autob(numpy);
+    }
+}
+
+bool pass::BroadcastFolding::run_on_node(shared_ptr<Node> node)
+{
+    if (!(node->is_binary_elementwise_arithmetic() || node->is_binary_elementwise_comparison() ||
+          node->is_binary_elementwise_logical()) ||
+        node->get_autob().m_type != op::AutoBroadcastType::NONE ||
+        node->get_input_partial_shape(0).is_dynamic() ||
+        node->get_input_partial_shape(1).is_dynamic() ||
+        (m_supports_implicit_broadcast && !m_supports_implicit_broadcast(*node)))
+    {
+        return false;
+    }
+
+    // Both inputs have the output shape. Under NUMPY broadcasting a folded input has length one
+    // along its broadcast axes instead.
+    Shape shape = node->get_input_shape(0);
+    shared_ptr<op::Broadcast> broadcasts[2];
+    Shape folded_shapes[2] = {shape, shape};
+    for (size_t i = 0; i < 2; i++)
+    {
+        broadcasts[i] = as_type_ptr<op::Broadcast>(node->get_argument(i));
+        if (broadcasts[i] && broadcasts[i]->get_input_partial_shape(0).is_static())
+        {
+            for (auto axis : broadcasts[i]->get_broadcast_axes())
+            {
+                folded_shapes[i][axis] = 1;
+            }
+        }
+        else
+        {
+            broadcasts[i] = nullptr;
+        }
+    }
+    if (!broadcasts[0] && !broadcasts[1])
+    {
+        return false;
+    }
+
+    // An axis broadcast by both inputs would be lost from the output, so only the first is
+    // folded then
+    if (broadcasts[0] && broadcasts[1])
+    {
+        for (size_t axis = 0; axis < shape.size(); axis++)
+        {
+            if (shape[axis] != 1 && folded_shapes[0][axis] == 1 && folded_shapes[1][axis] == 1)
+            {
+                broadcasts[1] = nullptr;
+                break;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        if (!broadcasts[i])
+        {
+            continue;
+        }
+        // NUMPY broadcasting left pads the shorter shape with ones, so leading ones are implied
+        Shape& folded_shape = folded_shapes[i];
+        auto first = find_if(
+            folded_shape.begin(), folded_shape.end(), [](size_t length) { return length != 1; });
+        folded_shape.erase(folded_shape.begin(), first);
+
+        Output<Node> arg = broadcasts[i]->input_value(0);
+        if (arg.get_shape() != folded_shape)
+        {
+            arg = make_shared<op::Reshape>(
+                      arg, get_default_order(arg.get_shape().size()), folded_shape)
+                      ->output(0);
+        }
+        node->input(i).replace_source_output(arg);
+    }
+    set_numpy_autob(*node);
+    node->revalidate_and_infer_types();
+    NGRAPH_CHECK(node->get_output_shape(0) == shape,
+                 "Folding broadcasts changed the shape of ",
+                 *node);
+    return true;
+}
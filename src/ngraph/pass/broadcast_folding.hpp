@@ -0,0 +1,52 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Folds Broadcast ops into the binary elementwise ops that read them, turning
+        ///        an explicit broadcast back into a NUMPY-style implicit one.
+        ///
+        /// This is the inverse of ImplicitBroadcastElimination, for backends whose kernels read
+        /// an implicitly broadcast input in place instead of materializing it at the output
+        /// shape. A Broadcast input is replaced by its argument, reshaped to insert the
+        /// broadcast axes as ones where NUMPY alignment requires it. The Broadcast itself stays
+        /// in the graph only if it has other users.
+        class NGRAPH_API BroadcastFolding : public NodePass
+        {
+        public:
+            /// \brief Returns whether the backend reads the implicitly broadcast inputs of the
+            ///        given op without materializing them.
+            using op_query_t = std::function<bool(const Node& node)>;
+
+            /// \param callback Selects the ops to fold into. All binary elementwise ops are
+            ///                 candidates if it is null.
+            BroadcastFolding(op_query_t callback = nullptr);
+            bool run_on_node(std::shared_ptr<Node> node) override;
+
+        private:
+            op_query_t m_supports_implicit_broadcast;
+        };
+    }
+}
@@ -14,7 +14,18 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
 #include "constant_folding.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/result.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -31,3 +42,328 @@ bool ngraph::pass::revalidate_and_ensure_static(shared_ptr<Node> n)
     }
     return true;
 }
+
+static size_t get_env_size(const char* name, size_t default_value)
+{
+    const char* env = getenv(name);
+    return env ? static_cast<size_t>(strtoull(env, nullptr, 10)) : default_value;
+}
+
+void pass::ConstantFolding::init_defaults()
+{
+    static const size_t s_thread_count =
+        get_env_size("NGRAPH_CONSTANT_FOLDING_THREADS", thread::hardware_concurrency());
+    static const size_t s_max_folded_bytes =
+        get_env_size("NGRAPH_CONSTANT_FOLDING_MAX_BYTES", size_t(256) << 20);
+    m_thread_count = max<size_t>(s_thread_count, 1);
+    m_max_folded_bytes = s_max_folded_bytes;
+    m_max_expansion_ratio = 0;
+}
+
+const char* const pass::ConstantFolding::s_threads_parameter = "ConstantFolding::Threads";
+const char* const pass::ConstantFolding::s_max_folded_bytes_parameter =
+    "ConstantFolding::MaxFoldedBytes";
+const char* const pass::ConstantFolding::s_max_expansion_ratio_parameter =
+    "ConstantFolding::MaxExpansionRatio";
+
+void pass::ConstantFolding::apply_pass_config(const PassConfig& pass_config)
+{
+    if (pass_config.has_pass_parameter(s_threads_parameter))
+    {
+        size_t thread_count =
+            static_cast<size_t>(pass_config.get_pass_parameter(s_threads_parameter, 1));
+        m_thread_count = max<size_t>(thread_count, 1);
+    }
+    m_max_folded_bytes = static_cast<size_t>(
+        pass_config.get_pass_parameter(s_max_folded_bytes_parameter, m_max_folded_bytes));
+    m_max_expansion_ratio =
+        pass_config.get_pass_parameter(s_max_expansion_ratio_parameter, m_max_expansion_ratio);
+}
+
+// Returns the total size of `values`, or 0 if any of them is not static
+template <typename T>
+static size_t get_static_bytes(const vector<T>& values)
+{
+    size_t bytes = 0;
+    for (auto& value : values)
+    {
+        if (value.get_partial_shape().is_dynamic() || value.get_element_type().is_dynamic())
+        {
+            return 0;
+        }
+        bytes += shape_size(value.get_shape()) * value.get_element_type().size();
+    }
+    return bytes;
+}
+
+// Folding a node that expands its inputs, such as a Broadcast, can grow the model by orders of
+// magnitude. Such nodes are left unfolded, which keeps the compact form of the constant.
+bool pass::ConstantFolding::is_too_large_to_fold(const shared_ptr<Node>& node) const
+{
+    // Small results are always folded, whatever their expansion
+    const size_t minimum_size_of_interest = 64 * 1024;
+    size_t output_bytes = get_static_bytes(node->outputs());
+    size_t input_bytes = get_static_bytes(node->inputs());
+    if (output_bytes <= input_bytes)
+    {
+        return false;
+    }
+    if (output_bytes > m_max_folded_bytes)
+    {
+        return true;
+    }
+    return m_max_expansion_ratio > 0 && output_bytes > minimum_size_of_interest &&
+           output_bytes > m_max_expansion_ratio * input_bytes;
+}
+
+bool pass::ConstantFolding::try_fold(const vector<MatchClosure>& matchers,
+                                     const shared_ptr<Node>& node,
+                                     bool is_dyn_func)
+{
+    for (auto& closure : matchers)
+    {
+        if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
+        {
+            continue;
+        }
+        if (closure.matcher->match(node) && closure.callback(*closure.matcher.get()))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Node names are generated on first use, so generate the names that several threads can read
+// before the threads start
+static void generate_names(const shared_ptr<Node>& node)
+{
+    node->get_name();
+    for (auto& arg : node->get_arguments())
+    {
+        generate_names(arg);
+    }
+}
+
+vector<shared_ptr<Node>>
+    pass::ConstantFolding::fold_in_parallel(const vector<MatchClosure>& matchers,
+                                            const vector<shared_ptr<Node>>& nodes,
+                                            bool is_dyn_func)
+{
+    // Each node is folded as a copy feeding a private Result, so the callbacks never update
+    // users shared with other threads. Copies attach to and detach from the shared input
+    // Constants, so they are made and destroyed on this thread.
+    vector<shared_ptr<Node>> copies;
+    vector<shared_ptr<op::Result>> results;
+    for (auto& node : nodes)
+    {
+        generate_names(node);
+        copies.push_back(node->copy_with_new_inputs(node->input_values(), {}));
+        results.push_back(make_shared<op::Result>(copies.back()));
+    }
+    for (auto& closure : matchers)
+    {
+        generate_names(closure.matcher->get_pattern());
+    }
+
+    vector<shared_ptr<Node>> replacements(nodes.size());
+    atomic<size_t> next_node{0};
+    exception_ptr error;
+    mutex error_mutex;
+    auto fold_nodes = [&]() {
+        // Matchers hold the state of their last match, so each thread needs its own
+        vector<MatchClosure> thread_matchers;
+        for (auto& closure : matchers)
+        {
+            auto matcher = make_shared<pattern::Matcher>(closure.matcher->get_pattern(),
+                                                         closure.matcher->get_name());
+            thread_matchers.push_back({matcher, closure.callback, closure.property});
+        }
+        try
+        {
+            for (size_t i = next_node++; i < nodes.size(); i = next_node++)
+            {
+                if (try_fold(thread_matchers, copies[i], is_dyn_func))
+                {
+                    auto replacement = results[i]->input_value(0).get_node_shared_ptr();
+                    if (replacement != copies[i])
+                    {
+                        replacements[i] = replacement;
+                    }
+                }
+            }
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(error_mutex);
+            if (!error)
+            {
+                error = current_exception();
+            }
+            next_node = nodes.size();
+        }
+    };
+
+    vector<thread> threads;
+    for (size_t i = 1; i < min(m_thread_count, nodes.size()); i++)
+    {
+        threads.emplace_back(fold_nodes);
+    }
+    fold_nodes();
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+    return replacements;
+}
+
+// Unlike GraphRewrite, which tries every matcher on every node in one sequential sweep, this
+// works in waves. Nodes whose inputs are all Constants do not depend on each other, so they are
+// folded on several threads. The other nodes are folded on this thread, in topological order.
+// The next wave only visits the users of the nodes that were folded, and the users of nodes
+// whose types changed on revalidation.
+bool pass::ConstantFolding::run_on_function(shared_ptr<Function> f)
+{
+    // This check is very expensive and is only needed for experimental features, so we will hide
+    // it behind an environment variable for now, as GraphRewrite does.
+    static bool s_rerun_dynamic_check =
+        (std::getenv("NGRAPH_GRAPH_REWRITE_RERUN_DYNAMIC_CHECK") != nullptr);
+    bool is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
+    if (has_state() && get_state().get_pass_config())
+    {
+        apply_pass_config(*get_state().get_pass_config());
+    }
+    vector<MatchClosure> original_matchers{m_matchers};
+    bool rewritten = false;
+
+    // Nodes created by a fold, such as the Slices of a folded Split, take the position of the
+    // node they replace, which keeps the order topological
+    unordered_map<Node*, size_t> positions;
+    using WorkList = map<pair<size_t, size_t>, shared_ptr<Node>>;
+    WorkList work;
+    auto add_work = [&](WorkList& list, const shared_ptr<Node>& node, size_t position) {
+        auto it = positions.insert({node.get(), position}).first;
+        list.insert({{it->second, node->get_instance_id()}, node});
+    };
+    size_t position = 0;
+    for (auto& node : f->get_ordered_ops())
+    {
+        add_work(work, node, position++);
+    }
+    auto add_users = [&](const shared_ptr<Node>& folded, const NodeVector& users) {
+        size_t folded_position = positions.at(folded.get());
+        for (auto& user : users)
+        {
+            add_work(work, user, folded_position);
+            for (auto& value : user->input_values())
+            {
+                auto source = value.get_node_shared_ptr();
+                if (!source->is_constant() && positions.count(source.get()) == 0)
+                {
+                    add_work(work, source, folded_position);
+                }
+            }
+        }
+    };
+
+    while (!work.empty())
+    {
+        WorkList current;
+        swap(current, work);
+        vector<MatchClosure> matchers{m_matchers};
+
+        if (m_enable_shape_inference)
+        {
+            for (auto& entry : current)
+            {
+                auto& node = entry.second;
+                vector<pair<element::Type, PartialShape>> types;
+                for (auto& output : node->outputs())
+                {
+                    types.push_back({output.get_element_type(), output.get_partial_shape()});
+                }
+                node->revalidate_and_infer_types();
+                for (size_t i = 0; i < types.size(); i++)
+                {
+                    if (node->get_output_element_type(i) != types[i].first ||
+                        !node->get_output_partial_shape(i).same_scheme(types[i].second))
+                    {
+                        // Users come later in the order, so they are revalidated in this loop
+                        for (auto& user : node->get_users())
+                        {
+                            add_work(current, user, positions.at(node.get()));
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+
+        vector<shared_ptr<Node>> parallel_nodes;
+        vector<shared_ptr<Node>> serial_nodes;
+        for (auto& entry : current)
+        {
+            auto& node = entry.second;
+            if (node->is_constant() || node->is_parameter() || node->is_output() ||
+                node->get_users().empty())
+            {
+                continue;
+            }
+            if (is_too_large_to_fold(node))
+            {
+                NGRAPH_DEBUG << "Not folding " << node->get_name()
+                             << " since its result is too large";
+                continue;
+            }
+            // Folding a multi-output node, such as a Split, can build new nodes on the inputs
+            bool parallel =
+                node->get_output_size() == 1 && node->get_control_dependencies().empty();
+            for (auto& value : node->input_values())
+            {
+                parallel = parallel && value.get_node()->is_constant();
+            }
+            (parallel ? parallel_nodes : serial_nodes).push_back(node);
+        }
+        if (m_thread_count == 1 || parallel_nodes.size() < 2)
+        {
+            serial_nodes.insert(serial_nodes.end(), parallel_nodes.begin(), parallel_nodes.end());
+            parallel_nodes.clear();
+            sort(serial_nodes.begin(),
+                 serial_nodes.end(),
+                 [&](const shared_ptr<Node>& a, const shared_ptr<Node>& b) {
+                     return positions.at(a.get()) < positions.at(b.get());
+                 });
+        }
+
+        vector<shared_ptr<Node>> replacements =
+            fold_in_parallel(matchers, parallel_nodes, is_dyn_func);
+        for (size_t i = 0; i < parallel_nodes.size(); i++)
+        {
+            if (replacements[i])
+            {
+                NodeVector users = parallel_nodes[i]->get_users();
+                replace_node(parallel_nodes[i], replacements[i]);
+                add_users(parallel_nodes[i], users);
+                rewritten = true;
+            }
+        }
+
+        for (auto& node : serial_nodes)
+        {
+            NodeVector users = node->get_users();
+            if (!users.empty() && try_fold(matchers, node, is_dyn_func))
+            {
+                add_users(node, users);
+                rewritten = true;
+                is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
+            }
+        }
+    }
+
+    m_matchers.assign(original_matchers.begin(), original_matchers.end());
+    return rewritten;
+}
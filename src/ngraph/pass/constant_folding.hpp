@@ -68,6 +68,7 @@ public:
     {
         m_cfmap = cfmap;
         m_enable_shape_inference = true;
+        init_defaults();
 
         construct_constant_split();
         construct_constant_variadic_split();
@@ -105,6 +106,7 @@ public:
         : GraphRewrite()
     {
         m_cfmap = cfmap;
+        init_defaults();
         for (auto cft : transformations)
         {
             switch (cft)
@@ -144,7 +146,40 @@ public:
         }
     }
 
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+    /// \brief Sets the number of threads that fold independent constant subgraphs. Defaults to
+    ///        NGRAPH_CONSTANT_FOLDING_THREADS, or the number of hardware threads.
+    void set_thread_count(size_t thread_count) { m_thread_count = thread_count; }
+    /// \brief Sets the largest result, in bytes, a fold may produce when it is larger than the
+    ///        fold's inputs, such as a large Broadcast of a small Constant. Defaults to
+    ///        NGRAPH_CONSTANT_FOLDING_MAX_BYTES, or 256 MiB.
+    void set_max_folded_bytes(size_t max_folded_bytes) { m_max_folded_bytes = max_folded_bytes; }
+    /// \brief Sets how many times larger than its inputs the result of a fold may be, once the
+    ///        result is larger than 64 KiB. Zero, the default, sets no limit.
+    void set_max_expansion_ratio(double max_expansion_ratio)
+    {
+        m_max_expansion_ratio = max_expansion_ratio;
+    }
+
+    /// \brief Names of the PassConfig parameters that override the folding limits when the pass
+    ///        is run by a Manager
+    static const char* const s_threads_parameter;
+    static const char* const s_max_folded_bytes_parameter;
+    static const char* const s_max_expansion_ratio_parameter;
+
 private:
+    void init_defaults();
+    void apply_pass_config(const PassConfig& pass_config);
+    bool is_too_large_to_fold(const std::shared_ptr<Node>& node) const;
+    bool try_fold(const std::vector<MatchClosure>& matchers,
+                  const std::shared_ptr<Node>& node,
+                  bool is_dyn_func);
+    std::vector<std::shared_ptr<Node>>
+        fold_in_parallel(const std::vector<MatchClosure>& matchers,
+                         const std::vector<std::shared_ptr<Node>>& nodes,
+                         bool is_dyn_func);
+
     void construct_constant_reshape();
     void construct_constant_broadcast();
     void construct_constant_dyn_broadcast();
@@ -174,4 +209,7 @@ private:
     void construct_constant_one_hot();
 
     ngraph::BuildNodeExecutorMap m_cfmap;
+    size_t m_thread_count;
+    size_t m_max_folded_bytes;
+    double m_max_expansion_ratio;
 };
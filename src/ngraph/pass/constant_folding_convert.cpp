@@ -29,13 +29,19 @@ shared_ptr<op::Constant> fold_constant_convert_helper1(shared_ptr<op::Constant>
                                                        const element::Type& output_element_type)
 {
     const Shape& out_shape = constant->get_shape();
-    runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(TO));
-    TO* data_ptr = buffer.get_ptr<TO>();
+    if (output_element_type == constant->get_element_type())
+    {
+        // Converting to the same type leaves the bytes unchanged, so the data is shared
+        return constant->with_shape(out_shape);
+    }
+
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(out_shape) * sizeof(TO));
+    TO* data_ptr = buffer->get_ptr<TO>();
 
     runtime::reference::convert<TI, TO>(
-        constant->get_vector<TI>().data(), data_ptr, shape_size(out_shape));
+        constant->get_data_ptr<TI>(), data_ptr, shape_size(out_shape));
 
-    return make_shared<op::Constant>(output_element_type, out_shape, data_ptr);
+    return make_shared<op::Constant>(output_element_type, out_shape, buffer);
 }
 
 // Helper for mapping element::Types to runtime::reference::convert, which is templated in C++
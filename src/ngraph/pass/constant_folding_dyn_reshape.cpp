@@ -14,12 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <numeric>
-
 #include "constant_folding.hpp"
 #include "ngraph/op/experimental/dyn_reshape.hpp"
 #include "ngraph/op/reshape.hpp"
-#include "ngraph/runtime/reference/reshape.hpp"
 #include "ngraph/type/element_type.hpp"
 
 using namespace std;
@@ -29,20 +26,8 @@ template <typename T, typename R>
 shared_ptr<op::Constant> fold_constant_dyn_reshape(shared_ptr<op::Constant> constant_data,
                                                    R dyn_reshape)
 {
-    const Shape& out_shape = dyn_reshape->get_shape();
-    runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(T));
-    T* data_ptr = buffer.get_ptr<T>();
-
-    AxisVector input_order(constant_data->get_shape().size());
-    std::iota(input_order.begin(), input_order.end(), 0);
-
-    runtime::reference::reshape<T>(constant_data->get_data_ptr<T>(),
-                                   data_ptr,
-                                   constant_data->get_shape(),
-                                   input_order,
-                                   out_shape);
-
-    return make_shared<op::Constant>(dyn_reshape->get_element_type(), out_shape, data_ptr);
+    // Reshaping in row-major order does not move any elements, so the data is shared
+    return constant_data->with_shape(dyn_reshape->get_shape());
 }
 
 template <typename R>
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cmath>
 #include <unordered_set>
 
 #include "ngraph/pass/core_fusion.hpp"
@@ -28,8 +29,11 @@
 #include "ngraph/op/convert.hpp"
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/divide.hpp"
+#include "ngraph/op/dot.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/fused/conv_fused.hpp"
+#include "ngraph/op/fused/layer_norm.hpp"
+#include "ngraph/op/fused/scale_shift.hpp"
 #include "ngraph/op/fused/softmax_crossentropy.hpp"
 #include "ngraph/op/log.hpp"
 #include "ngraph/op/max.hpp"
@@ -548,6 +552,315 @@ void pass::CoreFusion::construct_conv_affine_folding()
     this->add_matcher(m, callback, PassProperty::REQUIRE_STATIC_SHAPE);
 }
 
+// Gets the per-channel values of `value` as seen at an op whose output has `shape` and its
+// channels on axis 1. `value` must be a constant, possibly reshaped and broadcast, that only
+// varies along the channel axis.
+static bool get_channel_values(const Output<Node>& value,
+                               const Shape& shape,
+                               vector<double>& channel_values)
+{
+    const size_t axis = 1;
+    auto node = value.get_node_shared_ptr();
+    // The shape of the values with the rank of `shape`, 1 where they are broadcast
+    Shape aligned_shape;
+    if (auto broadcast = as_type_ptr<op::Broadcast>(node))
+    {
+        auto arg = broadcast->get_argument(0);
+        aligned_shape = Shape(shape.size(), 1);
+        size_t arg_axis = 0;
+        for (size_t i = 0; i < shape.size(); i++)
+        {
+            if (broadcast->get_broadcast_axes().count(i) == 0)
+            {
+                aligned_shape[i] = arg->get_shape().at(arg_axis++);
+            }
+        }
+        node = arg;
+    }
+    else
+    {
+        // Numpy-style broadcast aligns the trailing axes
+        if (node->get_output_size() != 1 || node->get_shape().size() > shape.size())
+        {
+            return false;
+        }
+        aligned_shape = Shape(shape.size() - node->get_shape().size(), 1);
+        for (size_t dim : node->get_shape())
+        {
+            aligned_shape.push_back(dim);
+        }
+    }
+    // A reshape that does not transpose keeps the order of the values
+    auto reshape = as_type_ptr<op::Reshape>(node);
+    if (reshape && !reshape->get_is_transpose())
+    {
+        node = reshape->get_argument(0);
+    }
+    auto constant = as_type_ptr<op::Constant>(node);
+    if (!constant || aligned_shape.size() <= axis)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < aligned_shape.size(); i++)
+    {
+        if (aligned_shape[i] != 1 && aligned_shape[i] != shape[i])
+        {
+            return false;
+        }
+    }
+
+    vector<double> values = constant->cast_vector<double>();
+    if (values.empty())
+    {
+        return false;
+    }
+    size_t stride = shape_size(Shape(aligned_shape.begin() + axis + 1, aligned_shape.end()));
+    size_t channels = aligned_shape[axis];
+    vector<bool> seen(channels, false);
+    channel_values.assign(channels, 0);
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        size_t channel = (i / stride) % channels;
+        if (!seen[channel])
+        {
+            channel_values[channel] = values[i];
+            seen[channel] = true;
+        }
+        else if (values[i] != channel_values[channel])
+        {
+            return false;
+        }
+    }
+    channel_values.resize(shape[axis], channel_values[0]);
+    return true;
+}
+
+// Gets the values of `value` if it is a constant of shape [channels]
+static bool get_vector_values(const Output<Node>& value,
+                              size_t channels,
+                              vector<double>& vector_values)
+{
+    auto constant = as_type_ptr<op::Constant>(value.get_node_shared_ptr());
+    if (!constant || constant->get_shape() != Shape{channels})
+    {
+        return false;
+    }
+    vector_values = constant->cast_vector<double>();
+    return true;
+}
+
+// Whether `node` is a Convolution, ConvolutionBias without relu or 2-D Dot with constant
+// weights, into which a per-channel scale and shift of its output can be folded
+static bool is_foldable_into_weights(const shared_ptr<Node>& node)
+{
+    auto element_type = node->get_element_type();
+    if ((element_type != element::f32 && element_type != element::f64) ||
+        node->get_output_size() != 1 || node->get_users().size() != 1 ||
+        node->get_output_partial_shape(0).is_dynamic() ||
+        !node->get_argument(1)->is_constant())
+    {
+        return false;
+    }
+    if (is_type<op::Convolution>(node))
+    {
+        return true;
+    }
+    if (auto conv_bias = as_type_ptr<op::ConvolutionBias>(node))
+    {
+        return !conv_bias->with_relu() && conv_bias->get_argument(2)->is_constant();
+    }
+    if (auto dot = as_type_ptr<op::Dot>(node))
+    {
+        return dot->get_reduction_axes_count() == 1 && dot->get_input_shape(0).size() == 2 &&
+               dot->get_input_shape(1).size() == 2;
+    }
+    return false;
+}
+
+// Multiplies the values of `constant` along `axis` by the per-channel `scale`
+static shared_ptr<Node> scale_constant(const shared_ptr<Node>& constant,
+                                       size_t axis,
+                                       const vector<double>& scale)
+{
+    const Shape& shape = constant->get_shape();
+    vector<double> values = static_pointer_cast<op::Constant>(constant)->cast_vector<double>();
+    size_t stride = shape_size(Shape(shape.begin() + axis + 1, shape.end()));
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        values[i] *= scale[(i / stride) % shape[axis]];
+    }
+    return op::Constant::create(constant->get_element_type(), shape, values);
+}
+
+// Replaces `root`, which computes producer * scale + shift per output channel, by `producer`
+// with scaled weights, and the shift folded into its bias or added to its output
+static void fold_into_weights(const shared_ptr<Node>& root,
+                              const shared_ptr<Node>& producer,
+                              const vector<double>& scale,
+                              const vector<double>& shift)
+{
+    auto element_type = producer->get_element_type();
+    const Shape& shape = producer->get_shape();
+    // Dot weights are [K, M] with the output channels on axis 1; filters have them on axis 0
+    size_t weights_axis = is_type<op::Dot>(producer) ? 1 : 0;
+    auto weights = scale_constant(producer->get_argument(1), weights_axis, scale);
+
+    shared_ptr<Node> replacement;
+    if (is_type<op::ConvolutionBias>(producer))
+    {
+        auto bias = scale_constant(producer->get_argument(2), 0, scale);
+        if (!shift.empty())
+        {
+            auto bias_values = static_pointer_cast<op::Constant>(bias)->cast_vector<double>();
+            for (size_t c = 0; c < bias_values.size(); c++)
+            {
+                bias_values[c] += shift[c];
+            }
+            bias = op::Constant::create(element_type, bias->get_shape(), bias_values);
+        }
+        replacement =
+            producer->copy_with_new_inputs({producer->input_value(0), weights, bias});
+    }
+    else
+    {
+        replacement = producer->copy_with_new_inputs({producer->input_value(0), weights});
+        if (any_of(shift.begin(), shift.end(), [](double value) { return value != 0; }))
+        {
+            AxisSet broadcast_axes;
+            for (size_t i = 0; i < shape.size(); i++)
+            {
+                if (i != 1)
+                {
+                    broadcast_axes.insert(i);
+                }
+            }
+            auto bias = op::Constant::create(element_type, Shape{shape[1]}, shift);
+            replacement = replacement + make_shared<op::Broadcast>(bias, shape, broadcast_axes);
+        }
+    }
+    replace_node(root, replacement);
+}
+
+void pass::CoreFusion::construct_batch_norm_weight_folding()
+{
+    // BatchNormInference(gamma, beta, Conv|ConvBias|Dot(input, W), mean, var) with constant
+    // parameters -> Conv|ConvBias|Dot(input, W * s) + (beta - mean * s), where
+    // s = gamma / sqrt(var + eps)
+    Shape shape{2, 2, 1, 1};
+    auto producer = make_shared<pattern::op::Label>(element::f32, shape, is_foldable_into_weights);
+    auto gamma = make_shared<pattern::op::Label>(element::f32, Shape{2});
+    auto beta = make_shared<pattern::op::Label>(element::f32, Shape{2});
+    auto mean = make_shared<pattern::op::Label>(element::f32, Shape{2});
+    auto var = make_shared<pattern::op::Label>(element::f32, Shape{2});
+    auto bn = make_shared<op::BatchNormInference>(0.001, gamma, beta, producer, mean, var);
+
+    auto callback = [producer, gamma, beta, mean, var](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for batch norm weight folding against node = "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+        auto m_bn = static_pointer_cast<op::BatchNormInference>(m.get_match_root());
+        auto m_producer = pattern_map[producer];
+
+        size_t channels = m_producer->get_shape().at(1);
+        vector<double> gamma_values;
+        vector<double> beta_values;
+        vector<double> mean_values;
+        vector<double> var_values;
+        if (!get_vector_values(pattern_map[gamma], channels, gamma_values) ||
+            !get_vector_values(pattern_map[beta], channels, beta_values) ||
+            !get_vector_values(pattern_map[mean], channels, mean_values) ||
+            !get_vector_values(pattern_map[var], channels, var_values))
+        {
+            return false;
+        }
+
+        double eps = m_bn->get_eps_value();
+        vector<double> scale(gamma_values.size());
+        vector<double> shift(gamma_values.size());
+        for (size_t c = 0; c < scale.size(); c++)
+        {
+            scale[c] = gamma_values[c] / sqrt(var_values[c] + eps);
+            shift[c] = beta_values[c] - mean_values[c] * scale[c];
+        }
+        fold_into_weights(m_bn, m_producer, scale, shift);
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(bn, "CoreFusion.BatchNormWeightFolding");
+    this->add_matcher(m, callback, PassProperty::REQUIRE_STATIC_SHAPE);
+}
+
+void pass::CoreFusion::construct_scale_shift_weight_folding()
+{
+    // ScaleShift(Conv|ConvBias|Dot(input, W), a, b) with per-channel constants a and b
+    // -> Conv|ConvBias|Dot(input, W * a) + b
+    Shape shape{2, 2, 1, 1};
+    auto producer = make_shared<pattern::op::Label>(element::f32, shape, is_foldable_into_weights);
+    auto scale = make_shared<pattern::op::Label>(element::f32, shape);
+    auto shift = make_shared<pattern::op::Label>(element::f32, shape);
+    auto scale_shift = make_shared<op::ScaleShift>(producer, scale, shift);
+
+    auto callback = [producer, scale, shift](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for scale shift weight folding against node = "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+        auto m_producer = pattern_map[producer];
+        const Shape& shape = m_producer->get_shape();
+        // The scale and shift must not broadcast the output to a larger shape
+        if (m.get_match_root()->get_shape() != shape)
+        {
+            return false;
+        }
+
+        vector<double> scale_values;
+        vector<double> shift_values;
+        if (!get_channel_values(pattern_map[scale], shape, scale_values) ||
+            !get_channel_values(pattern_map[shift], shape, shift_values))
+        {
+            return false;
+        }
+        fold_into_weights(m.get_match_root(), m_producer, scale_values, shift_values);
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(scale_shift, "CoreFusion.ScaleShiftWeightFolding");
+    this->add_matcher(m, callback, PassProperty::REQUIRE_STATIC_SHAPE);
+}
+
+void pass::CoreFusion::construct_multiply_weight_folding()
+{
+    // Conv|ConvBias|Dot(input, W) * a with a per-channel constant a
+    // -> Conv|ConvBias|Dot(input, W * a). A following Add of a per-channel constant is left
+    // to the bias fusions.
+    Shape shape{2, 2, 1, 1};
+    auto producer = make_shared<pattern::op::Label>(element::f32, shape, is_foldable_into_weights);
+    auto scale = make_shared<pattern::op::Label>(element::f32, shape);
+    auto multiply = make_shared<op::Multiply>(producer, scale);
+
+    auto callback = [producer, scale](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for multiply weight folding against node = "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+        auto m_producer = pattern_map[producer];
+        const Shape& shape = m_producer->get_shape();
+        if (m.get_match_root()->get_shape() != shape)
+        {
+            return false;
+        }
+
+        vector<double> scale_values;
+        if (!get_channel_values(pattern_map[scale], shape, scale_values))
+        {
+            return false;
+        }
+        fold_into_weights(m.get_match_root(), m_producer, scale_values, {});
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(multiply, "CoreFusion.MultiplyWeightFolding");
+    this->add_matcher(m, callback, PassProperty::REQUIRE_STATIC_SHAPE);
+}
+
 static bool is_trivial_convolution(shared_ptr<op::Convolution> conv, bool skip_pad_checks = false)
 {
     Strides stride_1{1, 1};
@@ -910,6 +1223,63 @@ void pass::CoreFusion::construct_reshape_softmax_reshape()
     this->add_matcher(m, callback, PassProperty::REQUIRE_STATIC_SHAPE);
 }
 
+void pass::CoreFusion::construct_softmax()
+{
+    // exp(x - max(x)) / sum(exp(x - max(x))) with all reductions and broadcasts over the same axes
+    Shape shape{2, 3};
+    auto input = make_shared<pattern::op::Label>(element::f32, shape);
+    auto max = make_shared<op::Max>(input, AxisSet{1});
+    auto max_label = make_shared<pattern::op::Label>(max, nullptr, NodeVector{max});
+    auto broadcast_max = make_shared<op::Broadcast>(max_label, shape, AxisSet{1});
+    auto broadcast_max_label =
+        make_shared<pattern::op::Label>(broadcast_max, nullptr, NodeVector{broadcast_max});
+    auto exp = make_shared<op::Exp>(make_shared<op::Subtract>(input, broadcast_max_label));
+    auto exp_label = make_shared<pattern::op::Label>(exp, nullptr, NodeVector{exp});
+    auto sum = make_shared<op::Sum>(exp_label, AxisSet{1});
+    auto sum_label = make_shared<pattern::op::Label>(sum, nullptr, NodeVector{sum});
+    auto broadcast_sum = make_shared<op::Broadcast>(sum_label, shape, AxisSet{1});
+    auto broadcast_sum_label =
+        make_shared<pattern::op::Label>(broadcast_sum, nullptr, NodeVector{broadcast_sum});
+    auto divide = make_shared<op::Divide>(exp_label, broadcast_sum_label);
+
+    auto callback =
+        [input, max_label, broadcast_max_label, exp_label, sum_label, broadcast_sum_label](
+            pattern::Matcher& m) {
+            NGRAPH_DEBUG << "In a callback for construct_softmax against "
+                         << m.get_match_root()->get_name();
+
+            auto pattern_map = m.get_pattern_map();
+            auto max_m = static_pointer_cast<op::Max>(pattern_map[max_label]);
+            auto broadcast_max_m =
+                static_pointer_cast<op::Broadcast>(pattern_map[broadcast_max_label]);
+            auto sum_m = static_pointer_cast<op::Sum>(pattern_map[sum_label]);
+            auto broadcast_sum_m =
+                static_pointer_cast<op::Broadcast>(pattern_map[broadcast_sum_label]);
+
+            const auto& axes = sum_m->get_reduction_axes();
+            if (axes.empty() || max_m->get_reduction_axes() != axes ||
+                broadcast_max_m->get_broadcast_axes() != axes ||
+                broadcast_sum_m->get_broadcast_axes() != axes)
+            {
+                NGRAPH_DEBUG << "the reductions and broadcasts are not over the same axes";
+                return false;
+            }
+
+            if (pattern_map[exp_label]->get_users().size() != 2)
+            {
+                NGRAPH_DEBUG << "exp is used outside of the softmax";
+                return false;
+            }
+
+            auto softmax = make_shared<op::Softmax>(pattern_map[input], axes);
+            replace_node(m.get_match_root(), softmax);
+            return true;
+        };
+
+    auto m = make_shared<pattern::Matcher>(divide, "CoreFusion.Softmax");
+    this->add_matcher(m, callback, PassProperty::REQUIRE_STATIC_SHAPE);
+}
+
 static bool
     zero_padded_conv_consistency_check(const std::shared_ptr<ngraph::Node>& match_root,
                                        const std::shared_ptr<ngraph::op::Constant>& pad_value_op,
@@ -1334,3 +1704,154 @@ void pass::CoreFusion::construct_conv_bias_add()
     auto m = std::make_shared<pattern::Matcher>(padd, "CoreFusion.ConvBiasAdd");
     this->add_matcher(m, callback, all_pass_property_off);
 }
+
+void pass::CoreFusion::construct_layer_norm()
+{
+    // (x - mean) / sqrt(variance + eps) * gamma + beta, where the mean and the biased variance
+    // are reduced over the trailing axes and gamma and beta are broadcast along the others
+    Shape shape{2, 4};
+    auto input = make_shared<pattern::op::Label>(element::f32, shape);
+    auto is_constant = pattern::has_class<op::Constant>();
+    auto is_broadcast = pattern::has_class<op::Broadcast>();
+
+    auto mean_count = make_shared<pattern::op::Label>(element::f32, Shape{2}, is_constant);
+    auto mean_sum = make_shared<op::Sum>(input, AxisSet{1});
+    auto mean_sum_label = make_shared<pattern::op::Label>(mean_sum, nullptr, NodeVector{mean_sum});
+    auto mean = make_shared<op::Divide>(mean_sum_label,
+                                        make_shared<pattern::op::Skip>(mean_count, is_broadcast));
+    auto broadcast_mean = make_shared<op::Broadcast>(mean, shape, AxisSet{1});
+    auto broadcast_mean_label =
+        make_shared<pattern::op::Label>(broadcast_mean, nullptr, NodeVector{broadcast_mean});
+    auto diff = make_shared<op::Subtract>(input, broadcast_mean_label);
+    auto diff_label = make_shared<pattern::op::Label>(diff, nullptr, NodeVector{diff});
+
+    auto variance_count = make_shared<pattern::op::Label>(element::f32, Shape{2}, is_constant);
+    auto variance_sum = make_shared<op::Sum>(make_shared<op::Multiply>(diff_label, diff_label),
+                                             AxisSet{1});
+    auto variance_sum_label =
+        make_shared<pattern::op::Label>(variance_sum, nullptr, NodeVector{variance_sum});
+    auto variance = make_shared<op::Divide>(
+        variance_sum_label, make_shared<pattern::op::Skip>(variance_count, is_broadcast));
+
+    auto epsilon = make_shared<pattern::op::Label>(element::f32, Shape{2}, is_constant);
+    auto stddev = make_shared<op::Sqrt>(
+        make_shared<op::Add>(variance, make_shared<pattern::op::Skip>(epsilon, is_broadcast)));
+    auto broadcast_stddev = make_shared<op::Broadcast>(stddev, shape, AxisSet{1});
+    auto broadcast_stddev_label =
+        make_shared<pattern::op::Label>(broadcast_stddev, nullptr, NodeVector{broadcast_stddev});
+    auto norm = make_shared<op::Divide>(diff_label, broadcast_stddev_label);
+
+    auto gamma = make_shared<pattern::op::Label>(element::f32, Shape{4});
+    auto broadcast_gamma = make_shared<op::Broadcast>(gamma, shape, AxisSet{0});
+    auto broadcast_gamma_label =
+        make_shared<pattern::op::Label>(broadcast_gamma, nullptr, NodeVector{broadcast_gamma});
+    auto beta = make_shared<pattern::op::Label>(element::f32, Shape{4});
+    auto broadcast_beta = make_shared<op::Broadcast>(beta, shape, AxisSet{0});
+    auto broadcast_beta_label =
+        make_shared<pattern::op::Label>(broadcast_beta, nullptr, NodeVector{broadcast_beta});
+    auto layer_norm = make_shared<op::Add>(make_shared<op::Multiply>(norm, broadcast_gamma_label),
+                                           broadcast_beta_label);
+
+    auto callback = [input,
+                     mean_count,
+                     mean_sum_label,
+                     broadcast_mean_label,
+                     variance_count,
+                     variance_sum_label,
+                     epsilon,
+                     broadcast_stddev_label,
+                     gamma,
+                     broadcast_gamma_label,
+                     beta,
+                     broadcast_beta_label](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_layer_norm against "
+                     << m.get_match_root()->get_name();
+
+        auto pattern_map = m.get_pattern_map();
+        auto input_m = pattern_map[input];
+        const auto& shape = input_m->get_shape();
+        if (!input_m->get_element_type().is_real())
+        {
+            NGRAPH_DEBUG << "layer norm needs a floating point input";
+            return false;
+        }
+
+        // The normalized axes must be the trailing ones, starting from begin_norm_axis
+        const auto& norm_axes =
+            static_pointer_cast<op::Sum>(pattern_map[mean_sum_label])->get_reduction_axes();
+        if (norm_axes.empty() || *norm_axes.begin() == 0 ||
+            *norm_axes.begin() + norm_axes.size() != shape.size())
+        {
+            NGRAPH_DEBUG << "layer norm must normalize over the trailing axes";
+            return false;
+        }
+        size_t begin_norm_axis = *norm_axes.begin();
+        AxisSet outer_axes;
+        size_t count = 1;
+        for (size_t i = 0; i < shape.size(); i++)
+        {
+            if (i < begin_norm_axis)
+            {
+                outer_axes.insert(i);
+            }
+            else
+            {
+                count *= shape[i];
+            }
+        }
+
+        auto broadcast_axes = [&pattern_map](const shared_ptr<pattern::op::Label>& label) {
+            return static_pointer_cast<op::Broadcast>(pattern_map[label])->get_broadcast_axes();
+        };
+        if (static_pointer_cast<op::Sum>(pattern_map[variance_sum_label])
+                    ->get_reduction_axes() != norm_axes ||
+            broadcast_axes(broadcast_mean_label) != norm_axes ||
+            broadcast_axes(broadcast_stddev_label) != norm_axes ||
+            broadcast_axes(broadcast_gamma_label) != outer_axes ||
+            broadcast_axes(broadcast_beta_label) != outer_axes)
+        {
+            NGRAPH_DEBUG << "the reductions and broadcasts of layer norm do not line up";
+            return false;
+        }
+
+        // The constants must be uniform and the counts must match the normalized size
+        for (auto label : {mean_count, variance_count, epsilon})
+        {
+            if (!static_pointer_cast<op::Constant>(pattern_map[label])
+                     ->get_all_data_elements_bitwise_identical())
+            {
+                NGRAPH_DEBUG << "layer norm constants must be uniform";
+                return false;
+            }
+        }
+        auto constant_value = [&pattern_map](const shared_ptr<pattern::op::Label>& label) {
+            return static_pointer_cast<op::Constant>(pattern_map[label])
+                ->cast_vector<double>()
+                .at(0);
+        };
+        if (static_cast<size_t>(constant_value(mean_count)) != count ||
+            static_cast<size_t>(constant_value(variance_count)) != count)
+        {
+            NGRAPH_DEBUG << "the mean and variance of layer norm must divide by "
+                         << "the normalized size";
+            return false;
+        }
+
+        auto gamma_m = pattern_map[gamma];
+        auto beta_m = pattern_map[beta];
+        auto norm_shape = Shape(shape.begin() + begin_norm_axis, shape.end());
+        if (gamma_m->get_shape() != norm_shape || beta_m->get_shape() != norm_shape)
+        {
+            NGRAPH_DEBUG << "gamma and beta must have the normalized shape";
+            return false;
+        }
+
+        auto layer_norm = make_shared<op::LayerNorm>(
+            input_m, gamma_m, beta_m, false, begin_norm_axis, constant_value(epsilon));
+        replace_node(m.get_match_root(), layer_norm);
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(layer_norm, "CoreFusion.LayerNorm");
+    this->add_matcher(m, callback, PassProperty::REQUIRE_STATIC_SHAPE);
+}
@@ -37,11 +37,15 @@ public:
             construct_relu();
             construct_folded_batch_norm();
             construct_conv_affine_folding();
+            construct_batch_norm_weight_folding();
+            construct_scale_shift_weight_folding();
+            construct_multiply_weight_folding();
             construct_sigmoid();
             construct_sigmoid_bprop();
             construct_optimized_strided_conv();
             construct_reshape_broadcast();
             construct_reshape_softmax_reshape();
+            construct_softmax();
             construct_zero_padded_reshaped_conv();
             construct_zero_padded_conv();
             construct_zero_padded_conv_backprop_filters();
@@ -57,21 +61,27 @@ public:
         {
             construct_conv_bias();
             construct_conv_bias_add();
+            construct_layer_norm();
         }
     }
     void construct_relu();
     void construct_folded_batch_norm();
     void construct_conv_affine_folding();
+    void construct_batch_norm_weight_folding();
+    void construct_scale_shift_weight_folding();
+    void construct_multiply_weight_folding();
     void construct_sigmoid();
     void construct_sigmoid_bprop();
     void construct_optimized_strided_conv();
     void construct_reshape_broadcast();
     void construct_reshape_softmax_reshape();
+    void construct_softmax();
     void construct_zero_padded_reshaped_conv();
     void construct_zero_padded_conv();
     void construct_zero_padded_conv_backprop_filters();
     void construct_conv_bias();
     void construct_conv_bias_add();
+    void construct_layer_norm();
     void construct_softmax_cross_entropy_fprop();
     void construct_softmax_cross_entropy_bprop_with_soft_labels();
     void construct_softmax_cross_entropy_bprop_with_ignore_mask();
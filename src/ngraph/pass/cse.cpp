@@ -14,12 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
 #include <memory>
 #include <set>
+#include <sstream>
 #include <typeinfo>
 #include <unordered_map>
 
 #include "cse.hpp"
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
@@ -207,50 +210,206 @@ static unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node
          {TI(op::Broadcast), cse_broadcast}});
 }
 
-static unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>
+static const unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>
     ops_to_cse_handlers = initialize_ops_to_cse_handlers();
 
+namespace
+{
+    /// Collects the attributes visited by Node::visit_attributes into a string that is the same
+    /// for two nodes exactly when their attributes are equal.
+    class AttributeSignature : public AttributeVisitor
+    {
+    public:
+        void on_attribute(const string& name, string& value) override
+        {
+            add_name(name);
+            m_signature << value.size() << ':' << value;
+        }
+        void on_attribute(const string& name, bool& value) override
+        {
+            add_name(name);
+            m_signature << value;
+        }
+        void on_adapter(const string& name, ValueAccessor<void>& adapter) override
+        {
+            add_name(name);
+            if (auto a = dynamic_cast<AttributeAdapter<element::Type>*>(&adapter))
+            {
+                m_signature << static_cast<element::Type&>(*a);
+            }
+            else if (auto a = dynamic_cast<AttributeAdapter<PartialShape>*>(&adapter))
+            {
+                m_signature << static_cast<PartialShape&>(*a);
+            }
+            else if (auto a = dynamic_cast<AttributeAdapter<op::AutoBroadcastSpec>*>(&adapter))
+            {
+                const op::AutoBroadcastSpec& spec = *a;
+                m_signature << static_cast<int>(spec.m_type) << ',' << spec.m_axis;
+            }
+            else
+            {
+                // An attribute we cannot compare
+                m_complete = false;
+            }
+        }
+        void on_adapter(const string& name, ValueAccessor<string>& adapter) override
+        {
+            string value = adapter.get();
+            on_attribute(name, value);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int64_t>>& adapter) override
+        {
+            add_name(name);
+            for (int64_t value : adapter.get())
+            {
+                m_signature << value << ',';
+            }
+        }
+        void on_adapter(const string& name, ValueAccessor<int64_t>& adapter) override
+        {
+            add_name(name);
+            m_signature << adapter.get();
+        }
+        void on_adapter(const string& name, ValueAccessor<double>& adapter) override
+        {
+            // Compare the bits, so that -0.0 and NaN attributes are not merged with other values
+            add_name(name);
+            double value = adapter.get();
+            uint64_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            m_signature << bits;
+        }
+
+        bool is_complete() const { return m_complete; }
+        string get_signature() const { return m_signature.str(); }
+
+    private:
+        void add_name(const string& name) { m_signature << ';' << name << '='; }
+        stringstream m_signature;
+        bool m_complete{true};
+    };
+
+    size_t hash_constant_data(const op::Constant& constant)
+    {
+        size_t size = shape_size(constant.get_shape()) * constant.get_element_type().size();
+        const char* data = static_cast<const char*>(constant.get_data_ptr());
+        // FNV-1a over 8 byte words, then over the remaining bytes
+        uint64_t hash = 14695981039346656037ULL;
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+        {
+            uint64_t word;
+            memcpy(&word, data + i, sizeof(word));
+            hash = (hash ^ word) * 1099511628211ULL;
+        }
+        for (; i < size; i++)
+        {
+            hash = (hash ^ static_cast<unsigned char>(data[i])) * 1099511628211ULL;
+        }
+        return static_cast<size_t>(hash);
+    }
+}
+
+using CSEHandler = function<bool(shared_ptr<Node>, shared_ptr<Node>)>;
+
+/// A node and what identifies the value it computes: its type, its inputs and either a handler
+/// comparing it with other nodes of the same type or the signature of its attributes.
 class NodeKey
 {
 public:
-    NodeKey(const shared_ptr<Node>& n,
-            unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>&
-                backend_handlers)
+    NodeKey(const shared_ptr<Node>& n, unordered_map<type_index, CSEHandler>& backend_handlers)
         : m_node(n)
-        , m_node_ref(*n)
-        , m_ti(TI(m_node_ref))
-        , m_backend_handlers(backend_handlers)
+        , m_ti(TI(*n))
     {
+        auto eh = ops_to_cse_handlers.find(m_ti);
+        if (eh != ops_to_cse_handlers.end())
+        {
+            m_handler = &eh->second;
+        }
+        else
+        {
+            eh = backend_handlers.find(m_ti);
+            if (eh != backend_handlers.end())
+            {
+                m_handler = &eh->second;
+            }
+        }
+
+        // Nodes with state or control dependencies compute more than the value of their inputs
+        if (!m_handler && !n->has_state() && n->get_control_dependencies().empty())
+        {
+            AttributeSignature visitor;
+            m_has_signature = n->visit_attributes(visitor) && visitor.is_complete();
+            m_signature = visitor.get_signature();
+        }
+
+        vector<size_t> hash_values{hash<type_index>{}(m_ti)};
+        if (auto constant = as_type_ptr<op::Constant>(n))
+        {
+            hash_values.push_back(hash_constant_data(*constant));
+        }
+        else
+        {
+            hash_values.push_back(hash<string>{}(m_signature));
+        }
+        vector<Output<Node>> cargs = get_canonical_inputs();
+        for (auto& arg : cargs)
+        {
+            hash_values.push_back(arg.get_node()->get_instance_id());
+            hash_values.push_back(arg.get_index());
+        }
+        m_hash = hash_combine(hash_values);
     }
 
     shared_ptr<Node> get_node() const { return m_node; }
+    size_t get_hash() const { return m_hash; }
+    /// \returns true if this node can be compared with other nodes
+    bool is_comparable() const { return m_handler || m_has_signature; }
     bool operator==(const NodeKey& other) const
     {
-        if (m_ti == other.m_ti)
+        if (m_ti != other.m_ti || m_hash != other.m_hash)
         {
-            auto eh = ops_to_cse_handlers.find(m_ti);
-            if (eh != ops_to_cse_handlers.end())
-            {
-                return eh->second(m_node, other.m_node);
-            }
-
-            eh = m_backend_handlers.find(m_ti);
-            if (eh != m_backend_handlers.end())
+            return false;
+        }
+        if (m_handler)
+        {
+            return (*m_handler)(m_node, other.m_node);
+        }
+        if (!m_has_signature || !other.m_has_signature || m_signature != other.m_signature ||
+            get_canonical_inputs() != other.get_canonical_inputs())
+        {
+            return false;
+        }
+        // Attribute visitors may not cover every attribute, so also check the inferred types
+        for (size_t i = 0; i < m_node->get_output_size(); i++)
+        {
+            if (m_node->get_output_element_type(i) != other.m_node->get_output_element_type(i) ||
+                !m_node->get_output_partial_shape(i).same_scheme(
+                    other.m_node->get_output_partial_shape(i)))
             {
-                return eh->second(m_node, other.m_node);
+                return false;
             }
         }
-
-        return false;
+        return m_node->get_output_size() == other.m_node->get_output_size();
     }
 
 private:
+    vector<Output<Node>> get_canonical_inputs() const
+    {
+        vector<Output<Node>> cargs = m_node->input_values();
+        if (m_node->is_commutative())
+        {
+            sort(begin(cargs), end(cargs));
+        }
+        return cargs;
+    }
+
     shared_ptr<Node> m_node;
-    // m_node_ref is only to allow getting the type_index in the ctor
-    Node& m_node_ref;
     std::type_index m_ti;
-    unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>&
-        m_backend_handlers;
+    const CSEHandler* m_handler{nullptr};
+    bool m_has_signature{false};
+    string m_signature;
+    size_t m_hash;
 };
 
 namespace std
@@ -258,40 +417,7 @@ namespace std
     template <>
     struct hash<NodeKey>
     {
-        size_t operator()(const NodeKey& k) const
-        {
-            Node& p_this = *k.get_node().get();
-            auto ti = TI(p_this);
-
-            hash<type_index> type_hash_compute{};
-            auto type_hash = type_hash_compute(ti);
-
-            vector<size_t> arg_ids;
-
-            arg_ids.push_back(type_hash);
-
-            std::vector<Output<Node>> cargs;
-            for (auto input : k.get_node()->inputs())
-            {
-                cargs.push_back(input.get_source_output());
-            }
-
-            // TODO: Do we need another map, so we could
-            // specify how to compute hash for each op?
-            if (p_this.is_commutative())
-            {
-                sort(begin(cargs), end(cargs));
-            }
-
-            for (auto arg : cargs)
-            {
-                arg_ids.push_back(arg.get_node_shared_ptr()->get_instance_id());
-                arg_ids.push_back(arg.get_index());
-            }
-
-            auto hashc = ngraph::hash_combine(arg_ids);
-            return hashc;
-        }
+        size_t operator()(const NodeKey& k) const { return k.get_hash(); }
     };
 }
 
@@ -308,6 +434,10 @@ bool ngraph::pass::CommonSubexpressionElimination::run_on_function(shared_ptr<ng
         }
 
         NodeKey n_key(n, m_backend_cse_handlers);
+        if (!n_key.is_comparable())
+        {
+            continue;
+        }
         if (expressions.count(n_key))
         {
             ngraph::replace_node(n, expressions.at(n_key));
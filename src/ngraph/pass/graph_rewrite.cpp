@@ -15,8 +15,11 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <iomanip>
 #include <iostream>
 #include <regex>
+#include <typeindex>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -59,9 +62,68 @@ using namespace ngraph;
 // c) there's no linear order of fusions which will give
 //    the correct final fusion. i.e. the same fusion needs to occur before and after some other
 //    fusion
+//
+// A matcher can only match a node of the same type as the root of its pattern, unless the root
+// is a pattern op such as Label or Any. Matchers are indexed by root type, so each node is only
+// offered to the matchers of its own type and to the wildcard ones, in registration order.
+
+namespace
+{
+    class MatcherIndex
+    {
+    public:
+        template <typename T>
+        MatcherIndex(const vector<T>& closures)
+        {
+            for (size_t i = 0; i < closures.size(); i++)
+            {
+                auto& matcher = *closures[i].matcher;
+                auto pattern = matcher.get_pattern();
+                // Subclasses of Matcher may override match_node, so they can match any node
+                if (typeid(matcher) == typeid(pattern::Matcher) &&
+                    !dynamic_pointer_cast<pattern::op::Pattern>(pattern))
+                {
+                    m_typed[type_index(typeid(*pattern))].push_back(i);
+                }
+                else
+                {
+                    m_wildcard.push_back(i);
+                }
+            }
+        }
+
+        /// Indices of the matchers that may match node, in registration order
+        const vector<size_t>& get_candidates(const Node& node)
+        {
+            auto it = m_typed.find(type_index(typeid(node)));
+            if (it == m_typed.end())
+            {
+                return m_wildcard;
+            }
+            if (m_wildcard.empty())
+            {
+                return it->second;
+            }
+            m_candidates.clear();
+            merge(it->second.begin(),
+                  it->second.end(),
+                  m_wildcard.begin(),
+                  m_wildcard.end(),
+                  back_inserter(m_candidates));
+            return m_candidates;
+        }
+
+    private:
+        unordered_map<type_index, vector<size_t>> m_typed;
+        vector<size_t> m_wildcard;
+        vector<size_t> m_candidates;
+    };
+}
 
 bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 {
+    static const bool s_profile_enabled = getenv("NGRAPH_PROFILE_PASS_ENABLE") != nullptr;
+    bool profile = m_matcher_profiling || s_profile_enabled;
     bool rewritten = false;
     const size_t NUM_TRIES = 10;
     size_t tries = NUM_TRIES;
@@ -78,14 +140,22 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // that need multiple passes. See comments above.
         vector<MatchClosure> matchers_to_run{m_matchers};
         m_matchers.clear();
+        MatcherIndex index(matchers_to_run);
+        // Failed sub-matches are remembered until the graph changes. Shape inference may
+        // change the nodes as the run goes, so it rules memoization out.
+        for (auto& closure : matchers_to_run)
+        {
+            closure.matcher->set_memoization(!m_enable_shape_inference);
+        }
         for (auto node : f->get_ordered_ops())
         {
             if (m_enable_shape_inference)
             {
                 node->revalidate_and_infer_types();
             }
-            for (auto& closure : matchers_to_run)
+            for (size_t i : index.get_candidates(*node))
             {
+                auto& closure = matchers_to_run[i];
                 if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
                 {
                     NGRAPH_DEBUG << "matcher callback requires static shape but the "
@@ -97,13 +167,38 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
                 NGRAPH_DEBUG << "Running matcher " << closure.matcher->get_name() << "("
                              << closure.matcher->get_pattern()->get_name() << ") on "
                              << node->get_name();
-                if (closure.matcher->match(node))
+                MatcherStats* stats = nullptr;
+                stopwatch timer;
+                auto matcher_stats = closure.matcher->get_statistics();
+                if (profile)
+                {
+                    stats = &m_matcher_stats[closure.matcher->get_name()];
+                    stats->attempts++;
+                    timer.start();
+                }
+                bool matched = closure.matcher->match(node);
+                bool replaced = matched && closure.callback(*closure.matcher.get());
+                if (stats)
+                {
+                    timer.stop();
+                    stats->nanoseconds += timer.get_nanoseconds();
+                    stats->matches += matched;
+                    stats->rewrites += replaced;
+                    auto& after = closure.matcher->get_statistics();
+                    stats->node_visits += after.node_visits - matcher_stats.node_visits;
+                    stats->memo_hits += after.memo_hits - matcher_stats.memo_hits;
+                }
+                if (matched)
                 {
                     NGRAPH_DEBUG << "Matcher " << closure.matcher << closure.matcher->get_name()
                                  << " matched " << node->get_name();
-                    if (closure.callback(*closure.matcher.get()))
+                    if (replaced)
                     {
                         rewritten = true;
+                        for (auto& other : matchers_to_run)
+                        {
+                            other.matcher->clear_memo();
+                        }
                         // If call back may change function's is_dynamic state, we need to
                         // update the cached value.
                         if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
@@ -115,9 +210,24 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
                 }
             }
         }
-
+        for (auto& closure : matchers_to_run)
+        {
+            closure.matcher->set_memoization(false);
+        }
     } while (rewritten && m_matchers.size() > 0 && tries--);
 
+    if (s_profile_enabled)
+    {
+        for (auto& entry : m_matcher_stats)
+        {
+            cout << setw(7) << entry.second.nanoseconds / 1000 << "us " << entry.first << " ("
+                 << entry.second.attempts << " attempts, " << entry.second.matches
+                 << " matches, " << entry.second.rewrites << " rewrites, "
+                 << entry.second.node_visits << " node visits, " << entry.second.memo_hits
+                 << " memo hits)\n";
+        }
+    }
+
     m_matchers.assign(original_matchers.begin(), original_matchers.end());
     return (NUM_TRIES - tries) > 1; // this means a graph was transformed
 }
@@ -205,20 +315,31 @@ void pass::RecurrentGraphRewrite::add_matcher(
 
 bool pass::RecurrentGraphRewrite::run_on_function(shared_ptr<Function> f)
 {
+    static const bool s_profile_enabled = getenv("NGRAPH_PROFILE_PASS_ENABLE") != nullptr;
+    bool profile = m_matcher_profiling || s_profile_enabled;
     bool changed = false;
     size_t i = 0;
+    m_matcher_stats.resize(m_matchers.size());
 
     // This check is very expensive and is only needed for experimental features, so we will hide
     // it behind an environment variable for now. TODO: Find a less expensive way to handle this.
     static bool s_rerun_dynamic_check =
         (std::getenv("NGRAPH_GRAPH_REWRITE_RERUN_DYNAMIC_CHECK") != nullptr);
 
+    // Every node of a chain of cells is tried as a root, so cells are cached until the graph
+    // changes; otherwise each cell would be matched once for every cell above it
+    for (auto& closure : m_matchers)
+    {
+        closure.matcher->set_memoization(true);
+    }
+
     auto run_matchers = [&]() -> bool {
         bool is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
         for (auto node : f->get_ops())
         {
-            for (auto& closure : m_matchers)
+            for (size_t index = 0; index < m_matchers.size(); index++)
             {
+                auto& closure = m_matchers[index];
                 if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
                 {
                     NGRAPH_DEBUG << "matcher callback requires static shape but the "
@@ -228,12 +349,40 @@ bool pass::RecurrentGraphRewrite::run_on_function(shared_ptr<Function> f)
                     continue;
                 }
                 NGRAPH_DEBUG << "Running matcher " << closure.matcher << " on " << node->get_name();
-                if (closure.matcher->match(node))
+                GraphRewrite::MatcherStats* stats = nullptr;
+                stopwatch timer;
+                auto matcher_stats = closure.matcher->get_statistics();
+                if (profile)
+                {
+                    stats = &m_matcher_stats[index];
+                    stats->attempts++;
+                    timer.start();
+                }
+                bool matched = closure.matcher->match(node);
+                bool replaced = matched && closure.callback(*closure.matcher.get());
+                if (stats)
+                {
+                    timer.stop();
+                    auto after = closure.matcher->get_statistics();
+                    stats->nanoseconds += timer.get_nanoseconds();
+                    stats->matches += matched;
+                    stats->rewrites += replaced;
+                    stats->node_visits +=
+                        after.cell_matcher.node_visits - matcher_stats.cell_matcher.node_visits;
+                    stats->memo_hits += after.cell_cache_hits - matcher_stats.cell_cache_hits +
+                                        after.cell_matcher.memo_hits -
+                                        matcher_stats.cell_matcher.memo_hits;
+                }
+                if (matched)
                 {
                     NGRAPH_DEBUG << "Matcher " << closure.matcher << " matched "
                                  << node->get_name();
-                    if (closure.callback(*closure.matcher.get()))
+                    if (replaced)
                     {
+                        for (auto& other : m_matchers)
+                        {
+                            other.matcher->clear_memo();
+                        }
                         // If call back may change function's is_dynamic state, we need to
                         // update the cached value.
                         if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
@@ -253,5 +402,22 @@ bool pass::RecurrentGraphRewrite::run_on_function(shared_ptr<Function> f)
         changed = run_matchers();
         i++;
     } while (changed && i < m_num_iters);
+
+    for (auto& closure : m_matchers)
+    {
+        closure.matcher->set_memoization(false);
+    }
+
+    if (s_profile_enabled)
+    {
+        for (size_t index = 0; index < m_matcher_stats.size(); index++)
+        {
+            auto& entry = m_matcher_stats[index];
+            cout << setw(7) << entry.nanoseconds / 1000 << "us recurrent matcher " << index
+                 << " (" << entry.attempts << " attempts, " << entry.matches << " matches, "
+                 << entry.rewrites << " rewrites, " << entry.node_visits << " node visits, "
+                 << entry.memo_hits << " memo hits)\n";
+        }
+    }
     return changed;
 }
@@ -17,8 +17,11 @@
 #pragma once
 
 #include <functional>
+#include <map>
 #include <memory>
 #include <set>
+#include <string>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pattern/matcher.hpp"
@@ -68,11 +71,33 @@ public:
 
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
 
+    /// \brief Per-matcher counters, collected when profiling is enabled
+    struct MatcherStats
+    {
+        size_t attempts = 0;
+        size_t matches = 0;
+        size_t rewrites = 0;
+        size_t nanoseconds = 0;
+        /// Graph nodes compared against pattern nodes
+        size_t node_visits = 0;
+        /// Comparisons or recurrent cells skipped thanks to memoization
+        size_t memo_hits = 0;
+    };
+    /// \brief Enables collection of MatcherStats. Also enabled by NGRAPH_PROFILE_PASS_ENABLE,
+    ///        which prints the statistics after each run.
+    void set_matcher_profiling(bool enable) { m_matcher_profiling = enable; }
+    /// \brief Returns the statistics of each matcher by name, accumulated over all runs
+    const std::map<std::string, MatcherStats>& get_matcher_stats() const
+    {
+        return m_matcher_stats;
+    }
+
 protected:
     bool is_enabled(const std::shared_ptr<pattern::Matcher>& m) const;
     bool m_enable_shape_inference = false;
+    bool m_matcher_profiling = false;
+    std::map<std::string, MatcherStats> m_matcher_stats;
 
-private:
     struct MatchClosure
     {
         std::shared_ptr<pattern::Matcher> matcher;
@@ -105,8 +130,19 @@ public:
 
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
 
+    /// \brief Enables collection of statistics, as GraphRewrite::set_matcher_profiling
+    void set_matcher_profiling(bool enable) { m_matcher_profiling = enable; }
+    /// \brief Returns the statistics of each matcher in registration order, accumulated over
+    ///        all runs
+    const std::vector<GraphRewrite::MatcherStats>& get_matcher_stats() const
+    {
+        return m_matcher_stats;
+    }
+
 private:
     size_t m_num_iters;
+    bool m_matcher_profiling = false;
+    std::vector<GraphRewrite::MatcherStats> m_matcher_stats;
 
     struct MatchClosure
     {
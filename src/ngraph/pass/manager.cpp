@@ -19,17 +19,22 @@
 #else
 #include <cxxabi.h>
 #endif
+#include <cstdlib>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <sstream>
 
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/op/constant.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/serialize.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/chrome_trace.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -53,11 +58,57 @@ pass::Manager::~Manager()
 {
 }
 
-void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
+static mutex s_pass_report_callback_mutex;
+static function<void(const pass::PassReport&)> s_pass_report_callback;
+
+void pass::Manager::set_pass_report_callback(function<void(const PassReport&)> callback)
+{
+    lock_guard<mutex> lock(s_pass_report_callback_mutex);
+    s_pass_report_callback = move(callback);
+}
+
+static string get_pass_name(const pass::PassBase& pass)
+{
+    string name = typeid(pass).name();
+#ifndef _WIN32
+    int status;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (demangled)
+    {
+        name = demangled;
+        free(demangled);
+    }
+#endif
+    return name;
+}
+
+static void measure_functions(const vector<shared_ptr<Function>>& functions,
+                              size_t& node_count,
+                              size_t& constant_bytes)
+{
+    node_count = 0;
+    constant_bytes = 0;
+    for (auto& f : functions)
+    {
+        for (auto& node : f->get_ops())
+        {
+            node_count++;
+            if (auto constant = as_type_ptr<op::Constant>(node))
+            {
+                constant_bytes +=
+                    shape_size(constant->get_shape()) * constant->get_element_type().size();
+            }
+        }
+    }
+}
+
+const pass::PassReport& pass::Manager::run_passes(shared_ptr<Function> func,
+                                                  bool /* transitive */)
 {
     static bool profile_enabled = getenv("NGRAPH_PROFILE_PASS_ENABLE") != nullptr;
 
     get_state().set_function(func);
+    get_state().set_pass_config(m_pass_config);
     vector<std::pair<shared_ptr<Function>, bool>> fs{std::make_pair(func, func->is_dynamic())};
     vector<shared_ptr<Function>> f_array{func};
 
@@ -65,8 +116,17 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
     stopwatch pass_timer;
     stopwatch overall_timer;
     overall_timer.start();
+    m_pass_report.clear();
+    size_t node_count;
+    size_t constant_bytes;
+    measure_functions(f_array, node_count, constant_bytes);
     for (shared_ptr<PassBase> pass : m_pass_list)
     {
+        PassReportEntry entry;
+        entry.name = get_pass_name(*pass);
+        entry.nodes_before = node_count;
+        entry.constant_bytes_before = constant_bytes;
+        runtime::event::Duration event(entry.name, "Pass");
         pass_timer.start();
         pass->set_state(get_state());
         auto module_pass = dynamic_pointer_cast<ModulePass>(pass);
@@ -160,21 +220,38 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
         }
         index++;
         pass_timer.stop();
+        event.stop();
+        measure_functions(f_array, node_count, constant_bytes);
+        entry.microseconds = pass_timer.get_microseconds();
+        entry.nodes_after = node_count;
+        entry.constant_bytes_after = constant_bytes;
+        if (runtime::event::Manager::is_tracing_enabled())
+        {
+            stringstream args;
+            args << R"({"nodes_before":)" << entry.nodes_before << R"(,"nodes_after":)"
+                 << entry.nodes_after << R"(,"constant_bytes_before":)"
+                 << entry.constant_bytes_before << R"(,"constant_bytes_after":)"
+                 << entry.constant_bytes_after << "}";
+            event.set_args(args.str());
+        }
         if (profile_enabled)
         {
-            PassBase* p = pass.get();
-            string name = typeid(*p).name();
-#ifndef _WIN32
-            int status;
-            name = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
-#endif
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << name << "\n";
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << entry.name << "\n";
         }
+        m_pass_report.push_back(entry);
     }
     if (profile_enabled)
     {
         cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
     }
+    {
+        lock_guard<mutex> lock(s_pass_report_callback_mutex);
+        if (s_pass_report_callback)
+        {
+            s_pass_report_callback(m_pass_report);
+        }
+    }
+    return m_pass_report;
 }
 
 pass::ManagerState& pass::Manager::get_state()
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <functional>
 #include <list>
 #include <memory>
 #include <typeinfo>
@@ -24,6 +25,7 @@
 #include "ngraph/pass/manager_state.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/pass_config.hpp"
+#include "ngraph/pass/pass_report.hpp"
 #include "ngraph/pass/validate.hpp"
 
 namespace ngraph
@@ -52,7 +54,15 @@ public:
         return rc;
     }
 
-    void run_passes(std::shared_ptr<Function>, bool transitive = true);
+    /// \brief Runs the registered passes on a function
+    /// \returns The time each pass took and how it changed the function, also available from
+    ///          get_pass_report() until the next run. Each pass is also recorded as a chrome
+    ///          trace event when NGRAPH_ENABLE_TRACING is set.
+    const PassReport& run_passes(std::shared_ptr<Function>, bool transitive = true);
+    const PassReport& get_pass_report() const { return m_pass_report; }
+    /// \brief Sets a function called with the report of every run_passes in the process,
+    ///        including the ones backends run during compile. Pass an empty function to clear it.
+    static void set_pass_report_callback(std::function<void(const PassReport&)> callback);
 
     ManagerState& get_state();
     PassConfig& get_pass_config() { return m_pass_config; }
@@ -88,6 +98,7 @@ private:
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     ManagerState m_state;
     PassConfig m_pass_config;
+    PassReport m_pass_report;
     bool m_visualize = false;
     bool m_serialize = false;
     bool m_per_pass_validation = true;
@@ -26,6 +26,7 @@
 
 #include "ngraph/function.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/pass/pass_config.hpp"
 
 using visualize_tree_ops_map_t =
     std::unordered_map<ngraph::Node::type_info_t,
@@ -60,7 +61,11 @@ public:
         return {m_function};
     }
 
+    void set_pass_config(const PassConfig& pass_config) { m_pass_config = &pass_config; }
+    /// \brief The configuration of the Manager running the passes, or nullptr
+    const PassConfig* get_pass_config() const { return m_pass_config; }
 private:
     visualize_tree_ops_map_t m_visualize_tree_ops_map;
     std::shared_ptr<Function> m_function;
+    const PassConfig* m_pass_config{nullptr};
 };
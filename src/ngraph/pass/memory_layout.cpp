@@ -14,8 +14,11 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
+#include <memory>
 #include <sstream>
+#include <unordered_set>
 
 #include "ngraph/log.hpp"
 #include "ngraph/log.hpp"
@@ -25,14 +28,18 @@
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/pass_util.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
 
-pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
+pass::MemoryLayout::MemoryLayout(size_t alignment,
+                                 bool disable_memory_sharing,
+                                 MemoryManager::allocation_scheme scheme)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_scheme(disable_memory_sharing ? MemoryManager::allocation_scheme::NO_REUSE : scheme)
 {
     if (m_alignment == 0)
     {
@@ -42,7 +49,20 @@ pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
 
 bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
 {
-    MemoryManager mm(m_alignment, m_disable_memory_sharing);
+    // When packing, the pool offsets hold buffer ids until pack() assigns the offsets
+    bool packed = m_scheme == MemoryManager::allocation_scheme::PACKED;
+    unique_ptr<MemoryManager> mm;
+    unique_ptr<MemoryPacker> packer;
+    if (packed)
+    {
+        packer.reset(new MemoryPacker(m_alignment));
+    }
+    else
+    {
+        mm.reset(new MemoryManager(m_alignment, m_scheme));
+    }
+    unordered_set<descriptor::Tensor*> packed_tensors;
+
     for (shared_ptr<Node> node : function->get_ordered_ops())
     {
         std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
@@ -78,14 +98,48 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
                         }
                     }
                 }
+                // Elementwise ops can also overwrite an input that dies here without a hint
+                if (in_place_outputs.empty() && !m_disable_memory_sharing)
+                {
+                    for (size_t input_index : get_in_place_elementwise_inputs(*node))
+                    {
+                        auto output = &node->output(0).get_tensor();
+                        auto input = &node->input(input_index).get_tensor();
+                        if (node->liveness_free_list.count(input) != 0 &&
+                            node->liveness_new_list.count(output) != 0)
+                        {
+                            NGRAPH_DEBUG << "Reusing " << input->get_name() << " for "
+                                         << output->get_name();
+                            in_place_outputs.insert({output, input});
+                            reused_inputs.insert(input);
+                            break;
+                        }
+                    }
+                }
             }
         }
 
         for (descriptor::Tensor* tensor : node->liveness_new_list)
         {
-            size_t offset = in_place_outputs.count(tensor)
-                                ? in_place_outputs.at(tensor)->get_pool_offset()
-                                : mm.allocate(tensor->size());
+            size_t offset = 0;
+            if (in_place_outputs.count(tensor))
+            {
+                auto input = in_place_outputs.at(tensor);
+                offset = input->get_pool_offset();
+                if (packed_tensors.count(input) != 0)
+                {
+                    packed_tensors.insert(tensor);
+                }
+            }
+            else if (packed)
+            {
+                offset = packer->allocate(tensor->size());
+                packed_tensors.insert(tensor);
+            }
+            else
+            {
+                offset = mm->allocate(tensor->size());
+            }
             tensor->set_pool_offset(offset);
         }
 
@@ -95,12 +149,31 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
             {
                 if (reused_inputs.count(tensor) == 0)
                 {
-                    mm.free(tensor->get_pool_offset());
+                    if (packed)
+                    {
+                        packer->free(tensor->get_pool_offset());
+                    }
+                    else
+                    {
+                        mm->free(tensor->get_pool_offset());
+                    }
                 }
             }
         }
     }
-    function->set_temporary_pool_size(mm.max_allocated());
+
+    if (packed)
+    {
+        packer->pack();
+        for (descriptor::Tensor* tensor : packed_tensors)
+        {
+            tensor->set_pool_offset(packer->get_offset(tensor->get_pool_offset()));
+        }
+        NGRAPH_DEBUG << "MemoryLayout: packed " << packed_tensors.size() << " tensors into "
+                     << packer->max_allocated() << " bytes, lower bound "
+                     << packer->lower_bound() << " bytes";
+    }
+    function->set_temporary_pool_size(packed ? packer->max_allocated() : mm->max_allocated());
 
     return false;
 }
@@ -123,6 +196,16 @@ pass::MemoryManager::MemoryManager(size_t alignment, bool disable_memory_reuse)
     m_node_list.emplace_back(numeric_limits<size_t>::max(), block_state::FREE);
 }
 
+pass::MemoryManager::MemoryManager(size_t alignment, allocation_scheme scheme)
+    : MemoryManager(alignment, scheme == allocation_scheme::NO_REUSE)
+{
+    if (scheme == allocation_scheme::PACKED)
+    {
+        throw invalid_argument("Packed allocation is done by MemoryPacker");
+    }
+    m_scheme = scheme;
+}
+
 size_t pass::MemoryManager::allocate(size_t size)
 {
     size_t rc = 0;
@@ -131,6 +214,7 @@ size_t pass::MemoryManager::allocate(size_t size)
     case allocation_scheme::FIRST_FIT: rc = first_fit(size); break;
     case allocation_scheme::BEST_FIT: rc = best_fit(size); break;
     case allocation_scheme::NO_REUSE: rc = no_reuse_allocator(size); break;
+    case allocation_scheme::PACKED: throw logic_error("Packed allocation is done by MemoryPacker");
     }
     return rc;
 }
@@ -290,3 +374,94 @@ size_t pass::MemoryManager::align(size_t size, size_t alignment)
     }
     return size;
 }
+
+pass::MemoryPacker::MemoryPacker(size_t alignment)
+    : m_alignment{alignment}
+    , m_clock{0}
+    , m_live_bytes{0}
+    , m_lower_bound{0}
+    , m_max_allocated{0}
+{
+    if (m_alignment == 0)
+    {
+        throw invalid_argument("Memory alignment must be > 0");
+    }
+}
+
+size_t pass::MemoryPacker::allocate(size_t size)
+{
+    size = MemoryManager::align(size, m_alignment);
+    m_buffers.push_back({size, m_clock++, numeric_limits<size_t>::max(), 0});
+    m_live_bytes += size;
+    m_lower_bound = max(m_lower_bound, m_live_bytes);
+    return m_buffers.size() - 1;
+}
+
+void pass::MemoryPacker::free(size_t buffer_id)
+{
+    if (buffer_id >= m_buffers.size() ||
+        m_buffers[buffer_id].end != numeric_limits<size_t>::max())
+    {
+        throw runtime_error("bad free");
+    }
+    m_buffers[buffer_id].end = m_clock++;
+    m_live_bytes -= m_buffers[buffer_id].size;
+}
+
+size_t pass::MemoryPacker::pack()
+{
+    vector<size_t> order(m_buffers.size());
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        order[i] = i;
+    }
+    stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return m_buffers[a].size > m_buffers[b].size;
+    });
+
+    m_max_allocated = 0;
+    vector<size_t> placed;
+    for (size_t id : order)
+    {
+        Buffer& buffer = m_buffers[id];
+        // Address ranges of the placed buffers that are live at the same time
+        vector<pair<size_t, size_t>> taken;
+        for (size_t other_id : placed)
+        {
+            const Buffer& other = m_buffers[other_id];
+            if (other.begin < buffer.end && buffer.begin < other.end)
+            {
+                taken.push_back({other.offset, other.offset + other.size});
+            }
+        }
+        sort(taken.begin(), taken.end());
+
+        // Smallest gap that fits, or above everything taken
+        size_t best_offset = 0;
+        size_t best_gap = numeric_limits<size_t>::max();
+        size_t gap_begin = 0;
+        for (auto& range : taken)
+        {
+            if (range.first >= gap_begin + buffer.size && range.first - gap_begin < best_gap)
+            {
+                best_gap = range.first - gap_begin;
+                best_offset = gap_begin;
+            }
+            gap_begin = max(gap_begin, range.second);
+        }
+        if (best_gap == numeric_limits<size_t>::max())
+        {
+            best_offset = gap_begin;
+        }
+
+        buffer.offset = best_offset;
+        m_max_allocated = max(m_max_allocated, buffer.offset + buffer.size);
+        placed.push_back(id);
+    }
+    return m_max_allocated;
+}
+
+size_t pass::MemoryPacker::get_offset(size_t buffer_id) const
+{
+    return m_buffers.at(buffer_id).offset;
+}
@@ -19,6 +19,7 @@
 #include <limits>
 #include <list>
 #include <sstream>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 
@@ -29,20 +30,10 @@ namespace ngraph
         class MemoryLayout;
         class MemoryNode;
         class MemoryManager;
+        class MemoryPacker;
     }
 }
 
-class ngraph::pass::MemoryLayout : public FunctionPass
-{
-public:
-    MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
-    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
-
-private:
-    size_t m_alignment;
-    bool m_disable_memory_sharing;
-};
-
 class ngraph::pass::MemoryManager
 {
 public:
@@ -56,7 +47,9 @@ public:
     {
         FIRST_FIT,
         BEST_FIT,
-        NO_REUSE
+        NO_REUSE,
+        /// Offline packing of all lifetimes by MemoryPacker, not supported by MemoryManager
+        PACKED
     };
 
     class node
@@ -70,6 +63,7 @@ public:
     };
 
     MemoryManager(size_t alignment = 1, bool disable_reuse = false);
+    MemoryManager(size_t alignment, allocation_scheme scheme);
     // memory_manager& alignment(size_t a);
 
     size_t allocate(size_t size);
@@ -95,3 +89,58 @@ private:
     allocation_scheme m_scheme;
     size_t m_max_allocated;
 };
+
+/// \brief Assigns offsets once the lifetimes of all buffers are known.
+///
+/// allocate() and free() are called in execution order, as with MemoryManager, but return and
+/// take buffer ids instead of offsets. pack() then places the buffers by decreasing size, each
+/// in the smallest gap left by the already placed buffers whose lifetimes overlap its own. This
+/// fragments less than first fit when huge and small tensors are mixed.
+class ngraph::pass::MemoryPacker
+{
+public:
+    MemoryPacker(size_t alignment = 1);
+
+    /// \brief Starts the lifetime of a buffer and returns its id
+    size_t allocate(size_t size);
+    /// \brief Ends the lifetime of a buffer. Buffers never freed live until the end.
+    void free(size_t buffer_id);
+
+    /// \brief Assigns the offsets and returns the pool size
+    size_t pack();
+    size_t get_offset(size_t buffer_id) const;
+    size_t max_allocated() const { return m_max_allocated; }
+    /// \brief The peak of the bytes live at once, which no assignment can go below
+    size_t lower_bound() const { return m_lower_bound; }
+private:
+    struct Buffer
+    {
+        size_t size;
+        size_t begin;
+        size_t end;
+        size_t offset;
+    };
+
+    std::vector<Buffer> m_buffers;
+    size_t m_alignment;
+    size_t m_clock;
+    size_t m_live_bytes;
+    size_t m_lower_bound;
+    size_t m_max_allocated;
+};
+
+class ngraph::pass::MemoryLayout : public FunctionPass
+{
+public:
+    /// \param scheme How offsets are assigned when memory sharing is enabled
+    MemoryLayout(size_t alignment = 1,
+                 bool disable_memory_sharing = false,
+                 MemoryManager::allocation_scheme scheme =
+                     MemoryManager::allocation_scheme::FIRST_FIT);
+    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+
+private:
+    size_t m_alignment;
+    bool m_disable_memory_sharing;
+    MemoryManager::allocation_scheme m_scheme;
+};
@@ -0,0 +1,155 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/pass/memory_scheduling.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    struct MemoryEstimate
+    {
+        // Bytes held by the node's results once it has run
+        size_t output_bytes = 0;
+        // Peak bytes while computing the node and everything it depends on
+        size_t peak_bytes = 0;
+        vector<Node*> ordered_args;
+    };
+}
+
+static size_t get_output_bytes(const Node* node)
+{
+    if (node->is_parameter() || node->is_constant() || node->is_output())
+    {
+        return 0;
+    }
+    size_t bytes = 0;
+    for (auto& output : node->outputs())
+    {
+        if (output.get_partial_shape().is_static())
+        {
+            bytes += shape_size(output.get_shape()) * output.get_element_type().size();
+        }
+    }
+    return bytes;
+}
+
+// Arguments that need more memory beyond their own result go first
+static void order_by_extra_bytes(vector<Node*>& nodes,
+                                 const unordered_map<Node*, MemoryEstimate>& estimates)
+{
+    stable_sort(nodes.begin(), nodes.end(), [&](Node* a, Node* b) {
+        auto& ea = estimates.at(a);
+        auto& eb = estimates.at(b);
+        return ea.peak_bytes - ea.output_bytes > eb.peak_bytes - eb.output_bytes;
+    });
+}
+
+list<shared_ptr<Node>> pass::MemoryScheduling::sort(const NodeVector& root_nodes,
+                                                    bool include_control_deps)
+{
+    unordered_map<Node*, MemoryEstimate> estimates;
+    for (auto& node : topological_sort(root_nodes, include_control_deps))
+    {
+        MemoryEstimate& estimate = estimates[node.get()];
+        unordered_set<Node*> seen;
+        for (auto& value : node->input_values())
+        {
+            if (seen.insert(value.get_node()).second)
+            {
+                estimate.ordered_args.push_back(value.get_node());
+            }
+        }
+        if (include_control_deps)
+        {
+            for (auto& dep : node->get_control_dependencies())
+            {
+                if (seen.insert(dep.get()).second)
+                {
+                    estimate.ordered_args.push_back(dep.get());
+                }
+            }
+        }
+        order_by_extra_bytes(estimate.ordered_args, estimates);
+
+        size_t held_bytes = 0;
+        for (Node* arg : estimate.ordered_args)
+        {
+            auto& arg_estimate = estimates.at(arg);
+            estimate.peak_bytes = max(estimate.peak_bytes, held_bytes + arg_estimate.peak_bytes);
+            held_bytes += arg_estimate.output_bytes;
+        }
+        estimate.output_bytes = get_output_bytes(node.get());
+        estimate.peak_bytes = max(estimate.peak_bytes, held_bytes + estimate.output_bytes);
+    }
+
+    vector<Node*> roots;
+    for (auto& node : root_nodes)
+    {
+        roots.push_back(node.get());
+    }
+    order_by_extra_bytes(roots, estimates);
+
+    // Depth-first, visiting arguments in their estimated order
+    list<shared_ptr<Node>> result;
+    unordered_set<Node*> nodes_done;
+    vector<pair<Node*, size_t>> nodes_to_do;
+    for (auto it = roots.rbegin(); it != roots.rend(); ++it)
+    {
+        nodes_to_do.push_back({*it, 0});
+    }
+    while (!nodes_to_do.empty())
+    {
+        Node* node = nodes_to_do.back().first;
+        size_t& next_arg = nodes_to_do.back().second;
+        if (nodes_done.count(node) != 0)
+        {
+            nodes_to_do.pop_back();
+            continue;
+        }
+        auto& args = estimates.at(node).ordered_args;
+        while (next_arg < args.size() && nodes_done.count(args[next_arg]) != 0)
+        {
+            next_arg++;
+        }
+        if (next_arg < args.size())
+        {
+            nodes_to_do.push_back({args[next_arg], 0});
+        }
+        else
+        {
+            result.push_back(node->shared_from_this());
+            nodes_done.insert(node);
+            nodes_to_do.pop_back();
+        }
+    }
+    return result;
+}
+
+bool pass::MemoryScheduling::run_on_function(shared_ptr<Function> f)
+{
+    f->set_topological_sort(sort);
+    return false;
+}
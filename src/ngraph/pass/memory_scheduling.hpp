@@ -0,0 +1,45 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class MemoryScheduling;
+    }
+}
+
+/// \brief Makes get_ordered_ops() order independent ops to lower the peak of live
+///        intermediate bytes.
+///
+/// The default topological sort visits the arguments of each op in input order. This pass
+/// installs a sort that first visits the argument whose subgraph needs the most memory beyond
+/// its own result, as in Sethi-Ullman register allocation, so that large temporaries are freed
+/// before other results are held. Shared subgraphs are estimated as if they were trees. The
+/// graph itself is not changed. Run it before Liveness and MemoryLayout.
+class NGRAPH_API ngraph::pass::MemoryScheduling : public FunctionPass
+{
+public:
+    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+
+    /// \brief The memory-aware topological sort installed by the pass
+    static std::list<std::shared_ptr<Node>> sort(const NodeVector& root_nodes,
+                                                 bool include_control_deps);
+};
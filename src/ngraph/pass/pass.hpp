@@ -80,6 +80,8 @@ public:
     bool get_property(const PassPropertyMask& prop_mask) const;
 
 protected:
+    /// \brief Returns true when the pass is being run by a Manager, which sets its state
+    bool has_state() const { return m_state != nullptr; }
     ManagerState& get_state();
     void set_state(ManagerState&);
     void set_property(const PassPropertyMask& prop, bool value);
@@ -80,6 +80,35 @@ pass::PassConfig::PassConfig()
             }
         }
     }
+    //
+    //  Parses the semi-colon separated environment string passed through NGRAPH_PASS_PARAMETERS
+    //  and returns the numeric pass parameters. Naming of pass parameters is up to the passes.
+    //
+    //  For example:
+    //  NGRAPH_PASS_PARAMETERS="ConstantFolding::MaxFoldedBytes=1048576"
+    //  would limit the results ConstantFolding may materialize to 1 MiB
+    //
+    env_str = getenv("NGRAPH_PASS_PARAMETERS");
+    if (env_str)
+    {
+        stringstream ss;
+        ss << env_str;
+        while (ss.good())
+        {
+            string substr;
+            getline(ss, substr, ';');
+            if (substr.empty())
+            {
+                continue;
+            }
+            auto split_str = split(substr, '=', false);
+            if (split_str.size() != 2)
+            {
+                throw ngraph_error("Unexpected string in NGRAPH_PASS_PARAMETERS: " + substr);
+            }
+            m_pass_parameters.emplace(split_str[0], parse_string<double>(split_str[1]));
+        }
+    }
 }
 
 void pass::PassConfig::set_pass_enable(const string& name, bool enable)
@@ -111,3 +140,23 @@ bool pass::PassConfig::get_pass_attribute(const string& name) const
     }
     return false;
 }
+
+void pass::PassConfig::set_pass_parameter(const string& name, double value)
+{
+    m_pass_parameters[name] = value;
+}
+
+bool pass::PassConfig::has_pass_parameter(const string& name) const
+{
+    return m_pass_parameters.find(name) != m_pass_parameters.end();
+}
+
+double pass::PassConfig::get_pass_parameter(const string& name, double default_value) const
+{
+    auto it = m_pass_parameters.find(name);
+    if (it != m_pass_parameters.end())
+    {
+        return it->second;
+    }
+    return default_value;
+}
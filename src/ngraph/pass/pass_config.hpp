@@ -37,8 +37,13 @@ public:
     const std::map<std::string, bool>& get_pass_attributes() const { return m_pass_attributes; }
     void set_pass_attribute(const std::string& name, bool enable);
     bool get_pass_attribute(const std::string& name) const;
+    const std::map<std::string, double>& get_pass_parameters() const { return m_pass_parameters; }
+    void set_pass_parameter(const std::string& name, double value);
+    bool has_pass_parameter(const std::string& name) const;
+    double get_pass_parameter(const std::string& name, double default_value) const;
 
 private:
     std::map<std::string, bool> m_pass_enables;
     std::map<std::string, bool> m_pass_attributes;
+    std::map<std::string, double> m_pass_parameters;
 };
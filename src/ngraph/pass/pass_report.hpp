@@ -0,0 +1,41 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Statistics of one pass run by Manager::run_passes
+        struct PassReportEntry
+        {
+            std::string name;
+            size_t microseconds = 0;
+            size_t nodes_before = 0;
+            size_t nodes_after = 0;
+            /// \brief Bytes of Constant data in the functions before and after the pass
+            size_t constant_bytes_before = 0;
+            size_t constant_bytes_after = 0;
+        };
+
+        using PassReport = std::vector<PassReportEntry>;
+    }
+}
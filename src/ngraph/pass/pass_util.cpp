@@ -38,3 +38,25 @@ std::function<bool(std::shared_ptr<Node>)> ngraph::pass::get_no_fan_out_function
 
     return ret_fun;
 }
+
+std::vector<size_t> ngraph::pass::get_in_place_elementwise_inputs(const Node& node)
+{
+    std::vector<size_t> inputs;
+    if (node.get_output_size() != 1 || node.get_output_partial_shape(0).is_dynamic() ||
+        !(node.is_unary_elementwise_arithmetic() || node.is_binary_elementwise_arithmetic() ||
+          node.is_binary_elementwise_comparison() || node.is_binary_elementwise_logical()))
+    {
+        return inputs;
+    }
+    for (size_t i = 0; i < node.get_input_size(); i++)
+    {
+        // Implicitly broadcast inputs are read at more than one output position
+        if (node.get_input_partial_shape(i).is_static() &&
+            node.get_input_shape(i) == node.get_output_shape(0) &&
+            node.get_input_element_type(i) == node.get_output_element_type(0))
+        {
+            inputs.push_back(i);
+        }
+    }
+    return inputs;
+}
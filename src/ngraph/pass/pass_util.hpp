@@ -23,6 +23,7 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "ngraph/node.hpp"
 
@@ -31,5 +32,11 @@ namespace ngraph
     namespace pass
     {
         std::function<bool(std::shared_ptr<Node>)> get_no_fan_out_function();
+
+        /// \brief Returns the inputs of an elementwise op whose buffer may hold the op's
+        ///        output, those with the output's static shape and element type. Callers must
+        ///        still check that the input is not used after the op.
+        NGRAPH_API
+        std::vector<size_t> get_in_place_elementwise_inputs(const Node& node);
     }
 }
@@ -0,0 +1,354 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ngraph/builder/dequantize_builder.hpp"
+#include "ngraph/builder/quantize_builder.hpp"
+#include "ngraph/builder/quantized_conv_builder.hpp"
+#include "ngraph/builder/quantized_dot_builder.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/fused/matmul.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/pass/post_training_quantization.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using Range = pass::PostTrainingQuantization::Range;
+
+string pass::PostTrainingQuantization::get_range_key(const Output<Node>& value)
+{
+    return value.get_node()->get_name() + ":" + to_string(value.get_index());
+}
+
+pass::PostTrainingQuantization::RangeMap pass::PostTrainingQuantization::calibrate(
+    const shared_ptr<Function>& f,
+    runtime::Backend& backend,
+    const vector<vector<shared_ptr<runtime::Tensor>>>& samples)
+{
+    // Backends rewrite the functions they compile, so calibrate a copy with every f32 value
+    // as an extra result.
+    NodeMap node_map;
+    auto clone = clone_function(*f, node_map);
+    vector<string> keys;
+    ResultVector results;
+    for (auto& node : f->get_ordered_ops())
+    {
+        if (node->is_constant() || node->is_output())
+        {
+            continue;
+        }
+        for (auto& output : node->outputs())
+        {
+            if (output.get_element_type() == element::f32)
+            {
+                keys.push_back(get_range_key(output));
+                results.push_back(make_shared<op::Result>(
+                    node_map.at(node.get())->output(output.get_index())));
+            }
+        }
+    }
+
+    auto executable = backend.compile(make_shared<Function>(results, clone->get_parameters()));
+    vector<shared_ptr<runtime::Tensor>> outputs;
+    for (auto& result : results)
+    {
+        outputs.push_back(backend.create_tensor(element::f32, result->get_shape()));
+    }
+
+    RangeMap ranges;
+    vector<float> values;
+    for (auto& inputs : samples)
+    {
+        executable->call_with_validate(outputs, inputs);
+        for (size_t i = 0; i < outputs.size(); i++)
+        {
+            values.resize(shape_size(outputs[i]->get_shape()));
+            if (values.empty())
+            {
+                continue;
+            }
+            outputs[i]->read(values.data(), values.size() * sizeof(float));
+            auto minmax = minmax_element(values.begin(), values.end());
+            auto it = ranges.find(keys[i]);
+            if (it == ranges.end())
+            {
+                ranges[keys[i]] = Range{*minmax.first, *minmax.second};
+            }
+            else
+            {
+                it->second.min = min(it->second.min, *minmax.first);
+                it->second.max = max(it->second.max, *minmax.second);
+            }
+        }
+    }
+    return ranges;
+}
+
+namespace
+{
+    struct Quantized
+    {
+        Output<Node> value;
+        Output<Node> min;
+        Output<Node> max;
+    };
+
+    // The quantized value behind each Dequantize created by the pass
+    using DequantizedMap = unordered_map<Node*, Quantized>;
+}
+
+static Output<Node> make_scalar(float value)
+{
+    return op::Constant::create(element::f32, Shape{}, {value})->output(0);
+}
+
+static Quantized quantize(const Output<Node>& value,
+                          const Range& range,
+                          const element::Type& type,
+                          const DequantizedMap& dequantized)
+{
+    auto it = dequantized.find(value.get_node());
+    if (it != dequantized.end() && it->second.value.get_element_type() == type)
+    {
+        return it->second;
+    }
+    auto min = make_scalar(range.min);
+    auto max = make_scalar(range.max);
+    auto quantized = builder::QuantizeBuilder(
+        value, min, max, type, AxisSet{}, op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+    return Quantized{quantized, min, max};
+}
+
+static bool get_constant_range(const shared_ptr<Node>& node, Range& range)
+{
+    auto constant = as_type_ptr<op::Constant>(node);
+    if (!constant || shape_size(constant->get_shape()) == 0)
+    {
+        return false;
+    }
+    auto values = constant->cast_vector<float>();
+    auto minmax = minmax_element(values.begin(), values.end());
+    range = Range{*minmax.first, *minmax.second};
+    return range.min < range.max;
+}
+
+static shared_ptr<Node> get_single_user(const shared_ptr<Node>& node)
+{
+    auto users = node->get_users();
+    return users.size() == 1 ? users[0] : nullptr;
+}
+
+// Returns the [channels] bias constant if `add` adds it, broadcast along every axis but the
+// channel axis, to `convolution`.
+static shared_ptr<op::Constant> get_bias(const shared_ptr<Node>& add,
+                                         const shared_ptr<Node>& convolution)
+{
+    if (!add || !is_type<op::Add>(add))
+    {
+        return nullptr;
+    }
+    auto other = add->get_argument(0) == convolution ? add->get_argument(1)
+                                                     : add->get_argument(0);
+    auto broadcast = as_type_ptr<op::Broadcast>(other);
+    if (!broadcast)
+    {
+        return nullptr;
+    }
+    auto bias = as_type_ptr<op::Constant>(broadcast->get_argument(0));
+    auto& shape = convolution->get_shape();
+    AxisSet axes;
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        if (i != 1)
+        {
+            axes.insert(i);
+        }
+    }
+    if (!bias || bias->get_shape() != Shape{shape[1]} || broadcast->get_broadcast_axes() != axes)
+    {
+        return nullptr;
+    }
+    return bias;
+}
+
+bool pass::PostTrainingQuantization::run_on_function(shared_ptr<Function> f)
+{
+    DequantizedMap dequantized;
+    unordered_set<Node*> replaced;
+
+    auto find_range = [this](const Output<Node>& value, Range& range) {
+        auto it = m_ranges.find(get_range_key(value));
+        if (it == m_ranges.end() || !(it->second.min < it->second.max))
+        {
+            return false;
+        }
+        range = it->second;
+        return true;
+    };
+
+    auto dequantize = [&](const shared_ptr<Node>& tail,
+                          const Output<Node>& quantized,
+                          const Range& range) {
+        auto min = make_scalar(range.min);
+        auto max = make_scalar(range.max);
+        auto result = builder::DequantizeBuilder(quantized, min, max, element::f32, AxisSet{});
+        NGRAPH_DEBUG << "Quantized " << tail->get_name() << " into "
+                     << quantized.get_node()->get_name();
+        replace_node(tail, result);
+        dequantized[result.get()] = Quantized{quantized, min, max};
+    };
+
+    bool modified = false;
+    for (auto& node : f->get_ordered_ops())
+    {
+        if (replaced.count(node.get()) != 0 || node->get_element_type() != element::f32)
+        {
+            continue;
+        }
+
+        if (auto convolution = as_type_ptr<op::Convolution>(node))
+        {
+            Range data_range, filter_range, output_range;
+            if (!find_range(convolution->input_value(0), data_range) || data_range.min < 0 ||
+                !get_constant_range(convolution->get_argument(1), filter_range))
+            {
+                continue;
+            }
+
+            // Fold a following bias Add and Relu into the quantized convolution
+            shared_ptr<Node> tail = convolution;
+            auto bias = get_bias(get_single_user(convolution), convolution);
+            bool with_relu = false;
+            if (bias)
+            {
+                tail = get_single_user(convolution);
+                auto relu = get_single_user(tail);
+                if (relu && is_type<op::Relu>(relu))
+                {
+                    tail = relu;
+                    with_relu = true;
+                }
+            }
+            if (!find_range(tail, output_range))
+            {
+                continue;
+            }
+
+            auto data = quantize(convolution->input_value(0), data_range, element::u8, dequantized);
+            auto filters = quantize(
+                convolution->input_value(1), filter_range, element::i8, dequantized);
+            auto& strides = convolution->get_window_movement_strides();
+            auto& dilations = convolution->get_window_dilation_strides();
+            auto& padding_below = convolution->get_padding_below();
+            auto& padding_above = convolution->get_padding_above();
+            auto& data_dilations = convolution->get_data_dilation_strides();
+            shared_ptr<Node> quantized;
+            if (bias)
+            {
+                quantized = builder::QuantizedConvolutionBiasBuilder(data.value,
+                                                                     filters.value,
+                                                                     bias,
+                                                                     strides,
+                                                                     dilations,
+                                                                     padding_below,
+                                                                     padding_above,
+                                                                     data_dilations,
+                                                                     data.min,
+                                                                     data.max,
+                                                                     filters.min,
+                                                                     filters.max,
+                                                                     make_scalar(output_range.min),
+                                                                     make_scalar(output_range.max),
+                                                                     with_relu);
+            }
+            else
+            {
+                quantized = builder::QuantizedConvolutionBuilder(data.value,
+                                                                 filters.value,
+                                                                 strides,
+                                                                 dilations,
+                                                                 padding_below,
+                                                                 padding_above,
+                                                                 data_dilations,
+                                                                 data.min,
+                                                                 data.max,
+                                                                 filters.min,
+                                                                 filters.max,
+                                                                 make_scalar(output_range.min),
+                                                                 make_scalar(output_range.max),
+                                                                 element::i8);
+            }
+            if (tail != convolution)
+            {
+                replaced.insert(tail.get());
+                replaced.insert(get_single_user(convolution).get());
+            }
+            dequantize(tail, quantized, output_range);
+            modified = true;
+        }
+        else if (is_type<op::Dot>(node) || is_type<op::MatMul>(node))
+        {
+            auto dot = as_type_ptr<op::Dot>(node);
+            auto matmul = as_type_ptr<op::MatMul>(node);
+            if ((dot && dot->get_reduction_axes_count() != 1) ||
+                (matmul && (matmul->get_transpose_a() || matmul->get_transpose_b())) ||
+                node->get_input_shape(0).size() != 2 || node->get_input_shape(1).size() != 2)
+            {
+                continue;
+            }
+
+            Range data_range, weight_range, output_range;
+            if (!find_range(node->input_value(0), data_range) ||
+                !get_constant_range(node->get_argument(1), weight_range) ||
+                !find_range(node, output_range))
+            {
+                continue;
+            }
+
+            auto data_type = data_range.min < 0 ? element::i8 : element::u8;
+            auto data = quantize(node->input_value(0), data_range, data_type, dequantized);
+            auto weights = quantize(node->input_value(1), weight_range, element::i8, dequantized);
+            auto quantized = builder::QuantizedDotBuilder(data.value,
+                                                          weights.value,
+                                                          1,
+                                                          data.min,
+                                                          data.max,
+                                                          weights.min,
+                                                          weights.max,
+                                                          make_scalar(output_range.min),
+                                                          make_scalar(output_range.max),
+                                                          element::i8,
+                                                          AxisSet{},
+                                                          AxisSet{},
+                                                          AxisSet{});
+            dequantize(node, quantized, output_range);
+            modified = true;
+        }
+    }
+    return modified;
+}
@@ -0,0 +1,81 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/backend.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class PostTrainingQuantization;
+    }
+}
+
+/// \brief Rewrites f32 Convolution and Dot regions into the quantized ops, using the value
+///        ranges recorded by running the f32 function on sample data.
+///
+/// A Convolution with constant filters and non-negative data becomes a QuantizedConvolutionBias
+/// when its result feeds a single bias Add, with a following Relu folded in as a u8 output, and
+/// a QuantizedConvolution otherwise. A 2D Dot or untransposed MatMul with constant weights
+/// becomes a QuantizedDot. Data is quantized per tensor with its calibrated range and constant
+/// weights are quantized to i8 with their own range.
+///
+/// Every quantized result is dequantized back to f32, but a rewritten op whose input is such a
+/// Dequantize reads the quantized value directly when the types agree, so a chain of quantized
+/// layers only quantizes and dequantizes at its ends. Values without a calibrated range stay in
+/// f32.
+class NGRAPH_API ngraph::pass::PostTrainingQuantization : public FunctionPass
+{
+public:
+    struct Range
+    {
+        float min;
+        float max;
+    };
+
+    /// Ranges of f32 values, keyed by get_range_key()
+    using RangeMap = std::map<std::string, Range>;
+
+    PostTrainingQuantization(const RangeMap& ranges)
+        : FunctionPass()
+        , m_ranges(ranges)
+    {
+        set_property(PassProperty::REQUIRE_STATIC_SHAPE, true);
+    }
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+    /// \brief Runs a copy of `f` on `backend` once for each entry of `samples`, which holds
+    ///        the arguments in parameter order, and records the range of every f32 value
+    ///        computed by `f`.
+    static RangeMap
+        calibrate(const std::shared_ptr<Function>& f,
+                  runtime::Backend& backend,
+                  const std::vector<std::vector<std::shared_ptr<runtime::Tensor>>>& samples);
+
+    static std::string get_range_key(const Output<Node>& value);
+
+private:
+    RangeMap m_ranges;
+};
@@ -0,0 +1,156 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/pass/quantization_folding.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static bool same_value(const Output<Node>& a, const Output<Node>& b)
+{
+    return a == b || compare_constants(a.get_node_shared_ptr(), b.get_node_shared_ptr());
+}
+
+static bool is_positive(const Output<Node>& scale)
+{
+    auto constant = as_type_ptr<op::Constant>(scale.get_node_shared_ptr());
+    if (!constant)
+    {
+        return false;
+    }
+    for (auto value : constant->cast_vector<double>())
+    {
+        if (!(value > 0))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool same_quantization(const op::Dequantize& a, const op::Dequantize& b)
+{
+    return a.get_input_element_type(0) == b.get_input_element_type(0) &&
+           a.get_axes() == b.get_axes() && same_value(a.input_value(1), b.input_value(1)) &&
+           same_value(a.input_value(2), b.input_value(2));
+}
+
+// Quantize(Dequantize(x)) -> x
+static bool cancel(const shared_ptr<op::Quantize>& quantize)
+{
+    auto dequantize = as_type_ptr<op::Dequantize>(quantize->get_argument(0));
+    if (!dequantize || quantize->get_element_type() != dequantize->get_input_element_type(0) ||
+        quantize->get_axes() != dequantize->get_axes() ||
+        !same_value(quantize->input_value(1), dequantize->input_value(1)) ||
+        !same_value(quantize->input_value(2), dequantize->input_value(2)))
+    {
+        return false;
+    }
+    NGRAPH_DEBUG << "Cancelling " << quantize->get_name() << " and " << dequantize->get_name();
+    replace_node(quantize, dequantize->get_argument(0));
+    return true;
+}
+
+// op(Dequantize(x)) -> Dequantize(op(x))
+static bool sink(const shared_ptr<Node>& node)
+{
+    bool order_preserving = is_type<op::Reshape>(node) || is_type<op::Slice>(node) ||
+                            is_type<op::Broadcast>(node) || is_type<op::Concat>(node);
+    bool monotonic = is_type<op::MaxPool>(node) || is_type<op::Relu>(node);
+    if ((!order_preserving && !monotonic) || node->get_input_size() == 0)
+    {
+        return false;
+    }
+
+    OutputVector quantized_inputs;
+    shared_ptr<op::Dequantize> first;
+    for (auto& input : node->input_values())
+    {
+        auto dequantize = as_type_ptr<op::Dequantize>(input.get_node_shared_ptr());
+        if (!dequantize || (first && !same_quantization(*first, *dequantize)))
+        {
+            return false;
+        }
+        first = first ? first : dequantize;
+        quantized_inputs.push_back(dequantize->input_value(0));
+    }
+
+    // Per-axis parameters may not follow the data through a change of shape
+    if (!first->get_axes().empty())
+    {
+        return false;
+    }
+    if (monotonic && !is_positive(first->input_value(1)))
+    {
+        return false;
+    }
+
+    Output<Node> quantized;
+    if (is_type<op::Relu>(node))
+    {
+        if (!is_zero(first->input_value(2)))
+        {
+            return false;
+        }
+        // u8 values are already non-negative
+        quantized = first->get_input_element_type(0) == element::u8
+                        ? quantized_inputs[0]
+                        : node->copy_with_new_inputs(quantized_inputs)->output(0);
+    }
+    else
+    {
+        quantized = node->copy_with_new_inputs(quantized_inputs)->output(0);
+    }
+
+    NGRAPH_DEBUG << "Moving " << node->get_name() << " above " << first->get_name();
+    replace_node(node,
+                 make_shared<op::Dequantize>(quantized,
+                                             first->input_value(1),
+                                             first->input_value(2),
+                                             node->get_element_type(),
+                                             first->get_axes()));
+    return true;
+}
+
+bool pass::QuantizationFolding::run_on_function(shared_ptr<Function> f)
+{
+    // Ops are visited producers first, so a Dequantize moved below one op can keep moving
+    // below its users and meet the Quantize that ends the chain.
+    bool modified = false;
+    for (auto& node : f->get_ordered_ops())
+    {
+        if (auto quantize = as_type_ptr<op::Quantize>(node))
+        {
+            modified |= cancel(quantize);
+        }
+        else
+        {
+            modified |= sink(node);
+        }
+    }
+    return modified;
+}
@@ -0,0 +1,48 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class QuantizationFolding;
+    }
+}
+
+/// \brief Keeps quantized data quantized across ops that commute with dequantization, and
+///        cancels the Quantize/Dequantize pairs this exposes.
+///
+/// A Reshape, Slice, Broadcast, MaxPool, Relu or Concat whose data inputs are all dequantized
+/// with the same per-tensor parameters runs on the quantized values instead, followed by a
+/// single Dequantize. MaxPool and Relu need a positive scale, and Relu a zero zero point; a
+/// Relu of u8 data disappears. A Quantize of a Dequantize with the same scale, zero point,
+/// axes and element type is replaced by the quantized input, so a
+/// Dequantize -> MaxPool -> Reshape -> Quantize chain reduces to the int8 MaxPool and Reshape.
+class NGRAPH_API ngraph::pass::QuantizationFolding : public FunctionPass
+{
+public:
+    QuantizationFolding()
+        : FunctionPass()
+    {
+        set_property(PassProperty::REQUIRE_STATIC_SHAPE, true);
+    }
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+};
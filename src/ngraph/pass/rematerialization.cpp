@@ -0,0 +1,207 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
+#include "ngraph/pass/rematerialization.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    struct Schedule
+    {
+        vector<shared_ptr<Node>> nodes;
+        unordered_map<Node*, size_t> position;
+        unordered_map<Node*, size_t> last_use;
+        size_t peak_position = 0;
+        size_t peak_bytes = 0;
+    };
+}
+
+static bool is_persistent(const Node* node)
+{
+    return node->is_parameter() || node->is_constant() || node->is_output();
+}
+
+static size_t get_output_bytes(const Node* node)
+{
+    size_t bytes = 0;
+    for (auto& output : node->outputs())
+    {
+        bytes += shape_size(output.get_shape()) * output.get_element_type().size();
+    }
+    return bytes;
+}
+
+static bool is_cheap_to_recompute(const shared_ptr<Node>& node)
+{
+    return node->get_output_size() == 1 && !node->has_state() &&
+           node->get_control_dependencies().empty() &&
+           node->get_control_dependents().empty() &&
+           (dynamic_pointer_cast<op::util::UnaryElementwiseArithmetic>(node) ||
+            dynamic_pointer_cast<op::util::BinaryElementwiseArithmetic>(node) ||
+            is_type<op::Reshape>(node) || is_type<op::Broadcast>(node) ||
+            is_type<op::Convert>(node) || is_type<op::Slice>(node));
+}
+
+static Schedule make_schedule(const shared_ptr<Function>& f)
+{
+    Schedule schedule;
+    for (auto& node : f->get_ordered_ops())
+    {
+        schedule.position[node.get()] = schedule.nodes.size();
+        schedule.nodes.push_back(node);
+    }
+
+    // Each intermediate result is freed after the last op reading it
+    vector<vector<Node*>> frees(schedule.nodes.size());
+    for (auto& node : schedule.nodes)
+    {
+        size_t last_use = schedule.position[node.get()];
+        for (auto& output : node->outputs())
+        {
+            for (auto& input : output.get_target_inputs())
+            {
+                last_use = max(last_use, schedule.position[input.get_node()]);
+            }
+        }
+        schedule.last_use[node.get()] = last_use;
+        if (!is_persistent(node.get()))
+        {
+            frees[last_use].push_back(node.get());
+        }
+    }
+
+    size_t live_bytes = 0;
+    for (size_t i = 0; i < schedule.nodes.size(); i++)
+    {
+        Node* node = schedule.nodes[i].get();
+        if (!is_persistent(node))
+        {
+            live_bytes += get_output_bytes(node);
+        }
+        if (live_bytes > schedule.peak_bytes)
+        {
+            schedule.peak_bytes = live_bytes;
+            schedule.peak_position = i;
+        }
+        for (Node* freed : frees[i])
+        {
+            live_bytes -= get_output_bytes(freed);
+        }
+    }
+    return schedule;
+}
+
+// Returns the position of the first user of node scheduled after the peak, or 0 if the node
+// cannot be recomputed there without extending the lifetime of its inputs
+static size_t get_first_far_use(const Schedule& schedule, const shared_ptr<Node>& node)
+{
+    size_t first_far_use = 0;
+    for (auto& input : node->output(0).get_target_inputs())
+    {
+        size_t position = schedule.position.at(input.get_node());
+        if (position > schedule.peak_position &&
+            (first_far_use == 0 || position < first_far_use))
+        {
+            first_far_use = position;
+        }
+    }
+    for (auto& value : node->input_values())
+    {
+        Node* arg = value.get_node();
+        if (!is_persistent(arg) && schedule.last_use.at(arg) < first_far_use)
+        {
+            return 0;
+        }
+    }
+    return first_far_use;
+}
+
+bool pass::Rematerialization::run_on_function(shared_ptr<Function> f)
+{
+    bool changed = false;
+    Schedule schedule = make_schedule(f);
+    // Each step moves the peak, bound the number of steps in case it keeps moving around
+    size_t max_steps = schedule.nodes.size();
+    for (size_t step = 0; step < max_steps && schedule.peak_bytes > m_memory_budget; step++)
+    {
+        // Pick the largest result held across the peak
+        shared_ptr<Node> candidate;
+        size_t candidate_bytes = 0;
+        size_t candidate_first_far_use = 0;
+        for (size_t i = 0; i < schedule.peak_position; i++)
+        {
+            auto& node = schedule.nodes[i];
+            if (is_persistent(node.get()) ||
+                schedule.last_use.at(node.get()) <= schedule.peak_position ||
+                !is_cheap_to_recompute(node))
+            {
+                continue;
+            }
+            size_t first_far_use = get_first_far_use(schedule, node);
+            size_t bytes = get_output_bytes(node.get());
+            if (first_far_use != 0 && bytes > candidate_bytes)
+            {
+                candidate = node;
+                candidate_bytes = bytes;
+                candidate_first_far_use = first_far_use;
+            }
+        }
+        if (!candidate)
+        {
+            NGRAPH_DEBUG << "Rematerialization: peak of " << schedule.peak_bytes
+                         << " bytes is above the budget of " << m_memory_budget
+                         << " bytes but nothing can be recomputed";
+            break;
+        }
+
+        auto clone = candidate->copy_with_new_inputs(candidate->input_values());
+        for (auto& input : candidate->output(0).get_target_inputs())
+        {
+            if (schedule.position.at(input.get_node()) > schedule.peak_position)
+            {
+                input.replace_source_output(clone->output(0));
+            }
+        }
+        // Keep the clone from being scheduled as early as the original. Nodes before the first
+        // far user cannot depend on the clone, so this cannot introduce a cycle. The op at the
+        // peak always allocates, so a non-persistent anchor is found.
+        size_t anchor = candidate_first_far_use - 1;
+        while (is_persistent(schedule.nodes[anchor].get()))
+        {
+            anchor--;
+        }
+        clone->add_control_dependency(schedule.nodes[anchor]);
+        NGRAPH_DEBUG << "Rematerialization: recomputing " << candidate->get_name() << " as "
+                     << clone->get_name();
+        changed = true;
+        schedule = make_schedule(f);
+    }
+    return changed;
+}
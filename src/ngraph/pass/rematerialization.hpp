@@ -0,0 +1,51 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class Rematerialization;
+    }
+}
+
+/// \brief Recomputes cheap intermediate values close to their late users to lower the peak
+///        memory of the schedule.
+///
+/// The pass simulates the schedule of get_ordered_ops() and, while the peak number of live
+/// intermediate bytes is above the budget, picks a cheap op (elementwise, Reshape, Broadcast,
+/// Convert, Slice) whose result is held across the peak, clones it and moves the users after
+/// the peak to the clone. The clone gets a control dependency so it is scheduled right before
+/// its first user. This targets backprop graphs, where forward activations stay alive until
+/// their adjoints are computed. Run it before Liveness and MemoryLayout.
+class NGRAPH_API ngraph::pass::Rematerialization : public FunctionPass
+{
+public:
+    /// \param memory_budget Peak bytes of intermediate tensors the schedule should stay within
+    Rematerialization(size_t memory_budget)
+        : FunctionPass()
+        , m_memory_budget(memory_budget)
+    {
+    }
+    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+
+private:
+    size_t m_memory_budget;
+};
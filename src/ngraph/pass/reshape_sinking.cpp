@@ -34,7 +34,9 @@
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/slice.hpp"
+#include "ngraph/op/util/arithmetic_reduction.hpp"
 #include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/logical_reduction.hpp"
 #include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/util.hpp"
@@ -491,6 +493,110 @@ static void sink_concat(shared_ptr<op::Concat> n,
     write_reshapemap(reorders, new_concat, new_reshape);
 }
 
+// The reduction is rewritten to reduce the corresponding axes of its untransposed argument.
+// The surviving axes come out in their untransposed order, so the pending reshape keeps only
+// the relative order of the axes that are not reduced
+template <typename T>
+static void sink_reduction(shared_ptr<T> n,
+                           ReshapeMap& reorders,
+                           set<shared_ptr<Node>>& reshapes_to_delete)
+{
+    auto arg_reshape = reorders.at(n->get_argument(0));
+    auto order = arg_reshape->get_input_order();
+    if (!n->reduction_axes_constant() || order == get_default_order(order.size()))
+    {
+        materialize_shapes(n, reorders, reshapes_to_delete);
+        return;
+    }
+
+    auto reduction_axes = n->get_reduction_axes();
+    AxisSet new_reduction_axes;
+    for (auto axis : reduction_axes)
+    {
+        new_reduction_axes.insert(order.at(axis));
+    }
+
+    // reductions that keep dims leave the reduced axes in place as size-1 axes
+    AxisVector new_order{order};
+    if (n->get_shape().size() != order.size())
+    {
+        AxisVector kept_axes;
+        for (size_t i = 0; i < order.size(); i++)
+        {
+            if (new_reduction_axes.count(i) == 0)
+            {
+                kept_axes.push_back(i);
+            }
+        }
+        new_order.clear();
+        for (size_t i = 0; i < order.size(); i++)
+        {
+            if (reduction_axes.count(i) == 0)
+            {
+                auto it = find(kept_axes.begin(), kept_axes.end(), order.at(i));
+                new_order.push_back(distance(kept_axes.begin(), it));
+            }
+        }
+    }
+
+    // shapes are fixed up once all the reshapes are removed
+    if (new_reduction_axes != reduction_axes)
+    {
+        n->set_reduction_axes(new_reduction_axes);
+    }
+    auto new_reshape = make_reshape(n, new_order, n->get_shape());
+    NGRAPH_DEBUG << "Propagating " << describe_reshape(new_reshape) << " for " << n->get_name();
+    write_reshapemap(reorders, n, new_reshape);
+}
+
+// The broadcast is rewritten to place the axes of its untransposed argument, in order, where
+// the transposed axes used to go. The new axes stay where they are
+static void sink_broadcast(shared_ptr<op::Broadcast> n,
+                           ReshapeMap& reorders,
+                           set<shared_ptr<Node>>& reshapes_to_delete)
+{
+    auto arg_reshape = reorders.at(n->get_argument(0));
+    auto order = arg_reshape->get_input_order();
+    if (order == get_default_order(order.size()))
+    {
+        materialize_shapes(n, reorders, reshapes_to_delete);
+        return;
+    }
+
+    auto def_order = ngraph::get_permutation_to_default_order(order);
+    auto input_shape = ngraph::apply_permutation(arg_reshape->get_shape(), def_order);
+    auto broadcast_axes = n->get_broadcast_axes();
+    auto output_shape = n->get_shape();
+
+    AxisVector source_axes;
+    for (size_t i = 0; i < output_shape.size(); i++)
+    {
+        if (broadcast_axes.count(i) == 0)
+        {
+            source_axes.push_back(i);
+        }
+    }
+
+    Shape new_shape{output_shape};
+    AxisVector new_order = get_default_order(output_shape.size());
+    for (size_t i = 0; i < source_axes.size(); i++)
+    {
+        new_shape.at(source_axes.at(i)) = input_shape.at(i);
+        new_order.at(source_axes.at(i)) = source_axes.at(order.at(i));
+    }
+
+    auto dummy_correct_shape =
+        make_shared<pattern::op::Label>(arg_reshape->get_element_type(), input_shape);
+    auto new_broadcast = make_shared<op::Broadcast>(dummy_correct_shape, new_shape, broadcast_axes);
+    ngraph::replace_node(dummy_correct_shape, n->get_argument(0));
+    NGRAPH_DEBUG << "Replacing " << n->get_name() << " with " << new_broadcast->get_name();
+    ngraph::replace_node(n, new_broadcast);
+
+    auto new_reshape = make_reshape(new_broadcast, new_order, output_shape);
+    NGRAPH_DEBUG << "Propagating " << describe_reshape(new_reshape) << " for " << n->get_name();
+    write_reshapemap(reorders, new_broadcast, new_reshape);
+}
+
 static void sink_dequantize(shared_ptr<op::Dequantize> dequantize,
                             ReshapeMap& reorders,
                             set<shared_ptr<Node>>& /* reshapes_to_delete */)
@@ -586,6 +692,18 @@ bool ngraph::pass::ReshapeSinking::run_on_function(shared_ptr<ngraph::Function>
         {
             sink_concat(concat, reorders, reshapes_to_delete);
         }
+        else if (auto broadcast = as_type_ptr<op::Broadcast>(n))
+        {
+            sink_broadcast(broadcast, reorders, reshapes_to_delete);
+        }
+        else if (auto reduction = dynamic_pointer_cast<op::util::ArithmeticReduction>(n))
+        {
+            sink_reduction(reduction, reorders, reshapes_to_delete);
+        }
+        else if (auto reduction = dynamic_pointer_cast<op::util::LogicalReduction>(n))
+        {
+            sink_reduction(reduction, reorders, reshapes_to_delete);
+        }
         else
         {
             materialize_shapes(n, reorders, reshapes_to_delete);
@@ -0,0 +1,391 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/tensor_iterator.hpp"
+#include "ngraph/pass/tensor_iterator_hoisting.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using InputDescription = op::TensorIterator::InputDescription;
+using SliceInputDescription = op::TensorIterator::SliceInputDescription;
+using MergedInputDescription = op::TensorIterator::MergedInputDescription;
+using InvariantInputDescription = op::TensorIterator::InvariantInputDescription;
+
+namespace
+{
+    // A body parameter and where its value comes from. Only the kind and the slicing of the
+    // description are used; the indices are recomputed when the iterator is rebuilt.
+    struct BodyInput
+    {
+        shared_ptr<op::Parameter> parameter;
+        shared_ptr<InputDescription> description;
+        Output<Node> value;
+    };
+
+    using BodyInputs = unordered_map<Node*, BodyInput>;
+}
+
+static list<shared_ptr<Node>> get_body_ops(const shared_ptr<op::TensorIterator::BodyLambda>& body)
+{
+    NodeVector results;
+    for (auto& result : body->get_results())
+    {
+        results.push_back(result);
+    }
+    return topological_sort(results);
+}
+
+static bool is_invariant_parameter(const BodyInputs& inputs, Node* node)
+{
+    auto it = inputs.find(node);
+    return it != inputs.end() && is_type<InvariantInputDescription>(it->second.description);
+}
+
+// Ops whose value is the same in every iteration: invariant parameters, constants and
+// single-output ops of those. Ops with state or control dependencies are left in the body.
+static unordered_set<Node*> find_invariant_ops(const list<shared_ptr<Node>>& ops,
+                                               const BodyInputs& inputs)
+{
+    unordered_set<Node*> invariant;
+    for (auto& node : ops)
+    {
+        bool is_invariant = false;
+        if (node->is_parameter())
+        {
+            is_invariant = is_invariant_parameter(inputs, node.get());
+        }
+        else if (node->is_constant())
+        {
+            is_invariant = true;
+        }
+        else if (!node->is_output() && node->get_output_size() == 1 && !node->has_state() &&
+                 node->get_control_dependencies().empty() &&
+                 node->get_output_partial_shape(0).is_static())
+        {
+            is_invariant = true;
+            for (auto& input : node->inputs())
+            {
+                if (invariant.count(input.get_source_output().get_node()) == 0)
+                {
+                    is_invariant = false;
+                    break;
+                }
+            }
+        }
+        if (is_invariant)
+        {
+            invariant.insert(node.get());
+        }
+    }
+    return invariant;
+}
+
+// Returns the value of the invariant body op `node` outside of the iterator, cloning the ops it
+// depends on as needed
+static Output<Node> hoist(Node* node,
+                          const BodyInputs& inputs,
+                          unordered_map<Node*, Output<Node>>& hoisted)
+{
+    auto it = hoisted.find(node);
+    if (it != hoisted.end())
+    {
+        return it->second;
+    }
+    Output<Node> value;
+    if (node->is_parameter())
+    {
+        value = inputs.at(node).value;
+    }
+    else
+    {
+        OutputVector args;
+        for (auto& input : node->inputs())
+        {
+            args.push_back(hoist(input.get_source_output().get_node(), inputs, hoisted));
+        }
+        value = node->copy_with_new_inputs(args);
+    }
+    hoisted.emplace(node, value);
+    return value;
+}
+
+// Feeds every invariant value read by a varying op, or returned by the body, through a new
+// invariant parameter computed outside of the iterator
+static bool hoist_invariant_ops(const shared_ptr<op::TensorIterator::BodyLambda>& body,
+                                BodyInputs& inputs,
+                                vector<Node*>& input_order)
+{
+    auto ops = get_body_ops(body);
+    auto invariant = find_invariant_ops(ops, inputs);
+    unordered_map<Node*, Output<Node>> hoisted;
+    unordered_map<Node*, shared_ptr<op::Parameter>> parameters;
+    bool modified = false;
+    for (auto& node : ops)
+    {
+        if (invariant.count(node.get()) != 0)
+        {
+            continue;
+        }
+        for (auto& input : node->inputs())
+        {
+            auto arg = input.get_source_output().get_node();
+            if (invariant.count(arg) == 0 || arg->is_parameter() || arg->is_constant())
+            {
+                continue;
+            }
+            auto& parameter = parameters[arg];
+            if (!parameter)
+            {
+                parameter = make_shared<op::Parameter>(arg->get_output_element_type(0),
+                                                       arg->get_output_shape(0));
+                auto description = make_shared<InvariantInputDescription>(0, 0);
+                inputs[parameter.get()] =
+                    BodyInput{parameter, description, hoist(arg, inputs, hoisted)};
+                input_order.push_back(parameter.get());
+                NGRAPH_DEBUG << "Hoisting " << arg->get_name() << " out of TensorIterator";
+            }
+            input.replace_source_output(parameter->output(0));
+            modified = true;
+        }
+    }
+    return modified;
+}
+
+// The invariant matrix of a Dot, outside of the iterator
+static bool get_invariant_matrix(const shared_ptr<Node>& node,
+                                 const BodyInputs& inputs,
+                                 Output<Node>& value)
+{
+    if (node->is_constant())
+    {
+        value = node->copy_with_new_inputs(OutputVector{});
+        return true;
+    }
+    if (is_invariant_parameter(inputs, node.get()))
+    {
+        value = inputs.at(node.get()).value;
+        return true;
+    }
+    return false;
+}
+
+// Replaces each Dot of a slice of an input by an invariant matrix with the matching slice of
+// one Dot over all iterations. The slice may go through a Reshape that only drops the sliced
+// axis.
+static bool precompute_sliced_dots(const shared_ptr<op::TensorIterator::BodyLambda>& body,
+                                   BodyInputs& inputs,
+                                   vector<Node*>& input_order)
+{
+    bool modified = false;
+    for (auto& node : get_body_ops(body))
+    {
+        auto dot = as_type_ptr<op::Dot>(node);
+        if (!dot || dot->get_reduction_axes_count() != 1)
+        {
+            continue;
+        }
+        Output<Node> matrix;
+        if (!get_invariant_matrix(dot->get_argument(1), inputs, matrix))
+        {
+            continue;
+        }
+
+        auto arg = dot->get_argument(0);
+        auto reshape = as_type_ptr<op::Reshape>(arg);
+        if (reshape)
+        {
+            if (reshape->get_is_transpose())
+            {
+                continue;
+            }
+            arg = reshape->get_argument(0);
+        }
+        auto it = inputs.find(arg.get());
+        if (it == inputs.end())
+        {
+            continue;
+        }
+        auto slice = as_type_ptr<SliceInputDescription>(it->second.description);
+        if (!slice)
+        {
+            continue;
+        }
+        // The sliced axis must not be the reduced one
+        auto slice_shape = arg->get_shape();
+        if (slice->m_axis < 0 || slice->m_axis + 1 >= static_cast<int64_t>(slice_shape.size()))
+        {
+            continue;
+        }
+        if (reshape)
+        {
+            Shape squeezed_shape = slice_shape;
+            squeezed_shape.erase(squeezed_shape.begin() + slice->m_axis);
+            if (slice->m_part_size != 1 || reshape->get_shape() != squeezed_shape)
+            {
+                continue;
+            }
+        }
+
+        auto all_dots = make_shared<op::Dot>(it->second.value, matrix, 1);
+        Shape dot_shape = all_dots->get_shape();
+        dot_shape[slice->m_axis] = slice->m_part_size;
+        auto parameter = make_shared<op::Parameter>(dot->get_element_type(), dot_shape);
+        auto description = make_shared<SliceInputDescription>(0,
+                                                              0,
+                                                              slice->m_start,
+                                                              slice->m_stride,
+                                                              slice->m_part_size,
+                                                              slice->m_end,
+                                                              slice->m_axis);
+        inputs[parameter.get()] = BodyInput{parameter, description, all_dots};
+        input_order.push_back(parameter.get());
+
+        shared_ptr<Node> replacement = parameter;
+        if (reshape)
+        {
+            replacement = make_shared<op::Reshape>(
+                parameter, get_default_order(dot_shape.size()), dot->get_shape());
+        }
+        NGRAPH_DEBUG << "Computing " << dot->get_name() << " for all TensorIterator iterations";
+        replace_node(dot, replacement);
+        modified = true;
+    }
+    return modified;
+}
+
+// Builds an iterator over the rewritten body, without the sliced and invariant inputs the
+// body no longer reads
+static shared_ptr<op::TensorIterator>
+    rebuild_tensor_iterator(const shared_ptr<op::TensorIterator>& tensor_iterator,
+                            const BodyInputs& inputs,
+                            const vector<Node*>& input_order)
+{
+    auto body = tensor_iterator->get_body();
+    unordered_set<Node*> live;
+    for (auto& node : get_body_ops(body))
+    {
+        live.insert(node.get());
+    }
+
+    vector<const BodyInput*> kept;
+    ParameterVector parameters;
+    for (auto node : input_order)
+    {
+        auto& input = inputs.at(node);
+        if (live.count(node) == 0 && !is_type<MergedInputDescription>(input.description))
+        {
+            continue;
+        }
+        kept.push_back(&input);
+        parameters.push_back(input.parameter);
+    }
+
+    auto new_tensor_iterator = make_shared<op::TensorIterator>();
+    new_tensor_iterator->set_body(
+        make_shared<op::TensorIterator::BodyLambda>(body->get_results(), parameters));
+    for (auto input : kept)
+    {
+        if (auto slice = as_type_ptr<SliceInputDescription>(input->description))
+        {
+            new_tensor_iterator->set_sliced_input(input->parameter,
+                                                  input->value,
+                                                  slice->m_start,
+                                                  slice->m_stride,
+                                                  slice->m_part_size,
+                                                  slice->m_end,
+                                                  slice->m_axis);
+        }
+        else if (auto merged = as_type_ptr<MergedInputDescription>(input->description))
+        {
+            new_tensor_iterator->set_merged_input(
+                input->parameter,
+                input->value,
+                body->get_results().at(merged->m_body_value_index)->output(0));
+        }
+        else
+        {
+            new_tensor_iterator->set_invariant_input(input->parameter, input->value);
+        }
+    }
+    for (auto& description : tensor_iterator->get_output_descriptions())
+    {
+        auto result = body->get_results().at(description->m_body_value_index)->output(0);
+        if (auto concat =
+                as_type_ptr<op::TensorIterator::ConcatOutputDescription>(description))
+        {
+            new_tensor_iterator->get_concatenated_slices(result,
+                                                         concat->m_start,
+                                                         concat->m_stride,
+                                                         concat->m_part_size,
+                                                         concat->m_end,
+                                                         concat->m_axis);
+        }
+        else if (auto iteration =
+                     as_type_ptr<op::TensorIterator::BodyOutputDescription>(description))
+        {
+            new_tensor_iterator->get_iter_value(result, iteration->m_iteration);
+        }
+    }
+    new_tensor_iterator->set_num_iterations(tensor_iterator->get_num_iterations());
+    new_tensor_iterator->validate_and_infer_types();
+    return new_tensor_iterator;
+}
+
+bool pass::TensorIteratorHoisting::run_on_function(shared_ptr<Function> f)
+{
+    bool modified = false;
+    for (auto& node : f->get_ordered_ops())
+    {
+        auto tensor_iterator = as_type_ptr<op::TensorIterator>(node);
+        if (!tensor_iterator)
+        {
+            continue;
+        }
+
+        auto body = tensor_iterator->get_body();
+        BodyInputs inputs;
+        vector<Node*> input_order;
+        for (auto& description : tensor_iterator->get_input_descriptions())
+        {
+            auto parameter = body->get_parameters().at(description->m_body_parameter_index);
+            inputs[parameter.get()] =
+                BodyInput{parameter,
+                          description,
+                          tensor_iterator->input_value(description->m_input_index)};
+            input_order.push_back(parameter.get());
+        }
+
+        bool hoisted = hoist_invariant_ops(body, inputs, input_order);
+        bool precomputed = precompute_sliced_dots(body, inputs, input_order);
+        if (hoisted || precomputed)
+        {
+            replace_node(tensor_iterator,
+                         rebuild_tensor_iterator(tensor_iterator, inputs, input_order));
+            modified = true;
+        }
+    }
+    return modified;
+}
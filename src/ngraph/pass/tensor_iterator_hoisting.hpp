@@ -0,0 +1,46 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class TensorIteratorHoisting;
+    }
+}
+
+/// \brief Moves work that does not change between iterations out of TensorIterator bodies.
+///
+/// Body ops whose inputs only come from invariant inputs and constants (weight transposes, bias
+/// broadcasts, reshapes of constants) are computed once outside the iterator and passed in as
+/// new invariant inputs. Then every Dot of a sliced input by an invariant matrix, possibly
+/// through a Reshape that drops the sliced axis, is computed for all iterations as one Dot of
+/// the whole input and passed in as a sliced input; this is the input-to-hidden GEMM of RNN
+/// cells. Sliced and invariant inputs the body no longer reads are removed.
+class NGRAPH_API ngraph::pass::TensorIteratorHoisting : public FunctionPass
+{
+public:
+    TensorIteratorHoisting()
+        : FunctionPass()
+    {
+        set_property(PassProperty::REQUIRE_STATIC_SHAPE, true);
+    }
+    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+};
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdlib>
+
 #include "ngraph/pass/validate.hpp"
 #include "ngraph/graph_util.hpp"
 
@@ -21,6 +23,16 @@ using namespace ngraph;
 
 bool pass::Validate::run_on_function(std::shared_ptr<Function> f)
 {
-    f->validate_nodes_and_infer_types();
+    // Passes that change an attribute of a node without calling set_needs_revalidation are only
+    // caught by validating every node
+    static const bool s_full_validation = std::getenv("NGRAPH_FULL_PASS_VALIDATION") != nullptr;
+    if (s_full_validation)
+    {
+        f->validate_nodes_and_infer_types();
+    }
+    else
+    {
+        f->validate_changed_nodes_and_infer_types();
+    }
     return false;
 }
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <fstream>
+#include <iomanip>
 
 #include "ngraph/file_util.hpp"
 #include "ngraph/function.hpp"
@@ -253,6 +254,25 @@ pass::VisualizeTree::VisualizeTree(const string& file_name, node_modifiers_t nm,
 {
 }
 
+void pass::VisualizeTree::set_performance_data(
+    const vector<runtime::PerformanceCounter>& counters)
+{
+    m_performance.clear();
+    m_total_microseconds = 0;
+    m_max_microseconds = 0;
+    for (auto& counter : counters)
+    {
+        if (!counter.get_node())
+        {
+            continue;
+        }
+        m_performance[counter.get_node()->get_name()] = NodePerformance{
+            counter.total_microseconds(), counter.microseconds(), counter.bytes()};
+        m_total_microseconds += counter.total_microseconds();
+        m_max_microseconds = max(m_max_microseconds, counter.total_microseconds());
+    }
+}
+
 void pass::VisualizeTree::add_node_arguments(shared_ptr<Node> node,
                                              unordered_map<Node*, HeightMap>& height_maps,
                                              size_t& fake_node_ctr)
@@ -392,8 +412,27 @@ string pass::VisualizeTree::get_attributes(shared_ptr<Node> node)
         {
             eh->second(*node, label);
         }
+
+        auto perf = m_performance.find(node->get_name());
+        if (perf != m_performance.end() && m_total_microseconds > 0)
+        {
+            const auto& p = perf->second;
+            label << "\\n" << fixed << setprecision(1)
+                  << 100.0 * p.total_microseconds / m_total_microseconds << "% " << p.microseconds
+                  << "us " << p.bytes << "B";
+        }
         label << "\"";
         attributes.push_back(label.str());
+
+        if (perf != m_performance.end() && m_max_microseconds > 0)
+        {
+            // Red hue, with the saturation given by the time relative to the slowest node
+            stringstream fill;
+            fill << "style=filled fillcolor=\"0.000 " << fixed << setprecision(3)
+                 << static_cast<double>(perf->second.total_microseconds) / m_max_microseconds
+                 << " 1.000\"";
+            attributes.push_back(fill.str());
+        }
     }
 
     if (m_node_modifiers)
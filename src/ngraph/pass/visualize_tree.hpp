@@ -27,6 +27,7 @@
 
 #include "ngraph/pass/manager_state.hpp"
 #include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
 
 namespace ngraph
 {
@@ -49,7 +50,19 @@ public:
     bool run_on_module(std::vector<std::shared_ptr<ngraph::Function>>&) override;
 
     void set_ops_to_details(const visualize_tree_ops_map_t& ops_map) { m_ops_to_details = ops_map; }
+    /// \brief Labels the nodes of a profiled run with their share of the total time, time per
+    ///        call and bytes moved, and fills them with a color that deepens with the share.
+    ///        Counters are matched to nodes by name.
+    void set_performance_data(const std::vector<runtime::PerformanceCounter>& counters);
+
 protected:
+    struct NodePerformance
+    {
+        size_t total_microseconds;
+        size_t microseconds;
+        size_t bytes;
+    };
+
     void add_node_arguments(std::shared_ptr<Node> node,
                             std::unordered_map<Node*, HeightMap>& height_maps,
                             size_t& fake_node_ctr);
@@ -63,6 +76,9 @@ protected:
     std::set<std::shared_ptr<Node>> m_nodes_with_attributes;
     visualize_tree_ops_map_t m_ops_to_details;
     node_modifiers_t m_node_modifiers = nullptr;
+    std::unordered_map<std::string, NodePerformance> m_performance;
+    size_t m_total_microseconds = 0;
+    size_t m_max_microseconds = 0;
     bool m_dot_only;
     static const int max_jump_distance;
 };
@@ -194,6 +194,27 @@ namespace ngraph
             }
         }
 
+        const std::vector<std::shared_ptr<op::Label>>&
+            Matcher::get_pattern_labels(const std::shared_ptr<Node>& pattern_node)
+        {
+            auto it = m_pattern_labels.find(pattern_node.get());
+            if (it != m_pattern_labels.end())
+            {
+                return it->second;
+            }
+            std::vector<std::shared_ptr<op::Label>> labels;
+            if (auto label = as_type_ptr<op::Label>(pattern_node))
+            {
+                labels.push_back(label);
+            }
+            for (auto& arg : pattern_node->get_arguments())
+            {
+                auto& arg_labels = get_pattern_labels(arg);
+                labels.insert(labels.end(), arg_labels.begin(), arg_labels.end());
+            }
+            return m_pattern_labels[pattern_node.get()] = labels;
+        }
+
         bool Matcher::match_node(const std::shared_ptr<Node>& pattern_node,
                                  const std::shared_ptr<Node>& graph_node,
                                  PatternMap& pattern_map)
@@ -203,6 +224,41 @@ namespace ngraph
                 throw ngraph_error("pattern_node or graph_node shouldn't be nullptrs!");
             }
 
+            // Predicates only look at the graph node, so the outcome only depends on the
+            // bindings of the labels below pattern_node. With none of them bound yet, a failure
+            // holds for every later attempt on the same nodes.
+            bool memoize = m_memoize;
+            if (memoize)
+            {
+                for (auto& label : get_pattern_labels(pattern_node))
+                {
+                    if (pattern_map.count(label) != 0)
+                    {
+                        memoize = false;
+                        break;
+                    }
+                }
+            }
+            NodePair key(pattern_node.get(), graph_node.get());
+            if (memoize && m_failed_matches.count(key) != 0)
+            {
+                m_statistics.memo_hits++;
+                return false;
+            }
+
+            bool is_match = match_node_uncached(pattern_node, graph_node, pattern_map);
+            if (memoize && !is_match)
+            {
+                m_failed_matches.insert(key);
+            }
+            return is_match;
+        }
+
+        bool Matcher::match_node_uncached(const std::shared_ptr<Node>& pattern_node,
+                                          const std::shared_ptr<Node>& graph_node,
+                                          PatternMap& pattern_map)
+        {
+            m_statistics.node_visits++;
             add_node(graph_node);
             size_t watermark = m_matched_list.size() - 1;
 
@@ -385,6 +441,7 @@ namespace ngraph
             // clear our state
             m_match_root.reset();
             m_pattern_map.clear();
+            m_matched_list.clear();
 
             // insert previous matches
             m_pattern_map.insert(previous_matches.cbegin(), previous_matches.cend());
@@ -405,25 +462,76 @@ namespace ngraph
             return is_match;
         }
 
+        void RecurrentMatcher::set_memoization(bool enable)
+        {
+            m_memoize = enable;
+            m_cell_matcher.set_memoization(enable);
+            m_cell_cache.clear();
+        }
+
+        void RecurrentMatcher::clear_memo()
+        {
+            m_cell_matcher.clear_memo();
+            m_cell_cache.clear();
+        }
+
+        RecurrentMatcher::Statistics RecurrentMatcher::get_statistics() const
+        {
+            Statistics rc = m_statistics;
+            rc.cell_matcher = m_cell_matcher.get_statistics();
+            return rc;
+        }
+
+        bool RecurrentMatcher::match_cell(const std::shared_ptr<Node>& graph,
+                                          const Matcher::PatternMap& previous_matches,
+                                          Matcher::PatternMap& pattern_map)
+        {
+            m_statistics.cell_attempts++;
+            if (m_memoize)
+            {
+                auto it = m_cell_cache.find(graph.get());
+                if (it != m_cell_cache.end())
+                {
+                    for (auto& cell : it->second)
+                    {
+                        if (cell.previous_matches == previous_matches)
+                        {
+                            m_statistics.cell_cache_hits++;
+                            pattern_map = cell.pattern_map;
+                            return cell.matched;
+                        }
+                    }
+                }
+            }
+
+            bool matched = m_cell_matcher.match(graph, previous_matches);
+            pattern_map = matched ? m_cell_matcher.get_pattern_map() : Matcher::PatternMap{};
+            if (m_memoize)
+            {
+                m_cell_cache[graph.get()].push_back({previous_matches, matched, pattern_map});
+            }
+            return matched;
+        }
+
         bool RecurrentMatcher::match(std::shared_ptr<Node> graph)
         {
             bool matched = false;
-            Matcher m(m_pattern);
             Matcher::PatternMap previous_matches;
+            Matcher::PatternMap cell_matches;
             m_matches.clear();
             m_match_root = graph;
 
             NGRAPH_DEBUG << "matching graph to " << graph->get_name() << std::endl;
             // try to match one cell (i.e. pattern)
-            while (m.match(graph, previous_matches))
+            while (match_cell(graph, previous_matches, cell_matches))
             {
                 matched = true;
                 // move to the next cell
-                graph = m.get_pattern_map()[m_recurrent_pattern];
+                graph = cell_matches[m_recurrent_pattern];
                 NGRAPH_DEBUG << "setting graph to " << graph->get_name() << std::endl;
 
                 // copy bound nodes for the current pattern graph into a global matches map
-                for (auto cur_match : m.get_pattern_map())
+                for (auto& cur_match : cell_matches)
                 {
                     m_matches[cur_match.first].push_back(cur_match.second);
                 }
@@ -432,22 +540,21 @@ namespace ngraph
                 // from the current match. Only bound nodes whose labels are in
                 // correlated_patterns are pre-populated. Skip other labels are
                 // unbounded by default
-                for (auto cor_pat : m_correlated_patterns)
+                for (auto& cor_pat : m_correlated_patterns)
                 {
-                    if (m.get_pattern_map().count(cor_pat) != 0)
+                    auto bound = cell_matches.find(cor_pat);
+                    if (bound != cell_matches.end())
                     {
                         // assert that bound nodes from the previous and current matches are the
                         // same
-                        if (previous_matches.count(cor_pat) != 0)
+                        auto previous = previous_matches.find(cor_pat);
+                        if (previous != previous_matches.end() && previous->second != bound->second)
                         {
-                            if (previous_matches[cor_pat] != m.get_pattern_map()[cor_pat])
-                            {
-                                throw ngraph_error(
-                                    "previous matches and current matches aren't consistent!");
-                            }
+                            throw ngraph_error(
+                                "previous matches and current matches aren't consistent!");
                         }
 
-                        previous_matches[cor_pat] = m.get_pattern_map()[cor_pat];
+                        previous_matches[cor_pat] = bound->second;
                     }
                 }
             }
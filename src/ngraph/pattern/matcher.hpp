@@ -18,6 +18,9 @@
 
 #include <functional>
 #include <memory.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
 #include "ngraph/node.hpp"
 #include "ngraph/op/constant.hpp"
@@ -122,6 +125,28 @@ namespace ngraph
                 return matched;
             }
 
+            /// \brief Counters of the work done by match
+            struct Statistics
+            {
+                /// Graph nodes compared against pattern nodes
+                size_t node_visits = 0;
+                /// Comparisons skipped because they were remembered to fail
+                size_t memo_hits = 0;
+            };
+
+            /// \brief Remembers which pattern nodes failed to match which graph nodes, where
+            ///        the outcome did not depend on labels bound earlier in the match, and
+            ///        fails those comparisons right away in later matches. Only valid while
+            ///        the graph is unchanged: clear_memo() after modifying it. GraphRewrite
+            ///        enables it for the duration of a run.
+            void set_memoization(bool enable)
+            {
+                m_memoize = enable;
+                clear_memo();
+            }
+            bool get_memoization() const { return m_memoize; }
+            void clear_memo() { m_failed_matches.clear(); }
+            const Statistics& get_statistics() const { return m_statistics; }
             bool is_contained_match(const NodeVector& exclusions = {}, bool ignore_unused = true);
             const NodeVector& get_matched_nodes() { return m_matched_list; }
             void reset() {}
@@ -162,7 +187,23 @@ namespace ngraph
             NodeVector m_matched_list;
 
         private:
+            using NodePair = std::pair<const Node*, const Node*>;
+            struct NodePairHash
+            {
+                size_t operator()(const NodePair& pair) const
+                {
+                    return std::hash<const Node*>()(pair.first) * 31 +
+                           std::hash<const Node*>()(pair.second);
+                }
+            };
+
             static std::string pad(size_t num) { return std::string(num, ' '); }
+            bool match_node_uncached(const std::shared_ptr<Node>& pattern_node,
+                                     const std::shared_ptr<Node>& graph_node,
+                                     PatternMap& pattern_map);
+            /// The labels in the pattern subgraph rooted at pattern_node
+            const std::vector<std::shared_ptr<op::Label>>&
+                get_pattern_labels(const std::shared_ptr<Node>& pattern_node);
             bool match_permutation(const NodeVector& pattern_args,
                                    const NodeVector& args,
                                    PatternMap& pattern_map);
@@ -182,6 +223,11 @@ namespace ngraph
             size_t m_depth;
             std::string m_name;
             bool m_strict_mode;
+            bool m_memoize{false};
+            std::unordered_set<NodePair, NodePairHash> m_failed_matches;
+            std::unordered_map<const Node*, std::vector<std::shared_ptr<op::Label>>>
+                m_pattern_labels;
+            Statistics m_statistics;
         };
 
         class RecurrentMatcher
@@ -201,6 +247,7 @@ namespace ngraph
                 : m_pattern(pattern)
                 , m_recurrent_pattern(rpattern)
                 , m_correlated_patterns(correlated_patterns)
+                , m_cell_matcher(pattern)
             {
             }
 
@@ -231,12 +278,48 @@ namespace ngraph
             bool match(std::shared_ptr<Node> graph);
 
             std::shared_ptr<Node> get_match_root() { return m_match_root; }
+            /// \brief Counters of the work done by match
+            struct Statistics
+            {
+                /// Cells matched against the pattern, including cached ones
+                size_t cell_attempts = 0;
+                /// Cells whose outcome was taken from the cache
+                size_t cell_cache_hits = 0;
+                /// Counters of the matcher of individual cells
+                Matcher::Statistics cell_matcher;
+            };
+
+            /// \brief Caches the outcome of matching a cell at each graph node, so that
+            ///        matching at every node of a chain of n cells, as RecurrentGraphRewrite
+            ///        does, matches each cell once rather than O(n) times. Also memoizes the
+            ///        cell matcher, see Matcher::set_memoization. Only valid while the graph is
+            ///        unchanged: clear_memo() after modifying it.
+            void set_memoization(bool enable);
+            void clear_memo();
+            Statistics get_statistics() const;
+
         private:
+            struct CellMatch
+            {
+                Matcher::PatternMap previous_matches;
+                bool matched;
+                Matcher::PatternMap pattern_map;
+            };
+
+            bool match_cell(const std::shared_ptr<Node>& graph,
+                            const Matcher::PatternMap& previous_matches,
+                            Matcher::PatternMap& pattern_map);
+
             std::shared_ptr<Node> m_pattern;
             std::shared_ptr<op::Label> m_recurrent_pattern;
             const std::set<std::shared_ptr<op::Label>> m_correlated_patterns;
             RPatternMap m_matches;
             std::shared_ptr<Node> m_match_root;
+            Matcher m_cell_matcher;
+            bool m_memoize = false;
+            // Outcomes by cell root, one per set of correlated bindings it was matched with
+            std::unordered_map<const Node*, std::vector<CellMatch>> m_cell_cache;
+            Statistics m_statistics;
         };
     }
 }
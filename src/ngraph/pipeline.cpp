@@ -0,0 +1,142 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "ngraph/check.hpp"
+#include "ngraph/pipeline.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+size_t pipeline::get_default_chunk_bytes()
+{
+    static const size_t s_chunk_bytes = []() -> size_t {
+        const char* env = getenv("NGRAPH_PIPELINE_CHUNK_BYTES");
+        return env ? static_cast<size_t>(strtoull(env, nullptr, 10)) : size_t(1) << 20;
+    }();
+    return s_chunk_bytes;
+}
+
+static size_t get_chunk_count(const element::Type& element_type, size_t chunk_bytes)
+{
+    return max(chunk_bytes / element_type.size(), size_t(1));
+}
+
+pipeline::SendChannel::SendChannel(element::Type element_type,
+                                   size_t count,
+                                   int dest_id,
+                                   size_t chunk_bytes)
+    : m_element_type(element_type)
+    , m_count(count)
+    , m_dest_id(dest_id)
+    , m_chunk_count(get_chunk_count(element_type, chunk_bytes))
+{
+    for (auto& buffer : m_buffers)
+    {
+        buffer.resize(count * element_type.size());
+    }
+}
+
+pipeline::SendChannel::~SendChannel()
+{
+    flush();
+}
+
+void* pipeline::SendChannel::get_buffer()
+{
+    if (m_requests[m_current])
+    {
+        m_requests[m_current]->wait();
+        m_requests[m_current].reset();
+    }
+    return m_buffers[m_current].data();
+}
+
+void pipeline::SendChannel::send()
+{
+    NGRAPH_CHECK(!m_requests[m_current], "SendChannel::send() called without get_buffer()");
+    m_requests[m_current] = get_distributed_interface()->send_start(m_buffers[m_current].data(),
+                                                                    m_element_type,
+                                                                    m_count,
+                                                                    m_dest_id,
+                                                                    m_chunk_count);
+    m_current = 1 - m_current;
+}
+
+void pipeline::SendChannel::flush()
+{
+    for (auto& request : m_requests)
+    {
+        if (request)
+        {
+            request->wait();
+            request.reset();
+        }
+    }
+}
+
+pipeline::RecvChannel::RecvChannel(element::Type element_type,
+                                   size_t count,
+                                   int src_id,
+                                   size_t micro_batches,
+                                   size_t chunk_bytes)
+    : m_element_type(element_type)
+    , m_count(count)
+    , m_src_id(src_id)
+    , m_chunk_count(get_chunk_count(element_type, chunk_bytes))
+    , m_remaining(micro_batches)
+{
+    for (auto& buffer : m_buffers)
+    {
+        buffer.resize(count * element_type.size());
+    }
+    start(m_current);
+}
+
+pipeline::RecvChannel::~RecvChannel()
+{
+    for (auto& request : m_requests)
+    {
+        if (request)
+        {
+            request->wait();
+        }
+    }
+}
+
+void pipeline::RecvChannel::start(size_t buffer)
+{
+    if (m_remaining > 0)
+    {
+        m_remaining--;
+        m_requests[buffer] = get_distributed_interface()->recv_start(
+            m_buffers[buffer].data(), m_element_type, m_count, m_src_id, m_chunk_count);
+    }
+}
+
+const void* pipeline::RecvChannel::receive()
+{
+    size_t buffer = m_current;
+    NGRAPH_CHECK(m_requests[buffer], "RecvChannel received more micro-batches than expected");
+    m_requests[buffer]->wait();
+    m_requests[buffer].reset();
+    // The other buffer was handed out by the previous call, which is now over
+    m_current = 1 - m_current;
+    start(m_current);
+    return m_buffers[buffer].data();
+}
@@ -0,0 +1,99 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "ngraph/distributed.hpp"
+#include "ngraph/ngraph_visibility.hpp"
+#include "ngraph/type/element_type.hpp"
+
+namespace ngraph
+{
+    namespace pipeline
+    {
+        /// \brief Size of the messages micro-batches are split into. Defaults to
+        ///        NGRAPH_PIPELINE_CHUNK_BYTES, or 1 MiB.
+        NGRAPH_API size_t get_default_chunk_bytes();
+
+        /// \brief Sends successive micro-batches of a tensor to the next pipeline stage.
+        ///
+        /// Two staging buffers alternate: while one micro-batch is in flight the caller fills
+        /// the other, so the transfer of micro-batch N overlaps the compute of N+1.
+        class NGRAPH_API SendChannel
+        {
+        public:
+            SendChannel(element::Type element_type,
+                        size_t count,
+                        int dest_id,
+                        size_t chunk_bytes = get_default_chunk_bytes());
+            ~SendChannel();
+
+            /// \returns The buffer for the next micro-batch, once the send that last used it has
+            ///          completed
+            void* get_buffer();
+            /// \brief Starts sending the buffer returned by the last get_buffer()
+            void send();
+            /// \brief Waits for all micro-batches to be sent
+            void flush();
+
+        private:
+            element::Type m_element_type;
+            size_t m_count;
+            int m_dest_id;
+            size_t m_chunk_count;
+            std::vector<char> m_buffers[2];
+            std::unique_ptr<DistributedRequest> m_requests[2];
+            size_t m_current = 0;
+        };
+
+        /// \brief Receives the micro-batches sent by a SendChannel of the previous pipeline
+        ///        stage.
+        ///
+        /// The next micro-batch is received into the second staging buffer while the caller
+        /// consumes the current one.
+        class NGRAPH_API RecvChannel
+        {
+        public:
+            /// \param micro_batches Number of micro-batches that will be received, so that no
+            ///        receive is posted past the last one
+            RecvChannel(element::Type element_type,
+                        size_t count,
+                        int src_id,
+                        size_t micro_batches,
+                        size_t chunk_bytes = get_default_chunk_bytes());
+            ~RecvChannel();
+
+            /// \returns The next micro-batch. It stays valid until the following call.
+            const void* receive();
+
+        private:
+            void start(size_t buffer);
+
+            element::Type m_element_type;
+            size_t m_count;
+            int m_src_id;
+            size_t m_chunk_count;
+            size_t m_remaining;
+            std::vector<char> m_buffers[2];
+            std::unique_ptr<DistributedRequest> m_requests[2];
+            size_t m_current = 0;
+        };
+    }
+}
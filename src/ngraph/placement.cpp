@@ -15,11 +15,17 @@
 //*****************************************************************************
 
 #include <deque>
+#include <functional>
+#include <map>
+#include <set>
 #include <sstream>
 
+#include "ngraph/check.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/result.hpp"
 #include "ngraph/placement.hpp"
 #include "ngraph/util.hpp"
 
@@ -39,3 +45,152 @@ std::string ngraph::placement_to_string(Placement placement)
     }
     throw runtime_error("unhandled placement type");
 }
+
+namespace
+{
+    struct StageBuilder
+    {
+        ParameterVector parameters;
+        ResultVector results;
+        // Values of the original function, identified by node and output index, as seen in
+        // this stage
+        map<pair<Node*, size_t>, Output<Node>> values;
+        // Result index of the values this stage passes on to later stages
+        map<pair<Node*, size_t>, size_t> exported;
+    };
+}
+
+// Parameters and unplaced constants are copied into each stage that uses them
+static bool is_copied_per_stage(const Node* node)
+{
+    return node->is_parameter() ||
+           (node->is_constant() && node->get_placement_index() == Node::placement_invalid);
+}
+
+PipelinePartition ngraph::partition_by_placement(const shared_ptr<Function>& f)
+{
+    auto ops = f->get_ordered_ops();
+    set<size_t> placement_indices;
+    for (auto& node : ops)
+    {
+        if (!node->is_output() && !is_copied_per_stage(node.get()))
+        {
+            NGRAPH_CHECK(node->get_placement_index() != Node::placement_invalid,
+                         "Node ",
+                         node->get_name(),
+                         " has no placement index");
+            placement_indices.insert(node->get_placement_index());
+        }
+    }
+    if (placement_indices.empty())
+    {
+        placement_indices.insert(0);
+    }
+
+    PipelinePartition partition;
+    partition.placement_indices.assign(placement_indices.begin(), placement_indices.end());
+    map<size_t, size_t> stage_of_index;
+    for (size_t i = 0; i < partition.placement_indices.size(); i++)
+    {
+        stage_of_index[partition.placement_indices[i]] = i;
+    }
+    auto get_stage = [&](const Node* node) {
+        return is_copied_per_stage(node) ? 0 : stage_of_index.at(node->get_placement_index());
+    };
+
+    auto& parameters = f->get_parameters();
+    map<Node*, size_t> parameter_indices;
+    for (size_t i = 0; i < parameters.size(); i++)
+    {
+        parameter_indices[parameters[i].get()] = i;
+    }
+    partition.parameters.resize(parameters.size());
+
+    vector<StageBuilder> stages(partition.placement_indices.size());
+    // Returns `value` as seen in `stage`, importing it from an earlier stage if needed
+    function<Output<Node>(const Output<Node>&, size_t)> get_value = [&](
+        const Output<Node>& value, size_t stage) -> Output<Node> {
+        auto key = make_pair(value.get_node(), value.get_index());
+        auto& builder = stages[stage];
+        auto it = builder.values.find(key);
+        if (it != builder.values.end())
+        {
+            return it->second;
+        }
+
+        Node* node = value.get_node();
+        Output<Node> imported;
+        if (node->is_constant() && is_copied_per_stage(node))
+        {
+            imported = node->copy_with_new_inputs({})->output(0);
+        }
+        else
+        {
+            auto parameter =
+                make_shared<op::Parameter>(value.get_element_type(), value.get_partial_shape());
+            if (node->is_parameter())
+            {
+                partition.parameters[parameter_indices.at(node)].push_back(
+                    {stage, builder.parameters.size()});
+            }
+            else
+            {
+                size_t src_stage = get_stage(node);
+                NGRAPH_CHECK(src_stage < stage,
+                             "Node ",
+                             node->get_name(),
+                             " is used by a stage with a lower placement index");
+                auto& src_builder = stages[src_stage];
+                auto exported = src_builder.exported.find(key);
+                if (exported == src_builder.exported.end())
+                {
+                    exported = src_builder.exported.insert({key, src_builder.results.size()}).first;
+                    src_builder.results.push_back(
+                        make_shared<op::Result>(src_builder.values.at(key)));
+                }
+                partition.edges.push_back(
+                    {src_stage, exported->second, stage, builder.parameters.size()});
+            }
+            builder.parameters.push_back(parameter);
+            imported = parameter;
+        }
+        builder.values[key] = imported;
+        return imported;
+    };
+
+    for (auto& node : ops)
+    {
+        if (node->is_output() || is_copied_per_stage(node.get()))
+        {
+            continue;
+        }
+        size_t stage = get_stage(node.get());
+        OutputVector args;
+        for (auto& value : node->input_values())
+        {
+            args.push_back(get_value(value, stage));
+        }
+        auto clone = node->copy_with_new_inputs(args);
+        clone->set_placement_index(node->get_placement_index());
+        for (size_t i = 0; i < node->get_output_size(); i++)
+        {
+            stages[stage].values[{node.get(), i}] = clone->output(i);
+        }
+    }
+
+    for (auto& result : f->get_results())
+    {
+        auto value = result->input_value(0);
+        size_t stage = get_stage(value.get_node());
+        auto& builder = stages[stage];
+        partition.results.push_back({stage, builder.results.size()});
+        builder.results.push_back(make_shared<op::Result>(get_value(value, stage)));
+    }
+
+    for (size_t i = 0; i < stages.size(); i++)
+    {
+        partition.stages.push_back(make_shared<Function>(
+            stages[i].results, stages[i].parameters, f->get_name() + "_stage_" + to_string(i)));
+    }
+    return partition;
+}
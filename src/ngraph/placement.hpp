@@ -20,12 +20,16 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "ngraph/log.hpp"
+#include "ngraph/ngraph_visibility.hpp"
 
 namespace ngraph
 {
+    class Function;
+
     enum class Placement
     {
         DEFAULT,
@@ -37,4 +41,35 @@ namespace ngraph
     };
 
     std::string placement_to_string(Placement placement);
+
+    /// \brief A Function split into pipeline stages
+    struct PipelinePartition
+    {
+        /// \brief A value computed by one stage and used by a later one
+        struct Edge
+        {
+            size_t src_stage;
+            size_t src_result;
+            size_t dst_stage;
+            size_t dst_parameter;
+        };
+
+        /// Stage functions, in increasing placement index
+        std::vector<std::shared_ptr<Function>> stages;
+        std::vector<size_t> placement_indices;
+        /// Values to transfer between stages, e.g. with pipeline::SendChannel
+        std::vector<Edge> edges;
+        /// For each parameter of the original function, the (stage, parameter) pairs it feeds
+        std::vector<std::vector<std::pair<size_t, size_t>>> parameters;
+        /// For each result of the original function, the (stage, result) that computes it
+        std::vector<std::pair<size_t, size_t>> results;
+    };
+
+    /// \brief Splits `f` into one stage per node placement index, for pipeline parallelism.
+    ///
+    /// Parameters and constants without a placement index are copied into every stage that
+    /// uses them; every other node must have one. Values may only flow from a stage to a stage
+    /// with a higher placement index.
+    NGRAPH_API
+    PipelinePartition partition_by_placement(const std::shared_ptr<Function>& f);
 }
@@ -19,6 +19,7 @@
 
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/allocator.hpp"
+#include "ngraph/runtime/metrics.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph;
@@ -46,6 +47,7 @@ runtime::AlignedBuffer::AlignedBuffer(size_t byte_size, size_t alignment, Alloca
     {
         m_allocated_buffer = static_cast<char*>(ngraph_malloc(allocation_size));
     }
+    runtime::metrics::record_allocation(m_byte_size);
     m_aligned_buffer = m_allocated_buffer;
     size_t mod = size_t(m_aligned_buffer) % alignment;
 
@@ -71,6 +73,7 @@ runtime::AlignedBuffer::~AlignedBuffer()
 {
     if (m_allocated_buffer != nullptr)
     {
+        runtime::metrics::record_free(m_byte_size);
         if (m_allocator)
         {
             m_allocator->free(m_allocated_buffer);
@@ -66,12 +66,15 @@ public:
         return get_ptr<T>();
     }
 
-private:
-    AlignedBuffer(const AlignedBuffer&) = delete;
-    AlignedBuffer& operator=(const AlignedBuffer&) = delete;
-
+protected:
+    // Derived buffers that provide their own memory leave m_allocated_buffer null so nothing
+    // is freed here
     Allocator* m_allocator;
     char* m_allocated_buffer;
     char* m_aligned_buffer;
     size_t m_byte_size;
+
+private:
+    AlignedBuffer(const AlignedBuffer&) = delete;
+    AlignedBuffer& operator=(const AlignedBuffer&) = delete;
 };
@@ -26,6 +26,7 @@
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/dynamic/dynamic_backend.hpp"
+#include "ngraph/runtime/tensor_pool.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -89,6 +90,31 @@ vector<string> runtime::Backend::get_registered_devices()
     return BackendManager::get_registered_backends();
 }
 
+std::shared_ptr<ngraph::runtime::Tensor>
+    runtime::Backend::create_tensor(const ngraph::element::Type& element_type,
+                                    const Shape& shape,
+                                    void* memory_pointer,
+                                    std::function<void(void*)> deleter)
+{
+    if (!is_supported_property(Property::memory_attach))
+    {
+        throw ngraph_error("Backend does not support attaching memory to tensors");
+    }
+    auto tensor = create_tensor(element_type, shape, memory_pointer);
+    if (!deleter)
+    {
+        return tensor;
+    }
+    // The returned pointer owns the backend tensor, which must be gone before the buffer is
+    // handed back to the caller
+    auto raw = tensor.get();
+    return shared_ptr<runtime::Tensor>(
+        raw, [tensor, memory_pointer, deleter](runtime::Tensor*) mutable {
+            tensor.reset();
+            deleter(memory_pointer);
+        });
+}
+
 std::shared_ptr<ngraph::runtime::Tensor>
     runtime::Backend::create_dynamic_tensor(const ngraph::element::Type& /* element_type */,
                                             const PartialShape& /* shape */)
@@ -104,6 +130,24 @@ std::shared_ptr<runtime::Executable>
     return compile(func, enable_performance_data);
 }
 
+future<shared_ptr<runtime::Executable>>
+    runtime::Backend::compile_async(shared_ptr<Function> func,
+                                    const ngraph::pass::PassConfig& pass_config,
+                                    bool enable_performance_data)
+{
+    ngraph::pass::PassConfig config = pass_config;
+    return async(launch::async,
+                 [this, func, config, enable_performance_data]() mutable
+                 -> shared_ptr<Executable> {
+                     unique_lock<mutex> lock(m_compile_mutex, defer_lock);
+                     if (!is_supported_property(Property::concurrent_compile))
+                     {
+                         lock.lock();
+                     }
+                     return compile(func, config, enable_performance_data);
+                 });
+}
+
 bool runtime::Backend::is_supported(const Node& /* node */) const
 {
     // The default behavior is that a backend does not support any ops. If this is not the case
@@ -173,3 +217,13 @@ bool runtime::Backend::executable_can_create_tensors()
     remove_compiled_function(exec);
     return exec_can_create_tensors;
 }
+
+shared_ptr<runtime::TensorPool> runtime::Backend::get_tensor_pool()
+{
+    lock_guard<mutex> lock(m_tensor_pool_mutex);
+    if (!m_tensor_pool)
+    {
+        m_tensor_pool = make_shared<TensorPool>(this);
+    }
+    return m_tensor_pool;
+}
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <functional>
+#include <future>
 #include <memory>
 #include <mutex>
 
@@ -33,6 +35,7 @@ namespace ngraph
     namespace runtime
     {
         class Tensor;
+        class TensorPool;
         class Backend;
     }
 }
@@ -78,6 +81,23 @@ public:
     virtual std::shared_ptr<ngraph::runtime::Tensor> create_tensor(
         const ngraph::element::Type& element_type, const Shape& shape, void* memory_pointer) = 0;
 
+    /// \brief Create a tensor that takes ownership of a caller-provided buffer
+    /// \param element_type The type of the tensor element
+    /// \param shape The shape of the tensor
+    /// \param memory_pointer A pointer to a buffer used for this tensor. The size of the buffer
+    ///     must be sufficient to contain the tensor.
+    /// \param deleter Called with `memory_pointer` once the returned tensor, and every copy of
+    ///     the shared_ptr, has been released. May be used to free the buffer or to drop a
+    ///     reference held on it. If empty the buffer is not released, as with the overload
+    ///     above.
+    /// \returns shared_ptr to a new backend-specific tensor
+    /// \throws ngraph_error if the backend does not support Property::memory_attach
+    std::shared_ptr<ngraph::runtime::Tensor>
+        create_tensor(const ngraph::element::Type& element_type,
+                      const Shape& shape,
+                      void* memory_pointer,
+                      std::function<void(void*)> deleter);
+
     /// \brief Create a tensor of C type T specific to this backend
     /// \param shape The shape of the tensor
     /// \returns shared_ptr to a new backend specific tensor
@@ -112,6 +132,19 @@ public:
                                                 ngraph::pass::PassConfig& pass_config,
                                                 bool enable_performance_data = false);
 
+    /// \brief Compiles a Function on another thread.
+    ///
+    /// Compiles of different functions run in parallel on backends that support
+    /// Property::concurrent_compile and one at a time on others. The backend must outlive the
+    /// returned future.
+    /// \param func The function to compile; it must not be modified until the future is ready
+    /// \param pass_config Configuration object for defining compilation options, copied
+    /// \returns A future for the compiled function, rethrowing any compilation error
+    std::future<std::shared_ptr<Executable>>
+        compile_async(std::shared_ptr<Function> func,
+                      const ngraph::pass::PassConfig& pass_config = ngraph::pass::PassConfig(),
+                      bool enable_performance_data = false);
+
     /// \brief Loads a previously saved Executable object from a stream.
     /// \param input_stream the opened input stream containing the saved Executable
     /// \returns A compiled function or throws an exception on error
@@ -125,7 +158,8 @@ public:
     /// \brief A set of properties supported by a backend
     enum class Property
     {
-        memory_attach /// New tensor can use attached memory
+        memory_attach,     /// New tensor can use attached memory
+        concurrent_compile /// Different functions may be compiled at the same time
     };
 
     /// \brief Test if a backend particular property is supported
@@ -175,6 +209,10 @@ public:
 
     virtual bool executable_can_create_tensors();
 
+    /// \brief The pool of reusable tensors of this backend, created on first use. Checked out
+    ///        tensors return to it when released; see TensorPool.
+    std::shared_ptr<TensorPool> get_tensor_pool();
+
     /// \brief Get the version of the backend
     /// The default value of 0.0.0 is chosen to be a parsable version number
     virtual std::string get_version() const { return "0.0.0"; }
@@ -182,4 +220,9 @@ private:
     // mutex to modify s_backend_shared_library_search_directory thread safe
     static std::mutex m_mtx;
     static std::string s_backend_shared_library_search_directory;
+
+    // Serializes compile_async on backends without Property::concurrent_compile
+    std::mutex m_compile_mutex;
+    std::mutex m_tensor_pool_mutex;
+    std::shared_ptr<TensorPool> m_tensor_pool;
 };
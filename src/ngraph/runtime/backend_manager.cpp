@@ -20,6 +20,7 @@
 #include <dlfcn.h>
 #endif
 
+#include <cstdlib>
 #include <sstream>
 
 #include "ngraph/file_util.hpp"
@@ -54,17 +55,46 @@ unordered_map<string, runtime::BackendConstructor>& runtime::BackendManager::get
     return s_registered_backend;
 }
 
+mutex& runtime::BackendManager::get_registry_mutex()
+{
+    static mutex s_registry_mutex;
+    return s_registry_mutex;
+}
+
+// Library loads started by load_library, by backend name
+static unordered_map<string, shared_future<string>>& get_library_loads()
+{
+    static unordered_map<string, shared_future<string>> s_library_loads;
+    return s_library_loads;
+}
+
+// strip off attributes, IE:CPU becomes IE
+static string get_backend_type(const string& config)
+{
+    string type = config;
+    auto colon = type.find(":");
+    if (colon != type.npos)
+    {
+        type = type.substr(0, colon);
+    }
+    return type;
+}
+
 void runtime::BackendManager::register_backend(const string& name, BackendConstructor new_backend)
 {
+    lock_guard<mutex> lock(get_registry_mutex());
     get_registry()[name] = new_backend;
 }
 
 vector<string> runtime::BackendManager::get_registered_backends()
 {
     vector<string> rc;
-    for (const auto& p : get_registry())
     {
-        rc.push_back(p.first);
+        lock_guard<mutex> lock(get_registry_mutex());
+        for (const auto& p : get_registry())
+        {
+            rc.push_back(p.first);
+        }
     }
     for (const auto& p : get_registered_device_map())
     {
@@ -76,68 +106,140 @@ vector<string> runtime::BackendManager::get_registered_backends()
     return rc;
 }
 
-shared_ptr<runtime::Backend> runtime::BackendManager::create_backend(const std::string& config)
+void runtime::BackendManager::preload_backends(const vector<string>& types)
 {
-    string type = config;
+#ifdef NGRAPH_DYNAMIC_COMPONENTS_ENABLE
+    for (const string& config : types)
+    {
+        load_library(get_backend_type(config), launch::async);
+    }
+#else
+    (void)types;
+#endif
+}
 
-    // strip off attributes, IE:CPU becomes IE
-    auto colon = type.find(":");
-    if (colon != type.npos)
+shared_future<string> runtime::BackendManager::load_library(const string& type, launch policy)
+{
+    lock_guard<mutex> lock(get_registry_mutex());
+    auto& loads = get_library_loads();
+    auto it = loads.find(type);
+    if (it != loads.end())
     {
-        type = type.substr(0, colon);
+        return it->second;
     }
+    if (get_registry().count(type) != 0)
+    {
+        promise<string> registered;
+        registered.set_value("");
+        return registered.get_future().share();
+    }
+    // The load registers the backend itself, so it must not run under the registry lock
+    shared_future<string> load = async(policy, [type]() { return register_library(type); });
+    loads.insert({type, load});
+    return load;
+}
 
-    auto& registry = get_registry();
-    auto it = registry.find(type);
+string runtime::BackendManager::register_library(const string& type)
+{
     string error;
 #ifdef NGRAPH_DYNAMIC_COMPONENTS_ENABLE
-    if (it == registry.end())
+    DL_HANDLE handle = open_shared_library(type);
+    if (!handle)
+    {
+        error = DLERROR();
+    }
+    else
     {
-        DL_HANDLE handle = open_shared_library(type);
-        if (!handle)
+        DLERROR(); // Clear any pending errors
+        string register_function_name = string("ngraph_register_") + to_lower(type) + "_backend";
+        auto register_function =
+            reinterpret_cast<void (*)()>(DLSYM(handle, register_function_name.c_str()));
+        if (register_function)
         {
-            error = DLERROR();
+            register_function();
         }
         else
         {
-            DLERROR(); // Clear any pending errors
-            string register_function_name =
-                string("ngraph_register_") + to_lower(type) + "_backend";
-            auto register_function =
-                reinterpret_cast<void (*)()>(DLSYM(handle, register_function_name.c_str()));
-            if (register_function)
+            error = DLERROR();
+            CLOSE_LIBRARY(handle);
+            stringstream ss;
+            ss << "Failed to find symbol 'get_backend_constructor_pointer' in backend library."
+               << endl;
+            if (error.size() > 0)
             {
-                register_function();
-                it = registry.find(type);
+                ss << "\nError: " << error;
             }
-            else
+            error = ss.str();
+        }
+    }
+#else
+    (void)type;
+#endif
+    return error;
+}
+
+shared_ptr<runtime::Backend> runtime::BackendManager::create_backend(const std::string& config)
+{
+    static once_flag s_preloaded;
+    call_once(s_preloaded, []() {
+        if (const char* env = getenv("NGRAPH_PRELOAD_BACKENDS"))
+        {
+            vector<string> types;
+            for (const string& type : split(env, ',', true))
             {
-                error = DLERROR();
-                CLOSE_LIBRARY(handle);
-                stringstream ss;
-                ss << "Failed to find symbol 'get_backend_constructor_pointer' in backend library."
-                   << endl;
-                if (error.size() > 0)
+                if (!type.empty())
                 {
-                    ss << "\nError: " << error;
+                    types.push_back(type);
                 }
-                error = ss.str();
             }
+            preload_backends(types);
         }
+    });
+
+    string type = get_backend_type(config);
+    string error;
+#ifdef NGRAPH_DYNAMIC_COMPONENTS_ENABLE
+    // Loads the library here unless it is registered or already being loaded. A failed load is
+    // forgotten so that a later call tries again.
+    auto forget_load = [&type]() {
+        lock_guard<mutex> lock(get_registry_mutex());
+        get_library_loads().erase(type);
+    };
+    try
+    {
+        error = load_library(type, launch::deferred).get();
+    }
+    catch (...)
+    {
+        forget_load();
+        throw;
+    }
+    if (error.size() > 0)
+    {
+        forget_load();
     }
 #endif
 
-    if (it == registry.end())
+    BackendConstructor constructor;
+    {
+        lock_guard<mutex> lock(get_registry_mutex());
+        auto it = get_registry().find(type);
+        if (it != get_registry().end())
+        {
+            constructor = it->second;
+        }
+    }
+    if (!constructor)
     {
         stringstream ss;
         ss << "Backend '" << type << "' not registered.";
         if (error.size() > 0)
         {
-            ss << "\n  Error: " << DLERROR();
+            ss << "\n  Error: " << error;
         }
         throw runtime_error(ss.str());
     }
-    return it->second(config);
+    return constructor(config);
 }
 
 DL_HANDLE runtime::BackendManager::open_shared_library(string type)
@@ -17,8 +17,10 @@
 #pragma once
 
 #include <functional>
+#include <future>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -60,13 +62,32 @@ public:
     /// \returns A vector of all registered devices.
     static std::vector<std::string> get_registered_backends();
 
+    /// \brief Starts loading the shared libraries of the given backends on background threads,
+    ///    so that they are loaded and linked while the caller does other work. Backend::create
+    ///    waits for a pending load of the backend it creates. Only the named libraries are
+    ///    opened; this has no effect on backends that are already registered or on builds
+    ///    without dynamic backends.
+    ///
+    ///    The backends named in the comma-separated NGRAPH_PRELOAD_BACKENDS are preloaded when
+    ///    the first backend is created.
+    /// \param types The names of the backends to load, e.g. "CPU".
+    static NGRAPH_API void preload_backends(const std::vector<std::string>& types);
+
 private:
-    static void initialize_backends();
     static std::shared_ptr<runtime::Backend> create_backend(const std::string& type);
     static std::unordered_map<std::string, BackendConstructor>& get_registry();
 
     static std::unordered_map<std::string, BackendConstructor> s_registered_backend;
 
+    static std::mutex& get_registry_mutex();
+
+    /// \brief Returns the load of the library of backend `type`, starting it with `policy` if
+    ///    there is none. The load yields an error message, which is empty on success.
+    static std::shared_future<std::string> load_library(const std::string& type,
+                                                        std::launch policy);
+    /// \brief Opens the library of backend `type` and calls its registration function.
+    /// \returns An error message, which is empty on success.
+    static std::string register_library(const std::string& type);
     static DL_HANDLE open_shared_library(std::string type);
     static std::map<std::string, std::string> get_registered_device_map();
     static bool is_backend_name(const std::string& file, std::string& backend_name);
@@ -0,0 +1,180 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "ngraph/op/avg_pool.hpp"
+#include "ngraph/op/batch_norm.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/select.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/util/arithmetic_reduction.hpp"
+#include "ngraph/op/util/index_reduction.hpp"
+#include "ngraph/op/util/logical_reduction.hpp"
+#include "ngraph/runtime/batching/batch_rows.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// How the rows of the batch pass through an op
+enum class BatchRows
+{
+    // No input of the op holds rows of the batch
+    NONE,
+    // Row i of each output is computed from row i of the batched inputs alone
+    KEPT,
+    // Rows of the batch are combined or reordered, or the op is not known to keep them apart
+    MIXED
+};
+
+static bool is_constant_input(const Node& node, size_t i)
+{
+    return is_type<op::Constant>(node.input_value(i).get_node());
+}
+
+static BatchRows get_batch_rows(const shared_ptr<Node>& node,
+                                const unordered_set<descriptor::Tensor*>& batched)
+{
+    vector<bool> is_batched;
+    for (auto& input : node->inputs())
+    {
+        is_batched.push_back(batched.count(input.get_tensor_ptr().get()) != 0);
+    }
+    if (find(is_batched.begin(), is_batched.end(), true) == is_batched.end())
+    {
+        return BatchRows::NONE;
+    }
+    auto rows_kept_if = [](bool kept) { return kept ? BatchRows::KEPT : BatchRows::MIXED; };
+
+    if (node->is_unary_elementwise_arithmetic() || node->is_binary_elementwise_arithmetic() ||
+        node->is_binary_elementwise_comparison() || node->is_binary_elementwise_logical() ||
+        is_type<op::Convert>(node) || is_type<op::Select>(node))
+    {
+        // Broadcasting a batched input to a higher rank would move its rows off axis 0
+        size_t rank = node->get_output_shape(0).size();
+        for (size_t i = 0; i < is_batched.size(); i++)
+        {
+            if (is_batched[i] && node->get_input_shape(i).size() != rank)
+            {
+                return BatchRows::MIXED;
+            }
+        }
+        return BatchRows::KEPT;
+    }
+    if (is_type<op::Result>(node) || is_type<op::GetOutputElement>(node))
+    {
+        return BatchRows::KEPT;
+    }
+    if (auto reduction = dynamic_pointer_cast<op::util::ArithmeticReduction>(node))
+    {
+        return rows_kept_if(is_constant_input(*node, 1) &&
+                            reduction->get_reduction_axes().count(0) == 0);
+    }
+    if (auto reduction = dynamic_pointer_cast<op::util::LogicalReduction>(node))
+    {
+        return rows_kept_if(is_constant_input(*node, 1) &&
+                            reduction->get_reduction_axes().count(0) == 0);
+    }
+    if (auto reduction = dynamic_pointer_cast<op::util::IndexReduction>(node))
+    {
+        return rows_kept_if(reduction->get_reduction_axis() != 0);
+    }
+    if (auto softmax = as_type_ptr<op::Softmax>(node))
+    {
+        return rows_kept_if(softmax->are_axes_constant() && softmax->get_axes().count(0) == 0);
+    }
+    if (auto reshape = as_type_ptr<op::Reshape>(node))
+    {
+        const Shape& input_shape = node->get_input_shape(0);
+        const Shape& output_shape = node->get_output_shape(0);
+        return rows_kept_if(!input_shape.empty() && !output_shape.empty() &&
+                            reshape->get_input_order().at(0) == 0 &&
+                            input_shape[0] == output_shape[0]);
+    }
+    if (auto broadcast = as_type_ptr<op::Broadcast>(node))
+    {
+        return rows_kept_if(broadcast->get_broadcast_axes().count(0) == 0);
+    }
+    if (auto dot = as_type_ptr<op::Dot>(node))
+    {
+        return rows_kept_if(!is_batched[1] &&
+                            dot->get_reduction_axes_count() < node->get_input_shape(0).size());
+    }
+    if (is_type<op::Convolution>(node) || is_type<op::MaxPool>(node) ||
+        is_type<op::AvgPool>(node))
+    {
+        return rows_kept_if(is_batched.size() < 2 || !is_batched[1]);
+    }
+    if (is_type<op::BatchNormInference>(node))
+    {
+        // Only the data, input 2, may be batched; the statistics are per channel
+        for (size_t i = 0; i < is_batched.size(); i++)
+        {
+            if (is_batched[i] && i != 2)
+            {
+                return BatchRows::MIXED;
+            }
+        }
+        return BatchRows::KEPT;
+    }
+    if (auto slice = as_type_ptr<op::Slice>(node))
+    {
+        return rows_kept_if(slice->get_lower_bounds().at(0) == 0 &&
+                            slice->get_upper_bounds().at(0) == node->get_input_shape(0).at(0) &&
+                            slice->get_strides().at(0) == 1);
+    }
+    if (auto concat = as_type_ptr<op::Concat>(node))
+    {
+        return rows_kept_if(concat->get_concatenation_axis() != 0);
+    }
+    // BatchNormTraining, Gather, Reverse, TopK and the rest are not known to keep rows apart
+    return BatchRows::MIXED;
+}
+
+bool runtime::batching::keeps_batch_rows_apart(const Function& func)
+{
+    unordered_set<descriptor::Tensor*> batched;
+    for (auto& param : func.get_parameters())
+    {
+        batched.insert(param->output(0).get_tensor_ptr().get());
+    }
+    for (auto& node : func.get_ordered_ops())
+    {
+        switch (get_batch_rows(node, batched))
+        {
+        case BatchRows::NONE: break;
+        case BatchRows::KEPT:
+            for (auto& output : node->outputs())
+            {
+                batched.insert(output.get_tensor_ptr().get());
+            }
+            break;
+        case BatchRows::MIXED: return false;
+        }
+    }
+    return true;
+}
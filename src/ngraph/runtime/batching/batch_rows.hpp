@@ -0,0 +1,39 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/function.hpp"
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace batching
+        {
+            /// \brief Checks that a function may run on any subset of the rows of a batch.
+            ///
+            /// Axis 0 of every Parameter is taken as the batch. Ops that combine or reorder
+            /// rows of the batch, such as a Sum or Softmax over axis 0, a transpose or a
+            /// training BatchNorm, break this, as do ops that are not known to keep rows apart.
+            /// \returns true if row i along axis 0 of every value computed from the
+            ///          Parameters depends only on row i of the Parameters
+            NGRAPH_API
+            bool keeps_batch_rows_apart(const Function& func);
+        }
+    }
+}
@@ -0,0 +1,213 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/check.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/runtime/batching/batch_rows.hpp"
+#include "ngraph/runtime/batching/batching_executable.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::batching::BatchingExecutable::BatchingExecutable(shared_ptr<Function> function,
+                                                          shared_ptr<runtime::Backend> backend,
+                                                          size_t max_batch,
+                                                          chrono::microseconds window,
+                                                          bool enable_performance_collection)
+    : m_backend(backend)
+    , m_max_batch(max_batch)
+    , m_window(window)
+    , m_zero_copy(backend->is_supported_property(runtime::Backend::Property::memory_attach))
+{
+    NGRAPH_CHECK(max_batch > 0, "BatchingExecutable requires a max_batch of at least 1");
+    // Requests are stacked along axis 0, so an op that combines rows there would mix requests
+    NGRAPH_CHECK(keeps_batch_rows_apart(*function),
+                 "BatchingExecutable requires a function whose ops keep the rows of axis 0 "
+                 "apart");
+    set_parameters_and_results(*function);
+
+    // Build a clone whose batch dimension is max_batch times larger and let validation
+    // propagate the new shapes through the graph.
+    auto batched_function = clone_function(*function);
+    for (auto& param : batched_function->get_parameters())
+    {
+        const PartialShape& shape = param->get_output_partial_shape(0);
+        NGRAPH_CHECK(shape.is_static() && static_cast<size_t>(shape.rank()) > 0,
+                     "BatchingExecutable requires static, non-scalar parameters; got ",
+                     shape,
+                     " for ",
+                     param->get_name());
+        Shape batched_shape = shape.to_shape();
+        batched_shape[0] *= max_batch;
+        param->set_partial_shape(batched_shape);
+    }
+    batched_function->validate_nodes_and_infer_types();
+
+    const ResultVector& results = get_results();
+    const ResultVector& batched_results = batched_function->get_results();
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const Shape& shape = results[i]->get_shape();
+        const Shape& batched_shape = batched_results[i]->get_shape();
+        NGRAPH_CHECK(shape.size() > 0 && batched_shape.size() == shape.size() &&
+                         batched_shape[0] == shape[0] * max_batch &&
+                         equal(shape.begin() + 1, shape.end(), batched_shape.begin() + 1),
+                     "Result ",
+                     i,
+                     " does not scale with the batch dimension: ",
+                     shape,
+                     " became ",
+                     batched_shape);
+    }
+
+    m_batched_executable = backend->compile(batched_function, enable_performance_collection);
+
+    for (auto& param : batched_function->get_parameters())
+    {
+        const element::Type& type = param->get_element_type();
+        const Shape& shape = param->get_shape();
+        size_t byte_size = shape_size(shape) * type.size();
+        m_input_sizes.push_back(byte_size / max_batch);
+        m_input_staging.emplace_back(byte_size);
+        m_batched_inputs.push_back(
+            m_zero_copy ? backend->create_tensor(type, shape, m_input_staging.back().get_ptr())
+                        : backend->create_tensor(type, shape));
+    }
+    for (auto& result : batched_results)
+    {
+        const element::Type& type = result->get_element_type();
+        const Shape& shape = result->get_shape();
+        size_t byte_size = shape_size(shape) * type.size();
+        m_output_sizes.push_back(byte_size / max_batch);
+        m_output_staging.emplace_back(byte_size);
+        m_batched_outputs.push_back(
+            m_zero_copy ? backend->create_tensor(type, shape, m_output_staging.back().get_ptr())
+                        : backend->create_tensor(type, shape));
+    }
+}
+
+bool runtime::batching::BatchingExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                                 const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    auto request = make_shared<Request>();
+    request->outputs = outputs;
+    request->inputs = inputs;
+
+    unique_lock<mutex> lock(m_queue_mutex);
+    m_queue.push_back(request);
+    m_queue_cv.notify_all();
+    while (!request->finished)
+    {
+        if (!m_leader_active && !m_queue.empty())
+        {
+            // Become the leader: gather requests until the batch is full or the window closes
+            m_leader_active = true;
+            m_queue_cv.wait_for(lock, m_window, [this]() { return m_queue.size() >= m_max_batch; });
+            size_t count = min(m_queue.size(), m_max_batch);
+            vector<shared_ptr<Request>> batch(m_queue.begin(), m_queue.begin() + count);
+            m_queue.erase(m_queue.begin(), m_queue.begin() + count);
+
+            // Let the next leader start gathering while this batch runs
+            m_leader_active = false;
+            m_queue_cv.notify_all();
+
+            lock.unlock();
+            run_batch(batch);
+            lock.lock();
+        }
+        else
+        {
+            m_queue_cv.wait(lock);
+        }
+    }
+
+    if (request->error)
+    {
+        rethrow_exception(request->error);
+    }
+    return request->rc;
+}
+
+void runtime::batching::BatchingExecutable::run_batch(const vector<shared_ptr<Request>>& batch)
+{
+    bool rc = false;
+    exception_ptr error;
+    {
+        lock_guard<mutex> run_lock(m_run_mutex);
+        try
+        {
+            for (size_t i = 0; i < m_batched_inputs.size(); i++)
+            {
+                char* staging = m_input_staging[i].get_ptr<char>();
+                for (size_t r = 0; r < batch.size(); r++)
+                {
+                    batch[r]->inputs[i]->read(staging + r * m_input_sizes[i], m_input_sizes[i]);
+                }
+                // Zero the rows of a partial batch rather than rerun those of an earlier one
+                fill(staging + batch.size() * m_input_sizes[i],
+                     staging + m_input_staging[i].size(),
+                     0);
+                if (m_zero_copy)
+                {
+                    m_batched_inputs[i]->set_stale(true);
+                }
+                else
+                {
+                    m_batched_inputs[i]->write(staging, m_input_staging[i].size());
+                }
+            }
+
+            rc = m_batched_executable->call(m_batched_outputs, m_batched_inputs);
+
+            for (size_t i = 0; i < m_batched_outputs.size(); i++)
+            {
+                char* staging = m_output_staging[i].get_ptr<char>();
+                if (!m_zero_copy)
+                {
+                    m_batched_outputs[i]->read(staging, m_output_staging[i].size());
+                }
+                for (size_t r = 0; r < batch.size(); r++)
+                {
+                    batch[r]->outputs[i]->write(staging + r * m_output_sizes[i],
+                                                m_output_sizes[i]);
+                }
+            }
+        }
+        catch (...)
+        {
+            error = current_exception();
+        }
+        m_batch_count++;
+        m_request_count += batch.size();
+    }
+
+    lock_guard<mutex> lock(m_queue_mutex);
+    for (auto& request : batch)
+    {
+        request->rc = rc;
+        request->error = error;
+        request->finished = true;
+    }
+    m_queue_cv.notify_all();
+}
+
+vector<runtime::PerformanceCounter>
+    runtime::batching::BatchingExecutable::get_performance_data() const
+{
+    return m_batched_executable->get_performance_data();
+}
@@ -0,0 +1,116 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace batching
+        {
+            class BatchingExecutable;
+        }
+    }
+}
+
+///
+/// \brief Executable that coalesces concurrent small-batch calls into one larger call.
+///
+/// The wrapped function is recompiled with the leading (batch) dimension of every
+/// Parameter and Result multiplied by `max_batch`. Each `call` is queued; the first
+/// caller to find the queue empty becomes the leader for that batch and waits until either
+/// `max_batch` requests are queued or `window` has elapsed. The leader then concatenates the
+/// inputs of all gathered requests along axis 0, runs the batched executable once and
+/// scatters the outputs back. The inputs of the unused rows of a partially filled batch are
+/// zeroed and their outputs are not copied out.
+///
+/// Every request must use tensors whose shapes match the original function exactly. The
+/// function must keep the rows of axis 0 apart (see keeps_batch_rows_apart); one with ops
+/// that combine them, such as a Sum or Softmax over axis 0, is rejected. Graphs whose ops
+/// hard-code the batch size (for example a Reshape with a fixed output shape) will fail
+/// validation when the batched clone is built.
+///
+class ngraph::runtime::batching::BatchingExecutable : public ngraph::runtime::Executable
+{
+public:
+    BatchingExecutable(std::shared_ptr<Function> function,
+                       std::shared_ptr<runtime::Backend> backend,
+                       size_t max_batch,
+                       std::chrono::microseconds window,
+                       bool enable_performance_collection = false);
+
+    bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    std::vector<PerformanceCounter> get_performance_data() const override;
+
+    /// \returns the number of batched executions performed so far
+    size_t get_batch_count() const { return m_batch_count; }
+    /// \returns the number of requests served so far
+    size_t get_request_count() const { return m_request_count; }
+private:
+    struct Request
+    {
+        std::vector<std::shared_ptr<runtime::Tensor>> outputs;
+        std::vector<std::shared_ptr<runtime::Tensor>> inputs;
+        bool finished = false;
+        bool rc = false;
+        std::exception_ptr error;
+    };
+
+    void run_batch(const std::vector<std::shared_ptr<Request>>& batch);
+
+    std::shared_ptr<runtime::Backend> m_backend;
+    std::shared_ptr<runtime::Executable> m_batched_executable;
+    size_t m_max_batch;
+    std::chrono::microseconds m_window;
+
+    // Per-request byte sizes of each input and output
+    std::vector<size_t> m_input_sizes;
+    std::vector<size_t> m_output_sizes;
+
+    // Host staging buffers and the batched tensors that view or mirror them
+    std::vector<AlignedBuffer> m_input_staging;
+    std::vector<AlignedBuffer> m_output_staging;
+    std::vector<std::shared_ptr<runtime::Tensor>> m_batched_inputs;
+    std::vector<std::shared_ptr<runtime::Tensor>> m_batched_outputs;
+    bool m_zero_copy;
+
+    std::mutex m_queue_mutex;
+    std::condition_variable m_queue_cv;
+    std::deque<std::shared_ptr<Request>> m_queue;
+    bool m_leader_active = false;
+
+    // Only one batch runs at a time since the staging buffers are shared
+    std::mutex m_run_mutex;
+    std::atomic<size_t> m_batch_count{0};
+    std::atomic<size_t> m_request_count{0};
+};
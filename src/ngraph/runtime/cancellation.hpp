@@ -0,0 +1,71 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+#include "ngraph/except.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class CancellationToken;
+        class call_cancelled;
+    }
+}
+
+/// \brief Lets the caller of Executable::call_cancellable give up on the call, either
+///        explicitly or once a deadline passes. Backends check the token between ops.
+class ngraph::runtime::CancellationToken
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    CancellationToken() = default;
+    /// \param deadline Calls are cancelled once Clock::now() reaches it
+    explicit CancellationToken(Clock::time_point deadline)
+        : m_has_deadline(true)
+        , m_deadline(deadline)
+    {
+    }
+
+    /// \brief Cancels the calls using this token. May be called from any thread.
+    void cancel() { m_cancelled.store(true, std::memory_order_relaxed); }
+    bool is_cancelled() const
+    {
+        return m_cancelled.load(std::memory_order_relaxed) ||
+               (m_has_deadline && Clock::now() >= m_deadline);
+    }
+
+private:
+    std::atomic<bool> m_cancelled{false};
+    bool m_has_deadline = false;
+    Clock::time_point m_deadline;
+};
+
+/// \brief Thrown inside a backend to unwind a call whose CancellationToken was cancelled.
+///        call_cancellable reports it by returning false.
+class ngraph::runtime::call_cancelled : public ngraph::ngraph_error
+{
+public:
+    call_cancelled()
+        : ngraph_error("Call cancelled")
+    {
+    }
+};
@@ -0,0 +1,244 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+#include <thread>
+
+#include "ngraph/except.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/checkpoint.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/serializer.hpp"
+#include "ngraph/state/state.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Checkpoint entries are Constants whose friendly names are these prefixes followed by
+    // the key of the tensor or State
+    const string s_tensor_prefix = "tensor:";
+    const string s_state_prefix = "state:";
+
+    struct Entry
+    {
+        string name;
+        element::Type element_type;
+        Shape shape;
+        shared_ptr<runtime::AlignedBuffer> buffer;
+    };
+
+    // Returns `buffer` if it has `size` bytes, or a new buffer
+    shared_ptr<runtime::AlignedBuffer>
+        reuse_buffer(const shared_ptr<runtime::AlignedBuffer>& buffer, size_t size)
+    {
+        if (buffer && buffer->size() == size)
+        {
+            return buffer;
+        }
+        return make_shared<runtime::AlignedBuffer>(size);
+    }
+
+    void write_checkpoint(const string& path, const vector<Entry>& entries)
+    {
+        ResultVector results;
+        for (auto& entry : entries)
+        {
+            auto constant =
+                make_shared<op::Constant>(entry.element_type, entry.shape, entry.buffer);
+            constant->set_friendly_name(entry.name);
+            results.push_back(make_shared<op::Result>(constant));
+        }
+        auto function = make_shared<Function>(results, ParameterVector{});
+        string temporary_path = path + ".tmp";
+        serialize_binary(temporary_path, function);
+        if (rename(temporary_path.c_str(), path.c_str()) != 0)
+        {
+            remove(temporary_path.c_str());
+            throw ngraph_error("Unable to write checkpoint '" + path + "'");
+        }
+    }
+}
+
+runtime::CheckpointWriter::~CheckpointWriter()
+{
+    for (auto& snapshot : m_snapshots)
+    {
+        if (snapshot.written.valid())
+        {
+            snapshot.written.wait();
+        }
+    }
+}
+
+shared_future<void>
+    runtime::CheckpointWriter::save(const string& path,
+                                    const map<string, shared_ptr<Tensor>>& tensors,
+                                    const map<string, shared_ptr<State>>& states)
+{
+    lock_guard<mutex> lock(m_mutex);
+    Snapshot& snapshot = m_snapshots[m_next_snapshot];
+    m_next_snapshot = (m_next_snapshot + 1) % 2;
+    // The buffers of this snapshot are still being written by the save before last
+    if (snapshot.written.valid())
+    {
+        snapshot.written.wait();
+    }
+
+    map<string, shared_ptr<AlignedBuffer>> buffers;
+    vector<Entry> entries;
+    for (auto& named_tensor : tensors)
+    {
+        string name = s_tensor_prefix + named_tensor.first;
+        auto& tensor = named_tensor.second;
+        size_t size = tensor->get_size_in_bytes();
+        auto buffer = reuse_buffer(snapshot.buffers[name], size);
+        tensor->read(buffer->get_ptr(), size);
+        buffers[name] = buffer;
+        entries.push_back({name, tensor->get_element_type(), tensor->get_shape(), buffer});
+    }
+    for (auto& named_state : states)
+    {
+        string name = s_state_prefix + named_state.first;
+        ostringstream out;
+        named_state.second->save(out);
+        string data = out.str();
+        auto buffer = reuse_buffer(snapshot.buffers[name], data.size());
+        copy(data.begin(), data.end(), buffer->get_ptr<char>());
+        buffers[name] = buffer;
+        entries.push_back({name, element::u8, Shape{data.size()}, buffer});
+    }
+    snapshot.buffers = move(buffers);
+    snapshot.written = async(launch::async, write_checkpoint, path, move(entries)).share();
+    return snapshot.written;
+}
+
+void runtime::CheckpointWriter::wait()
+{
+    lock_guard<mutex> lock(m_mutex);
+    // Oldest first
+    for (size_t i = 0; i < 2; i++)
+    {
+        auto& written = m_snapshots[(m_next_snapshot + i) % 2].written;
+        if (written.valid())
+        {
+            written.wait();
+        }
+    }
+    for (size_t i = 0; i < 2; i++)
+    {
+        auto& written = m_snapshots[(m_next_snapshot + i) % 2].written;
+        if (written.valid())
+        {
+            written.get();
+        }
+    }
+}
+
+void runtime::load_checkpoint(const string& path,
+                              const map<string, shared_ptr<Tensor>>& tensors,
+                              const map<string, shared_ptr<State>>& states)
+{
+    auto function = deserialize(path);
+    map<string, shared_ptr<op::Constant>> constants;
+    for (auto& result : function->get_results())
+    {
+        if (auto constant = as_type_ptr<op::Constant>(result->get_argument(0)))
+        {
+            constants[constant->get_friendly_name()] = constant;
+        }
+    }
+    auto find_constant = [&](const string& name, size_t size) {
+        auto it = constants.find(name);
+        if (it == constants.end())
+        {
+            throw ngraph_error("Checkpoint '" + path + "' has no entry " + name);
+        }
+        size_t stored_size = shape_size(it->second->get_shape()) *
+                             it->second->get_element_type().size();
+        if (size != SIZE_MAX && stored_size != size)
+        {
+            throw ngraph_error("Checkpoint entry " + name + " has " + to_string(stored_size) +
+                               " bytes, expected " + to_string(size));
+        }
+        return it->second;
+    };
+
+    vector<pair<shared_ptr<Tensor>, shared_ptr<op::Constant>>> writes;
+    for (auto& named_tensor : tensors)
+    {
+        auto& tensor = named_tensor.second;
+        writes.emplace_back(
+            tensor,
+            find_constant(s_tensor_prefix + named_tensor.first, tensor->get_size_in_bytes()));
+    }
+    for (auto& named_state : states)
+    {
+        auto constant = find_constant(s_state_prefix + named_state.first, SIZE_MAX);
+        auto data = static_cast<const char*>(constant->get_data_ptr());
+        istringstream in(string(data, data + shape_size(constant->get_shape())));
+        named_state.second->load(in);
+    }
+
+    // The tensors are written on up to one thread per core, which also faults in the mapped
+    // pages of the checkpoint in parallel
+    atomic<size_t> next{0};
+    exception_ptr error;
+    mutex error_mutex;
+    auto run = [&]() {
+        try
+        {
+            for (size_t i = next++; i < writes.size(); i = next++)
+            {
+                auto& tensor = writes[i].first;
+                tensor->write(writes[i].second->get_data_ptr(), tensor->get_size_in_bytes());
+            }
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(error_mutex);
+            if (!error)
+            {
+                error = current_exception();
+            }
+            next = writes.size();
+        }
+    };
+    vector<thread> threads;
+    size_t thread_count =
+        min<size_t>(max<size_t>(thread::hardware_concurrency(), 1), writes.size());
+    for (size_t i = 1; i < thread_count; i++)
+    {
+        threads.emplace_back(run);
+    }
+    run();
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+}
@@ -0,0 +1,89 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    class State;
+
+    namespace runtime
+    {
+        class AlignedBuffer;
+        class CheckpointWriter;
+        class Tensor;
+
+        /// \brief Restores a checkpoint written by CheckpointWriter.
+        ///
+        /// The data of the checkpoint is mapped from the file and written straight into the
+        /// tensors, several tensors at a time. Every tensor and State in the maps must have a
+        /// matching entry of the same size in the checkpoint; entries of the checkpoint that
+        /// are not in the maps are ignored.
+        NGRAPH_API void
+            load_checkpoint(const std::string& path,
+                            const std::map<std::string, std::shared_ptr<Tensor>>& tensors,
+                            const std::map<std::string, std::shared_ptr<State>>& states = {});
+    }
+}
+
+/// \brief Saves tensors and States to checkpoint files without stalling the caller.
+///
+/// save() copies the tensors into host buffers and returns; the file is written by a
+/// background thread in the binary model format, one Constant per tensor and per State, and
+/// moved into place once complete, so an interrupted save never leaves a partial checkpoint
+/// behind. The writer keeps two sets of buffers, so a save only waits for the one before
+/// the previous save to finish writing, and reuses the buffers across saves of the same
+/// tensors.
+class NGRAPH_API ngraph::runtime::CheckpointWriter
+{
+public:
+    CheckpointWriter() = default;
+    /// \brief Waits for the pending saves
+    ~CheckpointWriter();
+
+    /// \brief Snapshots `tensors` and `states` and writes them to `path` in the background
+    /// \returns A future that is ready once the file is written and rethrows any error
+    std::shared_future<void>
+        save(const std::string& path,
+             const std::map<std::string, std::shared_ptr<Tensor>>& tensors,
+             const std::map<std::string, std::shared_ptr<State>>& states = {});
+
+    /// \brief Waits for the pending saves and rethrows the first error among them
+    void wait();
+
+private:
+    CheckpointWriter(const CheckpointWriter&) = delete;
+    CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+
+    struct Snapshot
+    {
+        std::map<std::string, std::shared_ptr<AlignedBuffer>> buffers;
+        std::shared_future<void> written;
+    };
+
+    std::mutex m_mutex;
+    Snapshot m_snapshots[2];
+    size_t m_next_snapshot = 0;
+};
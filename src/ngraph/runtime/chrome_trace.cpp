@@ -14,10 +14,16 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "chrome_trace.hpp"
 #include "ngraph/log.hpp"
@@ -32,58 +38,291 @@ static bool read_tracing_env_var()
     return is_enabled;
 }
 
+static size_t read_env_size(const char* name, size_t default_value)
+{
+    const char* env = getenv(name);
+    return env ? static_cast<size_t>(strtoull(env, nullptr, 10)) : default_value;
+}
+
 mutex runtime::event::Manager::s_file_mutex;
 bool runtime::event::Manager::s_tracing_enabled = read_tracing_env_var();
+atomic<size_t> runtime::event::Manager::s_sample_every{read_env_size("NGRAPH_TRACING_SAMPLE", 1)};
 
-runtime::event::Duration::Duration(const string& name, const string& category, const string& args)
+namespace
 {
-    if (Manager::is_tracing_enabled())
+    // The trace buffer of one thread. The registry keeps it alive after the thread exits until
+    // its records are flushed.
+    struct ThreadTrace
     {
-        m_start = Manager::get_current_microseconds();
-        m_stop = 0;
-        m_name = name;
-        m_category = category;
-        m_args = args;
+        ThreadTrace(size_t capacity, const string& id)
+            : buffer(capacity)
+            , thread_id(id)
+        {
+        }
+        runtime::event::TraceBuffer buffer;
+        string thread_id;
+        size_t reported_dropped = 0;
+    };
+
+    struct ThreadRegistry
+    {
+        mutex registry_mutex;
+        vector<shared_ptr<ThreadTrace>> threads;
+        // The buffers allow one consumer at a time
+        mutex flush_mutex;
+    };
+
+    struct StringTable
+    {
+        mutex table_mutex;
+        unordered_map<string, uint32_t> ids;
+        vector<string> strings;
+    };
+
+    // Periodically moves the buffered records to the trace file, and once more on exit
+    class TraceFlusher
+    {
+    public:
+        TraceFlusher()
+            : m_interval(read_env_size("NGRAPH_TRACING_FLUSH_MS", 100))
+            , m_thread([this]() { run(); })
+        {
+        }
+
+        ~TraceFlusher()
+        {
+            {
+                lock_guard<mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_condition.notify_all();
+            m_thread.join();
+            runtime::event::Manager::flush();
+        }
+
+    private:
+        void run()
+        {
+            unique_lock<mutex> lock(m_mutex);
+            while (!m_stop)
+            {
+                m_condition.wait_for(lock, m_interval, [this]() { return m_stop; });
+                lock.unlock();
+                runtime::event::Manager::flush();
+                lock.lock();
+            }
+        }
+
+        chrono::milliseconds m_interval;
+        mutex m_mutex;
+        condition_variable m_condition;
+        bool m_stop = false;
+        thread m_thread;
+    };
+}
+
+static ThreadRegistry& get_thread_registry()
+{
+    static ThreadRegistry s_registry;
+    return s_registry;
+}
+
+static StringTable& get_string_table()
+{
+    static StringTable s_table;
+    return s_table;
+}
+
+uint32_t runtime::event::Manager::intern(const string& s)
+{
+    // Each thread caches the ids it has seen so recording an event takes no lock
+    thread_local unordered_map<string, uint32_t> t_ids;
+    auto it = t_ids.find(s);
+    if (it != t_ids.end())
+    {
+        return it->second;
+    }
+    StringTable& table = get_string_table();
+    lock_guard<mutex> lock(table.table_mutex);
+    auto global = table.ids.find(s);
+    uint32_t id;
+    if (global != table.ids.end())
+    {
+        id = global->second;
+    }
+    else
+    {
+        id = static_cast<uint32_t>(table.strings.size());
+        table.strings.push_back(s);
+        table.ids.insert({s, id});
     }
+    t_ids.insert({s, id});
+    return id;
 }
 
-void runtime::event::Duration::stop()
+string runtime::event::Manager::get_string(uint32_t id)
 {
-    if (Manager::is_tracing_enabled())
+    StringTable& table = get_string_table();
+    lock_guard<mutex> lock(table.table_mutex);
+    return table.strings.at(id);
+}
+
+void runtime::event::Manager::set_sampling(size_t every)
+{
+    s_sample_every = every;
+}
+
+bool runtime::event::Manager::sample()
+{
+    size_t every = s_sample_every.load(memory_order_relaxed);
+    if (every <= 1)
     {
-        m_stop = Manager::get_current_microseconds();
+        return true;
     }
+    thread_local size_t t_count = 0;
+    return t_count++ % every == 0;
 }
 
-void runtime::event::Duration::write()
+void runtime::event::Manager::record(const TraceRecord& record)
 {
-    if (Manager::is_tracing_enabled())
+    thread_local shared_ptr<ThreadTrace> t_trace;
+    if (!t_trace)
     {
-        size_t stop_time = (m_stop != 0 ? m_stop : Manager::get_current_microseconds());
+        string thread_id;
+        {
+            lock_guard<mutex> lock(get_mutex());
+            thread_id = get_thread_id();
+        }
+        // Construct everything the flusher uses on exit before it, so it is destroyed after it
+        get_string_table();
+        get_thread_registry();
+        get_output_stream();
+        get_process_id();
+        static TraceFlusher s_flusher;
+        t_trace = make_shared<ThreadTrace>(
+            read_env_size("NGRAPH_TRACING_BUFFER_EVENTS", 1 << 16), thread_id);
+        ThreadRegistry& registry = get_thread_registry();
+        lock_guard<mutex> lock(registry.registry_mutex);
+        registry.threads.push_back(t_trace);
+    }
+    t_trace->buffer.push(record);
+}
 
-        lock_guard<mutex> lock(Manager::get_mutex());
+void runtime::event::Manager::flush()
+{
+    ThreadRegistry& registry = get_thread_registry();
+    lock_guard<mutex> flush_lock(registry.flush_mutex);
 
-        ofstream& out = runtime::event::Manager::get_output_stream();
-        if (out.is_open() == false)
+    vector<shared_ptr<ThreadTrace>> threads;
+    vector<shared_ptr<ThreadTrace>> exited;
+    {
+        lock_guard<mutex> lock(registry.registry_mutex);
+        threads = registry.threads;
+        for (const shared_ptr<ThreadTrace>& trace : registry.threads)
         {
-            runtime::event::Manager::open();
+            // Only the registry and the copy above hold the trace of a thread that has exited,
+            // so this flush writes the last of its records
+            if (trace.use_count() == 2)
+            {
+                exited.push_back(trace);
+            }
         }
-        else
+    }
+
+    vector<TraceRecord> records;
+    for (const shared_ptr<ThreadTrace>& trace : threads)
+    {
+        records.clear();
+        trace->buffer.drain([&](const TraceRecord& r) { records.push_back(r); });
+        size_t dropped = trace->buffer.get_dropped();
+        if (dropped != trace->reported_dropped)
         {
-            Manager::get_output_stream() << ",\n";
+            NGRAPH_WARN << "Trace buffer of thread " << trace->thread_id << " dropped "
+                        << dropped - trace->reported_dropped
+                        << " events, consider raising NGRAPH_TRACING_BUFFER_EVENTS";
+            trace->reported_dropped = dropped;
+        }
+        if (records.empty())
+        {
+            continue;
         }
 
-        Manager::get_output_stream() <<
-            R"({"name":")" << m_name << R"(","cat":")" << m_category << R"(","ph":"X","pid":)"
-                                     << Manager::get_process_id() << R"(,"tid":)"
-                                     << Manager::get_thread_id() <<
-            R"(,"ts":)" << m_start << R"(,"dur":)" << (stop_time - m_start);
-        if (!m_args.empty())
+        StringTable& table = get_string_table();
+        lock_guard<mutex> table_lock(table.table_mutex);
+        lock_guard<mutex> file_lock(get_mutex());
+        for (const TraceRecord& r : records)
         {
-            out <<
-                R"(,"args":)" << m_args;
+            start_event() << R"({"name":")" << table.strings[r.name] << R"(","cat":")"
+                          << table.strings[r.category] << R"(","ph":"X","pid":)"
+                          << get_process_id() << R"(,"tid":)" << trace->thread_id
+                          << R"(,"ts":)" << r.start << R"(,"dur":)" << r.duration << "}";
         }
-        out << "}";
+        get_output_stream().flush();
+    }
+
+    // Forget the buffers of threads that have exited and been flushed
+    lock_guard<mutex> lock(registry.registry_mutex);
+    for (const shared_ptr<ThreadTrace>& trace : exited)
+    {
+        registry.threads.erase(find(registry.threads.begin(), registry.threads.end(), trace));
+    }
+}
+
+ofstream& runtime::event::Manager::start_event()
+{
+    ofstream& out = get_output_stream();
+    if (out.is_open() == false)
+    {
+        open();
+    }
+    else
+    {
+        out << ",\n";
+    }
+    return out;
+}
+
+runtime::event::Duration::Duration(const string& name, const string& category, const string& args)
+{
+    if (Manager::is_tracing_enabled() && Manager::sample())
+    {
+        m_sampled = true;
+        m_name = Manager::intern(name);
+        m_category = Manager::intern(category);
+        m_args = args;
+        m_start = Manager::get_current_microseconds();
+    }
+}
+
+void runtime::event::Duration::stop()
+{
+    if (m_sampled && Manager::is_tracing_enabled())
+    {
+        m_stop = Manager::get_current_microseconds();
+    }
+}
+
+void runtime::event::Duration::write()
+{
+    if (m_sampled && Manager::is_tracing_enabled())
+    {
+        // Write each event once, even if write() was called before the destructor
+        m_sampled = false;
+        size_t stop_time = (m_stop != 0 ? m_stop : Manager::get_current_microseconds());
+        if (m_args.empty())
+        {
+            Manager::record({m_start, stop_time - m_start, m_name, m_category});
+            return;
+        }
+
+        string name = Manager::get_string(m_name);
+        string category = Manager::get_string(m_category);
+        lock_guard<mutex> lock(Manager::get_mutex());
+        Manager::start_event() << R"({"name":")" << name << R"(","cat":")" << category
+                               << R"(","ph":"X","pid":)" << Manager::get_process_id()
+                               << R"(,"tid":)" << Manager::get_thread_id() << R"(,"ts":)"
+                               << m_start << R"(,"dur":)" << (stop_time - m_start)
+                               << R"(,"args":)" << m_args << "}";
     }
 }
 
@@ -184,6 +423,8 @@ void runtime::event::Manager::open(const string& path)
 
 void runtime::event::Manager::close()
 {
+    flush();
+    lock_guard<mutex> lock(get_mutex());
     ofstream& out = get_output_stream();
     if (out.is_open())
     {
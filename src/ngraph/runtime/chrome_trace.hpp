@@ -16,12 +16,16 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <mutex>
 #include <string>
 #include <thread>
+
+#include "ngraph/runtime/trace_buffer.hpp"
 #ifdef _WIN32
 #include <windows.h>
 // windows.h must be before processthreadsapi.h so we need this comment
@@ -74,6 +78,13 @@ namespace ngraph
 //
 // More information about this is at:
 // http://dev.chromium.org/developers/how-tos/trace-event-profiling-tool
+//
+// Durations without arguments are recorded as binary TraceRecords in a lock-free buffer owned
+// by the calling thread, and a background thread converts them to JSON every
+// NGRAPH_TRACING_FLUSH_MS milliseconds (default 100). Each thread buffers up to
+// NGRAPH_TRACING_BUFFER_EVENTS records (default 65536); records arriving while the buffer is
+// full are dropped and reported. NGRAPH_TRACING_SAMPLE=n records one in every n Durations of
+// each thread. Durations with arguments and Objects are written synchronously.
 
 class ngraph::runtime::event::Manager
 {
@@ -87,8 +98,19 @@ public:
     static void enable_event_tracing();
     static void disable_event_tracing();
     static bool is_event_tracing_enabled();
+    /// \brief Records one in every `every` Durations of each thread
+    static void set_sampling(size_t every);
+    /// \brief Writes the Durations buffered by all threads to the trace file
+    static void flush();
 
 private:
+    static uint32_t intern(const std::string& s);
+    static std::string get_string(uint32_t id);
+    static bool sample();
+    static void record(const TraceRecord& record);
+    // Opens the trace file or writes the separator before the next event. Requires the file
+    // mutex.
+    static std::ofstream& start_event();
     static std::ofstream& get_output_stream();
     static const std::string& get_process_id();
     static size_t get_current_microseconds()
@@ -100,6 +122,7 @@ private:
     static std::ostream s_ostream;
     static std::mutex s_file_mutex;
     static bool s_tracing_enabled;
+    static std::atomic<size_t> s_sample_every;
 };
 
 class ngraph::runtime::event::Duration
@@ -114,6 +137,10 @@ public:
     /// Calls to stop() are optional
     void stop();
 
+    /// \brief replace the JSON object written as the event's arguments, for values only known
+    /// once the event is over
+    void set_args(const std::string& args) { m_args = args; }
+
     /// \brief write the log data to the log file for this event
     /// This funtion has an implicit stop() if stop() has not been previously called
     void write();
@@ -122,11 +149,11 @@ public:
     Duration& operator=(Duration const&) = delete;
 
 private:
-    std::string to_json() const;
+    bool m_sampled{false};
     size_t m_start{0};
     size_t m_stop{0};
-    std::string m_name;
-    std::string m_category;
+    uint32_t m_name{0};
+    uint32_t m_category{0};
     std::string m_args;
 };
 
@@ -0,0 +1,154 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/compile_cache.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/metrics.hpp"
+#include "ngraph/serializer.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// 64-bit FNV-1a; stable across processes and platforms, unlike std::hash
+static uint64_t fnv1a(const string& s, uint64_t hash = 0xcbf29ce484222325ULL)
+{
+    for (unsigned char c : s)
+    {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+runtime::CompileCache::CompileCache(const string& directory)
+    : m_directory(directory)
+{
+    if (is_enabled() && !file_util::exists(m_directory))
+    {
+        file_util::make_directory(m_directory);
+    }
+}
+
+runtime::CompileCache& runtime::CompileCache::get_default()
+{
+    static const char* env = getenv("NGRAPH_COMPILE_CACHE_DIR");
+    static CompileCache s_cache(env == nullptr ? "" : env);
+    return s_cache;
+}
+
+string runtime::CompileCache::get_key(const shared_ptr<Function>& func,
+                                      const string& backend_description) const
+{
+    string model;
+    try
+    {
+        model = serialize(func);
+    }
+    catch (const exception& e)
+    {
+        NGRAPH_DEBUG << "Compile cache disabled for " << func->get_name() << ": " << e.what();
+        return "";
+    }
+
+    // Hash the parts separately so that moving text between them changes the key
+    uint64_t hash = fnv1a(model);
+    hash = fnv1a(backend_description, hash);
+    hash = fnv1a(NGRAPH_VERSION, hash);
+
+    stringstream ss;
+    ss << hex << setw(16) << setfill('0') << hash;
+    return ss.str();
+}
+
+string runtime::CompileCache::get_entry_path(const string& key) const
+{
+    return file_util::path_join(m_directory, key + ".ngc");
+}
+
+shared_ptr<runtime::Executable> runtime::CompileCache::load(const string& key,
+                                                            Backend& backend) const
+{
+    shared_ptr<Executable> exec;
+    if (!is_enabled() || key.empty())
+    {
+        return exec;
+    }
+    static metrics::Counter& s_hits = metrics::Registry::get_default().get_counter(
+        "ngraph_compile_cache_hits_total", "Compiles loaded from the on-disk compile cache");
+    static metrics::Counter& s_misses = metrics::Registry::get_default().get_counter(
+        "ngraph_compile_cache_misses_total", "Compiles not found in the on-disk compile cache");
+    string path = get_entry_path(key);
+    ifstream in(path, ios::binary);
+    if (in)
+    {
+        try
+        {
+            exec = backend.load(in);
+        }
+        catch (const exception& e)
+        {
+            NGRAPH_WARN << "Ignoring unreadable compile cache entry " << path << ": " << e.what();
+            exec = nullptr;
+        }
+    }
+    (exec ? s_hits : s_misses).increment();
+    return exec;
+}
+
+void runtime::CompileCache::store(const string& key, Executable& exec) const
+{
+    if (!is_enabled() || key.empty())
+    {
+        return;
+    }
+    // Write to a private file first and rename it into place so that concurrent
+    // processes never observe a partially written entry.
+    string path = get_entry_path(key);
+    stringstream suffix;
+    suffix << ".tmp" << hex << hash<thread::id>()(this_thread::get_id())
+           << chrono::steady_clock::now().time_since_epoch().count();
+    string tmp_path = path + suffix.str();
+    try
+    {
+        {
+            ofstream out(tmp_path, ios::binary);
+            exec.save(out);
+            if (!out)
+            {
+                throw runtime_error("write failed");
+            }
+        }
+        if (rename(tmp_path.c_str(), path.c_str()) != 0)
+        {
+            throw runtime_error("rename failed");
+        }
+    }
+    catch (const exception& e)
+    {
+        NGRAPH_WARN << "Unable to write compile cache entry " << path << ": " << e.what();
+        file_util::remove_file(tmp_path);
+    }
+}
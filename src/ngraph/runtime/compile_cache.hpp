@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "ngraph/function.hpp"
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class Backend;
+        class Executable;
+        class CompileCache;
+    }
+}
+
+/// \brief Content-addressed on-disk cache of compiled Executables.
+///
+/// Entries are keyed on a hash of the serialized Function, the nGraph version and a
+/// backend-supplied description that should cover everything else the compiled result
+/// depends on (backend name, configuration, target ISA). An entry holds whatever
+/// Executable::save writes, and is read back with Backend::load, so only backends that
+/// implement both can use the cache.
+///
+/// The process-wide instance returned by get_default() is enabled by setting
+/// NGRAPH_COMPILE_CACHE_DIR to a writable directory.
+class NGRAPH_API ngraph::runtime::CompileCache
+{
+public:
+    /// \param directory Directory holding the cache entries. An empty string disables the
+    ///                  cache.
+    CompileCache(const std::string& directory);
+
+    /// \brief The cache configured by the NGRAPH_COMPILE_CACHE_DIR environment variable
+    static CompileCache& get_default();
+
+    bool is_enabled() const { return !m_directory.empty(); }
+    const std::string& get_directory() const { return m_directory; }
+    /// \brief Compute the cache key for a function.
+    /// \param func The function about to be compiled
+    /// \param backend_description Everything besides the graph that affects the compiled
+    ///        result, e.g. "INTERPRETER" or "CPU;isa=avx512;codegen=0"
+    /// \returns the key, or an empty string if the function cannot be serialized
+    std::string get_key(const std::shared_ptr<Function>& func,
+                        const std::string& backend_description) const;
+
+    /// \brief Load a cached executable.
+    /// \returns The executable, or nullptr if there is no usable entry for key
+    std::shared_ptr<Executable> load(const std::string& key, Backend& backend) const;
+
+    /// \brief Save an executable under key. Failures to save are logged and ignored so
+    ///        a read-only or full cache never breaks compilation.
+    void store(const std::string& key, Executable& exec) const;
+
+private:
+    std::string get_entry_path(const std::string& key) const;
+
+    std::string m_directory;
+};
@@ -0,0 +1,121 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+#include <cstring>
+
+#include "ngraph/runtime/constant_store.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Word-at-a-time multiplicative hash, fast enough to run over multi-gigabyte tables
+static uint64_t hash_bytes(const char* data, size_t size)
+{
+    uint64_t hash = 0x9e3779b97f4a7c15ULL ^ size;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 32;
+    }
+    for (; i < size; i++)
+    {
+        hash = (hash ^ static_cast<unsigned char>(data[i])) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+runtime::ConstantStore& runtime::ConstantStore::get()
+{
+    static ConstantStore s_store;
+    return s_store;
+}
+
+runtime::ConstantStore::ConstantStore()
+    : m_min_size(64 * 1024)
+{
+    if (auto env = getenv("NGRAPH_CONSTANT_STORE_MIN_BYTES"))
+    {
+        m_min_size = strtoull(env, nullptr, 10);
+    }
+}
+
+shared_ptr<runtime::AlignedBuffer>
+    runtime::ConstantStore::intern(const shared_ptr<AlignedBuffer>& buffer)
+{
+    if (buffer == nullptr || buffer->size() < m_min_size)
+    {
+        return buffer;
+    }
+    const char* data = buffer->get_ptr<char>();
+    size_t size = buffer->size();
+    uint64_t hash = hash_bytes(data, size);
+
+    lock_guard<mutex> lock(m_mutex);
+    auto range = m_entries.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        auto existing = it->second.lock();
+        if (existing == buffer)
+        {
+            return buffer;
+        }
+        if (existing && existing->size() == size && memcmp(existing->get_ptr(), data, size) == 0)
+        {
+            m_hits++;
+            return existing;
+        }
+    }
+    m_entries.emplace(hash, buffer);
+    // Expired entries are only dropped occasionally to keep interning cheap
+    if (++m_interns_since_purge >= 64)
+    {
+        purge_expired();
+    }
+    return buffer;
+}
+
+void runtime::ConstantStore::purge_expired()
+{
+    for (auto it = m_entries.begin(); it != m_entries.end();)
+    {
+        it = it->second.expired() ? m_entries.erase(it) : next(it);
+    }
+    m_interns_since_purge = 0;
+}
+
+size_t runtime::ConstantStore::get_hits() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_hits;
+}
+
+size_t runtime::ConstantStore::get_resident_bytes() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    size_t bytes = 0;
+    for (auto& entry : m_entries)
+    {
+        if (auto buffer = entry.second.lock())
+        {
+            bytes += buffer->size();
+        }
+    }
+    return bytes;
+}
@@ -0,0 +1,74 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "ngraph/ngraph_visibility.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class ConstantStore;
+    }
+}
+
+/// \brief Process-wide, content-addressed store of constant data.
+///
+/// Backends intern the data of the Constants they compile (see op::Constant::intern_data),
+/// so copies of a model compiled several times, for example once per batch size, keep a
+/// single resident copy of every large weight, whichever backend compiled them. Buffers are
+/// found by a hash of their contents and confirmed with a full comparison. The store only
+/// holds weak references: an entry disappears once the last Constant using it is destroyed.
+///
+/// Buffers smaller than get_min_size() bytes are not interned since hashing them costs more
+/// than it saves. The threshold defaults to 64 KiB and can be set with the
+/// NGRAPH_CONSTANT_STORE_MIN_BYTES environment variable.
+class NGRAPH_API ngraph::runtime::ConstantStore
+{
+public:
+    static ConstantStore& get();
+
+    /// \returns A buffer with the same contents as `buffer`: a matching one already in the
+    ///          store, or `buffer` itself, which is then added to the store. The contents of
+    ///          an interned buffer must not be modified.
+    std::shared_ptr<AlignedBuffer> intern(const std::shared_ptr<AlignedBuffer>& buffer);
+
+    size_t get_min_size() const { return m_min_size; }
+    void set_min_size(size_t min_size) { m_min_size = min_size; }
+    /// \returns the number of intern calls that returned an existing buffer
+    size_t get_hits() const;
+    /// \returns the total size of the distinct buffers currently alive in the store
+    size_t get_resident_bytes() const;
+
+private:
+    ConstantStore();
+
+    void purge_expired();
+
+    mutable std::mutex m_mutex;
+    std::unordered_multimap<uint64_t, std::weak_ptr<AlignedBuffer>> m_entries;
+    size_t m_min_size;
+    size_t m_hits = 0;
+    size_t m_interns_since_purge = 0;
+};
@@ -0,0 +1,279 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/fused/clamp.hpp"
+#include "ngraph/op/fused/elu.hpp"
+#include "ngraph/op/fused/hard_sigmoid.hpp"
+#include "ngraph/op/fused/prelu.hpp"
+#include "ngraph/op/fused/selu.hpp"
+#include "ngraph/op/fused/squared_difference.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/activation.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Native kernels for element-wise fused ops, which would otherwise be decomposed. They only
+// handle floating point types, see the FusedOpDecomposition callback in
+// cpu_external_function.cpp.
+#define SELECT_FLOAT_KERNEL(KV, ET, K)                                                             \
+    if (ET == element::f32)                                                                        \
+    {                                                                                              \
+        KV = K<float>;                                                                             \
+    }                                                                                              \
+    else if (ET == element::f64)                                                                   \
+    {                                                                                              \
+        KV = K<double>;                                                                            \
+    }                                                                                              \
+    else                                                                                           \
+    {                                                                                              \
+        throw ngraph_error("Unsupported element type " + ET.c_type_string() + " for kernel " #K);  \
+    }
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Value of a scalar input of a floating point op
+            static double read_scalar(const void* data, const element::Type& element_type)
+            {
+                return element_type == element::f32 ? *static_cast<const float*>(data)
+                                                    : *static_cast<const double*>(data);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Clamp)
+            {
+                auto clamp = static_cast<const ngraph::op::Clamp*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto input_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                size_t count = out[0].get_size();
+                auto min = clamp->get_min();
+                auto max = clamp->get_max();
+
+                std::function<decltype(runtime::cpu::kernel::clamp<double>)> kernel;
+                SELECT_FLOAT_KERNEL(
+                    kernel, args[0].get_element_type(), runtime::cpu::kernel::clamp)
+
+                auto functor = [&, kernel, min, max, count, input_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[input_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           min,
+                           max,
+                           count,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Elu)
+            {
+                auto elu = static_cast<const ngraph::op::Elu*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto input_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                size_t count = out[0].get_size();
+                auto alpha = elu->get_alpha();
+
+                std::function<decltype(runtime::cpu::kernel::elu<double>)> kernel;
+                SELECT_FLOAT_KERNEL(kernel, args[0].get_element_type(), runtime::cpu::kernel::elu)
+
+                auto functor = [&, kernel, alpha, count, input_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[input_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           alpha,
+                           count,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::HardSigmoid)
+            {
+                (void)node;
+                auto& functors = external_function->get_functors();
+
+                auto input_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto alpha_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto beta_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                size_t count = out[0].get_size();
+                auto element_type = args[0].get_element_type();
+
+                std::function<decltype(runtime::cpu::kernel::hard_sigmoid<double>)> kernel;
+                SELECT_FLOAT_KERNEL(kernel, element_type, runtime::cpu::kernel::hard_sigmoid)
+
+                auto functor = [&,
+                                kernel,
+                                element_type,
+                                count,
+                                input_buffer_index,
+                                alpha_buffer_index,
+                                beta_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[input_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           read_scalar(ctx->buffer_data[alpha_buffer_index], element_type),
+                           read_scalar(ctx->buffer_data[beta_buffer_index], element_type),
+                           count,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Selu)
+            {
+                (void)node;
+                auto& functors = external_function->get_functors();
+
+                auto input_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto alpha_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto lambda_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                size_t count = out[0].get_size();
+                auto element_type = args[0].get_element_type();
+
+                std::function<decltype(runtime::cpu::kernel::selu<double>)> kernel;
+                SELECT_FLOAT_KERNEL(kernel, element_type, runtime::cpu::kernel::selu)
+
+                auto functor = [&,
+                                kernel,
+                                element_type,
+                                count,
+                                input_buffer_index,
+                                alpha_buffer_index,
+                                lambda_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[input_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           read_scalar(ctx->buffer_data[alpha_buffer_index], element_type),
+                           read_scalar(ctx->buffer_data[lambda_buffer_index], element_type),
+                           count,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::PRelu)
+            {
+                (void)node;
+                auto& functors = external_function->get_functors();
+
+                auto input_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto slope_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                size_t count = out[0].get_size();
+
+                // A single slope, one per element, or one per entry of the first axis that has
+                // as many entries as the slope, as in PRelu::decompose_op
+                auto& data_shape = args[0].get_shape();
+                auto& slope_shape = args[1].get_shape();
+                size_t channels = shape_size(slope_shape);
+                size_t inner = count;
+                if (slope_shape.size() == 1 && channels != 1)
+                {
+                    auto axis = find(data_shape.begin(), data_shape.end(), channels);
+                    NGRAPH_CHECK(axis != data_shape.end());
+                    inner = shape_size(Shape(axis + 1, data_shape.end()));
+                }
+                else if (channels != 1)
+                {
+                    NGRAPH_CHECK(slope_shape == data_shape);
+                    inner = 1;
+                }
+
+                std::function<decltype(runtime::cpu::kernel::prelu<float>)> kernel;
+                SELECT_FLOAT_KERNEL(
+                    kernel, args[0].get_element_type(), runtime::cpu::kernel::prelu)
+
+                auto functor = [&,
+                                kernel,
+                                count,
+                                channels,
+                                inner,
+                                input_buffer_index,
+                                slope_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[input_buffer_index],
+                           ctx->buffer_data[slope_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           count,
+                           channels,
+                           inner,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::SquaredDifference)
+            {
+                (void)node;
+                auto& functors = external_function->get_functors();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                size_t count = out[0].get_size();
+                NGRAPH_CHECK(args[0].get_shape() == args[1].get_shape());
+
+                std::function<decltype(runtime::cpu::kernel::squared_difference<float>)> kernel;
+                SELECT_FLOAT_KERNEL(kernel,
+                                    args[0].get_element_type(),
+                                    runtime::cpu::kernel::squared_difference)
+
+                auto functor = [&,
+                                kernel,
+                                count,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg0_buffer_index],
+                           ctx->buffer_data[arg1_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           count,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_activation_cpp()
+            {
+                REGISTER_OP_BUILDER(Clamp);
+                REGISTER_OP_BUILDER(Elu);
+                REGISTER_OP_BUILDER(HardSigmoid);
+                REGISTER_OP_BUILDER(PRelu);
+                REGISTER_OP_BUILDER(Selu);
+                REGISTER_OP_BUILDER(SquaredDifference);
+            }
+        }
+    }
+}
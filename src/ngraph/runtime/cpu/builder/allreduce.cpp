@@ -14,9 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
+#include <vector>
+
 #include "ngraph/op/allreduce.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/op/allreduce_async.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -55,19 +59,115 @@ namespace ngraph
                         : node->get_friendly_name().c_str(),
                     count);
 
-                auto functor =
-                    [&, count, reduce_type, data_type, arg_buffer_index, out_buffer_index](
-                        CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
-                        get_distributed_interface()->all_reduce(ctx->buffer_data[arg_buffer_index],
-                                                                ctx->buffer_data[out_buffer_index],
-                                                                data_type,
-                                                                reduce_type,
-                                                                count);
-                    };
+                auto algorithm = allreduce->get_algorithm();
+                auto compression = allreduce->get_compression();
+                if (algorithm == reduction::Algorithm::FLAT &&
+                    compression == reduction::Compression::NONE)
+                {
+                    auto functor =
+                        [&, count, reduce_type, data_type, arg_buffer_index, out_buffer_index](
+                            CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                            get_distributed_interface()->all_reduce(
+                                ctx->buffer_data[arg_buffer_index],
+                                ctx->buffer_data[out_buffer_index],
+                                data_type,
+                                reduce_type,
+                                count);
+                        };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
+                // Compression error carried over from one call to the next
+                auto residual = make_shared<vector<float>>(
+                    compression == reduction::Compression::NONE ? 0 : count, 0.0f);
+                auto functor = [&,
+                                count,
+                                reduce_type,
+                                data_type,
+                                arg_buffer_index,
+                                out_buffer_index,
+                                algorithm,
+                                compression,
+                                residual](CPURuntimeContext* ctx,
+                                          CPUExecutionContext* /* ectx */) {
+                    get_distributed_interface()->all_reduce(ctx->buffer_data[arg_buffer_index],
+                                                            ctx->buffer_data[out_buffer_index],
+                                                            data_type,
+                                                            reduce_type,
+                                                            count,
+                                                            algorithm,
+                                                            compression,
+                                                            residual->data());
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::AllReduceStart)
+            {
+                auto& functors = external_function->get_functors();
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto count = out[0].get_size();
+                auto data_type = args[0].get_element_type();
+                auto reduce_type =
+                    static_cast<const ngraph::op::AllReduceStart*>(node)->get_reduce_type();
+                auto request_index = external_function->get_distributed_request_index(node);
+
+                auto functor = [&,
+                                count,
+                                reduce_type,
+                                data_type,
+                                arg_buffer_index,
+                                out_buffer_index,
+                                request_index](CPURuntimeContext* ctx,
+                                               CPUExecutionContext* /* ectx */) {
+                    ctx->distributed_requests[request_index] =
+                        get_distributed_interface()
+                            ->all_reduce_start(ctx->buffer_data[arg_buffer_index],
+                                               ctx->buffer_data[out_buffer_index],
+                                               data_type,
+                                               reduce_type,
+                                               count)
+                            .release();
+                };
                 functors.emplace_back(functor);
             }
 
-            void register_builders_allreduce_cpp() { REGISTER_OP_BUILDER(AllReduce); }
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::AllReduceWait)
+            {
+                auto& functors = external_function->get_functors();
+                auto start_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto size = out[0].get_size() * out[0].get_element_type().size();
+                auto request_index = external_function->get_distributed_request_index(
+                    node->input_value(0).get_node());
+
+                auto functor = [&, start_buffer_index, out_buffer_index, size, request_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                    std::unique_ptr<DistributedRequest> request(
+                        ctx->distributed_requests[request_index]);
+                    ctx->distributed_requests[request_index] = nullptr;
+                    request->wait();
+                    // The output is normally assigned in place of the start's buffer
+                    if (ctx->buffer_data[out_buffer_index] != ctx->buffer_data[start_buffer_index])
+                    {
+                        memcpy(ctx->buffer_data[out_buffer_index],
+                               ctx->buffer_data[start_buffer_index],
+                               size);
+                    }
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_allreduce_cpp()
+            {
+                REGISTER_OP_BUILDER(AllReduce);
+                REGISTER_OP_BUILDER(AllReduceStart);
+                REGISTER_OP_BUILDER(AllReduceWait);
+            }
         }
     }
 }
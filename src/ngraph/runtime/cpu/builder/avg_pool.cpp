@@ -108,7 +108,7 @@ namespace ngraph
                                     include_padding_in_avg_computation,
                                     arg0_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* /* ectx */) {
+                                                      CPUExecutionContext* ectx) {
                         kernel(ctx->buffer_data[arg0_buffer_index],
                                ctx->buffer_data[out_buffer_index],
                                arg0_shape,
@@ -117,7 +117,8 @@ namespace ngraph
                                window_movement_strides,
                                padding_below,
                                padding_above,
-                               include_padding_in_avg_computation);
+                               include_padding_in_avg_computation,
+                               ectx->arena);
                     };
                     functors.emplace_back(functor);
                 }
@@ -208,7 +209,7 @@ namespace ngraph
                                     include_padding_in_avg_computation,
                                     delta_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* /* ectx */) {
+                                                      CPUExecutionContext* ectx) {
                         kernel(ctx->buffer_data[delta_buffer_index],
                                ctx->buffer_data[out_buffer_index],
                                delta_shape,
@@ -217,7 +218,8 @@ namespace ngraph
                                window_movement_strides,
                                padding_below,
                                padding_above,
-                               include_padding_in_avg_computation);
+                               include_padding_in_avg_computation,
+                               ectx->arena);
                     };
                     functors.emplace_back(functor);
                 }
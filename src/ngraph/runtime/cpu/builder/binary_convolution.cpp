@@ -0,0 +1,179 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "ngraph/op/binary_convolution.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/binary_convolution.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace
+            {
+                template <typename T>
+                CPUKernelFunctor prepare_functor(const ngraph::op::v1::BinaryConvolution* conv,
+                                                 const vector<TensorViewWrapper>& args,
+                                                 const vector<TensorViewWrapper>& out,
+                                                 CPU_ExternalFunction* external_function)
+                {
+                    auto in_shape = args[0].get_shape();
+                    auto filters_shape = args[1].get_shape();
+                    auto out_shape = out[0].get_shape();
+                    size_t rank = in_shape.size() - 2;
+                    if (rank > 3)
+                    {
+                        throw ngraph_error(
+                            "Unsupported spatial rank in CPU Builder for BinaryConvolution");
+                    }
+
+                    kernel::BinaryConvolutionParams params;
+                    params.batch = in_shape[0];
+                    params.channels = in_shape[1];
+                    params.out_channels = out_shape[1];
+                    params.pad_bit = conv->get_pad_value() > 0.0f;
+                    // Leading spatial dimensions that the op does not have are of size one
+                    for (size_t d = 0; d < 3; d++)
+                    {
+                        bool present = d >= 3 - rank;
+                        size_t i = d + rank - 3;
+                        params.in_dims[d] = present ? in_shape[2 + i] : 1;
+                        params.kernel_dims[d] = present ? filters_shape[2 + i] : 1;
+                        params.out_dims[d] = present ? out_shape[2 + i] : 1;
+                        params.strides[d] = present ? conv->get_strides()[i] : 1;
+                        params.dilations[d] = present ? conv->get_dilations()[i] : 1;
+                        params.pads_begin[d] = present ? conv->get_pads_begin()[i] : 0;
+                    }
+
+                    size_t words = params.get_words();
+                    size_t kernel_size = params.get_kernel_size();
+                    size_t in_spatial = shape_size(in_shape) / (params.batch * params.channels);
+
+                    // Constant filters are packed once, here, instead of on every call
+                    shared_ptr<vector<uint64_t>> packed_filters;
+                    if (auto constant = as_type_ptr<ngraph::op::Constant>(
+                            conv->input_value(1).get_node_shared_ptr()))
+                    {
+                        packed_filters = make_shared<vector<uint64_t>>(params.out_channels *
+                                                                       kernel_size * words);
+                        kernel::pack_binary_channels(constant->get_data_ptr<T>(),
+                                                     packed_filters->data(),
+                                                     params.out_channels,
+                                                     params.channels,
+                                                     kernel_size,
+                                                     0);
+                        external_function->add_prepacked_weight_bytes(packed_filters->size() *
+                                                                      sizeof(uint64_t));
+                    }
+
+                    auto in_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                    auto filters_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                    return [&,
+                            params,
+                            packed_filters,
+                            in_spatial,
+                            kernel_size,
+                            words,
+                            in_buffer_index,
+                            filters_buffer_index,
+                            out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        vector<uint64_t> packed_input(params.batch * in_spatial * words);
+                        kernel::pack_binary_channels(
+                            static_cast<T*>(ctx->buffer_data[in_buffer_index]),
+                            packed_input.data(),
+                            params.batch,
+                            params.channels,
+                            in_spatial,
+                            ectx->arena);
+
+                        vector<uint64_t> call_filters;
+                        const uint64_t* filters = nullptr;
+                        if (packed_filters)
+                        {
+                            filters = packed_filters->data();
+                        }
+                        else
+                        {
+                            call_filters.resize(params.out_channels * kernel_size * words);
+                            kernel::pack_binary_channels(
+                                static_cast<T*>(ctx->buffer_data[filters_buffer_index]),
+                                call_filters.data(),
+                                params.out_channels,
+                                params.channels,
+                                kernel_size,
+                                ectx->arena);
+                            filters = call_filters.data();
+                        }
+
+                        kernel::binary_convolution(
+                            packed_input.data(),
+                            filters,
+                            static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                            params,
+                            ectx->arena);
+                    };
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v1::BinaryConvolution)
+            {
+                auto& functors = external_function->get_functors();
+                auto conv = static_cast<const ngraph::op::v1::BinaryConvolution*>(node);
+                CPUKernelFunctor functor;
+
+                auto element_type = args[0].get_element_type();
+                if (args[1].get_element_type() != element_type)
+                {
+                    throw ngraph_error(
+                        "Data and filters of different types in CPU Builder for "
+                        "BinaryConvolution");
+                }
+                if (element_type == element::f32)
+                {
+                    functor = prepare_functor<float>(conv, args, out, external_function);
+                }
+                else if (element_type == element::f64)
+                {
+                    functor = prepare_functor<double>(conv, args, out, external_function);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported type (" + element_type.get_type_name() +
+                                       ") in CPU Builder for BinaryConvolution");
+                }
+
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_binary_convolution_cpp()
+            {
+                REGISTER_OP_BUILDER(v1::BinaryConvolution);
+            }
+        }
+    }
+}
@@ -19,6 +19,7 @@
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/broadcast.hpp"
+#include "ngraph/runtime/cpu/kernel/isa.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -155,6 +156,13 @@ namespace ngraph
                     }
                 }
 
+                if (out_rank == 2 && broadcast_axes.size() == 1 &&
+                    broadcast->get_input_element_type(0) == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::broadcast_2d_float32;
+                    return;
+                }
+
                 SELECT_KERNEL_ET_RANK(kernel,
                                       broadcast->get_input_element_type(0),
                                       out_rank,
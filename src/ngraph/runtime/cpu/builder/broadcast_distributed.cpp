@@ -14,8 +14,11 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
+
 #include "ngraph/op/broadcast_distributed.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/op/broadcast_distributed_async.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -29,18 +32,98 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::BroadcastDistributed)
             {
-                (void)out;
                 auto& functors = external_function->get_functors();
 
                 auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
-                auto count = static_cast<int>(args[0].get_size());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto count = args[0].get_size();
                 auto data_type = args[0].get_element_type();
+                auto size = count * data_type.size();
+                auto options = BroadcastOptions::get_default(data_type.size());
                 auto broadcast = static_cast<const ngraph::op::BroadcastDistributed*>(node);
                 auto root_id = broadcast->get_root_id();
-                auto functor = [&, count, data_type, arg_buffer_index, root_id](
+                auto functor = [&,
+                                count,
+                                data_type,
+                                size,
+                                options,
+                                arg_buffer_index,
+                                out_buffer_index,
+                                root_id](CPURuntimeContext* ctx,
+                                         CPUExecutionContext* /* ectx */) {
+                    auto distributed = get_distributed_interface();
+                    auto out_data = ctx->buffer_data[out_buffer_index];
+                    if (distributed->get_rank() == root_id &&
+                        out_data != ctx->buffer_data[arg_buffer_index])
+                    {
+                        memcpy(out_data, ctx->buffer_data[arg_buffer_index], size);
+                    }
+                    distributed->broadcast(out_data, data_type, count, root_id, options);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::BroadcastDistributedStart)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto count = args[0].get_size();
+                auto data_type = args[0].get_element_type();
+                auto size = count * data_type.size();
+                auto options = BroadcastOptions::get_default(data_type.size());
+                auto root_id =
+                    static_cast<const ngraph::op::BroadcastDistributedStart*>(node)->get_root_id();
+                auto request_index = external_function->get_distributed_request_index(node);
+
+                auto functor = [&,
+                                count,
+                                data_type,
+                                size,
+                                options,
+                                arg_buffer_index,
+                                out_buffer_index,
+                                root_id,
+                                request_index](CPURuntimeContext* ctx,
+                                               CPUExecutionContext* /* ectx */) {
+                    auto distributed = get_distributed_interface();
+                    auto out_data = ctx->buffer_data[out_buffer_index];
+                    if (distributed->get_rank() == root_id)
+                    {
+                        memcpy(out_data, ctx->buffer_data[arg_buffer_index], size);
+                    }
+                    ctx->distributed_requests[request_index] =
+                        distributed->broadcast_start(out_data, data_type, count, root_id, options)
+                            .release();
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::BroadcastDistributedWait)
+            {
+                auto& functors = external_function->get_functors();
+                auto start_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto size = out[0].get_size() * out[0].get_element_type().size();
+                auto request_index = external_function->get_distributed_request_index(
+                    node->input_value(0).get_node());
+
+                auto functor = [&, start_buffer_index, out_buffer_index, size, request_index](
                     CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
-                    get_distributed_interface()->broadcast(
-                        ctx->buffer_data[arg_buffer_index], data_type, count, root_id);
+                    std::unique_ptr<DistributedRequest> request(
+                        ctx->distributed_requests[request_index]);
+                    ctx->distributed_requests[request_index] = nullptr;
+                    request->wait();
+                    // The output is normally assigned in place of the start's buffer
+                    if (ctx->buffer_data[out_buffer_index] != ctx->buffer_data[start_buffer_index])
+                    {
+                        memcpy(ctx->buffer_data[out_buffer_index],
+                               ctx->buffer_data[start_buffer_index],
+                               size);
+                    }
                 };
                 functors.emplace_back(functor);
             }
@@ -48,6 +131,8 @@ namespace ngraph
             void register_builders_broadcast_distributed_cpp()
             {
                 REGISTER_OP_BUILDER(BroadcastDistributed);
+                REGISTER_OP_BUILDER(BroadcastDistributedStart);
+                REGISTER_OP_BUILDER(BroadcastDistributedWait);
             }
         }
     }
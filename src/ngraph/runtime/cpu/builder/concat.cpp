@@ -152,12 +152,9 @@ namespace ngraph
                 }
                 else
                 {
-                    std::function<decltype(runtime::cpu::kernel::concat<float, 1>)> kernel;
+                    std::function<decltype(runtime::cpu::kernel::concat<float>)> kernel;
 
-                    SELECT_KERNEL_ET_RANK(kernel,
-                                          out[0].get_element_type(),
-                                          out[0].get_shape().size(),
-                                          runtime::cpu::kernel::concat)
+                    SELECT_KERNEL(kernel, out[0].get_element_type(), runtime::cpu::kernel::concat)
 
                     auto functor = [&,
                                     kernel,
@@ -166,7 +163,7 @@ namespace ngraph
                                     out_shape,
                                     axis,
                                     out_buffer_index](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* /* ectx */) {
+                                                      CPUExecutionContext* ectx) {
                         std::vector<void*> arg_tensors;
                         for (auto& arg_buffer_index : arg_buffer_indices)
                         {
@@ -176,7 +173,8 @@ namespace ngraph
                                arg_shapes,
                                ctx->buffer_data[out_buffer_index],
                                out_shape,
-                               axis);
+                               axis,
+                               ectx->arena);
                     };
                     functors.emplace_back(functor);
                 }
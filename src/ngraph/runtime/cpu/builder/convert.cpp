@@ -17,6 +17,7 @@
 #include "ngraph/op/convert.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/convert.hpp"
+#include "ngraph/runtime/cpu/kernel/isa.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -48,7 +49,12 @@ namespace ngraph
                 else if (args[0].get_element_type() == element::bf16 &&
                          out[0].get_element_type() == element::f32)
                 {
-                    kernel = runtime::cpu::kernel::convert_to_float32<bfloat16>;
+                    kernel = runtime::cpu::kernel::convert_bf16_to_float32;
+                }
+                else if (args[0].get_element_type() == element::f16 &&
+                         out[0].get_element_type() == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::convert_f16_to_float32;
                 }
                 else if (out[0].get_element_type() == element::f32)
                 {
@@ -105,7 +111,12 @@ namespace ngraph
                 else if (args[0].get_element_type() == element::f32 &&
                          out[0].get_element_type() == element::bf16)
                 {
-                    kernel = runtime::cpu::kernel::convert_to_bf16<float>;
+                    kernel = runtime::cpu::kernel::convert_float32_to_bf16;
+                }
+                else if (args[0].get_element_type() == element::f32 &&
+                         out[0].get_element_type() == element::f16)
+                {
+                    kernel = runtime::cpu::kernel::convert_float32_to_f16;
                 }
                 else
                 {
@@ -524,13 +524,8 @@ namespace ngraph
                     auto window_dilation_strides =
                         convolution->get_window_dilation_strides_forward();
                     auto padding_below = convolution->get_padding_below_forward();
-                    auto padding_above = convolution->get_padding_above_forward();
                     auto window_movement_strides =
                         convolution->get_window_movement_strides_forward();
-                    auto backward_delta_out_pad_below =
-                        convolution->compute_backward_delta_out_pad_below();
-                    auto backward_delta_out_pad_above =
-                        convolution->compute_backward_delta_out_pad_above();
 
                     auto functor = [&,
                                     kernel,
@@ -539,24 +534,23 @@ namespace ngraph
                                     in_shape,
                                     data_dilation_strides,
                                     window_dilation_strides,
-                                    backward_delta_out_pad_below,
-                                    backward_delta_out_pad_above,
+                                    padding_below,
                                     window_movement_strides,
                                     arg0_buffer_index,
                                     arg1_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* /* ectx */) {
+                                                      CPUExecutionContext* ectx) {
                         kernel(ctx->buffer_data[arg1_buffer_index],
                                ctx->buffer_data[arg0_buffer_index],
                                ctx->buffer_data[out_buffer_index],
                                arg1_shape,
                                arg0_shape,
                                in_shape,
-                               data_dilation_strides,
+                               window_movement_strides,
                                window_dilation_strides,
-                               backward_delta_out_pad_below,
-                               backward_delta_out_pad_above,
-                               window_movement_strides);
+                               padding_below,
+                               data_dilation_strides,
+                               ectx->arena);
                     };
                     functors.emplace_back(functor);
                 }
@@ -643,10 +637,7 @@ namespace ngraph
                     auto window_movement_strides =
                         convolution->get_window_movement_strides_forward();
                     auto padding_below = convolution->get_padding_below_forward();
-                    auto padding_above = convolution->get_padding_above_forward();
                     auto data_dilation_strides = convolution->get_data_dilation_strides_forward();
-                    CoordinateDiff backward_in_pad_above =
-                        convolution->compute_backward_in_pad_above();
 
                     auto functor = [&,
                                     kernel,
@@ -656,12 +647,11 @@ namespace ngraph
                                     window_dilation_strides,
                                     window_movement_strides,
                                     padding_below,
-                                    backward_in_pad_above,
                                     data_dilation_strides,
                                     arg0_buffer_index,
                                     arg1_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* /* ectx */) {
+                                                      CPUExecutionContext* ectx) {
                         kernel(ctx->buffer_data[arg0_buffer_index],
                                ctx->buffer_data[arg1_buffer_index],
                                ctx->buffer_data[out_buffer_index],
@@ -671,8 +661,8 @@ namespace ngraph
                                window_movement_strides,
                                window_dilation_strides,
                                padding_below,
-                               backward_in_pad_above,
-                               data_dilation_strides);
+                               data_dilation_strides,
+                               ectx->arena);
                     };
                     functors.emplace_back(functor);
                 }
@@ -0,0 +1,123 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/deformable_convolution.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/deformable_convolution.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace
+            {
+                template <typename T>
+                CPUKernelFunctor
+                    prepare_functor(const ngraph::op::v1::DeformableConvolution* conv,
+                                    const vector<TensorViewWrapper>& args,
+                                    const vector<TensorViewWrapper>& out,
+                                    CPU_ExternalFunction* external_function)
+                {
+                    auto in_shape = args[0].get_shape();
+                    auto filters_shape = args[2].get_shape();
+                    auto out_shape = out[0].get_shape();
+
+                    kernel::DeformableConvolutionParams params;
+                    params.batch = in_shape[0];
+                    params.channels = in_shape[1];
+                    params.out_channels = out_shape[1];
+                    params.in_h = in_shape[2];
+                    params.in_w = in_shape[3];
+                    params.kernel_h = filters_shape[2];
+                    params.kernel_w = filters_shape[3];
+                    params.out_h = out_shape[2];
+                    params.out_w = out_shape[3];
+                    params.stride_h = conv->get_strides()[0];
+                    params.stride_w = conv->get_strides()[1];
+                    params.dilation_h = conv->get_dilations()[0];
+                    params.dilation_w = conv->get_dilations()[1];
+                    params.pad_h = conv->get_pads_begin()[0];
+                    params.pad_w = conv->get_pads_begin()[1];
+                    params.group = conv->get_group();
+                    params.deformable_group = conv->get_deformable_group();
+
+                    auto in_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                    auto offsets_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto filters_buffer_index =
+                        external_function->get_buffer_index(args[2].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                    return [&,
+                            params,
+                            in_buffer_index,
+                            offsets_buffer_index,
+                            filters_buffer_index,
+                            out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel::deformable_convolution(
+                            static_cast<T*>(ctx->buffer_data[in_buffer_index]),
+                            static_cast<T*>(ctx->buffer_data[offsets_buffer_index]),
+                            static_cast<T*>(ctx->buffer_data[filters_buffer_index]),
+                            static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                            params,
+                            ectx->arena);
+                    };
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v1::DeformableConvolution)
+            {
+                auto& functors = external_function->get_functors();
+                auto conv = static_cast<const ngraph::op::v1::DeformableConvolution*>(node);
+                CPUKernelFunctor functor;
+
+                if (args[0].get_shape().size() != 4)
+                {
+                    throw ngraph_error(
+                        "Only 2D data is supported in CPU Builder for DeformableConvolution");
+                }
+
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    functor = prepare_functor<float>(conv, args, out, external_function);
+                }
+                else if (element_type == element::f64)
+                {
+                    functor = prepare_functor<double>(conv, args, out, external_function);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported type (" + element_type.get_type_name() +
+                                       ") in CPU Builder for DeformableConvolution");
+                }
+
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_deformable_convolution_cpp()
+            {
+                REGISTER_OP_BUILDER(v1::DeformableConvolution);
+            }
+        }
+    }
+}
@@ -0,0 +1,114 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/deformable_psroi_pooling.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/deformable_psroi_pooling.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace
+            {
+                template <typename T>
+                CPUKernelFunctor
+                    prepare_functor(const ngraph::op::v1::DeformablePSROIPooling* pooling,
+                                    const vector<TensorViewWrapper>& args,
+                                    const vector<TensorViewWrapper>& out,
+                                    CPU_ExternalFunction* external_function)
+                {
+                    auto in_shape = args[0].get_shape();
+
+                    kernel::DeformablePSROIPoolingParams params;
+                    params.channels = in_shape[1];
+                    params.in_h = in_shape[2];
+                    params.in_w = in_shape[3];
+                    params.rois = args[1].get_shape()[0];
+                    params.output_dim = pooling->get_output_dim();
+                    params.group_size = pooling->get_group_size();
+                    params.spatial_scale = pooling->get_spatial_scale();
+                    params.spatial_bins_x = pooling->get_spatial_bins_x();
+                    params.spatial_bins_y = pooling->get_spatial_bins_y();
+                    params.trans_std = pooling->get_trans_std();
+                    params.part_size = pooling->get_part_size();
+                    params.classes = args.size() == 3 ? args[2].get_shape()[1] / 2 : 0;
+
+                    auto in_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                    auto coords_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto offsets_buffer_index =
+                        args.size() == 3 ? external_function->get_buffer_index(args[2].get_name())
+                                         : 0;
+                    bool has_offsets = args.size() == 3;
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                    return [&,
+                            params,
+                            has_offsets,
+                            in_buffer_index,
+                            coords_buffer_index,
+                            offsets_buffer_index,
+                            out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel::deformable_psroi_pooling(
+                            static_cast<T*>(ctx->buffer_data[in_buffer_index]),
+                            static_cast<T*>(ctx->buffer_data[coords_buffer_index]),
+                            has_offsets ? static_cast<T*>(ctx->buffer_data[offsets_buffer_index])
+                                        : nullptr,
+                            static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                            params,
+                            ectx->arena);
+                    };
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v1::DeformablePSROIPooling)
+            {
+                auto& functors = external_function->get_functors();
+                auto pooling = static_cast<const ngraph::op::v1::DeformablePSROIPooling*>(node);
+                CPUKernelFunctor functor;
+
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    functor = prepare_functor<float>(pooling, args, out, external_function);
+                }
+                else if (element_type == element::f64)
+                {
+                    functor = prepare_functor<double>(pooling, args, out, external_function);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported type (" + element_type.get_type_name() +
+                                       ") in CPU Builder for DeformablePSROIPooling");
+                }
+
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_deformable_psroi_pooling_cpp()
+            {
+                REGISTER_OP_BUILDER(v1::DeformablePSROIPooling);
+            }
+        }
+    }
+}
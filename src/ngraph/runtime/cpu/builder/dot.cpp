@@ -20,6 +20,7 @@
 #include "ngraph/op/dot.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/cpu_packed_gemm.hpp"
 #include "ngraph/runtime/cpu/kernel/dot.hpp"
 
 using namespace std;
@@ -201,6 +202,39 @@ namespace ngraph
                     auto lda = arg0_shape[1];
                     auto ldb = arg1_shape[1];
                     const float beta = 0.0f;
+
+                    // Constant weights are packed once here instead of on every call
+                    auto packed_b = make_packed_gemm_operand(node, 1, transpose_B, m, n, k, ldb);
+                    auto packed_a =
+                        packed_b ? nullptr
+                                 : make_packed_gemm_operand(node, 0, transpose_A, m, n, k, lda);
+                    if (packed_a || packed_b)
+                    {
+                        auto packed = packed_b ? packed_b : packed_a;
+                        external_function->add_prepacked_weight_bytes(packed->size());
+                        auto other_buffer_index = packed_b ? arg0_buffer_index : arg1_buffer_index;
+                        auto transpose_other = packed_b ? transpose_A : transpose_B;
+                        auto ld_other = packed_b ? lda : ldb;
+                        auto functor = [&,
+                                        packed,
+                                        other_buffer_index,
+                                        transpose_other,
+                                        ld_other,
+                                        result_shape,
+                                        out_buffer_index](CPURuntimeContext* ctx,
+                                                          CPUExecutionContext* /* ectx */) {
+                            packed->compute(
+                                static_cast<float*>(ctx->buffer_data[other_buffer_index]),
+                                transpose_other,
+                                max<size_t>(1UL, ld_other),
+                                0.0f,
+                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                                max<size_t>(1UL, result_shape[1]));
+                        };
+                        functors.emplace_back(functor);
+                        return;
+                    }
+
                     auto functor = [&,
                                     transpose_A,
                                     transpose_B,
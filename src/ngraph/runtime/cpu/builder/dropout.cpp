@@ -16,7 +16,8 @@
 
 #include "ngraph/runtime/cpu/op/dropout.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/cpu/kernel/dropout.hpp"
+#include "ngraph/runtime/cpu/kernel/random.hpp"
+#include "ngraph/state/uniform_rng_state.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -27,96 +28,123 @@ namespace ngraph
     {
         namespace cpu
         {
-            template <>
-            void Builder::BUILDER_DECL(ngraph::op::Dropout)
+            namespace
             {
-                auto& functors = external_function->get_functors();
-
-                auto drop = static_cast<const ngraph::op::Dropout*>(node);
-                CPUKernelFunctor functor;
-
-                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
-                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
-                auto arg4_buffer_index = external_function->get_buffer_index(args[4].get_name());
-                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
-                auto out1_buffer_index = external_function->get_buffer_index(out[1].get_name());
+                template <typename T>
+                CPUKernelFunctor prepare_dropout(const ngraph::op::Dropout* drop,
+                                                 const vector<TensorViewWrapper>& args,
+                                                 const vector<TensorViewWrapper>& out,
+                                                 CPU_ExternalFunction* external_function)
+                {
+                    auto arg_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto arg1_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto arg4_buffer_index =
+                        external_function->get_buffer_index(args[4].get_name());
+                    auto out0_buffer_index =
+                        external_function->get_buffer_index(out[0].get_name());
+                    auto out1_buffer_index =
+                        external_function->get_buffer_index(out[1].get_name());
 
-                size_t element_count = out[0].get_size();
+                    size_t element_count = out[0].get_size();
 
-                bool use_seed = drop->get_use_seed();
+                    bool use_seed = drop->get_use_seed();
+                    bool packed_mask = drop->get_packed_mask();
 
-                // Note: for performance optimization in addition to parallel RNG with multiple,
-                // threads, we create, initialize and advance each msr here in builder instead of
-                // in kernel. By doing so here, we saved 30% vs. kernel
-                // msr.discard() has the biggest impact on performance.
-                // But we need discard only when use_seed==true to generate same mask.
-                size_t nthr = ngraph::runtime::cpu::executor::GetCPUExecutor().get_num_cores();
-                size_t chunk_size = (element_count + nthr - 1) / nthr;
-                std::vector<std::minstd_rand> vmsr(nthr);
-                if (use_seed)
-                {
+                    // With a seed every call draws the same mask, as in the frameworks' own
+                    // dropout; otherwise consecutive calls continue the stream of the node's
+                    // state.
                     uint64_t seed = drop->get_seed();
-                    for (size_t i = 0; i < nthr; i++)
-                    {
-                        std::minstd_rand msr;
-                        msr.seed(seed);
-                        msr.discard(i * chunk_size);
-                        vmsr[i] = msr;
-                    }
-                }
+                    auto index = external_function->add_state(
+                        use_seed ? new ngraph::UniformRNGState(seed)
+                                 : new ngraph::UniformRNGState());
 
-                if (args[0].get_element_type() == element::f32)
-                {
-                    functor = [&,
-                               element_count,
-                               arg_buffer_index,
-                               arg1_buffer_index,
-                               arg4_buffer_index,
-                               out0_buffer_index,
-                               out1_buffer_index,
-                               vmsr,
-                               use_seed](CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                    return [element_count,
+                            arg_buffer_index,
+                            arg1_buffer_index,
+                            arg4_buffer_index,
+                            out0_buffer_index,
+                            out1_buffer_index,
+                            index,
+                            use_seed,
+                            packed_mask](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
                         bool training = static_cast<bool>(
-                            static_cast<float*>(ctx->buffer_data[arg1_buffer_index])[0]);
+                            static_cast<T*>(ctx->buffer_data[arg1_buffer_index])[0]);
                         double keep_prob =
                             static_cast<double*>(ctx->buffer_data[arg4_buffer_index])[0];
-                        runtime::cpu::kernel::generate_dropout(
-                            static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
-                            static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
-                            static_cast<float*>(ctx->buffer_data[out1_buffer_index]),
-                            element_count,
-                            training,
-                            keep_prob,
-                            vmsr,
-                            use_seed);
+                        auto state = static_cast<UniformRNGState*>(ctx->states[index]);
+                        auto input = static_cast<T*>(ctx->buffer_data[arg_buffer_index]);
+                        auto out0 = static_cast<T*>(ctx->buffer_data[out0_buffer_index]);
+                        uint64_t offset = use_seed ? 0 : state->reserve(element_count);
+                        if (packed_mask)
+                        {
+                            kernel::dropout_packed(
+                                input,
+                                out0,
+                                static_cast<uint32_t*>(ctx->buffer_data[out1_buffer_index]),
+                                element_count,
+                                training,
+                                keep_prob,
+                                state->get_philox(),
+                                offset,
+                                ectx->arena);
+                        }
+                        else
+                        {
+                            kernel::dropout(input,
+                                            out0,
+                                            static_cast<T*>(ctx->buffer_data[out1_buffer_index]),
+                                            element_count,
+                                            training,
+                                            keep_prob,
+                                            state->get_philox(),
+                                            offset,
+                                            ectx->arena);
+                        }
                     };
                 }
-                else if (args[0].get_element_type() == element::f64)
+
+                template <typename T>
+                CPUKernelFunctor prepare_mask_multiply(const vector<TensorViewWrapper>& args,
+                                                       const vector<TensorViewWrapper>& out,
+                                                       CPU_ExternalFunction* external_function)
                 {
-                    functor = [&,
-                               element_count,
-                               arg_buffer_index,
-                               arg1_buffer_index,
-                               arg4_buffer_index,
-                               out0_buffer_index,
-                               out1_buffer_index,
-                               vmsr,
-                               use_seed](CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
-                        bool training = static_cast<bool>(
-                            static_cast<double*>(ctx->buffer_data[arg1_buffer_index])[0]);
-                        double keep_prob =
-                            static_cast<double*>(ctx->buffer_data[arg4_buffer_index])[0];
-                        runtime::cpu::kernel::generate_dropout(
-                            static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
-                            static_cast<double*>(ctx->buffer_data[out0_buffer_index]),
-                            static_cast<double*>(ctx->buffer_data[out1_buffer_index]),
+                    auto arg_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto mask_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                    size_t element_count = out[0].get_size();
+
+                    return [element_count, arg_buffer_index, mask_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel::dropout_mask_multiply(
+                            static_cast<T*>(ctx->buffer_data[arg_buffer_index]),
+                            static_cast<uint32_t*>(ctx->buffer_data[mask_buffer_index]),
+                            static_cast<T*>(ctx->buffer_data[out_buffer_index]),
                             element_count,
-                            training,
-                            keep_prob,
-                            vmsr,
-                            use_seed);
+                            ectx->arena);
                     };
                 }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Dropout)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto drop = static_cast<const ngraph::op::Dropout*>(node);
+                CPUKernelFunctor functor;
+
+                if (args[0].get_element_type() == element::f32)
+                {
+                    functor = prepare_dropout<float>(drop, args, out, external_function);
+                }
+                else if (args[0].get_element_type() == element::f64)
+                {
+                    functor = prepare_dropout<double>(drop, args, out, external_function);
+                }
                 else
                 {
                     throw ngraph_error(std::string("Unsupported type") +
@@ -125,7 +153,34 @@ namespace ngraph
                 functors.emplace_back(functor);
             }
 
-            void register_builders_dropout_cpp() { REGISTER_OP_BUILDER(Dropout); }
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::DropoutMaskMultiply)
+            {
+                auto& functors = external_function->get_functors();
+                CPUKernelFunctor functor;
+
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    functor = prepare_mask_multiply<float>(args, out, external_function);
+                }
+                else if (element_type == element::f64)
+                {
+                    functor = prepare_mask_multiply<double>(args, out, external_function);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported type (" + element_type.get_type_name() +
+                                       ") in CPU Builder for DropoutMaskMultiply");
+                }
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_dropout_cpp()
+            {
+                REGISTER_OP_BUILDER(Dropout);
+                REGISTER_OP_BUILDER(DropoutMaskMultiply);
+            }
         }
     }
 }
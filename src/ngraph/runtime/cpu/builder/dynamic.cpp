@@ -0,0 +1,289 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/op/experimental/dyn_broadcast.hpp"
+#include "ngraph/op/experimental/dyn_replace_slice.hpp"
+#include "ngraph/op/experimental/dyn_reshape.hpp"
+#include "ngraph/op/experimental/dyn_slice.hpp"
+#include "ngraph/op/experimental/range.hpp"
+#include "ngraph/op/experimental/shape_of.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/dynamic.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Kernels for the experimental dynamic-shape ops that read their shape, bound and axis inputs
+// from the tensors at run time, so that these ops do not need to be rewritten to their static
+// counterparts by DynElimination first. The output shapes are still static; a runtime value
+// that would change them is an error.
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            static vector<int64_t> read_i64_vector(const void* data, size_t count)
+            {
+                auto values = static_cast<const int64_t*>(data);
+                return vector<int64_t>(values, values + count);
+            }
+
+            // Returns a function that makes the slice plan of `op` from the bounds in its
+            // inputs `first_bound` to `first_bound + 2`, and checks that it selects
+            // `sliced_shape`.
+            template <typename OP>
+            static function<SlicePlan(CPURuntimeContext*)>
+                runtime_slice_plan(CPU_ExternalFunction* external_function,
+                                   const OP* op,
+                                   const vector<TensorViewWrapper>& args,
+                                   size_t first_bound,
+                                   const Shape& sliced_shape)
+            {
+                auto lower_buffer_index =
+                    external_function->get_buffer_index(args[first_bound].get_name());
+                auto upper_buffer_index =
+                    external_function->get_buffer_index(args[first_bound + 1].get_name());
+                auto strides_buffer_index =
+                    external_function->get_buffer_index(args[first_bound + 2].get_name());
+                auto bounds_count = shape_size(args[first_bound].get_shape());
+                auto arg_shape = args[0].get_shape();
+                auto name = op->get_name();
+
+                auto lower_bounds_mask = op->get_lower_bounds_mask();
+                auto upper_bounds_mask = op->get_upper_bounds_mask();
+                auto new_axis = op->get_new_axis();
+                auto shrink_axis = op->get_shrink_axis();
+                auto ellipsis_mask = op->get_ellipsis_mask();
+
+                return [=](CPURuntimeContext* ctx) {
+                    auto plan = make_slice_plan(
+                        arg_shape,
+                        read_i64_vector(ctx->buffer_data[lower_buffer_index], bounds_count),
+                        read_i64_vector(ctx->buffer_data[upper_buffer_index], bounds_count),
+                        read_i64_vector(ctx->buffer_data[strides_buffer_index], bounds_count),
+                        lower_bounds_mask,
+                        upper_bounds_mask,
+                        new_axis,
+                        shrink_axis,
+                        ellipsis_mask);
+                    NGRAPH_CHECK(plan.reshape_out_shape == sliced_shape,
+                                 "Bounds of ",
+                                 name,
+                                 " select ",
+                                 plan.reshape_out_shape,
+                                 " instead of the compiled shape ",
+                                 sliced_shape);
+                    return plan;
+                };
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::DynSlice)
+            {
+                auto dyn_slice = static_cast<const ngraph::op::DynSlice*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto arg_shape = args[0].get_shape();
+                auto plan_of =
+                    runtime_slice_plan(external_function, dyn_slice, args, 1, out[0].get_shape());
+
+                std::function<decltype(runtime::cpu::kernel::dyn_slice<float>)> kernel;
+                SELECT_KERNEL(kernel, args[0].get_element_type(), runtime::cpu::kernel::dyn_slice)
+
+                auto functor =
+                    [&, kernel, plan_of, arg_shape, arg_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               arg_shape,
+                               plan_of(ctx),
+                               ectx->arena);
+                    };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::DynReplaceSlice)
+            {
+                auto dyn_replace_slice = static_cast<const ngraph::op::DynReplaceSlice*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto replacement_buffer_index =
+                    external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto arg_shape = args[0].get_shape();
+                auto plan_of = runtime_slice_plan(
+                    external_function, dyn_replace_slice, args, 2, args[1].get_shape());
+
+                std::function<decltype(runtime::cpu::kernel::dyn_replace_slice<float>)> kernel;
+                SELECT_KERNEL(
+                    kernel, args[0].get_element_type(), runtime::cpu::kernel::dyn_replace_slice)
+
+                auto functor = [&,
+                                kernel,
+                                plan_of,
+                                arg_shape,
+                                arg_buffer_index,
+                                replacement_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg_buffer_index],
+                           ctx->buffer_data[replacement_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           arg_shape,
+                           plan_of(ctx),
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::DynBroadcast)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto shape_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto axes_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto arg_shape = args[0].get_shape();
+                auto out_shape = out[0].get_shape();
+                auto axes_count = shape_size(args[2].get_shape());
+                auto name = node->get_name();
+
+                std::function<decltype(runtime::cpu::kernel::dyn_broadcast<float>)> kernel;
+                SELECT_KERNEL(
+                    kernel, args[0].get_element_type(), runtime::cpu::kernel::dyn_broadcast)
+
+                auto functor = [&,
+                                kernel,
+                                arg_shape,
+                                out_shape,
+                                axes_count,
+                                name,
+                                arg_buffer_index,
+                                shape_buffer_index,
+                                axes_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    auto shape =
+                        read_i64_vector(ctx->buffer_data[shape_buffer_index], out_shape.size());
+                    NGRAPH_CHECK(Shape(shape.begin(), shape.end()) == out_shape,
+                                 "Shape input of ",
+                                 name,
+                                 " does not match the compiled shape ",
+                                 out_shape);
+                    auto axes = read_i64_vector(ctx->buffer_data[axes_buffer_index], axes_count);
+                    AxisSet broadcast_axes(vector<size_t>(axes.begin(), axes.end()));
+                    NGRAPH_CHECK(broadcast_axes.size() + arg_shape.size() == out_shape.size(),
+                                 "Axes input of ",
+                                 name,
+                                 " does not match the compiled shapes");
+                    kernel(ctx->buffer_data[arg_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           arg_shape,
+                           out_shape,
+                           broadcast_axes,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::DynReshape)
+            {
+                (void)node;
+                auto& functors = external_function->get_functors();
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto size = out[0].get_size() * out[0].get_element_type().size();
+
+                // The pattern only determines the output shape, which is static here
+                auto functor = [&, size, arg_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                    if (ctx->buffer_data[arg_buffer_index] != ctx->buffer_data[out_buffer_index])
+                    {
+                        memcpy(ctx->buffer_data[out_buffer_index],
+                               ctx->buffer_data[arg_buffer_index],
+                               size);
+                    }
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Range)
+            {
+                (void)node;
+                auto& functors = external_function->get_functors();
+
+                auto start_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto step_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto out_shape = out[0].get_shape();
+
+                std::function<decltype(runtime::cpu::kernel::range<float>)> kernel;
+                SELECT_KERNEL(kernel, out[0].get_element_type(), runtime::cpu::kernel::range)
+
+                auto functor =
+                    [&, kernel, out_shape, start_buffer_index, step_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                        kernel(ctx->buffer_data[start_buffer_index],
+                               ctx->buffer_data[step_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               out_shape);
+                    };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ShapeOf)
+            {
+                (void)node;
+                auto& functors = external_function->get_functors();
+
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto& arg_shape = args[0].get_shape();
+                vector<int64_t> shape(arg_shape.begin(), arg_shape.end());
+
+                auto functor = [&, shape, out_buffer_index](CPURuntimeContext* ctx,
+                                                            CPUExecutionContext* /* ectx */) {
+                    memcpy(ctx->buffer_data[out_buffer_index],
+                           shape.data(),
+                           shape.size() * sizeof(int64_t));
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_dynamic_cpp()
+            {
+                REGISTER_OP_BUILDER(DynBroadcast);
+                REGISTER_OP_BUILDER(DynReplaceSlice);
+                REGISTER_OP_BUILDER(DynReshape);
+                REGISTER_OP_BUILDER(DynSlice);
+                REGISTER_OP_BUILDER(Range);
+                REGISTER_OP_BUILDER(ShapeOf);
+            }
+        }
+    }
+}
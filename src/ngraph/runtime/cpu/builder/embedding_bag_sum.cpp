@@ -0,0 +1,127 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdint>
+
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/embedding_lookup.hpp"
+#include "ngraph/runtime/cpu/op/embedding_bag_sum.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace
+            {
+                template <typename T, typename U>
+                CPUKernelFunctor prepare_functor(const vector<TensorViewWrapper>& args,
+                                                 const vector<TensorViewWrapper>& out,
+                                                 CPU_ExternalFunction* external_function)
+                {
+                    auto indices_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto weights_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                    auto indices_shape = args[0].get_shape();
+                    auto weights_shape = args[1].get_shape();
+
+                    std::function<decltype(runtime::cpu::kernel::embedding_bag_sum<T, U>)> kernel;
+                    SELECT_INNER_DIM(
+                        kernel, weights_shape[1], runtime::cpu::kernel::embedding_bag_sum, T, U);
+
+                    return [&,
+                            kernel,
+                            indices_shape,
+                            weights_shape,
+                            indices_buffer_index,
+                            weights_buffer_index,
+                            out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel(static_cast<T*>(ctx->buffer_data[weights_buffer_index]),
+                               static_cast<U*>(ctx->buffer_data[indices_buffer_index]),
+                               static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                               indices_shape[0],
+                               indices_shape[1],
+                               weights_shape[1],
+                               weights_shape[0],
+                               ectx->arena);
+                    };
+                }
+
+                template <typename T>
+                CPUKernelFunctor prepare_functor(const vector<TensorViewWrapper>& args,
+                                                 const vector<TensorViewWrapper>& out,
+                                                 CPU_ExternalFunction* external_function)
+                {
+                    auto index_element_type = args[0].get_element_type();
+                    if (index_element_type == element::f32)
+                    {
+                        return prepare_functor<T, float>(args, out, external_function);
+                    }
+                    else if (index_element_type == element::i32)
+                    {
+                        return prepare_functor<T, int>(args, out, external_function);
+                    }
+                    else if (index_element_type == element::i64)
+                    {
+                        return prepare_functor<T, int64_t>(args, out, external_function);
+                    }
+                    else
+                    {
+                        throw ngraph_error(
+                            "Unsupported index type in CPU Builder for EmbeddingBagSum");
+                    }
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::EmbeddingBagSum)
+            {
+                (void)node;
+                auto& functors = external_function->get_functors();
+
+                CPUKernelFunctor functor;
+                auto element_type = out[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    functor = prepare_functor<float>(args, out, external_function);
+                }
+                else if (element_type == element::f64)
+                {
+                    functor = prepare_functor<double>(args, out, external_function);
+                }
+                else if (element_type == element::i32)
+                {
+                    functor = prepare_functor<int>(args, out, external_function);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported type in CPU Builder for EmbeddingBagSum");
+                }
+
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_embedding_bag_sum_cpp() { REGISTER_OP_BUILDER(EmbeddingBagSum); }
+        }
+    }
+}
@@ -15,11 +15,10 @@
 //*****************************************************************************
 
 #include <cstdint>
-#include <cstring>
 
 #include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/embedding_lookup.hpp"
+#include "ngraph/runtime/cpu/kernel/embedding_lookup.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -30,82 +29,56 @@ namespace ngraph
     {
         namespace cpu
         {
-            template <>
-            void Builder::BUILDER_DECL(ngraph::op::EmbeddingLookup)
+            namespace
             {
-                (void)node;
-                auto& functors = external_function->get_functors();
-
-                CPUKernelFunctor functor;
-                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
-                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
-                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
-
-                if (out[0].get_element_type() != element::f32 &&
-                    out[0].get_element_type() != element::f64)
+                template <typename T, typename U>
+                CPUKernelFunctor prepare_functor(const vector<TensorViewWrapper>& args,
+                                                 const vector<TensorViewWrapper>& out,
+                                                 CPU_ExternalFunction* external_function)
                 {
-                    throw ngraph_error("Unsupported output element type");
+                    auto arg0_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto arg1_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                    auto in_shape = args[1].get_shape();
+                    size_t element_count = shape_size(args[0].get_shape());
+
+                    return [&,
+                            in_shape,
+                            element_count,
+                            arg0_buffer_index,
+                            arg1_buffer_index,
+                            out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        runtime::cpu::kernel::gather_rows<T, U>(
+                            static_cast<T*>(ctx->buffer_data[arg1_buffer_index]),
+                            static_cast<U*>(ctx->buffer_data[arg0_buffer_index]),
+                            static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                            element_count,
+                            in_shape.at(1),
+                            in_shape.at(0),
+                            ectx->arena);
+                    };
                 }
-                auto in_shape = args[1].get_shape();
-                size_t element_count = shape_size(args[0].get_shape());
-                auto out_shape = out[0].get_shape();
-                auto element_type = out[0].get_element_type();
-                auto index_element_type = args[0].get_element_type();
-                if (element_type == element::f32)
+
+                template <typename T>
+                CPUKernelFunctor prepare_functor(const vector<TensorViewWrapper>& args,
+                                                 const vector<TensorViewWrapper>& out,
+                                                 CPU_ExternalFunction* external_function)
                 {
+                    auto index_element_type = args[0].get_element_type();
                     if (index_element_type == element::f32)
                     {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-
-                            ngraph::runtime::reference::embedding<float, float>(
-                                static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
+                        return prepare_functor<T, float>(args, out, external_function);
                     }
                     else if (index_element_type == element::i32)
                     {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-
-                            ngraph::runtime::reference::embedding<float, int>(
-                                static_cast<int*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
+                        return prepare_functor<T, int>(args, out, external_function);
                     }
                     else if (index_element_type == element::i64)
                     {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-
-                            ngraph::runtime::reference::embedding<float, int64_t>(
-                                static_cast<int64_t*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
+                        return prepare_functor<T, int64_t>(args, out, external_function);
                     }
                     else
                     {
@@ -113,129 +86,27 @@ namespace ngraph
                             "Unsupported index type in CPU Builder for EmbeddingLookup");
                     }
                 }
-                else if (element_type == element::f64)
-                {
-                    if (index_element_type == element::f32)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-
-                            ngraph::runtime::reference::embedding<double, float>(
-                                static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else if (index_element_type == element::i32)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
+            }
 
-                            ngraph::runtime::reference::embedding<double, int>(
-                                static_cast<int*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else if (index_element_type == element::i64)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::EmbeddingLookup)
+            {
+                (void)node;
+                auto& functors = external_function->get_functors();
 
-                            ngraph::runtime::reference::embedding<double, int64_t>(
-                                static_cast<int64_t*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else
-                    {
-                        throw ngraph_error(
-                            "Unsupported index type in CPU Builder for EmbeddingLookup");
-                    }
+                CPUKernelFunctor functor;
+                auto element_type = out[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    functor = prepare_functor<float>(args, out, external_function);
+                }
+                else if (element_type == element::f64)
+                {
+                    functor = prepare_functor<double>(args, out, external_function);
                 }
                 else if (element_type == element::i32)
                 {
-                    if (index_element_type == element::f32)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-
-                            ngraph::runtime::reference::embedding<int, float>(
-                                static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<int*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<int*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else if (index_element_type == element::i32)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-
-                            ngraph::runtime::reference::embedding<int, int>(
-                                static_cast<int*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<int*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<int*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else if (index_element_type == element::i64)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-
-                            ngraph::runtime::reference::embedding<int, int64_t>(
-                                static_cast<int64_t*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<int*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<int*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else
-                    {
-                        throw ngraph_error(
-                            "Unsupported index type in CPU Builder for EmbeddingLookup");
-                    }
+                    functor = prepare_functor<int>(args, out, external_function);
                 }
                 else
                 {
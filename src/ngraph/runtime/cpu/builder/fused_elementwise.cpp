@@ -0,0 +1,130 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/kernel/fused_elementwise.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::FusedElementwise)
+            {
+                auto fused = static_cast<const ngraph::op::FusedElementwise*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto shape = fused->get_program_shape();
+                auto reduced_rank = fused->get_reduction_axes().size();
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto& broadcast_axes = fused->get_broadcast_axes();
+                auto program = fused->get_program();
+
+                // Dense inputs get no strides; broadcast inputs get their stride along every
+                // program axis, with 0 on the axes they are broadcast along.
+                vector<size_t> arg_buffer_indices;
+                vector<vector<size_t>> arg_strides;
+                for (size_t i = 0; i < args.size(); i++)
+                {
+                    arg_buffer_indices.push_back(
+                        external_function->get_buffer_index(args[i].get_name()));
+
+                    vector<size_t> strides;
+                    if (!broadcast_axes[i].empty())
+                    {
+                        auto arg_strides_row_major = row_major_strides(args[i].get_shape());
+                        size_t arg_axis = 0;
+                        for (size_t axis = 0; axis < shape.size(); axis++)
+                        {
+                            strides.push_back(broadcast_axes[i].count(axis) != 0
+                                                  ? 0
+                                                  : arg_strides_row_major[arg_axis++]);
+                        }
+                    }
+                    arg_strides.push_back(strides);
+                }
+
+                std::function<decltype(runtime::cpu::kernel::fused_elementwise<float>)> kernel;
+                std::function<decltype(runtime::cpu::kernel::fused_elementwise_sum<float>)>
+                    sum_kernel;
+                if (out[0].get_element_type() == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::fused_elementwise<float>;
+                    sum_kernel = runtime::cpu::kernel::fused_elementwise_sum<float>;
+                }
+                else if (out[0].get_element_type() == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::fused_elementwise<double>;
+                    sum_kernel = runtime::cpu::kernel::fused_elementwise_sum<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       out[0].get_element_type().c_type_string() +
+                                       " for FusedElementwise");
+                }
+
+                auto functor = [&,
+                                kernel,
+                                sum_kernel,
+                                arg_buffer_indices,
+                                arg_strides,
+                                program,
+                                shape,
+                                reduced_rank,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    vector<void*> inputs(arg_buffer_indices.size());
+                    for (size_t i = 0; i < arg_buffer_indices.size(); i++)
+                    {
+                        inputs[i] = ctx->buffer_data[arg_buffer_indices[i]];
+                    }
+                    if (reduced_rank == 0)
+                    {
+                        kernel(inputs,
+                               ctx->buffer_data[out_buffer_index],
+                               arg_strides,
+                               program,
+                               shape,
+                               ectx->arena);
+                    }
+                    else
+                    {
+                        sum_kernel(inputs,
+                                   ctx->buffer_data[out_buffer_index],
+                                   arg_strides,
+                                   program,
+                                   shape,
+                                   reduced_rank,
+                                   ectx->arena);
+                    }
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_fused_elementwise_cpp()
+            {
+                REGISTER_OP_BUILDER(FusedElementwise);
+            }
+        }
+    }
+}
@@ -18,6 +18,7 @@
 
 #include "ngraph/op/gather.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/embedding_lookup.hpp"
 #include "ngraph/runtime/cpu/kernel/gather.hpp"
 #include "ngraph/runtime/reference/gather.hpp"
 
@@ -32,6 +33,42 @@ namespace ngraph
         {
             namespace
             {
+                // Gathering along axis 0 copies whole rows of params, so it is done with the
+                // parallel row-gather kernel for any rank and element type.
+                template <typename T, typename U>
+                CPUKernelFunctor prepare_rows_functor(const vector<TensorViewWrapper>& args,
+                                                      const vector<TensorViewWrapper>& out,
+                                                      CPU_ExternalFunction* external_function)
+                {
+                    auto params_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto indices_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                    auto params_shape = args[0].get_shape();
+                    size_t count = shape_size(args[1].get_shape());
+                    size_t rows = params_shape.at(0);
+                    size_t row_length = rows == 0 ? 0 : shape_size(params_shape) / rows;
+
+                    return [&,
+                            count,
+                            rows,
+                            row_length,
+                            params_buffer_index,
+                            indices_buffer_index,
+                            out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        runtime::cpu::kernel::gather_rows<T, U>(
+                            static_cast<T*>(ctx->buffer_data[params_buffer_index]),
+                            static_cast<U*>(ctx->buffer_data[indices_buffer_index]),
+                            static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                            count,
+                            row_length,
+                            rows,
+                            ectx->arena);
+                    };
+                }
+
                 template <typename T>
                 CPUKernelFunctor prepare_functor(const Node* node,
                                                  const vector<TensorViewWrapper>& args,
@@ -51,6 +88,13 @@ namespace ngraph
                     auto indices_shape = args[1].get_shape();
                     auto out_shape = out[0].get_shape();
 
+                    if (axis == 0)
+                    {
+                        return is_int64
+                                   ? prepare_rows_functor<T, int64_t>(args, out, external_function)
+                                   : prepare_rows_functor<T, int32_t>(args, out, external_function);
+                    }
+
                     if (is_int64)
                     {
                         if ((args[0].get_element_type() == element::f32 ||
@@ -16,6 +16,7 @@
 
 #include "ngraph/op/fused/gelu.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/isa.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
@@ -77,9 +78,21 @@ namespace ngraph
                     };
                     functors.emplace_back(functor);
                 }
+                else if (args[0].get_element_type() == element::f32)
+                {
+                    auto element_count = out[0].get_size();
+                    auto functor = [&, element_count, input_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        runtime::cpu::kernel::gelu_float32(ctx->buffer_data[input_buffer_index],
+                                                           ctx->buffer_data[out_buffer_index],
+                                                           element_count,
+                                                           ectx->arena);
+                    };
+                    functors.emplace_back(functor);
+                }
                 else
                 {
-                    throw ngraph_error("Gelu is supported with MKLDNN kernel only for f32.");
+                    throw ngraph_error("Gelu is supported only for f32.");
                 }
             }
 
@@ -18,8 +18,11 @@
 
 #include "ngraph/op/experimental/batch_mat_mul.hpp"
 #include "ngraph/op/fused/batch_mat_mul_transpose.hpp"
+#include "ngraph/op/fused/matmul.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/cpu_packed_gemm.hpp"
+#include "ngraph/runtime/cpu/kernel/batch_gemm.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -72,7 +75,23 @@ namespace ngraph
 
                 const float beta = 0.0f;
 
-                auto mm_functor = [&,
+                // Constant weights are packed once here instead of on every call
+                shared_ptr<PackedGemmOperand> packed_a, packed_b;
+                if (element_type == element::f32)
+                {
+                    packed_b = make_packed_gemm_operand(node, 1, transpose_B, m, n, k, ldb);
+                    if (!packed_b)
+                    {
+                        packed_a = make_packed_gemm_operand(node, 0, transpose_A, m, n, k, lda);
+                    }
+                }
+                if (packed_a || packed_b)
+                {
+                    external_function->add_prepacked_weight_bytes(
+                        (packed_b ? packed_b : packed_a)->size());
+                }
+
+                CPUKernelFunctor mm_functor = [&,
                                    transpose_A,
                                    transpose_B,
                                    m,
@@ -127,6 +146,30 @@ namespace ngraph
                     }
                 };
 
+                if (packed_a || packed_b)
+                {
+                    auto packed = packed_b ? packed_b : packed_a;
+                    auto other_buffer_index = packed_b ? arg0_buffer_index : arg1_buffer_index;
+                    auto transpose_other = packed_b ? transpose_A : transpose_B;
+                    auto ld_other = packed_b ? lda : ldb;
+                    mm_functor = [&,
+                                  packed,
+                                  other_buffer_index,
+                                  transpose_other,
+                                  ld_other,
+                                  beta,
+                                  arg2_shape,
+                                  out0_buffer_index](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* /* ectx */) {
+                        packed->compute(static_cast<float*>(ctx->buffer_data[other_buffer_index]),
+                                        transpose_other,
+                                        max<size_t>(1, ld_other),
+                                        beta,
+                                        static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
+                                        max<size_t>(1, arg2_shape[1]));
+                    };
+                }
+
                 CPUKernelFunctor bias_functor = [](CPURuntimeContext* /* ctx */,
                                                    CPUExecutionContext* /* ectx */) {};
 
@@ -229,187 +272,108 @@ namespace ngraph
                 functors.emplace_back(functor);
             }
 
-            struct CblasGemmOptions
+            struct BatchGemmOptions
             {
-                CblasGemmOptions(size_t& dai, size_t& dbi, size_t& dci)
-                    : data_a_index(dai)
-                    , data_b_index(dbi)
-                    , data_c_index(dci)
-                {
-                }
-
-                std::vector<cblas::Transpose> transa_array;
-                std::vector<cblas::Transpose> transb_array;
-                std::vector<int64_t> m_array;
-                std::vector<int64_t> n_array;
-                std::vector<int64_t> k_array;
-                std::vector<int64_t> lda_array;
-                std::vector<int64_t> ldb_array;
-                std::vector<int64_t> ldc_array;
-                std::vector<int64_t> group_sizes;
-                std::vector<float> alpha_array;
-                std::vector<float> beta_array;
-                size_t offset_a;
-                size_t offset_b;
-                size_t offset_c;
                 size_t data_a_index;
                 size_t data_b_index;
                 size_t data_c_index;
-                int64_t group_count;
+                size_t batch;
+                bool transpose_a;
+                bool transpose_b;
+                size_t m;
+                size_t n;
+                size_t k;
+                size_t offset_a;
+                size_t offset_b;
+                size_t offset_c;
 
-                void call(CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */)
+                template <typename T>
+                void call(CPURuntimeContext* ctx, CPUExecutionContext* ectx) const
                 {
-                    std::vector<float*> a_array(group_sizes[0]);
-                    std::vector<float*> b_array(group_sizes[0]);
-                    std::vector<float*> c_array(group_sizes[0]);
-
-                    auto populate_array = [](std::vector<float*>& offsets_vector,
-                                             void* data,
-                                             int64_t size,
-                                             size_t offset) {
-                        for (int64_t i = 0; i < size; ++i)
-                        {
-                            offsets_vector.at(i) = static_cast<float*>(data) + (i * offset);
-                        }
-                    };
-
-                    populate_array(
-                        a_array, ctx->buffer_data[data_a_index], group_sizes[0], offset_a);
-                    populate_array(
-                        b_array, ctx->buffer_data[data_b_index], group_sizes[0], offset_b);
-                    populate_array(
-                        c_array, ctx->buffer_data[data_c_index], group_sizes[0], offset_c);
-
-                    const float** a = const_cast<const float**>(&a_array[0]);
-                    const float** b = const_cast<const float**>(&b_array[0]);
-
-                    cblas_sgemm_batch(cblas::Layout::RowMajor,
-                                      &transa_array[0],
-                                      &transb_array[0],
-                                      &m_array[0],
-                                      &n_array[0],
-                                      &k_array[0],
-                                      &alpha_array[0],
-                                      a,
-                                      &lda_array[0],
-                                      b,
-                                      &ldb_array[0],
-                                      &beta_array[0],
-                                      &c_array[0],
-                                      &ldc_array[0],
-                                      group_count,
-                                      &group_sizes[0]);
+                    runtime::cpu::kernel::batch_gemm(
+                        static_cast<const T*>(ctx->buffer_data[data_a_index]),
+                        static_cast<const T*>(ctx->buffer_data[data_b_index]),
+                        static_cast<T*>(ctx->buffer_data[data_c_index]),
+                        batch,
+                        transpose_a,
+                        transpose_b,
+                        m,
+                        n,
+                        k,
+                        offset_a,
+                        offset_b,
+                        offset_c,
+                        ectx->arena);
                 }
             };
 
-            static CPUKernelFunctor emitCblasSgemmBatch(const Shape& shape_a,
-                                                        const Shape& shape_b,
-                                                        const Shape& shape_c,
-                                                        bool transpose_a,
-                                                        bool transpose_b,
-                                                        size_t& data_a_index,
-                                                        size_t& data_b_index,
-                                                        size_t& data_c_index,
-                                                        const float alpha,
-                                                        const float beta,
-                                                        size_t group_size)
+            // c[i] = op(a[i]) * op(b[i]) over the leading axis of [batch, rows, cols] operands; a
+            // batch of 1 is broadcast against the other operand
+            static void batchMatMul(CPU_ExternalFunction* external_function,
+                                    const std::vector<TensorViewWrapper>& args,
+                                    const std::vector<TensorViewWrapper>& out,
+                                    const Shape& shape_a,
+                                    const Shape& shape_b,
+                                    bool transpose_a,
+                                    bool transpose_b)
             {
-                size_t m = shape_a[1];
-                size_t k = shape_a[2];
-                size_t n = shape_b[2];
-                size_t lda = std::max<size_t>(1, k);
-                size_t ldb = std::max<size_t>(1, n);
-                cblas::Transpose ctranspose_a = cblas::Transpose::None;
-                cblas::Transpose ctranspose_b = cblas::Transpose::None;
+                auto& functors = external_function->get_functors();
 
-                if (transpose_a)
+                BatchGemmOptions options;
+                options.data_a_index = external_function->get_buffer_index(args[0].get_name());
+                options.data_b_index = external_function->get_buffer_index(args[1].get_name());
+                options.data_c_index = external_function->get_buffer_index(out[0].get_name());
+                options.transpose_a = transpose_a;
+                options.transpose_b = transpose_b;
+                options.m = transpose_a ? shape_a[2] : shape_a[1];
+                options.k = transpose_a ? shape_a[1] : shape_a[2];
+                options.n = transpose_b ? shape_b[1] : shape_b[2];
+                options.batch = std::max(shape_a[0], shape_b[0]);
+                options.offset_a = shape_a[0] > 1 ? options.m * options.k : 0;
+                options.offset_b = shape_b[0] > 1 ? options.k * options.n : 0;
+                options.offset_c = options.m * options.n;
+
+                auto element_type = out[0].get_element_type();
+                if (element_type == element::f32)
                 {
-                    ctranspose_a = cblas::Transpose::Transpose;
-                    m = shape_a[2];
-                    k = shape_a[1];
-                    lda = std::max<size_t>(1, m);
+                    functors.emplace_back(
+                        [options](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            options.call<float>(ctx, ectx);
+                        });
                 }
-                if (transpose_b)
+                else if (element_type == element::f64)
                 {
-                    ctranspose_b = cblas::Transpose::Transpose;
-                    n = shape_b[1];
-                    ldb = std::max<size_t>(1, k);
+                    functors.emplace_back(
+                        [options](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            options.call<double>(ctx, ectx);
+                        });
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported type " + element_type.c_type_string() +
+                                       " in CPU Builder for batched matrix multiplication");
                 }
-                size_t ldc = std::max<size_t>(1, n);
-
-                CblasGemmOptions options(data_a_index, data_b_index, data_c_index);
-
-                const size_t offset_a = (shape_a.at(0) > 1) ? m * k : 0;
-                const size_t offset_b = (shape_b.at(0) > 1) ? k * n : 0;
-                const size_t offset_c = (shape_c.at(0) > 1) ? m * n : 0;
-
-                options.offset_a = offset_a;
-                options.offset_b = offset_b;
-                options.offset_c = offset_c;
-
-                // if we were to support more groups
-                const size_t group_count = 1;
-                options.group_count = group_count;
-
-                options.transa_array.push_back(ctranspose_a);
-                options.transb_array.push_back(ctranspose_b);
-
-                options.m_array.push_back(m);
-                options.n_array.push_back(n);
-                options.k_array.push_back(k);
-
-                options.alpha_array.push_back(alpha);
-                options.beta_array.push_back(beta);
-
-                options.lda_array.push_back(lda);
-                options.ldb_array.push_back(ldb);
-                options.ldc_array.push_back(ldc);
-                options.group_sizes.push_back(group_size);
-
-                CPUKernelFunctor cblas_func = [options](CPURuntimeContext* ctx,
-                                                        CPUExecutionContext* ectx) mutable {
-                    options.call(ctx, ectx);
-                };
-                return cblas_func;
             }
 
-            static void batchMatMul(CPU_ExternalFunction* external_function,
-                                    const ngraph::Node* node,
-                                    const std::vector<TensorViewWrapper>& args,
-                                    const std::vector<TensorViewWrapper>& out,
-                                    bool transpose0,
-                                    bool transpose1)
+            // Collapses the leading axes of a MatMul operand of rank 3 or more into one batch axis
+            static Shape batched_matrix_shape(const Shape& shape)
             {
-                auto& functors = external_function->get_functors();
-
-                auto mat_a_index = external_function->get_buffer_index(args[0].get_name());
-                auto mat_b_index = external_function->get_buffer_index(args[1].get_name());
-                auto mat_c_index = external_function->get_buffer_index(out[0].get_name());
-
-                const auto& shape_a = node->get_input_shape(0);
-                const auto& shape_b = node->get_input_shape(1);
-                const auto& shape_c = out[0].get_shape();
-
-                const size_t group_size = shape_a.at(0);
-                auto func = emitCblasSgemmBatch(shape_a,
-                                                shape_b,
-                                                shape_c,
-                                                transpose0,
-                                                transpose1,
-                                                mat_a_index,
-                                                mat_b_index,
-                                                mat_c_index,
-                                                1.f,
-                                                0.f,
-                                                group_size);
-
-                functors.emplace_back(func);
+                size_t rank = shape.size();
+                return Shape{shape_size(Shape(shape.begin(), shape.end() - 2)),
+                             shape[rank - 2],
+                             shape[rank - 1]};
             }
 
             template <>
             void Builder::BUILDER_DECL(ngraph::op::BatchMatMul)
             {
-                batchMatMul(external_function, node, args, out, false, false);
+                batchMatMul(external_function,
+                            args,
+                            out,
+                            node->get_input_shape(0),
+                            node->get_input_shape(1),
+                            false,
+                            false);
             }
 
             template <>
@@ -417,18 +381,35 @@ namespace ngraph
             {
                 const auto* cg = static_cast<const ngraph::op::BatchMatMulTranspose*>(node);
                 batchMatMul(external_function,
-                            node,
                             args,
                             out,
+                            node->get_input_shape(0),
+                            node->get_input_shape(1),
                             cg->get_transpose_arg0(),
                             cg->get_transpose_arg1());
             }
 
+            // Only kept for batched products whose batches match or are 1, see
+            // native_fused_op_supported in cpu_external_function.cpp
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::MatMul)
+            {
+                const auto* matmul = static_cast<const ngraph::op::MatMul*>(node);
+                batchMatMul(external_function,
+                            args,
+                            out,
+                            batched_matrix_shape(node->get_input_shape(0)),
+                            batched_matrix_shape(node->get_input_shape(1)),
+                            matmul->get_transpose_a(),
+                            matmul->get_transpose_b());
+            }
+
             void register_builders_matmul_bias_cpp()
             {
                 REGISTER_OP_BUILDER(MatmulBias);
                 REGISTER_OP_BUILDER(BatchMatMul);
                 REGISTER_OP_BUILDER(BatchMatMulTranspose);
+                REGISTER_OP_BUILDER(MatMul);
             }
         } // namespace cpu
     }     // namespace runtime
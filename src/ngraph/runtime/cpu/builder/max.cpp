@@ -18,6 +18,8 @@
 
 #include "ngraph/op/max.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/isa.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_axes.hpp"
 #include "ngraph/runtime/cpu/kernel/reduce_max.hpp"
 
 #include "reduction.hpp"
@@ -34,6 +36,7 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Max)
             {
+                BUILD_ISA_REDUCTION_FUNCTOR(Max, max);
                 BUILD_REDUCTION_FUNCTOR(Max, max);
             }
 
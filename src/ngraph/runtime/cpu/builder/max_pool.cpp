@@ -106,7 +106,7 @@ namespace ngraph
                                     padding_above,
                                     arg0_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* /* ectx */) {
+                                                      CPUExecutionContext* ectx) {
                         kernel(ctx->buffer_data[arg0_buffer_index],
                                ctx->buffer_data[out_buffer_index],
                                arg0_shape,
@@ -114,7 +114,8 @@ namespace ngraph
                                window_shape,
                                window_movement_strides,
                                padding_below,
-                               padding_above);
+                               padding_above,
+                               ectx->arena);
                     };
                     functors.emplace_back(functor);
                 }
@@ -246,7 +247,7 @@ namespace ngraph
                                     arg_fwd_buffer_index,
                                     delta_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* /* ectx */) {
+                                                      CPUExecutionContext* ectx) {
                         kernel(ctx->buffer_data[arg_fwd_buffer_index],
                                ctx->buffer_data[delta_buffer_index],
                                ctx->buffer_data[out_buffer_index],
@@ -255,7 +256,8 @@ namespace ngraph
                                window_shape,
                                window_movement_strides,
                                padding_below,
-                               padding_above);
+                               padding_above,
+                               ectx->arena);
                     };
                     functors.emplace_back(functor);
                 }
@@ -264,17 +266,58 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::MaxPoolWithIndices)
             {
-                if (!runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
-                {
-                    throw ngraph_error("MaxPoolWithIndices isn't supported");
-                }
-
                 auto& functors = external_function->get_functors();
 
                 auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
                 auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
                 auto out1_buffer_index = external_function->get_buffer_index(out[1].get_name());
 
+                if (!runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    // The native kernel's indices are row-major offsets within each window
+                    // and are only understood by the native backprop kernel.
+                    auto max_pool = static_cast<const ngraph::op::MaxPoolWithIndices*>(node);
+                    auto arg0_shape = args[0].get_shape();
+                    auto out_shape = out[0].get_shape();
+                    auto window_shape = max_pool->get_window_shape();
+                    auto window_movement_strides = max_pool->get_window_movement_strides();
+                    auto padding_below = max_pool->get_padding_below();
+                    auto padding_above = max_pool->get_padding_above();
+
+                    std::function<decltype(runtime::cpu::kernel::max_pool_with_indices<float>)>
+                        kernel;
+
+                    SELECT_KERNEL(kernel,
+                                  out[0].get_element_type(),
+                                  runtime::cpu::kernel::max_pool_with_indices)
+
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    out_shape,
+                                    window_shape,
+                                    window_movement_strides,
+                                    padding_below,
+                                    padding_above,
+                                    arg0_buffer_index,
+                                    out0_buffer_index,
+                                    out1_buffer_index](CPURuntimeContext* ctx,
+                                                       CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[out0_buffer_index],
+                               ctx->buffer_data[out1_buffer_index],
+                               arg0_shape,
+                               out_shape,
+                               window_shape,
+                               window_movement_strides,
+                               padding_below,
+                               padding_above,
+                               ectx->arena);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
                 auto max_pool_desc =
                     mkldnn_emitter
@@ -324,17 +367,57 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::MaxPoolWithIndicesBackprop)
             {
-                if (!runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
-                {
-                    throw ngraph_error("MaxPoolWithIndicesBackprop isn't supported");
-                }
-
                 auto& functors = external_function->get_functors();
 
                 auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
                 auto arg2_buffer_index = external_function->get_buffer_index(args[2].get_name());
                 auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
+                if (!runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    auto mpb = static_cast<const ngraph::op::MaxPoolWithIndicesBackprop*>(node);
+                    auto delta_shape = args[1].get_shape();
+                    auto out_shape = out[0].get_shape();
+                    auto window_shape = mpb->get_window_shape();
+                    auto window_movement_strides = mpb->get_window_movement_strides();
+                    auto padding_below = mpb->get_padding_below();
+                    auto padding_above = mpb->get_padding_above();
+
+                    std::function<decltype(
+                        runtime::cpu::kernel::max_pool_with_indices_backprop<float>)>
+                        kernel;
+
+                    SELECT_KERNEL(kernel,
+                                  out[0].get_element_type(),
+                                  runtime::cpu::kernel::max_pool_with_indices_backprop)
+
+                    auto functor = [&,
+                                    kernel,
+                                    delta_shape,
+                                    out_shape,
+                                    window_shape,
+                                    window_movement_strides,
+                                    padding_below,
+                                    padding_above,
+                                    arg1_buffer_index,
+                                    arg2_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg1_buffer_index],
+                               ctx->buffer_data[arg2_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               delta_shape,
+                               out_shape,
+                               window_shape,
+                               window_movement_strides,
+                               padding_below,
+                               padding_above,
+                               ectx->arena);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
                 auto fwd_pool_desc =
                     mkldnn_emitter
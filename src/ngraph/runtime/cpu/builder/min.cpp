@@ -18,6 +18,7 @@
 
 #include "ngraph/op/min.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_axes.hpp"
 #include "ngraph/runtime/cpu/kernel/reduce_min.hpp"
 
 #include "reduction.hpp"
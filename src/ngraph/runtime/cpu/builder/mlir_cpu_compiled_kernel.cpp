@@ -22,6 +22,12 @@
 #include "ngraph/op/experimental/compiled_kernel.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
 
+#include <llvm/Support/raw_ostream.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 using namespace ngraph;
 using namespace ngraph::op;
 using namespace ngraph::runtime::cpu;
@@ -35,6 +41,43 @@ namespace ngraph
     {
         namespace cpu
         {
+            // Returns a compiled runtime for the sub-graph of `compiled_kernel`. Runtimes are
+            // cached by the text of their NG dialect module, so the same sub-graph is JIT-compiled
+            // once however many contexts and executables run it. The cache does not keep a runtime
+            // alive once the last executable using it is gone.
+            static std::shared_ptr<MLIRCPURuntime>
+                get_mlir_runtime(const CompiledKernel* compiled_kernel)
+            {
+                static std::mutex cache_mutex;
+                static std::unordered_map<std::string, std::weak_ptr<MLIRCPURuntime>> cache;
+
+                // The runtime owns the context, which must out-live compilation and execution
+                auto mlir_runtime = std::make_shared<MLIRCPURuntime>();
+                mlir::MLIRContext& context = mlir_runtime->get_context();
+                MLIRCompiler mlir_compiler(compiled_kernel, context);
+                // Compile to NG dialect
+                mlir_compiler.compile();
+
+                std::string key;
+                llvm::raw_string_ostream key_stream(key);
+                mlir_compiler.get_module()->print(key_stream);
+                key_stream.flush();
+
+                std::lock_guard<std::mutex> lock(cache_mutex);
+                if (auto cached = cache[key].lock())
+                {
+                    return cached;
+                }
+
+                // Codegen to LLVM dialect with a CPU backend using the same context, then JIT
+                MLIRCPUBackend mlir_backend(mlir_compiler.get_module(), context);
+                mlir_backend.codegen();
+                mlir_runtime->set_module(mlir_backend.get_module());
+                mlir_runtime->compile();
+                cache[key] = mlir_runtime;
+                return mlir_runtime;
+            }
+
             template <>
             void Builder::BUILDER_DECL(CompiledKernel)
             {
@@ -87,9 +130,13 @@ namespace ngraph
                     strides_vec.push_back(strides);
                 }
 
-                // Create functor that will be executed to compile and run this CompiledKernel.
-                // Note that 'double_ptr_args' must be captured by value since it's a local var.
-                auto functor = [node, buffer_indices, shape_vec, strides_vec](
+                // Compile the sub-graph now rather than on the first call. Kernels whose NG
+                // dialect module is identical share one JIT-compiled runtime.
+                auto compiled_kernel = static_cast<const CompiledKernel*>(node);
+                auto mlir_runtime = get_mlir_runtime(compiled_kernel);
+
+                // Create functor that will be executed to run this CompiledKernel.
+                auto functor = [mlir_runtime, buffer_indices, shape_vec, strides_vec](
                     CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
 
                     // MLIR requires a list of type-erased pointer to arguments. Tensors must have
@@ -106,44 +153,7 @@ namespace ngraph
                         i++;
                     }
 
-                    // Compile nodes within the CompiledKernel op.
-                    CompiledKernel* compiled_kernel =
-                        static_cast<CompiledKernel*>(const_cast<Node*>(node));
-
-                    auto it = ctx->mlir_runtimes.find(compiled_kernel);
-
-                    if (it == ctx->mlir_runtimes.end())
-                    {
-                        // Compile the sub-graph and create a new runtime
-                        // We must create an MLIRContext that out lives the compilation/execution
-                        // The runtime contains the context and gets store in the CK cache
-
-                        // Runtime contains context and must be constructed in-place.
-                        // MLIR contexts cannot be copied over
-                        ctx->mlir_runtimes.emplace(std::piecewise_construct,
-                                                   std::make_tuple(compiled_kernel),
-                                                   std::make_tuple());
-                        MLIRCPURuntime& mlir_runtime =
-                            ctx->mlir_runtimes.find(compiled_kernel)->second;
-                        // Grab the context and initialize a core compiler
-                        mlir::MLIRContext& context = mlir_runtime.get_context();
-                        MLIRCompiler mlir_compiler(compiled_kernel, context);
-                        // Compile to NG dialect
-                        mlir_compiler.compile();
-                        // Grab a context and initialize a CPU backend using same context
-                        MLIRCPUBackend mlir_backend(mlir_compiler.get_module(), context);
-                        // Codegen to LLVM dialect
-                        mlir_backend.codegen();
-                        // Store module into runtime, and invoke.
-                        mlir_runtime.set_module(mlir_backend.get_module());
-                        mlir_runtime.run(mem_ref_arg_vec);
-                    }
-                    else
-                    {
-                        // We have found a cached runtime, just invoke.
-                        MLIRCPURuntime& mlir_runtime = it->second;
-                        mlir_runtime.run(mem_ref_arg_vec);
-                    }
+                    mlir_runtime->run(mem_ref_arg_vec);
                 };
 
                 functors.emplace_back(functor);
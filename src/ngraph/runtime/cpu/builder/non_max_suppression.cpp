@@ -0,0 +1,157 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdint>
+
+#include "ngraph/op/non_max_suppression.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/non_max_suppression.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace
+            {
+                // The scalar attributes are inputs, so they are read when the functor runs
+                template <typename R>
+                R read_scalar(const void* data, const element::Type& element_type)
+                {
+                    if (element_type == element::i8)
+                    {
+                        return static_cast<R>(*static_cast<const int8_t*>(data));
+                    }
+                    else if (element_type == element::i16)
+                    {
+                        return static_cast<R>(*static_cast<const int16_t*>(data));
+                    }
+                    else if (element_type == element::i32)
+                    {
+                        return static_cast<R>(*static_cast<const int32_t*>(data));
+                    }
+                    else if (element_type == element::i64)
+                    {
+                        return static_cast<R>(*static_cast<const int64_t*>(data));
+                    }
+                    else if (element_type == element::f32)
+                    {
+                        return static_cast<R>(*static_cast<const float*>(data));
+                    }
+                    else if (element_type == element::f64)
+                    {
+                        return static_cast<R>(*static_cast<const double*>(data));
+                    }
+                    throw ngraph_error("Unsupported scalar type (" + element_type.get_type_name() +
+                                       ") in CPU Builder for NonMaxSuppression");
+                }
+
+                template <typename T>
+                CPUKernelFunctor prepare_functor(const ngraph::op::v1::NonMaxSuppression* nms,
+                                                 const vector<TensorViewWrapper>& args,
+                                                 const vector<TensorViewWrapper>& out,
+                                                 CPU_ExternalFunction* external_function)
+                {
+                    auto boxes_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto scores_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto max_boxes_buffer_index =
+                        external_function->get_buffer_index(args[2].get_name());
+                    auto iou_buffer_index = external_function->get_buffer_index(args[3].get_name());
+                    auto score_buffer_index =
+                        external_function->get_buffer_index(args[4].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                    auto boxes_shape = args[0].get_shape();
+                    auto scores_shape = args[1].get_shape();
+                    auto out_shape = out[0].get_shape();
+                    auto max_boxes_type = args[2].get_element_type();
+                    auto iou_type = args[3].get_element_type();
+                    auto score_type = args[4].get_element_type();
+                    using BoxEncodingType = ngraph::op::v1::NonMaxSuppression::BoxEncodingType;
+                    bool center_encoding = nms->get_box_encoding() == BoxEncodingType::CENTER;
+                    bool sort_result_descending = nms->get_sort_result_descending();
+
+                    return [&,
+                            boxes_shape,
+                            scores_shape,
+                            out_shape,
+                            max_boxes_type,
+                            iou_type,
+                            score_type,
+                            center_encoding,
+                            sort_result_descending,
+                            boxes_buffer_index,
+                            scores_buffer_index,
+                            max_boxes_buffer_index,
+                            iou_buffer_index,
+                            score_buffer_index,
+                            out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        runtime::cpu::kernel::non_max_suppression<T>(
+                            static_cast<T*>(ctx->buffer_data[boxes_buffer_index]),
+                            static_cast<T*>(ctx->buffer_data[scores_buffer_index]),
+                            static_cast<int64_t*>(ctx->buffer_data[out_buffer_index]),
+                            boxes_shape,
+                            scores_shape,
+                            out_shape,
+                            read_scalar<int64_t>(ctx->buffer_data[max_boxes_buffer_index],
+                                                 max_boxes_type),
+                            read_scalar<T>(ctx->buffer_data[iou_buffer_index], iou_type),
+                            read_scalar<T>(ctx->buffer_data[score_buffer_index], score_type),
+                            center_encoding,
+                            sort_result_descending,
+                            ectx->arena);
+                    };
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v1::NonMaxSuppression)
+            {
+                auto& functors = external_function->get_functors();
+                auto nms = static_cast<const ngraph::op::v1::NonMaxSuppression*>(node);
+                CPUKernelFunctor functor;
+
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    functor = prepare_functor<float>(nms, args, out, external_function);
+                }
+                else if (element_type == element::f64)
+                {
+                    functor = prepare_functor<double>(nms, args, out, external_function);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported type (" + element_type.get_type_name() +
+                                       ") in CPU Builder for NonMaxSuppression");
+                }
+
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_non_max_suppression_cpp()
+            {
+                REGISTER_OP_BUILDER(v1::NonMaxSuppression);
+            }
+        }
+    }
+}
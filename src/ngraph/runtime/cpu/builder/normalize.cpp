@@ -0,0 +1,135 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/fused/grn.hpp"
+#include "ngraph/op/fused/mvn.hpp"
+#include "ngraph/op/fused/normalize_l2.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/normalize.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Normalizes args[0] over `reduction_axes` with one kernel instead of the reductions,
+            // broadcasts and element-wise ops of the decomposition
+            static void build_normalize(CPU_ExternalFunction* external_function,
+                                        const vector<TensorViewWrapper>& args,
+                                        const vector<TensorViewWrapper>& out,
+                                        const AxisSet& reduction_axes,
+                                        runtime::cpu::kernel::NormalizeMode mode,
+                                        double epsilon,
+                                        const string& op_name)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                runtime::cpu::kernel::ReductionPlan plan(args[0].get_shape(), reduction_axes);
+
+                std::function<decltype(runtime::cpu::kernel::normalize_axes<float>)> kernel;
+                if (args[0].get_element_type() == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::normalize_axes<float>;
+                }
+                else if (args[0].get_element_type() == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::normalize_axes<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       args[0].get_element_type().c_type_string() + " for " +
+                                       op_name);
+                }
+
+                auto functor = [&, kernel, plan, mode, epsilon, arg_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           plan,
+                           mode,
+                           epsilon,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::MVN)
+            {
+                auto mvn = static_cast<const ngraph::op::MVN*>(node);
+                build_normalize(external_function,
+                                args,
+                                out,
+                                mvn->get_reduction_axes(),
+                                mvn->get_normalize_variance()
+                                    ? runtime::cpu::kernel::NormalizeMode::MEAN_STDDEV
+                                    : runtime::cpu::kernel::NormalizeMode::MEAN,
+                                mvn->get_eps(),
+                                "MVN");
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::NormalizeL2)
+            {
+                auto normalize = static_cast<const ngraph::op::NormalizeL2*>(node);
+                build_normalize(external_function,
+                                args,
+                                out,
+                                normalize->get_reduction_axes(),
+                                normalize->get_eps_mode() == ngraph::op::EpsMode::MAX
+                                    ? runtime::cpu::kernel::NormalizeMode::L2_MAX
+                                    : runtime::cpu::kernel::NormalizeMode::L2_ADD,
+                                normalize->get_eps(),
+                                "NormalizeL2");
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::GRN)
+            {
+                auto grn = static_cast<const ngraph::op::GRN*>(node);
+                // GRN::decompose_op pads the shape to 4-D with leading ones and normalizes over
+                // axis 1, which a 2-D input does not have
+                size_t rank = args[0].get_shape().size();
+                AxisSet reduction_axes;
+                if (rank >= 3)
+                {
+                    reduction_axes.insert(rank - 3);
+                }
+                build_normalize(external_function,
+                                args,
+                                out,
+                                reduction_axes,
+                                runtime::cpu::kernel::NormalizeMode::L2_ADD,
+                                grn->get_bias(),
+                                "GRN");
+            }
+
+            void register_builders_normalize_cpp()
+            {
+                REGISTER_OP_BUILDER(GRN);
+                REGISTER_OP_BUILDER(MVN);
+                REGISTER_OP_BUILDER(NormalizeL2);
+            }
+        }
+    }
+}
@@ -0,0 +1,166 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/fused/optimizer_update.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/optimizer_update.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::SGDMomentumUpdate)
+            {
+                auto update = static_cast<const ngraph::op::SGDMomentumUpdate*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto param_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto grad_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto velocity_buffer_index =
+                    external_function->get_buffer_index(args[2].get_name());
+                auto lr_buffer_index = external_function->get_buffer_index(args[3].get_name());
+                auto param_out_buffer_index =
+                    external_function->get_buffer_index(out[0].get_name());
+                auto velocity_out_buffer_index =
+                    external_function->get_buffer_index(out[1].get_name());
+                size_t count = out[0].get_size();
+                auto momentum = update->get_momentum();
+                auto nesterov = update->get_nesterov();
+
+                std::function<decltype(runtime::cpu::kernel::sgd_momentum_update<float>)> kernel;
+                if (args[0].get_element_type() == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::sgd_momentum_update<float>;
+                }
+                else if (args[0].get_element_type() == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::sgd_momentum_update<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       args[0].get_element_type().c_type_string() +
+                                       " for SGDMomentumUpdate");
+                }
+
+                auto functor = [&,
+                                kernel,
+                                count,
+                                momentum,
+                                nesterov,
+                                param_buffer_index,
+                                grad_buffer_index,
+                                velocity_buffer_index,
+                                lr_buffer_index,
+                                param_out_buffer_index,
+                                velocity_out_buffer_index](CPURuntimeContext* ctx,
+                                                           CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[param_buffer_index],
+                           ctx->buffer_data[grad_buffer_index],
+                           ctx->buffer_data[velocity_buffer_index],
+                           ctx->buffer_data[lr_buffer_index],
+                           ctx->buffer_data[param_out_buffer_index],
+                           ctx->buffer_data[velocity_out_buffer_index],
+                           count,
+                           momentum,
+                           nesterov,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::AdamUpdate)
+            {
+                auto update = static_cast<const ngraph::op::AdamUpdate*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto param_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto grad_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto m_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto v_buffer_index = external_function->get_buffer_index(args[3].get_name());
+                auto lr_buffer_index = external_function->get_buffer_index(args[4].get_name());
+                auto param_out_buffer_index =
+                    external_function->get_buffer_index(out[0].get_name());
+                auto m_out_buffer_index = external_function->get_buffer_index(out[1].get_name());
+                auto v_out_buffer_index = external_function->get_buffer_index(out[2].get_name());
+                size_t count = out[0].get_size();
+                auto beta1 = update->get_beta1();
+                auto beta2 = update->get_beta2();
+                auto epsilon = update->get_epsilon();
+
+                std::function<decltype(runtime::cpu::kernel::adam_update<float>)> kernel;
+                if (args[0].get_element_type() == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::adam_update<float>;
+                }
+                else if (args[0].get_element_type() == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::adam_update<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       args[0].get_element_type().c_type_string() +
+                                       " for AdamUpdate");
+                }
+
+                auto functor = [&,
+                                kernel,
+                                count,
+                                beta1,
+                                beta2,
+                                epsilon,
+                                param_buffer_index,
+                                grad_buffer_index,
+                                m_buffer_index,
+                                v_buffer_index,
+                                lr_buffer_index,
+                                param_out_buffer_index,
+                                m_out_buffer_index,
+                                v_out_buffer_index](CPURuntimeContext* ctx,
+                                                    CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[param_buffer_index],
+                           ctx->buffer_data[grad_buffer_index],
+                           ctx->buffer_data[m_buffer_index],
+                           ctx->buffer_data[v_buffer_index],
+                           ctx->buffer_data[lr_buffer_index],
+                           ctx->buffer_data[param_out_buffer_index],
+                           ctx->buffer_data[m_out_buffer_index],
+                           ctx->buffer_data[v_out_buffer_index],
+                           count,
+                           beta1,
+                           beta2,
+                           epsilon,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_optimizer_update_cpp()
+            {
+                REGISTER_OP_BUILDER(SGDMomentumUpdate);
+                REGISTER_OP_BUILDER(AdamUpdate);
+            }
+        }
+    }
+}
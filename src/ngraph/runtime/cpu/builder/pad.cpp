@@ -20,6 +20,7 @@
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/pad.hpp"
 #include "ngraph/runtime/cpu/kernel/slice.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/shape.hpp"
 
 using namespace std;
@@ -49,10 +50,40 @@ namespace ngraph
                 auto padding_below = pad->get_padding_below();
                 auto padding_above = pad->get_padding_above();
                 auto pad_mode = pad->get_pad_mode();
+                // CPULayout keeps channel-blocked layouts through Pads of the spatial axes
+                mkldnn_utils::blocked_pad_view(
+                    node, arg_shape, out_shape, padding_below, padding_above);
 
-                if ((pad_mode == ngraph::op::PadMode::CONSTANT ||
-                     pad_mode == ngraph::op::PadMode::REFLECT) &&
-                    is_optimized_et(args[0].get_element_type()))
+                if (pad_mode == ngraph::op::PadMode::CONSTANT)
+                {
+                    std::function<decltype(runtime::cpu::kernel::pad_constant<float>)> kernel;
+
+                    SELECT_KERNEL(
+                        kernel, args[0].get_element_type(), runtime::cpu::kernel::pad_constant)
+
+                    auto functor = [&,
+                                    kernel,
+                                    arg_shape,
+                                    out_shape,
+                                    padding_below,
+                                    padding_above,
+                                    arg_buffer_index,
+                                    padding_value_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               ctx->buffer_data[padding_value_index],
+                               arg_shape,
+                               out_shape,
+                               CoordinateDiff(padding_below.begin(), padding_below.end()),
+                               CoordinateDiff(padding_above.begin(), padding_above.end()),
+                               ectx->arena);
+                    };
+                    functors.emplace_back(functor);
+                }
+                else if (pad_mode == ngraph::op::PadMode::REFLECT &&
+                         is_optimized_et(args[0].get_element_type()))
                 {
                     std::function<decltype(runtime::cpu::kernel::pad_and_slice<float, 1>)> kernel;
 
@@ -126,9 +157,29 @@ namespace ngraph
                 auto padding_above = pad->get_padding_above();
                 auto pad_mode = pad->get_pad_mode();
 
-                if ((pad_mode == ngraph::op::PadMode::CONSTANT ||
-                     pad_mode == ngraph::op::PadMode::REFLECT) &&
-                    is_optimized_et(pad->get_input_element_type(0)))
+                if (pad_mode == ngraph::op::PadMode::CONSTANT)
+                {
+                    std::function<decltype(runtime::cpu::kernel::pad_constant<float>)> kernel;
+
+                    SELECT_KERNEL(kernel,
+                                  pad->get_input_element_type(0),
+                                  runtime::cpu::kernel::pad_constant)
+
+                    auto functor = [kernel, arg_shape, out_shape, padding_below, padding_above](
+                        const std::vector<void*>& inputs, std::vector<void*>& outputs) {
+                        kernel(inputs[0],
+                               outputs[0],
+                               inputs[1],
+                               arg_shape,
+                               out_shape,
+                               CoordinateDiff(padding_below.begin(), padding_below.end()),
+                               CoordinateDiff(padding_above.begin(), padding_above.end()),
+                               0);
+                    };
+                    return functor;
+                }
+                else if (pad_mode == ngraph::op::PadMode::REFLECT &&
+                         is_optimized_et(pad->get_input_element_type(0)))
                 {
                     std::function<decltype(runtime::cpu::kernel::pad_and_slice<float, 1>)> kernel;
 
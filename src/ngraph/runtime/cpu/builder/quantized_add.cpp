@@ -0,0 +1,80 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/isa.hpp"
+#include "ngraph/runtime/cpu/op/quantized_add.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::QuantizedAdd)
+            {
+                auto& functors = external_function->get_functors();
+                auto qadd = static_cast<const ngraph::op::QuantizedAdd*>(node);
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto element_count = out[0].get_size();
+                float input0_multiplier = qadd->get_input0_scale() / qadd->get_output_scale();
+                float input1_multiplier = qadd->get_input1_scale() / qadd->get_output_scale();
+
+                decltype(&runtime::cpu::kernel::quantized_add_int8) kernel;
+                if (out[0].get_element_type() == element::i8)
+                {
+                    kernel = runtime::cpu::kernel::quantized_add_int8;
+                }
+                else if (out[0].get_element_type() == element::u8)
+                {
+                    kernel = runtime::cpu::kernel::quantized_add_uint8;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported type in CPU Builder for QuantizedAdd");
+                }
+
+                auto functor = [&,
+                                kernel,
+                                element_count,
+                                input0_multiplier,
+                                input1_multiplier,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg0_buffer_index],
+                           ctx->buffer_data[arg1_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           element_count,
+                           input0_multiplier,
+                           input1_multiplier,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_quantized_add_cpp() { REGISTER_OP_BUILDER(QuantizedAdd); }
+        }
+    }
+}
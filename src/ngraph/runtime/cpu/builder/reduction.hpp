@@ -58,135 +58,85 @@
         return;                                                                                    \
     }                                                                                              \
                                                                                                    \
-    if (reduction_axes.size() == 1 && is_optimized_et(args[0].get_element_type()))                 \
-    {                                                                                              \
-        if (*reduction_axes.begin() == arg_rank - 1)                                               \
-        {                                                                                          \
-            std::function<decltype(runtime::cpu::kernel::reduce_##K##_innermost_1rd<float, 2>)>    \
-                kernel;                                                                            \
-            SELECT_ETS_AND_RANK7(kernel,                                                           \
-                                 result_element_type,                                              \
-                                 arg_rank,                                                         \
-                                 runtime::cpu::kernel::reduce_##K##_innermost_1rd);                \
-            auto functor =                                                                         \
-                [&, kernel, arg_shape, result_shape, arg_buffer_index, out_buffer_index](          \
-                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                           \
-                    kernel(ctx->buffer_data[arg_buffer_index],                                     \
-                           ctx->buffer_data[out_buffer_index],                                     \
-                           arg_shape,                                                              \
-                           result_shape,                                                           \
-                           ectx->arena);                                                           \
-                };                                                                                 \
-            functors.emplace_back(functor);                                                        \
-            return;                                                                                \
-        }                                                                                          \
-                                                                                                   \
-        std::function<decltype(runtime::cpu::kernel::reduce_##K##_1rd<float, 2>)> kernel;          \
-        SELECT_ETS_AND_RANK7(                                                                      \
-            kernel, result_element_type, arg_rank, runtime::cpu::kernel::reduce_##K##_1rd);        \
-        auto functor = [&,                                                                         \
-                        kernel,                                                                    \
-                        arg_shape,                                                                 \
-                        result_shape,                                                              \
-                        reduction_axes,                                                            \
-                        arg_buffer_index,                                                          \
-                        out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {     \
-            kernel(ctx->buffer_data[arg_buffer_index],                                             \
-                   ctx->buffer_data[out_buffer_index],                                             \
-                   arg_shape,                                                                      \
-                   result_shape,                                                                   \
-                   reduction_axes,                                                                 \
-                   ectx->arena);                                                                   \
-        };                                                                                         \
-        functors.emplace_back(functor);                                                            \
-        return;                                                                                    \
-    }                                                                                              \
-                                                                                                   \
-    if (reduction_axes.size() == 2 && arg_rank == 3 &&                                             \
+    if (reduction_axes.size() == 1 && *reduction_axes.begin() == arg_rank - 1 &&                   \
         is_optimized_et(args[0].get_element_type()))                                               \
     {                                                                                              \
-        std::function<decltype(runtime::cpu::kernel::reduce_##K##_3d_2rd<float>)> kernel;          \
-        SELECT_ETS(kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_3d_2rd);        \
-        auto functor = [&,                                                                         \
-                        kernel,                                                                    \
-                        arg_shape,                                                                 \
-                        result_shape,                                                              \
-                        reduction_axes,                                                            \
-                        arg_buffer_index,                                                          \
-                        out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {     \
-            kernel(ctx->buffer_data[arg_buffer_index],                                             \
-                   ctx->buffer_data[out_buffer_index],                                             \
-                   arg_shape,                                                                      \
-                   result_shape,                                                                   \
-                   reduction_axes,                                                                 \
-                   ectx->arena);                                                                   \
-        };                                                                                         \
-        functors.emplace_back(functor);                                                            \
-        return;                                                                                    \
-    }                                                                                              \
-                                                                                                   \
-    if (reduction_axes.size() == 2 && arg_rank == 4 &&                                             \
-        is_optimized_et(args[0].get_element_type()))                                               \
-    {                                                                                              \
-        std::function<decltype(runtime::cpu::kernel::reduce_##K##_4d_2rd<float>)> kernel;          \
-        SELECT_ETS(kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_4d_2rd);        \
-        auto functor = [&,                                                                         \
-                        kernel,                                                                    \
-                        arg_shape,                                                                 \
-                        result_shape,                                                              \
-                        reduction_axes,                                                            \
-                        arg_buffer_index,                                                          \
-                        out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {     \
-            kernel(ctx->buffer_data[arg_buffer_index],                                             \
-                   ctx->buffer_data[out_buffer_index],                                             \
-                   arg_shape,                                                                      \
-                   result_shape,                                                                   \
-                   reduction_axes,                                                                 \
-                   ectx->arena);                                                                   \
-        };                                                                                         \
-        functors.emplace_back(functor);                                                            \
-        return;                                                                                    \
-    }                                                                                              \
-                                                                                                   \
-    if (reduction_axes.size() == 2 && arg_rank == 5 &&                                             \
-        is_optimized_et(args[0].get_element_type()))                                               \
-    {                                                                                              \
-        std::function<decltype(runtime::cpu::kernel::reduce_##K##_5d_2rd<float>)> kernel;          \
-        SELECT_ETS(kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_5d_2rd);        \
-        auto functor = [&,                                                                         \
-                        kernel,                                                                    \
-                        arg_shape,                                                                 \
-                        result_shape,                                                              \
-                        reduction_axes,                                                            \
-                        arg_buffer_index,                                                          \
-                        out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {     \
+        std::function<decltype(runtime::cpu::kernel::reduce_##K##_innermost_1rd<float, 2>)>        \
+            kernel;                                                                                \
+        SELECT_ETS_AND_RANK7(kernel,                                                               \
+                             result_element_type,                                                  \
+                             arg_rank,                                                             \
+                             runtime::cpu::kernel::reduce_##K##_innermost_1rd);                    \
+        auto functor = [&, kernel, arg_shape, result_shape, arg_buffer_index, out_buffer_index](   \
+            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                   \
             kernel(ctx->buffer_data[arg_buffer_index],                                             \
                    ctx->buffer_data[out_buffer_index],                                             \
                    arg_shape,                                                                      \
                    result_shape,                                                                   \
-                   reduction_axes,                                                                 \
                    ectx->arena);                                                                   \
         };                                                                                         \
         functors.emplace_back(functor);                                                            \
         return;                                                                                    \
     }                                                                                              \
                                                                                                    \
-    std::function<decltype(runtime::cpu::kernel::K<float>)> ref_kernel;                            \
+    std::function<decltype(runtime::cpu::kernel::reduce_##K##_axes<float>)> axes_kernel;           \
                                                                                                    \
-    SELECT_KERNEL(ref_kernel, result_element_type, runtime::cpu::kernel::K);                       \
+    SELECT_KERNEL(axes_kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_axes);      \
                                                                                                    \
-    auto functor = [&,                                                                             \
-                    ref_kernel,                                                                    \
-                    arg_shape,                                                                     \
-                    result_shape,                                                                  \
-                    reduction_axes,                                                                \
-                    arg_buffer_index,                                                              \
-                    out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {         \
-        ref_kernel(ctx->buffer_data[arg_buffer_index],                                             \
-                   ctx->buffer_data[out_buffer_index],                                             \
-                   arg_shape,                                                                      \
-                   result_shape,                                                                   \
-                   reduction_axes,                                                                 \
-                   ectx->arena);                                                                   \
+    runtime::cpu::kernel::ReductionPlan plan(arg_shape, reduction_axes);                           \
+    auto functor = [&, axes_kernel, plan, arg_buffer_index, out_buffer_index](                     \
+        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                       \
+        axes_kernel(ctx->buffer_data[arg_buffer_index],                                            \
+                    ctx->buffer_data[out_buffer_index],                                            \
+                    plan,                                                                          \
+                    ectx->arena);                                                                  \
     };                                                                                             \
     functors.emplace_back(functor)
+
+// f32 reductions whose axes are contiguous at either end of the shape are lowered onto the
+// kernels for the selected ISA. The input is viewed as [outer, inner] with the reduced axes on
+// one side. Expands to nothing for other reductions so BUILD_REDUCTION_FUNCTOR can follow it.
+#define BUILD_ISA_REDUCTION_FUNCTOR(OP, K)                                                         \
+    if (args[0].get_element_type() == element::f32)                                                \
+    {                                                                                              \
+        auto& isa_axes = static_cast<const ngraph::op::OP*>(node)->get_reduction_axes();           \
+        auto isa_shape = args[0].get_shape();                                                      \
+        size_t isa_rank = isa_shape.size();                                                        \
+        bool isa_contiguous =                                                                      \
+            !isa_axes.empty() && *isa_axes.rbegin() - *isa_axes.begin() + 1 == isa_axes.size();    \
+        bool isa_suffix = isa_contiguous && *isa_axes.rbegin() == isa_rank - 1;                    \
+        bool isa_prefix = isa_contiguous && *isa_axes.begin() == 0;                                \
+        if (isa_suffix || isa_prefix)                                                              \
+        {                                                                                          \
+            size_t split = isa_suffix ? *isa_axes.begin() : isa_axes.size();                       \
+            size_t outer = shape_size(Shape(isa_shape.begin(), isa_shape.begin() + split));        \
+            size_t inner = shape_size(Shape(isa_shape.begin() + split, isa_shape.end()));          \
+            auto isa_arg_index = external_function->get_buffer_index(args[0].get_name());          \
+            auto isa_out_index = external_function->get_buffer_index(out[0].get_name());           \
+            std::function<void(const float*, float*, size_t, size_t, int)> isa_kernel;             \
+            if (isa_suffix && isa_prefix)                                                          \
+            {                                                                                      \
+                isa_kernel = [](const float* x, float* y, size_t, size_t count, int arena) {       \
+                    runtime::cpu::kernel::reduce_##K##_all_float32(x, y, count, arena);            \
+                };                                                                                 \
+            }                                                                                      \
+            else if (isa_suffix)                                                                   \
+            {                                                                                      \
+                isa_kernel = runtime::cpu::kernel::reduce_##K##_rows_float32;                      \
+            }                                                                                      \
+            else                                                                                   \
+            {                                                                                      \
+                isa_kernel = runtime::cpu::kernel::reduce_##K##_cols_float32;                      \
+            }                                                                                      \
+            auto functor = [&, isa_kernel, outer, inner, isa_arg_index, isa_out_index](            \
+                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                               \
+                isa_kernel(static_cast<const float*>(ctx->buffer_data[isa_arg_index]),             \
+                           static_cast<float*>(ctx->buffer_data[isa_out_index]),                   \
+                           outer,                                                                  \
+                           inner,                                                                  \
+                           ectx->arena);                                                           \
+            };                                                                                     \
+            external_function->get_functors().emplace_back(functor);                               \
+            return;                                                                                \
+        }                                                                                          \
+    }
@@ -49,16 +49,6 @@ namespace ngraph
                 auto lower_bounds = replace_slice->get_lower_bounds();
                 auto upper_bounds = replace_slice->get_upper_bounds();
 
-                bool strided = false;
-                for (auto stride : strides)
-                {
-                    if (stride != 1)
-                    {
-                        strided = true;
-                        break;
-                    }
-                }
-
                 if (!arg0_shape.size())
                 {
                     size_t size = args[0].get_element_type().size();
@@ -72,95 +62,33 @@ namespace ngraph
                     return;
                 }
 
-                if (strided && is_optimized_et(args[0].get_element_type()))
-                {
-                    std::function<decltype(runtime::cpu::kernel::strided_replace_slice<float, 2>)>
-                        kernel;
-
-                    SELECT_ETS_AND_RANK7(kernel,
-                                         args[0].get_element_type(),
-                                         arg0_shape.size(),
-                                         runtime::cpu::kernel::strided_replace_slice);
-
-                    auto functor = [&,
-                                    kernel,
-                                    arg0_shape,
-                                    arg1_shape,
-                                    lower_bounds,
-                                    upper_bounds,
-                                    strides,
-                                    arg0_buffer_index,
-                                    arg1_buffer_index,
-                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* ectx) {
-                        kernel(ctx->buffer_data[arg0_buffer_index],
-                               ctx->buffer_data[arg1_buffer_index],
-                               ctx->buffer_data[out_buffer_index],
-                               arg0_shape,
-                               arg1_shape,
-                               lower_bounds,
-                               upper_bounds,
-                               strides,
-                               ectx->arena);
-                    };
-                    functors.emplace_back(functor);
-                }
-                else if (is_optimized_et(args[0].get_element_type()))
-                {
-                    std::function<decltype(runtime::cpu::kernel::replace_slice<float, 2>)> kernel;
-
-                    SELECT_ETS_AND_RANK7(kernel,
-                                         args[0].get_element_type(),
-                                         arg0_shape.size(),
-                                         runtime::cpu::kernel::replace_slice);
-
-                    auto functor = [&,
-                                    kernel,
-                                    arg0_shape,
-                                    arg1_shape,
-                                    lower_bounds,
-                                    arg0_buffer_index,
-                                    arg1_buffer_index,
-                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* ectx) {
-                        kernel(ctx->buffer_data[arg0_buffer_index],
-                               ctx->buffer_data[arg1_buffer_index],
-                               ctx->buffer_data[out_buffer_index],
-                               arg0_shape,
-                               arg1_shape,
-                               lower_bounds,
-                               ectx->arena);
-                    };
-                    functors.emplace_back(functor);
-                }
-                else
-                {
-                    std::function<decltype(runtime::cpu::kernel::ref_replace_slice<float>)> kernel;
-                    SELECT_KERNEL(kernel,
-                                  args[0].get_element_type(),
-                                  runtime::cpu::kernel::ref_replace_slice);
-                    auto functor = [&,
-                                    kernel,
-                                    arg1_shape,
-                                    out_shape,
-                                    lower_bounds,
-                                    upper_bounds,
-                                    strides,
-                                    arg0_buffer_index,
-                                    arg1_buffer_index,
-                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* /*ectx*/) {
-                        kernel(ctx->buffer_data[arg0_buffer_index],
-                               ctx->buffer_data[arg1_buffer_index],
-                               ctx->buffer_data[out_buffer_index],
-                               arg1_shape,
-                               lower_bounds,
-                               upper_bounds,
-                               strides,
-                               out_shape);
-                    };
-                    functors.emplace_back(functor);
-                }
+                std::function<decltype(runtime::cpu::kernel::replace_slice<float>)> kernel;
+
+                SELECT_KERNEL(
+                    kernel, args[0].get_element_type(), runtime::cpu::kernel::replace_slice)
+
+                auto functor = [&,
+                                kernel,
+                                arg1_shape,
+                                out_shape,
+                                lower_bounds,
+                                upper_bounds,
+                                strides,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg0_buffer_index],
+                           ctx->buffer_data[arg1_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           arg1_shape,
+                           lower_bounds,
+                           upper_bounds,
+                           strides,
+                           out_shape,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
             }
 
             void register_builders_replace_slice_cpp() { REGISTER_OP_BUILDER(ReplaceSlice); }
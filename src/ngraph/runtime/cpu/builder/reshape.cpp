@@ -18,6 +18,7 @@
 
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/isa.hpp"
 #include "ngraph/runtime/cpu/kernel/reshape.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
@@ -34,7 +35,8 @@ namespace ngraph
             static void get_reshape_kernel(
                 const ngraph::Node* node,
                 std::function<decltype(runtime::cpu::kernel::reshape_1d<float, 2>)>& kernel,
-                std::function<decltype(runtime::cpu::kernel::reshape_ref<float>)>& ref_kernel,
+                std::function<decltype(runtime::cpu::kernel::reshape_blocked<float>)>&
+                    blocked_kernel,
                 Shape& arg_shape,
                 Shape& result_shape,
                 AxisVector& input_order,
@@ -86,25 +88,17 @@ namespace ngraph
                     SELECT_ETS_AND_RANK7(
                         kernel, result_element_type, result_rank, runtime::cpu::kernel::reshape_1d);
                 }
-                else if (arg_rank == 2 && is_optimized_et(result_element_type))
+                else if (arg_rank == 2 && result_rank == 2 &&
+                         result_element_type == element::f32)
                 {
-                    SELECT_ETS_AND_RANK7(
-                        kernel, result_element_type, result_rank, runtime::cpu::kernel::reshape_2d);
-                }
-                else if (arg_rank == 3 && is_optimized_et(result_element_type))
-                {
-                    SELECT_ETS_AND_RANK7(
-                        kernel, result_element_type, result_rank, runtime::cpu::kernel::reshape_3d);
-                }
-                else if (arg_rank == 4 && is_optimized_et(result_element_type))
-                {
-                    SELECT_ETS_AND_RANK7(
-                        kernel, result_element_type, result_rank, runtime::cpu::kernel::reshape_4d);
+                    // The only 2-D permutation that is not sorted is a transpose
+                    kernel = runtime::cpu::kernel::transpose_2d_float32;
                 }
                 else
                 {
-                    SELECT_KERNEL(
-                        ref_kernel, result_element_type, runtime::cpu::kernel::reshape_ref)
+                    SELECT_KERNEL(blocked_kernel,
+                                  result_element_type,
+                                  runtime::cpu::kernel::reshape_blocked)
                 }
             }
 
@@ -112,7 +106,8 @@ namespace ngraph
             NodeExecutorTy Builder::BUILDER_CF_DECL(ngraph::op::Reshape)
             {
                 std::function<decltype(runtime::cpu::kernel::reshape_1d<float, 2>)> kernel;
-                std::function<decltype(runtime::cpu::kernel::reshape_ref<float>)> ref_kernel;
+                std::function<decltype(runtime::cpu::kernel::reshape_blocked<float>)>
+                    blocked_kernel;
                 Shape arg_shape, result_shape;
                 AxisVector input_order;
                 size_t size;
@@ -120,7 +115,7 @@ namespace ngraph
 
                 get_reshape_kernel(node,
                                    kernel,
-                                   ref_kernel,
+                                   blocked_kernel,
                                    arg_shape,
                                    result_shape,
                                    input_order,
@@ -134,11 +129,12 @@ namespace ngraph
                         kernel(inputs[0], outputs[0], arg_shape, input_order, result_shape, 0);
                     };
                 }
-                else if (ref_kernel)
+                else if (blocked_kernel)
                 {
-                    functor = [ref_kernel, arg_shape, input_order, result_shape](
+                    functor = [blocked_kernel, arg_shape, input_order, result_shape](
                         std::vector<void*> inputs, std::vector<void*> outputs) {
-                        ref_kernel(inputs[0], outputs[0], arg_shape, input_order, result_shape, 0);
+                        blocked_kernel(
+                            inputs[0], outputs[0], arg_shape, input_order, result_shape, 0);
                     };
                 }
                 else if (skip_reshape)
@@ -170,7 +166,8 @@ namespace ngraph
                 auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 std::function<decltype(runtime::cpu::kernel::reshape_1d<float, 2>)> kernel;
-                std::function<decltype(runtime::cpu::kernel::reshape_ref<float>)> ref_kernel;
+                std::function<decltype(runtime::cpu::kernel::reshape_blocked<float>)>
+                    blocked_kernel;
                 Shape arg_shape, result_shape;
                 AxisVector input_order;
                 size_t size;
@@ -178,7 +175,7 @@ namespace ngraph
 
                 get_reshape_kernel(node,
                                    kernel,
-                                   ref_kernel,
+                                   blocked_kernel,
                                    arg_shape,
                                    result_shape,
                                    input_order,
@@ -203,22 +200,22 @@ namespace ngraph
                                ectx->arena);
                     };
                 }
-                else if (ref_kernel)
+                else if (blocked_kernel)
                 {
                     functor = [&,
-                               ref_kernel,
+                               blocked_kernel,
                                arg_shape,
                                input_order,
                                result_shape,
                                arg_buffer_index,
                                out_buffer_index](CPURuntimeContext* ctx,
                                                  CPUExecutionContext* ectx) {
-                        ref_kernel(ctx->buffer_data[arg_buffer_index],
-                                   ctx->buffer_data[out_buffer_index],
-                                   arg_shape,
-                                   input_order,
-                                   result_shape,
-                                   ectx->arena);
+                        blocked_kernel(ctx->buffer_data[arg_buffer_index],
+                                       ctx->buffer_data[out_buffer_index],
+                                       arg_shape,
+                                       input_order,
+                                       result_shape,
+                                       ectx->arena);
                     };
                 }
                 else if (skip_reshape)
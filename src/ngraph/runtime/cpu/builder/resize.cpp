@@ -0,0 +1,248 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/crop_and_resize.hpp"
+#include "ngraph/op/experimental/layers/interpolate.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/resize.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace
+            {
+                template <typename T, typename I>
+                CPUKernelFunctor prepare_crop_and_resize(const ngraph::op::CropAndResize* crop,
+                                                         const vector<TensorViewWrapper>& args,
+                                                         const vector<TensorViewWrapper>& out,
+                                                         CPU_ExternalFunction* external_function)
+                {
+                    auto image_shape = args[0].get_shape();
+                    auto out_shape = out[0].get_shape();
+                    size_t image_h = image_shape[1];
+                    size_t image_w = image_shape[2];
+                    size_t depth = image_shape[3];
+                    size_t box_count = out_shape[0];
+                    size_t crop_h = out_shape[1];
+                    size_t crop_w = out_shape[2];
+                    using ResizeMethod = ngraph::op::CropAndResize::ResizeMethod;
+                    bool nearest = crop->get_resize_method() == ResizeMethod::nearest;
+                    float extrapolation_value = crop->get_extrapolation_value();
+
+                    auto image_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto boxes_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto indices_buffer_index =
+                        external_function->get_buffer_index(args[2].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                    return [&,
+                            image_h,
+                            image_w,
+                            depth,
+                            box_count,
+                            crop_h,
+                            crop_w,
+                            nearest,
+                            extrapolation_value,
+                            image_buffer_index,
+                            boxes_buffer_index,
+                            indices_buffer_index,
+                            out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel::crop_and_resize(
+                            static_cast<T*>(ctx->buffer_data[image_buffer_index]),
+                            static_cast<float*>(ctx->buffer_data[boxes_buffer_index]),
+                            static_cast<I*>(ctx->buffer_data[indices_buffer_index]),
+                            static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                            image_h,
+                            image_w,
+                            depth,
+                            box_count,
+                            crop_h,
+                            crop_w,
+                            nearest,
+                            extrapolation_value,
+                            ectx->arena);
+                    };
+                }
+
+                template <typename T>
+                CPUKernelFunctor prepare_crop_and_resize(const ngraph::op::CropAndResize* crop,
+                                                         const vector<TensorViewWrapper>& args,
+                                                         const vector<TensorViewWrapper>& out,
+                                                         CPU_ExternalFunction* external_function)
+                {
+                    auto index_element_type = args[2].get_element_type();
+                    if (index_element_type == element::i32)
+                    {
+                        return prepare_crop_and_resize<T, int32_t>(
+                            crop, args, out, external_function);
+                    }
+                    else if (index_element_type == element::i64)
+                    {
+                        return prepare_crop_and_resize<T, int64_t>(
+                            crop, args, out, external_function);
+                    }
+                    else
+                    {
+                        throw ngraph_error(
+                            "Unsupported index type in CPU Builder for CropAndResize");
+                    }
+                }
+
+                template <typename T>
+                CPUKernelFunctor prepare_interpolate(const ngraph::op::Interpolate* interpolate,
+                                                     const vector<TensorViewWrapper>& args,
+                                                     const vector<TensorViewWrapper>& out,
+                                                     CPU_ExternalFunction* external_function)
+                {
+                    auto in_shape = args[0].get_shape();
+                    auto out_shape = out[0].get_shape();
+                    size_t rank = in_shape.size();
+                    size_t in_h = rank > 1 ? in_shape[rank - 2] : 1;
+                    size_t in_w = in_shape[rank - 1];
+                    size_t out_h = rank > 1 ? out_shape[rank - 2] : 1;
+                    size_t out_w = out_shape[rank - 1];
+                    size_t planes = shape_size(in_shape) / (in_h * in_w);
+                    bool nearest = interpolate->get_attrs().mode == "nearest";
+                    bool align_corners = interpolate->get_attrs().align_corners;
+
+                    auto in_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                    return [&,
+                            planes,
+                            in_h,
+                            in_w,
+                            out_h,
+                            out_w,
+                            nearest,
+                            align_corners,
+                            in_buffer_index,
+                            out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel::interpolate(static_cast<T*>(ctx->buffer_data[in_buffer_index]),
+                                            static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                                            planes,
+                                            in_h,
+                                            in_w,
+                                            out_h,
+                                            out_w,
+                                            nearest,
+                                            align_corners,
+                                            ectx->arena);
+                    };
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::CropAndResize)
+            {
+                auto& functors = external_function->get_functors();
+                auto crop = static_cast<const ngraph::op::CropAndResize*>(node);
+                CPUKernelFunctor functor;
+
+                if (args[1].get_element_type() != element::f32)
+                {
+                    throw ngraph_error("Boxes must be f32 in CPU Builder for CropAndResize");
+                }
+
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    functor = prepare_crop_and_resize<float>(crop, args, out, external_function);
+                }
+                else if (element_type == element::f64)
+                {
+                    functor = prepare_crop_and_resize<double>(crop, args, out, external_function);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported type (" + element_type.get_type_name() +
+                                       ") in CPU Builder for CropAndResize");
+                }
+
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Interpolate)
+            {
+                auto& functors = external_function->get_functors();
+                auto interpolate = static_cast<const ngraph::op::Interpolate*>(node);
+                auto& attrs = interpolate->get_attrs();
+                CPUKernelFunctor functor;
+
+                // Only the two trailing axes can be resized
+                size_t rank = args[0].get_shape().size();
+                for (auto axis : attrs.axes)
+                {
+                    if (axis + 2 < rank)
+                    {
+                        throw ngraph_error(
+                            "Only the two trailing axes can be resized in CPU Builder for "
+                            "Interpolate");
+                    }
+                }
+                bool padded = false;
+                for (auto pad : attrs.pads_begin)
+                {
+                    padded = padded || pad != 0;
+                }
+                for (auto pad : attrs.pads_end)
+                {
+                    padded = padded || pad != 0;
+                }
+                if ((attrs.mode != "nearest" && attrs.mode != "linear") || attrs.antialias ||
+                    padded)
+                {
+                    throw ngraph_error("Unsupported mode (" + attrs.mode +
+                                       ") in CPU Builder for Interpolate");
+                }
+
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    functor = prepare_interpolate<float>(interpolate, args, out, external_function);
+                }
+                else if (element_type == element::f64)
+                {
+                    functor =
+                        prepare_interpolate<double>(interpolate, args, out, external_function);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported type (" + element_type.get_type_name() +
+                                       ") in CPU Builder for Interpolate");
+                }
+
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_resize_cpp()
+            {
+                REGISTER_OP_BUILDER(CropAndResize);
+                REGISTER_OP_BUILDER(Interpolate);
+            }
+        }
+    }
+}
@@ -14,8 +14,6 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <cstring>
-
 #include "ngraph/op/scatter_add.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/scatter_add.hpp"
@@ -46,160 +44,41 @@ namespace ngraph
                     throw ngraph_error("Unsupported index element type");
                 }
 
-                if (args[0].get_element_type() != element::f64 &&
-                    args[0].get_element_type() != element::f32 &&
-                    args[0].get_element_type() != element::u8 &&
-                    args[0].get_element_type() != element::i8)
-                {
-                    throw ngraph_error("Unsupported type in CPU Builder for ScatterAdd");
-                }
-
-                bool is_int64 = args[1].get_element_type() == element::i64;
                 auto inputs_shape = args[0].get_shape();
                 auto indices_shape = args[1].get_shape();
-                auto updates_shape = args[2].get_shape();
-                auto out_shape = out[0].get_shape();
-                auto element_type = args[0].get_element_type();
-
-                if (is_int64 && is_optimized_et(args[0].get_element_type()))
-                {
-                    if (inputs_shape.size() <= 3 && updates_shape.size() <= 5)
-                    {
-                        std::function<decltype(runtime::cpu::kernel::scatter_add_i64<float, 2, 2>)>
-                            kernel;
-
-                        SELECT_RANK35_ET4(kernel,
-                                          args[0].get_element_type(),
-                                          inputs_shape.size(),
-                                          updates_shape.size(),
-                                          runtime::cpu::kernel::scatter_add_i64);
-
-                        auto functor = [&,
-                                        kernel,
-                                        inputs_shape,
-                                        indices_shape,
-                                        updates_shape,
-                                        inputs_buffer_index,
-                                        indices_buffer_index,
-                                        updates_buffer_index,
-                                        out_buffer_index](CPURuntimeContext* ctx,
-                                                          CPUExecutionContext* ectx) {
-                            kernel(ctx->buffer_data[inputs_buffer_index],
-                                   ctx->buffer_data[indices_buffer_index],
-                                   ctx->buffer_data[updates_buffer_index],
-                                   ctx->buffer_data[out_buffer_index],
-                                   inputs_shape,
-                                   indices_shape,
-                                   updates_shape,
-                                   ectx->arena);
-                        };
-                        functors.emplace_back(functor);
-                    }
-                    else
-                    {
-                        throw ngraph_error("Unsupported ranks in CPU Builder for ScatterAdd");
-                    }
-                }
-                else if (is_optimized_et(args[0].get_element_type()))
-                {
-                    if (inputs_shape.size() <= 3 && updates_shape.size() <= 5)
-                    {
-                        std::function<decltype(runtime::cpu::kernel::scatter_add_i32<float, 2, 2>)>
-                            kernel;
 
-                        SELECT_RANK35_ET4(kernel,
-                                          args[0].get_element_type(),
-                                          inputs_shape.size(),
-                                          updates_shape.size(),
-                                          runtime::cpu::kernel::scatter_add_i32);
-
-                        auto functor = [&,
-                                        kernel,
-                                        inputs_shape,
-                                        indices_shape,
-                                        updates_shape,
-                                        inputs_buffer_index,
-                                        indices_buffer_index,
-                                        updates_buffer_index,
-                                        out_buffer_index](CPURuntimeContext* ctx,
-                                                          CPUExecutionContext* ectx) {
-                            kernel(ctx->buffer_data[inputs_buffer_index],
-                                   ctx->buffer_data[indices_buffer_index],
-                                   ctx->buffer_data[updates_buffer_index],
-                                   ctx->buffer_data[out_buffer_index],
-                                   inputs_shape,
-                                   indices_shape,
-                                   updates_shape,
-                                   ectx->arena);
-                        };
-                        functors.emplace_back(functor);
-                    }
-                    else
-                    {
-                        throw ngraph_error("Unsupported ranks in CPU Builder for ScatterAdd");
-                    }
-                }
-                else if (is_int64)
+                std::function<decltype(runtime::cpu::kernel::scatter_add_rows_i32<float>)> kernel;
+                if (args[1].get_element_type() == element::i64)
                 {
-                    std::function<decltype(runtime::cpu::kernel::ref_scatter_add_i64<float>)>
-                        kernel;
                     SELECT_KERNEL(kernel,
                                   args[0].get_element_type(),
-                                  runtime::cpu::kernel::ref_scatter_add_i64);
-
-                    auto functor = [&,
-                                    kernel,
-                                    inputs_shape,
-                                    indices_shape,
-                                    updates_shape,
-                                    out_shape,
-                                    inputs_buffer_index,
-                                    indices_buffer_index,
-                                    updates_buffer_index,
-                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* /*ectx*/) {
-                        kernel(ctx->buffer_data[inputs_buffer_index],
-                               ctx->buffer_data[indices_buffer_index],
-                               ctx->buffer_data[updates_buffer_index],
-                               ctx->buffer_data[out_buffer_index],
-                               inputs_shape,
-                               indices_shape,
-                               updates_shape,
-                               out_shape);
-                    };
-                    functors.emplace_back(functor);
+                                  runtime::cpu::kernel::scatter_add_rows_i64);
                 }
-
                 else
                 {
-                    std::function<decltype(runtime::cpu::kernel::ref_scatter_add_i32<float>)>
-                        kernel;
                     SELECT_KERNEL(kernel,
                                   args[0].get_element_type(),
-                                  runtime::cpu::kernel::ref_scatter_add_i32);
-
-                    auto functor = [&,
-                                    kernel,
-                                    inputs_shape,
-                                    indices_shape,
-                                    updates_shape,
-                                    out_shape,
-                                    inputs_buffer_index,
-                                    indices_buffer_index,
-                                    updates_buffer_index,
-                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* /*ectx*/) {
-                        kernel(ctx->buffer_data[inputs_buffer_index],
-                               ctx->buffer_data[indices_buffer_index],
-                               ctx->buffer_data[updates_buffer_index],
-                               ctx->buffer_data[out_buffer_index],
-                               inputs_shape,
-                               indices_shape,
-                               updates_shape,
-                               out_shape);
-                    };
-                    functors.emplace_back(functor);
+                                  runtime::cpu::kernel::scatter_add_rows_i32);
                 }
+
+                auto functor = [&,
+                                kernel,
+                                inputs_shape,
+                                indices_shape,
+                                inputs_buffer_index,
+                                indices_buffer_index,
+                                updates_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[inputs_buffer_index],
+                           ctx->buffer_data[indices_buffer_index],
+                           ctx->buffer_data[updates_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           inputs_shape,
+                           indices_shape,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
             }
 
             void register_builders_scatter_add_cpp() { REGISTER_OP_BUILDER(ScatterAdd); }
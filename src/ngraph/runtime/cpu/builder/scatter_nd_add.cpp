@@ -14,11 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <cstring>
-
+#include "ngraph/op/fused/scatter_nd.hpp"
 #include "ngraph/op/scatter_nd_add.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/scatter_nd_add.hpp"
+#include "ngraph/runtime/cpu/kernel/scatter_add.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -29,184 +28,94 @@ namespace ngraph
     {
         namespace cpu
         {
-            template <>
-            void Builder::BUILDER_DECL(ngraph::op::ScatterNDAdd)
+            using ScatterNDKernel = std::function<decltype(kernel::scatter_nd_add_i32<float>)>;
+
+            static void build_scatter_nd(CPU_ExternalFunction* external_function,
+                                         const vector<TensorViewWrapper>& args,
+                                         const vector<TensorViewWrapper>& out,
+                                         const ScatterNDKernel& kernel)
             {
-                (void)node;
                 auto& functors = external_function->get_functors();
-                CPUKernelFunctor functor;
 
                 auto inputs_buffer_index = external_function->get_buffer_index(args[0].get_name());
                 auto indices_buffer_index = external_function->get_buffer_index(args[1].get_name());
                 auto updates_buffer_index = external_function->get_buffer_index(args[2].get_name());
                 auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto inputs_shape = args[0].get_shape();
+                auto indices_shape = args[1].get_shape();
+
+                auto functor = [&,
+                                kernel,
+                                inputs_shape,
+                                indices_shape,
+                                inputs_buffer_index,
+                                indices_buffer_index,
+                                updates_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[inputs_buffer_index],
+                           ctx->buffer_data[indices_buffer_index],
+                           ctx->buffer_data[updates_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           inputs_shape,
+                           indices_shape,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ScatterNDAdd)
+            {
+                (void)node;
                 if (args[1].get_element_type() != element::i64 &&
                     args[1].get_element_type() != element::i32)
                 {
                     throw ngraph_error("Unsupported index element type");
                 }
-                bool is_int64 = args[1].get_element_type() == element::i64;
-                auto inputs_shape = args[0].get_shape();
-                auto indices_shape = args[1].get_shape();
-                auto updates_shape = args[2].get_shape();
-                auto out_shape = out[0].get_shape();
-                auto element_type = args[0].get_element_type();
-                if (element_type == element::f32)
+
+                ScatterNDKernel kernel;
+                if (args[1].get_element_type() == element::i64)
                 {
-                    if (is_int64)
-                    {
-                        functor = [&,
-                                   inputs_shape,
-                                   indices_shape,
-                                   updates_shape,
-                                   out_shape,
-                                   inputs_buffer_index,
-                                   indices_buffer_index,
-                                   updates_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::scatter_nd_add<float, int64_t>(
-                                static_cast<float*>(ctx->buffer_data[inputs_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[indices_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[updates_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                inputs_shape,
-                                indices_shape,
-                                updates_shape,
-                                out_shape);
-                        };
-                    }
-                    else
-                    {
-                        functor = [&,
-                                   inputs_shape,
-                                   indices_shape,
-                                   updates_shape,
-                                   out_shape,
-                                   inputs_buffer_index,
-                                   indices_buffer_index,
-                                   updates_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::scatter_nd_add<float, int32_t>(
-                                static_cast<float*>(ctx->buffer_data[inputs_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[indices_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[updates_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                inputs_shape,
-                                indices_shape,
-                                updates_shape,
-                                out_shape);
-                        };
-                    }
+                    SELECT_KERNEL(kernel,
+                                  args[0].get_element_type(),
+                                  runtime::cpu::kernel::scatter_nd_add_i64);
                 }
-                else if (element_type == element::f64)
+                else
                 {
-                    if (is_int64)
-                    {
-                        functor = [&,
-                                   inputs_shape,
-                                   indices_shape,
-                                   updates_shape,
-                                   out_shape,
-                                   inputs_buffer_index,
-                                   indices_buffer_index,
-                                   updates_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::scatter_nd_add<double, int64_t>(
-                                static_cast<double*>(ctx->buffer_data[inputs_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[indices_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[updates_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
-                                inputs_shape,
-                                indices_shape,
-                                updates_shape,
-                                out_shape);
-                        };
-                    }
-                    else
-                    {
-                        functor = [&,
-                                   inputs_shape,
-                                   indices_shape,
-                                   updates_shape,
-                                   out_shape,
-                                   inputs_buffer_index,
-                                   indices_buffer_index,
-                                   updates_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::scatter_nd_add<double, int32_t>(
-                                static_cast<double*>(ctx->buffer_data[inputs_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[indices_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[updates_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
-                                inputs_shape,
-                                indices_shape,
-                                updates_shape,
-                                out_shape);
-                        };
-                    }
+                    SELECT_KERNEL(kernel,
+                                  args[0].get_element_type(),
+                                  runtime::cpu::kernel::scatter_nd_add_i32);
                 }
-                else if (element_type == element::i64)
+                build_scatter_nd(external_function, args, out, kernel);
+            }
+
+            // Runs directly instead of as its decomposition into two ScatterNDAdds, a Convert
+            // and a Select
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ScatterND)
+            {
+                (void)node;
+                ScatterNDKernel kernel;
+                if (args[1].get_element_type() == element::i64)
                 {
-                    if (is_int64)
-                    {
-                        functor = [&,
-                                   inputs_shape,
-                                   indices_shape,
-                                   updates_shape,
-                                   out_shape,
-                                   inputs_buffer_index,
-                                   indices_buffer_index,
-                                   updates_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::scatter_nd_add<int64_t, int64_t>(
-                                static_cast<int64_t*>(ctx->buffer_data[inputs_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[indices_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[updates_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[out_buffer_index]),
-                                inputs_shape,
-                                indices_shape,
-                                updates_shape,
-                                out_shape);
-                        };
-                    }
-                    else
-                    {
-                        functor = [&,
-                                   inputs_shape,
-                                   indices_shape,
-                                   updates_shape,
-                                   out_shape,
-                                   inputs_buffer_index,
-                                   indices_buffer_index,
-                                   updates_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::scatter_nd_add<int64_t, int32_t>(
-                                static_cast<int64_t*>(ctx->buffer_data[inputs_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[indices_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[updates_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[out_buffer_index]),
-                                inputs_shape,
-                                indices_shape,
-                                updates_shape,
-                                out_shape);
-                        };
-                    }
+                    SELECT_KERNEL(
+                        kernel, args[0].get_element_type(), runtime::cpu::kernel::scatter_nd_i64);
                 }
                 else
                 {
-                    throw ngraph_error("Unsupported type in CPU Builder for ScatterNDAdd");
+                    SELECT_KERNEL(
+                        kernel, args[0].get_element_type(), runtime::cpu::kernel::scatter_nd_i32);
                 }
-
-                functors.emplace_back(functor);
+                build_scatter_nd(external_function, args, out, kernel);
             }
 
-            void register_builders_scatter_nd_add_cpp() { REGISTER_OP_BUILDER(ScatterNDAdd); }
+            void register_builders_scatter_nd_add_cpp()
+            {
+                REGISTER_OP_BUILDER(ScatterNDAdd);
+                REGISTER_OP_BUILDER(ScatterND);
+            }
         }
     }
 }
@@ -0,0 +1,185 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/fused/depth_to_space.hpp"
+#include "ngraph/op/fused/shuffle_channels.hpp"
+#include "ngraph/op/fused/space_to_depth.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/reshape.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Copies args[0], viewed with `dispersed_shape`, to out[0] in the order of
+            // `axis_order` with one blocked transpose. The decompositions of the ops below are
+            // this transpose between two reshapes.
+            static void build_shuffle(CPU_ExternalFunction* external_function,
+                                      const vector<TensorViewWrapper>& args,
+                                      const vector<TensorViewWrapper>& out,
+                                      const Shape& dispersed_shape,
+                                      const AxisVector& axis_order)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                Shape transposed_shape;
+                for (auto axis : axis_order)
+                {
+                    transposed_shape.push_back(dispersed_shape.at(axis));
+                }
+
+                std::function<decltype(runtime::cpu::kernel::reshape_blocked<float>)> kernel;
+                SELECT_KERNEL(
+                    kernel, args[0].get_element_type(), runtime::cpu::kernel::reshape_blocked)
+
+                auto functor = [&,
+                                kernel,
+                                dispersed_shape,
+                                axis_order,
+                                transposed_shape,
+                                arg_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           dispersed_shape,
+                           axis_order,
+                           transposed_shape,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::DepthToSpace)
+            {
+                auto depth_to_space = static_cast<const ngraph::op::DepthToSpace*>(node);
+                Shape data_shape = args[0].get_shape();
+                if (data_shape.size() == 3)
+                {
+                    data_shape.insert(data_shape.begin(), 1);
+                }
+                size_t bs = depth_to_space->get_block_size();
+                size_t spatial_dims = data_shape.size() - 2;
+                size_t c_flat = data_shape[1] / static_cast<size_t>(pow(bs, spatial_dims));
+
+                // [N, C / bs^K, bs, ..., bs, D1, ..., DK] for depth first and
+                // [N, bs, ..., bs, C / bs^K, D1, ..., DK] for blocks first, transposed so that
+                // each spatial axis is followed by its block axis
+                Shape dispersed_shape{data_shape[0]};
+                dispersed_shape.insert(dispersed_shape.end(), spatial_dims, bs);
+                dispersed_shape.insert(
+                    dispersed_shape.end(), data_shape.begin() + 2, data_shape.end());
+                AxisVector axis_order{0};
+                if (depth_to_space->get_mode() ==
+                    ngraph::op::DepthToSpace::DepthToSpaceMode::DEPTH_FIRST)
+                {
+                    dispersed_shape.insert(dispersed_shape.begin() + 1, c_flat);
+                    axis_order.push_back(1);
+                    for (size_t i = 2; i < data_shape.size(); i++)
+                    {
+                        axis_order.push_back(spatial_dims + i);
+                        axis_order.push_back(i);
+                    }
+                }
+                else
+                {
+                    dispersed_shape.insert(dispersed_shape.begin() + spatial_dims + 1, c_flat);
+                    axis_order.push_back(spatial_dims + 1);
+                    for (size_t i = 2; i < data_shape.size(); i++)
+                    {
+                        axis_order.push_back(spatial_dims + i);
+                        axis_order.push_back(i - 1);
+                    }
+                }
+                build_shuffle(external_function, args, out, dispersed_shape, axis_order);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::SpaceToDepth)
+            {
+                auto space_to_depth = static_cast<const ngraph::op::SpaceToDepth*>(node);
+                Shape data_shape = args[0].get_shape();
+                if (data_shape.size() == 3)
+                {
+                    data_shape.insert(data_shape.begin(), 1);
+                }
+                size_t bs = space_to_depth->get_block_size();
+                size_t spatial_dims = data_shape.size() - 2;
+
+                // [N, C, D1 / bs, bs, ..., DK / bs, bs], transposed to put the block axes next
+                // to the channel axis, after it for depth first and before it for blocks first
+                Shape dispersed_shape{data_shape[0], data_shape[1]};
+                for (size_t i = 2; i < data_shape.size(); i++)
+                {
+                    dispersed_shape.push_back(data_shape[i] / bs);
+                    dispersed_shape.push_back(bs);
+                }
+                AxisVector axis_order{0};
+                for (size_t i = 0; i < spatial_dims; i++)
+                {
+                    axis_order.push_back(3 + 2 * i);
+                }
+                for (size_t i = 0; i < spatial_dims; i++)
+                {
+                    axis_order.push_back(2 + 2 * i);
+                }
+                if (space_to_depth->get_mode() ==
+                    ngraph::op::SpaceToDepth::SpaceToDepthMode::DEPTH_FIRST)
+                {
+                    axis_order.insert(axis_order.begin() + 1, 1);
+                }
+                else
+                {
+                    axis_order.insert(axis_order.begin() + spatial_dims + 1, 1);
+                }
+                build_shuffle(external_function, args, out, dispersed_shape, axis_order);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ShuffleChannels)
+            {
+                auto shuffle = static_cast<const ngraph::op::ShuffleChannels*>(node);
+                auto& data_shape = args[0].get_shape();
+                size_t axis = shuffle->get_zero_based_axis();
+                size_t groups = shuffle->get_groups();
+
+                // [outer, groups, channels / groups, inner] with the middle axes swapped
+                auto axis_it = data_shape.begin() + axis;
+                Shape dispersed_shape{shape_size(Shape(data_shape.begin(), axis_it)),
+                                      groups,
+                                      data_shape[axis] / groups,
+                                      shape_size(Shape(axis_it + 1, data_shape.end()))};
+                build_shuffle(
+                    external_function, args, out, dispersed_shape, AxisVector{0, 2, 1, 3});
+            }
+
+            void register_builders_shuffle_cpp()
+            {
+                REGISTER_OP_BUILDER(DepthToSpace);
+                REGISTER_OP_BUILDER(ShuffleChannels);
+                REGISTER_OP_BUILDER(SpaceToDepth);
+            }
+        }
+    }
+}
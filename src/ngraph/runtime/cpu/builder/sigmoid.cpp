@@ -16,10 +16,12 @@
 
 #include "ngraph/op/sigmoid.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/isa.hpp"
 #include "ngraph/runtime/cpu/kernel/sigmoid_multiply.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
+#include "ngraph/runtime/reference/sigmoid.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -38,8 +40,37 @@ namespace ngraph
                 auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
                 auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
-                auto input_shape = args[0].get_shape();
-                auto out_shape = out[0].get_shape();
+                // Only f32 is assigned to MKLDNN
+                if (!runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    std::function<void(void*, void*, size_t, int)> kernel;
+                    if (args[0].get_element_type() == element::f32)
+                    {
+                        kernel = runtime::cpu::kernel::sigmoid_float32;
+                    }
+                    else if (args[0].get_element_type() == element::f64)
+                    {
+                        kernel = [](void* input, void* output, size_t count, int) {
+                            reference::sigmoid(static_cast<const double*>(input),
+                                               static_cast<double*>(output),
+                                               count);
+                        };
+                    }
+                    else
+                    {
+                        throw ngraph_error("Sigmoid is supported only for floating point types");
+                    }
+                    auto element_count = out[0].get_size();
+                    auto functor = [&, kernel, element_count, arg0_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               element_count,
+                               ectx->arena);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
 
                 auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
                 auto sigmoid_desc = mkldnn_emitter->get_sigmoid_forward_desc(node, false);
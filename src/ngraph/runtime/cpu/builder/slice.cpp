@@ -138,88 +138,30 @@ namespace ngraph
                 }
                 else
                 {
-                    if (is_strided(strides) && is_optimized_et(args[0].get_element_type()))
-                    {
-                        std::function<decltype(runtime::cpu::kernel::strided_slice<float, 2>)>
-                            kernel;
+                    std::function<decltype(runtime::cpu::kernel::slice<float>)> kernel;
 
-                        SELECT_ETS_AND_RANK7(kernel,
-                                             args[0].get_element_type(),
-                                             arg_shape.size(),
-                                             runtime::cpu::kernel::strided_slice);
+                    SELECT_KERNEL(kernel, args[0].get_element_type(), runtime::cpu::kernel::slice)
 
-                        auto functor = [&,
-                                        kernel,
-                                        arg_shape,
-                                        out_shape,
-                                        lower_bounds,
-                                        upper_bounds,
-                                        strides,
-                                        arg_buffer_index,
-                                        out_buffer_index](CPURuntimeContext* ctx,
-                                                          CPUExecutionContext* ectx) {
-                            kernel(ctx->buffer_data[arg_buffer_index],
-                                   ctx->buffer_data[out_buffer_index],
-                                   arg_shape,
-                                   out_shape,
-                                   lower_bounds,
-                                   upper_bounds,
-                                   strides,
-                                   ectx->arena);
-                        };
-                        functors.emplace_back(functor);
-                    }
-                    else if (is_optimized_et(args[0].get_element_type()))
-                    {
-                        std::function<decltype(runtime::cpu::kernel::slice<float, 2>)> kernel;
-
-                        SELECT_ETS_AND_RANK7(kernel,
-                                             args[0].get_element_type(),
-                                             arg_shape.size(),
-                                             runtime::cpu::kernel::slice);
-
-                        auto functor = [&,
-                                        kernel,
-                                        arg_shape,
-                                        out_shape,
-                                        lower_bounds,
-                                        arg_buffer_index,
-                                        out_buffer_index](CPURuntimeContext* ctx,
-                                                          CPUExecutionContext* ectx) {
-                            kernel(ctx->buffer_data[arg_buffer_index],
-                                   ctx->buffer_data[out_buffer_index],
-                                   arg_shape,
-                                   out_shape,
-                                   lower_bounds,
-                                   ectx->arena);
-                        };
-                        functors.emplace_back(functor);
-                    }
-                    else
-                    {
-                        std::function<decltype(runtime::cpu::kernel::ref_slice<float>)> kernel;
-                        SELECT_KERNEL(
-                            kernel, args[0].get_element_type(), runtime::cpu::kernel::ref_slice);
-                        auto functor = [&,
-                                        kernel,
-                                        arg_shape,
-                                        out_shape,
-                                        lower_bounds,
-                                        upper_bounds,
-                                        strides,
-                                        arg_buffer_index,
-                                        out_buffer_index](CPURuntimeContext* ctx,
-                                                          CPUExecutionContext* /*ectx*/) {
-                            kernel(ctx->buffer_data[arg_buffer_index],
-                                   ctx->buffer_data[out_buffer_index],
-                                   arg_shape,
-                                   lower_bounds,
-                                   upper_bounds,
-                                   strides,
-                                   out_shape);
-                        };
-                        functors.emplace_back(functor);
-                    }
+                    auto functor = [&,
+                                    kernel,
+                                    arg_shape,
+                                    out_shape,
+                                    lower_bounds,
+                                    upper_bounds,
+                                    strides,
+                                    arg_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               arg_shape,
+                               lower_bounds,
+                               upper_bounds,
+                               strides,
+                               out_shape,
+                               ectx->arena);
+                    };
+                    functors.emplace_back(functor);
                 }
             }
 
@@ -16,6 +16,7 @@
 
 #include "ngraph/op/softmax.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/isa.hpp"
 #include "ngraph/runtime/cpu/kernel/softmax.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
@@ -106,52 +107,59 @@ namespace ngraph
                         functors.emplace_back(functor);
                         return;
                     }
-                    else if (axes.size() == 1)
+                    else if (!axes.empty() && *axes.begin() + axes.size() == arg_shape.size())
                     {
-                        if (*axes.begin() == (arg_shape.size() - 1))
+                        // The softmax axes are the trailing ones, so each row is contiguous
+                        size_t cols = 1;
+                        for (auto axis : axes)
+                        {
+                            cols *= arg_shape[axis];
+                        }
+                        size_t rows = cols == 0 ? 0 : shape_size(arg_shape) / cols;
+
+                        std::function<decltype(runtime::cpu::kernel::softmax_rows<float>)> kernel;
+                        if (args[0].get_element_type() == element::f32)
                         {
-                            std::function<decltype(
-                                runtime::cpu::kernel::softmax_innermost_1rd<float, 1>)>
-                                kernel;
-
-                            SELECT_ETS_AND_RANK7(kernel,
-                                                 args[0].get_element_type(),
-                                                 args[0].get_shape().size(),
-                                                 runtime::cpu::kernel::softmax_innermost_1rd);
-
-                            auto functor =
-                                [&, kernel, arg_shape, arg_buffer_index, out_buffer_index](
-                                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                    kernel(ctx->buffer_data[arg_buffer_index],
-                                           ctx->buffer_data[out_buffer_index],
-                                           arg_shape,
-                                           ectx->arena);
-                                };
-                            functors.emplace_back(functor);
-                            return;
+                            kernel = runtime::cpu::kernel::softmax_rows_float32;
                         }
                         else
                         {
-                            std::function<decltype(runtime::cpu::kernel::softmax_1rd<float, 1>)>
-                                kernel;
-
-                            SELECT_ETS_AND_RANK7(kernel,
-                                                 args[0].get_element_type(),
-                                                 args[0].get_shape().size(),
-                                                 runtime::cpu::kernel::softmax_1rd);
-
-                            auto functor =
-                                [&, kernel, arg_shape, axes, arg_buffer_index, out_buffer_index](
-                                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                    kernel(ctx->buffer_data[arg_buffer_index],
-                                           ctx->buffer_data[out_buffer_index],
-                                           arg_shape,
-                                           axes,
-                                           ectx->arena);
-                                };
-                            functors.emplace_back(functor);
-                            return;
+                            SELECT_ETS(kernel,
+                                       args[0].get_element_type(),
+                                       runtime::cpu::kernel::softmax_rows);
                         }
+
+                        auto functor = [&, kernel, rows, cols, arg_buffer_index, out_buffer_index](
+                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            kernel(ctx->buffer_data[arg_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
+                                   rows,
+                                   cols,
+                                   ectx->arena);
+                        };
+                        functors.emplace_back(functor);
+                        return;
+                    }
+                    else if (axes.size() == 1)
+                    {
+                        std::function<decltype(runtime::cpu::kernel::softmax_1rd<float, 1>)> kernel;
+
+                        SELECT_ETS_AND_RANK7(kernel,
+                                             args[0].get_element_type(),
+                                             args[0].get_shape().size(),
+                                             runtime::cpu::kernel::softmax_1rd);
+
+                        auto functor =
+                            [&, kernel, arg_shape, axes, arg_buffer_index, out_buffer_index](
+                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                                kernel(ctx->buffer_data[arg_buffer_index],
+                                       ctx->buffer_data[out_buffer_index],
+                                       arg_shape,
+                                       axes,
+                                       ectx->arena);
+                            };
+                        functors.emplace_back(functor);
+                        return;
                     }
                     else if (arg_shape.size() == 3 && axes.size() == 2)
                     {
@@ -0,0 +1,227 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/fused/softmax_crossentropy.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/softmax_crossentropy.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace
+            {
+                template <typename T, typename L>
+                CPUKernelFunctor prepare_forward(const ngraph::op::SoftmaxCrossEntropy* sm_ce,
+                                                 const vector<TensorViewWrapper>& args,
+                                                 const vector<TensorViewWrapper>& out,
+                                                 CPU_ExternalFunction* external_function)
+                {
+                    auto shape = args[0].get_shape();
+                    size_t n = shape[0];
+                    size_t c = shape[1];
+                    bool soft_label = sm_ce->get_soft_label();
+                    int64_t ignore_index = sm_ce->get_ignore_index();
+
+                    auto logits_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto labels_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                    return [&,
+                            n,
+                            c,
+                            soft_label,
+                            ignore_index,
+                            logits_buffer_index,
+                            labels_buffer_index,
+                            out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel::softmax_crossentropy(
+                            static_cast<T*>(ctx->buffer_data[logits_buffer_index]),
+                            static_cast<L*>(ctx->buffer_data[labels_buffer_index]),
+                            static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                            n,
+                            c,
+                            soft_label,
+                            ignore_index,
+                            ectx->arena);
+                    };
+                }
+
+                template <typename T, typename L>
+                CPUKernelFunctor
+                    prepare_backprop(const ngraph::op::SoftmaxCrossEntropyBackprop* sm_ce,
+                                     const vector<TensorViewWrapper>& args,
+                                     const vector<TensorViewWrapper>& out,
+                                     CPU_ExternalFunction* external_function)
+                {
+                    auto shape = args[1].get_shape();
+                    size_t n = shape[0];
+                    size_t c = shape[1];
+                    bool delta_per_row = args[0].get_shape() != shape;
+                    bool soft_label = sm_ce->get_soft_label();
+                    int64_t ignore_index = sm_ce->get_ignore_index();
+
+                    auto delta_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto softmax_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto labels_buffer_index =
+                        external_function->get_buffer_index(args[2].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                    return [&,
+                            n,
+                            c,
+                            delta_per_row,
+                            soft_label,
+                            ignore_index,
+                            delta_buffer_index,
+                            softmax_buffer_index,
+                            labels_buffer_index,
+                            out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel::softmax_crossentropy_backprop(
+                            static_cast<T*>(ctx->buffer_data[delta_buffer_index]),
+                            static_cast<T*>(ctx->buffer_data[softmax_buffer_index]),
+                            static_cast<L*>(ctx->buffer_data[labels_buffer_index]),
+                            static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                            n,
+                            c,
+                            delta_per_row,
+                            soft_label,
+                            ignore_index,
+                            ectx->arena);
+                    };
+                }
+
+                // Soft labels have the element type of the logits, hard labels are i32 or i64
+                template <typename T, typename OP>
+                void check_label_type(const OP* sm_ce, const element::Type& label_type)
+                {
+                    if (sm_ce->get_soft_label() ? label_type != element::from<T>()
+                                                : label_type != element::i32 &&
+                                                      label_type != element::i64)
+                    {
+                        throw ngraph_error("Unsupported label type (" +
+                                           label_type.get_type_name() + ") in CPU Builder for " +
+                                           sm_ce->description());
+                    }
+                }
+
+                template <typename T>
+                CPUKernelFunctor prepare_forward(const ngraph::op::SoftmaxCrossEntropy* sm_ce,
+                                                 const vector<TensorViewWrapper>& args,
+                                                 const vector<TensorViewWrapper>& out,
+                                                 CPU_ExternalFunction* external_function)
+                {
+                    auto label_type = args[1].get_element_type();
+                    check_label_type<T>(sm_ce, label_type);
+                    if (sm_ce->get_soft_label())
+                    {
+                        return prepare_forward<T, T>(sm_ce, args, out, external_function);
+                    }
+                    else if (label_type == element::i32)
+                    {
+                        return prepare_forward<T, int32_t>(sm_ce, args, out, external_function);
+                    }
+                    return prepare_forward<T, int64_t>(sm_ce, args, out, external_function);
+                }
+
+                template <typename T>
+                CPUKernelFunctor
+                    prepare_backprop(const ngraph::op::SoftmaxCrossEntropyBackprop* sm_ce,
+                                     const vector<TensorViewWrapper>& args,
+                                     const vector<TensorViewWrapper>& out,
+                                     CPU_ExternalFunction* external_function)
+                {
+                    auto label_type = args[2].get_element_type();
+                    check_label_type<T>(sm_ce, label_type);
+                    if (sm_ce->get_soft_label())
+                    {
+                        return prepare_backprop<T, T>(sm_ce, args, out, external_function);
+                    }
+                    else if (label_type == element::i32)
+                    {
+                        return prepare_backprop<T, int32_t>(sm_ce, args, out, external_function);
+                    }
+                    return prepare_backprop<T, int64_t>(sm_ce, args, out, external_function);
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::SoftmaxCrossEntropy)
+            {
+                auto& functors = external_function->get_functors();
+                auto sm_ce = static_cast<const ngraph::op::SoftmaxCrossEntropy*>(node);
+                CPUKernelFunctor functor;
+
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    functor = prepare_forward<float>(sm_ce, args, out, external_function);
+                }
+                else if (element_type == element::f64)
+                {
+                    functor = prepare_forward<double>(sm_ce, args, out, external_function);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported type (" + element_type.get_type_name() +
+                                       ") in CPU Builder for SoftmaxCrossEntropy");
+                }
+
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::SoftmaxCrossEntropyBackprop)
+            {
+                auto& functors = external_function->get_functors();
+                auto sm_ce = static_cast<const ngraph::op::SoftmaxCrossEntropyBackprop*>(node);
+                CPUKernelFunctor functor;
+
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    functor = prepare_backprop<float>(sm_ce, args, out, external_function);
+                }
+                else if (element_type == element::f64)
+                {
+                    functor = prepare_backprop<double>(sm_ce, args, out, external_function);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported type (" + element_type.get_type_name() +
+                                       ") in CPU Builder for SoftmaxCrossEntropyBackprop");
+                }
+
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_softmax_crossentropy_cpp()
+            {
+                REGISTER_OP_BUILDER(SoftmaxCrossEntropy);
+                REGISTER_OP_BUILDER(SoftmaxCrossEntropyBackprop);
+            }
+        }
+    }
+}
@@ -0,0 +1,66 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/kernel/sparse_dot.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/op/sparse_dot.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::SparseDot)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto sparse_dot = static_cast<const ngraph::op::SparseDot*>(node);
+                auto weights = sparse_dot->get_weights();
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                size_t k = weights->shape[0];
+                size_t n = weights->shape[1];
+                size_t m = shape_size(args[0].get_shape()) / (k == 0 ? 1 : k);
+
+                // The functor keeps the weights alive; the node may be released after compile
+                auto functor = [&, weights, m, k, n, arg_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    runtime::cpu::kernel::sparse_dot(
+                        static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                        m,
+                        k,
+                        n,
+                        weights->row_offsets.data(),
+                        weights->columns.data(),
+                        weights->values.data(),
+                        weights->get_nonzero_count(),
+                        ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_sparse_dot_cpp() { REGISTER_OP_BUILDER(SparseDot); }
+        }
+    }
+}
@@ -16,7 +16,7 @@
 
 #include "ngraph/op/experimental/generate_mask.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/generate_mask.hpp"
+#include "ngraph/runtime/cpu/kernel/random.hpp"
 #include "ngraph/state/bernoulli_rng_state.hpp"
 
 using namespace std;
@@ -62,7 +62,7 @@ namespace ngraph
                                arg2_buffer_index,
                                arg3_buffer_index,
                                arg4_buffer_index](CPURuntimeContext* ctx,
-                                                  CPUExecutionContext* /* ectx */) {
+                                                  CPUExecutionContext* ectx) {
                         bool training = static_cast<bool>(
                             static_cast<float*>(ctx->buffer_data[arg_buffer_index])[0]);
                         // TODO: get shape when required
@@ -74,20 +74,26 @@ namespace ngraph
 
                         if (use_seed == false)
                         {
-                            reference::generate_mask(
+                            auto state = static_cast<BernoulliRNGState*>(ctx->states[index]);
+                            kernel::generate_mask(
                                 static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                static_cast<BernoulliRNGState*>(ctx->states[index]),
-                                training);
+                                training,
+                                state->get_distribution().p(),
+                                state->get_philox(),
+                                state->reserve(element_count),
+                                ectx->arena);
                         }
                         else
                         {
-                            reference::generate_mask_no_state(
+                            kernel::generate_mask(
                                 static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
                                 training,
-                                seed,
-                                prob);
+                                prob,
+                                Philox4x32(seed),
+                                0,
+                                ectx->arena);
                         }
                     };
                 }
@@ -101,7 +107,7 @@ namespace ngraph
                                arg2_buffer_index,
                                arg3_buffer_index,
                                arg4_buffer_index](CPURuntimeContext* ctx,
-                                                  CPUExecutionContext* /* ectx */) {
+                                                  CPUExecutionContext* ectx) {
                         bool training = static_cast<bool>(
                             static_cast<double*>(ctx->buffer_data[arg_buffer_index])[0]);
                         // TODO: get shape when required
@@ -113,20 +119,26 @@ namespace ngraph
 
                         if (use_seed == false)
                         {
-                            reference::generate_mask(
+                            auto state = static_cast<BernoulliRNGState*>(ctx->states[index]);
+                            kernel::generate_mask(
                                 static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                static_cast<BernoulliRNGState*>(ctx->states[index]),
-                                training);
+                                training,
+                                state->get_distribution().p(),
+                                state->get_philox(),
+                                state->reserve(element_count),
+                                ectx->arena);
                         }
                         else
                         {
-                            reference::generate_mask_no_state(
+                            kernel::generate_mask(
                                 static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
                                 training,
-                                seed,
-                                prob);
+                                prob,
+                                Philox4x32(seed),
+                                0,
+                                ectx->arena);
                         }
                     };
                 }
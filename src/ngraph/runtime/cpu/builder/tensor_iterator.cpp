@@ -0,0 +1,408 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/tensor_iterator.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_nested_function.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Rows [begin, begin + part_size) of `axis` in a row-major tensor. The view is contiguous,
+    // so the body can read or write it in place, when every dimension before axis is 1.
+    struct AxisSlice
+    {
+        AxisSlice(const Shape& shape,
+                  size_t element_size,
+                  int64_t start,
+                  int64_t stride,
+                  int64_t part_size,
+                  int64_t axis)
+        {
+            auto dim = static_cast<int64_t>(shape.at(axis));
+            m_start = start < 0 ? start + dim : start;
+            m_stride = stride;
+            m_part_size = part_size;
+            m_dim = static_cast<size_t>(dim);
+            m_outer = 1;
+            for (int64_t i = 0; i < axis; i++)
+            {
+                m_outer *= shape[i];
+            }
+            m_row_bytes = element_size;
+            for (size_t i = axis + 1; i < shape.size(); i++)
+            {
+                m_row_bytes *= shape[i];
+            }
+        }
+
+        bool is_contiguous() const { return m_outer == 1; }
+        size_t get_bytes() const { return m_outer * m_part_size * m_row_bytes; }
+        // Negative strides walk backwards from start, which is then the last row of the first
+        // slice
+        size_t get_begin(int64_t iteration) const
+        {
+            int64_t begin = m_start + iteration * m_stride;
+            return static_cast<size_t>(m_stride < 0 ? begin - (m_part_size - 1) : begin);
+        }
+
+        char* view(char* tensor, int64_t iteration) const
+        {
+            return tensor + get_begin(iteration) * m_row_bytes;
+        }
+
+        void gather(const char* tensor, char* slice, int64_t iteration) const
+        {
+            size_t begin = get_begin(iteration);
+            size_t slice_row = m_part_size * m_row_bytes;
+            for (size_t o = 0; o < m_outer; o++)
+            {
+                memcpy(slice + o * slice_row,
+                       tensor + (o * m_dim + begin) * m_row_bytes,
+                       slice_row);
+            }
+        }
+
+        void scatter(const char* slice, char* tensor, int64_t iteration) const
+        {
+            size_t begin = get_begin(iteration);
+            size_t slice_row = m_part_size * m_row_bytes;
+            for (size_t o = 0; o < m_outer; o++)
+            {
+                memcpy(tensor + (o * m_dim + begin) * m_row_bytes,
+                       slice + o * slice_row,
+                       slice_row);
+            }
+        }
+
+        int64_t m_start;
+        int64_t m_stride;
+        size_t m_part_size;
+        size_t m_dim;
+        size_t m_outer;
+        size_t m_row_bytes;
+    };
+
+    struct BodyParameter
+    {
+        enum class Kind
+        {
+            SLICED,
+            MERGED,
+            INVARIANT
+        };
+        Kind kind;
+        size_t buffer_index;
+        element::Type element_type;
+        Shape shape;
+        // SLICED
+        shared_ptr<AxisSlice> slice;
+        // SLICED and not contiguous: where the slice of each iteration is gathered
+        size_t staging_offset;
+        // MERGED: the body result whose value of the previous iteration is read
+        size_t result;
+    };
+
+    struct BodyResult
+    {
+        element::Type element_type;
+        Shape shape;
+        size_t bytes;
+        // Keeps the values of two iterations because a parameter reads it on the next one
+        bool back_edge = false;
+        // The single concatenated output this result is written to in place, if any
+        int64_t direct_output = -1;
+        // Where the body writes the result unless it has a direct output, and where the
+        // value of the previous iteration is kept for a back edge
+        size_t current_offset;
+        size_t previous_offset;
+    };
+
+    struct TensorIteratorOutput
+    {
+        size_t buffer_index;
+        size_t result;
+        // Concatenated output, or nullptr for the value of one iteration
+        shared_ptr<AxisSlice> slice;
+        int64_t iteration;
+    };
+
+    // Everything the functor needs, built once at compile time. The staging and result
+    // buffers are reserved in the memory pool of the outer function, at these offsets.
+    struct TensorIteratorPlan
+    {
+        shared_ptr<runtime::cpu::CPU_NestedFunction> body;
+        int64_t num_iterations;
+        vector<BodyParameter> parameters;
+        vector<BodyResult> results;
+        vector<TensorIteratorOutput> outputs;
+    };
+
+    void run_tensor_iterator(const TensorIteratorPlan& plan, runtime::cpu::CPURuntimeContext* ctx)
+    {
+        auto& buffer_data = ctx->buffer_data;
+        // Empty only if the plan reserved nothing
+        char* pool = nullptr;
+        if (!ctx->memory_buffers.empty())
+        {
+            pool = static_cast<char*>(ctx->memory_buffers[0]->get_ptr());
+        }
+        vector<char*> current(plan.results.size(), nullptr);
+        vector<char*> previous(plan.results.size(), nullptr);
+        for (size_t i = 0; i < plan.results.size(); i++)
+        {
+            auto& result = plan.results[i];
+            if (result.direct_output < 0)
+            {
+                current[i] = pool + result.current_offset;
+            }
+            if (result.back_edge)
+            {
+                previous[i] = pool + result.previous_offset;
+            }
+        }
+
+        vector<void*> inputs(plan.parameters.size());
+        vector<void*> outputs(plan.results.size());
+        for (int64_t iteration = 0; iteration < plan.num_iterations; iteration++)
+        {
+            for (size_t i = 0; i < plan.parameters.size(); i++)
+            {
+                auto& parameter = plan.parameters[i];
+                char* outer = static_cast<char*>(buffer_data[parameter.buffer_index]);
+                inputs[i] = outer;
+                if (parameter.kind == BodyParameter::Kind::SLICED)
+                {
+                    if (parameter.slice->is_contiguous())
+                    {
+                        inputs[i] = parameter.slice->view(outer, iteration);
+                    }
+                    else
+                    {
+                        char* staging = pool + parameter.staging_offset;
+                        parameter.slice->gather(outer, staging, iteration);
+                        inputs[i] = staging;
+                    }
+                }
+                else if (parameter.kind == BodyParameter::Kind::MERGED && iteration > 0)
+                {
+                    inputs[i] = previous[parameter.result];
+                }
+            }
+            for (size_t i = 0; i < plan.results.size(); i++)
+            {
+                auto& result = plan.results[i];
+                if (result.direct_output >= 0)
+                {
+                    auto& output = plan.outputs[result.direct_output];
+                    outputs[i] = output.slice->view(
+                        static_cast<char*>(buffer_data[output.buffer_index]), iteration);
+                }
+                else
+                {
+                    outputs[i] = current[i];
+                }
+            }
+
+            plan.body->call(ctx, inputs, outputs);
+
+            for (auto& output : plan.outputs)
+            {
+                if (plan.results[output.result].direct_output >= 0)
+                {
+                    continue;
+                }
+                char* out = static_cast<char*>(buffer_data[output.buffer_index]);
+                const char* value = current[output.result];
+                if (output.slice)
+                {
+                    output.slice->scatter(value, out, iteration);
+                }
+                else if (output.iteration == iteration)
+                {
+                    memcpy(out, value, plan.results[output.result].bytes);
+                }
+            }
+            // The values of this iteration become the back-edge inputs of the next one
+            for (size_t i = 0; i < plan.results.size(); i++)
+            {
+                if (plan.results[i].back_edge)
+                {
+                    swap(current[i], previous[i]);
+                }
+            }
+        }
+    }
+}
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::TensorIterator)
+            {
+                auto tensor_iterator = static_cast<const ngraph::op::TensorIterator*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto plan = make_shared<TensorIteratorPlan>();
+                plan->num_iterations = tensor_iterator->get_num_iterations();
+                if (plan->num_iterations < 0)
+                {
+                    throw ngraph_error(
+                        "TensorIterator needs a sliced input with a static shape to determine "
+                        "its number of iterations");
+                }
+
+                // Compile a copy of the body once; the CPU passes rewrite the graph they
+                // compile, and the body still belongs to the TensorIterator
+                auto body = tensor_iterator->get_body();
+                auto body_function =
+                    clone_function(Function(body->get_results(), body->get_parameters()));
+                auto& body_parameters = body_function->get_parameters();
+                auto& body_results = body_function->get_results();
+
+                for (auto& result : body_results)
+                {
+                    BodyResult body_result;
+                    body_result.element_type = result->get_element_type();
+                    body_result.shape = result->get_shape();
+                    body_result.bytes =
+                        shape_size(body_result.shape) * body_result.element_type.size();
+                    plan->results.push_back(body_result);
+                }
+
+                plan->parameters.resize(body_parameters.size());
+                for (auto& description : tensor_iterator->get_input_descriptions())
+                {
+                    auto& parameter = plan->parameters.at(description->m_body_parameter_index);
+                    auto& body_parameter =
+                        body_parameters.at(description->m_body_parameter_index);
+                    parameter.buffer_index = external_function->get_buffer_index(
+                        args.at(description->m_input_index).get_name());
+                    parameter.element_type = body_parameter->get_element_type();
+                    parameter.shape = body_parameter->get_shape();
+                    if (auto sliced = as_type_ptr<
+                            ngraph::op::TensorIterator::SliceInputDescription>(description))
+                    {
+                        parameter.kind = BodyParameter::Kind::SLICED;
+                        parameter.slice = make_shared<AxisSlice>(
+                            args.at(description->m_input_index).get_shape(),
+                            parameter.element_type.size(),
+                            sliced->m_start,
+                            sliced->m_stride,
+                            sliced->m_part_size,
+                            sliced->m_axis);
+                    }
+                    else if (auto merged = as_type_ptr<
+                                 ngraph::op::TensorIterator::MergedInputDescription>(description))
+                    {
+                        parameter.kind = BodyParameter::Kind::MERGED;
+                        parameter.result = merged->m_body_value_index;
+                        plan->results.at(parameter.result).back_edge = true;
+                    }
+                    else
+                    {
+                        parameter.kind = BodyParameter::Kind::INVARIANT;
+                    }
+                }
+
+                vector<size_t> output_uses(plan->results.size(), 0);
+                for (auto& description : tensor_iterator->get_output_descriptions())
+                {
+                    TensorIteratorOutput output;
+                    output.buffer_index = external_function->get_buffer_index(
+                        out.at(description->m_output_index).get_name());
+                    output.result = description->m_body_value_index;
+                    output.iteration = 0;
+                    auto& result = plan->results.at(output.result);
+                    if (auto concat = as_type_ptr<
+                            ngraph::op::TensorIterator::ConcatOutputDescription>(description))
+                    {
+                        output.slice =
+                            make_shared<AxisSlice>(out.at(description->m_output_index).get_shape(),
+                                                   result.element_type.size(),
+                                                   concat->m_start,
+                                                   concat->m_stride,
+                                                   concat->m_part_size,
+                                                   concat->m_axis);
+                    }
+                    else if (auto body_output = as_type_ptr<
+                                 ngraph::op::TensorIterator::BodyOutputDescription>(description))
+                    {
+                        output.iteration = body_output->m_iteration < 0
+                                               ? plan->num_iterations + body_output->m_iteration
+                                               : body_output->m_iteration;
+                    }
+                    output_uses[output.result]++;
+                    plan->outputs.push_back(output);
+                }
+                // A result that only feeds one contiguous concatenated output is written
+                // straight into its slice of that output
+                for (size_t i = 0; i < plan->outputs.size(); i++)
+                {
+                    auto& output = plan->outputs[i];
+                    auto& result = plan->results[output.result];
+                    if (output.slice && output.slice->is_contiguous() && !result.back_edge &&
+                        output_uses[output.result] == 1)
+                    {
+                        result.direct_output = static_cast<int64_t>(i);
+                    }
+                }
+
+                for (auto& parameter : plan->parameters)
+                {
+                    if (parameter.kind == BodyParameter::Kind::SLICED &&
+                        !parameter.slice->is_contiguous())
+                    {
+                        parameter.staging_offset =
+                            external_function->reserve_memory(parameter.slice->get_bytes());
+                    }
+                }
+                for (auto& result : plan->results)
+                {
+                    if (result.direct_output < 0)
+                    {
+                        result.current_offset = external_function->reserve_memory(result.bytes);
+                    }
+                    if (result.back_edge)
+                    {
+                        result.previous_offset = external_function->reserve_memory(result.bytes);
+                    }
+                }
+                plan->body = make_shared<CPU_NestedFunction>(external_function, body_function);
+
+                auto functor = [plan](CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                    run_tensor_iterator(*plan, ctx);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_tensor_iterator_cpp()
+            {
+                REGISTER_OP_BUILDER(TensorIterator);
+            }
+        }
+    }
+}
@@ -14,11 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <cstring>
-
 #include "ngraph/op/topk.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/topk.hpp"
+#include "ngraph/runtime/cpu/kernel/topk.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -29,6 +27,63 @@ namespace ngraph
     {
         namespace cpu
         {
+            namespace
+            {
+                template <typename T, typename U>
+                CPUKernelFunctor prepare_functor(const ngraph::op::TopK* topk,
+                                                 const vector<TensorViewWrapper>& args,
+                                                 const vector<TensorViewWrapper>& out,
+                                                 CPU_ExternalFunction* external_function)
+                {
+                    auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                    auto out_indices_buffer_index =
+                        external_function->get_buffer_index(out[0].get_name());
+                    auto out_values_buffer_index =
+                        external_function->get_buffer_index(out[1].get_name());
+
+                    auto axis = topk->get_top_k_axis();
+                    auto in_shape = args[0].get_shape();
+                    auto out_shape = out[0].get_shape();
+                    auto compute_max = topk->get_compute_max();
+                    auto sort = topk->get_sort();
+
+                    return [&,
+                            in_shape,
+                            out_shape,
+                            axis,
+                            compute_max,
+                            sort,
+                            arg_buffer_index,
+                            out_indices_buffer_index,
+                            out_values_buffer_index](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                        runtime::cpu::kernel::topk<T, U>(
+                            static_cast<T*>(ctx->buffer_data[arg_buffer_index]),
+                            static_cast<U*>(ctx->buffer_data[out_indices_buffer_index]),
+                            static_cast<T*>(ctx->buffer_data[out_values_buffer_index]),
+                            in_shape,
+                            out_shape,
+                            axis,
+                            compute_max,
+                            sort,
+                            ectx->arena);
+                    };
+                }
+
+                template <typename T>
+                CPUKernelFunctor prepare_functor(const ngraph::op::TopK* topk,
+                                                 const vector<TensorViewWrapper>& args,
+                                                 const vector<TensorViewWrapper>& out,
+                                                 CPU_ExternalFunction* external_function)
+                {
+                    if (out[0].get_element_type() == element::i64)
+                    {
+                        return prepare_functor<T, int64_t>(topk, args, out, external_function);
+                    }
+                    return prepare_functor<T, int32_t>(topk, args, out, external_function);
+                }
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::TopK)
             {
@@ -36,183 +91,24 @@ namespace ngraph
                 const ngraph::op::TopK* topk = static_cast<const ngraph::op::TopK*>(node);
                 CPUKernelFunctor functor;
 
-                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
-                auto out_indices_buffer_index =
-                    external_function->get_buffer_index(out[0].get_name());
-                auto out_values_buffer_index =
-                    external_function->get_buffer_index(out[1].get_name());
                 if (out[0].get_element_type() != element::i64 &&
                     out[0].get_element_type() != element::i32)
                 {
                     throw ngraph_error("Unsupported index element type");
                 }
-                bool is_int64 = out[0].get_element_type() == element::i64;
-                auto axis = topk->get_top_k_axis();
-                auto in_shape = args[0].get_shape();
-                auto out_shape = out[0].get_shape();
-                auto k = topk->get_k();
-                auto compute_max = topk->get_compute_max();
-                auto sort = topk->get_sort();
 
                 auto element_type = args[0].get_element_type();
                 if (element_type == element::f32)
                 {
-                    if (is_int64)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   k,
-                                   compute_max,
-                                   sort,
-                                   arg_buffer_index,
-                                   out_indices_buffer_index,
-                                   out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<float, int64_t>(
-                                static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_values_buffer_index]),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max,
-                                sort);
-                        };
-                    }
-                    else
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   k,
-                                   compute_max,
-                                   sort,
-                                   arg_buffer_index,
-                                   out_indices_buffer_index,
-                                   out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<float, int32_t>(
-                                static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_values_buffer_index]),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max,
-                                sort);
-                        };
-                    }
+                    functor = prepare_functor<float>(topk, args, out, external_function);
                 }
                 else if (element_type == element::f64)
                 {
-                    if (is_int64)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   k,
-                                   compute_max,
-                                   sort,
-                                   arg_buffer_index,
-                                   out_indices_buffer_index,
-                                   out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<double, int64_t>(
-                                static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_values_buffer_index]),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max,
-                                sort);
-                        };
-                    }
-                    else
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   k,
-                                   compute_max,
-                                   sort,
-                                   arg_buffer_index,
-                                   out_indices_buffer_index,
-                                   out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<double, int32_t>(
-                                static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_values_buffer_index]),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max,
-                                sort);
-                        };
-                    }
+                    functor = prepare_functor<double>(topk, args, out, external_function);
                 }
                 else if (element_type == element::i32)
                 {
-                    if (is_int64)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   k,
-                                   compute_max,
-                                   sort,
-                                   arg_buffer_index,
-                                   out_indices_buffer_index,
-                                   out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<int32_t, int64_t>(
-                                static_cast<int32_t*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[out_values_buffer_index]),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max,
-                                sort);
-                        };
-                    }
-                    else
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   k,
-                                   compute_max,
-                                   sort,
-                                   arg_buffer_index,
-                                   out_indices_buffer_index,
-                                   out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<int32_t, int32_t>(
-                                static_cast<int32_t*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[out_values_buffer_index]),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max,
-                                sort);
-                        };
-                    }
+                    functor = prepare_functor<int32_t>(topk, args, out, external_function);
                 }
                 else
                 {
@@ -0,0 +1,284 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <tuple>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/cpu_affinity.hpp"
+
+using namespace std;
+using namespace ngraph;
+using runtime::cpu::affinity::Policy;
+
+namespace
+{
+    struct AffinityState
+    {
+        mutex lock;
+        Policy policy = Policy::NONE;
+        vector<int> cpus;
+        atomic<uint64_t> generation{0};
+    };
+
+#ifdef __linux__
+    int read_topology(int cpu, const string& name)
+    {
+        ifstream in("/sys/devices/system/cpu/cpu" + to_string(cpu) + "/topology/" + name);
+        int value = 0;
+        in >> value;
+        return value;
+    }
+
+    // CPUs the process may run on, captured before any thread is pinned
+    const vector<int>& get_process_cpus()
+    {
+        static const vector<int> s_cpus = []() {
+            vector<int> cpus;
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            if (sched_getaffinity(0, sizeof(set), &set) == 0)
+            {
+                for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+                {
+                    if (CPU_ISSET(cpu, &set))
+                    {
+                        cpus.push_back(cpu);
+                    }
+                }
+            }
+            return cpus;
+        }();
+        return s_cpus;
+    }
+#else
+    const vector<int>& get_process_cpus()
+    {
+        static const vector<int> s_cpus;
+        return s_cpus;
+    }
+#endif
+
+    // Orders the process CPUs for the compact or scatter policy from the sysfs topology
+    vector<int> order_cpus(Policy policy)
+    {
+        struct CPUInfo
+        {
+            int cpu;
+            int package;
+            int core_rank;
+            int sibling_rank;
+        };
+        vector<CPUInfo> infos;
+        map<pair<int, int>, int> siblings;
+        map<int, map<int, int>> core_ranks;
+        for (int cpu : get_process_cpus())
+        {
+#ifdef __linux__
+            int package = read_topology(cpu, "physical_package_id");
+            int core = read_topology(cpu, "core_id");
+#else
+            int package = 0;
+            int core = cpu;
+#endif
+            auto& ranks = core_ranks[package];
+            auto rank = ranks.insert(make_pair(core, static_cast<int>(ranks.size()))).first;
+            infos.push_back({cpu, package, rank->second, siblings[make_pair(package, core)]++});
+        }
+        if (policy == Policy::COMPACT)
+        {
+            sort(infos.begin(), infos.end(), [](const CPUInfo& a, const CPUInfo& b) {
+                return tie(a.package, a.core_rank, a.sibling_rank) <
+                       tie(b.package, b.core_rank, b.sibling_rank);
+            });
+        }
+        else
+        {
+            sort(infos.begin(), infos.end(), [](const CPUInfo& a, const CPUInfo& b) {
+                return tie(a.sibling_rank, a.core_rank, a.package) <
+                       tie(b.sibling_rank, b.core_rank, b.package);
+            });
+        }
+        vector<int> cpus;
+        for (auto& info : infos)
+        {
+            cpus.push_back(info.cpu);
+        }
+        return cpus;
+    }
+
+    // Strictly parses a CPU list such as "0-3,8"
+    bool parse_cpu_list(const string& list, vector<int>& cpus)
+    {
+        stringstream ss(list);
+        string range;
+        while (getline(ss, range, ','))
+        {
+            int first;
+            int last;
+            char dash;
+            char extra;
+            stringstream rs(range);
+            if (!(rs >> first) || first < 0)
+            {
+                return false;
+            }
+            last = first;
+            if (rs >> dash && (dash != '-' || !(rs >> last) || last < first || rs >> extra))
+            {
+                return false;
+            }
+            for (int cpu = first; cpu <= last; cpu++)
+            {
+                cpus.push_back(cpu);
+            }
+        }
+        return !cpus.empty();
+    }
+
+    bool apply_policy(AffinityState& state, const string& value, string& error)
+    {
+        Policy policy;
+        vector<int> cpus;
+        if (value == "none" || value.empty())
+        {
+            policy = Policy::NONE;
+        }
+        else if (value == "compact" || value == "scatter")
+        {
+            policy = value == "compact" ? Policy::COMPACT : Policy::SCATTER;
+            cpus = order_cpus(policy);
+            if (cpus.empty())
+            {
+                error = "Thread affinity '" + value + "' is not supported on this platform";
+                return false;
+            }
+        }
+        else if (parse_cpu_list(value, cpus))
+        {
+            policy = Policy::EXPLICIT;
+#ifdef __linux__
+            for (int cpu : cpus)
+            {
+                if (cpu >= CPU_SETSIZE)
+                {
+                    error = "CPU " + to_string(cpu) + " in thread affinity '" + value +
+                            "' is out of range";
+                    return false;
+                }
+            }
+#endif
+        }
+        else
+        {
+            error = "Thread affinity must be 'none', 'compact', 'scatter' or a CPU list such "
+                    "as '0-3,8', got '" +
+                    value + "'";
+            return false;
+        }
+        state.policy = policy;
+        state.cpus = move(cpus);
+        state.generation++;
+        return true;
+    }
+
+    AffinityState& get_state()
+    {
+        static AffinityState* s_state = []() {
+            auto state = new AffinityState();
+            // Capture the process CPUs before anything is pinned
+            get_process_cpus();
+            const char* env = getenv("NGRAPH_CPU_AFFINITY");
+            string error;
+            if (env != nullptr && !apply_policy(*state, env, error))
+            {
+                NGRAPH_WARN << "Ignoring NGRAPH_CPU_AFFINITY: " << error;
+            }
+            return state;
+        }();
+        return *s_state;
+    }
+}
+
+bool runtime::cpu::affinity::set_policy(const string& value, string& error)
+{
+    auto& state = get_state();
+    lock_guard<mutex> lock(state.lock);
+    return apply_policy(state, value, error);
+}
+
+Policy runtime::cpu::affinity::get_policy()
+{
+    auto& state = get_state();
+    lock_guard<mutex> lock(state.lock);
+    return state.policy;
+}
+
+vector<int> runtime::cpu::affinity::get_cpus()
+{
+    auto& state = get_state();
+    lock_guard<mutex> lock(state.lock);
+    return state.cpus;
+}
+
+uint64_t runtime::cpu::affinity::get_generation()
+{
+    return get_state().generation.load(memory_order_acquire);
+}
+
+bool runtime::cpu::affinity::bind_thread(size_t slot)
+{
+#ifdef __linux__
+    vector<int> cpus = get_cpus();
+    if (cpus.empty())
+    {
+        cpus = get_process_cpus();
+    }
+    else
+    {
+        cpus = {cpus[slot % cpus.size()]};
+    }
+    if (cpus.empty())
+    {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus)
+    {
+        CPU_SET(cpu, &set);
+    }
+    if (sched_setaffinity(0, sizeof(set), &set) != 0)
+    {
+        NGRAPH_DEBUG << "Failed to bind thread slot " << slot << " to CPU " << cpus[0];
+        return false;
+    }
+    return true;
+#else
+    (void)slot;
+    return false;
+#endif
+}
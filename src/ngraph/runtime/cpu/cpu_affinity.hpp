@@ -0,0 +1,74 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// Pinning of the threads the CPU backend owns (Eigen pool threads, TBB workers and
+            /// the helper threads of OpenMP teams) to cores. Threads are numbered in slots:
+            /// thread j of intra-op pool k takes slot k * threads_per_pool + j, and slot s is
+            /// pinned to get_cpus()[s % get_cpus().size()], so each pool owns a contiguous
+            /// share of the CPU list. Application threads that call into nGraph are never
+            /// pinned. On platforms without sched_setaffinity every helper is a no-op.
+            namespace affinity
+            {
+                enum class Policy
+                {
+                    // Leave threads to the OS scheduler
+                    NONE,
+                    // Fill the cores of one socket before the next, hyperthread siblings
+                    // next to each other
+                    COMPACT,
+                    // Spread over sockets first, then physical cores, then siblings
+                    SCATTER,
+                    // Use a user supplied CPU list in the order given
+                    EXPLICIT
+                };
+
+                /// \brief Change the process-wide policy. The initial policy is read from
+                ///        NGRAPH_CPU_AFFINITY.
+                /// \param value "none", "compact", "scatter" or a CPU list such as "0-3,8"
+                /// \returns false and sets error if value is not understood
+                bool set_policy(const std::string& value, std::string& error);
+
+                Policy get_policy();
+
+                /// \returns the CPUs slots are pinned to, in slot order. Compact and scatter
+                ///          order the CPUs the process was allowed to run on at startup.
+                std::vector<int> get_cpus();
+
+                /// \brief A number that changes whenever the policy changes, so that pinned
+                ///        threads can notice and re-pin
+                uint64_t get_generation();
+
+                /// \brief Pin the calling thread to the CPU of `slot`, or allow it every CPU
+                ///        of the process again if the policy is NONE
+                /// \returns false if the affinity could not be changed
+                bool bind_thread(size_t slot);
+            }
+        }
+    }
+}
@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <future>
+#include <mutex>
+
 #if defined(NGRAPH_TBB_ENABLE)
 #include <tbb/tbb_stddef.h>
 #endif
@@ -22,13 +25,21 @@
 
 #include "ngraph/component_manager.hpp"
 #include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
+#include "ngraph/runtime/cpu/cpu_affinity.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder_registry.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_call_scheduler.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
+#include "ngraph/runtime/cpu/cpu_split_batch_executable.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/kernel/isa.hpp"
+#include "ngraph/runtime/cpu/mkldnn_conv_tuner.hpp"
 #include "ngraph/runtime/cpu/static_initialize.hpp"
+#include "ngraph/runtime/metrics.hpp"
 #include "ngraph/util.hpp"
 
 #ifdef NGRAPH_MLIR_ENABLE
@@ -42,20 +53,25 @@ using namespace std;
 extern "C" CPU_BACKEND_API void ngraph_register_cpu_backend()
 {
     runtime::BackendManager::register_backend("CPU", [](const std::string& /* config */) {
-        static bool is_initialized = false;
-        if (!is_initialized)
-        {
+        // Builders are registered when the first CPU backend is created, not when the
+        // library is loaded, and only once even if backends are created concurrently
+        static std::once_flag s_initialized;
+        std::call_once(s_initialized, []() {
 #if defined(NGRAPH_TBB_ENABLE)
             // Force TBB to link to the backend
             tbb::TBB_runtime_interface_version();
 #endif
             ngraph::runtime::cpu::register_builders();
-            is_initialized = true;
-        }
+        });
         return make_shared<runtime::cpu::CPU_Backend>();
     });
 }
 
+runtime::cpu::CPU_Backend::CPU_Backend()
+{
+    kernel::set_isa(kernel::get_default_isa());
+}
+
 runtime::cpu::CPU_Backend::~CPU_Backend()
 {
     m_exec_map.clear();
@@ -80,6 +96,23 @@ shared_ptr<runtime::Tensor> runtime::cpu::CPU_Backend::create_tensor(
     return make_shared<runtime::cpu::CPUTensorView>(element_type, shape, memory_pointer);
 }
 
+shared_ptr<runtime::Tensor> runtime::cpu::CPU_Backend::create_tensor_on_node(
+    const element::Type& element_type, const Shape& shape, size_t numa_node)
+{
+    auto tensor = make_shared<runtime::cpu::CPUTensorView>(element_type, shape);
+    if (numa::is_enabled() && numa_node < numa::get_num_nodes())
+    {
+        numa::bind_memory_to_node(tensor->get_data_ptr(), tensor->get_size_in_bytes(), numa_node);
+    }
+    return tensor;
+}
+
+static runtime::metrics::BackendMetrics& get_metrics()
+{
+    static runtime::metrics::BackendMetrics s_metrics("CPU");
+    return s_metrics;
+}
+
 shared_ptr<runtime::Executable>
     runtime::cpu::CPU_Backend::compile(shared_ptr<Function> func, bool performance_counters_enabled)
 {
@@ -102,42 +135,110 @@ shared_ptr<runtime::Executable>
     }
 #endif
 
+    auto& metrics = get_metrics();
+    runtime::metrics::ScopedTimer timer(metrics.compile_seconds);
     shared_ptr<runtime::Executable> rc;
-    // we will protect the access to map (m_exec_map) across multiple threads by creating a
-    // lock_gaurd
-    // m_exec_map_mutex will be released once the object `guard` goes out of scope
+    // Compiling rewrites the function, so a compile of a function already being compiled on
+    // another thread waits for that one instead of starting a second
+    std::promise<shared_ptr<runtime::Executable>> compiled;
     {
-        std::lock_guard<std::mutex> guard(m_exec_map_mutex);
+        std::unique_lock<std::mutex> guard(m_exec_map_mutex);
         auto it = m_exec_map.find(func);
         if (it != m_exec_map.end())
         {
+            metrics.executable_cache_hits.increment();
             rc = it->second;
             return rc;
         }
+        auto pending = m_compiling.find(func);
+        if (pending != m_compiling.end())
+        {
+            auto in_flight = pending->second;
+            guard.unlock();
+            metrics.executable_cache_hits.increment();
+            return in_flight.get();
+        }
+        m_compiling.insert({func, compiled.get_future().share()});
+    }
+    metrics.executable_cache_misses.increment();
+    try
+    {
+        auto compile_executable = [&](shared_ptr<Function> f, int numa_node) {
+            // Replicas are compiled concurrently, each with its own copy of the pass config
+            ngraph::pass::PassConfig config = pass_config;
+            auto executable = make_shared<CPU_Executable>(f,
+                                                          config,
+                                                          get_host_memory_allocator(),
+                                                          performance_counters_enabled,
+                                                          m_max_concurrency,
+                                                          m_prebuild_primitives,
+                                                          m_primitive_build_threads,
+                                                          m_share_memory_pool,
+                                                          numa_node);
+            executable->get_call_frame()->set_scheduling(
+                m_scheduling_weight, m_scheduling_priority, m_max_queued_calls);
+            return executable;
+        };
+        size_t num_nodes = numa::get_num_nodes();
+        if (m_numa_batch_split && numa::is_enabled() &&
+            CPU_SplitBatchExecutable::is_splittable(*func, num_nodes))
+        {
+            try
+            {
+                rc = make_shared<CPU_SplitBatchExecutable>(func, num_nodes, compile_executable);
+            }
+            catch (const std::exception& e)
+            {
+                // Ops that hard-code the batch size fail to specialize to a share of it
+                NGRAPH_DEBUG << "Not splitting the batch across NUMA nodes: " << e.what();
+            }
+        }
+        if (!rc)
+        {
+            rc = compile_executable(func, -1);
+        }
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> guard(m_exec_map_mutex);
+        m_compiling.erase(func);
+        compiled.set_exception(std::current_exception());
+        throw;
     }
-    rc = make_shared<CPU_Executable>(
-        func, pass_config, get_host_memory_allocator(), performance_counters_enabled);
     {
         std::lock_guard<std::mutex> guard(m_exec_map_mutex);
+        m_compiling.erase(func);
         m_exec_map.insert({func, rc});
-        return rc;
     }
+    compiled.set_value(rc);
+    return rc;
 }
 
 runtime::cpu::CPU_Executable::CPU_Executable(shared_ptr<Function> func,
                                              ngraph::pass::PassConfig& pass_config,
                                              Allocator* allocator,
-                                             bool performance_counters_enabled)
+                                             bool performance_counters_enabled,
+                                             size_t max_concurrency,
+                                             bool prebuild_primitives,
+                                             size_t primitive_build_threads,
+                                             bool share_memory_pool,
+                                             int numa_node)
 {
     FunctionInstance& instance = m_function_instance;
     if (instance.m_external_function == nullptr)
     {
         instance.m_external_function = make_shared<CPU_ExternalFunction>(func);
         instance.m_external_function->m_emit_timing = performance_counters_enabled;
-        auto cf = instance.m_external_function->make_call_frame(pass_config, allocator);
+        instance.m_external_function->m_prebuild_primitives = prebuild_primitives;
+        instance.m_external_function->m_primitive_build_threads = primitive_build_threads;
+        instance.m_external_function->m_share_memory_pool = share_memory_pool;
+        instance.m_external_function->m_numa_node = numa_node;
+        auto cf = instance.m_external_function->make_call_frame(
+            pass_config, allocator, max_concurrency);
         instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
     }
     set_parameters_and_results(*func);
+    set_pass_report(instance.m_external_function->get_pass_report());
 }
 
 std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame> runtime::cpu::CPU_Executable::get_call_frame()
@@ -146,6 +247,59 @@ std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame> runtime::cpu::CPU_Executabl
     return instance.m_call_frame;
 }
 
+void runtime::cpu::CPU_Executable::warmup()
+{
+    m_function_instance.m_external_function->prebuild_primitives();
+}
+
+void runtime::cpu::CPU_Executable::update_constants(
+    const map<string, shared_ptr<runtime::Tensor>>& constants)
+{
+    FunctionInstance& instance = m_function_instance;
+    if (instance.m_external_function == nullptr)
+    {
+        throw runtime_error("compile() must be called before update_constants().");
+    }
+    instance.m_external_function->update_constants(constants);
+}
+
+void runtime::cpu::CPU_Executable::tune_intra_op_parallelism(
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs,
+    size_t calls_per_candidate)
+{
+    FunctionInstance& instance = m_function_instance;
+    if (instance.m_external_function == nullptr)
+    {
+        throw runtime_error("compile() must be called before tune_intra_op_parallelism().");
+    }
+
+    validate(outputs, inputs);
+    auto call_frame = instance.m_call_frame;
+    instance.m_external_function->tune_op_num_threads(
+        [&]() { call_frame->call(outputs, inputs); }, calls_per_candidate);
+}
+
+vector<int> runtime::cpu::CPU_Executable::get_op_num_threads() const
+{
+    const FunctionInstance& instance = m_function_instance;
+    if (instance.m_external_function == nullptr)
+    {
+        throw runtime_error("compile() must be called before get_op_num_threads().");
+    }
+    return instance.m_external_function->get_op_num_threads();
+}
+
+void runtime::cpu::CPU_Executable::set_op_num_threads(const vector<int>& num_threads)
+{
+    FunctionInstance& instance = m_function_instance;
+    if (instance.m_external_function == nullptr)
+    {
+        throw runtime_error("compile() must be called before set_op_num_threads().");
+    }
+    instance.m_external_function->set_op_num_threads(num_threads);
+}
+
 bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
                                         const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
@@ -158,11 +312,87 @@ bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>
         throw runtime_error("compile() must be called before call().");
     }
 
+    auto& metrics = get_metrics();
+    metrics.calls.increment();
+    runtime::metrics::ScopedTimer timer(metrics.call_seconds);
     instance.m_call_frame->call(outputs, inputs);
 
     return rc;
 }
 
+shared_ptr<runtime::cpu::CPU_Executable::BoundCall>
+    runtime::cpu::CPU_Executable::bind(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                       const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    FunctionInstance& instance = m_function_instance;
+    if (instance.m_external_function == nullptr)
+    {
+        throw runtime_error("compile() must be called before bind().");
+    }
+
+    validate(outputs, inputs);
+    return make_shared<BoundCall>(instance.m_call_frame,
+                                  instance.m_call_frame->bind(outputs, inputs));
+}
+
+runtime::cpu::CPU_Executable::BoundCall::BoundCall(shared_ptr<CPU_CallFrame> call_frame,
+                                                   shared_ptr<CPU_TensorBinding> binding)
+    : m_call_frame(call_frame)
+    , m_binding(binding)
+{
+}
+
+void runtime::cpu::CPU_Executable::BoundCall::run()
+{
+    auto& metrics = get_metrics();
+    metrics.calls.increment();
+    runtime::metrics::ScopedTimer timer(metrics.call_seconds);
+    m_call_frame->call_bound(*m_binding);
+}
+
+bool runtime::cpu::CPU_Executable::call_cancellable(
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs,
+    const CancellationToken& token)
+{
+    FunctionInstance& instance = m_function_instance;
+    if (instance.m_external_function == nullptr)
+    {
+        throw runtime_error("compile() must be called before call_cancellable().");
+    }
+    if (token.is_cancelled())
+    {
+        return false;
+    }
+
+    auto& metrics = get_metrics();
+    metrics.calls.increment();
+    runtime::metrics::ScopedTimer timer(metrics.call_seconds);
+    try
+    {
+        instance.m_call_frame->call(outputs, inputs, &token);
+    }
+    catch (const call_cancelled&)
+    {
+        return false;
+    }
+    return true;
+}
+
+future<bool>
+    runtime::cpu::CPU_Executable::call_async(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                             const vector<shared_ptr<runtime::Tensor>>& inputs,
+                                             const AsyncCallback& callback)
+{
+    FunctionInstance& instance = m_function_instance;
+    if (instance.m_external_function == nullptr)
+    {
+        throw runtime_error("compile() must be called before call_async().");
+    }
+
+    return instance.m_call_frame->call_async(outputs, inputs, callback);
+}
+
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Executable> exec)
 {
     std::lock_guard<std::mutex> guard(m_exec_map_mutex);
@@ -210,6 +440,30 @@ vector<runtime::PerformanceCounter> runtime::cpu::CPU_Executable::get_performanc
     return rc;
 }
 
+runtime::Executable::MemoryStats runtime::cpu::CPU_Executable::get_memory_stats() const
+{
+    MemoryStats stats;
+    const FunctionInstance& instance = m_function_instance;
+    if (instance.m_external_function == nullptr || instance.m_call_frame == nullptr)
+    {
+        return stats;
+    }
+    auto& external_function = instance.m_external_function;
+    auto& call_frame = instance.m_call_frame;
+    stats.constant_bytes = external_function->get_constant_bytes();
+    stats.prepacked_weight_bytes = external_function->get_prepacked_weight_bytes();
+    stats.primitive_bytes = external_function->get_mkldnn_emitter()->get_workspace_bytes();
+    for (auto size : external_function->get_memory_buffer_sizes())
+    {
+        stats.intermediate_bytes_per_context += size;
+    }
+    stats.scratchpad_bytes_per_context = call_frame->get_scratchpad_bytes();
+    stats.overhead_bytes_per_context = call_frame->get_context_overhead_bytes();
+    stats.context_count = call_frame->get_context_count();
+    stats.max_context_count = call_frame->get_max_context_count();
+    return stats;
+}
+
 shared_ptr<ngraph::op::Parameter> runtime::cpu::CPU_Executable::get_parameter(size_t index) const
 {
     const ParameterVector& parameters = get_parameters();
@@ -234,59 +488,192 @@ shared_ptr<runtime::Tensor> runtime::cpu::CPU_Executable::create_input_tensor(si
 shared_ptr<runtime::Tensor> runtime::cpu::CPU_Executable::create_output_tensor(size_t output_index)
 {
     shared_ptr<op::Result> result = get_result(output_index);
-    return make_shared<runtime::cpu::CPUTensorView>(result->get_element_type(),
-                                                    result->get_shape());
+    auto tensor = make_shared<runtime::cpu::CPUTensorView>(result->get_element_type(),
+                                                           result->get_shape());
+    if (auto layout = get_output_layout(output_index))
+    {
+        tensor->set_tensor_layout(layout);
+    }
+    return tensor;
+}
+
+shared_ptr<descriptor::layout::TensorLayout>
+    runtime::cpu::CPU_Executable::get_input_layout(size_t input_index)
+{
+    return m_function_instance.m_external_function->get_parameter_layout_descriptors().at(
+        input_index);
+}
+
+shared_ptr<descriptor::layout::TensorLayout>
+    runtime::cpu::CPU_Executable::get_output_layout(size_t output_index)
+{
+    return m_function_instance.m_external_function->get_result_layout_descriptors().at(
+        output_index);
 }
 
 vector<shared_ptr<runtime::Tensor>>
     runtime::cpu::CPU_Executable::create_input_tensor(size_t input_index, size_t pipeline_depth)
 {
-    vector<shared_ptr<runtime::cpu::CPUTensorView>> tensors;
-    shared_ptr<op::Parameter> parameter = get_parameter(input_index);
-    for (size_t i = 0; i < pipeline_depth; i++)
+    vector<shared_ptr<runtime::Tensor>> tensors;
+    for (size_t stage = 0; stage < pipeline_depth; stage++)
     {
-        shared_ptr<runtime::cpu::CPUTensorView> tensor;
-        auto t = make_shared<runtime::cpu::CPUTensorView>(parameter->get_element_type(),
-                                                          parameter->get_shape());
-        tensor = static_pointer_cast<runtime::cpu::CPUTensorView>(t);
+        auto tensor = create_input_tensor(input_index);
+        m_function_instance.m_call_frame->set_pipeline_input(stage, input_index, tensor);
         tensors.push_back(tensor);
     }
-    vector<shared_ptr<runtime::Tensor>> result_tensors;
-    for (const shared_ptr<runtime::cpu::CPUTensorView>& tensor : tensors)
-    {
-        result_tensors.push_back(tensor);
-    }
-    return result_tensors;
+    return tensors;
 }
 
 vector<shared_ptr<runtime::Tensor>>
     runtime::cpu::CPU_Executable::create_output_tensor(size_t output_index, size_t pipeline_depth)
 {
-    vector<shared_ptr<runtime::cpu::CPUTensorView>> tensors;
-    shared_ptr<op::Result> result = get_result(output_index);
-    for (size_t i = 0; i < pipeline_depth; i++)
+    vector<shared_ptr<runtime::Tensor>> tensors;
+    for (size_t stage = 0; stage < pipeline_depth; stage++)
     {
-        shared_ptr<runtime::cpu::CPUTensorView> tensor;
-        auto t = make_shared<runtime::cpu::CPUTensorView>(result->get_element_type(),
-                                                          result->get_shape());
-        tensor = static_pointer_cast<runtime::cpu::CPUTensorView>(t);
+        auto tensor = create_output_tensor(output_index);
+        m_function_instance.m_call_frame->set_pipeline_output(stage, output_index, tensor);
         tensors.push_back(tensor);
     }
-    vector<shared_ptr<runtime::Tensor>> result_tensors;
-    for (const shared_ptr<runtime::cpu::CPUTensorView>& tensor : tensors)
-    {
-        result_tensors.push_back(tensor);
-    }
-    return result_tensors;
+    return tensors;
 }
 
 bool runtime::cpu::CPU_Backend::is_supported(const Node& /* op */) const
 {
     return true;
 }
+bool runtime::cpu::CPU_Backend::set_config(const map<string, string>& config, string& error)
+{
+    error = "";
+    for (auto& entry : config)
+    {
+        if (entry.first == "max_concurrency")
+        {
+            int value = std::atoi(entry.second.c_str());
+            if (value < 1)
+            {
+                error = "max_concurrency must be a positive integer, got '" + entry.second + "'";
+                return false;
+            }
+            m_max_concurrency = static_cast<size_t>(value);
+        }
+        else if (entry.first == "prebuild_primitives")
+        {
+            if (entry.second != "true" && entry.second != "false")
+            {
+                error = "prebuild_primitives must be 'true' or 'false', got '" + entry.second +
+                        "'";
+                return false;
+            }
+            m_prebuild_primitives = entry.second == "true";
+        }
+        else if (entry.first == "primitive_build_threads")
+        {
+            int value = std::atoi(entry.second.c_str());
+            if (value < 1)
+            {
+                error =
+                    "primitive_build_threads must be a positive integer, got '" + entry.second +
+                    "'";
+                return false;
+            }
+            m_primitive_build_threads = static_cast<size_t>(value);
+        }
+        else if (entry.first == "share_memory_pool")
+        {
+            if (entry.second != "true" && entry.second != "false")
+            {
+                error =
+                    "share_memory_pool must be 'true' or 'false', got '" + entry.second + "'";
+                return false;
+            }
+            m_share_memory_pool = entry.second == "true";
+        }
+        else if (entry.first == "numa_batch_split")
+        {
+            if (entry.second != "true" && entry.second != "false")
+            {
+                error =
+                    "numa_batch_split must be 'true' or 'false', got '" + entry.second + "'";
+                return false;
+            }
+            m_numa_batch_split = entry.second == "true";
+        }
+        else if (entry.first == "call_scheduler")
+        {
+            if (entry.second != "true" && entry.second != "false")
+            {
+                error = "call_scheduler must be 'true' or 'false', got '" + entry.second + "'";
+                return false;
+            }
+            set_call_scheduler_enabled(entry.second == "true");
+        }
+        else if (entry.first == "scheduling_weight")
+        {
+            int value = std::atoi(entry.second.c_str());
+            if (value < 1)
+            {
+                error =
+                    "scheduling_weight must be a positive integer, got '" + entry.second + "'";
+                return false;
+            }
+            m_scheduling_weight = static_cast<size_t>(value);
+        }
+        else if (entry.first == "scheduling_priority")
+        {
+            char* end = nullptr;
+            long value = std::strtol(entry.second.c_str(), &end, 10);
+            if (entry.second.empty() || *end != '\0')
+            {
+                error = "scheduling_priority must be an integer, got '" + entry.second + "'";
+                return false;
+            }
+            m_scheduling_priority = static_cast<int>(value);
+        }
+        else if (entry.first == "max_queued_calls")
+        {
+            char* end = nullptr;
+            long value = std::strtol(entry.second.c_str(), &end, 10);
+            if (entry.second.empty() || *end != '\0' || value < 0)
+            {
+                error = "max_queued_calls must be a non-negative integer, got '" + entry.second +
+                        "'";
+                return false;
+            }
+            m_max_queued_calls = static_cast<size_t>(value);
+        }
+        else if (entry.first == "conv_tuning")
+        {
+            if (entry.second != "true" && entry.second != "false")
+            {
+                error = "conv_tuning must be 'true' or 'false', got '" + entry.second + "'";
+                return false;
+            }
+            MKLDNNConvTuner::get().set_enabled(entry.second == "true");
+        }
+        else if (entry.first == "conv_tuning_cache")
+        {
+            MKLDNNConvTuner::get().set_cache_path(entry.second);
+        }
+        else if (entry.first == "thread_affinity")
+        {
+            // The executor and its pools are shared by every CPU backend in the process
+            if (!affinity::set_policy(entry.second, error))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            error = "Unsupported CPU backend config key '" + entry.first + "'";
+            return false;
+        }
+    }
+    return true;
+}
+
 bool runtime::cpu::CPU_Backend::is_supported_property(const Property prop) const
 {
-    if (prop == Property::memory_attach)
+    if (prop == Property::memory_attach || prop == Property::concurrent_compile)
     {
         return true;
     }
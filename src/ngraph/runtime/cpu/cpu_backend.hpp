@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -34,10 +35,14 @@ namespace ngraph
         {
             class CPU_ExternalFunction;
             class CPU_CallFrame;
+            struct CPU_TensorBinding;
             BackendConstructor CPU_BACKEND_API get_backend_constructor_pointer();
             class CPU_BACKEND_API CPU_Backend : public runtime::Backend
             {
             public:
+                /// \brief Selects the kernels for the host instruction set, see
+                ///        kernel::get_default_isa().
+                CPU_Backend();
                 ~CPU_Backend() override;
 
                 std::shared_ptr<CPU_CallFrame>
@@ -54,6 +59,15 @@ namespace ngraph
                     create_tensor(const ngraph::element::Type& element_type,
                                   const Shape& shape) override;
 
+                /// \brief Create a tensor whose pages are placed on `numa_node`. Callers that
+                ///        feed a context bound to a given node (see NGRAPH_CPU_NUMA) can use
+                ///        this to keep inputs and outputs local to the threads using them.
+                ///        Behaves like create_tensor when NUMA placement is disabled.
+                std::shared_ptr<ngraph::runtime::Tensor>
+                    create_tensor_on_node(const ngraph::element::Type& element_type,
+                                          const Shape& shape,
+                                          size_t numa_node);
+
                 std::shared_ptr<ngraph::runtime::Executable>
                     compile(std::shared_ptr<Function> func,
                             bool enable_performance_counters = false) override;
@@ -71,36 +85,186 @@ namespace ngraph
                 bool is_supported(const Node& node) const override;
                 bool is_supported_property(const Property prop) const override;
 
+                /// \brief Supported keys:
+                ///     "max_concurrency" - upper bound on the number of runtime contexts each
+                ///     executable compiled afterwards may create for concurrent calls.
+                ///     "prebuild_primitives" - "true" (default) builds the MKLDNN primitives
+                ///     while compiling, "false" defers them to Executable::warmup() or to the
+                ///     first call.
+                ///     "primitive_build_threads" - number of threads used to build them,
+                ///     default 1.
+                ///     "share_memory_pool" - "true" makes executables compiled afterwards take
+                ///     their intermediate tensors from a pool shared by every executable
+                ///     called on the same thread, sized to the largest of them. Results of
+                ///     cacheable ops are then recomputed on every call. Default "false".
+                ///     "thread_affinity" - "none" (default), "compact", "scatter" or an
+                ///     explicit CPU list such as "0-3,8". Pins the threads of the intra-op
+                ///     pools, TBB and OpenMP to cores, with each pool on its own share of the
+                ///     CPUs. The thread pools are shared by every CPU backend in the process,
+                ///     so this applies process-wide, immediately.
+                ///     "numa_batch_split" - "true" makes executables compiled afterwards
+                ///     split the batch of each call across the NUMA nodes when NGRAPH_CPU_NUMA
+                ///     is set, see CPU_SplitBatchExecutable. Functions whose batch does not
+                ///     split evenly are compiled as usual. Default "false".
+                ///     "call_scheduler" - "true" admits the calls of every CPU executable in
+                ///     the process through CPU_CallScheduler, which runs at most one call per
+                ///     intra-op thread pool and queues the rest; "false" (default) lets calls
+                ///     share the pools freely. Applies immediately.
+                ///     "scheduling_weight" - share of the thread pools that executables
+                ///     compiled afterwards get relative to others of the same priority,
+                ///     default 1.
+                ///     "scheduling_priority" - calls of executables compiled afterwards are
+                ///     admitted before those of lower priority, default 0.
+                ///     "max_queued_calls" - calls of executables compiled afterwards throw
+                ///     instead of queueing once this many calls are waiting; 0 (default)
+                ///     leaves the queue unbounded.
+                ///     "conv_tuning" - "true" benchmarks the MKLDNN implementations of each f32
+                ///     convolution compiled afterwards and keeps the fastest, see
+                ///     MKLDNNConvTuner. Default "false", or NGRAPH_CPU_CONV_TUNING.
+                ///     "conv_tuning_cache" - file the tuned choices are kept in and reused from
+                ///     by later compiles, in this process or others. Process-wide.
+                bool set_config(const std::map<std::string, std::string>& config,
+                                std::string& error) override;
+
             private:
                 // this mutex will be used to protect the addition and deletion
                 // of function to m_exec_map across multiple threads
                 std::mutex m_exec_map_mutex;
                 std::unordered_map<std::shared_ptr<Function>, std::shared_ptr<Executable>>
                     m_exec_map;
+                // Compiles in progress, guarded by m_exec_map_mutex
+                std::unordered_map<std::shared_ptr<Function>,
+                                   std::shared_future<std::shared_ptr<Executable>>>
+                    m_compiling;
                 Allocator* m_allocator;
+                size_t m_max_concurrency = 0;
+                bool m_prebuild_primitives = true;
+                size_t m_primitive_build_threads = 1;
+                bool m_share_memory_pool = false;
+                bool m_numa_batch_split = false;
+                size_t m_scheduling_weight = 1;
+                int m_scheduling_priority = 0;
+                size_t m_max_queued_calls = 0;
             };
 
             class CPU_BACKEND_API CPU_Executable : public runtime::Executable
             {
             public:
+                /// \param numa_node Run the calls on the thread pools of this NUMA node and
+                ///        keep the constants and buffers on it, or -1 for no placement. The
+                ///        Constants of `func` must then not share their data with other
+                ///        functions, since their pages are moved to the node.
                 CPU_Executable(std::shared_ptr<Function> func,
                                ngraph::pass::PassConfig& pass_config,
                                Allocator* allocator,
-                               bool performance_counters_enabled);
+                               bool performance_counters_enabled,
+                               size_t max_concurrency = 0,
+                               bool prebuild_primitives = true,
+                               size_t primitive_build_threads = 1,
+                               bool share_memory_pool = false,
+                               int numa_node = -1);
                 bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
+                /// \brief Checks `token` between ops in direct execution mode. Codegen and TBB
+                ///        flow graph calls only check it before starting.
+                bool call_cancellable(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                                      const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                                      const CancellationToken& token) override;
+
+                std::future<bool>
+                    call_async(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                               const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                               const AsyncCallback& callback = nullptr) override;
+
+                /// \brief A call on fixed tensors, made by bind()
+                class CPU_BACKEND_API BoundCall
+                {
+                public:
+                    BoundCall(std::shared_ptr<CPU_CallFrame> call_frame,
+                              std::shared_ptr<CPU_TensorBinding> binding);
+
+                    /// \brief Invoke the function on the bound tensors. Runs of one handle
+                    ///        must not overlap.
+                    void run();
+
+                private:
+                    std::shared_ptr<CPU_CallFrame> m_call_frame;
+                    std::shared_ptr<CPU_TensorBinding> m_binding;
+                };
+
+                /// \brief Validates the tensors and resolves their data pointers once, for a
+                ///        handle that runs the function on them without redoing that work.
+                ///        The tensors are kept alive by the handle.
+                std::shared_ptr<BoundCall>
+                    bind(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                         const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
                 std::shared_ptr<CPU_CallFrame> get_call_frame();
 
+                /// \brief Builds the MKLDNN primitives that were not built while compiling
+                ///
+                /// A pre-fork server can compile and warm up in the parent and fork its workers
+                /// while no call is running. The workers then share the constants, packed
+                /// weights and primitives with the parent copy-on-write, and start their own
+                /// thread pools on their first call. TBB execution is not fork safe.
+                void warmup() override;
+
+                /// \brief Swaps in the new data between calls. Constants folded into others
+                ///        during compilation, or given an MKLDNN layout, cannot be updated;
+                ///        disabling ConstantFolding and CPUConvertLayoutConstantFolding in the
+                ///        pass config keeps weights updatable.
+                void update_constants(
+                    const std::map<std::string, std::shared_ptr<runtime::Tensor>>& constants)
+                    override;
+
+                /// \brief Picks the intra-op thread count of each op by timing
+                ///        `calls_per_candidate` calls on the given tensors for every candidate
+                ///        count. No other calls may run on this executable meanwhile. Without
+                ///        tuning, small elementwise ops get fewer threads and all other ops use
+                ///        the whole arena.
+                void tune_intra_op_parallelism(
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                    size_t calls_per_candidate = 3);
+
+                /// \brief The intra-op thread count of each op in execution order, 0 for the
+                ///        whole arena. Direct execution mode only.
+                std::vector<int> get_op_num_threads() const;
+
+                /// \brief Restores thread counts saved by get_op_num_threads(). Not safe while
+                ///        calls are running.
+                void set_op_num_threads(const std::vector<int>& num_threads);
+
                 std::vector<PerformanceCounter> get_performance_data() const override;
 
+                /// \brief Primitive memory is the MKLDNN workspaces kept between forward and
+                ///        backward ops; the primitives themselves are not counted. With
+                ///        `share_memory_pool`, the intermediates of every context come from the
+                ///        pool of the calling thread, and the scratchpads of a thread pool are
+                ///        shared by the calls of all executables running on it. Bodies of
+                ///        TensorIterators and called functions are not included.
+                MemoryStats get_memory_stats() const override;
+
+                std::shared_ptr<descriptor::layout::TensorLayout>
+                    get_input_layout(size_t input_index) override;
+
+                std::shared_ptr<descriptor::layout::TensorLayout>
+                    get_output_layout(size_t output_index) override;
+
                 std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
 
+                /// \brief Creates a tensor already in the layout of output `output_index`
                 std::shared_ptr<runtime::Tensor> create_output_tensor(size_t output_index) override;
 
+                /// \brief Creates the tensors of input `input_index` for each pipeline stage.
+                ///        The call frame keeps them, and once all inputs and outputs of a stage
+                ///        are created, calls on exactly the stage's tensors reuse the runtime
+                ///        context and tensor bindings of the previous call on that stage.
                 std::vector<std::shared_ptr<runtime::Tensor>>
                     create_input_tensor(size_t input_index, size_t pipeline_depth) override;
 
+                /// \brief Creates the tensors of output `output_index` for each pipeline stage
                 std::vector<std::shared_ptr<runtime::Tensor>>
                     create_output_tensor(size_t output_index, size_t pipeline_depth) override;
 
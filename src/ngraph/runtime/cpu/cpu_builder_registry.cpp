@@ -23,12 +23,15 @@ namespace ngraph
         {
             void register_builders()
             {
+                register_builders_activation_cpp();
                 register_builders_add_cpp();
+                register_builders_all_gather_cpp();
                 register_builders_allreduce_cpp();
                 register_builders_argmax_cpp();
                 register_builders_argmin_cpp();
                 register_builders_avg_pool_cpp();
                 register_builders_batch_norm_cpp();
+                register_builders_binary_convolution_cpp();
                 register_builders_bounded_relu_cpp();
                 register_builders_broadcast_cpp();
                 register_builders_broadcast_distributed_cpp();
@@ -37,14 +40,21 @@ namespace ngraph
                 register_builders_convert_layout_cpp();
                 register_builders_convolution_cpp();
                 register_builders_cumsum_cpp();
+                register_builders_deformable_convolution_cpp();
+                register_builders_deformable_psroi_pooling_cpp();
+                register_builders_dequantizing_dot_cpp();
                 register_builders_dot_cpp();
                 register_builders_dropout_cpp();
+                register_builders_dynamic_cpp();
+                register_builders_embedding_bag_sum_cpp();
                 register_builders_embedding_lookup_cpp();
                 register_builders_erf_cpp();
+                register_builders_fused_elementwise_cpp();
                 register_builders_gather_cpp();
                 register_builders_gather_nd_cpp();
                 register_builders_gelu_cpp();
                 register_builders_get_output_element_cpp();
+                register_builders_layer_norm_cpp();
                 register_builders_leaky_relu_cpp();
                 register_builders_lrn_cpp();
                 register_builders_lstm_cpp();
@@ -52,29 +62,39 @@ namespace ngraph
                 register_builders_max_cpp();
                 register_builders_max_pool_cpp();
                 register_builders_min_cpp();
+                register_builders_non_max_suppression_cpp();
+                register_builders_normalize_cpp();
                 register_builders_one_hot_cpp();
+                register_builders_optimizer_update_cpp();
                 register_builders_pad_cpp();
                 register_builders_product_cpp();
                 register_builders_quantization_cpp();
+                register_builders_quantized_add_cpp();
                 register_builders_quantized_conv_cpp();
                 register_builders_quantized_dot_cpp();
                 register_builders_quantized_matmul_cpp();
                 register_builders_random_uniform_cpp();
                 register_builders_reduce_function_cpp();
+                register_builders_reduce_scatter_cpp();
                 register_builders_relu_cpp();
                 register_builders_replace_slice_cpp();
                 register_builders_reshape_cpp();
+                register_builders_resize_cpp();
                 register_builders_reverse_cpp();
                 register_builders_reverse_sequence_cpp();
                 register_builders_rnn_cpp();
                 register_builders_scatter_add_cpp();
                 register_builders_scatter_nd_add_cpp();
                 register_builders_select_cpp();
+                register_builders_shuffle_cpp();
                 register_builders_state_cpp();
                 register_builders_sigmoid_cpp();
                 register_builders_slice_cpp();
                 register_builders_softmax_cpp();
+                register_builders_softmax_crossentropy_cpp();
+                register_builders_sparse_dot_cpp();
                 register_builders_sum_cpp();
+                register_builders_tensor_iterator_cpp();
                 register_builders_tile_cpp();
                 register_builders_topk_cpp();
                 register_builders_update_slice_cpp();
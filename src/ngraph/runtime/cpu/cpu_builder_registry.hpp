@@ -22,12 +22,15 @@ namespace ngraph
         namespace cpu
         {
             void register_builders();
+            void register_builders_activation_cpp();
             void register_builders_add_cpp();
+            void register_builders_all_gather_cpp();
             void register_builders_allreduce_cpp();
             void register_builders_argmax_cpp();
             void register_builders_argmin_cpp();
             void register_builders_avg_pool_cpp();
             void register_builders_batch_norm_cpp();
+            void register_builders_binary_convolution_cpp();
             void register_builders_bounded_relu_cpp();
             void register_builders_broadcast_cpp();
             void register_builders_broadcast_distributed_cpp();
@@ -36,14 +39,21 @@ namespace ngraph
             void register_builders_convert_layout_cpp();
             void register_builders_convolution_cpp();
             void register_builders_cumsum_cpp();
+            void register_builders_deformable_convolution_cpp();
+            void register_builders_deformable_psroi_pooling_cpp();
+            void register_builders_dequantizing_dot_cpp();
             void register_builders_dot_cpp();
             void register_builders_dropout_cpp();
+            void register_builders_dynamic_cpp();
+            void register_builders_embedding_bag_sum_cpp();
             void register_builders_embedding_lookup_cpp();
             void register_builders_erf_cpp();
+            void register_builders_fused_elementwise_cpp();
             void register_builders_gather_cpp();
             void register_builders_gather_nd_cpp();
             void register_builders_gelu_cpp();
             void register_builders_get_output_element_cpp();
+            void register_builders_layer_norm_cpp();
             void register_builders_leaky_relu_cpp();
             void register_builders_lrn_cpp();
             void register_builders_lstm_cpp();
@@ -51,29 +61,39 @@ namespace ngraph
             void register_builders_max_cpp();
             void register_builders_max_pool_cpp();
             void register_builders_min_cpp();
+            void register_builders_non_max_suppression_cpp();
+            void register_builders_normalize_cpp();
             void register_builders_one_hot_cpp();
+            void register_builders_optimizer_update_cpp();
             void register_builders_pad_cpp();
             void register_builders_product_cpp();
             void register_builders_quantization_cpp();
+            void register_builders_quantized_add_cpp();
             void register_builders_quantized_conv_cpp();
             void register_builders_quantized_dot_cpp();
             void register_builders_quantized_matmul_cpp();
             void register_builders_random_uniform_cpp();
             void register_builders_reduce_function_cpp();
+            void register_builders_reduce_scatter_cpp();
             void register_builders_relu_cpp();
             void register_builders_replace_slice_cpp();
             void register_builders_reshape_cpp();
+            void register_builders_resize_cpp();
             void register_builders_reverse_cpp();
             void register_builders_reverse_sequence_cpp();
             void register_builders_rnn_cpp();
             void register_builders_scatter_add_cpp();
             void register_builders_scatter_nd_add_cpp();
             void register_builders_select_cpp();
+            void register_builders_shuffle_cpp();
             void register_builders_state_cpp();
             void register_builders_sigmoid_cpp();
             void register_builders_slice_cpp();
             void register_builders_softmax_cpp();
+            void register_builders_softmax_crossentropy_cpp();
+            void register_builders_sparse_dot_cpp();
             void register_builders_sum_cpp();
+            void register_builders_tensor_iterator_cpp();
             void register_builders_tile_cpp();
             void register_builders_topk_cpp();
             void register_builders_update_slice_cpp();
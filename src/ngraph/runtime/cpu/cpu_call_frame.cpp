@@ -15,40 +15,198 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <exception>
+#include <limits>
+#include <mutex>
 #include <thread>
 
+#include "ngraph/distributed.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
+#include "ngraph/runtime/metrics.hpp"
 
 using namespace std;
 using namespace ngraph;
 
+namespace
+{
+    // Intermediate pool shared by the call frames that run on this thread. Calls on one thread
+    // never overlap, except when a running call invokes another executable.
+    struct SharedMemoryPool
+    {
+        unique_ptr<runtime::AlignedBuffer> buffer;
+        bool in_use = false;
+    };
+    thread_local SharedMemoryPool s_shared_memory_pool;
+
+    // MKLDNN scratchpads shared by the calls that run in one executor arena, grown to the
+    // largest size any executable asks for. Scratchpads only live for the length of a
+    // primitive, so calls on the arena share them as long as they do not overlap.
+    struct SharedScratchpads
+    {
+        unique_ptr<runtime::AlignedBuffer> buffer;
+        // One per inter-op worker beyond the calling thread
+        vector<unique_ptr<runtime::AlignedBuffer>> workers;
+        bool in_use = false;
+    };
+    std::mutex s_scratchpad_mutex;
+
+    // A region of another pool, which it does not own
+    class MemoryPoolView : public runtime::AlignedBuffer
+    {
+    public:
+        MemoryPoolView(void* data, size_t size)
+        {
+            m_aligned_buffer = static_cast<char*>(data);
+            m_byte_size = size;
+        }
+    };
+    vector<SharedScratchpads> s_shared_scratchpads;
+
+    void release_shared_scratchpads(int arena)
+    {
+        std::lock_guard<std::mutex> lock(s_scratchpad_mutex);
+        s_shared_scratchpads[arena].in_use = false;
+    }
+
+    struct ContextMetrics
+    {
+        ContextMetrics()
+            : contexts(runtime::metrics::Registry::get_default().get_gauge(
+                  "ngraph_cpu_contexts", "Runtime contexts held by CPU call frames"))
+            , busy(runtime::metrics::Registry::get_default().get_gauge(
+                  "ngraph_cpu_contexts_busy", "Runtime contexts running a call"))
+            , wait_seconds(runtime::metrics::Registry::get_default().get_histogram(
+                  "ngraph_cpu_context_wait_seconds",
+                  "Time a CPU call waited for a free runtime context, in seconds"))
+        {
+        }
+        runtime::metrics::Gauge& contexts;
+        runtime::metrics::Gauge& busy;
+        runtime::metrics::Histogram& wait_seconds;
+    };
+
+    // m_ctx_binding of a context whose last call did not finish; no binding matches it, so
+    // the partly updated values cached in the context are not reused
+    const size_t s_unfinished_call = std::numeric_limits<size_t>::max();
+
+    ContextMetrics& get_context_metrics()
+    {
+        static ContextMetrics s_metrics;
+        return s_metrics;
+    }
+
+    // Slot held by the call running on this thread. Scheduled calls run their kernels on the
+    // calling thread, so a call made by a kernel, such as a TensorIterator body, finds the
+    // slot of its caller here and runs in it instead of waiting for a second one.
+    thread_local int s_held_slot = -1;
+
+    // Holds a call scheduler slot for the length of a call, or -1 if the scheduler is off
+    struct ScheduledSlot
+    {
+        ScheduledSlot(runtime::cpu::CPU_CallScheduler::Client& client, size_t max_queued)
+            : slot(s_held_slot)
+            , owned(false)
+        {
+            if (slot < 0 && runtime::cpu::is_call_scheduler_enabled())
+            {
+                slot = runtime::cpu::get_call_scheduler().acquire(client, max_queued);
+                owned = true;
+                s_held_slot = slot;
+            }
+        }
+        ~ScheduledSlot()
+        {
+            if (owned)
+            {
+                s_held_slot = -1;
+                runtime::cpu::get_call_scheduler().release(slot);
+            }
+        }
+        int slot;
+        bool owned;
+    };
+
+    // Records the fences of the inputs that are still being streamed in
+    void set_input_fences(runtime::cpu::CPURuntimeContext* ctx,
+                          const vector<shared_ptr<runtime::Tensor>>& inputs)
+    {
+        ctx->input_fences.clear();
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            auto fence = inputs[i] ? inputs[i]->get_fence() : nullptr;
+            if (fence && !fence->is_ready())
+            {
+                ctx->input_fences.resize(inputs.size());
+                ctx->input_fences[i] = fence;
+            }
+        }
+    }
+}
+
 runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction> external_function,
                                            InitContextFuncCG compiled_init_ctx_func,
                                            DestroyContextFuncCG compiled_destroy_ctx_func,
                                            EntryPoint compiled_function,
-                                           runtime::Allocator* allocator)
+                                           runtime::Allocator* allocator,
+                                           size_t max_concurrency)
     : m_external_function(external_function)
+    , m_allocator(allocator)
     , m_compiled_init_ctx_func(compiled_init_ctx_func)
     , m_compiled_destroy_ctx_func(compiled_destroy_ctx_func)
     , m_compiled_function(compiled_function)
 {
+    const size_t hw_concurrency = std::max(1u, std::thread::hardware_concurrency());
     const auto envConcurrency = std::getenv("NGRAPH_CPU_CONCURRENCY");
-    m_num_ctx = envConcurrency == nullptr ? 1 : std::atoi(envConcurrency);
-    if (m_num_ctx > std::thread::hardware_concurrency())
+    size_t initial_ctx = envConcurrency == nullptr ? 1 : std::atoi(envConcurrency);
+    if (initial_ctx < 1 || initial_ctx > hw_concurrency)
     {
         throw ngraph_error(
             "Unexpected value specified for NGRAPH_CPU_CONCURRENCY "
             "(" +
             std::string(envConcurrency) + "). Please specify a value in range [1-" +
-            std::to_string(std::thread::hardware_concurrency()) + "]");
+            std::to_string(hw_concurrency) + "]");
     }
 
-    setup_runtime_context(allocator);
+    if (!m_external_function->is_direct_execution())
+    {
+        // single context for codegen
+        m_max_ctx = 1;
+        initial_ctx = 1;
+    }
+    else
+    {
+        m_max_ctx = std::max(initial_ctx, max_concurrency == 0 ? hw_concurrency : max_concurrency);
+    }
+
+    // The pool of a nested function is a region of its caller's pool
+    m_share_memory_pool =
+        m_external_function->is_direct_execution() &&
+        (m_external_function->m_share_memory_pool || m_external_function->m_nested);
+    m_own_memory_pools.resize(m_max_ctx);
+    m_nested_memory_pools.resize(m_max_ctx);
+    m_own_scratchpads.resize(m_max_ctx);
+
+    m_ctx_busy.reset(new std::atomic<bool>[m_max_ctx]);
+    for (size_t i = 0; i < m_max_ctx; i++)
+    {
+        m_ctx_busy[i] = true;
+    }
+    m_ctx_vec = std::vector<CPURuntimeContext*>(m_max_ctx, nullptr);
+    m_ctx_binding = std::vector<size_t>(m_max_ctx, 0);
+    for (size_t i = 0; i < initial_ctx; i++)
+    {
+        m_ctx_vec[i] = create_runtime_context(i);
+        m_ctx_busy[i] = false;
+    }
+    m_num_ctx = initial_ctx;
+
     if (!m_external_function->is_direct_execution())
     {
         // Invoke codegen runtime context initialization function.
@@ -79,7 +237,8 @@ void runtime::cpu::CPU_CallFrame::inner_call(
     {
         shared_ptr<runtime::cpu::CPUTensorView> tv =
             static_pointer_cast<runtime::cpu::CPUTensorView>(input_tvs[i]);
-        if (disable_caching)
+        // Cached results do not survive in a pool that other call frames write to
+        if (disable_caching || m_share_memory_pool)
         {
             m_ctx_vec[id]->p_en[i] = true;
         }
@@ -96,10 +255,51 @@ void runtime::cpu::CPU_CallFrame::inner_call(
             static_pointer_cast<runtime::cpu::CPUTensorView>(output_tvs[i]);
         outputs.push_back(tv->get_data_ptr());
     }
+    m_ctx_vec[id]->io_binding = 0;
+    run_context(id, inputs, outputs);
+}
+
+void runtime::cpu::CPU_CallFrame::run_context(size_t id,
+                                              vector<void*>& inputs,
+                                              vector<void*>& outputs)
+{
+    // Give the shared pool back to the thread even if the call throws
+    struct SharedMemoryPoolGuard
+    {
+        ~SharedMemoryPoolGuard()
+        {
+            if (taken)
+            {
+                s_shared_memory_pool.in_use = false;
+            }
+        }
+        bool taken;
+    } shared_memory_pool_guard{m_share_memory_pool && bind_shared_memory_pool(id)};
+
+    struct SharedScratchpadsGuard
+    {
+        ~SharedScratchpadsGuard()
+        {
+            if (taken)
+            {
+                release_shared_scratchpads(arena);
+            }
+        }
+        bool taken;
+        int arena;
+    } shared_scratchpads_guard{bind_scratchpads(id), m_ctx_vec[id]->arena};
 
     // Invoke compiled computation
     if (!m_external_function->is_direct_execution())
     {
+        // Generated code runs as one unit, so it waits for all streamed inputs
+        for (auto& fence : m_ctx_vec[id]->input_fences)
+        {
+            if (fence)
+            {
+                fence->wait();
+            }
+        }
         m_compiled_function(inputs.data(), outputs.data(), m_ctx_vec[id], cg_ctx);
     }
     else
@@ -109,200 +309,713 @@ void runtime::cpu::CPU_CallFrame::inner_call(
 
     if (runtime::cpu::IsTracingEnabled())
     {
+        const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
         GenerateTimeline(m_external_function->get_op_attrs(),
                          m_ctx_vec[id]->op_durations,
-                         m_external_function->get_function_name() + ".timeline.json");
+                         m_external_function->get_function_name() + ".timeline.json",
+                         mkldnn_emitter->get_max_scratchpad_size(),
+                         mkldnn_emitter->get_workspace_bytes());
     }
 }
 
-void runtime::cpu::CPU_CallFrame::call(
-    const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
-    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
+size_t runtime::cpu::CPU_CallFrame::acquire_context(size_t preferred)
 {
-    size_t id = 0;
-    auto disable_caching = false;
+    runtime::metrics::ScopedTimer timer(get_context_metrics().wait_seconds);
+    if (preferred < m_num_ctx.load(std::memory_order_acquire))
     {
-        std::unique_lock<std::mutex> lck(m_mutex);
-        while (m_num_ctx_available == 0)
+        bool busy = false;
+        if (m_ctx_busy[preferred].compare_exchange_strong(busy, true, std::memory_order_acquire))
         {
-            m_cv.wait(lck);
+            return preferred;
         }
+    }
+    while (true)
+    {
+        size_t num_ctx = m_num_ctx.load(std::memory_order_acquire);
+        for (size_t i = 0; i < num_ctx; i++)
+        {
+            bool busy = false;
+            if (m_ctx_busy[i].compare_exchange_strong(busy, true, std::memory_order_acquire))
+            {
+                return i;
+            }
+        }
+
+        // Every context is in use; grow the pool by one if the cap allows it. The new
+        // slot is already marked busy, so it belongs to this thread once published.
+        if (num_ctx < m_max_ctx &&
+            m_num_ctx.compare_exchange_strong(num_ctx, num_ctx + 1, std::memory_order_acq_rel))
+        {
+            m_ctx_vec[num_ctx] = create_runtime_context(num_ctx);
+            return num_ctx;
+        }
+
+        if (num_ctx == m_max_ctx)
+        {
+            // Sleep until release_context frees a context. Waiters are counted before the
+            // flags are checked, so a release either sees the count or frees a flag seen here.
+            std::unique_lock<std::mutex> lock(m_ctx_mutex);
+            m_ctx_waiters.fetch_add(1);
+            m_ctx_released.wait(lock, [this, num_ctx]() {
+                for (size_t i = 0; i < num_ctx; i++)
+                {
+                    if (!m_ctx_busy[i].load())
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            });
+            m_ctx_waiters.fetch_sub(1);
+        }
+    }
+}
 
-        for (size_t i = 0; i < m_num_ctx; i++)
+void runtime::cpu::CPU_CallFrame::set_call_arena(size_t id, int slot)
+{
+    auto ctx = m_ctx_vec[id];
+    ctx->scheduled = slot >= 0;
+    ctx->arena = slot >= 0 ? slot : get_default_arena(id);
+}
+
+int runtime::cpu::CPU_CallFrame::get_default_arena(size_t id) const
+{
+    auto& cpu_executor = executor::GetCPUExecutor();
+    int num_thread_pools = cpu_executor.get_num_thread_pools();
+    if (m_external_function->m_numa_node >= 0)
+    {
+        vector<int> node_pools;
+        for (int pool = 0; pool < num_thread_pools; pool++)
         {
-            if (m_id_pool[i])
+            if (cpu_executor.get_numa_node(pool) == m_external_function->m_numa_node)
             {
-                id = i;
-                break;
+                node_pools.push_back(pool);
             }
         }
-        NGRAPH_CHECK(id != m_num_ctx);
-        m_id_pool[id] = false;
-        if (id != m_prev_ctx)
+        if (!node_pools.empty())
         {
-            // Disable caching since staleness hints are no longer
-            // applicable to this context
-            disable_caching = true;
+            return node_pools[id % node_pools.size()];
         }
-        m_prev_ctx = id;
-        m_num_ctx_available--;
     }
+    return static_cast<int>(id % num_thread_pools);
+}
 
-    m_ctx_vec[id]->pc = 0;
-    propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
-    inner_call(output_tvs, input_tvs, id, disable_caching);
+void runtime::cpu::CPU_CallFrame::set_scheduling(size_t weight, int priority, size_t max_queued)
+{
+    m_scheduling_client = make_shared<CPU_CallScheduler::Client>(weight, priority);
+    m_max_queued_calls = max_queued;
+}
 
-    m_mutex.lock();
-    m_id_pool[id] = true;
-    m_num_ctx_available++;
-    m_mutex.unlock();
-    m_cv.notify_one();
+bool runtime::cpu::CPU_CallFrame::bind_shared_memory_pool(size_t id)
+{
+    auto ctx = m_ctx_vec[id];
+    size_t size = m_external_function->get_memory_buffer_sizes().at(0);
+    size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
+    auto& pool = s_shared_memory_pool;
+    if (pool.in_use)
+    {
+        auto& own_pool = m_own_memory_pools[id];
+        if (!own_pool)
+        {
+            own_pool.reset(new AlignedBuffer(size, alignment, m_allocator));
+        }
+        ctx->memory_buffers[0] = own_pool.get();
+        return false;
+    }
+    if (!pool.buffer || pool.buffer->size() < size)
+    {
+        // Free the smaller pool first
+        pool.buffer.reset();
+        pool.buffer.reset(new AlignedBuffer(size, alignment));
+    }
+    pool.in_use = true;
+    ctx->memory_buffers[0] = pool.buffer.get();
+    return true;
 }
 
-void runtime::cpu::CPU_CallFrame::propagate_layouts(
-    const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
-    const LayoutDescriptorPtrs& layouts) const
+bool runtime::cpu::CPU_CallFrame::bind_scratchpads(size_t id)
 {
-    if (layouts.size() != tvs.size())
+    if (!m_external_function->is_direct_execution())
     {
-        throw ngraph_error(
-            "Error propagating layouts - tensor and layout descriptor counts do not match");
+        return false;
     }
-    for (size_t i = 0; i < tvs.size(); i++)
+    size_t size = m_external_function->get_mkldnn_emitter()->get_max_scratchpad_size();
+    if (size == 0)
     {
-        if (layouts[i] == nullptr)
+        return false;
+    }
+    auto ctx = m_ctx_vec[id];
+    size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
+    auto& cpu_executor = executor::GetCPUExecutor();
+    size_t num_workers = m_external_function->uses_inter_op_scheduler()
+                             ? cpu_executor.get_num_thread_pools() - 1
+                             : 0;
+    auto new_scratchpad = [&](Allocator* allocator) -> AlignedBuffer* {
+        auto buffer = new AlignedBuffer(size, alignment, allocator);
+        if (numa::is_enabled())
         {
-            throw ngraph_error(
-                "Error propagating layouts - layout information missing from tensor");
+            numa::bind_memory_to_node(
+                buffer->get_ptr(), size, cpu_executor.get_numa_node(ctx->arena));
         }
-        tvs[i]->set_tensor_layout(layouts[i]);
+        return buffer;
+    };
+
+    {
+        std::lock_guard<std::mutex> lock(s_scratchpad_mutex);
+        if (s_shared_scratchpads.size() <= static_cast<size_t>(ctx->arena))
+        {
+            s_shared_scratchpads.resize(ctx->arena + 1);
+        }
+        auto& shared = s_shared_scratchpads[ctx->arena];
+        if (!shared.in_use)
+        {
+            if (!shared.buffer || shared.buffer->size() < size)
+            {
+                // Free the smaller scratchpads first
+                shared.buffer.reset();
+                shared.workers.clear();
+                shared.buffer.reset(new_scratchpad(nullptr));
+            }
+            while (shared.workers.size() < num_workers)
+            {
+                shared.workers.emplace_back(new_scratchpad(nullptr));
+            }
+            shared.in_use = true;
+            ctx->scratchpad_buffer = shared.buffer.get();
+            ctx->worker_scratchpads.clear();
+            for (size_t i = 0; i < num_workers; i++)
+            {
+                ctx->worker_scratchpads.push_back(shared.workers[i].get());
+            }
+            return true;
+        }
+    }
+
+    // Another call on the arena holds the shared scratchpads, e.g. the caller of a nested
+    // call or an unscheduled call that landed on the same arena
+    auto& own = m_own_scratchpads[id];
+    if (own.empty())
+    {
+        for (size_t i = 0; i <= num_workers; i++)
+        {
+            own.emplace_back(new_scratchpad(m_allocator));
+        }
+    }
+    ctx->scratchpad_buffer = own[0].get();
+    ctx->worker_scratchpads.clear();
+    for (size_t i = 1; i < own.size(); i++)
+    {
+        ctx->worker_scratchpads.push_back(own[i].get());
     }
+    return false;
 }
 
-void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
+size_t runtime::cpu::CPU_CallFrame::get_scratchpad_bytes() const
 {
-    for (size_t i = 0; i < m_num_ctx; i++)
+    if (!m_external_function->is_direct_execution())
     {
-        m_id_pool[i] = true;
-        auto ctx = new CPURuntimeContext;
-        m_ctx_vec.push_back(ctx);
+        return 0;
+    }
+    size_t num_workers = m_external_function->uses_inter_op_scheduler()
+                             ? executor::GetCPUExecutor().get_num_thread_pools() - 1
+                             : 0;
+    return m_external_function->get_mkldnn_emitter()->get_max_scratchpad_size() *
+           (num_workers + 1);
+}
 
-        ctx->pc = 0;
-        ctx->op_durations = nullptr;
-        if (runtime::cpu::IsTracingEnabled())
+size_t runtime::cpu::CPU_CallFrame::get_context_overhead_bytes() const
+{
+    size_t bytes = sizeof(CPURuntimeContext);
+    bytes += m_external_function->get_buffer_size() * sizeof(void*);
+    bytes += m_external_function->get_parameter_layout_descriptors().size() * sizeof(bool);
+    if (runtime::cpu::IsTracingEnabled())
+    {
+        bytes += m_external_function->get_op_attrs().size() * sizeof(int64_t);
+    }
+    if (m_external_function->is_direct_execution())
+    {
+        const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
+        bytes += (mkldnn_emitter->get_mkldnn_primitives().size() +
+                  mkldnn_emitter->get_mkldnn_memories().size() +
+                  mkldnn_emitter->get_mkldnn_scratchpad_mds().size()) *
+                 sizeof(void*);
+    }
+    return bytes;
+}
+
+void runtime::cpu::CPU_CallFrame::release_context(size_t id)
+{
+    m_ctx_busy[id].store(false);
+    get_context_metrics().busy.add(-1);
+    if (m_ctx_waiters.load() > 0)
+    {
+        // Taking the mutex orders the notification after a waiter's check of the flags
+        std::lock_guard<std::mutex> lock(m_ctx_mutex);
+        m_ctx_released.notify_one();
+    }
+}
+
+void runtime::cpu::CPU_CallFrame::call(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs,
+    const CancellationToken* cancellation)
+{
+    if (auto stage = find_pipeline_stage(output_tvs, input_tvs))
+    {
+        call_bound(*stage, cancellation);
+        return;
+    }
+
+    ScheduledSlot scheduled(*m_scheduling_client, m_max_queued_calls);
+    size_t id = acquire_context();
+    get_context_metrics().busy.add(1);
+    set_call_arena(id, scheduled.slot);
+
+    // Disable caching if the staleness hints were recorded against a different context, or
+    // the context last ran a pipeline stage
+    auto disable_caching = m_prev_ctx.exchange(id, std::memory_order_relaxed) != id ||
+                           m_ctx_binding[id] != 0;
+    m_ctx_binding[id] = 0;
+
+    m_ctx_vec[id]->pc = 0;
+    m_ctx_vec[id]->cancellation = cancellation;
+    set_input_fences(m_ctx_vec[id], input_tvs);
+    try
+    {
+        propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
+        inner_call(output_tvs, input_tvs, id, disable_caching);
+    }
+    catch (...)
+    {
+        m_ctx_vec[id]->cancellation = nullptr;
+        m_ctx_vec[id]->input_fences.clear();
+        m_ctx_binding[id] = s_unfinished_call;
+        release_context(id);
+        throw;
+    }
+    m_ctx_vec[id]->cancellation = nullptr;
+    m_ctx_vec[id]->input_fences.clear();
+    release_context(id);
+}
+
+void runtime::cpu::CPU_CallFrame::call_nested(CPURuntimeContext* caller,
+                                              void* memory_pool,
+                                              vector<void*>& inputs,
+                                              vector<void*>& outputs)
+{
+    size_t id = acquire_context(0);
+    get_context_metrics().busy.add(1);
+    struct ContextGuard
+    {
+        ~ContextGuard() { call_frame->release_context(id); }
+        CPU_CallFrame* call_frame;
+        size_t id;
+    } context_guard{this, id};
+
+    auto ctx = m_ctx_vec[id];
+    if (!ctx->memory_buffers.empty())
+    {
+        auto& pool = m_nested_memory_pools[id];
+        if (!pool || pool->get_ptr() != memory_pool)
         {
-            ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
+            pool.reset(new MemoryPoolView(memory_pool,
+                                          m_external_function->get_memory_buffer_sizes()[0]));
         }
-        ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
+        ctx->memory_buffers[0] = pool.get();
+    }
+    // The caller may have written new values to the same pointers
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        ctx->p_en[i] = true;
+    }
+    ctx->io_binding = 0;
+    ctx->pc = 0;
+    ctx->arena = caller->arena;
+    ctx->scheduled = caller->scheduled;
+    ctx->cancellation = caller->cancellation;
+
+    struct SharedScratchpadsGuard
+    {
+        ~SharedScratchpadsGuard()
+        {
+            if (taken)
+            {
+                release_shared_scratchpads(arena);
+            }
+        }
+        bool taken;
+        int arena;
+    } shared_scratchpads_guard{bind_scratchpads(id), ctx->arena};
 
-        ctx->first_iteration = true;
+    m_external_function->get_executor()(ctx, inputs, outputs);
+}
 
-        ctx->buffer_data = std::vector<void*>(m_external_function->get_buffer_size());
+void runtime::cpu::CPU_CallFrame::call_bound(CPU_TensorBinding& binding,
+                                             const CancellationToken* cancellation)
+{
+    ScheduledSlot scheduled(*m_scheduling_client, m_max_queued_calls);
+    size_t id = acquire_context(binding.last_ctx.load(std::memory_order_relaxed));
+    get_context_metrics().busy.add(1);
+    set_call_arena(id, scheduled.slot);
+    binding.last_ctx.store(id, std::memory_order_relaxed);
 
-        // Create temporary buffer pools
-        size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
-        for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
+    // Values cached in the context are only valid for the binding that computed them
+    auto ctx = m_ctx_vec[id];
+    bool disable_caching = m_ctx_binding[id] != binding.id || m_share_memory_pool;
+    m_ctx_binding[id] = binding.id;
+    for (size_t i = 0; i < binding.inputs.size(); i++)
+    {
+        ctx->p_en[i] = disable_caching || binding.inputs[i]->get_stale();
+    }
+    ctx->io_binding = binding.id;
+    ctx->pc = 0;
+    ctx->cancellation = cancellation;
+    set_input_fences(ctx, binding.inputs);
+    try
+    {
+        run_context(id, binding.input_ptrs, binding.output_ptrs);
+    }
+    catch (...)
+    {
+        ctx->cancellation = nullptr;
+        ctx->input_fences.clear();
+        m_ctx_binding[id] = s_unfinished_call;
+        release_context(id);
+        throw;
+    }
+    ctx->cancellation = nullptr;
+    ctx->input_fences.clear();
+    release_context(id);
+}
+
+shared_ptr<runtime::cpu::CPU_TensorBinding> runtime::cpu::CPU_CallFrame::bind(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
+{
+    propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
+    auto binding = make_shared<CPU_TensorBinding>();
+    binding->inputs = input_tvs;
+    binding->outputs = output_tvs;
+    resolve_binding(*binding);
+    std::lock_guard<std::mutex> lock(m_pipeline_mutex);
+    binding->id = m_next_binding++;
+    return binding;
+}
+
+void runtime::cpu::CPU_CallFrame::resolve_binding(CPU_TensorBinding& binding)
+{
+    binding.input_ptrs.clear();
+    binding.output_ptrs.clear();
+    for (auto& input : binding.inputs)
+    {
+        binding.input_ptrs.push_back(
+            input ? static_pointer_cast<runtime::cpu::CPUTensorView>(input)->get_data_ptr()
+                  : nullptr);
+    }
+    for (auto& output : binding.outputs)
+    {
+        binding.output_ptrs.push_back(
+            output ? static_pointer_cast<runtime::cpu::CPUTensorView>(output)->get_data_ptr()
+                   : nullptr);
+    }
+}
+
+shared_ptr<runtime::cpu::CPU_TensorBinding>
+    runtime::cpu::CPU_CallFrame::find_pipeline_stage(
+        const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
+        const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
+{
+    auto stages = atomic_load(&m_pipeline_stages);
+    if (!stages)
+    {
+        return nullptr;
+    }
+    for (auto& stage : *stages)
+    {
+        if (stage && stage->inputs == input_tvs && stage->outputs == output_tvs)
         {
-            auto buffer = new AlignedBuffer(buffer_size, alignment, allocator);
-            ctx->memory_buffers.push_back(buffer);
+            return stage;
         }
-        const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
-        // Create scratchpad
-        auto scratchpad_size = mkldnn_emitter->get_max_scratchpad_size();
-        if (m_external_function->is_direct_execution())
-        {
-            ctx->mkldnn_primitives =
-                std::vector<mkldnn::primitive*>(mkldnn_emitter->get_mkldnn_primitives().size());
-            ctx->mkldnn_memories =
-                std::vector<mkldnn::memory*>(mkldnn_emitter->get_mkldnn_memories().size());
-            ctx->mkldnn_scratchpad_mds = std::vector<mkldnn::memory::desc*>(
-                mkldnn_emitter->get_mkldnn_scratchpad_mds().size());
-            if (scratchpad_size > 0)
+    }
+    return nullptr;
+}
+
+void runtime::cpu::CPU_CallFrame::set_pipeline_input(size_t stage,
+                                                     size_t index,
+                                                     const shared_ptr<runtime::Tensor>& tensor)
+{
+    set_pipeline_tensor(stage, index, tensor, true);
+}
+
+void runtime::cpu::CPU_CallFrame::set_pipeline_output(size_t stage,
+                                                      size_t index,
+                                                      const shared_ptr<runtime::Tensor>& tensor)
+{
+    const auto& layouts = m_external_function->get_result_layout_descriptors();
+    NGRAPH_CHECK(index < layouts.size(), "Pipeline output ", index, " does not exist");
+    propagate_layouts({tensor}, {layouts[index]});
+    set_pipeline_tensor(stage, index, tensor, false);
+}
+
+void runtime::cpu::CPU_CallFrame::set_pipeline_tensor(size_t stage,
+                                                      size_t index,
+                                                      const shared_ptr<runtime::Tensor>& tensor,
+                                                      bool is_input)
+{
+    std::lock_guard<std::mutex> lock(m_pipeline_mutex);
+    auto stages = m_pipeline_stages ? make_shared<PipelineStages>(*m_pipeline_stages)
+                                    : make_shared<PipelineStages>();
+    if (stages->size() <= stage)
+    {
+        stages->resize(stage + 1);
+    }
+
+    // Calls may be running on the current stage, so it is replaced by an updated copy
+    auto updated = make_shared<CPU_TensorBinding>();
+    updated->id = m_next_binding++;
+    if (auto& current = stages->at(stage))
+    {
+        updated->inputs = current->inputs;
+        updated->outputs = current->outputs;
+        updated->last_ctx.store(current->last_ctx.load());
+    }
+    else
+    {
+        updated->inputs.resize(m_external_function->get_parameter_layout_descriptors().size());
+        updated->outputs.resize(m_external_function->get_result_layout_descriptors().size());
+    }
+    auto& tensors = is_input ? updated->inputs : updated->outputs;
+    NGRAPH_CHECK(index < tensors.size(),
+                 "Pipeline ",
+                 is_input ? "input " : "output ",
+                 index,
+                 " does not exist");
+    tensors[index] = tensor;
+
+    resolve_binding(*updated);
+    stages->at(stage) = updated;
+    atomic_store(&m_pipeline_stages, shared_ptr<const PipelineStages>(stages));
+}
+
+std::future<bool> runtime::cpu::CPU_CallFrame::call_async(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs,
+    std::function<void(bool)> callback)
+{
+    auto promise = make_shared<std::promise<bool>>();
+    auto rc = promise->get_future();
+    executor::GetCPUExecutor().schedule_request([this, output_tvs, input_tvs, callback, promise]() {
+        bool ok = false;
+        std::exception_ptr error;
+        try
+        {
+            call(output_tvs, input_tvs);
+            ok = true;
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        // An exception escaping into the executor's worker would terminate the process, so
+        // one thrown by the callback goes to the future unless the call already failed
+        if (callback)
+        {
+            try
             {
-                ctx->scratchpad_buffer = new AlignedBuffer(scratchpad_size, alignment, allocator);
+                callback(ok);
             }
-            else
+            catch (...)
             {
-                ctx->scratchpad_buffer = nullptr;
+                if (!error)
+                {
+                    error = std::current_exception();
+                }
             }
         }
+        if (error)
+        {
+            promise->set_exception(error);
+        }
         else
         {
-            // single thread for codegen
-            NGRAPH_CHECK(m_num_ctx == 1);
+            promise->set_value(true);
         }
+    });
+    return rc;
+}
 
-        ctx->states = m_external_function->m_states.data();
-#if defined(NGRAPH_TBB_ENABLE)
-        if (m_external_function->is_direct_execution() &&
-            std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+void runtime::cpu::CPU_CallFrame::propagate_layouts(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
+    const LayoutDescriptorPtrs& layouts) const
+{
+    if (layouts.size() != tvs.size())
+    {
+        throw ngraph_error(
+            "Error propagating layouts - tensor and layout descriptor counts do not match");
+    }
+    for (size_t i = 0; i < tvs.size(); i++)
+    {
+        if (layouts[i] == nullptr)
+        {
+            throw ngraph_error(
+                "Error propagating layouts - layout information missing from tensor");
+        }
+        // Tensors created in the result layout, such as pooled ones, already have it
+        if (tvs[i]->get_tensor_layout() != layouts[i])
         {
-            // For codegen mode, graph and global control are now part of the code generated
-            // CPURuntimeContextCG class.
-            ctx->G = new tbb::flow::graph;
-            const auto envParallelism = std::getenv("NGRAPH_INTER_OP_PARALLELISM");
-            const auto parallelism = envParallelism == nullptr ? 1 : std::atoi(envParallelism);
-            ctx->c =
-                new tbb::global_control(tbb::global_control::max_allowed_parallelism, parallelism);
+            tvs[i]->set_tensor_layout(layouts[i]);
         }
-#endif
     }
-    m_num_ctx_available = m_num_ctx;
 }
 
-void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
+runtime::cpu::CPURuntimeContext* runtime::cpu::CPU_CallFrame::create_runtime_context(size_t id)
 {
-    for (size_t i = 0; i < m_num_ctx; i++)
+    auto ctx = new CPURuntimeContext;
+    get_context_metrics().contexts.add(1);
+
+    ctx->pc = 0;
+    // Spread concurrent contexts over the executor's thread pools
+    auto& cpu_executor = executor::GetCPUExecutor();
+    ctx->arena = get_default_arena(id);
+    ctx->scheduled = false;
+    auto numa_node = cpu_executor.get_numa_node(ctx->arena);
+    ctx->op_durations = nullptr;
+    if (runtime::cpu::IsTracingEnabled())
     {
-        auto ctx = m_ctx_vec.back();
-        m_ctx_vec.pop_back();
+        ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
+    }
+    ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
+
+    ctx->first_iteration = true;
 
-        delete[] ctx->op_durations;
-        delete[] ctx->p_en;
-        for (auto p : ctx->mkldnn_primitives)
+    ctx->buffer_data = std::vector<void*>(m_external_function->get_buffer_size());
+    ctx->bound_memory_pool = nullptr;
+    ctx->io_binding = 0;
+    ctx->bound_io_binding = 0;
+    ctx->constants_version = 0;
+    ctx->cancellation = nullptr;
+
+    // Create temporary buffer pools
+    size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
+    for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
+    {
+        if (m_share_memory_pool)
         {
-            delete p;
+            // Bound to a shared or own pool on each call
+            ctx->memory_buffers.push_back(nullptr);
+            continue;
         }
-        for (auto m : ctx->mkldnn_memories)
+        auto buffer = new AlignedBuffer(buffer_size, alignment, m_allocator);
+        if (numa::is_enabled())
         {
-            delete m;
+            numa::bind_memory_to_node(buffer->get_ptr(), buffer->size(), numa_node);
         }
+        ctx->memory_buffers.push_back(buffer);
+    }
+    const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
+    if (m_external_function->is_direct_execution())
+    {
+        ctx->mkldnn_primitives =
+            std::vector<mkldnn::primitive*>(mkldnn_emitter->get_mkldnn_primitives().size());
+        ctx->mkldnn_memories =
+            std::vector<mkldnn::memory*>(mkldnn_emitter->get_mkldnn_memories().size());
+        ctx->mkldnn_scratchpad_mds = std::vector<mkldnn::memory::desc*>(
+            mkldnn_emitter->get_mkldnn_scratchpad_mds().size());
+        // Bound to the arena's shared scratchpads or own ones on each call
+        ctx->scratchpad_buffer = nullptr;
+    }
+
+    ctx->states = m_external_function->m_states.data();
+    ctx->distributed_requests = std::vector<DistributedRequest*>(
+        m_external_function->m_distributed_request_indices.size());
+#if defined(NGRAPH_TBB_ENABLE)
+    if (m_external_function->is_direct_execution() &&
+        std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+    {
+        // For codegen mode, graph and global control are now part of the code generated
+        // CPURuntimeContextCG class.
+        ctx->G = new tbb::flow::graph;
+        const auto envParallelism = std::getenv("NGRAPH_INTER_OP_PARALLELISM");
+        const auto parallelism = envParallelism == nullptr ? 1 : std::atoi(envParallelism);
+        ctx->c = new tbb::global_control(tbb::global_control::max_allowed_parallelism, parallelism);
+    }
+#endif
+    return ctx;
+}
+
+void runtime::cpu::CPU_CallFrame::destroy_runtime_context(CPURuntimeContext* ctx)
+{
+    get_context_metrics().contexts.add(-1);
+    delete[] ctx->op_durations;
+    delete[] ctx->p_en;
+    for (auto p : ctx->mkldnn_primitives)
+    {
+        delete p;
+    }
+    for (auto m : ctx->mkldnn_memories)
+    {
+        delete m;
+    }
+    if (!m_share_memory_pool)
+    {
         for (auto buffer : ctx->memory_buffers)
         {
             delete buffer;
         }
-        for (auto s : ctx->mkldnn_scratchpad_mds)
+    }
+    for (auto s : ctx->mkldnn_scratchpad_mds)
+    {
+        delete s;
+    }
+    // Requests are only left behind by a call that threw; deleting them waits for completion
+    for (auto request : ctx->distributed_requests)
+    {
+        delete request;
+    }
+
+#if defined(NGRAPH_TBB_ENABLE)
+    if (m_external_function->is_direct_execution() &&
+        std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+    {
+        // For codegen mode, graph and global control are now part of a code generated
+        // CPURuntimeContext class.
+
+        // delete graph G and nodes in G
+        ctx->G->wait_for_all();
+        std::vector<tbb::flow::graph_node*> to_be_deleted;
+        for (auto it = ctx->G->begin(); it != ctx->G->end(); it++)
         {
-            delete s;
+            to_be_deleted.push_back(&(*it));
         }
-        if (m_external_function->is_direct_execution())
+        delete ctx->G;
+        for (auto node : to_be_deleted)
         {
-            delete ctx->scratchpad_buffer;
+            delete node;
         }
+        delete ctx->c;
+    }
+#endif
+    delete ctx;
+}
 
-#if defined(NGRAPH_TBB_ENABLE)
-        if (m_external_function->is_direct_execution() &&
-            std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
+{
+    size_t num_ctx = m_num_ctx.load();
+    for (size_t i = 0; i < num_ctx; i++)
+    {
+        if (m_ctx_vec[i] != nullptr)
         {
-            // For codegen mode, graph and global control are now part of a code generated
-            // CPURuntimeContext class.
-
-            // delete graph G and nodes in G
-            ctx->G->wait_for_all();
-            std::vector<tbb::flow::graph_node*> to_be_deleted;
-            for (auto it = ctx->G->begin(); it != ctx->G->end(); it++)
-            {
-                to_be_deleted.push_back(&(*it));
-            }
-            delete ctx->G;
-            for (auto node : to_be_deleted)
-            {
-                delete node;
-            }
-            delete ctx->c;
+            destroy_runtime_context(m_ctx_vec[i]);
+            m_ctx_vec[i] = nullptr;
         }
-#endif
-        delete ctx;
+        m_ctx_busy[i] = true;
+    }
+    for (auto& own_pool : m_own_memory_pools)
+    {
+        own_pool.reset();
+    }
+    for (auto& own_scratchpads : m_own_scratchpads)
+    {
+        own_scratchpads.clear();
     }
-    m_num_ctx_available = 0;
 }
@@ -16,15 +16,21 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <functional>
+#include <future>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
 
 #include "ngraph/function.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/allocator.hpp"
+#include "ngraph/runtime/cancellation.hpp"
+#include "ngraph/runtime/cpu/cpu_call_scheduler.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
 #include "ngraph/runtime/tensor.hpp"
@@ -51,29 +57,117 @@ namespace ngraph
             using DestroyContextFuncCG = std::function<DestroyContextFuncTy>;
             using EntryPoint = std::function<EntryPointTy>;
 
+            /// \brief Tensors bound to a call frame with their data pointers resolved, as made
+            ///        by CPU_CallFrame::bind and for each pipeline stage
+            struct CPU_TensorBinding
+            {
+                // Identifies these tensors in CPURuntimeContext::io_binding, never 0
+                size_t id;
+                std::vector<std::shared_ptr<runtime::Tensor>> inputs;
+                std::vector<std::shared_ptr<runtime::Tensor>> outputs;
+                std::vector<void*> input_ptrs;
+                std::vector<void*> output_ptrs;
+                std::atomic<size_t> last_ctx{0};
+            };
+
             // Compile and execute graphs
             class CPU_CallFrame
             {
             public:
                 friend class CPU_Debugger;
 
+                /// \param max_concurrency Upper bound on the number of runtime contexts the
+                ///        call frame may grow to. 0 selects the default, which is the number
+                ///        of hardware threads.
                 CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction> external_function,
                               InitContextFuncCG compiled_init_ctx_func,
                               DestroyContextFuncCG compiled_destroy_ctx_func,
                               EntryPoint compiled_function,
-                              runtime::Allocator* allocator);
+                              runtime::Allocator* allocator,
+                              size_t max_concurrency = 0);
                 ~CPU_CallFrame();
 
                 /// \brief Invoke the function with values matching the signature of the function.
                 ///
                 /// Tuples will be expanded into their tensor views to build the call frame.
+                /// \param cancellation If set, the call throws call_cancelled between ops once
+                ///        the token is cancelled
                 void call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
-                          const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+                          const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                          const CancellationToken* cancellation = nullptr);
+
+                /// \brief Queue an invocation of the function on the executor's request pool.
+                ///
+                /// The returned future becomes ready once the call has run; exceptions thrown
+                /// by the call are stored in the future. The optional callback runs on the
+                /// request thread right before the future is made ready.
+                std::future<bool>
+                    call_async(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                               const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                               std::function<void(bool)> callback);
+
+                /// \brief Bind the function to these tensors for repeated calls with call_bound.
+                ///
+                /// The tensors must already be validated against the function; their layouts
+                /// and data pointers are set up here instead of on every call.
+                std::shared_ptr<CPU_TensorBinding>
+                    bind(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                         const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+                /// \brief Invoke the function on bound tensors.
+                ///
+                /// The call first tries the runtime context the binding ran on last, and binds
+                /// the tensors to the context again only if it ran other tensors in between.
+                /// Calls on one binding must not overlap.
+                void call_bound(CPU_TensorBinding& binding,
+                                const CancellationToken* cancellation = nullptr);
+
+                /// \brief Invoke the function from an op of the call running on `caller`; see
+                ///        CPU_NestedFunction.
+                ///
+                /// The call runs on the calling thread and in the arena of `caller`, uses the
+                /// data pointers as they are and places the intermediates at `memory_pool`,
+                /// which holds the first of the function's memory buffer sizes.
+                void call_nested(CPURuntimeContext* caller,
+                                 void* memory_pool,
+                                 std::vector<void*>& inputs,
+                                 std::vector<void*>& outputs);
+
+                /// \brief Make `tensor` input `index` of pipeline stage `stage`.
+                ///
+                /// Once every input and output of a stage is set, a call with exactly the
+                /// stage's tensors goes through call_bound. Calls on one stage must not
+                /// overlap.
+                void set_pipeline_input(size_t stage,
+                                        size_t index,
+                                        const std::shared_ptr<runtime::Tensor>& tensor);
+                /// \brief Make `tensor` output `index` of pipeline stage `stage`
+                void set_pipeline_output(size_t stage,
+                                         size_t index,
+                                         const std::shared_ptr<runtime::Tensor>& tensor);
+
+                /// \brief Sets how calls are admitted while the call scheduler is enabled.
+                ///        Must not be called while calls are running.
+                /// \param weight Share of the thread pools relative to other executables of
+                ///        the same priority
+                /// \param priority Calls of higher priority are admitted first
+                /// \param max_queued Calls fail instead of waiting once this many calls are
+                ///        queued; 0 for no bound
+                void set_scheduling(size_t weight, int priority, size_t max_queued);
+
+                /// \returns The runtime contexts created so far
+                size_t get_context_count() const { return m_num_ctx.load(); }
+                /// \returns The runtime contexts the call frame may grow to
+                size_t get_max_context_count() const { return m_max_ctx; }
+                /// \returns The bytes of the MKLDNN scratchpads a call uses, on its own thread
+                ///          and on the inter-op workers
+                size_t get_scratchpad_bytes() const;
+                /// \returns The bytes of the bookkeeping of one runtime context
+                size_t get_context_overhead_bytes() const;
 
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
 
-                void setup_runtime_context(runtime::Allocator* allocator);
                 void setup_cg_runtime_context();
                 void cleanup_runtime_context();
 
@@ -87,15 +181,93 @@ namespace ngraph
                                 const size_t id,
                                 const bool disable_caching = true);
 
+                using PipelineStages = std::vector<std::shared_ptr<CPU_TensorBinding>>;
+
+                void set_pipeline_tensor(size_t stage,
+                                         size_t index,
+                                         const std::shared_ptr<runtime::Tensor>& tensor,
+                                         bool is_input);
+                /// \returns the complete pipeline stage with exactly these tensors, if any
+                std::shared_ptr<CPU_TensorBinding> find_pipeline_stage(
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+                /// \brief Resolves the data pointers of the binding's tensors
+                void resolve_binding(CPU_TensorBinding& binding);
+
+                /// \brief Points context `id` at thread pool `slot` granted by the call
+                ///        scheduler, or at its own pool if `slot` is negative
+                void set_call_arena(size_t id, int slot);
+                /// \returns the thread pool context `id` runs on outside the call scheduler.
+                ///          Contexts are spread over the pools of the function's NUMA node,
+                ///          if it has one, or over all pools.
+                int get_default_arena(size_t id) const;
+
+                /// \brief Runs the function on context `id`, whose inputs are already bound
+                void run_context(size_t id,
+                                 std::vector<void*>& inputs,
+                                 std::vector<void*>& outputs);
+
+                CPURuntimeContext* create_runtime_context(size_t id);
+                void destroy_runtime_context(CPURuntimeContext* ctx);
+
+                /// \brief Points the context at the intermediate pool shared by the call frames
+                ///        running on this thread, or at its own pool if another call frame on
+                ///        this thread holds the shared one. Returns true if it took the shared
+                ///        pool.
+                bool bind_shared_memory_pool(size_t id);
+
+                /// \brief Points the context at the MKLDNN scratchpads shared by the calls on its
+                ///        arena, or at scratchpads of its own while another call holds them.
+                ///        Returns true if it took the shared scratchpads.
+                bool bind_scratchpads(size_t id);
+
+                /// \brief Claim a free runtime context, creating a new one if every existing
+                ///        context is busy and the cap has not been reached. Context `preferred`
+                ///        is tried first.
+                size_t acquire_context(size_t preferred = std::numeric_limits<size_t>::max());
+                void release_context(size_t id);
+
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
+                runtime::Allocator* m_allocator;
 
-                std::mutex m_mutex;
-                std::condition_variable m_cv;
-                volatile size_t m_num_ctx_available = 0;
-                size_t m_prev_ctx = 0;
-                size_t m_num_ctx = 1;
-                std::unordered_map<size_t, bool> m_id_pool;
+                // Contexts are claimed by flipping their busy flag with a CAS; slots past
+                // m_num_ctx are pre-marked busy so a newly published slot is owned by the
+                // thread that grew the pool until it releases it.
+                size_t m_max_ctx = 1;
+                std::atomic<size_t> m_num_ctx{0};
+                std::atomic<size_t> m_prev_ctx{0};
+                std::unique_ptr<std::atomic<bool>[]> m_ctx_busy;
                 std::vector<CPURuntimeContext*> m_ctx_vec;
+                // Callers that found every context busy with the pool at its cap sleep on
+                // m_ctx_released until a context is released
+                std::mutex m_ctx_mutex;
+                std::condition_variable m_ctx_released;
+                std::atomic<size_t> m_ctx_waiters{0};
+
+                // io_binding of the last call on each context, which owns its cached values
+                std::vector<size_t> m_ctx_binding;
+
+                // Replaced as a whole under m_pipeline_mutex and read with atomic_load, so that
+                // calls do not lock
+                std::mutex m_pipeline_mutex;
+                std::shared_ptr<const PipelineStages> m_pipeline_stages;
+                // Next CPU_TensorBinding::id, taken under m_pipeline_mutex
+                size_t m_next_binding = 1;
+
+                // Admission of calls by the call scheduler
+                std::shared_ptr<CPU_CallScheduler::Client> m_scheduling_client =
+                    std::make_shared<CPU_CallScheduler::Client>(1, 0);
+                size_t m_max_queued_calls = 0;
+
+                // Intermediates come from a per-thread pool instead of one pool per context
+                bool m_share_memory_pool = false;
+                // Pools used by each context when the shared pool is taken by an enclosing call
+                std::vector<std::unique_ptr<AlignedBuffer>> m_own_memory_pools;
+                // The regions of the callers' pools each context last ran nested calls in
+                std::vector<std::unique_ptr<AlignedBuffer>> m_nested_memory_pools;
+                // Scratchpads used by each context when its arena's shared ones are taken;
+                // the first is the calling thread's, the rest belong to inter-op workers
+                std::vector<std::vector<std::unique_ptr<AlignedBuffer>>> m_own_scratchpads;
 
                 // Codegen specific
 
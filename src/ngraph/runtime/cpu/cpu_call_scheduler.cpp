@@ -0,0 +1,170 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/cpu_call_scheduler.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/metrics.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    struct SchedulerMetrics
+    {
+        SchedulerMetrics()
+            : queued(runtime::metrics::Registry::get_default().get_gauge(
+                  "ngraph_cpu_calls_queued", "CPU calls waiting for the call scheduler"))
+            , rejected(runtime::metrics::Registry::get_default().get_counter(
+                  "ngraph_cpu_calls_rejected",
+                  "CPU calls rejected because the call scheduler queue was full"))
+            , wait_seconds(runtime::metrics::Registry::get_default().get_histogram(
+                  "ngraph_cpu_call_queue_seconds",
+                  "Time a CPU call waited in the call scheduler queue, in seconds"))
+        {
+        }
+        runtime::metrics::Gauge& queued;
+        runtime::metrics::Counter& rejected;
+        runtime::metrics::Histogram& wait_seconds;
+    };
+
+    SchedulerMetrics& get_scheduler_metrics()
+    {
+        static SchedulerMetrics s_metrics;
+        return s_metrics;
+    }
+
+    atomic<bool> s_call_scheduler_enabled{false};
+}
+
+struct runtime::cpu::CPU_CallScheduler::Waiter
+{
+    Client* client;
+    condition_variable granted;
+    int slot = -1;
+};
+
+runtime::cpu::CPU_CallScheduler::CPU_CallScheduler(size_t num_slots)
+    : m_num_slots(max(num_slots, size_t(1)))
+{
+    // Slot 0 is handed out first
+    for (size_t slot = m_num_slots; slot > 0; slot--)
+    {
+        m_free_slots.push_back(static_cast<int>(slot - 1));
+    }
+}
+
+int runtime::cpu::CPU_CallScheduler::acquire(Client& client, size_t max_queued)
+{
+    unique_lock<mutex> lock(m_mutex);
+    if (m_waiters.empty() && !m_free_slots.empty())
+    {
+        int slot = m_free_slots.back();
+        m_free_slots.pop_back();
+        grant(client);
+        return slot;
+    }
+
+    auto& metrics = get_scheduler_metrics();
+    if (max_queued != 0 && m_waiters.size() >= max_queued)
+    {
+        metrics.rejected.increment();
+        throw ngraph_error("CPU call rejected: " + to_string(m_waiters.size()) +
+                           " calls are already queued");
+    }
+
+    runtime::metrics::ScopedTimer timer(metrics.wait_seconds);
+    metrics.queued.add(1);
+    Waiter waiter;
+    waiter.client = &client;
+    m_waiters.push_back(&waiter);
+    // release() removes the waiter from the queue before granting it a slot
+    waiter.granted.wait(lock, [&waiter]() { return waiter.slot >= 0; });
+    metrics.queued.add(-1);
+    return waiter.slot;
+}
+
+void runtime::cpu::CPU_CallScheduler::release(int slot)
+{
+    lock_guard<mutex> lock(m_mutex);
+    if (m_waiters.empty())
+    {
+        m_free_slots.push_back(slot);
+        return;
+    }
+    Waiter* next = select_waiter();
+    grant(*next->client);
+    next->slot = slot;
+    next->granted.notify_one();
+}
+
+size_t runtime::cpu::CPU_CallScheduler::get_num_queued()
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_waiters.size();
+}
+
+runtime::cpu::CPU_CallScheduler::Waiter* runtime::cpu::CPU_CallScheduler::select_waiter()
+{
+    auto virtual_time = [this](const Client& client) {
+        return max(client.m_virtual_time, m_virtual_time);
+    };
+    // Waiters are in arrival order, so ties go to the call that waited longest
+    auto best = m_waiters.begin();
+    for (auto it = next(best); it != m_waiters.end(); ++it)
+    {
+        const Client& candidate = *(*it)->client;
+        const Client& current = *(*best)->client;
+        if (candidate.m_priority > current.m_priority ||
+            (candidate.m_priority == current.m_priority &&
+             virtual_time(candidate) < virtual_time(current)))
+        {
+            best = it;
+        }
+    }
+    Waiter* waiter = *best;
+    m_waiters.erase(best);
+    return waiter;
+}
+
+void runtime::cpu::CPU_CallScheduler::grant(Client& client)
+{
+    double start = max(client.m_virtual_time, m_virtual_time);
+    m_virtual_time = start;
+    client.m_virtual_time = start + 1.0 / static_cast<double>(max(client.m_weight, size_t(1)));
+}
+
+runtime::cpu::CPU_CallScheduler& runtime::cpu::get_call_scheduler()
+{
+    static CPU_CallScheduler s_scheduler(
+        static_cast<size_t>(executor::GetCPUExecutor().get_num_thread_pools()));
+    return s_scheduler;
+}
+
+void runtime::cpu::set_call_scheduler_enabled(bool enabled)
+{
+    s_call_scheduler_enabled.store(enabled, memory_order_relaxed);
+}
+
+bool runtime::cpu::is_call_scheduler_enabled()
+{
+    return s_call_scheduler_enabled.load(memory_order_relaxed);
+}
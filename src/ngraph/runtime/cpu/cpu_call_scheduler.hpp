@@ -0,0 +1,101 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Admission control for the calls of every CPU executable in the process.
+            ///
+            /// Each slot stands for one of the executor's thread pools, so a running call has
+            /// the cores of its pool to itself. Calls beyond the number of slots wait in a
+            /// queue. When a slot frees up it goes to the waiting call with the highest
+            /// priority. Among equal priorities, executables share the slots in proportion to
+            /// their weights: each admission advances the executable's virtual time by
+            /// 1/weight, and the executable furthest behind goes next.
+            class CPU_CallScheduler
+            {
+            public:
+                /// \brief The scheduling parameters of one executable
+                class Client
+                {
+                public:
+                    Client(size_t weight, int priority)
+                        : m_weight(weight)
+                        , m_priority(priority)
+                    {
+                    }
+                    size_t get_weight() const { return m_weight; }
+                    int get_priority() const { return m_priority; }
+                private:
+                    friend class CPU_CallScheduler;
+                    size_t m_weight;
+                    int m_priority;
+                    // Guarded by the scheduler's mutex
+                    double m_virtual_time = 0;
+                };
+
+                /// \param num_slots Number of calls that may run at once
+                explicit CPU_CallScheduler(size_t num_slots);
+
+                /// \brief Waits until the call may run.
+                /// \returns the slot granted to the call, which is also the id of the thread
+                ///          pool it should run on. Throws if `max_queued` calls are already
+                ///          waiting; 0 means the queue is unbounded.
+                int acquire(Client& client, size_t max_queued = 0);
+                /// \brief Gives the slot of a finished call to the next waiting call
+                void release(int slot);
+
+                size_t get_num_slots() const { return m_num_slots; }
+                size_t get_num_queued();
+
+            private:
+                struct Waiter;
+
+                // Removes and returns the waiter that goes next
+                Waiter* select_waiter();
+                // Charges the client for one admission
+                void grant(Client& client);
+
+                size_t m_num_slots;
+                std::mutex m_mutex;
+                std::vector<int> m_free_slots;
+                std::list<Waiter*> m_waiters;
+                // Virtual time of the latest admission; a client that was idle starts from
+                // here instead of using the share it did not claim
+                double m_virtual_time = 0;
+            };
+
+            /// \brief The scheduler shared by every CPU backend, with one slot per executor
+            ///        thread pool
+            CPU_CallScheduler& get_call_scheduler();
+
+            /// \brief Enables or disables the call scheduler for the calls of every CPU
+            ///        executable. Disabled by default.
+            void set_call_scheduler_enabled(bool enabled);
+            bool is_call_scheduler_enabled();
+        }
+    }
+}
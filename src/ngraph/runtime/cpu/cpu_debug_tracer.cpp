@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <sstream>
+
 #include "ngraph/runtime/cpu/cpu_debug_tracer.hpp"
 
 using namespace std;
@@ -21,6 +23,7 @@ using namespace ngraph;
 
 runtime::cpu::CPU_DebugTracer::CPU_DebugTracer()
     : m_serial_number(0)
+    , m_random(std::random_device{}())
 {
     static const auto debug_t = std::getenv("NGRAPH_CPU_DEBUG_TRACER");
     if (debug_t != nullptr)
@@ -28,7 +31,58 @@ runtime::cpu::CPU_DebugTracer::CPU_DebugTracer()
         m_enable_tracing = true;
 
         init_streams();
+        read_sampling_config();
+    }
+}
+
+void runtime::cpu::CPU_DebugTracer::read_sampling_config()
+{
+    const char* every = std::getenv("NGRAPH_CPU_TRACER_SAMPLE_EVERY");
+    const char* probability = std::getenv("NGRAPH_CPU_TRACER_SAMPLE_PROBABILITY");
+    set_sampling(every ? std::strtoull(every, nullptr, 10) : 1,
+                 probability ? std::strtod(probability, nullptr) : 1);
+
+    // Comma-separated op descriptions, e.g. "Convolution,MatMulBias"
+    unordered_set<string> ops;
+    if (const char* env_ops = std::getenv("NGRAPH_CPU_TRACER_OPS"))
+    {
+        stringstream ss(env_ops);
+        string op;
+        while (getline(ss, op, ','))
+        {
+            if (!op.empty())
+            {
+                ops.insert(op);
+            }
+        }
+    }
+    set_traced_ops(ops);
+
+    // Sampling is meant for live traffic, where full dumps are too expensive
+    m_stats_only = is_sampling() || std::getenv("NGRAPH_CPU_TRACER_STATS_ONLY") != nullptr;
+}
+
+void runtime::cpu::CPU_DebugTracer::set_sampling(size_t every, double probability)
+{
+    m_sample_every = std::max<size_t>(every, 1);
+    m_sample_probability = std::min(std::max(probability, 0.0), 1.0);
+    m_call_count = 0;
+}
+
+void runtime::cpu::CPU_DebugTracer::set_traced_ops(const unordered_set<string>& ops)
+{
+    m_traced_ops = ops;
+}
+
+bool runtime::cpu::CPU_DebugTracer::begin_call()
+{
+    m_trace_call = m_call_count++ % m_sample_every == 0;
+    if (m_trace_call && m_sample_probability < 1)
+    {
+        std::uniform_real_distribution<double> uniform(0, 1);
+        m_trace_call = uniform(m_random) < m_sample_probability;
     }
+    return m_trace_call;
 }
 
 void runtime::cpu::CPU_DebugTracer::init_streams()
@@ -58,6 +112,7 @@ void runtime::cpu::CPU_DebugTracer::set_enable_tracing(bool new_state)
     if (!m_enable_tracing && new_state)
     {
         init_streams();
+        read_sampling_config();
     }
 
     m_enable_tracing = new_state;
@@ -70,3 +125,49 @@ void runtime::cpu::CPU_DebugTracer::end_of_kernel()
     m_tracer_stream.flush();
     m_tracer_bin_stream.flush();
 }
+
+void runtime::cpu::CPU_DebugTracer::dump_tensor_stats(const string& kernel_name,
+                                                      const string& tensor_name,
+                                                      const TensorStats& stats,
+                                                      const ngraph::Shape& shape,
+                                                      const string& in_out)
+{
+    string tid{tensor_name.substr(1 + tensor_name.find("_"))};
+
+    m_tracer_stream << " K=" << std::left << std::setw(20) << kernel_name << " S=" << std::left
+                    << std::setw(10) << m_serial_number << " TID=" << std::left << std::setw(10)
+                    << tid << in_out;
+    m_tracer_stream << " size=" << stats.count << " " << shape;
+    m_tracer_stream << " min=" << stats.min << " max=" << stats.max << " mean=" << stats.mean
+                    << " nan=" << stats.nan_count << "\n";
+}
+
+runtime::cpu::TensorStats runtime::cpu::compute_tensor_stats(const void* data,
+                                                             const element::Type& type,
+                                                             size_t size)
+{
+    switch (type)
+    {
+    case element::Type_t::f32: return compute_tensor_stats(static_cast<const float*>(data), size);
+    case element::Type_t::f64: return compute_tensor_stats(static_cast<const double*>(data), size);
+    case element::Type_t::i8: return compute_tensor_stats(static_cast<const int8_t*>(data), size);
+    case element::Type_t::i16: return compute_tensor_stats(static_cast<const int16_t*>(data), size);
+    case element::Type_t::i32: return compute_tensor_stats(static_cast<const int32_t*>(data), size);
+    case element::Type_t::i64: return compute_tensor_stats(static_cast<const int64_t*>(data), size);
+    case element::Type_t::u8: return compute_tensor_stats(static_cast<const uint8_t*>(data), size);
+    case element::Type_t::u16:
+        return compute_tensor_stats(static_cast<const uint16_t*>(data), size);
+    case element::Type_t::u32:
+        return compute_tensor_stats(static_cast<const uint32_t*>(data), size);
+    case element::Type_t::u64:
+        return compute_tensor_stats(static_cast<const uint64_t*>(data), size);
+    case element::Type_t::undefined:
+    case element::Type_t::dynamic:
+    case element::Type_t::boolean:
+    case element::Type_t::bf16:
+    case element::Type_t::f16:
+    case element::Type_t::u1:
+    default: break;
+    }
+    return TensorStats();
+}
@@ -18,13 +18,17 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cmath>
 #include <cstring>
 #include <fstream>
 #include <functional>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <numeric>
+#include <random>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -36,6 +40,31 @@ namespace ngraph
     {
         namespace cpu
         {
+            /// \brief Summary of a tensor's values. NaNs are counted but excluded from min, max
+            ///        and mean.
+            struct TensorStats
+            {
+                size_t count = 0;
+                size_t nan_count = 0;
+                double min = 0;
+                double max = 0;
+                double mean = 0;
+            };
+
+            template <typename T>
+            TensorStats compute_tensor_stats(const T* data, size_t size);
+
+            /// \brief Computes the statistics of \p size elements of type \p type. Returns
+            ///        empty statistics for element types that are not supported.
+            TensorStats compute_tensor_stats(const void* data,
+                                             const element::Type& type,
+                                             size_t size);
+
+            /// Traces the tensors of executed kernels. By default every input and output of every
+            /// kernel is dumped on every call. Sampling, configured with
+            /// NGRAPH_CPU_TRACER_SAMPLE_EVERY, NGRAPH_CPU_TRACER_SAMPLE_PROBABILITY and
+            /// NGRAPH_CPU_TRACER_OPS, traces only a subset of calls and op types, and records
+            /// tensor statistics instead of full dumps.
             class CPU_DebugTracer
             {
             public:
@@ -46,6 +75,30 @@ namespace ngraph
                 bool tracing_is_enabled() { return m_enable_tracing; }
                 void end_of_kernel();
 
+                /// \brief Traces one call in every \p every, each with probability
+                ///        \p probability.
+                void set_sampling(size_t every, double probability);
+                /// \brief Restricts tracing to ops with the given descriptions. An empty set
+                ///        traces every op.
+                void set_traced_ops(const std::unordered_set<std::string>& ops);
+                /// \brief Record statistics only, without the binary dump
+                void set_stats_only(bool stats_only) { m_stats_only = stats_only; }
+                bool is_sampling() const { return m_sample_every > 1 || m_sample_probability < 1; }
+                bool is_stats_only() const { return m_stats_only; }
+                /// \brief Decides whether the call that is starting is traced
+                bool begin_call();
+                bool call_is_traced() const { return m_enable_tracing && m_trace_call; }
+                bool op_is_traced(const std::string& description) const
+                {
+                    return m_traced_ops.empty() || m_traced_ops.count(description) != 0;
+                }
+
+                void dump_tensor_stats(const std::string& kernel_name,
+                                       const std::string& tensor_name,
+                                       const TensorStats& stats,
+                                       const ngraph::Shape& shape,
+                                       const std::string& in_out);
+
                 template <typename T>
                 void dump_one_tensor(const std::string& kernel_name,
                                      const void* tensor,
@@ -60,17 +113,90 @@ namespace ngraph
                 CPU_DebugTracer& operator=(const CPU_DebugTracer&) = delete;
 
                 void init_streams();
+                void read_sampling_config();
 
                 size_t m_serial_number;
                 std::fstream m_tracer_stream;
                 std::fstream m_tracer_bin_stream;
 
                 bool m_enable_tracing = false;
+                bool m_stats_only = false;
+                bool m_trace_call = true;
+                size_t m_sample_every = 1;
+                size_t m_call_count = 0;
+                double m_sample_probability = 1;
+                std::unordered_set<std::string> m_traced_ops;
+                std::mt19937 m_random;
             };
         }
     }
 }
 
+template <typename T>
+ngraph::runtime::cpu::TensorStats ngraph::runtime::cpu::compute_tensor_stats(const T* data,
+                                                                             size_t size)
+{
+    // Independent per-lane accumulators keep the loop free of cross-iteration dependencies so
+    // that it vectorizes
+    constexpr size_t lanes = 8;
+    const T init_min = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                            : std::numeric_limits<T>::max();
+    const T init_max = std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity()
+                                                            : std::numeric_limits<T>::lowest();
+    T lo[lanes];
+    T hi[lanes];
+    double sum[lanes];
+    size_t nans[lanes];
+    for (size_t l = 0; l < lanes; l++)
+    {
+        lo[l] = init_min;
+        hi[l] = init_max;
+        sum[l] = 0;
+        nans[l] = 0;
+    }
+
+    auto accumulate = [&](size_t l, T x) {
+        bool nan = std::isnan(x);
+        nans[l] += nan;
+        sum[l] += nan ? 0 : static_cast<double>(x);
+        lo[l] = x < lo[l] ? x : lo[l];
+        hi[l] = x > hi[l] ? x : hi[l];
+    };
+
+    size_t blocked = size - size % lanes;
+    for (size_t i = 0; i < blocked; i += lanes)
+    {
+        for (size_t l = 0; l < lanes; l++)
+        {
+            accumulate(l, data[i + l]);
+        }
+    }
+    for (size_t i = blocked; i < size; i++)
+    {
+        accumulate(0, data[i]);
+    }
+
+    TensorStats stats;
+    stats.count = size;
+    T min = init_min;
+    T max = init_max;
+    double total = 0;
+    for (size_t l = 0; l < lanes; l++)
+    {
+        min = std::min(min, lo[l]);
+        max = std::max(max, hi[l]);
+        total += sum[l];
+        stats.nan_count += nans[l];
+    }
+    if (stats.nan_count < size)
+    {
+        stats.min = static_cast<double>(min);
+        stats.max = static_cast<double>(max);
+        stats.mean = total / (size - stats.nan_count);
+    }
+    return stats;
+}
+
 // use of kahan sum to reduce numeric error
 template <typename T>
 float find_variance(const std::vector<T>& f_data, float mean, size_t size)
@@ -38,6 +38,14 @@ void runtime::cpu::CPU_CountTracepoint::operator()(void** outputs, const std::st
     }
 }
 
+void runtime::cpu::CPU_SampledTracepoint::operator()(void** outputs, const std::string& name)
+{
+    if (std::uniform_real_distribution<double>(0, 1)(m_random) < m_probability)
+    {
+        m_callback(outputs, name);
+    }
+}
+
 runtime::cpu::CPU_Debugger::CPU_Debugger(ngraph::runtime::cpu::CPU_CallFrame& callframe)
     : m_callframe(callframe)
 {
@@ -19,6 +19,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <random>
 #include <string>
 #include <string>
 #include <tuple>
@@ -58,6 +59,29 @@ namespace ngraph
                 size_t m_iteration;
             };
 
+            class CPU_BACKEND_API CPU_SampledTracepoint
+            {
+            public:
+                /// \brief A convenience class that wraps user's callback to run it with the given
+                /// probability, e.g. to collect compute_tensor_stats on live traffic
+                CPU_SampledTracepoint(
+                    const std::function<void(void**, const std::string&)>& callback,
+                    double probability,
+                    unsigned seed = std::random_device{}())
+                    : m_callback(callback)
+                    , m_probability(probability)
+                    , m_random(seed)
+                {
+                }
+
+                void operator()(void** outputs, const std::string& name);
+
+            private:
+                std::function<void(void**, const std::string&)> m_callback;
+                double m_probability;
+                std::mt19937 m_random;
+            };
+
             class CPU_BACKEND_API CPU_Debugger
             {
             public:
@@ -17,7 +17,9 @@
 #include "ngraph/runtime/cpu/cpu_emitter.hpp"
 #include <algorithm>
 #include <cmath>
+#include <iomanip>
 #include <numeric>
+#include <sstream>
 #include <string>
 #include <typeindex>
 #include <unordered_map>
@@ -1780,6 +1782,39 @@ namespace ngraph
                 writer.block_end();
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::EmbeddingBagSum)
+            {
+                (void)external_function;
+                (void)node;
+                const Shape& indices_shape = args[0].get_shape();
+                const Shape& weights_shape = args[1].get_shape();
+                size_t bag_size = indices_shape.at(1);
+                size_t row_length = weights_shape.at(1);
+                writer.block_begin();
+                writer << "#pragma omp parallel for\n";
+                writer << "for (size_t i = 0; i < " << indices_shape.at(0) << "; i++)\n";
+                writer.block_begin();
+                writer << out[0].get_type() << "* sum = " << out[0].get_name() << " + i * "
+                       << row_length << ";\n";
+                writer << "for (size_t j = 0; j < " << row_length << "; j++)\n";
+                writer.block_begin();
+                writer << "sum[j] = 0;\n";
+                writer.block_end();
+                writer << "for (size_t k = 0; k < " << bag_size << "; k++)\n";
+                writer.block_begin();
+                writer << "const " << out[0].get_type() << "* row = " << args[1].get_name()
+                       << " + static_cast<size_t>(" << args[0].get_name() << "[i * " << bag_size
+                       << " + k]) * " << row_length << ";\n";
+                writer << "for (size_t j = 0; j < " << row_length << "; j++)\n";
+                writer.block_begin();
+                writer << "sum[j] += row[j];\n";
+                writer.block_end();
+                writer.block_end();
+                writer.block_end();
+                writer.block_end();
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Sin)
             {
@@ -2885,6 +2920,31 @@ namespace ngraph
                 writer << "            " << args[7].get_name() << ");\n";
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::QuantizedAdd)
+            {
+                (void)external_function;
+                auto qadd = static_cast<const ngraph::op::QuantizedAdd*>(node);
+                // Enough digits to round trip the multipliers
+                std::ostringstream input0_multiplier, input1_multiplier;
+                input0_multiplier << std::setprecision(9)
+                                  << qadd->get_input0_scale() / qadd->get_output_scale() << "f";
+                input1_multiplier << std::setprecision(9)
+                                  << qadd->get_input1_scale() / qadd->get_output_scale() << "f";
+                bool is_signed = out[0].get_element_type() == element::i8;
+                writer << "#pragma omp parallel for\n";
+                writer << "for (size_t i = 0; i < " << out[0].get_size() << "; i++)\n";
+                writer.block_begin();
+                writer << "float sum = " << args[0].get_name() << "[i] * "
+                       << input0_multiplier.str() << " + " << args[1].get_name() << "[i] * "
+                       << input1_multiplier.str() << ";\n";
+                writer << "sum = std::min(std::max(sum, " << (is_signed ? "-128.0f" : "0.0f")
+                       << "), " << (is_signed ? "127.0f" : "255.0f") << ");\n";
+                writer << out[0].get_name() << "[i] = static_cast<" << out[0].get_type()
+                       << ">(std::nearbyint(sum));\n";
+                writer.block_end();
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::QuantizedMatmul)
             {
@@ -3274,6 +3334,11 @@ namespace ngraph
 
                 auto arg0_shape = args[0].get_shape();
                 auto result_shape = out[0].get_shape();
+                auto padding_below = pad->get_padding_below();
+                auto padding_above = pad->get_padding_above();
+                // CPULayout keeps channel-blocked layouts through Pads of the spatial axes
+                mkldnn_utils::blocked_pad_view(
+                    node, arg0_shape, result_shape, padding_below, padding_above);
 
                 std::string pad_mode_string;
                 switch (pad->get_pad_mode())
@@ -3301,10 +3366,8 @@ namespace ngraph
                            << "                            " << args[1].get_name() << ",\n"
                            << "                            {" << join(arg0_shape) << "},\n"
                            << "                            {" << join(result_shape) << "},\n"
-                           << "                            {" << join(pad->get_padding_below())
-                           << "},\n"
-                           << "                            {" << join(pad->get_padding_above())
-                           << "}, \n"
+                           << "                            {" << join(padding_below) << "},\n"
+                           << "                            {" << join(padding_above) << "}, \n"
                            << "                            " << pad_mode_string << ",\n"
                            << "                             0);\n";
                 }
@@ -3316,8 +3379,8 @@ namespace ngraph
                     writer << "            " << out[0].get_name() << ",\n";
                     writer << "            {" << join(arg0_shape) << "},\n";
                     writer << "            {" << join(result_shape) << "},\n";
-                    writer << "            {" << join(pad->get_padding_below()) << "},\n";
-                    writer << "            {" << join(pad->get_padding_above()) << "},\n";
+                    writer << "            {" << join(padding_below) << "},\n";
+                    writer << "            {" << join(padding_above) << "},\n";
                     writer << "            " << pad_mode_string << ");\n";
                 }
             }
@@ -3722,9 +3785,14 @@ namespace ngraph
                     writer << "cg_ctx->mkldnn_invoke_primitive(" << to_string(gelu_index)
                            << ", deps, OpType::GELU, " << to_string(scratchpad_size) << ");\n";
                 }
+                else if (args[0].get_element_type() == element::f32)
+                {
+                    writer << "cpu::kernel::gelu_float32(" << args[0].get_name() << ", "
+                           << out[0].get_name() << ", " << out[0].get_size() << ", 0);\n";
+                }
                 else
                 {
-                    throw ngraph_error("Gelu is only supported with MKLDNN kernel for f32.");
+                    throw ngraph_error("Gelu is only supported for f32.");
                 }
             }
 
@@ -4652,6 +4720,137 @@ namespace ngraph
                 writer.block_end();
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::FusedElementwise)
+            {
+                (void)external_function;
+                using Opcode = ngraph::op::FusedElementwise::Opcode;
+                auto fused = static_cast<const ngraph::op::FusedElementwise*>(node);
+                auto& shape = fused->get_program_shape();
+                auto& broadcast_axes = fused->get_broadcast_axes();
+                auto& program = fused->get_program();
+                auto rank = shape.size();
+                auto kept_rank = rank - fused->get_reduction_axes().size();
+                bool reduce = kept_rank != rank;
+                auto& type = out[0].get_type();
+
+                // Builds the offset of an element from the loop indices and the stride of each
+                // program axis; broadcast axes have stride 0 and drop out.
+                auto offset = [](const vector<size_t>& strides) {
+                    vector<string> terms;
+                    for (size_t axis = 0; axis < strides.size(); axis++)
+                    {
+                        if (strides[axis] != 0)
+                        {
+                            auto index = "i" + to_string(axis);
+                            terms.push_back(strides[axis] == 1
+                                                ? index
+                                                : index + " * " + to_string(strides[axis]));
+                        }
+                    }
+                    return terms.empty() ? string("0") : join(terms, " + ");
+                };
+
+                auto program_strides = row_major_strides(shape);
+                vector<string> operands;
+                for (size_t i = 0; i < args.size(); i++)
+                {
+                    auto strides = program_strides;
+                    if (!broadcast_axes[i].empty())
+                    {
+                        auto arg_strides = row_major_strides(args[i].get_shape());
+                        size_t arg_axis = 0;
+                        for (size_t axis = 0; axis < rank; axis++)
+                        {
+                            strides[axis] = broadcast_axes[i].count(axis) != 0
+                                                ? 0
+                                                : arg_strides[arg_axis++];
+                        }
+                    }
+                    operands.push_back(args[i].get_name() + "[" + offset(strides) + "]");
+                }
+                // The output is indexed by the kept axes only
+                auto kept_strides =
+                    row_major_strides(Shape(shape.begin(), shape.begin() + kept_rank));
+                vector<size_t> out_strides(rank, 0);
+                copy(kept_strides.begin(), kept_strides.end(), out_strides.begin());
+                auto out_element = out[0].get_name() + "[" + offset(out_strides) + "]";
+
+                // One loop nest for the whole program: threads split the outermost axis, the
+                // innermost one is vectorized, and every instruction is a scalar temporary.
+                writer.block_begin();
+                for (size_t axis = 0; axis < rank; axis++)
+                {
+                    if (reduce && axis == kept_rank)
+                    {
+                        writer << type << " sum = 0;\n";
+                    }
+                    if (axis == 0 && kept_rank > 0)
+                    {
+                        writer << (rank == 1 ? "#pragma omp parallel for simd\n"
+                                             : "#pragma omp parallel for\n");
+                    }
+                    else if (axis + 1 == rank)
+                    {
+                        writer << (reduce ? "#pragma omp simd reduction(+ : sum)\n"
+                                          : "#pragma omp simd\n");
+                    }
+                    writer << emit_for_lt("i", axis, shape[axis]);
+                    writer.block_begin();
+                }
+
+                for (size_t i = 0; i < program.size(); i++)
+                {
+                    auto& a = operands[program[i].arg0];
+                    string b = ngraph::op::FusedElementwise::is_unary(program[i].opcode)
+                                   ? ""
+                                   : operands[program[i].arg1];
+                    string expression;
+                    switch (program[i].opcode)
+                    {
+                    case Opcode::Abs: expression = "std::abs(" + a + ")"; break;
+                    case Opcode::Add: expression = a + " + " + b; break;
+                    case Opcode::Divide: expression = a + " / " + b; break;
+                    case Opcode::Exp: expression = "std::exp(" + a + ")"; break;
+                    case Opcode::Log: expression = "std::log(" + a + ")"; break;
+                    case Opcode::Maximum:
+                        expression = a + " > " + b + " ? " + a + " : " + b;
+                        break;
+                    case Opcode::Minimum:
+                        expression = a + " < " + b + " ? " + a + " : " + b;
+                        break;
+                    case Opcode::Multiply: expression = a + " * " + b; break;
+                    case Opcode::Negative: expression = "-" + a; break;
+                    case Opcode::Relu: expression = a + " > 0 ? " + a + " : 0"; break;
+                    case Opcode::Sigmoid: expression = "1 / (1 + std::exp(-" + a + "))"; break;
+                    case Opcode::Sqrt: expression = "std::sqrt(" + a + ")"; break;
+                    case Opcode::Subtract: expression = a + " - " + b; break;
+                    case Opcode::Tanh: expression = "std::tanh(" + a + ")"; break;
+                    }
+                    auto t = "t" + to_string(i);
+                    writer << type << " " << t << " = " << expression << ";\n";
+                    operands.push_back(t);
+                }
+                if (reduce)
+                {
+                    writer << "sum += " << operands.back() << ";\n";
+                }
+                else
+                {
+                    writer << out_element << " = " << operands.back() << ";\n";
+                }
+
+                for (size_t axis = rank; axis-- > 0;)
+                {
+                    writer.block_end();
+                    if (reduce && axis == kept_rank)
+                    {
+                        writer << out_element << " = sum;\n";
+                    }
+                }
+                writer.block_end();
+            }
+
 #undef TI
         } // namespace cpu
     }     // namespace runtime
@@ -27,10 +27,13 @@
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/dropout.hpp"
+#include "ngraph/runtime/cpu/op/embedding_bag_sum.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
 #include "ngraph/runtime/cpu/op/gelu_backprop.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/quantized_add.hpp"
 #include "ngraph/runtime/cpu/op/quantized_matmul.hpp"
 #include "ngraph/runtime/cpu/op/quantized_matmul.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
@@ -180,6 +183,8 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::EmbeddingLookup);
             template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::EmbeddingBagSum);
+            template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Sin);
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Sinh);
@@ -252,6 +257,8 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::QuantizedDot);
             template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::QuantizedAdd);
+            template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::QuantizedMatmul);
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::ConvolutionBias);
@@ -333,6 +340,8 @@ namespace ngraph
             void CPU_Emitter::EMITTER_DECL(ngraph::op::RandomUniform);
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::GeluBackprop);
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::FusedElementwise);
         }
     }
 }
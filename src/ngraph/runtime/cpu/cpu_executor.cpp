@@ -14,11 +14,21 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <pthread.h>
 #include <thread>
 
 #include "cpu_executor.hpp"
 
 #include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/cpu_affinity.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #define MAX_PARALLELISM_THRESHOLD 2
 
@@ -67,6 +77,124 @@ static int GetNumThreadPools()
     return count < 1 ? 1 : count;
 }
 
+static int GetNumRequestThreads()
+{
+    // One request thread per runtime context is enough to keep every context busy
+    const auto ngraph_cpu_concurrency = std::getenv("NGRAPH_CPU_CONCURRENCY");
+    int count = 0;
+
+    if (ngraph_cpu_concurrency)
+    {
+        count = std::atoi(ngraph_cpu_concurrency);
+    }
+
+    return count < 1 ? 1 : count;
+}
+
+namespace
+{
+    // Thread environment that pins every pool thread to its affinity slot, or to one NUMA
+    // node when no affinity policy is set, before it starts pulling work, so that pages first
+    // touched by the pool stay local. Threads re-pin before their next task when the policy
+    // changes.
+    struct PinnedThreadEnvironment : public Eigen::StlThreadEnvironment
+    {
+        PinnedThreadEnvironment(size_t first_slot, bool numa, size_t numa_node)
+            : next_slot(first_slot)
+            , bind_numa(numa)
+            , node(numa_node)
+        {
+        }
+
+        EnvThread* CreateThread(std::function<void()> f)
+        {
+            auto slot = next_slot++;
+            auto numa = bind_numa;
+            auto numa_node = node;
+            return new EnvThread([slot, numa, numa_node, f]() {
+                s_slot = slot;
+                s_numa = numa;
+                s_node = numa_node;
+                if (numa)
+                {
+                    ngraph::runtime::cpu::numa::bind_thread_to_node(numa_node);
+                }
+                pin();
+                f();
+            });
+        }
+
+        void ExecuteTask(const Task& t)
+        {
+            pin();
+            t.f();
+        }
+
+        static void pin()
+        {
+            namespace affinity = ngraph::runtime::cpu::affinity;
+            uint64_t generation = affinity::get_generation();
+            if (generation == s_generation)
+            {
+                return;
+            }
+            s_generation = generation;
+            if (s_numa && affinity::get_policy() == affinity::Policy::NONE)
+            {
+                ngraph::runtime::cpu::numa::bind_thread_to_node(s_node);
+            }
+            else
+            {
+                affinity::bind_thread(s_slot);
+            }
+        }
+
+        size_t next_slot;
+        bool bind_numa;
+        size_t node;
+
+        static thread_local size_t s_slot;
+        static thread_local bool s_numa;
+        static thread_local size_t s_node;
+        static thread_local uint64_t s_generation;
+    };
+
+    thread_local size_t PinnedThreadEnvironment::s_slot = 0;
+    thread_local bool PinnedThreadEnvironment::s_numa = false;
+    thread_local size_t PinnedThreadEnvironment::s_node = 0;
+    thread_local uint64_t PinnedThreadEnvironment::s_generation = 0;
+
+#if defined(NGRAPH_TBB_ENABLE)
+    // Pins TBB worker threads, which run flow graph nodes, to consecutive affinity slots as
+    // they join an arena
+    class PinningObserver : public tbb::task_scheduler_observer
+    {
+    public:
+        PinningObserver() { observe(true); }
+        ~PinningObserver() { observe(false); }
+        void on_scheduler_entry(bool is_worker) override
+        {
+            namespace affinity = ngraph::runtime::cpu::affinity;
+            if (!is_worker)
+            {
+                return;
+            }
+            thread_local size_t s_slot = m_next_slot++;
+            thread_local uint64_t s_generation = 0;
+            uint64_t generation = affinity::get_generation();
+            if (generation != s_generation)
+            {
+                s_generation = generation;
+                affinity::bind_thread(s_slot);
+            }
+        }
+
+    private:
+        std::atomic<size_t> m_next_slot{0};
+    };
+#endif
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -79,48 +207,206 @@ namespace ngraph
                     : m_num_thread_pools(num_thread_pools)
                 {
                     m_num_cores = GetNumCores();
-                    for (int i = 0; i < num_thread_pools; i++)
-                    {
-                        int num_threads_per_pool;
+                    // Read NGRAPH_CPU_AFFINITY and the CPUs of the process before any pool
+                    // thread is pinned
+                    affinity::get_generation();
 
-                        // Eigen threadpool will still be used for reductions
-                        // and other tensor operations that dont use a parallelFor
-                        num_threads_per_pool = GetNumCores();
+                    // Eigen threadpool will still be used for reductions
+                    // and other tensor operations that dont use a parallelFor
+                    int num_threads_per_pool = m_num_cores;
 
-                        // User override
-                        char* eigen_tp_count = std::getenv("NGRAPH_CPU_EIGEN_THREAD_COUNT");
-                        if (eigen_tp_count != nullptr)
+                    // User override
+                    char* eigen_tp_count = std::getenv("NGRAPH_CPU_EIGEN_THREAD_COUNT");
+                    if (eigen_tp_count != nullptr)
+                    {
+                        const int tp_count = std::atoi(eigen_tp_count);
+                        if (tp_count < 1 || tp_count > m_num_cores)
                         {
-                            const int tp_count = std::atoi(eigen_tp_count);
-                            if (tp_count < 1 || tp_count > GetNumCores())
-                            {
-                                throw ngraph_error(
-                                    "Unexpected value specified for NGRAPH_CPU_EIGEN_THREAD_COUNT "
-                                    "(" +
-                                    std::string(eigen_tp_count) +
-                                    "). Please specify a value in range [1-" +
-                                    std::to_string(GetNumCores()) + "]");
-                            }
-                            num_threads_per_pool = tp_count;
+                            throw ngraph_error(
+                                "Unexpected value specified for NGRAPH_CPU_EIGEN_THREAD_COUNT "
+                                "(" +
+                                std::string(eigen_tp_count) +
+                                "). Please specify a value in range [1-" +
+                                std::to_string(m_num_cores) + "]");
                         }
+                        num_threads_per_pool = tp_count;
+                    }
+                    m_num_threads_per_pool = num_threads_per_pool;
 
-                        m_thread_pools.push_back(std::unique_ptr<Eigen::ThreadPool>(
-                            new Eigen::ThreadPool(num_threads_per_pool)));
-                        m_thread_pool_devices.push_back(
-                            std::unique_ptr<Eigen::ThreadPoolDevice>(new Eigen::ThreadPoolDevice(
-                                m_thread_pools[i].get(), num_threads_per_pool)));
+                    // The pools themselves are created by get_device
+                    m_thread_pools.resize(num_thread_pools);
+                    m_thread_pool_devices.resize(num_thread_pools);
+                    m_limited_devices.resize(num_thread_pools);
+                    m_thread_pool_created.reset(new std::once_flag[num_thread_pools]);
+                    pthread_atfork(prepare_fork, parent_after_fork, child_after_fork);
 #if defined(NGRAPH_TBB_ENABLE)
+                    // Arenas start their threads on first use
+                    for (int i = 0; i < num_thread_pools; i++)
+                    {
                         m_tbb_arenas.emplace_back(1);
+                    }
+                    m_tbb_observer.reset(new PinningObserver());
 #endif
+                }
+
+                void CPUExecutor::create_thread_pool(int id)
+                {
+                    int num_threads_per_pool = static_cast<int>(m_num_threads_per_pool);
+                    m_thread_pools[id] = std::unique_ptr<Eigen::ThreadPoolInterface>(
+                        new Eigen::ThreadPoolTempl<PinnedThreadEnvironment>(
+                            num_threads_per_pool,
+                            PinnedThreadEnvironment(
+                                id * num_threads_per_pool, numa::is_enabled(), get_numa_node(id))));
+                    m_thread_pool_devices[id] =
+                        std::unique_ptr<Eigen::ThreadPoolDevice>(new Eigen::ThreadPoolDevice(
+                            m_thread_pools[id].get(), num_threads_per_pool));
+                    for (int n = 1; n < num_threads_per_pool; n++)
+                    {
+                        m_limited_devices[id].emplace_back(
+                            new Eigen::ThreadPoolDevice(m_thread_pools[id].get(), n));
                     }
                 }
 
+                void CPUExecutor::prepare_fork()
+                {
+                    auto& executor = GetCPUExecutor();
+                    executor.m_request_pool_mutex.lock();
+                    executor.m_inter_op_pool_mutex.lock();
+                }
+
+                void CPUExecutor::parent_after_fork()
+                {
+                    auto& executor = GetCPUExecutor();
+                    executor.m_inter_op_pool_mutex.unlock();
+                    executor.m_request_pool_mutex.unlock();
+                }
+
+                void CPUExecutor::child_after_fork()
+                {
+                    // Destroying a pool would join threads that only exist in the parent
+                    auto& executor = GetCPUExecutor();
+                    for (int id = 0; id < executor.m_num_thread_pools; id++)
+                    {
+                        executor.m_thread_pools[id].release();
+                        executor.m_thread_pool_devices[id].reset();
+                        executor.m_limited_devices[id].clear();
+                    }
+                    executor.m_thread_pool_created.reset(
+                        new std::once_flag[executor.m_num_thread_pools]);
+                    executor.m_inter_op_pool.release();
+                    executor.m_request_pool.release();
+                    executor.m_inter_op_pool_mutex.unlock();
+                    executor.m_request_pool_mutex.unlock();
+                }
+
+                void CPUExecutor::pin_openmp_threads(int arena)
+                {
+#ifdef _OPENMP
+                    // The helper threads of an OpenMP team share the slots of the intra-op
+                    // pool of the arena; the thread that starts the team is left alone
+                    thread_local uint64_t s_generation = 0;
+                    thread_local int s_arena = -1;
+                    uint64_t generation = affinity::get_generation();
+                    if (generation == s_generation && arena == s_arena)
+                    {
+                        return;
+                    }
+                    s_generation = generation;
+                    s_arena = arena;
+                    size_t first_slot = static_cast<size_t>(arena) * m_num_threads_per_pool;
+#pragma omp parallel
+                    {
+                        int thread = omp_get_thread_num();
+                        if (thread > 0)
+                        {
+                            affinity::bind_thread(first_slot + thread);
+                        }
+                    }
+#else
+                    (void)arena;
+#endif
+                }
+
+                void CPUExecutor::schedule_request(std::function<void()> request)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(m_request_pool_mutex);
+                        if (!m_request_pool)
+                        {
+                            m_request_pool = std::unique_ptr<Eigen::ThreadPool>(
+                                new Eigen::ThreadPool(GetNumRequestThreads()));
+                        }
+                    }
+                    m_request_pool->Schedule(std::move(request));
+                }
+
+                int CPUExecutor::get_numa_node(int id)
+                {
+                    if (!numa::is_enabled())
+                    {
+                        return 0;
+                    }
+                    return id % static_cast<int>(numa::get_num_nodes());
+                }
+
+                void CPUExecutor::schedule_inter_op(std::function<void()> worker)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(m_inter_op_pool_mutex);
+                        if (!m_inter_op_pool)
+                        {
+                            m_inter_op_pool = std::unique_ptr<Eigen::ThreadPool>(
+                                new Eigen::ThreadPool(std::max(m_num_thread_pools - 1, 1)));
+                        }
+                    }
+                    m_inter_op_pool->Schedule(std::move(worker));
+                }
+
+                thread_local int CPUExecutor::s_op_num_threads = 0;
+
+                // Limits the Eigen devices and the OpenMP team (used by MKL-DNN) of the
+                // calling thread to the op's thread count while the op runs
+                class CPUExecutor::OpThreadLimit
+                {
+                public:
+                    OpThreadLimit(int num_threads)
+                        : m_previous(s_op_num_threads)
+                    {
+                        s_op_num_threads = num_threads;
+#ifdef _OPENMP
+                        m_omp_threads = omp_get_max_threads();
+                        if (num_threads > 0 && num_threads < m_omp_threads)
+                        {
+                            omp_set_num_threads(num_threads);
+                        }
+#endif
+                    }
+                    ~OpThreadLimit()
+                    {
+                        s_op_num_threads = m_previous;
+#ifdef _OPENMP
+                        if (omp_get_max_threads() != m_omp_threads)
+                        {
+                            omp_set_num_threads(m_omp_threads);
+                        }
+#endif
+                    }
+
+                private:
+                    int m_previous;
+#ifdef _OPENMP
+                    int m_omp_threads;
+#endif
+                };
+
 #if defined(NGRAPH_TBB_ENABLE)
                 void CPUExecutor::execute(CPUKernelFunctor& f,
                                           CPURuntimeContext* ctx,
                                           CPUExecutionContext* ectx,
                                           bool use_tbb)
                 {
+                    pin_openmp_threads(ectx->arena);
+                    OpThreadLimit limit(ectx->num_threads);
                     auto tbb_functor = [&]() { f(ctx, ectx); };
                     if (use_tbb)
                     {
@@ -136,6 +422,8 @@ namespace ngraph
                                           CPURuntimeContext* ctx,
                                           CPUExecutionContext* ectx)
                 {
+                    pin_openmp_threads(ectx->arena);
+                    OpThreadLimit limit(ectx->num_threads);
                     f(ctx, ectx);
                 }
 #endif
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <functional>
+#include <mutex>
 #include <thread>
 
 #include <mkldnn.hpp>
@@ -28,6 +29,7 @@
 
 #if defined(NGRAPH_TBB_ENABLE)
 #include "tbb/task_arena.h"
+#include "tbb/task_scheduler_observer.h"
 #endif
 
 namespace ngraph
@@ -46,8 +48,20 @@ namespace ngraph
                 public:
                     explicit CPUExecutor(int num_thread_pools);
 
+                    /// \brief The device of thread pool `id`. Pools are created on first use,
+                    ///        so that processes which never run a kernel start no threads.
+                    ///        Within execute(), the device uses no more threads than the op
+                    ///        was given.
                     Eigen::ThreadPoolDevice& get_device(int id)
                     {
+                        std::call_once(m_thread_pool_created[id], [this, id]() {
+                            create_thread_pool(id);
+                        });
+                        size_t limit = static_cast<size_t>(s_op_num_threads);
+                        if (limit > 0 && limit < m_num_threads_per_pool)
+                        {
+                            return *m_limited_devices[id][limit - 1];
+                        }
                         return *m_thread_pool_devices[id].get();
                     }
 
@@ -61,16 +75,62 @@ namespace ngraph
                                  CPURuntimeContext* ctx,
                                  CPUExecutionContext* ectx);
 #endif
+                    /// \brief Run a whole-graph request on the request pool. Used by
+                    ///        CPU_CallFrame::call_async so that asynchronous calls do not
+                    ///        spawn a thread per request.
+                    void schedule_request(std::function<void()> request);
+
+                    /// \brief Run a helper worker of the inter-op scheduler. The pool has one
+                    ///        thread per thread pool beyond the first, since the calling thread
+                    ///        of a request is always worker 0.
+                    void schedule_inter_op(std::function<void()> worker);
+
                     int get_num_thread_pools() { return m_num_thread_pools; }
+                    size_t get_num_threads_per_pool() const { return m_num_threads_per_pool; }
                     int get_num_cores() { return m_num_cores; }
+                    /// \returns the NUMA node whose CPUs run thread pool `id`. Pools are
+                    ///          spread round-robin over the nodes when NGRAPH_CPU_NUMA is set
+                    ///          and all map to node 0 otherwise.
+                    int get_numa_node(int id);
+
                 private:
-                    std::vector<std::unique_ptr<Eigen::ThreadPool>> m_thread_pools;
+                    void create_thread_pool(int id);
+
+                    // fork() handlers. The pool mutexes are held across the fork, and the child,
+                    // which has none of the pool threads, abandons the pools so that they are
+                    // created again on first use.
+                    static void prepare_fork();
+                    static void parent_after_fork();
+                    static void child_after_fork();
+
+                    /// \brief Re-pin the helper threads of the calling thread's OpenMP team
+                    ///        if the affinity policy or the arena changed since the last call
+                    void pin_openmp_threads(int arena);
+
+                    std::vector<std::unique_ptr<Eigen::ThreadPoolInterface>> m_thread_pools;
                     std::vector<std::unique_ptr<Eigen::ThreadPoolDevice>> m_thread_pool_devices;
+                    // m_limited_devices[id][n - 1] runs on pool `id` with at most n threads
+                    std::vector<std::vector<std::unique_ptr<Eigen::ThreadPoolDevice>>>
+                        m_limited_devices;
+                    // CPUExecutionContext::num_threads of the op execute() is running on this
+                    // thread, 0 outside of ops
+                    static thread_local int s_op_num_threads;
+                    class OpThreadLimit;
+                    std::unique_ptr<std::once_flag[]> m_thread_pool_created;
 #if defined(NGRAPH_TBB_ENABLE)
                     std::vector<tbb::task_arena> m_tbb_arenas;
+                    std::unique_ptr<tbb::task_scheduler_observer> m_tbb_observer;
 #endif
                     int m_num_thread_pools;
                     int m_num_cores;
+                    size_t m_num_threads_per_pool = 1;
+                    std::unique_ptr<Eigen::ThreadPool> m_inter_op_pool;
+                    std::mutex m_inter_op_pool_mutex;
+                    // Threads that drive asynchronous calls; separate from the intra-op pools
+                    // so that a request never blocks on a pool it is itself running on.
+                    // Declared last so it is drained before the pools it uses are destroyed.
+                    std::unique_ptr<Eigen::ThreadPool> m_request_pool;
+                    std::mutex m_request_pool_mutex;
                 };
 
                 extern CPUExecutor& GetCPUExecutor();
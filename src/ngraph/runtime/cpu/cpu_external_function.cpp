@@ -85,13 +85,28 @@
 #include "ngraph/op/experimental/random_uniform.hpp"
 #include "ngraph/op/experimental/tile.hpp"
 #include "ngraph/op/floor.hpp"
+#include "ngraph/op/fused/batch_mat_mul_transpose.hpp"
+#include "ngraph/op/fused/clamp.hpp"
 #include "ngraph/op/fused/conv_fused.hpp"
+#include "ngraph/op/fused/depth_to_space.hpp"
+#include "ngraph/op/fused/elu.hpp"
 #include "ngraph/op/fused/gelu.hpp"
 #include "ngraph/op/fused/gemm.hpp"
+#include "ngraph/op/fused/grn.hpp"
 #include "ngraph/op/fused/group_conv.hpp"
+#include "ngraph/op/fused/hard_sigmoid.hpp"
+#include "ngraph/op/fused/layer_norm.hpp"
 #include "ngraph/op/fused/lstm_cell.hpp"
 #include "ngraph/op/fused/matmul.hpp"
+#include "ngraph/op/fused/mvn.hpp"
+#include "ngraph/op/fused/normalize_l2.hpp"
+#include "ngraph/op/fused/optimizer_update.hpp"
+#include "ngraph/op/fused/prelu.hpp"
+#include "ngraph/op/fused/selu.hpp"
+#include "ngraph/op/fused/shuffle_channels.hpp"
 #include "ngraph/op/fused/softmax_crossentropy.hpp"
+#include "ngraph/op/fused/space_to_depth.hpp"
+#include "ngraph/op/fused/squared_difference.hpp"
 #include "ngraph/op/gather.hpp"
 #include "ngraph/op/gather_nd.hpp"
 #include "ngraph/op/get_output_element.hpp"
@@ -143,6 +158,8 @@
 #include "ngraph/op/topk.hpp"
 #include "ngraph/op/xor.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
+#include "ngraph/pass/allreduce_sharding.hpp"
 #include "ngraph/pass/batch_fusion.hpp"
 #include "ngraph/pass/common_function_collection.hpp"
 #include "ngraph/pass/constant_folding.hpp"
@@ -159,8 +176,10 @@
 #include "ngraph/pass/nop_elimination.hpp"
 #include "ngraph/pass/opset0_downgrade.hpp"
 #include "ngraph/pass/propagate_cacheability.hpp"
+#include "ngraph/pass/quantization_folding.hpp"
 #include "ngraph/pass/reshape_elimination.hpp"
 #include "ngraph/pass/reshape_sinking.hpp"
+#include "ngraph/pass/tensor_iterator_hoisting.hpp"
 #include "ngraph/pass/zero_dim_tensor_elimination.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
@@ -171,11 +190,14 @@
 #include "ngraph/runtime/cpu/cpu_emitter.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_hardware_counters.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/runtime/cpu/cpu_visualize_tree.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
+#include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
@@ -184,27 +206,36 @@
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/deconv.hpp"
 #include "ngraph/runtime/cpu/op/dropout.hpp"
+#include "ngraph/runtime/cpu/op/embedding_bag_sum.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
 #include "ngraph/runtime/cpu/op/gelu_backprop.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/quantized_add.hpp"
 #include "ngraph/runtime/cpu/op/quantized_matmul.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_assignment.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_async_allreduce.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_collapse_dims.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_dequantizing_dot.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_dropout_mask_packing.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_elementwise_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_memory_assignment.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_memory_optimization.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_mixed_precision.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mkldnn_primitive_build.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_sparse_dot.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_workspace_insertion.hpp"
 
 using namespace std;
@@ -309,8 +340,6 @@ static string emit_string_array(const vector<string>& s, size_t max_line_length)
     return ss.str();
 }
 
-static StaticInitializers s_static_initializers(s_output_dir);
-
 #define TI(x) type_index(typeid(x))
 
 static const runtime::cpu::OpMap dispatcher{
@@ -355,6 +384,7 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::Slice), &runtime::cpu::CPU_Emitter::emit<op::Slice>},
     {TI(ngraph::op::Sum), &runtime::cpu::CPU_Emitter::emit<op::Sum>},
     {TI(ngraph::op::EmbeddingLookup), &runtime::cpu::CPU_Emitter::emit<op::EmbeddingLookup>},
+    {TI(ngraph::op::EmbeddingBagSum), &runtime::cpu::CPU_Emitter::emit<op::EmbeddingBagSum>},
     {TI(ngraph::op::Exp), &runtime::cpu::CPU_Emitter::emit<op::Exp>},
     {TI(ngraph::op::Sin), &runtime::cpu::CPU_Emitter::emit<op::Sin>},
     {TI(ngraph::op::Sinh), &runtime::cpu::CPU_Emitter::emit<op::Sinh>},
@@ -391,6 +421,7 @@ static const runtime::cpu::OpMap dispatcher{
      &runtime::cpu::CPU_Emitter::emit<op::QuantizedConvolutionBiasSignedAdd>},
     {TI(ngraph::op::QuantizedDotBias), &runtime::cpu::CPU_Emitter::emit<op::QuantizedDotBias>},
     {TI(ngraph::op::QuantizedDot), &runtime::cpu::CPU_Emitter::emit<op::QuantizedDot>},
+    {TI(ngraph::op::QuantizedAdd), &runtime::cpu::CPU_Emitter::emit<op::QuantizedAdd>},
     {TI(ngraph::op::QuantizedMatmul), &runtime::cpu::CPU_Emitter::emit<op::QuantizedMatmul>},
     {TI(ngraph::op::ConvolutionRelu), &runtime::cpu::CPU_Emitter::emit<op::ConvolutionRelu>},
     {TI(ngraph::op::QuantizedConvolution),
@@ -455,6 +486,7 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::Tile), &runtime::cpu::CPU_Emitter::emit<op::Tile>},
     {TI(ngraph::op::Gelu), &runtime::cpu::CPU_Emitter::emit<op::Gelu>},
     {TI(ngraph::op::GeluBackprop), &runtime::cpu::CPU_Emitter::emit<op::GeluBackprop>},
+    {TI(ngraph::op::FusedElementwise), &runtime::cpu::CPU_Emitter::emit<op::FusedElementwise>},
     {TI(ngraph::op::Round), &runtime::cpu::CPU_Emitter::emit<op::Round>}};
 
 static void
@@ -466,8 +498,8 @@ static void
     auto ctype = node->get_element_type().c_type_string();
     writer << "{   // A " << funcname << " for" << node->get_name() << "\n";
     writer.indent++;
-    writer << " ngraph::check_fp_values<" << ctype << "," << funcname << "> (\"" << node->get_name()
-           << "\", (" << ctype << "*)" << out[0].get_name() << ", " << out[0].get_size() << ");\n";
+    writer << " ngraph::check_fp_values_" << funcname << "(\"" << node->get_name() << "\", ("
+           << ctype << "*)" << out[0].get_name() << ", " << out[0].get_size() << ");\n";
     writer.indent--;
     writer << "}\n";
 }
@@ -509,7 +541,7 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
                          placeholders::_2);
     pass_manager.register_pass<ngraph::pass::CommonFunctionCollection>(
         femitter, node_function_map, common_function_string);
-    pass_manager.run_passes(m_function);
+    m_pass_report = pass_manager.run_passes(m_function);
 
     list<shared_ptr<Node>> ordered_ops = m_function->get_ordered_ops();
 
@@ -658,7 +690,12 @@ using namespace ngraph::runtime;
         ngraph::op::Constant* c = as_type<ngraph::op::Constant>(node.get());
         if (c)
         {
+            if (m_numa_node < 0)
+            {
+                c->intern_data();
+            }
             m_active_constants.push_back(node);
+            m_constant_bytes += shape_size(c->get_shape()) * c->get_element_type().size();
             shared_ptr<descriptor::Tensor> tv = node->get_outputs()[0].get_tensor_ptr();
             string type = tv->get_element_type().c_type_string();
             writer << "static " << type << "* " << tv->get_name() << " = ((" << type << "*)("
@@ -1095,6 +1132,8 @@ using namespace ngraph::runtime;
     // End generated function
     writer += "}\n\n";
 
+    // Clear the output of previous runs on first use rather than when the library is loaded
+    static StaticInitializers s_static_initializers(s_output_dir);
     // TODO: Cleanup and make this a utility function
     string filename = file_util::path_join(s_output_dir, m_function_name + "_codegen.cpp");
     string code = writer.get_code();
@@ -1105,13 +1144,23 @@ using namespace ngraph::runtime;
 
     m_compiler->set_precompiled_header_source(pch_header_source);
 
-    auto codegen_module = m_compiler->compile(code);
-
-    if (codegen_module == nullptr)
+    // With NGRAPH_CODEGEN_CACHE_DIR set, code compiled from the same source by an earlier
+    // process is loaded instead of being compiled again
+    string cache_key = m_compiler->get_cache_key(code);
+    if (m_execution_engine->add_cached_module(cache_key))
     {
-        throw runtime_error("function failed to compile");
+        NGRAPH_DEBUG << "Loaded " << m_function_name << " from the codegen cache";
+    }
+    else
+    {
+        auto codegen_module = m_compiler->compile(code);
+
+        if (codegen_module == nullptr)
+        {
+            throw runtime_error("function failed to compile");
+        }
+        m_execution_engine->add_module(codegen_module, cache_key);
     }
-    m_execution_engine->add_module(codegen_module);
     m_execution_engine->finalize();
 
     m_compiled_init_ctx_func = m_execution_engine->find_function<InitContextFuncTy>("init_cg_ctx");
@@ -1172,6 +1221,7 @@ using namespace ngraph::runtime;
         }
     }
 
+    set_live_tensor_bytes();
     m_is_compiled = true;
     if (m_release_function && !m_emit_timing)
     {
@@ -1181,13 +1231,102 @@ using namespace ngraph::runtime;
 
 #endif // !defined(NGRAPH_DEX_ONLY)
 
+// The native kernels of the fused ops in builder/activation.cpp, builder/normalize.cpp and
+// builder/shuffle.cpp cover fewer cases than their decompositions. False for the nodes that they
+// cannot run, which are decomposed instead.
+static bool native_fused_op_supported(const Node& node)
+{
+    auto& et = node.get_input_element_type(0);
+    bool is_real = et == element::f32 || et == element::f64;
+    if (is_type<ngraph::op::Clamp>(&node) || is_type<ngraph::op::Elu>(&node) ||
+        is_type<ngraph::op::GRN>(&node) || is_type<ngraph::op::MVN>(&node) ||
+        is_type<ngraph::op::NormalizeL2>(&node))
+    {
+        return is_real;
+    }
+    else if (is_type<ngraph::op::HardSigmoid>(&node) || is_type<ngraph::op::Selu>(&node))
+    {
+        return is_real && shape_size(node.get_input_shape(1)) == 1 &&
+               shape_size(node.get_input_shape(2)) == 1;
+    }
+    else if (is_type<ngraph::op::MatMul>(&node))
+    {
+        // Batched products run as one batch_gemm when every operand's leading axes are either all
+        // 1 or the output's, see builder/matmul_bias.cpp. Plain matrices still decompose to Dot.
+        auto& out_shape = node.get_output_shape(0);
+        auto& a_shape = node.get_input_shape(0);
+        auto& b_shape = node.get_input_shape(1);
+        if (!is_real || a_shape.size() < 2 || b_shape.size() < 2 || out_shape.size() < 3)
+        {
+            return false;
+        }
+        auto batch_size = [](const Shape& shape) {
+            return shape_size(Shape(shape.begin(), shape.end() - 2));
+        };
+        auto batch = batch_size(out_shape);
+        return (batch_size(a_shape) == 1 || batch_size(a_shape) == batch) &&
+               (batch_size(b_shape) == 1 || batch_size(b_shape) == batch);
+    }
+    else if (is_type<ngraph::op::BatchMatMulTranspose>(&node))
+    {
+        return is_real;
+    }
+    else if (is_type<ngraph::op::SquaredDifference>(&node))
+    {
+        return is_real && node.get_input_shape(0) == node.get_input_shape(1);
+    }
+    else if (is_type<ngraph::op::PRelu>(&node))
+    {
+        // One slope, one per element or one per entry of an axis, see builder/activation.cpp
+        auto& data_shape = node.get_input_shape(0);
+        auto& slope_shape = node.get_input_shape(1);
+        size_t slopes = shape_size(slope_shape);
+        bool per_axis = slope_shape.size() == 1 &&
+                        find(data_shape.begin(), data_shape.end(), slopes) != data_shape.end();
+        return is_real && node.get_input_element_type(1) == et &&
+               (slopes == 1 || per_axis || slope_shape == data_shape);
+    }
+    else if (is_type<ngraph::op::DepthToSpace>(&node) ||
+             is_type<ngraph::op::SpaceToDepth>(&node) ||
+             is_type<ngraph::op::ShuffleChannels>(&node))
+    {
+        return et != element::bf16 && et != element::f16;
+    }
+    else if (is_type<ngraph::op::SoftmaxCrossEntropy>(&node) ||
+             is_type<ngraph::op::SoftmaxCrossEntropyBackprop>(&node))
+    {
+        // [n, c] logits with soft labels of the same type or [n, 1] i32/i64 hard labels, see
+        // builder/softmax_crossentropy.cpp. The backprop takes a [n, 1] or [n, c] delta first.
+        auto forward = as_type<const ngraph::op::SoftmaxCrossEntropy>(&node);
+        auto backprop = as_type<const ngraph::op::SoftmaxCrossEntropyBackprop>(&node);
+        bool soft_label = forward ? forward->get_soft_label() : backprop->get_soft_label();
+        size_t data = forward ? 0 : 1;
+        auto& data_shape = node.get_input_shape(data);
+        auto& label_shape = node.get_input_shape(data + 1);
+        auto& label_type = node.get_input_element_type(data + 1);
+        if (!is_real || data_shape.size() != 2 || node.get_input_element_type(data) != et ||
+            (backprop && node.get_input_shape(0) != data_shape &&
+             node.get_input_shape(0) != Shape{data_shape[0], 1}))
+        {
+            return false;
+        }
+        return soft_label ? label_type == et && label_shape == data_shape
+                          : (label_type == element::i32 || label_type == element::i64) &&
+                                label_shape == Shape{data_shape[0], 1};
+    }
+    return true;
+}
+
 void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     ngraph::pass::Manager& pass_manager, ngraph::pass::PassConfig& pass_config)
 {
     auto pass_map = pass_config.get_enables();
 
     auto dex = is_direct_execution();
-    auto is_supported = [dex](const Node& node) {
+    // The ONNX recurrent ops are only kept when ONNXRNNFusion is there to lower them
+    auto onnx_rnn_fusion =
+        pass_map.find("ONNXRNNFusion") == pass_map.end() || pass_map["ONNXRNNFusion"];
+    auto is_supported = [dex, onnx_rnn_fusion](const Node& node) {
 #ifdef NGRAPH_MLIR_ENABLE
         if (std::getenv("NGRAPH_MLIR") != nullptr && std::getenv("NGRAPH_MLIR_CALLBACK") != nullptr)
         {
@@ -1223,6 +1362,12 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
                 return false;
             }
         }
+        else if (typeid(ngraph::op::GRUCell) == typeid(node) ||
+                 typeid(ngraph::op::RNNCell) == typeid(node) ||
+                 typeid(ngraph::op::LSTMSequence) == typeid(node))
+        {
+            return onnx_rnn_fusion && runtime::cpu::pass::ONNXRNNFusion::is_fusible(node);
+        }
         else if (typeid(ngraph::op::GeluBackpropFactor) == typeid(node))
         {
 #if MKLDNN_VERSION_MAJOR < 1
@@ -1233,21 +1378,35 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
             return false;
 #endif
         }
+        // Gelu runs as one fused f32 kernel, see kernel/isa.hpp
         else if (typeid(ngraph::op::Gelu) == typeid(node))
         {
-#if MKLDNN_VERSION_MAJOR < 1
-            // TODO: (gauri): need to differentiate which implementation : erf vs tanh
+            return node.get_input_element_type(0) == element::f32;
+        }
+        // The native LayerNorm kernel only handles floating point types
+        else if (typeid(ngraph::op::LayerNorm) == typeid(node) &&
+                 node.get_input_element_type(0) != element::f32 &&
+                 node.get_input_element_type(0) != element::f64)
+        {
             return false;
-#else
-            // TODO: will be supported in mkldnn v1.1
+        }
+        // So do the optimizer update kernels
+        else if ((typeid(ngraph::op::SGDMomentumUpdate) == typeid(node) ||
+                  typeid(ngraph::op::AdamUpdate) == typeid(node)) &&
+                 node.get_input_element_type(0) != element::f32 &&
+                 node.get_input_element_type(0) != element::f64)
+        {
             return false;
-#endif
         }
         // GroupConvolution is only supported with MKLDNN
         else if (auto conv = as_type<ngraph::op::GroupConvolution>(const_cast<Node*>(&node)))
         {
             return mkldnn_utils::can_use_mkldnn_conv<ngraph::op::GroupConvolution>(conv);
         }
+        else if (!native_fused_op_supported(node))
+        {
+            return false;
+        }
 
         if (dex)
         {
@@ -1273,14 +1432,22 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     };
 
     REGISTER_KNOBBED_PASS(LikeReplacement, true, ngraph::pass)
+    // Runs before the optimizer updates are decomposed; the collectives are only built in DEX
+    if (dex)
+    {
+        REGISTER_KNOBBED_PASS(AllReduceSharding, false, ngraph::pass)
+    }
     REGISTER_KNOBBED_PASS_WITH_ARGS(FusedOpDecomposition, true, ngraph::pass, is_supported)
     REGISTER_KNOBBED_PASS(Opset0Downgrade, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(ImplicitBroadcastElimination, true, ngraph::pass)
+    REGISTER_KNOBBED_PASS(TensorIteratorHoisting, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(NopElimination, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(ZeroDimTensorElimination, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(LSTMFusion, true, runtime::cpu::pass)
+    REGISTER_KNOBBED_PASS(ONNXRNNFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(RNNFusion, true, runtime::cpu::pass)
-    REGISTER_KNOBBED_PASS(AlgebraicSimplification, true, ngraph::pass)
+    // Divisions by constants are left for the fusions below, which match them
+    REGISTER_KNOBBED_PASS_WITH_ARGS(AlgebraicSimplification, true, ngraph::pass, false)
     REGISTER_KNOBBED_PASS(MultiLayerRNNFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(BiDirectionalRnn, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPURnnMatFusion, true, runtime::cpu::pass)
@@ -1292,15 +1459,38 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
         CoreFusion, true, ngraph::pass, ngraph::pass::FusionType::ALL_FUSIONS)
     REGISTER_KNOBBED_PASS_WITH_ARGS(FusedOpDecomposition, true, ngraph::pass, is_supported)
     REGISTER_KNOBBED_PASS(CPUPreFusion, true, runtime::cpu::pass)
+    // Run before Dot is fused into MatmulBias; the kernels are only built in DEX mode
+    if (dex)
+    {
+        REGISTER_KNOBBED_PASS(CPUSparseDot, true, runtime::cpu::pass)
+        REGISTER_KNOBBED_PASS(CPUDequantizingDot,
+                              runtime::cpu::pass::CPUDequantizingDot::is_enabled_by_default(),
+                              runtime::cpu::pass)
+    }
 
     // Disable CPUFusion if MLIR is enabled to preserve core ops.
     if (std::getenv("NGRAPH_MLIR") == nullptr)
     {
         REGISTER_KNOBBED_PASS(CPUFusion, true, runtime::cpu::pass)
+        // The packed mask kernels are only built in DEX mode
+        if (dex)
+        {
+            REGISTER_KNOBBED_PASS(CPUDropoutMaskPacking, true, runtime::cpu::pass)
+        }
     }
     REGISTER_KNOBBED_PASS(CPUQuantFusion, true, runtime::cpu::pass)
+    REGISTER_KNOBBED_PASS(QuantizationFolding, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(CPUHorizontalFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUCollapseDims, true, runtime::cpu::pass)
+    REGISTER_KNOBBED_PASS(CPUMixedPrecision,
+                          runtime::cpu::pass::CPUMixedPrecision::is_enabled_by_default(),
+                          runtime::cpu::pass)
+    REGISTER_KNOBBED_PASS(AllReduceBucketing, true, ngraph::pass)
+    // Split collectives are only built in DEX mode
+    if (dex)
+    {
+        REGISTER_KNOBBED_PASS(CPUAsyncAllReduce, true, runtime::cpu::pass)
+    }
 
 #ifdef NGRAPH_MLIR_ENABLE
     if (std::getenv("NGRAPH_MLIR") != nullptr)
@@ -1313,6 +1503,9 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUWorkspaceInsertion, true, runtime::cpu::pass, nv_cwi, false)
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUAssignment, true, runtime::cpu::pass, this)
     REGISTER_KNOBBED_PASS_WITH_ARGS(ConstantFolding, true, ngraph::pass, GetGlobalCFDispatcherCPU())
+    // Now that the fusions have run and sqrt(constant) is folded, divide by reciprocals
+    REGISTER_KNOBBED_PASS_WITH_ARGS(AlgebraicSimplification, true, ngraph::pass, true)
+    REGISTER_KNOBBED_PASS(CPUElementwiseFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPULayout, true, runtime::cpu::pass, this)
     REGISTER_KNOBBED_PASS_WITH_ARGS(
         CommonSubexpressionElimination, true, ngraph::pass, runtime::cpu::get_cse_handlers_map())
@@ -1324,8 +1517,15 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
         PropagateCacheability, true, ngraph::pass, runtime::cpu::get_annotations_factory())
     bool reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
                         pass_config.get_pass_attribute("ReuseMemory");
+    auto allocation_scheme = pass_config.get_pass_attribute("CPUMemoryAssignment::PackMemory")
+                                 ? ngraph::pass::MemoryManager::allocation_scheme::PACKED
+                                 : ngraph::pass::MemoryManager::allocation_scheme::FIRST_FIT;
     pass_manager.register_pass<runtime::cpu::pass::CPUMemoryAssignment>(
-        bufferID_to_tensorSets, tensor_to_bufferID, size_t(s_memory_pool_alignment), !reuse_memory);
+        bufferID_to_tensorSets,
+        tensor_to_bufferID,
+        size_t(s_memory_pool_alignment),
+        !reuse_memory,
+        allocation_scheme);
 
     pass_manager.get_state().set_visualize_tree_ops_map(runtime::cpu::get_visualize_tree_ops_map());
 }
@@ -1344,6 +1544,98 @@ bool runtime::cpu::CPU_ExternalFunction::computes_result(Node* node)
     return false;
 }
 
+// Elementwise ops too small to amortize waking the arena's threads run on fewer threads,
+// one per s_elementwise_elements_per_thread output elements. Other ops use the whole arena.
+static const size_t s_elementwise_elements_per_thread = 16384;
+
+static int default_op_num_threads(const Node& node)
+{
+    if (!(node.is_unary_elementwise_arithmetic() || node.is_binary_elementwise_arithmetic() ||
+          node.is_binary_elementwise_comparison() || node.is_binary_elementwise_logical()))
+    {
+        return 0;
+    }
+    size_t max_threads = runtime::cpu::executor::GetCPUExecutor().get_num_threads_per_pool();
+    size_t threads = std::max<size_t>(
+        shape_size(node.get_output_shape(0)) / s_elementwise_elements_per_thread, 1);
+    return threads < max_threads ? static_cast<int>(threads) : 0;
+}
+
+void runtime::cpu::CPU_ExternalFunction::wait_for_streamed_inputs(CPURuntimeContext* ctx,
+                                                                 size_t index)
+{
+    for (auto arg : m_op_input_args[index])
+    {
+        if (auto& fence = ctx->input_fences[arg])
+        {
+            fence->wait();
+        }
+    }
+}
+
+void runtime::cpu::CPU_ExternalFunction::set_op_num_threads(const vector<int>& num_threads)
+{
+    NGRAPH_CHECK(num_threads.size() == m_op_num_threads.size(),
+                 "Expected ",
+                 m_op_num_threads.size(),
+                 " op thread counts, got ",
+                 num_threads.size());
+    m_op_num_threads = num_threads;
+}
+
+void runtime::cpu::CPU_ExternalFunction::tune_op_num_threads(const function<void()>& call,
+                                                             size_t calls_per_candidate)
+{
+    NGRAPH_CHECK(m_direct_execution && m_is_built, "Intra-op tuning needs a built DEX function");
+    // Primitives and the first-iteration paths are not representative of later calls
+    call();
+
+    size_t num_ops = m_op_num_threads.size();
+    vector<int> best = m_op_num_threads;
+    vector<int64_t> best_durations(num_ops, 0);
+    vector<bool> measured(num_ops, false);
+    int max_threads = static_cast<int>(executor::GetCPUExecutor().get_num_threads_per_pool());
+    m_tuning_durations.reset(new atomic<int64_t>[num_ops]);
+    try
+    {
+        for (int candidate = 1;; candidate = min(candidate * 2, max_threads))
+        {
+            for (size_t i = 0; i < num_ops; i++)
+            {
+                m_op_num_threads[i] = candidate;
+                m_tuning_durations[i] = 0;
+            }
+            for (size_t c = 0; c < calls_per_candidate; c++)
+            {
+                call();
+            }
+            for (size_t i = 0; i < num_ops; i++)
+            {
+                // Ops skipped by caching measure nothing and keep their default
+                int64_t duration = m_tuning_durations[i];
+                if (duration > 0 && (!measured[i] || duration < best_durations[i]))
+                {
+                    measured[i] = true;
+                    best_durations[i] = duration;
+                    best[i] = candidate < max_threads ? candidate : 0;
+                }
+            }
+            if (candidate >= max_threads)
+            {
+                break;
+            }
+        }
+    }
+    catch (...)
+    {
+        m_tuning_durations.reset();
+        m_op_num_threads = best;
+        throw;
+    }
+    m_tuning_durations.reset();
+    m_op_num_threads = best;
+}
+
 static void dump_one_kernel_with_type(runtime::cpu::CPU_DebugTracer& debug_tracer,
                                       runtime::cpu::TensorTracerAttributes& t_attrs,
                                       const std::string& kernel_name,
@@ -1351,6 +1643,14 @@ static void dump_one_kernel_with_type(runtime::cpu::CPU_DebugTracer& debug_trace
                                       const std::string& tensor_name,
                                       const std::string& in_out)
 {
+    if (debug_tracer.is_stats_only())
+    {
+        auto stats = runtime::cpu::compute_tensor_stats(
+            tensor, t_attrs.m_type_of_element, t_attrs.m_number_of_elements);
+        debug_tracer.dump_tensor_stats(kernel_name, tensor_name, stats, t_attrs.m_t_shape, in_out);
+        return;
+    }
+
     switch (t_attrs.m_type_of_element)
     {
     case element::Type_t::f32:
@@ -1435,6 +1735,153 @@ void runtime::cpu::CPU_ExternalFunction::dump_one_kernel(CPU_DebugTracer& debug_
     }
 }
 
+template <typename T>
+static bool parallel_any_non_finite(const T* data, size_t count, bool nan, int arena)
+{
+    auto check = [nan](const T* begin, size_t n) {
+        return nan ? ngraph::any_isnan(begin, n) : ngraph::any_isinf(begin, n);
+    };
+
+    const size_t block_size = 1 << 14;
+    if (count <= block_size)
+    {
+        return check(data, count);
+    }
+
+    std::atomic<bool> found{false};
+    runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+        ceil_div(count, block_size),
+        Eigen::TensorOpCost(block_size * sizeof(T), 0, block_size),
+        [&](Eigen::Index first, Eigen::Index last) {
+            size_t begin = first * block_size;
+            size_t end = std::min(count, static_cast<size_t>(last) * block_size);
+            if (!found.load(std::memory_order_relaxed) && check(data + begin, end - begin))
+            {
+                found.store(true, std::memory_order_relaxed);
+            }
+        });
+    return found.load();
+}
+
+void runtime::cpu::CPU_ExternalFunction::check_fp_outputs(CPURuntimeContext* ctx,
+                                                          size_t index,
+                                                          int arena)
+{
+    auto& attrs = m_op_attrs.at(index);
+    size_t buffer = 0;
+    for (auto& t_attrs : attrs.m_outputs_tensor_attrs)
+    {
+        bool is_f32 = t_attrs.m_type_of_element == element::f32;
+        if (!is_f32 && t_attrs.m_type_of_element != element::f64)
+        {
+            continue;
+        }
+        void* data = ctx->buffer_data[m_fp_check_buffers.at(index).at(buffer++)];
+        size_t count = t_attrs.m_number_of_elements;
+        for (bool nan : {true, false})
+        {
+            if (!(nan ? m_nan_check : m_inf_check))
+            {
+                continue;
+            }
+            bool found = is_f32 ? parallel_any_non_finite(
+                                      static_cast<const float*>(data), count, nan, arena)
+                                : parallel_any_non_finite(
+                                      static_cast<const double*>(data), count, nan, arena);
+            if (found)
+            {
+                throw std::runtime_error(string("Discovered ") + (nan ? "NaN" : "Inf") + " in '" +
+                                         op_names.at(index) + "'");
+            }
+        }
+    }
+}
+
+void runtime::cpu::CPU_ExternalFunction::prebuild_primitives()
+{
+#if MKLDNN_VERSION_MAJOR >= 1
+    if (m_direct_execution && m_mkldnn_emitter)
+    {
+        m_mkldnn_emitter->prebuild_primitives(m_primitive_build_threads);
+    }
+#endif
+}
+
+void runtime::cpu::CPU_ExternalFunction::update_constants(
+    const std::map<std::string, std::shared_ptr<runtime::Tensor>>& constants)
+{
+    if (!m_direct_execution)
+    {
+        throw ngraph_error("Constants can only be updated in direct execution mode");
+    }
+
+    // The new table is published only once every constant is checked, so a failed update
+    // changes nothing
+    std::lock_guard<std::mutex> lock(m_constant_updates_mutex);
+    auto updates = m_constant_updates ? make_shared<ConstantUpdates>(*m_constant_updates)
+                                      : make_shared<ConstantUpdates>();
+    updates->version = m_constants_version.load() + 1;
+    for (auto& named : constants)
+    {
+        auto slots = m_constant_slots.find(named.first);
+        if (slots == m_constant_slots.end())
+        {
+            throw ngraph_error("Constant '" + named.first +
+                               "' is not in the compiled function. It may have been folded "
+                               "into another constant during compilation");
+        }
+        auto& tensor = named.second;
+        for (auto& slot : slots->second)
+        {
+            if (tensor->get_element_type() != slot.element_type ||
+                tensor->get_shape() != slot.shape)
+            {
+                throw ngraph_error("Data for constant '" + named.first + "' must be " +
+                                   slot.element_type.c_type_string() + " of shape " +
+                                   vector_to_string(slot.shape));
+            }
+            if (!slot.has_default_layout)
+            {
+                throw ngraph_error("Constant '" + named.first +
+                                   "' was given an MKLDNN layout during compilation");
+            }
+            size_t size = shape_size(slot.shape) * slot.element_type.size();
+            auto buffer = make_shared<AlignedBuffer>(size, s_memory_pool_alignment);
+            tensor->read(buffer->get_ptr(), size);
+
+            ConstantUpdates::Entry entry{slot.buffer_index, buffer, slot.stale, updates->version};
+            auto it = find_if(updates->entries.begin(),
+                              updates->entries.end(),
+                              [&](const ConstantUpdates::Entry& existing) {
+                                  return existing.buffer_index == slot.buffer_index;
+                              });
+            if (it == updates->entries.end())
+            {
+                updates->entries.push_back(entry);
+            }
+            else
+            {
+                *it = entry;
+            }
+        }
+    }
+    atomic_store(&m_constant_updates, shared_ptr<const ConstantUpdates>(updates));
+    m_constants_version.store(updates->version, std::memory_order_release);
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::get_constant_bytes() const
+{
+    size_t bytes = m_constant_bytes;
+    if (auto updates = atomic_load(&m_constant_updates))
+    {
+        for (auto& entry : updates->entries)
+        {
+            bytes += entry.buffer->size();
+        }
+    }
+    return bytes;
+}
+
 void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_config)
 {
     if (m_is_built)
@@ -1462,7 +1909,10 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         pass_manager.set_per_pass_validation(false);
     }
     register_common_passes(pass_manager, pass_config);
-    pass_manager.run_passes(m_function, false);
+    m_pass_report = pass_manager.run_passes(m_function, false);
+
+    m_nan_check = std::getenv("NGRAPH_CPU_NAN_CHECK") != nullptr;
+    m_inf_check = std::getenv("NGRAPH_CPU_INF_CHECK") != nullptr;
 
     static runtime::cpu::CPU_DebugTracer debug_tracer;
     if (std::getenv("NGRAPH_CPU_DEBUG_TRACER") != nullptr)
@@ -1535,9 +1985,33 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         {
             auto output_tensor = &node->get_output_tensor();
             m_buffer_indices[output_tensor->get_name()] = buffer_index;
-            constant_tensor_data.emplace_back(
-                buffer_index,
-                const_cast<void*>(static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr()));
+            auto constant = static_pointer_cast<ngraph::op::Constant>(node);
+            if (m_numa_node < 0)
+            {
+                // Share the data with identical constants of other executables
+                constant->intern_data();
+            }
+            else if (numa::is_enabled())
+            {
+                // Not interned, so that executables placed on other nodes keep copies of
+                // their own
+                numa::bind_memory_to_node(
+                    const_cast<void*>(constant->get_data_ptr()),
+                    shape_size(constant->get_shape()) * constant->get_element_type().size(),
+                    m_numa_node);
+            }
+            constant_tensor_data.emplace_back(buffer_index,
+                                              const_cast<void*>(constant->get_data_ptr()));
+            m_constant_bytes += shape_size(constant->get_shape()) *
+                                constant->get_element_type().size();
+            auto layout = static_pointer_cast<runtime::cpu::LayoutDescriptor>(
+                output_tensor->get_tensor_layout());
+            m_constant_slots[constant->get_friendly_name()].push_back(
+                ConstantSlot{buffer_index,
+                             constant->get_element_type(),
+                             constant->get_shape(),
+                             !layout || !layout->is_mkldnn_layout(),
+                             tensor_stale[output_tensor->get_name()]});
             auto tensor_set = get_tensor_set(output_tensor);
             // process all tensors in the set containing the output tensor of the constant
             for (auto& ele_t : tensor_set)
@@ -1599,6 +2073,12 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     // After processing inputs, outputs, constants, and intermediates, set the buffer size.
     m_buffer_size = buffer_index;
 
+    unordered_map<size_t, size_t> input_buffer_args;
+    for (auto& p : function_input_index_offset)
+    {
+        input_buffer_args[get<0>(p)] = get<1>(p);
+    }
+
     for (shared_ptr<Node> node : m_function->get_ordered_ops())
     {
         if (node->is_parameter() || node->is_constant())
@@ -1639,6 +2119,18 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
 
         m_op_attrs.emplace_back(node->description(), out_names, in_names, t_out_attrs, t_in_attrs);
         op_names.push_back(node->get_name());
+        if (m_nan_check || m_inf_check)
+        {
+            m_fp_check_buffers.emplace_back();
+            for (size_t i = 0; i < out.size(); i++)
+            {
+                if (out[i].get_element_type() == element::f32 ||
+                    out[i].get_element_type() == element::f64)
+                {
+                    m_fp_check_buffers.back().push_back(get_buffer_index(out_names[i]));
+                }
+            }
+        }
         handler->second(this, node.get(), in, out);
 
         auto cacheable = true;
@@ -1715,6 +2207,17 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         enable_nodename_list.emplace_back(make_pair(enable, node->get_name()));
 
         m_perf_counters.emplace_back(node, 0, 0);
+        m_op_num_threads.push_back(default_op_num_threads(*node));
+
+        m_op_input_args.emplace_back();
+        for (const auto& name : in_names)
+        {
+            auto it = input_buffer_args.find(get_buffer_index(name));
+            if (it != input_buffer_args.end())
+            {
+                m_op_input_args.back().push_back(it->second);
+            }
+        }
     }
 
     if ((std::getenv("NGRAPH_DEX_DEBUG") != nullptr))
@@ -1780,40 +2283,111 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     }
     // This check ensures we have exactly one functor for Op.
     NGRAPH_CHECK(m_op_attrs.size() == functors.size());
+    set_live_tensor_bytes();
+
+    // NGRAPH_CPU_PREFETCH_DISTANCE=<n> reads the weights and inputs of each op on a helper
+    // thread while the op n places before it runs
+    if (auto distance = std::getenv("NGRAPH_CPU_PREFETCH_DISTANCE"))
+    {
+        if (std::atoi(distance) > 0)
+        {
+            build_prefetch_plan(static_cast<size_t>(std::atoi(distance)));
+        }
+    }
+
+    // With more than one executor thread pool, independent ops run concurrently on one
+    // inter-op worker per pool
+    if (executor::GetCPUExecutor().get_num_thread_pools() > 1 &&
+#if defined(NGRAPH_TBB_ENABLE)
+        !m_use_tbb &&
+#endif
+        (!debug_tracer.tracing_is_enabled() || debug_tracer.is_sampling()) &&
+        std::getenv("NGRAPH_CPU_DISABLE_INTER_OP_SCHEDULER") == nullptr)
+    {
+        build_inter_op_scheduler();
+    }
 
     executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
         cpu::Timestamp start_ts, end_ts;
         uint64_t profiler_count = 0;
 
-        if (ctx->first_iteration)
+        // The pool moves when it is shared between call frames
+        void* memory_pool = ctx->memory_buffers[0]->get_ptr();
+        if (ctx->first_iteration || memory_pool != ctx->bound_memory_pool)
         {
             for (auto& p : intermediates_offsets)
             {
-                ctx->buffer_data[p.first] =
-                    static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr()) + p.second;
+                ctx->buffer_data[p.first] = static_cast<uint8_t*>(memory_pool) + p.second;
             }
+            ctx->bound_memory_pool = memory_pool;
+        }
 
+        if (ctx->first_iteration)
+        {
             for (auto& p : constant_tensor_data)
             {
                 ctx->buffer_data[p.first] = p.second;
             }
         }
 
+        // Ops reading a constant swapped in since this context last ran must not reuse the
+        // values they cached, so the constant is stale for one call
+        if (m_constants_version.load(std::memory_order_acquire) != ctx->constants_version)
+        {
+            auto updates = atomic_load(&m_constant_updates);
+            for (auto& entry : updates->entries)
+            {
+                ctx->buffer_data[entry.buffer_index] = entry.buffer->get_ptr();
+                entry.stale.get() = entry.version > ctx->constants_version;
+            }
+            ctx->constants_version = updates->version;
+            ctx->constant_updates = updates;
+        }
+        else if (ctx->constant_updates)
+        {
+            auto updates = static_cast<const ConstantUpdates*>(ctx->constant_updates.get());
+            for (auto& entry : updates->entries)
+            {
+                entry.stale.get() = false;
+            }
+        }
+
+        // The tensors of a pipeline stage do not move, so they are only bound again when the
+        // context ran other tensors since
+        bool bind_io = ctx->io_binding == 0 || ctx->io_binding != ctx->bound_io_binding;
         for (const auto& p : function_input_index_offset)
         {
-            ctx->buffer_data[get<0>(p)] = static_cast<uint8_t*>(inputs[get<1>(p)]) + get<2>(p);
+            if (bind_io)
+            {
+                ctx->buffer_data[get<0>(p)] =
+                    static_cast<uint8_t*>(inputs[get<1>(p)]) + get<2>(p);
+            }
             get<3>(p).get() = ctx->p_en[get<1>(p)];
         }
 
-        for (const auto& p : function_output_index_offset)
+        if (bind_io)
         {
-            ctx->buffer_data[get<0>(p)] = static_cast<uint8_t*>(outputs[get<1>(p)]) + get<2>(p);
+            for (const auto& p : function_output_index_offset)
+            {
+                ctx->buffer_data[get<0>(p)] =
+                    static_cast<uint8_t*>(outputs[get<1>(p)]) + get<2>(p);
+            }
         }
+        ctx->bound_io_binding = ctx->io_binding;
 
         auto functor = functors.begin();
 #if defined(NGRAPH_TBB_ENABLE)
         if (m_use_tbb)
         {
+            // The flow graph does not wait for streamed inputs op by op
+            for (auto& fence : ctx->input_fences)
+            {
+                if (fence)
+                {
+                    fence->wait();
+                }
+            }
+
             // Build the flow graph
             if (ctx->first_iteration)
             {
@@ -1836,7 +2410,8 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                                     {
                                         start_ts = cpu::Clock::now();
                                     }
-                                    CPUExecutionContext ectx{0};
+                                    CPUExecutionContext ectx{ctx->arena,
+                                                             m_op_num_threads[index]};
                                     executor::GetCPUExecutor().execute(*functor, ctx, &ectx, true);
                                     if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
                                     {
@@ -1951,29 +2526,68 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                 }
             }
 
+            // The first iteration builds primitives and other per-context state, which is
+            // left to the sequential path
+            // Unsampled calls skip the tracer entirely
+            if (ctx->pc == 0 && debug_tracer.tracing_is_enabled())
+            {
+                debug_tracer.begin_call();
+            }
+
+            if (m_inter_op_scheduler && !ctx->first_iteration && ctx->pc == 0 &&
+                ctx->breakpoints.empty() && !debug_tracer.call_is_traced() && !ctx->scheduled)
+            {
+                run_inter_op_scheduler(ctx);
+                profiler_count = functors.size();
+                ctx->pc = functors.size();
+            }
+
             for (; ctx->pc < functors.size(); ctx->pc++)
             {
+                if (ctx->cancellation && ctx->cancellation->is_cancelled())
+                {
+                    throw runtime::call_cancelled();
+                }
                 auto index = profiler_count++;
+                if (m_prefetcher)
+                {
+                    prefetch_ahead(ctx, ctx->pc);
+                }
                 if ((enables.at(ctx->pc))(ctx) || ctx->first_iteration)
                 {
+                    if (!ctx->input_fences.empty())
+                    {
+                        wait_for_streamed_inputs(ctx, ctx->pc);
+                    }
+
                     // Each Op will have exactly one functor, start the clock before the exceution
                     // of functor
                     // and collect the profiler_count once the execution complets
-                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
+                    cpu::hardware_counters::Sample hw_start;
+                    bool hw_counted = m_emit_timing && cpu::hardware_counters::read(hw_start);
+                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing || m_tuning_durations)
                     {
                         start_ts = cpu::Clock::now();
                     }
 
-                    CPUExecutionContext ectx{0};
+                    CPUExecutionContext ectx{ctx->arena, m_op_num_threads[ctx->pc]};
 
-                    if (debug_tracer.tracing_is_enabled())
+                    bool trace_kernel =
+                        debug_tracer.call_is_traced() &&
+                        debug_tracer.op_is_traced(m_op_attrs.at(ctx->pc).Description);
+                    if (trace_kernel)
                     {
                         this->dump_one_kernel(debug_tracer, ctx, true);
                     }
 
                     executor::GetCPUExecutor().execute(functors.at(ctx->pc), ctx, &ectx);
 
-                    if (debug_tracer.tracing_is_enabled())
+                    if (m_nan_check || m_inf_check)
+                    {
+                        check_fp_outputs(ctx, ctx->pc, ctx->arena);
+                    }
+
+                    if (trace_kernel)
                     {
                         this->dump_one_kernel(debug_tracer, ctx, false);
                     }
@@ -1984,7 +2598,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                         break;
                     }
 
-                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
+                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing || m_tuning_durations)
                     {
                         end_ts = cpu::Clock::now();
 
@@ -1994,6 +2608,13 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                                 (std::chrono::duration_cast<cpu::Timescale>(end_ts - start_ts))
                                     .count();
                         }
+                        if (m_tuning_durations)
+                        {
+                            m_tuning_durations[index] +=
+                                std::chrono::duration_cast<std::chrono::nanoseconds>(end_ts -
+                                                                                     start_ts)
+                                    .count();
+                        }
                         if (m_emit_timing)
                         {
                             m_perf_counters[index].m_total_microseconds +=
@@ -2001,6 +2622,11 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                                                                                       start_ts)
                                     .count();
                             m_perf_counters[index].m_call_count++;
+                            if (hw_counted)
+                            {
+                                cpu::hardware_counters::accumulate(m_perf_counters[index],
+                                                                   hw_start);
+                            }
                         }
                     }
                 }
@@ -2026,6 +2652,10 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     };
 
     m_is_built = true;
+    if (m_prebuild_primitives)
+    {
+        prebuild_primitives();
+    }
 
 #if defined(NGRAPH_TBB_ENABLE)
     if (m_release_function && !m_use_tbb)
@@ -2037,6 +2667,346 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     }
 }
 
+void runtime::cpu::CPU_ExternalFunction::build_inter_op_scheduler()
+{
+    // Where a buffer_data entry points. Function inputs and outputs are only known by index;
+    // since a caller may pass the same tensor as an input and an output, any input may alias
+    // any output.
+    enum class Base
+    {
+        Intermediate,
+        Input,
+        Output,
+        Constant
+    };
+    struct Region
+    {
+        Base base;
+        size_t id;
+        size_t begin;
+        size_t end;
+
+        bool overlaps(const Region& other) const
+        {
+            if (base == other.base)
+            {
+                return id == other.id && begin < other.end && other.begin < end;
+            }
+            return (base == Base::Input && other.base == Base::Output) ||
+                   (base == Base::Output && other.base == Base::Input);
+        }
+    };
+
+    unordered_map<size_t, tuple<Base, size_t, size_t>> placements;
+    for (auto& p : intermediates_offsets)
+    {
+        placements[p.first] = make_tuple(Base::Intermediate, 0, p.second);
+    }
+    for (auto& p : function_input_index_offset)
+    {
+        placements[get<0>(p)] = make_tuple(Base::Input, get<1>(p), get<2>(p));
+    }
+    for (auto& p : function_output_index_offset)
+    {
+        placements[get<0>(p)] = make_tuple(Base::Output, get<1>(p), get<2>(p));
+    }
+    auto get_region = [&](const descriptor::Tensor& tensor) {
+        auto index = get_buffer_index(tensor.get_name());
+        auto it = placements.find(index);
+        if (it == placements.end())
+        {
+            return Region{Base::Constant, index, 0, tensor.size()};
+        }
+        auto offset = get<2>(it->second);
+        return Region{get<0>(it->second), get<1>(it->second), offset, offset + tensor.size()};
+    };
+
+    // Functors were emitted in this order, skipping parameters and constants
+    vector<vector<Region>> reads;
+    vector<vector<Region>> writes;
+    vector<size_t> costs;
+    for (shared_ptr<Node> node : m_function->get_ordered_ops())
+    {
+        if (node->is_parameter() || node->is_constant())
+        {
+            continue;
+        }
+        vector<Region> op_reads;
+        vector<Region> op_writes;
+        size_t cost = 1;
+        for (const descriptor::Input& input : node->get_inputs())
+        {
+            op_reads.push_back(get_region(input.get_output().get_tensor()));
+            cost += input.get_output().get_tensor().size();
+        }
+        for (const descriptor::Output& output : node->get_outputs())
+        {
+            op_writes.push_back(get_region(output.get_tensor()));
+            cost += output.get_tensor().size();
+        }
+        reads.push_back(move(op_reads));
+        writes.push_back(move(op_writes));
+        costs.push_back(cost);
+    }
+    NGRAPH_CHECK(costs.size() == functors.size());
+
+    auto conflicts = [](const vector<Region>& a, const vector<Region>& b) {
+        for (auto& ra : a)
+        {
+            for (auto& rb : b)
+            {
+                if (ra.overlaps(rb))
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    // Op j depends on an earlier op i if it reads what i writes or writes what i reads or
+    // writes. Buffers reused by the memory assignment are covered by the write-after-read
+    // and write-after-write cases.
+    vector<vector<size_t>> dependencies(functors.size());
+    for (size_t j = 0; j < functors.size(); j++)
+    {
+        for (size_t i = 0; i < j; i++)
+        {
+            if (conflicts(reads[j], writes[i]) || conflicts(writes[j], reads[i]) ||
+                conflicts(writes[j], writes[i]))
+            {
+                dependencies[j].push_back(i);
+            }
+        }
+    }
+
+    m_inter_op_scheduler.reset(new CPU_InterOpScheduler(dependencies, costs));
+
+    // NGRAPH_CPU_PROFILE_GUIDED_SCHEDULING=<n> times every op over the first n scheduled
+    // calls and then prioritizes the ops by their measured durations instead of their sizes
+    if (auto profiling_calls = std::getenv("NGRAPH_CPU_PROFILE_GUIDED_SCHEDULING"))
+    {
+        auto count = std::atoi(profiling_calls);
+        if (count > 0)
+        {
+            m_profiling_calls = static_cast<size_t>(count);
+            m_profiled_durations.reset(new std::atomic<int64_t>[functors.size()]);
+            for (size_t i = 0; i < functors.size(); i++)
+            {
+                m_profiled_durations[i] = 0;
+            }
+        }
+    }
+}
+
+void runtime::cpu::CPU_ExternalFunction::apply_profiled_op_costs(size_t calls)
+{
+    vector<size_t> costs(functors.size());
+    for (size_t i = 0; i < functors.size(); i++)
+    {
+        // Keep a unit cost for ops too short to measure so that path lengths still count them
+        auto mean = m_profiled_durations[i] / static_cast<int64_t>(calls);
+        costs[i] = 1 + static_cast<size_t>(mean);
+    }
+    m_inter_op_scheduler->set_costs(costs);
+}
+
+void runtime::cpu::CPU_ExternalFunction::set_live_tensor_bytes()
+{
+    // Tensors sharing a buffer set through in-place or concat memory reuse are counted once,
+    // while any of them is live. Maps buffer ID to its live tensor count and size.
+    unordered_map<size_t, pair<size_t, size_t>> live_buffers;
+    size_t live = 0;
+    size_t index = 0;
+    for (shared_ptr<Node> node : m_function->get_ordered_ops())
+    {
+        if (node->is_parameter() || node->is_constant())
+        {
+            continue;
+        }
+        if (index == m_op_attrs.size())
+        {
+            return;
+        }
+        for (descriptor::Tensor* tensor : node->liveness_new_list)
+        {
+            auto& buffer = live_buffers[tensor_to_bufferID.at(tensor)];
+            buffer.first++;
+            if (tensor->size() > buffer.second)
+            {
+                live += tensor->size() - buffer.second;
+                buffer.second = tensor->size();
+            }
+        }
+        m_op_attrs[index++].LiveTensorBytes = live;
+        for (descriptor::Tensor* tensor : node->liveness_free_list)
+        {
+            auto it = live_buffers.find(tensor_to_bufferID.at(tensor));
+            if (it != live_buffers.end() && --it->second.first == 0)
+            {
+                live -= it->second.second;
+                live_buffers.erase(it);
+            }
+        }
+    }
+}
+
+void runtime::cpu::CPU_ExternalFunction::build_prefetch_plan(size_t distance)
+{
+    // A functor's input can only be read ahead if its producer has finished by the time the
+    // functor `distance` places before it starts. Parameters and constants always have.
+    unordered_map<Node*, size_t> producers;
+    m_prefetch_regions.clear();
+    for (shared_ptr<Node> node : m_function->get_ordered_ops())
+    {
+        if (node->is_parameter() || node->is_constant())
+        {
+            continue;
+        }
+        size_t index = m_prefetch_regions.size();
+        m_prefetch_regions.emplace_back();
+        for (const descriptor::Input& input : node->get_inputs())
+        {
+            auto producer = producers.find(input.get_output().get_node().get());
+            if (producer == producers.end() || producer->second + distance < index)
+            {
+                auto& tensor = input.get_output().get_tensor();
+                m_prefetch_regions.back().emplace_back(get_buffer_index(tensor.get_name()),
+                                                       tensor.size());
+            }
+        }
+        producers[node.get()] = index;
+    }
+    NGRAPH_CHECK(m_prefetch_regions.size() == functors.size());
+    m_prefetch_distance = distance;
+    m_prefetcher.reset(new CPU_Prefetcher());
+}
+
+void runtime::cpu::CPU_ExternalFunction::prefetch_ahead(CPURuntimeContext* ctx, size_t pc)
+{
+    // The first functor queues everything up to the distance; the functor itself is already
+    // needed
+    size_t first = pc == 0 ? 1 : pc + m_prefetch_distance;
+    size_t last = std::min(pc + m_prefetch_distance, functors.size() - 1);
+    for (size_t op = first; op <= last; op++)
+    {
+        for (auto& region : m_prefetch_regions[op])
+        {
+            m_prefetcher->prefetch(ctx->buffer_data[region.first], region.second);
+        }
+    }
+}
+
+void runtime::cpu::CPU_ExternalFunction::run_inter_op_scheduler(CPURuntimeContext* ctx)
+{
+    // Restores the context scratchpad even if a kernel throws, since inter-op worker threads
+    // are reused for other contexts
+    struct ScratchpadGuard
+    {
+        ScratchpadGuard(AlignedBuffer* scratchpad)
+        {
+            mkldnn_utils::set_thread_scratchpad(scratchpad);
+        }
+        ~ScratchpadGuard() { mkldnn_utils::set_thread_scratchpad(nullptr); }
+    };
+
+    auto& cpu_executor = executor::GetCPUExecutor();
+    // Each call claims a profiling slot before it runs, so no more than m_profiling_calls
+    // calls add durations even when several contexts start at once
+    bool profiling = m_profiled_durations && m_profiling_slots < m_profiling_calls &&
+                     m_profiling_slots++ < m_profiling_calls;
+    bool timed =
+        runtime::cpu::IsTracingEnabled() || m_emit_timing || profiling || m_tuning_durations;
+    auto runner = [this, ctx, profiling, timed](size_t index, int worker) {
+        // The scheduler stops handing out ops once one throws
+        if (ctx->cancellation && ctx->cancellation->is_cancelled())
+        {
+            throw runtime::call_cancelled();
+        }
+        if (!enables.at(index)(ctx))
+        {
+            if (runtime::cpu::IsTracingEnabled())
+            {
+                ctx->op_durations[index] = 0;
+            }
+            if (m_emit_timing)
+            {
+                m_perf_counters[index].m_call_count++;
+            }
+            return;
+        }
+        if (!ctx->input_fences.empty())
+        {
+            wait_for_streamed_inputs(ctx, index);
+        }
+
+        cpu::hardware_counters::Sample hw_start;
+        bool hw_counted = m_emit_timing && cpu::hardware_counters::read(hw_start);
+        cpu::Timestamp start_ts;
+        if (timed)
+        {
+            start_ts = cpu::Clock::now();
+        }
+
+        {
+            size_t scratchpad = static_cast<size_t>(worker);
+            ScratchpadGuard guard(scratchpad > 0 && scratchpad <= ctx->worker_scratchpads.size()
+                                      ? ctx->worker_scratchpads[scratchpad - 1]
+                                      : nullptr);
+            CPUExecutionContext ectx{worker, m_op_num_threads[index]};
+            executor::GetCPUExecutor().execute(functors.at(index), ctx, &ectx);
+            if (m_nan_check || m_inf_check)
+            {
+                check_fp_outputs(ctx, index, worker);
+            }
+        }
+
+        if (timed)
+        {
+            auto elapsed = cpu::Clock::now() - start_ts;
+            auto duration = std::chrono::duration_cast<cpu::Timescale>(elapsed).count();
+            if (m_tuning_durations)
+            {
+                m_tuning_durations[index] +=
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+            }
+            if (runtime::cpu::IsTracingEnabled())
+            {
+                ctx->op_durations[index] = duration;
+            }
+            if (m_emit_timing)
+            {
+                m_perf_counters[index].m_total_microseconds += duration;
+                m_perf_counters[index].m_call_count++;
+                if (hw_counted)
+                {
+                    cpu::hardware_counters::accumulate(m_perf_counters[index], hw_start);
+                }
+            }
+            if (profiling)
+            {
+                m_profiled_durations[index] += duration;
+            }
+        }
+    };
+    m_inter_op_scheduler->run(runner,
+                              cpu_executor.get_num_thread_pools(),
+                              [&cpu_executor](std::function<void()> worker) {
+                                  cpu_executor.schedule_inter_op(std::move(worker));
+                              });
+
+    // The last profiled call to finish applies the profile, averaged over the calls that
+    // actually added durations
+    if (profiling)
+    {
+        auto calls = ++m_profiled_calls;
+        if (calls == m_profiling_calls)
+        {
+            apply_profiled_op_costs(calls);
+        }
+    }
+}
+
 size_t runtime::cpu::CPU_ExternalFunction::get_buffer_index(const std::string& name)
 {
     if (tensor_alias.count(name))
@@ -2064,7 +3034,8 @@ bool runtime::cpu::CPU_ExternalFunction::is_codegen(const ngraph::pass::PassConf
 
 shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
     runtime::cpu::CPU_ExternalFunction::make_call_frame(ngraph::pass::PassConfig& pass_config,
-                                                        Allocator* allocator)
+                                                        Allocator* allocator,
+                                                        size_t max_concurrency)
 {
 #if defined(NGRAPH_DEX_ONLY)
     if (is_codegen(pass_config))
@@ -2093,7 +3064,19 @@ shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
                                                             m_compiled_init_ctx_func,
                                                             m_compiled_destroy_ctx_func,
                                                             m_compiled_function,
-                                                            allocator);
+                                                            allocator,
+                                                            max_concurrency);
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::reserve_memory(size_t bytes)
+{
+    if (m_memory_buffer_sizes.empty())
+    {
+        m_memory_buffer_sizes.push_back(0);
+    }
+    size_t offset = round_up(m_memory_buffer_sizes[0], s_memory_pool_alignment);
+    m_memory_buffer_sizes[0] = offset + bytes;
+    return offset;
 }
 
 const runtime::cpu::LayoutDescriptorPtrs&
@@ -16,10 +16,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
@@ -41,7 +43,9 @@
 #include "ngraph/pass/pass_config.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_debug_tracer.hpp"
+#include "ngraph/runtime/cpu/cpu_inter_op_scheduler.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_prefetcher.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
@@ -93,6 +97,8 @@ namespace ngraph
                 std::vector<std::string> Inputs;
                 std::vector<TensorTracerAttributes> m_outputs_tensor_attrs;
                 std::vector<TensorTracerAttributes> m_inputs_tensor_attrs;
+                // Bytes of the intermediate buffers that are live while the op runs
+                size_t LiveTensorBytes = 0;
 
                 OpAttributes(const std::string& desc,
                              const std::vector<std::string>& outputs,
@@ -114,19 +120,27 @@ namespace ngraph
                 friend class CPU_CallFrame;
                 friend class CPU_Debugger;
                 friend class CPU_Executable;
+                friend class CPU_NestedFunction;
 
             public:
                 CPU_ExternalFunction(const std::shared_ptr<ngraph::Function>& function,
                                      bool release_function = true);
                 ~CPU_ExternalFunction();
                 std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
-                    make_call_frame(ngraph::pass::PassConfig& pass_config, Allocator* allocator);
+                    make_call_frame(ngraph::pass::PassConfig& pass_config,
+                                    Allocator* allocator,
+                                    size_t max_concurrency = 0);
                 const LayoutDescriptorPtrs& get_parameter_layout_descriptors();
                 const LayoutDescriptorPtrs& get_result_layout_descriptors();
                 const std::vector<size_t>& get_memory_buffer_sizes() const
                 {
                     return m_memory_buffer_sizes;
                 }
+                /// \brief Reserves `bytes` after the intermediates in the first memory buffer,
+                ///        for the op being built to use while it runs, such as for the
+                ///        intermediates of a CPU_NestedFunction. Only for builders.
+                /// \returns The offset of the reserved bytes in the buffer
+                size_t reserve_memory(size_t bytes);
                 const std::vector<OpAttributes>& get_op_attrs() const { return m_op_attrs; }
                 const std::unique_ptr<MKLDNNEmitter>& get_mkldnn_emitter() const
                 {
@@ -153,6 +167,15 @@ namespace ngraph
                     return m_states.size() - 1;
                 }
 
+                /// \returns The slot of CPURuntimeContext::distributed_requests that holds the
+                ///          collective started by `start`
+                size_t get_distributed_request_index(const Node* start)
+                {
+                    return m_distributed_request_indices
+                        .emplace(start, m_distributed_request_indices.size())
+                        .first->second;
+                }
+
                 const std::string& get_function_name() const { return m_function_name; }
                 const std::shared_ptr<ngraph::Function> get_function() { return m_function; }
                 // Temporary Memory Pool alignment
@@ -163,6 +186,16 @@ namespace ngraph
                 // tensor
                 size_t get_buffer_index(const std::string& name);
                 size_t get_buffer_size() const { return m_buffer_size; }
+                /// \returns The bytes of the constants of the function, including the data
+                ///          swapped in by update_constants
+                size_t get_constant_bytes() const;
+                /// \returns The bytes of the weights the builders packed while compiling
+                size_t get_prepacked_weight_bytes() const { return m_prepacked_weight_bytes; }
+                /// \brief Records weights packed by a builder, see PackedGemmOperand
+                void add_prepacked_weight_bytes(size_t bytes)
+                {
+                    m_prepacked_weight_bytes += bytes;
+                }
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>&
                     get_executor()
                 {
@@ -174,11 +207,35 @@ namespace ngraph
                     return callees;
                 }
                 bool is_direct_execution() const { return m_direct_execution; }
+                /// \returns true if DEX calls run their ops concurrently on the inter-op
+                ///          scheduler
+                bool uses_inter_op_scheduler() const { return m_inter_op_scheduler != nullptr; }
+                /// \brief Builds the MKLDNN primitives of a DEX function ahead of the first call.
+                ///        Runs at the end of compilation unless disabled with the
+                ///        `prebuild_primitives` backend config, in which case
+                ///        Executable::warmup() triggers it. Safe to call more than once.
+                void prebuild_primitives();
+                /// \brief Replaces the data of the constants with these friendly names for the
+                ///        calls that start after it returns. See Executable::update_constants.
+                void update_constants(
+                    const std::map<std::string, std::shared_ptr<runtime::Tensor>>& constants);
+                /// \brief The intra-op thread count of each DEX op in execution order, where 0
+                ///        lets the op use its whole arena
+                const std::vector<int>& get_op_num_threads() const { return m_op_num_threads; }
+                /// \brief Replaces the per-op thread counts. Not safe while calls are running.
+                void set_op_num_threads(const std::vector<int>& num_threads);
+                /// \brief Runs \p call \p calls_per_candidate times for every power-of-two
+                ///        thread count up to the arena size and keeps the fastest count of
+                ///        each op. No other calls may run until it returns.
+                void tune_op_num_threads(const std::function<void()>& call,
+                                         size_t calls_per_candidate);
                 void write_to_file(const std::string& code,
                                    const std::string& directory,
                                    const std::string& filename);
 
                 const std::vector<PerformanceCounter>& get_perf_counters();
+                /// \returns The passes run when the function was compiled
+                const ngraph::pass::PassReport& get_pass_report() const { return m_pass_report; }
 
             protected:
                 void build(ngraph::pass::PassConfig& pass_config);
@@ -190,10 +247,18 @@ namespace ngraph
 #endif
 
                 std::vector<ngraph::State*> m_states;
+                std::unordered_map<const Node*, size_t> m_distributed_request_indices;
 
                 void dump_one_kernel(CPU_DebugTracer& debug_tracer,
                                      CPURuntimeContext* ctx,
                                      bool is_it_input);
+                /// \brief Throws if an f32/f64 output of kernel \p index holds a NaN
+                ///        (NGRAPH_CPU_NAN_CHECK) or an Inf (NGRAPH_CPU_INF_CHECK). Large outputs
+                ///        are scanned on the threads of \p arena.
+                void check_fp_outputs(CPURuntimeContext* ctx, size_t index, int arena);
+                /// \brief Waits until the inputs of the function that kernel \p index reads
+                ///        have been streamed in, see Tensor::begin_streaming_write
+                void wait_for_streamed_inputs(CPURuntimeContext* ctx, size_t index);
 
             private:
                 // Register passes that are common to codegen and DEX
@@ -201,6 +266,19 @@ namespace ngraph
                                             ngraph::pass::PassConfig& pass_config);
 
                 bool computes_result(Node* node);
+                // Builds the op dependency graph for the inter-op scheduler from the DEX
+                // functors' data and buffer-overlap hazards
+                void build_inter_op_scheduler();
+                void run_inter_op_scheduler(CPURuntimeContext* ctx);
+                // Replaces the static scheduler costs with the mean op durations measured
+                // over `calls` profiling calls
+                void apply_profiled_op_costs(size_t calls);
+                // Records in m_op_attrs the intermediate buffer bytes live at each op
+                void set_live_tensor_bytes();
+                // Plans which input buffers of each functor the prefetcher reads ahead of it
+                void build_prefetch_plan(size_t distance);
+                // Queues the inputs of the functors up to m_prefetch_distance after `pc`
+                void prefetch_ahead(CPURuntimeContext* ctx, size_t pc);
                 void release_function() { m_function = nullptr; }
 #if !defined(NGRAPH_DEX_ONLY)
                 void emit_debug_function_entry(CodeWriter& writer,
@@ -239,8 +317,17 @@ namespace ngraph
                     get_tensor_set(descriptor::Tensor* output_tensor);
 
                 std::shared_ptr<ngraph::Function> m_function;
+                ngraph::pass::PassReport m_pass_report;
                 bool m_release_function;
                 bool m_emit_timing;
+                bool m_prebuild_primitives = true;
+                size_t m_primitive_build_threads = 1;
+                bool m_share_memory_pool = false;
+                // Only called through CPU_NestedFunction, with its intermediates in the pool of
+                // the calling function
+                bool m_nested = false;
+                // NUMA node the calls run on and the constants are kept on, -1 for any
+                int m_numa_node = -1;
 
 #if defined(NGRAPH_TBB_ENABLE)
                 bool m_use_tbb;
@@ -269,12 +356,38 @@ namespace ngraph
                 LayoutDescriptorPtrs result_layout_descriptors;
                 std::vector<size_t> m_memory_buffer_sizes;
                 std::vector<OpAttributes> m_op_attrs;
+                // Buffer indices of the floating-point outputs of each kernel, filled only when
+                // NaN or Inf checks are enabled
+                std::vector<std::vector<size_t>> m_fp_check_buffers;
+                bool m_nan_check = false;
+                bool m_inf_check = false;
 
                 std::unique_ptr<MKLDNNEmitter> m_mkldnn_emitter;
 
                 std::string m_function_name;
 
                 std::vector<CPUKernelFunctor> functors;
+                std::unique_ptr<CPU_InterOpScheduler> m_inter_op_scheduler;
+                // Profile-guided scheduling: the first m_profiling_calls scheduled calls
+                // accumulate per-op durations (in microseconds) into m_profiled_durations.
+                // m_profiling_slots counts the calls that started profiling and
+                // m_profiled_calls the ones that finished.
+                size_t m_profiling_calls = 0;
+                std::atomic<size_t> m_profiling_slots{0};
+                std::atomic<size_t> m_profiled_calls{0};
+                std::unique_ptr<std::atomic<int64_t>[]> m_profiled_durations;
+                // Weight streaming: while functor i runs, the prefetcher reads the inputs of
+                // functor i + m_prefetch_distance that are already computed. Each entry of
+                // m_prefetch_regions is a buffer index and its size in bytes.
+                size_t m_prefetch_distance = 0;
+                std::unique_ptr<CPU_Prefetcher> m_prefetcher;
+                std::vector<std::vector<std::pair<size_t, size_t>>> m_prefetch_regions;
+                // Intra-op thread count of each functor, see CPUExecutionContext::num_threads
+                std::vector<int> m_op_num_threads;
+                // Per-op durations (in nanoseconds) accumulated while tune_op_num_threads runs
+                std::unique_ptr<std::atomic<int64_t>[]> m_tuning_durations;
+                // Function inputs each functor reads
+                std::vector<std::vector<size_t>> m_op_input_args;
                 std::vector<std::string> op_names;
                 std::vector<std::function<bool(CPURuntimeContext*)>> enables;
                 std::list<std::pair<std::function<bool(CPURuntimeContext*)>, std::string>>
@@ -306,6 +419,34 @@ namespace ngraph
                 // and the tensor pointer.
                 // used to get the address at runtime
                 std::list<std::pair<size_t, void*>> constant_tensor_data;
+                // Constants by friendly name, recorded for update_constants
+                struct ConstantSlot
+                {
+                    size_t buffer_index;
+                    element::Type element_type;
+                    Shape shape;
+                    bool has_default_layout;
+                    std::reference_wrapper<bool> stale;
+                };
+                std::unordered_map<std::string, std::vector<ConstantSlot>> m_constant_slots;
+                // Data swapped into constants by update_constants. A table is replaced as a
+                // whole, and each context keeps the one it is bound to alive.
+                struct ConstantUpdates
+                {
+                    struct Entry
+                    {
+                        size_t buffer_index;
+                        std::shared_ptr<AlignedBuffer> buffer;
+                        std::reference_wrapper<bool> stale;
+                        // m_constants_version that last changed the entry
+                        size_t version;
+                    };
+                    size_t version = 0;
+                    std::vector<Entry> entries;
+                };
+                std::mutex m_constant_updates_mutex;
+                std::shared_ptr<const ConstantUpdates> m_constant_updates;
+                std::atomic<size_t> m_constants_version{0};
                 // index into the cpu_runtime_context's buffer_data vector to get a tensor,
                 // input index, offset into the input, and if the input is stale
                 // used to calculate the correct address at runtime
@@ -317,6 +458,8 @@ namespace ngraph
                 std::list<std::tuple<size_t, size_t, size_t>> function_output_index_offset;
                 // size of the cpu_runtime_context's buffer_data vector.
                 size_t m_buffer_size = 0;
+                size_t m_constant_bytes = 0;
+                size_t m_prepacked_weight_bytes = 0;
                 std::unordered_map<std::string, std::shared_ptr<CPU_ExternalFunction>> callees;
                 bool m_is_built;
                 std::vector<runtime::PerformanceCounter> m_perf_counters;
@@ -0,0 +1,150 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/cpu_hardware_counters.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#ifdef __linux__
+namespace
+{
+    // A perf event group of cycles, instructions and cache misses for the calling thread.
+    // The group is read with a single syscall so that the three counts cover the same interval.
+    class EventGroup
+    {
+    public:
+        EventGroup()
+        {
+            const uint64_t configs[] = {PERF_COUNT_HW_CPU_CYCLES,
+                                        PERF_COUNT_HW_INSTRUCTIONS,
+                                        PERF_COUNT_HW_CACHE_MISSES};
+            for (size_t i = 0; i < s_event_count; i++)
+            {
+                perf_event_attr attr;
+                memset(&attr, 0, sizeof(attr));
+                attr.size = sizeof(attr);
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = configs[i];
+                attr.disabled = i == 0 ? 1 : 0;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                attr.read_format = PERF_FORMAT_GROUP;
+                int group_fd = i == 0 ? -1 : m_fds[0];
+                m_fds[i] =
+                    static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+                if (m_fds[i] < 0)
+                {
+                    return;
+                }
+            }
+            m_valid = ioctl(m_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) == 0;
+        }
+
+        ~EventGroup()
+        {
+            for (size_t i = 0; i < s_event_count; i++)
+            {
+                if (m_fds[i] >= 0)
+                {
+                    close(m_fds[i]);
+                }
+            }
+        }
+
+        EventGroup(const EventGroup&) = delete;
+        EventGroup& operator=(const EventGroup&) = delete;
+
+        bool is_valid() const { return m_valid; }
+        bool read(runtime::cpu::hardware_counters::Sample& sample) const
+        {
+            // Layout of PERF_FORMAT_GROUP without times or ids: nr, then one value per event
+            uint64_t values[1 + s_event_count];
+            if (::read(m_fds[0], values, sizeof(values)) != static_cast<ssize_t>(sizeof(values)))
+            {
+                return false;
+            }
+            sample.cycles = values[1];
+            sample.instructions = values[2];
+            sample.llc_misses = values[3];
+            return true;
+        }
+
+    private:
+        static constexpr size_t s_event_count = 3;
+        int m_fds[s_event_count] = {-1, -1, -1};
+        bool m_valid = false;
+    };
+}
+#endif
+
+bool runtime::cpu::hardware_counters::is_enabled()
+{
+    static const bool s_enabled = []() {
+        const char* env = getenv("NGRAPH_CPU_HARDWARE_COUNTERS");
+        return env != nullptr && atoi(env) != 0;
+    }();
+    return s_enabled;
+}
+
+bool runtime::cpu::hardware_counters::read(Sample& sample)
+{
+#ifdef __linux__
+    if (!is_enabled())
+    {
+        return false;
+    }
+    thread_local EventGroup s_group;
+    if (!s_group.is_valid())
+    {
+        static bool s_warned = []() {
+            NGRAPH_WARN << "NGRAPH_CPU_HARDWARE_COUNTERS is set but perf events are unavailable; "
+                        << "check /proc/sys/kernel/perf_event_paranoid";
+            return true;
+        }();
+        (void)s_warned;
+        return false;
+    }
+    return s_group.read(sample);
+#else
+    (void)sample;
+    return false;
+#endif
+}
+
+void runtime::cpu::hardware_counters::accumulate(PerformanceCounter& counter, const Sample& start)
+{
+    Sample end;
+    if (!read(end))
+    {
+        return;
+    }
+    counter.m_has_hardware_counters = true;
+    counter.m_cycles += end.cycles - start.cycles;
+    counter.m_instructions += end.instructions - start.instructions;
+    counter.m_llc_misses += end.llc_misses - start.llc_misses;
+}
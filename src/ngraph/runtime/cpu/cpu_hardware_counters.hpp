@@ -0,0 +1,56 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+
+#include "ngraph/runtime/performance_counter.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// Per-op hardware event counts gathered with Linux perf events. The counters are
+            /// opened lazily for each thread that executes ops and only count that thread, so
+            /// work an op hands to intra-op worker threads is not included. On other platforms,
+            /// or when the kernel denies access to perf events, every helper degrades to a
+            /// no-op.
+            namespace hardware_counters
+            {
+                struct Sample
+                {
+                    uint64_t cycles = 0;
+                    uint64_t instructions = 0;
+                    uint64_t llc_misses = 0;
+                };
+
+                /// \returns true if hardware counters were requested with
+                ///          NGRAPH_CPU_HARDWARE_COUNTERS
+                bool is_enabled();
+
+                /// \brief Read the counters of the calling thread, opening them on first use
+                /// \returns false if the counters are disabled or unavailable
+                bool read(Sample& sample);
+
+                /// \brief Add the events counted since `start` to `counter`
+                void accumulate(PerformanceCounter& counter, const Sample& start);
+            }
+        }
+    }
+}
@@ -0,0 +1,291 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/cpu/cpu_inter_op_scheduler.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+struct runtime::cpu::CPU_InterOpScheduler::RunState
+{
+    struct Queue
+    {
+        std::mutex mutex;
+        // Max-heap on the op priorities
+        std::vector<size_t> heap;
+    };
+
+    RunState(const shared_ptr<const Graph>& run_graph, const OpRunner& op_runner, int num_workers)
+        : graph(run_graph)
+        , runner(op_runner)
+        , pending(new atomic<size_t>[run_graph->successors.size()])
+        , queues(num_workers)
+        , remaining(run_graph->successors.size())
+    {
+        for (size_t i = 0; i < graph->successors.size(); i++)
+        {
+            pending[i].store(graph->num_dependencies[i], memory_order_relaxed);
+        }
+    }
+
+    bool higher_priority(size_t a, size_t b) const
+    {
+        return graph->priorities[a] < graph->priorities[b];
+    }
+
+    void push(int worker, size_t op)
+    {
+        // Count the op before it becomes visible so that `queued` never underflows
+        queued++;
+        {
+            auto& queue = queues[worker];
+            lock_guard<std::mutex> lock(queue.mutex);
+            queue.heap.push_back(op);
+            push_heap(queue.heap.begin(),
+                      queue.heap.end(),
+                      [this](size_t a, size_t b) { return higher_priority(a, b); });
+        }
+        notify(false);
+    }
+
+    // Takes the most critical op from the worker's own queue, or steals one from another
+    // worker when its own queue is empty
+    bool pop(int worker, size_t& op)
+    {
+        for (size_t i = 0; i < queues.size(); i++)
+        {
+            auto& queue = queues[(worker + i) % queues.size()];
+            lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.heap.empty())
+            {
+                pop_heap(queue.heap.begin(),
+                         queue.heap.end(),
+                         [this](size_t a, size_t b) { return higher_priority(a, b); });
+                op = queue.heap.back();
+                queue.heap.pop_back();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void notify(bool all)
+    {
+        // Taking the lock orders this notification after any waiter's predicate check
+        {
+            lock_guard<std::mutex> lock(mutex);
+        }
+        if (all)
+        {
+            cv.notify_all();
+        }
+        else
+        {
+            cv.notify_one();
+        }
+    }
+
+    shared_ptr<const Graph> graph;
+    OpRunner runner;
+    unique_ptr<atomic<size_t>[]> pending;
+    vector<Queue> queues;
+    atomic<size_t> remaining;
+    atomic<size_t> queued{0};
+    atomic<size_t> in_flight{0};
+    atomic<bool> failed{false};
+    std::mutex mutex;
+    condition_variable cv;
+    exception_ptr error;
+};
+
+runtime::cpu::CPU_InterOpScheduler::CPU_InterOpScheduler(
+    const vector<vector<size_t>>& dependencies, const vector<size_t>& costs)
+{
+    NGRAPH_CHECK(dependencies.size() == costs.size(),
+                 "Every op needs a cost (",
+                 dependencies.size(),
+                 " ops, ",
+                 costs.size(),
+                 " costs)");
+
+    auto graph = make_shared<Graph>();
+    size_t num_ops = dependencies.size();
+    graph->successors.resize(num_ops);
+    graph->num_dependencies.resize(num_ops);
+    graph->priorities.resize(num_ops);
+
+    for (size_t op = 0; op < num_ops; op++)
+    {
+        auto deps = dependencies[op];
+        sort(deps.begin(), deps.end());
+        deps.erase(unique(deps.begin(), deps.end()), deps.end());
+        for (auto dep : deps)
+        {
+            NGRAPH_CHECK(dep < op, "Op ", op, " depends on later op ", dep);
+            graph->successors[dep].push_back(op);
+        }
+        graph->num_dependencies[op] = deps.size();
+    }
+    prioritize(*graph, costs);
+
+    m_graph = graph;
+}
+
+void runtime::cpu::CPU_InterOpScheduler::set_costs(const vector<size_t>& costs)
+{
+    auto current = get_graph();
+    NGRAPH_CHECK(current->successors.size() == costs.size(),
+                 "Every op needs a cost (",
+                 current->successors.size(),
+                 " ops, ",
+                 costs.size(),
+                 " costs)");
+
+    auto graph = make_shared<Graph>();
+    graph->successors = current->successors;
+    graph->num_dependencies = current->num_dependencies;
+    graph->priorities.resize(costs.size());
+    prioritize(*graph, costs);
+
+    atomic_store(&m_graph, shared_ptr<const Graph>(graph));
+}
+
+void runtime::cpu::CPU_InterOpScheduler::prioritize(Graph& graph, const vector<size_t>& costs)
+{
+    // Ops are in topological order, so walking backwards sees all successors first
+    for (size_t i = graph.successors.size(); i > 0; i--)
+    {
+        size_t op = i - 1;
+        size_t longest_successor = 0;
+        for (auto successor : graph.successors[op])
+        {
+            longest_successor = max(longest_successor, graph.priorities[successor]);
+        }
+        graph.priorities[op] = costs[op] + longest_successor;
+    }
+
+    graph.roots.clear();
+    for (size_t op = 0; op < graph.num_dependencies.size(); op++)
+    {
+        if (graph.num_dependencies[op] == 0)
+        {
+            graph.roots.push_back(op);
+        }
+    }
+    stable_sort(graph.roots.begin(), graph.roots.end(), [&graph](size_t a, size_t b) {
+        return graph.priorities[a] > graph.priorities[b];
+    });
+}
+
+void runtime::cpu::CPU_InterOpScheduler::worker_loop(const shared_ptr<RunState>& state,
+                                                     int worker)
+{
+    const auto& graph = *state->graph;
+    while (true)
+    {
+        size_t op;
+        if (state->pop(worker, op))
+        {
+            state->in_flight++;
+            state->queued--;
+            if (!state->failed)
+            {
+                try
+                {
+                    state->runner(op, worker);
+                }
+                catch (...)
+                {
+                    lock_guard<std::mutex> lock(state->mutex);
+                    if (!state->error)
+                    {
+                        state->error = current_exception();
+                    }
+                    state->failed = true;
+                }
+            }
+            if (!state->failed)
+            {
+                for (auto successor : graph.successors[op])
+                {
+                    if (--state->pending[successor] == 0)
+                    {
+                        state->push(worker, successor);
+                    }
+                }
+            }
+            auto remaining = --state->remaining;
+            state->in_flight--;
+            if (remaining == 0 || state->failed)
+            {
+                state->notify(true);
+            }
+            continue;
+        }
+
+        unique_lock<std::mutex> lock(state->mutex);
+        state->cv.wait(lock, [&state]() {
+            return state->queued > 0 || state->remaining == 0 || state->failed;
+        });
+        if (state->remaining == 0 || state->failed)
+        {
+            return;
+        }
+    }
+}
+
+void runtime::cpu::CPU_InterOpScheduler::run(const OpRunner& runner,
+                                             int num_workers,
+                                             const Spawner& spawn)
+{
+    if (get_num_ops() == 0)
+    {
+        return;
+    }
+    num_workers = max(num_workers, 1);
+
+    auto graph = get_graph();
+    auto state = make_shared<RunState>(graph, runner, num_workers);
+    int worker = 0;
+    for (auto root : graph->roots)
+    {
+        state->push(worker, root);
+        worker = (worker + 1) % num_workers;
+    }
+
+    // Helpers hold their own reference to the state; one that starts after the run has
+    // finished finds nothing to do and returns immediately
+    for (int i = 1; i < num_workers; i++)
+    {
+        spawn([state, i]() { worker_loop(state, i); });
+    }
+    worker_loop(state, 0);
+
+    if (state->failed)
+    {
+        // The caller's context must not be released while other workers still use it
+        unique_lock<std::mutex> lock(state->mutex);
+        state->cv.wait(lock, [&state]() { return state->in_flight == 0; });
+        rethrow_exception(state->error);
+    }
+}
@@ -0,0 +1,90 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Dependency-counting, work-stealing scheduler for the ops of a DEX function.
+            ///
+            /// The op DAG is fixed at construction time. Each call to `run` executes every op
+            /// exactly once on up to `num_workers` workers: the calling thread is worker 0 and
+            /// the remaining workers are started through `spawn`. An op becomes ready once all
+            /// of its dependencies have finished and is pushed onto the queue of the worker
+            /// that released it; idle workers steal from the other queues. Every queue is
+            /// ordered by the length of the most expensive path from the op to the end of the
+            /// graph, so that the critical path is started first.
+            class CPU_InterOpScheduler
+            {
+            public:
+                /// \brief Executes op `op` on worker `worker`
+                using OpRunner = std::function<void(size_t op, int worker)>;
+                /// \brief Starts a helper worker on another thread
+                using Spawner = std::function<void(std::function<void()>)>;
+
+                /// \param dependencies dependencies[j] lists the ops that must finish before op
+                ///        j starts. Every dependency of op j must have an index below j.
+                /// \param costs the relative cost of each op
+                CPU_InterOpScheduler(const std::vector<std::vector<size_t>>& dependencies,
+                                     const std::vector<size_t>& costs);
+
+                /// \brief Runs all ops and returns once they have finished. If an op throws,
+                ///        the ops that have not started yet are skipped and the exception is
+                ///        rethrown once the ops already in flight have finished.
+                void run(const OpRunner& runner, int num_workers, const Spawner& spawn);
+
+                /// \brief Replaces the op costs, for example with measured op durations, and
+                ///        recomputes the priorities. Runs that have already started keep the
+                ///        priorities they started with.
+                void set_costs(const std::vector<size_t>& costs);
+
+                size_t get_num_ops() const { return get_graph()->successors.size(); }
+                /// \returns the cost of the most expensive path from each op to a sink
+                std::vector<size_t> get_priorities() const { return get_graph()->priorities; }
+
+            private:
+                struct Graph
+                {
+                    std::vector<std::vector<size_t>> successors;
+                    std::vector<size_t> num_dependencies;
+                    std::vector<size_t> priorities;
+                    std::vector<size_t> roots;
+                };
+                struct RunState;
+
+                static void worker_loop(const std::shared_ptr<RunState>& state, int worker);
+                // Fills in the priorities and the priority-ordered roots from the successors
+                static void prioritize(Graph& graph, const std::vector<size_t>& costs);
+
+                std::shared_ptr<const Graph> get_graph() const
+                {
+                    return std::atomic_load(&m_graph);
+                }
+
+                std::shared_ptr<const Graph> m_graph;
+            };
+        }
+    }
+}
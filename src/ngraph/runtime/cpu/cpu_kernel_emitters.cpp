@@ -58,6 +58,8 @@ string recast_tmp_var(CodeWriter& writer,
 // write openings to for loops, for variables in the order of top,
 // where each loop ranges from bottom[i] to top[i]
 // creates index variables for each loop and returns them
+// the outermost loop is parallelized and the innermost one vectorized, so
+// the loop body must only write the element at the loop indices
 vector<string> open_for_loops(CodeWriter& writer, const Shape& top, const Shape& bottom = {})
 {
     Shape new_bottom;
@@ -70,6 +72,15 @@ vector<string> open_for_loops(CodeWriter& writer, const Shape& top, const Shape&
         new_bottom = bottom;
     }
 
+    size_t simd_inner = top.size();
+    for (size_t i = 0; i < top.size(); i++)
+    {
+        if (top[i] != (new_bottom[i] + 1))
+        {
+            simd_inner = i;
+        }
+    }
+
     vector<string> index_vars;
     bool omp_outer = true;
     for (size_t i = 0; i < top.size(); i++)
@@ -88,7 +99,7 @@ vector<string> open_for_loops(CodeWriter& writer, const Shape& top, const Shape&
             string index_var = writer.generate_temporary_name("_i");
 
             writer << runtime::cpu::kernel::start_index_loop(
-                index_var, new_bottom[i], top[i], omp_outer);
+                index_var, new_bottom[i], top[i], omp_outer, i == simd_inner);
             writer.indent++;
             index_vars.push_back(index_var);
             omp_outer = false;
@@ -120,19 +120,29 @@ string ngraph::runtime::cpu::kernel::emit_linear_index(CoordinateTransform& tran
 // Begins an indexing loop (just a for-loop) with index_var as the index
 // variable, starting at start, continuing while [index_var] < [end].
 //
-// Optionally emits an OpenMP parallel pragma, if "omp" is true.
+// Optionally emits an OpenMP parallel pragma, if "omp" is true, and an
+// OpenMP simd pragma, if "simd" is true.
 //
 string ngraph::runtime::cpu::kernel::start_index_loop(const string& index_var,
                                                       size_t start,
                                                       size_t end,
-                                                      bool omp)
+                                                      bool omp,
+                                                      bool simd)
 {
     stringstream ss;
 
-    if (omp)
+    if (omp && simd)
+    {
+        ss << "#pragma omp parallel for simd\n";
+    }
+    else if (omp)
     {
         ss << "#pragma omp parallel for\n";
     }
+    else if (simd)
+    {
+        ss << "#pragma omp simd\n";
+    }
 
     ss << "for(size_t " << index_var << " = " << start << "; " << index_var << " < " << end << "; "
        << index_var << "++)\n"
@@ -123,6 +123,45 @@ namespace cblas
                            const int64_t* ldc_array,
                            const int64_t group_count,
                            const int64_t* group_size);
+
+    float* cblas_sgemm_alloc(const Ident identifier,
+                             const int64_t M,
+                             const int64_t N,
+                             const int64_t K);
+
+    size_t cblas_sgemm_pack_get_size(const Ident identifier,
+                                     const int64_t M,
+                                     const int64_t N,
+                                     const int64_t K);
+
+    void cblas_sgemm_pack(const Layout layout,
+                          const Ident identifier,
+                          const Transpose trans,
+                          const int64_t M,
+                          const int64_t N,
+                          const int64_t K,
+                          const float alpha,
+                          const float* src,
+                          const int64_t ld,
+                          float* dest);
+
+    // transa and transb are a Transpose value, or Storage::Packed for an operand packed by
+    // cblas_sgemm_pack
+    void cblas_sgemm_compute(const Layout layout,
+                             const int64_t transa,
+                             const int64_t transb,
+                             const int64_t M,
+                             const int64_t N,
+                             const int64_t K,
+                             const float* A,
+                             const int64_t lda,
+                             const float* B,
+                             const int64_t ldb,
+                             const float beta,
+                             float* C,
+                             const int64_t ldc);
+
+    void cblas_sgemm_free(float* dest);
     }
 }
 
@@ -219,6 +258,8 @@ namespace ngraph
                                            const Shape& output_shape,
                                            int arena);
 
+                void gelu_float32(void* input, void* output, size_t count, int arena);
+
                 template <typename ElementType, unsigned int Rank>
                 void update_slice(void* input0,
                                   void* input1,
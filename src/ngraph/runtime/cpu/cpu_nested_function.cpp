@@ -0,0 +1,59 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/cpu_nested_function.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/pass/pass_config.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::CPU_NestedFunction::CPU_NestedFunction(CPU_ExternalFunction* caller,
+                                                     const shared_ptr<Function>& function)
+{
+    m_external_function = make_shared<CPU_ExternalFunction>(function);
+    m_external_function->m_nested = true;
+    m_external_function->m_direct_execution = true;
+    m_external_function->m_numa_node = caller->m_numa_node;
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CODEGEN", false);
+    m_call_frame = m_external_function->make_call_frame(pass_config, nullptr);
+    // Kept with the caller's other callees
+    caller->get_callees()[function->get_name()] = m_external_function;
+
+    auto& buffer_sizes = m_external_function->get_memory_buffer_sizes();
+    NGRAPH_CHECK(buffer_sizes.size() <= 1, "Nested functions use a single memory buffer");
+    if (!buffer_sizes.empty())
+    {
+        m_memory_offset = caller->reserve_memory(buffer_sizes[0]);
+        m_has_memory = true;
+    }
+}
+
+void runtime::cpu::CPU_NestedFunction::call(CPURuntimeContext* ctx,
+                                            vector<void*>& inputs,
+                                            vector<void*>& outputs) const
+{
+    void* memory_pool = nullptr;
+    if (m_has_memory)
+    {
+        memory_pool = ctx->memory_buffers[0]->get_ptr(m_memory_offset);
+    }
+    m_call_frame->call_nested(ctx, memory_pool, inputs, outputs);
+}
@@ -0,0 +1,66 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ngraph/function.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            class CPU_CallFrame;
+            class CPU_ExternalFunction;
+            struct CPURuntimeContext;
+
+            /// \brief A function called by an op of a CPU function, such as the body of a
+            ///        TensorIterator.
+            ///
+            /// The function is compiled for DEX when the op is built, but it is not called as
+            /// an Executable. It runs on the thread and in the arena of the op, reads and
+            /// writes the data pointers the op passes without wrapping them in tensors, and
+            /// keeps its intermediates in a region of the caller's memory pool that is reserved
+            /// next to the caller's own intermediates. A call therefore allocates nothing.
+            class CPU_NestedFunction
+            {
+            public:
+                /// \brief Compiles `function` and reserves its intermediates in `caller`.
+                ///        Called by the builder of the op that calls it.
+                CPU_NestedFunction(CPU_ExternalFunction* caller,
+                                   const std::shared_ptr<Function>& function);
+
+                /// \brief Runs the function for the op of the call running on `ctx`.
+                /// \param inputs Data of the parameters, in order
+                /// \param outputs Data of the results, in order
+                void call(CPURuntimeContext* ctx,
+                          std::vector<void*>& inputs,
+                          std::vector<void*>& outputs) const;
+
+            private:
+                std::shared_ptr<CPU_ExternalFunction> m_external_function;
+                std::shared_ptr<CPU_CallFrame> m_call_frame;
+                // Offset of the intermediates in the first memory buffer of the caller
+                size_t m_memory_offset = 0;
+                bool m_has_memory = false;
+            };
+        }
+    }
+}
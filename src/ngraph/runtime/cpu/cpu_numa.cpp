@@ -0,0 +1,170 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#ifdef __linux__
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#ifdef __linux__
+// From linux/mempolicy.h, which is not always installed
+#define NGRAPH_MPOL_PREFERRED 1
+#define NGRAPH_MPOL_MF_MOVE (1 << 1)
+
+// Parses the sysfs list format, for example "0-3,8,10-11"
+static vector<int> parse_cpu_list(const string& list)
+{
+    vector<int> ids;
+    stringstream ss(list);
+    string range;
+    while (getline(ss, range, ','))
+    {
+        if (range.empty())
+        {
+            continue;
+        }
+        auto dash = range.find('-');
+        int first = atoi(range.substr(0, dash).c_str());
+        int last = dash == string::npos ? first : atoi(range.substr(dash + 1).c_str());
+        for (int id = first; id <= last; id++)
+        {
+            ids.push_back(id);
+        }
+    }
+    return ids;
+}
+
+static vector<int> read_sysfs_list(const string& path)
+{
+    ifstream in(path);
+    string list;
+    if (!in || !getline(in, list))
+    {
+        return {};
+    }
+    return parse_cpu_list(list);
+}
+#endif
+
+size_t runtime::cpu::numa::get_num_nodes()
+{
+#ifdef __linux__
+    static size_t num_nodes = []() {
+        auto nodes = read_sysfs_list("/sys/devices/system/node/online");
+        return nodes.empty() ? size_t(1) : static_cast<size_t>(nodes.back() + 1);
+    }();
+    return num_nodes;
+#else
+    return 1;
+#endif
+}
+
+bool runtime::cpu::numa::is_enabled()
+{
+    static bool enabled = (getenv("NGRAPH_CPU_NUMA") != nullptr) && (get_num_nodes() > 1);
+    return enabled;
+}
+
+vector<int> runtime::cpu::numa::get_node_cpus(size_t node)
+{
+#ifdef __linux__
+    return read_sysfs_list("/sys/devices/system/node/node" + to_string(node) + "/cpulist");
+#else
+    return {};
+#endif
+}
+
+bool runtime::cpu::numa::bind_thread_to_node(size_t node)
+{
+#ifdef __linux__
+    auto cpus = get_node_cpus(node);
+    if (cpus.empty())
+    {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus)
+    {
+        if (cpu < CPU_SETSIZE)
+        {
+            CPU_SET(cpu, &set);
+        }
+    }
+    if (sched_setaffinity(0, sizeof(set), &set) != 0)
+    {
+        NGRAPH_DEBUG << "Failed to bind thread to NUMA node " << node;
+        return false;
+    }
+    return true;
+#else
+    (void)node;
+    return false;
+#endif
+}
+
+bool runtime::cpu::numa::bind_memory_to_node(void* ptr, size_t size, size_t node)
+{
+#ifdef __linux__
+    constexpr size_t mask_bits = sizeof(unsigned long) * 8;
+    if (ptr == nullptr || node >= mask_bits)
+    {
+        return false;
+    }
+
+    // mbind works on whole pages; only touch the pages that lie entirely inside the
+    // buffer so that neighbouring allocations keep their own policy
+    const uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t begin = (reinterpret_cast<uintptr_t>(ptr) + page_size - 1) & ~(page_size - 1);
+    uintptr_t end = (reinterpret_cast<uintptr_t>(ptr) + size) & ~(page_size - 1);
+    if (end <= begin)
+    {
+        return false;
+    }
+
+    unsigned long node_mask = 1UL << node;
+    if (syscall(SYS_mbind,
+                reinterpret_cast<void*>(begin),
+                end - begin,
+                NGRAPH_MPOL_PREFERRED,
+                &node_mask,
+                mask_bits,
+                NGRAPH_MPOL_MF_MOVE) != 0)
+    {
+        NGRAPH_DEBUG << "Failed to bind " << (end - begin) << " bytes to NUMA node " << node;
+        return false;
+    }
+    return true;
+#else
+    (void)ptr;
+    (void)size;
+    (void)node;
+    return false;
+#endif
+}
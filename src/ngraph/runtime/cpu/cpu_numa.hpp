@@ -0,0 +1,55 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// Minimal NUMA helpers built directly on sysfs and the Linux scheduling and memory
+            /// policy syscalls so that the CPU backend does not need to link against libnuma.
+            /// On other platforms, or when the kernel reports a single node, every helper
+            /// degrades to a no-op.
+            namespace numa
+            {
+                /// \returns true if NUMA-aware placement was requested with NGRAPH_CPU_NUMA
+                ///          and the machine has more than one online node
+                bool is_enabled();
+
+                /// \returns the number of online NUMA nodes, at least 1
+                size_t get_num_nodes();
+
+                /// \returns the logical CPUs that belong to `node`
+                std::vector<int> get_node_cpus(size_t node);
+
+                /// \brief Restrict the calling thread to the CPUs of `node`
+                /// \returns false if the affinity could not be changed
+                bool bind_thread_to_node(size_t node);
+
+                /// \brief Prefer `node` for the pages backing [ptr, ptr + size). Pages that
+                ///        are already resident are migrated when the kernel allows it.
+                /// \returns false if the memory policy could not be applied
+                bool bind_memory_to_node(void* ptr, size_t size, size_t node);
+            }
+        }
+    }
+}
@@ -31,11 +31,25 @@ namespace ngraph
             class CPUOpAnnotations : public ngraph::op::util::OpAnnotations
             {
             public:
+                /// \brief MKLDNN forward convolution implementations, see MKLDNNConvTuner
+                enum class ConvolutionImpl
+                {
+                    unset,
+                    direct,
+                    winograd,
+                    gemm
+                };
+
                 CPUOpAnnotations() {}
                 bool is_mkldnn_op() { return m_mkldnn_op; }
                 void set_mkldnn_op(bool val) { m_mkldnn_op = val; }
+                /// \brief The implementation the layout pass tuned the convolution for, which
+                ///        the primitive must be built with to match its layouts
+                ConvolutionImpl get_convolution_impl() const { return m_convolution_impl; }
+                void set_convolution_impl(ConvolutionImpl impl) { m_convolution_impl = impl; }
             private:
                 bool m_mkldnn_op = false;
+                ConvolutionImpl m_convolution_impl = ConvolutionImpl::unset;
             };
 
             std::function<std::shared_ptr<ngraph::op::util::OpAnnotations>(void)>
@@ -0,0 +1,127 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+
+#include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/cpu_packed_gemm.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static int64_t to_cblas(cblas::Transpose transpose)
+{
+    return static_cast<int64_t>(transpose);
+}
+
+static cblas::Transpose get_transpose(bool transpose)
+{
+    return transpose ? cblas::Transpose::Transpose : cblas::Transpose::None;
+}
+
+runtime::cpu::PackedGemmOperand::PackedGemmOperand(bool pack_a,
+                                                   const float* data,
+                                                   bool transpose,
+                                                   int64_t m,
+                                                   int64_t n,
+                                                   int64_t k,
+                                                   int64_t ld)
+    : m_pack_a(pack_a)
+    , m_m(m)
+    , m_n(n)
+    , m_k(k)
+{
+    auto ident = pack_a ? cblas::Ident::AMatrix : cblas::Ident::BMatrix;
+    m_size = cblas::cblas_sgemm_pack_get_size(ident, m, n, k);
+    m_packed = cblas::cblas_sgemm_alloc(ident, m, n, k);
+    if (m_packed == nullptr)
+    {
+        throw ngraph_error("Failed to allocate a packed GEMM operand");
+    }
+    cblas::cblas_sgemm_pack(cblas::Layout::RowMajor,
+                            ident,
+                            get_transpose(transpose),
+                            m,
+                            n,
+                            k,
+                            1.0f,
+                            data,
+                            ld,
+                            m_packed);
+}
+
+runtime::cpu::PackedGemmOperand::~PackedGemmOperand()
+{
+    cblas::cblas_sgemm_free(m_packed);
+}
+
+void runtime::cpu::PackedGemmOperand::compute(
+    const float* other, bool transpose, int64_t ld, float beta, float* c, int64_t ldc) const
+{
+    const int64_t packed = static_cast<int64_t>(cblas::Storage::Packed);
+    if (m_pack_a)
+    {
+        cblas::cblas_sgemm_compute(cblas::Layout::RowMajor,
+                                   packed,
+                                   to_cblas(get_transpose(transpose)),
+                                   m_m,
+                                   m_n,
+                                   m_k,
+                                   m_packed,
+                                   m_k,
+                                   other,
+                                   ld,
+                                   beta,
+                                   c,
+                                   ldc);
+    }
+    else
+    {
+        cblas::cblas_sgemm_compute(cblas::Layout::RowMajor,
+                                   to_cblas(get_transpose(transpose)),
+                                   packed,
+                                   m_m,
+                                   m_n,
+                                   m_k,
+                                   other,
+                                   ld,
+                                   m_packed,
+                                   m_n,
+                                   beta,
+                                   c,
+                                   ldc);
+    }
+}
+
+shared_ptr<runtime::cpu::PackedGemmOperand>
+    runtime::cpu::make_packed_gemm_operand(const Node* node,
+                                           size_t input_index,
+                                           bool transpose,
+                                           int64_t m,
+                                           int64_t n,
+                                           int64_t k,
+                                           int64_t ld)
+{
+    static const bool s_disabled = std::getenv("NGRAPH_CPU_DISABLE_PACKED_GEMM") != nullptr;
+    auto constant = as_type_ptr<op::Constant>(node->get_argument(input_index));
+    if (s_disabled || constant == nullptr || constant->get_element_type() != element::f32)
+    {
+        return nullptr;
+    }
+    return make_shared<PackedGemmOperand>(
+        input_index == 0, constant->get_data_ptr<float>(), transpose, m, n, k, ld);
+}
@@ -0,0 +1,94 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "ngraph/node.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief One constant operand of a row-major f32 GEMM, packed once into MKL's
+            ///        internal blocked format.
+            ///
+            /// Built at compile time for Dot and MatmulBias whose A or B input is a Constant and
+            /// shared by every runtime context, so calls skip the packing cblas_sgemm would
+            /// otherwise redo on each invocation. The packed layout is only valid for the
+            /// m, n and k it was created with.
+            class CPU_BACKEND_API PackedGemmOperand
+            {
+            public:
+                /// \param pack_a true to pack the A operand, false to pack B
+                /// \param data Row-major data of the operand
+                /// \param transpose true if the operand is used transposed
+                /// \param ld Leading dimension of `data`
+                PackedGemmOperand(bool pack_a,
+                                  const float* data,
+                                  bool transpose,
+                                  int64_t m,
+                                  int64_t n,
+                                  int64_t k,
+                                  int64_t ld);
+                ~PackedGemmOperand();
+
+                PackedGemmOperand(const PackedGemmOperand&) = delete;
+                PackedGemmOperand& operator=(const PackedGemmOperand&) = delete;
+
+                /// \brief C = op(A) * op(B) + beta * C, where the packed operand stands in for
+                ///        the one passed at construction.
+                /// \param other Data of the operand that was not packed
+                /// \param transpose true if `other` is used transposed
+                /// \param ld Leading dimension of `other`
+                void compute(const float* other,
+                             bool transpose,
+                             int64_t ld,
+                             float beta,
+                             float* c,
+                             int64_t ldc) const;
+
+                /// \returns The bytes of the packed operand
+                size_t size() const { return m_size; }
+
+            private:
+                bool m_pack_a;
+                int64_t m_m;
+                int64_t m_n;
+                int64_t m_k;
+                size_t m_size;
+                float* m_packed;
+            };
+
+            /// \brief Packs the operand of a GEMM node whose input `input_index` (0 for A, 1 for
+            ///        B) is a Constant.
+            /// \returns nullptr if the input is not a Constant or packing is disabled with
+            ///          NGRAPH_CPU_DISABLE_PACKED_GEMM
+            std::shared_ptr<PackedGemmOperand> make_packed_gemm_operand(const Node* node,
+                                                                        size_t input_index,
+                                                                        bool transpose,
+                                                                        int64_t m,
+                                                                        int64_t n,
+                                                                        int64_t k,
+                                                                        int64_t ld);
+        }
+    }
+}
@@ -0,0 +1,141 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <pthread.h>
+
+#include "ngraph/runtime/cpu/cpu_prefetcher.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Cache line size of the supported x86 CPUs
+static const size_t s_cache_line = 64;
+
+// Bumped in the child of every fork
+static atomic<uint64_t> s_forks{0};
+
+static void count_fork()
+{
+    s_forks.fetch_add(1, memory_order_relaxed);
+}
+
+runtime::cpu::CPU_Prefetcher::CPU_Prefetcher()
+    : m_forks(s_forks.load(memory_order_relaxed))
+    , m_state(new State())
+{
+    static once_flag registered;
+    call_once(registered, []() { pthread_atfork(nullptr, nullptr, count_fork); });
+    m_thread.reset(new thread(&CPU_Prefetcher::worker_loop, m_state.load()));
+}
+
+runtime::cpu::CPU_Prefetcher::~CPU_Prefetcher()
+{
+    if (m_forks.load() != s_forks.load(memory_order_relaxed))
+    {
+        // Forked without a prefetch since; the thread was the parent's
+        m_thread.release();
+        return;
+    }
+    State* state = m_state.load();
+    {
+        lock_guard<mutex> lock(state->mutex);
+        state->stop = true;
+    }
+    state->queued.notify_one();
+    m_thread->join();
+    delete state;
+}
+
+runtime::cpu::CPU_Prefetcher::State* runtime::cpu::CPU_Prefetcher::get_state()
+{
+    uint64_t forks = s_forks.load(memory_order_relaxed);
+    if (m_forks.load(memory_order_acquire) != forks)
+    {
+        lock_guard<mutex> lock(m_start_mutex);
+        if (m_forks.load() != forks)
+        {
+            m_thread.release();
+            m_state.store(new State());
+            m_thread.reset(new thread(&CPU_Prefetcher::worker_loop, m_state.load()));
+            m_forks.store(forks, memory_order_release);
+        }
+    }
+    return m_state.load();
+}
+
+void runtime::cpu::CPU_Prefetcher::prefetch(const void* data, size_t size)
+{
+    if (data == nullptr || size == 0)
+    {
+        return;
+    }
+    State* state = get_state();
+    {
+        lock_guard<mutex> lock(state->mutex);
+        state->queue.emplace_back(static_cast<const char*>(data), size);
+    }
+    state->queued.notify_one();
+}
+
+void runtime::cpu::CPU_Prefetcher::wait()
+{
+    State* state = get_state();
+    unique_lock<mutex> lock(state->mutex);
+    state->drained.wait(lock, [state] { return state->queue.empty() && !state->busy; });
+}
+
+size_t runtime::cpu::CPU_Prefetcher::get_prefetched_bytes() const
+{
+    State* state = m_state.load();
+    lock_guard<mutex> lock(state->mutex);
+    return state->prefetched_bytes;
+}
+
+void runtime::cpu::CPU_Prefetcher::worker_loop(State* state)
+{
+    unique_lock<mutex> lock(state->mutex);
+    while (true)
+    {
+        state->queued.wait(lock, [state] { return state->stop || !state->queue.empty(); });
+        if (state->stop)
+        {
+            return;
+        }
+        auto region = state->queue.front();
+        state->queue.pop_front();
+        state->busy = true;
+        lock.unlock();
+
+        // Real loads rather than prefetch hints, so that the line is fetched even when the
+        // hardware would drop the hint
+        const volatile char* data = region.first;
+        char sink = 0;
+        for (size_t offset = 0; offset < region.second; offset += s_cache_line)
+        {
+            sink ^= data[offset];
+        }
+        sink ^= data[region.second - 1];
+        (void)sink;
+
+        lock.lock();
+        state->busy = false;
+        state->prefetched_bytes += region.second;
+        if (state->queue.empty())
+        {
+            state->drained.notify_all();
+        }
+    }
+}
@@ -0,0 +1,86 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Helper thread that reads memory ahead of the ops that need it.
+            ///
+            /// DEX runs its functors in a fixed order, so while one op runs the weights and
+            /// inputs of the ops after it are known. Queued regions are read one cache line at a
+            /// time on the helper thread, which pulls them from DRAM into the shared last level
+            /// cache and overlaps the misses of big weights with the current op.
+            ///
+            /// A process forked from the owner has no helper thread; the first prefetch in it
+            /// starts a new one.
+            class CPU_Prefetcher
+            {
+            public:
+                CPU_Prefetcher();
+                ~CPU_Prefetcher();
+                CPU_Prefetcher(const CPU_Prefetcher&) = delete;
+                CPU_Prefetcher& operator=(const CPU_Prefetcher&) = delete;
+
+                /// \brief Queues `size` bytes at `data` to be read
+                void prefetch(const void* data, size_t size);
+                /// \brief Returns once every queued region has been read
+                void wait();
+                /// \returns the number of bytes read so far
+                size_t get_prefetched_bytes() const;
+
+            private:
+                struct State
+                {
+                    std::mutex mutex;
+                    std::condition_variable queued;
+                    std::condition_variable drained;
+                    std::deque<std::pair<const char*, size_t>> queue;
+                    bool busy = false;
+                    bool stop = false;
+                    size_t prefetched_bytes = 0;
+                };
+
+                static void worker_loop(State* state);
+                // Starts a new helper thread and state if the process forked since the current
+                // ones were started, and returns the state
+                State* get_state();
+
+                std::mutex m_start_mutex;
+                // Forks seen by the process when the helper thread was started
+                std::atomic<uint64_t> m_forks;
+                // After a fork the old state and thread are abandoned rather than destroyed,
+                // since the thread does not exist in the child and its mutex may be held
+                std::atomic<State*> m_state;
+                std::unique_ptr<std::thread> m_thread;
+            };
+        }
+    }
+}
@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <memory>
 #include <set>
 
 #if defined(NGRAPH_TBB_ENABLE)
@@ -30,10 +31,6 @@
 
 #include "ngraph/op/experimental/compiled_kernel.hpp"
 
-#ifdef NGRAPH_MLIR_ENABLE
-#include "contrib/mlir/runtime/cpu/cpu_runtime.hpp"
-#endif
-
 namespace mkldnn
 {
     class primitive;
@@ -44,8 +41,11 @@ namespace ngraph
     namespace runtime
     {
         class AlignedBuffer;
+        class CancellationToken;
+        class TensorFence;
     }
     class State;
+    class DistributedRequest;
 }
 
 namespace ngraph
@@ -69,6 +69,15 @@ namespace ngraph
                 std::vector<mkldnn::memory*> mkldnn_memories;
                 std::vector<mkldnn::primitive*> mkldnn_primitives;
                 std::vector<AlignedBuffer*> memory_buffers;
+                // memory_buffers[0] data the intermediate pointers in buffer_data point into
+                void* bound_memory_pool;
+                // pipeline stage whose tensors this call runs on, or 0 for other tensors, and
+                // the stage whose tensors the input and output pointers in buffer_data are for
+                size_t io_binding;
+                size_t bound_io_binding;
+                // constants update the constant pointers in buffer_data are for, and its table
+                size_t constants_version;
+                std::shared_ptr<const void> constant_updates;
                 std::vector<mkldnn::memory::desc*> mkldnn_scratchpad_mds;
                 AlignedBuffer* scratchpad_buffer;
                 std::vector<char*> mkldnn_workspaces;
@@ -77,22 +86,30 @@ namespace ngraph
                 tbb::global_control* c;
 #endif
                 State* const* states;
+                // collectives started by AllReduceStart and not yet waited on
+                std::vector<DistributedRequest*> distributed_requests;
                 std::set<size_t> breakpoints;
                 size_t pc;
-#ifdef NGRAPH_MLIR_ENABLE
-                /// Maps CompiledKernel nodes to their MLIR compiler
-                /// The MLIR compiler caches the compiled code on the first invocation,
-                /// and may in the future support re-compilation
-                std::unordered_map<ngraph::op::CompiledKernel*,
-                                   ngraph::runtime::ngmlir::MLIRCPURuntime>
-                    mlir_runtimes;
-#endif
+                // checked between ops in DEX mode when set, see Executable::call_cancellable
+                const CancellationToken* cancellation;
+                // fences of the inputs still being streamed in, indexed like the inputs, or
+                // empty when every input is complete; see Tensor::begin_streaming_write
+                std::vector<std::shared_ptr<TensorFence>> input_fences;
+                // executor thread pool (and NUMA node) this context's kernels run on
+                int arena;
+                // set while the call scheduler has given the call thread pool `arena` alone,
+                // so the call must not spread to the other pools
+                bool scheduled;
+                // scratchpads for inter-op workers 1..N-1; worker 0 uses scratchpad_buffer
+                std::vector<AlignedBuffer*> worker_scratchpads;
             };
             }
 
             struct CPUExecutionContext
             {
                 int arena;
+                // Upper bound on the intra-op threads of the op, 0 for the whole arena
+                int num_threads;
             };
 
             typedef std::function<void(CPURuntimeContext*, CPUExecutionContext*)> CPUKernelFunctor;
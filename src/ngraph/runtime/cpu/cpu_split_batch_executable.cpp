@@ -0,0 +1,230 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <exception>
+#include <future>
+#include <thread>
+
+#include "ngraph/check.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/batching/batch_rows.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
+#include "ngraph/runtime/cpu/cpu_split_batch_executable.hpp"
+#include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/specialize_function.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static bool is_batch_splittable(const PartialShape& shape, size_t num_nodes)
+{
+    return shape.is_static() && static_cast<size_t>(shape.rank()) > 0 &&
+           shape.to_shape()[0] % num_nodes == 0;
+}
+
+static Shape get_share_shape(const Shape& shape, size_t num_nodes)
+{
+    Shape share = shape;
+    share[0] /= num_nodes;
+    return share;
+}
+
+bool runtime::cpu::CPU_SplitBatchExecutable::is_splittable(const Function& func,
+                                                           size_t num_nodes)
+{
+    if (num_nodes < 2)
+    {
+        return false;
+    }
+    for (auto& param : func.get_parameters())
+    {
+        if (!is_batch_splittable(param->get_output_partial_shape(0), num_nodes))
+        {
+            return false;
+        }
+    }
+    for (auto& result : func.get_results())
+    {
+        if (!is_batch_splittable(result->get_output_partial_shape(0), num_nodes))
+        {
+            return false;
+        }
+    }
+
+    // Each replica only sees its share of the rows, so no op may combine rows of the batch
+    return batching::keeps_batch_rows_apart(func);
+}
+
+runtime::cpu::CPU_SplitBatchExecutable::CPU_SplitBatchExecutable(
+    shared_ptr<Function> func, size_t num_nodes, const CompileReplica& compile_replica)
+{
+    NGRAPH_CHECK(is_splittable(*func, num_nodes),
+                 "The batch of every parameter and result must split across ",
+                 num_nodes,
+                 " NUMA nodes");
+    set_parameters_and_results(*func);
+
+    vector<PartialShape> replica_shapes;
+    for (auto& param : func->get_parameters())
+    {
+        m_input_types.push_back(param->get_element_type());
+        m_input_shapes.push_back(get_share_shape(param->get_shape(), num_nodes));
+        replica_shapes.push_back(m_input_shapes.back());
+    }
+    for (auto& result : func->get_results())
+    {
+        m_output_types.push_back(result->get_element_type());
+        m_output_shapes.push_back(get_share_shape(result->get_shape(), num_nodes));
+    }
+
+    // Each replica is built and compiled on a thread of its node, so that the pages of its
+    // constants and of what the compiler allocates are first touched there
+    m_replicas.resize(num_nodes);
+    vector<exception_ptr> errors(num_nodes);
+    vector<thread> builders;
+    for (size_t node = 0; node < num_nodes; node++)
+    {
+        builders.emplace_back([&, node]() {
+            try
+            {
+                numa::bind_thread_to_node(node);
+                auto replica = specialize_function(func,
+                                                   m_input_types,
+                                                   replica_shapes,
+                                                   vector<void*>(replica_shapes.size()));
+                // The specialized Constants share their data with `func`
+                for (auto& op : replica->get_ordered_ops())
+                {
+                    if (auto constant = as_type_ptr<op::Constant>(op))
+                    {
+                        replace_node(constant,
+                                     make_shared<op::Constant>(constant->get_element_type(),
+                                                               constant->get_shape(),
+                                                               constant->get_data_ptr()));
+                    }
+                }
+                const ResultVector& results = replica->get_results();
+                for (size_t i = 0; i < results.size(); i++)
+                {
+                    NGRAPH_CHECK(results[i]->get_output_partial_shape(0).same_scheme(
+                                     m_output_shapes[i]),
+                                 "Result ",
+                                 i,
+                                 " does not scale with the batch dimension: expected ",
+                                 m_output_shapes[i],
+                                 ", got ",
+                                 results[i]->get_output_partial_shape(0));
+                }
+                m_replicas[node] = compile_replica(replica, static_cast<int>(node));
+            }
+            catch (...)
+            {
+                errors[node] = current_exception();
+            }
+        });
+    }
+    for (auto& builder : builders)
+    {
+        builder.join();
+    }
+    for (auto& error : errors)
+    {
+        if (error)
+        {
+            rethrow_exception(error);
+        }
+    }
+}
+
+bool runtime::cpu::CPU_SplitBatchExecutable::call(
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    validate(outputs, inputs);
+
+    // The other replicas run on threads of their own node; the calling thread keeps its
+    // affinity and runs the first
+    vector<future<bool>> others;
+    for (size_t node = 1; node < m_replicas.size(); node++)
+    {
+        others.push_back(async(launch::async, [this, node, &outputs, &inputs]() {
+            numa::bind_thread_to_node(node);
+            return call_replica(node, outputs, inputs);
+        }));
+    }
+    bool rc = true;
+    exception_ptr error;
+    try
+    {
+        rc = call_replica(0, outputs, inputs);
+    }
+    catch (...)
+    {
+        error = current_exception();
+    }
+    // Every replica writes to the caller's tensors, so all of them finish before returning
+    for (auto& other : others)
+    {
+        try
+        {
+            rc = other.get() && rc;
+        }
+        catch (...)
+        {
+            if (!error)
+            {
+                error = current_exception();
+            }
+        }
+    }
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+    return rc;
+}
+
+bool runtime::cpu::CPU_SplitBatchExecutable::call_replica(
+    size_t node,
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    vector<shared_ptr<runtime::Tensor>> input_shares;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        size_t bytes = shape_size(m_input_shapes[i]) * m_input_types[i].size();
+        char* data = static_pointer_cast<CPUTensorView>(inputs[i])->get_data_ptr();
+        input_shares.push_back(make_shared<CPUTensorView>(
+            m_input_types[i], m_input_shapes[i], data + node * bytes));
+    }
+    vector<shared_ptr<runtime::Tensor>> output_shares;
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        size_t bytes = shape_size(m_output_shapes[i]) * m_output_types[i].size();
+        char* data = static_pointer_cast<CPUTensorView>(outputs[i])->get_data_ptr();
+        output_shares.push_back(make_shared<CPUTensorView>(
+            m_output_types[i], m_output_shapes[i], data + node * bytes));
+    }
+    return m_replicas[node]->call(output_shares, input_shares);
+}
+
+vector<runtime::PerformanceCounter>
+    runtime::cpu::CPU_SplitBatchExecutable::get_performance_data() const
+{
+    return m_replicas[0]->get_performance_data();
+}
@@ -0,0 +1,87 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "cpu_backend_visibility.h"
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/executable.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            class CPU_Executable;
+
+            /// \brief Executable that splits the batch of each call across the NUMA nodes.
+            ///
+            /// Every node gets a replica of the function, specialized to an equal share of
+            /// the leading (batch) dimension of each Parameter and Result and compiled on a
+            /// thread bound to the node. A replica has its own copy of the constants and runs
+            /// on the thread pools of its node, which also hold its intermediate buffers (see
+            /// NGRAPH_CPU_NUMA). A call runs the replicas concurrently on views of the
+            /// caller's tensors at the offsets of their shares, so the outputs are written in
+            /// place.
+            ///
+            /// Graphs whose ops hard-code the batch size, for example a Reshape with a fixed
+            /// output shape, fail validation when the replicas are built. Graphs with ops that
+            /// combine rows of the batch, such as a Sum or Softmax over axis 0, are not
+            /// splittable.
+            class CPU_BACKEND_API CPU_SplitBatchExecutable : public runtime::Executable
+            {
+            public:
+                /// \brief Compiles the replica for a NUMA node
+                using CompileReplica = std::function<std::shared_ptr<CPU_Executable>(
+                    std::shared_ptr<Function> replica, int numa_node)>;
+
+                CPU_SplitBatchExecutable(std::shared_ptr<Function> func,
+                                         size_t num_nodes,
+                                         const CompileReplica& compile_replica);
+
+                /// \returns true if the leading dimension of every Parameter and Result of
+                ///          `func` is static and a multiple of `num_nodes`, and every op
+                ///          computes each row of the batch from the same row of its inputs
+                static bool is_splittable(const Function& func, size_t num_nodes);
+
+                bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                          const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+                /// \returns the performance data of the replica on node 0
+                std::vector<PerformanceCounter> get_performance_data() const override;
+
+                size_t get_num_replicas() const { return m_replicas.size(); }
+            private:
+                /// \brief Calls replica `node` on its share of the tensors
+                bool call_replica(size_t node,
+                                  const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                                  const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+                std::vector<std::shared_ptr<CPU_Executable>> m_replicas;
+                // Types and shapes of the share of one replica
+                std::vector<element::Type> m_input_types;
+                std::vector<Shape> m_input_shapes;
+                std::vector<element::Type> m_output_types;
+                std::vector<Shape> m_output_shapes;
+            };
+        }
+    }
+}
@@ -103,6 +103,15 @@ void runtime::cpu::CPUTensorView::write(const void* source, size_t n)
     memcpy(target, source, n);
 }
 
+void runtime::cpu::CPUTensorView::write_at(const void* source, size_t offset, size_t n)
+{
+    if (offset + n > buffer_size)
+    {
+        throw out_of_range("write access past end of tensor");
+    }
+    memcpy(get_data_ptr() + offset, source, n);
+}
+
 void runtime::cpu::CPUTensorView::read(void* target, size_t n) const
 {
     if (n > buffer_size)
@@ -49,6 +49,8 @@ namespace ngraph
                 /// \param n Number of bytes to write, must be integral number of elements.
                 void write(const void* p, size_t n) override;
 
+                void write_at(const void* p, size_t offset, size_t n) override;
+
                 /// \brief Read bytes directly from the tensor
                 /// \param p Pointer to destination for data
                 /// \param n Number of bytes to read, must be integral number of elements.
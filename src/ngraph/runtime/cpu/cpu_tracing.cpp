@@ -44,7 +44,9 @@ void ngraph::runtime::cpu::to_json(nlohmann::json& json, const TraceEvent& event
 
 void ngraph::runtime::cpu::GenerateTimeline(const std::vector<OpAttributes>& op_attrs,
                                             int64_t* op_durations,
-                                            const std::string& file_name)
+                                            const std::string& file_name,
+                                            size_t scratchpad_bytes,
+                                            size_t workspace_bytes)
 {
     nlohmann::json timeline;
     std::list<TraceEvent> trace;
@@ -66,6 +68,22 @@ void ngraph::runtime::cpu::GenerateTimeline(const std::vector<OpAttributes>& op_
     }
 
     timeline["traceEvents"] = trace;
+    // Counter events hold their value until the next one, so one per op gives the memory in
+    // use over its duration
+    ts = 0;
+    for (size_t i = 0; i < op_attrs.size(); i++)
+    {
+        nlohmann::json counter;
+        counter["ph"] = "C";
+        counter["name"] = "Memory";
+        counter["pid"] = 0;
+        counter["ts"] = ts;
+        counter["args"]["tensors"] = op_attrs[i].LiveTensorBytes;
+        counter["args"]["scratchpad"] = scratchpad_bytes;
+        counter["args"]["workspaces"] = workspace_bytes;
+        timeline["traceEvents"].push_back(counter);
+        ts += op_durations[i];
+    }
     out << timeline;
     out.close();
 
@@ -80,7 +98,9 @@ bool ngraph::runtime::cpu::IsTracingEnabled()
 #else
 void ngraph::runtime::cpu::GenerateTimeline(const std::vector<OpAttributes>& op_attrs,
                                             int64_t* op_durations,
-                                            const std::string& file_name)
+                                            const std::string& file_name,
+                                            size_t scratchpad_bytes,
+                                            size_t workspace_bytes)
 {
     return;
 }
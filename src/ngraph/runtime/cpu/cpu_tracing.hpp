@@ -71,9 +71,14 @@ namespace ngraph
             void to_json(nlohmann::json& json, const TraceEvent& event);
 #endif
 
+            /// \brief Writes the op durations as a Chrome trace, with a "Memory" counter track
+            ///        of the live intermediate tensor bytes, scratchpad and workspace bytes at
+            ///        each op.
             void GenerateTimeline(const std::vector<OpAttributes>& op_attrs,
                                   int64_t* op_durations,
-                                  const std::string& file_name);
+                                  const std::string& file_name,
+                                  size_t scratchpad_bytes = 0,
+                                  size_t workspace_bytes = 0);
             bool IsTracingEnabled();
         }
     }
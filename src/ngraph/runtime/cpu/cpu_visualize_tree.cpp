@@ -17,6 +17,7 @@
 #include <string>
 
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/cpu_visualize_tree.hpp"
@@ -93,6 +94,24 @@ namespace ngraph
                     {ngraph::op::Reshape::type_info, visualize_layout_format}};
                 return vtom;
             }
+
+            void visualize_performance(const std::shared_ptr<Function>& function,
+                                       const std::vector<PerformanceCounter>& counters,
+                                       const std::string& file_name)
+            {
+                auto outline_layouts = [](const Node& node, vector<string>& attributes) {
+                    if (is_type<runtime::cpu::op::ConvertLayout>(&node))
+                    {
+                        attributes.push_back("color=darkorange");
+                        attributes.push_back("penwidth=3");
+                    }
+                };
+                pass::VisualizeTree visualize(file_name, outline_layouts);
+                visualize.set_ops_to_details(get_visualize_tree_ops_map());
+                visualize.set_performance_data(counters);
+                vector<shared_ptr<Function>> functions{function};
+                visualize.run_on_module(functions);
+            }
         }
     }
 }
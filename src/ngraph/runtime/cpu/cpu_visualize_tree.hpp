@@ -24,9 +24,12 @@
 #include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
+#include <vector>
 
+#include "ngraph/function.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/pass/manager_state.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
 
 namespace ngraph
 {
@@ -35,6 +38,13 @@ namespace ngraph
         namespace cpu
         {
             const visualize_tree_ops_map_t& get_visualize_tree_ops_map();
+
+            /// \brief Draws a function compiled by the CPU backend with the performance
+            ///        counters of a profiled run, see VisualizeTree::set_performance_data.
+            ///        Layout conversions are outlined so that chains of reorders stand out.
+            void visualize_performance(const std::shared_ptr<Function>& function,
+                                       const std::vector<PerformanceCounter>& counters,
+                                       const std::string& file_name);
         }
     }
 }
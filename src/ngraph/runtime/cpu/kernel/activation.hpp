@@ -0,0 +1,165 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Single pass kernels for the element-wise fused ops that FusedOpDecomposition
+                // would otherwise split into chains of primitive ops.
+
+                template <typename ElementType>
+                void clamp(void* input0,
+                           void* output,
+                           ElementType min,
+                           ElementType max,
+                           size_t count,
+                           int arena)
+                {
+                    Eigen::array<Eigen::Index, 1> out_dims, in_dims;
+
+                    out_dims[0] = in_dims[0] = count;
+
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> out(
+                        static_cast<ElementType*>(output), out_dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
+                        static_cast<ElementType*>(input0), in_dims);
+
+                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
+                        in0.cwiseMax(min).cwiseMin(max);
+                }
+
+                template <typename ElementType>
+                void hard_sigmoid(void* input0,
+                                  void* output,
+                                  ElementType alpha,
+                                  ElementType beta,
+                                  size_t count,
+                                  int arena)
+                {
+                    Eigen::array<Eigen::Index, 1> out_dims, in_dims;
+
+                    out_dims[0] = in_dims[0] = count;
+
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> out(
+                        static_cast<ElementType*>(output), out_dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
+                        static_cast<ElementType*>(input0), in_dims);
+
+                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
+                        (in0 * alpha + beta).cwiseMax(ElementType(0)).cwiseMin(ElementType(1));
+                }
+
+                // lambda * (max(x, 0) + alpha * (exp(min(x, 0)) - 1)), which is Elu for a
+                // lambda of 1 and Selu otherwise
+                template <typename ElementType>
+                void selu(void* input0,
+                          void* output,
+                          ElementType alpha,
+                          ElementType lambda,
+                          size_t count,
+                          int arena)
+                {
+                    Eigen::array<Eigen::Index, 1> out_dims, in_dims;
+
+                    out_dims[0] = in_dims[0] = count;
+
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> out(
+                        static_cast<ElementType*>(output), out_dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
+                        static_cast<ElementType*>(input0), in_dims);
+
+                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
+                        (in0.cwiseMax(ElementType(0)) +
+                         (in0.cwiseMin(ElementType(0)).exp() - ElementType(1)) * alpha) *
+                        lambda;
+                }
+
+                template <typename ElementType>
+                void elu(void* input0, void* output, ElementType alpha, size_t count, int arena)
+                {
+                    selu<ElementType>(input0, output, alpha, ElementType(1), count, arena);
+                }
+
+                // x < 0 ? x * slope : x, where element i uses slope (i / inner) % channels. This
+                // covers a single slope, one slope per channel and one slope per element.
+                template <typename ElementType>
+                void prelu(void* input0,
+                           void* slope,
+                           void* output,
+                           size_t count,
+                           size_t channels,
+                           size_t inner,
+                           int arena)
+                {
+                    auto in = static_cast<const ElementType*>(input0);
+                    auto alpha = static_cast<const ElementType*>(slope);
+                    auto out = static_cast<ElementType*>(output);
+
+                    auto prelu_range = [&](Eigen::Index first, Eigen::Index last) {
+                        size_t i = first;
+                        while (i < static_cast<size_t>(last))
+                        {
+                            size_t row = i / inner;
+                            size_t row_end = std::min(static_cast<size_t>(last), (row + 1) * inner);
+                            ElementType s = alpha[row % channels];
+                            for (; i < row_end; i++)
+                            {
+                                out[i] = in[i] < ElementType(0) ? in[i] * s : in[i];
+                            }
+                        }
+                    };
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        count,
+                        Eigen::TensorOpCost(2 * sizeof(ElementType), sizeof(ElementType), 1),
+                        prelu_range);
+                }
+
+                template <typename ElementType>
+                void squared_difference(
+                    void* input0, void* input1, void* output, size_t count, int arena)
+                {
+                    Eigen::array<Eigen::Index, 1> out_dims, in_dims;
+
+                    out_dims[0] = in_dims[0] = count;
+
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> out(
+                        static_cast<ElementType*>(output), out_dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
+                        static_cast<ElementType*>(input0), in_dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in1(
+                        static_cast<ElementType*>(input1), in_dims);
+
+                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
+                        (in0 - in1).square();
+                }
+            }
+        }
+    }
+}
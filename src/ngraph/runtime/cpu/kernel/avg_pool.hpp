@@ -16,7 +16,12 @@
 
 #pragma once
 
-#include "ngraph/runtime/reference/avg_pool.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "ngraph/runtime/cpu/kernel/pool_window.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -27,6 +32,16 @@ namespace ngraph
         {
             namespace kernel
             {
+                // Integer windows are summed in 64 bits so that they cannot overflow. int8 and
+                // uint8 averages are rounded to nearest, other integer averages truncate.
+                template <typename ElementType>
+                using avg_pool_accumulator_t = typename std::conditional<
+                    std::is_integral<ElementType>::value,
+                    typename std::conditional<std::is_signed<ElementType>::value,
+                                              int64_t,
+                                              uint64_t>::type,
+                    ElementType>::type;
+
                 template <typename ElementType>
                 void avg_pool(void* arg,
                               void* out,
@@ -36,17 +51,61 @@ namespace ngraph
                               const Strides& window_movement_strides,
                               const Shape& padding_below,
                               const Shape& padding_above,
-                              bool include_padding_in_avg_computation)
+                              bool include_padding_in_avg_computation,
+                              int arena)
                 {
-                    reference::avg_pool<ElementType>(static_cast<const ElementType*>(arg),
-                                                     static_cast<ElementType*>(out),
-                                                     arg_shape,
-                                                     out_shape,
-                                                     window_shape,
-                                                     window_movement_strides,
-                                                     padding_below,
-                                                     padding_above,
-                                                     include_padding_in_avg_computation);
+                    using Accumulator = avg_pool_accumulator_t<ElementType>;
+                    const bool round = std::is_same<ElementType, int8_t>::value ||
+                                       std::is_same<ElementType, uint8_t>::value;
+
+                    PoolGeometry geometry(arg_shape,
+                                          out_shape,
+                                          window_shape,
+                                          window_movement_strides,
+                                          padding_below,
+                                          padding_above);
+                    double bytes = sizeof(ElementType);
+                    Eigen::TensorOpCost plane_cost(
+                        geometry.out_plane_size * geometry.window_size * bytes,
+                        geometry.out_plane_size * bytes,
+                        geometry.out_plane_size * (geometry.window_size + 1));
+
+                    parallel_for_planes(
+                        geometry, plane_cost, arena, [&](PoolWindow& window, size_t plane) {
+                            auto in = static_cast<const ElementType*>(arg) +
+                                      plane * geometry.in_plane_size;
+                            auto dst =
+                                static_cast<ElementType*>(out) + plane * geometry.out_plane_size;
+                            window.for_each_output([&](size_t out_index) {
+                                Accumulator sum = 0;
+                                window.for_each_row([&](size_t in_offset, size_t length, size_t) {
+                                    const ElementType* row = in + in_offset;
+                                    for (size_t i = 0; i < length; i++)
+                                    {
+                                        sum += row[i];
+                                    }
+                                });
+                                size_t n = include_padding_in_avg_computation
+                                               ? window.padded_count()
+                                               : window.valid_count();
+                                // Shape inference rejects windows that lie entirely in the
+                                // padding, so n is only zero for an empty window.
+                                if (n == 0)
+                                {
+                                    dst[out_index] = 0;
+                                }
+                                else if (round)
+                                {
+                                    dst[out_index] = static_cast<ElementType>(
+                                        std::nearbyint(static_cast<float>(sum) / n));
+                                }
+                                else
+                                {
+                                    dst[out_index] =
+                                        static_cast<ElementType>(sum / static_cast<Accumulator>(n));
+                                }
+                            });
+                        });
                 }
 
                 template <typename ElementType>
@@ -58,18 +117,47 @@ namespace ngraph
                                        const Strides& window_movement_strides,
                                        const Shape& padding_below,
                                        const Shape& padding_above,
-                                       bool include_padding_in_avg_computation)
+                                       bool include_padding_in_avg_computation,
+                                       int arena)
                 {
-                    reference::avg_pool_backprop<ElementType>(
-                        static_cast<const ElementType*>(delta),
-                        static_cast<ElementType*>(out),
-                        delta_shape,
-                        out_shape,
-                        window_shape,
-                        window_movement_strides,
-                        padding_below,
-                        padding_above,
-                        include_padding_in_avg_computation);
+                    PoolGeometry geometry(out_shape,
+                                          delta_shape,
+                                          window_shape,
+                                          window_movement_strides,
+                                          padding_below,
+                                          padding_above);
+                    double bytes = sizeof(ElementType);
+                    Eigen::TensorOpCost plane_cost(
+                        geometry.out_plane_size * (geometry.window_size + 1) * bytes,
+                        (geometry.in_plane_size + geometry.out_plane_size * geometry.window_size) *
+                            bytes,
+                        geometry.out_plane_size * (geometry.window_size + 1));
+
+                    parallel_for_planes(
+                        geometry, plane_cost, arena, [&](PoolWindow& window, size_t plane) {
+                            auto d = static_cast<const ElementType*>(delta) +
+                                     plane * geometry.out_plane_size;
+                            auto dst =
+                                static_cast<ElementType*>(out) + plane * geometry.in_plane_size;
+                            std::memset(dst, 0, geometry.in_plane_size * sizeof(ElementType));
+                            window.for_each_output([&](size_t out_index) {
+                                size_t n = include_padding_in_avg_computation
+                                               ? window.padded_count()
+                                               : window.valid_count();
+                                if (n == 0)
+                                {
+                                    return;
+                                }
+                                ElementType share = d[out_index] / static_cast<ElementType>(n);
+                                window.for_each_row([&](size_t in_offset, size_t length, size_t) {
+                                    ElementType* row = dst + in_offset;
+                                    for (size_t i = 0; i < length; i++)
+                                    {
+                                        row[i] += share;
+                                    }
+                                });
+                            });
+                        });
                 }
             }
         }
@@ -0,0 +1,242 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Products with fewer multiply-adds than this are too small for the BLAS library
+                // to thread, so a batch of them is split over the threads of the arena instead.
+                static const size_t BATCH_GEMM_SMALL = 64 * 64 * 64;
+
+                inline void gemm(cblas::Transpose transpose_a,
+                                 cblas::Transpose transpose_b,
+                                 size_t m,
+                                 size_t n,
+                                 size_t k,
+                                 const float* a,
+                                 size_t lda,
+                                 const float* b,
+                                 size_t ldb,
+                                 float* c,
+                                 size_t ldc)
+                {
+                    cblas::cblas_sgemm(cblas::Layout::RowMajor,
+                                       transpose_a,
+                                       transpose_b,
+                                       m,
+                                       n,
+                                       k,
+                                       1.0f,
+                                       a,
+                                       lda,
+                                       b,
+                                       ldb,
+                                       0.0f,
+                                       c,
+                                       ldc);
+                }
+
+                inline void gemm(cblas::Transpose transpose_a,
+                                 cblas::Transpose transpose_b,
+                                 size_t m,
+                                 size_t n,
+                                 size_t k,
+                                 const double* a,
+                                 size_t lda,
+                                 const double* b,
+                                 size_t ldb,
+                                 double* c,
+                                 size_t ldc)
+                {
+                    cblas::cblas_dgemm(cblas::Layout::RowMajor,
+                                       transpose_a,
+                                       transpose_b,
+                                       m,
+                                       n,
+                                       k,
+                                       1.0,
+                                       a,
+                                       lda,
+                                       b,
+                                       ldb,
+                                       0.0,
+                                       c,
+                                       ldc);
+                }
+
+                // One grouped call, which MKL schedules across the batch itself
+                inline void gemm_batch(cblas::Transpose transpose_a,
+                                       cblas::Transpose transpose_b,
+                                       size_t m,
+                                       size_t n,
+                                       size_t k,
+                                       const float* a,
+                                       size_t lda,
+                                       size_t offset_a,
+                                       const float* b,
+                                       size_t ldb,
+                                       size_t offset_b,
+                                       float* c,
+                                       size_t ldc,
+                                       size_t offset_c,
+                                       size_t batch)
+                {
+                    std::vector<const float*> a_array(batch);
+                    std::vector<const float*> b_array(batch);
+                    std::vector<float*> c_array(batch);
+                    for (size_t i = 0; i < batch; i++)
+                    {
+                        a_array[i] = a + i * offset_a;
+                        b_array[i] = b + i * offset_b;
+                        c_array[i] = c + i * offset_c;
+                    }
+                    int64_t m_ = m, n_ = n, k_ = k, lda_ = lda, ldb_ = ldb, ldc_ = ldc;
+                    int64_t group_size = batch;
+                    float alpha = 1.0f, beta = 0.0f;
+                    cblas::cblas_sgemm_batch(cblas::Layout::RowMajor,
+                                             &transpose_a,
+                                             &transpose_b,
+                                             &m_,
+                                             &n_,
+                                             &k_,
+                                             &alpha,
+                                             a_array.data(),
+                                             &lda_,
+                                             b_array.data(),
+                                             &ldb_,
+                                             &beta,
+                                             c_array.data(),
+                                             &ldc_,
+                                             1,
+                                             &group_size);
+                }
+
+                // There is no grouped dgemm, so the products run one after the other
+                inline void gemm_batch(cblas::Transpose transpose_a,
+                                       cblas::Transpose transpose_b,
+                                       size_t m,
+                                       size_t n,
+                                       size_t k,
+                                       const double* a,
+                                       size_t lda,
+                                       size_t offset_a,
+                                       const double* b,
+                                       size_t ldb,
+                                       size_t offset_b,
+                                       double* c,
+                                       size_t ldc,
+                                       size_t offset_c,
+                                       size_t batch)
+                {
+                    for (size_t i = 0; i < batch; i++)
+                    {
+                        gemm(transpose_a,
+                             transpose_b,
+                             m,
+                             n,
+                             k,
+                             a + i * offset_a,
+                             lda,
+                             b + i * offset_b,
+                             ldb,
+                             c + i * offset_c,
+                             ldc);
+                    }
+                }
+
+                // c[i] = op(a[i]) * op(b[i]) for row-major [m, n] products of `batch` matrices
+                // `offset_*` elements apart; an offset of 0 reuses one matrix for the batch.
+                template <typename T>
+                void batch_gemm(const T* a,
+                                const T* b,
+                                T* c,
+                                size_t batch,
+                                bool transpose_a,
+                                bool transpose_b,
+                                size_t m,
+                                size_t n,
+                                size_t k,
+                                size_t offset_a,
+                                size_t offset_b,
+                                size_t offset_c,
+                                int arena)
+                {
+                    auto trans_a =
+                        transpose_a ? cblas::Transpose::Transpose : cblas::Transpose::None;
+                    auto trans_b =
+                        transpose_b ? cblas::Transpose::Transpose : cblas::Transpose::None;
+                    size_t lda = std::max<size_t>(1, transpose_a ? m : k);
+                    size_t ldb = std::max<size_t>(1, transpose_b ? k : n);
+                    size_t ldc = std::max<size_t>(1, n);
+                    if (batch < 2 || m * n * k >= BATCH_GEMM_SMALL)
+                    {
+                        gemm_batch(trans_a,
+                                   trans_b,
+                                   m,
+                                   n,
+                                   k,
+                                   a,
+                                   lda,
+                                   offset_a,
+                                   b,
+                                   ldb,
+                                   offset_b,
+                                   c,
+                                   ldc,
+                                   offset_c,
+                                   batch);
+                        return;
+                    }
+
+                    Eigen::TensorOpCost cost(
+                        (m * k + k * n) * sizeof(T), m * n * sizeof(T), 2 * m * n * k);
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        batch, cost, [&](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index i = first; i < last; i++)
+                            {
+                                gemm(trans_a,
+                                     trans_b,
+                                     m,
+                                     n,
+                                     k,
+                                     a + i * offset_a,
+                                     lda,
+                                     b + i * offset_b,
+                                     ldb,
+                                     c + i * offset_c,
+                                     ldc);
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,208 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Geometry of a binary convolution, with the spatial dimensions padded
+                ///        to three by leading dimensions of size one.
+                struct BinaryConvolutionParams
+                {
+                    size_t batch;
+                    size_t channels;
+                    size_t out_channels;
+                    size_t in_dims[3];
+                    size_t kernel_dims[3];
+                    size_t out_dims[3];
+                    size_t strides[3];
+                    size_t dilations[3];
+                    std::ptrdiff_t pads_begin[3];
+                    // Padding is read as 1 when true and as 0 (that is, -1) when false
+                    bool pad_bit;
+
+                    /// \brief Number of 64 bit words holding the channels of one position.
+                    size_t get_words() const { return (channels + 63) / 64; }
+                    size_t get_kernel_size() const
+                    {
+                        return kernel_dims[0] * kernel_dims[1] * kernel_dims[2];
+                    }
+                };
+
+                inline int binary_popcount(uint64_t word)
+                {
+#if defined(__GNUC__)
+                    return __builtin_popcountll(word);
+#else
+                    int count = 0;
+                    for (; word != 0; word &= word - 1)
+                    {
+                        count++;
+                    }
+                    return count;
+#endif
+                }
+
+                /// \brief Packs the channels of `values` ([batch, channels, spatial]) into
+                ///        [batch, spatial, words], with bit `c % 64` of word `c / 64` set when
+                ///        channel `c` is positive. Unused bits of the last word are zero.
+                template <typename T>
+                void pack_binary_channels(const T* values,
+                                          uint64_t* packed,
+                                          size_t batch,
+                                          size_t channels,
+                                          size_t spatial,
+                                          int arena)
+                {
+                    size_t words = (channels + 63) / 64;
+                    auto positions = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index p = first; p < last; p++)
+                        {
+                            size_t n = p / spatial;
+                            size_t s = p % spatial;
+                            const T* in = values + n * channels * spatial + s;
+                            uint64_t* out = packed + p * words;
+                            for (size_t w = 0; w < words; w++)
+                            {
+                                out[w] = 0;
+                            }
+                            for (size_t c = 0; c < channels; c++)
+                            {
+                                if (in[c * spatial] > T(0))
+                                {
+                                    out[c / 64] |= uint64_t(1) << (c % 64);
+                                }
+                            }
+                        }
+                    };
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        batch * spatial,
+                        Eigen::TensorOpCost(sizeof(T) * channels, sizeof(uint64_t) * words, 0),
+                        positions);
+                }
+
+                /// \brief XNOR-popcount convolution of packed activations
+                ///        ([batch, in spatial, words]) with packed filters
+                ///        ([out_channels, kernel spatial, words]) into `out` in NC(D)HW layout.
+                ///
+                /// Each product of a +1/-1 input with a +1/-1 weight is +1 when their bits match,
+                /// so a window sums to `channels * kernel_size - 2 * popcount(input ^ weights)`.
+                template <typename T>
+                void binary_convolution(const uint64_t* input,
+                                        const uint64_t* filters,
+                                        T* out,
+                                        const BinaryConvolutionParams& p,
+                                        int arena)
+                {
+                    size_t words = p.get_words();
+                    size_t kernel_size = p.get_kernel_size();
+                    size_t in_spatial = p.in_dims[0] * p.in_dims[1] * p.in_dims[2];
+                    size_t out_spatial = p.out_dims[0] * p.out_dims[1] * p.out_dims[2];
+                    int total = static_cast<int>(p.channels * kernel_size);
+
+                    std::vector<uint64_t> pad_row(words, 0);
+                    if (p.pad_bit)
+                    {
+                        for (size_t c = 0; c < p.channels; c++)
+                        {
+                            pad_row[c / 64] |= uint64_t(1) << (c % 64);
+                        }
+                    }
+
+                    auto positions = [&](Eigen::Index first, Eigen::Index last) {
+                        std::vector<int> mismatches(p.out_channels);
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+                            size_t n = i / out_spatial;
+                            size_t s = i % out_spatial;
+                            std::ptrdiff_t out_coord[3] = {
+                                std::ptrdiff_t(s / (p.out_dims[1] * p.out_dims[2])),
+                                std::ptrdiff_t(s / p.out_dims[2] % p.out_dims[1]),
+                                std::ptrdiff_t(s % p.out_dims[2])};
+                            std::fill(mismatches.begin(), mismatches.end(), 0);
+
+                            size_t k = 0;
+                            for (size_t kd = 0; kd < p.kernel_dims[0]; kd++)
+                            {
+                                for (size_t kh = 0; kh < p.kernel_dims[1]; kh++)
+                                {
+                                    for (size_t kw = 0; kw < p.kernel_dims[2]; kw++, k++)
+                                    {
+                                        size_t kernel_coord[3] = {kd, kh, kw};
+                                        const uint64_t* row = pad_row.data();
+                                        size_t offset = 0;
+                                        bool inside = true;
+                                        for (size_t d = 0; d < 3 && inside; d++)
+                                        {
+                                            std::ptrdiff_t x =
+                                                out_coord[d] * std::ptrdiff_t(p.strides[d]) -
+                                                p.pads_begin[d] +
+                                                std::ptrdiff_t(kernel_coord[d] * p.dilations[d]);
+                                            inside = x >= 0 && x < std::ptrdiff_t(p.in_dims[d]);
+                                            offset = offset * p.in_dims[d] + size_t(x);
+                                        }
+                                        if (inside)
+                                        {
+                                            row = input + (n * in_spatial + offset) * words;
+                                        }
+                                        for (size_t o = 0; o < p.out_channels; o++)
+                                        {
+                                            const uint64_t* f =
+                                                filters + (o * kernel_size + k) * words;
+                                            int count = 0;
+                                            for (size_t w = 0; w < words; w++)
+                                            {
+                                                count += binary_popcount(row[w] ^ f[w]);
+                                            }
+                                            mismatches[o] += count;
+                                        }
+                                    }
+                                }
+                            }
+
+                            T* y = out + n * p.out_channels * out_spatial + s;
+                            for (size_t o = 0; o < p.out_channels; o++)
+                            {
+                                y[o * out_spatial] = static_cast<T>(total - 2 * mismatches[o]);
+                            }
+                        }
+                    };
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        p.batch * out_spatial,
+                        Eigen::TensorOpCost(sizeof(uint64_t) * kernel_size * words,
+                                            sizeof(T) * p.out_channels,
+                                            2.0 * kernel_size * p.out_channels * words),
+                        positions);
+                }
+            }
+        }
+    }
+}
@@ -15,14 +15,11 @@
 //*****************************************************************************
 
 #pragma once
-#include <functional>
-#include <iostream>
-#include <vector>
 
-#define EIGEN_USE_THREADS
-#include <unsupported/Eigen/CXX11/Tensor>
+#include <vector>
 
-#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/kernel/parallel_for.hpp"
+#include "ngraph/runtime/opt_kernel/concat.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -33,37 +30,25 @@ namespace ngraph
         {
             namespace kernel
             {
-                template <typename ElementType, int Rank>
-                void concat(std::vector<void*> inputs,
-                            std::vector<Shape> input_shapes,
+                template <typename ElementType>
+                void concat(const std::vector<void*>& inputs,
+                            const std::vector<Shape>& input_shapes,
                             void* output,
-                            Shape output_shape,
-                            int64_t axis)
+                            const Shape& output_shape,
+                            int64_t axis,
+                            int arena)
                 {
-                    Eigen::array<Eigen::Index, Rank> out_dims;
-                    for (int i = 0; i < Rank; i++)
-                    {
-                        out_dims[i] = output_shape[i];
-                    }
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> out(
-                        static_cast<ElementType*>(output), out_dims);
-
-                    Eigen::array<Eigen::Index, Rank> in_dims, concat_pos;
-                    concat_pos.fill(static_cast<Eigen::Index>(0));
-                    for (size_t i = 0; i < input_shapes.size(); i++)
+                    std::vector<const ElementType*> args;
+                    for (auto input : inputs)
                     {
-                        for (int j = 0; j < Rank; j++)
-                        {
-                            in_dims[j] = input_shapes[i][j];
-                        }
-
-                        Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(
-                            static_cast<ElementType*>(inputs[i]), in_dims);
-                        out.slice(concat_pos, in_dims)
-                            .device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(
-                                0)) = in;
-                        concat_pos[axis] += in_dims[axis];
+                        args.push_back(static_cast<const ElementType*>(input));
                     }
+                    opt_kernel::concat(args,
+                                       static_cast<ElementType*>(output),
+                                       input_shapes,
+                                       output_shape,
+                                       axis,
+                                       parallel_for_on(arena, sizeof(ElementType)));
                 }
             }
         }
@@ -111,12 +111,6 @@ namespace ngraph
                 {
                     convert<InputElementType, bool>(input, output, count, arena);
                 }
-
-                template <typename InputElementType>
-                void convert_to_bf16(void* input, void* output, size_t count, int arena)
-                {
-                    convert<InputElementType, bfloat16>(input, output, count, arena);
-                }
             }
         }
     }
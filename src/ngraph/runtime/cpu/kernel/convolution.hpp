@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "ngraph/runtime/cpu/kernel/parallel_for.hpp"
+#include "ngraph/runtime/opt_kernel/convolution_backprop.hpp"
 #include "ngraph/runtime/reference/convolution.hpp"
 #include "ngraph/shape.hpp"
 
@@ -77,24 +79,24 @@ namespace ngraph
                                                  const Shape& arg0_shape,
                                                  const Shape& arg1_shape,
                                                  const Shape& filter_shape,
-                                                 const Strides& window_dilation_strides,
                                                  const Strides& window_movement_strides,
+                                                 const Strides& window_dilation_strides,
                                                  const CoordinateDiff& padding_below,
-                                                 const CoordinateDiff& padding_above,
-                                                 const Strides& data_dilation_strides)
+                                                 const Strides& data_dilation_strides,
+                                                 int arena)
                 {
-                    reference::convolution_backprop_filter<ElementType>(
+                    opt_kernel::convolution_backprop_filter<ElementType>(
                         static_cast<const ElementType*>(input0),
                         static_cast<const ElementType*>(input1),
                         static_cast<ElementType*>(output),
                         arg0_shape,
                         arg1_shape,
                         filter_shape,
-                        window_dilation_strides,
                         window_movement_strides,
+                        window_dilation_strides,
                         padding_below,
-                        padding_above,
-                        data_dilation_strides);
+                        data_dilation_strides,
+                        parallel_for_on(arena, sizeof(ElementType)));
                 }
 
                 template <typename ElementType>
@@ -107,10 +109,10 @@ namespace ngraph
                                              const Strides& window_movement_strides,
                                              const Strides& window_dilation_strides,
                                              const CoordinateDiff& padding_below,
-                                             const CoordinateDiff& padding_above,
-                                             const Strides& data_dilation_strides)
+                                             const Strides& data_dilation_strides,
+                                             int arena)
                 {
-                    reference::convolution_backprop_in<ElementType>(
+                    opt_kernel::convolution_backprop_in<ElementType>(
                         static_cast<const ElementType*>(input0),
                         static_cast<const ElementType*>(input1),
                         static_cast<ElementType*>(output),
@@ -120,8 +122,8 @@ namespace ngraph
                         window_movement_strides,
                         window_dilation_strides,
                         padding_below,
-                        padding_above,
-                        data_dilation_strides);
+                        data_dilation_strides,
+                        parallel_for_on(arena, sizeof(ElementType)));
                 }
             } // namespace kernel
         }     // namespace cpu
@@ -16,8 +16,8 @@
 
 #pragma once
 
-#include "ngraph/runtime/cpu/cpu_executor.hpp"
-#include "ngraph/runtime/reference/cum_sum.hpp"
+#include "ngraph/runtime/cpu/kernel/parallel_for.hpp"
+#include "ngraph/runtime/opt_kernel/cum_sum.hpp"
 
 namespace ngraph
 {
@@ -28,20 +28,22 @@ namespace ngraph
             namespace kernel
             {
                 template <typename InputElementType, typename AxisElementType>
-                void reference_cumsum(void* input_tensor,
-                                      void* axis_tensor,
-                                      void* out,
-                                      const Shape& tensor_shape,
-                                      const bool exclusive,
-                                      const bool reverse)
+                void cumsum(void* input_tensor,
+                            void* axis_tensor,
+                            void* out,
+                            const Shape& tensor_shape,
+                            const bool exclusive,
+                            const bool reverse,
+                            int arena)
                 {
-                    reference::cumsum<InputElementType, AxisElementType>(
+                    opt_kernel::cumsum<InputElementType, AxisElementType>(
                         static_cast<const InputElementType*>(input_tensor),
                         static_cast<const AxisElementType*>(axis_tensor),
                         static_cast<InputElementType*>(out),
                         tensor_shape,
                         exclusive,
-                        reverse);
+                        reverse,
+                        parallel_for_on(arena, sizeof(InputElementType)));
                 }
             }
         }
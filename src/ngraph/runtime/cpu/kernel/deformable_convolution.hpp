@@ -0,0 +1,204 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Geometry of a 2D deformable convolution.
+                struct DeformableConvolutionParams
+                {
+                    size_t batch;
+                    size_t channels;
+                    size_t out_channels;
+                    size_t in_h, in_w;
+                    size_t kernel_h, kernel_w;
+                    size_t out_h, out_w;
+                    size_t stride_h, stride_w;
+                    size_t dilation_h, dilation_w;
+                    std::ptrdiff_t pad_h, pad_w;
+                    size_t group;
+                    size_t deformable_group;
+                };
+
+                /// \brief Corners and weights of a bilinear sample of an [h, w] plane. Corners
+                ///        outside the plane get a zero weight, so reading them is never needed.
+                template <typename T>
+                struct BilinearSample
+                {
+                    size_t offsets[4];
+                    T weights[4];
+
+                    /// \return false when the point is too far outside the plane to sample.
+                    bool set(T y, T x, size_t h, size_t w)
+                    {
+                        if (!(y > T(-1) && x > T(-1) && y < T(h) && x < T(w)))
+                        {
+                            return false;
+                        }
+                        std::ptrdiff_t y0 = static_cast<std::ptrdiff_t>(std::floor(y));
+                        std::ptrdiff_t x0 = static_cast<std::ptrdiff_t>(std::floor(x));
+                        T ly = y - T(y0);
+                        T lx = x - T(x0);
+                        std::ptrdiff_t ys[2] = {y0, y0 + 1};
+                        std::ptrdiff_t xs[2] = {x0, x0 + 1};
+                        T wy[2] = {T(1) - ly, ly};
+                        T wx[2] = {T(1) - lx, lx};
+                        for (size_t i = 0; i < 4; i++)
+                        {
+                            std::ptrdiff_t yi = ys[i / 2];
+                            std::ptrdiff_t xi = xs[i % 2];
+                            bool inside = yi >= 0 && xi >= 0 && yi < std::ptrdiff_t(h) &&
+                                          xi < std::ptrdiff_t(w);
+                            offsets[i] = inside ? size_t(yi) * w + size_t(xi) : 0;
+                            weights[i] = inside ? wy[i / 2] * wx[i % 2] : T(0);
+                        }
+                        return true;
+                    }
+
+                    T read(const T* plane) const
+                    {
+                        return weights[0] * plane[offsets[0]] + weights[1] * plane[offsets[1]] +
+                               weights[2] * plane[offsets[2]] + weights[3] * plane[offsets[3]];
+                    }
+                };
+
+                /// \brief 2D deformable convolution.
+                ///
+                /// `offsets` is [batch, deformable_group * 2 * kernel_h * kernel_w, out_h, out_w],
+                /// holding a (dy, dx) pair for each kernel position. For each batch item the
+                /// input is sampled into a column buffer of [channels * kernel size, out_h *
+                /// out_w]; a sample point is shared by all channels of its deformable group, so
+                /// its corners and weights are computed once and applied across those channels.
+                /// Each group of the output is then a single contraction of its filters with its
+                /// rows of the buffer.
+                template <typename T>
+                void deformable_convolution(const T* in,
+                                            const T* offsets,
+                                            const T* filters,
+                                            T* out,
+                                            const DeformableConvolutionParams& p,
+                                            int arena)
+                {
+                    auto& device = executor::GetCPUExecutor().get_device(arena);
+
+                    size_t kernel_size = p.kernel_h * p.kernel_w;
+                    size_t out_spatial = p.out_h * p.out_w;
+                    size_t in_spatial = p.in_h * p.in_w;
+                    size_t group_channels = p.channels / p.group;
+                    size_t group_out_channels = p.out_channels / p.group;
+                    size_t deformable_channels = p.channels / p.deformable_group;
+                    std::vector<T> columns(p.channels * kernel_size * out_spatial);
+
+                    for (size_t n = 0; n < p.batch; n++)
+                    {
+                        const T* image = in + n * p.channels * in_spatial;
+                        const T* image_offsets =
+                            offsets + n * p.deformable_group * 2 * kernel_size * out_spatial;
+
+                        // One work item per (deformable group, kernel position, output position)
+                        auto samples = [&](Eigen::Index first, Eigen::Index last) {
+                            BilinearSample<T> sample;
+                            for (Eigen::Index i = first; i < last; i++)
+                            {
+                                size_t pos = i % out_spatial;
+                                size_t k = i / out_spatial % kernel_size;
+                                size_t dg = i / (out_spatial * kernel_size);
+                                size_t oh = pos / p.out_w;
+                                size_t ow = pos % p.out_w;
+                                size_t kh = k / p.kernel_w;
+                                size_t kw = k % p.kernel_w;
+
+                                const T* dy = image_offsets +
+                                              ((dg * kernel_size + k) * 2) * out_spatial + pos;
+                                const T* dx = dy + out_spatial;
+                                T y = T(std::ptrdiff_t(oh * p.stride_h) - p.pad_h +
+                                        std::ptrdiff_t(kh * p.dilation_h)) +
+                                      *dy;
+                                T x = T(std::ptrdiff_t(ow * p.stride_w) - p.pad_w +
+                                        std::ptrdiff_t(kw * p.dilation_w)) +
+                                      *dx;
+
+                                size_t c_begin = dg * deformable_channels;
+                                size_t c_end = c_begin + deformable_channels;
+                                T* column = columns.data() + k * out_spatial + pos;
+                                if (!sample.set(y, x, p.in_h, p.in_w))
+                                {
+                                    for (size_t c = c_begin; c < c_end; c++)
+                                    {
+                                        column[c * kernel_size * out_spatial] = T(0);
+                                    }
+                                    continue;
+                                }
+                                for (size_t c = c_begin; c < c_end; c++)
+                                {
+                                    column[c * kernel_size * out_spatial] =
+                                        sample.read(image + c * in_spatial);
+                                }
+                            }
+                        };
+                        device.parallelFor(
+                            p.deformable_group * kernel_size * out_spatial,
+                            Eigen::TensorOpCost(4 * sizeof(T) * deformable_channels,
+                                                sizeof(T) * deformable_channels,
+                                                8.0 * deformable_channels),
+                            samples);
+
+                        for (size_t g = 0; g < p.group; g++)
+                        {
+                            Eigen::array<Eigen::Index, 2> filter_dims{
+                                {Eigen::Index(group_out_channels),
+                                 Eigen::Index(group_channels * kernel_size)}};
+                            Eigen::array<Eigen::Index, 2> column_dims{
+                                {Eigen::Index(group_channels * kernel_size),
+                                 Eigen::Index(out_spatial)}};
+                            Eigen::array<Eigen::Index, 2> out_dims{
+                                {Eigen::Index(group_out_channels), Eigen::Index(out_spatial)}};
+                            Eigen::array<Eigen::IndexPair<Eigen::Index>, 1> dot_dims{
+                                {Eigen::IndexPair<Eigen::Index>(1, 0)}};
+
+                            Eigen::TensorMap<Eigen::Tensor<const T, 2, Eigen::RowMajor>> w(
+                                filters + g * group_out_channels * group_channels * kernel_size,
+                                filter_dims);
+                            Eigen::TensorMap<Eigen::Tensor<const T, 2, Eigen::RowMajor>> col(
+                                columns.data() + g * group_channels * kernel_size * out_spatial,
+                                column_dims);
+                            Eigen::TensorMap<Eigen::Tensor<T, 2, Eigen::RowMajor>> y(
+                                out + (n * p.out_channels + g * group_out_channels) * out_spatial,
+                                out_dims);
+                            y.device(device) = w.contract(col, dot_dims);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
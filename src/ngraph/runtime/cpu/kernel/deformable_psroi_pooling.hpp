@@ -0,0 +1,160 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/kernel/deformable_convolution.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                struct DeformablePSROIPoolingParams
+                {
+                    size_t channels;
+                    size_t in_h, in_w;
+                    size_t rois;
+                    size_t output_dim;
+                    size_t group_size;
+                    float spatial_scale;
+                    size_t spatial_bins_x, spatial_bins_y;
+                    float trans_std;
+                    size_t part_size;
+                    // Number of (dx, dy) pairs in `offsets`; zero when there are no offsets
+                    size_t classes;
+                };
+
+                /// \brief Deformable position sensitive ROI pooling.
+                ///
+                /// `coords` holds (batch index, x1, y1, x2, y2) for each ROI, and `offsets`, if
+                /// not null, is [rois, 2 * classes, part_size, part_size]. Each output bin of
+                /// [rois, output_dim, group_size, group_size] averages a grid of bilinear samples
+                /// of its own input channel, shifted by the offsets of its part. ROIs are split
+                /// across the threads of `arena`.
+                template <typename T>
+                void deformable_psroi_pooling(const T* in,
+                                              const T* coords,
+                                              const T* offsets,
+                                              T* out,
+                                              const DeformablePSROIPoolingParams& p,
+                                              int arena)
+                {
+                    size_t in_spatial = p.in_h * p.in_w;
+                    size_t gs = p.group_size;
+                    size_t channels_per_class =
+                        p.classes == 0 ? p.output_dim : p.output_dim / p.classes;
+
+                    auto rois = [&](Eigen::Index first, Eigen::Index last) {
+                        BilinearSample<T> sample;
+                        for (Eigen::Index r = first; r < last; r++)
+                        {
+                            const T* roi = coords + r * 5;
+                            size_t batch = static_cast<size_t>(roi[0]);
+                            T scale = T(p.spatial_scale);
+                            T start_w = std::round(roi[1]) * scale - T(0.5);
+                            T start_h = std::round(roi[2]) * scale - T(0.5);
+                            T end_w = (std::round(roi[3]) + T(1)) * scale - T(0.5);
+                            T end_h = (std::round(roi[4]) + T(1)) * scale - T(0.5);
+                            T roi_w = std::max(end_w - start_w, T(0.1));
+                            T roi_h = std::max(end_h - start_h, T(0.1));
+                            T bin_w = roi_w / T(gs);
+                            T bin_h = roi_h / T(gs);
+                            T sub_bin_w = bin_w / T(p.spatial_bins_x);
+                            T sub_bin_h = bin_h / T(p.spatial_bins_y);
+
+                            for (size_t c = 0; c < p.output_dim; c++)
+                            {
+                                size_t class_id = c / channels_per_class;
+                                for (size_t ph = 0; ph < gs; ph++)
+                                {
+                                    for (size_t pw = 0; pw < gs; pw++)
+                                    {
+                                        T trans_x = T(0);
+                                        T trans_y = T(0);
+                                        if (offsets != nullptr)
+                                        {
+                                            size_t part_h = ph * p.part_size / gs;
+                                            size_t part_w = pw * p.part_size / gs;
+                                            size_t part = part_h * p.part_size + part_w;
+                                            size_t part_count = p.part_size * p.part_size;
+                                            const T* trans =
+                                                offsets + (r * p.classes + class_id) * 2 *
+                                                              part_count;
+                                            trans_x = trans[part] * T(p.trans_std);
+                                            trans_y = trans[part_count + part] * T(p.trans_std);
+                                        }
+
+                                        T w0 = T(pw) * bin_w + start_w + trans_x * roi_w;
+                                        T h0 = T(ph) * bin_h + start_h + trans_y * roi_h;
+                                        size_t c_in = (c * gs + ph) * gs + pw;
+                                        const T* plane = in + (batch * p.channels + c_in) *
+                                                                  in_spatial;
+
+                                        T sum = T(0);
+                                        size_t count = 0;
+                                        for (size_t iy = 0; iy < p.spatial_bins_y; iy++)
+                                        {
+                                            T h = h0 + T(iy) * sub_bin_h;
+                                            if (h < T(-0.5) || h > T(p.in_h) - T(0.5))
+                                            {
+                                                continue;
+                                            }
+                                            h = std::min(std::max(h, T(0)), T(p.in_h - 1));
+                                            for (size_t ix = 0; ix < p.spatial_bins_x; ix++)
+                                            {
+                                                T w = w0 + T(ix) * sub_bin_w;
+                                                if (w < T(-0.5) || w > T(p.in_w) - T(0.5))
+                                                {
+                                                    continue;
+                                                }
+                                                w = std::min(std::max(w, T(0)), T(p.in_w - 1));
+                                                sample.set(h, w, p.in_h, p.in_w);
+                                                sum += sample.read(plane);
+                                                count++;
+                                            }
+                                        }
+                                        out[((r * p.output_dim + c) * gs + ph) * gs + pw] =
+                                            count == 0 ? T(0) : sum / T(count);
+                                    }
+                                }
+                            }
+                        }
+                    };
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        p.rois,
+                        Eigen::TensorOpCost(4 * sizeof(T) * p.output_dim * gs * gs *
+                                                p.spatial_bins_x * p.spatial_bins_y,
+                                            sizeof(T) * p.output_dim * gs * gs,
+                                            8.0 * p.output_dim * gs * gs * p.spatial_bins_x *
+                                                p.spatial_bins_y),
+                        rois);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,97 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Weights are dequantized this many at a time into a buffer that stays in L1
+                static constexpr size_t DEQUANTIZE_TILE = 256;
+
+                /// \brief out[M, N] = arg[M, K] * W, where column `c` of W is
+                ///        `scales[c] * weights[c * K + k]`.
+                ///
+                /// Output channels are split across the threads of `arena`. A tile of each
+                /// channel is dequantized once and reused for every row of `arg`, so the weights
+                /// are read from memory at their stored width.
+                template <typename W>
+                void dequantizing_dot(const float* arg,
+                                      float* out,
+                                      size_t m,
+                                      size_t k,
+                                      size_t n,
+                                      const W* weights,
+                                      const float* scales,
+                                      int arena)
+                {
+                    auto channels = [&](Eigen::Index first, Eigen::Index last) {
+                        float tile[DEQUANTIZE_TILE];
+                        for (Eigen::Index c = first; c < last; c++)
+                        {
+                            const W* w = weights + c * k;
+                            for (size_t i = 0; i < m; i++)
+                            {
+                                out[i * n + c] = 0.0f;
+                            }
+                            for (size_t start = 0; start < k; start += DEQUANTIZE_TILE)
+                            {
+                                size_t length = std::min(DEQUANTIZE_TILE, k - start);
+                                for (size_t j = 0; j < length; j++)
+                                {
+                                    tile[j] = static_cast<float>(w[start + j]);
+                                }
+                                for (size_t i = 0; i < m; i++)
+                                {
+                                    const float* x = arg + i * k + start;
+                                    float sum = 0.0f;
+                                    for (size_t j = 0; j < length; j++)
+                                    {
+                                        sum += x[j] * tile[j];
+                                    }
+                                    out[i * n + c] += sum;
+                                }
+                            }
+                            for (size_t i = 0; i < m; i++)
+                            {
+                                out[i * n + c] *= scales[c];
+                            }
+                        }
+                    };
+
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        n,
+                        Eigen::TensorOpCost(
+                            sizeof(W) * k + sizeof(float) * m * k, sizeof(float) * m, 2.0 * m * k),
+                        channels);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,92 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/cpu/kernel/parallel_for.hpp"
+#include "ngraph/runtime/opt_kernel/broadcast.hpp"
+#include "ngraph/runtime/opt_kernel/dyn_slice.hpp"
+#include "ngraph/runtime/reference/range.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/slice_plan.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                template <typename ElementType>
+                void dyn_slice(void* input,
+                               void* output,
+                               const Shape& input_shape,
+                               const SlicePlan& plan,
+                               int arena)
+                {
+                    opt_kernel::dyn_slice(static_cast<const ElementType*>(input),
+                                          static_cast<ElementType*>(output),
+                                          input_shape,
+                                          plan,
+                                          parallel_for_on(arena, sizeof(ElementType)));
+                }
+
+                template <typename ElementType>
+                void dyn_replace_slice(void* input,
+                                       void* replacement,
+                                       void* output,
+                                       const Shape& input_shape,
+                                       const SlicePlan& plan,
+                                       int arena)
+                {
+                    opt_kernel::dyn_replace_slice(static_cast<const ElementType*>(input),
+                                                  static_cast<const ElementType*>(replacement),
+                                                  static_cast<ElementType*>(output),
+                                                  input_shape,
+                                                  plan,
+                                                  parallel_for_on(arena, sizeof(ElementType)));
+                }
+
+                template <typename ElementType>
+                void dyn_broadcast(void* input,
+                                   void* output,
+                                   const Shape& input_shape,
+                                   const Shape& output_shape,
+                                   const AxisSet& broadcast_axes,
+                                   int arena)
+                {
+                    opt_kernel::broadcast(static_cast<const ElementType*>(input),
+                                          static_cast<ElementType*>(output),
+                                          input_shape,
+                                          output_shape,
+                                          broadcast_axes,
+                                          parallel_for_on(arena, sizeof(ElementType)));
+                }
+
+                template <typename ElementType>
+                void range(void* start, void* step, void* output, const Shape& output_shape)
+                {
+                    reference::range(static_cast<const ElementType*>(start),
+                                     static_cast<const ElementType*>(step),
+                                     output_shape,
+                                     static_cast<ElementType*>(output));
+                }
+            }
+        }
+    }
+}
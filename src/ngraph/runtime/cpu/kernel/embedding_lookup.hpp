@@ -0,0 +1,175 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Rows are prefetched this many indices ahead of the one being read.
+                static constexpr size_t EMBEDDING_PREFETCH_DISTANCE = 8;
+
+                // Tables larger than this are prefetched with a non-temporal hint, so that
+                // streaming rows out of them does not evict the rest of the working set.
+                static constexpr size_t EMBEDDING_NON_TEMPORAL_BYTES = size_t(16) << 20;
+
+                inline void prefetch_embedding_row(const void* row,
+                                                   size_t row_bytes,
+                                                   bool non_temporal)
+                {
+#if defined(__GNUC__)
+                    auto bytes = static_cast<const char*>(row);
+                    for (size_t offset = 0; offset < row_bytes; offset += 64)
+                    {
+                        if (non_temporal)
+                        {
+                            __builtin_prefetch(bytes + offset, 0, 0);
+                        }
+                        else
+                        {
+                            __builtin_prefetch(bytes + offset, 0, 3);
+                        }
+                    }
+#else
+                    (void)row;
+                    (void)row_bytes;
+                    (void)non_temporal;
+#endif
+                }
+
+                // Negative indices count from the end of the table.
+                template <typename IndexType>
+                inline size_t embedding_row(IndexType index, size_t table_rows)
+                {
+                    auto row = static_cast<int64_t>(index);
+                    return static_cast<size_t>(row >= 0 ? row
+                                                        : row + static_cast<int64_t>(table_rows));
+                }
+
+                // Copies table[indices[i]] to row i of the output for each of the count indices.
+                // Rows are copied in parallel, and upcoming rows are prefetched.
+                template <typename ElementType, typename IndexType>
+                void gather_rows(const ElementType* table,
+                                 const IndexType* indices,
+                                 ElementType* output,
+                                 size_t count,
+                                 size_t row_length,
+                                 size_t table_rows,
+                                 int arena)
+                {
+                    if (count == 0 || row_length == 0)
+                    {
+                        return;
+                    }
+                    size_t row_bytes = row_length * sizeof(ElementType);
+                    bool non_temporal = table_rows * row_bytes > EMBEDDING_NON_TEMPORAL_BYTES;
+
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        count,
+                        Eigen::TensorOpCost(row_bytes, row_bytes, 0),
+                        [&](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index i = first; i < last; i++)
+                            {
+                                Eigen::Index ahead = i + EMBEDDING_PREFETCH_DISTANCE;
+                                if (ahead < last)
+                                {
+                                    prefetch_embedding_row(
+                                        table + embedding_row(indices[ahead], table_rows) *
+                                                    row_length,
+                                        row_bytes,
+                                        non_temporal);
+                                }
+                                memcpy(output + i * row_length,
+                                       table + embedding_row(indices[i], table_rows) * row_length,
+                                       row_bytes);
+                            }
+                        });
+                }
+
+                // For each of the bags rows of indices, writes the sum of the bag_size table rows
+                // they select to the corresponding output row. This is the fused form of a gather
+                // followed by a sum over the bag axis; the gathered rows are never materialized.
+                // A nonzero `RowLength` fixes the row length at compile time, see
+                // SELECT_INNER_DIM.
+                template <typename ElementType, typename IndexType, size_t RowLength = 0>
+                void embedding_bag_sum(const ElementType* table,
+                                       const IndexType* indices,
+                                       ElementType* output,
+                                       size_t bags,
+                                       size_t bag_size,
+                                       size_t table_row_length,
+                                       size_t table_rows,
+                                       int arena)
+                {
+                    const size_t row_length = RowLength != 0 ? RowLength : table_row_length;
+                    if (bags == 0 || row_length == 0)
+                    {
+                        return;
+                    }
+                    size_t row_bytes = row_length * sizeof(ElementType);
+                    bool non_temporal = table_rows * row_bytes > EMBEDDING_NON_TEMPORAL_BYTES;
+
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        bags,
+                        Eigen::TensorOpCost(
+                            bag_size * row_bytes, row_bytes, bag_size * row_length),
+                        [&](Eigen::Index first, Eigen::Index last) {
+                            size_t end = last * bag_size;
+                            for (Eigen::Index bag = first; bag < last; bag++)
+                            {
+                                ElementType* sum = output + bag * row_length;
+                                std::fill(sum, sum + row_length, ElementType(0));
+                                for (size_t k = 0; k < bag_size; k++)
+                                {
+                                    size_t position = bag * bag_size + k;
+                                    size_t ahead = position + EMBEDDING_PREFETCH_DISTANCE;
+                                    if (ahead < end)
+                                    {
+                                        prefetch_embedding_row(
+                                            table + embedding_row(indices[ahead], table_rows) *
+                                                        row_length,
+                                            row_bytes,
+                                            non_temporal);
+                                    }
+                                    const ElementType* row =
+                                        table +
+                                        embedding_row(indices[position], table_rows) * row_length;
+                                    for (size_t j = 0; j < row_length; j++)
+                                    {
+                                        sum[j] += row[j];
+                                    }
+                                }
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
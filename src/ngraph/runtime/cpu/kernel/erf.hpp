@@ -46,6 +46,10 @@ namespace ngraph
                         in0.unaryExpr(Eigen::internal::scalar_erf_op<ElementType>());
                 }
 
+                // Dispatched to the kernels for the selected ISA, see isa.cpp
+                template <>
+                void erf<float>(void* input0, void* output, size_t count, int arena);
+
                 template <typename ElementType>
                 void reference_erf(void* arg, void* out, size_t count)
                 {
@@ -0,0 +1,329 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Elements evaluated per step of the program. Small enough that the operands and
+                // intermediates of a block stay in L1.
+                static const size_t FUSED_ELEMENTWISE_BLOCK = 256;
+
+                template <typename ElementType>
+                using FusedArray = Eigen::Map<Eigen::Array<ElementType, Eigen::Dynamic, 1>>;
+
+                template <typename ElementType>
+                using ConstFusedArray =
+                    Eigen::Map<const Eigen::Array<ElementType, Eigen::Dynamic, 1>>;
+
+                // Gathers `count` elements of a broadcast input starting at output element
+                // `start`. `strides` holds the input stride of each output axis and is 0 along
+                // the broadcast axes. Elements are copied a run of the innermost axis at a time,
+                // so an innermost broadcast axis is a fill and a dense one a plain copy.
+                template <typename ElementType>
+                void fused_elementwise_gather(const ElementType* input,
+                                              ElementType* output,
+                                              const std::vector<size_t>& strides,
+                                              const Shape& shape,
+                                              size_t start,
+                                              size_t count)
+                {
+                    size_t rank = shape.size();
+                    if (rank == 0)
+                    {
+                        std::fill(output, output + count, input[0]);
+                        return;
+                    }
+
+                    std::vector<size_t> coord(rank);
+                    size_t offset = 0;
+                    size_t remainder = start;
+                    for (size_t i = rank; i-- > 0;)
+                    {
+                        coord[i] = remainder % shape[i];
+                        remainder /= shape[i];
+                        offset += coord[i] * strides[i];
+                    }
+
+                    const size_t inner = rank - 1;
+                    const size_t inner_stride = strides[inner];
+                    for (size_t j = 0; j < count;)
+                    {
+                        size_t run = std::min(count - j, shape[inner] - coord[inner]);
+                        const ElementType* src = input + offset;
+                        if (inner_stride == 0)
+                        {
+                            std::fill(output + j, output + j + run, src[0]);
+                        }
+                        else if (inner_stride == 1)
+                        {
+                            std::copy(src, src + run, output + j);
+                        }
+                        else
+                        {
+                            for (size_t k = 0; k < run; k++)
+                            {
+                                output[j + k] = src[k * inner_stride];
+                            }
+                        }
+                        j += run;
+
+                        coord[inner] += run;
+                        offset += run * inner_stride;
+                        for (size_t i = rank; i-- > 0 && coord[i] == shape[i];)
+                        {
+                            offset -= coord[i] * strides[i];
+                            coord[i] = 0;
+                            if (i > 0)
+                            {
+                                coord[i - 1]++;
+                                offset += strides[i - 1];
+                            }
+                        }
+                    }
+                }
+
+                template <typename ElementType>
+                void fused_elementwise_step(op::FusedElementwise::Opcode opcode,
+                                            const ElementType* arg0,
+                                            const ElementType* arg1,
+                                            ElementType* out,
+                                            size_t count)
+                {
+                    using Opcode = op::FusedElementwise::Opcode;
+
+                    ConstFusedArray<ElementType> a(arg0, count);
+                    FusedArray<ElementType> r(out, count);
+                    switch (opcode)
+                    {
+                    case Opcode::Abs: r = a.abs(); break;
+                    case Opcode::Exp: r = a.exp(); break;
+                    case Opcode::Log: r = a.log(); break;
+                    case Opcode::Negative: r = -a; break;
+                    case Opcode::Relu: r = a.max(ElementType(0)); break;
+                    case Opcode::Sigmoid: r = ElementType(1) / (ElementType(1) + (-a).exp()); break;
+                    case Opcode::Sqrt: r = a.sqrt(); break;
+                    case Opcode::Tanh: r = a.tanh(); break;
+                    case Opcode::Add: r = a + ConstFusedArray<ElementType>(arg1, count); break;
+                    case Opcode::Divide: r = a / ConstFusedArray<ElementType>(arg1, count); break;
+                    case Opcode::Maximum:
+                        r = a.max(ConstFusedArray<ElementType>(arg1, count));
+                        break;
+                    case Opcode::Minimum:
+                        r = a.min(ConstFusedArray<ElementType>(arg1, count));
+                        break;
+                    case Opcode::Multiply: r = a * ConstFusedArray<ElementType>(arg1, count); break;
+                    case Opcode::Subtract: r = a - ConstFusedArray<ElementType>(arg1, count); break;
+                    }
+                }
+
+                // Evaluates `program` over the `length` elements of `shape` that start at element
+                // `start`, writing the result of the last instruction to `result`. `scratch`
+                // holds one block per input and per instruction; `operands` one entry for each.
+                template <typename ElementType>
+                void fused_elementwise_block(
+                    const std::vector<void*>& inputs,
+                    const std::vector<std::vector<size_t>>& input_strides,
+                    const std::vector<op::FusedElementwise::Instruction>& program,
+                    const Shape& shape,
+                    size_t start,
+                    size_t length,
+                    ElementType* scratch,
+                    std::vector<const ElementType*>& operands,
+                    ElementType* result)
+                {
+                    const size_t input_count = inputs.size();
+                    for (size_t i = 0; i < input_count; i++)
+                    {
+                        auto input = static_cast<const ElementType*>(inputs[i]);
+                        if (input_strides[i].empty())
+                        {
+                            operands[i] = input + start;
+                        }
+                        else
+                        {
+                            ElementType* slot = scratch + i * FUSED_ELEMENTWISE_BLOCK;
+                            fused_elementwise_gather(
+                                input, slot, input_strides[i], shape, start, length);
+                            operands[i] = slot;
+                        }
+                    }
+
+                    for (size_t i = 0; i < program.size(); i++)
+                    {
+                        auto& instruction = program[i];
+                        ElementType* step_result =
+                            i + 1 == program.size()
+                                ? result
+                                : scratch + (input_count + i) * FUSED_ELEMENTWISE_BLOCK;
+                        fused_elementwise_step(instruction.opcode,
+                                               operands[instruction.arg0],
+                                               op::FusedElementwise::is_unary(instruction.opcode)
+                                                   ? nullptr
+                                                   : operands[instruction.arg1],
+                                               step_result,
+                                               length);
+                        operands[input_count + i] = step_result;
+                    }
+                }
+
+                // Evaluates `program` over every element of `shape`, one block at a time, so
+                // that each input is read once and the output is written once. `input_strides`
+                // is empty for inputs that have the output shape and holds the per-output-axis
+                // input strides for broadcast inputs.
+                template <typename ElementType>
+                void fused_elementwise(
+                    const std::vector<void*>& inputs,
+                    void* output,
+                    const std::vector<std::vector<size_t>>& input_strides,
+                    const std::vector<op::FusedElementwise::Instruction>& program,
+                    const Shape& shape,
+                    int arena)
+                {
+                    const size_t count = shape_size(shape);
+                    const size_t input_count = inputs.size();
+                    const size_t block_count =
+                        (count + FUSED_ELEMENTWISE_BLOCK - 1) / FUSED_ELEMENTWISE_BLOCK;
+                    if (block_count == 0)
+                    {
+                        return;
+                    }
+
+                    auto out = static_cast<ElementType*>(output);
+
+                    auto evaluate = [&](Eigen::Index first_block, Eigen::Index last_block) {
+                        // Broadcast inputs are gathered into the first slots of the scratch
+                        // buffer, followed by one slot per instruction except the last, which
+                        // writes straight to the output.
+                        std::vector<ElementType> scratch((input_count + program.size()) *
+                                                         FUSED_ELEMENTWISE_BLOCK);
+                        std::vector<const ElementType*> operands(input_count + program.size());
+
+                        for (Eigen::Index block = first_block; block < last_block; block++)
+                        {
+                            size_t start = block * FUSED_ELEMENTWISE_BLOCK;
+                            size_t length = std::min(FUSED_ELEMENTWISE_BLOCK, count - start);
+                            fused_elementwise_block(inputs,
+                                                    input_strides,
+                                                    program,
+                                                    shape,
+                                                    start,
+                                                    length,
+                                                    scratch.data(),
+                                                    operands,
+                                                    out + start);
+                        }
+                    };
+
+                    // Rough per-block cost so that Eigen only splits large tensors across
+                    // threads.
+                    double bytes = static_cast<double>(FUSED_ELEMENTWISE_BLOCK *
+                                                       sizeof(ElementType));
+                    Eigen::TensorOpCost cost(bytes * input_count,
+                                             bytes,
+                                             static_cast<double>(FUSED_ELEMENTWISE_BLOCK *
+                                                                 program.size()));
+                    ngraph::runtime::cpu::executor::GetCPUExecutor()
+                        .get_device(arena)
+                        .parallelFor(block_count, cost, evaluate);
+                }
+
+                // Evaluates `program` like fused_elementwise and sums the result over the last
+                // `reduced_rank` axes of `shape`. Each output element is owned by one thread,
+                // which walks its row of the program shape a block at a time.
+                template <typename ElementType>
+                void fused_elementwise_sum(
+                    const std::vector<void*>& inputs,
+                    void* output,
+                    const std::vector<std::vector<size_t>>& input_strides,
+                    const std::vector<op::FusedElementwise::Instruction>& program,
+                    const Shape& shape,
+                    size_t reduced_rank,
+                    int arena)
+                {
+                    const size_t input_count = inputs.size();
+                    size_t row_count = 1;
+                    size_t row_size = 1;
+                    for (size_t axis = 0; axis < shape.size(); axis++)
+                    {
+                        (axis + reduced_rank < shape.size() ? row_count : row_size) *= shape[axis];
+                    }
+                    if (row_count == 0)
+                    {
+                        return;
+                    }
+
+                    auto out = static_cast<ElementType*>(output);
+
+                    auto evaluate = [&](Eigen::Index first_row, Eigen::Index last_row) {
+                        // The result of the last instruction gets its own scratch slot
+                        std::vector<ElementType> scratch((input_count + program.size()) *
+                                                         FUSED_ELEMENTWISE_BLOCK);
+                        std::vector<const ElementType*> operands(input_count + program.size());
+                        ElementType* result =
+                            &scratch[(input_count + program.size() - 1) * FUSED_ELEMENTWISE_BLOCK];
+
+                        for (Eigen::Index row = first_row; row < last_row; row++)
+                        {
+                            ElementType sum = 0;
+                            size_t end = (row + 1) * row_size;
+                            for (size_t start = row * row_size; start < end;
+                                 start += FUSED_ELEMENTWISE_BLOCK)
+                            {
+                                size_t length = std::min(FUSED_ELEMENTWISE_BLOCK, end - start);
+                                fused_elementwise_block(inputs,
+                                                        input_strides,
+                                                        program,
+                                                        shape,
+                                                        start,
+                                                        length,
+                                                        scratch.data(),
+                                                        operands,
+                                                        result);
+                                sum += FusedArray<ElementType>(result, length).sum();
+                            }
+                            out[row] = sum;
+                        }
+                    };
+
+                    double bytes = static_cast<double>(row_size * sizeof(ElementType));
+                    Eigen::TensorOpCost cost(bytes * input_count,
+                                             sizeof(ElementType),
+                                             static_cast<double>(row_size * program.size()));
+                    ngraph::runtime::cpu::executor::GetCPUExecutor()
+                        .get_device(arena)
+                        .parallelFor(row_count, cost, evaluate);
+                }
+            }
+        }
+    }
+}
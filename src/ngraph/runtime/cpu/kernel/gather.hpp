@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cstring>
+
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
@@ -262,6 +264,71 @@ namespace ngraph
                                                                axis,
                                                                arena);
                 }
+
+                // GatherND: each tuple along the innermost axis of indices selects a slice made of
+                // the trailing axes of params. The slices are contiguous, so each is copied whole
+                // from a flat offset computed from its tuple, on as many threads as there are
+                // slices. Only the element size matters, so one kernel serves every type.
+                template <typename IndicesType>
+                void gather_nd(const void* params,
+                               const void* indices,
+                               void* output,
+                               const Shape& params_shape,
+                               const Shape& indices_shape,
+                               size_t element_size,
+                               int arena)
+                {
+                    size_t slice_rank = indices_shape.back();
+                    size_t slice_length = 1;
+                    for (size_t i = slice_rank; i < params_shape.size(); i++)
+                    {
+                        slice_length *= params_shape[i];
+                    }
+                    std::vector<size_t> strides(slice_rank);
+                    size_t stride = slice_length;
+                    for (size_t i = slice_rank; i-- > 0;)
+                    {
+                        strides[i] = stride;
+                        stride *= params_shape[i];
+                    }
+                    size_t count = 1;
+                    for (size_t i = 0; i + 1 < indices_shape.size(); i++)
+                    {
+                        count *= indices_shape[i];
+                    }
+                    size_t slice_bytes = slice_length * element_size;
+                    if (count == 0 || slice_bytes == 0)
+                    {
+                        return;
+                    }
+
+                    auto params_ptr = static_cast<const char*>(params);
+                    auto indices_ptr = static_cast<const IndicesType*>(indices);
+                    auto output_ptr = static_cast<char*>(output);
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        count,
+                        Eigen::TensorOpCost(slice_bytes, slice_bytes, slice_rank),
+                        [&](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index i = first; i < last; i++)
+                            {
+                                const IndicesType* tuple = indices_ptr + i * slice_rank;
+                                size_t offset = 0;
+                                for (size_t j = 0; j < slice_rank; j++)
+                                {
+                                    // Negative indices count from the end of the axis
+                                    int64_t index = static_cast<int64_t>(tuple[j]);
+                                    if (index < 0)
+                                    {
+                                        index += params_shape[j];
+                                    }
+                                    offset += static_cast<size_t>(index) * strides[j];
+                                }
+                                memcpy(output_ptr + i * slice_bytes,
+                                       params_ptr + offset * element_size,
+                                       slice_bytes);
+                            }
+                        });
+                }
             }
         }
     }
@@ -0,0 +1,517 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/kernel/add.hpp"
+#include "ngraph/runtime/cpu/kernel/erf.hpp"
+#include "ngraph/runtime/cpu/kernel/exp.hpp"
+#include "ngraph/runtime/cpu/kernel/isa.hpp"
+#include "ngraph/runtime/cpu/kernel/log.hpp"
+#include "ngraph/runtime/cpu/kernel/maximum.hpp"
+#include "ngraph/runtime/cpu/kernel/minimum.hpp"
+#include "ngraph/runtime/cpu/kernel/multiply.hpp"
+#include "ngraph/runtime/cpu/kernel/negative.hpp"
+#include "ngraph/runtime/cpu/kernel/relu.hpp"
+#include "ngraph/runtime/cpu/kernel/subtract.hpp"
+#include "ngraph/runtime/cpu/kernel/tanh.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Full reductions are split into fixed-size chunks so that the result does not
+                // depend on the number of threads.
+                static const size_t REDUCTION_CHUNK = 16384;
+
+                static atomic<ISA> s_isa{ISA::baseline};
+
+                static const ISAKernels& lookup_isa_kernels(ISA isa)
+                {
+                    switch (isa)
+                    {
+#if defined(NGRAPH_CPU_ISA_DISPATCH)
+                    case ISA::avx512: return avx512::get_isa_kernels();
+                    case ISA::avx2: return avx2::get_isa_kernels();
+                    case ISA::sse42: return sse42::get_isa_kernels();
+#else
+                    case ISA::avx512:
+                    case ISA::avx2:
+                    case ISA::sse42:
+#endif
+                    case ISA::baseline: break;
+                    }
+                    return baseline::get_isa_kernels();
+                }
+
+                static atomic<const ISAKernels*> s_isa_kernels{nullptr};
+
+                ISA get_host_isa()
+                {
+#if defined(NGRAPH_CPU_ISA_DISPATCH)
+                    __builtin_cpu_init();
+                    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl") &&
+                        __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512dq"))
+                    {
+                        return ISA::avx512;
+                    }
+                    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+                    {
+                        return ISA::avx2;
+                    }
+                    if (__builtin_cpu_supports("sse4.2"))
+                    {
+                        return ISA::sse42;
+                    }
+#endif
+                    return ISA::baseline;
+                }
+
+                ISA get_default_isa()
+                {
+                    ISA isa = get_host_isa();
+                    if (const char* env = getenv("NGRAPH_CPU_ISA"))
+                    {
+                        for (auto candidate : {ISA::baseline, ISA::sse42, ISA::avx2, ISA::avx512})
+                        {
+                            if (isa_name(candidate) == env)
+                            {
+                                return candidate < isa ? candidate : isa;
+                            }
+                        }
+                        NGRAPH_WARN << "Ignoring unknown NGRAPH_CPU_ISA value '" << env << "'";
+                    }
+                    return isa;
+                }
+
+                void set_isa(ISA isa)
+                {
+                    ISA host_isa = get_host_isa();
+                    if (host_isa < isa)
+                    {
+                        isa = host_isa;
+                    }
+                    s_isa = isa;
+                    s_isa_kernels = &lookup_isa_kernels(isa);
+                }
+
+                ISA get_isa() { return s_isa; }
+                string isa_name(ISA isa)
+                {
+                    switch (isa)
+                    {
+                    case ISA::baseline: return "baseline";
+                    case ISA::sse42: return "sse42";
+                    case ISA::avx2: return "avx2";
+                    case ISA::avx512: return "avx512";
+                    }
+                    return "unknown";
+                }
+
+                const ISAKernels& get_isa_kernels()
+                {
+                    auto kernels = s_isa_kernels.load();
+                    return kernels ? *kernels : baseline::get_isa_kernels();
+                }
+
+                // Runs f over [0, count) on the arena's thread pool in blocks aligned to 16
+                // elements. The costs are per element.
+                static void parallel_for(size_t count,
+                                         double bytes_loaded,
+                                         double bytes_stored,
+                                         double cycles,
+                                         int arena,
+                                         const function<void(size_t, size_t)>& f)
+                {
+                    if (count == 0)
+                    {
+                        return;
+                    }
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        count,
+                        Eigen::TensorOpCost(bytes_loaded, bytes_stored, cycles),
+                        [](Eigen::Index size) { return (size + 15) & ~Eigen::Index(15); },
+                        [&f](Eigen::Index first, Eigen::Index last) { f(first, last); });
+                }
+
+#define ISA_BINARY_KERNEL(OP)                                                                      \
+    template <>                                                                                    \
+    void OP<float>(void* input0, void* input1, void* output, size_t count, int arena)              \
+    {                                                                                              \
+        auto kernel = get_isa_kernels().OP;                                                        \
+        auto in0 = static_cast<const float*>(input0);                                              \
+        auto in1 = static_cast<const float*>(input1);                                              \
+        auto out = static_cast<float*>(output);                                                    \
+        parallel_for(count, 8, 4, 1, arena, [&](size_t first, size_t last) {                       \
+            kernel(in0 + first, in1 + first, out + first, last - first);                           \
+        });                                                                                        \
+    }
+
+#define ISA_UNARY_KERNEL(OP, CYCLES)                                                               \
+    template <>                                                                                    \
+    void OP<float>(void* input0, void* output, size_t count, int arena)                            \
+    {                                                                                              \
+        auto kernel = get_isa_kernels().OP;                                                        \
+        auto in = static_cast<const float*>(input0);                                               \
+        auto out = static_cast<float*>(output);                                                    \
+        parallel_for(count, 4, 4, CYCLES, arena, [&](size_t first, size_t last) {                  \
+            kernel(in + first, out + first, last - first);                                         \
+        });                                                                                        \
+    }
+
+                ISA_BINARY_KERNEL(add)
+                ISA_BINARY_KERNEL(subtract)
+                ISA_BINARY_KERNEL(multiply)
+                ISA_BINARY_KERNEL(maximum)
+                ISA_BINARY_KERNEL(minimum)
+                ISA_UNARY_KERNEL(negative, 1)
+                ISA_UNARY_KERNEL(relu, 1)
+                ISA_UNARY_KERNEL(exp, 10)
+                ISA_UNARY_KERNEL(log, 12)
+                ISA_UNARY_KERNEL(tanh, 16)
+                ISA_UNARY_KERNEL(erf, 16)
+
+#define ISA_BINARY_KERNEL_8BIT(OP, T, SUFFIX)                                                      \
+    template <>                                                                                    \
+    void OP<T>(void* input0, void* input1, void* output, size_t count, int arena)                  \
+    {                                                                                              \
+        auto kernel = get_isa_kernels().OP##_##SUFFIX;                                             \
+        auto in0 = static_cast<const T*>(input0);                                                  \
+        auto in1 = static_cast<const T*>(input1);                                                  \
+        auto out = static_cast<T*>(output);                                                        \
+        parallel_for(count, 2, 1, 0.25, arena, [&](size_t first, size_t last) {                    \
+            kernel(in0 + first, in1 + first, out + first, last - first);                           \
+        });                                                                                        \
+    }
+
+                ISA_BINARY_KERNEL_8BIT(add, int8_t, i8)
+                ISA_BINARY_KERNEL_8BIT(add, uint8_t, u8)
+                ISA_BINARY_KERNEL_8BIT(maximum, int8_t, i8)
+                ISA_BINARY_KERNEL_8BIT(maximum, uint8_t, u8)
+                ISA_BINARY_KERNEL_8BIT(minimum, int8_t, i8)
+                ISA_BINARY_KERNEL_8BIT(minimum, uint8_t, u8)
+
+                template <>
+                void relu<int8_t>(void* input0, void* output, size_t count, int arena)
+                {
+                    auto kernel = get_isa_kernels().relu_i8;
+                    auto in = static_cast<const int8_t*>(input0);
+                    auto out = static_cast<int8_t*>(output);
+                    parallel_for(count, 1, 1, 0.25, arena, [&](size_t first, size_t last) {
+                        kernel(in + first, out + first, last - first);
+                    });
+                }
+
+                template <typename Reduce>
+                static float reduce_all(const float* input, size_t count, int arena, Reduce reduce)
+                {
+                    size_t chunks = (count + REDUCTION_CHUNK - 1) / REDUCTION_CHUNK;
+                    if (chunks <= 1)
+                    {
+                        return reduce(input, count);
+                    }
+                    vector<float> partials(chunks);
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        chunks,
+                        Eigen::TensorOpCost(4.0 * REDUCTION_CHUNK, 4, REDUCTION_CHUNK),
+                        [&](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index chunk = first; chunk < last; chunk++)
+                            {
+                                size_t begin = chunk * REDUCTION_CHUNK;
+                                size_t length = REDUCTION_CHUNK < count - begin
+                                                    ? REDUCTION_CHUNK
+                                                    : count - begin;
+                                partials[chunk] = reduce(input + begin, length);
+                            }
+                        });
+                    return reduce(partials.data(), chunks);
+                }
+
+                void reduce_sum_all_float32(const float* input,
+                                            float* output,
+                                            size_t count,
+                                            int arena)
+                {
+                    *output = reduce_all(input, count, arena, get_isa_kernels().reduce_sum);
+                }
+
+                void reduce_max_all_float32(const float* input,
+                                            float* output,
+                                            size_t count,
+                                            int arena)
+                {
+                    *output = reduce_all(input, count, arena, get_isa_kernels().reduce_max);
+                }
+
+                void reduce_sum_rows_float32(
+                    const float* input, float* output, size_t rows, size_t cols, int arena)
+                {
+                    auto reduce = get_isa_kernels().reduce_sum;
+                    parallel_for(rows, 4.0 * cols, 4, cols, arena, [&](size_t first, size_t last) {
+                        for (size_t r = first; r < last; r++)
+                        {
+                            output[r] = reduce(input + r * cols, cols);
+                        }
+                    });
+                }
+
+                void reduce_max_rows_float32(
+                    const float* input, float* output, size_t rows, size_t cols, int arena)
+                {
+                    auto reduce = get_isa_kernels().reduce_max;
+                    parallel_for(rows, 4.0 * cols, 4, cols, arena, [&](size_t first, size_t last) {
+                        for (size_t r = first; r < last; r++)
+                        {
+                            output[r] = reduce(input + r * cols, cols);
+                        }
+                    });
+                }
+
+                template <typename Accumulate>
+                static void reduce_cols(const float* input,
+                                        float* output,
+                                        size_t rows,
+                                        size_t cols,
+                                        float identity,
+                                        int arena,
+                                        Accumulate accumulate)
+                {
+                    parallel_for(
+                        cols, 4.0 * rows, 4, rows, arena, [&](size_t first, size_t last) {
+                            if (rows == 0)
+                            {
+                                fill(output + first, output + last, identity);
+                                return;
+                            }
+                            memcpy(output + first, input + first, (last - first) * sizeof(float));
+                            for (size_t r = 1; r < rows; r++)
+                            {
+                                accumulate(input + r * cols + first, output + first, last - first);
+                            }
+                        });
+                }
+
+                void reduce_sum_cols_float32(
+                    const float* input, float* output, size_t rows, size_t cols, int arena)
+                {
+                    reduce_cols(
+                        input, output, rows, cols, 0.0f, arena, get_isa_kernels().accumulate_sum);
+                }
+
+                void reduce_max_cols_float32(
+                    const float* input, float* output, size_t rows, size_t cols, int arena)
+                {
+                    reduce_cols(input,
+                                output,
+                                rows,
+                                cols,
+                                -numeric_limits<float>::infinity(),
+                                arena,
+                                get_isa_kernels().accumulate_max);
+                }
+
+                void softmax_rows_float32(
+                    void* input, void* output, size_t rows, size_t cols, int arena)
+                {
+                    auto kernel = get_isa_kernels().softmax_rows;
+                    auto in = static_cast<const float*>(input);
+                    auto out = static_cast<float*>(output);
+                    double bytes = 4.0 * cols;
+                    parallel_for(
+                        rows, bytes, bytes, 20.0 * cols, arena, [&](size_t first, size_t last) {
+                            kernel(in + first * cols, out + first * cols, last - first, cols);
+                        });
+                }
+
+                void sigmoid_float32(void* input, void* output, size_t count, int arena)
+                {
+                    auto kernel = get_isa_kernels().sigmoid;
+                    auto in = static_cast<const float*>(input);
+                    auto out = static_cast<float*>(output);
+                    parallel_for(count, 4, 4, 12, arena, [&](size_t first, size_t last) {
+                        kernel(in + first, out + first, last - first);
+                    });
+                }
+
+                void gelu_float32(void* input, void* output, size_t count, int arena)
+                {
+                    auto kernel = get_isa_kernels().gelu;
+                    auto in = static_cast<const float*>(input);
+                    auto out = static_cast<float*>(output);
+                    parallel_for(count, 4, 4, 18, arena, [&](size_t first, size_t last) {
+                        kernel(in + first, out + first, last - first);
+                    });
+                }
+
+                void swish_float32(void* input, void* output, size_t count, int arena)
+                {
+                    auto kernel = get_isa_kernels().swish;
+                    auto in = static_cast<const float*>(input);
+                    auto out = static_cast<float*>(output);
+                    parallel_for(count, 4, 4, 12, arena, [&](size_t first, size_t last) {
+                        kernel(in + first, out + first, last - first);
+                    });
+                }
+
+                void broadcast_2d_float32(void* input,
+                                          void* output,
+                                          const Shape& input_shape,
+                                          const Shape& output_shape,
+                                          int arena)
+                {
+                    auto& kernels = get_isa_kernels();
+                    size_t rows = output_shape[0];
+                    size_t cols = output_shape[1];
+                    auto in = static_cast<const float*>(input);
+                    auto out = static_cast<float*>(output);
+                    // The input is either [1, cols] or [rows, 1]
+                    bool by_rows = input_shape[0] == 1;
+                    auto kernel = by_rows ? kernels.broadcast_rows : kernels.broadcast_cols;
+                    parallel_for(rows, 4, 4.0 * cols, cols, arena, [&](size_t first, size_t last) {
+                        kernel(by_rows ? in : in + first, out + first * cols, last - first, cols);
+                    });
+                }
+
+                void transpose_2d_float32(void* input,
+                                          void* output,
+                                          const Shape& input_shape,
+                                          const AxisVector& /* input_axis_order */,
+                                          const Shape& /* output_shape */,
+                                          int arena)
+                {
+                    auto kernel = get_isa_kernels().transpose;
+                    size_t rows = input_shape[0];
+                    size_t cols = input_shape[1];
+                    auto in = static_cast<const float*>(input);
+                    auto out = static_cast<float*>(output);
+                    parallel_for(
+                        rows, 4.0 * cols, 4.0 * cols, cols, arena, [&](size_t first, size_t last) {
+                            kernel(in, out, rows, cols, first, last);
+                        });
+                }
+
+                template <typename In, typename Out>
+                static void convert_16bit(void* input,
+                                          void* output,
+                                          size_t count,
+                                          int arena,
+                                          void (*kernel)(const In*, Out*, size_t))
+                {
+                    auto in = static_cast<const In*>(input);
+                    auto out = static_cast<Out*>(output);
+                    parallel_for(
+                        count, sizeof(In), sizeof(Out), 1, arena, [&](size_t first, size_t last) {
+                            kernel(in + first, out + first, last - first);
+                        });
+                }
+
+                void convert_float32_to_bf16(void* input, void* output, size_t count, int arena)
+                {
+                    convert_16bit(input, output, count, arena, get_isa_kernels().float32_to_bf16);
+                }
+
+                void convert_bf16_to_float32(void* input, void* output, size_t count, int arena)
+                {
+                    convert_16bit(input, output, count, arena, get_isa_kernels().bf16_to_float32);
+                }
+
+                void convert_float32_to_f16(void* input, void* output, size_t count, int arena)
+                {
+                    convert_16bit(input, output, count, arena, get_isa_kernels().float32_to_f16);
+                }
+
+                void convert_f16_to_float32(void* input, void* output, size_t count, int arena)
+                {
+                    convert_16bit(input, output, count, arena, get_isa_kernels().f16_to_float32);
+                }
+
+                template <typename T>
+                static void quantized_add(void* input0,
+                                          void* input1,
+                                          void* output,
+                                          size_t count,
+                                          float input0_multiplier,
+                                          float input1_multiplier,
+                                          int arena,
+                                          void (*kernel)(
+                                              const T*, const T*, T*, size_t, float, float))
+                {
+                    auto in0 = static_cast<const T*>(input0);
+                    auto in1 = static_cast<const T*>(input1);
+                    auto out = static_cast<T*>(output);
+                    parallel_for(count, 2, 1, 2, arena, [&](size_t first, size_t last) {
+                        kernel(in0 + first,
+                               in1 + first,
+                               out + first,
+                               last - first,
+                               input0_multiplier,
+                               input1_multiplier);
+                    });
+                }
+
+                void quantized_add_int8(void* input0,
+                                        void* input1,
+                                        void* output,
+                                        size_t count,
+                                        float input0_multiplier,
+                                        float input1_multiplier,
+                                        int arena)
+                {
+                    quantized_add(input0,
+                                  input1,
+                                  output,
+                                  count,
+                                  input0_multiplier,
+                                  input1_multiplier,
+                                  arena,
+                                  get_isa_kernels().quantized_add_i8);
+                }
+
+                void quantized_add_uint8(void* input0,
+                                         void* input1,
+                                         void* output,
+                                         size_t count,
+                                         float input0_multiplier,
+                                         float input1_multiplier,
+                                         int arena)
+                {
+                    quantized_add(input0,
+                                  input1,
+                                  output,
+                                  count,
+                                  input0_multiplier,
+                                  input1_multiplier,
+                                  arena,
+                                  get_isa_kernels().quantized_add_u8);
+                }
+            }
+        }
+    }
+}
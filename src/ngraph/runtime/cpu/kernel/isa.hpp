@@ -0,0 +1,217 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/axis_vector.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Instruction sets the hot kernels are built for, in increasing order.
+                enum class ISA
+                {
+                    baseline,
+                    sse42,
+                    avx2,
+                    avx512
+                };
+
+                /// \brief Single-threaded kernels built for one instruction set. Every
+                ///        entry works on a contiguous range; the callers in isa.cpp split the
+                ///        work over the executor's thread pools.
+                struct ISAKernels
+                {
+                    void (*add)(const float*, const float*, float*, size_t);
+                    void (*subtract)(const float*, const float*, float*, size_t);
+                    void (*multiply)(const float*, const float*, float*, size_t);
+                    void (*maximum)(const float*, const float*, float*, size_t);
+                    void (*minimum)(const float*, const float*, float*, size_t);
+                    void (*negative)(const float*, float*, size_t);
+                    void (*relu)(const float*, float*, size_t);
+
+                    /// Vectorized approximations, see isa_kernels.hpp for their error bounds
+                    void (*exp)(const float*, float*, size_t);
+                    void (*log)(const float*, float*, size_t);
+                    void (*tanh)(const float*, float*, size_t);
+                    void (*erf)(const float*, float*, size_t);
+                    void (*sigmoid)(const float*, float*, size_t);
+                    /// x * Phi(x) and x * sigmoid(x) in one pass
+                    void (*gelu)(const float*, float*, size_t);
+                    void (*swish)(const float*, float*, size_t);
+
+                    /// Sum and max of `count` elements
+                    float (*reduce_sum)(const float*, size_t);
+                    float (*reduce_max)(const float*, size_t);
+                    /// out[j] op= in[j] for `count` elements
+                    void (*accumulate_sum)(const float*, float*, size_t);
+                    void (*accumulate_max)(const float*, float*, size_t);
+
+                    /// Softmax over each of `rows` rows of `cols` elements
+                    void (*softmax_rows)(const float*, float*, size_t rows, size_t cols);
+                    /// out[r][c] = in[c]
+                    void (*broadcast_rows)(const float*, float*, size_t rows, size_t cols);
+                    /// out[r][c] = in[r]
+                    void (*broadcast_cols)(const float*, float*, size_t rows, size_t cols);
+                    /// out[c][r] = in[r][c] for the rows [row_begin, row_end) of `in`
+                    void (*transpose)(const float*,
+                                      float*,
+                                      size_t rows,
+                                      size_t cols,
+                                      size_t row_begin,
+                                      size_t row_end);
+
+                    /// Conversions between f32 and the raw bits of the 16-bit float types
+                    void (*float32_to_bf16)(const float*, uint16_t*, size_t);
+                    void (*bf16_to_float32)(const uint16_t*, float*, size_t);
+                    void (*float32_to_f16)(const float*, uint16_t*, size_t);
+                    void (*f16_to_float32)(const uint16_t*, float*, size_t);
+
+                    /// 8-bit elementwise kernels. Add wraps around like the reference kernel.
+                    void (*add_i8)(const int8_t*, const int8_t*, int8_t*, size_t);
+                    void (*add_u8)(const uint8_t*, const uint8_t*, uint8_t*, size_t);
+                    void (*maximum_i8)(const int8_t*, const int8_t*, int8_t*, size_t);
+                    void (*maximum_u8)(const uint8_t*, const uint8_t*, uint8_t*, size_t);
+                    void (*minimum_i8)(const int8_t*, const int8_t*, int8_t*, size_t);
+                    void (*minimum_u8)(const uint8_t*, const uint8_t*, uint8_t*, size_t);
+                    void (*relu_i8)(const int8_t*, int8_t*, size_t);
+                    /// out[i] = saturate(round(a[i] * a_multiplier + b[i] * b_multiplier)),
+                    /// rounding to nearest even
+                    void (*quantized_add_i8)(
+                        const int8_t*, const int8_t*, int8_t*, size_t, float, float);
+                    void (*quantized_add_u8)(
+                        const uint8_t*, const uint8_t*, uint8_t*, size_t, float, float);
+                };
+
+                namespace baseline
+                {
+                    const ISAKernels& get_isa_kernels();
+                }
+#if defined(NGRAPH_CPU_ISA_DISPATCH)
+                namespace sse42
+                {
+                    const ISAKernels& get_isa_kernels();
+                }
+                namespace avx2
+                {
+                    const ISAKernels& get_isa_kernels();
+                }
+                namespace avx512
+                {
+                    const ISAKernels& get_isa_kernels();
+                }
+#endif
+
+                /// \returns the best instruction set this binary has kernels for that the host
+                ///          CPU supports.
+                CPU_BACKEND_API ISA get_host_isa();
+
+                /// \returns the host ISA, capped by the NGRAPH_CPU_ISA environment variable
+                ///          (one of "baseline", "sse42", "avx2" or "avx512") if it is set.
+                CPU_BACKEND_API ISA get_default_isa();
+
+                /// \brief Selects the kernels used from now on. Requests above the host ISA
+                ///        are lowered to it. Called with get_default_isa() when a CPU_Backend
+                ///        is constructed.
+                CPU_BACKEND_API void set_isa(ISA isa);
+                CPU_BACKEND_API ISA get_isa();
+                CPU_BACKEND_API std::string isa_name(ISA isa);
+
+                const ISAKernels& get_isa_kernels();
+
+                // Multi-threaded entry points for the builders
+                void reduce_sum_all_float32(const float* input,
+                                            float* output,
+                                            size_t count,
+                                            int arena);
+                void reduce_max_all_float32(const float* input,
+                                            float* output,
+                                            size_t count,
+                                            int arena);
+
+                /// Reduce a row-major [rows, cols] tensor over its innermost axis.
+                void reduce_sum_rows_float32(
+                    const float* input, float* output, size_t rows, size_t cols, int arena);
+                void reduce_max_rows_float32(
+                    const float* input, float* output, size_t rows, size_t cols, int arena);
+
+                /// Reduce a row-major [rows, cols] tensor over its outermost axis.
+                void reduce_sum_cols_float32(
+                    const float* input, float* output, size_t rows, size_t cols, int arena);
+                void reduce_max_cols_float32(
+                    const float* input, float* output, size_t rows, size_t cols, int arena);
+
+                /// Softmax over each of the `rows` contiguous rows of `cols` elements.
+                void softmax_rows_float32(
+                    void* input, void* output, size_t rows, size_t cols, int arena);
+
+                void sigmoid_float32(void* input, void* output, size_t count, int arena);
+                void gelu_float32(void* input, void* output, size_t count, int arena);
+                void swish_float32(void* input, void* output, size_t count, int arena);
+
+                void broadcast_2d_float32(void* input,
+                                          void* output,
+                                          const Shape& input_shape,
+                                          const Shape& output_shape,
+                                          int arena);
+
+                void transpose_2d_float32(void* input,
+                                          void* output,
+                                          const Shape& input_shape,
+                                          const AxisVector& input_axis_order,
+                                          const Shape& output_shape,
+                                          int arena);
+
+                /// Bulk conversions with the signature of the kernels in convert.hpp. bf16
+                /// rounds exactly like ngraph::bfloat16; f16 rounds to nearest even, as the
+                /// F16C instructions do.
+                void convert_float32_to_bf16(void* input, void* output, size_t count, int arena);
+                void convert_bf16_to_float32(void* input, void* output, size_t count, int arena);
+                void convert_float32_to_f16(void* input, void* output, size_t count, int arena);
+                void convert_f16_to_float32(void* input, void* output, size_t count, int arena);
+
+                /// Adds two tensors quantized with zero zero points and rescales the sum to
+                /// the output scale, saturating to the range of the element type.
+                void quantized_add_int8(void* input0,
+                                        void* input1,
+                                        void* output,
+                                        size_t count,
+                                        float input0_multiplier,
+                                        float input1_multiplier,
+                                        int arena);
+                void quantized_add_uint8(void* input0,
+                                         void* input1,
+                                         void* output,
+                                         size_t count,
+                                         float input0_multiplier,
+                                         float input1_multiplier,
+                                         int arena);
+            }
+        }
+    }
+}
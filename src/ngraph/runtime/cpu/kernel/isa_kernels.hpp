@@ -0,0 +1,750 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// Kernel bodies shared by the per-ISA translation units. Each of them defines NGRAPH_CPU_ISA
+// to the name of its namespace and is compiled with the matching target flags, so everything
+// here must stay inside that namespace; an inline function or template shared with another
+// ISA would be merged by the linker and could run the wrong code. That includes the standard
+// library templates, which is why the loops below are written out by hand.
+//
+// Reductions accumulate into ISA_LANES independent partial results, which vectorizes without
+// reassociation and gives the same result for every ISA.
+
+#if !defined(NGRAPH_CPU_ISA)
+#error "NGRAPH_CPU_ISA must name the instruction set namespace"
+#endif
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#if defined(__F16C__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#include "ngraph/runtime/cpu/kernel/isa.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace NGRAPH_CPU_ISA
+                {
+                    static const size_t ISA_LANES = 16;
+                    static const size_t TRANSPOSE_BLOCK = 16;
+
+                    static void add(const float* a, const float* b, float* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = a[i] + b[i];
+                        }
+                    }
+
+                    static void subtract(const float* a, const float* b, float* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = a[i] - b[i];
+                        }
+                    }
+
+                    static void multiply(const float* a, const float* b, float* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = a[i] * b[i];
+                        }
+                    }
+
+                    static void maximum(const float* a, const float* b, float* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = a[i] < b[i] ? b[i] : a[i];
+                        }
+                    }
+
+                    static void minimum(const float* a, const float* b, float* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = b[i] < a[i] ? b[i] : a[i];
+                        }
+                    }
+
+                    static void negative(const float* in, float* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = -in[i];
+                        }
+                    }
+
+                    static void relu(const float* in, float* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = in[i] < 0.0f ? 0.0f : in[i];
+                        }
+                    }
+
+                    static float reduce_sum(const float* in, size_t count)
+                    {
+                        float lanes[ISA_LANES] = {};
+                        size_t i = 0;
+                        for (; i + ISA_LANES <= count; i += ISA_LANES)
+                        {
+                            for (size_t j = 0; j < ISA_LANES; j++)
+                            {
+                                lanes[j] += in[i + j];
+                            }
+                        }
+                        for (size_t j = 0; i < count; i++, j++)
+                        {
+                            lanes[j] += in[i];
+                        }
+                        float sum = 0.0f;
+                        for (size_t j = 0; j < ISA_LANES; j++)
+                        {
+                            sum += lanes[j];
+                        }
+                        return sum;
+                    }
+
+                    static float reduce_max(const float* in, size_t count)
+                    {
+                        float lanes[ISA_LANES];
+                        for (size_t j = 0; j < ISA_LANES; j++)
+                        {
+                            lanes[j] = -std::numeric_limits<float>::infinity();
+                        }
+                        size_t i = 0;
+                        for (; i + ISA_LANES <= count; i += ISA_LANES)
+                        {
+                            for (size_t j = 0; j < ISA_LANES; j++)
+                            {
+                                lanes[j] = lanes[j] < in[i + j] ? in[i + j] : lanes[j];
+                            }
+                        }
+                        for (size_t j = 0; i < count; i++, j++)
+                        {
+                            lanes[j] = lanes[j] < in[i] ? in[i] : lanes[j];
+                        }
+                        float max = lanes[0];
+                        for (size_t j = 1; j < ISA_LANES; j++)
+                        {
+                            max = max < lanes[j] ? lanes[j] : max;
+                        }
+                        return max;
+                    }
+
+                    static void accumulate_sum(const float* in, float* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] += in[i];
+                        }
+                    }
+
+                    static void accumulate_max(const float* in, float* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = out[i] < in[i] ? in[i] : out[i];
+                        }
+                    }
+
+                    // Cephes-style exp that vectorizes: exp(x) = 2^n * exp(r) with
+                    // r = x - n * ln(2) and a degree 5 polynomial for exp(r). Accurate to a few
+                    // ulp; results that would be denormal flush to zero.
+                    static inline float exp_poly(float x)
+                    {
+                        const float lower = -87.33654f;
+                        const float upper = 88.37626f;
+                        const float round = 12582912.0f; // 1.5 * 2^23
+                        float clamped = x < lower ? lower : x;
+                        clamped = upper < clamped ? upper : clamped;
+                        float n = (clamped * 1.44269504088896341f + round) - round;
+                        float r = clamped - n * 0.693359375f + n * 2.12194440e-4f;
+                        float p = 1.9875691500e-4f;
+                        p = p * r + 1.3981999507e-3f;
+                        p = p * r + 8.3334519073e-3f;
+                        p = p * r + 4.1665795894e-2f;
+                        p = p * r + 1.6666665459e-1f;
+                        p = p * r + 5.0000001201e-1f;
+                        p = p * r * r + r + 1.0f;
+                        union {
+                            int32_t i;
+                            float f;
+                        } scale;
+                        scale.i = (static_cast<int32_t>(n) + 127) << 23;
+                        float result = p * scale.f;
+                        return x < lower ? 0.0f : result;
+                    }
+
+                    // max, then exp and sum in one pass, then scale
+                    static void softmax_rows(const float* in, float* out, size_t rows, size_t cols)
+                    {
+                        for (size_t r = 0; r < rows; r++)
+                        {
+                            const float* row_in = in + r * cols;
+                            float* row_out = out + r * cols;
+                            float max = reduce_max(row_in, cols);
+                            float lanes[ISA_LANES] = {};
+                            size_t c = 0;
+                            for (; c + ISA_LANES <= cols; c += ISA_LANES)
+                            {
+                                for (size_t j = 0; j < ISA_LANES; j++)
+                                {
+                                    float value = exp_poly(row_in[c + j] - max);
+                                    row_out[c + j] = value;
+                                    lanes[j] += value;
+                                }
+                            }
+                            for (size_t j = 0; c < cols; c++, j++)
+                            {
+                                float value = exp_poly(row_in[c] - max);
+                                row_out[c] = value;
+                                lanes[j] += value;
+                            }
+                            float sum = 0.0f;
+                            for (size_t j = 0; j < ISA_LANES; j++)
+                            {
+                                sum += lanes[j];
+                            }
+                            float scale = 1.0f / sum;
+                            for (c = 0; c < cols; c++)
+                            {
+                                row_out[c] *= scale;
+                            }
+                        }
+                    }
+
+                    static void
+                        broadcast_rows(const float* in, float* out, size_t rows, size_t cols)
+                    {
+                        for (size_t r = 0; r < rows; r++)
+                        {
+                            float* row_out = out + r * cols;
+                            for (size_t c = 0; c < cols; c++)
+                            {
+                                row_out[c] = in[c];
+                            }
+                        }
+                    }
+
+                    static void
+                        broadcast_cols(const float* in, float* out, size_t rows, size_t cols)
+                    {
+                        for (size_t r = 0; r < rows; r++)
+                        {
+                            float* row_out = out + r * cols;
+                            float value = in[r];
+                            for (size_t c = 0; c < cols; c++)
+                            {
+                                row_out[c] = value;
+                            }
+                        }
+                    }
+
+                    static void transpose(const float* in,
+                                          float* out,
+                                          size_t rows,
+                                          size_t cols,
+                                          size_t row_begin,
+                                          size_t row_end)
+                    {
+                        for (size_t r0 = row_begin; r0 < row_end; r0 += TRANSPOSE_BLOCK)
+                        {
+                            size_t r1 =
+                                row_end - r0 < TRANSPOSE_BLOCK ? row_end : r0 + TRANSPOSE_BLOCK;
+                            for (size_t c0 = 0; c0 < cols; c0 += TRANSPOSE_BLOCK)
+                            {
+                                size_t c1 =
+                                    cols - c0 < TRANSPOSE_BLOCK ? cols : c0 + TRANSPOSE_BLOCK;
+                                for (size_t r = r0; r < r1; r++)
+                                {
+                                    for (size_t c = c0; c < c1; c++)
+                                    {
+                                        out[c * rows + r] = in[r * cols + c];
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                    static uint32_t float_bits(float value)
+                    {
+                        uint32_t bits;
+                        memcpy(&bits, &value, sizeof(bits));
+                        return bits;
+                    }
+
+                    static float bits_float(uint32_t bits)
+                    {
+                        float value;
+                        memcpy(&value, &bits, sizeof(value));
+                        return value;
+                    }
+
+                    // Same rounding as ngraph::bfloat16
+                    static void float32_to_bf16(const float* in, uint16_t* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            uint32_t bits = float_bits(in[i]);
+                            out[i] = static_cast<uint16_t>((bits + ((bits & 0x10000) >> 1)) >> 16);
+                        }
+                    }
+
+                    static void bf16_to_float32(const uint16_t* in, float* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = bits_float(static_cast<uint32_t>(in[i]) << 16);
+                        }
+                    }
+
+                    static uint16_t float32_to_f16_scalar(float value)
+                    {
+                        uint32_t bits = float_bits(value);
+                        uint32_t sign = (bits >> 16) & 0x8000;
+                        bits &= 0x7fffffff;
+                        uint32_t result;
+                        if (bits >= 0x47800000)
+                        {
+                            // 2^16 and above overflow to infinity. NaNs are quieted and keep
+                            // the top of their payload.
+                            result = bits > 0x7f800000 ? 0x7e00 | ((bits >> 13) & 0x3ff) : 0x7c00;
+                        }
+                        else if (bits < 0x38800000)
+                        {
+                            // Below 2^-14 the result is subnormal. Adding 0.5 lines the f16
+                            // mantissa up with the low bits of the f32 one and rounds it.
+                            result = float_bits(bits_float(bits) + 0.5f) - 0x3f000000;
+                        }
+                        else
+                        {
+                            // Rebias the exponent and round the 13 dropped bits to even
+                            uint32_t odd = (bits >> 13) & 1;
+                            result = (bits + 0xc8000fff + odd) >> 13;
+                        }
+                        return static_cast<uint16_t>(result | sign);
+                    }
+
+                    static float f16_to_float32_scalar(uint16_t value)
+                    {
+                        uint32_t sign = static_cast<uint32_t>(value & 0x8000) << 16;
+                        uint32_t bits = static_cast<uint32_t>(value & 0x7fff) << 13;
+                        uint32_t exponent = bits & 0x0f800000;
+                        bits += 0x38000000;
+                        if (exponent == 0x0f800000)
+                        {
+                            // Infinity or NaN, which is quieted
+                            bits += 0x38000000;
+                            if ((bits & 0x007fffff) != 0)
+                            {
+                                bits |= 0x00400000;
+                            }
+                        }
+                        else if (exponent == 0)
+                        {
+                            // Zero or subnormal, normalized by the f32 subtraction
+                            float normal = bits_float(bits + 0x00800000);
+                            bits = float_bits(normal - bits_float(0x38800000));
+                        }
+                        return bits_float(bits | sign);
+                    }
+
+                    static void float32_to_f16(const float* in, uint16_t* out, size_t count)
+                    {
+                        size_t i = 0;
+#if defined(__AVX512F__)
+                        for (; i + 16 <= count; i += 16)
+                        {
+                            __m256i half = _mm512_cvtps_ph(_mm512_loadu_ps(in + i),
+                                                           _MM_FROUND_TO_NEAREST_INT);
+                            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), half);
+                        }
+#elif defined(__F16C__)
+                        for (; i + 8 <= count; i += 8)
+                        {
+                            __m128i half =
+                                _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT);
+                            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), half);
+                        }
+#endif
+                        for (; i < count; i++)
+                        {
+                            out[i] = float32_to_f16_scalar(in[i]);
+                        }
+                    }
+
+                    static void f16_to_float32(const uint16_t* in, float* out, size_t count)
+                    {
+                        size_t i = 0;
+#if defined(__AVX512F__)
+                        for (; i + 16 <= count; i += 16)
+                        {
+                            __m256i half =
+                                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+                            _mm512_storeu_ps(out + i, _mm512_cvtph_ps(half));
+                        }
+#elif defined(__F16C__)
+                        for (; i + 8 <= count; i += 8)
+                        {
+                            __m128i half =
+                                _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                            _mm256_storeu_ps(out + i, _mm256_cvtph_ps(half));
+                        }
+#endif
+                        for (; i < count; i++)
+                        {
+                            out[i] = f16_to_float32_scalar(in[i]);
+                        }
+                    }
+
+                    // Activation math. Every function is branch-free apart from selects, so
+                    // the loops over them vectorize for each ISA. The error bounds below are
+                    // the largest distance from the correctly rounded result, checked against
+                    // every f32 input whose result is a normal float. Special values follow
+                    // the standard library.
+
+                    // exp(x) = 2^n * exp(r) with r = x - n * ln(2) and the degree 7 polynomial
+                    // from exp_poly. The scale is applied in two halves so that 2^n may be as
+                    // large as 2^128 or denormal. Within 1 ulp; overflows to infinity.
+                    static inline float exp_approx(float x)
+                    {
+                        const float lower = -103.972084f;
+                        const float upper = 88.7228394f;
+                        const float round = 12582912.0f; // 1.5 * 2^23
+                        float clamped = x < lower ? lower : x;
+                        clamped = upper < clamped ? upper : clamped;
+                        float n = (clamped * 1.44269504088896341f + round) - round;
+                        float r = clamped - n * 0.693359375f + n * 2.12194440e-4f;
+                        float p = 1.9875691500e-4f;
+                        p = p * r + 1.3981999507e-3f;
+                        p = p * r + 8.3334519073e-3f;
+                        p = p * r + 4.1665795894e-2f;
+                        p = p * r + 1.6666665459e-1f;
+                        p = p * r + 5.0000001201e-1f;
+                        p = p * r * r + r + 1.0f;
+                        int32_t n0 = static_cast<int32_t>(n);
+                        int32_t n1 = n0 >> 1;
+                        float result = p * bits_float(static_cast<uint32_t>(n1 + 127) << 23) *
+                                       bits_float(static_cast<uint32_t>(n0 - n1 + 127) << 23);
+                        result = x < lower ? 0.0f : result;
+                        result = upper < x ? std::numeric_limits<float>::infinity() : result;
+                        return x != x ? x : result;
+                    }
+
+                    // log(x) = e * ln(2) + log(m) with m in [sqrt(1/2), sqrt(2)) and the Cephes
+                    // degree 9 polynomial for log(1 + f). Within 1 ulp.
+                    static inline float log_approx(float x)
+                    {
+                        const float min_normal = 1.17549435e-38f;
+                        bool denormal = x < min_normal;
+                        uint32_t bits = float_bits(denormal ? x * 8388608.0f : x); // 2^23
+                        float e = static_cast<float>(static_cast<int32_t>(bits >> 23) - 126) -
+                                  (denormal ? 23.0f : 0.0f);
+                        float m = bits_float((bits & 0x007fffff) | 0x3f000000);
+                        bool low = m < 0.707106781186547524f;
+                        e = low ? e - 1.0f : e;
+                        float f = (low ? m + m : m) - 1.0f;
+                        float z = f * f;
+                        float p = 7.0376836292e-2f;
+                        p = p * f - 1.1514610310e-1f;
+                        p = p * f + 1.1676998740e-1f;
+                        p = p * f - 1.2420140846e-1f;
+                        p = p * f + 1.4249322787e-1f;
+                        p = p * f - 1.6668057665e-1f;
+                        p = p * f + 2.0000714765e-1f;
+                        p = p * f - 2.4999993993e-1f;
+                        p = p * f + 3.3333331174e-1f;
+                        p = p * f * z;
+                        p = p - e * 2.12194440e-4f;
+                        p = p - 0.5f * z;
+                        float result = f + p + e * 0.693359375f;
+                        result = x == 0.0f ? -std::numeric_limits<float>::infinity() : result;
+                        result = x == std::numeric_limits<float>::infinity() ? x : result;
+                        return x < 0.0f || x != x ? std::numeric_limits<float>::quiet_NaN()
+                                                  : result;
+                    }
+
+                    // Odd Cephes polynomial below 0.625, 1 - 2 / (exp(2|x|) + 1) above.
+                    // Within 1 ulp.
+                    static inline float tanh_approx(float x)
+                    {
+                        float a = x < 0.0f ? -x : x;
+                        float z = x * x;
+                        float p = -5.70498872745e-3f;
+                        p = p * z + 2.06390887954e-2f;
+                        p = p * z - 5.37397155531e-2f;
+                        p = p * z + 1.33314422036e-1f;
+                        p = p * z - 3.33332819422e-1f;
+                        float small = x + x * z * p;
+                        float large = 1.0f - 2.0f / (exp_approx(a + a) + 1.0f);
+                        large = x < 0.0f ? -large : large;
+                        return a < 0.625f ? small : large;
+                    }
+
+                    // Rational approximation x * P(x^2) / Q(x^2) on [-4, 4], as in Eigen's
+                    // vectorized erf. Within 8 ulp.
+                    static inline float erf_approx(float x)
+                    {
+                        float c = x < -4.0f ? -4.0f : x;
+                        c = 4.0f < c ? 4.0f : c;
+                        float z = c * c;
+                        float p = -2.72614225801306e-10f;
+                        p = p * z + 2.77068142495902e-08f;
+                        p = p * z - 2.10102402082508e-06f;
+                        p = p * z - 5.69250639462346e-05f;
+                        p = p * z - 7.34990630326855e-04f;
+                        p = p * z - 2.95459980854025e-03f;
+                        p = p * z - 1.60960333262415e-02f;
+                        float q = -1.45660718464996e-05f;
+                        q = q * z - 2.13374055278905e-04f;
+                        q = q * z - 1.68282697438203e-03f;
+                        q = q * z - 7.37332916720468e-03f;
+                        q = q * z - 1.42647390514189e-02f;
+                        float result = c * (p / q);
+                        return x != x ? x : result;
+                    }
+
+                    // erfc(x / sqrt(2)) for x >= sqrt(2), as exp(-x^2 / 2) times the Cephes
+                    // rational approximations in 1 / x. x^2 / 2 is split so that the large
+                    // part is exact, which keeps the rounding of the exponent from growing
+                    // with x.
+                    static inline float erfc_scaled_tail(float x)
+                    {
+                        float high = bits_float(float_bits(x) & 0xfffff000);
+                        float low = x - high;
+                        float e = exp_approx(-0.5f * high * high) *
+                                  exp_approx(-0.5f * low * (x + high));
+                        float q = 1.0f / (x * 0.707106781186547524f);
+                        float y = q * q;
+                        float near = 2.326819970068386e-2f;
+                        near = near * y - 1.387039388740657e-1f;
+                        near = near * y + 3.687424674597105e-1f;
+                        near = near * y - 5.824733027278666e-1f;
+                        near = near * y + 6.210004621745983e-1f;
+                        near = near * y - 4.944515323274145e-1f;
+                        near = near * y + 3.404879937665872e-1f;
+                        near = near * y - 2.741127028184656e-1f;
+                        near = near * y + 5.638259427386472e-1f;
+                        float far = -1.047766399936249e+1f;
+                        far = far * y + 1.297719955372516e+1f;
+                        far = far * y - 7.495518717768503e+0f;
+                        far = far * y + 2.921019019210786e+0f;
+                        far = far * y - 1.015265279202700e+0f;
+                        far = far * y + 4.218463358204948e-1f;
+                        far = far * y - 2.820767439740514e-1f;
+                        far = far * y + 5.641895067754075e-1f;
+                        return e * q * (x < 2.82842712474619010f ? near : far);
+                    }
+
+                    // x * Phi(x) = x / 2 * (1 + erf(x / sqrt(2))). Below -sqrt(2) the sum
+                    // cancels, so the tail uses erfc instead. Within 18 ulp.
+                    static inline float gelu_approx(float x)
+                    {
+                        float a = x < 0.0f ? -x : x;
+                        float head = 0.5f * x * (1.0f + erf_approx(x * 0.707106781186547524f));
+                        // erfc has underflowed long before 32
+                        float tail = -0.5f * a * erfc_scaled_tail(a < 32.0f ? a : 32.0f);
+                        return x < -1.41421356237309505f ? tail : head;
+                    }
+
+                    // exp(-|x|) never overflows, so both tails stay accurate. Within 3 ulp.
+                    static inline float sigmoid_approx(float x)
+                    {
+                        float e = exp_approx(x < 0.0f ? x : -x);
+                        float r = 1.0f / (1.0f + e);
+                        return x < 0.0f ? e * r : r;
+                    }
+
+                    // x * sigmoid(x). Within 3 ulp above -87, where exp(x) becomes denormal.
+                    static inline float swish_approx(float x)
+                    {
+                        float e = exp_approx(x < 0.0f ? x : -x);
+                        float r = x / (1.0f + e);
+                        return x < 0.0f ? e * r : r;
+                    }
+
+                    static void exp(const float* in, float* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = exp_approx(in[i]);
+                        }
+                    }
+
+                    static void log(const float* in, float* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = log_approx(in[i]);
+                        }
+                    }
+
+                    static void tanh(const float* in, float* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = tanh_approx(in[i]);
+                        }
+                    }
+
+                    static void erf(const float* in, float* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = erf_approx(in[i]);
+                        }
+                    }
+
+                    static void sigmoid(const float* in, float* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = sigmoid_approx(in[i]);
+                        }
+                    }
+
+                    static void gelu(const float* in, float* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = gelu_approx(in[i]);
+                        }
+                    }
+
+                    static void swish(const float* in, float* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = swish_approx(in[i]);
+                        }
+                    }
+
+                    // 8-bit kernels. The integer loops vectorize to the packed byte
+                    // instructions (paddb, pmaxsb, ...) of each ISA; the quantized add is done
+                    // in f32, 8 or 16 lanes at a time, and clamped before it is rounded.
+                    template <typename T>
+                    static void add_8bit(const T* a, const T* b, T* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = static_cast<T>(a[i] + b[i]);
+                        }
+                    }
+
+                    template <typename T>
+                    static void maximum_8bit(const T* a, const T* b, T* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = a[i] < b[i] ? b[i] : a[i];
+                        }
+                    }
+
+                    template <typename T>
+                    static void minimum_8bit(const T* a, const T* b, T* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = b[i] < a[i] ? b[i] : a[i];
+                        }
+                    }
+
+                    static void relu_i8(const int8_t* in, int8_t* out, size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = in[i] < 0 ? 0 : in[i];
+                        }
+                    }
+
+                    template <typename T>
+                    static void quantized_add_8bit(const T* a,
+                                                   const T* b,
+                                                   T* out,
+                                                   size_t count,
+                                                   float a_multiplier,
+                                                   float b_multiplier)
+                    {
+                        const float lowest = std::numeric_limits<T>::lowest();
+                        const float highest = std::numeric_limits<T>::max();
+                        const float round = 12582912.0f; // 1.5 * 2^23
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            float sum = static_cast<float>(a[i]) * a_multiplier +
+                                        static_cast<float>(b[i]) * b_multiplier;
+                            sum = sum < lowest ? lowest : sum;
+                            sum = highest < sum ? highest : sum;
+                            out[i] = static_cast<T>(static_cast<int32_t>((sum + round) - round));
+                        }
+                    }
+
+                    const ISAKernels& get_isa_kernels()
+                    {
+                        static const ISAKernels kernels{add,
+                                                        subtract,
+                                                        multiply,
+                                                        maximum,
+                                                        minimum,
+                                                        negative,
+                                                        relu,
+                                                        exp,
+                                                        log,
+                                                        tanh,
+                                                        erf,
+                                                        sigmoid,
+                                                        gelu,
+                                                        swish,
+                                                        reduce_sum,
+                                                        reduce_max,
+                                                        accumulate_sum,
+                                                        accumulate_max,
+                                                        softmax_rows,
+                                                        broadcast_rows,
+                                                        broadcast_cols,
+                                                        transpose,
+                                                        float32_to_bf16,
+                                                        bf16_to_float32,
+                                                        float32_to_f16,
+                                                        f16_to_float32,
+                                                        add_8bit<int8_t>,
+                                                        add_8bit<uint8_t>,
+                                                        maximum_8bit<int8_t>,
+                                                        maximum_8bit<uint8_t>,
+                                                        minimum_8bit<int8_t>,
+                                                        minimum_8bit<uint8_t>,
+                                                        relu_i8,
+                                                        quantized_add_8bit<int8_t>,
+                                                        quantized_add_8bit<uint8_t>};
+                        return kernels;
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,134 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                static const size_t LAYER_NORM_LANES = 16;
+
+                // Layer normalization of each of the `rows` contiguous rows of `cols` elements.
+                // The mean and variance of a row are computed in a single pass as sums of the
+                // values shifted by the first element of the row, which avoids most of the
+                // cancellation of E[x^2] - E[x]^2. A second pass writes the normalized row.
+                // `scale` and `bias` hold `cols` elements and may be null; `mean` and
+                // `variance` hold `rows` elements and may be null. A nonzero `Cols` fixes the
+                // row length at compile time, see SELECT_INNER_DIM.
+                template <typename ElementType, size_t Cols = 0>
+                void layer_norm(void* input,
+                                void* scale,
+                                void* bias,
+                                void* output,
+                                void* mean,
+                                void* variance,
+                                size_t rows,
+                                size_t row_length,
+                                double epsilon,
+                                int arena)
+                {
+                    const size_t cols = Cols != 0 ? Cols : row_length;
+                    auto in = static_cast<const ElementType*>(input);
+                    auto gamma = static_cast<const ElementType*>(scale);
+                    auto beta = static_cast<const ElementType*>(bias);
+                    auto out = static_cast<ElementType*>(output);
+                    auto out_mean = static_cast<ElementType*>(mean);
+                    auto out_variance = static_cast<ElementType*>(variance);
+                    auto eps = static_cast<ElementType>(epsilon);
+
+                    auto layer_norm_range = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index r = first; r < last; r++)
+                        {
+                            const ElementType* row_in = in + r * cols;
+                            ElementType* row_out = out + r * cols;
+                            ElementType shift = row_in[0];
+                            ElementType sum[LAYER_NORM_LANES] = {};
+                            ElementType sum_sq[LAYER_NORM_LANES] = {};
+                            size_t c = 0;
+                            for (; c + LAYER_NORM_LANES <= cols; c += LAYER_NORM_LANES)
+                            {
+                                for (size_t j = 0; j < LAYER_NORM_LANES; j++)
+                                {
+                                    ElementType x = row_in[c + j] - shift;
+                                    sum[j] += x;
+                                    sum_sq[j] += x * x;
+                                }
+                            }
+                            for (size_t j = 0; c < cols; c++, j++)
+                            {
+                                ElementType x = row_in[c] - shift;
+                                sum[j] += x;
+                                sum_sq[j] += x * x;
+                            }
+                            for (size_t j = 1; j < LAYER_NORM_LANES; j++)
+                            {
+                                sum[0] += sum[j];
+                                sum_sq[0] += sum_sq[j];
+                            }
+
+                            ElementType n = static_cast<ElementType>(cols);
+                            ElementType shifted_mean = sum[0] / n;
+                            ElementType var = sum_sq[0] / n - shifted_mean * shifted_mean;
+                            var = var < 0 ? 0 : var;
+                            ElementType mu = shift + shifted_mean;
+                            ElementType inv_std = 1 / std::sqrt(var + eps);
+                            if (out_mean)
+                            {
+                                out_mean[r] = mu;
+                                out_variance[r] = var;
+                            }
+
+                            if (gamma)
+                            {
+                                for (c = 0; c < cols; c++)
+                                {
+                                    row_out[c] = (row_in[c] - mu) * inv_std * gamma[c] + beta[c];
+                                }
+                            }
+                            else
+                            {
+                                for (c = 0; c < cols; c++)
+                                {
+                                    row_out[c] = (row_in[c] - mu) * inv_std;
+                                }
+                            }
+                        }
+                    };
+
+                    if (rows == 0 || cols == 0)
+                    {
+                        return;
+                    }
+                    double bytes = sizeof(ElementType) * cols;
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        rows, Eigen::TensorOpCost(2 * bytes, bytes, 6.0 * cols), layer_norm_range);
+                }
+            }
+        }
+    }
+}
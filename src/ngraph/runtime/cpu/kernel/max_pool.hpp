@@ -16,7 +16,10 @@
 
 #pragma once
 
-#include "ngraph/runtime/reference/max_pool.hpp"
+#include <cstring>
+#include <limits>
+
+#include "ngraph/runtime/cpu/kernel/pool_window.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -27,6 +30,9 @@ namespace ngraph
         {
             namespace kernel
             {
+                // Only in-bounds elements take part in the maximum. The backprop kernels route
+                // each delta to the first maximum of its window in row-major window order.
+
                 template <typename ElementType>
                 void max_pool(void* arg,
                               void* out,
@@ -35,16 +41,94 @@ namespace ngraph
                               const Shape& window_shape,
                               const Strides& window_movement_strides,
                               const Shape& padding_below,
-                              const Shape& padding_above)
+                              const Shape& padding_above,
+                              int arena)
+                {
+                    PoolGeometry geometry(arg_shape,
+                                          out_shape,
+                                          window_shape,
+                                          window_movement_strides,
+                                          padding_below,
+                                          padding_above);
+                    double bytes = sizeof(ElementType);
+                    Eigen::TensorOpCost plane_cost(
+                        geometry.out_plane_size * geometry.window_size * bytes,
+                        geometry.out_plane_size * bytes,
+                        geometry.out_plane_size * geometry.window_size);
+
+                    parallel_for_planes(
+                        geometry, plane_cost, arena, [&](PoolWindow& window, size_t plane) {
+                            auto in = static_cast<const ElementType*>(arg) +
+                                      plane * geometry.in_plane_size;
+                            auto dst =
+                                static_cast<ElementType*>(out) + plane * geometry.out_plane_size;
+                            window.for_each_output([&](size_t out_index) {
+                                ElementType result = std::numeric_limits<ElementType>::lowest();
+                                window.for_each_row([&](size_t in_offset, size_t length, size_t) {
+                                    const ElementType* row = in + in_offset;
+                                    for (size_t i = 0; i < length; i++)
+                                    {
+                                        result = row[i] > result ? row[i] : result;
+                                    }
+                                });
+                                dst[out_index] = result;
+                            });
+                        });
+                }
+
+                // Also writes, for every output element, the row-major index within its padded
+                // window of the first maximum, or -1 if the window has no in-bounds elements.
+                template <typename ElementType>
+                void max_pool_with_indices(void* arg,
+                                           void* out,
+                                           void* indices,
+                                           const Shape& arg_shape,
+                                           const Shape& out_shape,
+                                           const Shape& window_shape,
+                                           const Strides& window_movement_strides,
+                                           const Shape& padding_below,
+                                           const Shape& padding_above,
+                                           int arena)
                 {
-                    reference::max_pool<ElementType>(static_cast<const ElementType*>(arg),
-                                                     static_cast<ElementType*>(out),
-                                                     arg_shape,
-                                                     out_shape,
-                                                     window_shape,
-                                                     window_movement_strides,
-                                                     padding_below,
-                                                     padding_above);
+                    PoolGeometry geometry(arg_shape,
+                                          out_shape,
+                                          window_shape,
+                                          window_movement_strides,
+                                          padding_below,
+                                          padding_above);
+                    double bytes = sizeof(ElementType);
+                    Eigen::TensorOpCost plane_cost(
+                        geometry.out_plane_size * geometry.window_size * bytes,
+                        geometry.out_plane_size * (bytes + sizeof(int32_t)),
+                        geometry.out_plane_size * geometry.window_size);
+
+                    parallel_for_planes(
+                        geometry, plane_cost, arena, [&](PoolWindow& window, size_t plane) {
+                            auto in = static_cast<const ElementType*>(arg) +
+                                      plane * geometry.in_plane_size;
+                            auto dst =
+                                static_cast<ElementType*>(out) + plane * geometry.out_plane_size;
+                            auto dst_indices =
+                                static_cast<int32_t*>(indices) + plane * geometry.out_plane_size;
+                            window.for_each_output([&](size_t out_index) {
+                                ElementType result = std::numeric_limits<ElementType>::lowest();
+                                int32_t argmax = -1;
+                                window.for_each_row(
+                                    [&](size_t in_offset, size_t length, size_t window_index) {
+                                        const ElementType* row = in + in_offset;
+                                        for (size_t i = 0; i < length; i++)
+                                        {
+                                            if (argmax < 0 || row[i] > result)
+                                            {
+                                                result = row[i];
+                                                argmax = static_cast<int32_t>(window_index + i);
+                                            }
+                                        }
+                                    });
+                                dst[out_index] = result;
+                                dst_indices[out_index] = argmax;
+                            });
+                        });
                 }
 
                 template <typename ElementType>
@@ -56,18 +140,93 @@ namespace ngraph
                                        const Shape& window_shape,
                                        const Strides& window_movement_strides,
                                        const Shape& padding_below,
-                                       const Shape& padding_above)
+                                       const Shape& padding_above,
+                                       int arena)
                 {
-                    reference::max_pool_backprop<ElementType>(
-                        static_cast<const ElementType*>(arg_forward),
-                        static_cast<const ElementType*>(delta),
-                        static_cast<ElementType*>(out),
-                        delta_shape,
-                        out_shape,
-                        window_shape,
-                        window_movement_strides,
-                        padding_below,
-                        padding_above);
+                    PoolGeometry geometry(out_shape,
+                                          delta_shape,
+                                          window_shape,
+                                          window_movement_strides,
+                                          padding_below,
+                                          padding_above);
+                    double bytes = sizeof(ElementType);
+                    Eigen::TensorOpCost plane_cost(
+                        geometry.out_plane_size * (geometry.window_size + 1) * bytes,
+                        (geometry.in_plane_size + geometry.out_plane_size) * bytes,
+                        geometry.out_plane_size * geometry.window_size);
+
+                    parallel_for_planes(
+                        geometry, plane_cost, arena, [&](PoolWindow& window, size_t plane) {
+                            auto fwd = static_cast<const ElementType*>(arg_forward) +
+                                       plane * geometry.in_plane_size;
+                            auto d = static_cast<const ElementType*>(delta) +
+                                     plane * geometry.out_plane_size;
+                            auto dst =
+                                static_cast<ElementType*>(out) + plane * geometry.in_plane_size;
+                            std::memset(dst, 0, geometry.in_plane_size * sizeof(ElementType));
+                            window.for_each_output([&](size_t out_index) {
+                                ElementType result = 0;
+                                const ElementType* argmax = nullptr;
+                                window.for_each_row([&](size_t in_offset, size_t length, size_t) {
+                                    const ElementType* row = fwd + in_offset;
+                                    for (size_t i = 0; i < length; i++)
+                                    {
+                                        if (!argmax || row[i] > result)
+                                        {
+                                            result = row[i];
+                                            argmax = row + i;
+                                        }
+                                    }
+                                });
+                                if (argmax)
+                                {
+                                    dst[argmax - fwd] += d[out_index];
+                                }
+                            });
+                        });
+                }
+
+                template <typename ElementType>
+                void max_pool_with_indices_backprop(void* delta,
+                                                    void* indices,
+                                                    void* out,
+                                                    const Shape& delta_shape,
+                                                    const Shape& out_shape,
+                                                    const Shape& window_shape,
+                                                    const Strides& window_movement_strides,
+                                                    const Shape& padding_below,
+                                                    const Shape& padding_above,
+                                                    int arena)
+                {
+                    PoolGeometry geometry(out_shape,
+                                          delta_shape,
+                                          window_shape,
+                                          window_movement_strides,
+                                          padding_below,
+                                          padding_above);
+                    double bytes = sizeof(ElementType);
+                    Eigen::TensorOpCost plane_cost(
+                        geometry.out_plane_size * (bytes + sizeof(int32_t)),
+                        (geometry.in_plane_size + geometry.out_plane_size) * bytes,
+                        geometry.out_plane_size * geometry.rank);
+
+                    parallel_for_planes(
+                        geometry, plane_cost, arena, [&](PoolWindow& window, size_t plane) {
+                            auto d = static_cast<const ElementType*>(delta) +
+                                     plane * geometry.out_plane_size;
+                            auto src_indices = static_cast<const int32_t*>(indices) +
+                                               plane * geometry.out_plane_size;
+                            auto dst =
+                                static_cast<ElementType*>(out) + plane * geometry.in_plane_size;
+                            std::memset(dst, 0, geometry.in_plane_size * sizeof(ElementType));
+                            window.for_each_output([&](size_t out_index) {
+                                int32_t argmax = src_indices[out_index];
+                                if (argmax >= 0)
+                                {
+                                    dst[window.input_offset(argmax)] += d[out_index];
+                                }
+                            });
+                        });
                 }
             }
         }
@@ -46,6 +46,17 @@ namespace ngraph
                     out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
                         in0.cwiseMax(in1);
                 }
+
+                // Dispatched to the kernels for the selected ISA, see isa.cpp
+                template <>
+                void maximum<float>(
+                    void* input0, void* input1, void* output, size_t count, int arena);
+                template <>
+                void maximum<int8_t>(
+                    void* input0, void* input1, void* output, size_t count, int arena);
+                template <>
+                void maximum<uint8_t>(
+                    void* input0, void* input1, void* output, size_t count, int arena);
             }
         }
     }
@@ -46,6 +46,17 @@ namespace ngraph
                     out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
                         in0.cwiseMin(in1);
                 }
+
+                // Dispatched to the kernels for the selected ISA, see isa.cpp
+                template <>
+                void minimum<float>(
+                    void* input0, void* input1, void* output, size_t count, int arena);
+                template <>
+                void minimum<int8_t>(
+                    void* input0, void* input1, void* output, size_t count, int arena);
+                template <>
+                void minimum<uint8_t>(
+                    void* input0, void* input1, void* output, size_t count, int arena);
             }
         }
     }
@@ -46,6 +46,11 @@ namespace ngraph
                     out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
                         in0 * in1;
                 }
+
+                // Dispatched to the kernels for the selected ISA, see isa.cpp
+                template <>
+                void multiply<float>(
+                    void* input0, void* input1, void* output, size_t count, int arena);
             }
         }
     }
@@ -0,0 +1,231 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                template <typename T>
+                struct NMSBox
+                {
+                    T y1;
+                    T x1;
+                    T y2;
+                    T x2;
+                    T area;
+                };
+
+                template <typename T>
+                struct NMSCandidate
+                {
+                    T score;
+                    int64_t box;
+
+                    bool operator<(const NMSCandidate& other) const
+                    {
+                        // Higher scores first, then lower box indices
+                        return score < other.score || (!(other.score < score) && box > other.box);
+                    }
+                };
+
+                template <typename T>
+                struct NMSSelection
+                {
+                    T score;
+                    int64_t batch;
+                    int64_t cls;
+                    int64_t box;
+                };
+
+                template <typename T>
+                NMSBox<T> make_nms_box(const T* coords, bool center_encoding)
+                {
+                    NMSBox<T> box;
+                    if (center_encoding)
+                    {
+                        // [x_center, y_center, width, height]
+                        box.x1 = coords[0] - coords[2] / 2;
+                        box.x2 = coords[0] + coords[2] / 2;
+                        box.y1 = coords[1] - coords[3] / 2;
+                        box.y2 = coords[1] + coords[3] / 2;
+                    }
+                    else
+                    {
+                        // [y1, x1, y2, x2], with either pair of corners
+                        box.y1 = std::min(coords[0], coords[2]);
+                        box.y2 = std::max(coords[0], coords[2]);
+                        box.x1 = std::min(coords[1], coords[3]);
+                        box.x2 = std::max(coords[1], coords[3]);
+                    }
+                    box.area = (box.y2 - box.y1) * (box.x2 - box.x1);
+                    return box;
+                }
+
+                template <typename T>
+                T nms_iou(const NMSBox<T>& a, const NMSBox<T>& b)
+                {
+                    T height = std::min(a.y2, b.y2) - std::max(a.y1, b.y1);
+                    T width = std::min(a.x2, b.x2) - std::max(a.x1, b.x1);
+                    if (height <= 0 || width <= 0)
+                    {
+                        return 0;
+                    }
+                    T intersection = height * width;
+                    T union_area = a.area + b.area - intersection;
+                    return union_area > 0 ? intersection / union_area : 0;
+                }
+
+                // Greedy non-maximum suppression with boxes [B, N, 4] and scores [B, C, N]. Every
+                // (batch, class) pair is processed in parallel. Boxes whose score does not exceed
+                // score_threshold are dropped up front, and the remaining candidates are kept in
+                // a heap so that only the boxes actually examined are ordered. A candidate is
+                // rejected as soon as it overlaps one selected box by more than iou_threshold,
+                // and a class stops once max_output_boxes_per_class boxes are selected.
+                //
+                // The output holds out_shape[0] [batch, class, box] triplets. They are ordered by
+                // score if sort_result_descending is set, and otherwise by batch and class.
+                // Unused rows are filled with -1.
+                template <typename T>
+                void non_max_suppression(const T* boxes,
+                                         const T* scores,
+                                         int64_t* output,
+                                         const Shape& boxes_shape,
+                                         const Shape& scores_shape,
+                                         const Shape& out_shape,
+                                         int64_t max_output_boxes_per_class,
+                                         T iou_threshold,
+                                         T score_threshold,
+                                         bool center_encoding,
+                                         bool sort_result_descending,
+                                         int arena)
+                {
+                    size_t batches = boxes_shape[0];
+                    size_t num_boxes = boxes_shape[1];
+                    size_t classes = scores_shape[1];
+                    size_t max_boxes =
+                        max_output_boxes_per_class > 0
+                            ? std::min(static_cast<size_t>(max_output_boxes_per_class), num_boxes)
+                            : 0;
+
+                    std::vector<std::vector<NMSSelection<T>>> selected(batches * classes);
+                    if (max_boxes > 0)
+                    {
+                        executor::GetCPUExecutor().get_device(arena).parallelFor(
+                            batches * classes,
+                            Eigen::TensorOpCost(num_boxes * sizeof(T) * 5, 0, num_boxes * 8.0),
+                            [&](Eigen::Index first, Eigen::Index last) {
+                                std::vector<NMSCandidate<T>> candidates;
+                                std::vector<NMSBox<T>> kept;
+                                for (Eigen::Index pair = first; pair < last; pair++)
+                                {
+                                    size_t batch = pair / classes;
+                                    size_t cls = pair % classes;
+                                    const T* class_scores =
+                                        scores + (batch * classes + cls) * num_boxes;
+                                    const T* batch_boxes = boxes + batch * num_boxes * 4;
+
+                                    candidates.clear();
+                                    for (size_t i = 0; i < num_boxes; i++)
+                                    {
+                                        if (class_scores[i] > score_threshold)
+                                        {
+                                            candidates.push_back(NMSCandidate<T>{
+                                                class_scores[i], static_cast<int64_t>(i)});
+                                        }
+                                    }
+                                    std::make_heap(candidates.begin(), candidates.end());
+
+                                    kept.clear();
+                                    while (!candidates.empty() && kept.size() < max_boxes)
+                                    {
+                                        std::pop_heap(candidates.begin(), candidates.end());
+                                        NMSCandidate<T> candidate = candidates.back();
+                                        candidates.pop_back();
+
+                                        NMSBox<T> box = make_nms_box(
+                                            batch_boxes + candidate.box * 4, center_encoding);
+                                        bool suppressed = false;
+                                        for (const NMSBox<T>& other : kept)
+                                        {
+                                            if (nms_iou(box, other) > iou_threshold)
+                                            {
+                                                suppressed = true;
+                                                break;
+                                            }
+                                        }
+                                        if (!suppressed)
+                                        {
+                                            kept.push_back(box);
+                                            selected[pair].push_back(
+                                                NMSSelection<T>{candidate.score,
+                                                                static_cast<int64_t>(batch),
+                                                                static_cast<int64_t>(cls),
+                                                                candidate.box});
+                                        }
+                                    }
+                                }
+                            });
+                    }
+
+                    std::vector<NMSSelection<T>> results;
+                    for (auto& pair_selected : selected)
+                    {
+                        results.insert(results.end(), pair_selected.begin(), pair_selected.end());
+                    }
+                    if (sort_result_descending)
+                    {
+                        std::stable_sort(results.begin(),
+                                         results.end(),
+                                         [](const NMSSelection<T>& a, const NMSSelection<T>& b) {
+                                             return a.score > b.score;
+                                         });
+                    }
+
+                    size_t rows = out_shape[0];
+                    for (size_t i = 0; i < rows; i++)
+                    {
+                        if (i < results.size())
+                        {
+                            output[i * 3] = results[i].batch;
+                            output[i * 3 + 1] = results[i].cls;
+                            output[i * 3 + 2] = results[i].box;
+                        }
+                        else
+                        {
+                            output[i * 3] = output[i * 3 + 1] = output[i * 3 + 2] = -1;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,255 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_axes.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                enum class NormalizeMode
+                {
+                    // x - mean
+                    MEAN,
+                    // (x - mean) / (sqrt(variance) + eps), as MVN
+                    MEAN_STDDEV,
+                    // x / sqrt(sum(x^2) + eps), as NormalizeL2 and GRN
+                    L2_ADD,
+                    // x / sqrt(max(sum(x^2), eps)), as NormalizeL2
+                    L2_MAX
+                };
+
+                // Offset and divisor of one group of `count` elements from the sums of the
+                // elements and of their squares, shifted by `shift`
+                template <typename ElementType>
+                void normalize_factors(NormalizeMode mode,
+                                       ElementType eps,
+                                       size_t count,
+                                       ElementType shift,
+                                       ElementType sum,
+                                       ElementType sum_sq,
+                                       ElementType& offset,
+                                       ElementType& divisor)
+                {
+                    ElementType n = static_cast<ElementType>(count);
+                    switch (mode)
+                    {
+                    case NormalizeMode::MEAN:
+                        offset = shift + sum / n;
+                        divisor = ElementType(1);
+                        break;
+                    case NormalizeMode::MEAN_STDDEV:
+                    {
+                        ElementType mean = sum / n;
+                        ElementType variance = std::max(sum_sq / n - mean * mean, ElementType(0));
+                        offset = shift + mean;
+                        divisor = std::sqrt(variance) + eps;
+                        break;
+                    }
+                    case NormalizeMode::L2_ADD:
+                        offset = ElementType(0);
+                        divisor = std::sqrt(sum_sq + eps);
+                        break;
+                    case NormalizeMode::L2_MAX:
+                        offset = ElementType(0);
+                        divisor = std::sqrt(std::max(sum_sq, eps));
+                        break;
+                    }
+                }
+
+                // Normalizes each group of elements that a reduction over the axes of `plan`
+                // would combine, writing an output of the input's shape. A group's sums are
+                // accumulated in one pass, shifted by its first element when the mean is
+                // subtracted, and a second pass writes the group. As in reduce_axes, when the
+                // innermost axes are kept the groups of a block of contiguous elements are
+                // processed together, one input row at a time.
+                template <typename ElementType>
+                void normalize_axes(void* input,
+                                    void* output,
+                                    const ReductionPlan& plan,
+                                    NormalizeMode mode,
+                                    double epsilon,
+                                    int arena)
+                {
+                    auto in = static_cast<const ElementType*>(input);
+                    auto out = static_cast<ElementType*>(output);
+                    const size_t inner = plan.inner;
+                    const bool centered =
+                        mode == NormalizeMode::MEAN || mode == NormalizeMode::MEAN_STDDEV;
+                    const auto eps = static_cast<ElementType>(epsilon);
+
+                    if (plan.rows == 0 || plan.reduced_count == 0 || inner == 0)
+                    {
+                        return;
+                    }
+
+                    auto& device = executor::GetCPUExecutor().get_device(arena);
+                    if (plan.inner_reduced)
+                    {
+                        const size_t count = inner * plan.reduced_count;
+                        auto normalize_rows = [&](Eigen::Index first, Eigen::Index last) {
+                            std::vector<size_t> coord(plan.reduced_dims.size(), 0);
+                            for (Eigen::Index r = first; r < last; r++)
+                            {
+                                size_t row_offset = plan.row_offset(r);
+                                const ElementType* row_in = in + row_offset;
+                                ElementType* row_out = out + row_offset;
+                                ElementType shift = centered ? row_in[0] : ElementType(0);
+                                ElementType sum[REDUCE_AXES_LANES] = {};
+                                ElementType sum_sq[REDUCE_AXES_LANES] = {};
+                                size_t offset = 0;
+                                for (size_t k = 0; k < plan.reduced_count; k++)
+                                {
+                                    const ElementType* run = row_in + offset;
+                                    size_t c = 0;
+                                    for (; c + REDUCE_AXES_LANES <= inner; c += REDUCE_AXES_LANES)
+                                    {
+                                        for (size_t j = 0; j < REDUCE_AXES_LANES; j++)
+                                        {
+                                            ElementType x = run[c + j] - shift;
+                                            sum[j] += x;
+                                            sum_sq[j] += x * x;
+                                        }
+                                    }
+                                    for (size_t j = 0; c < inner; c++, j++)
+                                    {
+                                        ElementType x = run[c] - shift;
+                                        sum[j] += x;
+                                        sum_sq[j] += x * x;
+                                    }
+                                    next_reduced_position(plan, coord, offset);
+                                }
+                                for (size_t j = 1; j < REDUCE_AXES_LANES; j++)
+                                {
+                                    sum[0] += sum[j];
+                                    sum_sq[0] += sum_sq[j];
+                                }
+
+                                ElementType group_offset, divisor;
+                                normalize_factors(mode,
+                                                  eps,
+                                                  count,
+                                                  shift,
+                                                  sum[0],
+                                                  sum_sq[0],
+                                                  group_offset,
+                                                  divisor);
+                                offset = 0;
+                                for (size_t k = 0; k < plan.reduced_count; k++)
+                                {
+                                    const ElementType* run = row_in + offset;
+                                    ElementType* run_out = row_out + offset;
+                                    for (size_t c = 0; c < inner; c++)
+                                    {
+                                        run_out[c] = (run[c] - group_offset) / divisor;
+                                    }
+                                    next_reduced_position(plan, coord, offset);
+                                }
+                            }
+                        };
+                        double elements = static_cast<double>(count);
+                        device.parallelFor(plan.rows,
+                                           Eigen::TensorOpCost(2 * sizeof(ElementType) * elements,
+                                                               sizeof(ElementType) * elements,
+                                                               4 * elements),
+                                           normalize_rows);
+                    }
+                    else
+                    {
+                        const size_t blocks = (inner + REDUCE_AXES_BLOCK - 1) / REDUCE_AXES_BLOCK;
+                        auto normalize_blocks = [&](Eigen::Index first, Eigen::Index last) {
+                            std::vector<size_t> coord(plan.reduced_dims.size(), 0);
+                            std::vector<ElementType> shift(REDUCE_AXES_BLOCK);
+                            std::vector<ElementType> sum(REDUCE_AXES_BLOCK);
+                            std::vector<ElementType> sum_sq(REDUCE_AXES_BLOCK);
+                            for (Eigen::Index t = first; t < last; t++)
+                            {
+                                size_t r = t / blocks;
+                                size_t begin = (t % blocks) * REDUCE_AXES_BLOCK;
+                                size_t length = std::min(REDUCE_AXES_BLOCK, inner - begin);
+                                size_t block_offset = plan.row_offset(r) + begin;
+                                const ElementType* block_in = in + block_offset;
+                                ElementType* block_out = out + block_offset;
+                                for (size_t c = 0; c < length; c++)
+                                {
+                                    shift[c] = centered ? block_in[c] : ElementType(0);
+                                }
+                                std::fill(sum.begin(), sum.begin() + length, ElementType(0));
+                                std::fill(sum_sq.begin(), sum_sq.begin() + length, ElementType(0));
+                                size_t offset = 0;
+                                for (size_t k = 0; k < plan.reduced_count; k++)
+                                {
+                                    const ElementType* run = block_in + offset;
+                                    for (size_t c = 0; c < length; c++)
+                                    {
+                                        ElementType x = run[c] - shift[c];
+                                        sum[c] += x;
+                                        sum_sq[c] += x * x;
+                                    }
+                                    next_reduced_position(plan, coord, offset);
+                                }
+
+                                // Reuse the sums for the offset and divisor of each group
+                                for (size_t c = 0; c < length; c++)
+                                {
+                                    normalize_factors(mode,
+                                                      eps,
+                                                      plan.reduced_count,
+                                                      shift[c],
+                                                      sum[c],
+                                                      sum_sq[c],
+                                                      sum[c],
+                                                      sum_sq[c]);
+                                }
+                                for (size_t k = 0; k < plan.reduced_count; k++)
+                                {
+                                    const ElementType* run = block_in + offset;
+                                    ElementType* run_out = block_out + offset;
+                                    for (size_t c = 0; c < length; c++)
+                                    {
+                                        run_out[c] = (run[c] - sum[c]) / sum_sq[c];
+                                    }
+                                    next_reduced_position(plan, coord, offset);
+                                }
+                            }
+                        };
+                        double length = static_cast<double>(std::min(inner, REDUCE_AXES_BLOCK));
+                        double elements = length * plan.reduced_count;
+                        device.parallelFor(plan.rows * blocks,
+                                           Eigen::TensorOpCost(2 * sizeof(ElementType) * elements,
+                                                               sizeof(ElementType) * elements,
+                                                               4 * elements),
+                                           normalize_blocks);
+                    }
+                }
+            }
+        }
+    }
+}
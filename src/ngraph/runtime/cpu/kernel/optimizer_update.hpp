@@ -0,0 +1,142 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Each output element is computed from the input elements at the same index,
+                // and every input element is read before the output element at its index is
+                // written, so outputs may alias the matching inputs. The element range is split
+                // across the arena's threads.
+
+                template <typename ElementType>
+                void sgd_momentum_update(void* param,
+                                         void* grad,
+                                         void* velocity,
+                                         void* learning_rate,
+                                         void* param_out,
+                                         void* velocity_out,
+                                         size_t count,
+                                         double momentum,
+                                         bool nesterov,
+                                         int arena)
+                {
+                    auto p = static_cast<const ElementType*>(param);
+                    auto g = static_cast<const ElementType*>(grad);
+                    auto v = static_cast<const ElementType*>(velocity);
+                    auto p_out = static_cast<ElementType*>(param_out);
+                    auto v_out = static_cast<ElementType*>(velocity_out);
+                    auto lr = *static_cast<const ElementType*>(learning_rate);
+                    auto mu = static_cast<ElementType>(momentum);
+
+                    auto update_range = [&](Eigen::Index first, Eigen::Index last) {
+                        if (nesterov)
+                        {
+                            for (Eigen::Index i = first; i < last; i++)
+                            {
+                                ElementType new_v = mu * v[i] + g[i];
+                                ElementType step = g[i] + mu * new_v;
+                                p_out[i] = p[i] - lr * step;
+                                v_out[i] = new_v;
+                            }
+                        }
+                        else
+                        {
+                            for (Eigen::Index i = first; i < last; i++)
+                            {
+                                ElementType new_v = mu * v[i] + g[i];
+                                p_out[i] = p[i] - lr * new_v;
+                                v_out[i] = new_v;
+                            }
+                        }
+                    };
+
+                    if (count == 0)
+                    {
+                        return;
+                    }
+                    double bytes = sizeof(ElementType);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        count, Eigen::TensorOpCost(3 * bytes, 2 * bytes, 4.0), update_range);
+                }
+
+                template <typename ElementType>
+                void adam_update(void* param,
+                                 void* grad,
+                                 void* m,
+                                 void* v,
+                                 void* learning_rate,
+                                 void* param_out,
+                                 void* m_out,
+                                 void* v_out,
+                                 size_t count,
+                                 double beta1,
+                                 double beta2,
+                                 double epsilon,
+                                 int arena)
+                {
+                    auto p = static_cast<const ElementType*>(param);
+                    auto g = static_cast<const ElementType*>(grad);
+                    auto m_in = static_cast<const ElementType*>(m);
+                    auto v_in = static_cast<const ElementType*>(v);
+                    auto p_dst = static_cast<ElementType*>(param_out);
+                    auto m_dst = static_cast<ElementType*>(m_out);
+                    auto v_dst = static_cast<ElementType*>(v_out);
+                    auto lr = *static_cast<const ElementType*>(learning_rate);
+                    auto b1 = static_cast<ElementType>(beta1);
+                    auto b2 = static_cast<ElementType>(beta2);
+                    auto one_minus_b1 = static_cast<ElementType>(1 - beta1);
+                    auto one_minus_b2 = static_cast<ElementType>(1 - beta2);
+                    auto eps = static_cast<ElementType>(epsilon);
+
+                    auto update_range = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+                            ElementType grad_i = g[i];
+                            ElementType new_m = b1 * m_in[i] + one_minus_b1 * grad_i;
+                            ElementType new_v = b2 * v_in[i] + one_minus_b2 * grad_i * grad_i;
+                            p_dst[i] = p[i] - lr * new_m / (std::sqrt(new_v) + eps);
+                            m_dst[i] = new_m;
+                            v_dst[i] = new_v;
+                        }
+                    };
+
+                    if (count == 0)
+                    {
+                        return;
+                    }
+                    double bytes = sizeof(ElementType);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        count, Eigen::TensorOpCost(4 * bytes, 3 * bytes, 12.0), update_range);
+                }
+            }
+        }
+    }
+}
@@ -20,6 +20,8 @@
 #include <unsupported/Eigen/CXX11/Tensor>
 
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/kernel/parallel_for.hpp"
+#include "ngraph/runtime/opt_kernel/pad.hpp"
 #include "ngraph/runtime/reference/pad.hpp"
 #include "ngraph/shape.hpp"
 
@@ -59,6 +61,27 @@ namespace ngraph
                         in.pad(padding, *static_cast<ElementType*>(pad_value));
                 }
 
+                /// \brief Constant padding of any rank as block fills and copies
+                template <typename ElementType>
+                void pad_constant(void* input,
+                                  void* output,
+                                  void* pad_value,
+                                  const Shape& input_shape,
+                                  const Shape& output_shape,
+                                  const CoordinateDiff& padding_below,
+                                  const CoordinateDiff& padding_above,
+                                  int arena)
+                {
+                    opt_kernel::pad(static_cast<const ElementType*>(input),
+                                    static_cast<const ElementType*>(pad_value),
+                                    static_cast<ElementType*>(output),
+                                    input_shape,
+                                    output_shape,
+                                    padding_below,
+                                    padding_above,
+                                    parallel_for_on(arena, sizeof(ElementType)));
+                }
+
                 template <typename ElementType, unsigned int Rank>
                 void pad_and_slice(void* input,
                                    void* output,
@@ -70,8 +93,20 @@ namespace ngraph
                                    const ngraph::op::PadMode pad_mode,
                                    int arena)
                 {
+                    if (pad_mode == ngraph::op::PadMode::CONSTANT)
+                    {
+                        pad_constant<ElementType>(input,
+                                                  output,
+                                                  pad_value,
+                                                  input_shape,
+                                                  output_shape,
+                                                  padding_below,
+                                                  padding_above,
+                                                  arena);
+                        return;
+                    }
+
                     Eigen::array<Eigen::Index, Rank> out_dims, in_dims, temp_dims;
-                    Eigen::array<Eigen::IndexPair<size_t>, Rank> padding;
                     Eigen::array<Eigen::Index, Rank> indices;
 
                     bool has_negative_below_padding = false;
@@ -82,12 +117,6 @@ namespace ngraph
                         temp_dims[i] = output_shape[i];
                         in_dims[i] = input_shape[i];
 
-                        padding[i] = {
-                            padding_below[i] >= 0 ? static_cast<unsigned long int>(padding_below[i])
-                                                  : 0,
-                            padding_above[i] >= 0 ? static_cast<unsigned long int>(padding_above[i])
-                                                  : 0};
-
                         if (padding_below[i] < 0)
                         {
                             NGRAPH_CHECK(padding_below[i] > INT_MIN);
@@ -108,87 +137,78 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(
                         static_cast<ElementType*>(input), in_dims);
 
-                    if (pad_mode == ngraph::op::PadMode::CONSTANT)
-                    {
-                        out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(
-                            arena)) = in.pad(padding, *static_cast<ElementType*>(pad_value))
-                                          .slice(indices, out_dims);
-                    }
-                    else
-                    {
-                        // clang-format off
-                        // PadMode::REFLECT
-                        // We should have dim >= 2 for each dim.
-                        // Example:
-                        //
-                        // Input shape:     [4]
-                        // Padding:         6 below, 13 above
-                        // Output shape:    [23]
-                        //
-                        // Input:                       1 2 3 4
-                        // Expected output: 1 2 3 4 3 2 1 2 3 4 3 2 1 2 3 4 3 2 1 2 3 4 3
-                        // Pattern: ... | original n elements | middle (n - 2) elements of original n in reverse order |
-                        //                original n elements | middle (n - 2) elements of original n in reverse order | ...
-                        //              | 1 2 3 4 | 3 2 | 1 2 3 4 | 3 2 | 1 2 3 4 | 3 2 | 1 2 3 4 | 3
-                        // clang-format on
-                        auto generator =
-                            [&](const Eigen::array<Eigen::DenseIndex, Rank>& out_index) {
-                                Eigen::array<Eigen::DenseIndex, Rank> in_index;
-                                for (size_t i = 0; i < Rank; i++)
+                    // clang-format off
+                    // PadMode::REFLECT
+                    // We should have dim >= 2 for each dim.
+                    // Example:
+                    //
+                    // Input shape:     [4]
+                    // Padding:         6 below, 13 above
+                    // Output shape:    [23]
+                    //
+                    // Input:                       1 2 3 4
+                    // Expected output: 1 2 3 4 3 2 1 2 3 4 3 2 1 2 3 4 3 2 1 2 3 4 3
+                    // Pattern: ... | original n elements | middle (n - 2) elements of original n in reverse order |
+                    //                original n elements | middle (n - 2) elements of original n in reverse order | ...
+                    //              | 1 2 3 4 | 3 2 | 1 2 3 4 | 3 2 | 1 2 3 4 | 3 2 | 1 2 3 4 | 3
+                    // clang-format on
+                    auto generator =
+                        [&](const Eigen::array<Eigen::DenseIndex, Rank>& out_index) {
+                            Eigen::array<Eigen::DenseIndex, Rank> in_index;
+                            for (size_t i = 0; i < Rank; i++)
+                            {
+                                auto origin_length = in_dims[i];
+                                auto p_below = padding_below[i] >= 0 ? padding_below[i] : 0;
+                                if (out_index[i] < p_below)
                                 {
-                                    auto origin_length = in_dims[i];
-                                    auto p_below = padding_below[i] >= 0 ? padding_below[i] : 0;
-                                    if (out_index[i] < p_below)
+                                    // padding below
+                                    auto reverse = p_below - out_index[i];
+                                    auto res = reverse % (origin_length * 2 - 2);
+                                    if (res <= origin_length - 2)
+                                    {
+                                        // copy one of the middle n-2 items
+                                        in_index[i] = res;
+                                    }
+                                    else
                                     {
-                                        // padding below
-                                        auto reverse = p_below - out_index[i];
-                                        auto res = reverse % (origin_length * 2 - 2);
-                                        if (res <= origin_length - 2)
-                                        {
-                                            // copy one of the middle n-2 items
-                                            in_index[i] = res;
-                                        }
-                                        else
-                                        {
-                                            // copy one of the n items
-                                            in_index[i] = origin_length * 2 - 2 - res;
-                                        }
+                                        // copy one of the n items
+                                        in_index[i] = origin_length * 2 - 2 - res;
                                     }
-                                    else if (out_index[i] < in_dims[i] + p_below)
+                                }
+                                else if (out_index[i] < in_dims[i] + p_below)
+                                {
+                                    // original
+                                    in_index[i] = out_index[i] - p_below;
+                                }
+                                else
+                                {
+                                    // padding above
+                                    auto pos = out_index[i] - in_dims[i] - p_below;
+                                    auto res = pos % (origin_length * 2 - 2);
+                                    if (res < origin_length - 2)
                                     {
-                                        // original
-                                        in_index[i] = out_index[i] - p_below;
+                                        // copy one of the middle n-2 items
+                                        in_index[i] = origin_length - 2 - res;
                                     }
                                     else
                                     {
-                                        // padding above
-                                        auto pos = out_index[i] - in_dims[i] - p_below;
-                                        auto res = pos % (origin_length * 2 - 2);
-                                        if (res < origin_length - 2)
-                                        {
-                                            // copy one of the middle n-2 items
-                                            in_index[i] = origin_length - 2 - res;
-                                        }
-                                        else
-                                        {
-                                            // copy one of the n items
-                                            in_index[i] = res - (origin_length - 2);
-                                        }
+                                        // copy one of the n items
+                                        in_index[i] = res - (origin_length - 2);
                                     }
                                 }
-                                return in(in_index);
-                            };
+                            }
+                            return in(in_index);
+                        };
 
-                        if (has_negative_below_padding)
-                        {
-                            out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(
-                                arena)) = temp.generate(generator).slice(indices, out_dims);
-                        }
-                        else
-                        {
-                            out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(
-                                arena)) = out.generate(generator);
-                        }
+                    if (has_negative_below_padding)
+                    {
+                        out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(
+                            arena)) = temp.generate(generator).slice(indices, out_dims);
+                    }
+                    else
+                    {
+                        out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(
+                            arena)) = out.generate(generator);
                     }
                 }
 
@@ -0,0 +1,52 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/opt_kernel/parallel_copy.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief opt_kernel::parallel_for_t over the CPU executor of `arena`, for
+                ///        copies of elements of `element_size` bytes.
+                inline opt_kernel::parallel_for_t parallel_for_on(int arena, size_t element_size)
+                {
+                    return [arena, element_size](size_t count,
+                                                 size_t work_per_item,
+                                                 const std::function<void(size_t, size_t)>& f) {
+                        size_t bytes = work_per_item * element_size;
+                        executor::GetCPUExecutor().get_device(arena).parallelFor(
+                            count,
+                            Eigen::TensorOpCost(bytes, bytes, 0),
+                            [&f](Eigen::Index first, Eigen::Index last) { f(first, last); });
+                    };
+                }
+            }
+        }
+    }
+}
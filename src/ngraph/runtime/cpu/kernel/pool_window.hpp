@@ -0,0 +1,254 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Pooling kernels operate on dense row-major tensors of shape
+                // (N, C, d_1, ..., d_n). Every (n, c) plane is pooled independently, so planes are
+                // split across the arena's threads and each thread walks the windows of its planes
+                // one contiguous innermost row at a time.
+
+                struct PoolGeometry
+                {
+                    PoolGeometry(const Shape& in_shape,
+                                 const Shape& out_shape,
+                                 const Shape& window_shape,
+                                 const Strides& window_movement_strides,
+                                 const Shape& padding_below,
+                                 const Shape& padding_above)
+                        : planes(in_shape[0] * in_shape[1])
+                        , in_plane_size(shape_size(in_shape) / std::max<size_t>(planes, 1))
+                        , out_plane_size(shape_size(out_shape) / std::max<size_t>(planes, 1))
+                        , rank(in_shape.size() - 2)
+                        , in_dims(in_shape.begin() + 2, in_shape.end())
+                        , out_dims(out_shape.begin() + 2, out_shape.end())
+                        , window(window_shape)
+                        , strides(window_movement_strides)
+                        , pad_below(padding_below)
+                        , padded_dims(rank)
+                        , in_strides(rank)
+                        , window_strides(rank)
+                        , window_size(shape_size(window_shape))
+                    {
+                        size_t in_stride = 1;
+                        size_t window_stride = 1;
+                        for (size_t d = rank; d-- > 0;)
+                        {
+                            padded_dims[d] = padding_below[d] + in_dims[d] + padding_above[d];
+                            in_strides[d] = in_stride;
+                            window_strides[d] = window_stride;
+                            in_stride *= in_dims[d];
+                            window_stride *= window[d];
+                        }
+                    }
+
+                    size_t planes;
+                    size_t in_plane_size;
+                    size_t out_plane_size;
+                    size_t rank;
+                    Shape in_dims;
+                    Shape out_dims;
+                    Shape window;
+                    Strides strides;
+                    Shape pad_below;
+                    Shape padded_dims;
+                    std::vector<size_t> in_strides;
+                    std::vector<size_t> window_strides;
+                    size_t window_size;
+                };
+
+                // Window of one output point within a plane. The coordinate buffers are reused
+                // from point to point so that walking a plane does not allocate.
+                class PoolWindow
+                {
+                public:
+                    PoolWindow(const PoolGeometry& geometry)
+                        : m_g(geometry)
+                        , m_out_coord(geometry.rank)
+                        , m_start(geometry.rank)
+                        , m_lo(geometry.rank)
+                        , m_hi(geometry.rank)
+                        , m_pos(geometry.rank)
+                    {
+                    }
+
+                    // Calls f(out_index) for every output point of a plane in row-major order,
+                    // with the window positioned over that point.
+                    template <typename F>
+                    void for_each_output(F f)
+                    {
+                        if (m_g.out_plane_size == 0)
+                        {
+                            return;
+                        }
+                        std::fill(m_out_coord.begin(), m_out_coord.end(), 0);
+                        for (size_t out_index = 0;; out_index++)
+                        {
+                            position();
+                            f(out_index);
+
+                            size_t d = m_g.rank;
+                            while (true)
+                            {
+                                if (d == 0)
+                                {
+                                    return;
+                                }
+                                --d;
+                                if (++m_out_coord[d] < m_g.out_dims[d])
+                                {
+                                    break;
+                                }
+                                m_out_coord[d] = 0;
+                            }
+                        }
+                    }
+
+                    // Calls f(in_offset, length, window_index) for every run of in-bounds
+                    // elements along the innermost axis, in row-major window order. in_offset is
+                    // the run's offset within the input plane and window_index is the row-major
+                    // index of its first element within the padded window.
+                    template <typename F>
+                    void for_each_row(F f)
+                    {
+                        if (m_valid_count == 0)
+                        {
+                            return;
+                        }
+                        size_t last = m_g.rank - 1;
+                        size_t length = m_hi[last] - m_lo[last];
+                        std::copy(m_lo.begin(), m_lo.end(), m_pos.begin());
+                        while (true)
+                        {
+                            size_t in_offset = 0;
+                            size_t window_index = 0;
+                            for (size_t d = 0; d < m_g.rank; d++)
+                            {
+                                in_offset += m_pos[d] * m_g.in_strides[d];
+                                size_t w = m_pos[d] + m_g.pad_below[d] - m_start[d];
+                                window_index += w * m_g.window_strides[d];
+                            }
+                            f(in_offset, length, window_index);
+
+                            size_t d = last;
+                            while (true)
+                            {
+                                if (d == 0)
+                                {
+                                    return;
+                                }
+                                --d;
+                                if (++m_pos[d] < m_hi[d])
+                                {
+                                    break;
+                                }
+                                m_pos[d] = m_lo[d];
+                            }
+                        }
+                    }
+
+                    // Offset within the input plane of the element at a row-major window index.
+                    // The element must be in bounds.
+                    size_t input_offset(size_t window_index) const
+                    {
+                        size_t in_offset = 0;
+                        for (size_t d = 0; d < m_g.rank; d++)
+                        {
+                            size_t w = window_index / m_g.window_strides[d];
+                            window_index %= m_g.window_strides[d];
+                            in_offset += (m_start[d] + w - m_g.pad_below[d]) * m_g.in_strides[d];
+                        }
+                        return in_offset;
+                    }
+
+                    // Number of window positions inside the padded input
+                    size_t padded_count() const { return m_padded_count; }
+                    // Number of window positions inside the unpadded input
+                    size_t valid_count() const { return m_valid_count; }
+
+                private:
+                    void position()
+                    {
+                        m_padded_count = 1;
+                        m_valid_count = 1;
+                        for (size_t d = 0; d < m_g.rank; d++)
+                        {
+                            size_t start = m_out_coord[d] * m_g.strides[d];
+                            size_t end = std::min(start + m_g.window[d], m_g.padded_dims[d]);
+                            size_t lo = std::max(start, m_g.pad_below[d]);
+                            size_t hi = std::min(end, m_g.pad_below[d] + m_g.in_dims[d]);
+                            m_start[d] = start;
+                            m_padded_count *= end > start ? end - start : 0;
+                            m_valid_count *= hi > lo ? hi - lo : 0;
+                            m_lo[d] = lo - m_g.pad_below[d];
+                            m_hi[d] = std::max(hi, lo) - m_g.pad_below[d];
+                        }
+                    }
+
+                    const PoolGeometry& m_g;
+                    std::vector<size_t> m_out_coord;
+                    std::vector<size_t> m_start;
+                    std::vector<size_t> m_lo;
+                    std::vector<size_t> m_hi;
+                    std::vector<size_t> m_pos;
+                    size_t m_padded_count = 0;
+                    size_t m_valid_count = 0;
+                };
+
+                // Calls f(window, plane) for every plane, splitting the planes across the arena's
+                // threads. The cost estimate is per plane.
+                template <typename F>
+                void parallel_for_planes(const PoolGeometry& geometry,
+                                         const Eigen::TensorOpCost& plane_cost,
+                                         int arena,
+                                         F f)
+                {
+                    if (geometry.planes == 0)
+                    {
+                        return;
+                    }
+                    auto plane_range = [&](Eigen::Index first, Eigen::Index last) {
+                        PoolWindow window(geometry);
+                        for (Eigen::Index plane = first; plane < last; plane++)
+                        {
+                            f(window, static_cast<size_t>(plane));
+                        }
+                    };
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        geometry.planes, plane_cost, plane_range);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,220 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/state/philox.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Calls f(i, bits) for every i in [0, count), where bits is value offset + i of the
+                // Philox stream. Every element depends only on its index, so the output does not
+                // depend on how the range is split over the threads of the arena.
+                template <typename F>
+                void for_each_random(size_t count,
+                                     const Philox4x32& philox,
+                                     uint64_t offset,
+                                     int arena,
+                                     F f)
+                {
+                    // One Philox block of ten rounds yields four values
+                    Eigen::TensorOpCost cost(0, 4, 12);
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        count, cost, [&](Eigen::Index first, Eigen::Index last) {
+                            size_t i = first;
+                            while (i < static_cast<size_t>(last))
+                            {
+                                uint64_t index = offset + i;
+                                auto block = philox(index / 4);
+                                for (size_t lane = index % 4;
+                                     lane < 4 && i < static_cast<size_t>(last);
+                                     lane++, i++)
+                                {
+                                    f(i, block[lane]);
+                                }
+                            }
+                        });
+                }
+
+                template <typename T>
+                void random_uniform(T* out,
+                                    T min_val,
+                                    T max_val,
+                                    size_t count,
+                                    const Philox4x32& philox,
+                                    uint64_t offset,
+                                    int arena)
+                {
+                    for_each_random(count, philox, offset, arena, [&](size_t i, uint32_t bits) {
+                        out[i] = static_cast<T>(Philox4x32::to_double(bits)) * (max_val - min_val) +
+                                 min_val;
+                    });
+                }
+
+                template <typename T>
+                void generate_mask(T* out,
+                                   size_t count,
+                                   bool training,
+                                   double probability,
+                                   const Philox4x32& philox,
+                                   uint64_t offset,
+                                   int arena)
+                {
+                    if (!training)
+                    {
+                        std::fill(out, out + count, static_cast<T>(1));
+                        return;
+                    }
+                    for_each_random(count, philox, offset, arena, [&](size_t i, uint32_t bits) {
+                        out[i] = static_cast<T>(Philox4x32::to_double(bits) < probability ? 1 : 0);
+                    });
+                }
+
+                // Note: this kernel is for doing upscale in train
+                template <typename T>
+                void dropout(const T* input,
+                             T* out,
+                             T* mask,
+                             size_t count,
+                             bool training,
+                             double keep_prob,
+                             const Philox4x32& philox,
+                             uint64_t offset,
+                             int arena)
+                {
+                    if (!training)
+                    {
+                        // this is inference, ideally it should be optimized earlier
+                        std::fill(mask, mask + count, static_cast<T>(1));
+                        std::fill(out, out + count, static_cast<T>(1));
+                        return;
+                    }
+                    double drop_prob = 1 - keep_prob;
+                    T scale = static_cast<T>(keep_prob);
+                    for_each_random(count, philox, offset, arena, [&](size_t i, uint32_t bits) {
+                        if (Philox4x32::to_double(bits) < drop_prob)
+                        {
+                            mask[i] = 0;
+                            out[i] = 0;
+                        }
+                        else
+                        {
+                            mask[i] = 1;
+                            out[i] = input[i] / scale;
+                        }
+                    });
+                }
+
+                // Elements per word of a packed dropout mask
+                static const size_t DROPOUT_MASK_BITS = 32;
+
+                // Like dropout, with bit i % 32 of mask word i / 32 set when element i is kept.
+                // Element i uses the same Philox value as in dropout, so both draw the same mask.
+                // The words are split over the threads of the arena.
+                template <typename T>
+                void dropout_packed(const T* input,
+                                    T* out,
+                                    uint32_t* mask,
+                                    size_t count,
+                                    bool training,
+                                    double keep_prob,
+                                    const Philox4x32& philox,
+                                    uint64_t offset,
+                                    int arena)
+                {
+                    size_t words = (count + DROPOUT_MASK_BITS - 1) / DROPOUT_MASK_BITS;
+                    if (!training)
+                    {
+                        // this is inference, ideally it should be optimized earlier
+                        std::fill(mask, mask + words, ~uint32_t(0));
+                        std::fill(out, out + count, static_cast<T>(1));
+                        return;
+                    }
+                    double drop_prob = 1 - keep_prob;
+                    T scale = static_cast<T>(keep_prob);
+                    Eigen::TensorOpCost cost(DROPOUT_MASK_BITS * sizeof(T),
+                                             DROPOUT_MASK_BITS * sizeof(T) + sizeof(uint32_t),
+                                             DROPOUT_MASK_BITS * 4);
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        words, cost, [&](Eigen::Index first, Eigen::Index last) {
+                            Philox4x32::Block block;
+                            for (Eigen::Index w = first; w < last; w++)
+                            {
+                                size_t begin = w * DROPOUT_MASK_BITS;
+                                size_t end = std::min(begin + DROPOUT_MASK_BITS, count);
+                                uint32_t word = 0;
+                                for (size_t i = begin; i < end; i++)
+                                {
+                                    uint64_t index = offset + i;
+                                    if (i == begin || index % 4 == 0)
+                                    {
+                                        block = philox(index / 4);
+                                    }
+                                    if (Philox4x32::to_double(block[index % 4]) < drop_prob)
+                                    {
+                                        out[i] = 0;
+                                    }
+                                    else
+                                    {
+                                        word |= uint32_t(1) << (i - begin);
+                                        out[i] = input[i] / scale;
+                                    }
+                                }
+                                mask[w] = word;
+                            }
+                        });
+                }
+
+                // out = arg * mask for a mask packed by dropout_packed
+                template <typename T>
+                void dropout_mask_multiply(
+                    const T* arg, const uint32_t* mask, T* out, size_t count, int arena)
+                {
+                    size_t words = (count + DROPOUT_MASK_BITS - 1) / DROPOUT_MASK_BITS;
+                    Eigen::TensorOpCost cost(DROPOUT_MASK_BITS * sizeof(T) + sizeof(uint32_t),
+                                             DROPOUT_MASK_BITS * sizeof(T),
+                                             DROPOUT_MASK_BITS);
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        words, cost, [&](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index w = first; w < last; w++)
+                            {
+                                size_t begin = w * DROPOUT_MASK_BITS;
+                                size_t end = std::min(begin + DROPOUT_MASK_BITS, count);
+                                uint32_t word = mask[w];
+                                for (size_t i = begin; i < end; i++, word >>= 1)
+                                {
+                                    out[i] = (word & 1) ? arg[i] : static_cast<T>(0);
+                                }
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,318 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                static const size_t REDUCE_AXES_LANES = 8;
+                static const size_t REDUCE_AXES_BLOCK = 1024;
+
+                // Layout of a reduction over an arbitrary set of axes, computed once when the op
+                // is built. Axes of extent 1 are dropped and adjacent axes that are both reduced
+                // or both kept are merged, so the input is viewed as alternating groups of kept
+                // and reduced axes. The innermost group is kept apart so that the kernel always
+                // works on contiguous runs of `inner` elements.
+                struct ReductionPlan
+                {
+                    ReductionPlan(const Shape& input_shape, const AxisSet& reduction_axes)
+                    {
+                        std::vector<size_t> dims;
+                        std::vector<bool> reduced;
+                        for (size_t i = 0; i < input_shape.size(); i++)
+                        {
+                            if (input_shape[i] == 1)
+                            {
+                                continue;
+                            }
+                            bool is_reduced = reduction_axes.count(i) != 0;
+                            if (!dims.empty() && reduced.back() == is_reduced)
+                            {
+                                dims.back() *= input_shape[i];
+                            }
+                            else
+                            {
+                                dims.push_back(input_shape[i]);
+                                reduced.push_back(is_reduced);
+                            }
+                        }
+                        if (dims.empty())
+                        {
+                            return;
+                        }
+
+                        inner = dims.back();
+                        inner_reduced = reduced.back();
+                        size_t stride = inner;
+                        for (size_t i = dims.size() - 1; i-- > 0;)
+                        {
+                            auto& group_dims = reduced[i] ? reduced_dims : kept_dims;
+                            auto& group_strides = reduced[i] ? reduced_strides : kept_strides;
+                            group_dims.insert(group_dims.begin(), dims[i]);
+                            group_strides.insert(group_strides.begin(), stride);
+                            stride *= dims[i];
+                        }
+                        rows = shape_size(kept_dims);
+                        reduced_count = shape_size(reduced_dims);
+                    }
+
+                    // Offset in the input of the first element of kept row `row`
+                    size_t row_offset(size_t row) const
+                    {
+                        size_t offset = 0;
+                        for (size_t d = kept_dims.size(); d-- > 0;)
+                        {
+                            offset += (row % kept_dims[d]) * kept_strides[d];
+                            row /= kept_dims[d];
+                        }
+                        return offset;
+                    }
+
+                    // Extents and input strides of the merged kept and reduced axes outside the
+                    // innermost group, outermost first
+                    std::vector<size_t> kept_dims;
+                    std::vector<size_t> kept_strides;
+                    std::vector<size_t> reduced_dims;
+                    std::vector<size_t> reduced_strides;
+                    // Extent of the innermost group, and whether it is reduced
+                    size_t inner = 1;
+                    bool inner_reduced = false;
+                    size_t rows = 1;
+                    size_t reduced_count = 1;
+                };
+
+                template <typename T>
+                struct SumReducer
+                {
+                    static T identity() { return T(0); }
+                    static T reduce(T acc, T x) { return acc + x; }
+                };
+
+                template <typename T>
+                struct ProductReducer
+                {
+                    static T identity() { return T(1); }
+                    static T reduce(T acc, T x) { return acc * x; }
+                };
+
+                template <typename T>
+                struct MaxReducer
+                {
+                    static T identity()
+                    {
+                        return std::numeric_limits<T>::has_infinity
+                                   ? T(-std::numeric_limits<T>::infinity())
+                                   : std::numeric_limits<T>::lowest();
+                    }
+                    static T reduce(T acc, T x) { return x > acc ? x : acc; }
+                };
+
+                template <typename T>
+                struct MinReducer
+                {
+                    static T identity()
+                    {
+                        return std::numeric_limits<T>::has_infinity
+                                   ? T(std::numeric_limits<T>::infinity())
+                                   : std::numeric_limits<T>::max();
+                    }
+                    static T reduce(T acc, T x) { return x < acc ? x : acc; }
+                };
+
+                template <typename T>
+                struct AnyReducer
+                {
+                    static T identity() { return T(0); }
+                    static T reduce(T acc, T x) { return acc || x; }
+                };
+
+                template <typename T>
+                struct AllReducer
+                {
+                    static T identity() { return T(1); }
+                    static T reduce(T acc, T x) { return acc && x; }
+                };
+
+                // Steps `coord` to the next position of the reduced axes of `plan`, innermost
+                // fastest, and keeps `offset` at its input offset. Wraps to zero at the end.
+                inline void next_reduced_position(const ReductionPlan& plan,
+                                                  std::vector<size_t>& coord,
+                                                  size_t& offset)
+                {
+                    for (size_t d = coord.size(); d-- > 0;)
+                    {
+                        offset += plan.reduced_strides[d];
+                        if (++coord[d] < plan.reduced_dims[d])
+                        {
+                            return;
+                        }
+                        offset -= plan.reduced_strides[d] * plan.reduced_dims[d];
+                        coord[d] = 0;
+                    }
+                }
+
+                // Reduces the input over the axes described by `plan` without transposing it.
+                // When the innermost axes are reduced, each output element accumulates the
+                // contiguous runs that map to it. When they are kept, each output row is
+                // accumulated in blocks of contiguous elements, one input row at a time. Both
+                // walk the input in memory order within a run and are parallelized over output
+                // elements, so no thread ever writes to another's output.
+                template <typename ElementType, typename Reducer>
+                void reduce_axes(void* input, void* output, const ReductionPlan& plan, int arena)
+                {
+                    auto in = static_cast<const ElementType*>(input);
+                    auto out = static_cast<ElementType*>(output);
+                    const size_t inner = plan.inner;
+
+                    if (plan.rows == 0)
+                    {
+                        return;
+                    }
+
+                    auto& device = executor::GetCPUExecutor().get_device(arena);
+                    if (plan.inner_reduced)
+                    {
+                        auto reduce_rows = [&](Eigen::Index first, Eigen::Index last) {
+                            std::vector<size_t> coord(plan.reduced_dims.size(), 0);
+                            for (Eigen::Index r = first; r < last; r++)
+                            {
+                                const ElementType* row_in = in + plan.row_offset(r);
+                                ElementType acc[REDUCE_AXES_LANES];
+                                std::fill(acc, acc + REDUCE_AXES_LANES, Reducer::identity());
+                                size_t offset = 0;
+                                for (size_t k = 0; k < plan.reduced_count; k++)
+                                {
+                                    const ElementType* run = row_in + offset;
+                                    size_t c = 0;
+                                    for (; c + REDUCE_AXES_LANES <= inner; c += REDUCE_AXES_LANES)
+                                    {
+                                        for (size_t j = 0; j < REDUCE_AXES_LANES; j++)
+                                        {
+                                            acc[j] = Reducer::reduce(acc[j], run[c + j]);
+                                        }
+                                    }
+                                    for (size_t j = 0; c < inner; c++, j++)
+                                    {
+                                        acc[j] = Reducer::reduce(acc[j], run[c]);
+                                    }
+                                    next_reduced_position(plan, coord, offset);
+                                }
+                                for (size_t j = 1; j < REDUCE_AXES_LANES; j++)
+                                {
+                                    acc[0] = Reducer::reduce(acc[0], acc[j]);
+                                }
+                                out[r] = acc[0];
+                            }
+                        };
+                        double elements = static_cast<double>(inner) * plan.reduced_count;
+                        device.parallelFor(plan.rows,
+                                           Eigen::TensorOpCost(sizeof(ElementType) * elements,
+                                                               sizeof(ElementType),
+                                                               elements),
+                                           reduce_rows);
+                    }
+                    else
+                    {
+                        const size_t blocks = (inner + REDUCE_AXES_BLOCK - 1) / REDUCE_AXES_BLOCK;
+                        auto reduce_blocks = [&](Eigen::Index first, Eigen::Index last) {
+                            std::vector<size_t> coord(plan.reduced_dims.size(), 0);
+                            for (Eigen::Index t = first; t < last; t++)
+                            {
+                                size_t r = t / blocks;
+                                size_t begin = (t % blocks) * REDUCE_AXES_BLOCK;
+                                size_t length = std::min(REDUCE_AXES_BLOCK, inner - begin);
+                                const ElementType* block_in = in + plan.row_offset(r) + begin;
+                                ElementType* block_out = out + r * inner + begin;
+                                std::fill(block_out, block_out + length, Reducer::identity());
+                                size_t offset = 0;
+                                for (size_t k = 0; k < plan.reduced_count; k++)
+                                {
+                                    const ElementType* run = block_in + offset;
+                                    for (size_t c = 0; c < length; c++)
+                                    {
+                                        block_out[c] = Reducer::reduce(block_out[c], run[c]);
+                                    }
+                                    next_reduced_position(plan, coord, offset);
+                                }
+                            }
+                        };
+                        double length = static_cast<double>(std::min(inner, REDUCE_AXES_BLOCK));
+                        double elements = length * plan.reduced_count;
+                        device.parallelFor(plan.rows * blocks,
+                                           Eigen::TensorOpCost(sizeof(ElementType) * elements,
+                                                               sizeof(ElementType) * length,
+                                                               elements),
+                                           reduce_blocks);
+                    }
+                }
+
+                template <typename ElementType>
+                void reduce_sum_axes(void* input,
+                                     void* output,
+                                     const ReductionPlan& plan,
+                                     int arena)
+                {
+                    reduce_axes<ElementType, SumReducer<ElementType>>(input, output, plan, arena);
+                }
+
+                template <typename ElementType>
+                void reduce_product_axes(void* input,
+                                         void* output,
+                                         const ReductionPlan& plan,
+                                         int arena)
+                {
+                    reduce_axes<ElementType, ProductReducer<ElementType>>(
+                        input, output, plan, arena);
+                }
+
+                template <typename ElementType>
+                void reduce_max_axes(void* input,
+                                     void* output,
+                                     const ReductionPlan& plan,
+                                     int arena)
+                {
+                    reduce_axes<ElementType, MaxReducer<ElementType>>(input, output, plan, arena);
+                }
+
+                template <typename ElementType>
+                void reduce_min_axes(void* input,
+                                     void* output,
+                                     const ReductionPlan& plan,
+                                     int arena)
+                {
+                    reduce_axes<ElementType, MinReducer<ElementType>>(input, output, plan, arena);
+                }
+            }
+        }
+    }
+}
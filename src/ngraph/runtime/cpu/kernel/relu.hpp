@@ -46,6 +46,12 @@ namespace ngraph
                         in0.cwiseMax(ElementType(0));
                 }
 
+                // Dispatched to the kernels for the selected ISA, see isa.cpp
+                template <>
+                void relu<float>(void* input0, void* output, size_t count, int arena);
+                template <>
+                void relu<int8_t>(void* input0, void* output, size_t count, int arena);
+
                 template <typename ElementType>
                 void bounded_relu(
                     void* input0, void* output, ElementType alpha, size_t count, int arena)
@@ -21,7 +21,8 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
-#include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/cpu/kernel/parallel_for.hpp"
+#include "ngraph/runtime/opt_kernel/reshape.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -96,67 +97,21 @@ namespace ngraph
                                                      arena);
                 }
 
-                template <typename ElementType, unsigned int OutRank>
-                void reshape_2d(void* input,
-                                void* output,
-                                const Shape& input_shape,
-                                const AxisVector& input_axis_order,
-                                const Shape& output_shape,
-                                int arena)
-                {
-                    reshape<ElementType, 2, OutRank>(static_cast<ElementType*>(input),
-                                                     static_cast<ElementType*>(output),
-                                                     input_shape,
-                                                     input_axis_order,
-                                                     output_shape,
-                                                     arena);
-                }
-
-                template <typename ElementType, unsigned int OutRank>
-                void reshape_3d(void* input,
-                                void* output,
-                                const Shape& input_shape,
-                                const AxisVector& input_axis_order,
-                                const Shape& output_shape,
-                                int arena)
-                {
-                    reshape<ElementType, 3, OutRank>(static_cast<ElementType*>(input),
-                                                     static_cast<ElementType*>(output),
-                                                     input_shape,
-                                                     input_axis_order,
-                                                     output_shape,
-                                                     arena);
-                }
-
-                template <typename ElementType, unsigned int OutRank>
-                void reshape_4d(void* input,
-                                void* output,
-                                const Shape& input_shape,
-                                const AxisVector& input_axis_order,
-                                const Shape& output_shape,
-                                int arena)
-                {
-                    reshape<ElementType, 4, OutRank>(static_cast<ElementType*>(input),
-                                                     static_cast<ElementType*>(output),
-                                                     input_shape,
-                                                     input_axis_order,
-                                                     output_shape,
-                                                     arena);
-                }
-
+                /// \brief Any permutation, as a blocked transpose split over the executor.
                 template <typename ElementType>
-                void reshape_ref(const void* arg,
-                                 void* out,
-                                 const Shape& in_shape,
-                                 const AxisVector& in_axis_order,
-                                 const Shape& out_shape,
-                                 int /* arena */)
+                void reshape_blocked(const void* arg,
+                                     void* out,
+                                     const Shape& in_shape,
+                                     const AxisVector& in_axis_order,
+                                     const Shape& out_shape,
+                                     int arena)
                 {
-                    reference::reshape(static_cast<const ElementType*>(arg),
-                                       static_cast<ElementType*>(out),
-                                       in_shape,
-                                       in_axis_order,
-                                       out_shape);
+                    opt_kernel::reshape(static_cast<const ElementType*>(arg),
+                                        static_cast<ElementType*>(out),
+                                        in_shape,
+                                        in_axis_order,
+                                        out_shape,
+                                        parallel_for_on(arena, sizeof(ElementType)));
                 }
             }
         }
@@ -0,0 +1,244 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief For each output coordinate along one axis, the two input coordinates
+                ///        it interpolates between and the weight of the second.
+                ///
+                /// Nearest neighbour tables have `lo == hi`. Coordinates outside the input are
+                /// marked invalid.
+                struct ResizeTable
+                {
+                    std::vector<size_t> lo;
+                    std::vector<size_t> hi;
+                    std::vector<float> frac;
+                    std::vector<bool> valid;
+
+                    void resize(size_t size)
+                    {
+                        lo.resize(size);
+                        hi.resize(size);
+                        frac.resize(size);
+                        valid.resize(size);
+                    }
+
+                    /// \brief Fills entry `i` for input coordinate `x` of an axis of `size`.
+                    void set(size_t i, float x, size_t size, bool nearest)
+                    {
+                        valid[i] = x >= 0.0f && x <= float(size - 1);
+                        x = std::min(std::max(x, 0.0f), float(size - 1));
+                        if (nearest)
+                        {
+                            lo[i] = hi[i] = static_cast<size_t>(std::round(x));
+                            frac[i] = 0.0f;
+                        }
+                        else
+                        {
+                            lo[i] = static_cast<size_t>(std::floor(x));
+                            hi[i] = std::min(lo[i] + 1, size - 1);
+                            frac[i] = x - float(lo[i]);
+                        }
+                    }
+                };
+
+                /// \brief TensorFlow style CropAndResize of an [N, H, W, C] image into
+                ///        [boxes, crop_h, crop_w, C].
+                ///
+                /// Each box is [y1, x1, y2, x2] in normalized coordinates. Work is split across
+                /// (box, output row) pairs; the column table of a box is built once per row
+                /// range, and the innermost loop runs over the contiguous channels.
+                template <typename T, typename I>
+                void crop_and_resize(const T* image,
+                                     const float* boxes,
+                                     const I* box_indices,
+                                     T* out,
+                                     size_t image_h,
+                                     size_t image_w,
+                                     size_t depth,
+                                     size_t box_count,
+                                     size_t crop_h,
+                                     size_t crop_w,
+                                     bool nearest,
+                                     float extrapolation_value,
+                                     int arena)
+                {
+                    auto coordinate = [](float lo, float hi, size_t size, size_t i, size_t count) {
+                        float extent = float(size - 1);
+                        return count > 1 ? lo * extent + i * (hi - lo) * extent / (count - 1)
+                                         : 0.5f * (lo + hi) * extent;
+                    };
+
+                    auto rows = [&](Eigen::Index first, Eigen::Index last) {
+                        ResizeTable x_table;
+                        x_table.resize(crop_w);
+                        ResizeTable y_table;
+                        y_table.resize(1);
+                        size_t table_box = box_count;
+                        for (Eigen::Index r = first; r < last; r++)
+                        {
+                            size_t b = r / crop_h;
+                            size_t y = r % crop_h;
+                            const float* box = boxes + b * 4;
+                            if (table_box != b)
+                            {
+                                for (size_t x = 0; x < crop_w; x++)
+                                {
+                                    x_table.set(x,
+                                                coordinate(box[1], box[3], image_w, x, crop_w),
+                                                image_w,
+                                                nearest);
+                                }
+                                table_box = b;
+                            }
+
+                            T* out_row = out + r * crop_w * depth;
+                            float in_y = coordinate(box[0], box[2], image_h, y, crop_h);
+                            if (in_y < 0.0f || in_y > float(image_h - 1))
+                            {
+                                std::fill(
+                                    out_row, out_row + crop_w * depth, T(extrapolation_value));
+                                continue;
+                            }
+                            y_table.set(0, in_y, image_h, nearest);
+
+                            const T* plane =
+                                image + static_cast<size_t>(box_indices[b]) * image_h * image_w *
+                                            depth;
+                            const T* top = plane + y_table.lo[0] * image_w * depth;
+                            const T* bottom = plane + y_table.hi[0] * image_w * depth;
+                            T y_frac = T(y_table.frac[0]);
+                            for (size_t x = 0; x < crop_w; x++)
+                            {
+                                T* pixel = out_row + x * depth;
+                                if (!x_table.valid[x])
+                                {
+                                    std::fill(pixel, pixel + depth, T(extrapolation_value));
+                                    continue;
+                                }
+                                const T* tl = top + x_table.lo[x] * depth;
+                                const T* tr = top + x_table.hi[x] * depth;
+                                const T* bl = bottom + x_table.lo[x] * depth;
+                                const T* br = bottom + x_table.hi[x] * depth;
+                                T x_frac = T(x_table.frac[x]);
+                                for (size_t c = 0; c < depth; c++)
+                                {
+                                    T t = tl[c] + (tr[c] - tl[c]) * x_frac;
+                                    T d = bl[c] + (br[c] - bl[c]) * x_frac;
+                                    pixel[c] = t + (d - t) * y_frac;
+                                }
+                            }
+                        }
+                    };
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        box_count * crop_h,
+                        Eigen::TensorOpCost(4 * sizeof(T) * crop_w * depth,
+                                            sizeof(T) * crop_w * depth,
+                                            6.0 * crop_w * depth),
+                        rows);
+                }
+
+                /// \brief Resizes the two trailing axes of `planes` [in_h, in_w] planes to
+                ///        [out_h, out_w], by nearest neighbour or bilinear interpolation.
+                ///
+                /// With `align_corners` the corner pixels of input and output coincide;
+                /// otherwise output coordinate `i` reads input coordinate `i * in / out`. Both
+                /// tables are built once per call, and work is split across output rows.
+                template <typename T>
+                void interpolate(const T* in,
+                                 T* out,
+                                 size_t planes,
+                                 size_t in_h,
+                                 size_t in_w,
+                                 size_t out_h,
+                                 size_t out_w,
+                                 bool nearest,
+                                 bool align_corners,
+                                 int arena)
+                {
+                    auto fill_table = [&](ResizeTable& table, size_t in_size, size_t out_size) {
+                        table.resize(out_size);
+                        for (size_t i = 0; i < out_size; i++)
+                        {
+                            float x;
+                            if (align_corners)
+                            {
+                                x = out_size > 1 ? float(i) * (in_size - 1) / (out_size - 1) : 0;
+                            }
+                            else
+                            {
+                                x = float(i) * in_size / out_size;
+                                if (nearest)
+                                {
+                                    x = std::floor(x);
+                                }
+                            }
+                            table.set(i, x, in_size, nearest);
+                        }
+                    };
+                    ResizeTable y_table;
+                    ResizeTable x_table;
+                    fill_table(y_table, in_h, out_h);
+                    fill_table(x_table, in_w, out_w);
+
+                    auto rows = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index r = first; r < last; r++)
+                        {
+                            size_t p = r / out_h;
+                            size_t y = r % out_h;
+                            const T* top = in + (p * in_h + y_table.lo[y]) * in_w;
+                            const T* bottom = in + (p * in_h + y_table.hi[y]) * in_w;
+                            T y_frac = T(y_table.frac[y]);
+                            T* out_row = out + r * out_w;
+                            for (size_t x = 0; x < out_w; x++)
+                            {
+                                size_t lo = x_table.lo[x];
+                                size_t hi = x_table.hi[x];
+                                T x_frac = T(x_table.frac[x]);
+                                T t = top[lo] + (top[hi] - top[lo]) * x_frac;
+                                T d = bottom[lo] + (bottom[hi] - bottom[lo]) * x_frac;
+                                out_row[x] = t + (d - t) * y_frac;
+                            }
+                        }
+                    };
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        planes * out_h,
+                        Eigen::TensorOpCost(
+                            4 * sizeof(T) * out_w, sizeof(T) * out_w, 6.0 * out_w),
+                        rows);
+                }
+            }
+        }
+    }
+}
@@ -16,12 +16,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
 #include "ngraph/coordinate.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
-#include "ngraph/runtime/reference/scatter_add.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -130,84 +133,295 @@ namespace ngraph
                     }
                 }
 
-                template <typename ElementType, unsigned int Rank1, unsigned int Rank2>
-                void scatter_add_i64(void* inputs,
-                                     void* indices,
-                                     void* updates,
-                                     void* output,
-                                     const Shape& inputs_shape,
-                                     const Shape& indices_shape,
-                                     const Shape& updates_shape,
-                                     int arena)
+                // Work on a destination slice is split into blocks of this many elements, so
+                // that a few heavily updated slices still spread across threads.
+                static constexpr size_t SCATTER_ADD_BLOCK = 1024;
+
+                // Adds the update slices to output, which holds a copy of inputs. Update i is the
+                // slice_length elements at updates + i * slice_length and is added at
+                // output + destinations[i]. With assign_first, the first update to a slice
+                // replaces it instead, and the others are added to that.
+                //
+                // Updates are bucketed by destination so that each destination slice is owned by
+                // a single thread, and the updates to a slice are applied in their original
+                // order. The result therefore needs no atomics and is bitwise identical to a
+                // sequential scatter, whatever the number of threads.
+                template <typename ElementType>
+                void scatter_add_slices(const ElementType* inputs,
+                                        const ElementType* updates,
+                                        ElementType* output,
+                                        size_t output_size,
+                                        const std::vector<size_t>& destinations,
+                                        size_t slice_length,
+                                        int arena,
+                                        bool assign_first = false)
+                {
+                    auto& device = executor::GetCPUExecutor().get_device(arena);
+                    if (inputs != output && output_size > 0)
+                    {
+                        device.parallelFor(output_size,
+                                           Eigen::TensorOpCost(sizeof(ElementType),
+                                                               sizeof(ElementType),
+                                                               0),
+                                           [&](Eigen::Index first, Eigen::Index last) {
+                                               std::copy(inputs + first,
+                                                         inputs + last,
+                                                         output + first);
+                                           });
+                    }
+
+                    size_t count = destinations.size();
+                    if (count == 0 || slice_length == 0)
+                    {
+                        return;
+                    }
+
+                    // (destination, update) pairs sorted by destination, then by update
+                    std::vector<std::pair<size_t, size_t>> order(count);
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        order[i] = std::make_pair(destinations[i], i);
+                    }
+                    std::sort(order.begin(), order.end());
+
+                    std::vector<size_t> group_begin;
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        if (i == 0 || order[i].first != order[i - 1].first)
+                        {
+                            group_begin.push_back(i);
+                        }
+                    }
+                    size_t groups = group_begin.size();
+                    group_begin.push_back(count);
+
+                    size_t blocks = (slice_length + SCATTER_ADD_BLOCK - 1) / SCATTER_ADD_BLOCK;
+                    size_t block_length = std::min(slice_length, SCATTER_ADD_BLOCK);
+                    double updates_per_group = static_cast<double>(count) / groups;
+                    device.parallelFor(
+                        groups * blocks,
+                        Eigen::TensorOpCost((updates_per_group + 1) * block_length *
+                                                sizeof(ElementType),
+                                            block_length * sizeof(ElementType),
+                                            updates_per_group * block_length),
+                        [&](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index item = first; item < last; item++)
+                            {
+                                size_t group = item / blocks;
+                                size_t begin = (item % blocks) * SCATTER_ADD_BLOCK;
+                                size_t end = std::min(begin + SCATTER_ADD_BLOCK, slice_length);
+                                ElementType* out = output + order[group_begin[group]].first;
+                                for (size_t u = group_begin[group]; u < group_begin[group + 1];
+                                     u++)
+                                {
+                                    const ElementType* update =
+                                        updates + order[u].second * slice_length;
+                                    if (assign_first && u == group_begin[group])
+                                    {
+                                        std::copy(update + begin, update + end, out + begin);
+                                        continue;
+                                    }
+                                    for (size_t j = begin; j < end; j++)
+                                    {
+                                        out[j] += update[j];
+                                    }
+                                }
+                            }
+                        });
+                }
+
+                // ScatterAdd: update slice i is added to row indices[i] of the output, where a
+                // row is a slice along the first axis of inputs.
+                template <typename ElementType, typename IndicesType>
+                void scatter_add_rows(void* inputs,
+                                      void* indices,
+                                      void* updates,
+                                      void* output,
+                                      const Shape& inputs_shape,
+                                      const Shape& indices_shape,
+                                      int arena)
                 {
-                    scatter_add<ElementType, int64_t, Rank1, Rank2>(inputs,
-                                                                    indices,
-                                                                    updates,
-                                                                    output,
-                                                                    inputs_shape,
-                                                                    indices_shape,
-                                                                    updates_shape,
-                                                                    arena);
+                    size_t output_size = shape_size(inputs_shape);
+                    size_t slice_length =
+                        inputs_shape.at(0) == 0 ? 0 : output_size / inputs_shape.at(0);
+                    auto indices_ptr = static_cast<const IndicesType*>(indices);
+                    std::vector<size_t> destinations(shape_size(indices_shape));
+                    for (size_t i = 0; i < destinations.size(); i++)
+                    {
+                        destinations[i] = static_cast<size_t>(indices_ptr[i]) * slice_length;
+                    }
+                    scatter_add_slices(static_cast<const ElementType*>(inputs),
+                                       static_cast<const ElementType*>(updates),
+                                       static_cast<ElementType*>(output),
+                                       output_size,
+                                       destinations,
+                                       slice_length,
+                                       arena);
                 }
 
-                template <typename ElementType, unsigned int Rank1, unsigned int Rank2>
-                void scatter_add_i32(void* inputs,
-                                     void* indices,
-                                     void* updates,
-                                     void* output,
-                                     const Shape& inputs_shape,
-                                     const Shape& indices_shape,
-                                     const Shape& updates_shape,
-                                     int arena)
+                // The innermost axis of indices holds coordinates into the leading axes of
+                // inputs, each selecting a slice of the trailing axes. Returns the flat offset of
+                // the slice selected by each tuple, and sets slice_length.
+                template <typename IndicesType>
+                std::vector<size_t> get_nd_destinations(const void* indices,
+                                                        const Shape& inputs_shape,
+                                                        const Shape& indices_shape,
+                                                        size_t& slice_length)
+                {
+                    size_t slice_rank = indices_shape.back();
+                    slice_length = 1;
+                    for (size_t i = slice_rank; i < inputs_shape.size(); i++)
+                    {
+                        slice_length *= inputs_shape[i];
+                    }
+                    std::vector<size_t> strides(slice_rank);
+                    size_t stride = slice_length;
+                    for (size_t i = slice_rank; i-- > 0;)
+                    {
+                        strides[i] = stride;
+                        stride *= inputs_shape[i];
+                    }
+
+                    auto indices_ptr = static_cast<const IndicesType*>(indices);
+                    size_t count = slice_rank == 0 ? 0 : shape_size(indices_shape) / slice_rank;
+                    std::vector<size_t> destinations(count);
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        size_t offset = 0;
+                        for (size_t j = 0; j < slice_rank; j++)
+                        {
+                            offset += static_cast<size_t>(indices_ptr[i * slice_rank + j]) *
+                                      strides[j];
+                        }
+                        destinations[i] = offset;
+                    }
+                    return destinations;
+                }
+
+                // ScatterNDAdd: each update slice is added to the slice of inputs its index
+                // tuple selects.
+                template <typename ElementType, typename IndicesType>
+                void scatter_nd_add(void* inputs,
+                                    void* indices,
+                                    void* updates,
+                                    void* output,
+                                    const Shape& inputs_shape,
+                                    const Shape& indices_shape,
+                                    int arena)
+                {
+                    size_t slice_length;
+                    auto destinations = get_nd_destinations<IndicesType>(
+                        indices, inputs_shape, indices_shape, slice_length);
+                    scatter_add_slices(static_cast<const ElementType*>(inputs),
+                                       static_cast<const ElementType*>(updates),
+                                       static_cast<ElementType*>(output),
+                                       shape_size(inputs_shape),
+                                       destinations,
+                                       slice_length,
+                                       arena);
+                }
+
+                // ScatterND: each update slice replaces the slice of inputs its index tuple
+                // selects. Updates to the same slice are summed, as in the decomposition of
+                // ScatterND into ScatterNDAdd.
+                template <typename ElementType, typename IndicesType>
+                void scatter_nd(void* inputs,
+                                void* indices,
+                                void* updates,
+                                void* output,
+                                const Shape& inputs_shape,
+                                const Shape& indices_shape,
+                                int arena)
+                {
+                    size_t slice_length;
+                    auto destinations = get_nd_destinations<IndicesType>(
+                        indices, inputs_shape, indices_shape, slice_length);
+                    scatter_add_slices(static_cast<const ElementType*>(inputs),
+                                       static_cast<const ElementType*>(updates),
+                                       static_cast<ElementType*>(output),
+                                       shape_size(inputs_shape),
+                                       destinations,
+                                       slice_length,
+                                       arena,
+                                       true);
+                }
+
+                template <typename ElementType>
+                void scatter_add_rows_i32(void* inputs,
+                                          void* indices,
+                                          void* updates,
+                                          void* output,
+                                          const Shape& inputs_shape,
+                                          const Shape& indices_shape,
+                                          int arena)
+                {
+                    scatter_add_rows<ElementType, int32_t>(
+                        inputs, indices, updates, output, inputs_shape, indices_shape, arena);
+                }
+
+                template <typename ElementType>
+                void scatter_add_rows_i64(void* inputs,
+                                          void* indices,
+                                          void* updates,
+                                          void* output,
+                                          const Shape& inputs_shape,
+                                          const Shape& indices_shape,
+                                          int arena)
+                {
+                    scatter_add_rows<ElementType, int64_t>(
+                        inputs, indices, updates, output, inputs_shape, indices_shape, arena);
+                }
+
+                template <typename ElementType>
+                void scatter_nd_add_i32(void* inputs,
+                                        void* indices,
+                                        void* updates,
+                                        void* output,
+                                        const Shape& inputs_shape,
+                                        const Shape& indices_shape,
+                                        int arena)
+                {
+                    scatter_nd_add<ElementType, int32_t>(
+                        inputs, indices, updates, output, inputs_shape, indices_shape, arena);
+                }
+
+                template <typename ElementType>
+                void scatter_nd_add_i64(void* inputs,
+                                        void* indices,
+                                        void* updates,
+                                        void* output,
+                                        const Shape& inputs_shape,
+                                        const Shape& indices_shape,
+                                        int arena)
                 {
-                    scatter_add<ElementType, int32_t, Rank1, Rank2>(inputs,
-                                                                    indices,
-                                                                    updates,
-                                                                    output,
-                                                                    inputs_shape,
-                                                                    indices_shape,
-                                                                    updates_shape,
-                                                                    arena);
+                    scatter_nd_add<ElementType, int64_t>(
+                        inputs, indices, updates, output, inputs_shape, indices_shape, arena);
                 }
 
                 template <typename ElementType>
-                void ref_scatter_add_i32(void* inputs,
-                                         void* indices,
-                                         void* updates,
-                                         void* output,
-                                         const Shape& inputs_shape,
-                                         const Shape& indices_shape,
-                                         const Shape& updates_shape,
-                                         const Shape& output_shape)
+                void scatter_nd_i32(void* inputs,
+                                    void* indices,
+                                    void* updates,
+                                    void* output,
+                                    const Shape& inputs_shape,
+                                    const Shape& indices_shape,
+                                    int arena)
                 {
-                    reference::scatter_add<ElementType, int32_t>(static_cast<ElementType*>(inputs),
-                                                                 static_cast<int32_t*>(indices),
-                                                                 static_cast<ElementType*>(updates),
-                                                                 static_cast<ElementType*>(output),
-                                                                 inputs_shape,
-                                                                 indices_shape,
-                                                                 updates_shape,
-                                                                 output_shape);
+                    scatter_nd<ElementType, int32_t>(
+                        inputs, indices, updates, output, inputs_shape, indices_shape, arena);
                 }
 
                 template <typename ElementType>
-                void ref_scatter_add_i64(void* inputs,
-                                         void* indices,
-                                         void* updates,
-                                         void* output,
-                                         const Shape& inputs_shape,
-                                         const Shape& indices_shape,
-                                         const Shape& updates_shape,
-                                         const Shape& output_shape)
+                void scatter_nd_i64(void* inputs,
+                                    void* indices,
+                                    void* updates,
+                                    void* output,
+                                    const Shape& inputs_shape,
+                                    const Shape& indices_shape,
+                                    int arena)
                 {
-                    reference::scatter_add<ElementType, int64_t>(static_cast<ElementType*>(inputs),
-                                                                 static_cast<int64_t*>(indices),
-                                                                 static_cast<ElementType*>(updates),
-                                                                 static_cast<ElementType*>(output),
-                                                                 inputs_shape,
-                                                                 indices_shape,
-                                                                 updates_shape,
-                                                                 output_shape);
+                    scatter_nd<ElementType, int64_t>(
+                        inputs, indices, updates, output, inputs_shape, indices_shape, arena);
                 }
             }
         }
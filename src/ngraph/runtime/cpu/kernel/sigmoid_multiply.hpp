@@ -18,6 +18,7 @@
 #include <unsupported/Eigen/CXX11/Tensor>
 #include "ngraph/op/sigmoid.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/kernel/isa.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 
 template <typename ElementType>
@@ -50,6 +51,13 @@ namespace ngraph
                                       size_t index,
                                       int arena)
                 {
+                    // x * sigmoid(x) is swish, which has a one-pass kernel
+                    if (arg0_tensor == arg1_tensor && (index == 2 || index == 6))
+                    {
+                        swish_float32(arg0_tensor, out_tensor, tensor_size, arena);
+                        return;
+                    }
+
                     auto in0 = wrap_into_tensor_map<float>(arg0_tensor, tensor_size);
                     auto in1 = wrap_into_tensor_map<float>(arg1_tensor, tensor_size);
                     auto out_tm = wrap_into_tensor_map<float>(out_tensor, tensor_size);
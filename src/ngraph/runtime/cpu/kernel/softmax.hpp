@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cmath>
+
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
@@ -101,39 +103,46 @@ namespace ngraph
                         out * out.sum(axes).inverse().eval().reshape(rdims).broadcast(bcast);
                 }
 
-                template <typename ElementType, unsigned int Rank>
-                void softmax_innermost_1rd(void* input,
-                                           void* output,
-                                           const Shape& input_shape,
-                                           int arena)
+                // Softmax over each of the `rows` contiguous rows of `cols` elements, i.e.
+                // over the trailing axes of the input. Each row is handled by one thread in
+                // three passes: the max, exp fused with the sum, and the scale.
+                template <typename ElementType>
+                void softmax_rows(void* input, void* output, size_t rows, size_t cols, int arena)
                 {
-                    Eigen::array<Eigen::Index, Rank> in_dims, rdims, bcast;
-                    Eigen::IndexList<Eigen::type2index<Rank - 1>> axis;
-                    rdims.fill(1);
-
-                    for (size_t i = 0; i < Rank; i++)
-                    {
-                        in_dims[i] = input_shape[i];
-                    }
+                    auto in = static_cast<const ElementType*>(input);
+                    auto out = static_cast<ElementType*>(output);
+                    double bytes = sizeof(ElementType) * cols;
 
-                    for (size_t i = 0; i < Rank - 1; i++)
-                    {
-                        rdims[i] = in_dims[i];
-                    }
+                    auto softmax_range = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index r = first; r < last; r++)
+                        {
+                            const ElementType* row_in = in + r * cols;
+                            ElementType* row_out = out + r * cols;
+                            ElementType max = row_in[0];
+                            for (size_t c = 1; c < cols; c++)
+                            {
+                                max = max < row_in[c] ? row_in[c] : max;
+                            }
+                            ElementType sum = 0;
+                            for (size_t c = 0; c < cols; c++)
+                            {
+                                row_out[c] = std::exp(row_in[c] - max);
+                                sum += row_out[c];
+                            }
+                            ElementType scale = 1 / sum;
+                            for (size_t c = 0; c < cols; c++)
+                            {
+                                row_out[c] *= scale;
+                            }
+                        }
+                    };
 
-                    for (size_t i = 0; i < Rank; i++)
+                    if (rows == 0 || cols == 0)
                     {
-                        bcast[i] = in_dims[i] / rdims[i];
+                        return;
                     }
-
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> out(
-                        static_cast<ElementType *>(output), in_dims),
-                        in(static_cast<ElementType *>(input), in_dims);
-
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        (in - in.maximum(axis).eval().reshape(rdims).broadcast(bcast)).exp();
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        out * out.sum(axis).inverse().eval().reshape(rdims).broadcast(bcast);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        rows, Eigen::TensorOpCost(bytes, bytes, 20.0 * cols), softmax_range);
                 }
 
                 template <typename ElementType, unsigned int Rank>
@@ -0,0 +1,163 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Softmax cross entropy of [n, c] logits, into [n, 1].
+                ///
+                /// Each row is read twice: once for its maximum and once for the sum of
+                /// exponentials (and, with soft labels, the label weighted sums), so the loss is
+                /// computed from the log-softmax without materializing it. With hard labels,
+                /// `labels` is [n, 1]; rows labelled `ignore_index` or out of range give zero.
+                /// Rows are split across the threads of `arena`.
+                template <typename T, typename L>
+                void softmax_crossentropy(const T* logits,
+                                          const L* labels,
+                                          T* out,
+                                          size_t n,
+                                          size_t c,
+                                          bool soft_label,
+                                          int64_t ignore_index,
+                                          int arena)
+                {
+                    auto rows = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+                            const T* x = logits + i * c;
+                            T max = -std::numeric_limits<T>::infinity();
+                            for (size_t j = 0; j < c; j++)
+                            {
+                                max = std::max(max, x[j]);
+                            }
+
+                            T sum = T(0);
+                            T label_sum = T(0);
+                            T weighted_sum = T(0);
+                            for (size_t j = 0; j < c; j++)
+                            {
+                                sum += std::exp(x[j] - max);
+                                if (soft_label)
+                                {
+                                    T label = static_cast<T>(labels[i * c + j]);
+                                    label_sum += label;
+                                    weighted_sum += label * (x[j] - max);
+                                }
+                            }
+                            T log_sum = std::log(sum);
+
+                            if (soft_label)
+                            {
+                                out[i] = label_sum * log_sum - weighted_sum;
+                                continue;
+                            }
+                            int64_t label = static_cast<int64_t>(labels[i]);
+                            bool counted =
+                                label != ignore_index && label >= 0 && label < int64_t(c);
+                            out[i] = counted ? log_sum - (x[label] - max) : T(0);
+                        }
+                    };
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        n,
+                        Eigen::TensorOpCost(
+                            (soft_label ? 4 : 2) * sizeof(T) * c, sizeof(T), 12.0 * c),
+                        rows);
+                }
+
+                /// \brief Backprop of softmax_crossentropy with respect to the logits, given the
+                ///        forward softmax.
+                ///
+                /// For label weights `w` (the soft labels, or the masked one-hot hard label) and
+                /// `d = delta * w`, the result is `sum(d) * softmax - d`. `delta` is [n, 1] or
+                /// [n, c]; each row of the result is written in one pass after one pass for the
+                /// sum.
+                template <typename T, typename L>
+                void softmax_crossentropy_backprop(const T* delta,
+                                                   const T* softmax,
+                                                   const L* labels,
+                                                   T* out,
+                                                   size_t n,
+                                                   size_t c,
+                                                   bool delta_per_row,
+                                                   bool soft_label,
+                                                   int64_t ignore_index,
+                                                   int arena)
+                {
+                    auto rows = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+                            const T* s = softmax + i * c;
+                            T* y = out + i * c;
+                            auto d = [&](size_t j) {
+                                return delta_per_row ? delta[i] : delta[i * c + j];
+                            };
+
+                            if (soft_label)
+                            {
+                                const L* w = labels + i * c;
+                                T sum = T(0);
+                                for (size_t j = 0; j < c; j++)
+                                {
+                                    sum += d(j) * static_cast<T>(w[j]);
+                                }
+                                for (size_t j = 0; j < c; j++)
+                                {
+                                    y[j] = sum * s[j] - d(j) * static_cast<T>(w[j]);
+                                }
+                                continue;
+                            }
+
+                            int64_t label = static_cast<int64_t>(labels[i]);
+                            if (label == ignore_index || label < 0 || label >= int64_t(c))
+                            {
+                                std::fill(y, y + c, T(0));
+                                continue;
+                            }
+                            T sum = d(label);
+                            for (size_t j = 0; j < c; j++)
+                            {
+                                y[j] = sum * s[j];
+                            }
+                            y[label] -= sum;
+                        }
+                    };
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        n,
+                        Eigen::TensorOpCost(3 * sizeof(T) * c, sizeof(T) * c, 3.0 * c),
+                        rows);
+                }
+            }
+        }
+    }
+}
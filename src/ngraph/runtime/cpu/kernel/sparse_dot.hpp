@@ -0,0 +1,83 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief out[M, N] = arg[M, K] * W, with W given in CSR form.
+                ///
+                /// Rows of `arg` are split across the threads of `arena`. For each nonzero
+                /// `arg[m, k]`, row `k` of W is scattered into row `m` of the output, so the
+                /// work per row is proportional to the nonzeros it touches.
+                inline void sparse_dot(const float* arg,
+                                       float* out,
+                                       size_t m,
+                                       size_t k,
+                                       size_t n,
+                                       const size_t* row_offsets,
+                                       const uint32_t* columns,
+                                       const float* values,
+                                       size_t nonzero_count,
+                                       int arena)
+                {
+                    auto rows = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+                            const float* x = arg + i * k;
+                            float* y = out + i * n;
+                            std::fill(y, y + n, 0.0f);
+                            for (size_t r = 0; r < k; r++)
+                            {
+                                float a = x[r];
+                                if (a == 0.0f)
+                                {
+                                    continue;
+                                }
+                                for (size_t j = row_offsets[r]; j < row_offsets[r + 1]; j++)
+                                {
+                                    y[columns[j]] += a * values[j];
+                                }
+                            }
+                        }
+                    };
+
+                    // A dense row of `arg` touches every nonzero of W once
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        m,
+                        Eigen::TensorOpCost(sizeof(float) * (k + nonzero_count),
+                                            sizeof(float) * n,
+                                            2.0 * nonzero_count),
+                        rows);
+                }
+            }
+        }
+    }
+}
@@ -44,6 +44,10 @@ namespace ngraph
                     out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
                         in0.tanh();
                 }
+
+                // Dispatched to the kernels for the selected ISA, see isa.cpp
+                template <>
+                void tanh<float>(void* input0, void* output, size_t count, int arena);
             }
         }
     }
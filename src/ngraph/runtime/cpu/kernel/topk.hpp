@@ -0,0 +1,131 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/topk.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Selects the top k = out_shape[axis] entries of every slice along axis. Slices
+                // are processed in parallel, each with a bounded heap of the k best entries seen
+                // so far, so an entry that does not beat the worst of them is rejected with one
+                // comparison and nothing is allocated per slice. Ties and the order of the
+                // results match reference::topk.
+                template <typename T, typename U>
+                void topk(const T* arg,
+                          U* out_indices,
+                          T* out_values,
+                          const Shape& in_shape,
+                          const Shape& out_shape,
+                          size_t axis,
+                          bool compute_max,
+                          op::TopK::SortType sort,
+                          int arena)
+                {
+                    size_t n = in_shape[axis];
+                    size_t k = out_shape[axis];
+                    size_t outer = 1;
+                    for (size_t i = 0; i < axis; i++)
+                    {
+                        outer *= in_shape[i];
+                    }
+                    size_t inner = 1;
+                    for (size_t i = axis + 1; i < in_shape.size(); i++)
+                    {
+                        inner *= in_shape[i];
+                    }
+                    if (k == 0 || outer * inner == 0)
+                    {
+                        return;
+                    }
+
+                    using Entry = std::tuple<T, U>;
+                    auto better =
+                        compute_max ? reference::compare_max<T, U> : reference::compare_min<T, U>;
+                    auto by_index = compute_max ? reference::sort_indices_descending<T, U>
+                                                : reference::sort_indices_ascending<T, U>;
+
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        outer * inner,
+                        Eigen::TensorOpCost(n * sizeof(T),
+                                            k * (sizeof(T) + sizeof(U)),
+                                            n + k * std::log2(k + 1.0)),
+                        [&](Eigen::Index first, Eigen::Index last) {
+                            // Heap ordered by better, so the worst selected entry is at the front
+                            std::vector<Entry> heap;
+                            heap.reserve(k);
+                            for (Eigen::Index slice = first; slice < last; slice++)
+                            {
+                                size_t o = slice / inner;
+                                size_t i = slice % inner;
+                                const T* in = arg + o * n * inner + i;
+                                heap.clear();
+                                for (size_t j = 0; j < n; j++)
+                                {
+                                    Entry entry(in[j * inner], static_cast<U>(j));
+                                    if (heap.size() < k)
+                                    {
+                                        heap.push_back(entry);
+                                        std::push_heap(heap.begin(), heap.end(), better);
+                                    }
+                                    else if (better(entry, heap.front()))
+                                    {
+                                        std::pop_heap(heap.begin(), heap.end(), better);
+                                        heap.back() = entry;
+                                        std::push_heap(heap.begin(), heap.end(), better);
+                                    }
+                                }
+
+                                if (sort == op::TopK::SortType::SORT_INDICES)
+                                {
+                                    std::sort(heap.begin(), heap.end(), by_index);
+                                }
+                                else
+                                {
+                                    std::sort_heap(heap.begin(), heap.end(), better);
+                                }
+
+                                size_t out_index = o * k * inner + i;
+                                for (const Entry& entry : heap)
+                                {
+                                    out_values[out_index] = std::get<0>(entry);
+                                    out_indices[out_index] = std::get<1>(entry);
+                                    out_index += inner;
+                                }
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
@@ -35,6 +35,26 @@
 #define SELECT_ETS(KV, ET, K) EXPAND_ETS(K, KV, ET, KERNEL_CT)
 #define SELECT_ETS_AND_RANK7(KV, ET, R, K) EXPAND_ETS_AND_RANK7(K, KV, ET, R, KERNEL_CT_R)
 
+// Specializes a kernel on the common sizes D of its innermost dimension so that the compiler can
+// fully unroll and vectorize its inner loops without remainders. Other sizes use the generic
+// kernel, instantiated with a size of 0, which reads the size at run time. The kernel's template
+// arguments other than the size are passed after K.
+#define SELECT_INNER_DIM(KV, D, K, ...)                                                            \
+    switch (D)                                                                                     \
+    {                                                                                              \
+    case 3: KV = K<__VA_ARGS__, 3>; break;                                                         \
+    case 4: KV = K<__VA_ARGS__, 4>; break;                                                         \
+    case 16: KV = K<__VA_ARGS__, 16>; break;                                                       \
+    case 32: KV = K<__VA_ARGS__, 32>; break;                                                       \
+    case 64: KV = K<__VA_ARGS__, 64>; break;                                                       \
+    case 128: KV = K<__VA_ARGS__, 128>; break;                                                     \
+    case 256: KV = K<__VA_ARGS__, 256>; break;                                                     \
+    case 512: KV = K<__VA_ARGS__, 512>; break;                                                     \
+    case 768: KV = K<__VA_ARGS__, 768>; break;                                                     \
+    case 1024: KV = K<__VA_ARGS__, 1024>; break;                                                   \
+    default: KV = K<__VA_ARGS__, 0>; break;                                                        \
+    }
+
 // Macros for instantiating templated kernels
 #define KERNEL_CT(K, KV, CT) KV = K<CT>
 #define KERNEL_CT_CT_CT(K, KV, CT) KV = K<CT, CT, CT>
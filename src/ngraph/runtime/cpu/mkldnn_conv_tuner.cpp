@@ -0,0 +1,279 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/kernel/isa.hpp"
+#include "ngraph/runtime/cpu/mkldnn_conv_tuner.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using ConvolutionImpl = runtime::cpu::MKLDNNConvTuner::ConvolutionImpl;
+
+static const ConvolutionImpl s_candidates[] = {
+    ConvolutionImpl::direct, ConvolutionImpl::winograd, ConvolutionImpl::gemm};
+
+runtime::cpu::MKLDNNConvTuner& runtime::cpu::MKLDNNConvTuner::get()
+{
+    static MKLDNNConvTuner s_tuner;
+    return s_tuner;
+}
+
+runtime::cpu::MKLDNNConvTuner::MKLDNNConvTuner()
+{
+    if (auto env = std::getenv("NGRAPH_CPU_CONV_TUNING"))
+    {
+        m_enabled = std::atoi(env) != 0;
+    }
+    if (auto env = std::getenv("NGRAPH_CPU_CONV_TUNING_CACHE"))
+    {
+        m_path = env;
+        load();
+    }
+}
+
+void runtime::cpu::MKLDNNConvTuner::set_cache_path(const string& path)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_path = path;
+    load();
+}
+
+string runtime::cpu::MKLDNNConvTuner::get_cache_path() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_path;
+}
+
+void runtime::cpu::MKLDNNConvTuner::clear()
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_choices.clear();
+}
+
+size_t runtime::cpu::MKLDNNConvTuner::size() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_choices.size();
+}
+
+string runtime::cpu::MKLDNNConvTuner::get_impl_name(ConvolutionImpl impl)
+{
+    switch (impl)
+    {
+    case ConvolutionImpl::direct: return "direct";
+    case ConvolutionImpl::winograd: return "winograd";
+    case ConvolutionImpl::gemm: return "gemm";
+    case ConvolutionImpl::unset: break;
+    }
+    return "unset";
+}
+
+void runtime::cpu::MKLDNNConvTuner::load()
+{
+    if (m_path.empty())
+    {
+        return;
+    }
+    ifstream in(m_path);
+    string line;
+    while (getline(in, line))
+    {
+        // "<key> <implementation>"; unreadable lines, e.g. from a future version, are skipped
+        auto space = line.rfind(' ');
+        if (space == string::npos)
+        {
+            continue;
+        }
+        string name = line.substr(space + 1);
+        for (auto impl : s_candidates)
+        {
+            if (get_impl_name(impl) == name)
+            {
+                m_choices[line.substr(0, space)] = impl;
+            }
+        }
+    }
+}
+
+void runtime::cpu::MKLDNNConvTuner::append(const string& key, ConvolutionImpl impl)
+{
+    if (m_path.empty())
+    {
+        return;
+    }
+    // One short line per write, so that processes tuning at the same time do not interleave
+    stringstream line;
+    line << key << ' ' << get_impl_name(impl) << '\n';
+    ofstream out(m_path, ios::app);
+    out << line.str() << flush;
+    if (!out)
+    {
+        NGRAPH_WARN << "Could not write the convolution tuning cache " << m_path;
+    }
+}
+
+ConvolutionImpl
+    runtime::cpu::MKLDNNConvTuner::select(const string& key,
+                                          const function<double(ConvolutionImpl)>& benchmark)
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        auto it = m_choices.find(key);
+        if (it != m_choices.end())
+        {
+            return it->second;
+        }
+    }
+    if (!m_enabled)
+    {
+        return ConvolutionImpl::unset;
+    }
+
+    // Benchmarks run unlocked; concurrent misses on one key time it twice and agree closely
+    // enough that either result is fine
+    auto best = ConvolutionImpl::unset;
+    double best_seconds = numeric_limits<double>::max();
+    for (auto impl : s_candidates)
+    {
+        double seconds = benchmark(impl);
+        NGRAPH_DEBUG << "Convolution " << key << ": " << get_impl_name(impl) << " "
+                     << seconds << "s";
+        if (seconds >= 0 && seconds < best_seconds)
+        {
+            best = impl;
+            best_seconds = seconds;
+        }
+    }
+    if (best != ConvolutionImpl::unset)
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_choices[key] = best;
+        append(key, best);
+    }
+    return best;
+}
+
+string runtime::cpu::MKLDNNConvTuner::make_key(const Node& node,
+                                               const Strides& strides,
+                                               const Strides& dilations,
+                                               const CoordinateDiff& padding_below,
+                                               const CoordinateDiff& padding_above)
+{
+    // No spaces, which separate the key from the choice in the cache file
+    auto join = [](stringstream& ss, char tag, const vector<size_t>& values) {
+        ss << ';' << tag;
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            ss << (i ? "x" : "") << values[i];
+        }
+    };
+    auto join_diff = [](stringstream& ss, char tag, const CoordinateDiff& values) {
+        ss << ';' << tag;
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            ss << (i ? "x" : "") << values[i];
+        }
+    };
+
+    stringstream ss;
+    ss << kernel::isa_name(kernel::get_host_isa()) << ";t"
+       << executor::GetCPUExecutor().get_num_threads_per_pool() << ';' << node.description();
+    for (size_t i = 0; i < node.get_input_size(); i++)
+    {
+        ss << ';' << node.get_input_element_type(i).c_type_string();
+        join(ss, 'i', node.get_input_shape(i));
+    }
+    join(ss, 'o', node.get_output_shape(0));
+    join(ss, 's', strides);
+    join(ss, 'd', dilations);
+    join_diff(ss, 'b', padding_below);
+    join_diff(ss, 'a', padding_above);
+    return ss.str();
+}
+
+double runtime::cpu::MKLDNNConvTuner::time_convolution(
+    const mkldnn::convolution_forward::desc& desc, bool with_bias)
+{
+#if MKLDNN_VERSION_MAJOR < 1
+    mkldnn::convolution_forward::primitive_desc pd(desc, executor::global_cpu_engine);
+    auto zeroed = [](const mkldnn::memory::primitive_desc& mpd) -> mkldnn::memory {
+        mkldnn::memory memory(mpd);
+        memset(memory.get_data_handle(), 0, mpd.get_size());
+        return memory;
+    };
+    auto src = zeroed(pd.src_primitive_desc());
+    auto weights = zeroed(pd.weights_primitive_desc());
+    auto dst = zeroed(pd.dst_primitive_desc());
+    vector<mkldnn::primitive> convolution;
+    if (with_bias)
+    {
+        auto bias = zeroed(pd.bias_primitive_desc());
+        convolution.push_back(mkldnn::convolution_forward(pd, src, weights, bias, dst));
+    }
+    else
+    {
+        convolution.push_back(mkldnn::convolution_forward(pd, src, weights, dst));
+    }
+    auto run = [&]() {
+        mkldnn::stream s(mkldnn::stream::kind::eager);
+        s.submit(convolution).wait();
+    };
+#else
+    auto& engine = executor::global_cpu_engine;
+    mkldnn::convolution_forward::primitive_desc pd(desc, engine);
+    auto zeroed = [&engine](const mkldnn::memory::desc& md) -> mkldnn::memory {
+        mkldnn::memory memory(md, engine);
+        memset(memory.get_data_handle(), 0, md.get_size());
+        return memory;
+    };
+    unordered_map<int, mkldnn::memory> args = {{MKLDNN_ARG_SRC, zeroed(pd.src_desc())},
+                                               {MKLDNN_ARG_WEIGHTS, zeroed(pd.weights_desc())},
+                                               {MKLDNN_ARG_DST, zeroed(pd.dst_desc())}};
+    if (with_bias)
+    {
+        args.insert({MKLDNN_ARG_BIAS, zeroed(pd.bias_desc())});
+    }
+    mkldnn::convolution_forward convolution(pd);
+    auto run = [&]() {
+        mkldnn::stream s(engine);
+        convolution.execute(s, args);
+        s.wait();
+    };
+#endif
+
+    run();
+    double best = numeric_limits<double>::max();
+    for (int i = 0; i < 5; i++)
+    {
+        auto start = chrono::steady_clock::now();
+        run();
+        chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+        best = min(best, elapsed.count());
+    }
+    return best;
+}
@@ -0,0 +1,109 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <mkldnn.hpp>
+
+#include "ngraph/node.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+#include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Compile-time benchmarking of MKLDNN forward convolution implementations.
+            ///
+            /// The layout pass normally lets MKLDNN pick the layouts of a convolution for the
+            /// algorithm returned by mkldnn_utils::get_conv_algo(). With tuning enabled it times
+            /// the candidates of each f32 convolution on its actual shapes instead:
+            ///     direct   - convolution_direct on the layouts MKLDNN prefers
+            ///     winograd - convolution_winograd, for 2D 3x3 convolutions with unit strides
+            ///     gemm     - convolution_direct on plain nchw/oihw layouts, which MKLDNN runs
+            ///                as im2col followed by a GEMM
+            /// and keeps the fastest. Choices are keyed by the host ISA, the intra-op thread
+            /// count and the shapes and parameters of the convolution. They are appended to a
+            /// cache file so that later compiles, in this process or others, reuse them without
+            /// benchmarking.
+            ///
+            /// Tuning is enabled by NGRAPH_CPU_CONV_TUNING=1 or the backend's "conv_tuning"
+            /// config key, and the cache file is named by NGRAPH_CPU_CONV_TUNING_CACHE or the
+            /// "conv_tuning_cache" key. Cached choices are used even with tuning disabled.
+            class CPU_BACKEND_API MKLDNNConvTuner
+            {
+            public:
+                using ConvolutionImpl = CPUOpAnnotations::ConvolutionImpl;
+
+                static MKLDNNConvTuner& get();
+
+                bool is_enabled() const { return m_enabled; }
+                void set_enabled(bool enabled) { m_enabled = enabled; }
+                /// \brief Switches to the cache file at `path` and loads its choices. An empty
+                ///        path keeps new choices in memory only.
+                void set_cache_path(const std::string& path);
+                std::string get_cache_path() const;
+
+                /// \brief The cached choice for `key`. On a miss with tuning enabled, times
+                ///        every candidate with `benchmark` and caches the fastest. `benchmark`
+                ///        returns the seconds per run of a candidate, or a negative value if
+                ///        MKLDNN cannot run it on these shapes.
+                /// \returns ConvolutionImpl::unset on a miss with tuning disabled, or when no
+                ///          candidate could run
+                ConvolutionImpl select(const std::string& key,
+                                       const std::function<double(ConvolutionImpl)>& benchmark);
+
+                /// \brief Forgets the choices held in memory. The cache file is kept.
+                void clear();
+                size_t size() const;
+
+                /// \brief The cache key of a convolution with the given parameters
+                static std::string make_key(const Node& node,
+                                            const Strides& strides,
+                                            const Strides& dilations,
+                                            const CoordinateDiff& padding_below,
+                                            const CoordinateDiff& padding_above);
+
+                /// \brief Seconds per run of the forward convolution `desc` on zeroed
+                ///        buffers, the best of a few runs after a warm-up run. Throws
+                ///        mkldnn::error if MKLDNN has no implementation for it.
+                static double time_convolution(const mkldnn::convolution_forward::desc& desc,
+                                               bool with_bias);
+
+                static std::string get_impl_name(ConvolutionImpl impl);
+
+            private:
+                MKLDNNConvTuner();
+                // Reads m_path, with later lines overriding earlier ones. Needs m_mutex held.
+                void load();
+                void append(const std::string& key, ConvolutionImpl impl);
+
+                mutable std::mutex m_mutex;
+                std::atomic<bool> m_enabled{false};
+                std::string m_path;
+                std::map<std::string, ConvolutionImpl> m_choices;
+            };
+        }
+    }
+}
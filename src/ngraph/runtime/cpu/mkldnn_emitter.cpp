@@ -14,8 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include "mkldnn_emitter.hpp"
 
@@ -90,6 +95,46 @@ const std::vector<mkldnn::memory::desc*>& MKLDNNEmitter::get_mkldnn_scratchpad_m
     return m_mkldnn_scratchpad_mds;
 }
 
+#if MKLDNN_VERSION_MAJOR >= 1
+void MKLDNNEmitter::prebuild_primitives(size_t num_threads)
+{
+    std::lock_guard<std::mutex> lock(m_prebuild_mutex);
+    std::atomic<size_t> next{0};
+    std::mutex error_mutex;
+    std::exception_ptr error;
+    auto worker = [&]() {
+        for (size_t i = next++; i < m_primitive_prebuilds.size(); i = next++)
+        {
+            try
+            {
+                m_primitive_prebuilds[i]();
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                error = std::current_exception();
+            }
+        }
+    };
+    num_threads = std::min(num_threads, m_primitive_prebuilds.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < num_threads; i++)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    m_primitive_prebuilds.clear();
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+#endif
+
 size_t MKLDNNEmitter::insert_primitive(mkldnn::primitive* primitive)
 {
     m_mkldnn_primitives.emplace_back(primitive);
@@ -154,6 +199,16 @@ size_t MKLDNNEmitter::get_max_scratchpad_size() const
     return m_max_scratchpad_size;
 }
 
+size_t MKLDNNEmitter::get_workspace_bytes() const
+{
+    size_t bytes = 0;
+    for (auto& workspace : m_workspaces)
+    {
+        bytes += workspace->size;
+    }
+    return bytes;
+}
+
 mkldnn::memory::desc
     MKLDNNEmitter::build_blocked_memory_descriptor(const mkldnn::memory::dims& dim,
                                                    const mkldnn::memory::dims& strides,
@@ -1544,6 +1599,7 @@ size_t MKLDNNEmitter::query_scratchpad_convolution_forward(
     const mkldnn::convolution_forward::desc& desc, mkldnn::primitive_attr& attr)
 {
     attr.set_scratchpad_mode(mkldnn::scratchpad_mode::user);
+    add_primitive_prebuild<mkldnn::convolution_forward>(desc, attr);
     auto pd = mkldnn::convolution_forward::primitive_desc(desc, attr, executor::global_cpu_engine);
     GET_SIZE
 }
@@ -1603,6 +1659,7 @@ size_t MKLDNNEmitter::query_scratchpad_ip_forward(const mkldnn::inner_product_fo
                                                   mkldnn::primitive_attr& attr)
 {
     attr.set_scratchpad_mode(mkldnn::scratchpad_mode::user);
+    add_primitive_prebuild<mkldnn::inner_product_forward>(desc, attr);
     auto pd =
         mkldnn::inner_product_forward::primitive_desc(desc, attr, executor::global_cpu_engine);
     GET_SIZE
@@ -20,7 +20,9 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -49,6 +51,7 @@
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
@@ -115,9 +118,14 @@ namespace ngraph
             class MKLDNNWorkspace
             {
             public:
-                MKLDNNWorkspace(size_t size) { buf = reinterpret_cast<char*>(ngraph_malloc(size)); }
+                MKLDNNWorkspace(size_t size)
+                    : size(size)
+                {
+                    buf = reinterpret_cast<char*>(ngraph_malloc(size));
+                }
                 ~MKLDNNWorkspace() { ngraph_free(buf); }
                 char* buf;
+                size_t size;
 
                 MKLDNNWorkspace(const MKLDNNWorkspace&) = delete;
                 MKLDNNWorkspace(MKLDNNWorkspace&&) = delete;
@@ -154,6 +162,15 @@ namespace ngraph
                 size_t get_mkldnn_descriptors_size();
                 std::vector<size_t>& get_primitive_deps(size_t index);
                 size_t get_max_scratchpad_size() const;
+                /// \brief Bytes of all the workspaces created so far
+                size_t get_workspace_bytes() const;
+#if MKLDNN_VERSION_MAJOR >= 1
+                /// \brief Builds the primitives registered while querying scratchpad sizes into
+                ///        the MKLDNNPrimitiveCache using up to `num_threads` threads, so that the
+                ///        first iteration only has to pick up the cached handles.
+                void prebuild_primitives(size_t num_threads);
+                size_t get_num_primitive_prebuilds() const { return m_primitive_prebuilds.size(); }
+#endif
 
                 size_t build_quantized_inner_product_forward(
                     const mkldnn::memory::desc& input_data_desc,
@@ -620,7 +637,7 @@ namespace ngraph
                     // from each pos.
                     Strides window_dilation_strides_adjusted;
 
-                    mkldnn::algorithm convolution_algo = mkldnn_utils::get_conv_algo();
+                    mkldnn::algorithm convolution_algo = mkldnn_utils::get_conv_algo(node);
 
                     if ((node->get_input_element_type(0) != element::f32 &&
                          convolution_algo != mkldnn::algorithm::convolution_direct) ||
@@ -1372,12 +1389,11 @@ namespace ngraph
                     mkldnn_memories[results_idx] =
                         new mkldnn::memory(desc.data.dst_desc, engine, nullptr);
 
-                    auto conv_pd = mkldnn::convolution_forward::primitive_desc(desc, attr, engine);
-                    mkldnn_scratchpad_mds[conv_idx] =
-                        new mkldnn::memory::desc(conv_pd.scratchpad_desc());
-
-                    mkldnn::primitive* prim = new mkldnn::convolution_forward(conv_pd);
-                    mkldnn_primitives[conv_idx] = prim;
+                    auto cached =
+                        MKLDNNPrimitiveCache::get().get_or_create<mkldnn::convolution_forward>(
+                            desc, attr, engine);
+                    mkldnn_scratchpad_mds[conv_idx] = new mkldnn::memory::desc(cached.second);
+                    mkldnn_primitives[conv_idx] = new mkldnn::primitive(cached.first);
                 }
 
                 template <bool with_bias>
@@ -1412,12 +1428,11 @@ namespace ngraph
                     mkldnn_memories[results_idx] =
                         new mkldnn::memory(desc.data.dst_desc, engine, nullptr);
 
-                    auto ip_pd = mkldnn::inner_product_forward::primitive_desc(desc, attr, engine);
-                    mkldnn_scratchpad_mds[ip_idx] =
-                        new mkldnn::memory::desc(ip_pd.scratchpad_desc());
-
-                    mkldnn::primitive* prim = new mkldnn::inner_product_forward(ip_pd);
-                    mkldnn_primitives[ip_idx] = prim;
+                    auto cached =
+                        MKLDNNPrimitiveCache::get().get_or_create<mkldnn::inner_product_forward>(
+                            desc, attr, engine);
+                    mkldnn_scratchpad_mds[ip_idx] = new mkldnn::memory::desc(cached.second);
+                    mkldnn_primitives[ip_idx] = new mkldnn::primitive(cached.first);
                 }
 
                 size_t query_scratchpad_sum(const mkldnn::sum::primitive_desc);
@@ -1528,6 +1543,8 @@ namespace ngraph
                         case rnn_utils::rnntype::vanilla_gru: return mkldnn::algorithm::vanilla_gru;
                         case rnn_utils::rnntype::vanilla_lstm:
                             return mkldnn::algorithm::vanilla_lstm;
+                        case rnn_utils::rnntype::gru_linear_before_reset:
+                            return mkldnn::algorithm::gru_linear_before_reset;
                         default: throw ngraph_error("unsupported mkldnn rnn algorithm");
                         }
                     };
@@ -1572,7 +1589,11 @@ namespace ngraph
                         feature_size};
                     Shape wei_iter_tz{
                         num_fused_layers, direction, feature_size, rnn_cell_n_gates, feature_size};
-                    Shape bias_tz{num_fused_layers, direction, rnn_cell_n_gates, feature_size};
+                    auto bias_n_gates =
+                        rnn_node->get_rnn_type() == rnn_utils::rnntype::gru_linear_before_reset
+                            ? rnn_cell_n_gates + 1
+                            : rnn_cell_n_gates;
+                    Shape bias_tz{num_fused_layers, direction, bias_n_gates, feature_size};
                     Shape dst_layer_tz{src_sequence_length_max, batch, direction * feature_size};
                     Shape dst_iter_tz{
                         num_fused_layers, direction, rnn_cell_n_states, batch, feature_size};
@@ -1593,7 +1614,10 @@ namespace ngraph
                     auto dst_iter_desc = build_memory_descriptor(
                         dst_iter_tz, out[1].get_element_type(), mkldnn::memory::FORMAT::ldsnc);
 
-                    mkldnn::rnn_cell::desc rnn_cell_desc(get_mkldnn_rnn_cell_type());
+                    // The activation only applies to vanilla RNN cells, which use tanh like the
+                    // default of ONNX RNN
+                    mkldnn::rnn_cell::desc rnn_cell_desc(get_mkldnn_rnn_cell_type(),
+                                                         mkldnn::algorithm::eltwise_tanh);
                     return mkldnn::rnn_forward::desc(mkldnn::prop_kind::forward_training,
                                                      rnn_cell_desc,
                                                      get_mkldnn_rnn_direction(),
@@ -1721,6 +1745,19 @@ namespace ngraph
 #endif
 
             private:
+#if MKLDNN_VERSION_MAJOR >= 1
+                template <typename PRIM, typename DESC>
+                void add_primitive_prebuild(const DESC& desc, const mkldnn::primitive_attr& attr)
+                {
+                    m_primitive_prebuilds.emplace_back([desc, attr]() {
+                        MKLDNNPrimitiveCache::get().get_or_create<PRIM>(
+                            desc, attr, executor::global_cpu_engine);
+                    });
+                }
+
+                std::vector<std::function<void()>> m_primitive_prebuilds;
+                std::mutex m_prebuild_mutex;
+#endif
                 std::vector<mkldnn::memory*> m_mkldnn_memories;
                 std::vector<mkldnn::primitive*> m_mkldnn_primitives;
                 std::vector<mkldnn::stream> m_mkldnn_streams;
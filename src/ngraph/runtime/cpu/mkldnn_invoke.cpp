@@ -24,6 +24,13 @@
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 
+static thread_local ngraph::runtime::AlignedBuffer* s_thread_scratchpad = nullptr;
+
+void ngraph::runtime::cpu::mkldnn_utils::set_thread_scratchpad(AlignedBuffer* scratchpad)
+{
+    s_thread_scratchpad = scratchpad;
+}
+
 #if MKLDNN_VERSION_MAJOR < 1
 extern "C" void ngraph::runtime::cpu::mkldnn_utils::set_memory_ptr(CPURuntimeContext* ctx,
                                                                    size_t index,
@@ -211,9 +218,11 @@ extern "C" void
 
     if (scratchpad_size)
     {
+        auto scratchpad_buffer =
+            s_thread_scratchpad != nullptr ? s_thread_scratchpad : ctx->scratchpad_buffer;
         mkldnn::memory scratchpad(*ctx->mkldnn_scratchpad_mds[primitive_index],
                                   executor::global_cpu_engine,
-                                  ctx->scratchpad_buffer->get_ptr());
+                                  scratchpad_buffer->get_ptr());
         exec_args.insert({MKLDNN_ARG_SCRATCHPAD, scratchpad});
     }
 
@@ -22,6 +22,8 @@ namespace ngraph
 {
     namespace runtime
     {
+        class AlignedBuffer;
+
         namespace cpu
         {
             struct CPURuntimeContext;
@@ -80,6 +82,11 @@ namespace ngraph
                     SLICE,
                     SOFTMAX
                 };
+                /// \brief Make primitives invoked on the calling thread use `scratchpad`
+                ///        instead of the runtime context's scratchpad, so that inter-op
+                ///        workers can run primitives of one context concurrently. Pass nullptr
+                ///        to go back to the context's scratchpad.
+                void set_thread_scratchpad(AlignedBuffer* scratchpad);
                 extern "C" void set_memory_ptr(CPURuntimeContext* ctx, size_t index, void* ptr);
                 extern "C" void mkldnn_invoke_primitive(CPURuntimeContext* ctx,
                                                         size_t primitive_index,
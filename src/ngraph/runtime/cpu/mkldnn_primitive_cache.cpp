@@ -0,0 +1,154 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+#include <vector>
+
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
+
+#if MKLDNN_VERSION_MAJOR >= 1
+
+using namespace ngraph;
+using namespace ngraph::runtime::cpu;
+
+template <typename T>
+static void append_value(std::string& key, const T& value)
+{
+    key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+MKLDNNPrimitiveCache& MKLDNNPrimitiveCache::get()
+{
+    static MKLDNNPrimitiveCache s_cache;
+    return s_cache;
+}
+
+MKLDNNPrimitiveCache::MKLDNNPrimitiveCache()
+    : m_capacity(1024)
+{
+    if (auto env = std::getenv("NGRAPH_MKLDNN_PRIMITIVE_CACHE_CAPACITY"))
+    {
+        m_capacity = std::strtoul(env, nullptr, 10);
+    }
+}
+
+void MKLDNNPrimitiveCache::append_attr(std::string& key, const mkldnn::primitive_attr& attr)
+{
+    append_value(key, attr.get_scratchpad_mode());
+
+    int mask;
+    std::vector<float> scales;
+    attr.get_output_scales(mask, scales);
+    append_value(key, mask);
+    append_value(key, scales.size());
+    for (float scale : scales)
+    {
+        append_value(key, scale);
+    }
+
+    const mkldnn::post_ops ops = attr.get_post_ops();
+    append_value(key, ops.len());
+    for (int i = 0; i < ops.len(); i++)
+    {
+        auto kind = ops.kind(i);
+        append_value(key, kind);
+        if (kind == mkldnn::primitive::kind::sum)
+        {
+            float scale;
+            ops.get_params_sum(i, scale);
+            append_value(key, scale);
+        }
+        else if (kind == mkldnn::primitive::kind::eltwise)
+        {
+            float scale, alpha, beta;
+            mkldnn::algorithm alg;
+            ops.get_params_eltwise(i, scale, alg, alpha, beta);
+            append_value(key, scale);
+            append_value(key, alg);
+            append_value(key, alpha);
+            append_value(key, beta);
+        }
+    }
+}
+
+bool MKLDNNPrimitiveCache::find(const std::string& key, Entry& entry)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_index.find(key);
+    if (it == m_index.end())
+    {
+        m_misses++;
+        return false;
+    }
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+    entry = it->second->second;
+    m_hits++;
+    return true;
+}
+
+void MKLDNNPrimitiveCache::insert(const std::string& key, const Entry& entry)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_capacity == 0 || m_index.find(key) != m_index.end())
+    {
+        return;
+    }
+    m_lru.emplace_front(key, entry);
+    m_index[key] = m_lru.begin();
+    evict();
+}
+
+void MKLDNNPrimitiveCache::evict()
+{
+    while (m_lru.size() > m_capacity)
+    {
+        // Executables still holding the primitive keep it alive through their own handle
+        m_index.erase(m_lru.back().first);
+        m_lru.pop_back();
+        m_evictions++;
+    }
+}
+
+size_t MKLDNNPrimitiveCache::size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_lru.size();
+}
+
+size_t MKLDNNPrimitiveCache::get_capacity() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_capacity;
+}
+
+void MKLDNNPrimitiveCache::set_capacity(size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacity = capacity;
+    evict();
+}
+
+void MKLDNNPrimitiveCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_index.clear();
+    m_lru.clear();
+    m_hits = 0;
+    m_misses = 0;
+    m_evictions = 0;
+}
+
+#endif
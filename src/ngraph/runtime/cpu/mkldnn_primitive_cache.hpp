@@ -0,0 +1,131 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+
+#include <mkldnn.hpp>
+
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+#if MKLDNN_VERSION_MAJOR >= 1
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Process-wide cache of MKLDNN primitives shared by all CPU executables.
+            ///
+            /// Primitive creation (implementation search and JIT code generation) dominates the
+            /// compile time of convolution heavy models. Executables compiled from the same model
+            /// for different batch sizes, or from similar models, build many identical primitives;
+            /// the cache hands out handles to a single instance instead. MKLDNN v1 primitives are
+            /// reference counted handles that can be executed concurrently as long as the
+            /// scratchpad is user managed, which is the mode nGraph always uses.
+            ///
+            /// Entries are keyed by the primitive kind, the raw bytes of the operation descriptor
+            /// (which embeds the shapes, data types and layouts of every memory), the primitive
+            /// attributes and the engine. Comparing raw bytes can only produce spurious misses,
+            /// never false hits. The least recently used entry is evicted once the capacity is
+            /// exceeded; the capacity defaults to 1024 and can be changed with the
+            /// NGRAPH_MKLDNN_PRIMITIVE_CACHE_CAPACITY environment variable, 0 disables caching.
+            class CPU_BACKEND_API MKLDNNPrimitiveCache
+            {
+            public:
+                static MKLDNNPrimitiveCache& get();
+
+                /// \brief Returns the cached primitive and scratchpad descriptor for `PRIM`
+                ///        built from `desc` and `attr`, creating them on a miss.
+                template <typename PRIM, typename DESC>
+                std::pair<mkldnn::primitive, mkldnn::memory::desc>
+                    get_or_create(const DESC& desc,
+                                  const mkldnn::primitive_attr& attr,
+                                  const mkldnn::engine& engine)
+                {
+                    std::string key = make_key(typeid(PRIM).name(), desc.data, attr, engine);
+                    std::pair<mkldnn::primitive, mkldnn::memory::desc> entry;
+                    if (find(key, entry))
+                    {
+                        return entry;
+                    }
+                    // Built outside the lock; a concurrent miss on the same key just builds a
+                    // duplicate that loses the race in insert()
+                    typename PRIM::primitive_desc pd(desc, attr, engine);
+                    entry.first = PRIM(pd);
+                    entry.second = pd.scratchpad_desc();
+                    insert(key, entry);
+                    return entry;
+                }
+
+                size_t get_hits() const { return m_hits; }
+                size_t get_misses() const { return m_misses; }
+                size_t get_evictions() const { return m_evictions; }
+                size_t size() const;
+                size_t get_capacity() const;
+                /// \brief Sets the maximum number of entries, evicting as needed
+                void set_capacity(size_t capacity);
+                /// \brief Drops all entries and resets the counters
+                void clear();
+
+            private:
+                using Entry = std::pair<mkldnn::primitive, mkldnn::memory::desc>;
+                using LRUList = std::list<std::pair<std::string, Entry>>;
+
+                MKLDNNPrimitiveCache();
+
+                template <typename T>
+                static std::string make_key(const char* kind,
+                                            const T& op_desc,
+                                            const mkldnn::primitive_attr& attr,
+                                            const mkldnn::engine& engine)
+                {
+                    std::string key(kind);
+                    key.push_back('\0');
+                    key.append(reinterpret_cast<const char*>(&op_desc), sizeof(T));
+                    append_attr(key, attr);
+                    auto handle = engine.get();
+                    key.append(reinterpret_cast<const char*>(&handle), sizeof(handle));
+                    return key;
+                }
+
+                static void append_attr(std::string& key, const mkldnn::primitive_attr& attr);
+
+                bool find(const std::string& key, Entry& entry);
+                void insert(const std::string& key, const Entry& entry);
+                void evict();
+
+                mutable std::mutex m_mutex;
+                LRUList m_lru;
+                std::unordered_map<std::string, LRUList::iterator> m_index;
+                size_t m_capacity;
+                std::atomic<size_t> m_hits{0};
+                std::atomic<size_t> m_misses{0};
+                std::atomic<size_t> m_evictions{0};
+            };
+        }
+    }
+}
+
+#endif
@@ -189,6 +189,72 @@ bool runtime::cpu::mkldnn_utils::is_mkldnn_blocked_data_format(mkldnn::memory::F
     return false;
 }
 
+size_t runtime::cpu::mkldnn_utils::get_mkldnn_channel_block(const mkldnn::memory::desc& md)
+{
+#if MKLDNN_VERSION_MAJOR < 1
+    auto fmt = static_cast<memory::FORMAT>(md.data.format);
+    if (fmt == memory::FORMAT::nChw8c || fmt == memory::FORMAT::nCdhw8c)
+    {
+        return 8;
+    }
+    if (fmt == memory::FORMAT::nChw16c || fmt == memory::FORMAT::nCdhw16c)
+    {
+        return 16;
+    }
+#else
+    if (md.data.ndims == 4)
+    {
+        if (mkldnn_md_matches_format_tag(md, memory::FORMAT::nChw8c))
+        {
+            return 8;
+        }
+        if (mkldnn_md_matches_format_tag(md, memory::FORMAT::nChw16c))
+        {
+            return 16;
+        }
+    }
+    else if (md.data.ndims == 5)
+    {
+        if (mkldnn_md_matches_format_tag(md, memory::FORMAT::nCdhw8c))
+        {
+            return 8;
+        }
+        if (mkldnn_md_matches_format_tag(md, memory::FORMAT::nCdhw16c))
+        {
+            return 16;
+        }
+    }
+#endif
+    return 0;
+}
+
+void runtime::cpu::mkldnn_utils::blocked_pad_view(const Node* node,
+                                                  Shape& arg_shape,
+                                                  Shape& out_shape,
+                                                  CoordinateDiff& padding_below,
+                                                  CoordinateDiff& padding_above)
+{
+    auto tvl = dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(
+        node->get_output_tensor_ptr(0)->get_tensor_layout());
+    size_t block =
+        tvl && tvl->is_mkldnn_layout() ? get_mkldnn_channel_block(tvl->get_mkldnn_md()) : 0;
+    if (block == 0)
+    {
+        return;
+    }
+
+    auto view = [block](const Shape& shape) {
+        Shape blocked{shape[0], shape[1] / block};
+        blocked.insert(blocked.end(), shape.begin() + 2, shape.end());
+        blocked.push_back(block);
+        return blocked;
+    };
+    arg_shape = view(arg_shape);
+    out_shape = view(out_shape);
+    padding_below.push_back(0);
+    padding_above.push_back(0);
+}
+
 bool runtime::cpu::mkldnn_utils::use_mkldnn_kernel(const ngraph::Node* node)
 {
     if (auto* op_node = dynamic_cast<const ngraph::op::Op*>(node))
@@ -246,6 +312,28 @@ mkldnn::algorithm runtime::cpu::mkldnn_utils::get_conv_algo()
     return mkldnn::algorithm::convolution_direct;
 }
 
+mkldnn::algorithm runtime::cpu::mkldnn_utils::get_conv_algo(const ngraph::Node* node)
+{
+    using ConvolutionImpl = ngraph::runtime::cpu::CPUOpAnnotations::ConvolutionImpl;
+    auto impl = ConvolutionImpl::unset;
+    if (auto* op_node = dynamic_cast<const ngraph::op::Op*>(node))
+    {
+        if (auto op_annotations = op_node->get_op_annotations())
+        {
+            impl = static_pointer_cast<ngraph::runtime::cpu::CPUOpAnnotations>(op_annotations)
+                       ->get_convolution_impl();
+        }
+    }
+    switch (impl)
+    {
+    case ConvolutionImpl::winograd: return mkldnn::algorithm::convolution_winograd;
+    case ConvolutionImpl::direct:
+    case ConvolutionImpl::gemm: return mkldnn::algorithm::convolution_direct;
+    case ConvolutionImpl::unset: break;
+    }
+    return get_conv_algo();
+}
+
 bool runtime::cpu::mkldnn_utils::can_use_mkldnn_batchnorm_bprop(const ngraph::Node* node)
 {
     auto input_rank = node->get_input_shape(2).size();
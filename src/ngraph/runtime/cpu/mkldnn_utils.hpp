@@ -147,6 +147,18 @@ namespace ngraph
                                              const AxisVector& axis_list);
                 bool is_mkldnn_filter_format(mkldnn::memory::FORMAT fmt);
                 bool is_mkldnn_blocked_data_format(mkldnn::memory::FORMAT fmt);
+                /// \brief The channel block of nChw8c, nChw16c, nCdhw8c and nCdhw16c
+                ///        descriptors, or 0 for any other layout.
+                size_t get_mkldnn_channel_block(const mkldnn::memory::desc& md);
+                /// \brief Rewrites the shapes and paddings of a Pad whose output is channel
+                ///        blocked into those of a Pad of the row-major view
+                ///        [N, C / block, spatial..., block] of its buffers. The shapes and
+                ///        paddings of other Pads are left alone.
+                void blocked_pad_view(const Node* node,
+                                      Shape& arg_shape,
+                                      Shape& out_shape,
+                                      CoordinateDiff& padding_below,
+                                      CoordinateDiff& padding_above);
                 bool can_use_mkldnn_batchnorm_fprop(const ngraph::Node* node);
                 bool can_use_mkldnn_batchnorm_bprop(const ngraph::Node* node);
 
@@ -161,6 +173,9 @@ namespace ngraph
                 // tile sizes). Training - Uses F(4x4, 3x3) winograd.
                 //
                 mkldnn::algorithm get_conv_algo();
+                /// \brief The algorithm of forward convolution `node`: the one the layout pass
+                ///        tuned it for (see MKLDNNConvTuner), or get_conv_algo() if untuned.
+                mkldnn::algorithm get_conv_algo(const ngraph::Node* node);
 
                 // Placeholder for when "auto" support is added for deconv
                 mkldnn::algorithm get_deconv_algo();
@@ -0,0 +1,69 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/distributed.hpp"
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Starts an AllReduce of its argument without waiting for it to complete.
+        ///
+        /// The output is the buffer the reduced values are written to; it may only be read through
+        /// the AllReduceWait that consumes it.
+        class AllReduceStart : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"AllReduceStart", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPU_BACKEND_API AllReduceStart(const Output<Node>& arg,
+                                           reduction::Type reduce_type = reduction::Type::SUM);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            reduction::Type get_reduce_type() const { return m_reduce_type; }
+
+        private:
+            reduction::Type m_reduce_type;
+        };
+
+        /// \brief Waits for the AllReduce started by an AllReduceStart and returns its result.
+        ///
+        /// The second argument is the input of the AllReduceStart. It is consumed here so that
+        /// its buffer stays live, and is not reused, while the collective is still reading it.
+        class AllReduceWait : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"AllReduceWait", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPU_BACKEND_API AllReduceWait(const Output<Node>& start, const Output<Node>& arg);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+        };
+    }
+}
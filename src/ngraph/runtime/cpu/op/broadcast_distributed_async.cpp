@@ -0,0 +1,71 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/broadcast_distributed_async.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::BroadcastDistributedStart::type_info;
+
+op::BroadcastDistributedStart::BroadcastDistributedStart(const Output<Node>& arg, int64_t root_id)
+    : Op({arg})
+    , m_root_id(root_id)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::BroadcastDistributedStart::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(0).is_dynamic() ||
+                              get_input_element_type(0) == element::f32 ||
+                              get_input_element_type(0) == element::f64,
+                          "Only element types f32 and f64 are supported (argument element type: ",
+                          get_input_element_type(0),
+                          ").");
+
+    set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+}
+
+shared_ptr<Node> op::BroadcastDistributedStart::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<BroadcastDistributedStart>(new_args.at(0), m_root_id);
+}
+
+constexpr NodeTypeInfo op::BroadcastDistributedWait::type_info;
+
+op::BroadcastDistributedWait::BroadcastDistributedWait(const Output<Node>& start)
+    : Op({start})
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::BroadcastDistributedWait::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this,
+                          is_type<BroadcastDistributedStart>(input_value(0).get_node()),
+                          "Argument must be a BroadcastDistributedStart");
+
+    set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+}
+
+shared_ptr<Node> op::BroadcastDistributedWait::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<BroadcastDistributedWait>(new_args.at(0));
+}
@@ -0,0 +1,67 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Starts a BroadcastDistributed of its argument without waiting for it to
+        ///        complete.
+        ///
+        /// The output is the buffer the broadcast values are written to; it may only be read
+        /// through the BroadcastDistributedWait that consumes it.
+        class BroadcastDistributedStart : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"BroadcastDistributedStart", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPU_BACKEND_API BroadcastDistributedStart(const Output<Node>& arg,
+                                                      int64_t root_id = 0);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            int64_t get_root_id() const { return m_root_id; }
+
+        private:
+            int64_t m_root_id;
+        };
+
+        /// \brief Waits for the broadcast started by a BroadcastDistributedStart and returns
+        ///        its result.
+        class BroadcastDistributedWait : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"BroadcastDistributedWait", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPU_BACKEND_API BroadcastDistributedWait(const Output<Node>& start);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+        };
+    }
+}
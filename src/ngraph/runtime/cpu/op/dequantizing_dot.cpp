@@ -0,0 +1,111 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+
+#include "ngraph/runtime/cpu/op/dequantizing_dot.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::DequantizingDot::type_info;
+
+shared_ptr<op::LowPrecisionWeights> op::LowPrecisionWeights::from_dense(
+    const float* data, const Shape& shape, const element::Type& type)
+{
+    NGRAPH_CHECK(shape.size() == 2, "Low precision weights must be a matrix");
+    NGRAPH_CHECK(type == element::i8 || type == element::f16,
+                 "Unsupported low precision weight type ",
+                 type);
+
+    size_t k = shape[0];
+    size_t n = shape[1];
+    auto weights = make_shared<LowPrecisionWeights>();
+    weights->element_type = type;
+    weights->shape = shape;
+    weights->scales.assign(n, 1.0f);
+    if (type == element::i8)
+    {
+        weights->i8_data.resize(k * n);
+        for (size_t c = 0; c < n; c++)
+        {
+            float max_abs = 0.0f;
+            for (size_t r = 0; r < k; r++)
+            {
+                max_abs = max(max_abs, fabs(data[r * n + c]));
+            }
+            float scale = max_abs > 0.0f ? max_abs / 127.0f : 1.0f;
+            weights->scales[c] = scale;
+            for (size_t r = 0; r < k; r++)
+            {
+                // Round half to even, as op::Quantize does by default
+                float q = nearbyint(data[r * n + c] / scale);
+                weights->i8_data[c * k + r] = static_cast<int8_t>(min(127.0f, max(-127.0f, q)));
+            }
+        }
+    }
+    else
+    {
+        weights->f16_data.resize(k * n);
+        for (size_t c = 0; c < n; c++)
+        {
+            for (size_t r = 0; r < k; r++)
+            {
+                weights->f16_data[c * k + r] = float16(data[r * n + c]);
+            }
+        }
+    }
+    return weights;
+}
+
+op::DequantizingDot::DequantizingDot(const Output<Node>& arg,
+                                     const shared_ptr<const LowPrecisionWeights>& weights)
+    : Op({arg})
+    , m_weights(weights)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::DequantizingDot::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this, m_weights != nullptr, "Weights must be given.");
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(0).compatible(element::f32),
+                          "Argument element type must be f32, got ",
+                          get_input_element_type(0),
+                          ".");
+
+    const PartialShape& arg_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, arg_shape.is_static(), "Argument shape must be static.");
+
+    Shape shape = arg_shape.to_shape();
+    NODE_VALIDATION_CHECK(this,
+                          !shape.empty() && shape.back() == m_weights->shape[0],
+                          "Argument shape ",
+                          shape,
+                          " does not match weights shape ",
+                          m_weights->shape,
+                          ".");
+    shape.back() = m_weights->shape[1];
+    set_output_type(0, element::f32, shape);
+}
+
+shared_ptr<Node> op::DequantizingDot::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<DequantizingDot>(new_args.at(0), m_weights);
+}
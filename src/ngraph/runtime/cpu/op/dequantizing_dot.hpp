@@ -0,0 +1,80 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+#include "ngraph/type/float16.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief A [K, N] f32 matrix stored as i8 or f16, transposed to [N, K] so that each
+        ///        output channel is contiguous.
+        ///
+        /// Column `n` of the original matrix is `scales[n] * data[n * K + k]`. i8 weights are
+        /// quantized symmetrically per channel, with `scales[n] = max_k |w[k, n]| / 127`; f16
+        /// weights have unit scales.
+        struct LowPrecisionWeights
+        {
+            element::Type element_type;
+            Shape shape;
+            std::vector<int8_t> i8_data;
+            std::vector<float16> f16_data;
+            std::vector<float> scales;
+
+            CPU_BACKEND_API
+            static std::shared_ptr<LowPrecisionWeights>
+                from_dense(const float* data, const Shape& shape, const element::Type& type);
+        };
+
+        /// \brief Dot of an f32 tensor of shape [..., K] with constant low precision weights of
+        ///        shape [K, N], producing f32 [..., N]. The weights are dequantized inside the
+        ///        kernel and never materialized in f32.
+        class DequantizingDot : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"DequantizingDot", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            /// \brief Constructs a dequantizing dot operation.
+            ///
+            /// \param arg The f32 left-hand argument.
+            /// \param weights The right-hand weights.
+            DequantizingDot(const Output<Node>& arg,
+                            const std::shared_ptr<const LowPrecisionWeights>& weights);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            const std::shared_ptr<const LowPrecisionWeights>& get_weights() const
+            {
+                return m_weights;
+            }
+
+        private:
+            std::shared_ptr<const LowPrecisionWeights> m_weights;
+        };
+    }
+}
@@ -29,14 +29,23 @@ op::Dropout::Dropout(const Output<Node>& input,
                      const Output<Node>& gm_const,
                      const Output<Node>& use_seed,
                      const Output<Node>& seed,
-                     const Output<Node>& keep_prob)
+                     const Output<Node>& keep_prob,
+                     bool packed_mask)
     : Op({input, gm_const, use_seed, seed, keep_prob})
+    , m_packed_mask(packed_mask)
 {
     constructor_validate_and_infer_types();
 
     set_output_size(2);
     set_output_type(0, get_input_element_type(0), input.get_shape());
-    set_output_type(1, get_input_element_type(0), input.get_shape());
+    if (m_packed_mask)
+    {
+        set_output_type(1, element::u32, Shape{(shape_size(input.get_shape()) + 31) / 32});
+    }
+    else
+    {
+        set_output_type(1, get_input_element_type(0), input.get_shape());
+    }
 }
 
 shared_ptr<Node> op::Dropout::copy_with_new_args(const NodeVector& new_args) const
@@ -46,8 +55,12 @@ shared_ptr<Node> op::Dropout::copy_with_new_args(const NodeVector& new_args) con
         throw ngraph_error("Incorrect number of new arguments");
     }
 
-    return make_shared<Dropout>(
-        new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), new_args.at(4));
+    return make_shared<Dropout>(new_args.at(0),
+                                new_args.at(1),
+                                new_args.at(2),
+                                new_args.at(3),
+                                new_args.at(4),
+                                m_packed_mask);
 }
 
 bool op::Dropout::get_use_seed() const
@@ -73,3 +86,24 @@ uint64_t op::Dropout::get_seed() const
     }
     return seed;
 }
+
+constexpr NodeTypeInfo op::DropoutMaskMultiply::type_info;
+
+op::DropoutMaskMultiply::DropoutMaskMultiply(const Output<Node>& arg, const Output<Node>& mask)
+    : Op({arg, mask})
+{
+    constructor_validate_and_infer_types();
+
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(1) == element::u32 &&
+                              get_input_shape(1) ==
+                                  Shape{(shape_size(get_input_shape(0)) + 31) / 32},
+                          "Mask must hold one bit per element of the argument in u32 words");
+    set_output_type(0, get_input_element_type(0), get_input_shape(0));
+}
+
+shared_ptr<Node> op::DropoutMaskMultiply::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<DropoutMaskMultiply>(new_args.at(0), new_args.at(1));
+}
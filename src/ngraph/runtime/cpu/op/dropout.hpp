@@ -34,11 +34,30 @@ namespace ngraph
                     const Output<Node>& gm_const,
                     const Output<Node>& use_seed,
                     const Output<Node>& seed,
-                    const Output<Node>& keep_prob); // keep_prob = 1 - dropout_prob
+                    const Output<Node>& keep_prob, // keep_prob = 1 - dropout_prob
+                    bool packed_mask = false);
 
             bool get_use_seed() const;
             uint64_t get_seed() const;
             double get_keep_prob() const;
+            /// \brief True if output 1 holds the mask one bit per element in u32 words, which
+            ///        only DropoutMaskMultiply reads, instead of as a tensor like the input.
+            bool get_packed_mask() const { return m_packed_mask; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        private:
+            bool m_packed_mask;
+        };
+
+        /// \brief Multiplies a tensor by the packed mask of a Dropout with the same shape.
+        class DropoutMaskMultiply : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"DropoutMaskMultiply", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            DropoutMaskMultiply(const Output<Node>& arg, const Output<Node>& mask);
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
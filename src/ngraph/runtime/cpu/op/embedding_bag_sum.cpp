@@ -0,0 +1,55 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/embedding_bag_sum.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::EmbeddingBagSum::type_info;
+
+op::EmbeddingBagSum::EmbeddingBagSum(const Output<Node>& indices, const Output<Node>& weights)
+    : Op({indices, weights})
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::EmbeddingBagSum::validate_and_infer_types()
+{
+    const PartialShape& indices_shape = get_input_partial_shape(0);
+    const PartialShape& weights_shape = get_input_partial_shape(1);
+
+    NODE_VALIDATION_CHECK(this,
+                          indices_shape.rank().compatible(2),
+                          "Indices are expected to be a matrix (indices shape: ",
+                          indices_shape,
+                          ").");
+    NODE_VALIDATION_CHECK(this,
+                          weights_shape.rank().compatible(2),
+                          "Weights are expected to be a matrix (weights shape: ",
+                          weights_shape,
+                          ").");
+
+    Dimension bags = indices_shape.rank().is_static() ? indices_shape[0] : Dimension::dynamic();
+    Dimension width = weights_shape.rank().is_static() ? weights_shape[1] : Dimension::dynamic();
+    set_output_type(0, get_input_element_type(1), PartialShape{bags, width});
+}
+
+shared_ptr<Node> op::EmbeddingBagSum::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<EmbeddingBagSum>(new_args.at(0), new_args.at(1));
+}
@@ -0,0 +1,50 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Sums the embedding rows selected by each row of an index matrix.
+        ///
+        /// For indices of shape [B, K] and weights of shape [V, D], the output has shape [B, D]
+        /// and row b is the sum of weights[indices[b, k]] over k. This is EmbeddingLookup
+        /// followed by a Sum over axis 1, without materializing the [B, K, D] lookup result.
+        class EmbeddingBagSum : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"EmbeddingBagSum", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            /// \brief Constructs an EmbeddingBagSum operation.
+            ///
+            /// \param indices The [B, K] matrix of row indices into the weights.
+            /// \param weights The [V, D] embedding table.
+            CPU_BACKEND_API EmbeddingBagSum(const Output<Node>& indices,
+                                            const Output<Node>& weights);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+        };
+    }
+}
@@ -0,0 +1,170 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::FusedElementwise::type_info;
+
+op::FusedElementwise::FusedElementwise(const OutputVector& args,
+                                       const vector<AxisSet>& broadcast_axes,
+                                       const vector<Instruction>& program,
+                                       const Shape& shape,
+                                       const AxisSet& reduction_axes)
+    : Op(args)
+    , m_broadcast_axes(broadcast_axes)
+    , m_program(program)
+    , m_shape(shape)
+    , m_reduction_axes(reduction_axes)
+{
+    constructor_validate_and_infer_types();
+}
+
+bool op::FusedElementwise::is_unary(Opcode opcode)
+{
+    switch (opcode)
+    {
+    case Opcode::Abs:
+    case Opcode::Exp:
+    case Opcode::Log:
+    case Opcode::Negative:
+    case Opcode::Relu:
+    case Opcode::Sigmoid:
+    case Opcode::Sqrt:
+    case Opcode::Tanh: return true;
+    case Opcode::Add:
+    case Opcode::Divide:
+    case Opcode::Maximum:
+    case Opcode::Minimum:
+    case Opcode::Multiply:
+    case Opcode::Subtract: return false;
+    }
+    return false;
+}
+
+void op::FusedElementwise::validate_and_infer_types()
+{
+    size_t input_count = get_input_size();
+
+    NODE_VALIDATION_CHECK(this,
+                          m_broadcast_axes.size() == input_count,
+                          "Number of broadcast axis sets (",
+                          m_broadcast_axes.size(),
+                          ") does not match the number of inputs (",
+                          input_count,
+                          ").");
+    NODE_VALIDATION_CHECK(this, !m_program.empty(), "Program must not be empty.");
+
+    element::Type element_type = element::dynamic;
+    for (size_t i = 0; i < input_count; i++)
+    {
+        NODE_VALIDATION_CHECK(
+            this,
+            element::Type::merge(element_type, element_type, get_input_element_type(i)),
+            "Argument element types are inconsistent.");
+
+        for (auto axis : m_broadcast_axes[i])
+        {
+            NODE_VALIDATION_CHECK(this,
+                                  axis < m_shape.size(),
+                                  "Broadcast axis ",
+                                  axis,
+                                  " of input ",
+                                  i,
+                                  " exceeds the program rank (",
+                                  m_shape.size(),
+                                  ").");
+        }
+
+        const PartialShape& arg_shape = get_input_partial_shape(i);
+        if (arg_shape.is_static())
+        {
+            Shape expected_shape;
+            for (size_t axis = 0; axis < m_shape.size(); axis++)
+            {
+                if (m_broadcast_axes[i].count(axis) == 0)
+                {
+                    expected_shape.push_back(m_shape[axis]);
+                }
+            }
+            NODE_VALIDATION_CHECK(this,
+                                  arg_shape.to_shape() == expected_shape,
+                                  "Shape of input ",
+                                  i,
+                                  " (",
+                                  arg_shape,
+                                  ") does not match the program shape ",
+                                  m_shape,
+                                  " with broadcast axes ",
+                                  m_broadcast_axes[i],
+                                  ".");
+        }
+    }
+
+    NODE_VALIDATION_CHECK(this,
+                          element_type.is_dynamic() || element_type.is_real(),
+                          "Arguments must have a floating point element type (element type: ",
+                          element_type,
+                          ").");
+
+    for (size_t i = 0; i < m_program.size(); i++)
+    {
+        auto& instruction = m_program[i];
+        NODE_VALIDATION_CHECK(this,
+                              instruction.arg0 < input_count + i &&
+                                  (is_unary(instruction.opcode) ||
+                                   instruction.arg1 < input_count + i),
+                              "Instruction ",
+                              i,
+                              " reads an operand that is not yet defined.");
+    }
+
+    Shape output_shape;
+    for (size_t axis = 0; axis < m_shape.size(); axis++)
+    {
+        if (m_reduction_axes.count(axis) == 0)
+        {
+            NODE_VALIDATION_CHECK(this,
+                                  m_reduction_axes.empty() ||
+                                      *m_reduction_axes.begin() > axis,
+                                  "Reduction axes ",
+                                  m_reduction_axes,
+                                  " are not the trailing axes of the program shape ",
+                                  m_shape,
+                                  ".");
+            output_shape.push_back(m_shape[axis]);
+        }
+    }
+    NODE_VALIDATION_CHECK(this,
+                          output_shape.size() + m_reduction_axes.size() == m_shape.size(),
+                          "Reduction axes ",
+                          m_reduction_axes,
+                          " exceed the program rank (",
+                          m_shape.size(),
+                          ").");
+
+    set_output_type(0, element_type, output_shape);
+}
+
+shared_ptr<Node> op::FusedElementwise::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<FusedElementwise>(
+        as_output_vector(new_args), m_broadcast_axes, m_program, m_shape, m_reduction_axes);
+}
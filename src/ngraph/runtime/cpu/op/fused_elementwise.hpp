@@ -0,0 +1,99 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief A subgraph of elementwise operations evaluated in a single loop over the output.
+        ///
+        /// The subgraph is stored as a straight-line program. Operand indices below
+        /// `get_input_size()` refer to the op's inputs; index `get_input_size() + i` refers to the
+        /// result of instruction `i`. The last instruction produces the output. An input with
+        /// non-empty broadcast axes is read as if broadcast to the program shape along those axes.
+        /// When reduction axes are given, the result of the last instruction is summed over
+        /// them; they must be the trailing axes of the program shape.
+        class FusedElementwise : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"FusedElementwise", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            enum class Opcode
+            {
+                Abs,
+                Add,
+                Divide,
+                Exp,
+                Log,
+                Maximum,
+                Minimum,
+                Multiply,
+                Negative,
+                Relu,
+                Sigmoid,
+                Sqrt,
+                Subtract,
+                Tanh
+            };
+
+            struct Instruction
+            {
+                Opcode opcode;
+                size_t arg0;
+                size_t arg1; // Ignored for unary opcodes
+            };
+
+            /// \brief Constructs a fused elementwise operation.
+            ///
+            /// \param args The inputs read by the program.
+            /// \param broadcast_axes For each input, the output axes it is broadcast along.
+            /// \param program The instructions, in evaluation order.
+            /// \param shape The shape the program is evaluated over.
+            /// \param reduction_axes The trailing axes of `shape` the result is summed over.
+            FusedElementwise(const OutputVector& args,
+                             const std::vector<AxisSet>& broadcast_axes,
+                             const std::vector<Instruction>& program,
+                             const Shape& shape,
+                             const AxisSet& reduction_axes = AxisSet{});
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            const std::vector<AxisSet>& get_broadcast_axes() const { return m_broadcast_axes; }
+            const std::vector<Instruction>& get_program() const { return m_program; }
+            const Shape& get_program_shape() const { return m_shape; }
+            const AxisSet& get_reduction_axes() const { return m_reduction_axes; }
+            static bool is_unary(Opcode opcode);
+
+        private:
+            std::vector<AxisSet> m_broadcast_axes;
+            std::vector<Instruction> m_program;
+            Shape m_shape;
+            AxisSet m_reduction_axes;
+        };
+    }
+}
@@ -0,0 +1,76 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/quantized_add.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::QuantizedAdd::type_info;
+
+op::QuantizedAdd::QuantizedAdd(const Output<Node>& input0,
+                               const Output<Node>& input1,
+                               float input0_scale,
+                               float input1_scale,
+                               float output_scale)
+    : Op({input0, input1})
+    , m_input0_scale(input0_scale)
+    , m_input1_scale(input1_scale)
+    , m_output_scale(output_scale)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::QuantizedAdd::validate_and_infer_types()
+{
+    const element::Type& element_type = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this,
+                          element_type.is_dynamic() || element_type == element::i8 ||
+                              element_type == element::u8,
+                          "Inputs are expected to be i8 or u8 (element type: ",
+                          element_type,
+                          ").");
+    NODE_VALIDATION_CHECK(this,
+                          element_type.compatible(get_input_element_type(1)),
+                          "Inputs do not have the same element type (input0 element type: ",
+                          element_type,
+                          ", input1 element type: ",
+                          get_input_element_type(1),
+                          ").");
+
+    PartialShape shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this,
+                          PartialShape::merge_into(shape, get_input_partial_shape(1)),
+                          "Inputs do not have the same shape (input0 shape: ",
+                          get_input_partial_shape(0),
+                          ", input1 shape: ",
+                          get_input_partial_shape(1),
+                          ").");
+    NODE_VALIDATION_CHECK(this,
+                          m_output_scale > 0.0f,
+                          "Output scale must be positive (output scale: ",
+                          m_output_scale,
+                          ").");
+
+    set_output_type(0, element_type, shape);
+}
+
+shared_ptr<Node> op::QuantizedAdd::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<QuantizedAdd>(
+        new_args.at(0), new_args.at(1), m_input0_scale, m_input1_scale, m_output_scale);
+}
@@ -0,0 +1,60 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Adds two 8-bit tensors quantized with zero zero points and requantizes the
+        ///        sum to the output scale.
+        ///
+        /// Computes saturate(round((input0 * input0_scale + input1 * input1_scale) /
+        /// output_scale)) with rounding to nearest even, which is what
+        /// Quantize(Add(Dequantize(input0), Dequantize(input1))) computes without leaving the
+        /// 8-bit type. Both inputs and the output have the same shape and element type, i8
+        /// or u8.
+        class QuantizedAdd : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"QuantizedAdd", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPU_BACKEND_API QuantizedAdd(const Output<Node>& input0,
+                                         const Output<Node>& input1,
+                                         float input0_scale,
+                                         float input1_scale,
+                                         float output_scale);
+
+            void validate_and_infer_types() override;
+
+            float get_input0_scale() const { return m_input0_scale; }
+            float get_input1_scale() const { return m_input1_scale; }
+            float get_output_scale() const { return m_output_scale; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        private:
+            float m_input0_scale;
+            float m_input1_scale;
+            float m_output_scale;
+        };
+    }
+}
@@ -98,9 +98,12 @@ op::Rnn::Rnn(const Output<Node>& src_layer,
         throw ngraph_error("src_layer size is not equal t*n*c");
     }
 
-    if ((bias.get_shape()[0] / (m_direction * m_num_fused_layers)) !=
-            (weights_layer.get_shape()[1]) ||
-        (bias.get_shape()[0] / (m_direction * m_num_fused_layers)) != (weights_iter.get_shape()[1]))
+    auto bias_gates_per_cell = m_rnntype == runtime::cpu::rnn_utils::gru_linear_before_reset
+                                   ? m_num_gates_per_cell + 1
+                                   : m_num_gates_per_cell;
+    auto bias_size = bias.get_shape()[0] / (m_direction * m_num_fused_layers);
+    if (bias_size != m_dst_layer_feature_size * bias_gates_per_cell ||
+        bias_size != m_dst_iter_feature_size * bias_gates_per_cell)
     {
         throw ngraph_error("bias and weights_shape are not compatible");
     }
@@ -200,9 +203,12 @@ op::Rnn::Rnn(const Output<Node>& src_layer,
         throw ngraph_error("src_layer size is not equal t*n*c");
     }
 
-    if ((bias.get_shape()[0] / (m_direction * m_num_fused_layers)) !=
-            (weights_layer.get_shape()[1]) ||
-        (bias.get_shape()[0] / (m_direction * m_num_fused_layers)) != (weights_iter.get_shape()[1]))
+    auto bias_gates_per_cell = m_rnntype == runtime::cpu::rnn_utils::gru_linear_before_reset
+                                   ? m_num_gates_per_cell + 1
+                                   : m_num_gates_per_cell;
+    auto bias_size = bias.get_shape()[0] / (m_direction * m_num_fused_layers);
+    if (bias_size != m_dst_layer_feature_size * bias_gates_per_cell ||
+        bias_size != m_dst_iter_feature_size * bias_gates_per_cell)
     {
         throw ngraph_error("bias and weights_shape are not compatible");
     }
@@ -32,7 +32,10 @@ namespace ngraph
                 {
                     vanilla_rnn,
                     vanilla_gru,
-                    vanilla_lstm
+                    vanilla_lstm,
+                    // GRU applying the recurrent weights before the reset gate. It has an extra
+                    // bias for the recurrent part of the candidate gate.
+                    gru_linear_before_reset
                 };
             }
         }
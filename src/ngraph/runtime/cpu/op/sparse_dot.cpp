@@ -0,0 +1,88 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <limits>
+
+#include "ngraph/runtime/cpu/op/sparse_dot.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::SparseDot::type_info;
+
+shared_ptr<op::CSRWeights> op::CSRWeights::from_dense(const float* data, const Shape& shape)
+{
+    NGRAPH_CHECK(shape.size() == 2, "CSR weights must be a matrix");
+    NGRAPH_CHECK(shape[1] <= numeric_limits<uint32_t>::max(), "Too many columns for CSR weights");
+
+    auto weights = make_shared<CSRWeights>();
+    weights->shape = shape;
+    weights->row_offsets.reserve(shape[0] + 1);
+    weights->row_offsets.push_back(0);
+    for (size_t k = 0; k < shape[0]; k++)
+    {
+        const float* row = data + k * shape[1];
+        for (size_t n = 0; n < shape[1]; n++)
+        {
+            if (row[n] != 0.0f)
+            {
+                weights->columns.push_back(static_cast<uint32_t>(n));
+                weights->values.push_back(row[n]);
+            }
+        }
+        weights->row_offsets.push_back(weights->values.size());
+    }
+    weights->columns.shrink_to_fit();
+    weights->values.shrink_to_fit();
+    return weights;
+}
+
+op::SparseDot::SparseDot(const Output<Node>& arg, const shared_ptr<const CSRWeights>& weights)
+    : Op({arg})
+    , m_weights(weights)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::SparseDot::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this, m_weights != nullptr, "Weights must be given.");
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(0).compatible(element::f32),
+                          "Argument element type must be f32, got ",
+                          get_input_element_type(0),
+                          ".");
+
+    const PartialShape& arg_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, arg_shape.is_static(), "Argument shape must be static.");
+
+    Shape shape = arg_shape.to_shape();
+    NODE_VALIDATION_CHECK(this,
+                          !shape.empty() && shape.back() == m_weights->shape[0],
+                          "Argument shape ",
+                          shape,
+                          " does not match weights shape ",
+                          m_weights->shape,
+                          ".");
+    shape.back() = m_weights->shape[1];
+    set_output_type(0, element::f32, shape);
+}
+
+shared_ptr<Node> op::SparseDot::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<SparseDot>(new_args.at(0), m_weights);
+}
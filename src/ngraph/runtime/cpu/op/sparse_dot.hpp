@@ -0,0 +1,70 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief A [K, N] f32 matrix in compressed sparse row format.
+        ///
+        /// The nonzeros of row `k` are `values[row_offsets[k]..row_offsets[k + 1])`, in the
+        /// columns given by the same range of `columns`.
+        struct CSRWeights
+        {
+            Shape shape;
+            std::vector<size_t> row_offsets;
+            std::vector<uint32_t> columns;
+            std::vector<float> values;
+
+            size_t get_nonzero_count() const { return values.size(); }
+            CPU_BACKEND_API
+            static std::shared_ptr<CSRWeights> from_dense(const float* data, const Shape& shape);
+        };
+
+        /// \brief Dot of an f32 tensor of shape [..., K] with constant sparse weights of shape
+        ///        [K, N], producing [..., N].
+        class SparseDot : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"SparseDot", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            /// \brief Constructs a sparse dot operation.
+            ///
+            /// \param arg The dense left-hand argument.
+            /// \param weights The right-hand weights.
+            SparseDot(const Output<Node>& arg, const std::shared_ptr<const CSRWeights>& weights);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            const std::shared_ptr<const CSRWeights>& get_weights() const { return m_weights; }
+        private:
+            std::shared_ptr<const CSRWeights> m_weights;
+        };
+    }
+}
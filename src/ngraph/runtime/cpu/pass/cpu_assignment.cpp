@@ -38,6 +38,7 @@
 #include "ngraph/op/fused/conv_fused.hpp"
 #include "ngraph/op/fused/gelu.hpp"
 #include "ngraph/op/fused/group_conv.hpp"
+#include "ngraph/op/fused/optimizer_update.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/lrn.hpp"
 #include "ngraph/op/max_pool.hpp"
@@ -51,8 +52,10 @@
 #include "ngraph/op/softmax.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/op/allreduce_async.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
+#include "ngraph/runtime/cpu/op/broadcast_distributed_async.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/deconv.hpp"
@@ -105,7 +108,8 @@ namespace ngraph
                     if ((node->get_input_element_type(0) == element::f32 ||
                          node->get_input_element_type(0) == element::i8 ||
                          node->get_input_element_type(0) == element::u8) &&
-                        ((node->get_input_shape(0)).size() == 4 ||
+                        ((node->get_input_shape(0)).size() == 5 ||
+                         (node->get_input_shape(0)).size() == 4 ||
                          (node->get_input_shape(0)).size() == 2))
                     {
                         // MKLDNN seems to throw an exception when given tensors with 0-length
@@ -751,12 +755,12 @@ namespace ngraph
                     (void)external_function;
                     auto gelu = static_cast<ngraph::op::Gelu*>(node);
 
+                    // MKLDNN's gelu is the tanh approximation while op::Gelu uses erf, so f32
+                    // runs the native kernel from isa.hpp instead.
                     if (node->get_input_element_type(0) == element::f32)
                     {
                         auto op_annotations =
                             std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
-                        op_annotations->set_mkldnn_op(true);
-                        runtime::cpu::mkldnn_utils::assign_mkldnn_kernel(node);
                         if (get_user_count(node->get_argument(0).get()) == 1)
                         {
                             // Safe to overwrite input
@@ -1010,6 +1014,56 @@ namespace ngraph
                         convert->set_op_annotations(op_annotations);
                     }
                 }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::SGDMomentumUpdate)
+                {
+                    (void)external_function;
+                    // The kernel updates param and velocity in place when their buffers die here
+                    auto op_annotations =
+                        std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+                    op_annotations->add_in_place_oi_pair({0, 0, true});
+                    op_annotations->add_in_place_oi_pair({1, 2, true});
+                    static_cast<ngraph::op::SGDMomentumUpdate*>(node)->set_op_annotations(
+                        op_annotations);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::AdamUpdate)
+                {
+                    (void)external_function;
+                    // The kernel updates param, m and v in place when their buffers die here
+                    auto op_annotations =
+                        std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+                    op_annotations->add_in_place_oi_pair({0, 0, true});
+                    op_annotations->add_in_place_oi_pair({1, 2, true});
+                    op_annotations->add_in_place_oi_pair({2, 3, true});
+                    static_cast<ngraph::op::AdamUpdate*>(node)->set_op_annotations(op_annotations);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::AllReduceWait)
+                {
+                    (void)external_function;
+                    // The reduced values are already in the start's output
+                    auto op_annotations =
+                        std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+                    op_annotations->add_in_place_oi_pair({0, 0, false});
+                    static_cast<ngraph::op::AllReduceWait*>(node)->set_op_annotations(
+                        op_annotations);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::BroadcastDistributedWait)
+                {
+                    (void)external_function;
+                    // The broadcast values are already in the start's output
+                    auto op_annotations =
+                        std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+                    op_annotations->add_in_place_oi_pair({0, 0, false});
+                    static_cast<ngraph::op::BroadcastDistributedWait*>(node)->set_op_annotations(
+                        op_annotations);
+                }
             }
         }
     }
@@ -1021,9 +1075,13 @@ static const runtime::cpu::pass::AssignOpMap s_dispatcher{
     {TI(ngraph::op::Add), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::Add>},
     {TI(ngraph::op::Concat), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::Concat>},
     {TI(ngraph::op::Convert), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::Convert>},
+    {TI(ngraph::op::AllReduceWait),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::AllReduceWait>},
     {TI(ngraph::op::AvgPool), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::AvgPool>},
     {TI(ngraph::op::AvgPoolBackprop),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::AvgPoolBackprop>},
+    {TI(ngraph::op::BroadcastDistributedWait),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::BroadcastDistributedWait>},
     {TI(ngraph::op::BatchNormTraining),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::BatchNormTraining>},
     {TI(ngraph::op::BatchNormInference),
@@ -1104,6 +1162,10 @@ static const runtime::cpu::pass::AssignOpMap s_dispatcher{
     {TI(ngraph::op::ScatterAdd),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::ScatterAdd>},
     {TI(ngraph::op::Gelu), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::Gelu>},
+    {TI(ngraph::op::SGDMomentumUpdate),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::SGDMomentumUpdate>},
+    {TI(ngraph::op::AdamUpdate),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::AdamUpdate>},
     {TI(ngraph::op::GeluBackprop),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::GeluBackprop>},
 };
@@ -0,0 +1,145 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/op/broadcast_distributed.hpp"
+#include "ngraph/runtime/cpu/op/allreduce_async.hpp"
+#include "ngraph/runtime/cpu/op/broadcast_distributed_async.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_async_allreduce.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Lower is scheduled earlier among the ops that are ready
+static int get_priority(const Node* node)
+{
+    if (is_type<op::AllReduceStart>(node) || is_type<op::BroadcastDistributedStart>(node))
+    {
+        return 0;
+    }
+    if (is_type<op::AllReduceWait>(node) || is_type<op::BroadcastDistributedWait>(node))
+    {
+        return 2;
+    }
+    return 1;
+}
+
+list<shared_ptr<Node>>
+    runtime::cpu::pass::CPUAsyncAllReduce::schedule(const list<shared_ptr<Node>>& ordered_ops,
+                                                    bool include_control_deps)
+{
+    vector<shared_ptr<Node>> nodes(ordered_ops.begin(), ordered_ops.end());
+    unordered_map<Node*, size_t> indices;
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        indices[nodes[i].get()] = i;
+    }
+
+    // Number of unscheduled arguments of each node, and the nodes that depend on each node
+    vector<size_t> pending(nodes.size(), 0);
+    vector<vector<size_t>> users(nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        NodeVector args;
+        for (auto& value : nodes[i]->input_values())
+        {
+            args.push_back(value.get_node_shared_ptr());
+        }
+        if (include_control_deps)
+        {
+            auto& deps = nodes[i]->get_control_dependencies();
+            args.insert(args.end(), deps.begin(), deps.end());
+        }
+        for (auto& arg : args)
+        {
+            pending[i]++;
+            users[indices.at(arg.get())].push_back(i);
+        }
+    }
+
+    // Ties are broken by the original order
+    set<pair<int, size_t>> ready;
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        if (pending[i] == 0)
+        {
+            ready.insert({get_priority(nodes[i].get()), i});
+        }
+    }
+
+    list<shared_ptr<Node>> result;
+    while (!ready.empty())
+    {
+        size_t i = ready.begin()->second;
+        ready.erase(ready.begin());
+        result.push_back(nodes[i]);
+        for (size_t user : users[i])
+        {
+            if (--pending[user] == 0)
+            {
+                ready.insert({get_priority(nodes[user].get()), user});
+            }
+        }
+    }
+    return result;
+}
+
+bool runtime::cpu::pass::CPUAsyncAllReduce::run_on_function(shared_ptr<Function> function)
+{
+    bool modified = false;
+    for (auto& node : function->get_ordered_ops())
+    {
+        auto allreduce = as_type_ptr<op::AllReduce>(node);
+        // Hierarchical and compressed reductions have no non-blocking form
+        if (allreduce && allreduce->get_algorithm() == reduction::Algorithm::FLAT &&
+            allreduce->get_compression() == reduction::Compression::NONE)
+        {
+            auto arg = allreduce->input_value(0);
+            auto start = make_shared<op::AllReduceStart>(arg, allreduce->get_reduce_type());
+            auto wait = make_shared<op::AllReduceWait>(start, arg);
+            NGRAPH_DEBUG << "Splitting " << allreduce->get_name() << " into "
+                         << start->get_name() << " and " << wait->get_name();
+            replace_node(allreduce, wait);
+            modified = true;
+        }
+        else if (auto broadcast = as_type_ptr<op::BroadcastDistributed>(node))
+        {
+            auto start = make_shared<op::BroadcastDistributedStart>(broadcast->input_value(0),
+                                                                    broadcast->get_root_id());
+            auto wait = make_shared<op::BroadcastDistributedWait>(start);
+            NGRAPH_DEBUG << "Splitting " << broadcast->get_name() << " into "
+                         << start->get_name() << " and " << wait->get_name();
+            replace_node(broadcast, wait);
+            modified = true;
+        }
+    }
+
+    if (modified)
+    {
+        auto sort = function->get_topological_sort();
+        function->set_topological_sort(
+            [sort](const NodeVector& root_nodes, bool include_control_deps) {
+                return schedule(sort(root_nodes, include_control_deps), include_control_deps);
+            });
+    }
+    return modified;
+}
@@ -0,0 +1,53 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/function.hpp"
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Splits each AllReduce into an AllReduceStart and an AllReduceWait and
+                ///        schedules the function so that communication overlaps computation.
+                ///
+                /// The function's topological sort is replaced by a list schedule that issues
+                /// every AllReduceStart as soon as its gradient is ready and postpones every
+                /// AllReduceWait until nothing else can run, i.e. until just before the reduced
+                /// values are needed. Other ops keep their relative order.
+                ///
+                /// BroadcastDistributed is split the same way into a BroadcastDistributedStart
+                /// and a BroadcastDistributedWait, so the broadcasts of many initial weights
+                /// are in flight at once.
+                class CPUAsyncAllReduce : public ngraph::pass::FunctionPass
+                {
+                public:
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+                    static std::list<std::shared_ptr<Node>>
+                        schedule(const std::list<std::shared_ptr<Node>>& ordered_ops,
+                                 bool include_control_deps);
+                };
+            }
+        }
+    }
+}
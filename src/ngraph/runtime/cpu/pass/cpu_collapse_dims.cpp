@@ -18,12 +18,17 @@
 #include <algorithm>
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/argmax.hpp"
+#include "ngraph/op/argmin.hpp"
 #include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/concat.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/max.hpp"
 #include "ngraph/op/min.hpp"
+#include "ngraph/op/pad.hpp"
 #include "ngraph/op/product.hpp"
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
 #include "ngraph/op/sum.hpp"
 #include "ngraph/util.hpp"
 
@@ -42,7 +47,7 @@ struct CollapsedShape
 // E.g.,
 // Shape{3, 3, 2}, AxisSet{0, 1} -> Shape{9, 2}, AxisSet{0}
 // Shape{2, 4, 6, 6}, AxisSet{2, 3} -> Shape{8, 36}, AxisSet{1}
-static void collapse_dims(std::vector<size_t>& shape,
+static void collapse_dims(const Shape& shape,
                           std::set<size_t> operated_axes,
                           struct CollapsedShape& cshape,
                           bool skip_unit_size = true)
@@ -91,6 +96,61 @@ static void collapse_dims(std::vector<size_t>& shape,
     }
 }
 
+// Reshape value to shape. A default-order Reshape producer, such as the output reshape of a
+// collapsed neighbour, is looked through so that consecutive collapsed ops share their shapes
+// instead of bouncing through the original one.
+static Output<Node> reshape_to(const Output<Node>& value, const Shape& shape)
+{
+    Output<Node> source = value;
+    auto reshape = as_type_ptr<op::Reshape>(value.get_node_shared_ptr());
+    if (reshape && !reshape->get_is_transpose())
+    {
+        source = reshape->input_value(0);
+    }
+    if (source.get_shape() == shape)
+    {
+        return source;
+    }
+    AxisVector axis_order = ngraph::get_default_order(source.get_shape());
+    return std::make_shared<op::Reshape>(source, axis_order, shape)->output(0);
+}
+
+// Collapse the axes before and after axis, dropping them if they are unit sized.
+// Returns the position of axis in cshape.
+// E.g., Shape{2, 3, 4, 5, 6}, 2 -> Shape{6, 4, 30}, 1
+static size_t collapse_around_axis(const Shape& shape, size_t axis, Shape& cshape)
+{
+    size_t outer = 1;
+    for (size_t i = 0; i < axis; i++)
+    {
+        outer *= shape[i];
+    }
+    size_t inner = 1;
+    for (size_t i = axis + 1; i < shape.size(); i++)
+    {
+        inner *= shape[i];
+    }
+
+    if (outer != 1)
+    {
+        cshape.push_back(outer);
+    }
+    size_t caxis = cshape.size();
+    cshape.push_back(shape[axis]);
+    if (inner != 1)
+    {
+        cshape.push_back(inner);
+    }
+    return caxis;
+}
+
+// MKLDNN may run these in blocked layouts, which a reshape would force back to row-major
+static bool may_use_mkldnn_layout(const Node* node)
+{
+    auto rank = node->get_input_shape(0).size();
+    return node->get_input_element_type(0) == element::f32 && (rank == 4 || rank == 5);
+}
+
 static bool collapse_broadcast(std::shared_ptr<Node> n)
 {
     bool replaced = false;
@@ -115,9 +175,7 @@ static bool collapse_broadcast(std::shared_ptr<Node> n)
     else if (output_shape.size() != cshape.fshape.size())
     {
         // Reshape arg to collapsed input_shape
-        AxisVector input_axis_order = ngraph::get_default_order(input_shape);
-        auto reshape_input = std::make_shared<op::Reshape>(
-            node->get_argument(0), input_axis_order, Shape(cshape.rshape));
+        auto reshape_input = reshape_to(node->input_value(0), Shape(cshape.rshape));
 
         auto broadcast = std::make_shared<op::Broadcast>(
             reshape_input, Shape(cshape.fshape), AxisSet(cshape.axis_set));
@@ -164,9 +222,7 @@ static bool collapse_reduction(std::shared_ptr<Node> n)
     else if (input_shape.size() != cshape.fshape.size())
     {
         // Reshape arg to collapsed input_shape
-        AxisVector input_axis_order = ngraph::get_default_order(input_shape);
-        auto reshape_input = std::make_shared<op::Reshape>(
-            node->get_argument(0), input_axis_order, Shape(cshape.fshape));
+        auto reshape_input = reshape_to(node->input_value(0), Shape(cshape.fshape));
 
         auto reduction = std::make_shared<T>(reshape_input, AxisSet(cshape.axis_set));
 
@@ -211,14 +267,10 @@ static bool collapse_dot(std::shared_ptr<Node> n)
     if (A_shape != cshape_A.fshape || B_shape != cshape_B.fshape)
     {
         // Reshape A to cshape_A.fshape
-        AxisVector A_axis_order = ngraph::get_default_order(A_shape);
-        auto reshape_A = std::make_shared<op::Reshape>(
-            node->get_argument(0), A_axis_order, Shape(cshape_A.fshape));
+        auto reshape_A = reshape_to(node->input_value(0), Shape(cshape_A.fshape));
 
         // Reshape B to cshape_B.fshape
-        AxisVector B_axis_order = ngraph::get_default_order(B_shape);
-        auto reshape_B = std::make_shared<op::Reshape>(
-            node->get_argument(1), B_axis_order, Shape(cshape_B.fshape));
+        auto reshape_B = reshape_to(node->input_value(1), Shape(cshape_B.fshape));
 
         auto cdot =
             std::make_shared<op::Dot>(reshape_A, reshape_B, reduction_count ? 1 : reduction_count);
@@ -236,6 +288,196 @@ static bool collapse_dot(std::shared_ptr<Node> n)
     return replaced;
 }
 
+static bool collapse_concat(std::shared_ptr<Node> n)
+{
+    auto node = std::static_pointer_cast<op::Concat>(n).get();
+    auto output_shape = node->get_shape();
+    auto axis = node->get_concatenation_axis();
+    if (may_use_mkldnn_layout(node))
+    {
+        return false;
+    }
+
+    Shape coutput_shape;
+    auto caxis = collapse_around_axis(output_shape, axis, coutput_shape);
+    if (coutput_shape.size() == output_shape.size())
+    {
+        return false;
+    }
+
+    // The axes around the concatenation axis match for all args, so they collapse alike
+    OutputVector reshape_inputs;
+    for (auto& input : node->inputs())
+    {
+        Shape cinput_shape;
+        collapse_around_axis(input.get_shape(), axis, cinput_shape);
+        reshape_inputs.push_back(reshape_to(input.get_source_output(), cinput_shape));
+    }
+    auto concat = std::make_shared<op::Concat>(reshape_inputs, caxis);
+
+    // Reshape collapsed output to original output_shape
+    auto reshape_output = std::make_shared<op::Reshape>(
+        concat, ngraph::get_default_order(coutput_shape), output_shape);
+    ngraph::replace_node(n, reshape_output);
+
+    NGRAPH_DEBUG << "CollapseDims: Replaced concat " << output_shape << " axis " << axis
+                 << " with " << coutput_shape << " axis " << caxis;
+    return true;
+}
+
+template <typename T>
+static bool collapse_index_reduction(std::shared_ptr<Node> n)
+{
+    auto node = std::static_pointer_cast<T>(n).get();
+    auto input_shape = node->get_input_shape(0);
+    auto output_shape = node->get_shape();
+    auto axis = node->get_reduction_axis();
+
+    Shape cinput_shape;
+    auto caxis = collapse_around_axis(input_shape, axis, cinput_shape);
+    if (cinput_shape.size() == input_shape.size())
+    {
+        return false;
+    }
+
+    auto reshape_input = reshape_to(node->input_value(0), cinput_shape);
+    auto reduction =
+        std::make_shared<T>(reshape_input, caxis, node->get_index_element_type());
+
+    // Reshape collapsed output to original output_shape
+    auto reshape_output = std::make_shared<op::Reshape>(
+        reduction, ngraph::get_default_order(reduction->get_shape()), output_shape);
+    ngraph::replace_node(n, reshape_output);
+
+    NGRAPH_DEBUG << "CollapseDims: Replaced index reduction " << input_shape << " axis " << axis
+                 << " with " << cinput_shape << " axis " << caxis;
+    return true;
+}
+
+// Full axes (stride 1, whole extent) fold into the axis before them as long as that axis has
+// stride 1: rows [l, u) of a row-major tensor are the contiguous elements [l * d, u * d).
+// E.g., Shape{2, 4, 3, 5}, lower {0, 1, 0, 0}, upper {2, 3, 3, 5} ->
+// Shape{2, 60}, lower {0, 15}, upper {2, 45}
+static bool collapse_slice(std::shared_ptr<Node> n)
+{
+    auto node = std::static_pointer_cast<op::Slice>(n).get();
+    auto input_shape = node->get_input_shape(0);
+    auto& lower = node->get_lower_bounds();
+    auto& upper = node->get_upper_bounds();
+    auto& strides = node->get_strides();
+    if (may_use_mkldnn_layout(node))
+    {
+        return false;
+    }
+
+    Shape cshape;
+    Coordinate clower, cupper;
+    Strides cstrides;
+    for (size_t i = 0; i < input_shape.size(); i++)
+    {
+        bool full = lower[i] == 0 && upper[i] == input_shape[i] && strides[i] == 1;
+        bool unit = !cshape.empty() && cshape.back() == 1 && clower.back() == 0 &&
+                    cupper.back() == 1;
+        if (unit)
+        {
+            // Leading unit axes carry no slicing
+            cshape.back() = input_shape[i];
+            clower.back() = lower[i];
+            cupper.back() = upper[i];
+            cstrides.back() = strides[i];
+        }
+        else if (full && !cshape.empty() && cstrides.back() == 1)
+        {
+            cshape.back() *= input_shape[i];
+            clower.back() *= input_shape[i];
+            cupper.back() *= input_shape[i];
+        }
+        else
+        {
+            cshape.push_back(input_shape[i]);
+            clower.push_back(lower[i]);
+            cupper.push_back(upper[i]);
+            cstrides.push_back(strides[i]);
+        }
+    }
+    if (cshape.size() == input_shape.size())
+    {
+        return false;
+    }
+
+    auto reshape_input = reshape_to(node->input_value(0), cshape);
+    auto slice = std::make_shared<op::Slice>(reshape_input, clower, cupper, cstrides);
+
+    // Reshape collapsed output to original output_shape
+    auto reshape_output = std::make_shared<op::Reshape>(
+        slice, ngraph::get_default_order(slice->get_shape()), node->get_shape());
+    ngraph::replace_node(n, reshape_output);
+
+    NGRAPH_DEBUG << "CollapseDims: Replaced slice " << input_shape << " " << lower << " "
+                 << upper << " with " << cshape << " " << clower << " " << cupper;
+    return true;
+}
+
+// Unpadded axes fold into the axis before them. With constant padding the axis before may be
+// padded too, its padding scaling with the folded axes; other modes replicate single
+// elements, so only runs of unpadded axes fold.
+// E.g., Shape{2, 3, 4}, below {0, 1, 0}, above {0, 2, 0} -> Shape{2, 12}, below {0, 4},
+// above {0, 8}
+static bool collapse_pad(std::shared_ptr<Node> n)
+{
+    auto node = std::static_pointer_cast<op::Pad>(n).get();
+    auto input_shape = node->get_input_shape(0);
+    auto& below = node->get_padding_below();
+    auto& above = node->get_padding_above();
+    bool constant = node->get_pad_mode() == op::PadMode::CONSTANT;
+
+    Shape cshape;
+    CoordinateDiff cbelow, cabove;
+    for (size_t i = 0; i < input_shape.size(); i++)
+    {
+        bool padded = below[i] != 0 || above[i] != 0;
+        bool unit = !cshape.empty() && cshape.back() == 1 && cbelow.back() == 0 &&
+                    cabove.back() == 0;
+        auto size = static_cast<std::ptrdiff_t>(input_shape[i]);
+        if (unit)
+        {
+            cshape.back() = input_shape[i];
+            cbelow.back() = below[i];
+            cabove.back() = above[i];
+        }
+        else if (!padded && !cshape.empty() &&
+                 (constant || (cbelow.back() == 0 && cabove.back() == 0)))
+        {
+            cshape.back() *= input_shape[i];
+            cbelow.back() *= size;
+            cabove.back() *= size;
+        }
+        else
+        {
+            cshape.push_back(input_shape[i]);
+            cbelow.push_back(below[i]);
+            cabove.push_back(above[i]);
+        }
+    }
+    if (cshape.size() == input_shape.size())
+    {
+        return false;
+    }
+
+    auto reshape_input = reshape_to(node->input_value(0), cshape);
+    auto pad = std::make_shared<op::Pad>(
+        reshape_input, node->input_value(1), cbelow, cabove, node->get_pad_mode());
+
+    // Reshape collapsed output to original output_shape
+    auto reshape_output = std::make_shared<op::Reshape>(
+        pad, ngraph::get_default_order(pad->get_shape()), node->get_shape());
+    ngraph::replace_node(n, reshape_output);
+
+    NGRAPH_DEBUG << "CollapseDims: Replaced pad " << input_shape << " " << below << " " << above
+                 << " with " << cshape << " " << cbelow << " " << cabove;
+    return true;
+}
+
 bool runtime::cpu::pass::CPUCollapseDims::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
     bool replaced = false;
@@ -265,6 +507,26 @@ bool runtime::cpu::pass::CPUCollapseDims::run_on_function(std::shared_ptr<ngraph
         {
             replaced |= collapse_dot<op::Dot>(n);
         }
+        else if (is_type<op::Concat>(n))
+        {
+            replaced |= collapse_concat(n);
+        }
+        else if (is_type<op::Slice>(n))
+        {
+            replaced |= collapse_slice(n);
+        }
+        else if (is_type<op::Pad>(n))
+        {
+            replaced |= collapse_pad(n);
+        }
+        else if (is_type<op::ArgMax>(n))
+        {
+            replaced |= collapse_index_reduction<op::ArgMax>(n);
+        }
+        else if (is_type<op::ArgMin>(n))
+        {
+            replaced |= collapse_index_reduction<op::ArgMin>(n);
+        }
     }
 
     return replaced;
@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+#include <cstring>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/runtime/cpu/op/dequantizing_dot.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_dequantizing_dot.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+element::Type runtime::cpu::pass::CPUDequantizingDot::get_default_element_type()
+{
+    const char* env = getenv("NGRAPH_CPU_WEIGHT_PRECISION");
+    if (env != nullptr && strcmp(env, "f16") == 0)
+    {
+        return element::f16;
+    }
+    return element::i8;
+}
+
+bool runtime::cpu::pass::CPUDequantizingDot::is_enabled_by_default()
+{
+    const char* env = getenv("NGRAPH_CPU_WEIGHT_PRECISION");
+    return env != nullptr && (strcmp(env, "i8") == 0 || strcmp(env, "f16") == 0);
+}
+
+bool runtime::cpu::pass::CPUDequantizingDot::run_on_function(shared_ptr<Function> function)
+{
+    bool modified = false;
+    for (auto& node : function->get_ordered_ops())
+    {
+        auto dot = as_type_ptr<op::Dot>(node);
+        if (!dot || dot->get_reduction_axes_count() != 1 ||
+            dot->get_input_element_type(0) != element::f32 ||
+            !dot->get_input_partial_shape(0).is_static())
+        {
+            continue;
+        }
+
+        auto constant = as_type_ptr<op::Constant>(dot->input_value(1).get_node_shared_ptr());
+        if (!constant || constant->get_element_type() != element::f32 ||
+            constant->get_shape().size() != 2 ||
+            shape_size(constant->get_shape()) < m_min_elements)
+        {
+            continue;
+        }
+
+        NGRAPH_DEBUG << "Storing " << constant->get_shape() << " weights of " << dot->get_name()
+                     << " as " << m_element_type;
+        auto weights = op::LowPrecisionWeights::from_dense(
+            constant->get_data_ptr<float>(), constant->get_shape(), m_element_type);
+        replace_node(dot, make_shared<op::DequantizingDot>(dot->input_value(0), weights));
+        modified = true;
+    }
+    return modified;
+}
@@ -0,0 +1,60 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+#include "ngraph/type/element_type.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Replaces a Dot with f32 constant weights on the right by a
+                ///        DequantizingDot that stores the weights as i8 with per-channel scales
+                ///        or as f16.
+                ///
+                /// This is lossy and off by default. Setting NGRAPH_CPU_WEIGHT_PRECISION to
+                /// `i8` or `f16` enables it with that storage type. Weights with fewer than
+                /// `min_elements` elements are left in f32.
+                class CPU_BACKEND_API CPUDequantizingDot : public ngraph::pass::FunctionPass
+                {
+                public:
+                    CPUDequantizingDot(const element::Type& type = get_default_element_type(),
+                                       size_t min_elements = 4096)
+                        : m_element_type(type)
+                        , m_min_elements(min_elements)
+                    {
+                    }
+
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+                    static element::Type get_default_element_type();
+                    static bool is_enabled_by_default();
+
+                private:
+                    element::Type m_element_type;
+                    size_t m_min_elements;
+                };
+            }
+        }
+    }
+}
@@ -0,0 +1,100 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/pass/cpu_dropout_mask_packing.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/runtime/cpu/op/dropout.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+bool runtime::cpu::pass::CPUDropoutMaskPacking::run_on_function(shared_ptr<Function> function)
+{
+    bool modified = false;
+    for (auto& node : function->get_ordered_ops())
+    {
+        auto dropout = as_type_ptr<op::Dropout>(node);
+        if (!dropout || dropout->get_packed_mask())
+        {
+            continue;
+        }
+
+        shared_ptr<Node> data_goe;
+        shared_ptr<Node> mask_goe;
+        bool packable = true;
+        for (auto& user : dropout->get_users())
+        {
+            auto goe = as_type_ptr<op::GetOutputElement>(user);
+            if (!goe)
+            {
+                packable = false;
+                break;
+            }
+            (goe->get_n() == 0 ? data_goe : mask_goe) = goe;
+        }
+        if (!packable || !mask_goe || mask_goe->get_users().empty())
+        {
+            continue;
+        }
+
+        // Every user of the mask must be an elementwise product of the mask with another tensor
+        // of its shape, so that DropoutMaskMultiply can index the bits in the same order.
+        const Shape& shape = dropout->get_output_shape(1);
+        vector<shared_ptr<Node>> multiplies;
+        for (auto& user : mask_goe->get_users())
+        {
+            auto multiply = as_type_ptr<op::Multiply>(user);
+            if (!multiply || multiply->get_output_shape(0) != shape ||
+                multiply->get_input_shape(0) != shape || multiply->get_input_shape(1) != shape ||
+                multiply->get_argument(0) == multiply->get_argument(1))
+            {
+                packable = false;
+                break;
+            }
+            multiplies.push_back(multiply);
+        }
+        if (!packable)
+        {
+            continue;
+        }
+
+        NGRAPH_DEBUG << "Packing the mask of " << dropout->get_name() << " for "
+                     << multiplies.size() << " multiplies";
+        auto packed = make_shared<op::Dropout>(dropout->input_value(0),
+                                               dropout->input_value(1),
+                                               dropout->input_value(2),
+                                               dropout->input_value(3),
+                                               dropout->input_value(4),
+                                               true);
+        auto packed_mask = make_shared<op::GetOutputElement>(packed, 1);
+        if (data_goe)
+        {
+            replace_node(data_goe, make_shared<op::GetOutputElement>(packed, 0));
+        }
+        for (auto& multiply : multiplies)
+        {
+            auto arg = multiply->get_argument(0) == mask_goe
+                           ? multiply->input_value(1)
+                           : multiply->input_value(0);
+            replace_node(multiply, make_shared<op::DropoutMaskMultiply>(arg, packed_mask));
+        }
+        modified = true;
+    }
+    return modified;
+}
@@ -0,0 +1,307 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "cpu_elementwise_fusion.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using Opcode = op::FusedElementwise::Opcode;
+
+static bool get_opcode(const Node& node, Opcode& opcode)
+{
+    static const map<NodeTypeInfo, Opcode> opcodes{
+        {op::Abs::type_info, Opcode::Abs},
+        {op::Add::type_info, Opcode::Add},
+        {op::Divide::type_info, Opcode::Divide},
+        {op::Exp::type_info, Opcode::Exp},
+        {op::Log::type_info, Opcode::Log},
+        {op::Maximum::type_info, Opcode::Maximum},
+        {op::Minimum::type_info, Opcode::Minimum},
+        {op::Multiply::type_info, Opcode::Multiply},
+        {op::Negative::type_info, Opcode::Negative},
+        {op::Relu::type_info, Opcode::Relu},
+        {op::Sigmoid::type_info, Opcode::Sigmoid},
+        {op::Sqrt::type_info, Opcode::Sqrt},
+        {op::Subtract::type_info, Opcode::Subtract},
+        {op::Tanh::type_info, Opcode::Tanh}};
+
+    auto it = opcodes.find(node.get_type_info());
+    if (it == opcodes.end())
+    {
+        return false;
+    }
+    opcode = it->second;
+    return true;
+}
+
+static bool is_fusible(const Node& node, const Shape& shape, const element::Type& element_type)
+{
+    Opcode opcode;
+    if (!get_opcode(node, opcode) || node.get_output_size() != 1 ||
+        node.get_output_partial_shape(0).is_dynamic() || node.get_output_shape(0) != shape ||
+        node.get_output_element_type(0) != element_type)
+    {
+        return false;
+    }
+    // Binary ops must already have their implicit broadcasts made explicit
+    for (size_t i = 0; i < node.get_input_size(); i++)
+    {
+        if (node.get_input_partial_shape(i).is_dynamic() || node.get_input_shape(i) != shape)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// A Broadcast into the subgraph is read through strides instead of being materialized. It may
+// have users outside the subgraph; those keep reading the Broadcast itself.
+static bool is_foldable_broadcast(const Node& node,
+                                  const Shape& shape,
+                                  const element::Type& element_type)
+{
+    auto broadcast = as_type<const op::Broadcast>(&node);
+    return broadcast && node.get_output_element_type(0) == element_type &&
+           node.get_output_partial_shape(0).is_static() && node.get_output_shape(0) == shape &&
+           node.get_input_partial_shape(0).is_static();
+}
+
+// A Sum over the trailing axes of a fusible op is evaluated by the fused loop, so the summed
+// tensor is never materialized. Returns the summed op, or null.
+static Node* get_reduced_argument(const Node& node)
+{
+    auto sum = as_type<const op::Sum>(&node);
+    if (!sum || !sum->reduction_axes_constant() || sum->get_output_partial_shape(0).is_dynamic())
+    {
+        return nullptr;
+    }
+    auto arg = sum->get_argument(0);
+    auto reduction_axes = sum->get_reduction_axes();
+    if (arg->get_output_size() != 1 || arg->get_users().size() != 1 ||
+        arg->get_output_partial_shape(0).is_dynamic() || reduction_axes.empty())
+    {
+        return nullptr;
+    }
+    auto shape = arg->get_output_shape(0);
+    if (*reduction_axes.begin() + reduction_axes.size() != shape.size() ||
+        !is_fusible(*arg, shape, arg->get_output_element_type(0)))
+    {
+        return nullptr;
+    }
+    return arg.get();
+}
+
+bool runtime::cpu::pass::CPUElementwiseFusion::run_on_function(shared_ptr<Function> function)
+{
+    auto ops = function->get_ordered_ops();
+
+    unordered_map<Node*, size_t> topological_index;
+    for (auto& node : ops)
+    {
+        size_t index = topological_index.size();
+        topological_index[node.get()] = index;
+    }
+
+    unordered_set<Node*> fused;
+    bool replaced = false;
+
+    // Visit the ops from the outputs backwards so that each subgraph is grown from its last op
+    for (auto it = ops.rbegin(); it != ops.rend(); ++it)
+    {
+        auto root = *it;
+        if (fused.count(root.get()) != 0 || root->get_output_size() != 1 ||
+            root->get_output_partial_shape(0).is_dynamic())
+        {
+            continue;
+        }
+
+        // The last op of the program is the root itself, or the op a root Sum reduces
+        auto last = get_reduced_argument(*root);
+        AxisSet reduction_axes;
+        if (last)
+        {
+            reduction_axes = static_cast<op::Sum*>(root.get())->get_reduction_axes();
+        }
+        else
+        {
+            last = root.get();
+        }
+
+        auto shape = last->get_output_shape(0);
+        auto element_type = last->get_output_element_type(0);
+        if ((element_type != element::f32 && element_type != element::f64) ||
+            !is_fusible(*last, shape, element_type))
+        {
+            continue;
+        }
+
+        // Candidates are visited in decreasing topological order, so by the time a candidate
+        // is considered every user that could join the subgraph already has.
+        unordered_set<Node*> group{last};
+        unordered_set<Node*> visited{last};
+        priority_queue<pair<size_t, Node*>> candidates;
+        size_t folded_broadcasts = reduction_axes.empty() ? 0 : 1;
+        auto push_arguments = [&](Node* node) {
+            for (auto& value : node->input_values())
+            {
+                auto arg = value.get_node();
+                if (visited.insert(arg).second)
+                {
+                    candidates.push({topological_index.at(arg), arg});
+                }
+            }
+        };
+        push_arguments(last);
+
+        while (!candidates.empty())
+        {
+            auto candidate = candidates.top().second;
+            candidates.pop();
+
+            if (is_foldable_broadcast(*candidate, shape, element_type))
+            {
+                folded_broadcasts++;
+                continue;
+            }
+            if (!is_fusible(*candidate, shape, element_type))
+            {
+                continue;
+            }
+
+            auto users = candidate->get_users();
+            bool internal = all_of(users.begin(), users.end(), [&](const shared_ptr<Node>& user) {
+                return group.count(user.get()) != 0;
+            });
+            if (internal)
+            {
+                group.insert(candidate);
+                push_arguments(candidate);
+            }
+        }
+
+        // A fused Sum counts towards the ops saved, like a folded Broadcast
+        if (group.size() + folded_broadcasts < 2)
+        {
+            continue;
+        }
+
+        vector<Node*> nodes(group.begin(), group.end());
+        sort(nodes.begin(), nodes.end(), [&](Node* a, Node* b) {
+            return topological_index.at(a) < topological_index.at(b);
+        });
+
+        // Collect the external inputs, reading through any folded Broadcast
+        OutputVector args;
+        vector<AxisSet> broadcast_axes;
+        auto find_input = [&](const Output<Node>& value) -> size_t {
+            Output<Node> source = value;
+            AxisSet axes;
+            if (is_foldable_broadcast(*value.get_node(), shape, element_type))
+            {
+                auto broadcast = static_cast<op::Broadcast*>(value.get_node());
+                source = broadcast->input_value(0);
+                axes = broadcast->get_broadcast_axes();
+            }
+            for (size_t i = 0; i < args.size(); i++)
+            {
+                if (args[i] == source && broadcast_axes[i] == axes)
+                {
+                    return i;
+                }
+            }
+            args.push_back(source);
+            broadcast_axes.push_back(axes);
+            return args.size() - 1;
+        };
+
+        unordered_map<Node*, size_t> instruction_index;
+        vector<vector<size_t>> operands(nodes.size());
+        for (size_t i = 0; i < nodes.size(); i++)
+        {
+            for (auto& value : nodes[i]->input_values())
+            {
+                auto arg = value.get_node();
+                operands[i].push_back(group.count(arg) != 0 ? SIZE_MAX : find_input(value));
+            }
+            instruction_index[nodes[i]] = i;
+        }
+
+        // Reading an MKLDNN result would force a layout conversion in front of the fused op
+        bool reads_mkldnn = any_of(args.begin(), args.end(), [](const Output<Node>& arg) {
+            return runtime::cpu::mkldnn_utils::use_mkldnn_kernel(arg.get_node());
+        });
+        if (reads_mkldnn)
+        {
+            continue;
+        }
+
+        vector<op::FusedElementwise::Instruction> program;
+        for (size_t i = 0; i < nodes.size(); i++)
+        {
+            op::FusedElementwise::Instruction instruction{Opcode::Abs, 0, 0};
+            get_opcode(*nodes[i], instruction.opcode);
+            for (size_t j = 0; j < operands[i].size(); j++)
+            {
+                size_t operand = operands[i][j];
+                if (operand == SIZE_MAX)
+                {
+                    operand = args.size() + instruction_index.at(nodes[i]->get_argument(j).get());
+                }
+                (j == 0 ? instruction.arg0 : instruction.arg1) = operand;
+            }
+            program.push_back(instruction);
+        }
+
+        NGRAPH_DEBUG << "Fusing " << nodes.size() << " elementwise ops, " << folded_broadcasts
+                     << " broadcasts and sums into " << root->get_name();
+        auto fused_op = make_shared<op::FusedElementwise>(
+            args, broadcast_axes, program, shape, reduction_axes);
+        replace_node(root, fused_op);
+        fused.insert(root.get());
+        fused.insert(group.begin(), group.end());
+        replaced = true;
+    }
+
+    return replaced;
+}
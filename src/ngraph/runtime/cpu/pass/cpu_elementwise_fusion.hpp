@@ -0,0 +1,48 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Replaces connected subgraphs of elementwise floating point ops with a
+                ///        single FusedElementwise op, so intermediate results are never
+                ///        materialized.
+                ///
+                /// A subgraph grows backwards from its last op. An op joins only if it has the
+                /// same shape and element type and every one of its users is already in the
+                /// subgraph. A Broadcast feeding the subgraph is folded into a strided read of
+                /// its argument, and a Sum over the trailing axes of its last op is folded into
+                /// the loop. Subgraphs that read the result of an MKLDNN kernel are left alone so
+                /// that blocked layouts do not need a conversion.
+                class CPU_BACKEND_API CPUElementwiseFusion : public ngraph::pass::FunctionPass
+                {
+                public:
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+                };
+            }
+        }
+    }
+}
@@ -39,6 +39,7 @@
 #include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/experimental/generate_mask.hpp"
 #include "ngraph/op/experimental/quantized_conv_bias.hpp"
@@ -76,11 +77,13 @@
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/deconv.hpp"
 #include "ngraph/runtime/cpu/op/dropout.hpp"
+#include "ngraph/runtime/cpu/op/embedding_bag_sum.hpp"
 #include "ngraph/runtime/cpu/op/gelu_backprop.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/quantized_add.hpp"
 #include "ngraph/runtime/cpu/op/quantized_matmul.hpp"
 #include "ngraph/runtime/cpu/op/rnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
@@ -2135,6 +2138,54 @@ void ngraph::runtime::cpu::pass::CPUFusion::construct_update_slice()
     this->add_matcher(m, callback);
 }
 
+void ngraph::runtime::cpu::pass::CPUFusion::construct_embedding_bag_sum()
+{
+    auto indices = std::make_shared<pattern::op::Label>(element::i32, Shape{4, 3});
+    auto weights = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 8});
+    auto lookup = std::make_shared<ngraph::op::EmbeddingLookup>(indices, weights);
+    auto lookup_label =
+        std::make_shared<pattern::op::Label>(lookup, nullptr, NodeVector{lookup});
+    auto sum = std::make_shared<ngraph::op::Sum>(lookup_label, AxisSet{1});
+
+    auto callback = [indices, weights, lookup_label](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for embedding_bag_sum = " << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+        auto sum_m = std::static_pointer_cast<ngraph::op::Sum>(m.get_match_root());
+
+        if (pattern_map[indices]->get_shape().size() != 2 ||
+            sum_m->get_reduction_axes() != AxisSet{1})
+        {
+            NGRAPH_DEBUG << "Embedding bag sum cannot be created, sum is not over the bag axis";
+            return false;
+        }
+
+        auto element_type = sum_m->get_element_type();
+        auto index_element_type = pattern_map[indices]->get_element_type();
+        if ((element_type != element::f32 && element_type != element::f64 &&
+             element_type != element::i32) ||
+            (index_element_type != element::f32 && index_element_type != element::i32 &&
+             index_element_type != element::i64))
+        {
+            NGRAPH_DEBUG << "Embedding bag sum cannot be created, unsupported element types";
+            return false;
+        }
+
+        if (pattern_map[lookup_label]->get_users().size() > 1)
+        {
+            NGRAPH_DEBUG << "Embedding bag sum cannot be created, lookup result is required";
+            return false;
+        }
+
+        auto bag_sum = std::make_shared<ngraph::op::EmbeddingBagSum>(pattern_map[indices],
+                                                                     pattern_map[weights]);
+        ngraph::replace_node(m.get_match_root(), bag_sum);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(sum, "CPUFusion.EmbeddingBagSum");
+    this->add_matcher(m, callback);
+}
+
 // QuantizedConvolution + Dequantize + Relu -> QuantizedConvolutionRelu + Dequantize
 void ngraph::runtime::cpu::pass::CPUQuantFusion::construct_qconv_relu(bool with_bias)
 {
@@ -2454,6 +2505,143 @@ void ngraph::runtime::cpu::pass::CPUQuantFusion::construct_dq_q()
     this->add_matcher(m, callback);
 }
 
+// Dequantize + Relu -> Relu + Dequantize
+void ngraph::runtime::cpu::pass::CPUQuantFusion::construct_qrelu()
+{
+    Shape shape{2, 2, 1, 1};
+    auto input = std::make_shared<pattern::op::Label>(element::i8, shape);
+    auto dq_scale = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto dq_zp = std::make_shared<pattern::op::Label>(element::i8, Shape{});
+    auto dq =
+        std::make_shared<ngraph::op::Dequantize>(input, dq_scale, dq_zp, element::f32, AxisSet{});
+    auto relu = std::make_shared<ngraph::op::Relu>(dq);
+
+    auto callback = [](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_qrelu against "
+                     << m.get_match_root()->get_name();
+
+        auto dq_m = std::static_pointer_cast<ngraph::op::Dequantize>(
+            m.get_match_root()->get_argument(0));
+        if (!ngraph::is_zero(dq_m->get_argument(2)))
+        {
+            NGRAPH_DEBUG << "Non-zero zero point";
+            return false;
+        }
+        // Relu commutes with the scaling only if every scale is positive
+        auto scale = as_type_ptr<ngraph::op::Constant>(dq_m->get_argument(1));
+        if (!scale)
+        {
+            NGRAPH_DEBUG << "Scale is not a constant";
+            return false;
+        }
+        for (float value : scale->get_vector<float>())
+        {
+            if (!(value > 0.0f))
+            {
+                NGRAPH_DEBUG << "Non-positive scale";
+                return false;
+            }
+        }
+
+        auto input_n = dq_m->get_argument(0);
+        // Relu of a u8 tensor is the tensor itself
+        if (input_n->get_element_type() == element::i8)
+        {
+            input_n = std::make_shared<ngraph::op::Relu>(input_n);
+        }
+        auto dq_n = std::make_shared<ngraph::op::Dequantize>(input_n,
+                                                             dq_m->get_argument(1),
+                                                             dq_m->get_argument(2),
+                                                             dq_m->get_output_element_type(0),
+                                                             dq_m->get_axes());
+        ngraph::replace_node(m.get_match_root(), dq_n);
+        return true;
+    };
+
+    this->add_matcher(std::make_shared<pattern::Matcher>(relu, "CPUQuantFusion.QRelu"),
+                      callback);
+}
+
+// Quantize(Dequantize + Dequantize) -> QuantizedAdd
+void ngraph::runtime::cpu::pass::CPUQuantFusion::construct_qadd()
+{
+    Shape shape{2, 2, 1, 1};
+    auto input0 = std::make_shared<pattern::op::Label>(element::i8, shape);
+    auto input1 = std::make_shared<pattern::op::Label>(element::i8, shape);
+    auto dq0_scale = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto dq1_scale = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto q_scale = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto dq0_zp = std::make_shared<pattern::op::Label>(element::i8, Shape{});
+    auto dq1_zp = std::make_shared<pattern::op::Label>(element::i8, Shape{});
+    auto q_zp = std::make_shared<pattern::op::Label>(element::i8, Shape{});
+
+    auto dq0 = std::make_shared<ngraph::op::Dequantize>(
+        input0, dq0_scale, dq0_zp, element::f32, AxisSet{});
+    auto dq1 = std::make_shared<ngraph::op::Dequantize>(
+        input1, dq1_scale, dq1_zp, element::f32, AxisSet{});
+    auto add = std::make_shared<ngraph::op::Add>(dq0, dq1);
+    ngraph::op::Quantize::RoundMode round_mode =
+        ngraph::op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN;
+    auto q = std::make_shared<ngraph::op::Quantize>(
+        add, q_scale, q_zp, element::i8, AxisSet{}, round_mode);
+
+    auto callback = [input0, input1, dq0_scale, dq1_scale, q_scale, dq0_zp, dq1_zp, q_zp](
+        pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_qadd against "
+                     << m.get_match_root()->get_name();
+
+        auto pattern_map = m.get_pattern_map();
+        auto q_m = std::static_pointer_cast<ngraph::op::Quantize>(m.get_match_root());
+        if (q_m->get_round_mode() != ngraph::op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN)
+        {
+            NGRAPH_DEBUG << "Unsupported round mode";
+            return false;
+        }
+
+        auto element_type = q_m->get_element_type();
+        if ((element_type != element::i8 && element_type != element::u8) ||
+            pattern_map[input0]->get_element_type() != element_type ||
+            pattern_map[input1]->get_element_type() != element_type)
+        {
+            NGRAPH_DEBUG << "Inputs and output must have the same 8-bit element type";
+            return false;
+        }
+
+        if (!(ngraph::is_zero(pattern_map[dq0_zp]) && ngraph::is_zero(pattern_map[dq1_zp]) &&
+              ngraph::is_zero(pattern_map[q_zp])))
+        {
+            NGRAPH_DEBUG << "Non-zero zero points";
+            return false;
+        }
+
+        float scales[3];
+        std::shared_ptr<Node> scale_nodes[3] = {
+            pattern_map[dq0_scale], pattern_map[dq1_scale], pattern_map[q_scale]};
+        for (size_t i = 0; i < 3; i++)
+        {
+            auto scale = as_type_ptr<ngraph::op::Constant>(scale_nodes[i]);
+            if (!scale || shape_size(scale->get_shape()) != 1)
+            {
+                NGRAPH_DEBUG << "Scales must be scalar constants";
+                return false;
+            }
+            scales[i] = scale->get_vector<float>()[0];
+        }
+        if (!(scales[2] > 0.0f))
+        {
+            NGRAPH_DEBUG << "Non-positive output scale";
+            return false;
+        }
+
+        auto qadd_n = std::make_shared<ngraph::op::QuantizedAdd>(
+            pattern_map[input0], pattern_map[input1], scales[0], scales[1], scales[2]);
+        ngraph::replace_node(m.get_match_root(), qadd_n);
+        return true;
+    };
+
+    this->add_matcher(std::make_shared<pattern::Matcher>(q, "CPUQuantFusion.QAdd"), callback);
+}
+
 // Left Branch(LB): QCONVB + DQ + {Reshape/Broadcast}
 // Right Branch(RB): DQ + {Reshape/Broadcast}
 // Relu(LB + RB) -> QCB{S}A
@@ -85,6 +85,7 @@ public:
             construct_conv_add();
             construct_conv_add_relu();
             construct_update_slice();
+            construct_embedding_bag_sum();
 #if MKLDNN_VERSION_MAJOR < 1
             construct_fuse_lstm_recurrent_state();
 #endif
@@ -125,6 +126,7 @@ private:
     void construct_groupconv_batchnorm_global_stats_folding();
     void construct_groupconv_batchnorm_global_stats_folding_relu();
     void construct_update_slice();
+    void construct_embedding_bag_sum();
 #if MKLDNN_VERSION_MAJOR < 1
     void construct_fuse_lstm_recurrent_state();
 #endif
@@ -146,9 +148,11 @@ public:
         construct_qconv_relu(false);
         construct_qavg_pool();
         construct_qmax_pool();
+        construct_qrelu();
         construct_qconcat();
         construct_qconvb_add();
         construct_dq_q();
+        construct_qadd();
         construct_quantized_matmul();
     }
 
@@ -156,8 +160,10 @@ private:
     void construct_qconv_relu(bool with_bias);
     void construct_qavg_pool();
     void construct_qmax_pool();
+    void construct_qrelu();
     void construct_qconcat();
     void construct_dq_q();
+    void construct_qadd();
     void construct_qconvb_add();
     void construct_quantized_matmul();
 };
@@ -14,18 +14,24 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
+
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/avg_pool.hpp"
 #include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
 #include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
 #include "ngraph/op/fused/conv_fused.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 
 using namespace ngraph;
 using namespace std;
@@ -192,3 +198,217 @@ void ngraph::runtime::cpu::pass::CPUHorizontalFusion::cpu_conv_horizontal_fusion
         make_shared<pattern::Matcher>(conv_bias, "CPUHorizontalFusion.CpuConvHorizontalFusion");
     this->add_matcher(m, callback);
 }
+
+// Concatenates the data of constants along axis
+static std::shared_ptr<op::Constant>
+    concat_constants(const std::vector<std::shared_ptr<op::Constant>>& constants, size_t axis)
+{
+    Shape out_shape = constants.at(0)->get_shape();
+    out_shape[axis] = 0;
+    for (auto& constant : constants)
+    {
+        out_shape[axis] += constant->get_shape()[axis];
+    }
+    auto et = constants.at(0)->get_element_type();
+    size_t outer = 1;
+    for (size_t i = 0; i < axis; i++)
+    {
+        outer *= out_shape[i];
+    }
+
+    runtime::AlignedBuffer buffer(shape_size(out_shape) * et.size());
+    char* out = buffer.get_ptr<char>();
+    for (size_t i = 0; i < outer; i++)
+    {
+        for (auto& constant : constants)
+        {
+            size_t chunk = shape_size(constant->get_shape()) / outer * et.size();
+            memcpy(out, constant->get_data_ptr<char>() + i * chunk, chunk);
+            out += chunk;
+        }
+    }
+    return std::make_shared<op::Constant>(et, out_shape, buffer.get_ptr());
+}
+
+// Replaces each of nodes by a Slice of fused along axis. Slices of the leading axes, or of the
+// last one when the leading axes have size 1, are done in place by CPUMemoryOptimization.
+static void replace_with_slices(const std::shared_ptr<Node>& fused,
+                                const std::vector<std::shared_ptr<Node>>& nodes,
+                                size_t axis)
+{
+    size_t index = 0;
+    for (auto& node : nodes)
+    {
+        Shape slice_shape = node->get_output_shape(0);
+        Coordinate lower_bounds(slice_shape.size(), 0);
+        lower_bounds[axis] = index;
+        index += slice_shape[axis];
+        Coordinate upper_bounds(slice_shape);
+        upper_bounds[axis] = index;
+        auto slice = std::make_shared<ngraph::op::Slice>(fused, lower_bounds, upper_bounds);
+        ngraph::replace_node(node, slice);
+    }
+}
+
+static bool has_multiple_users(std::shared_ptr<Node> n)
+{
+    return n->get_output_inputs(0).size() > 1;
+}
+
+void ngraph::runtime::cpu::pass::CPUHorizontalFusion::cpu_dot_horizontal_fusion()
+{
+    auto data = std::make_shared<pattern::op::Label>(element::f32, Shape{2, 4}, has_multiple_users);
+    auto weights = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{4, 3}, pattern::has_class<op::Constant>());
+    auto dot = std::make_shared<ngraph::op::Dot>(data, weights);
+
+    auto callback = [](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "dot_horizontal_fusion: In a callback for dot horizontal fusion for "
+                     << m.get_match_root()->get_name();
+
+        auto root = m.get_match_root();
+        if (root->get_users().empty())
+        {
+            NGRAPH_DEBUG << "dot_horizontal_fusion: root node has been replaced\n";
+            return false;
+        }
+
+        auto data_value = root->input_value(0);
+        auto is_fusible = [&data_value](const std::shared_ptr<Node>& n) {
+            auto dot_n = as_type_ptr<ngraph::op::Dot>(n);
+            return dot_n && is_used(n.get()) && n->input_value(0) == data_value &&
+                   dot_n->get_reduction_axes_count() == 1 && n->get_input_shape(1).size() == 2 &&
+                   n->get_argument(1)->is_constant();
+        };
+        if (!is_fusible(root))
+        {
+            return false;
+        }
+
+        std::vector<std::shared_ptr<Node>> dot_nodes;
+        std::vector<std::shared_ptr<op::Constant>> weights_nodes;
+        for (auto& input : data_value.get_target_inputs())
+        {
+            auto u = input.get_node()->shared_from_this();
+            if (input.get_index() != 0 || !is_fusible(u) ||
+                u->get_input_shape(1)[0] != root->get_input_shape(1)[0] ||
+                u->get_input_element_type(1) != root->get_input_element_type(1))
+            {
+                continue;
+            }
+            dot_nodes.push_back(u);
+            weights_nodes.push_back(as_type_ptr<op::Constant>(u->get_argument(1)));
+        }
+
+        if (dot_nodes.size() <= 1)
+        {
+            NGRAPH_DEBUG << "dot_horizontal_fusion: need more than one nodes to do fusion\n";
+            return false;
+        }
+
+        auto dot_new =
+            std::make_shared<ngraph::op::Dot>(data_value, concat_constants(weights_nodes, 1), 1);
+        replace_with_slices(dot_new, dot_nodes, dot_new->get_shape().size() - 1);
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(dot, "CPUHorizontalFusion.CpuDotHorizontalFusion");
+    this->add_matcher(m, callback);
+}
+
+void ngraph::runtime::cpu::pass::CPUHorizontalFusion::cpu_matmul_bias_horizontal_fusion()
+{
+    Shape shape_w{2, 4};
+    Shape shape_x{4, 3};
+    auto W = std::make_shared<pattern::op::Label>(element::f32, shape_w, has_multiple_users);
+    auto x = std::make_shared<pattern::op::Label>(
+        element::f32, shape_x, pattern::has_class<op::Constant>());
+    auto b = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{3}, pattern::has_class<op::Constant>());
+    auto matmul_bias = std::make_shared<ngraph::op::MatmulBias>(
+        W, x, b, shape_w, shape_x, false, false, AxisSet{0});
+    auto matmul = std::make_shared<ngraph::op::MatmulBias>(
+        W, x, std::shared_ptr<Node>(), shape_w, shape_x, false, false);
+
+    auto callback = [](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "matmul_bias_horizontal_fusion: In a callback for "
+                     << m.get_match_root()->get_name();
+
+        auto root = std::static_pointer_cast<ngraph::op::MatmulBias>(m.get_match_root());
+        if (root->get_users().empty())
+        {
+            NGRAPH_DEBUG << "matmul_bias_horizontal_fusion: root node has been replaced\n";
+            return false;
+        }
+
+        auto w_value = root->input_value(0);
+        bool has_bias = root->get_input_size() == 3;
+        // Only a bias broadcast along the rows is split with the columns of the output
+        if (has_bias && root->get_broadcast_axes() != AxisSet{0})
+        {
+            return false;
+        }
+        auto is_fusible = [&](const std::shared_ptr<Node>& n) {
+            auto mb = as_type_ptr<ngraph::op::MatmulBias>(n);
+            return mb && is_used(n.get()) && n->input_value(0) == w_value &&
+                   mb->get_a_shape() == root->get_a_shape() &&
+                   mb->get_is_a_transposed() == root->get_is_a_transposed() &&
+                   mb->get_is_b_transposed() == root->get_is_b_transposed() &&
+                   mb->get_broadcast_axes() == root->get_broadcast_axes() &&
+                   n->get_input_size() == root->get_input_size() &&
+                   n->get_argument(1)->is_constant() &&
+                   (!has_bias || n->get_argument(2)->is_constant()) &&
+                   n->get_input_element_type(1) == root->get_input_element_type(1);
+        };
+        if (!is_fusible(root))
+        {
+            return false;
+        }
+
+        std::vector<std::shared_ptr<Node>> matmul_nodes;
+        std::vector<std::shared_ptr<op::Constant>> x_nodes;
+        std::vector<std::shared_ptr<op::Constant>> bias_nodes;
+        for (auto& input : w_value.get_target_inputs())
+        {
+            auto u = input.get_node()->shared_from_this();
+            if (input.get_index() != 0 || !is_fusible(u))
+            {
+                continue;
+            }
+            matmul_nodes.push_back(u);
+            x_nodes.push_back(as_type_ptr<op::Constant>(u->get_argument(1)));
+            if (has_bias)
+            {
+                bias_nodes.push_back(as_type_ptr<op::Constant>(u->get_argument(2)));
+            }
+        }
+
+        if (matmul_nodes.size() <= 1)
+        {
+            NGRAPH_DEBUG << "matmul_bias_horizontal_fusion: need more than one nodes to do "
+                            "fusion\n";
+            return false;
+        }
+
+        // The columns of the output are the columns of x, or its rows when x is transposed
+        auto x_new = concat_constants(x_nodes, root->get_is_b_transposed() ? 0 : 1);
+        auto matmul_bias_new = std::make_shared<ngraph::op::MatmulBias>(
+            w_value,
+            x_new,
+            has_bias ? concat_constants(bias_nodes, 0) : nullptr,
+            root->get_a_shape(),
+            x_new->get_shape(),
+            root->get_is_a_transposed(),
+            root->get_is_b_transposed(),
+            root->get_broadcast_axes());
+        replace_with_slices(matmul_bias_new, matmul_nodes, 1);
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(matmul_bias,
+                                           "CPUHorizontalFusion.CpuMatmulBiasHorizontalFusion");
+    this->add_matcher(m, callback);
+    auto m_no_bias =
+        make_shared<pattern::Matcher>(matmul, "CPUHorizontalFusion.CpuMatmulHorizontalFusion");
+    this->add_matcher(m_no_bias, callback);
+}
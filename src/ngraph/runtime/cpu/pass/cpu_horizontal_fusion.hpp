@@ -39,8 +39,15 @@ public:
         : GraphRewrite()
     {
         cpu_conv_horizontal_fusion();
+        cpu_dot_horizontal_fusion();
+        cpu_matmul_bias_horizontal_fusion();
     }
 
 private:
     void cpu_conv_horizontal_fusion();
+    /// \brief Fuses Dots sharing their first argument, and multiplying it with constant
+    ///        weights, into one Dot with concatenated weights followed by Slices
+    void cpu_dot_horizontal_fusion();
+    /// \brief The same as cpu_dot_horizontal_fusion for MatmulBias with constant x and bias
+    void cpu_matmul_bias_horizontal_fusion();
 };
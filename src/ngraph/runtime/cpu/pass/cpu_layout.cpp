@@ -15,10 +15,14 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
+#include <unordered_map>
 
 #include <mkldnn.hpp>
 
@@ -43,6 +47,7 @@
 #include "ngraph/op/lrn.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/op.hpp"
+#include "ngraph/op/pad.hpp"
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/op/quantized_convolution.hpp"
 #include "ngraph/op/relu.hpp"
@@ -54,6 +59,7 @@
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
+#include "ngraph/runtime/cpu/mkldnn_conv_tuner.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
@@ -79,6 +85,74 @@ using namespace ngraph::runtime::cpu;
 #define FORMAT format_tag
 #endif
 
+// Returns a conversion of `output` to `md` that an earlier consumer already inserted, so
+// that every consumer requiring the same layout reads one shared reorder
+static shared_ptr<Node> find_conversion(const descriptor::Output& output,
+                                        const memory::desc& md)
+{
+    for (auto input : output.get_inputs())
+    {
+        auto user = input->get_node();
+        if (!is_type<runtime::cpu::op::ConvertLayout>(user))
+        {
+            continue;
+        }
+        auto tvl = dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(
+            user->get_output_tensor_ptr(0)->get_tensor_layout());
+        if (tvl && tvl->is_mkldnn_layout() &&
+            mkldnn_utils::compare_mkldnn_mds(tvl->get_mkldnn_md(), md))
+        {
+            return user;
+        }
+    }
+    return nullptr;
+}
+
+static size_t tensor_bytes(const descriptor::Tensor& tv)
+{
+    return shape_size(tv.get_shape()) * tv.get_element_type().size();
+}
+
+// Bytes reordered for a consumer to read `output` in `md`
+static size_t conversion_bytes(const descriptor::Output& output, const memory::desc& md)
+{
+    auto tvl = dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(
+        output.get_tensor_ptr()->get_tensor_layout());
+    if (!tvl || !tvl->is_mkldnn_layout() ||
+        mkldnn_utils::compare_mkldnn_mds(tvl->get_mkldnn_md(), md) || find_conversion(output, md))
+    {
+        return 0;
+    }
+    return tensor_bytes(output.get_tensor());
+}
+
+static bool requires_native_layout(const Node* node);
+
+// Bytes reordered downstream if `node` produces `md`, counting the users known to convert
+// their inputs back to the native layout
+static size_t native_conversion_bytes(const Node* node, const memory::desc& md)
+{
+    auto tv = node->get_output_tensor_ptr(0);
+    auto strides = row_major_strides(tv->get_shape());
+    if (!mkldnn_utils::can_create_mkldnn_md(tv->get_shape(), strides, tv->get_element_type()) ||
+        mkldnn_utils::compare_mkldnn_mds(
+            md,
+            mkldnn_utils::create_blocked_mkldnn_md(
+                tv->get_shape(), strides, tv->get_element_type())))
+    {
+        return 0;
+    }
+    size_t bytes = 0;
+    for (auto& user : node->get_users())
+    {
+        if (requires_native_layout(user.get()))
+        {
+            bytes += tensor_bytes(*tv);
+        }
+    }
+    return bytes;
+}
+
 // Check if the input layout matches the layout requested in `required_mds`
 // If not, insert a layout conversion node between the input tensor and
 // the `node`. For now, only MKLDNN nodes/kernels can request specific layouts
@@ -125,12 +199,21 @@ static shared_ptr<Node>
 
         if (!mkldnn_utils::compare_mkldnn_mds(tvl->get_mkldnn_md(), required_mds[index]))
         {
+            auto new_node = find_conversion(output, required_mds[index]);
+            replace_node = true;
+            if (new_node)
+            {
+                new_args.push_back(new_node);
+                NGRAPH_DEBUG << "Reusing conversion node " << new_node->get_name() << " for "
+                             << node->get_name();
+                index++;
+                continue;
+            }
             auto layout = std::make_shared<ngraph::runtime::cpu::LayoutDescriptor>(*tv);
             layout->set_mkldnn_md(required_mds[index]);
-            auto new_node = std::shared_ptr<Node>(
+            new_node = std::shared_ptr<Node>(
                 new runtime::cpu::op::ConvertLayout(output.get_node(), output.get_index(), layout));
             new_args.push_back(new_node);
-            replace_node = true;
 #if MKLDNN_VERSION_MAJOR < 1
             NGRAPH_DEBUG << "Inserted conversion node " << new_node->get_name() << " between "
                          << output.get_node()->get_name()
@@ -213,10 +296,14 @@ static void set_native_layouts(runtime::cpu::CPU_ExternalFunction* external_func
                 mkldnn_utils::create_blocked_mkldnn_md(shape, cpu_tvl->get_strides(), et);
             if (!mkldnn_utils::compare_mkldnn_mds(cpu_tvl->get_mkldnn_md(), native_md))
             {
-                auto layout = std::make_shared<ngraph::runtime::cpu::LayoutDescriptor>(*tv);
-                layout->set_mkldnn_md(native_md);
-                auto new_node = std::shared_ptr<Node>(new runtime::cpu::op::ConvertLayout(
-                    output.get_node(), output.get_index(), layout));
+                auto new_node = find_conversion(output, native_md);
+                if (!new_node)
+                {
+                    auto layout = std::make_shared<ngraph::runtime::cpu::LayoutDescriptor>(*tv);
+                    layout->set_mkldnn_md(native_md);
+                    new_node = std::shared_ptr<Node>(new runtime::cpu::op::ConvertLayout(
+                        output.get_node(), output.get_index(), layout));
+                }
                 new_args.push_back(new_node);
                 if (use_replace)
                 {
@@ -342,7 +429,15 @@ void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* exter
     {
         vector<memory::desc> i_mds;
         vector<memory::desc> o_mds;
-        int select = 0;
+        // Produce the layout of the argument that costs the fewest reordered bytes, counting
+        // the conversion of the other argument and those of users that need native layouts
+        size_t costs[2];
+        for (size_t i = 0; i < 2; i++)
+        {
+            costs[i] = conversion_bytes(node->get_inputs().at(1 - i).get_output(), arg_mds[i]) +
+                       native_conversion_bytes(node.get(), arg_mds[i]);
+        }
+        int select = costs[1] < costs[0] ? 1 : 0;
         char* ngraph_pass_cpu_layout_eltwise = std::getenv("NGRAPH_PASS_CPU_LAYOUT_ELTWISE");
         if (ngraph_pass_cpu_layout_eltwise != nullptr)
         {
@@ -361,6 +456,20 @@ void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* exter
     }
 }
 
+// Input and output layouts chosen for MKLDNN convolutions, keyed by everything
+// ConvolutionLayout reads. Structurally identical convolutions, as in unrolled RNNs and stacked
+// residual or transformer blocks, and recompiles of the same model reuse the descriptors of the
+// first instance instead of creating another primitive descriptor.
+static mutex s_convolution_layouts_mutex;
+static unordered_map<string, pair<vector<memory::desc>, vector<memory::desc>>>
+    s_convolution_layouts;
+static atomic<size_t> s_reused_layouts{0};
+
+size_t runtime::cpu::pass::CPULayout::get_reused_layouts()
+{
+    return s_reused_layouts;
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -418,13 +527,6 @@ namespace ngraph
                                                         window_dilation_strides_adjusted.end());
                     memory::dims mkldnn_padding_below(padding_below.begin(), padding_below.end());
                     memory::dims mkldnn_padding_above(padding_above.begin(), padding_above.end());
-                    const memory::desc input_data_desc(mkldnn_arg0_shape, et, memory::FORMAT::any);
-                    const memory::desc weights_desc(
-                        mkldnn_arg1_shape, et_weights, memory::FORMAT::any);
-                    const memory::desc result_desc(
-                        mkldnn_result_shape, et_result, memory::FORMAT::any);
-
-                    std::unique_ptr<convolution_forward::desc> fwd_desc{nullptr};
                     auto convolution_algo = mkldnn_utils::get_conv_algo();
 
                     // I/p channels less than 8 & convolution_algo = convolution_auto
@@ -438,57 +540,131 @@ namespace ngraph
                         convolution_algo = mkldnn::algorithm::convolution_direct;
                     }
 
-                    if (use_bias)
-                    {
-                        memory::data_type et_bias =
-                            mkldnn_utils::get_mkldnn_data_type(node->get_input_element_type(2));
-                        auto arg2_shape = node->get_input_shape(2);
-                        memory::dims mkldnn_arg2_shape(arg2_shape.begin(), arg2_shape.end());
-                        const memory::desc bias_desc(
-                            mkldnn_arg2_shape, et_bias, memory::FORMAT::any);
-                        try
+                    // The gemm implementation is direct convolution on plain layouts
+                    auto make_fwd_desc = [&](mkldnn::algorithm algo,
+                                             bool plain) -> convolution_forward::desc {
+                        auto data_format = plain ? memory::FORMAT::nchw : memory::FORMAT::any;
+                        auto weights_format = plain ? memory::FORMAT::oihw : memory::FORMAT::any;
+                        const memory::desc input_data_desc(mkldnn_arg0_shape, et, data_format);
+                        const memory::desc weights_desc(
+                            mkldnn_arg1_shape, et_weights, weights_format);
+                        const memory::desc result_desc(mkldnn_result_shape, et_result, data_format);
+                        if (use_bias)
                         {
-                            fwd_desc.reset(
-                                new convolution_forward::desc(prop_kind::forward,
-                                                              convolution_algo,
-                                                              input_data_desc,
-                                                              weights_desc,
-                                                              bias_desc, // with bias
-                                                              result_desc,
-                                                              mkldnn_filter_strides,
-                                                              mkldnn_dilated_strides,
-                                                              mkldnn_padding_below,
-                                                              mkldnn_padding_above PADDING));
+                            memory::data_type et_bias = mkldnn_utils::get_mkldnn_data_type(
+                                node->get_input_element_type(2));
+                            auto arg2_shape = node->get_input_shape(2);
+                            memory::dims mkldnn_arg2_shape(arg2_shape.begin(), arg2_shape.end());
+                            const memory::desc bias_desc(
+                                mkldnn_arg2_shape, et_bias, memory::FORMAT::any);
+                            return convolution_forward::desc(prop_kind::forward,
+                                                             algo,
+                                                             input_data_desc,
+                                                             weights_desc,
+                                                             bias_desc, // with bias
+                                                             result_desc,
+                                                             mkldnn_filter_strides,
+                                                             mkldnn_dilated_strides,
+                                                             mkldnn_padding_below,
+                                                             mkldnn_padding_above PADDING);
                         }
-                        catch (const mkldnn::error& e)
+                        return convolution_forward::desc(prop_kind::forward,
+                                                         algo,
+                                                         input_data_desc,
+                                                         weights_desc,
+                                                         result_desc,
+                                                         mkldnn_filter_strides,
+                                                         mkldnn_dilated_strides,
+                                                         mkldnn_padding_below,
+                                                         mkldnn_padding_above PADDING);
+                    };
+
+                    // Ungrouped f32 2D convolutions can be tuned, see MKLDNNConvTuner
+                    using ConvolutionImpl = CPUOpAnnotations::ConvolutionImpl;
+                    auto impl = ConvolutionImpl::unset;
+                    if (node->get_input_element_type(0) == element::f32 && arg0_shape[1] > 8 &&
+                        arg0_shape.size() == 4 && arg1_shape.size() == 4)
+                    {
+                        bool winograd_shape = arg1_shape[2] == 3 && arg1_shape[3] == 3 &&
+                                              filter_strides == Strides{1, 1} &&
+                                              convolution->get_window_dilation_strides() ==
+                                                  Strides{1, 1};
+                        auto benchmark = [&](ConvolutionImpl candidate) -> double {
+                            if (candidate == ConvolutionImpl::winograd && !winograd_shape)
+                            {
+                                return -1;
+                            }
+                            try
+                            {
+                                return MKLDNNConvTuner::time_convolution(
+                                    make_fwd_desc(candidate == ConvolutionImpl::winograd
+                                                      ? algorithm::convolution_winograd
+                                                      : algorithm::convolution_direct,
+                                                  candidate == ConvolutionImpl::gemm),
+                                    use_bias);
+                            }
+                            catch (const mkldnn::error&)
+                            {
+                                return -1;
+                            }
+                        };
+                        impl = MKLDNNConvTuner::get().select(
+                            MKLDNNConvTuner::make_key(*node,
+                                                      filter_strides,
+                                                      convolution->get_window_dilation_strides(),
+                                                      padding_below,
+                                                      padding_above),
+                            benchmark);
+                        if (impl != ConvolutionImpl::unset)
                         {
-                            throw ngraph_error(
-                                "setting layouts on Convolution failed with MKLDNN error: " +
-                                MKLDNN_ERROR_MESSAGE);
+                            convolution_algo = impl == ConvolutionImpl::winograd
+                                                   ? algorithm::convolution_winograd
+                                                   : algorithm::convolution_direct;
                         }
                     }
-                    else
+                    auto op_annotations =
+                        static_pointer_cast<ngraph::op::Op>(node)->get_op_annotations();
+                    if (op_annotations)
                     {
-                        try
-                        {
-                            fwd_desc.reset(
-                                new convolution_forward::desc(prop_kind::forward,
-                                                              convolution_algo,
-                                                              input_data_desc,
-                                                              weights_desc,
-                                                              result_desc,
-                                                              mkldnn_filter_strides,
-                                                              mkldnn_dilated_strides,
-                                                              mkldnn_padding_below,
-                                                              mkldnn_padding_above PADDING));
-                        }
-                        catch (const mkldnn::error& e)
+                        static_pointer_cast<CPUOpAnnotations>(op_annotations)
+                            ->set_convolution_impl(impl);
+                    }
+
+                    stringstream key;
+                    key << typeid(T).name() << " " << use_bias << " " << arg0_shape << " "
+                        << arg1_shape << " " << result_shape << " " << filter_strides << " "
+                        << convolution->get_window_dilation_strides() << " " << padding_below
+                        << " " << padding_above << " " << static_cast<int>(convolution_algo)
+                        << " " << static_cast<int>(impl);
+                    for (auto& input : node->inputs())
+                    {
+                        key << " " << input.get_element_type() << input.get_shape();
+                    }
+                    key << " " << node->get_output_element_type(0);
+                    {
+                        lock_guard<mutex> lock(s_convolution_layouts_mutex);
+                        auto it = s_convolution_layouts.find(key.str());
+                        if (it != s_convolution_layouts.end())
                         {
-                            throw ngraph_error(
-                                "setting layouts on Convolution failed with MKLDNN error: " +
-                                MKLDNN_ERROR_MESSAGE);
+                            i_mds = it->second.first;
+                            o_mds = it->second.second;
+                            s_reused_layouts++;
+                            return;
                         }
                     }
+
+                    std::unique_ptr<convolution_forward::desc> fwd_desc{nullptr};
+                    try
+                    {
+                        fwd_desc.reset(new convolution_forward::desc(
+                            make_fwd_desc(convolution_algo, impl == ConvolutionImpl::gemm)));
+                    }
+                    catch (const mkldnn::error& e)
+                    {
+                        throw ngraph_error(
+                            "setting layouts on Convolution failed with MKLDNN error: " +
+                            MKLDNN_ERROR_MESSAGE);
+                    }
                     convolution_forward::primitive_desc prim_desc(*fwd_desc,
                                                                   executor::global_cpu_engine);
 #if MKLDNN_VERSION_MAJOR < 1
@@ -510,6 +686,9 @@ namespace ngraph
                     }
                     o_mds.push_back(prim_desc.dst_desc());
 #endif
+
+                    lock_guard<mutex> lock(s_convolution_layouts_mutex);
+                    s_convolution_layouts.emplace(key.str(), make_pair(i_mds, o_mds));
                 }
 
                 template <typename T, bool use_bias>
@@ -2006,19 +2185,30 @@ namespace ngraph
                         // Input is in row-major layout
                         if (reshape->get_is_transpose())
                         {
+                            // Non-MKLDNN layouts are always row-major, so a transpose can only be
+                            // expressed as a strided view when every user reads its input through
+                            // an MKLDNN memory descriptor. The view then aliases the input.
+                            auto input_shape = reshape->get_input_shape(0);
                             auto input_strides = cpu_tvl->get_strides();
-                            auto axis_order = reshape->get_input_order();
-                            Strides output_strides(input_strides.size());
-                            for (size_t i = 0; i < input_strides.size(); i++)
+                            auto et = reshape->get_input_element_type(0);
+                            bool mkldnn_users = !node->get_users().empty();
+                            for (auto& user : node->get_users())
                             {
-                                output_strides[i] = input_strides[axis_order[i]];
+                                mkldnn_users &= mkldnn_utils::use_mkldnn_kernel(user.get());
+                            }
+                            if (mkldnn_users &&
+                                mkldnn_utils::can_create_mkldnn_md(input_shape, input_strides, et))
+                            {
+                                auto input_md = mkldnn_utils::create_blocked_mkldnn_md(
+                                    input_shape, input_strides, et);
+                                if (can_be_rotated(reshape, input_md))
+                                {
+                                    auto output_md = mkldnn_utils::rotate_blocked_md(
+                                        input_md, reshape->get_input_order());
+                                    set_output_layouts(node, {output_md});
+                                    skip_reshape = true;
+                                }
                             }
-
-                            auto output_tvl = dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(
-                                node->get_output_tensor_ptr()->get_tensor_layout());
-                            // TODO (jbobba): For now non-MKLDNN layouts are always in row-major
-                            // format. Enable this once we support non row-major strided formats
-                            // output_tvl->set_strides(output_strides);
                         }
                         else
                         {
@@ -2498,6 +2688,47 @@ namespace ngraph
                     }
                 }
 
+                template <>
+                void CPULayout::LAYOUT_DECL(ngraph::op::Pad)
+                {
+                    // A Pad that leaves the batch and channel axes alone pads the spatial axes of
+                    // a channel-blocked input without converting it to the native layout
+                    auto pad = static_cast<const ngraph::op::Pad*>(node.get());
+                    auto arg_shape = node->get_input_shape(0);
+                    auto& padding_below = pad->get_padding_below();
+                    auto& padding_above = pad->get_padding_above();
+                    size_t block = 0;
+                    if ((arg_shape.size() == 4 || arg_shape.size() == 5) &&
+                        padding_below[0] == 0 && padding_below[1] == 0 &&
+                        padding_above[0] == 0 && padding_above[1] == 0)
+                    {
+                        auto input_md = mkldnn_utils::get_input_mkldnn_md(node.get(), 0);
+                        block = mkldnn_utils::get_mkldnn_channel_block(input_md);
+                    }
+
+                    if (block != 0 && arg_shape[1] % block == 0)
+                    {
+                        memory::FORMAT format;
+                        if (arg_shape.size() == 4)
+                        {
+                            format = block == 8 ? memory::FORMAT::nChw8c : memory::FORMAT::nChw16c;
+                        }
+                        else
+                        {
+                            format =
+                                block == 8 ? memory::FORMAT::nCdhw8c : memory::FORMAT::nCdhw16c;
+                        }
+                        vector<memory::desc> o_mds;
+                        o_mds.push_back(
+                            mkldnn_utils::create_default_mkldnn_md(node.get(), 0, true, format));
+                        set_output_layouts(node, o_mds);
+                    }
+                    else
+                    {
+                        set_native_layouts(external_function, node);
+                    }
+                }
+
                 template <>
                 void CPULayout::LAYOUT_DECL(ngraph::op::Lstm)
                 {
@@ -2649,6 +2880,7 @@ static const runtime::cpu::pass::LayoutOpMap s_dispatcher{
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::ReluBackprop>},
     {TI(ngraph::op::SigmoidBackprop),
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::SigmoidBackprop>},
+    {TI(ngraph::op::Pad), &runtime::cpu::pass::CPULayout::layout<ngraph::op::Pad>},
     {TI(ngraph::op::Lstm), &runtime::cpu::pass::CPULayout::layout<ngraph::op::Lstm>},
     {TI(ngraph::op::Rnn), &runtime::cpu::pass::CPULayout::layout<ngraph::op::Rnn>},
     {TI(ngraph::op::Softmax), &runtime::cpu::pass::CPULayout::layout<ngraph::op::Softmax>},
@@ -2673,8 +2905,60 @@ static const runtime::cpu::pass::LayoutOpMap s_dispatcher{
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::QuantizedMatmul>},
 };
 
+static bool requires_native_layout(const Node* node)
+{
+    if (auto result = as_type<const ngraph::op::Result>(node))
+    {
+        return result->needs_default_layout();
+    }
+    return s_dispatcher.find(TI(*node)) == s_dispatcher.end() &&
+           !node->is_unary_elementwise_arithmetic() && !node->is_binary_elementwise_arithmetic();
+}
+
+// Logs the layout conversions of `f`, largest first, with the bytes each one moves
+static void report_conversions(const shared_ptr<Function>& f)
+{
+    vector<pair<size_t, shared_ptr<Node>>> conversions;
+    size_t total_bytes = 0;
+    for (auto& node : f->get_ops())
+    {
+        if (is_type<runtime::cpu::op::ConvertLayout>(node))
+        {
+            size_t bytes = tensor_bytes(*node->get_output_tensor_ptr(0));
+            conversions.push_back({bytes, node});
+            total_bytes += bytes;
+        }
+    }
+    NGRAPH_DEBUG << f->get_name() << " needs " << conversions.size()
+                 << " layout conversions moving " << total_bytes << " bytes";
+    if (conversions.empty() || std::getenv("NGRAPH_CPU_LAYOUT_REPORT") == nullptr)
+    {
+        return;
+    }
+
+    stable_sort(conversions.begin(),
+                conversions.end(),
+                [](const pair<size_t, shared_ptr<Node>>& a,
+                   const pair<size_t, shared_ptr<Node>>& b) { return a.first > b.first; });
+    stringstream ss;
+    ss << f->get_name() << ": " << conversions.size() << " layout conversions, " << total_bytes
+       << " bytes";
+    for (auto& conversion : conversions)
+    {
+        auto& node = conversion.second;
+        ss << "\n  " << node->get_name() << ": " << conversion.first << " bytes from "
+           << node->get_argument(0)->get_name() << " to";
+        for (auto& user : node->get_users())
+        {
+            ss << " " << user->get_name();
+        }
+    }
+    NGRAPH_INFO << ss.str();
+}
+
 bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::shared_ptr<Node>>& nodes)
 {
+    size_t reused_layouts = s_reused_layouts;
     for (const auto& node : nodes)
     {
         auto& n = *node;
@@ -2696,6 +2980,9 @@ bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::share
             set_native_layouts(m_external_function, node);
         }
     }
+    NGRAPH_DEBUG << m_external_function->get_function()->get_name() << " reused the layouts of "
+                 << s_reused_layouts - reused_layouts << " convolutions";
+    report_conversions(m_external_function->get_function());
 
     return false;
 }
@@ -36,6 +36,13 @@ namespace ngraph
 
                 using LayoutOpMap = std::unordered_map<std::type_index, LayoutFunction>;
 
+                /// \brief Assigns MKLDNN layouts to tensors and inserts ConvertLayout ops where
+                ///        a consumer needs another layout than its producer gives.
+                ///
+                /// Consumers that need the same layout of a tensor share one conversion. A binary
+                /// elementwise op produces the layout of whichever argument costs the fewest
+                /// reordered bytes, counting its users that need native layouts. Set
+                /// NGRAPH_CPU_LAYOUT_REPORT to log the remaining conversions and their sizes.
                 class CPULayout : public ngraph::pass::CallGraphPass
                 {
                 public:
@@ -51,6 +58,10 @@ namespace ngraph
                         layout(ngraph::runtime::cpu::CPU_ExternalFunction* external_function,
                                std::shared_ptr<ngraph::Node> node);
 
+                    /// \brief Number of convolutions, process-wide, that reused the layouts
+                    ///        chosen for a structurally identical convolution.
+                    static size_t get_reused_layouts();
+
                 private:
                     CPU_ExternalFunction* m_external_function;
                 };
@@ -15,8 +15,10 @@
 //*****************************************************************************
 
 #include <exception>
+#include <memory>
 #include <sstream>
 
+#include "ngraph/descriptor/layout/tensor_layout.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/concat.hpp"
@@ -24,6 +26,7 @@
 #include "ngraph/op/slice.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/pass_util.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_memory_assignment.hpp"
 #include "ngraph/util.hpp"
@@ -36,9 +39,12 @@ runtime::cpu::pass::CPUMemoryAssignment::CPUMemoryAssignment(
         bufferID_to_tensorSets,
     unordered_map<descriptor::Tensor*, size_t>& tensor_to_bufferID,
     size_t alignment,
-    bool disable_memory_sharing)
+    bool disable_memory_sharing,
+    ngraph::pass::MemoryManager::allocation_scheme scheme)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_scheme(disable_memory_sharing ? ngraph::pass::MemoryManager::allocation_scheme::NO_REUSE
+                                      : scheme)
     , m_bufferID_to_tensorSets(bufferID_to_tensorSets)
     , m_tensor_to_bufferID(tensor_to_bufferID)
 {
@@ -368,7 +374,9 @@ void runtime::cpu::pass::CPUMemoryAssignment::build_buffer_sets_maps(list<shared
             {
                 // tensor of function output should not be in the same set as function input,
                 // constant, output, or in place slice, because they cannot share the same memory
-                // buffer
+                // buffer. kernel::result copies in each of these four cases: the value is a
+                // parameter, the value is a constant, the value is already bound to another
+                // output, or the value is an in place slice view of a larger buffer.
                 auto ele = std::pair<TensorRole, unordered_set<descriptor::Tensor*>>(
                     TensorRole::OUTPUT, unordered_set<descriptor::Tensor*>({output_tensor}));
                 m_bufferID_to_tensorSets[count] = ele;
@@ -377,7 +385,11 @@ void runtime::cpu::pass::CPUMemoryAssignment::build_buffer_sets_maps(list<shared
             }
             else
             {
-                // in place output
+                // in place output: the producer and the tensors sharing its buffer are bound to
+                // the caller's output tensor, so the producer writes the result directly and
+                // kernel::result sees the same pointer twice and does not copy. OUTPUT sets are
+                // never allocated, so no destructive oi pair can move the producer back into
+                // the pool either.
                 m_bufferID_to_tensorSets[bufferID].first = TensorRole::OUTPUT;
                 m_bufferID_to_tensorSets[bufferID].second.insert(output_tensor);
                 m_tensor_to_bufferID[output_tensor] = bufferID;
@@ -628,7 +640,19 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
     // memory assignment using liveness analysis result
 
     // memory manager for non-cacheable ops, memory allocation will be freed when not longer in use
-    ngraph::pass::MemoryManager mm(m_alignment, m_disable_memory_sharing);
+    // when packing, the pool offsets of non-cacheable tensors hold buffer ids until pack()
+    bool packed = m_scheme == ngraph::pass::MemoryManager::allocation_scheme::PACKED;
+    unique_ptr<ngraph::pass::MemoryManager> mm;
+    unique_ptr<ngraph::pass::MemoryPacker> packer;
+    if (packed)
+    {
+        packer.reset(new ngraph::pass::MemoryPacker(m_alignment));
+    }
+    else
+    {
+        mm.reset(new ngraph::pass::MemoryManager(m_alignment, m_scheme));
+    }
+    unordered_set<descriptor::Tensor*> packed_tensors;
     // memory manager for cacheable ops, memory allocation will never be freed
     ngraph::pass::MemoryManager mm_caching(m_alignment, true);
 
@@ -668,97 +692,127 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
         unordered_set<descriptor::Tensor*> no_new;
 
         auto op = std::static_pointer_cast<op::Op>(node);
-        if (auto op_annotations = op->get_op_annotations())
+        auto op_annotations = op->get_op_annotations();
+        bool cacheable = op_annotations && op_annotations->is_cacheable();
+        vector<ngraph::op::util::oi_pair> oi_pairs;
+        if (op_annotations)
         {
-            for (auto oi_pair : op_annotations->get_in_place_oi_pairs())
+            oi_pairs = op_annotations->get_in_place_oi_pairs();
+        }
+        // Elementwise ops without hints can also overwrite an input that dies here
+        bool implicit_oi_pairs = oi_pairs.empty() && !m_disable_memory_sharing;
+        if (implicit_oi_pairs)
+        {
+            for (size_t input_index : ngraph::pass::get_in_place_elementwise_inputs(*node))
             {
-                auto output_tensor = &node->output(oi_pair.output).get_tensor();
-                auto input_tensor = &node->input_value(oi_pair.input).get_tensor();
-                auto input_op = node->input_value(oi_pair.input).get_node_shared_ptr();
+                oi_pairs.push_back({0, input_index, true});
+            }
+        }
+        for (auto oi_pair : oi_pairs)
+        {
+            auto output_tensor = &node->output(oi_pair.output).get_tensor();
+            auto input_tensor = &node->input_value(oi_pair.input).get_tensor();
+            auto input_op = node->input_value(oi_pair.input).get_node_shared_ptr();
 
-                if (oi_pair.destructive && node->liveness_free_list.count(input_tensor) != 0 &&
-                    node->liveness_new_list.count(output_tensor) != 0)
+            if (oi_pair.destructive && node->liveness_free_list.count(input_tensor) != 0 &&
+                node->liveness_new_list.count(output_tensor) != 0 &&
+                no_new.count(output_tensor) == 0)
+            {
+                // The kernel reads and writes both buffers in the same order only when their
+                // layouts match
+                if (implicit_oi_pairs)
                 {
-                    if (auto input_op_annotations = input_op->get_op_annotations())
+                    auto input_layout = input_tensor->get_tensor_layout();
+                    auto output_layout = output_tensor->get_tensor_layout();
+                    if (!input_layout || !output_layout || !(*input_layout == *output_layout))
                     {
-                        // when reusing memory, ops with different cacheabilities are using
-                        // different memory manager
-                        // and should not share the same buffer.
-                        if (!m_disable_memory_sharing &&
-                            input_op_annotations->is_cacheable() != op_annotations->is_cacheable())
-                        {
-                            NGRAPH_DEBUG << "cpu_memory_assignment: reusing memory with "
-                                            "input and output have different cacheabilities, no "
-                                            "destructive oi";
-                            continue;
-                        }
+                        continue;
                     }
-
-                    auto input_bufferID = get_bufferID(input_tensor);
-                    auto output_bufferID = get_bufferID(output_tensor);
-
-                    auto input_buffer_it = m_bufferID_to_tensorSets.find(input_bufferID);
-                    NGRAPH_CHECK(input_buffer_it != m_bufferID_to_tensorSets.end());
-                    // do not modify function inputs and constants, so no destructive oi
-                    if (input_buffer_it->second.first == TensorRole::INPUT ||
-                        input_buffer_it->second.first == TensorRole::CONSTANT)
+                }
+                if (auto input_op_annotations = input_op->get_op_annotations())
+                {
+                    // when reusing memory, ops with different cacheabilities are using
+                    // different memory manager
+                    // and should not share the same buffer.
+                    if (!m_disable_memory_sharing &&
+                        input_op_annotations->is_cacheable() != cacheable)
                     {
-                        NGRAPH_DEBUG << "cpu_memory_assignment: input is function input or "
-                                        "constant, no destructive oi";
+                        NGRAPH_DEBUG << "cpu_memory_assignment: reusing memory with "
+                                        "input and output have different cacheabilities, no "
+                                        "destructive oi";
                         continue;
                     }
-                    auto input_set = input_buffer_it->second.second;
-                    // check buffer sizes, if required output buffer is larger than input
-                    // buffer, do not reuse input buffer get the largest tensor size, which is
-                    // the size of the memory buffer for the set
-                    size_t input_size = input_tensor->size();
-                    // get the smallest offset, which is the offset of the memory buffer for the
-                    // set
-                    size_t offset = input_tensor->get_pool_offset();
-                    for (auto e : input_set)
+                }
+
+                auto input_bufferID = get_bufferID(input_tensor);
+                auto output_bufferID = get_bufferID(output_tensor);
+
+                auto input_buffer_it = m_bufferID_to_tensorSets.find(input_bufferID);
+                NGRAPH_CHECK(input_buffer_it != m_bufferID_to_tensorSets.end());
+                // do not modify function inputs and constants, so no destructive oi
+                if (input_buffer_it->second.first == TensorRole::INPUT ||
+                    input_buffer_it->second.first == TensorRole::CONSTANT)
+                {
+                    NGRAPH_DEBUG << "cpu_memory_assignment: input is function input or "
+                                    "constant, no destructive oi";
+                    continue;
+                }
+                auto input_set = input_buffer_it->second.second;
+                // check buffer sizes, if required output buffer is larger than input
+                // buffer, do not reuse input buffer get the largest tensor size, which is
+                // the size of the memory buffer for the set
+                size_t input_size = input_tensor->size();
+                // get the smallest offset, which is the offset of the memory buffer for the
+                // set
+                size_t offset = input_tensor->get_pool_offset();
+                for (auto e : input_set)
+                {
+                    if (e->size() > input_size)
                     {
-                        if (e->size() > input_size)
-                        {
-                            input_size = e->size();
-                        }
-                        if (e->get_pool_offset() < offset)
-                        {
-                            offset = e->get_pool_offset();
-                        }
+                        input_size = e->size();
                     }
-                    auto output_buffer_it = m_bufferID_to_tensorSets.find(output_bufferID);
-                    NGRAPH_CHECK(output_buffer_it != m_bufferID_to_tensorSets.end());
-                    auto output_set = output_buffer_it->second.second;
-                    size_t output_size = input_tensor->size();
-                    // get the largest tensor size, which is the size of memory buffer for the
-                    // set
-                    for (auto e : output_set)
+                    if (e->get_pool_offset() < offset)
                     {
-                        if (e->size() > output_size)
-                        {
-                            output_size = e->size();
-                        }
+                        offset = e->get_pool_offset();
                     }
-                    if (input_size < output_size)
+                }
+                auto output_buffer_it = m_bufferID_to_tensorSets.find(output_bufferID);
+                NGRAPH_CHECK(output_buffer_it != m_bufferID_to_tensorSets.end());
+                auto output_set = output_buffer_it->second.second;
+                size_t output_size = input_tensor->size();
+                // get the largest tensor size, which is the size of memory buffer for the
+                // set
+                for (auto e : output_set)
+                {
+                    if (e->size() > output_size)
                     {
-                        continue;
+                        output_size = e->size();
                     }
-                    NGRAPH_DEBUG << "cpu_memory_assignment: last use of input tensor, "
-                                    "destructive oi allowed:";
-                    NGRAPH_DEBUG << "input_tensor is " << input_tensor->get_name();
-                    NGRAPH_DEBUG << "output_tensor is " << output_tensor->get_name();
-                    no_free.insert(input_tensor);
-                    no_new.insert(output_tensor);
-
-                    // set the tensor offset for tensors in the set containing the output tensor
-                    // to the starting offset
-                    // of the set of input tensor.
-                    // do not combine those two sets.
-                    // change the label of output tensor set to that of input tensor set
-                    output_buffer_it->second.first = input_buffer_it->second.first;
-                    for (auto& ele_t : output_set)
+                }
+                if (input_size < output_size)
+                {
+                    continue;
+                }
+                NGRAPH_DEBUG << "cpu_memory_assignment: last use of input tensor, "
+                                "destructive oi allowed:";
+                NGRAPH_DEBUG << "input_tensor is " << input_tensor->get_name();
+                NGRAPH_DEBUG << "output_tensor is " << output_tensor->get_name();
+                no_free.insert(input_tensor);
+                no_new.insert(output_tensor);
+
+                // set the tensor offset for tensors in the set containing the output tensor
+                // to the starting offset
+                // of the set of input tensor.
+                // do not combine those two sets.
+                // change the label of output tensor set to that of input tensor set
+                output_buffer_it->second.first = input_buffer_it->second.first;
+                bool input_packed = packed_tensors.count(input_tensor) != 0;
+                for (auto& ele_t : output_set)
+                {
+                    ele_t->set_pool_offset(offset);
+                    if (input_packed)
                     {
-                        ele_t->set_pool_offset(offset);
+                        packed_tensors.insert(ele_t);
                     }
                 }
             }
@@ -783,19 +837,30 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
                     size = e->size();
                 }
             }
+            bool packed_tensor = false;
             if (m_tensor_caching.count(tensor) != 0)
             {
                 offset = mm_caching.allocate(size);
             }
+            else if (packed)
+            {
+                offset = packer->allocate(size);
+                packed_tensor = true;
+            }
             else
             {
-                offset = mm.allocate(size);
+                offset = mm->allocate(size);
             }
             tensor->set_pool_offset(offset);
             for (auto& e : tensor_set)
             {
                 e->set_pool_offset(offset);
             }
+            if (packed_tensor)
+            {
+                packed_tensors.insert(tensor);
+                packed_tensors.insert(tensor_set.begin(), tensor_set.end());
+            }
         }
 
         // when reusing memory, free when done
@@ -810,12 +875,35 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
                 if (m_tensor_caching.empty() ||
                     (!m_tensor_caching.empty() && m_tensor_caching.count(tensor) == 0))
                 {
-                    mm.free(tensor->get_pool_offset());
+                    if (packed)
+                    {
+                        packer->free(tensor->get_pool_offset());
+                    }
+                    else
+                    {
+                        mm->free(tensor->get_pool_offset());
+                    }
                 }
             }
         }
     }
 
+    size_t max_allocated = 0;
+    if (packed)
+    {
+        max_allocated = packer->pack();
+        for (descriptor::Tensor* tensor : packed_tensors)
+        {
+            tensor->set_pool_offset(packer->get_offset(tensor->get_pool_offset()));
+        }
+        NGRAPH_DEBUG << "cpu_memory_assignment: packed into " << max_allocated
+                     << " bytes, lower bound " << packer->lower_bound() << " bytes";
+    }
+    else
+    {
+        max_allocated = mm->max_allocated();
+    }
+
     // update offsets in concat and slice tensors set.
     // In place concatenation optimization
     process_in_place_concat(ops);
@@ -824,7 +912,7 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
     process_in_place_slice(ops);
 
     // update the offset for intermediate tensors in tensor_caching
-    auto start = mm.max_allocated();
+    auto start = max_allocated;
     for (auto item : m_tensor_caching)
     {
         auto bufferID = get_bufferID(item);
@@ -838,13 +926,13 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
         }
     }
 
-    NGRAPH_DEBUG << "cpu_memory_assignemnt: max allocated for mm is " << mm.max_allocated();
+    NGRAPH_DEBUG << "cpu_memory_assignemnt: max allocated for mm is " << max_allocated;
     NGRAPH_DEBUG << "cpu_memory_assignment: max allocated for mm_caching is "
                  << mm_caching.max_allocated();
     NGRAPH_DEBUG << "cpu_memory_assignment: max allocated in total is "
-                 << mm.max_allocated() + mm_caching.max_allocated();
+                 << max_allocated + mm_caching.max_allocated();
 
-    function->set_temporary_pool_size(mm.max_allocated() + mm_caching.max_allocated());
+    function->set_temporary_pool_size(max_allocated + mm_caching.max_allocated());
 
     return false;
 }
@@ -48,6 +48,21 @@
 ///
 /// After optimization: the result of add1 is stored to the memory buffer assigned to concat, same
 /// for add2 and add3.
+///
+/// Example3 (Stack, which is decomposed into Reshapes that add the stacking axis and a Concat):
+/// parameter1 parameter2        parameter3 parameter4
+///    \          /                 \          /
+///         add1                        add2
+///           |                           |
+///       reshape1                    reshape2
+///           \                           /
+///                      concat
+///
+/// After optimization: reshape1 and reshape2 are pass-through, so add1 and add2 write straight
+/// into the memory buffer assigned to concat.
+///
+/// In-place slices read the slice from the input buffer at an offset. Split is decomposed into
+/// Slices, so splits along the outermost non-unit axis produce views of their input.
 
 #include "ngraph/runtime/cpu/pass/cpu_memory_optimization.hpp"
 
@@ -55,12 +70,82 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/reshape.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 
 using namespace ngraph;
 
+// True if the input and output of an MKLDNN typed slice have the same format and the input is in
+// native layout, so that the slice is a contiguous part of its input.
+static bool is_native_layout_slice(const std::shared_ptr<ngraph::op::Slice>& slice)
+{
+    auto n = slice.get();
+    auto output_md = mkldnn_utils::get_output_mkldnn_md(n, 0);
+    auto input_md = mkldnn_utils::get_input_mkldnn_md(n, 0);
+#if MKLDNN_VERSION_MAJOR < 1
+    auto output_format = static_cast<mkldnn::memory::format>(output_md.data.format);
+    auto input_format = static_cast<mkldnn::memory::format>(input_md.data.format);
+    if (output_format != input_format)
+    {
+        NGRAPH_DEBUG << "cpu_memory_optimization: input format is different from "
+                        "output format, no in place slice";
+        return false;
+    }
+#else
+    if (!mkldnn_utils::compare_mkldnn_md_formats(output_md, input_md))
+    {
+        NGRAPH_DEBUG << "cpu_memory_optimization: input format is different from "
+                        "output format, no in place slice";
+        return false;
+    }
+#endif
+
+    // If input layout is in non-native layout, we need more complicated checks for
+    // slice contiguity. Bail out for now.
+    auto input_tensor = slice->get_inputs().at(0).get_output().get_tensor_ptr();
+    auto native_md =
+        mkldnn_utils::create_blocked_mkldnn_md(slice->get_input_shape(0),
+                                               input_tensor->get_tensor_layout()->get_strides(),
+                                               slice->get_input_element_type(0));
+    if (!mkldnn_utils::compare_mkldnn_mds(input_md, native_md))
+    {
+        NGRAPH_DEBUG << "cpu_memory_optimization: Non-native layout for MKLDNN slice input";
+        return false;
+    }
+    return true;
+}
+
+// A pass-through Reshape, such as the ones Stack adds the stacking axis with, whose producer
+// feeds nothing else and can therefore write into the buffer of the concat using the reshape.
+static bool is_in_place_concat_reshape(const std::shared_ptr<Node>& node)
+{
+    auto reshape = as_type_ptr<ngraph::op::Reshape>(node);
+    if (!reshape || reshape->get_is_transpose())
+    {
+        return false;
+    }
+    auto in_place_oi_pairs = reshape->get_op_annotations()->get_in_place_oi_pairs();
+    if (in_place_oi_pairs.size() != 1 || in_place_oi_pairs[0].destructive)
+    {
+        return false;
+    }
+
+    auto arg = reshape->get_argument(0);
+    if (arg->is_constant() || arg->is_parameter() || arg->get_output_size() != 1 ||
+        arg->get_output_inputs(0).size() != 1)
+    {
+        return false;
+    }
+    if (!arg->is_op())
+    {
+        return false;
+    }
+    auto annotation = std::static_pointer_cast<ngraph::op::Op>(arg)->get_op_annotations();
+    return !annotation || annotation->get_in_place_oi_pairs().empty();
+}
+
 bool runtime::cpu::pass::CPUMemoryOptimization::run_on_function(std::shared_ptr<Function> function)
 {
     for (auto n : function->get_ordered_ops())
@@ -153,8 +238,8 @@ bool runtime::cpu::pass::CPUMemoryOptimization::run_on_function(std::shared_ptr<
                     {
                         auto op = std::static_pointer_cast<ngraph::op::Op>(arg);
                         auto annotation = op->get_op_annotations();
-                        if (annotation && annotation->get_in_place_oi_pairs().size() > 0)
-
+                        if (annotation && annotation->get_in_place_oi_pairs().size() > 0 &&
+                            !is_in_place_concat_reshape(arg))
                         {
                             NGRAPH_DEBUG << "cpu_memory_optimization: " << arg->get_name()
                                          << ": in place non-concat op, no in place concat";
@@ -287,47 +372,11 @@ bool runtime::cpu::pass::CPUMemoryOptimization::run_on_function(std::shared_ptr<
                 continue;
             }
 
-            // check if input and output formats are the same
-            auto output_md = mkldnn_utils::get_output_mkldnn_md(n.get(), 0);
-            auto input_md = mkldnn_utils::get_input_mkldnn_md(n.get(), 0);
-#if MKLDNN_VERSION_MAJOR < 1
-            auto output_format = static_cast<mkldnn::memory::format>(output_md.data.format);
-            auto input_format = static_cast<mkldnn::memory::format>(input_md.data.format);
-            if (output_format != input_format)
-            {
-                NGRAPH_DEBUG << "cpu_memory_optimization: input format is different from "
-                                "output format, no in place slice";
-                continue;
-            }
-#else
-            if (!mkldnn_utils::compare_mkldnn_md_formats(output_md, input_md))
-            {
-                NGRAPH_DEBUG << "cpu_memory_optimization: input format is different from "
-                                "output format, no in place slice";
-                continue;
-            }
-#endif
-
-            const auto& dtype = slice->get_input_element_type(0);
-            if (runtime::cpu::mkldnn_utils::get_mkldnn_data_type(dtype) ==
-                mkldnn::memory::data_type::DATA_UNDEF)
-            {
-                NGRAPH_DEBUG << "cpu_memory_optimization: "
-                             << slice->get_input_element_type(0).c_type_string()
-                             << " isn't supported, no in place slice";
-                continue;
-            }
-
-            // If input layout is in non-native layout, we need more complicated checks for
-            // slice contiguity. Bail out for now.
-            auto input_tensor = slice->get_inputs().at(0).get_output().get_tensor_ptr();
-            auto native_md = mkldnn_utils::create_blocked_mkldnn_md(
-                in_shape,
-                input_tensor->get_tensor_layout()->get_strides(),
-                slice->get_input_element_type(0));
-            if (!mkldnn_utils::compare_mkldnn_mds(input_md, native_md))
+            // Tensors of element types MKLDNN does not support are always in row-major layout,
+            // so only MKLDNN types need their formats checked
+            if (mkldnn_utils::can_create_mkldnn_md(slice->get_input_element_type(0)) &&
+                !is_native_layout_slice(slice))
             {
-                NGRAPH_DEBUG << "cpu_memory_optimization: Non-native layout for MKLDNN slice input";
                 continue;
             }
 
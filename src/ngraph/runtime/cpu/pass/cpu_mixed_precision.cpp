@@ -0,0 +1,72 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+#include <cstring>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_mixed_precision.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+bool runtime::cpu::pass::CPUMixedPrecision::is_enabled_by_default()
+{
+    const char* env = getenv("NGRAPH_CPU_MIXED_PRECISION");
+    return env != nullptr && strcmp(env, "bf16") == 0;
+}
+
+static Output<Node> to_bf16(const Output<Node>& value)
+{
+    // bf16 -> f32 -> bf16 is exact
+    auto convert = as_type_ptr<op::Convert>(value.get_node_shared_ptr());
+    if (convert && convert->input_value(0).get_element_type() == element::bf16)
+    {
+        return convert->input_value(0);
+    }
+    return make_shared<op::Convert>(value, element::bf16)->output(0);
+}
+
+bool runtime::cpu::pass::CPUMixedPrecision::run_on_function(shared_ptr<Function> function)
+{
+    if (!runtime::cpu::mkldnn_utils::is_bf16_supported())
+    {
+        NGRAPH_DEBUG << "MKLDNN has no bf16 support on this host, keeping convolutions in f32";
+        return false;
+    }
+
+    bool modified = false;
+    for (auto& node : function->get_ordered_ops())
+    {
+        auto convolution = as_type_ptr<op::Convolution>(node);
+        if (!convolution || convolution->get_input_element_type(0) != element::f32 ||
+            convolution->get_input_element_type(1) != element::f32 ||
+            !runtime::cpu::mkldnn_utils::can_use_mkldnn_conv<op::Convolution>(node.get()))
+        {
+            continue;
+        }
+
+        auto bf16_convolution = convolution->copy_with_new_inputs(
+            {to_bf16(convolution->input_value(0)), to_bf16(convolution->input_value(1))});
+        replace_node(convolution, make_shared<op::Convert>(bf16_convolution, element::f32));
+        modified = true;
+    }
+    return modified;
+}
@@ -0,0 +1,49 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Runs f32 convolutions in bf16 on hosts where MKLDNN supports it.
+                ///
+                /// The data and filters of each f32 Convolution that MKLDNN can run are
+                /// converted to bf16 and its result is converted back to f32. MKLDNN
+                /// accumulates bf16 convolutions in f32, and every other op, including softmax,
+                /// normalization and reductions, keeps running in f32. A bf16 value converted to
+                /// f32 and straight back is used directly.
+                ///
+                /// Disabled unless NGRAPH_CPU_MIXED_PRECISION is set to "bf16" or the pass is
+                /// enabled through NGRAPH_PASS_ENABLES.
+                class CPUMixedPrecision : public ngraph::pass::FunctionPass
+                {
+                public:
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+                    static bool is_enabled_by_default();
+                };
+            }
+        }
+    }
+}
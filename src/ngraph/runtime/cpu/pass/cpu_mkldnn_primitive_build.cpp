@@ -879,14 +879,17 @@ namespace ngraph
                     mkldnn_emitter.reserve_descriptor_space(descs.size());
                     serialize_memory_descs(desc_file, descs, deps[0]);
 
+                    // The layouts were chosen for the tuned algorithm
+                    auto conv_algo_string =
+                        mkldnn_utils::get_conv_algo(node) ==
+                                mkldnn::algorithm::convolution_winograd
+                            ? "mkldnn::algorithm::convolution_winograd,\n"
+                            : "mkldnn::algorithm::convolution_direct,\n";
                     writer << "\n// build QConv primitive descriptor\n";
                     writer << "auto conv_desc = "
                               "mkldnn::convolution_forward::desc(mkldnn::prop_kind::forward,\n"
-                              "mkldnn::algorithm::convolution_direct,\n"
-                              "*cg_ctx->mkldnn_descriptors["
-                           << desc_index << "],\n"
-                                            "*cg_ctx->mkldnn_descriptors["
-                           << desc_index + 1 << "],\n";
+                           << conv_algo_string << "*cg_ctx->mkldnn_descriptors[" << desc_index
+                           << "],\n*cg_ctx->mkldnn_descriptors[" << desc_index + 1 << "],\n";
                     if (mkldnn_emitter.has_bias<OP>())
                     {
                         writer << "*cg_ctx->mkldnn_descriptors[" << desc_index + 2 << "],\n";
@@ -32,7 +32,10 @@
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/exp.hpp"
+#include "ngraph/op/fused/gru_cell.hpp"
 #include "ngraph/op/fused/lstm_cell.hpp"
+#include "ngraph/op/fused/lstm_sequence.hpp"
+#include "ngraph/op/fused/rnn_cell.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
@@ -53,6 +56,7 @@
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/rnn_utils.hpp"
+#include "ngraph/util.hpp"
 
 #define STR(X) #X
 #define CHECK_RANK(X, RANK)                                                                        \
@@ -1046,7 +1050,8 @@ void ngraph::runtime::cpu::pass::MultiLayerRNNFusion::construct_multi_layer_rnn_
                 (rnn_node->get_src_sequence_length() != sequence_len) ||
                 (rnn_node->get_src_iter_feature_size() != src_iter_feature_size) ||
                 (rnn_node->get_num_cell_states() != num_rnn_cell_states) ||
-                (rnn_node->get_direction() != rnn_direction))
+                (rnn_node->get_direction() != rnn_direction) ||
+                (rnn_node->get_rnn_type() != rnn_type))
             {
                 NGRAPH_DEBUG << "RNN attributes dont match";
                 return false;
@@ -1266,6 +1271,12 @@ void ngraph::runtime::cpu::pass::BiDirectionalRnn::construct_bidirectional_rnn()
             return false;
         }
 
+        if (rnn_ltor_node->get_rnn_type() != rnn_rtol_node->get_rnn_type())
+        {
+            NGRAPH_DEBUG << " Not fusing, cell type of rnn's in both direction should match";
+            return false;
+        }
+
         if (rnn_ltor_node->get_src_layer_feature_size() !=
             rnn_rtol_node->get_src_layer_feature_size())
         {
@@ -1298,8 +1309,7 @@ void ngraph::runtime::cpu::pass::BiDirectionalRnn::construct_bidirectional_rnn()
         size_t num_rnn_cell_states = rnn_ltor_node->get_num_cell_states();
         size_t rnn_direction = 2;
         size_t num_fused_rnn_layers = 1;
-        ngraph::runtime::cpu::rnn_utils::rnntype rnn_type =
-            ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_lstm;
+        ngraph::runtime::cpu::rnn_utils::rnntype rnn_type = rnn_ltor_node->get_rnn_type();
 
         auto construct_birnn_inputs = [&](int index) {
             auto nodes =
@@ -1376,3 +1386,430 @@ void ngraph::runtime::cpu::pass::BiDirectionalRnn::construct_bidirectional_rnn()
     auto m = std::make_shared<ngraph::pattern::Matcher>(concat, "BiDirectionalRnn");
     this->add_matcher(m, callback);
 }
+
+// Redirects the users of value, directly or through its GetOutputElement, to replacement
+static void replace_output(const Output<Node>& value, const std::shared_ptr<Node>& replacement)
+{
+    for (auto& input : value.get_target_inputs())
+    {
+        if (is_type<ngraph::op::GetOutputElement>(input.get_node()))
+        {
+            ngraph::replace_node(input.get_node()->shared_from_this(), replacement);
+        }
+        else
+        {
+            input.replace_source_output(replacement->output(0));
+        }
+    }
+}
+
+static std::shared_ptr<Node> transpose_2d(const Output<Node>& value)
+{
+    auto& shape = value.get_shape();
+    return std::make_shared<ngraph::op::Reshape>(
+        value, AxisVector{1, 0}, Shape{shape.at(1), shape.at(0)});
+}
+
+bool ngraph::runtime::cpu::pass::ONNXRNNFusion::is_fusible(const Node& node)
+{
+    if (node.is_dynamic() || node.get_input_element_type(0) != element::f32)
+    {
+        return false;
+    }
+    auto node_ptr = const_cast<Node*>(&node);
+    auto has_default_activations = [](const ngraph::op::util::RNNCellBase& cell,
+                                      const std::vector<std::string>& activations) {
+        return cell.get_activations() == activations && cell.get_activations_alpha().empty() &&
+               cell.get_activations_beta().empty() && cell.get_clip() == 0.f;
+    };
+#if MKLDNN_VERSION_MAJOR < 1
+    if (auto gru_cell = as_type<ngraph::op::GRUCell>(node_ptr))
+    {
+        return gru_cell->get_input_size() == 5 &&
+               has_default_activations(*gru_cell, {"sigmoid", "tanh"});
+    }
+    if (auto rnn_cell = as_type<ngraph::op::RNNCell>(node_ptr))
+    {
+        return rnn_cell->get_input_size() == 5 && has_default_activations(*rnn_cell, {"tanh"});
+    }
+#else
+    (void)has_default_activations;
+#endif
+    if (auto lstm_sequence = as_type<ngraph::op::LSTMSequence>(node_ptr))
+    {
+        auto activations = lstm_sequence->get_activations();
+        for (auto& activation : activations)
+        {
+            activation = to_lower(activation);
+        }
+        if (lstm_sequence->get_input_size() != 8 ||
+            lstm_sequence->get_direction() == ngraph::op::LSTMSequence::direction::REVERSE ||
+            activations != std::vector<std::string>{"sigmoid", "tanh", "tanh"} ||
+            !lstm_sequence->get_activations_alpha().empty() ||
+            !lstm_sequence->get_activations_beta().empty() ||
+            lstm_sequence->get_clip_threshold() != 0.f || lstm_sequence->get_input_forget())
+        {
+            return false;
+        }
+
+        // The MKLDNN LSTM has no peepholes and runs every batch entry for the whole sequence
+        auto peepholes = as_type_ptr<ngraph::op::Constant>(lstm_sequence->get_argument(7));
+        auto sequence_lengths =
+            as_type_ptr<ngraph::op::Constant>(lstm_sequence->get_argument(3));
+        if (!peepholes || !sequence_lengths)
+        {
+            return false;
+        }
+        auto peephole_values = peepholes->cast_vector<float>();
+        auto length_values = sequence_lengths->cast_vector<int64_t>();
+        auto seq_length = static_cast<int64_t>(lstm_sequence->get_input_shape(0).at(0));
+        return std::all_of(peephole_values.begin(),
+                           peephole_values.end(),
+                           [](float value) { return value == 0.f; }) &&
+               std::all_of(length_values.begin(),
+                           length_values.end(),
+                           [seq_length](int64_t length) { return length == seq_length; });
+    }
+    return false;
+}
+
+#if MKLDNN_VERSION_MAJOR < 1
+// Replaces a single cell of an ONNX recurrent op by an Rnn with one time step
+static void fuse_rnn_cell(const std::shared_ptr<Node>& cell,
+                          const Output<Node>& X,
+                          const Output<Node>& H_t,
+                          const Output<Node>& W,
+                          const Output<Node>& R,
+                          const std::shared_ptr<Node>& bias,
+                          size_t gates_count,
+                          ngraph::runtime::cpu::rnn_utils::rnntype rnn_type)
+{
+    // MKLDNN takes the weights as {input_size, gates_count * hidden_size}
+    auto rnn = std::make_shared<ngraph::op::Rnn>(
+        X, H_t, transpose_2d(W), transpose_2d(R), bias, 1, gates_count, 1, 1, 1, 1, rnn_type);
+    ngraph::replace_node(cell, std::make_shared<ngraph::op::GetOutputElement>(rnn, 0));
+}
+
+void ngraph::runtime::cpu::pass::ONNXRNNFusion::construct_gru_cell()
+{
+    size_t ref_batch_size = 2;
+    size_t ref_input_size = 3;
+    size_t ref_hidden_size = 3;
+    size_t ref_gates_count = 3;
+
+    auto X =
+        std::make_shared<pattern::op::Label>(element::f32, Shape{ref_batch_size, ref_input_size});
+    auto W = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{ref_gates_count * ref_hidden_size, ref_input_size});
+    auto R = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{ref_gates_count * ref_hidden_size, ref_hidden_size});
+    auto H_t =
+        std::make_shared<pattern::op::Label>(element::f32, Shape{ref_batch_size, ref_hidden_size});
+    auto B = std::make_shared<pattern::op::Label>(element::f32,
+                                                  Shape{2 * ref_gates_count * ref_hidden_size});
+    auto ref_gru_cell = std::make_shared<ngraph::op::GRUCell>(X, W, R, H_t, ref_hidden_size, B);
+
+    auto callback = [](pattern::Matcher& m) {
+        auto gru_cell = std::static_pointer_cast<ngraph::op::GRUCell>(m.get_match_root());
+        if (!is_fusible(*gru_cell))
+        {
+            NGRAPH_DEBUG << "GRUCell " << gru_cell->get_name() << " is not supported by MKLDNN";
+            return false;
+        }
+
+        // ONNX and MKLDNN share the zrh gate order. B holds the biases of W and of R.
+        auto hidden_size = gru_cell->get_hidden_size();
+        auto B = gru_cell->input_value(4);
+        auto bias_slice = [&](size_t gate_begin, size_t gate_end) {
+            return std::make_shared<ngraph::op::Slice>(
+                B, Coordinate{gate_begin * hidden_size}, Coordinate{gate_end * hidden_size});
+        };
+
+        std::shared_ptr<Node> bias;
+        ngraph::runtime::cpu::rnn_utils::rnntype rnn_type;
+        if (gru_cell->get_linear_before_reset())
+        {
+            // The recurrent bias of the candidate gate is added before the reset gate applies,
+            // so MKLDNN keeps it as a fourth bias
+            auto zr_bias = std::make_shared<ngraph::op::Add>(bias_slice(0, 2), bias_slice(3, 5));
+            bias = std::make_shared<ngraph::op::Concat>(
+                NodeVector{zr_bias, bias_slice(2, 3), bias_slice(5, 6)}, 0);
+            rnn_type = ngraph::runtime::cpu::rnn_utils::rnntype::gru_linear_before_reset;
+        }
+        else
+        {
+            bias = std::make_shared<ngraph::op::Add>(bias_slice(0, 3), bias_slice(3, 6));
+            rnn_type = ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_gru;
+        }
+
+        fuse_rnn_cell(gru_cell,
+                      gru_cell->input_value(0),
+                      gru_cell->input_value(3),
+                      gru_cell->input_value(1),
+                      gru_cell->input_value(2),
+                      bias,
+                      3,
+                      rnn_type);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(ref_gru_cell, "ONNXRNNFusion.gru_cell");
+    this->add_matcher(m, callback);
+}
+
+void ngraph::runtime::cpu::pass::ONNXRNNFusion::construct_rnn_cell()
+{
+    size_t ref_batch_size = 2;
+    size_t ref_input_size = 3;
+    size_t ref_hidden_size = 3;
+
+    auto X =
+        std::make_shared<pattern::op::Label>(element::f32, Shape{ref_batch_size, ref_input_size});
+    auto H_t =
+        std::make_shared<pattern::op::Label>(element::f32, Shape{ref_batch_size, ref_hidden_size});
+    auto W =
+        std::make_shared<pattern::op::Label>(element::f32, Shape{ref_hidden_size, ref_input_size});
+    auto R =
+        std::make_shared<pattern::op::Label>(element::f32, Shape{ref_hidden_size, ref_hidden_size});
+    auto B = std::make_shared<pattern::op::Label>(element::f32, Shape{ref_hidden_size});
+    auto ref_rnn_cell = std::make_shared<ngraph::op::RNNCell>(X, H_t, W, R, B, ref_hidden_size);
+
+    auto callback = [](pattern::Matcher& m) {
+        auto rnn_cell = std::static_pointer_cast<ngraph::op::RNNCell>(m.get_match_root());
+        if (!is_fusible(*rnn_cell))
+        {
+            NGRAPH_DEBUG << "RNNCell " << rnn_cell->get_name() << " is not supported by MKLDNN";
+            return false;
+        }
+
+        fuse_rnn_cell(rnn_cell,
+                      rnn_cell->input_value(0),
+                      rnn_cell->input_value(1),
+                      rnn_cell->input_value(2),
+                      rnn_cell->input_value(3),
+                      rnn_cell->input_value(4).get_node_shared_ptr(),
+                      1,
+                      ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_rnn);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(ref_rnn_cell, "ONNXRNNFusion.rnn_cell");
+    this->add_matcher(m, callback);
+}
+#endif
+
+// Slice d of a tensor stacked along its outermost num_directions axis, without that axis
+static std::shared_ptr<Node> get_direction(const Output<Node>& value, size_t d)
+{
+    auto& shape = value.get_shape();
+    Coordinate lower(shape.size(), 0);
+    Coordinate upper(shape);
+    lower[0] = d;
+    upper[0] = d + 1;
+    auto slice = std::make_shared<ngraph::op::Slice>(value, lower, upper);
+    return std::make_shared<ngraph::op::Reshape>(
+        slice, get_default_order(shape.size()), Shape(shape.begin() + 1, shape.end()));
+}
+
+// Reorders the four gates stacked along the outermost axis of value into the IFCO order of MKLDNN
+static std::shared_ptr<Node> convert_to_ifco(const std::shared_ptr<Node>& value,
+                                             ngraph::op::LSTMWeightsFormat format)
+{
+    static const std::map<ngraph::op::LSTMWeightsFormat, std::vector<size_t>> gate_order{
+        {ngraph::op::LSTMWeightsFormat::FICO, {1, 0, 2, 3}},
+        {ngraph::op::LSTMWeightsFormat::ICOF, {0, 3, 1, 2}},
+        {ngraph::op::LSTMWeightsFormat::IFOC, {0, 1, 3, 2}},
+        {ngraph::op::LSTMWeightsFormat::IOFC, {0, 2, 3, 1}},
+    };
+    if (format == ngraph::op::LSTMWeightsFormat::IFCO)
+    {
+        return value;
+    }
+
+    auto& shape = value->get_shape();
+    size_t gate_size = shape.at(0) / 4;
+    NodeVector gates;
+    for (auto gate : gate_order.at(format))
+    {
+        Coordinate lower(shape.size(), 0);
+        Coordinate upper(shape);
+        lower[0] = gate * gate_size;
+        upper[0] = (gate + 1) * gate_size;
+        gates.push_back(std::make_shared<ngraph::op::Slice>(value, lower, upper));
+    }
+    return std::make_shared<ngraph::op::Concat>(gates, 0);
+}
+
+void ngraph::runtime::cpu::pass::ONNXRNNFusion::construct_lstm_sequence()
+{
+    size_t ref_seq_length = 2;
+    size_t ref_batch_size = 2;
+    size_t ref_input_size = 3;
+    size_t ref_hidden_size = 3;
+    size_t ref_gates_count = 4;
+
+    auto X = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{ref_seq_length, ref_batch_size, ref_input_size});
+    auto H_init = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{1, ref_batch_size, ref_hidden_size});
+    auto C_init = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{1, ref_batch_size, ref_hidden_size});
+    auto sequence_lengths =
+        std::make_shared<pattern::op::Label>(element::i32, Shape{ref_batch_size});
+    auto W = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{1, ref_gates_count * ref_hidden_size, ref_input_size});
+    auto R = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{1, ref_gates_count * ref_hidden_size, ref_hidden_size});
+    auto B = std::make_shared<pattern::op::Label>(element::f32,
+                                                  Shape{1, ref_gates_count * ref_hidden_size});
+    auto P = std::make_shared<pattern::op::Label>(element::f32, Shape{1, 3 * ref_hidden_size});
+    auto ref_lstm_sequence = std::make_shared<ngraph::op::LSTMSequence>(
+        X,
+        H_init,
+        C_init,
+        sequence_lengths,
+        W,
+        R,
+        B,
+        P,
+        ref_hidden_size,
+        ngraph::op::LSTMSequence::direction::FORWARD);
+
+    auto callback = [](pattern::Matcher& m) {
+        auto lstm_sequence =
+            std::static_pointer_cast<ngraph::op::LSTMSequence>(m.get_match_root());
+        if (!is_fusible(*lstm_sequence))
+        {
+            NGRAPH_DEBUG << "LSTMSequence " << lstm_sequence->get_name()
+                         << " is not supported by MKLDNN";
+            return false;
+        }
+
+        auto& x_shape = lstm_sequence->get_input_shape(0);
+        size_t seq_length = x_shape.at(0);
+        size_t batch_size = x_shape.at(1);
+        size_t input_size = x_shape.at(2);
+        size_t hidden_size = lstm_sequence->get_hidden_size();
+        size_t direction =
+            lstm_sequence->get_direction() == ngraph::op::LSTMSequence::direction::BIDIRECTIONAL
+                ? 2
+                : 1;
+        auto weights_format = lstm_sequence->get_weights_format();
+
+        // X is already time major
+        auto src_layer = std::make_shared<ngraph::op::Reshape>(lstm_sequence->input_value(0),
+                                                               AxisVector{0, 1, 2},
+                                                               Shape{seq_length * batch_size,
+                                                                     input_size});
+
+        // Lay the weights out as MKLDNN's {direction, input_size, gates, hidden_size}
+        NodeVector weights_layer;
+        NodeVector weights_iter;
+        NodeVector bias;
+        for (size_t d = 0; d < direction; d++)
+        {
+            weights_layer.push_back(transpose_2d(
+                convert_to_ifco(get_direction(lstm_sequence->input_value(4), d), weights_format)));
+            weights_iter.push_back(transpose_2d(
+                convert_to_ifco(get_direction(lstm_sequence->input_value(5), d), weights_format)));
+            bias.push_back(
+                convert_to_ifco(get_direction(lstm_sequence->input_value(6), d), weights_format));
+        }
+
+        const size_t lstm_n_gates = 4;
+        const size_t num_cell_states = 2;
+        const size_t num_fused_layers = 1;
+        auto rnn_type = ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_lstm;
+        Shape state_shape{direction, batch_size, hidden_size};
+#if MKLDNN_VERSION_MAJOR < 1
+        // MKLDNN v0.x keeps the hidden and cell states together as {direction, 2, batch, hidden}
+        Shape single_state_shape{direction, 1, batch_size, hidden_size};
+        auto H_init = std::make_shared<ngraph::op::Reshape>(
+            lstm_sequence->input_value(1), AxisVector{0, 1, 2}, single_state_shape);
+        auto C_init = std::make_shared<ngraph::op::Reshape>(
+            lstm_sequence->input_value(2), AxisVector{0, 1, 2}, single_state_shape);
+        auto src_iter = std::make_shared<ngraph::op::Reshape>(
+            std::make_shared<ngraph::op::Concat>(NodeVector{H_init, C_init}, 1),
+            AxisVector{0, 1, 2, 3},
+            Shape{direction * num_cell_states * batch_size, hidden_size});
+
+        auto rnn = std::make_shared<ngraph::op::Rnn>(src_layer,
+                                                     src_iter,
+                                                     std::make_shared<ngraph::op::Concat>(
+                                                         weights_layer, 0),
+                                                     std::make_shared<ngraph::op::Concat>(
+                                                         weights_iter, 0),
+                                                     std::make_shared<ngraph::op::Concat>(bias, 0),
+                                                     seq_length,
+                                                     lstm_n_gates,
+                                                     seq_length,
+                                                     num_cell_states,
+                                                     direction,
+                                                     num_fused_layers,
+                                                     rnn_type);
+
+        auto dst_iter = std::make_shared<ngraph::op::Reshape>(
+            std::make_shared<ngraph::op::GetOutputElement>(rnn, 1),
+            AxisVector{0, 1},
+            Shape{direction, num_cell_states, batch_size, hidden_size});
+        auto Y_h = std::make_shared<ngraph::op::Reshape>(
+            std::make_shared<ngraph::op::Slice>(
+                dst_iter, Coordinate{0, 0, 0, 0}, single_state_shape),
+            AxisVector{0, 1, 2, 3},
+            state_shape);
+        auto Y_c = std::make_shared<ngraph::op::Reshape>(
+            std::make_shared<ngraph::op::Slice>(
+                dst_iter,
+                Coordinate{0, 1, 0, 0},
+                Coordinate{direction, num_cell_states, batch_size, hidden_size}),
+            AxisVector{0, 1, 2, 3},
+            state_shape);
+#else
+        Shape flat_state_shape{direction * batch_size, hidden_size};
+        auto src_iter = std::make_shared<ngraph::op::Reshape>(
+            lstm_sequence->input_value(1), AxisVector{0, 1, 2}, flat_state_shape);
+        auto src_iter_c = std::make_shared<ngraph::op::Reshape>(
+            lstm_sequence->input_value(2), AxisVector{0, 1, 2}, flat_state_shape);
+
+        auto rnn = std::make_shared<ngraph::op::Rnn>(src_layer,
+                                                     src_iter,
+                                                     src_iter_c,
+                                                     std::make_shared<ngraph::op::Concat>(
+                                                         weights_layer, 0),
+                                                     std::make_shared<ngraph::op::Concat>(
+                                                         weights_iter, 0),
+                                                     std::make_shared<ngraph::op::Concat>(bias, 0),
+                                                     seq_length,
+                                                     lstm_n_gates,
+                                                     seq_length,
+                                                     num_cell_states,
+                                                     direction,
+                                                     num_fused_layers,
+                                                     rnn_type);
+
+        auto Y_h = std::make_shared<ngraph::op::Reshape>(
+            std::make_shared<ngraph::op::GetOutputElement>(rnn, 1), AxisVector{0, 1}, state_shape);
+        auto Y_c = std::make_shared<ngraph::op::Reshape>(
+            std::make_shared<ngraph::op::GetOutputElement>(rnn, 2), AxisVector{0, 1}, state_shape);
+#endif
+
+        // MKLDNN concatenates the directions along the feature axis, ONNX stacks them as
+        // {seq_length, direction, batch, hidden}
+        auto Y = std::make_shared<ngraph::op::Reshape>(
+            std::make_shared<ngraph::op::Reshape>(
+                std::make_shared<ngraph::op::GetOutputElement>(rnn, 0),
+                AxisVector{0, 1},
+                Shape{seq_length, batch_size, direction, hidden_size}),
+            AxisVector{0, 2, 1, 3},
+            Shape{seq_length, direction, batch_size, hidden_size});
+
+        replace_output(lstm_sequence->output(0), Y);
+        replace_output(lstm_sequence->output(1), Y_h);
+        replace_output(lstm_sequence->output(2), Y_c);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(ref_lstm_sequence,
+                                                        "ONNXRNNFusion.lstm_sequence");
+    this->add_matcher(m, callback);
+}
@@ -32,6 +32,7 @@ namespace ngraph
                 class RNNFusion;
                 class BiDirectionalRnn;
                 class MultiLayerRNNFusion;
+                class ONNXRNNFusion;
             }
         }
     }
@@ -95,3 +96,35 @@ public:
 private:
     void construct_bidirectional_rnn();
 };
+
+/// \brief Lowers the fused ONNX recurrent ops onto the MKLDNN backed Rnn op, so that they are not
+///        decomposed into one subgraph per time step.
+///
+/// GRUCell and RNNCell become single step Rnn ops; they need MKLDNN v0.x, whose RNN primitive
+/// supports GRU and vanilla RNN cells. Forward and bidirectional LSTMSequences become a single
+/// Rnn over the whole sequence. The weights are transposed and their gates reordered into the
+/// MKLDNN layout with plain ops, which ConstantFolding packs once when the weights are constant.
+class CPU_BACKEND_API ngraph::runtime::cpu::pass::ONNXRNNFusion : public ngraph::pass::GraphRewrite
+{
+public:
+    ONNXRNNFusion()
+        : GraphRewrite()
+    {
+#if MKLDNN_VERSION_MAJOR < 1
+        construct_gru_cell();
+        construct_rnn_cell();
+#endif
+        construct_lstm_sequence();
+    }
+
+    /// \brief Whether node is one of the ops this pass lowers, with attributes MKLDNN supports:
+    ///        default activations, no clipping, no peepholes and full length sequences.
+    static bool is_fusible(const Node& node);
+
+private:
+#if MKLDNN_VERSION_MAJOR < 1
+    void construct_gru_cell();
+    void construct_rnn_cell();
+#endif
+    void construct_lstm_sequence();
+};
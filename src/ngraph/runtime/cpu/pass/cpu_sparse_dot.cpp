@@ -0,0 +1,82 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/runtime/cpu/op/sparse_dot.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_sparse_dot.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+double runtime::cpu::pass::CPUSparseDot::get_default_min_sparsity()
+{
+    const char* env = getenv("NGRAPH_CPU_SPARSE_DOT_SPARSITY");
+    return env != nullptr ? atof(env) : 0.9;
+}
+
+bool runtime::cpu::pass::CPUSparseDot::run_on_function(shared_ptr<Function> function)
+{
+    bool modified = false;
+    for (auto& node : function->get_ordered_ops())
+    {
+        auto dot = as_type_ptr<op::Dot>(node);
+        if (!dot || dot->get_reduction_axes_count() != 1 ||
+            dot->get_input_element_type(0) != element::f32 ||
+            !dot->get_input_partial_shape(0).is_static())
+        {
+            continue;
+        }
+
+        auto constant = as_type_ptr<op::Constant>(dot->input_value(1).get_node_shared_ptr());
+        if (!constant || constant->get_element_type() != element::f32 ||
+            constant->get_shape().size() != 2)
+        {
+            continue;
+        }
+
+        const Shape& shape = constant->get_shape();
+        size_t element_count = shape_size(shape);
+        if (element_count == 0 || element_count < m_min_elements)
+        {
+            continue;
+        }
+
+        const float* data = constant->get_data_ptr<float>();
+        size_t zero_count = 0;
+        for (size_t i = 0; i < element_count; i++)
+        {
+            zero_count += data[i] == 0.0f;
+        }
+        double sparsity = double(zero_count) / element_count;
+        if (sparsity < m_min_sparsity)
+        {
+            continue;
+        }
+
+        NGRAPH_DEBUG << "Converting " << dot->get_name() << " with " << shape
+                     << " weights of sparsity " << sparsity << " to SparseDot";
+        auto sparse_dot = make_shared<op::SparseDot>(dot->input_value(0),
+                                                     op::CSRWeights::from_dense(data, shape));
+        replace_node(dot, sparse_dot);
+        modified = true;
+    }
+    return modified;
+}
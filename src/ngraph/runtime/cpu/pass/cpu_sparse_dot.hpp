@@ -0,0 +1,58 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Replaces a Dot with highly sparse f32 constant weights on the right by
+                ///        a SparseDot holding the weights in CSR form.
+                ///
+                /// A Dot is converted when the fraction of zeros in its weights is at least
+                /// `min_sparsity` and the weights have at least `min_elements` elements; smaller
+                /// matrices are cheap enough for the dense kernel. The default sparsity can be
+                /// overridden with NGRAPH_CPU_SPARSE_DOT_SPARSITY.
+                class CPU_BACKEND_API CPUSparseDot : public ngraph::pass::FunctionPass
+                {
+                public:
+                    CPUSparseDot(double min_sparsity = get_default_min_sparsity(),
+                                 size_t min_elements = 4096)
+                        : m_min_sparsity(min_sparsity)
+                        , m_min_elements(min_elements)
+                    {
+                    }
+
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+                    static double get_default_min_sparsity();
+
+                private:
+                    double m_min_sparsity;
+                    size_t m_min_elements;
+                };
+            }
+        }
+    }
+}
@@ -14,6 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
 #include "ngraph/runtime/dynamic/dynamic_backend.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/op/avg_pool.hpp"
@@ -76,7 +80,13 @@ runtime::dynamic::DynamicExecutable::DynamicExecutable(shared_ptr<Function> wrap
     : m_wrapped_function(wrapped_function)
     , m_wrapped_backend(wrapped_backend)
     , m_enable_performance_collection(enable_performance_collection)
+    , m_cache_capacity(32)
 {
+    if (auto env_capacity = std::getenv("NGRAPH_DYNAMIC_CACHE_SIZE"))
+    {
+        m_cache_capacity = static_cast<size_t>(std::atoi(env_capacity));
+    }
+
     pass::Manager passes;
     passes.register_pass<pass::ShapeRelevance>();
     passes.run_passes(m_wrapped_function);
@@ -115,73 +125,312 @@ bool runtime::dynamic::DynamicExecutable::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
 {
-    // TODO: Get cached executable out if it exists.
-    // We will cache on:
-    // (1) all shapes;
-    // (2) all values of shape-relevant input tensors.
-
     NGRAPH_CHECK(m_wrapped_function->get_parameters().size() == inputs.size());
+    // The wrapped tensors carry no fences, and shape inference may read the inputs
+    runtime::Tensor::wait_for_fences(inputs);
+
+    return call_bucketed(outputs, inputs, 0);
+}
+
+void runtime::dynamic::DynamicExecutable::set_cache_capacity(size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+    m_cache_capacity = capacity;
+    while (m_cache.size() > m_cache_capacity)
+    {
+        m_cache_index.erase(m_cache.back().first);
+        m_cache.pop_back();
+    }
+}
+
+void runtime::dynamic::DynamicExecutable::set_bucketing_policy(const BucketingPolicy& policy)
+{
+    m_bucketing_policies.clear();
+    add_bucketing_policy(policy);
+}
+
+void runtime::dynamic::DynamicExecutable::add_bucketing_policy(const BucketingPolicy& policy)
+{
+    NGRAPH_CHECK(std::is_sorted(policy.buckets.begin(), policy.buckets.end()),
+                 "Bucket sizes must be in ascending order");
+    NGRAPH_CHECK(!policy.bounded || !policy.buckets.empty(),
+                 "A bounded bucketing policy needs at least one bucket");
+    m_bucketing_policies.push_back(policy);
+}
+
+// Copies the first `count` entries along `axis` from src to dst, where src and dst have the
+// same shape as `shape` except for their extents along `axis`
+static void copy_axis_prefix(const char* src,
+                             size_t src_extent,
+                             char* dst,
+                             size_t dst_extent,
+                             const Shape& shape,
+                             size_t axis,
+                             size_t count,
+                             size_t element_size)
+{
+    size_t outer = 1;
+    for (size_t i = 0; i < axis; i++)
+    {
+        outer *= shape[i];
+    }
+    size_t inner = element_size;
+    for (size_t i = axis + 1; i < shape.size(); i++)
+    {
+        inner *= shape[i];
+    }
+    for (size_t i = 0; i < outer; i++)
+    {
+        memcpy(dst + i * dst_extent * inner, src + i * src_extent * inner, count * inner);
+    }
+}
+
+bool runtime::dynamic::DynamicExecutable::call_bucketed(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+    size_t policy_index)
+{
+    if (policy_index == m_bucketing_policies.size())
+    {
+        return call_specialized(outputs, inputs);
+    }
+    const auto& policy = m_bucketing_policies[policy_index];
+    if (policy.buckets.empty() || policy.input_axes.empty())
+    {
+        return call_bucketed(outputs, inputs, policy_index + 1);
+    }
+
+    size_t length = 0;
+    bool first = true;
+    for (auto& p : policy.input_axes)
+    {
+        NGRAPH_CHECK(p.first < inputs.size(), "Bucketed input ", p.first, " does not exist");
+        const Shape& shape = inputs[p.first]->get_shape();
+        NGRAPH_CHECK(p.second < shape.size(),
+                     "Bucketed axis ",
+                     p.second,
+                     " is out of range for input ",
+                     p.first);
+        NGRAPH_CHECK(first || shape[p.second] == length,
+                     "Bucketed inputs must have the same length along their axes");
+        length = shape[p.second];
+        first = false;
+    }
+
+    auto bucket = std::lower_bound(policy.buckets.begin(), policy.buckets.end(), length);
+    NGRAPH_CHECK(!policy.bounded || bucket != policy.buckets.end(),
+                 "Length ",
+                 length,
+                 " exceeds the upper bound ",
+                 policy.buckets.back());
+    if (bucket == policy.buckets.end() || *bucket == length)
+    {
+        return call_bucketed(outputs, inputs, policy_index + 1);
+    }
+    size_t padded_length = *bucket;
+
+    std::vector<std::shared_ptr<runtime::Tensor>> padded_inputs = inputs;
+    for (auto& p : policy.input_axes)
+    {
+        auto& input = inputs[p.first];
+        const element::Type& type = input->get_element_type();
+        Shape padded_shape = input->get_shape();
+        padded_shape[p.second] = padded_length;
+
+        AlignedBuffer unpadded(input->get_size_in_bytes(), /*alignment=*/64);
+        input->read(unpadded.get_ptr(), unpadded.size());
+        AlignedBuffer padded(shape_size(padded_shape) * type.size(), /*alignment=*/64);
+        memset(padded.get_ptr(), 0, padded.size());
+        copy_axis_prefix(unpadded.get_ptr<char>(),
+                         length,
+                         padded.get_ptr<char>(),
+                         padded_length,
+                         padded_shape,
+                         p.second,
+                         length,
+                         type.size());
+
+        auto padded_input = m_wrapped_backend->create_tensor(type, padded_shape);
+        padded_input->write(padded.get_ptr(), padded.size());
+        padded_inputs[p.first] = padded_input;
+    }
+
+    std::vector<std::shared_ptr<runtime::Tensor>> padded_outputs = outputs;
+    for (auto& p : policy.output_axes)
+    {
+        NGRAPH_CHECK(p.first < outputs.size(), "Bucketed output ", p.first, " does not exist");
+        padded_outputs[p.first] =
+            make_shared<DynamicTensor>(get_results()[p.first]->get_output_element_type(0),
+                                       PartialShape::dynamic(),
+                                       m_wrapped_backend);
+    }
 
+    auto rc = call_bucketed(padded_outputs, padded_inputs, policy_index + 1);
+
+    for (auto& p : policy.output_axes)
+    {
+        auto& padded_output = padded_outputs[p.first];
+        const element::Type& type = padded_output->get_element_type();
+        Shape shape = padded_output->get_shape();
+        NGRAPH_CHECK(p.second < shape.size() && shape[p.second] == padded_length,
+                     "Output ",
+                     p.first,
+                     " is not padded along axis ",
+                     p.second);
+        shape[p.second] = length;
+
+        AlignedBuffer padded(padded_output->get_size_in_bytes(), /*alignment=*/64);
+        padded_output->read(padded.get_ptr(), padded.size());
+        AlignedBuffer unpadded(shape_size(shape) * type.size(), /*alignment=*/64);
+        copy_axis_prefix(padded.get_ptr<char>(),
+                         padded_length,
+                         unpadded.get_ptr<char>(),
+                         length,
+                         shape,
+                         p.second,
+                         length,
+                         type.size());
+
+        auto& output = outputs[p.first];
+        if (auto dynamic_tensor =
+                std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(output))
+        {
+            dynamic_tensor->make_storage(type, shape);
+        }
+        else
+        {
+            NGRAPH_CHECK(output->get_shape() == shape,
+                         "Output ",
+                         p.first,
+                         " has shape ",
+                         output->get_shape(),
+                         ", expected ",
+                         shape);
+        }
+        output->write(unpadded.get_ptr(), unpadded.size());
+    }
+
+    return rc;
+}
+
+bool runtime::dynamic::DynamicExecutable::call_specialized(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
+{
     std::vector<std::shared_ptr<runtime::Tensor>> wrapped_inputs;
     std::vector<element::Type> arg_element_types;
     std::vector<PartialShape> arg_shapes;
 
-    std::shared_ptr<Function> clone;
+    // We'll use AlignedBuffers to back the base pointers, storing them in this vector for RAII
+    // purposes.
+    std::vector<AlignedBuffer> arg_buffers;
+    arg_buffers.reserve(inputs.size());
+    std::vector<void*> arg_value_base_pointers(inputs.size());
+
+    // Compiled clones are cached on:
+    // (1) all element types and shapes;
+    // (2) all values of shape-relevant input tensors.
+    std::ostringstream key;
+
+    size_t i = 0;
+
+    for (auto& input : inputs)
     {
-        // We'll use AlignedBuffers to back the base pointers, storing them in this vector for RAII
-        // purposes.
-        std::vector<AlignedBuffer> arg_buffers;
-        arg_buffers.reserve(inputs.size());
-        std::vector<void*> arg_value_base_pointers(inputs.size());
+        if (auto dynamic_tensor = std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
+        {
+            NGRAPH_CHECK(dynamic_tensor->has_storage());
+            arg_element_types.push_back(dynamic_tensor->get_wrapped_tensor()->get_element_type());
+            arg_shapes.push_back(dynamic_tensor->get_wrapped_tensor()->get_shape());
+            wrapped_inputs.push_back(dynamic_tensor->get_wrapped_tensor());
+        }
+        else
+        {
+            arg_element_types.push_back(input->get_element_type());
+            arg_shapes.push_back(input->get_shape());
+            wrapped_inputs.push_back(input);
+        }
+        key << arg_element_types.back() << arg_shapes.back();
+
+        if (m_wrapped_function->get_parameters()[i]->is_relevant_to_shapes())
+        {
+            arg_buffers.emplace_back(input->get_size_in_bytes(), /*alignment=*/64);
+            arg_value_base_pointers[i] = arg_buffers.back().get_ptr();
+
+            // TODO(amprocte): For host-resident tensors we should be able to skip the read,
+            // but no API for that yet.
+            input->read(arg_value_base_pointers[i], input->get_size_in_bytes());
+            key << '=';
+            key.write(arg_buffers.back().get_ptr<char>(), input->get_size_in_bytes());
+        }
+        else
+        {
+            arg_value_base_pointers[i] = nullptr;
+        }
+        key << ';';
 
-        size_t i = 0;
+        i++;
+    }
 
-        for (auto& input : inputs)
+    std::shared_ptr<CompiledClone> compiled;
+    std::string cache_key = key.str();
+    {
+        std::lock_guard<std::mutex> lock(m_cache_mutex);
+        auto it = m_cache_index.find(cache_key);
+        if (it != m_cache_index.end())
         {
-            if (m_wrapped_function->get_parameters()[i]->is_relevant_to_shapes())
-            {
-                // TODO(amprocte): Move has_storage() to runtime::Tensor?
-                if (auto dynamic_tensor =
-                        std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
-                {
-                    NGRAPH_CHECK(dynamic_tensor->has_storage());
-                }
-
-                arg_buffers.emplace_back(input->get_size_in_bytes(), /*alignment=*/64);
-                arg_value_base_pointers[i] = arg_buffers.back().get_ptr();
-
-                // TODO(amprocte): For host-resident tensors we should be able to skip the read,
-                // but no API for that yet.
-                input->read(arg_value_base_pointers[i], input->get_size_in_bytes());
-            }
-            else
-            {
-                arg_value_base_pointers[i] = nullptr;
-            }
+            m_cache.splice(m_cache.begin(), m_cache, it->second);
+            compiled = it->second->second;
+            m_cache_hit_count++;
+        }
+    }
 
-            if (auto dynamic_tensor =
-                    std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
-            {
-                NGRAPH_CHECK(dynamic_tensor->has_storage());
-                arg_element_types.push_back(
-                    dynamic_tensor->get_wrapped_tensor()->get_element_type());
-                arg_shapes.push_back(dynamic_tensor->get_wrapped_tensor()->get_shape());
-                wrapped_inputs.push_back(dynamic_tensor->get_wrapped_tensor());
-            }
-            else
+    if (!compiled)
+    {
+        compiled = compile_clone(arg_element_types, arg_shapes, arg_value_base_pointers);
+
+        std::lock_guard<std::mutex> lock(m_cache_mutex);
+        // Another caller may have compiled the same signature in the meantime
+        if (m_cache_capacity > 0 && m_cache_index.find(cache_key) == m_cache_index.end())
+        {
+            m_cache.emplace_front(cache_key, compiled);
+            m_cache_index[cache_key] = m_cache.begin();
+            if (m_cache.size() > m_cache_capacity)
             {
-                arg_element_types.push_back(input->get_element_type());
-                arg_shapes.push_back(input->get_shape());
-                wrapped_inputs.push_back(input);
+                m_cache_index.erase(m_cache.back().first);
+                m_cache.pop_back();
             }
-
-            i++;
         }
+    }
+
+    NGRAPH_CHECK(compiled->result_shapes.size() == outputs.size());
 
-        clone = specialize_function(
-            m_wrapped_function, arg_element_types, arg_shapes, arg_value_base_pointers);
+    std::vector<std::shared_ptr<runtime::Tensor>> wrapped_outputs;
+    for (size_t j = 0; j < outputs.size(); j++)
+    {
+        if (auto dynamic_tensor =
+                std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(outputs[j]))
+        {
+            dynamic_tensor->make_storage(compiled->result_types[j], compiled->result_shapes[j]);
+            wrapped_outputs.push_back(dynamic_tensor->get_wrapped_tensor());
+        }
+        else
+        {
+            wrapped_outputs.push_back(outputs[j]);
+        }
     }
 
+    return compiled->executable->call(wrapped_outputs, wrapped_inputs);
+}
+
+std::shared_ptr<runtime::dynamic::DynamicExecutable::CompiledClone>
+    runtime::dynamic::DynamicExecutable::compile_clone(
+        const std::vector<element::Type>& arg_element_types,
+        const std::vector<PartialShape>& arg_shapes,
+        const std::vector<void*>& arg_value_base_pointers)
+{
+    std::shared_ptr<Function> clone = specialize_function(
+        m_wrapped_function, arg_element_types, arg_shapes, arg_value_base_pointers);
+
     pass::Manager passes;
     passes.register_pass<pass::ConstantFolding>();
     passes.register_pass<pass::DynElimination>();
@@ -213,37 +462,19 @@ bool runtime::dynamic::DynamicExecutable::call(
     pass_val.register_pass<pass::Validate>();
     pass_val.run_passes(clone);
 
-    std::vector<std::shared_ptr<runtime::Tensor>> wrapped_outputs;
-
-    const ResultVector& results = clone->get_results();
-    for (auto& result : results)
+    auto compiled = make_shared<CompiledClone>();
+    for (auto& result : clone->get_results())
     {
         NGRAPH_CHECK(result->get_output_partial_shape(0).is_static(),
                      "Shape staticization failed for result node ",
                      *result);
+        compiled->result_types.push_back(result->get_output_element_type(0));
+        compiled->result_shapes.push_back(result->get_output_shape(0));
     }
-    NGRAPH_CHECK(results.size() == outputs.size());
 
-    for (size_t i = 0; i < outputs.size(); i++)
-    {
-        if (auto dynamic_tensor =
-                std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(outputs[i]))
-        {
-            dynamic_tensor->make_storage(results[i]->get_output_element_type(0),
-                                         results[i]->get_output_shape(0));
-            wrapped_outputs.push_back(dynamic_tensor->get_wrapped_tensor());
-        }
-        else
-        {
-            wrapped_outputs.push_back(outputs[i]);
-        }
-    }
-
-    // TODO: Put compiled executable in the cache.
-    auto compiled_executable = m_wrapped_backend->compile(clone, m_enable_performance_collection);
-    auto result = compiled_executable->call(wrapped_outputs, wrapped_inputs);
-
-    return result;
+    compiled->executable = m_wrapped_backend->compile(clone, m_enable_performance_collection);
+    m_compilation_count++;
+    return compiled;
 }
 
 runtime::dynamic::DynamicTensor::DynamicTensor(
@@ -303,6 +534,13 @@ void runtime::dynamic::DynamicTensor::write(const void* p, size_t n)
     m_wrapped_tensor->write(p, n);
 }
 
+void runtime::dynamic::DynamicTensor::write_at(const void* p, size_t offset, size_t n)
+{
+    NGRAPH_CHECK(m_wrapped_tensor != nullptr,
+                 "tried to write to a dynamic tensor with no allocated storage");
+    m_wrapped_tensor->write_at(p, offset, n);
+}
+
 void runtime::dynamic::DynamicTensor::read(void* p, size_t n) const
 {
     NGRAPH_CHECK(m_wrapped_tensor != nullptr,
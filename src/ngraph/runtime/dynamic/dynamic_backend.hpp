@@ -16,9 +16,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <list>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "ngraph/runtime/backend.hpp"
@@ -86,21 +91,92 @@ private:
 /// 2. compiles the clone using the wrapped backend;
 /// 3. fowards the input tensors to the clone executable for actual execution.
 ///
+/// Compiled clones are kept in an LRU cache keyed on the element types and shapes of all
+/// inputs and on the values of shape-relevant inputs, so only the first call for each
+/// distinct signature pays for specialization and compilation.
+///
+/// To bound the number of compilations for inputs with a variable-length axis (for example
+/// a sequence length), a `BucketingPolicy` can be set. The selected inputs are zero-padded
+/// along their axis up to the next bucket size, and the selected outputs are sliced back to
+/// the original length. Padding a mask input with zeros masks out the padded positions, but
+/// it is up to the graph to ignore them; bucketing is only correct when the padded positions
+/// do not affect the unpadded part of the outputs.
+///
+/// Several policies can be combined for inputs with more than one variable-length axis, for
+/// example a batch and a sequence axis; each pads its own axes in turn. A `bounded` policy
+/// treats its largest bucket as an upper bound: with a single bucket at the bound, every
+/// length up to it runs on one clone compiled, and memory planned, for the bound.
+///
 /// `DynamicExecutable` objects are produced by `DynamicBackend::compile()`.
 ///
 class ngraph::runtime::dynamic::DynamicExecutable : public ngraph::runtime::Executable
 {
 public:
+    struct BucketingPolicy
+    {
+        /// Ascending sizes that the variable-length axis is rounded up to. Lengths above the
+        /// largest bucket are compiled exactly.
+        std::vector<size_t> buckets;
+        /// Maps input index to the axis that is padded. Every listed input must have the same
+        /// length along its axis.
+        std::map<size_t, size_t> input_axes;
+        /// Maps output index to the axis that is sliced back to the unpadded length
+        std::map<size_t, size_t> output_axes;
+        /// Whether lengths above the largest bucket are rejected rather than compiled exactly
+        bool bounded = false;
+    };
+
     DynamicExecutable(std::shared_ptr<Function> wrapped_function,
                       std::shared_ptr<ngraph::runtime::Backend> wrapped_backend,
                       bool enable_performance_collection = false);
     virtual bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                       const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
+    /// \brief Set the maximum number of compiled clones to keep. Defaults to
+    ///        NGRAPH_DYNAMIC_CACHE_SIZE if set, otherwise 32. Zero disables caching.
+    void set_cache_capacity(size_t capacity);
+    /// \brief Replace all bucketing policies with `policy`
+    void set_bucketing_policy(const BucketingPolicy& policy);
+    /// \brief Add a policy for another variable-length axis. Its buckets are applied after
+    ///        those of the policies added before it.
+    void add_bucketing_policy(const BucketingPolicy& policy);
+
+    /// \returns the number of clones compiled so far
+    size_t get_compilation_count() const { return m_compilation_count; }
+    /// \returns the number of calls served by a previously compiled clone
+    size_t get_cache_hit_count() const { return m_cache_hit_count; }
 private:
+    struct CompiledClone
+    {
+        std::shared_ptr<runtime::Executable> executable;
+        std::vector<element::Type> result_types;
+        std::vector<Shape> result_shapes;
+    };
+    using CacheList = std::list<std::pair<std::string, std::shared_ptr<CompiledClone>>>;
+
+    bool call_bucketed(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                       const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                       size_t policy_index);
+    bool call_specialized(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                          const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+    std::shared_ptr<CompiledClone>
+        compile_clone(const std::vector<element::Type>& arg_element_types,
+                      const std::vector<PartialShape>& arg_shapes,
+                      const std::vector<void*>& arg_value_base_pointers);
+
     std::shared_ptr<ngraph::Function> m_wrapped_function;
     std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
     bool m_enable_performance_collection;
+
+    std::vector<BucketingPolicy> m_bucketing_policies;
+
+    std::mutex m_cache_mutex;
+    size_t m_cache_capacity;
+    // Most recently used first
+    CacheList m_cache;
+    std::unordered_map<std::string, CacheList::iterator> m_cache_index;
+    std::atomic<size_t> m_compilation_count{0};
+    std::atomic<size_t> m_cache_hit_count{0};
 };
 
 ///
@@ -133,6 +209,7 @@ public:
     virtual const element::Type& get_element_type() const override;
     virtual const ngraph::Shape& get_shape() const override;
     virtual void write(const void* p, size_t n) override;
+    virtual void write_at(const void* p, size_t offset, size_t n) override;
     virtual void read(void* p, size_t n) const override;
     virtual void copy_from(const ngraph::runtime::Tensor& source) override;
     bool has_storage() const;
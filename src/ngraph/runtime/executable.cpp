@@ -39,6 +39,46 @@ bool runtime::Executable::call_with_validate(const vector<shared_ptr<runtime::Te
     return call(outputs, inputs);
 }
 
+bool runtime::Executable::call_cancellable(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                           const vector<shared_ptr<runtime::Tensor>>& inputs,
+                                           const CancellationToken& token)
+{
+    if (token.is_cancelled())
+    {
+        return false;
+    }
+    return call(outputs, inputs);
+}
+
+future<bool> runtime::Executable::call_async(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                             const vector<shared_ptr<runtime::Tensor>>& inputs,
+                                             const AsyncCallback& callback)
+{
+    // Backends without native asynchronous execution fall back to running call() on a
+    // separate thread. Calls are serialized so that non-reentrant executables stay correct.
+    return async(launch::async, [this, outputs, inputs, callback]() {
+        bool rc = false;
+        try
+        {
+            lock_guard<mutex> lock(m_async_mutex);
+            rc = call(outputs, inputs);
+        }
+        catch (...)
+        {
+            if (callback)
+            {
+                callback(false);
+            }
+            throw;
+        }
+        if (callback)
+        {
+            callback(rc);
+        }
+        return rc;
+    });
+}
+
 void runtime::Executable::validate(const vector<std::shared_ptr<runtime::Tensor>>& outputs,
                                    const vector<std::shared_ptr<runtime::Tensor>>& inputs)
 {
@@ -114,6 +154,10 @@ size_t runtime::Executable::get_preferred_pipeline_depth() const
     return 2;
 }
 
+void runtime::Executable::warmup()
+{
+}
+
 void runtime::Executable::set_parameters_and_results(const Function& func)
 {
     m_parameters = func.get_parameters();
@@ -125,6 +169,17 @@ vector<runtime::PerformanceCounter> runtime::Executable::get_performance_data()
     return vector<PerformanceCounter>();
 }
 
+runtime::Executable::MemoryStats runtime::Executable::get_memory_stats() const
+{
+    return MemoryStats();
+}
+
+void runtime::Executable::update_constants(
+    const std::map<std::string, std::shared_ptr<runtime::Tensor>>& /* constants */)
+{
+    throw runtime_error("update_constants unimplemented");
+}
+
 void runtime::Executable::save(std::ostream& /* output_stream */)
 {
     throw runtime_error("save operation unimplemented.");
@@ -152,3 +207,15 @@ vector<shared_ptr<runtime::Tensor>>
 {
     throw runtime_error("create_output_tensor unimplemented");
 }
+
+shared_ptr<descriptor::layout::TensorLayout>
+    runtime::Executable::get_input_layout(size_t /* input_index */)
+{
+    return nullptr;
+}
+
+shared_ptr<descriptor::layout::TensorLayout>
+    runtime::Executable::get_output_layout(size_t /* output_index */)
+{
+    return nullptr;
+}
@@ -16,9 +16,15 @@
 
 #pragma once
 
+#include <functional>
+#include <future>
+#include <map>
 #include <memory>
+#include <mutex>
 
 #include "ngraph/function.hpp"
+#include "ngraph/pass/pass_report.hpp"
+#include "ngraph/runtime/cancellation.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
@@ -51,10 +57,77 @@ public:
     bool call_with_validate(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                             const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
+    /// \brief Executes a single iteration of a Function unless `token` is cancelled first.
+    ///
+    /// Backends that support it check the token between ops and abandon the call as soon as
+    /// it is cancelled; the default implementation only checks it before starting.
+    /// \returns false if the call was cancelled, in which case the outputs are undefined
+    virtual bool call_cancellable(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                                  const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                                  const CancellationToken& token);
+
+    /// \brief Signature of the completion callback passed to call_async.
+    ///        The argument is the value returned by call(), or false if call() threw.
+    using AsyncCallback = std::function<void(bool)>;
+
+    /// \brief Start a single iteration of a Function and return without waiting for it to
+    ///        finish. The tensors must stay alive and untouched until the call completes.
+    /// \param outputs vector of runtime::Tensor used as outputs
+    /// \param inputs vector of runtime::Tensor used as inputs
+    /// \param callback Optional function invoked on the executing thread once the call completes
+    /// \returns A future holding the result of call(). Exceptions thrown by call() are
+    ///          rethrown from future::get().
+    virtual std::future<bool>
+        call_async(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                   const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                   const AsyncCallback& callback = nullptr);
+
     /// \brief Collect performance information gathered on a Function.
     /// \returns Vector of PerformanceCounter information.
     virtual std::vector<PerformanceCounter> get_performance_data() const;
 
+    /// \brief Memory held by a compiled Function, in bytes
+    struct MemoryStats
+    {
+        /// Data of the Constants, including constants created while compiling and data
+        /// swapped in by update_constants. Executables may share identical constants.
+        size_t constant_bytes = 0;
+        /// Weights repacked once into a kernel specific format while compiling
+        size_t prepacked_weight_bytes = 0;
+        /// Memory kept by the kernel primitives and shared by all runtime contexts
+        size_t primitive_bytes = 0;
+        /// Arena of the intermediate tensors of one runtime context
+        size_t intermediate_bytes_per_context = 0;
+        /// Scratch memory of the kernels of one call
+        size_t scratchpad_bytes_per_context = 0;
+        /// Bookkeeping of one runtime context, such as its tables of tensor pointers
+        size_t overhead_bytes_per_context = 0;
+        /// Runtime contexts created so far. Each concurrent call needs one.
+        size_t context_count = 0;
+        /// Runtime contexts the executable may grow to
+        size_t max_context_count = 0;
+
+        /// \returns The bytes held with `contexts` runtime contexts
+        size_t get_total_bytes(size_t contexts) const
+        {
+            return constant_bytes + prepacked_weight_bytes + primitive_bytes +
+                   contexts * (intermediate_bytes_per_context + scratchpad_bytes_per_context +
+                               overhead_bytes_per_context);
+        }
+        /// \returns The bytes held with the runtime contexts created so far
+        size_t get_total_bytes() const { return get_total_bytes(context_count); }
+    };
+
+    /// \brief Query the memory used by the compiled Function, for example to plan how many
+    ///        models fit on a host
+    /// \returns The memory by kind. The default implementation reports none.
+    virtual MemoryStats get_memory_stats() const;
+
+    /// \brief Query the passes run when the Function was compiled
+    /// \returns The time each compilation pass took and how it changed the Function. Empty if
+    ///          the backend does not report its passes.
+    const pass::PassReport& get_pass_report() const { return m_pass_report; }
+
     /// \brief Validates a Function.
     /// \param outputs vector of runtime::Tensor used as outputs
     /// \param inputs vector of runtime::Tensor used as inputs
@@ -73,6 +146,20 @@ public:
     /// \returns  preferred pipeline_depth
     virtual size_t get_preferred_pipeline_depth() const;
 
+    /// \brief Perform the one-time initialization that would otherwise happen during the
+    ///        first call, such as building backend kernels, so that the first request does not
+    ///        pay for it. The default implementation does nothing.
+    virtual void warmup();
+
+    /// \brief Replace the data of Constants of the compiled Function, for example to push new
+    ///        weights without recompiling. Calls that start after this returns see all of the
+    ///        new data and calls already running see none of it. Only work that depends on the
+    ///        replaced constants, such as repacking weights, is redone.
+    /// \param constants New data by the friendly name of the Constant. Each Tensor must match
+    ///        the element type and shape of its Constant.
+    virtual void
+        update_constants(const std::map<std::string, std::shared_ptr<runtime::Tensor>>& constants);
+
     /// \brief Save this compiled Executable to an output stream.
     ///    Saved stream may be read with Backend::load
     virtual void save(std::ostream& output_stream);
@@ -107,13 +194,31 @@ public:
     virtual std::vector<std::shared_ptr<runtime::Tensor>>
         create_output_tensor(size_t output_index, size_t pipeline_depth);
 
+    /// \brief The layout this executable expects for input `input_index`
+    /// \returns The layout, or nullptr if any layout of the right element type and shape will do
+    virtual std::shared_ptr<descriptor::layout::TensorLayout>
+        get_input_layout(size_t input_index);
+
+    /// \brief The layout this executable produces output `output_index` in. Output tensors
+    ///        created in it need no layout propagation when passed to call().
+    /// \returns The layout, or nullptr if the executable accepts any
+    virtual std::shared_ptr<descriptor::layout::TensorLayout>
+        get_output_layout(size_t output_index);
+
 protected:
     /// \brief Called at the end of compile to the values to be returned by get_parameters
     ///        and get_results
     /// \param func The function with Results fully resolved.
     void set_parameters_and_results(const Function& func);
 
+    /// \brief Called at the end of compile to record the value returned by get_pass_report
+    void set_pass_report(const pass::PassReport& pass_report) { m_pass_report = pass_report; }
+
 private:
     ngraph::ParameterVector m_parameters;
     ngraph::ResultVector m_results;
+    pass::PassReport m_pass_report;
+
+    // Serializes the emulated call_async since call() is not assumed to be reentrant
+    std::mutex m_async_mutex;
 };
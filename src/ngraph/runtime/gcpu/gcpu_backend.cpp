@@ -14,6 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+
 #include "ngraph/runtime/gcpu/gcpu_backend_visibility.hpp"
 
 #include "ngraph/except.hpp"
@@ -33,12 +37,33 @@ extern "C" GCPU_BACKEND_API void ngraph_register_gcpu_backend()
     });
 }
 
+static size_t get_default_num_threads()
+{
+    if (auto env = getenv("NGRAPH_GCPU_THREADS"))
+    {
+        int value = atoi(env);
+        if (value > 0)
+        {
+            return static_cast<size_t>(value);
+        }
+    }
+    return max<size_t>(1, thread::hardware_concurrency());
+}
+
+static shared_ptr<runtime::interpreter::INTThreadPool> make_thread_pool(size_t num_threads)
+{
+    return num_threads > 1 ? make_shared<runtime::interpreter::INTThreadPool>(num_threads)
+                           : nullptr;
+}
+
 runtime::gcpu::GCPUBackend::GCPUBackend()
+    : m_thread_pool{make_thread_pool(get_default_num_threads())}
 {
 }
 
 runtime::gcpu::GCPUBackend::GCPUBackend(const vector<string>& unsupported_op_name_list)
     : m_unsupported_op_name_list{unsupported_op_name_list.begin(), unsupported_op_name_list.end()}
+    , m_thread_pool{make_thread_pool(get_default_num_threads())}
 {
 }
 
@@ -59,10 +84,31 @@ shared_ptr<runtime::Executable>
     runtime::gcpu::GCPUBackend::compile(shared_ptr<Function> function,
                                         bool enable_performance_collection)
 {
-    return make_shared<GCPUExecutable>(function, enable_performance_collection);
+    auto exec = make_shared<GCPUExecutable>(function, enable_performance_collection);
+    exec->set_thread_pool(m_thread_pool);
+    return exec;
 }
 
 bool runtime::gcpu::GCPUBackend::is_supported(const Node& node) const
 {
     return m_unsupported_op_name_list.find(node.description()) == m_unsupported_op_name_list.end();
 }
+
+bool runtime::gcpu::GCPUBackend::set_config(const map<string, string>& config, string& error)
+{
+    bool rc = false;
+    error = "";
+    auto it = config.find("threads");
+    if (it != config.end())
+    {
+        int value = atoi(it->second.c_str());
+        if (value < 1)
+        {
+            error = "threads must be a positive integer, got '" + it->second + "'";
+            return false;
+        }
+        m_thread_pool = make_thread_pool(static_cast<size_t>(value));
+        rc = true;
+    }
+    return rc;
+}
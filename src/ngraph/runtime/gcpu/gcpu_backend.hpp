@@ -17,11 +17,13 @@
 #pragma once
 
 #include <initializer_list>
+#include <map>
 #include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include "ngraph/runtime/interpreter/int_thread_pool.hpp"
 #include "ngraph/runtime/reference/allreduce.hpp"
 #include "ngraph/runtime/tensor.hpp"
 
@@ -56,6 +58,11 @@ public:
 
     bool is_supported(const Node& node) const override;
 
+    /// \brief Accepts "threads", the number of threads used by each call (default: the value of
+    ///        NGRAPH_GCPU_THREADS, or the hardware concurrency)
+    bool set_config(const std::map<std::string, std::string>& config, std::string& error) override;
+
 private:
     std::set<std::string> m_unsupported_op_name_list;
+    std::shared_ptr<interpreter::INTThreadPool> m_thread_pool;
 };
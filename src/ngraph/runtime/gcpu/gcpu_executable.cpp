@@ -18,6 +18,7 @@
 #include "ngraph/cpio.hpp"
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/op/util/op_annotations.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/pass/assign_layout.hpp"
 #include "ngraph/pass/core_fusion.hpp"
@@ -37,10 +38,99 @@ using namespace ngraph;
 
 using descriptor::layout::DenseTensorLayout;
 
+namespace
+{
+    template <typename INPUT0, typename INPUT1, typename OUTPUT>
+    void run_quantized_dot(const op::QuantizedDot& node,
+                           const vector<shared_ptr<runtime::HostTensor>>& out,
+                           const vector<shared_ptr<runtime::HostTensor>>& args,
+                           const runtime::opt_kernel::parallel_for_t& parallel_for)
+    {
+        float scale = *args[2]->get_data_ptr<const float>() *
+                      *args[4]->get_data_ptr<const float>() /
+                      *args[6]->get_data_ptr<const float>();
+        runtime::gcpu::kernel::quantized_dot(args[0]->get_data_ptr<const INPUT0>(),
+                                             args[1]->get_data_ptr<const INPUT1>(),
+                                             out[0]->get_data_ptr<OUTPUT>(),
+                                             node.get_input_shape(0),
+                                             node.get_input_shape(1),
+                                             node.get_reduction_axes_count(),
+                                             scale,
+                                             *args[3]->get_data_ptr<const INPUT0>(),
+                                             *args[5]->get_data_ptr<const INPUT1>(),
+                                             *args[7]->get_data_ptr<const OUTPUT>(),
+                                             parallel_for);
+    }
+}
+
+bool runtime::gcpu::GCPUExecutable::is_in_place_candidate(const Node& node)
+{
+    if (node.get_output_size() != 1 || node.get_input_size() == 0 ||
+        node.get_output_shape(0) != node.get_input_shape(0) ||
+        node.get_output_element_type(0) != node.get_input_element_type(0))
+    {
+        return false;
+    }
+#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wswitch-enum"
+#endif
+    switch (get_typeid(node))
+    {
+    case ngraph::runtime::interpreter::OP_TYPEID::Abs:
+    case ngraph::runtime::interpreter::OP_TYPEID::Add:
+    case ngraph::runtime::interpreter::OP_TYPEID::Ceiling:
+    case ngraph::runtime::interpreter::OP_TYPEID::Cos:
+    case ngraph::runtime::interpreter::OP_TYPEID::Divide:
+    case ngraph::runtime::interpreter::OP_TYPEID::Erf:
+    case ngraph::runtime::interpreter::OP_TYPEID::Exp:
+    case ngraph::runtime::interpreter::OP_TYPEID::Floor:
+    case ngraph::runtime::interpreter::OP_TYPEID::Gelu:
+    case ngraph::runtime::interpreter::OP_TYPEID::Log:
+    case ngraph::runtime::interpreter::OP_TYPEID::Maximum:
+    case ngraph::runtime::interpreter::OP_TYPEID::Minimum:
+    case ngraph::runtime::interpreter::OP_TYPEID::Multiply:
+    case ngraph::runtime::interpreter::OP_TYPEID::Negative:
+    case ngraph::runtime::interpreter::OP_TYPEID::Relu:
+    case ngraph::runtime::interpreter::OP_TYPEID::Sigmoid:
+    case ngraph::runtime::interpreter::OP_TYPEID::Sin:
+    case ngraph::runtime::interpreter::OP_TYPEID::Sqrt:
+    case ngraph::runtime::interpreter::OP_TYPEID::Subtract:
+    case ngraph::runtime::interpreter::OP_TYPEID::Tanh: return true;
+    case ngraph::runtime::interpreter::OP_TYPEID::Reshape:
+        return !static_cast<const op::Reshape&>(node).get_is_transpose();
+    default: return false;
+    }
+#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
+#pragma GCC diagnostic pop
+#endif
+}
+
 runtime::gcpu::GCPUExecutable::GCPUExecutable(const shared_ptr<Function>& function,
                                               bool enable_performance_collection)
     : INTExecutable(function, enable_performance_collection)
 {
+    for (auto& node : m_nodes)
+    {
+        if (node->is_op() && is_in_place_candidate(*node))
+        {
+            auto op_annotations = make_shared<op::util::OpAnnotations>();
+            // Reshape only copies, so it does not destroy its input
+            bool destructive = !is_type<op::Reshape>(node);
+            op_annotations->add_in_place_oi_pair({0, 0, destructive});
+            static_pointer_cast<op::Op>(node)->set_op_annotations(op_annotations);
+        }
+    }
+
+    // INTExecutable has already run Liveness
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::MemoryLayout>(get_alignment());
+    pass_manager.run_passes(m_function);
+    m_pool_size = m_function->get_temporary_pool_size();
+    for (auto& node : m_nodes)
+    {
+        m_pool_tensors.insert(node->liveness_new_list.begin(), node->liveness_new_list.end());
+    }
 }
 
 bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
@@ -86,6 +176,22 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
         tensor_map.insert({tensor, func_outputs[output_count]});
     }
 
+    // Let the producer of each result write straight into the caller's output tensor, as in
+    // INTExecutable::call
+    for (size_t output_count = 0; output_count < get_results().size(); ++output_count)
+    {
+        auto& output_tensor = func_outputs[output_count];
+        if (find(func_inputs.begin(), func_inputs.end(), output_tensor) == func_inputs.end())
+        {
+            descriptor::Tensor* tensor = &get_results()[output_count]->input(0).get_tensor();
+            tensor_map.insert({tensor, output_tensor});
+        }
+    }
+
+    // One allocation per call holds every intermediate tensor
+    AlignedBuffer pool(m_pool_size, get_alignment());
+    char* pool_data = pool.get_ptr<char>();
+
     // for each ordered op in the graph
     for (auto& op : m_nodes)
     {
@@ -115,7 +221,15 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
                 const Shape& shape = op->get_output_shape(i);
                 const element::Type& type = op->get_output_element_type(i);
                 string name = op->output(i).get_tensor().get_name();
-                host_tensor = make_shared<runtime::HostTensor>(type, shape, name);
+                if (m_pool_tensors.count(tensor) != 0)
+                {
+                    host_tensor = make_shared<runtime::HostTensor>(
+                        type, shape, pool_data + tensor->get_pool_offset(), name);
+                }
+                else
+                {
+                    host_tensor = make_shared<runtime::HostTensor>(type, shape, name);
+                }
                 tensor_map.insert({tensor, host_tensor});
             }
             else
@@ -125,6 +239,12 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
             op_outputs.push_back(host_tensor);
         }
 
+        if (is_type<op::Result>(op) && op_inputs[0] == op_outputs[0])
+        {
+            // The producer already wrote to the output tensor
+            continue;
+        }
+
         // get op type
         element::Type type;
 #if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
@@ -174,6 +294,40 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
     return true;
 }
 
+void runtime::gcpu::GCPUExecutable::quantized_dot(const Node& node,
+                                                  const vector<shared_ptr<HostTensor>>& out,
+                                                  const vector<shared_ptr<HostTensor>>& args) const
+{
+    const op::QuantizedDot& qd = static_cast<const op::QuantizedDot&>(node);
+    auto input0_type = qd.get_input_element_type(0);
+    auto input1_type = qd.get_input_element_type(1);
+    auto output_type = qd.get_output_element_type(0);
+    if (input0_type != element::u8)
+    {
+        throw ngraph_error("unsupported element type");
+    }
+    if (input1_type == element::i8 && output_type == element::i8)
+    {
+        run_quantized_dot<uint8_t, int8_t, int8_t>(qd, out, args, kernel_parallel_for());
+    }
+    else if (input1_type == element::u8 && output_type == element::u8)
+    {
+        run_quantized_dot<uint8_t, uint8_t, uint8_t>(qd, out, args, kernel_parallel_for());
+    }
+    else if (input1_type == element::u8 && output_type == element::i32)
+    {
+        run_quantized_dot<uint8_t, uint8_t, int32_t>(qd, out, args, kernel_parallel_for());
+    }
+    else if (input1_type == element::i8 && output_type == element::i32)
+    {
+        run_quantized_dot<uint8_t, int8_t, int32_t>(qd, out, args, kernel_parallel_for());
+    }
+    else
+    {
+        throw ngraph_error("unsupported element type");
+    }
+}
+
 void runtime::gcpu::GCPUExecutable::generate_calls(const element::Type& type,
                                                    const Node& op,
                                                    const vector<shared_ptr<HostTensor>>& out,
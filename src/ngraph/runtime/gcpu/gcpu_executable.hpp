@@ -16,16 +16,19 @@
 
 #pragma once
 
+#include <cstring>
 #include <initializer_list>
 #include <iostream>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "ngraph/ops.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/gcpu/kernel/dot.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/interpreter/int_executable.hpp"
 #include "ngraph/runtime/opt_kernel/broadcast.hpp"
@@ -60,6 +63,14 @@ namespace ngraph
     }
 }
 
+/// \brief Interpreter-derived executable tuned for generic CPUs.
+///
+/// Intermediate tensors are placed in one pool laid out by pass::MemoryLayout, with
+/// same-shaped elementwise ops and non-transposing reshapes writing over their last-use
+/// input. Broadcast and Reshape use the opt_kernel implementations, Dot and QuantizedDot the
+/// GEMM kernels of gcpu/kernel/dot.hpp, and the heavy kernels are split over the thread pool
+/// set by the backend. QuantizedDotBias, a CPU backend fusion with transposed weights and
+/// MKLDNN requantization, is left to the interpreter.
 class ngraph::runtime::gcpu::GCPUExecutable : public runtime::interpreter::INTExecutable
 {
     friend class GCPUBackend;
@@ -78,6 +89,20 @@ private:
                         const std::vector<std::shared_ptr<HostTensor>>& outputs,
                         const std::vector<std::shared_ptr<HostTensor>>& inputs) override;
 
+    /// \returns true if the kernel of `node` only reads element i of input 0 to write element
+    ///          i of output 0, so the output may share memory with that input
+    static bool is_in_place_candidate(const Node& node);
+
+    /// \brief Runs QuantizedDot with gcpu::kernel::quantized_dot, for the input and output
+    ///        types the interpreter supports
+    void quantized_dot(const Node& node,
+                       const std::vector<std::shared_ptr<HostTensor>>& out,
+                       const std::vector<std::shared_ptr<HostTensor>>& args) const;
+
+    // Tensors placed in the memory pool by pass::MemoryLayout
+    std::unordered_set<const descriptor::Tensor*> m_pool_tensors;
+    size_t m_pool_size;
+
     template <typename T>
     void gop_engine(const Node& node,
                     const std::vector<std::shared_ptr<HostTensor>>& out,
@@ -91,23 +116,53 @@ private:
             Shape in_shape = node.get_input_shape(0);
             Shape out_shape = node.get_output_shape(0);
             AxisSet broadcast_axes = broadcast->get_broadcast_axes();
-            reference::broadcast<T>(args[0]->get_data_ptr<const T>(),
-                                    out[0]->get_data_ptr<T>(),
-                                    in_shape,
-                                    out_shape,
-                                    broadcast_axes);
+            opt_kernel::broadcast<T>(args[0]->get_data_ptr<const T>(),
+                                     out[0]->get_data_ptr<T>(),
+                                     in_shape,
+                                     out_shape,
+                                     broadcast_axes,
+                                     kernel_parallel_for());
             break;
         }
         case ngraph::runtime::interpreter::OP_TYPEID::Reshape:
         {
             const op::Reshape* reshape = static_cast<const op::Reshape*>(&node);
-            reference::reshape(args[0]->get_data_ptr<const T>(),
-                               out[0]->get_data_ptr<T>(),
-                               node.get_input_shape(0),
-                               reshape->get_input_order(),
-                               node.get_output_shape(0));
+            if (!reshape->get_is_transpose())
+            {
+                // The output may have been placed over the input by the memory layout
+                if (out[0]->get_data_ptr() != args[0]->get_data_ptr())
+                {
+                    std::memcpy(out[0]->get_data_ptr(),
+                                args[0]->get_data_ptr(),
+                                shape_size(node.get_output_shape(0)) * sizeof(T));
+                }
+            }
+            else
+            {
+                opt_kernel::reshape(args[0]->get_data_ptr<const T>(),
+                                    out[0]->get_data_ptr<T>(),
+                                    node.get_input_shape(0),
+                                    reshape->get_input_order(),
+                                    node.get_output_shape(0),
+                                    kernel_parallel_for());
+            }
             break;
         }
+        case ngraph::runtime::interpreter::OP_TYPEID::Dot:
+        {
+            const op::Dot* dot = static_cast<const op::Dot*>(&node);
+            kernel::dot<T>(args[0]->get_data_ptr<const T>(),
+                           args[1]->get_data_ptr<const T>(),
+                           out[0]->get_data_ptr<T>(),
+                           node.get_input_shape(0),
+                           node.get_input_shape(1),
+                           dot->get_reduction_axes_count(),
+                           kernel_parallel_for());
+            break;
+        }
+        case ngraph::runtime::interpreter::OP_TYPEID::QuantizedDot:
+            quantized_dot(node, out, args);
+            break;
         default: op_engine<T>(node, out, args); break;
         }
     }
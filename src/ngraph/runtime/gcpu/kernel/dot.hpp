@@ -17,15 +17,20 @@
 #pragma once
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <cmath>
-#include <utility>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
 
-#ifdef PARALLEL
-#include <omp.h>
+#if defined(__AVX512VNNI__)
+#include <immintrin.h>
 #endif
 
-#include "ngraph/coordinate_transform.hpp"
-#include "ngraph/shape_util.hpp"
+#include "ngraph/runtime/opt_kernel/parallel_copy.hpp"
+#include "ngraph/runtime/reference/gemm.hpp"
+#include "ngraph/shape.hpp"
 
 namespace ngraph
 {
@@ -35,116 +40,231 @@ namespace ngraph
         {
             namespace kernel
             {
+                // Rows of the product computed by one parallel_for item
+                constexpr size_t DOT_ROW_BLOCK = 16;
+
+                /// \brief Sizes of the matrix product a Dot performs.
+                ///
+                /// The dotted axes are the trailing axes of arg0 and the leading axes of arg1, so
+                /// in row-major layout every Dot, whatever its rank, is a [m, k] x [k, n] product.
+                struct GemmShape
+                {
+                    GemmShape(const Shape& arg0_shape,
+                              const Shape& arg1_shape,
+                              size_t reduction_axes_count)
+                        : m(shape_size(Shape(arg0_shape.begin(),
+                                             arg0_shape.end() - reduction_axes_count)))
+                        , n(shape_size(Shape(arg1_shape.begin() + reduction_axes_count,
+                                             arg1_shape.end())))
+                        , k(shape_size(Shape(arg1_shape.begin(),
+                                             arg1_shape.begin() + reduction_axes_count)))
+                    {
+                    }
+
+                    size_t m;
+                    size_t n;
+                    size_t k;
+                };
+
+                /// \brief Dot of any rank, as blocks of rows of the 2D product split over
+                ///        `parallel_for`.
                 template <typename T>
                 void dot(const T* arg0,
                          const T* arg1,
                          T* out,
                          const Shape& arg0_shape,
                          const Shape& arg1_shape,
-                         const Shape& out_shape,
-                         size_t reduction_axes_count)
+                         size_t reduction_axes_count,
+                         const opt_kernel::parallel_for_t& parallel_for = nullptr)
                 {
-                    if (arg0_shape.size() == 2 && arg1_shape.size() == 2 && out_shape.size() == 2)
+                    using Matrix =
+                        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+                    GemmShape gemm(arg0_shape, arg1_shape, reduction_axes_count);
+                    Eigen::Map<const Matrix> b(arg1, gemm.k, gemm.n);
+                    size_t blocks = (gemm.m + DOT_ROW_BLOCK - 1) / DOT_ROW_BLOCK;
+                    opt_kernel::run_parallel(
+                        parallel_for,
+                        blocks,
+                        DOT_ROW_BLOCK * gemm.k * gemm.n,
+                        [&](size_t begin, size_t end) {
+                            size_t row = begin * DOT_ROW_BLOCK;
+                            size_t rows = std::min(end * DOT_ROW_BLOCK, gemm.m) - row;
+                            Eigen::Map<const Matrix> a(arg0 + row * gemm.k, rows, gemm.k);
+                            Eigen::Map<Matrix> o(out + row * gemm.n, rows, gemm.n);
+                            o.noalias() = a * b;
+                        });
+                }
+
+#if defined(__AVX512VNNI__)
+                /// \brief u8 x s8 -> s32 products with vpdpbusd.
+                ///
+                /// vpdpbusd multiplies four adjacent u8 of one operand by four adjacent s8 of the
+                /// other and adds their sum to an s32 lane, so b is packed into panels of 16
+                /// columns in which each group of 4 rows is interleaved: the 64 bytes of
+                /// (group g, panel p) hold b[4g + r][16p + c] at byte 4c + r. Short panels and
+                /// groups are padded with zeros.
+                class VNNIGemm
+                {
+                public:
+                    VNNIGemm(const int8_t* b, size_t n, size_t k)
+                        : m_n(n)
+                        , m_k(k)
+                        , m_groups((k + 3) / 4)
+                        , m_panels((n + 15) / 16)
+                        , m_packed(m_panels * m_groups * 64, 0)
                     {
-                        Eigen::Map<
-                            Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>
-                            a0(const_cast<T*>(arg0), arg0_shape[0], arg0_shape[1]);
-                        Eigen::Map<
-                            Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>
-                            a1(const_cast<T*>(arg1), arg1_shape[0], arg1_shape[1]);
-                        Eigen::Map<
-                            Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>
-                            o(const_cast<T*>(out), out_shape[0], out_shape[1]);
-                        o = a0 * a1;
+                        for (size_t kk = 0; kk < k; kk++)
+                        {
+                            for (size_t j = 0; j < n; j++)
+                            {
+                                size_t panel = j / 16;
+                                size_t group = kk / 4;
+                                m_packed[(panel * m_groups + group) * 64 + (j % 16) * 4 + kk % 4] =
+                                    b[kk * n + j];
+                            }
+                        }
                     }
-                    else
-                    {
-                        // Get the sizes of the dot axes. It's easiest to pull them from arg1
-                        // because they're right up front.
-                        Shape dot_axis_sizes(reduction_axes_count);
-                        std::copy(arg1_shape.begin(),
-                                  arg1_shape.begin() + reduction_axes_count,
-                                  dot_axis_sizes.begin());
-
-                        CoordinateTransform arg0_transform(arg0_shape);
-                        CoordinateTransform arg1_transform(arg1_shape);
-                        CoordinateTransform output_transform(out_shape);
-
-                        // Create coordinate transforms for arg0 and arg1 that throw away the dotted
-                        // axes.
-                        size_t arg0_projected_rank = arg0_shape.size() - reduction_axes_count;
-                        size_t arg1_projected_rank = arg1_shape.size() - reduction_axes_count;
-
-                        Shape arg0_projected_shape(arg0_projected_rank);
-                        std::copy(arg0_shape.begin(),
-                                  arg0_shape.begin() + arg0_projected_rank,
-                                  arg0_projected_shape.begin());
 
-                        Shape arg1_projected_shape(arg1_projected_rank);
-                        std::copy(arg1_shape.begin() + reduction_axes_count,
-                                  arg1_shape.end(),
-                                  arg1_projected_shape.begin());
-
-                        CoordinateTransform arg0_projected_transform(arg0_projected_shape);
-                        CoordinateTransform arg1_projected_transform(arg1_projected_shape);
-
-                        // Create a coordinate transform that allows us to iterate over all possible
-                        // values for the dotted axes.
-                        CoordinateTransform dot_axes_transform(dot_axis_sizes);
-
-                        for (const Coordinate& arg0_projected_coord : arg0_projected_transform)
+                    /// \brief Writes the s32 products of `rows` rows of a, starting at a, to sums.
+                    void multiply(const uint8_t* a, size_t rows, int32_t* sums) const
+                    {
+                        // Four rows share each load of b
+                        for (size_t i0 = 0; i0 < rows; i0 += 4)
                         {
-                            for (const Coordinate& arg1_projected_coord : arg1_projected_transform)
+                            size_t count = std::min<size_t>(4, rows - i0);
+                            for (size_t panel = 0; panel < m_panels; panel++)
                             {
-                                // The output coordinate is just the concatenation of the projected
-                                // coordinates.
-                                Coordinate out_coord(arg0_projected_coord.size() +
-                                                     arg1_projected_coord.size());
-
-                                auto out_coord_it = std::copy(arg0_projected_coord.begin(),
-                                                              arg0_projected_coord.end(),
-                                                              out_coord.begin());
-                                std::copy(arg1_projected_coord.begin(),
-                                          arg1_projected_coord.end(),
-                                          out_coord_it);
-
-                                // Zero out to start the sum.
-                                T sum = 0;
-
-                                size_t out_index = output_transform.index(out_coord);
-
-                                // Walk along the dotted axes.
-                                Coordinate arg0_coord(arg0_shape.size());
-                                Coordinate arg1_coord(arg1_shape.size());
-                                auto arg0_it = std::copy(arg0_projected_coord.begin(),
-                                                         arg0_projected_coord.end(),
-                                                         arg0_coord.begin());
-                                for (const Coordinate& dot_axis_positions : dot_axes_transform)
+                                __m512i acc[4] = {_mm512_setzero_si512(),
+                                                  _mm512_setzero_si512(),
+                                                  _mm512_setzero_si512(),
+                                                  _mm512_setzero_si512()};
+                                const int8_t* b = m_packed.data() + panel * m_groups * 64;
+                                for (size_t group = 0; group < m_groups; group++)
                                 {
-                                    // In order to find the points to multiply together, we need to
-                                    // inject our current positions along the dotted axes back into
-                                    // the projected arg0 and arg1 coordinates.
-                                    std::copy(dot_axis_positions.begin(),
-                                              dot_axis_positions.end(),
-                                              arg0_it);
+                                    __m512i b_group = _mm512_loadu_si512(b + group * 64);
+                                    for (size_t i = 0; i < count; i++)
+                                    {
+                                        __m512i a_quad = _mm512_set1_epi32(
+                                            load_quad(a + (i0 + i) * m_k, group));
+                                        acc[i] = _mm512_dpbusd_epi32(acc[i], a_quad, b_group);
+                                    }
+                                }
+                                size_t columns = std::min<size_t>(16, m_n - panel * 16);
+                                __mmask16 mask = static_cast<__mmask16>((1u << columns) - 1);
+                                for (size_t i = 0; i < count; i++)
+                                {
+                                    _mm512_mask_storeu_epi32(
+                                        sums + (i0 + i) * m_n + panel * 16, mask, acc[i]);
+                                }
+                            }
+                        }
+                    }
 
-                                    auto arg1_it = std::copy(dot_axis_positions.begin(),
-                                                             dot_axis_positions.end(),
-                                                             arg1_coord.begin());
-                                    std::copy(arg1_projected_coord.begin(),
-                                              arg1_projected_coord.end(),
-                                              arg1_it);
+                private:
+                    // Four bytes of a row starting at 4 * group, padded with zeros past k
+                    int32_t load_quad(const uint8_t* row, size_t group) const
+                    {
+                        int32_t quad = 0;
+                        size_t begin = group * 4;
+                        std::memcpy(&quad, row + begin, std::min<size_t>(4, m_k - begin));
+                        return quad;
+                    }
 
-                                    // Multiply and add to the sum.
-                                    sum += arg0[arg0_transform.index(arg0_coord)] *
-                                           arg1[arg1_transform.index(arg1_coord)];
-                                }
+                    size_t m_n;
+                    size_t m_k;
+                    size_t m_groups;
+                    size_t m_panels;
+                    std::vector<int8_t> m_packed;
+                };
+#endif
 
-                                // Write the sum back.
-                                out[out_index] = sum;
+                /// \brief QuantizedDot with the requantization of reference::dot, split over
+                ///        `parallel_for` by blocks of rows of the 2D product.
+                ///
+                /// u8 x s8 products use VNNIGemm when the target has AVX512-VNNI. The zero points
+                /// are then applied afterwards, since
+                ///   sum (a - za)(b - zb) = sum ab - zb sum a - za sum b + k za zb.
+                /// Other types, and targets without VNNI, use reference::gemm on each block.
+                template <typename INPUT0, typename INPUT1, typename OUTPUT>
+                void quantized_dot(const INPUT0* arg0,
+                                   const INPUT1* arg1,
+                                   OUTPUT* out,
+                                   const Shape& arg0_shape,
+                                   const Shape& arg1_shape,
+                                   size_t reduction_axes_count,
+                                   float scale,
+                                   INPUT0 arg0_zero_point,
+                                   INPUT1 arg1_zero_point,
+                                   OUTPUT out_zero_point,
+                                   const opt_kernel::parallel_for_t& parallel_for = nullptr)
+                {
+                    GemmShape gemm(arg0_shape, arg1_shape, reduction_axes_count);
+                    auto finalize = [scale, out_zero_point](int32_t sum) {
+                        return static_cast<OUTPUT>(
+                            static_cast<OUTPUT>(std::round(static_cast<float>(sum) * scale)) +
+                            out_zero_point);
+                    };
+                    size_t blocks = (gemm.m + DOT_ROW_BLOCK - 1) / DOT_ROW_BLOCK;
+                    size_t work_per_block = DOT_ROW_BLOCK * gemm.k * gemm.n;
+
+#if defined(__AVX512VNNI__)
+                    if (std::is_same<INPUT0, uint8_t>::value && std::is_same<INPUT1, int8_t>::value)
+                    {
+                        auto a = reinterpret_cast<const uint8_t*>(arg0);
+                        auto b = reinterpret_cast<const int8_t*>(arg1);
+                        VNNIGemm vnni(b, gemm.n, gemm.k);
+                        int32_t a_zero = arg0_zero_point;
+                        int32_t b_zero = arg1_zero_point;
+                        std::vector<int32_t> b_column_sums(gemm.n, 0);
+                        for (size_t kk = 0; kk < gemm.k; kk++)
+                        {
+                            for (size_t j = 0; j < gemm.n; j++)
+                            {
+                                b_column_sums[j] += b[kk * gemm.n + j];
                             }
                         }
+                        int32_t zero_product = static_cast<int32_t>(gemm.k) * a_zero * b_zero;
+                        opt_kernel::run_parallel(
+                            parallel_for, blocks, work_per_block, [&](size_t begin, size_t end) {
+                                size_t row = begin * DOT_ROW_BLOCK;
+                                size_t rows = std::min(end * DOT_ROW_BLOCK, gemm.m) - row;
+                                std::vector<int32_t> sums(rows * gemm.n);
+                                vnni.multiply(a + row * gemm.k, rows, sums.data());
+                                for (size_t i = 0; i < rows; i++)
+                                {
+                                    const uint8_t* a_row = a + (row + i) * gemm.k;
+                                    int32_t a_row_sum = 0;
+                                    for (size_t kk = 0; kk < gemm.k; kk++)
+                                    {
+                                        a_row_sum += a_row[kk];
+                                    }
+                                    int32_t row_offset = zero_product - b_zero * a_row_sum;
+                                    const int32_t* sum_row = sums.data() + i * gemm.n;
+                                    OUTPUT* out_row = out + (row + i) * gemm.n;
+                                    for (size_t j = 0; j < gemm.n; j++)
+                                    {
+                                        out_row[j] = finalize(sum_row[j] + row_offset -
+                                                              a_zero * b_column_sums[j]);
+                                    }
+                                }
+                            });
+                        return;
                     }
+#endif
+                    opt_kernel::run_parallel(
+                        parallel_for, blocks, work_per_block, [&](size_t begin, size_t end) {
+                            size_t row = begin * DOT_ROW_BLOCK;
+                            size_t rows = std::min(end * DOT_ROW_BLOCK, gemm.m) - row;
+                            reference::gemm(arg0 + row * gemm.k,
+                                            arg1,
+                                            out + row * gemm.n,
+                                            rows,
+                                            gemm.n,
+                                            gemm.k,
+                                            static_cast<int32_t>(arg0_zero_point),
+                                            static_cast<int32_t>(arg1_zero_point),
+                                            finalize);
+                        });
                 }
             }
         }
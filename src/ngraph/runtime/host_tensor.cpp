@@ -20,6 +20,7 @@
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
 #include "ngraph/runtime/chrome_trace.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/metrics.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph;
@@ -49,6 +50,7 @@ runtime::HostTensor::HostTensor(const ngraph::element::Type& element_type,
     {
         size_t allocation_size = m_buffer_size + alignment;
         m_allocated_buffer_pool = static_cast<char*>(ngraph_malloc(allocation_size));
+        runtime::metrics::record_allocation(m_buffer_size);
         m_aligned_buffer_pool = m_allocated_buffer_pool;
         size_t mod = size_t(m_aligned_buffer_pool) % alignment;
         if (mod != 0)
@@ -81,6 +83,7 @@ runtime::HostTensor::~HostTensor()
 {
     if (m_allocated_buffer_pool != nullptr)
     {
+        runtime::metrics::record_free(m_buffer_size);
         ngraph_free(m_allocated_buffer_pool);
     }
 }
@@ -107,6 +110,15 @@ void runtime::HostTensor::write(const void* source, size_t n)
     memcpy(target, source, n);
 }
 
+void runtime::HostTensor::write_at(const void* source, size_t offset, size_t n)
+{
+    if (offset + n > m_buffer_size)
+    {
+        throw out_of_range("write access past end of tensor");
+    }
+    memcpy(get_data_ptr() + offset, source, n);
+}
+
 void runtime::HostTensor::read(void* target, size_t n) const
 {
     runtime::event::Duration d1("read", "HostTensor");
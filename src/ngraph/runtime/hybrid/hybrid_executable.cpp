@@ -0,0 +1,409 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <future>
+#include <unordered_map>
+
+#include "ngraph/check.hpp"
+#include "ngraph/cost_model.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/hybrid/hybrid_executable.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+double runtime::hybrid::get_default_min_flops_per_byte()
+{
+    static const double s_min_flops_per_byte = []() {
+        const char* env = getenv("NGRAPH_HYBRID_MIN_FLOPS_PER_BYTE");
+        return env ? strtod(env, nullptr) : 1.0;
+    }();
+    return s_min_flops_per_byte;
+}
+
+static size_t value_bytes(const Output<Node>& value)
+{
+    return shape_size(value.get_shape()) * value.get_element_type().size();
+}
+
+vector<size_t>
+    runtime::hybrid::assign_placement(const shared_ptr<Function>& f,
+                                      const vector<shared_ptr<runtime::Backend>>& backends,
+                                      double min_flops_per_byte)
+{
+    NGRAPH_CHECK(!backends.empty(), "assign_placement requires at least one backend");
+
+    unordered_map<const Node*, size_t> backend_of;
+    unordered_map<const Node*, size_t> segment_of;
+    vector<size_t> segment_backends;
+    for (auto& node : f->get_ordered_ops())
+    {
+        // Parameters and constants are copied into every segment that uses them
+        if (node->is_constant())
+        {
+            node->set_placement_index(Node::placement_invalid);
+        }
+        if (node->is_parameter() || node->is_constant() || node->is_output())
+        {
+            continue;
+        }
+
+        vector<size_t> supported;
+        for (size_t i = 0; i < backends.size(); i++)
+        {
+            if (backends[i]->is_supported(*node))
+            {
+                supported.push_back(i);
+            }
+        }
+        NGRAPH_CHECK(!supported.empty(), "No backend supports ", node->get_name());
+
+        // The backend all placed inputs come from, if they agree
+        size_t input_backend = backends.size();
+        bool inputs_agree = true;
+        size_t input_bytes = 0;
+        for (auto& value : node->input_values())
+        {
+            auto it = backend_of.find(value.get_node());
+            if (it == backend_of.end())
+            {
+                continue;
+            }
+            inputs_agree = inputs_agree && (input_backend == backends.size() ||
+                                            input_backend == it->second);
+            input_backend = it->second;
+            input_bytes += value_bytes(value);
+        }
+
+        size_t chosen = supported.front();
+        if (inputs_agree && input_backend != backends.size() && input_backend != chosen &&
+            find(supported.begin(), supported.end(), input_backend) != supported.end())
+        {
+            // Moving the op means copying its inputs over and, most likely, its outputs back
+            size_t boundary_bytes = input_bytes;
+            for (auto& output : node->outputs())
+            {
+                boundary_bytes += value_bytes(output);
+            }
+            size_t flops = estimate_cost(*node).flops;
+            if (flops < min_flops_per_byte * boundary_bytes)
+            {
+                chosen = input_backend;
+            }
+        }
+
+        // The op may join a segment of its backend that is not before any of its inputs, and
+        // must come after the segments of inputs on other backends
+        size_t first_segment = 0;
+        for (auto& value : node->input_values())
+        {
+            auto it = segment_of.find(value.get_node());
+            if (it != segment_of.end())
+            {
+                bool same_backend = backend_of.at(value.get_node()) == chosen;
+                first_segment = max(first_segment, it->second + (same_backend ? 0 : 1));
+            }
+        }
+        size_t segment = first_segment;
+        while (segment < segment_backends.size() && segment_backends[segment] != chosen)
+        {
+            segment++;
+        }
+        if (segment == segment_backends.size())
+        {
+            segment_backends.push_back(chosen);
+        }
+
+        backend_of[node.get()] = chosen;
+        segment_of[node.get()] = segment;
+        node->set_placement_index(segment);
+    }
+
+    if (segment_backends.empty())
+    {
+        segment_backends.push_back(backends.size() - 1);
+    }
+    return segment_backends;
+}
+
+runtime::hybrid::HybridExecutable::HybridExecutable(
+    shared_ptr<Function> function,
+    const vector<shared_ptr<runtime::Backend>>& backends,
+    size_t pipeline_depth,
+    bool enable_performance_collection)
+    : m_host_backend(backends.size() - 1)
+{
+    NGRAPH_CHECK(!backends.empty(), "HybridExecutable requires at least one backend");
+    NGRAPH_CHECK(pipeline_depth > 0, "HybridExecutable requires a pipeline_depth of at least 1");
+    set_parameters_and_results(*function);
+
+    auto clone = clone_function(*function);
+    m_segment_backends = assign_placement(clone, backends);
+    m_partition = partition_by_placement(clone);
+    NGRAPH_DEBUG << "Split " << function->get_name() << " into " << m_partition.stages.size()
+                 << " segments";
+
+    for (size_t i = 0; i < m_partition.stages.size(); i++)
+    {
+        auto segment = unique_ptr<Segment>(new Segment());
+        segment->backend = backends.at(m_segment_backends.at(i));
+        segment->executable =
+            segment->backend->compile(m_partition.stages[i], enable_performance_collection);
+        m_segments.push_back(move(segment));
+    }
+    for (size_t e = 0; e < m_partition.edges.size(); e++)
+    {
+        auto& edge = m_partition.edges[e];
+        auto& producers = m_segments[edge.dst_stage]->producers;
+        if (find(producers.begin(), producers.end(), edge.src_stage) == producers.end())
+        {
+            producers.push_back(edge.src_stage);
+        }
+        m_segments[edge.dst_stage]->incoming.push_back(e);
+    }
+
+    // Tensors on the host backend that are also call() arguments are bound at call time
+    m_slots.resize(pipeline_depth);
+    for (size_t s = 0; s < pipeline_depth; s++)
+    {
+        auto& slot = m_slots[s];
+        slot.staging.resize(m_segments.size());
+        for (size_t i = 0; i < m_segments.size(); i++)
+        {
+            auto& stage = m_partition.stages[i];
+            auto& backend = m_segments[i]->backend;
+            slot.inputs.emplace_back();
+            for (auto& parameter : stage->get_parameters())
+            {
+                slot.inputs.back().push_back(
+                    backend->create_tensor(parameter->get_element_type(), parameter->get_shape()));
+            }
+            slot.outputs.emplace_back();
+            for (auto& result : stage->get_results())
+            {
+                slot.outputs.back().push_back(
+                    backend->create_tensor(result->get_element_type(), result->get_shape()));
+            }
+        }
+        // Edges within a backend need no copy
+        for (auto& edge : m_partition.edges)
+        {
+            if (m_segment_backends[edge.src_stage] == m_segment_backends[edge.dst_stage])
+            {
+                slot.inputs[edge.dst_stage][edge.dst_parameter] =
+                    slot.outputs[edge.src_stage][edge.src_result];
+            }
+        }
+        m_free_slots.push_back(s);
+    }
+}
+
+size_t runtime::hybrid::HybridExecutable::acquire_slot()
+{
+    unique_lock<mutex> lock(m_slot_mutex);
+    m_slot_cv.wait(lock, [this]() { return !m_free_slots.empty(); });
+    size_t slot = m_free_slots.back();
+    m_free_slots.pop_back();
+    return slot;
+}
+
+void runtime::hybrid::HybridExecutable::release_slot(size_t slot)
+{
+    {
+        lock_guard<mutex> lock(m_slot_mutex);
+        m_free_slots.push_back(slot);
+    }
+    m_slot_cv.notify_one();
+}
+
+static void copy_tensor(runtime::Tensor& dst, const runtime::Tensor& src, vector<char>& staging)
+{
+    size_t bytes = src.get_size_in_bytes();
+    staging.resize(max(staging.size(), bytes));
+    src.read(staging.data(), bytes);
+    dst.write(staging.data(), bytes);
+}
+
+void runtime::hybrid::HybridExecutable::run_segment(
+    size_t index,
+    Slot& slot,
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    auto& segment = *m_segments[index];
+    bool on_host = m_segment_backends[index] == m_host_backend;
+    auto& staging = slot.staging[index];
+
+    // Copies run outside the segment lock so that they overlap other calls' compute
+    for (size_t e : segment.incoming)
+    {
+        auto& edge = m_partition.edges[e];
+        if (m_segment_backends[edge.src_stage] != m_segment_backends[index])
+        {
+            copy_tensor(*slot.inputs[index][edge.dst_parameter],
+                        *slot.outputs[edge.src_stage][edge.src_result],
+                        staging);
+        }
+    }
+    vector<shared_ptr<runtime::Tensor>> segment_inputs = slot.inputs[index];
+    for (size_t i = 0; i < m_partition.parameters.size(); i++)
+    {
+        for (auto& use : m_partition.parameters[i])
+        {
+            if (use.first != index)
+            {
+                continue;
+            }
+            if (on_host)
+            {
+                segment_inputs[use.second] = inputs[i];
+            }
+            else
+            {
+                copy_tensor(*segment_inputs[use.second], *inputs[i], staging);
+            }
+        }
+    }
+    vector<shared_ptr<runtime::Tensor>> segment_outputs = slot.outputs[index];
+    if (on_host)
+    {
+        for (size_t i = 0; i < m_partition.results.size(); i++)
+        {
+            if (m_partition.results[i].first == index)
+            {
+                segment_outputs[m_partition.results[i].second] = outputs[i];
+            }
+        }
+    }
+
+    {
+        lock_guard<mutex> lock(segment.mutex);
+        segment.executable->call(segment_outputs, segment_inputs);
+    }
+
+    if (!on_host)
+    {
+        for (size_t i = 0; i < m_partition.results.size(); i++)
+        {
+            if (m_partition.results[i].first == index)
+            {
+                copy_tensor(*outputs[i], *segment_outputs[m_partition.results[i].second], staging);
+            }
+        }
+    }
+}
+
+bool runtime::hybrid::HybridExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                             const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    size_t slot_index = acquire_slot();
+    Slot& slot = m_slots[slot_index];
+
+    if (m_segments.size() == 1)
+    {
+        try
+        {
+            run_segment(0, slot, outputs, inputs);
+        }
+        catch (...)
+        {
+            release_slot(slot_index);
+            throw;
+        }
+        release_slot(slot_index);
+        return true;
+    }
+
+    // Each segment waits for the segments it reads from, so independent segments overlap
+    vector<shared_future<void>> done(m_segments.size());
+    for (size_t i = 0; i < m_segments.size(); i++)
+    {
+        done[i] = async(launch::async, [this, i, &slot, &done, &outputs, &inputs]() {
+                      for (size_t producer : m_segments[i]->producers)
+                      {
+                          done[producer].get();
+                      }
+                      run_segment(i, slot, outputs, inputs);
+                  }).share();
+    }
+
+    exception_ptr error;
+    for (auto& segment_done : done)
+    {
+        try
+        {
+            segment_done.get();
+        }
+        catch (...)
+        {
+            if (!error)
+            {
+                error = current_exception();
+            }
+        }
+    }
+    release_slot(slot_index);
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+    return true;
+}
+
+future<bool> runtime::hybrid::HybridExecutable::call_async(
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs,
+    const AsyncCallback& callback)
+{
+    // call() is reentrant, so unlike the default, calls are not serialized and pipeline
+    return async(launch::async, [this, outputs, inputs, callback]() {
+        bool rc = false;
+        try
+        {
+            rc = call(outputs, inputs);
+        }
+        catch (...)
+        {
+            if (callback)
+            {
+                callback(false);
+            }
+            throw;
+        }
+        if (callback)
+        {
+            callback(rc);
+        }
+        return rc;
+    });
+}
+
+vector<runtime::PerformanceCounter>
+    runtime::hybrid::HybridExecutable::get_performance_data() const
+{
+    vector<runtime::PerformanceCounter> rc;
+    for (auto& segment : m_segments)
+    {
+        auto data = segment->executable->get_performance_data();
+        rc.insert(rc.end(), data.begin(), data.end());
+    }
+    return rc;
+}
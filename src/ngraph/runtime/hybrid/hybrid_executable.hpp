@@ -0,0 +1,139 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/placement.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace hybrid
+        {
+            class HybridExecutable;
+
+            /// \brief Defaults to NGRAPH_HYBRID_MIN_FLOPS_PER_BYTE, or 1.
+            NGRAPH_API double get_default_min_flops_per_byte();
+
+            /// \brief Assigns the ops of \p f to backends and groups them into segments.
+            ///
+            /// Each op goes to the first backend in \p backends that supports it. An op stays
+            /// instead on the backend its inputs come from, if that backend supports it too and
+            /// the op does less than \p min_flops_per_byte estimated flops per byte it would
+            /// move across the boundary, so that light ops do not cause extra copies.
+            ///
+            /// Ops on the same backend are grouped into segments such that values only flow to
+            /// the same or a later segment. The segment of each op is set as its placement
+            /// index, for partition_by_placement.
+            ///
+            /// \returns The index in \p backends of each segment's backend
+            NGRAPH_API
+            std::vector<size_t>
+                assign_placement(const std::shared_ptr<Function>& f,
+                                 const std::vector<std::shared_ptr<runtime::Backend>>& backends,
+                                 double min_flops_per_byte = get_default_min_flops_per_byte());
+        }
+    }
+}
+
+///
+/// \brief Executable that runs a Function split across several backends.
+///
+/// The Function is split by assign_placement and partition_by_placement, and each segment is
+/// compiled on its backend. Values that cross between backends are copied through host memory.
+/// Segments that do not depend on each other run concurrently.
+///
+/// call() may be entered from several threads at once, and call_async() does not serialize
+/// calls. Up to `pipeline_depth` calls are in flight, each with its own boundary tensors, and
+/// each segment runs one call at a time, so consecutive calls pipeline through the segments.
+///
+/// The tensors passed to call() must belong to the last backend in the list, which should
+/// support every op, such as CPU.
+///
+class NGRAPH_API ngraph::runtime::hybrid::HybridExecutable : public ngraph::runtime::Executable
+{
+public:
+    HybridExecutable(std::shared_ptr<Function> function,
+                     const std::vector<std::shared_ptr<runtime::Backend>>& backends,
+                     size_t pipeline_depth = 2,
+                     bool enable_performance_collection = false);
+
+    bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    std::future<bool> call_async(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                                 const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                                 const AsyncCallback& callback = nullptr) override;
+
+    std::vector<PerformanceCounter> get_performance_data() const override;
+
+    size_t get_preferred_pipeline_depth() const override { return m_slots.size(); }
+    /// \returns The backend index of each segment
+    const std::vector<size_t>& get_segment_backends() const { return m_segment_backends; }
+    /// \returns The compiled Function of each segment
+    std::vector<std::shared_ptr<Function>> get_segment_functions() const
+    {
+        return m_partition.stages;
+    }
+
+private:
+    struct Segment
+    {
+        std::shared_ptr<runtime::Backend> backend;
+        std::shared_ptr<runtime::Executable> executable;
+        // Segments that compute inputs of this one
+        std::vector<size_t> producers;
+        // Edges whose destination is this segment
+        std::vector<size_t> incoming;
+        // Runs one call at a time, since executables are not assumed to be reentrant
+        std::mutex mutex;
+    };
+
+    // Tensors of one in-flight call
+    struct Slot
+    {
+        // Parameter and result tensors of each segment
+        std::vector<std::vector<std::shared_ptr<runtime::Tensor>>> inputs;
+        std::vector<std::vector<std::shared_ptr<runtime::Tensor>>> outputs;
+        // Host staging buffer of each edge that crosses backends
+        std::vector<std::vector<char>> staging;
+    };
+
+    size_t acquire_slot();
+    void release_slot(size_t slot);
+    void run_segment(size_t segment,
+                     Slot& slot,
+                     const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                     const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+    PipelinePartition m_partition;
+    std::vector<size_t> m_segment_backends;
+    size_t m_host_backend;
+    std::vector<std::unique_ptr<Segment>> m_segments;
+    std::vector<Slot> m_slots;
+    std::vector<size_t> m_free_slots;
+    std::mutex m_slot_mutex;
+    std::condition_variable m_slot_cv;
+};
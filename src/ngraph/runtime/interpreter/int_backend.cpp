@@ -14,15 +14,19 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdlib>
+
 #include "ngraph/runtime/interpreter/int_backend_visibility.hpp"
 
 #include "ngraph/component_manager.hpp"
 #include "ngraph/cpio.hpp"
 #include "ngraph/except.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
+#include "ngraph/runtime/compile_cache.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/interpreter/int_backend.hpp"
 #include "ngraph/runtime/interpreter/int_executable.hpp"
+#include "ngraph/runtime/metrics.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 
@@ -36,12 +40,20 @@ extern "C" INTERPRETER_BACKEND_API void ngraph_register_interpreter_backend()
     });
 }
 
+static shared_ptr<runtime::interpreter::INTThreadPool> make_thread_pool(size_t num_threads)
+{
+    return num_threads > 1 ? make_shared<runtime::interpreter::INTThreadPool>(num_threads)
+                           : nullptr;
+}
+
 runtime::interpreter::INTBackend::INTBackend()
+    : m_thread_pool{make_thread_pool(INTThreadPool::get_default_num_threads())}
 {
 }
 
 runtime::interpreter::INTBackend::INTBackend(const vector<string>& unsupported_op_name_list)
     : m_unsupported_op_name_list{unsupported_op_name_list.begin(), unsupported_op_name_list.end()}
+    , m_thread_pool{make_thread_pool(INTThreadPool::get_default_num_threads())}
 {
 }
 
@@ -61,7 +73,25 @@ shared_ptr<runtime::Executable>
     runtime::interpreter::INTBackend::compile(shared_ptr<Function> function,
                                               bool enable_performance_collection)
 {
-    return make_shared<INTExecutable>(function, enable_performance_collection);
+    static runtime::metrics::BackendMetrics s_metrics("INTERPRETER");
+    runtime::metrics::ScopedTimer timer(s_metrics.compile_seconds);
+    // Performance counters are not restored by load(), so only plain compiles are cached
+    runtime::CompileCache& cache = runtime::CompileCache::get_default();
+    if (cache.is_enabled() && !enable_performance_collection)
+    {
+        string key = cache.get_key(function, "INTERPRETER");
+        if (auto exec = cache.load(key, *this))
+        {
+            return exec;
+        }
+        auto exec = make_shared<INTExecutable>(function, enable_performance_collection);
+        exec->set_thread_pool(m_thread_pool);
+        cache.store(key, *exec);
+        return exec;
+    }
+    auto exec = make_shared<INTExecutable>(function, enable_performance_collection);
+    exec->set_thread_pool(m_thread_pool);
+    return exec;
 }
 
 bool runtime::interpreter::INTBackend::is_supported(const Node& node) const
@@ -92,7 +122,9 @@ std::shared_ptr<runtime::Executable> runtime::interpreter::INTBackend::load(istr
             {
                 vector<char> buffer = reader.read(info);
                 string model_string = string(buffer.data(), buffer.size());
-                exec = shared_ptr<INTExecutable>(new INTExecutable(model_string));
+                auto int_exec = shared_ptr<INTExecutable>(new INTExecutable(model_string));
+                int_exec->set_thread_pool(m_thread_pool);
+                exec = int_exec;
                 break;
             }
         }
@@ -110,5 +142,17 @@ bool runtime::interpreter::INTBackend::set_config(const map<string, string>& con
         error = it->second;
         rc = true;
     }
+    it = config.find("threads");
+    if (it != config.end())
+    {
+        int value = std::atoi(it->second.c_str());
+        if (value < 1)
+        {
+            error = "threads must be a positive integer, got '" + it->second + "'";
+            return false;
+        }
+        m_thread_pool = make_thread_pool(static_cast<size_t>(value));
+        rc = true;
+    }
     return rc;
 }
@@ -25,6 +25,7 @@
 #include "ngraph/runtime/interpreter/int_backend_visibility.hpp"
 
 #include "ngraph/runtime/backend_manager.hpp"
+#include "ngraph/runtime/interpreter/int_thread_pool.hpp"
 #include "ngraph/runtime/tensor.hpp"
 
 namespace ngraph
@@ -60,8 +61,13 @@ public:
 
     bool is_supported(const Node& node) const override;
 
+    /// \brief Besides `test_echo`, accepts `threads`: the number of threads that executables
+    ///        compiled afterwards use for the heavy kernels. Defaults to
+    ///        NGRAPH_INTERPRETER_THREADS, or 1.
     bool set_config(const std::map<std::string, std::string>& config, std::string& error) override;
 
 private:
     std::set<std::string> m_unsupported_op_name_list;
+    // Shared by the executables compiled while it is set; nullptr when single-threaded
+    std::shared_ptr<INTThreadPool> m_thread_pool;
 };
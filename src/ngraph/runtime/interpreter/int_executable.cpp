@@ -14,20 +14,25 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
+
 #include "ngraph/runtime/interpreter/int_executable.hpp"
 #include "ngraph/cpio.hpp"
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
 #include "ngraph/except.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/pass/assign_layout.hpp"
+#include "ngraph/pass/broadcast_folding.hpp"
 #include "ngraph/pass/core_fusion.hpp"
 #include "ngraph/pass/fused_op_decomposition.hpp"
 #include "ngraph/pass/like_replacement.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/opset0_downgrade.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/chrome_trace.hpp"
+#include "ngraph/runtime/metrics.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 
@@ -70,20 +75,53 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
 #else
     m_function = clone_function(*function);
 #endif
+    // Fused ops with a kernel of their own
+    auto is_supported = [](const Node& node) { return get_typeid(node) == OP_TYPEID::Gelu; };
     pass::Manager pass_manager;
     pass_manager.register_pass<pass::LikeReplacement>();
-    pass_manager.register_pass<pass::FusedOpDecomposition>();
+    pass_manager.register_pass<pass::FusedOpDecomposition>(is_supported);
     pass_manager.register_pass<pass::Opset0Downgrade>();
     // Need to decompose any v0 fused ops, which were produced by the downgrade pass
-    pass_manager.register_pass<pass::FusedOpDecomposition>();
+    pass_manager.register_pass<pass::FusedOpDecomposition>(is_supported);
+    // These kernels read implicitly broadcast inputs in place, see autobroadcast_binop
+    pass_manager.register_pass<pass::BroadcastFolding>([](const Node& node) {
+        switch (get_typeid(node))
+        {
+        case OP_TYPEID::Add:
+        case OP_TYPEID::And:
+        case OP_TYPEID::Divide:
+        case OP_TYPEID::Equal:
+        case OP_TYPEID::Greater:
+        case OP_TYPEID::GreaterEq:
+        case OP_TYPEID::Less:
+        case OP_TYPEID::LessEq:
+        case OP_TYPEID::Maximum:
+        case OP_TYPEID::Minimum:
+        case OP_TYPEID::Multiply:
+        case OP_TYPEID::NotEqual:
+        case OP_TYPEID::Or:
+        case OP_TYPEID::Power:
+        case OP_TYPEID::Subtract:
+        case OP_TYPEID::Xor: return true;
+        default: return false;
+        }
+    });
     pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
     pass_manager.register_pass<pass::Liveness>();
-    pass_manager.run_passes(m_function);
+    // Elementwise ops overwrite an input that dies there, see get_in_place_elementwise_inputs
+    pass_manager.register_pass<pass::MemoryLayout>(get_alignment());
+    set_pass_report(pass_manager.run_passes(m_function));
     for (auto node : m_function->get_ordered_ops())
     {
+        // Share the data with identical constants of other executables
+        if (auto constant = as_type_ptr<op::Constant>(node))
+        {
+            constant->intern_data();
+        }
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_function);
+    compile_plan();
 }
 
 runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_string)
@@ -91,137 +129,281 @@ runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_stri
     , m_performance_counters_enabled{false}
 {
     m_function = deserialize(model_string);
+    // The saved model has been through the other passes, but liveness is not serialized
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(get_alignment());
+    pass_manager.run_passes(m_function);
     for (auto node : m_function->get_ordered_ops())
     {
+        // Share the data with identical constants of other executables
+        if (auto constant = as_type_ptr<op::Constant>(node))
+        {
+            constant->intern_data();
+        }
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_function);
+    compile_plan();
 }
 
-bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
-                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+runtime::interpreter::INTExecutable::Kernel
+    runtime::interpreter::INTExecutable::get_kernel(const element::Type& type)
 {
-    runtime::event::Duration d1("call", "Interpreter");
-
-    // convert inputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_inputs;
-    for (auto tensor : inputs)
-    {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_inputs.push_back(host_tensor);
-    }
-    if (m_nan_check_enabled)
+    switch (type)
     {
-        perform_nan_check(func_inputs);
+    case element::Type_t::boolean: return &INTExecutable::op_engine<char>;
+    case element::Type_t::f32: return &INTExecutable::op_engine<float>;
+    case element::Type_t::f64: return &INTExecutable::op_engine<double>;
+    case element::Type_t::i8: return &INTExecutable::op_engine<int8_t>;
+    case element::Type_t::i16: return &INTExecutable::op_engine<int16_t>;
+    case element::Type_t::i32: return &INTExecutable::op_engine<int32_t>;
+    case element::Type_t::i64: return &INTExecutable::op_engine<int64_t>;
+    case element::Type_t::u8: return &INTExecutable::op_engine<uint8_t>;
+    case element::Type_t::u16: return &INTExecutable::op_engine<uint16_t>;
+    case element::Type_t::u32: return &INTExecutable::op_engine<uint32_t>;
+    case element::Type_t::u64: return &INTExecutable::op_engine<uint64_t>;
+    case element::Type_t::undefined:
+    case element::Type_t::dynamic:
+    case element::Type_t::u1:
+    case element::Type_t::bf16:
+    case element::Type_t::f16: break;
     }
+    return nullptr;
+}
 
-    // convert outputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_outputs;
-    for (auto tensor : outputs)
+void runtime::interpreter::INTExecutable::compile_plan()
+{
+    unordered_map<const descriptor::Tensor*, vector<Use>> uses;
+    unordered_map<const Node*, size_t> result_steps;
+    for (auto& op : m_nodes)
     {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_outputs.push_back(host_tensor);
+        if (op->is_parameter() || op->is_constant())
+        {
+            continue;
+        }
+
+        // The type whose op_engine runs the op
+        element::Type type;
+        if (is_type<op::Convert>(op) || is_type<op::Quantize>(op) || is_type<op::Dequantize>(op) ||
+            is_type<op::ArgMin>(op) || is_type<op::ArgMax>(op))
+        {
+            type = op->get_input_element_type(0);
+        }
+        else if (is_type<op::Equal>(op) || is_type<op::Greater>(op) || is_type<op::GreaterEq>(op) ||
+                 is_type<op::Less>(op) || is_type<op::LessEq>(op) || is_type<op::NotEqual>(op))
+        {
+            // Get the type of the second input, not the first
+            // All BinaryElementwiseComparision ops have the same type for inputs
+            // Select has bool for first input and the type we are interested in for the second
+            type = op->get_input_element_type(1);
+        }
+        else if (is_type<op::TopK>(op))
+        {
+            type = op->get_output_element_type(1);
+        }
+        else
+        {
+            type = op->get_output_element_type(0);
+        }
+
+        size_t step = m_steps.size();
+        m_steps.push_back(Step{op,
+                               type,
+                               get_kernel(type),
+                               vector<shared_ptr<HostTensor>>(op->get_input_size()),
+                               vector<shared_ptr<HostTensor>>(op->get_output_size())});
+        for (size_t i = 0; i < op->get_input_size(); ++i)
+        {
+            uses[&op->input(i).get_tensor()].push_back(Use{step, false, i});
+        }
+        for (size_t i = 0; i < op->get_output_size(); ++i)
+        {
+            uses[&op->output(i).get_tensor()].push_back(Use{step, true, i});
+        }
+        if (is_type<op::Result>(op))
+        {
+            result_steps[op.get()] = step;
+        }
     }
 
-    // map function params -> HostTensor
-    unordered_map<descriptor::Tensor*, shared_ptr<HostTensor>> tensor_map;
-    size_t input_count = 0;
-    for (auto param : get_parameters())
+    for (auto& param : get_parameters())
     {
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
-            descriptor::Tensor* tensor = &param->output(i).get_tensor();
-            tensor_map.insert({tensor, func_inputs[input_count++]});
+            m_parameter_uses.push_back(uses[&param->output(i).get_tensor()]);
         }
     }
 
-    // map function outputs -> HostTensor
-    for (size_t output_count = 0; output_count < get_results().size(); ++output_count)
+    for (auto& result : get_results())
     {
-        auto output = get_results()[output_count];
-        if (!is_type<op::Result>(output))
+        if (!is_type<op::Result>(result))
         {
             throw ngraph_error("One of function's outputs isn't op::Result");
         }
-        descriptor::Tensor* tensor = &output->output(0).get_tensor();
-        tensor_map.insert({tensor, func_outputs[output_count]});
+        m_result_steps.push_back(result_steps.at(result.get()));
+        descriptor::Tensor* tensor = &result->input(0).get_tensor();
+        auto producer = result->get_input_node_ptr(0);
+        // Parameters and constants are not written by a step, so their Results copy them
+        bool intermediate = !producer->is_parameter() && !producer->is_constant();
+        m_result_sources.push_back(
+            ResultSource{tensor, nullptr, intermediate ? uses[tensor] : vector<Use>{}});
     }
+    m_result_bound.resize(m_result_sources.size());
+}
 
-    // for each ordered op in the graph
-    for (auto op : m_nodes)
+void runtime::interpreter::INTExecutable::allocate_plan()
+{
+    m_pool = AlignedBuffer(m_function->get_temporary_pool_size(), get_alignment());
+    char* pool_data = m_pool.get_ptr<char>();
+    unordered_map<const descriptor::Tensor*, shared_ptr<HostTensor>> tensors;
+    for (auto& node : m_nodes)
     {
-        runtime::event::Duration d2(op->description(), "Interpreter");
-        if (op->is_parameter())
+        if (auto constant = as_type_ptr<op::Constant>(node))
         {
-            continue;
+            // Kernels read constants where they are, instead of copying them on each call
+            tensors[&constant->output(0).get_tensor()] =
+                make_shared<HostTensor>(constant->get_element_type(),
+                                        constant->get_shape(),
+                                        const_cast<void*>(constant->get_data_ptr()));
         }
-
-        // get op inputs from map
-        vector<shared_ptr<HostTensor>> op_inputs;
-        for (auto input : op->inputs())
+        for (descriptor::Tensor* tensor : node->liveness_new_list)
         {
-            descriptor::Tensor* tensor = &input.get_tensor();
-            op_inputs.push_back(tensor_map.at(tensor));
+            tensors[tensor] = make_shared<HostTensor>(tensor->get_element_type(),
+                                                      tensor->get_shape(),
+                                                      pool_data + tensor->get_pool_offset(),
+                                                      tensor->get_name());
         }
+    }
 
-        // get op outputs from map or create
-        vector<shared_ptr<HostTensor>> op_outputs;
-        for (size_t i = 0; i < op->get_output_size(); ++i)
+    // Parameters and Result outputs are left for call() to bind
+    for (auto& step : m_steps)
+    {
+        for (size_t i = 0; i < step.inputs.size(); ++i)
         {
-            descriptor::Tensor* tensor = &op->output(i).get_tensor();
-            shared_ptr<HostTensor> host_tensor;
-            auto it = tensor_map.find(tensor);
-            if (it == tensor_map.end())
+            auto it = tensors.find(&step.node->input(i).get_tensor());
+            if (it != tensors.end())
             {
-                const Shape& shape = op->get_output_shape(i);
-                const element::Type& type = op->get_output_element_type(i);
-                string name = op->output(i).get_tensor().get_name();
-                host_tensor = make_shared<runtime::HostTensor>(type, shape, name);
-                tensor_map.insert({tensor, host_tensor});
+                step.inputs[i] = it->second;
             }
-            else
+        }
+        for (size_t i = 0; i < step.outputs.size(); ++i)
+        {
+            auto it = tensors.find(&step.node->output(i).get_tensor());
+            if (it != tensors.end())
             {
-                host_tensor = it->second;
+                step.outputs[i] = it->second;
             }
-            op_outputs.push_back(host_tensor);
         }
+    }
+    for (auto& source : m_result_sources)
+    {
+        if (!source.uses.empty())
+        {
+            source.pool_tensor = tensors.at(source.tensor);
+        }
+    }
+    m_pool_allocated = true;
+}
 
-        // get op type
-        element::Type type;
-        if (is_type<op::Convert>(op) || is_type<op::Quantize>(op) || is_type<op::Dequantize>(op) ||
-            is_type<op::ArgMin>(op) || is_type<op::ArgMax>(op))
+void runtime::interpreter::INTExecutable::bind(const vector<Use>& uses,
+                                               const shared_ptr<HostTensor>& tensor)
+{
+    for (const Use& use : uses)
+    {
+        Step& step = m_steps[use.step];
+        (use.is_output ? step.outputs : step.inputs)[use.index] = tensor;
+    }
+}
+
+bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    runtime::event::Duration d1("call", "Interpreter");
+    static runtime::metrics::BackendMetrics s_metrics("INTERPRETER");
+    s_metrics.calls.increment();
+    runtime::metrics::ScopedTimer timer(s_metrics.call_seconds);
+
+    if (!m_pool_allocated)
+    {
+        allocate_plan();
+    }
+    if (m_nan_check_enabled)
+    {
+        vector<shared_ptr<HostTensor>> func_inputs;
+        for (auto& tensor : inputs)
         {
-            type = op->get_input_element_type(0);
+            func_inputs.push_back(static_pointer_cast<runtime::HostTensor>(tensor));
         }
-        else if (is_type<op::Equal>(op) || is_type<op::Greater>(op) || is_type<op::GreaterEq>(op) ||
-                 is_type<op::Less>(op) || is_type<op::LessEq>(op) || is_type<op::NotEqual>(op))
+        perform_nan_check(func_inputs);
+    }
+
+    for (size_t i = 0; i < m_parameter_uses.size(); ++i)
+    {
+        bind(m_parameter_uses[i], static_pointer_cast<runtime::HostTensor>(inputs[i]));
+    }
+
+    // Bind each result's producer directly to the caller's output tensor so that the Result
+    // op does not have to copy. A value that feeds an earlier result keeps that binding and
+    // the Result copies as before. A caller output that is also passed as an input is never
+    // bound, since the producer would overwrite data it may still be reading.
+    for (size_t i = 0; i < m_result_sources.size(); ++i)
+    {
+        auto output = static_pointer_cast<runtime::HostTensor>(outputs[i]);
+        m_steps[m_result_steps[i]].outputs[0] = output;
+        const ResultSource& source = m_result_sources[i];
+        if (source.uses.empty())
         {
-            // Get the type of the second input, not the first
-            // All BinaryElementwiseComparision ops have the same type for inputs
-            // Select has bool for first input and the type we are interested in for the second
-            type = op->get_input_element_type(1);
+            continue;
         }
-        else if (is_type<op::TopK>(op))
+        bool bound = find(inputs.begin(), inputs.end(), outputs[i]) == inputs.end();
+        for (size_t j = 0; j < i && bound; ++j)
         {
-            type = op->get_output_element_type(1);
+            bound = !(m_result_bound[j] && m_result_sources[j].tensor == source.tensor);
         }
-        else
+        m_result_bound[i] = bound;
+        if (bound)
         {
-            type = op->get_output_element_type(0);
+            bind(source.uses, output);
+        }
+        else if (!any_of(m_result_sources.begin(),
+                         m_result_sources.begin() + i,
+                         [&](const ResultSource& earlier) {
+                             return earlier.tensor == source.tensor;
+                         }))
+        {
+            bind(source.uses, source.pool_tensor);
+        }
+    }
+
+    for (Step& step : m_steps)
+    {
+        runtime::event::Duration d2(step.node->description(), "Interpreter");
+        if (is_type<op::Result>(step.node) && step.inputs[0] == step.outputs[0])
+        {
+            // The producer already wrote to the output tensor
+            continue;
         }
 
         if (m_performance_counters_enabled)
         {
-            m_timer_map[op].start();
+            m_timer_map[step.node].start();
+        }
+        if (step.kernel)
+        {
+            (this->*step.kernel)(*step.node, step.outputs, step.inputs);
+        }
+        else
+        {
+            generate_calls(step.type, *step.node, step.outputs, step.inputs);
         }
-        generate_calls(type, *op.get(), op_outputs, op_inputs);
         if (m_performance_counters_enabled)
         {
-            m_timer_map[op].stop();
+            m_timer_map[step.node].stop();
         }
         if (m_nan_check_enabled)
         {
-            perform_nan_check(op_outputs, op.get());
+            perform_nan_check(step.outputs, step.node.get());
         }
     }
 
@@ -273,49 +455,46 @@ vector<runtime::PerformanceCounter>
     return rc;
 }
 
+template <typename T>
+bool runtime::interpreter::INTExecutable::parallel_any_isnan(const T* data, size_t count) const
+{
+    atomic<bool> found{false};
+    parallel_for(count, 1, [&](size_t begin, size_t end) {
+        if (!found.load(memory_order_relaxed) && any_isnan(data + begin, end - begin))
+        {
+            found.store(true, memory_order_relaxed);
+        }
+    });
+    return found.load();
+}
+
 void runtime::interpreter::INTExecutable::perform_nan_check(
-    const vector<shared_ptr<HostTensor>>& tensors, const Node* op)
+    const vector<shared_ptr<HostTensor>>& tensors, const Node* op) const
 {
     size_t arg_number = 1;
     for (const shared_ptr<HostTensor>& tensor : tensors)
     {
         const element::Type& type = tensor->get_element_type();
+        bool found = false;
         if (type == element::f32)
         {
-            const float* data = tensor->get_data_ptr<float>();
-            for (size_t i = 0; i < tensor->get_element_count(); i++)
-            {
-                if (std::isnan(data[i]))
-                {
-                    if (op)
-                    {
-                        throw runtime_error("nan found in op '" + op->get_name() + "' output");
-                    }
-                    else
-                    {
-                        throw runtime_error("nan found in function's input tensor number " +
-                                            to_string(arg_number));
-                    }
-                }
-            }
+            found = parallel_any_isnan(tensor->get_data_ptr<float>(), tensor->get_element_count());
         }
         else if (type == element::f64)
         {
-            const double* data = tensor->get_data_ptr<double>();
-            for (size_t i = 0; i < tensor->get_element_count(); i++)
+            found =
+                parallel_any_isnan(tensor->get_data_ptr<double>(), tensor->get_element_count());
+        }
+        if (found)
+        {
+            if (op)
+            {
+                throw runtime_error("nan found in op '" + op->get_name() + "' output");
+            }
+            else
             {
-                if (std::isnan(data[i]))
-                {
-                    if (op)
-                    {
-                        throw runtime_error("nan found in op '" + op->get_name() + "' output");
-                    }
-                    else
-                    {
-                        throw runtime_error("nan found in function's input tensor number " +
-                                            to_string(arg_number));
-                    }
-                }
+                throw runtime_error("nan found in function's input tensor number " +
+                                    to_string(arg_number));
             }
         }
         arg_number++;
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
 #include <initializer_list>
 #include <iostream>
 #include <memory>
@@ -27,6 +29,15 @@
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/interpreter/int_thread_pool.hpp"
+#include "ngraph/runtime/opt_kernel/broadcast.hpp"
+#include "ngraph/runtime/opt_kernel/concat.hpp"
+#include "ngraph/runtime/opt_kernel/convolution_backprop.hpp"
+#include "ngraph/runtime/opt_kernel/cum_sum.hpp"
+#include "ngraph/runtime/opt_kernel/pad.hpp"
+#include "ngraph/runtime/opt_kernel/replace_slice.hpp"
+#include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/opt_kernel/slice.hpp"
 #ifdef INTERPRETER_USE_HYBRID
 #include "ngraph/runtime/hybrid/op/function_call.hpp"
 #endif
@@ -34,6 +45,7 @@
 #include "ngraph/runtime/reference/acos.hpp"
 #include "ngraph/runtime/reference/add.hpp"
 #include "ngraph/runtime/reference/all.hpp"
+#include "ngraph/runtime/reference/all_gather.hpp"
 #include "ngraph/runtime/reference/allreduce.hpp"
 #include "ngraph/runtime/reference/and.hpp"
 #include "ngraph/runtime/reference/any.hpp"
@@ -66,6 +78,7 @@
 #include "ngraph/runtime/reference/floor.hpp"
 #include "ngraph/runtime/reference/gather.hpp"
 #include "ngraph/runtime/reference/gather_nd.hpp"
+#include "ngraph/runtime/reference/gelu.hpp"
 #include "ngraph/runtime/reference/generate_mask.hpp"
 #include "ngraph/runtime/reference/greater.hpp"
 #include "ngraph/runtime/reference/greater_eq.hpp"
@@ -90,6 +103,7 @@
 #include "ngraph/runtime/reference/quantize.hpp"
 #include "ngraph/runtime/reference/random_uniform.hpp"
 #include "ngraph/runtime/reference/recv.hpp"
+#include "ngraph/runtime/reference/reduce_scatter.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
 #include "ngraph/runtime/reference/replace_slice.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
@@ -159,6 +173,13 @@ public:
 
     void set_nan_check(bool enable);
 
+    /// \brief Splits the heavy kernels across `thread_pool`; nullptr runs every kernel on the
+    ///        calling thread
+    void set_thread_pool(const std::shared_ptr<INTThreadPool>& thread_pool)
+    {
+        m_thread_pool = thread_pool;
+    }
+
     std::vector<PerformanceCounter> get_performance_data() const override;
 
     std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
@@ -183,13 +204,153 @@ protected:
     std::shared_ptr<Function> m_function;
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
     std::vector<std::shared_ptr<Node>> m_nodes;
+
+    using Kernel = void (INTExecutable::*)(const Node&,
+                                           const std::vector<std::shared_ptr<HostTensor>>&,
+                                           const std::vector<std::shared_ptr<HostTensor>>&);
+
+    /// \brief An op of the call plan, with its kernel and tensors resolved when compiling
+    struct Step
+    {
+        std::shared_ptr<Node> node;
+        element::Type type;
+        /// op_engine<T> for `type`; nullptr lets generate_calls report the unsupported type
+        Kernel kernel;
+        std::vector<std::shared_ptr<HostTensor>> inputs;
+        std::vector<std::shared_ptr<HostTensor>> outputs;
+    };
+
+    /// \brief An input or output of a step that is bound to a caller tensor on each call
+    struct Use
+    {
+        size_t step;
+        bool is_output;
+        size_t index;
+    };
+
+    /// \brief The value a Result copies out. When it is an intermediate, its producer writes
+    ///        straight into the caller's output tensor instead.
+    struct ResultSource
+    {
+        descriptor::Tensor* tensor;
+        std::shared_ptr<HostTensor> pool_tensor;
+        std::vector<Use> uses;
+    };
+
+    // Ops other than Parameter and Constant, in execution order
+    std::vector<Step> m_steps;
+    // Uses of each output of each parameter, in input order
+    std::vector<std::vector<Use>> m_parameter_uses;
+    // Step of each Result, in output order
+    std::vector<size_t> m_result_steps;
+    std::vector<ResultSource> m_result_sources;
+    std::vector<char> m_result_bound;
+    // Intermediate tensors, at the offsets assigned by pass::MemoryLayout. Allocated by the
+    // first call so that subclasses with their own call() do not hold it.
+    AlignedBuffer m_pool;
+    bool m_pool_allocated = false;
     std::unordered_map<const Node*, std::shared_ptr<State>> m_states;
     std::set<std::string> m_unsupported_op_name_list;
+    std::shared_ptr<INTThreadPool> m_thread_pool;
 
     static OP_TYPEID get_typeid(const Node& node);
 
-    static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
-                                  const Node* op = nullptr);
+    /// \brief Calls `f(begin, end)` on ranges covering [0, count), in parallel when a thread
+    ///        pool is set. `work_per_item` estimates the scalar operations per item so that
+    ///        small loops stay on the calling thread.
+    void parallel_for(size_t count,
+                      size_t work_per_item,
+                      const std::function<void(size_t begin, size_t end)>& f) const
+    {
+        const size_t min_work_per_chunk = 1 << 15;
+        if (m_thread_pool)
+        {
+            m_thread_pool->parallel_for(
+                count, min_work_per_chunk / std::max<size_t>(work_per_item, 1), f);
+        }
+        else if (count > 0)
+        {
+            f(0, count);
+        }
+    }
+
+    /// \brief parallel_for as a hook for the opt_kernel copies.
+    runtime::opt_kernel::parallel_for_t kernel_parallel_for() const
+    {
+        return [this](size_t count,
+                      size_t work_per_item,
+                      const std::function<void(size_t begin, size_t end)>& f) {
+            parallel_for(count, work_per_item, f);
+        };
+    }
+
+    template <typename T>
+    void parallel_elementwise(const T* arg,
+                              T* out,
+                              size_t count,
+                              void (*kernel)(const T*, T*, size_t)) const
+    {
+        parallel_for(count, 1, [&](size_t begin, size_t end) {
+            kernel(arg + begin, out + begin, end - begin);
+        });
+    }
+
+    template <typename T>
+    void parallel_elementwise(const T* arg0,
+                              const T* arg1,
+                              T* out,
+                              size_t count,
+                              void (*kernel)(const T*, const T*, T*, size_t)) const
+    {
+        parallel_for(count, 1, [&](size_t begin, size_t end) {
+            kernel(arg0 + begin, arg1 + begin, out + begin, end - begin);
+        });
+    }
+
+    /// \brief Splits a reduction along the leading axis when that axis is not reduced
+    template <typename T>
+    void parallel_reduction(
+        const T* arg,
+        T* out,
+        const Shape& in_shape,
+        const Shape& out_shape,
+        const AxisSet& reduction_axes,
+        void (*kernel)(const T*, T*, const Shape&, const Shape&, const AxisSet&)) const
+    {
+        if (in_shape.empty() || reduction_axes.count(0) != 0 || shape_size(in_shape) == 0)
+        {
+            kernel(arg, out, in_shape, out_shape, reduction_axes);
+            return;
+        }
+        size_t in_row_size = shape_size(in_shape) / in_shape[0];
+        size_t out_row_size = shape_size(out_shape) / out_shape[0];
+        parallel_for(in_shape[0], in_row_size, [&](size_t begin, size_t end) {
+            kernel(arg + begin * in_row_size,
+                   out + begin * out_row_size,
+                   with_leading_dim(in_shape, end - begin),
+                   with_leading_dim(out_shape, end - begin),
+                   reduction_axes);
+        });
+    }
+
+    static Shape with_leading_dim(Shape shape, size_t size)
+    {
+        shape[0] = size;
+        return shape;
+    }
+
+    /// \brief Builds m_steps and the caller bindings from m_nodes, which must have been
+    ///        through pass::Liveness and pass::MemoryLayout
+    void compile_plan();
+    /// \brief Allocates m_pool and points the steps at their intermediate tensors
+    void allocate_plan();
+    static Kernel get_kernel(const element::Type& type);
+    void bind(const std::vector<Use>& uses, const std::shared_ptr<HostTensor>& tensor);
+
+    void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
+                           const Node* op = nullptr) const;
+    template <typename T>
+    bool parallel_any_isnan(const T* data, size_t count) const;
 
     virtual void generate_calls(const element::Type& type,
                                 const Node& op,
@@ -228,6 +389,15 @@ protected:
         case OP_TYPEID::Add:
         {
             const op::Add* add = static_cast<const op::Add*>(&node);
+            if (node.get_input_shape(0) == node.get_input_shape(1))
+            {
+                parallel_elementwise<T>(args[0]->get_data_ptr<const T>(),
+                                        args[1]->get_data_ptr<const T>(),
+                                        out[0]->get_data_ptr<T>(),
+                                        shape_size(node.get_input_shape(0)),
+                                        reference::add<T>);
+                break;
+            }
             reference::add<T>(args[0]->get_data_ptr<const T>(),
                               args[1]->get_data_ptr<const T>(),
                               out[0]->get_data_ptr<T>(),
@@ -246,6 +416,20 @@ protected:
                            all->get_reduction_axes());
             break;
         }
+        case OP_TYPEID::AllGather:
+        {
+            const ngraph::op::AllGather* all_gather =
+                static_cast<const ngraph::op::AllGather*>(&node);
+            NGRAPH_CHECK(all_gather->get_num_ranks() == get_distributed_interface()->get_size(),
+                         "AllGather expects ",
+                         all_gather->get_num_ranks(),
+                         " ranks");
+            reference::all_gather<T>(args[0]->get_data_ptr<T>(),
+                                     out[0]->get_data_ptr<T>(),
+                                     node.get_input_element_type(0),
+                                     shape_size(node.get_input_shape(0)));
+            break;
+        }
         case OP_TYPEID::AllReduce:
         {
             const ngraph::op::AllReduce* allreduce =
@@ -356,16 +540,36 @@ protected:
         case OP_TYPEID::AvgPool:
         {
             const op::AvgPool* avg_pool = static_cast<const op::AvgPool*>(&node);
+            const T* arg = args[0]->get_data_ptr<const T>();
+            T* result = out[0]->get_data_ptr<T>();
+            const Shape& arg_shape = node.get_input_shape(0);
+            const Shape& out_shape = node.get_output_shape(0);
+            size_t arg_batch_size = shape_size(arg_shape) / std::max<size_t>(arg_shape[0], 1);
+            size_t out_batch_size = shape_size(out_shape) / std::max<size_t>(out_shape[0], 1);
 
-            reference::avg_pool<T>(args[0]->get_data_ptr<const T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   node.get_input_shape(0),
-                                   node.get_output_shape(0),
-                                   avg_pool->get_window_shape(),
-                                   avg_pool->get_window_movement_strides(),
-                                   avg_pool->get_padding_below(),
-                                   avg_pool->get_padding_above(),
-                                   avg_pool->get_include_padding_in_avg_computation());
+            parallel_for(
+                arg_shape[0],
+                out_batch_size * shape_size(avg_pool->get_window_shape()),
+                [&](size_t begin, size_t end) {
+                    reference::avg_pool<T>(arg + begin * arg_batch_size,
+                                           result + begin * out_batch_size,
+                                           with_leading_dim(arg_shape, end - begin),
+                                           with_leading_dim(out_shape, end - begin),
+                                           avg_pool->get_window_shape(),
+                                           avg_pool->get_window_movement_strides(),
+                                           avg_pool->get_padding_below(),
+                                           avg_pool->get_padding_above(),
+                                           avg_pool->get_include_padding_in_avg_computation());
+                });
+            break;
+        }
+        case OP_TYPEID::Gelu:
+        {
+            size_t element_count = shape_size(node.get_output_shape(0));
+            parallel_elementwise<T>(args[0]->get_data_ptr<const T>(),
+                                    out[0]->get_data_ptr<T>(),
+                                    element_count,
+                                    reference::gelu<T>);
             break;
         }
         case OP_TYPEID::GenerateMask:
@@ -479,11 +683,12 @@ protected:
             Shape in_shape = node.get_input_shape(0);
             Shape out_shape = node.get_output_shape(0);
             AxisSet broadcast_axes = broadcast->get_broadcast_axes();
-            reference::broadcast<T>(args[0]->get_data_ptr<const T>(),
-                                    out[0]->get_data_ptr<T>(),
-                                    in_shape,
-                                    out_shape,
-                                    broadcast_axes);
+            opt_kernel::broadcast<T>(args[0]->get_data_ptr<const T>(),
+                                     out[0]->get_data_ptr<T>(),
+                                     in_shape,
+                                     out_shape,
+                                     broadcast_axes,
+                                     kernel_parallel_for());
             break;
         }
         case OP_TYPEID::BroadcastDistributed:
@@ -531,11 +736,12 @@ protected:
                 in_args.push_back(args[i]->get_data_ptr<const T>());
                 in_shapes.push_back(node.get_input_shape(i));
             }
-            reference::concat<T>(in_args,
-                                 out[0]->get_data_ptr<T>(),
-                                 in_shapes,
-                                 node.get_output_shape(0),
-                                 concat->get_concatenation_axis());
+            opt_kernel::concat<T>(in_args,
+                                  out[0]->get_data_ptr<T>(),
+                                  in_shapes,
+                                  node.get_output_shape(0),
+                                  concat->get_concatenation_axis(),
+                                  kernel_parallel_for());
             break;
         }
         case OP_TYPEID::Constant:
@@ -619,36 +825,49 @@ protected:
         case OP_TYPEID::Convolution:
         {
             const op::Convolution* c = static_cast<const op::Convolution*>(&node);
-            reference::convolution<T>(args[0]->get_data_ptr<const T>(),
-                                      args[1]->get_data_ptr<const T>(),
-                                      out[0]->get_data_ptr<T>(),
-                                      node.get_input_shape(0),
-                                      node.get_input_shape(1),
-                                      node.get_output_shape(0),
-                                      c->get_window_movement_strides(),
-                                      c->get_window_dilation_strides(),
-                                      c->get_padding_below(),
-                                      c->get_padding_above(),
-                                      c->get_data_dilation_strides());
+            const T* data = args[0]->get_data_ptr<const T>();
+            const T* filters = args[1]->get_data_ptr<const T>();
+            T* result = out[0]->get_data_ptr<T>();
+            const Shape& data_shape = node.get_input_shape(0);
+            const Shape& filters_shape = node.get_input_shape(1);
+            const Shape& out_shape = node.get_output_shape(0);
+            size_t data_batch_size = shape_size(data_shape) / std::max<size_t>(data_shape[0], 1);
+            size_t out_batch_size = shape_size(out_shape) / std::max<size_t>(out_shape[0], 1);
+            size_t filter_size = shape_size(filters_shape) / std::max<size_t>(filters_shape[0], 1);
 
+            // Images of the batch are independent
+            parallel_for(data_shape[0],
+                         out_batch_size * filter_size,
+                         [&](size_t begin, size_t end) {
+                             reference::convolution<T>(data + begin * data_batch_size,
+                                                       filters,
+                                                       result + begin * out_batch_size,
+                                                       with_leading_dim(data_shape, end - begin),
+                                                       filters_shape,
+                                                       with_leading_dim(out_shape, end - begin),
+                                                       c->get_window_movement_strides(),
+                                                       c->get_window_dilation_strides(),
+                                                       c->get_padding_below(),
+                                                       c->get_padding_above(),
+                                                       c->get_data_dilation_strides());
+                         });
             break;
         }
         case OP_TYPEID::ConvolutionBackpropFilters:
         {
             const op::ConvolutionBackpropFilters* c =
                 static_cast<const op::ConvolutionBackpropFilters*>(&node);
-            reference::convolution_backprop_filter<T>(
-                args[0]->get_data_ptr<const T>(), // input
-                args[1]->get_data_ptr<const T>(), // delta_convolution_output
-                out[0]->get_data_ptr<T>(),        // delta_filter
-                c->get_input_shape(0),            // input_shape
-                c->get_input_shape(1),            // convolution_output_shape
-                c->get_filters_shape(),           // filter_shape
-                c->get_window_dilation_strides_forward(),
-                c->get_window_movement_strides_forward(),
-                c->get_padding_below_forward(),
-                c->compute_backward_in_pad_above(),
-                c->get_data_dilation_strides_forward());
+            opt_kernel::convolution_backprop_filter<T>(args[0]->get_data_ptr<const T>(),
+                                                       args[1]->get_data_ptr<const T>(),
+                                                       out[0]->get_data_ptr<T>(),
+                                                       c->get_input_shape(0),
+                                                       c->get_input_shape(1),
+                                                       c->get_filters_shape(),
+                                                       c->get_window_movement_strides_forward(),
+                                                       c->get_window_dilation_strides_forward(),
+                                                       c->get_padding_below_forward(),
+                                                       c->get_data_dilation_strides_forward(),
+                                                       kernel_parallel_for());
             break;
         }
         case OP_TYPEID::ConvolutionBackpropData:
@@ -656,17 +875,17 @@ protected:
             // Note that args[1] and args[0] are switched here from the usual order.
             const op::ConvolutionBackpropData* c =
                 static_cast<const op::ConvolutionBackpropData*>(&node);
-            reference::convolution_backprop_in<T>(args[1]->get_data_ptr<const T>(),
-                                                  args[0]->get_data_ptr<const T>(),
-                                                  out[0]->get_data_ptr<T>(),
-                                                  c->get_input_shape(1),
-                                                  c->get_input_shape(0),
-                                                  c->get_data_batch_shape(),
-                                                  c->get_data_dilation_strides_forward(),
-                                                  c->get_window_dilation_strides_forward(),
-                                                  c->compute_backward_delta_out_pad_below(),
-                                                  c->compute_backward_delta_out_pad_above(),
-                                                  c->get_window_movement_strides_forward());
+            opt_kernel::convolution_backprop_in<T>(args[1]->get_data_ptr<const T>(),
+                                                   args[0]->get_data_ptr<const T>(),
+                                                   out[0]->get_data_ptr<T>(),
+                                                   c->get_input_shape(1),
+                                                   c->get_input_shape(0),
+                                                   c->get_data_batch_shape(),
+                                                   c->get_window_movement_strides_forward(),
+                                                   c->get_window_dilation_strides_forward(),
+                                                   c->get_padding_below_forward(),
+                                                   c->get_data_dilation_strides_forward(),
+                                                   kernel_parallel_for());
             break;
         }
         case OP_TYPEID::Cos:
@@ -689,21 +908,23 @@ protected:
             auto axis_et = node.get_input_element_type(1);
             if (axis_et == element::i32)
             {
-                reference::cumsum<T, int32_t>(args[0]->get_data_ptr<const T>(),
-                                              args[1]->get_data_ptr<const int32_t>(),
-                                              out[0]->get_data_ptr<T>(),
-                                              node.get_input_shape(0),
-                                              cumsum->is_exclusive(),
-                                              cumsum->is_reverse());
+                opt_kernel::cumsum<T, int32_t>(args[0]->get_data_ptr<const T>(),
+                                               args[1]->get_data_ptr<const int32_t>(),
+                                               out[0]->get_data_ptr<T>(),
+                                               node.get_input_shape(0),
+                                               cumsum->is_exclusive(),
+                                               cumsum->is_reverse(),
+                                               kernel_parallel_for());
             }
             else if (axis_et == element::i64)
             {
-                reference::cumsum<T, int64_t>(args[0]->get_data_ptr<const T>(),
-                                              args[1]->get_data_ptr<const int64_t>(),
-                                              out[0]->get_data_ptr<T>(),
-                                              node.get_input_shape(0),
-                                              cumsum->is_exclusive(),
-                                              cumsum->is_reverse());
+                opt_kernel::cumsum<T, int64_t>(args[0]->get_data_ptr<const T>(),
+                                               args[1]->get_data_ptr<const int64_t>(),
+                                               out[0]->get_data_ptr<T>(),
+                                               node.get_input_shape(0),
+                                               cumsum->is_exclusive(),
+                                               cumsum->is_reverse(),
+                                               kernel_parallel_for());
             }
             break;
         }
@@ -749,9 +970,26 @@ protected:
         case OP_TYPEID::Divide:
         {
             const op::Divide* divop = static_cast<const op::Divide*>(&node);
-            reference::divide<T>(args[0]->get_data_ptr<const T>(),
-                                 args[1]->get_data_ptr<const T>(),
-                                 out[0]->get_data_ptr<T>(),
+            const T* arg0 = args[0]->get_data_ptr<const T>();
+            const T* arg1 = args[1]->get_data_ptr<const T>();
+            T* result = out[0]->get_data_ptr<T>();
+            if (node.get_input_shape(0) == node.get_input_shape(1))
+            {
+                bool pythondiv = divop->is_pythondiv();
+                parallel_for(shape_size(node.get_input_shape(0)), 1, [&](size_t begin, size_t end) {
+                    reference::divide<T>(arg0 + begin,
+                                         arg1 + begin,
+                                         result + begin,
+                                         Shape{end - begin},
+                                         Shape{end - begin},
+                                         op::AutoBroadcastSpec::NONE,
+                                         pythondiv);
+                });
+                break;
+            }
+            reference::divide<T>(arg0,
+                                 arg1,
+                                 result,
                                  node.get_input_shape(0),
                                  node.get_input_shape(1),
                                  divop->get_autob(),
@@ -761,14 +999,35 @@ protected:
         case OP_TYPEID::Dot:
         {
             const op::Dot* dot = static_cast<const op::Dot*>(&node);
+            const T* arg0 = args[0]->get_data_ptr<const T>();
+            const T* arg1 = args[1]->get_data_ptr<const T>();
+            T* result = out[0]->get_data_ptr<T>();
+            const Shape& arg0_shape = node.get_input_shape(0);
+            const Shape& arg1_shape = node.get_input_shape(1);
+            const Shape& out_shape = node.get_output_shape(0);
+            size_t reduction_axes_count = dot->get_reduction_axes_count();
 
-            reference::dot(args[0]->get_data_ptr<const T>(),
-                           args[1]->get_data_ptr<const T>(),
-                           out[0]->get_data_ptr<T>(),
-                           node.get_input_shape(0),
-                           node.get_input_shape(1),
-                           node.get_output_shape(0),
-                           dot->get_reduction_axes_count());
+            // The leading axis of arg0 is not dotted, so its rows produce contiguous rows of
+            // the result
+            if (arg0_shape.size() > reduction_axes_count && shape_size(arg0_shape) > 0)
+            {
+                size_t arg0_row_size = shape_size(arg0_shape) / arg0_shape[0];
+                size_t out_row_size = shape_size(out_shape) / out_shape[0];
+                parallel_for(arg0_shape[0],
+                             arg0_row_size * out_row_size,
+                             [&](size_t begin, size_t end) {
+                                 reference::dot(arg0 + begin * arg0_row_size,
+                                                arg1,
+                                                result + begin * out_row_size,
+                                                with_leading_dim(arg0_shape, end - begin),
+                                                arg1_shape,
+                                                with_leading_dim(out_shape, end - begin),
+                                                reduction_axes_count);
+                             });
+                break;
+            }
+            reference::dot(
+                arg0, arg1, result, arg0_shape, arg1_shape, out_shape, reduction_axes_count);
             break;
         }
         case OP_TYPEID::DynReshape:
@@ -840,15 +1099,19 @@ protected:
         case OP_TYPEID::Erf:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::erf<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            parallel_elementwise<T>(args[0]->get_data_ptr<const T>(),
+                                    out[0]->get_data_ptr<T>(),
+                                    element_count,
+                                    reference::erf<T>);
             break;
         }
         case OP_TYPEID::Exp:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::exp<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            parallel_elementwise<T>(args[0]->get_data_ptr<const T>(),
+                                    out[0]->get_data_ptr<T>(),
+                                    element_count,
+                                    reference::exp<T>);
             break;
         }
 #ifdef INTERPRETER_USE_HYBRID
@@ -996,8 +1259,10 @@ protected:
         case OP_TYPEID::Log:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::log<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            parallel_elementwise<T>(args[0]->get_data_ptr<const T>(),
+                                    out[0]->get_data_ptr<T>(),
+                                    element_count,
+                                    reference::log<T>);
             break;
         }
         case OP_TYPEID::LogicalAnd_v1:
@@ -1049,16 +1314,26 @@ protected:
         case OP_TYPEID::Max:
         {
             const op::Max* max = static_cast<const op::Max*>(&node);
-            reference::max<T>(args[0]->get_data_ptr<const T>(),
-                              out[0]->get_data_ptr<T>(),
-                              node.get_input_shape(0),
-                              node.get_output_shape(0),
-                              max->get_reduction_axes());
+            parallel_reduction<T>(args[0]->get_data_ptr<const T>(),
+                                  out[0]->get_data_ptr<T>(),
+                                  node.get_input_shape(0),
+                                  node.get_output_shape(0),
+                                  max->get_reduction_axes(),
+                                  reference::max<T>);
             break;
         }
         case OP_TYPEID::Maximum:
         {
             auto maximum = static_cast<const op::Maximum*>(&node);
+            if (node.get_input_shape(0) == node.get_input_shape(1))
+            {
+                parallel_elementwise<T>(args[0]->get_data_ptr<const T>(),
+                                        args[1]->get_data_ptr<const T>(),
+                                        out[0]->get_data_ptr<T>(),
+                                        shape_size(node.get_input_shape(0)),
+                                        reference::maximum<T>);
+                break;
+            }
             reference::maximum<T>(args[0]->get_data_ptr<const T>(),
                                   args[1]->get_data_ptr<const T>(),
                                   out[0]->get_data_ptr<T>(),
@@ -1070,15 +1345,25 @@ protected:
         case OP_TYPEID::MaxPool:
         {
             const op::MaxPool* max_pool = static_cast<const op::MaxPool*>(&node);
+            const T* arg = args[0]->get_data_ptr<const T>();
+            T* result = out[0]->get_data_ptr<T>();
+            const Shape& arg_shape = node.get_input_shape(0);
+            const Shape& out_shape = node.get_output_shape(0);
+            size_t arg_batch_size = shape_size(arg_shape) / std::max<size_t>(arg_shape[0], 1);
+            size_t out_batch_size = shape_size(out_shape) / std::max<size_t>(out_shape[0], 1);
 
-            reference::max_pool<T>(args[0]->get_data_ptr<const T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   node.get_input_shape(0),
-                                   node.get_output_shape(0),
-                                   max_pool->get_window_shape(),
-                                   max_pool->get_window_movement_strides(),
-                                   max_pool->get_padding_below(),
-                                   max_pool->get_padding_above());
+            parallel_for(arg_shape[0],
+                         out_batch_size * shape_size(max_pool->get_window_shape()),
+                         [&](size_t begin, size_t end) {
+                             reference::max_pool<T>(arg + begin * arg_batch_size,
+                                                    result + begin * out_batch_size,
+                                                    with_leading_dim(arg_shape, end - begin),
+                                                    with_leading_dim(out_shape, end - begin),
+                                                    max_pool->get_window_shape(),
+                                                    max_pool->get_window_movement_strides(),
+                                                    max_pool->get_padding_below(),
+                                                    max_pool->get_padding_above());
+                         });
             break;
         }
         case OP_TYPEID::MaxPoolBackprop:
@@ -1100,16 +1385,26 @@ protected:
         case OP_TYPEID::Min:
         {
             const op::Min* min = static_cast<const op::Min*>(&node);
-            reference::min<T>(args[0]->get_data_ptr<const T>(),
-                              out[0]->get_data_ptr<T>(),
-                              node.get_input_shape(0),
-                              node.get_output_shape(0),
-                              min->get_reduction_axes());
+            parallel_reduction<T>(args[0]->get_data_ptr<const T>(),
+                                  out[0]->get_data_ptr<T>(),
+                                  node.get_input_shape(0),
+                                  node.get_output_shape(0),
+                                  min->get_reduction_axes(),
+                                  reference::min<T>);
             break;
         }
         case OP_TYPEID::Minimum:
         {
             auto minimum = static_cast<const op::Minimum*>(&node);
+            if (node.get_input_shape(0) == node.get_input_shape(1))
+            {
+                parallel_elementwise<T>(args[0]->get_data_ptr<const T>(),
+                                        args[1]->get_data_ptr<const T>(),
+                                        out[0]->get_data_ptr<T>(),
+                                        shape_size(node.get_input_shape(0)),
+                                        reference::minimum<T>);
+                break;
+            }
             reference::minimum<T>(args[0]->get_data_ptr<const T>(),
                                   args[1]->get_data_ptr<const T>(),
                                   out[0]->get_data_ptr<T>(),
@@ -1121,6 +1416,15 @@ protected:
         case OP_TYPEID::Multiply:
         {
             auto multiply = static_cast<const op::Multiply*>(&node);
+            if (node.get_input_shape(0) == node.get_input_shape(1))
+            {
+                parallel_elementwise<T>(args[0]->get_data_ptr<const T>(),
+                                        args[1]->get_data_ptr<const T>(),
+                                        out[0]->get_data_ptr<T>(),
+                                        shape_size(node.get_input_shape(0)),
+                                        reference::multiply<T>);
+                break;
+            }
             reference::multiply<T>(args[0]->get_data_ptr<const T>(),
                                    args[1]->get_data_ptr<const T>(),
                                    out[0]->get_data_ptr<T>(),
@@ -1186,6 +1490,18 @@ protected:
         {
             const op::Pad* pad = static_cast<const op::Pad*>(&node);
 
+            if (pad->get_pad_mode() == op::PadMode::CONSTANT)
+            {
+                opt_kernel::pad(args[0]->get_data_ptr<const T>(),
+                                args[1]->get_data_ptr<const T>(),
+                                out[0]->get_data_ptr<T>(),
+                                node.input(0).get_shape(),
+                                node.output(0).get_shape(),
+                                pad->get_padding_below(),
+                                pad->get_padding_above(),
+                                kernel_parallel_for());
+                break;
+            }
             reference::pad(args[0]->get_data_ptr<const T>(),
                            args[1]->get_data_ptr<const T>(),
                            out[0]->get_data_ptr<T>(),
@@ -1210,11 +1526,12 @@ protected:
         case OP_TYPEID::Product:
         {
             const op::Product* product = static_cast<const op::Product*>(&node);
-            reference::product<T>(args[0]->get_data_ptr<const T>(),
+            parallel_reduction<T>(args[0]->get_data_ptr<const T>(),
                                   out[0]->get_data_ptr<T>(),
                                   node.get_input_shape(0),
                                   node.get_output_shape(0),
-                                  product->get_reduction_axes());
+                                  product->get_reduction_axes(),
+                                  reference::product<T>);
             break;
         }
         case OP_TYPEID::Quantize:
@@ -1479,6 +1796,22 @@ protected:
             memcpy(out[0]->get_data_ptr<T>(), args[0]->get_data_ptr<T>(), memSize);
             break;
         }
+        case OP_TYPEID::ReduceScatter:
+        {
+            const ngraph::op::ReduceScatter* reduce_scatter =
+                static_cast<const ngraph::op::ReduceScatter*>(&node);
+            NGRAPH_CHECK(reduce_scatter->get_num_ranks() ==
+                             get_distributed_interface()->get_size(),
+                         "ReduceScatter expects ",
+                         reduce_scatter->get_num_ranks(),
+                         " ranks");
+            reference::reduce_scatter<T>(args[0]->get_data_ptr<T>(),
+                                         out[0]->get_data_ptr<T>(),
+                                         node.get_input_element_type(0),
+                                         reduce_scatter->get_reduce_type(),
+                                         shape_size(node.get_output_shape(0)));
+            break;
+        }
         case OP_TYPEID::RandomUniform:
         {
             const op::RandomUniform* ru = static_cast<const op::RandomUniform*>(&node);
@@ -1519,8 +1852,10 @@ protected:
         case OP_TYPEID::Relu:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::relu<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            parallel_elementwise<T>(args[0]->get_data_ptr<const T>(),
+                                    out[0]->get_data_ptr<T>(),
+                                    element_count,
+                                    reference::relu<T>);
             break;
         }
         case OP_TYPEID::ReluBackprop:
@@ -1535,24 +1870,26 @@ protected:
         case OP_TYPEID::ReplaceSlice:
         {
             const op::ReplaceSlice* slice = static_cast<const op::ReplaceSlice*>(&node);
-            reference::replace_slice<T>(args[0]->get_data_ptr<const T>(),
-                                        args[1]->get_data_ptr<const T>(),
-                                        out[0]->get_data_ptr<T>(),
-                                        node.get_input_shape(1),
-                                        slice->get_lower_bounds(),
-                                        slice->get_upper_bounds(),
-                                        slice->get_strides(),
-                                        node.get_output_shape(0));
+            opt_kernel::replace_slice<T>(args[0]->get_data_ptr<const T>(),
+                                         args[1]->get_data_ptr<const T>(),
+                                         out[0]->get_data_ptr<T>(),
+                                         node.get_input_shape(1),
+                                         slice->get_lower_bounds(),
+                                         slice->get_upper_bounds(),
+                                         slice->get_strides(),
+                                         node.get_output_shape(0),
+                                         kernel_parallel_for());
             break;
         }
         case OP_TYPEID::Reshape:
         {
             const op::Reshape* reshape = static_cast<const op::Reshape*>(&node);
-            reference::reshape(args[0]->get_data_ptr<const T>(),
-                               out[0]->get_data_ptr<T>(),
-                               node.get_input_shape(0),
-                               reshape->get_input_order(),
-                               node.get_output_shape(0));
+            opt_kernel::reshape(args[0]->get_data_ptr<const T>(),
+                                out[0]->get_data_ptr<T>(),
+                                node.get_input_shape(0),
+                                reshape->get_input_order(),
+                                node.get_output_shape(0),
+                                kernel_parallel_for());
             break;
         }
         case OP_TYPEID::Result:
@@ -1692,8 +2029,10 @@ protected:
         case OP_TYPEID::Sigmoid:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sigmoid<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            parallel_elementwise<T>(args[0]->get_data_ptr<const T>(),
+                                    out[0]->get_data_ptr<T>(),
+                                    element_count,
+                                    reference::sigmoid<T>);
             break;
         }
         case OP_TYPEID::SigmoidBackprop:
@@ -1729,13 +2068,14 @@ protected:
         case OP_TYPEID::Slice:
         {
             const op::Slice* slice = static_cast<const op::Slice*>(&node);
-            reference::slice<T>(args[0]->get_data_ptr<const T>(),
-                                out[0]->get_data_ptr<T>(),
-                                node.get_input_shape(0),
-                                slice->get_lower_bounds(),
-                                slice->get_upper_bounds(),
-                                slice->get_strides(),
-                                node.get_output_shape(0));
+            opt_kernel::slice<T>(args[0]->get_data_ptr<const T>(),
+                                 out[0]->get_data_ptr<T>(),
+                                 node.get_input_shape(0),
+                                 slice->get_lower_bounds(),
+                                 slice->get_upper_bounds(),
+                                 slice->get_strides(),
+                                 node.get_output_shape(0),
+                                 kernel_parallel_for());
             break;
         }
         case OP_TYPEID::Softmax:
@@ -1750,8 +2090,10 @@ protected:
         case OP_TYPEID::Sqrt:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sqrt<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            parallel_elementwise<T>(args[0]->get_data_ptr<const T>(),
+                                    out[0]->get_data_ptr<T>(),
+                                    element_count,
+                                    reference::sqrt<T>);
             break;
         }
         case OP_TYPEID::StopGradient: { throw unsupported_op("Unsupported op 'StopGradient'");
@@ -1759,6 +2101,15 @@ protected:
         case OP_TYPEID::Subtract:
         {
             auto subtract = static_cast<const op::Subtract*>(&node);
+            if (node.get_input_shape(0) == node.get_input_shape(1))
+            {
+                parallel_elementwise<T>(args[0]->get_data_ptr<const T>(),
+                                        args[1]->get_data_ptr<const T>(),
+                                        out[0]->get_data_ptr<T>(),
+                                        shape_size(node.get_input_shape(0)),
+                                        reference::subtract<T>);
+                break;
+            }
             reference::subtract<T>(args[0]->get_data_ptr<const T>(),
                                    args[1]->get_data_ptr<const T>(),
                                    out[0]->get_data_ptr<T>(),
@@ -1770,11 +2121,12 @@ protected:
         case OP_TYPEID::Sum:
         {
             const op::Sum* sum = static_cast<const op::Sum*>(&node);
-            reference::sum<T>(args[0]->get_data_ptr<const T>(),
-                              out[0]->get_data_ptr<T>(),
-                              node.get_input_shape(0),
-                              node.get_output_shape(0),
-                              sum->get_reduction_axes());
+            parallel_reduction<T>(args[0]->get_data_ptr<const T>(),
+                                  out[0]->get_data_ptr<T>(),
+                                  node.get_input_shape(0),
+                                  node.get_output_shape(0),
+                                  sum->get_reduction_axes(),
+                                  reference::sum<T>);
             break;
         }
         case OP_TYPEID::Tan:
@@ -1787,8 +2139,10 @@ protected:
         case OP_TYPEID::Tanh:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::tanh<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            parallel_elementwise<T>(args[0]->get_data_ptr<const T>(),
+                                    out[0]->get_data_ptr<T>(),
+                                    element_count,
+                                    reference::tanh<T>);
             break;
         }
         case OP_TYPEID::TopK:
@@ -1844,6 +2198,7 @@ protected:
         case OP_TYPEID::DynPad:
         case OP_TYPEID::Tile:
         case OP_TYPEID::DynReplaceSlice:
+        case OP_TYPEID::AdamUpdate:
         case OP_TYPEID::BatchMatMulTranspose:
         case OP_TYPEID::ConvolutionBias:
         case OP_TYPEID::ConvolutionBiasAdd:
@@ -1858,7 +2213,6 @@ protected:
         case OP_TYPEID::GroupConvolutionBackpropFilters:
         case OP_TYPEID::GRN:
         case OP_TYPEID::GRUCell:
-        case OP_TYPEID::Gelu:
         case OP_TYPEID::GeluBackpropFactor:
         case OP_TYPEID::Gemm:
         case OP_TYPEID::GroupConvolutionTranspose:
@@ -1874,6 +2228,7 @@ protected:
         case OP_TYPEID::PartialSlice:
         case OP_TYPEID::PartialSliceBackprop:
         case OP_TYPEID::RNNCell:
+        case OP_TYPEID::SGDMomentumUpdate:
         case OP_TYPEID::ScalarConstantLike:
         case OP_TYPEID::ScaleShift:
         case OP_TYPEID::ScatterND:
@@ -0,0 +1,155 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+
+#include "ngraph/runtime/interpreter/int_thread_pool.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::interpreter::INTThreadPool::INTThreadPool(size_t num_threads)
+{
+    for (size_t i = 1; i < num_threads; i++)
+    {
+        m_workers.emplace_back([this]() { worker_loop(); });
+    }
+}
+
+runtime::interpreter::INTThreadPool::~INTThreadPool()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_cv.notify_all();
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+size_t runtime::interpreter::INTThreadPool::get_default_num_threads()
+{
+    size_t num_threads = 1;
+    if (auto env = getenv("NGRAPH_INTERPRETER_THREADS"))
+    {
+        int value = atoi(env);
+        if (value > 0)
+        {
+            num_threads = static_cast<size_t>(value);
+        }
+    }
+    return num_threads;
+}
+
+void runtime::interpreter::INTThreadPool::worker_loop()
+{
+    while (true)
+    {
+        function<void()> task;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return m_stopping || !m_tasks.empty(); });
+            if (m_tasks.empty())
+            {
+                return;
+            }
+            task = move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+        task();
+    }
+}
+
+void runtime::interpreter::INTThreadPool::parallel_for(
+    size_t count, size_t min_chunk, const function<void(size_t begin, size_t end)>& f)
+{
+    min_chunk = max<size_t>(min_chunk, 1);
+    size_t num_chunks = min(get_num_threads(), count / min_chunk);
+    if (num_chunks < 2)
+    {
+        if (count > 0)
+        {
+            f(0, count);
+        }
+        return;
+    }
+
+    struct Loop
+    {
+        atomic<size_t> next_chunk{0};
+        size_t finished_chunks = 0;
+        std::mutex mutex;
+        condition_variable cv;
+        exception_ptr error;
+    };
+    auto loop = make_shared<Loop>();
+    size_t chunk_size = (count + num_chunks - 1) / num_chunks;
+
+    // Each participant claims chunks until none are left, so helpers that start late simply
+    // find the loop finished
+    auto run_chunks = [loop, &f, count, chunk_size, num_chunks]() {
+        size_t chunk;
+        while ((chunk = loop->next_chunk++) < num_chunks)
+        {
+            size_t begin = chunk * chunk_size;
+            size_t end = min(begin + chunk_size, count);
+            exception_ptr error;
+            try
+            {
+                if (begin < end)
+                {
+                    f(begin, end);
+                }
+            }
+            catch (...)
+            {
+                error = current_exception();
+            }
+            lock_guard<std::mutex> lock(loop->mutex);
+            if (error && !loop->error)
+            {
+                loop->error = error;
+            }
+            if (++loop->finished_chunks == num_chunks)
+            {
+                loop->cv.notify_all();
+            }
+        }
+    };
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        for (size_t i = 1; i < num_chunks; i++)
+        {
+            m_tasks.push_back(run_chunks);
+        }
+    }
+    m_cv.notify_all();
+    run_chunks();
+
+    unique_lock<std::mutex> lock(loop->mutex);
+    loop->cv.wait(lock, [&loop, num_chunks]() { return loop->finished_chunks == num_chunks; });
+    if (loop->error)
+    {
+        rethrow_exception(loop->error);
+    }
+}
@@ -0,0 +1,72 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace interpreter
+        {
+            class INTThreadPool;
+        }
+    }
+}
+
+/// \brief Fixed-size worker pool used to split the heavy interpreter kernels.
+///
+/// The thread calling `parallel_for` always works on its own loop, so the pool may be shared
+/// by executables that run concurrently, and a loop never waits for a worker to become free.
+class ngraph::runtime::interpreter::INTThreadPool
+{
+public:
+    /// \param num_threads the total parallelism including the calling thread; 1 runs every
+    ///        loop inline
+    INTThreadPool(size_t num_threads);
+    ~INTThreadPool();
+    INTThreadPool(const INTThreadPool&) = delete;
+    INTThreadPool& operator=(const INTThreadPool&) = delete;
+
+    /// \brief Calls `f(begin, end)` on disjoint ranges covering [0, count) and returns once
+    ///        all of them have finished. Ranges span at least `min_chunk` items, so loops
+    ///        shorter than two chunks run inline. The first exception thrown by `f` is
+    ///        rethrown.
+    void parallel_for(size_t count,
+                      size_t min_chunk,
+                      const std::function<void(size_t begin, size_t end)>& f);
+
+    size_t get_num_threads() const { return m_workers.size() + 1; }
+    /// \returns the thread count from NGRAPH_INTERPRETER_THREADS, or 1 if it is not set
+    static size_t get_default_num_threads();
+
+private:
+    void worker_loop();
+
+    std::vector<std::thread> m_workers;
+    std::deque<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_stopping = false;
+};
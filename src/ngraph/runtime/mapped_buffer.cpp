@@ -0,0 +1,122 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/mapped_buffer.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#ifdef _WIN32
+runtime::MappedFile::MappedFile(const string& path)
+    : m_path(path)
+    , m_data(nullptr)
+    , m_size(0)
+    , m_mapping(nullptr)
+{
+    HANDLE file = CreateFileA(path.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw ngraph_error("Unable to open '" + path + "' for mapping");
+    }
+    LARGE_INTEGER file_size;
+    if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0)
+    {
+        m_size = static_cast<size_t>(file_size.QuadPart);
+        m_mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (m_mapping)
+        {
+            m_data = static_cast<char*>(MapViewOfFile(m_mapping, FILE_MAP_COPY, 0, 0, 0));
+        }
+    }
+    CloseHandle(file);
+    if (m_data == nullptr)
+    {
+        if (m_mapping)
+        {
+            CloseHandle(m_mapping);
+        }
+        throw ngraph_error("Unable to map '" + path + "'");
+    }
+}
+
+runtime::MappedFile::~MappedFile()
+{
+    UnmapViewOfFile(m_data);
+    CloseHandle(m_mapping);
+}
+#else
+runtime::MappedFile::MappedFile(const string& path)
+    : m_path(path)
+    , m_data(nullptr)
+    , m_size(0)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw ngraph_error("Unable to open '" + path + "' for mapping");
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        m_size = static_cast<size_t>(st.st_size);
+        // Writable private mapping so a stray write copies the page instead of faulting
+        void* data = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED)
+        {
+            m_data = static_cast<char*>(data);
+        }
+    }
+    close(fd);
+    if (m_data == nullptr)
+    {
+        throw ngraph_error("Unable to map '" + path + "'");
+    }
+}
+
+runtime::MappedFile::~MappedFile()
+{
+    munmap(m_data, m_size);
+}
+#endif
+
+runtime::MappedBuffer::MappedBuffer(const shared_ptr<MappedFile>& file,
+                                    size_t offset,
+                                    size_t byte_size)
+    : m_file(file)
+{
+    if (offset > m_file->size() || byte_size > m_file->size() - offset)
+    {
+        throw ngraph_error("Mapped region is outside of '" + m_file->get_path() + "'");
+    }
+    m_aligned_buffer = m_file->get_ptr() + offset;
+    m_byte_size = byte_size;
+}
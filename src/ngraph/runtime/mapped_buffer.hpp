@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "ngraph/ngraph_visibility.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class MappedFile;
+        class MappedBuffer;
+    }
+}
+
+/// \brief A whole file mapped into memory.
+///
+/// The mapping is private and copy-on-write: pages are read from the file lazily on first
+/// access and, until written to, are shared through the page cache with every other process
+/// mapping the same file. The file must not be modified while it is mapped.
+class NGRAPH_API ngraph::runtime::MappedFile
+{
+public:
+    /// \brief Maps `path`. Throws ngraph_error if the file can not be opened or mapped.
+    MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const std::string& get_path() const { return m_path; }
+    size_t size() const { return m_size; }
+    char* get_ptr() const { return m_data; }
+private:
+    std::string m_path;
+    char* m_data;
+    size_t m_size;
+#ifdef _WIN32
+    void* m_mapping;
+#endif
+};
+
+/// \brief An AlignedBuffer viewing a region of a MappedFile, used to back Constants with
+/// file data without copying it. The buffer keeps the file mapped for as long as it lives.
+///
+/// The region is used in place, so its alignment is that of `offset` within the file.
+class NGRAPH_API ngraph::runtime::MappedBuffer : public ngraph::runtime::AlignedBuffer
+{
+public:
+    MappedBuffer(const std::shared_ptr<MappedFile>& file, size_t offset, size_t byte_size);
+
+    MappedBuffer(const MappedBuffer&) = delete;
+    MappedBuffer& operator=(const MappedBuffer&) = delete;
+
+    const std::shared_ptr<MappedFile>& get_file() const { return m_file; }
+private:
+    std::shared_ptr<MappedFile> m_file;
+};
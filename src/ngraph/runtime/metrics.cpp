@@ -0,0 +1,244 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/metrics.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::metrics::Histogram::Histogram(const vector<double>& bounds)
+    : m_bounds(bounds)
+    , m_buckets(new atomic<uint64_t>[bounds.size() + 1])
+{
+    if (!is_sorted(m_bounds.begin(), m_bounds.end()))
+    {
+        throw ngraph_error("Histogram bounds must be in ascending order");
+    }
+    for (size_t i = 0; i <= m_bounds.size(); i++)
+    {
+        m_buckets[i] = 0;
+    }
+}
+
+void runtime::metrics::Histogram::observe(double value)
+{
+    size_t bucket = lower_bound(m_bounds.begin(), m_bounds.end(), value) - m_bounds.begin();
+    m_buckets[bucket].fetch_add(1, memory_order_relaxed);
+    double sum = m_sum.load(memory_order_relaxed);
+    while (!m_sum.compare_exchange_weak(sum, sum + value, memory_order_relaxed))
+    {
+    }
+    m_count.fetch_add(1, memory_order_relaxed);
+}
+
+vector<uint64_t> runtime::metrics::Histogram::get_cumulative_counts() const
+{
+    vector<uint64_t> counts(m_bounds.size() + 1);
+    uint64_t total = 0;
+    for (size_t i = 0; i < counts.size(); i++)
+    {
+        total += m_buckets[i].load(memory_order_relaxed);
+        counts[i] = total;
+    }
+    return counts;
+}
+
+vector<double> runtime::metrics::Histogram::get_default_latency_bounds()
+{
+    vector<double> bounds;
+    for (double decade = 1e-5; decade < 10; decade *= 10)
+    {
+        bounds.push_back(decade);
+        bounds.push_back(decade * 2.5);
+        bounds.push_back(decade * 5);
+    }
+    bounds.push_back(10);
+    return bounds;
+}
+
+runtime::metrics::Registry& runtime::metrics::Registry::get_default()
+{
+    // Never destroyed so that metrics can be updated from static destructors
+    static Registry* s_registry = new Registry();
+    return *s_registry;
+}
+
+runtime::metrics::Registry::Family& runtime::metrics::Registry::get_family(const string& name,
+                                                                          const string& help,
+                                                                          Type type)
+{
+    auto it = m_families.find(name);
+    if (it == m_families.end())
+    {
+        it = m_families.insert(make_pair(name, Family{type, help, {}, {}, {}})).first;
+    }
+    else if (it->second.type != type)
+    {
+        throw ngraph_error("Metric '" + name + "' is already registered with another type");
+    }
+    return it->second;
+}
+
+runtime::metrics::Counter& runtime::metrics::Registry::get_counter(const string& name,
+                                                                   const string& help,
+                                                                   const string& labels)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto& metric = get_family(name, help, Type::COUNTER).counters[labels];
+    if (!metric)
+    {
+        metric.reset(new Counter());
+    }
+    return *metric;
+}
+
+runtime::metrics::Gauge& runtime::metrics::Registry::get_gauge(const string& name,
+                                                               const string& help,
+                                                               const string& labels)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto& metric = get_family(name, help, Type::GAUGE).gauges[labels];
+    if (!metric)
+    {
+        metric.reset(new Gauge());
+    }
+    return *metric;
+}
+
+runtime::metrics::Histogram& runtime::metrics::Registry::get_histogram(
+    const string& name, const string& help, const string& labels, const vector<double>& bounds)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto& metric = get_family(name, help, Type::HISTOGRAM).histograms[labels];
+    if (!metric)
+    {
+        metric.reset(new Histogram(bounds));
+    }
+    return *metric;
+}
+
+static string with_labels(const string& name, const string& labels, const string& extra = "")
+{
+    string all = labels.empty() ? extra : (extra.empty() ? labels : labels + "," + extra);
+    return all.empty() ? name : name + "{" + all + "}";
+}
+
+void runtime::metrics::Registry::write_prometheus(ostream& out) const
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto precision = out.precision(numeric_limits<double>::max_digits10);
+    for (auto& named_family : m_families)
+    {
+        const string& name = named_family.first;
+        const Family& family = named_family.second;
+        out << "# HELP " << name << " " << family.help << "\n";
+        switch (family.type)
+        {
+        case Type::COUNTER:
+            out << "# TYPE " << name << " counter\n";
+            for (auto& metric : family.counters)
+            {
+                out << with_labels(name, metric.first) << " " << metric.second->get_value()
+                    << "\n";
+            }
+            break;
+        case Type::GAUGE:
+            out << "# TYPE " << name << " gauge\n";
+            for (auto& metric : family.gauges)
+            {
+                out << with_labels(name, metric.first) << " " << metric.second->get_value()
+                    << "\n";
+            }
+            break;
+        case Type::HISTOGRAM:
+            out << "# TYPE " << name << " histogram\n";
+            for (auto& metric : family.histograms)
+            {
+                const Histogram& histogram = *metric.second;
+                auto& bounds = histogram.get_bounds();
+                auto counts = histogram.get_cumulative_counts();
+                for (size_t i = 0; i < counts.size(); i++)
+                {
+                    ostringstream le;
+                    le << "le=\"";
+                    if (i < bounds.size())
+                    {
+                        le << bounds[i];
+                    }
+                    else
+                    {
+                        le << "+Inf";
+                    }
+                    le << "\"";
+                    out << with_labels(name + "_bucket", metric.first, le.str()) << " "
+                        << counts[i] << "\n";
+                }
+                out << with_labels(name + "_sum", metric.first) << " " << histogram.get_sum()
+                    << "\n";
+                out << with_labels(name + "_count", metric.first) << " "
+                    << histogram.get_count() << "\n";
+            }
+            break;
+        }
+    }
+    out.precision(precision);
+}
+
+void runtime::metrics::record_allocation(size_t bytes)
+{
+    static Gauge& s_bytes = Registry::get_default().get_gauge(
+        "ngraph_allocated_bytes", "Bytes currently held by tensor and buffer allocations");
+    static Counter& s_allocations =
+        Registry::get_default().get_counter("ngraph_allocations_total", "Allocations made");
+    s_bytes.add(static_cast<int64_t>(bytes));
+    s_allocations.increment();
+}
+
+void runtime::metrics::record_free(size_t bytes)
+{
+    static Gauge& s_bytes = Registry::get_default().get_gauge(
+        "ngraph_allocated_bytes", "Bytes currently held by tensor and buffer allocations");
+    s_bytes.add(-static_cast<int64_t>(bytes));
+}
+
+static string backend_label(const string& backend)
+{
+    return "backend=\"" + backend + "\"";
+}
+
+runtime::metrics::BackendMetrics::BackendMetrics(const string& backend)
+    : calls(Registry::get_default().get_counter(
+          "ngraph_executable_calls_total", "Executable::call invocations", backend_label(backend)))
+    , call_seconds(Registry::get_default().get_histogram("ngraph_executable_call_seconds",
+                                                         "Executable::call latency in seconds",
+                                                         backend_label(backend)))
+    , compile_seconds(Registry::get_default().get_histogram(
+          "ngraph_compile_seconds", "Backend::compile latency in seconds", backend_label(backend)))
+    , executable_cache_hits(Registry::get_default().get_counter(
+          "ngraph_executable_cache_hits_total",
+          "Compiles answered from the backend's executable cache",
+          backend_label(backend)))
+    , executable_cache_misses(Registry::get_default().get_counter(
+          "ngraph_executable_cache_misses_total",
+          "Compiles not found in the backend's executable cache",
+          backend_label(backend)))
+{
+}
@@ -0,0 +1,202 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// In-process metrics describing what nGraph is doing, for export to monitoring
+        /// systems. Metrics are always on and cheap to update: updates are lock-free and
+        /// instrumented code looks its metrics up once and keeps the references.
+        namespace metrics
+        {
+            class Counter;
+            class Gauge;
+            class Histogram;
+            class ScopedTimer;
+            class Registry;
+            struct BackendMetrics;
+
+            /// \brief Account for a tensor or buffer allocation of `bytes` in the default
+            ///        registry
+            NGRAPH_API void record_allocation(size_t bytes);
+            /// \brief Account for freeing an allocation previously passed to
+            ///        record_allocation
+            NGRAPH_API void record_free(size_t bytes);
+        }
+    }
+}
+
+/// \brief A monotonically increasing count, such as the number of calls
+class NGRAPH_API ngraph::runtime::metrics::Counter
+{
+public:
+    void increment(uint64_t n = 1) { m_value.fetch_add(n, std::memory_order_relaxed); }
+    uint64_t get_value() const { return m_value.load(std::memory_order_relaxed); }
+private:
+    std::atomic<uint64_t> m_value{0};
+};
+
+/// \brief A value that can go up and down, such as the number of bytes currently allocated
+class NGRAPH_API ngraph::runtime::metrics::Gauge
+{
+public:
+    void add(int64_t n) { m_value.fetch_add(n, std::memory_order_relaxed); }
+    void set(int64_t n) { m_value.store(n, std::memory_order_relaxed); }
+    int64_t get_value() const { return m_value.load(std::memory_order_relaxed); }
+private:
+    std::atomic<int64_t> m_value{0};
+};
+
+/// \brief Counts observations in buckets with fixed upper bounds, such as call latencies
+class NGRAPH_API ngraph::runtime::metrics::Histogram
+{
+public:
+    /// \param bounds Ascending upper bounds of the buckets. Observations above the last bound
+    ///        are only counted in the implicit +Inf bucket.
+    explicit Histogram(const std::vector<double>& bounds);
+
+    void observe(double value);
+
+    const std::vector<double>& get_bounds() const { return m_bounds; }
+    /// \returns the number of observations less than or equal to each bound, followed by the
+    ///          total number of observations
+    std::vector<uint64_t> get_cumulative_counts() const;
+    uint64_t get_count() const { return m_count.load(std::memory_order_relaxed); }
+    double get_sum() const { return m_sum.load(std::memory_order_relaxed); }
+    /// \brief Bounds of 1, 2.5 and 5 per decade from 10us to 10s, suited to latencies in
+    ///        seconds
+    static std::vector<double> get_default_latency_bounds();
+
+private:
+    std::vector<double> m_bounds;
+    std::unique_ptr<std::atomic<uint64_t>[]> m_buckets;
+    std::atomic<uint64_t> m_count{0};
+    std::atomic<double> m_sum{0};
+};
+
+/// \brief Observes the seconds between construction and destruction in a histogram, so the
+///        time is recorded whether the scope exits normally or by an exception
+class NGRAPH_API ngraph::runtime::metrics::ScopedTimer
+{
+public:
+    explicit ScopedTimer(Histogram& histogram)
+        : m_histogram(histogram)
+        , m_start(std::chrono::steady_clock::now())
+    {
+    }
+    ~ScopedTimer()
+    {
+        m_histogram.observe(
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count());
+    }
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Histogram& m_histogram;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+/// \brief Owns named metrics and writes them in the Prometheus text exposition format.
+///
+/// A metric is identified by its name and an optional label set written in Prometheus syntax
+/// without braces, e.g. `backend="CPU"`. Getting a metric that already exists returns the same
+/// object, which lives as long as the registry. Asking for an existing name with a different
+/// metric type throws.
+///
+/// nGraph updates the registry returned by get_default():
+///   - ngraph_executable_calls_total, ngraph_executable_call_seconds: Executable::call, by
+///     backend
+///   - ngraph_compile_seconds, ngraph_executable_cache_{hits,misses}_total: Backend::compile,
+///     by backend
+///   - ngraph_compile_cache_{hits,misses}_total: the on-disk CompileCache
+///   - ngraph_allocated_bytes, ngraph_allocations_total: AlignedBuffer and HostTensor
+///     allocations
+///   - ngraph_cpu_contexts, ngraph_cpu_contexts_busy, ngraph_cpu_context_wait_seconds: the
+///     runtime contexts of CPU call frames
+class NGRAPH_API ngraph::runtime::metrics::Registry
+{
+public:
+    /// \brief The process-wide registry updated by nGraph
+    static Registry& get_default();
+
+    Counter& get_counter(const std::string& name,
+                         const std::string& help,
+                         const std::string& labels = "");
+    Gauge& get_gauge(const std::string& name,
+                     const std::string& help,
+                     const std::string& labels = "");
+    /// \param bounds Bucket bounds, only used when the histogram is created
+    Histogram& get_histogram(const std::string& name,
+                             const std::string& help,
+                             const std::string& labels = "",
+                             const std::vector<double>& bounds =
+                                 Histogram::get_default_latency_bounds());
+
+    /// \brief Write every metric in the Prometheus text exposition format
+    void write_prometheus(std::ostream& out) const;
+
+private:
+    enum class Type
+    {
+        COUNTER,
+        GAUGE,
+        HISTOGRAM
+    };
+    struct Family
+    {
+        Type type;
+        std::string help;
+        std::map<std::string, std::unique_ptr<Counter>> counters;
+        std::map<std::string, std::unique_ptr<Gauge>> gauges;
+        std::map<std::string, std::unique_ptr<Histogram>> histograms;
+    };
+
+    Family& get_family(const std::string& name, const std::string& help, Type type);
+
+    mutable std::mutex m_mutex;
+    std::map<std::string, Family> m_families;
+};
+
+/// \brief The call and compile metrics of one backend in the default registry, labelled with
+///        the backend name
+struct NGRAPH_API ngraph::runtime::metrics::BackendMetrics
+{
+    explicit BackendMetrics(const std::string& backend);
+
+    Counter& calls;
+    Histogram& call_seconds;
+    Histogram& compile_seconds;
+    /// Compiles answered from the backend's in-memory executable cache
+    Counter& executable_cache_hits;
+    Counter& executable_cache_misses;
+};
@@ -14,19 +14,35 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cmath>
+#include <cstdlib>
+
 #include "ngraph/runtime/nop/nop_backend_visibility.hpp"
 
+#include "ngraph/cost_model.hpp"
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
 #include "ngraph/except.hpp"
 #include "ngraph/op/convert.hpp"
 #include "ngraph/op/select.hpp"
 #include "ngraph/op/util/binary_elementwise_comparison.hpp"
+#include "ngraph/pass/algebraic_simplification.hpp"
 #include "ngraph/pass/assign_layout.hpp"
+#include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/core_fusion.hpp"
+#include "ngraph/pass/cse.hpp"
+#include "ngraph/pass/fused_op_decomposition.hpp"
+#include "ngraph/pass/implicit_broadcast_elimination.hpp"
 #include "ngraph/pass/like_replacement.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/nop_elimination.hpp"
+#include "ngraph/pass/opset0_downgrade.hpp"
+#include "ngraph/pass/reshape_elimination.hpp"
+#include "ngraph/pass/zero_dim_tensor_elimination.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/nop/nop_backend.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -41,6 +57,15 @@ extern "C" NOP_BACKEND_API void ngraph_register_nop_backend()
     });
 }
 
+// Alignment of the planned tensors, as in the CPU backend
+static const size_t s_alignment = 64;
+
+runtime::nop::NOPBackend::NOPBackend()
+    : m_peak_gflops(NOPExecutable::get_default_peak_gflops())
+    , m_peak_gbps(NOPExecutable::get_default_peak_gbps())
+{
+}
+
 shared_ptr<runtime::Tensor> runtime::nop::NOPBackend::create_tensor(const element::Type& type,
                                                                     const Shape& shape)
 {
@@ -54,21 +79,103 @@ shared_ptr<runtime::Tensor> runtime::nop::NOPBackend::create_tensor(const elemen
     return make_shared<runtime::HostTensor>(type, shape, memory_pointer, "external");
 }
 
+bool runtime::nop::NOPBackend::set_config(const map<string, string>& config, string& error)
+{
+    error = "";
+    for (auto& item : config)
+    {
+        double* rate = item.first == "peak_gflops"
+                           ? &m_peak_gflops
+                           : item.first == "peak_gbps" ? &m_peak_gbps : nullptr;
+        if (rate == nullptr)
+        {
+            error = "Unsupported NOP backend config '" + item.first + "'";
+            return false;
+        }
+        char* end = nullptr;
+        double value = strtod(item.second.c_str(), &end);
+        if (end == item.second.c_str() || *end != '\0' || !(value > 0))
+        {
+            error = "NOP backend config '" + item.first + "' must be a positive number";
+            return false;
+        }
+        *rate = value;
+    }
+    return !config.empty();
+}
+
 shared_ptr<runtime::Executable>
     runtime::nop::NOPBackend::compile(shared_ptr<Function> function,
                                       bool enable_performance_collection)
 {
-    return make_shared<NOPExecutable>(function, enable_performance_collection);
+    return make_shared<NOPExecutable>(
+        function, enable_performance_collection, m_peak_gflops, m_peak_gbps);
+}
+
+static double get_env_rate(const char* name, double default_rate)
+{
+    const char* env = getenv(name);
+    double rate = env ? strtod(env, nullptr) : 0;
+    return rate > 0 ? rate : default_rate;
+}
+
+double runtime::nop::NOPExecutable::get_default_peak_gflops()
+{
+    static const double s_peak_gflops = get_env_rate("NGRAPH_NOP_PEAK_GFLOPS", 1000);
+    return s_peak_gflops;
+}
+
+double runtime::nop::NOPExecutable::get_default_peak_gbps()
+{
+    static const double s_peak_gbps = get_env_rate("NGRAPH_NOP_PEAK_GBPS", 100);
+    return s_peak_gbps;
 }
 
 runtime::nop::NOPExecutable::NOPExecutable(shared_ptr<Function> function,
-                                           bool /* enable_performance_collection */)
+                                           bool /* enable_performance_collection */,
+                                           double peak_gflops,
+                                           double peak_gbps)
 {
+    // The target-independent part of the CPU pass pipeline, then the memory plan
     pass::Manager pass_manager;
+    pass_manager.register_pass<pass::LikeReplacement>();
+    pass_manager.register_pass<pass::FusedOpDecomposition>();
+    pass_manager.register_pass<pass::Opset0Downgrade>();
+    pass_manager.register_pass<pass::ImplicitBroadcastElimination>();
+    pass_manager.register_pass<pass::NopElimination>();
+    pass_manager.register_pass<pass::ZeroDimTensorElimination>();
+    pass_manager.register_pass<pass::AlgebraicSimplification>();
+    pass_manager.register_pass<pass::ReshapeElimination>();
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.register_pass<pass::CommonSubexpressionElimination>();
+    pass_manager.register_pass<pass::ConstantFolding>();
     pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(s_alignment);
     pass_manager.run_passes(function);
 
     set_parameters_and_results(*function);
+    m_temporary_pool_size = function->get_temporary_pool_size();
+
+    // Roofline model: an op takes the longer of its compute time at the peak FLOP rate and its
+    // memory time at the peak bandwidth
+    for (auto& node : function->get_ordered_ops())
+    {
+        if (node->is_parameter() || node->is_constant() || node->is_output())
+        {
+            continue;
+        }
+        NodeCost node_cost = estimate_cost(*node);
+        OpCost cost;
+        cost.node = node;
+        cost.flops = node_cost.flops;
+        cost.bytes = node_cost.bytes();
+        double compute_seconds = cost.flops / (peak_gflops * 1e9);
+        double memory_seconds = cost.bytes / (peak_gbps * 1e9);
+        cost.seconds = max(compute_seconds, memory_seconds);
+        cost.compute_bound = compute_seconds > memory_seconds;
+        m_op_costs.push_back(cost);
+    }
 }
 
 bool runtime::nop::NOPExecutable::call(const vector<shared_ptr<runtime::Tensor>>& /* outputs */,
@@ -76,3 +183,43 @@ bool runtime::nop::NOPExecutable::call(const vector<shared_ptr<runtime::Tensor>>
 {
     return true;
 }
+
+vector<runtime::PerformanceCounter> runtime::nop::NOPExecutable::get_performance_data() const
+{
+    vector<PerformanceCounter> counters;
+    for (auto& cost : m_op_costs)
+    {
+        counters.emplace_back(cost.node, static_cast<size_t>(llround(cost.seconds * 1e6)), 1);
+    }
+    return counters;
+}
+
+size_t runtime::nop::NOPExecutable::get_total_flops() const
+{
+    size_t flops = 0;
+    for (auto& cost : m_op_costs)
+    {
+        flops += cost.flops;
+    }
+    return flops;
+}
+
+size_t runtime::nop::NOPExecutable::get_total_bytes() const
+{
+    size_t bytes = 0;
+    for (auto& cost : m_op_costs)
+    {
+        bytes += cost.bytes;
+    }
+    return bytes;
+}
+
+double runtime::nop::NOPExecutable::get_predicted_seconds() const
+{
+    double seconds = 0;
+    for (auto& cost : m_op_costs)
+    {
+        seconds += cost.seconds;
+    }
+    return seconds;
+}
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -37,9 +38,17 @@ namespace ngraph
     }
 }
 
+/// \brief A backend that compiles functions for analysis and never executes them.
+///
+/// Its executables run the target-independent passes of the CPU pipeline, plan memory and
+/// estimate the cost of each op with a roofline model, for sizing hardware and comparing
+/// models without running them. The peak rates of the model are set with the "peak_gflops"
+/// and "peak_gbps" config keys.
 class ngraph::runtime::nop::NOPBackend : public Backend
 {
 public:
+    NOPBackend();
+
     std::shared_ptr<Tensor>
         create_tensor(const element::Type& type, const Shape& shape, void* memory_pointer) override;
 
@@ -47,12 +56,51 @@ public:
 
     std::shared_ptr<Executable> compile(std::shared_ptr<Function> function,
                                         bool enable_performance_data = false) override;
+
+    bool set_config(const std::map<std::string, std::string>& config, std::string& error) override;
+
+private:
+    double m_peak_gflops;
+    double m_peak_gbps;
 };
 
 class ngraph::runtime::nop::NOPExecutable : public Executable
 {
 public:
-    NOPExecutable(std::shared_ptr<Function> function, bool enable_performance_collection = false);
+    /// \brief The estimated cost of one op
+    struct OpCost
+    {
+        std::shared_ptr<Node> node;
+        size_t flops;
+        size_t bytes;
+        /// \brief The larger of the compute and the memory time at the peak rates
+        double seconds;
+        bool compute_bound;
+    };
+
+    NOPExecutable(std::shared_ptr<Function> function,
+                  bool enable_performance_collection = false,
+                  double peak_gflops = get_default_peak_gflops(),
+                  double peak_gbps = get_default_peak_gbps());
     bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
               const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    /// \returns One counter per costed op, with the predicted time of one call as its time
+    std::vector<PerformanceCounter> get_performance_data() const override;
+
+    const std::vector<OpCost>& get_op_costs() const { return m_op_costs; }
+    size_t get_total_flops() const;
+    size_t get_total_bytes() const;
+    double get_predicted_seconds() const;
+    /// \brief Bytes of the memory planned for the intermediate tensors
+    size_t get_temporary_pool_size() const { return m_temporary_pool_size; }
+
+    /// \brief NGRAPH_NOP_PEAK_GFLOPS, or 1000
+    static double get_default_peak_gflops();
+    /// \brief NGRAPH_NOP_PEAK_GBPS, or 100
+    static double get_default_peak_gbps();
+
+private:
+    std::vector<OpCost> m_op_costs;
+    size_t m_temporary_pool_size;
 };
@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/opt_kernel/parallel_copy.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace opt_kernel
+        {
+            /// \brief Concatenates row-major tensors along `concatenation_axis` with block copies.
+            ///
+            /// For every index over the axes before the concatenation axis, each input
+            /// contributes one contiguous block of the output. Those outer indices are split
+            /// over `parallel_for`; when there is only one, each input is copied in ranges.
+            template <typename T>
+            void concat(const std::vector<const T*>& args,
+                        T* out,
+                        const std::vector<Shape>& in_shapes,
+                        const Shape& out_shape,
+                        int64_t concatenation_axis,
+                        const parallel_for_t& parallel_for = nullptr)
+            {
+                size_t axis = static_cast<size_t>(concatenation_axis);
+                NGRAPH_CHECK(axis < out_shape.size());
+                size_t outer = shape_size(Shape(out_shape.begin(), out_shape.begin() + axis));
+                size_t inner = shape_size(Shape(out_shape.begin() + axis + 1, out_shape.end()));
+                size_t out_block = out_shape[axis] * inner;
+
+                std::vector<const T*> blocks;
+                std::vector<size_t> block_sizes;
+                std::vector<size_t> block_offsets;
+                size_t offset = 0;
+                for (size_t i = 0; i < args.size(); i++)
+                {
+                    NGRAPH_CHECK(in_shapes[i].size() == out_shape.size());
+                    size_t block_size = in_shapes[i][axis] * inner;
+                    if (block_size != 0 && outer != 0)
+                    {
+                        blocks.push_back(args[i]);
+                        block_sizes.push_back(block_size);
+                        block_offsets.push_back(offset);
+                    }
+                    offset += block_size;
+                }
+                NGRAPH_CHECK(offset == out_block);
+
+                if (outer == 1)
+                {
+                    for (size_t i = 0; i < blocks.size(); i++)
+                    {
+                        parallel_copy(
+                            blocks[i], out + block_offsets[i], block_sizes[i], parallel_for);
+                    }
+                    return;
+                }
+
+                run_parallel(parallel_for, outer, out_block, [&](size_t begin, size_t end) {
+                    for (size_t o = begin; o < end; o++)
+                    {
+                        T* out_row = out + o * out_block;
+                        for (size_t i = 0; i < blocks.size(); i++)
+                        {
+                            const T* in_row = blocks[i] + o * block_sizes[i];
+                            std::copy(in_row, in_row + block_sizes[i], out_row + block_offsets[i]);
+                        }
+                    }
+                });
+            }
+        }
+    }
+}
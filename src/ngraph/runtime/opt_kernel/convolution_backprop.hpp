@@ -0,0 +1,270 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/runtime/opt_kernel/parallel_copy.hpp"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/gemm_convolution.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace opt_kernel
+        {
+            /// \brief Largest number of partial filter gradients. The batch is split into
+            ///        partitions that do not depend on the thread count, so results are
+            ///        reproducible.
+            static const size_t CONVOLUTION_BACKPROP_PARTITIONS = 8;
+
+            /// \brief Columns of an im2col block; in channels are grouped until their filter
+            ///        positions fill about this many.
+            static const size_t CONVOLUTION_BACKPROP_BLOCK = 64;
+
+            /// \returns the in channels per im2col block for a filter with `filter_size`
+            ///          positions.
+            inline size_t convolution_backprop_channel_block(size_t filter_size, size_t channels)
+            {
+                size_t block = std::max<size_t>(CONVOLUTION_BACKPROP_BLOCK / filter_size, 1);
+                return std::min(block, std::max<size_t>(channels, 1));
+            }
+
+            /// \brief Gradient of an NC_I... x C_OC_I... -> NC_O... convolution with respect to
+            ///        its filter, given the forward parameters.
+            ///
+            /// Each task takes one partition of the batch and one block of in channels. For every
+            /// batch element it unrolls the receptive fields of those channels into an
+            /// [out positions, block channels * filter positions] matrix (im2col) and multiplies
+            /// the output delta by it with gemm. Blocks of a partition write disjoint elements of
+            /// that partition's partial gradient, and the partials are summed in partition order
+            /// at the end.
+            template <typename T, typename ACCUMULATION = typename reference::widen<T>::type>
+            void convolution_backprop_filter(const T* in,
+                                             const T* delta_out,
+                                             T* delta_filter,
+                                             const Shape& in_shape,
+                                             const Shape& out_shape,
+                                             const Shape& filter_shape,
+                                             const Strides& stride,
+                                             const Strides& filter_dilation,
+                                             const CoordinateDiff& in_pad_below,
+                                             const Strides& in_dilation,
+                                             const parallel_for_t& parallel_for = nullptr)
+            {
+                const size_t spatial_rank = in_shape.size() - 2;
+                const Shape in_spatial(in_shape.begin() + 2, in_shape.end());
+                const Shape filter_spatial(filter_shape.begin() + 2, filter_shape.end());
+                const Shape out_spatial(out_shape.begin() + 2, out_shape.end());
+
+                const size_t batch_size = in_shape[0];
+                const size_t channels = in_shape[1];
+                const size_t out_channels = filter_shape[0];
+                const size_t in_size = shape_size(in_spatial);
+                const size_t filter_size = shape_size(filter_spatial);
+                const size_t out_size = shape_size(out_spatial);
+                const size_t depth = channels * filter_size;
+
+                const std::vector<std::vector<std::ptrdiff_t>> offsets =
+                    reference::im2col_offsets(in_spatial,
+                                              filter_spatial,
+                                              out_spatial,
+                                              stride,
+                                              filter_dilation,
+                                              in_pad_below,
+                                              in_dilation);
+
+                const size_t partitions =
+                    std::max<size_t>(std::min(batch_size, CONVOLUTION_BACKPROP_PARTITIONS), 1);
+                const size_t block = convolution_backprop_channel_block(filter_size, channels);
+                const size_t blocks = (channels + block - 1) / block;
+                std::vector<ACCUMULATION> partials(partitions * out_channels * depth,
+                                                   ACCUMULATION(0));
+
+                auto accumulate = [&](size_t begin, size_t end) {
+                    std::vector<T> columns(out_size * block * filter_size);
+                    std::vector<ACCUMULATION> product(out_channels * block * filter_size);
+                    for (size_t item = begin; item < end; ++item)
+                    {
+                        const size_t partition = item / blocks;
+                        const size_t c0 = item % blocks * block;
+                        const size_t width = std::min(block, channels - c0) * filter_size;
+                        ACCUMULATION* partial = &partials[partition * out_channels * depth];
+                        const size_t n_end = (partition + 1) * batch_size / partitions;
+                        for (size_t n = partition * batch_size / partitions; n < n_end; ++n)
+                        {
+                            for (size_t col = 0; col < width; ++col)
+                            {
+                                const T* in_channel =
+                                    in + (n * channels + c0 + col / filter_size) * in_size;
+                                auto unroll = [&](size_t p, std::ptrdiff_t offset) {
+                                    columns[p * width + col] =
+                                        offset >= 0 ? in_channel[offset] : T(0);
+                                };
+                                reference::im2col_visit(
+                                    offsets.data() + col % filter_size * spatial_rank,
+                                    out_spatial,
+                                    unroll);
+                            }
+                            reference::gemm(delta_out + n * out_channels * out_size,
+                                            columns.data(),
+                                            product.data(),
+                                            out_channels,
+                                            width,
+                                            out_size,
+                                            ACCUMULATION(0),
+                                            ACCUMULATION(0),
+                                            [](ACCUMULATION sum) { return sum; });
+                            for (size_t oc = 0; oc < out_channels; ++oc)
+                            {
+                                ACCUMULATION* row = partial + oc * depth + c0 * filter_size;
+                                for (size_t col = 0; col < width; ++col)
+                                {
+                                    row[col] = row[col] + product[oc * width + col];
+                                }
+                            }
+                        }
+                    }
+                };
+                const size_t batch_per_partition = (batch_size + partitions - 1) / partitions;
+                run_parallel(parallel_for,
+                             partitions * blocks,
+                             batch_per_partition * out_channels * out_size * block * filter_size,
+                             accumulate);
+
+                auto reduce = [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        ACCUMULATION sum = partials[i];
+                        for (size_t partition = 1; partition < partitions; ++partition)
+                        {
+                            sum = sum + partials[partition * out_channels * depth + i];
+                        }
+                        delta_filter[i] = static_cast<T>(sum);
+                    }
+                };
+                run_parallel(parallel_for, out_channels * depth, partitions, reduce);
+            }
+
+            /// \brief Gradient of an NC_I... x C_OC_I... -> NC_O... convolution with respect to
+            ///        its input, given the forward parameters.
+            ///
+            /// Each task takes one batch element and one block of in channels. It multiplies the
+            /// filter rows of those channels, transposed, by the output delta with gemm into a
+            /// [block channels * filter positions, out positions] matrix and adds every element
+            /// back to the input position it would have been unrolled from (col2im). Tasks write
+            /// disjoint parts of the input delta, so no reduction is needed.
+            template <typename T, typename ACCUMULATION = typename reference::widen<T>::type>
+            void convolution_backprop_in(const T* delta_out,
+                                         const T* filter,
+                                         T* delta_in,
+                                         const Shape& out_shape,
+                                         const Shape& filter_shape,
+                                         const Shape& in_shape,
+                                         const Strides& stride,
+                                         const Strides& filter_dilation,
+                                         const CoordinateDiff& in_pad_below,
+                                         const Strides& in_dilation,
+                                         const parallel_for_t& parallel_for = nullptr)
+            {
+                const size_t spatial_rank = in_shape.size() - 2;
+                const Shape in_spatial(in_shape.begin() + 2, in_shape.end());
+                const Shape filter_spatial(filter_shape.begin() + 2, filter_shape.end());
+                const Shape out_spatial(out_shape.begin() + 2, out_shape.end());
+
+                const size_t batch_size = in_shape[0];
+                const size_t channels = in_shape[1];
+                const size_t out_channels = filter_shape[0];
+                const size_t in_size = shape_size(in_spatial);
+                const size_t filter_size = shape_size(filter_spatial);
+                const size_t out_size = shape_size(out_spatial);
+                const size_t depth = channels * filter_size;
+
+                const std::vector<std::vector<std::ptrdiff_t>> offsets =
+                    reference::im2col_offsets(in_spatial,
+                                              filter_spatial,
+                                              out_spatial,
+                                              stride,
+                                              filter_dilation,
+                                              in_pad_below,
+                                              in_dilation);
+
+                // [in channels * filter positions, out channels], so that the rows of a block of
+                // channels are contiguous
+                std::vector<T> weights(depth * out_channels);
+                for (size_t oc = 0; oc < out_channels; ++oc)
+                {
+                    for (size_t i = 0; i < depth; ++i)
+                    {
+                        weights[i * out_channels + oc] = filter[oc * depth + i];
+                    }
+                }
+
+                const size_t block = convolution_backprop_channel_block(filter_size, channels);
+                const size_t blocks = (channels + block - 1) / block;
+                auto scatter = [&](size_t begin, size_t end) {
+                    std::vector<ACCUMULATION> columns(block * filter_size * out_size);
+                    std::vector<ACCUMULATION> sums(in_size);
+                    for (size_t item = begin; item < end; ++item)
+                    {
+                        const size_t n = item / blocks;
+                        const size_t c0 = item % blocks * block;
+                        const size_t c_end = std::min(c0 + block, channels);
+                        reference::gemm(&weights[c0 * filter_size * out_channels],
+                                        delta_out + n * out_channels * out_size,
+                                        columns.data(),
+                                        (c_end - c0) * filter_size,
+                                        out_size,
+                                        out_channels,
+                                        ACCUMULATION(0),
+                                        ACCUMULATION(0),
+                                        [](ACCUMULATION sum) { return sum; });
+                        for (size_t c = c0; c < c_end; ++c)
+                        {
+                            std::fill(sums.begin(), sums.end(), ACCUMULATION(0));
+                            for (size_t f = 0; f < filter_size; ++f)
+                            {
+                                const ACCUMULATION* row =
+                                    &columns[((c - c0) * filter_size + f) * out_size];
+                                auto fold = [&](size_t p, std::ptrdiff_t offset) {
+                                    if (offset >= 0)
+                                    {
+                                        sums[offset] = sums[offset] + row[p];
+                                    }
+                                };
+                                reference::im2col_visit(
+                                    offsets.data() + f * spatial_rank, out_spatial, fold);
+                            }
+                            T* in_channel = delta_in + (n * channels + c) * in_size;
+                            for (size_t i = 0; i < in_size; ++i)
+                            {
+                                in_channel[i] = static_cast<T>(sums[i]);
+                            }
+                        }
+                    }
+                };
+                run_parallel(parallel_for,
+                             batch_size * blocks,
+                             out_channels * out_size * block * filter_size,
+                             scatter);
+            }
+        }
+    }
+}
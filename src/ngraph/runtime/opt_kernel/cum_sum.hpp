@@ -0,0 +1,165 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+
+#include "ngraph/runtime/opt_kernel/parallel_copy.hpp"
+#include "ngraph/runtime/reference/cum_sum.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace opt_kernel
+        {
+            /// \brief Elements per block of the two-pass scan. Blocks do not depend on the
+            ///        thread count, so results are reproducible.
+            static const size_t CUMSUM_BLOCK = 4096;
+
+            /// \brief Scans positions [begin, end) of a contiguous axis starting from `sum`, and
+            ///        returns the running sum after the last position.
+            template <typename T>
+            T cumsum_block(const T* arg,
+                           T* out,
+                           size_t length,
+                           size_t begin,
+                           size_t end,
+                           T sum,
+                           const bool exclusive,
+                           const bool reverse)
+            {
+                for (size_t p = begin; p < end; p++)
+                {
+                    size_t k = reverse ? length - 1 - p : p;
+                    T value = arg[k];
+                    if (exclusive)
+                    {
+                        out[k] = sum;
+                        sum = sum + value;
+                    }
+                    else
+                    {
+                        sum = sum + value;
+                        out[k] = sum;
+                    }
+                }
+                return sum;
+            }
+
+            /// \brief Cumulative sum along the axis given by `axis_tensor`.
+            ///
+            /// The independent lanes (every index over the other axes) are split over
+            /// `parallel_for`. When the axis is contiguous and there are fewer lanes than blocks
+            /// of CUMSUM_BLOCK elements along it, each lane is scanned in two passes instead:
+            /// block sums in parallel, a serial prefix over the blocks, then each block again from
+            /// its offset. Floating-point sums are then associated per block rather than strictly
+            /// left to right.
+            template <typename T, typename P>
+            void cumsum(const T* arg,
+                        const P* axis_tensor,
+                        T* out,
+                        const Shape& tensor_shape,
+                        const bool exclusive,
+                        const bool reverse,
+                        const parallel_for_t& parallel_for = nullptr)
+            {
+                auto layout = reference::cumsum_layout(tensor_shape, axis_tensor);
+                size_t length = layout.length;
+                size_t inner = layout.inner;
+                size_t slice = length * inner;
+                size_t lanes = layout.outer * inner;
+                if (!parallel_for || lanes == 0 || length == 0)
+                {
+                    reference::cumsum(arg, axis_tensor, out, tensor_shape, exclusive, reverse);
+                    return;
+                }
+
+                size_t blocks = (length + CUMSUM_BLOCK - 1) / CUMSUM_BLOCK;
+                if (inner == 1 && blocks > 1 && lanes < blocks)
+                {
+                    size_t count = lanes * blocks;
+                    std::unique_ptr<T[]> sums(new T[count]);
+                    auto block_range = [&](size_t item, size_t& begin, size_t& end) {
+                        begin = (item % blocks) * CUMSUM_BLOCK;
+                        end = std::min(begin + CUMSUM_BLOCK, length);
+                    };
+
+                    parallel_for(count, CUMSUM_BLOCK, [&](size_t first, size_t last) {
+                        for (size_t item = first; item < last; item++)
+                        {
+                            size_t begin, end;
+                            block_range(item, begin, end);
+                            const T* lane = arg + (item / blocks) * length;
+                            T sum = T(0);
+                            for (size_t p = begin; p < end; p++)
+                            {
+                                sum = sum + lane[reverse ? length - 1 - p : p];
+                            }
+                            sums[item] = sum;
+                        }
+                    });
+                    // Turn the block sums into exclusive offsets
+                    for (size_t lane = 0; lane < lanes; lane++)
+                    {
+                        T offset = T(0);
+                        for (size_t b = 0; b < blocks; b++)
+                        {
+                            T sum = sums[lane * blocks + b];
+                            sums[lane * blocks + b] = offset;
+                            offset = offset + sum;
+                        }
+                    }
+                    parallel_for(count, CUMSUM_BLOCK, [&](size_t first, size_t last) {
+                        for (size_t item = first; item < last; item++)
+                        {
+                            size_t begin, end;
+                            block_range(item, begin, end);
+                            size_t offset = (item / blocks) * length;
+                            cumsum_block(arg + offset,
+                                         out + offset,
+                                         length,
+                                         begin,
+                                         end,
+                                         sums[item],
+                                         exclusive,
+                                         reverse);
+                        }
+                    });
+                    return;
+                }
+
+                parallel_for(lanes, length, [&](size_t first, size_t last) {
+                    for (size_t o = first / inner; o * inner < last; o++)
+                    {
+                        size_t lane_begin = std::max(first, o * inner) - o * inner;
+                        size_t lane_end = std::min(last, (o + 1) * inner) - o * inner;
+                        reference::cumsum_lanes(arg + o * slice,
+                                                out + o * slice,
+                                                length,
+                                                inner,
+                                                lane_begin,
+                                                lane_end,
+                                                exclusive,
+                                                reverse);
+                    }
+                });
+            }
+        }
+    }
+}
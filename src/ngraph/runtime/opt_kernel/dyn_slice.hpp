@@ -0,0 +1,124 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/runtime/opt_kernel/parallel_copy.hpp"
+#include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/slice_plan.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace opt_kernel
+        {
+            /// \brief The elements of a row-major tensor of `arg_shape` selected by `plan`, in
+            ///        the order of the sliced, reshaped and reversed result.
+            ///
+            /// A reversed axis starts at its last element and steps by the two's complement of
+            /// its stride; the unsigned offset arithmetic of strided_copy wraps it back into
+            /// range. The plan's reshape only inserts and removes axes of length one, so the
+            /// reversed axes longer than one are matched in order between both shapes.
+            inline reference::SliceLayout dyn_slice_layout(const Shape& arg_shape,
+                                                           const SlicePlan& plan)
+            {
+                auto layout = reference::slice_layout(
+                    arg_shape,
+                    Coordinate(plan.begins.begin(), plan.begins.end()),
+                    Coordinate(plan.ends.begin(), plan.ends.end()),
+                    Strides(plan.strides.begin(), plan.strides.end()));
+
+                size_t in_axis = 0;
+                for (size_t out_axis = 0; out_axis < plan.reshape_out_shape.size(); out_axis++)
+                {
+                    size_t length = plan.reshape_out_shape[out_axis];
+                    if (length == 1)
+                    {
+                        continue;
+                    }
+                    while (layout.shape[in_axis] == 1)
+                    {
+                        in_axis++;
+                    }
+                    if (plan.reverse_axes.count(out_axis) != 0 && length != 0)
+                    {
+                        layout.start += (length - 1) * layout.strides[in_axis];
+                        layout.strides[in_axis] = 0 - layout.strides[in_axis];
+                    }
+                    in_axis++;
+                }
+                return layout;
+            }
+
+            /// \brief Copies the slice of `arg` described by `plan`, e.g. one made from runtime
+            ///        bounds by make_slice_plan, to `out`.
+            template <typename T>
+            void dyn_slice(const T* arg,
+                           T* out,
+                           const Shape& arg_shape,
+                           const SlicePlan& plan,
+                           const parallel_for_t& parallel_for = nullptr)
+            {
+                // make_slice_plan may leave the bounds of an empty backwards slice past the end
+                if (shape_size(plan.reshape_in_shape) == 0)
+                {
+                    return;
+                }
+                auto layout = dyn_slice_layout(arg_shape, plan);
+                parallel_strided_copy(arg,
+                                      out,
+                                      layout.shape,
+                                      layout.strides,
+                                      layout.start,
+                                      row_major_strides(layout.shape),
+                                      0,
+                                      parallel_for);
+            }
+
+            /// \brief Copies `arg` to `out` and then `replacement` over the slice described by
+            ///        `plan`. The copy of `arg` is skipped when it already is `out`.
+            template <typename T>
+            void dyn_replace_slice(const T* arg,
+                                   const T* replacement,
+                                   T* out,
+                                   const Shape& arg_shape,
+                                   const SlicePlan& plan,
+                                   const parallel_for_t& parallel_for = nullptr)
+            {
+                if (arg != out)
+                {
+                    parallel_copy(arg, out, shape_size(arg_shape), parallel_for);
+                }
+                if (shape_size(plan.reshape_in_shape) == 0)
+                {
+                    return;
+                }
+
+                auto layout = dyn_slice_layout(arg_shape, plan);
+                parallel_strided_copy(replacement,
+                                      out,
+                                      layout.shape,
+                                      row_major_strides(layout.shape),
+                                      0,
+                                      layout.strides,
+                                      layout.start,
+                                      parallel_for);
+            }
+        }
+    }
+}
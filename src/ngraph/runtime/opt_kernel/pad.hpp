@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+
+#include "ngraph/runtime/opt_kernel/parallel_copy.hpp"
+#include "ngraph/runtime/reference/pad.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace opt_kernel
+        {
+            /// \brief Constant padding. The outermost output axis longer than one is split over
+            ///        `parallel_for`; each range is filled with the pad value and then receives
+            ///        the part of the input that lands in it, while it is still in cache.
+            template <typename T>
+            void pad(const T* arg0,
+                     const T* arg1,
+                     T* out,
+                     const Shape& arg0_shape,
+                     const Shape& out_shape,
+                     const CoordinateDiff& padding_below,
+                     const CoordinateDiff& padding_above,
+                     const parallel_for_t& parallel_for = nullptr)
+            {
+                auto layout =
+                    reference::pad_layout(arg0_shape, out_shape, padding_below, padding_above);
+                T value = *arg1;
+
+                size_t axis = 0;
+                while (axis < out_shape.size() && out_shape[axis] == 1)
+                {
+                    axis++;
+                }
+                if (!parallel_for || axis == out_shape.size())
+                {
+                    std::fill(out, out + shape_size(out_shape), value);
+                    strided_copy(arg0,
+                                 out,
+                                 layout.copy_shape,
+                                 layout.arg0_strides,
+                                 layout.arg0_start,
+                                 layout.out_strides,
+                                 layout.out_start);
+                    return;
+                }
+
+                // Output rows along `axis` that receive input rows
+                size_t copy_begin =
+                    static_cast<size_t>(std::max<ptrdiff_t>(0, padding_below[axis]));
+                size_t copy_end = copy_begin + layout.copy_shape[axis];
+                size_t item_size = layout.out_strides[axis];
+                parallel_for(out_shape[axis], item_size, [&](size_t begin, size_t end) {
+                    std::fill(out + begin * item_size, out + end * item_size, value);
+
+                    size_t first = std::max(begin, copy_begin);
+                    size_t last = std::min(end, copy_end);
+                    if (first < last)
+                    {
+                        Shape chunk_shape = layout.copy_shape;
+                        chunk_shape[axis] = last - first;
+                        size_t skipped = first - copy_begin;
+                        strided_copy(arg0,
+                                     out,
+                                     chunk_shape,
+                                     layout.arg0_strides,
+                                     layout.arg0_start + skipped * layout.arg0_strides[axis],
+                                     layout.out_strides,
+                                     layout.out_start + skipped * layout.out_strides[axis]);
+                    }
+                });
+            }
+        }
+    }
+}
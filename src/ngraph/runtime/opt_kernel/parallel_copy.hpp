@@ -0,0 +1,130 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "ngraph/shape.hpp"
+#include "ngraph/strided_loop.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace opt_kernel
+        {
+            /// \brief Calls `f(begin, end)` on ranges covering [0, count), possibly in parallel.
+            ///        `work_per_item` estimates the elements touched per item so that small loops
+            ///        can stay on the calling thread. Kernels run serially when it is null.
+            using parallel_for_t =
+                std::function<void(size_t count,
+                                   size_t work_per_item,
+                                   const std::function<void(size_t begin, size_t end)>& f)>;
+
+            /// \brief Calls `f(begin, end)` through `parallel_for`, or once over [0, count) when
+            ///        it is null.
+            inline void run_parallel(const parallel_for_t& parallel_for,
+                                     size_t count,
+                                     size_t work_per_item,
+                                     const std::function<void(size_t begin, size_t end)>& f)
+            {
+                if (parallel_for)
+                {
+                    parallel_for(count, work_per_item, f);
+                }
+                else if (count > 0)
+                {
+                    f(0, count);
+                }
+            }
+
+            /// \brief Copies `count` contiguous elements, split into ranges.
+            template <typename T>
+            void parallel_copy(const T* in,
+                               T* out,
+                               size_t count,
+                               const parallel_for_t& parallel_for)
+            {
+                run_parallel(parallel_for, count, 1, [&](size_t begin, size_t end) {
+                    std::copy(in + begin, in + end, out + begin);
+                });
+            }
+
+            /// \brief Sets `count` contiguous elements to `value`, split into ranges.
+            template <typename T>
+            void parallel_fill(T* out, size_t count, T value, const parallel_for_t& parallel_for)
+            {
+                run_parallel(parallel_for, count, 1, [&](size_t begin, size_t end) {
+                    std::fill(out + begin, out + end, value);
+                });
+            }
+
+            /// \brief strided_copy split along the outermost axis of `shape` that is longer than
+            ///        one.
+            template <typename T>
+            void parallel_strided_copy(const T* in,
+                                       T* out,
+                                       const Shape& shape,
+                                       const std::vector<size_t>& in_strides,
+                                       size_t in_start,
+                                       const std::vector<size_t>& out_strides,
+                                       size_t out_start,
+                                       const parallel_for_t& parallel_for)
+            {
+                size_t axis = 0;
+                while (axis < shape.size() && shape[axis] == 1)
+                {
+                    axis++;
+                }
+                if (!parallel_for || axis == shape.size())
+                {
+                    strided_copy(in, out, shape, in_strides, in_start, out_strides, out_start);
+                    return;
+                }
+
+                size_t item_size = shape_size(Shape(shape.begin() + axis + 1, shape.end()));
+                parallel_for(shape[axis], item_size, [&](size_t begin, size_t end) {
+                    Shape chunk_shape = shape;
+                    chunk_shape[axis] = end - begin;
+                    strided_copy(in,
+                                 out,
+                                 chunk_shape,
+                                 in_strides,
+                                 in_start + begin * in_strides[axis],
+                                 out_strides,
+                                 out_start + begin * out_strides[axis]);
+                });
+            }
+
+            /// \brief strided_copy to a row-major output, split along the outermost axis of
+            ///        `shape` that is longer than one.
+            template <typename T>
+            void parallel_strided_copy(const T* in,
+                                       T* out,
+                                       const Shape& shape,
+                                       const std::vector<size_t>& in_strides,
+                                       const parallel_for_t& parallel_for)
+            {
+                parallel_strided_copy(
+                    in, out, shape, in_strides, 0, row_major_strides(shape), 0, parallel_for);
+            }
+        }
+    }
+}
@@ -0,0 +1,62 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/runtime/opt_kernel/parallel_copy.hpp"
+#include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace opt_kernel
+        {
+            /// \brief Copies `arg0` to `out` and then `arg1` over a strided slice of it. The copy
+            ///        of `arg0` is skipped when it already is `out`.
+            template <typename T>
+            void replace_slice(const T* arg0,
+                               const T* arg1,
+                               T* out,
+                               const Shape& arg1_shape,
+                               const Coordinate& lower_bounds,
+                               const Coordinate& upper_bounds,
+                               const Strides& strides,
+                               const Shape& out_shape,
+                               const parallel_for_t& parallel_for = nullptr)
+            {
+                if (arg0 != out)
+                {
+                    parallel_copy(arg0, out, shape_size(out_shape), parallel_for);
+                }
+
+                auto layout =
+                    reference::slice_layout(out_shape, lower_bounds, upper_bounds, strides);
+                NGRAPH_CHECK(shape_size(layout.shape) == shape_size(arg1_shape));
+
+                parallel_strided_copy(arg1,
+                                      out,
+                                      layout.shape,
+                                      row_major_strides(layout.shape),
+                                      0,
+                                      layout.strides,
+                                      layout.start,
+                                      parallel_for);
+            }
+        }
+    }
+}
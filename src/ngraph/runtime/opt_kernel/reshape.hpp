@@ -16,8 +16,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #include "ngraph/axis_vector.hpp"
-#include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/opt_kernel/parallel_copy.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -26,220 +30,133 @@ namespace ngraph
     {
         namespace opt_kernel
         {
+            /// \brief Side of the square tiles of a blocked transpose: one 64 byte cache line
+            ///        of elements, and at least 8.
             template <typename T>
-            void reshape_in0(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
+            constexpr size_t transpose_tile()
             {
-                *out = *in;
+                return sizeof(T) >= 8 ? 8 : 64 / sizeof(T);
             }
 
+            /// \brief Copies `in` to `out` in the order of `in_axis_order`.
+            ///
+            /// Output axes of length one are dropped and neighbouring output axes that are also
+            /// neighbours in the input are merged, so most layouts reduce to a few axes. When
+            /// the innermost output axis is not contiguous in the input, e.g. for NCHW <-> NHWC,
+            /// the copy is a batch of 2-D transposes between that axis and the axis that is
+            /// contiguous in the input. These run in square tiles of transpose_tile<T>() so
+            /// that the lines read and written by a tile stay in L1. Otherwise the output is a
+            /// sequence of contiguous input runs, which are copied directly. Tiles, or the
+            /// outermost axis, are split over `parallel_for` when it is given.
             template <typename T>
-            void reshape_in1(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
+            void reshape(const T* in,
+                         T* out,
+                         const Shape& in_shape,
+                         const AxisVector& in_axis_order,
+                         const Shape& out_shape,
+                         const parallel_for_t& parallel_for = nullptr)
             {
-                size_t size[1];
-                size_t in_index[1];
-                size_t* map_index[1];
-                for (size_t i = 0; i < 1; i++)
-                {
-                    size[i] = in_shape[in_axis_order[i]];
-                    map_index[in_axis_order[i]] = &in_index[i];
-                }
-                for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+                NGRAPH_CHECK(in_axis_order.size() == in_shape.size());
+                NGRAPH_CHECK(shape_size(in_shape) == shape_size(out_shape));
+                if (shape_size(in_shape) == 0)
                 {
-                    *out++ = in[*map_index[0]];
+                    return;
                 }
-            }
 
-            template <typename T>
-            void reshape_in2(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
-            {
-                size_t size[2];
-                size_t in_index[2];
-                size_t* map_index[2];
-                for (size_t i = 0; i < 2; i++)
-                {
-                    size[i] = in_shape[in_axis_order[i]];
-                    map_index[in_axis_order[i]] = &in_index[i];
-                }
-                for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+                // Lengths and input strides of the merged output axes
+                auto in_strides = row_major_strides(in_shape);
+                Shape lengths;
+                std::vector<size_t> strides;
+                for (size_t i = 0; i < in_axis_order.size(); i++)
                 {
-                    for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+                    NGRAPH_CHECK(in_axis_order[i] < in_shape.size());
+                    size_t length = in_shape[in_axis_order[i]];
+                    size_t stride = in_strides[in_axis_order[i]];
+                    if (length == 1)
                     {
-                        *out++ = in[*map_index[0] * in_shape[1] + *map_index[1]];
+                        continue;
                     }
-                }
-            }
-
-            template <typename T>
-            void reshape_in3(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
-            {
-                size_t size[3];
-                size_t in_index[3];
-                size_t* map_index[3];
-                for (size_t i = 0; i < 3; i++)
-                {
-                    size[i] = in_shape[in_axis_order[i]];
-                    map_index[in_axis_order[i]] = &in_index[i];
-                }
-                for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-                {
-                    for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+                    if (!lengths.empty() && strides.back() == stride * length)
                     {
-                        for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                        {
-                            *out++ = in[*map_index[0] * in_shape[1] * in_shape[2] +
-                                        *map_index[1] * in_shape[2] + *map_index[2]];
-                        }
+                        lengths.back() *= length;
+                        strides.back() = stride;
+                        continue;
                     }
+                    lengths.push_back(length);
+                    strides.push_back(stride);
                 }
-            }
 
-            template <typename T>
-            void reshape_in4(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
-            {
-                size_t size[4];
-                size_t in_index[4];
-                size_t* map_index[4];
-                for (size_t i = 0; i < 4; i++)
+                if (lengths.empty() || strides.back() == 1)
                 {
-                    size[i] = in_shape[in_axis_order[i]];
-                    map_index[in_axis_order[i]] = &in_index[i];
+                    parallel_strided_copy(in, out, lengths, strides, parallel_for);
+                    return;
                 }
-                for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+
+                // The innermost output axis `o` is strided in the input and exactly one other
+                // axis `p` is contiguous in it. Every other axis indexes a batch of transposes.
+                const size_t rank = lengths.size();
+                const size_t o = rank - 1;
+                const size_t p =
+                    std::find(strides.begin(), strides.end(), size_t(1)) - strides.begin();
+                NGRAPH_CHECK(p < o);
+                auto out_strides = row_major_strides(lengths);
+
+                Shape batch_lengths;
+                std::vector<size_t> batch_in_strides;
+                std::vector<size_t> batch_out_strides;
+                for (size_t i = 0; i < rank; i++)
                 {
-                    for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+                    if (i != p && i != o)
                     {
-                        for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                        {
-                            for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                            {
-                                *out++ =
-                                    in[*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] +
-                                       *map_index[1] * in_shape[2] * in_shape[3] +
-                                       *map_index[2] * in_shape[3] + *map_index[3]];
-                            }
-                        }
+                        batch_lengths.push_back(lengths[i]);
+                        batch_in_strides.push_back(strides[i]);
+                        batch_out_strides.push_back(out_strides[i]);
                     }
                 }
-            }
 
-            template <typename T>
-            void reshape_in5(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
-            {
-                size_t size[5];
-                size_t in_index[5];
-                size_t* map_index[5];
-                for (size_t i = 0; i < 5; i++)
-                {
-                    size[i] = in_shape[in_axis_order[i]];
-                    map_index[in_axis_order[i]] = &in_index[i];
-                }
-                for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-                {
-                    for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+                const size_t tile = transpose_tile<T>();
+                const size_t p_length = lengths[p];
+                const size_t o_length = lengths[o];
+                const size_t p_out_stride = out_strides[p];
+                const size_t o_in_stride = strides[o];
+                const size_t p_tiles = (p_length + tile - 1) / tile;
+                const size_t o_tiles = (o_length + tile - 1) / tile;
+                const size_t tiles_per_batch = p_tiles * o_tiles;
+
+                auto transpose_tiles = [&](size_t begin, size_t end) {
+                    for (size_t item = begin; item < end; item++)
                     {
-                        for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
+                        size_t batch = item / tiles_per_batch;
+                        size_t p_begin = (item % tiles_per_batch) / o_tiles * tile;
+                        size_t o_begin = item % o_tiles * tile;
+                        size_t p_end = std::min(p_begin + tile, p_length);
+                        size_t o_end = std::min(o_begin + tile, o_length);
+
+                        size_t in_offset = 0;
+                        size_t out_offset = 0;
+                        for (size_t i = batch_lengths.size(); i-- > 0;)
                         {
-                            for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                            {
-                                for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
-                                {
-                                    *out++ =
-                                        in[*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] *
-                                               in_shape[4] +
-                                           *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                           *map_index[2] * in_shape[3] * in_shape[4] +
-                                           *map_index[3] * in_shape[4] + *map_index[4]];
-                                }
-                            }
+                            size_t index = batch % batch_lengths[i];
+                            batch /= batch_lengths[i];
+                            in_offset += index * batch_in_strides[i];
+                            out_offset += index * batch_out_strides[i];
                         }
-                    }
-                }
-            }
 
-            template <typename T>
-            void reshape_in6(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
-            {
-                size_t size[6];
-                size_t in_index[6];
-                size_t* map_index[6];
-                for (size_t i = 0; i < 6; i++)
-                {
-                    size[i] = in_shape[in_axis_order[i]];
-                    map_index[in_axis_order[i]] = &in_index[i];
-                }
-                for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-                {
-                    for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-                    {
-                        for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
+                        const T* src = in + in_offset;
+                        T* dst = out + out_offset;
+                        for (size_t a = p_begin; a < p_end; a++)
                         {
-                            for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
+                            for (size_t b = o_begin; b < o_end; b++)
                             {
-                                for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
-                                {
-                                    for (in_index[5] = 0; in_index[5] < size[5]; ++in_index[5])
-                                    {
-                                        *out++ = in[*map_index[0] * in_shape[1] * in_shape[2] *
-                                                        in_shape[3] * in_shape[4] * in_shape[5] +
-                                                    *map_index[1] * in_shape[2] * in_shape[3] *
-                                                        in_shape[4] * in_shape[5] +
-                                                    *map_index[2] * in_shape[3] * in_shape[4] *
-                                                        in_shape[5] +
-                                                    *map_index[3] * in_shape[4] * in_shape[5] +
-                                                    *map_index[4] * in_shape[5] + *map_index[5]];
-                                    }
-                                }
+                                dst[a * p_out_stride + b] = src[a + b * o_in_stride];
                             }
                         }
                     }
-                }
-            }
-            template <typename T>
-            void reshape(const T* in,
-                         T* out,
-                         const Shape& in_shape,
-                         const AxisVector& in_axis_order,
-                         const Shape& out_shape)
-            {
-                switch (in_shape.size())
-                {
-                case 0: reshape_in0<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 1: reshape_in1<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 2: reshape_in2<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 3: reshape_in3<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 4: reshape_in4<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 5: reshape_in5<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 6: reshape_in6<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                default: reference::reshape(in, out, in_shape, in_axis_order, out_shape); break;
-                }
+                };
+                run_parallel(parallel_for,
+                             shape_size(batch_lengths) * tiles_per_batch,
+                             tile * tile,
+                             transpose_tiles);
             }
         }
     }
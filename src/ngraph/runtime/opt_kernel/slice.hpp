@@ -0,0 +1,57 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/runtime/opt_kernel/parallel_copy.hpp"
+#include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace opt_kernel
+        {
+            /// \brief Copies a strided slice of `arg` to `out`. Runs that are contiguous in both
+            ///        tensors are copied as blocks, and the outermost output axis is split over
+            ///        `parallel_for` when it is given.
+            template <typename T>
+            void slice(const T* arg,
+                       T* out,
+                       const Shape& arg_shape,
+                       const Coordinate& lower_bounds,
+                       const Coordinate& upper_bounds,
+                       const Strides& strides,
+                       const Shape& out_shape,
+                       const parallel_for_t& parallel_for = nullptr)
+            {
+                auto layout =
+                    reference::slice_layout(arg_shape, lower_bounds, upper_bounds, strides);
+                NGRAPH_CHECK(shape_size(layout.shape) == shape_size(out_shape));
+
+                parallel_strided_copy(arg,
+                                      out,
+                                      layout.shape,
+                                      layout.strides,
+                                      layout.start,
+                                      row_major_strides(layout.shape),
+                                      0,
+                                      parallel_for);
+            }
+        }
+    }
+}
@@ -0,0 +1,45 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/performance_counter.hpp"
+#include "ngraph/cost_model.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+size_t runtime::PerformanceCounter::flops() const
+{
+    return m_node ? estimate_cost(*m_node).flops : 0;
+}
+
+size_t runtime::PerformanceCounter::bytes() const
+{
+    return m_node ? estimate_cost(*m_node).bytes() : 0;
+}
+
+double runtime::PerformanceCounter::gflops_per_second() const
+{
+    return m_total_microseconds == 0
+               ? 0
+               : static_cast<double>(flops()) * m_call_count / m_total_microseconds / 1e3;
+}
+
+double runtime::PerformanceCounter::gigabytes_per_second() const
+{
+    return m_total_microseconds == 0
+               ? 0
+               : static_cast<double>(bytes()) * m_call_count / m_total_microseconds / 1e3;
+}
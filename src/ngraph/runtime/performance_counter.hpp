@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
 
 #include "ngraph/node.hpp"
@@ -41,9 +42,31 @@ namespace ngraph
                 return m_call_count == 0 ? 0 : m_total_microseconds / m_call_count;
             }
             size_t call_count() const { return m_call_count; }
+
+            /// \brief Whether the backend counted hardware events for this op
+            bool has_hardware_counters() const { return m_has_hardware_counters; }
+            /// \brief CPU cycles, instructions and last level cache misses over all calls, as
+            ///        counted on the thread that ran the op
+            uint64_t cycles() const { return m_cycles; }
+            uint64_t instructions() const { return m_instructions; }
+            uint64_t llc_misses() const { return m_llc_misses; }
+
+            /// \brief Estimated floating point operations of one call, from the op type and
+            ///        shapes. Zero for ops without an estimate. See ngraph::estimate_cost.
+            size_t flops() const;
+            /// \brief Estimated bytes moved by one call: the sizes of all inputs and outputs
+            size_t bytes() const;
+            /// \brief Achieved rates over all timed calls, zero if unknown
+            double gflops_per_second() const;
+            double gigabytes_per_second() const;
+
             std::shared_ptr<const Node> m_node;
             size_t m_total_microseconds;
             size_t m_call_count;
+            bool m_has_hardware_counters = false;
+            uint64_t m_cycles = 0;
+            uint64_t m_instructions = 0;
+            uint64_t m_llc_misses = 0;
         };
     }
 }
@@ -14,10 +14,16 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
 #include "ngraph/runtime/plaidml/plaidml_backend.hpp"
+#include "ngraph/cpio.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/runtime/plaidml/plaidml_executable.hpp"
 #include "ngraph/runtime/plaidml/plaidml_tensor.hpp"
+#include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 
 namespace vp = vertexai::plaidml;
@@ -25,6 +31,7 @@ namespace vp = vertexai::plaidml;
 ngraph::runtime::plaidml::PlaidML_Backend::PlaidML_Backend(const std::string& configuration_string)
     : m_config(parse_config_string(configuration_string))
     , m_compiler{&m_config}
+    , m_cache{this, "PlaidML;" + configuration_string}
 {
 }
 
@@ -68,3 +75,36 @@ void ngraph::runtime::plaidml::PlaidML_Backend::remove_compiled_function(
         m_cache.forget(std::move(plaidml_exec));
     }
 }
+
+std::shared_ptr<ngraph::runtime::Executable>
+    ngraph::runtime::plaidml::PlaidML_Backend::load(std::istream& input_stream)
+{
+    cpio::Reader reader(input_stream);
+    std::unordered_map<std::string, std::string> entries;
+    for (const cpio::FileInfo& info : reader.get_file_info())
+    {
+        std::vector<char> buffer = reader.read(info);
+        entries[info.get_name()] = std::string(buffer.data(), buffer.size());
+    }
+    if (entries["save_info"] != "PlaidML Save File 1.0")
+    {
+        return nullptr;
+    }
+
+    auto split_lines = [](const std::string& text) {
+        std::vector<std::string> lines;
+        std::istringstream ss{text};
+        for (std::string line; std::getline(ss, line);)
+        {
+            lines.push_back(line);
+        }
+        return lines;
+    };
+
+    std::shared_ptr<Function> func = deserialize(entries["model"]);
+    return std::make_shared<PlaidML_Executable>(&m_config,
+                                                std::move(func),
+                                                vp::function{entries["program"]},
+                                                split_lines(entries["inputs"]),
+                                                split_lines(entries["outputs"]));
+}
@@ -59,6 +59,11 @@ public:
 
     void remove_compiled_function(std::shared_ptr<Executable> exec) final;
 
+    // Loads an executable written by PlaidML_Executable::save.
+    std::shared_ptr<Executable> load(std::istream& input_stream) final;
+
+    CompilationCache::Stats get_cache_stats() const { return m_cache.get_stats(); }
+
 private:
     Config m_config;
     Compiler m_compiler;
@@ -304,18 +304,22 @@ std::string ngraph::runtime::plaidml::builder::Function::to_string() const
 }
 
 vp::application ngraph::runtime::plaidml::builder::Function::finalize() const
+{
+    return apply(vp::function{to_string()});
+}
+
+vp::application ngraph::runtime::plaidml::builder::Function::apply(vp::function function) const
 {
     std::vector<vp::variable> params;
     for (auto& input : m_inputs)
     {
         params.emplace_back(input.m_var);
     }
-    auto str = to_string();
     if (m_debug)
     {
-        PLAIDML_DEBUG << "Built Tile code:\n" << str;
+        PLAIDML_DEBUG << "Built Tile code:\n" << to_string();
     }
-    return vp::function{str}.apply(params);
+    return function.apply(params);
 }
 
 ngraph::runtime::plaidml::builder::Function&
@@ -76,6 +76,10 @@ public:
     // Finalizes a function, transforming it into a PlaidML function application object.
     vertexai::plaidml::application finalize() const;
 
+    // Applies the function's inputs to a PlaidML function previously built from to_string(),
+    // e.g. one shared by identical functions.
+    vertexai::plaidml::application apply(vertexai::plaidml::function function) const;
+
     // Adds an input to the function.
     Function& add(Input input) &;
     Function&& add(Input input) &&;
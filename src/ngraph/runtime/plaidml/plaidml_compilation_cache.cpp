@@ -14,31 +14,143 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cstdlib>
+
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/compile_cache.hpp"
 #include "ngraph/runtime/plaidml/plaidml_compilation_cache.hpp"
 
+namespace
+{
+    // The memory a compiled function keeps alive is dominated by its constants and by the
+    // device tensors bound to its inputs and outputs
+    std::size_t estimate_bytes(const ngraph::Function& func)
+    {
+        std::size_t bytes = 0;
+        for (const auto& node : func.get_ops())
+        {
+            if (node->is_constant() || node->is_parameter() || node->is_output())
+            {
+                for (std::size_t i = 0; i < node->get_output_size(); ++i)
+                {
+                    bytes += ngraph::shape_size(node->get_output_shape(i)) *
+                             node->get_output_element_type(i).size();
+                }
+            }
+        }
+        return bytes;
+    }
+}
+
+std::size_t ngraph::runtime::plaidml::CompilationCache::get_default_max_bytes()
+{
+    static const std::size_t s_max_bytes = []() -> std::size_t {
+        const char* env = std::getenv("NGRAPH_PLAIDML_CACHE_BYTES");
+        return env ? static_cast<std::size_t>(std::strtoull(env, nullptr, 10))
+                   : std::size_t(1) << 30;
+    }();
+    return s_max_bytes;
+}
+
+ngraph::runtime::plaidml::CompilationCache::CompilationCache(Backend* backend,
+                                                             std::string device_description,
+                                                             std::size_t max_bytes)
+    : m_backend{backend}
+    , m_device_description{std::move(device_description)}
+    , m_max_bytes{max_bytes}
+{
+}
+
 std::shared_ptr<ngraph::runtime::plaidml::PlaidML_Executable>
     ngraph::runtime::plaidml::CompilationCache::compile(std::shared_ptr<Function> func,
                                                         Compiler* compiler)
 {
     std::lock_guard<std::mutex> lock{m_mu};
-    auto it_inserted = m_cache.insert(std::make_pair(func, std::shared_ptr<PlaidML_Executable>{}));
-    if (it_inserted.second)
+    auto it = m_cache.find(func);
+    if (it != m_cache.end())
     {
-        try
-        {
-            it_inserted.first->second = compiler->compile(func);
-        }
-        catch (...)
+        ++m_stats.hits;
+        m_lru.splice(m_lru.begin(), m_lru, it->second.lru_position);
+        return it->second.exec;
+    }
+
+    ++m_stats.misses;
+    auto exec = load_or_compile(func, compiler);
+    m_lru.push_front(func);
+    Entry entry{exec, estimate_bytes(*func), m_lru.begin()};
+    m_stats.bytes += entry.bytes;
+    m_cache.emplace(std::move(func), std::move(entry));
+    evict();
+    return exec;
+}
+
+std::shared_ptr<ngraph::runtime::plaidml::PlaidML_Executable>
+    ngraph::runtime::plaidml::CompilationCache::load_or_compile(
+        const std::shared_ptr<Function>& func, Compiler* compiler)
+{
+    runtime::CompileCache& disk_cache = runtime::CompileCache::get_default();
+    std::string key;
+    if (disk_cache.is_enabled() && m_backend)
+    {
+        key = disk_cache.get_key(func, m_device_description);
+        auto loaded = std::dynamic_pointer_cast<PlaidML_Executable>(
+            disk_cache.load(key, *m_backend));
+        if (loaded)
         {
-            m_cache.erase(it_inserted.first);
-            throw;
+            ++m_stats.disk_hits;
+            return loaded;
         }
     }
-    return it_inserted.first->second;
+
+    auto exec = compiler->compile(func);
+    if (!key.empty())
+    {
+        disk_cache.store(key, *exec);
+    }
+    return exec;
+}
+
+void ngraph::runtime::plaidml::CompilationCache::evict()
+{
+    // The most recent entry is kept even if it exceeds the bound on its own
+    while (m_stats.bytes > m_max_bytes && m_lru.size() > 1)
+    {
+        auto it = m_cache.find(m_lru.back());
+        NGRAPH_DEBUG << "Evicting PlaidML function " << it->first->get_name() << " ("
+                     << it->second.bytes << " bytes)";
+        m_stats.bytes -= it->second.bytes;
+        ++m_stats.evictions;
+        m_cache.erase(it);
+        m_lru.pop_back();
+    }
+    m_stats.entries = m_cache.size();
 }
 
 void ngraph::runtime::plaidml::CompilationCache::forget(std::shared_ptr<PlaidML_Executable> exec)
 {
     std::lock_guard<std::mutex> lock{m_mu};
-    m_cache.erase(exec->src_func());
+    // Executables loaded from disk have their own copy of the source function, so entries are
+    // matched on the executable
+    auto it = std::find_if(
+        m_cache.begin(),
+        m_cache.end(),
+        [&exec](const std::pair<const std::shared_ptr<Function>, Entry>& entry) {
+            return entry.second.exec == exec;
+        });
+    if (it != m_cache.end())
+    {
+        m_stats.bytes -= it->second.bytes;
+        m_lru.erase(it->second.lru_position);
+        m_cache.erase(it);
+        m_stats.entries = m_cache.size();
+    }
+}
+
+ngraph::runtime::plaidml::CompilationCache::Stats
+    ngraph::runtime::plaidml::CompilationCache::get_stats() const
+{
+    std::lock_guard<std::mutex> lock{m_mu};
+    return m_stats;
 }
@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <list>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 
 #include "ngraph/function.hpp"
@@ -28,6 +31,8 @@ namespace ngraph
 {
     namespace runtime
     {
+        class Backend;
+
         namespace plaidml
         {
             class CompilationCache;
@@ -36,9 +41,35 @@ namespace ngraph
 }
 
 // A compilation cacher.
+//
+// Compiled functions are kept in memory, least recently used first out once their estimated
+// size (constants and I/O tensors) exceeds the bound. When the nGraph compile cache is enabled
+// (NGRAPH_COMPILE_CACHE_DIR), compiled programs are also stored on disk, keyed by a hash of the
+// function and the device description, so that a restarted process skips compilation.
 class ngraph::runtime::plaidml::CompilationCache final
 {
 public:
+    struct Stats
+    {
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+        // Misses served from the on-disk cache
+        std::size_t disk_hits = 0;
+        std::size_t evictions = 0;
+        std::size_t entries = 0;
+        std::size_t bytes = 0;
+    };
+
+    // The bound on the estimated size of the cached functions. Defaults to
+    // NGRAPH_PLAIDML_CACHE_BYTES, or 1 GiB.
+    static std::size_t get_default_max_bytes();
+
+    // backend loads entries from the on-disk cache, and device_description distinguishes the
+    // entries of different devices and configurations.
+    CompilationCache(Backend* backend,
+                     std::string device_description,
+                     std::size_t max_bytes = get_default_max_bytes());
+
     // Looks up the supplied function in the compilation cache.  If the function is not in the
     // cache, compiles it using the specified compiler (which must not be nullptr), adds the
     // compiled function to the cache, and returns the compiled function.
@@ -47,10 +78,29 @@ public:
     // Drops the supplied function's compiled function from the compilation cache.
     void forget(std::shared_ptr<PlaidML_Executable> func);
 
+    Stats get_stats() const;
+
 private:
-    std::mutex m_mu;
+    struct Entry
+    {
+        std::shared_ptr<PlaidML_Executable> exec;
+        std::size_t bytes;
+        std::list<std::shared_ptr<Function>>::iterator lru_position;
+    };
+
+    std::shared_ptr<PlaidML_Executable> load_or_compile(const std::shared_ptr<Function>& func,
+                                                        Compiler* compiler);
+    void evict();
+
+    mutable std::mutex m_mu;
+    Backend* m_backend;
+    std::string m_device_description;
+    std::size_t m_max_bytes;
+    Stats m_stats;
 
     // N.B. The key here is the original source function, *not* the copy that's been processed by
     // the compilation passes.
-    std::unordered_map<std::shared_ptr<Function>, std::shared_ptr<PlaidML_Executable>> m_cache;
+    std::unordered_map<std::shared_ptr<Function>, Entry> m_cache;
+    // Most recently used first
+    std::list<std::shared_ptr<Function>> m_lru;
 };
@@ -40,6 +40,7 @@
 #include "ngraph/runtime/plaidml/plaidml_pass_lower_convolutions.hpp"
 #include "ngraph/runtime/plaidml/plaidml_pass_replicate_combination.hpp"
 #include "ngraph/runtime/plaidml/plaidml_pass_replicate_elision.hpp"
+#include "ngraph/runtime/plaidml/plaidml_pass_tile_chain_fusion.hpp"
 #include "ngraph/runtime/plaidml/plaidml_pass_winograd.hpp"
 
 namespace
@@ -110,6 +111,7 @@ std::shared_ptr<ngraph::runtime::plaidml::PlaidML_Executable>
     pass_manager.register_pass<ngraph::runtime::plaidml::pass::ReplicateElision>();
     pass_manager.register_pass<ngraph::runtime::plaidml::pass::ReplicateCombination>();
     pass_manager.register_pass<ngraph::runtime::plaidml::pass::ImplicitBroadcast>();
+    pass_manager.register_pass<ngraph::runtime::plaidml::pass::TileChainFusion>();
     pass_manager.register_pass<ngraph::runtime::plaidml::pass::LowerConvolutions>();
     if (pass_manager.get_pass_config().get_pass_enable("Winograd"))
     {
@@ -145,6 +147,18 @@ bool ngraph::runtime::plaidml::Compiler::is_supported(const Node& node) const
     return GlobalOpImplMap()->count(std::type_index(typeid(node))) != 0;
 }
 
+vertexai::plaidml::function
+    ngraph::runtime::plaidml::Compiler::get_function(const std::string& code)
+{
+    std::lock_guard<std::mutex> lock{m_functions_mutex};
+    auto it = m_functions.find(code);
+    if (it == m_functions.end())
+    {
+        it = m_functions.emplace(code, vertexai::plaidml::function{code}).first;
+    }
+    return it->second;
+}
+
 void ngraph::runtime::plaidml::Compiler::build(std::shared_ptr<Function> func, Build* b)
 {
     b->compiler = this;
@@ -17,6 +17,9 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 #include <plaidml/plaidml++.h>
 
@@ -46,8 +49,14 @@ public:
 
     bool is_supported(const Node& node) const;
 
+    // Returns the PlaidML function for the supplied Tile code, parsing the code only the first
+    // time it is seen, so that identical functions of this and later compilations are shared.
+    vertexai::plaidml::function get_function(const std::string& code);
+
 private:
     void build(std::shared_ptr<Function> func, Build* build);
 
     Config* m_config;
+    std::mutex m_functions_mutex;
+    std::unordered_map<std::string, vertexai::plaidml::function> m_functions;
 };
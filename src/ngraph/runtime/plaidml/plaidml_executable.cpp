@@ -14,13 +14,20 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
 #include <utility>
 
+#include "ngraph/cpio.hpp"
+#include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/runtime/plaidml/plaidml_build.hpp"
 #include "ngraph/runtime/plaidml/plaidml_executable.hpp"
 #include "ngraph/runtime/plaidml/plaidml_tensor.hpp"
 #include "ngraph/runtime/plaidml/plaidml_translate.hpp"
+#include "ngraph/serializer.hpp"
 
 namespace vp = vertexai::plaidml;
 
@@ -37,12 +44,214 @@ ngraph::runtime::plaidml::PlaidML_Executable::PlaidML_Executable(Build build,
     NGRAPH_DEBUG << "Compiled PlaidML function " << this;
 }
 
+ngraph::runtime::plaidml::PlaidML_Executable::PlaidML_Executable(
+    Config* config,
+    std::shared_ptr<Function> func,
+    const vp::function& program,
+    const std::vector<std::string>& input_names,
+    const std::vector<std::string>& output_names)
+    : m_config{config}
+    , m_func{func}
+    , m_src_func{std::move(func)}
+    , m_invoker{config->ctx, program}
+{
+    set_parameters_and_results(*m_func);
+    const auto& params = m_func->get_parameters();
+    const auto& results = m_func->get_results();
+    if (params.size() != input_names.size() || results.size() != output_names.size())
+    {
+        throw std::runtime_error{"Saved PlaidML program does not match its function"};
+    }
+    for (std::size_t idx = 0; idx < params.size(); ++idx)
+    {
+        m_input_names[params[idx]->get_output_tensor_ptr(0).get()] = input_names[idx];
+    }
+    for (std::size_t idx = 0; idx < results.size(); ++idx)
+    {
+        m_output_names[results[idx]->get_output_tensor_ptr(0).get()] = output_names[idx];
+    }
+    NGRAPH_DEBUG << "Loaded PlaidML function " << this;
+}
+
+namespace
+{
+    std::vector<ngraph::runtime::plaidml::PlaidML_Tensor*>
+        to_plaidml_tensors(const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>& tensors)
+    {
+        std::vector<ngraph::runtime::plaidml::PlaidML_Tensor*> result;
+        for (const auto& tensor : tensors)
+        {
+            auto rtv = dynamic_cast<ngraph::runtime::plaidml::PlaidML_Tensor*>(tensor.get());
+            if (!rtv)
+            {
+                throw std::runtime_error{
+                    "The PlaidML backend only operates on PlaidML tensor views"};
+            }
+            result.push_back(rtv);
+        }
+        return result;
+    }
+
+    // The first call has no previous stages to wait for
+    void wait_for(const std::shared_future<void>& stage)
+    {
+        if (stage.valid())
+        {
+            stage.wait();
+        }
+    }
+}
+
 bool ngraph::runtime::plaidml::PlaidML_Executable::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
 {
-    std::lock_guard<std::mutex> lock{m_mu};
+    auto pending = issue_call(outputs, inputs);
+    return run_call(*pending, outputs, inputs);
+}
 
+std::future<bool> ngraph::runtime::plaidml::PlaidML_Executable::call_async(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+    const AsyncCallback& callback)
+{
+    // The call takes its place in the order here, so that calls run in the order they were
+    // made even though the threads running them start in any order
+    auto pending = issue_call(outputs, inputs);
+    return std::async(std::launch::async, [this, pending, outputs, inputs, callback]() {
+        bool rc = false;
+        try
+        {
+            rc = run_call(*pending, outputs, inputs);
+        }
+        catch (...)
+        {
+            if (callback)
+            {
+                callback(false);
+            }
+            throw;
+        }
+        if (callback)
+        {
+            callback(rc);
+        }
+        return rc;
+    });
+}
+
+std::shared_ptr<ngraph::runtime::plaidml::PlaidML_Executable::PendingCall>
+    ngraph::runtime::plaidml::PlaidML_Executable::issue_call(
+        const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+        const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
+{
+    std::vector<runtime::Tensor*> tensors;
+    for (const auto& tensor : inputs)
+    {
+        tensors.push_back(tensor.get());
+    }
+    for (const auto& tensor : outputs)
+    {
+        tensors.push_back(tensor.get());
+    }
+
+    auto pending = std::make_shared<PendingCall>();
+    std::lock_guard<std::mutex> lock{m_issue_mu};
+    pending->previous = m_last;
+    m_last.uploaded = pending->uploaded.get_future().share();
+    m_last.invoked = pending->invoked.get_future().share();
+    m_last.done = pending->done.get_future().share();
+
+    // Copying the inputs while a call using the same tensors runs would change the data under
+    // it, so such a call waits for the previous ones to finish. Calls finish in order, so
+    // waiting for the last one is enough.
+    auto finished = [](const std::pair<std::vector<runtime::Tensor*>,
+                                       std::shared_future<void>>& in_flight) {
+        return in_flight.second.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    };
+    m_in_flight.erase(std::remove_if(m_in_flight.begin(), m_in_flight.end(), finished),
+                      m_in_flight.end());
+    for (const auto& in_flight : m_in_flight)
+    {
+        for (runtime::Tensor* tensor : tensors)
+        {
+            if (std::find(in_flight.first.begin(), in_flight.first.end(), tensor) !=
+                in_flight.first.end())
+            {
+                pending->serial = true;
+            }
+        }
+    }
+    m_in_flight.emplace_back(std::move(tensors), m_last.done);
+    return pending;
+}
+
+bool ngraph::runtime::plaidml::PlaidML_Executable::run_call(
+    PendingCall& call,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
+{
+    // Later calls wait for each stage of this one, so a failed call still passes them all
+    std::size_t stages_passed = 0;
+    try
+    {
+        if (call.serial)
+        {
+            wait_for(call.previous.done);
+        }
+        auto input_tensors = to_plaidml_tensors(inputs);
+        auto output_tensors = to_plaidml_tensors(outputs);
+
+        // Chunks still being streamed into the inputs are copied to the device as they arrive
+        runtime::Tensor::wait_for_fences(inputs);
+        wait_for(call.previous.uploaded);
+        NGRAPH_DEBUG << "Copying inputs of PlaidML function " << this;
+        for (auto rtv : input_tensors)
+        {
+            rtv->sync_input();
+        }
+        call.uploaded.set_value();
+        ++stages_passed;
+
+        wait_for(call.previous.invoked);
+        {
+            std::lock_guard<std::mutex> lock{m_mu};
+            invoke(outputs, inputs);
+        }
+        call.invoked.set_value();
+        ++stages_passed;
+
+        wait_for(call.previous.done);
+        for (auto rtv : output_tensors)
+        {
+            rtv->sync_output();
+        }
+        call.done.set_value();
+        ++stages_passed;
+    }
+    catch (...)
+    {
+        if (stages_passed < 1)
+        {
+            call.uploaded.set_value();
+        }
+        if (stages_passed < 2)
+        {
+            call.invoked.set_value();
+        }
+        if (stages_passed < 3)
+        {
+            call.done.set_value();
+        }
+        throw;
+    }
+    return true;
+}
+
+void ngraph::runtime::plaidml::PlaidML_Executable::invoke(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
+{
     NGRAPH_DEBUG << "Binding PlaidML function " << this;
 
     m_bound_inputs.resize(inputs.size());
@@ -55,13 +264,7 @@ bool ngraph::runtime::plaidml::PlaidML_Executable::call(
         {
             descriptor::Tensor* tv = param->get_output_tensor_ptr(idx).get();
             auto& input = inputs.at(input_count);
-            auto rtv = dynamic_cast<PlaidML_Tensor*>(input.get());
-            if (!rtv)
-            {
-                throw std::runtime_error{
-                    "The PlaidML backend only operates on PlaidML tensor views"};
-            }
-            rtv->sync_input();
+            auto rtv = static_cast<PlaidML_Tensor*>(input.get());
             auto& bound_input = m_bound_inputs.at(input_count);
             ++input_count;
             if (bound_input.lock() == input)
@@ -82,12 +285,7 @@ bool ngraph::runtime::plaidml::PlaidML_Executable::call(
         {
             descriptor::Tensor* tv = result->get_output_tensor_ptr(idx).get();
             auto& output = outputs.at(output_count);
-            auto rtv = dynamic_cast<PlaidML_Tensor*>(output.get());
-            if (!rtv)
-            {
-                throw std::runtime_error{
-                    "The PlaidML backend only operates on PlaidML tensor views"};
-            }
+            auto rtv = static_cast<PlaidML_Tensor*>(output.get());
             auto& bound_output = m_bound_outputs.at(output_count);
             ++output_count;
             if (bound_output.lock() == output)
@@ -105,22 +303,48 @@ bool ngraph::runtime::plaidml::PlaidML_Executable::call(
 
     m_invoker.invoke();
     m_bound = true;
+}
 
-    output_count = 0;
-    for (const auto& result : m_func->get_results())
+std::shared_ptr<ngraph::runtime::Tensor>
+    ngraph::runtime::plaidml::PlaidML_Executable::create_input_tensor(size_t input_index)
+{
+    const auto& param = get_parameters().at(input_index);
+    return std::make_shared<PlaidML_Tensor>(
+        m_config, param->get_element_type(), param->get_shape(), "direct_data", nullptr);
+}
+
+std::shared_ptr<ngraph::runtime::Tensor>
+    ngraph::runtime::plaidml::PlaidML_Executable::create_output_tensor(size_t output_index)
+{
+    const auto& result = get_results().at(output_index);
+    return std::make_shared<PlaidML_Tensor>(
+        m_config, result->get_element_type(), result->get_shape(), "direct_data", nullptr);
+}
+
+std::vector<std::shared_ptr<ngraph::runtime::Tensor>>
+    ngraph::runtime::plaidml::PlaidML_Executable::create_input_tensor(size_t input_index,
+                                                                      size_t pipeline_depth)
+{
+    // Each stage gets its own device buffer, so that the inputs of one stage are copied while
+    // a call on another runs
+    std::vector<std::shared_ptr<runtime::Tensor>> tensors;
+    for (size_t i = 0; i < pipeline_depth; i++)
     {
-        for (std::size_t idx = 0; idx < result->get_output_size(); ++idx)
-        {
-            auto rtv = dynamic_cast<PlaidML_Tensor*>(outputs[output_count++].get());
-            if (!rtv)
-            {
-                throw std::runtime_error{
-                    "The PlaidML backend only operates on PlaidML tensor views"};
-            }
-            rtv->sync_output();
-        }
+        tensors.push_back(create_input_tensor(input_index));
     }
-    return true;
+    return tensors;
+}
+
+std::vector<std::shared_ptr<ngraph::runtime::Tensor>>
+    ngraph::runtime::plaidml::PlaidML_Executable::create_output_tensor(size_t output_index,
+                                                                       size_t pipeline_depth)
+{
+    std::vector<std::shared_ptr<runtime::Tensor>> tensors;
+    for (size_t i = 0; i < pipeline_depth; i++)
+    {
+        tensors.push_back(create_output_tensor(output_index));
+    }
+    return tensors;
 }
 
 std::vector<ngraph::runtime::PerformanceCounter>
@@ -161,3 +385,43 @@ void ngraph::runtime::plaidml::PlaidML_Executable::save_as_format(const std::str
 
     m_invoker.save(filename, format);
 }
+
+void ngraph::runtime::plaidml::PlaidML_Executable::save(std::ostream& output_stream)
+{
+    // The invoker only saves to files
+    std::string tile_path = file_util::tmp_filename(".tile");
+    save_as_format(tile_path, PLAIDML_FILE_FORMAT_TILE);
+    std::string program;
+    {
+        std::ifstream tile_file{tile_path};
+        std::stringstream ss;
+        ss << tile_file.rdbuf();
+        program = ss.str();
+    }
+    file_util::remove_file(tile_path);
+
+    auto names = [](const std::unordered_map<descriptor::Tensor*, std::string>& names_map,
+                    const std::vector<std::shared_ptr<Node>>& nodes) {
+        std::string joined;
+        for (const auto& node : nodes)
+        {
+            joined += names_map.at(node->get_output_tensor_ptr(0).get()) + "\n";
+        }
+        return joined;
+    };
+    std::vector<std::shared_ptr<Node>> params(m_func->get_parameters().begin(),
+                                              m_func->get_parameters().end());
+    std::vector<std::shared_ptr<Node>> results(m_func->get_results().begin(),
+                                               m_func->get_results().end());
+    std::string input_names = names(m_input_names, params);
+    std::string output_names = names(m_output_names, results);
+
+    cpio::Writer writer(output_stream);
+    std::string save_info = "PlaidML Save File 1.0";
+    writer.write("save_info", save_info.data(), save_info.size());
+    std::string model = serialize(m_src_func, 0);
+    writer.write("model", model.data(), model.size());
+    writer.write("program", program.data(), program.size());
+    writer.write("inputs", input_names.data(), input_names.size());
+    writer.write("outputs", output_names.data(), output_names.size());
+}
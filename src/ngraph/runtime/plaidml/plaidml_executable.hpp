@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
 #include <mutex>
+#include <ostream>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -41,20 +43,87 @@ namespace ngraph
 }
 
 // A PlaidML executable object produced by compiling an nGraph function.
+//
+// A call passes three stages: its inputs are copied to the device, the program is invoked, and
+// its outputs are copied back to host memory. Calls pass each stage in the order they were
+// issued, but a call only waits for the previous one to finish the same stage, so with
+// call_async the inputs of a call are transferred while the previous call runs and its outputs
+// are read back while the next one runs. A call that shares a tensor with a call still in
+// flight waits for that call to finish first; use the tensors from create_input_tensor and
+// create_output_tensor with a pipeline depth of two to keep the transfers overlapped.
 class ngraph::runtime::plaidml::PlaidML_Executable final : public Executable
 {
 public:
     PlaidML_Executable(Build build, std::shared_ptr<Function> func);
+
+    // Rebuilds an executable saved by save(): program is the saved Tile program, and the names
+    // are those of its inputs and outputs, in parameter and result order.
+    PlaidML_Executable(Config* config,
+                       std::shared_ptr<Function> func,
+                       const vertexai::plaidml::function& program,
+                       const std::vector<std::string>& input_names,
+                       const std::vector<std::string>& output_names);
     virtual ~PlaidML_Executable() {}
     bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
               const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) final;
 
+    std::future<bool> call_async(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                                 const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                                 const AsyncCallback& callback = nullptr) final;
+
+    std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) final;
+    std::shared_ptr<runtime::Tensor> create_output_tensor(size_t output_index) final;
+    std::vector<std::shared_ptr<runtime::Tensor>>
+        create_input_tensor(size_t input_index, size_t pipeline_depth) final;
+    std::vector<std::shared_ptr<runtime::Tensor>>
+        create_output_tensor(size_t output_index, size_t pipeline_depth) final;
+
     std::vector<PerformanceCounter> get_performance_data() const final;
 
     void save_as_format(const std::string& filename, plaidml_file_format format) const;
 
+    // Saves the source function and the Tile program, for PlaidML_Backend::load.
+    void save(std::ostream& output_stream) final;
+
     const std::shared_ptr<Function>& src_func() const { return m_src_func; }
 private:
+    // Completion of the stages of an issued call
+    struct Stages
+    {
+        std::shared_future<void> uploaded;
+        std::shared_future<void> invoked;
+        std::shared_future<void> done;
+    };
+
+    // A call between issue_call and run_call
+    struct PendingCall
+    {
+        std::promise<void> uploaded;
+        std::promise<void> invoked;
+        std::promise<void> done;
+        Stages previous;
+        // Set when the call shares a tensor with a call in flight
+        bool serial = false;
+    };
+
+    // Takes the next place in the order of calls.
+    std::shared_ptr<PendingCall>
+        issue_call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                   const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+    // Runs the stages of an issued call on the calling thread.
+    bool run_call(PendingCall& call,
+                  const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                  const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+    // Binds the PlaidML tensors of a call to the invoker and invokes it; requires m_mu.
+    void invoke(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+    std::mutex m_issue_mu; // Orders the calls; guards m_last and m_in_flight.
+    Stages m_last;         // The stages of the last issued call.
+    // The tensors of the calls that may still be running, with their completion
+    std::vector<std::pair<std::vector<runtime::Tensor*>, std::shared_future<void>>> m_in_flight;
     mutable std::mutex m_mu; // Locks the invoker while scheduling invocations.
     mutable bool m_bound = false;
     Config* m_config;
@@ -0,0 +1,246 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <typeindex>
+#include <unordered_map>
+
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/ceiling.hpp"
+#include "ngraph/op/cos.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/floor.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/min.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/power.hpp"
+#include "ngraph/op/product.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sin.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/op/util/arithmetic_reduction.hpp"
+#include "ngraph/runtime/plaidml/plaidml_compiler.hpp"
+#include "ngraph/runtime/plaidml/plaidml_impl.hpp"
+#include "ngraph/runtime/plaidml/plaidml_ops_tile_chain.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace plaidml
+        {
+            NGRAPH_PLAIDML_OP_CLASS(ImplTileChain, OpImpl<plaidml::op::TileChain>);
+        }
+    }
+}
+
+namespace
+{
+    // The Tile expressions of the elementwise operations that can be chained; %0 and %1 stand
+    // for the operands.  These match the expressions of the operations' own implementations.
+    const std::unordered_map<std::type_index, std::string>& elementwise_expressions()
+    {
+        static const std::unordered_map<std::type_index, std::string> expressions{
+            {typeid(ngraph::op::Abs), "abs(%0)"},
+            {typeid(ngraph::op::Add), "%0 + %1"},
+            {typeid(ngraph::op::Ceiling), "ceil(%0)"},
+            {typeid(ngraph::op::Cos), "cos(%0)"},
+            {typeid(ngraph::op::Divide), "%0 / %1"},
+            {typeid(ngraph::op::Exp), "exp(%0)"},
+            {typeid(ngraph::op::Floor), "floor(%0)"},
+            {typeid(ngraph::op::Log), "log(%0)"},
+            {typeid(ngraph::op::Maximum), "max(%0, %1)"},
+            {typeid(ngraph::op::Minimum), "min(%0, %1)"},
+            {typeid(ngraph::op::Multiply), "%0 * %1"},
+            {typeid(ngraph::op::Negative), "-%0"},
+            {typeid(ngraph::op::Power), "pow(%0, %1)"},
+            {typeid(ngraph::op::Relu), "relu(%0)"},
+            {typeid(ngraph::op::Sigmoid), "1/(1+exp(-%0))"},
+            {typeid(ngraph::op::Sin), "sin(%0)"},
+            {typeid(ngraph::op::Sqrt), "sqrt(%0)"},
+            {typeid(ngraph::op::Subtract), "%0 - %1"},
+            {typeid(ngraph::op::Tanh), "tanh(%0)"}};
+        return expressions;
+    }
+
+    // The aggregation operations of the reductions that can be chained.
+    const std::unordered_map<std::type_index, std::string>& reduction_aggregations()
+    {
+        static const std::unordered_map<std::type_index, std::string> aggregations{
+            {typeid(ngraph::op::Max), ">"},
+            {typeid(ngraph::op::Min), "<"},
+            {typeid(ngraph::op::Product), "*"},
+            {typeid(ngraph::op::Sum), "+"}};
+        return aggregations;
+    }
+
+    // Substitutes the operand names into an elementwise expression.  Operands are parenthesized,
+    // since they may themselves be expressions.
+    std::string substitute_operands(std::string expr, const std::vector<std::string>& operands)
+    {
+        for (std::size_t idx = 0; idx < operands.size(); ++idx)
+        {
+            std::string placeholder = "%" + std::to_string(idx);
+            for (auto pos = expr.find(placeholder); pos != std::string::npos;
+                 pos = expr.find(placeholder, pos + operands[idx].size()))
+            {
+                expr.replace(pos, placeholder.size(), operands[idx]);
+            }
+        }
+        return expr;
+    }
+}
+
+constexpr ngraph::NodeTypeInfo ngraph::runtime::plaidml::op::TileChain::type_info;
+
+ngraph::runtime::plaidml::op::TileChain::TileChain(const OutputVector& args,
+                                                   std::shared_ptr<Function> chain)
+    : Op{args}
+    , m_chain{std::move(chain)}
+{
+    constructor_validate_and_infer_types();
+}
+
+void ngraph::runtime::plaidml::op::TileChain::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this,
+                          get_input_size() == m_chain->get_parameters().size(),
+                          "TileChain requires one input per chain parameter");
+    NODE_VALIDATION_CHECK(
+        this, m_chain->get_output_size() == 1, "TileChain requires a single chain result");
+    set_output_type(0, m_chain->get_output_element_type(0), m_chain->get_output_shape(0));
+}
+
+std::shared_ptr<ngraph::Node>
+    ngraph::runtime::plaidml::op::TileChain::copy_with_new_args(const NodeVector& new_args) const
+{
+    return std::make_shared<TileChain>(as_output_vector(new_args), m_chain);
+}
+
+bool ngraph::runtime::plaidml::op::TileChain::is_chainable(const Node& node)
+{
+    if (node.get_output_size() != 1 || !node.get_output_element_type(0).is_real())
+    {
+        return false;
+    }
+    std::type_index type{typeid(node)};
+    if (elementwise_expressions().count(type))
+    {
+        for (const auto& input : node.inputs())
+        {
+            if (!input.get_element_type().is_real())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (reduction_aggregations().count(type))
+    {
+        return static_cast<const ngraph::op::util::ArithmeticReduction&>(node)
+            .reduction_axes_constant();
+    }
+    return false;
+}
+
+// TileChain emits each operation of the chain as one statement of a single Tile function.
+void ngraph::runtime::plaidml::ImplTileChain::Apply()
+{
+    check_outputs(1);
+
+    const auto& chain = op().get_chain();
+    check_inputs(chain->get_parameters().size());
+    const Node* root = chain->get_results().at(0)->get_argument(0).get();
+
+    auto f = start_tile_function();
+    std::unordered_map<const Node*, std::string> names;
+    std::size_t input_idx = 0;
+    for (const auto& param : chain->get_parameters())
+    {
+        std::string name = "I" + std::to_string(input_idx);
+        f.add(builder::Input{op_input(input_idx), name});
+        names.emplace(param.get(), name);
+        ++input_idx;
+    }
+    f.add(builder::Output{"O"});
+
+    std::size_t temp_idx = 0;
+    for (const auto& node : chain->get_ordered_ops())
+    {
+        if (node->is_parameter() || node->is_constant() || node->is_output())
+        {
+            continue;
+        }
+        std::string name = node.get() == root ? "O" : "T" + std::to_string(temp_idx++);
+        std::type_index type{typeid(*node)};
+        auto eit = elementwise_expressions().find(type);
+        if (eit != elementwise_expressions().end())
+        {
+            std::vector<std::string> operands;
+            for (const auto& input : node->inputs())
+            {
+                operands.emplace_back("(" + names.at(input.get_source_output().get_node()) +
+                                      ")");
+            }
+            f.add(builder::Elementwise{name, substitute_operands(eit->second, operands)});
+        }
+        else
+        {
+            const auto& reduction =
+                static_cast<const ngraph::op::util::ArithmeticReduction&>(*node);
+            auto axes = reduction.get_reduction_axes();
+            auto in_shape = node->get_input_shape(0);
+            f.add(builder::UnaryContraction{reduction_aggregations().at(type)}
+                      .set(builder::ContractionOutput{name}
+                               .add_indices([&](
+                                   std::back_insert_iterator<std::list<std::string>> out) {
+                                   for (std::size_t idx = 0; idx < in_shape.size(); ++idx)
+                                   {
+                                       if (!axes.count(idx))
+                                       {
+                                           out = "d" + std::to_string(idx);
+                                       }
+                                   }
+                               })
+                               .add_dims([&](
+                                   std::back_insert_iterator<std::list<std::string>> out) {
+                                   for (std::size_t idx = 0; idx < in_shape.size(); ++idx)
+                                   {
+                                       if (!axes.count(idx))
+                                       {
+                                           out = std::to_string(in_shape[idx]);
+                                       }
+                                   }
+                               }))
+                      .set(builder::ContractionInput{names.at(node->get_argument(0).get())}
+                               .add_indices("d", 0, in_shape.size())));
+        }
+        names.emplace(node.get(), name);
+    }
+
+    // Identical chains over identically shaped inputs produce identical Tile code, so they share
+    // one PlaidML function through the compiler.
+    set_output(f.apply(build()->compiler->get_function(f.to_string())));
+}
@@ -0,0 +1,60 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "ngraph/function.hpp"
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace plaidml
+        {
+            namespace op
+            {
+                class TileChain;
+            }
+        }
+    }
+}
+
+// TileChain computes a chain of elementwise and reduction operations as a single Tile function,
+// so that the intermediate tensors of the chain are never written out.  The chain is held as an
+// nGraph function whose parameters are the inputs of the TileChain and whose single result is
+// its output.
+class ngraph::runtime::plaidml::op::TileChain final : public ngraph::op::Op
+{
+public:
+    static constexpr NodeTypeInfo type_info{"plaidmlTileChain", 0};
+    const NodeTypeInfo& get_type_info() const override { return type_info; }
+    TileChain(const OutputVector& args, std::shared_ptr<Function> chain);
+
+    void validate_and_infer_types() final;
+
+    std::shared_ptr<Node> copy_with_new_args(const NodeVector& new_args) const final;
+
+    const std::shared_ptr<Function>& get_chain() const { return m_chain; }
+    /// \return True if the operation can be part of a chain.
+    static bool is_chainable(const Node& node);
+
+private:
+    std::shared_ptr<Function> m_chain;
+};
@@ -0,0 +1,171 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/util/arithmetic_reduction.hpp"
+#include "ngraph/runtime/plaidml/plaidml_ops_implicit_broadcast.hpp"
+#include "ngraph/runtime/plaidml/plaidml_ops_tile_chain.hpp"
+#include "ngraph/runtime/plaidml/plaidml_pass_tile_chain_fusion.hpp"
+
+namespace
+{
+    bool is_reduction(const ngraph::Node& node)
+    {
+        return dynamic_cast<const ngraph::op::util::ArithmeticReduction*>(&node) != nullptr;
+    }
+
+    // The inputs of a chained operation that carry tensor data; the reduction axes input of a
+    // reduction is a constant, and is copied into the chain instead.
+    std::size_t data_input_count(const ngraph::Node& node)
+    {
+        return is_reduction(node) ? 1 : node.get_input_size();
+    }
+
+    // Grows a chain backwards from its last operation, adding chainable producers all of whose
+    // users are already in the chain, until no more can be added.  Operations of chains that
+    // have already been fused are no longer part of the graph, and are not counted as users.
+    std::unordered_set<ngraph::Node*>
+        grow_chain(const std::shared_ptr<ngraph::Node>& root,
+                   const std::unordered_set<ngraph::Node*>& fused)
+    {
+        std::unordered_set<ngraph::Node*> members{root.get()};
+        std::vector<ngraph::Node*> member_list{root.get()};
+        for (bool grown = true; grown;)
+        {
+            grown = false;
+            for (std::size_t midx = 0; midx < member_list.size(); ++midx)
+            {
+                ngraph::Node* member = member_list[midx];
+                for (std::size_t idx = 0; idx < data_input_count(*member); ++idx)
+                {
+                    ngraph::Node* arg = member->get_input_node_ptr(idx);
+                    if (members.count(arg) || fused.count(arg) ||
+                        !ngraph::runtime::plaidml::op::TileChain::is_chainable(*arg) ||
+                        !arg->get_control_dependencies().empty())
+                    {
+                        continue;
+                    }
+                    bool all_users_in_chain = true;
+                    for (const auto& user : arg->get_users())
+                    {
+                        if (!members.count(user.get()) && !fused.count(user.get()))
+                        {
+                            all_users_in_chain = false;
+                            break;
+                        }
+                    }
+                    if (all_users_in_chain)
+                    {
+                        members.insert(arg);
+                        member_list.push_back(arg);
+                        grown = true;
+                    }
+                }
+            }
+        }
+        return members;
+    }
+}
+
+bool ngraph::runtime::plaidml::pass::TileChainFusion::run_on_function(
+    std::shared_ptr<Function> func)
+{
+    bool modified = false;
+    auto ops = func->get_ordered_ops();
+    std::vector<std::shared_ptr<Node>> ordered_ops{ops.begin(), ops.end()};
+    std::unordered_set<Node*> fused;
+
+    for (auto rit = ordered_ops.rbegin(); rit != ordered_ops.rend(); ++rit)
+    {
+        const auto& root = *rit;
+        if (fused.count(root.get()) || !op::TileChain::is_chainable(*root))
+        {
+            continue;
+        }
+        auto members = grow_chain(root, fused);
+        if (members.size() < 2)
+        {
+            continue;
+        }
+
+        // Copy the chain, in topological order, onto one parameter per distinct input.
+        OutputVector args;
+        ParameterVector params;
+        std::unordered_map<Node*, std::shared_ptr<Node>> copies;
+        std::map<Output<Node>, std::shared_ptr<ngraph::op::Parameter>> inputs;
+        bool has_reduction = false;
+        bool has_implicit_broadcast = false;
+        for (const auto& node : ordered_ops)
+        {
+            if (!members.count(node.get()))
+            {
+                continue;
+            }
+            has_reduction |= is_reduction(*node);
+            OutputVector new_args;
+            for (std::size_t idx = 0; idx < node->get_input_size(); ++idx)
+            {
+                auto value = node->input_value(idx);
+                if (idx >= data_input_count(*node))
+                {
+                    new_args.push_back(value.get_node()->copy_with_new_inputs(OutputVector{}));
+                }
+                else if (members.count(value.get_node()))
+                {
+                    new_args.push_back(copies.at(value.get_node()));
+                }
+                else
+                {
+                    auto& param = inputs[value];
+                    if (!param)
+                    {
+                        param = std::make_shared<ngraph::op::Parameter>(
+                            value.get_element_type(), value.get_shape());
+                        args.push_back(value);
+                        params.push_back(param);
+                        has_implicit_broadcast |=
+                            is_type<plaidml::op::ImplicitBroadcast>(value.get_node());
+                    }
+                    new_args.push_back(param);
+                }
+            }
+            copies.emplace(node.get(), node->copy_with_new_inputs(new_args));
+        }
+
+        // An implicit broadcast's tensor has fewer elements than its shape claims; that is only
+        // safe for elementwise operations, which broadcast it on the fly.
+        if (has_reduction && has_implicit_broadcast)
+        {
+            continue;
+        }
+
+        auto chain = std::make_shared<Function>(OutputVector{copies.at(root.get())}, params);
+        NGRAPH_DEBUG << "Fusing " << members.size() << " operations into a TileChain ending at "
+                     << root->get_name();
+        replace_node(root, std::make_shared<op::TileChain>(args, chain));
+        fused.insert(members.begin(), members.end());
+        modified = true;
+    }
+    return modified;
+}
@@ -0,0 +1,45 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace plaidml
+        {
+            namespace pass
+            {
+                class TileChainFusion;
+            }
+        }
+    }
+}
+
+// Fuses chains of elementwise and reduction operations into TileChain operations.
+//
+// Each operation becomes a separate Tile function, which writes its whole output tensor to
+// memory only for the next operation to read it back.  A chain is grown backwards from its last
+// operation through the producers whose outputs are only used within the chain; chains of two
+// or more operations are replaced by a single TileChain.
+class ngraph::runtime::plaidml::pass::TileChainFusion final : public ngraph::pass::FunctionPass
+{
+public:
+    bool run_on_function(std::shared_ptr<Function> func) override;
+};
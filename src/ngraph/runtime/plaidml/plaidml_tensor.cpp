@@ -80,6 +80,32 @@ void ngraph::runtime::plaidml::PlaidML_Tensor::write(const void* p, size_t n)
     std::copy(src, src + n, dest);
 }
 
+void ngraph::runtime::plaidml::PlaidML_Tensor::write_at(const void* p, size_t offset, size_t n)
+{
+    NGRAPH_DEBUG << "Write " << this << " offset=" << offset << " n=" << n;
+
+    if (offset + n > m_tensor.get_shape().buffer_size())
+    {
+        throw std::out_of_range("write access past end of tensor");
+    }
+
+    std::lock_guard<std::mutex> lock{m_write_mutex};
+    vp::mapping<char> mp;
+    if (m_is_logically_zero)
+    {
+        mp = m_tensor.map(vp::map_for_write);
+        std::fill_n(mp.raw(), m_tensor.get_shape().buffer_size(), 0);
+        m_is_logically_zero = false;
+    }
+    else
+    {
+        mp = m_tensor.map(vp::map_for_update);
+    }
+
+    const char* src = static_cast<const char*>(p);
+    std::copy(src, src + n, mp.raw() + offset);
+}
+
 void ngraph::runtime::plaidml::PlaidML_Tensor::read(void* p, size_t n) const
 {
     NGRAPH_DEBUG << "Read " << this << " n=" << n << " is_logically_zero=" << m_is_logically_zero;
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <mutex>
+
 #include <plaidml/plaidml++.h>
 
 #include "ngraph/runtime/plaidml/plaidml_config.hpp"
@@ -43,6 +45,7 @@ public:
     ~PlaidML_Tensor() final {}
     const vertexai::plaidml::tensor<char>& tensor() const { return m_tensor; }
     void write(const void* p, size_t n) final;
+    void write_at(const void* p, size_t offset, size_t n) final;
     void read(void* p, size_t n) const final;
 
     // Copy the backing memory to the tensor, if needed.
@@ -56,4 +59,6 @@ private:
     void* m_memory;
     size_t m_memory_size;
     bool m_is_logically_zero;
+    // Chunks written by concurrent write_at calls map the buffer one at a time
+    std::mutex m_write_mutex;
 };
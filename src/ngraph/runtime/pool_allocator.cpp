@@ -0,0 +1,258 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/pool_allocator.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Every block starts with a header_size region; the last bytes of it, right in front of
+    // the pointer handed out, describe the block.
+    struct BlockHeader
+    {
+        size_t size_class;
+        size_t offset;
+        size_t requested_size;
+    };
+
+    constexpr size_t s_base_alignment = 64;
+    constexpr size_t s_huge_page_size = 2 * 1024 * 1024;
+    constexpr size_t s_min_class_shift = 6; // 64 bytes
+    constexpr size_t s_max_class_shift = 40;
+    constexpr size_t s_classes_per_shift = 4;
+    constexpr size_t s_num_classes = (s_max_class_shift - s_min_class_shift) * s_classes_per_shift;
+
+    size_t log2_floor(size_t x)
+    {
+        size_t rc = 0;
+        while (x >>= 1)
+        {
+            rc++;
+        }
+        return rc;
+    }
+}
+
+double runtime::PoolAllocator::Statistics::fragmentation() const
+{
+    return reserved_bytes == 0 ? 0.0 : 1.0 - static_cast<double>(live_bytes) / reserved_bytes;
+}
+
+runtime::PoolAllocator::PoolAllocator(bool use_huge_pages, size_t max_cached_bytes)
+    : m_use_huge_pages(use_huge_pages)
+    , m_max_cached_bytes(max_cached_bytes)
+    , m_classes(new SizeClass[s_num_classes])
+{
+}
+
+runtime::PoolAllocator::~PoolAllocator()
+{
+    trim();
+}
+
+size_t runtime::PoolAllocator::get_size_class(size_t size)
+{
+    size = max(size, size_t(1) << s_min_class_shift);
+    size_t shift = log2_floor(size - 1);
+    if (shift < s_min_class_shift)
+    {
+        return 0;
+    }
+    // Split [2^shift, 2^(shift+1)) into s_classes_per_shift equal steps
+    size_t step = (size_t(1) << shift) / s_classes_per_shift;
+    size_t sub = ((size - 1) - (size_t(1) << shift)) / step;
+    size_t size_class = (shift - s_min_class_shift) * s_classes_per_shift + sub + 1;
+    if (size_class >= s_num_classes)
+    {
+        throw ngraph_error("PoolAllocator cannot allocate " + to_string(size) + " bytes");
+    }
+    return size_class;
+}
+
+size_t runtime::PoolAllocator::get_class_size(size_t size_class)
+{
+    if (size_class == 0)
+    {
+        return size_t(1) << s_min_class_shift;
+    }
+    size_t shift = (size_class - 1) / s_classes_per_shift + s_min_class_shift;
+    size_t sub = (size_class - 1) % s_classes_per_shift + 1;
+    return (size_t(1) << shift) + sub * ((size_t(1) << shift) / s_classes_per_shift);
+}
+
+void* runtime::PoolAllocator::allocate_block(size_t block_size)
+{
+    void* block = nullptr;
+#ifdef _WIN32
+    block = _aligned_malloc(block_size, s_base_alignment);
+#else
+    size_t alignment = s_base_alignment;
+    if (m_use_huge_pages && block_size >= s_huge_page_size)
+    {
+        alignment = s_huge_page_size;
+    }
+    if (posix_memalign(&block, alignment, block_size) != 0)
+    {
+        block = nullptr;
+    }
+#endif
+    if (block == nullptr)
+    {
+        throw ngraph_error("PoolAllocator failed to allocate memory of size " +
+                           to_string(block_size));
+    }
+#ifdef __linux__
+    if (m_use_huge_pages && block_size >= s_huge_page_size)
+    {
+        madvise(block, block_size, MADV_HUGEPAGE);
+    }
+#endif
+    m_reserved_bytes += block_size;
+    return block;
+}
+
+void runtime::PoolAllocator::release_block(void* block, size_t block_size)
+{
+#ifdef _WIN32
+    _aligned_free(block);
+#else
+    std::free(block);
+#endif
+    m_reserved_bytes -= block_size;
+}
+
+void* runtime::PoolAllocator::malloc(size_t size, size_t alignment)
+{
+    alignment = max(alignment, s_base_alignment);
+    if ((alignment & (alignment - 1)) != 0)
+    {
+        throw ngraph_error("PoolAllocator alignment must be a power of two, got " +
+                           to_string(alignment));
+    }
+    // Blocks are only guaranteed s_base_alignment, so over-aligned requests reserve one extra
+    // alignment worth of slack to slide the returned pointer into place.
+    size_t header_size = alignment;
+    size_t slack = alignment > s_base_alignment ? alignment : 0;
+    size_t size_class = get_size_class(size + header_size + slack);
+    size_t block_size = get_class_size(size_class);
+
+    void* block = nullptr;
+    {
+        SizeClass& cls = m_classes[size_class];
+        lock_guard<mutex> lock(cls.mutex);
+        if (!cls.free_blocks.empty())
+        {
+            block = cls.free_blocks.back();
+            cls.free_blocks.pop_back();
+        }
+    }
+    if (block != nullptr)
+    {
+        m_cached_bytes -= block_size;
+        m_reuse_count++;
+    }
+    else
+    {
+        block = allocate_block(block_size);
+    }
+
+    char* ptr = static_cast<char*>(block);
+    size_t offset = header_size;
+    size_t mod = reinterpret_cast<uintptr_t>(ptr + offset) % alignment;
+    if (mod != 0)
+    {
+        offset += alignment - mod;
+    }
+
+    BlockHeader* header = reinterpret_cast<BlockHeader*>(ptr + offset) - 1;
+    header->size_class = size_class;
+    header->offset = offset;
+    header->requested_size = size;
+
+    m_allocation_count++;
+    size_t live = (m_live_bytes += size);
+    size_t peak = m_peak_live_bytes.load();
+    while (live > peak && !m_peak_live_bytes.compare_exchange_weak(peak, live))
+    {
+    }
+    return ptr + offset;
+}
+
+void runtime::PoolAllocator::free(void* ptr)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    BlockHeader* header = static_cast<BlockHeader*>(ptr) - 1;
+    size_t size_class = header->size_class;
+    size_t block_size = get_class_size(size_class);
+    void* block = static_cast<char*>(ptr) - header->offset;
+    m_live_bytes -= header->requested_size;
+
+    // Reserve room in the cache before caching the block, so that concurrent frees of
+    // different size classes cannot together push the cache past m_max_cached_bytes
+    size_t cached = m_cached_bytes.load();
+    do
+    {
+        if (cached + block_size > m_max_cached_bytes)
+        {
+            release_block(block, block_size);
+            return;
+        }
+    } while (!m_cached_bytes.compare_exchange_weak(cached, cached + block_size));
+    SizeClass& cls = m_classes[size_class];
+    lock_guard<mutex> lock(cls.mutex);
+    cls.free_blocks.push_back(block);
+}
+
+void runtime::PoolAllocator::trim()
+{
+    for (size_t i = 0; i < s_num_classes; i++)
+    {
+        SizeClass& cls = m_classes[i];
+        size_t block_size = get_class_size(i);
+        lock_guard<mutex> lock(cls.mutex);
+        for (void* block : cls.free_blocks)
+        {
+            release_block(block, block_size);
+            m_cached_bytes -= block_size;
+        }
+        cls.free_blocks.clear();
+    }
+}
+
+runtime::PoolAllocator::Statistics runtime::PoolAllocator::get_statistics() const
+{
+    Statistics stats;
+    stats.live_bytes = m_live_bytes;
+    stats.peak_live_bytes = m_peak_live_bytes;
+    stats.reserved_bytes = m_reserved_bytes;
+    stats.allocation_count = m_allocation_count;
+    stats.reuse_count = m_reuse_count;
+    return stats;
+}
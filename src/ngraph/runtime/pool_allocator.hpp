@@ -0,0 +1,105 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/ngraph_visibility.hpp"
+#include "ngraph/runtime/allocator.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class PoolAllocator;
+    }
+}
+
+/// \brief Allocator that keeps freed blocks in size-class free lists for reuse.
+///
+/// Requests are rounded up to one of four size classes per power of two (so at most 25%
+/// internal waste) and served from the matching free list when possible. Each class has its
+/// own lock, so concurrent allocations of different sizes do not contend. Blocks are 64-byte
+/// aligned (or more if requested) and, when huge pages are enabled, blocks of 2MB and up are
+/// advised to the kernel as transparent huge page candidates on Linux.
+///
+/// Install it with Backend::set_host_memory_allocator before compiling so that executables
+/// and their runtime contexts draw their buffers from the pool. The allocator must outlive
+/// every buffer allocated from it.
+class NGRAPH_API ngraph::runtime::PoolAllocator : public ngraph::runtime::Allocator
+{
+public:
+    struct Statistics
+    {
+        /// Bytes currently handed out, as requested by callers
+        size_t live_bytes;
+        /// High-water mark of live_bytes
+        size_t peak_live_bytes;
+        /// Bytes obtained from the system, including blocks parked in free lists
+        size_t reserved_bytes;
+        /// Number of malloc calls
+        size_t allocation_count;
+        /// Number of malloc calls served from a free list
+        size_t reuse_count;
+        /// 1 - live_bytes / reserved_bytes; the share of reserved memory not in use
+        double fragmentation() const;
+    };
+
+    /// \param use_huge_pages Advise large blocks as huge page candidates
+    /// \param max_cached_bytes Upper bound on bytes parked in free lists; blocks freed beyond
+    ///                         it are returned to the system
+    PoolAllocator(bool use_huge_pages = false, size_t max_cached_bytes = SIZE_MAX);
+    ~PoolAllocator() override;
+
+    void* malloc(size_t size, size_t alignment) override;
+    void free(void* ptr) override;
+
+    /// \brief Return every block parked in the free lists to the system
+    void trim();
+
+    Statistics get_statistics() const;
+
+private:
+    PoolAllocator(const PoolAllocator&) = delete;
+    PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+    struct SizeClass
+    {
+        std::mutex mutex;
+        std::vector<void*> free_blocks;
+    };
+
+    static size_t get_size_class(size_t size);
+    static size_t get_class_size(size_t size_class);
+    void* allocate_block(size_t block_size);
+    void release_block(void* block, size_t block_size);
+
+    bool m_use_huge_pages;
+    size_t m_max_cached_bytes;
+    std::unique_ptr<SizeClass[]> m_classes;
+
+    std::atomic<size_t> m_live_bytes{0};
+    std::atomic<size_t> m_peak_live_bytes{0};
+    std::atomic<size_t> m_reserved_bytes{0};
+    std::atomic<size_t> m_cached_bytes{0};
+    std::atomic<size_t> m_allocation_count{0};
+    std::atomic<size_t> m_reuse_count{0};
+};
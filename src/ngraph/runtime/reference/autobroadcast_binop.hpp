@@ -16,11 +16,13 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
 #include "ngraph/shape_util.hpp"
+#include "ngraph/strided_loop.hpp"
 
 namespace ngraph
 {
@@ -28,6 +30,82 @@ namespace ngraph
     {
         namespace reference
         {
+            /// \brief Applies a binary functor at every point of an output shape, reading each
+            ///        argument with a stride of zero along the axes it is broadcast on.
+            ///
+            /// \param arg0_shape Shape of the left operand, of the rank of `out_shape`. Axes of
+            ///                   length one are broadcast.
+            /// \param arg1_shape Shape of the right operand, of the rank of `out_shape`. Axes of
+            ///                   length one are broadcast.
+            /// \param out_shape Shape of the output tensor.
+            template <typename T, typename U, typename Functor>
+            void broadcast_binop(const T* arg0,
+                                 const T* arg1,
+                                 U* out,
+                                 const Shape& arg0_shape,
+                                 const Shape& arg1_shape,
+                                 const Shape& out_shape,
+                                 Functor elementwise_functor)
+            {
+                auto arg0_strides = row_major_strides(arg0_shape);
+                auto arg1_strides = row_major_strides(arg1_shape);
+                for (size_t i = 0; i < out_shape.size(); i++)
+                {
+                    if (arg0_shape[i] == 1)
+                    {
+                        arg0_strides[i] = 0;
+                    }
+                    if (arg1_shape[i] == 1)
+                    {
+                        arg1_strides[i] = 0;
+                    }
+                }
+
+                for_each_strided_run<3>(
+                    out_shape,
+                    {{arg0_strides, arg1_strides, row_major_strides(out_shape)}},
+                    {{0, 0, 0}},
+                    [&](const std::array<size_t, 3>& offsets,
+                        size_t count,
+                        const std::array<size_t, 3>& inner_strides) {
+                        const T* a = arg0 + offsets[0];
+                        const T* b = arg1 + offsets[1];
+                        U* r = out + offsets[2];
+                        // The output is contiguous, so each input steps by 0 or 1
+                        if (inner_strides[0] == 1 && inner_strides[1] == 1)
+                        {
+                            for (size_t i = 0; i < count; i++)
+                            {
+                                r[i] = elementwise_functor(a[i], b[i]);
+                            }
+                        }
+                        else if (inner_strides[0] == 1)
+                        {
+                            T y = b[0];
+                            for (size_t i = 0; i < count; i++)
+                            {
+                                r[i] = elementwise_functor(a[i], y);
+                            }
+                        }
+                        else if (inner_strides[1] == 1)
+                        {
+                            T x = a[0];
+                            for (size_t i = 0; i < count; i++)
+                            {
+                                r[i] = elementwise_functor(x, b[i]);
+                            }
+                        }
+                        else
+                        {
+                            U value = elementwise_functor(a[0], b[0]);
+                            for (size_t i = 0; i < count; i++)
+                            {
+                                r[i] = value;
+                            }
+                        }
+                    });
+            }
+
             /// \brief Helper function to implement autobroadcasting elementwise binop references.
             ///
             /// \tparam T Element type of the input tensors.
@@ -63,22 +141,16 @@ namespace ngraph
                     }
                     break;
                 case op::AutoBroadcastType::NUMPY:
-                    // We'll be using CoordinateTransform to handle the broadcasting. The general
-                    // procedure is as follows:
-                    //
-                    // (1) Left pad the shorter of the two shapes with ones.
-                    // (2) Squeeze (remove ones from) both shapes, and record the squeezed axis
-                    //     indices.
-                    // (3) Using CoordinateTransform, broadcast both args to the final output
-                    //     shape. The "broadcasted axes" will be those that were squeezed in step
-                    //     2.
+                    // The shorter of the two shapes is left padded with ones. Each output axis
+                    // then reads an argument with a stride of zero where that argument has
+                    // length one, so neither argument is materialized at the output shape.
                     //
                     // Example:
                     //
-                    //    Input shape->Padded shape->Squeezed Shape/Squeezed Axes
-                    //    -----------  ------------  ----------------------------
-                    // a: [ 3, 2, 1]   [ 3, 2, 1]    [ 3, 2   ]     {2}
-                    // b: [    1, 6]   [ 1, 1, 6]    [       6]     {0,1}
+                    //    Input shape->Padded shape->Strides
+                    //    -----------  ------------  ---------
+                    // a: [ 3, 2, 1]   [ 3, 2, 1]    [2, 1, 0]
+                    // b: [    1, 6]   [ 1, 1, 6]    [0, 0, 1]
                     //                   |  |  |
                     //                   v  v  v
                     //                 Output shape
@@ -98,71 +170,38 @@ namespace ngraph
                             arg1_padded_shape.insert(arg1_padded_shape.begin(), 1);
                         }
 
-                        Shape arg0_squeezed_shape;
-                        Shape arg1_squeezed_shape;
-                        AxisSet arg0_squeezed_axes;
-                        AxisSet arg1_squeezed_axes;
                         Shape output_shape;
-
                         for (size_t i = 0; i < arg0_padded_shape.size(); i++)
                         {
-                            if (arg0_padded_shape[i] == 1)
-                            {
-                                arg0_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg0_squeezed_shape.push_back(arg0_padded_shape[i]);
-                            }
-
-                            if (arg1_padded_shape[i] == 1)
-                            {
-                                arg1_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg1_squeezed_shape.push_back(arg1_padded_shape[i]);
-                            }
-
                             output_shape.push_back(arg0_padded_shape[i] == 1
                                                        ? arg1_padded_shape[i]
                                                        : arg0_padded_shape[i]);
                         }
 
-                        CoordinateTransform arg0_transform(arg0_squeezed_shape);
-                        CoordinateTransform arg1_transform(arg1_squeezed_shape);
-                        CoordinateTransform output_transform(output_shape);
-
-                        for (const Coordinate& output_coord : output_transform)
-                        {
-                            Coordinate arg0_coord = reduce(output_coord, arg0_squeezed_axes);
-                            Coordinate arg1_coord = reduce(output_coord, arg1_squeezed_axes);
-                            out[output_transform.index(output_coord)] =
-                                elementwise_functor(arg0[arg0_transform.index(arg0_coord)],
-                                                    arg1[arg1_transform.index(arg1_coord)]);
-                        }
+                        broadcast_binop(arg0,
+                                        arg1,
+                                        out,
+                                        arg0_padded_shape,
+                                        arg1_padded_shape,
+                                        output_shape,
+                                        elementwise_functor);
                     }
                     break;
                 case op::AutoBroadcastType::PDPD:
-                    // We'll be using CoordinateTransform to handle the broadcasting. No need to
-                    // process arg0 and output shape will be the same as arg0. We need to process
-                    // arg1 and the general procedure is as follows:
+                    // No need to process arg0 and output shape will be the same as arg0. arg1
+                    // is processed as follows:
                     //
                     // (1) Trim trailing ones from arg1 shape.
                     // (2) Left and right pad arg1 to match arg0 shape. Axis is the index start
                     //     to align between arg0 and arg1.
-                    // (3) Squeeze (remove ones from) arg1 shape, and record the squeezed axis
-                    //     indices.
-                    // (3) Using CoordinateTransform, broadcast arg1 to the final output
-                    //     shape. The "broadcasted axes" will be those that were squeezed in step
-                    //     23.
+                    // (3) Read arg1 with a stride of zero along the padded axes.
                     //
                     // Example:
                     //
-                    //    Input shape->   Padded shape->   Squeezed Shape/Squeezed Axes
-                    //    -----------  ------------  ----------------------------
-                    // a: [ 3, 4, 5, 6]   [ 3, 4, 5, 6]    [ 3, 4, 5, 6]
-                    // b: [    4, 5,  ]   [ 1, 4, 5, 1]    [    4, 5   ]     {0,3}
+                    //    Input shape->   Padded shape->   Strides
+                    //    -----------  ------------  ---------
+                    // a: [ 3, 4, 5, 6]   [ 3, 4, 5, 6]    [120, 30, 6, 1]
+                    // b: [    4, 5,  ]   [ 1, 4, 5, 1]    [  0,  5, 1, 0]
                     //                      |  |  |
                     //                      v  v  v
                     //                     Output shape
@@ -192,32 +231,13 @@ namespace ngraph
                             arg1_padded_shape.insert(arg1_padded_shape.end(), 1);
                         }
 
-                        Shape arg1_squeezed_shape;
-                        AxisSet arg1_squeezed_axes;
-
-                        for (size_t i = 0; i < arg0_shape.size(); i++)
-                        {
-                            if (arg1_padded_shape[i] == 1)
-                            {
-                                arg1_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg1_squeezed_shape.push_back(arg1_padded_shape[i]);
-                            }
-                        }
-
-                        CoordinateTransform arg0_transform(arg0_shape);
-                        CoordinateTransform arg1_transform(arg1_squeezed_shape);
-                        CoordinateTransform output_transform(arg0_shape);
-
-                        for (const Coordinate& output_coord : output_transform)
-                        {
-                            Coordinate arg1_coord = reduce(output_coord, arg1_squeezed_axes);
-                            out[output_transform.index(output_coord)] =
-                                elementwise_functor(arg0[arg0_transform.index(output_coord)],
-                                                    arg1[arg1_transform.index(arg1_coord)]);
-                        }
+                        broadcast_binop(arg0,
+                                        arg1,
+                                        out,
+                                        arg0_shape,
+                                        arg1_padded_shape,
+                                        arg0_shape,
+                                        elementwise_functor);
                     }
                 }
             }
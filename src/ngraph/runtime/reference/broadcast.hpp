@@ -17,9 +17,12 @@
 #pragma once
 
 #include <cmath>
+#include <vector>
 
+#include "ngraph/check.hpp"
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/shape_util.hpp"
+#include "ngraph/strided_loop.hpp"
 
 namespace ngraph
 {
@@ -27,12 +30,11 @@ namespace ngraph
     {
         namespace reference
         {
-            template <typename T>
-            void broadcast(const T* arg,
-                           T* out,
-                           const Shape& in_shape,
-                           const Shape& out_shape,
-                           const AxisSet& broadcast_axes)
+            /// \brief Strides of the input of a broadcast for each output axis, zero along
+            ///        the broadcast axes.
+            inline std::vector<size_t> broadcast_in_strides(const Shape& in_shape,
+                                                            const Shape& out_shape,
+                                                            const AxisSet& broadcast_axes)
             {
                 // Remove all broadcast axes from in_shape
                 Shape adjusted_in_shape;
@@ -53,15 +55,31 @@ namespace ngraph
                         adjusted_axes.insert(axis);
                     }
                 }
-                CoordinateTransform input_transform(adjusted_in_shape);
-                CoordinateTransform output_transform(out_shape);
+                NGRAPH_CHECK(adjusted_in_shape.size() + adjusted_axes.size() == out_shape.size());
 
-                for (const Coordinate& output_coord : output_transform)
+                // Broadcast axes repeat the same input element; the others walk the input in order
+                auto adjusted_in_strides = row_major_strides(adjusted_in_shape);
+                std::vector<size_t> in_strides(out_shape.size(), 0);
+                size_t in_axis = 0;
+                for (size_t axis = 0; axis < out_shape.size(); axis++)
                 {
-                    Coordinate input_coord = reduce(output_coord, adjusted_axes);
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
+                    if (adjusted_axes.count(axis) == 0)
+                    {
+                        in_strides[axis] = adjusted_in_strides[in_axis++];
+                    }
                 }
+                return in_strides;
+            }
+
+            template <typename T>
+            void broadcast(const T* arg,
+                           T* out,
+                           const Shape& in_shape,
+                           const Shape& out_shape,
+                           const AxisSet& broadcast_axes)
+            {
+                strided_copy(
+                    arg, out, out_shape, broadcast_in_strides(in_shape, out_shape, broadcast_axes));
             }
         }
     }
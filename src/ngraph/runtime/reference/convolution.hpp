@@ -22,6 +22,7 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/gemm_convolution.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/util.hpp"
 
@@ -287,6 +288,66 @@ namespace ngraph
                              const OUTPUT* output_zero_point = nullptr)
 
             {
+                // With at least one spatial axis the convolution can be lowered onto gemm. The
+                // lowered forms multiply padded taps by the weights instead of skipping them, so
+                // a filter holding an infinity or a NaN stays on general_convolution.
+                if (in_shape.size() > 2 && has_only_finite_values(filter, shape_size(filter_shape)))
+                {
+                    auto old_mode = std::fegetround();
+                    std::fesetround(FE_TONEAREST);
+                    if (input_scale && input_zero_point && filter_scale && filter_zero_point &&
+                        output_scale && output_zero_point)
+                    {
+                        const float scale = *input_scale * *filter_scale / *output_scale;
+                        const OUTPUT zero_point = *output_zero_point;
+                        im2col_convolution(in,
+                                           filter,
+                                           out,
+                                           in_shape,
+                                           filter_shape,
+                                           out_shape,
+                                           stride,
+                                           filter_dilation,
+                                           in_pad_below,
+                                           in_dilation,
+                                           static_cast<ACCUMULATION>(*input_zero_point),
+                                           static_cast<ACCUMULATION>(*filter_zero_point),
+                                           *input_zero_point,
+                                           [scale, zero_point](ACCUMULATION sum) {
+                                               return static_cast<OUTPUT>(
+                                                   static_cast<OUTPUT>(std::round(
+                                                       static_cast<float>(sum) * scale)) +
+                                                   zero_point);
+                                           });
+                    }
+                    else if (is_winograd_convolution<INPUT, FILTER, OUTPUT>(
+                                 filter_shape, stride, filter_dilation, in_dilation))
+                    {
+                        winograd_convolution<INPUT, FILTER, OUTPUT, ACCUMULATION>(
+                            in, filter, out, in_shape, filter_shape, out_shape, in_pad_below);
+                    }
+                    else
+                    {
+                        im2col_convolution(in,
+                                           filter,
+                                           out,
+                                           in_shape,
+                                           filter_shape,
+                                           out_shape,
+                                           stride,
+                                           filter_dilation,
+                                           in_pad_below,
+                                           in_dilation,
+                                           ACCUMULATION(0),
+                                           ACCUMULATION(0),
+                                           INPUT(0),
+                                           [](ACCUMULATION sum) {
+                                               return static_cast<OUTPUT>(sum);
+                                           });
+                    }
+                    std::fesetround(old_mode);
+                    return;
+                }
                 general_convolution<INPUT, FILTER, OUTPUT, ACCUMULATION>(in,
                                                                          filter,
                                                                          out,
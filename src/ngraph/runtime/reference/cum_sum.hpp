@@ -16,11 +16,10 @@
 
 #pragma once
 
-#include <cmath>
+#include <cstddef>
 
-#include "ngraph/coordinate_transform.hpp"
-#include "ngraph/type/bfloat16.hpp"
-#include "ngraph/type/float16.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/shape.hpp"
 
 namespace ngraph
 {
@@ -28,113 +27,85 @@ namespace ngraph
     {
         namespace reference
         {
-            template <typename T, typename P>
-            void cumsum(const T* arg,
-                        const P* axis_tensor,
-                        T* out,
-                        const Shape& tensor_shape,
-                        const bool exclusive,
-                        const bool reverse)
+            /// \brief A tensor viewed as [outer, length, inner] around the CumSum axis.
+            struct CumSumLayout
             {
-                CoordinateTransform temp_transform(tensor_shape);
-                for (const Coordinate& output_coord : temp_transform)
-                {
-                    out[temp_transform.index(output_coord)] = 0;
-                }
+                size_t outer;
+                size_t length;
+                size_t inner;
+            };
 
-                P axis = axis_tensor[0];
-                P rank = tensor_shape.size();
-
-                if (axis < -rank || axis > rank)
+            template <typename P>
+            CumSumLayout cumsum_layout(const Shape& tensor_shape, const P* axis_tensor)
+            {
+                int64_t axis = static_cast<int64_t>(axis_tensor[0]);
+                int64_t rank = static_cast<int64_t>(tensor_shape.size());
+                if (axis < -rank || axis >= rank)
                 {
-                    throw ngraph_error("axis must be in the range [-rank, rank]");
+                    throw ngraph_error("axis must be in the range [-rank, rank)");
                 }
-                axis = axis < 0 ? rank + axis : axis;
-
-                auto get_key = [&, axis](const Coordinate& coord) -> Coordinate {
-                    Coordinate result(coord.size(), 0);
-                    result[axis] = coord[axis];
+                size_t a = static_cast<size_t>(axis < 0 ? rank + axis : axis);
+                auto axis_it = tensor_shape.begin() + a;
+                return CumSumLayout{shape_size(Shape(tensor_shape.begin(), axis_it)),
+                                    tensor_shape[a],
+                                    shape_size(Shape(axis_it + 1, tensor_shape.end()))};
+            }
 
-                    for (size_t i = 0; i < coord.size(); i++)
+            /// \brief Scans lanes [lane_begin, lane_end) of one [length, inner] slice. Each row of
+            ///        the output is the previous output row plus one input row, so the inner loop
+            ///        runs over contiguous lanes.
+            template <typename T>
+            void cumsum_lanes(const T* arg,
+                              T* out,
+                              size_t length,
+                              size_t inner,
+                              size_t lane_begin,
+                              size_t lane_end,
+                              const bool exclusive,
+                              const bool reverse)
+            {
+                for (size_t p = 0; p < length; p++)
+                {
+                    size_t k = reverse ? length - 1 - p : p;
+                    T* out_row = out + k * inner;
+                    if (p == 0)
                     {
-                        result[i] = coord[i] - result[i];
-                    }
-                    return result;
-                };
-
-                auto update_output_buffer =
-                    [&](size_t input_index,
-                        size_t output_index,
-                        T& prev,
-                        std::vector<std::pair<size_t, T>>& tensor_vec) -> void {
-
-                    tensor_vec[input_index].second = prev + tensor_vec[input_index].second;
-                    out[tensor_vec[output_index].first] = tensor_vec[input_index].second;
-
-                    // update prev to hold the last result value to compute ruuning sum for
-                    // subsequent iter
-                    prev = out[tensor_vec[output_index].first];
-                };
-
-                auto cum_sum =
-                    [&, exclusive, reverse](std::vector<std::pair<size_t, T>>& tensor_vec) {
-                        if (!reverse)
+                        for (size_t j = lane_begin; j < lane_end; j++)
                         {
-                            T prev = 0;
-                            for (size_t i = 0; i < tensor_vec.size(); i++)
-                            {
-                                if (exclusive && i == 0)
-                                {
-                                    out[tensor_vec[i].first] = prev;
-                                    continue;
-                                }
-                                // we will compute running sum of j-1 elements if exlusive=1 or else
-                                // for j elements if exclusive = 0
-                                size_t arg_index = exclusive == 1 ? i - 1 : i;
-                                update_output_buffer(arg_index, i, prev, tensor_vec);
-                            }
+                            out_row[j] = exclusive ? T(0) : arg[k * inner + j];
                         }
-                        else // reverse == true
-                        {
-                            T prev = 0;
-                            for (size_t i = tensor_vec.size(); i-- > 0;)
-                            {
-                                if (exclusive && i == tensor_vec.size() - 1)
-                                {
-                                    out[tensor_vec[i].first] = prev;
-                                    continue;
-                                }
-                                // we will compute running sum of j-1 elements if exlusive=1 or else
-                                // for j elements if exclusive = 0
-                                size_t arg_index = exclusive == 1 ? i + 1 : i;
-                                update_output_buffer(arg_index, i, prev, tensor_vec);
-                            }
-                        }
-                    };
-
-                // Map to collect tensor elements belonging to the same axis
-                std::map<Coordinate, std::vector<std::pair<size_t, T>>> map_cooord_to_val;
-                CoordinateTransform input_transform(tensor_shape);
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    // points to the current element in the input tensor
-                    T current = arg[input_transform.index(input_coord)];
-                    auto key = get_key(input_coord);
-                    auto index = input_transform.index(input_coord);
-                    if (map_cooord_to_val.find(key) != map_cooord_to_val.end())
-                    {
-                        map_cooord_to_val[key].push_back(std::make_pair(index, current));
+                        continue;
                     }
-                    else
+                    size_t prev = reverse ? k + 1 : k - 1;
+                    const T* prev_row = out + prev * inner;
+                    const T* in_row = arg + (exclusive ? prev : k) * inner;
+                    for (size_t j = lane_begin; j < lane_end; j++)
                     {
-                        map_cooord_to_val.insert({key, std::vector<std::pair<size_t, T>>()});
-                        map_cooord_to_val[key].push_back(std::make_pair(index, current));
+                        out_row[j] = prev_row[j] + in_row[j];
                     }
                 }
-                // iterate the map and perform cumulative sum over the give axis
-                for (auto& it : map_cooord_to_val)
+            }
+
+            template <typename T, typename P>
+            void cumsum(const T* arg,
+                        const P* axis_tensor,
+                        T* out,
+                        const Shape& tensor_shape,
+                        const bool exclusive,
+                        const bool reverse)
+            {
+                CumSumLayout layout = cumsum_layout(tensor_shape, axis_tensor);
+                size_t slice = layout.length * layout.inner;
+                for (size_t o = 0; o < layout.outer; o++)
                 {
-                    cum_sum(it.second);
+                    cumsum_lanes(arg + o * slice,
+                                 out + o * slice,
+                                 layout.length,
+                                 layout.inner,
+                                 0,
+                                 layout.inner,
+                                 exclusive,
+                                 reverse);
                 }
             }
         }
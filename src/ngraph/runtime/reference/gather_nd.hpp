@@ -16,9 +16,9 @@
 
 #pragma once
 
-#include <numeric>
+#include <cstring>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/shape.hpp"
 
 namespace ngraph
 {
@@ -37,70 +37,30 @@ namespace ngraph
                            const Shape& indices_shape,
                            const Shape& out_shape)
             {
-                using namespace std;
-                // Create a CoordinateTransform for "indices" that visits only the first element
-                // along inner most axis
-                size_t indices_ndim = static_cast<size_t>(indices_shape.size());
-                Coordinate indices_outer_start_corner(indices_ndim, 0);
-                Coordinate indices_outer_end_corner(indices_shape);
-                size_t slice_rank = indices_shape[indices_ndim - 1];
-                indices_outer_end_corner[indices_ndim - 1] = 1;
-                Strides indices_strides(indices_ndim, 1);
-                AxisVector indices_axis_order(indices_ndim);
-                std::iota(indices_axis_order.begin(), indices_axis_order.end(), 0);
-                CoordinateTransform indices_outer_transform(indices_shape,
-                                                            indices_outer_start_corner,
-                                                            indices_outer_end_corner,
-                                                            indices_strides,
-                                                            indices_axis_order);
-
-                // Create a matching CoordinateTransform for "out" that visits the same outer
-                // coordinates
-                size_t out_ndim = static_cast<size_t>(out_shape.size());
-                Coordinate out_start_corner(out_ndim, 0);
-                Coordinate out_end_corner(out_shape);
-                for (size_t i = indices_ndim - 1; i < out_ndim; i++)
+                size_t slice_rank = indices_shape.back();
+                size_t slice_length = 1;
+                for (size_t i = slice_rank; i < params_shape.size(); i++)
                 {
-                    out_end_corner[i] = 1;
+                    slice_length *= params_shape[i];
                 }
-                Strides out_strides(out_ndim, 1);
-                AxisVector out_axis_order(out_ndim);
-                std::iota(out_axis_order.begin(), out_axis_order.end(), 0);
-                CoordinateTransform out_transform(
-                    out_shape, out_start_corner, out_end_corner, out_strides, out_axis_order);
-                size_t params_ndim = static_cast<size_t>(params_shape.size());
-                Strides params_strides(params_ndim, 1);
-                AxisVector params_axis_order(params_ndim);
-                std::iota(params_axis_order.begin(), params_axis_order.end(), 0);
+                size_t slice_count = shape_size(indices_shape) / slice_rank;
 
-                // Gather slices from "params" and copy to "out"
-                auto out_coord_iter = out_transform.begin();
-                for (const Coordinate& indices_coord : indices_outer_transform)
+                // Every index vector selects one contiguous slice of "params"; its offset is
+                // the index vector dotted with the strides of the leading axes
+                for (size_t slice = 0; slice < slice_count; slice++)
                 {
-                    Coordinate params_start_corner(params_ndim, 0);
-                    Coordinate params_end_corner(params_shape);
-                    auto indices_index = indices_outer_transform.index(indices_coord);
+                    const U* index_vector = indices + slice * slice_rank;
+                    size_t offset = 0;
                     for (size_t i = 0; i < slice_rank; i++)
                     {
-                        U index = indices[indices_index];
+                        U index = index_vector[i];
                         // take care of negative indices
                         index = index >= 0 ? index : index + params_shape[i];
-                        params_start_corner[i] = index;
-                        params_end_corner[i] = index + 1;
-                        indices_index++;
-                    }
-                    CoordinateTransform params_transform(params_shape,
-                                                         params_start_corner,
-                                                         params_end_corner,
-                                                         params_strides,
-                                                         params_axis_order);
-                    auto out_index = out_transform.index(*out_coord_iter);
-                    for (const Coordinate& params_coord : params_transform)
-                    {
-                        out[out_index] = params[params_transform.index(params_coord)];
-                        out_index++;
+                        offset = offset * params_shape[i] + index;
                     }
-                    out_coord_iter++;
+                    memcpy(out + slice * slice_length,
+                           params + offset * slice_length,
+                           sizeof(T) * slice_length);
                 }
             }
         }
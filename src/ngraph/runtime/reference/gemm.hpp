@@ -0,0 +1,99 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            // Tile sizes for gemm. A tile of GEMM_ROW_BLOCK x GEMM_COL_BLOCK accumulators stays
+            // resident while panels of GEMM_DEPTH_BLOCK rows of B are streamed through it.
+            constexpr size_t GEMM_ROW_BLOCK = 8;
+            constexpr size_t GEMM_COL_BLOCK = 256;
+            constexpr size_t GEMM_DEPTH_BLOCK = 128;
+
+            /// \brief Computes out[m, n] = finalize(sum_k (a[m, k] - a_zero) * (b[k, n] - b_zero))
+            ///        for row-major matrices a (m x k), b (k x n) and out (m x n).
+            ///
+            /// The innermost loop runs over contiguous columns of b and of the accumulator tile
+            /// so that it can be vectorized by the compiler. Every output element still adds its
+            /// k products in ascending order starting from zero, so the result is identical to a
+            /// straightforward triple loop accumulating in ACCUMULATION.
+            template <typename INPUT0,
+                      typename INPUT1,
+                      typename OUTPUT,
+                      typename ACCUMULATION,
+                      typename FINALIZE>
+            void gemm(const INPUT0* a,
+                      const INPUT1* b,
+                      OUTPUT* out,
+                      size_t m,
+                      size_t n,
+                      size_t k,
+                      ACCUMULATION a_zero,
+                      ACCUMULATION b_zero,
+                      FINALIZE finalize)
+            {
+                std::vector<ACCUMULATION> tile(GEMM_ROW_BLOCK * GEMM_COL_BLOCK);
+                for (size_t i0 = 0; i0 < m; i0 += GEMM_ROW_BLOCK)
+                {
+                    const size_t rows = std::min(GEMM_ROW_BLOCK, m - i0);
+                    for (size_t j0 = 0; j0 < n; j0 += GEMM_COL_BLOCK)
+                    {
+                        const size_t cols = std::min(GEMM_COL_BLOCK, n - j0);
+                        std::fill(tile.begin(), tile.end(), ACCUMULATION(0));
+                        for (size_t k0 = 0; k0 < k; k0 += GEMM_DEPTH_BLOCK)
+                        {
+                            const size_t depth = std::min(GEMM_DEPTH_BLOCK, k - k0);
+                            for (size_t i = 0; i < rows; ++i)
+                            {
+                                const INPUT0* a_row = a + (i0 + i) * k + k0;
+                                ACCUMULATION* acc = tile.data() + i * GEMM_COL_BLOCK;
+                                for (size_t kk = 0; kk < depth; ++kk)
+                                {
+                                    const ACCUMULATION a_val =
+                                        static_cast<ACCUMULATION>(a_row[kk]) - a_zero;
+                                    const INPUT1* b_row = b + (k0 + kk) * n + j0;
+                                    for (size_t j = 0; j < cols; ++j)
+                                    {
+                                        acc[j] += a_val *
+                                                  (static_cast<ACCUMULATION>(b_row[j]) - b_zero);
+                                    }
+                                }
+                            }
+                        }
+                        for (size_t i = 0; i < rows; ++i)
+                        {
+                            const ACCUMULATION* acc = tile.data() + i * GEMM_COL_BLOCK;
+                            OUTPUT* out_row = out + (i0 + i) * n + j0;
+                            for (size_t j = 0; j < cols; ++j)
+                            {
+                                out_row[j] = finalize(acc[j]);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,421 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/gemm.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \returns true if none of the `size` values at `data` is an infinity or a NaN.
+            template <typename T>
+            typename std::enable_if<std::is_integral<T>::value, bool>::type
+                has_only_finite_values(const T*, size_t)
+            {
+                return true;
+            }
+
+            template <typename T>
+            typename std::enable_if<!std::is_integral<T>::value, bool>::type
+                has_only_finite_values(const T* data, size_t size)
+            {
+                for (size_t i = 0; i < size; ++i)
+                {
+                    if (!std::isfinite(static_cast<double>(data[i])))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            /// \brief For every filter position and spatial axis, the input offset that each output
+            ///        position along that axis reads, or -1 if it reads padding or an input
+            ///        dilation gap. The vector for filter position f and axis d is at
+            ///        f * spatial rank + d.
+            inline std::vector<std::vector<std::ptrdiff_t>>
+                im2col_offsets(const Shape& in_spatial,
+                               const Shape& filter_spatial,
+                               const Shape& out_spatial,
+                               const Strides& stride,
+                               const Strides& filter_dilation,
+                               const CoordinateDiff& in_pad_below,
+                               const Strides& in_dilation)
+            {
+                const size_t spatial_rank = in_spatial.size();
+                const Strides in_strides = row_major_strides(in_spatial);
+                std::vector<std::vector<std::ptrdiff_t>> offsets(shape_size(filter_spatial) *
+                                                                 spatial_rank);
+                size_t f = 0;
+                for (const Coordinate& filter_coord : CoordinateTransform(filter_spatial))
+                {
+                    for (size_t d = 0; d < spatial_rank; ++d)
+                    {
+                        const std::ptrdiff_t dilated_size =
+                            in_spatial[d] == 0 ? 0 : (in_spatial[d] - 1) * in_dilation[d] + 1;
+                        std::vector<std::ptrdiff_t>& axis = offsets[f * spatial_rank + d];
+                        axis.resize(out_spatial[d]);
+                        for (size_t o = 0; o < out_spatial[d]; ++o)
+                        {
+                            const std::ptrdiff_t i =
+                                static_cast<std::ptrdiff_t>(o * stride[d] +
+                                                            filter_coord[d] * filter_dilation[d]) -
+                                in_pad_below[d];
+                            axis[o] = (i < 0 || i >= dilated_size || i % in_dilation[d] != 0)
+                                          ? -1
+                                          : i / in_dilation[d] * in_strides[d];
+                        }
+                    }
+                    ++f;
+                }
+                return offsets;
+            }
+
+            /// \brief Calls `visit(p, offset)` for the output positions p of one filter position
+            ///        in row-major order, with the input offset that p reads or -1.
+            ///
+            /// `axis_offsets` points at the vectors of that filter position in the result of
+            /// im2col_offsets. Without spatial axes the single position reads offset 0.
+            template <typename VISIT>
+            void im2col_visit(const std::vector<std::ptrdiff_t>* axis_offsets,
+                              const Shape& out_spatial,
+                              VISIT visit)
+            {
+                const size_t spatial_rank = out_spatial.size();
+                if (spatial_rank == 0)
+                {
+                    visit(size_t(0), std::ptrdiff_t(0));
+                    return;
+                }
+                const size_t out_size = shape_size(out_spatial);
+                const size_t inner_size = out_spatial.back();
+                const std::ptrdiff_t* inner_offsets = axis_offsets[spatial_rank - 1].data();
+                Coordinate out_coord(spatial_rank, 0);
+                for (size_t p = 0; p < out_size; p += inner_size)
+                {
+                    std::ptrdiff_t base = 0;
+                    bool valid = true;
+                    for (size_t d = 0; d + 1 < spatial_rank; ++d)
+                    {
+                        const std::ptrdiff_t offset = axis_offsets[d][out_coord[d]];
+                        valid = valid && offset >= 0;
+                        base += offset;
+                    }
+                    for (size_t j = 0; j < inner_size; ++j)
+                    {
+                        visit(p + j,
+                              (valid && inner_offsets[j] >= 0) ? base + inner_offsets[j] : -1);
+                    }
+                    for (size_t d = spatial_rank - 1; d-- > 0;)
+                    {
+                        if (++out_coord[d] < out_spatial[d])
+                        {
+                            break;
+                        }
+                        out_coord[d] = 0;
+                    }
+                }
+            }
+
+            /// \brief Lowers an NC_I... x C_OC_I... -> NC_O... convolution onto gemm.
+            ///
+            /// For every batch element the receptive fields are unrolled into a
+            /// [filter positions * in channels, out positions] matrix (im2col) and multiplied by
+            /// the filter, transposed to [out channels, filter positions * in channels]. The
+            /// depth axis is ordered filter position major, in channel minor, so every output
+            /// adds its products in the same order as general_convolution. Positions that fall
+            /// in the padding or in an input dilation gap are filled with `pad_value`, which
+            /// must make `pad_value - in_zero` zero. Those positions are multiplied in rather
+            /// than skipped, so an infinite or NaN weight turns them into NaN; use
+            /// general_convolution unless has_only_finite_values holds for the filter.
+            template <typename INPUT,
+                      typename FILTER,
+                      typename OUTPUT,
+                      typename ACCUMULATION,
+                      typename FINALIZE>
+            void im2col_convolution(const INPUT* in,
+                                    const FILTER* filter,
+                                    OUTPUT* out,
+                                    const Shape& in_shape,
+                                    const Shape& filter_shape,
+                                    const Shape& out_shape,
+                                    const Strides& stride,
+                                    const Strides& filter_dilation,
+                                    const CoordinateDiff& in_pad_below,
+                                    const Strides& in_dilation,
+                                    ACCUMULATION in_zero,
+                                    ACCUMULATION filter_zero,
+                                    INPUT pad_value,
+                                    FINALIZE finalize)
+            {
+                const size_t spatial_rank = in_shape.size() - 2;
+                const Shape in_spatial(in_shape.begin() + 2, in_shape.end());
+                const Shape filter_spatial(filter_shape.begin() + 2, filter_shape.end());
+                const Shape out_spatial(out_shape.begin() + 2, out_shape.end());
+
+                const size_t batch_size = in_shape[0];
+                const size_t channels = in_shape[1];
+                const size_t out_channels = filter_shape[0];
+                const size_t in_size = shape_size(in_spatial);
+                const size_t filter_size = shape_size(filter_spatial);
+                const size_t out_size = shape_size(out_spatial);
+                const size_t depth = filter_size * channels;
+
+                std::vector<FILTER> weights(out_channels * depth);
+                for (size_t oc = 0; oc < out_channels; ++oc)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        for (size_t f = 0; f < filter_size; ++f)
+                        {
+                            weights[(oc * filter_size + f) * channels + c] =
+                                filter[(oc * channels + c) * filter_size + f];
+                        }
+                    }
+                }
+
+                const std::vector<std::vector<std::ptrdiff_t>> offsets =
+                    im2col_offsets(in_spatial,
+                                   filter_spatial,
+                                   out_spatial,
+                                   stride,
+                                   filter_dilation,
+                                   in_pad_below,
+                                   in_dilation);
+
+                std::vector<INPUT> columns(depth * out_size);
+                for (size_t n = 0; n < batch_size; ++n)
+                {
+                    for (size_t f = 0; f < filter_size; ++f)
+                    {
+                        for (size_t c = 0; c < channels; ++c)
+                        {
+                            const INPUT* in_channel = in + (n * channels + c) * in_size;
+                            INPUT* row = &columns[(f * channels + c) * out_size];
+                            im2col_visit(&offsets[f * spatial_rank],
+                                         out_spatial,
+                                         [&](size_t p, std::ptrdiff_t offset) {
+                                             row[p] = offset >= 0 ? in_channel[offset] : pad_value;
+                                         });
+                        }
+                    }
+                    gemm(weights.data(),
+                         columns.data(),
+                         out + n * out_channels * out_size,
+                         out_channels,
+                         out_size,
+                         depth,
+                         filter_zero,
+                         in_zero,
+                         finalize);
+                }
+            }
+
+            /// \brief Winograd F(2x2, 3x3) for 2D convolutions with a 3x3 filter, unit strides
+            ///        and no dilation.
+            ///
+            /// The filter and 4x4 input tiles are transformed once, the 16 transformed planes are
+            /// multiplied with gemm over the channels, and the products are transformed back into
+            /// 2x2 output tiles. This needs 16 instead of 36 multiplies per tile and channel pair
+            /// but rounds differently from the direct sum, so it is only used for floating point.
+            template <typename INPUT, typename FILTER, typename OUTPUT, typename ACCUMULATION>
+            void winograd_convolution(const INPUT* in,
+                                      const FILTER* filter,
+                                      OUTPUT* out,
+                                      const Shape& in_shape,
+                                      const Shape& filter_shape,
+                                      const Shape& out_shape,
+                                      const CoordinateDiff& in_pad_below)
+            {
+                const size_t batch_size = in_shape[0];
+                const size_t channels = in_shape[1];
+                const size_t out_channels = filter_shape[0];
+                const std::ptrdiff_t in_height = in_shape[2];
+                const std::ptrdiff_t in_width = in_shape[3];
+                const size_t out_height = out_shape[2];
+                const size_t out_width = out_shape[3];
+                const size_t tiles_y = (out_height + 1) / 2;
+                const size_t tiles_x = (out_width + 1) / 2;
+                const size_t tiles = tiles_y * tiles_x;
+                const ACCUMULATION half = ACCUMULATION(1) / ACCUMULATION(2);
+
+                // U = G g G^T for every (out channel, in channel) pair, stored as 16 planes of
+                // [out_channels, channels].
+                std::vector<ACCUMULATION> u(16 * out_channels * channels);
+                for (size_t oc = 0; oc < out_channels; ++oc)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        const FILTER* g = filter + (oc * channels + c) * 9;
+                        ACCUMULATION gg[4][3];
+                        for (size_t j = 0; j < 3; ++j)
+                        {
+                            const ACCUMULATION g0 = static_cast<ACCUMULATION>(g[j]);
+                            const ACCUMULATION g1 = static_cast<ACCUMULATION>(g[3 + j]);
+                            const ACCUMULATION g2 = static_cast<ACCUMULATION>(g[6 + j]);
+                            gg[0][j] = g0;
+                            gg[1][j] = (g0 + g1 + g2) * half;
+                            gg[2][j] = (g0 - g1 + g2) * half;
+                            gg[3][j] = g2;
+                        }
+                        for (size_t i = 0; i < 4; ++i)
+                        {
+                            ACCUMULATION* plane = &u[i * 4 * out_channels * channels];
+                            const size_t at = oc * channels + c;
+                            const size_t step = out_channels * channels;
+                            plane[at] = gg[i][0];
+                            plane[step + at] = (gg[i][0] + gg[i][1] + gg[i][2]) * half;
+                            plane[2 * step + at] = (gg[i][0] - gg[i][1] + gg[i][2]) * half;
+                            plane[3 * step + at] = gg[i][2];
+                        }
+                    }
+                }
+
+                std::vector<ACCUMULATION> v(16 * channels * tiles);
+                std::vector<ACCUMULATION> m(16 * out_channels * tiles);
+                for (size_t n = 0; n < batch_size; ++n)
+                {
+                    // V = B^T d B for every input tile, stored as 16 planes of [channels, tiles].
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        const INPUT* in_channel = in + (n * channels + c) * in_height * in_width;
+                        for (size_t ty = 0; ty < tiles_y; ++ty)
+                        {
+                            for (size_t tx = 0; tx < tiles_x; ++tx)
+                            {
+                                ACCUMULATION d[4][4];
+                                for (size_t i = 0; i < 4; ++i)
+                                {
+                                    const std::ptrdiff_t y = static_cast<std::ptrdiff_t>(
+                                                                 2 * ty + i) -
+                                                             in_pad_below[0];
+                                    for (size_t j = 0; j < 4; ++j)
+                                    {
+                                        const std::ptrdiff_t x = static_cast<std::ptrdiff_t>(
+                                                                     2 * tx + j) -
+                                                                 in_pad_below[1];
+                                        d[i][j] = (y < 0 || y >= in_height || x < 0 ||
+                                                   x >= in_width)
+                                                      ? ACCUMULATION(0)
+                                                      : static_cast<ACCUMULATION>(
+                                                            in_channel[y * in_width + x]);
+                                    }
+                                }
+                                ACCUMULATION bd[4][4];
+                                for (size_t j = 0; j < 4; ++j)
+                                {
+                                    bd[0][j] = d[0][j] - d[2][j];
+                                    bd[1][j] = d[1][j] + d[2][j];
+                                    bd[2][j] = d[2][j] - d[1][j];
+                                    bd[3][j] = d[1][j] - d[3][j];
+                                }
+                                const size_t at = c * tiles + ty * tiles_x + tx;
+                                const size_t step = channels * tiles;
+                                for (size_t i = 0; i < 4; ++i)
+                                {
+                                    ACCUMULATION* plane = &v[i * 4 * step];
+                                    plane[at] = bd[i][0] - bd[i][2];
+                                    plane[step + at] = bd[i][1] + bd[i][2];
+                                    plane[2 * step + at] = bd[i][2] - bd[i][1];
+                                    plane[3 * step + at] = bd[i][1] - bd[i][3];
+                                }
+                            }
+                        }
+                    }
+
+                    for (size_t e = 0; e < 16; ++e)
+                    {
+                        gemm(&u[e * out_channels * channels],
+                             &v[e * channels * tiles],
+                             &m[e * out_channels * tiles],
+                             out_channels,
+                             tiles,
+                             channels,
+                             ACCUMULATION(0),
+                             ACCUMULATION(0),
+                             [](ACCUMULATION sum) { return sum; });
+                    }
+
+                    // Y = A^T M A for every output tile.
+                    const size_t step = out_channels * tiles;
+                    for (size_t oc = 0; oc < out_channels; ++oc)
+                    {
+                        OUTPUT* out_channel =
+                            out + (n * out_channels + oc) * out_height * out_width;
+                        for (size_t ty = 0; ty < tiles_y; ++ty)
+                        {
+                            for (size_t tx = 0; tx < tiles_x; ++tx)
+                            {
+                                const size_t at = oc * tiles + ty * tiles_x + tx;
+                                ACCUMULATION am[2][4];
+                                for (size_t j = 0; j < 4; ++j)
+                                {
+                                    const ACCUMULATION m0 = m[j * step + at];
+                                    const ACCUMULATION m1 = m[(4 + j) * step + at];
+                                    const ACCUMULATION m2 = m[(8 + j) * step + at];
+                                    const ACCUMULATION m3 = m[(12 + j) * step + at];
+                                    am[0][j] = m0 + m1 + m2;
+                                    am[1][j] = m1 - m2 - m3;
+                                }
+                                for (size_t i = 0; i < 2 && 2 * ty + i < out_height; ++i)
+                                {
+                                    OUTPUT* out_row = out_channel + (2 * ty + i) * out_width;
+                                    out_row[2 * tx] =
+                                        static_cast<OUTPUT>(am[i][0] + am[i][1] + am[i][2]);
+                                    if (2 * tx + 1 < out_width)
+                                    {
+                                        out_row[2 * tx + 1] =
+                                            static_cast<OUTPUT>(am[i][1] - am[i][2] - am[i][3]);
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            /// \returns true if winograd_convolution can compute a convolution with these
+            ///          parameters.
+            template <typename INPUT, typename FILTER, typename OUTPUT>
+            bool is_winograd_convolution(const Shape& filter_shape,
+                                         const Strides& stride,
+                                         const Strides& filter_dilation,
+                                         const Strides& in_dilation)
+            {
+                return std::is_floating_point<INPUT>::value &&
+                       std::is_floating_point<FILTER>::value &&
+                       std::is_floating_point<OUTPUT>::value && filter_shape.size() == 4 &&
+                       filter_shape[2] == 3 && filter_shape[3] == 3 &&
+                       stride == Strides{1, 1} && filter_dilation == Strides{1, 1} &&
+                       in_dilation == Strides{1, 1};
+            }
+        }
+    }
+}
@@ -80,8 +80,8 @@ namespace ngraph
                         source_window_transform_padding_below[i] = padding_below[i - 2];
                         source_window_transform_padding_above[i] = padding_above[i - 2];
                     }
-                    std::iota(begin(source_window_transform_source_axis_order),
-                              end(source_window_transform_source_axis_order),
+                    std::iota(source_window_transform_source_axis_order.begin(),
+                              source_window_transform_source_axis_order.end(),
                               0);
 
                     CoordinateTransform source_window_transform(
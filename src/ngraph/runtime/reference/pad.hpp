@@ -16,12 +16,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/check.hpp"
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/pad.hpp" // for op::PadMode
+#include "ngraph/strided_loop.hpp"
 
 namespace ngraph
 {
@@ -29,6 +31,46 @@ namespace ngraph
     {
         namespace reference
         {
+            /// \brief The part of a constant-padded output that is copied from the input, as a
+            ///        shape walked over both tensors. Negative padding crops the input.
+            struct PadLayout
+            {
+                Shape copy_shape;
+                std::vector<size_t> arg0_strides;
+                size_t arg0_start;
+                std::vector<size_t> out_strides;
+                size_t out_start;
+            };
+
+            inline PadLayout pad_layout(const Shape& arg0_shape,
+                                        const Shape& out_shape,
+                                        const CoordinateDiff& padding_below,
+                                        const CoordinateDiff& padding_above)
+            {
+                NGRAPH_CHECK(padding_below.size() == arg0_shape.size() &&
+                             padding_above.size() == arg0_shape.size() &&
+                             out_shape.size() == arg0_shape.size());
+
+                PadLayout layout{Shape(arg0_shape.size()),
+                                 row_major_strides(arg0_shape),
+                                 0,
+                                 row_major_strides(out_shape),
+                                 0};
+                for (size_t i = 0; i < arg0_shape.size(); i++)
+                {
+                    ptrdiff_t arg0_length = static_cast<ptrdiff_t>(arg0_shape[i]);
+                    ptrdiff_t out_length = static_cast<ptrdiff_t>(out_shape[i]);
+                    NGRAPH_CHECK(out_length == arg0_length + padding_below[i] + padding_above[i]);
+                    ptrdiff_t arg0_begin = std::max<ptrdiff_t>(0, -padding_below[i]);
+                    ptrdiff_t out_begin = std::max<ptrdiff_t>(0, padding_below[i]);
+                    ptrdiff_t length = std::min(arg0_length - arg0_begin, out_length - out_begin);
+                    layout.copy_shape[i] = static_cast<size_t>(std::max<ptrdiff_t>(length, 0));
+                    layout.arg0_start += static_cast<size_t>(arg0_begin) * layout.arg0_strides[i];
+                    layout.out_start += static_cast<size_t>(out_begin) * layout.out_strides[i];
+                }
+                return layout;
+            }
+
             template <typename T>
             void pad(const T* arg0,
                      const T* arg1,
@@ -39,6 +81,26 @@ namespace ngraph
                      const CoordinateDiff& padding_above,
                      op::PadMode pad_mode)
             {
+                if (pad_mode == op::PadMode::CONSTANT)
+                {
+                    auto layout = pad_layout(arg0_shape, out_shape, padding_below, padding_above);
+
+                    size_t out_size = shape_size(out_shape);
+                    for (size_t i = 0; i < out_size; i++)
+                    {
+                        out[i] = *arg1;
+                    }
+
+                    strided_copy(arg0,
+                                 out,
+                                 layout.copy_shape,
+                                 layout.arg0_strides,
+                                 layout.arg0_start,
+                                 layout.out_strides,
+                                 layout.out_start);
+                    return;
+                }
+
                 Coordinate input_start(arg0_shape.size(), 0); // start at (0,0,...,0)
                 Coordinate input_end = out_shape; // end at (d'0,d'1,...,d'n), the outer corner of
                                                   // the post-padding shape
@@ -16,10 +16,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
 #include "ngraph/check.hpp"
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/strided_loop.hpp"
 
 namespace ngraph
 {
@@ -38,32 +40,22 @@ namespace ngraph
                                const Shape& out_shape)
             {
                 // Step 1: Copy the entire replacement context to the output.
-                CoordinateTransform copy_transform(out_shape);
-
-                for (Coordinate copy_coord : copy_transform)
+                size_t out_size = shape_size(out_shape);
+                if (arg0 != out)
                 {
-                    out[copy_transform.index(copy_coord)] = arg0[copy_transform.index(copy_coord)];
+                    std::copy(arg0, arg0 + out_size, out);
                 }
 
-                // Step 2: Overwrite the slice for replacement.
-                CoordinateTransform input_transform(arg1_shape);
-                CoordinateTransform output_transform(
-                    out_shape, lower_bounds, upper_bounds, strides);
-
-                NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                             shape_size(output_transform.get_target_shape()));
+                auto layout = slice_layout(out_shape, lower_bounds, upper_bounds, strides);
+                NGRAPH_CHECK(shape_size(layout.shape) == shape_size(arg1_shape));
 
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    const Coordinate& output_coord = *output_it;
-
-                    out[output_transform.index(output_coord)] =
-                        arg1[input_transform.index(input_coord)];
-
-                    ++output_it;
-                }
+                strided_copy(arg1,
+                             out,
+                             layout.shape,
+                             row_major_strides(layout.shape),
+                             0,
+                             layout.strides,
+                             layout.start);
             }
         }
     }
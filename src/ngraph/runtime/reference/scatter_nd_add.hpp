@@ -16,10 +16,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstring>
-#include <numeric>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/shape.hpp"
 
 namespace ngraph
 {
@@ -37,76 +37,37 @@ namespace ngraph
                                 const Shape& updates_shape,
                                 const Shape& out_shape)
             {
-                using namespace std;
                 // Copy inputs to out
                 memcpy(out, inputs, sizeof(T) * shape_size(inputs_shape));
-                // Create a CoordinateTransform for "indices" that visits only the first element
-                // along inner most axis
-                size_t indices_ndim = static_cast<size_t>(indices_shape.size());
-                Coordinate indices_outer_start_corner(indices_ndim, 0);
-                Coordinate indices_outer_end_corner(indices_shape);
-                size_t slice_rank = indices_shape[indices_ndim - 1];
-                indices_outer_end_corner[indices_ndim - 1] = 1;
-                Strides indices_strides(indices_ndim, 1);
-                AxisVector indices_axis_order(indices_ndim);
-                std::iota(indices_axis_order.begin(), indices_axis_order.end(), 0);
-                CoordinateTransform indices_outer_transform(indices_shape,
-                                                            indices_outer_start_corner,
-                                                            indices_outer_end_corner,
-                                                            indices_strides,
-                                                            indices_axis_order);
 
-                // Create a matching CoordinateTransform for "updates" that visits the same outer
-                // coordinates
-                size_t updates_ndim = static_cast<size_t>(updates_shape.size());
-                Strides updates_strides(updates_ndim, 1);
-                AxisVector updates_axis_order(updates_ndim);
-                std::iota(updates_axis_order.begin(), updates_axis_order.end(), 0);
-                Coordinate updates_outer_start_corner(updates_ndim, 0);
-                Coordinate updates_outer_end_corner(updates_shape);
-                for (size_t i = indices_ndim - 1; i < updates_ndim; i++)
+                size_t slice_rank = indices_shape.back();
+                size_t slice_length = 1;
+                for (size_t i = slice_rank; i < out_shape.size(); i++)
                 {
-                    updates_outer_end_corner[i] = 1;
+                    slice_length *= out_shape[i];
                 }
-                CoordinateTransform updates_outer_transform(updates_shape,
-                                                            updates_outer_start_corner,
-                                                            updates_outer_end_corner,
-                                                            updates_strides,
-                                                            updates_axis_order);
-
-                // Add an updates slice to a slice on out indexed by innermost dim ofindices
-                size_t out_ndim = static_cast<size_t>(out_shape.size());
-                Strides out_strides(out_ndim, 1);
-                AxisVector out_axis_order(out_ndim);
-                std::iota(out_axis_order.begin(), out_axis_order.end(), 0);
-
-                auto updates_outer_coord_iter = updates_outer_transform.begin();
-                for (const Coordinate& indices_coord : indices_outer_transform)
+                size_t slice_count = shape_size(indices_shape) / slice_rank;
+                if (slice_length != 0)
                 {
-                    if (updates_outer_coord_iter == updates_outer_transform.end())
-                    {
-                        break;
-                    }
+                    slice_count = std::min(slice_count, shape_size(updates_shape) / slice_length);
+                }
 
-                    Coordinate out_start_corner(out_ndim, 0);
-                    Coordinate out_end_corner(out_shape);
-                    auto indices_index = indices_outer_transform.index(indices_coord);
+                // Add an updates slice to the contiguous slice of out selected by the innermost
+                // dim of indices
+                for (size_t slice = 0; slice < slice_count; slice++)
+                {
+                    const U* index_vector = indices + slice * slice_rank;
+                    size_t offset = 0;
                     for (size_t i = 0; i < slice_rank; i++)
                     {
-                        U index = indices[indices_index];
-                        out_start_corner[i] = index;
-                        out_end_corner[i] = index + 1;
-                        indices_index++;
+                        offset = offset * out_shape[i] + index_vector[i];
                     }
-                    CoordinateTransform out_transform(
-                        out_shape, out_start_corner, out_end_corner, out_strides, out_axis_order);
-                    auto updates_index = updates_outer_transform.index(*updates_outer_coord_iter);
-                    for (const Coordinate& out_coord : out_transform)
+                    T* out_slice = out + offset * slice_length;
+                    const T* updates_slice = updates + slice * slice_length;
+                    for (size_t j = 0; j < slice_length; j++)
                     {
-                        out[out_transform.index(out_coord)] += updates[updates_index];
-                        updates_index++;
+                        out_slice[j] += updates_slice[j];
                     }
-                    updates_outer_coord_iter++;
                 }
             }
         }
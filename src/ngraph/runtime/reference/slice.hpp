@@ -20,6 +20,7 @@
 
 #include "ngraph/check.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_loop.hpp"
 
 namespace ngraph
 {
@@ -27,6 +28,39 @@ namespace ngraph
     {
         namespace reference
         {
+            /// \brief The elements of a row-major tensor selected by a strided slice, as a
+            ///        shape walked with `strides` from offset `start`.
+            struct SliceLayout
+            {
+                Shape shape;
+                std::vector<size_t> strides;
+                size_t start;
+            };
+
+            inline SliceLayout slice_layout(const Shape& arg_shape,
+                                            const Coordinate& lower_bounds,
+                                            const Coordinate& upper_bounds,
+                                            const Strides& strides)
+            {
+                NGRAPH_CHECK(lower_bounds.size() == arg_shape.size() &&
+                             upper_bounds.size() == arg_shape.size() &&
+                             strides.size() == arg_shape.size());
+
+                auto arg_strides = row_major_strides(arg_shape);
+                size_t rank = arg_shape.size();
+                SliceLayout layout{Shape(rank), std::vector<size_t>(rank), 0};
+                for (size_t i = 0; i < arg_shape.size(); i++)
+                {
+                    NGRAPH_CHECK(strides[i] > 0 && lower_bounds[i] <= upper_bounds[i] &&
+                                 upper_bounds[i] <= arg_shape[i]);
+                    layout.shape[i] =
+                        (upper_bounds[i] - lower_bounds[i] + strides[i] - 1) / strides[i];
+                    layout.strides[i] = arg_strides[i] * strides[i];
+                    layout.start += lower_bounds[i] * arg_strides[i];
+                }
+                return layout;
+            }
+
             template <typename T>
             void slice(const T* arg,
                        T* out,
@@ -36,22 +70,10 @@ namespace ngraph
                        const Strides& strides,
                        const Shape& out_shape)
             {
-                CoordinateTransform input_transform(arg_shape, lower_bounds, upper_bounds, strides);
-                CoordinateTransform output_transform(out_shape);
-
-                CoordinateTransform::Iterator output_it = output_transform.begin();
+                auto layout = slice_layout(arg_shape, lower_bounds, upper_bounds, strides);
+                NGRAPH_CHECK(shape_size(layout.shape) == shape_size(out_shape));
 
-                NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                             shape_size(output_transform.get_target_shape()));
-
-                for (const Coordinate& in_coord : input_transform)
-                {
-                    const Coordinate& out_coord = *output_it;
-
-                    out[output_transform.index(out_coord)] = arg[input_transform.index(in_coord)];
-
-                    ++output_it;
-                }
+                strided_copy(arg, out, layout.shape, layout.strides, layout.start);
             }
         }
     }
@@ -18,8 +18,10 @@
 
 #include <cmath>
 
+#include "ngraph/check.hpp"
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/shape_util.hpp"
+#include "ngraph/strided_loop.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
 
@@ -59,36 +61,55 @@ namespace ngraph
                      const Shape& out_shape,
                      const AxisSet& reduction_axes)
             {
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> cs(shape_size(out_shape));
-
-                for (const Coordinate& output_coord : output_transform)
+                size_t out_size = shape_size(out_shape);
+                std::vector<T> cs(out_size);
+                for (size_t i = 0; i < out_size; i++)
                 {
-                    out[output_transform.index(output_coord)] = 0;
-                    cs[output_transform.index(output_coord)] = 0;
+                    out[i] = 0;
+                    cs[i] = 0;
                 }
 
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
+                // Reduced axes map every input element of a run onto the same output element
+                auto out_row_strides = row_major_strides(out_shape);
+                std::vector<size_t> out_strides(in_shape.size(), 0);
+                size_t out_axis = 0;
+                for (size_t axis = 0; axis < in_shape.size(); axis++)
                 {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
-
-                    if (is_finite(x) && is_finite(z))
+                    if (reduction_axes.count(axis) == 0)
                     {
-                        T& c = cs[output_transform.index(output_coord)];
-                        T t = z + (x - c);
-                        c = (t - z) - (x - c);
-                        z = t;
-                    }
-                    else
-                    {
-                        z = z + x;
+                        NGRAPH_CHECK(out_axis < out_shape.size() &&
+                                     out_shape[out_axis] == in_shape[axis]);
+                        out_strides[axis] = out_row_strides[out_axis++];
                     }
                 }
+
+                T* c_base = cs.data();
+                for_each_strided_run<2>(
+                    in_shape,
+                    {{row_major_strides(in_shape), out_strides}},
+                    {{0, 0}},
+                    [arg, out, c_base](const std::array<size_t, 2>& offsets,
+                                       size_t count,
+                                       const std::array<size_t, 2>& inner_strides) {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            T x = arg[offsets[0] + i * inner_strides[0]];
+                            size_t out_index = offsets[1] + i * inner_strides[1];
+                            T& z = out[out_index];
+
+                            if (is_finite(x) && is_finite(z))
+                            {
+                                T& c = c_base[out_index];
+                                T t = z + (x - c);
+                                c = (t - z) - (x - c);
+                                z = t;
+                            }
+                            else
+                            {
+                                z = z + x;
+                            }
+                        }
+                    });
             }
         }
     }
@@ -16,6 +16,7 @@
 
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
+#include "ngraph/except.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/type/element_type.hpp"
@@ -95,3 +96,111 @@ void runtime::Tensor::copy_from(const ngraph::runtime::Tensor& source)
     source.read(buffer.get_ptr(), size);
     write(buffer.get_ptr(), size);
 }
+
+void runtime::Tensor::write_at(const void* p, size_t offset, size_t n)
+{
+    if (offset != 0 || n != get_size_in_bytes())
+    {
+        throw ngraph_error("Partial writes are not supported by this tensor");
+    }
+    write(p, n);
+}
+
+shared_ptr<runtime::TensorFence> runtime::Tensor::begin_streaming_write()
+{
+    auto fence = make_shared<TensorFence>(get_size_in_bytes());
+    atomic_store(&m_fence, fence);
+    return fence;
+}
+
+shared_ptr<runtime::TensorFence> runtime::Tensor::get_fence() const
+{
+    return atomic_load(&m_fence);
+}
+
+future<void> runtime::Tensor::write_async(const void* p, size_t offset, size_t n)
+{
+    if (offset + n > get_size_in_bytes())
+    {
+        throw out_of_range("write_async past the end of the tensor");
+    }
+    auto fence = get_fence();
+    return async(launch::async, [this, p, offset, n, fence]() {
+        try
+        {
+            write_at(p, offset, n);
+        }
+        catch (...)
+        {
+            if (fence)
+            {
+                fence->set_error(current_exception());
+            }
+            throw;
+        }
+        if (fence)
+        {
+            fence->add_ready(n);
+        }
+    });
+}
+
+void runtime::Tensor::wait_for_fences(const vector<shared_ptr<Tensor>>& tensors)
+{
+    for (auto& tensor : tensors)
+    {
+        if (auto fence = tensor ? tensor->get_fence() : nullptr)
+        {
+            fence->wait();
+        }
+    }
+}
+
+runtime::TensorFence::TensorFence(size_t size_in_bytes)
+    : m_size(size_in_bytes)
+{
+}
+
+void runtime::TensorFence::add_ready(size_t n)
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_ready += n;
+        if (m_ready < m_size)
+        {
+            return;
+        }
+    }
+    m_ready_condition.notify_all();
+}
+
+void runtime::TensorFence::set_error(exception_ptr error)
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_error = error;
+    }
+    m_ready_condition.notify_all();
+}
+
+bool runtime::TensorFence::is_ready() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_ready >= m_size;
+}
+
+size_t runtime::TensorFence::get_ready_bytes() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_ready;
+}
+
+void runtime::TensorFence::wait() const
+{
+    unique_lock<mutex> lock(m_mutex);
+    m_ready_condition.wait(lock, [this]() { return m_ready >= m_size || m_error; });
+    if (m_error)
+    {
+        rethrow_exception(m_error);
+    }
+}
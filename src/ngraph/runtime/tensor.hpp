@@ -16,7 +16,11 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <exception>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
@@ -35,6 +39,34 @@ namespace ngraph
 
     namespace runtime
     {
+        /// \brief Completion fence of a tensor that is written in chunks, see
+        ///        Tensor::begin_streaming_write. Backends that support streaming inputs start
+        ///        a call before its fences are ready and wait on them only before the parts of
+        ///        the call that read the tensors.
+        class NGRAPH_API TensorFence
+        {
+        public:
+            /// \param size_in_bytes Number of bytes that complete the tensor
+            TensorFence(size_t size_in_bytes);
+
+            /// \brief Counts `n` more bytes as written, releasing the waiters once all are
+            void add_ready(size_t n);
+            /// \brief Fails the fence; waiters rethrow `error`
+            void set_error(std::exception_ptr error);
+            bool is_ready() const;
+            size_t get_ready_bytes() const;
+            /// \brief Blocks until all bytes are written, rethrowing the error of a failed
+            ///        write
+            void wait() const;
+
+        private:
+            mutable std::mutex m_mutex;
+            mutable std::condition_variable m_ready_condition;
+            size_t m_size;
+            size_t m_ready = 0;
+            std::exception_ptr m_error;
+        };
+
         class NGRAPH_API Tensor
         {
         protected:
@@ -103,6 +135,33 @@ namespace ngraph
             /// \param n Number of bytes to read, must be integral number of elements.
             virtual void read(void* p, size_t n) const = 0;
 
+            /// \brief Write bytes into part of the tensor. Writes to disjoint ranges may run
+            ///        concurrently. Tensors that only support whole writes throw unless the
+            ///        range covers the tensor.
+            /// \param p Pointer to source of data
+            /// \param offset Byte offset of the range
+            /// \param n Number of bytes to write
+            virtual void write_at(const void* p, size_t offset, size_t n);
+
+            /// \brief Starts filling the tensor in chunks with write_async. On the CPU backend,
+            ///        calls made before all chunks arrive run the ops that do not read this
+            ///        tensor and wait for the fence before the rest; the PlaidML and dynamic
+            ///        backends wait for it before starting. With other backends, wait for the
+            ///        fence before calling.
+            /// \returns The fence, ready once get_size_in_bytes() bytes have been written
+            std::shared_ptr<TensorFence> begin_streaming_write();
+
+            /// \brief The fence of the last begin_streaming_write, or nullptr
+            std::shared_ptr<TensorFence> get_fence() const;
+
+            /// \brief Runs write_at on another thread and counts the bytes toward the fence
+            ///        once written. The data at `p` and the tensor must stay alive until the
+            ///        returned future is ready.
+            std::future<void> write_async(const void* p, size_t offset, size_t n);
+
+            /// \brief Waits for the fences of the tensors in `tensors` that have one
+            static void wait_for_fences(const std::vector<std::shared_ptr<Tensor>>& tensors);
+
             /// \brief copy bytes directly from source to this tensor
             /// \param source The source tensor
             virtual void copy_from(const ngraph::runtime::Tensor& source) NGRAPH_DEPRECATED(
@@ -112,6 +171,7 @@ namespace ngraph
         protected:
             std::shared_ptr<ngraph::descriptor::Tensor> m_descriptor;
             bool m_stale;
+            std::shared_ptr<TensorFence> m_fence;
         };
 
         using TensorViewPtrs = std::vector<std::shared_ptr<Tensor>>;
@@ -0,0 +1,174 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/runtime/tensor_pool.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    bool layout_matches(const runtime::Tensor& tensor,
+                        const shared_ptr<descriptor::layout::TensorLayout>& layout)
+    {
+        if (layout == nullptr)
+        {
+            return true;
+        }
+        auto tensor_layout = tensor.get_tensor_layout();
+        return tensor_layout == layout || (tensor_layout != nullptr && *tensor_layout == *layout);
+    }
+}
+
+runtime::TensorPool::TensorPool(Backend* backend,
+                                size_t max_tensors_per_key,
+                                size_t max_cached_bytes)
+    : m_backend(backend)
+    , m_state(make_shared<State>())
+{
+    m_state->max_tensors_per_key = max_tensors_per_key;
+    m_state->max_cached_bytes = max_cached_bytes;
+}
+
+shared_ptr<runtime::Tensor>
+    runtime::TensorPool::checkout(const element::Type& element_type,
+                                  const Shape& shape,
+                                  const shared_ptr<descriptor::layout::TensorLayout>& layout)
+{
+    {
+        lock_guard<mutex> lock(m_state->mutex);
+        m_state->checkouts++;
+        auto it = m_state->cache.find(Key(element_type, shape));
+        if (it != m_state->cache.end())
+        {
+            auto& tensors = it->second;
+            for (auto tensor = tensors.rbegin(); tensor != tensors.rend(); ++tensor)
+            {
+                if (layout_matches(**tensor, layout))
+                {
+                    auto rc = move(*tensor);
+                    tensors.erase(next(tensor).base());
+                    m_state->reuses++;
+                    m_state->cached_tensors--;
+                    m_state->cached_bytes -= rc->get_size_in_bytes();
+                    rc->set_stale(true);
+                    return lend(move(rc));
+                }
+            }
+        }
+    }
+
+    auto tensor = m_backend->create_tensor(element_type, shape);
+    if (layout != nullptr)
+    {
+        tensor->set_tensor_layout(layout);
+    }
+    return lend(move(tensor));
+}
+
+shared_ptr<runtime::Tensor> runtime::TensorPool::checkout_input(Executable& executable,
+                                                                size_t input_index)
+{
+    auto parameter = executable.get_parameters().at(input_index);
+    return checkout(parameter->get_element_type(),
+                    parameter->get_shape(),
+                    executable.get_input_layout(input_index));
+}
+
+shared_ptr<runtime::Tensor> runtime::TensorPool::checkout_output(Executable& executable,
+                                                                 size_t output_index)
+{
+    auto result = executable.get_results().at(output_index);
+    return checkout(result->get_element_type(),
+                    result->get_shape(),
+                    executable.get_output_layout(output_index));
+}
+
+shared_ptr<runtime::Tensor> runtime::TensorPool::lend(shared_ptr<Tensor> tensor)
+{
+    weak_ptr<State> state = m_state;
+    auto raw = tensor.get();
+    return shared_ptr<Tensor>(raw, [tensor, state](Tensor*) mutable {
+        if (auto owner = state.lock())
+        {
+            owner->give_back(move(tensor));
+        }
+        tensor = nullptr;
+    });
+}
+
+void runtime::TensorPool::set_limits(size_t max_tensors_per_key, size_t max_cached_bytes)
+{
+    lock_guard<mutex> lock(m_state->mutex);
+    m_state->max_tensors_per_key = max_tensors_per_key;
+    m_state->max_cached_bytes = max_cached_bytes;
+    m_state->trim();
+}
+
+void runtime::TensorPool::clear()
+{
+    decltype(m_state->cache) released;
+    {
+        lock_guard<mutex> lock(m_state->mutex);
+        swap(released, m_state->cache);
+        m_state->cached_tensors = 0;
+        m_state->cached_bytes = 0;
+    }
+}
+
+runtime::TensorPool::Statistics runtime::TensorPool::get_statistics() const
+{
+    lock_guard<mutex> lock(m_state->mutex);
+    Statistics rc;
+    rc.checkouts = m_state->checkouts;
+    rc.reuses = m_state->reuses;
+    rc.cached_tensors = m_state->cached_tensors;
+    rc.cached_bytes = m_state->cached_bytes;
+    return rc;
+}
+
+void runtime::TensorPool::State::give_back(shared_ptr<Tensor> tensor)
+{
+    size_t size = tensor->get_size_in_bytes();
+    lock_guard<std::mutex> lock(this->mutex);
+    auto& tensors = cache[Key(tensor->get_element_type(), tensor->get_shape())];
+    if (tensors.size() < max_tensors_per_key && cached_bytes + size <= max_cached_bytes)
+    {
+        tensors.push_back(move(tensor));
+        cached_tensors++;
+        cached_bytes += size;
+    }
+}
+
+void runtime::TensorPool::State::trim()
+{
+    for (auto& entry : cache)
+    {
+        auto& tensors = entry.second;
+        while (tensors.size() > max_tensors_per_key ||
+               (!tensors.empty() && cached_bytes > max_cached_bytes))
+        {
+            cached_bytes -= tensors.front()->get_size_in_bytes();
+            cached_tensors--;
+            tensors.erase(tensors.begin());
+        }
+    }
+}
@@ -0,0 +1,127 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "ngraph/descriptor/layout/tensor_layout.hpp"
+#include "ngraph/ngraph_visibility.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/type/element_type.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class Backend;
+        class Executable;
+        class Tensor;
+        class TensorPool;
+    }
+}
+
+/// \brief Cache of backend tensors for reuse across calls.
+///
+/// Tensors are checked out by element type, shape and layout, and return to the pool when
+/// the last reference to them is released, so callers that create tensors per request stop
+/// allocating once the pool is warm. The contents of a checked out tensor are whatever the
+/// previous user left in it. Tensors returned beyond the limits are freed.
+///
+/// checkout_input and checkout_output create tensors in the layout the executable prefers
+/// for that input or output; on the CPU backend calls then find the output layouts already
+/// in place and skip propagating them.
+///
+/// Get the pool of a backend with Backend::get_tensor_pool. Tensors may outlive the pool,
+/// in which case they are freed when released.
+class NGRAPH_API ngraph::runtime::TensorPool
+{
+public:
+    struct Statistics
+    {
+        /// Number of checkouts
+        size_t checkouts;
+        /// Number of checkouts served from the pool
+        size_t reuses;
+        /// Tensors currently waiting in the pool
+        size_t cached_tensors;
+        /// Bytes of the tensors waiting in the pool
+        size_t cached_bytes;
+    };
+
+    /// \param backend Creates the tensors; must outlive the pool
+    /// \param max_tensors_per_key Upper bound on cached tensors of one type, shape and layout
+    /// \param max_cached_bytes Upper bound on the bytes of all cached tensors
+    TensorPool(Backend* backend,
+               size_t max_tensors_per_key = 16,
+               size_t max_cached_bytes = SIZE_MAX);
+
+    /// \brief Checks out a tensor, reusing a cached one if possible
+    /// \param layout Required layout, or nullptr to accept any cached tensor of the type and
+    ///        shape; new tensors keep the backend's default layout then
+    std::shared_ptr<Tensor>
+        checkout(const element::Type& element_type,
+                 const Shape& shape,
+                 const std::shared_ptr<descriptor::layout::TensorLayout>& layout = nullptr);
+
+    /// \brief Checks out a tensor for input `input_index` of `executable`
+    std::shared_ptr<Tensor> checkout_input(Executable& executable, size_t input_index);
+
+    /// \brief Checks out a tensor for output `output_index` of `executable`
+    std::shared_ptr<Tensor> checkout_output(Executable& executable, size_t output_index);
+
+    /// \brief Changes the limits; cached tensors beyond them are freed
+    void set_limits(size_t max_tensors_per_key, size_t max_cached_bytes);
+
+    /// \brief Frees every cached tensor. Checked out tensors still return when released.
+    void clear();
+
+    Statistics get_statistics() const;
+
+private:
+    TensorPool(const TensorPool&) = delete;
+    TensorPool& operator=(const TensorPool&) = delete;
+
+    using Key = std::pair<element::Type, Shape>;
+
+    // Shared with the deleters of checked out tensors so that they can return after the
+    // pool is gone
+    struct State
+    {
+        void give_back(std::shared_ptr<Tensor> tensor);
+        void trim();
+
+        std::mutex mutex;
+        std::map<Key, std::vector<std::shared_ptr<Tensor>>> cache;
+        size_t max_tensors_per_key;
+        size_t max_cached_bytes;
+        size_t checkouts = 0;
+        size_t reuses = 0;
+        size_t cached_tensors = 0;
+        size_t cached_bytes = 0;
+    };
+
+    std::shared_ptr<Tensor> lend(std::shared_ptr<Tensor> tensor);
+
+    Backend* m_backend;
+    std::shared_ptr<State> m_state;
+};
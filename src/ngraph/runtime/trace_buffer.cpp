@@ -14,32 +14,23 @@
 // limitations under the License.
 //*****************************************************************************
 
-// NOTE: This file follows nGraph format style and MLIR naming convention since it does
-// not expose public API to the rest of nGraph codebase and heavily depends on MLIR API.
+#include "ngraph/runtime/trace_buffer.hpp"
 
-#include "memory_manager.hpp"
-#include <memory>
-#include "ngraph/ngraph_visibility.hpp"
+using namespace std;
+using namespace ngraph;
 
-using namespace ngraph::runtime::ngmlir;
-
-/// Call back to allocate memory for temps from JIT'ed code
-extern "C" NGRAPH_API void* __mlir_allocate(MLIRMemMgr* memMgr, size_t size)
-{
-    return memMgr->allocate(size);
-}
-
-void* MLIRMemMgr::allocate(size_t size)
+static size_t round_up_to_power_of_two(size_t n)
 {
-    void* ptr = malloc(size);
-    ptrList.push_back(ptr);
-    return ptr;
+    size_t rc = 1;
+    while (rc < n)
+    {
+        rc <<= 1;
+    }
+    return rc;
 }
 
-void MLIRMemMgr::freeAll()
+runtime::event::TraceBuffer::TraceBuffer(size_t capacity)
+    : m_records(round_up_to_power_of_two(capacity))
+    , m_mask(m_records.size() - 1)
 {
-    for (auto p : ptrList)
-    {
-        free(p);
-    }
 }
@@ -0,0 +1,102 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace event
+        {
+            struct TraceRecord;
+            class TraceBuffer;
+        }
+    }
+}
+
+/// \brief A compact trace event. Times are in microseconds, names and categories are ids into the
+///        table kept by event::Manager, and the thread is implied by the buffer that holds the
+///        record.
+struct ngraph::runtime::event::TraceRecord
+{
+    uint64_t start;
+    uint64_t duration;
+    uint32_t name;
+    uint32_t category;
+};
+
+/// \brief Fixed-size lock-free ring of trace records with one producer and one consumer.
+///
+/// Each traced thread owns one buffer and is its only producer; the trace flusher is the only
+/// consumer. When the ring is full new records are dropped and counted rather than blocking
+/// the traced thread.
+class NGRAPH_API ngraph::runtime::event::TraceBuffer
+{
+public:
+    /// \param capacity Number of records, rounded up to a power of two
+    explicit TraceBuffer(size_t capacity);
+
+    /// \brief Appends a record. Must only be called from the owning thread.
+    /// \returns false if the buffer was full and the record was dropped
+    bool push(const TraceRecord& record)
+    {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) == m_records.size())
+        {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        m_records[head & m_mask] = record;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// \brief Passes every buffered record to f in order and removes them. Must only be called
+    ///        from one thread at a time.
+    template <typename F>
+    size_t drain(F f)
+    {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        size_t head = m_head.load(std::memory_order_acquire);
+        for (size_t i = tail; i != head; i++)
+        {
+            f(m_records[i & m_mask]);
+        }
+        m_tail.store(head, std::memory_order_release);
+        return head - tail;
+    }
+
+    size_t get_capacity() const { return m_records.size(); }
+    /// \brief Number of records dropped because the buffer was full
+    size_t get_dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+    TraceBuffer(const TraceBuffer&) = delete;
+    TraceBuffer& operator=(const TraceBuffer&) = delete;
+
+private:
+    std::vector<TraceRecord> m_records;
+    size_t m_mask;
+    std::atomic<size_t> m_head{0};
+    std::atomic<size_t> m_tail{0};
+    std::atomic<size_t> m_dropped{0};
+};
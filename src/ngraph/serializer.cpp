@@ -14,17 +14,36 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
 #include <fstream>
 #include <functional>
+#include <mutex>
 #include <queue>
+#include <sstream>
 #include <stack>
+#include <thread>
+#include <unordered_map>
 
+#ifdef NGRAPH_LZ4_ENABLE
+#include <lz4.h>
+#endif
+#ifdef NGRAPH_ZSTD_ENABLE
+#include <zstd.h>
+#endif
+
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/cpio.hpp"
+#include "ngraph/factory.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/provenance.hpp"
+#include "ngraph/runtime/mapped_buffer.hpp"
 #include "ngraph/serializer.hpp"
+#include "ngraph/type/float16.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
 
@@ -69,7 +88,7 @@ static OP_TYPEID get_typeid(const NodeTypeInfo& type_info)
     // {Abs::type_info, OP_TYPEID::Abs},
     // {Acos::type_info, OP_TYPEID::Acos},
     // ...
-    static const map<NodeTypeInfo, OP_TYPEID> type_info_map{
+    static const unordered_map<NodeTypeInfo, OP_TYPEID> type_info_map{
 #define NGRAPH_OP(NAME, NAMESPACE, VERSION)                                                        \
     {NAMESPACE::NAME::type_info, OP_TYPEID::VSUF##VERSION(NAME)},
 #include "ngraph/op/op_version_tbl.hpp"
@@ -85,13 +104,13 @@ static OP_TYPEID get_typeid(const NodeTypeInfo& type_info)
     return rc;
 }
 
-bool has_key(json j, const std::string& key)
+bool has_key(const json& j, const std::string& key)
 {
     return j.count(key) != 0;
 }
 
 template <typename T>
-T get_or_default(json j, const std::string& key, const T& default_value)
+T get_or_default(const json& j, const std::string& key, const T& default_value)
 {
     return has_key(j, key) ? j.at(key).get<T>() : default_value;
 }
@@ -121,11 +140,19 @@ public:
     json serialize_tensor_iterator_output_description(
         const std::shared_ptr<op::TensorIterator::OutputDescription>&);
 
+    /// \brief The Constants, including those nested in TensorIterator bodies, whose data was
+    ///        left out of the json because binary constant data is enabled
+    const vector<const op::Constant*>& get_binary_constants() const
+    {
+        return m_binary_constants;
+    }
+
 protected:
     size_t m_indent{0};
     bool m_serialize_output_shapes{false};
     bool m_binary_constant_data{false};
     json m_json_nodes;
+    vector<const op::Constant*> m_binary_constants;
 };
 
 class JSONDeserializer
@@ -136,13 +163,16 @@ public:
         m_const_data_callback = const_data_callback;
     }
 
-    shared_ptr<Function> deserialize_function(json j);
-    Output<Node> deserialize_output(json j);
-    OutputVector deserialize_output_vector(json j);
-    ParameterVector deserialize_parameter_vector(json j);
-    shared_ptr<Node> deserialize_node_reference(json j);
-    shared_ptr<Node> deserialize_node(json j);
-    AxisSet deserialize_axis_set(json j);
+    shared_ptr<Function> deserialize_function(const json& j);
+    /// \brief Creates the Function from its name, parameters and results once all of its
+    ///        nodes have been deserialized
+    shared_ptr<Function> deserialize_function_signature(const json& j);
+    Output<Node> deserialize_output(const json& j);
+    OutputVector deserialize_output_vector(const json& j);
+    ParameterVector deserialize_parameter_vector(const json& j);
+    shared_ptr<Node> deserialize_node_reference(const json& j);
+    shared_ptr<Node> deserialize_node(const json& j);
+    AxisSet deserialize_axis_set(const json& j);
     shared_ptr<op::TensorIterator::InputDescription>
         deserialize_tensor_iterator_input_description(json j);
     shared_ptr<op::TensorIterator::OutputDescription>
@@ -154,6 +184,43 @@ protected:
     function<const_data_callback_t> m_const_data_callback;
 };
 
+// Deserializes while nlohmann::json parses the input, so the json for the whole model is never
+// held in memory. Each element of a function's "ops" array is deserialized and discarded as soon
+// as it has been parsed, and the value strings of a Constant are decoded straight into the
+// Constant's buffer. The value strings can only be decoded as they arrive if the Constant's
+// "element_type", "op" and "shape" come before its "value", which holds for json written by
+// serialize() since its keys are sorted; otherwise the strings are kept and decoded as usual.
+class JSONStreamingDeserializer : public JSONDeserializer
+{
+public:
+    JSONStreamingDeserializer();
+
+    json::parser_callback_t get_parser_callback();
+    shared_ptr<Function> get_function() const { return m_function; }
+private:
+    bool handle_event(int depth, json::parse_event_t event, json& parsed);
+    void append_constant_value(const string& value);
+
+    // Depths of the parser events, counting enclosing containers, for
+    // [ { "ops" : [ { "value" : [ "1", ... ], ... }, ... ], ... } ]
+    static const int s_function_depth = 1;
+    static const int s_node_depth = 3;
+    static const int s_node_value_depth = 5;
+
+    shared_ptr<Function> m_function;
+    string m_function_key;
+    string m_node_key;
+    string m_node_op;
+    string m_node_element_type;
+    Shape m_node_shape;
+    // The Constant data being decoded, or the decoded data until the Constant is created
+    shared_ptr<runtime::AlignedBuffer> m_constant_data;
+    element::Type m_constant_element_type;
+    size_t m_constant_element_count{0};
+    size_t m_constant_values{0};
+    bool m_decoding_constant{false};
+};
+
 static string
     serialize(shared_ptr<ngraph::Function> func, size_t indent, bool binary_constant_data);
 
@@ -169,7 +236,7 @@ static json write_dimension(Dimension d)
     }
 }
 
-static Dimension read_dimension(json j)
+static Dimension read_dimension(const json& j)
 {
     if (j.is_null())
     {
@@ -198,7 +265,7 @@ static json write_partial_shape(const PartialShape& s)
     }
 }
 
-static PartialShape read_partial_shape(json j)
+static PartialShape read_partial_shape(const json& j)
 {
     if (j.is_null())
     {
@@ -224,13 +291,13 @@ static json write_auto_broadcast(const op::AutoBroadcastSpec& autob)
 }
 
 static op::AutoBroadcastSpec
-    read_auto_broadcast(json js_node,
+    read_auto_broadcast(const json& js_node,
                         const std::string& attr,
                         const op::AutoBroadcastSpec& autob = op::AutoBroadcastSpec())
 {
     if (has_key(js_node, attr))
     {
-        json j = js_node[attr];
+        const json& j = js_node.at(attr);
         return op::AutoBroadcastSpec(static_cast<op::AutoBroadcastType>(j.at("type")),
                                      j.at("axis").get<int64_t>());
     }
@@ -240,19 +307,19 @@ static op::AutoBroadcastSpec
     }
 }
 
-static op::PadType read_pad_type(json node_js)
+static op::PadType read_pad_type(const json& node_js)
 {
     return has_key(node_js, "pad_type") ? static_cast<op::PadType>(node_js.at("pad_type"))
                                         : op::PadType::EXPLICIT;
 }
 
-static op::PadMode read_pad_mode(json node_js)
+static op::PadMode read_pad_mode(const json& node_js)
 {
     return has_key(node_js, "pad_mode") ? static_cast<op::PadMode>(node_js.at("pad_mode"))
                                         : op::PadMode::CONSTANT;
 }
 
-static op::RoundingType read_rounding_type(json node_js)
+static op::RoundingType read_rounding_type(const json& node_js)
 {
     return has_key(node_js, "rounding_type")
                ? static_cast<op::RoundingType>(node_js.at("rounding_type"))
@@ -266,7 +333,7 @@ static json write_element_type(const ngraph::element::Type& n)
     return j;
 }
 
-static element::Type read_element_type(json j)
+static element::Type read_element_type(const json& j)
 {
     size_t bitwidth = 0;
     bool is_real = false;
@@ -300,6 +367,116 @@ static element::Type read_element_type(json j)
     return element::Type(bitwidth, is_real, is_signed, is_quantized, c_type_string);
 }
 
+// Ops without a case of their own in the serializer are written through the attributes they
+// visit, into an "attributes" object, and read back into an op made by the factory registry
+class JSONAttributeSerializer : public AttributeVisitor
+{
+public:
+    JSONAttributeSerializer(json& attributes)
+        : m_json(attributes)
+    {
+    }
+
+    void on_attribute(const string& name, string& value) override { m_json[name] = value; }
+    void on_attribute(const string& name, bool& value) override { m_json[name] = value; }
+    void on_adapter(const string& name, ValueAccessor<void>& adapter) override
+    {
+        if (auto a = as_type<AttributeAdapter<element::Type>>(&adapter))
+        {
+            m_json[name] = write_element_type(static_cast<element::Type&>(*a));
+        }
+        else if (auto a = as_type<AttributeAdapter<PartialShape>>(&adapter))
+        {
+            m_json[name] = write_partial_shape(static_cast<PartialShape&>(*a));
+        }
+        else if (auto a = as_type<AttributeAdapter<op::AutoBroadcastSpec>>(&adapter))
+        {
+            m_json[name] = write_auto_broadcast(static_cast<op::AutoBroadcastSpec&>(*a));
+        }
+        else
+        {
+            throw ngraph_error("Cannot serialize attribute " + name + " of type " +
+                               adapter.get_type_info().name);
+        }
+    }
+    void on_adapter(const string& name, ValueAccessor<string>& adapter) override
+    {
+        m_json[name] = adapter.get();
+    }
+    void on_adapter(const string& name, ValueAccessor<vector<int64_t>>& adapter) override
+    {
+        m_json[name] = adapter.get();
+    }
+    void on_adapter(const string& name, ValueAccessor<int64_t>& adapter) override
+    {
+        m_json[name] = adapter.get();
+    }
+    void on_adapter(const string& name, ValueAccessor<double>& adapter) override
+    {
+        m_json[name] = adapter.get();
+    }
+
+private:
+    json& m_json;
+};
+
+class JSONAttributeDeserializer : public AttributeVisitor
+{
+public:
+    JSONAttributeDeserializer(const json& attributes)
+        : m_json(attributes)
+    {
+    }
+
+    void on_attribute(const string& name, string& value) override
+    {
+        value = m_json.at(name).get<string>();
+    }
+    void on_attribute(const string& name, bool& value) override
+    {
+        value = m_json.at(name).get<bool>();
+    }
+    void on_adapter(const string& name, ValueAccessor<void>& adapter) override
+    {
+        if (auto a = as_type<AttributeAdapter<element::Type>>(&adapter))
+        {
+            static_cast<element::Type&>(*a) = read_element_type(m_json.at(name));
+        }
+        else if (auto a = as_type<AttributeAdapter<PartialShape>>(&adapter))
+        {
+            static_cast<PartialShape&>(*a) = read_partial_shape(m_json.at(name));
+        }
+        else if (auto a = as_type<AttributeAdapter<op::AutoBroadcastSpec>>(&adapter))
+        {
+            static_cast<op::AutoBroadcastSpec&>(*a) = read_auto_broadcast(m_json, name);
+        }
+        else
+        {
+            throw ngraph_error("Cannot deserialize attribute " + name + " of type " +
+                               adapter.get_type_info().name);
+        }
+    }
+    void on_adapter(const string& name, ValueAccessor<string>& adapter) override
+    {
+        adapter.set(m_json.at(name).get<string>());
+    }
+    void on_adapter(const string& name, ValueAccessor<vector<int64_t>>& adapter) override
+    {
+        adapter.set(m_json.at(name).get<vector<int64_t>>());
+    }
+    void on_adapter(const string& name, ValueAccessor<int64_t>& adapter) override
+    {
+        adapter.set(m_json.at(name).get<int64_t>());
+    }
+    void on_adapter(const string& name, ValueAccessor<double>& adapter) override
+    {
+        adapter.set(m_json.at(name).get<double>());
+    }
+
+private:
+    const json& m_json;
+};
+
 void ngraph::serialize(const string& path, shared_ptr<ngraph::Function> func, size_t indent)
 {
     ofstream out(path);
@@ -311,6 +488,11 @@ void ngraph::serialize(ostream& out, shared_ptr<ngraph::Function> func, size_t i
     out << ::serialize(func, indent, false);
 }
 
+// Constant records are aligned like Constant's own buffers so they can be mapped in place
+static const size_t s_binary_constant_alignment = 64;
+// Smaller constants are copied, sparing a page per constant
+static const size_t s_min_mapped_constant_size = 4096;
+
 #if defined ENABLE_CPIO_FILE
 static void serialize_to_cpio(ostream& out, shared_ptr<ngraph::Function> func, size_t indent)
 {
@@ -320,18 +502,619 @@ static void serialize_to_cpio(ostream& out, shared_ptr<ngraph::Function> func, s
 
     traverse_nodes(const_cast<Function*>(func.get()),
                    [&](shared_ptr<Node> node) {
-                       if (auto c = node->as_type<op::Constant>())
+                       if (auto c = as_type_ptr<op::Constant>(node))
                        {
                            uint32_t size =
                                static_cast<uint32_t>(shape_size(c->get_output_shape(0)) *
                                                      c->get_output_element_type(0).size());
-                           writer.write(c->get_name(), c->get_data_ptr(), size);
+                           writer.write(c->get_name(),
+                                        c->get_data_ptr(),
+                                        size,
+                                        s_binary_constant_alignment);
                        }
                    },
                    true);
 }
 #endif
 
+// Binary model format
+//
+// The graph is stored as flat tables so it can be read one node at a time, without building
+// a json document for the whole model:
+//
+//     header          "NGRAPHB\0", u32 format version
+//     strings         u32 count, then u32 length and bytes per string
+//     constants       u32 count, then u32 node name, u64 file offset, u64 stored size,
+//                     u64 size, u8 compression and u8 f16 flag per Constant
+//     nodes           u32 count, then one record per node in topological order
+//     function        u32 name, u32 count + u32 node per parameter, same for results
+//     constant data   each Constant's data starts on a page boundary
+//
+// A node record is u32 type name, u64 type version, u32 name, u32 friendly name, u32 count +
+// (u32 node, u32 output index) per input, u32 count + u32 node per control dependency,
+// u32 count + u32 tensor name per output and finally u32 size + the CBOR encoding of the
+// remaining json attributes of the node, as produced by JSONSerializer. Strings and nodes are
+// referred to by their index in their table. Integers are in host byte order, like the
+// constant data.
+//
+// The data of a Constant is stored compressed with BinarySerializeOptions::Compression when
+// that makes it smaller, and f32 data flagged f16 is stored as f16 before any compression.
+// Version 1 models, whose constant table only has the name, offset and size, are still read.
+static const char s_binary_magic[8] = {'N', 'G', 'R', 'A', 'P', 'H', 'B', '\0'};
+static const uint32_t s_binary_version = 2;
+static const size_t s_binary_page_size = 4096;
+
+// json keys that are stored in the node record itself rather than the attributes
+static const vector<string> s_binary_node_keys = {
+    "type_info", "op", "name", "friendly_name", "inputs", "control_deps", "outputs"};
+
+template <typename T>
+static void write_binary(ostream& out, T value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+static T read_binary(istream& in)
+{
+    T value;
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    if (!in)
+    {
+        throw ngraph_error("Unexpected end of binary model");
+    }
+    return value;
+}
+
+static size_t round_up_to_page(size_t offset)
+{
+    return (offset + s_binary_page_size - 1) / s_binary_page_size * s_binary_page_size;
+}
+
+using Compression = BinarySerializeOptions::Compression;
+
+bool ngraph::BinarySerializeOptions::is_supported(Compression compression)
+{
+    switch (compression)
+    {
+    case Compression::NONE: return true;
+#ifdef NGRAPH_LZ4_ENABLE
+    case Compression::LZ4: return true;
+#endif
+#ifdef NGRAPH_ZSTD_ENABLE
+    case Compression::ZSTD: return true;
+#endif
+    default: return false;
+    }
+}
+
+// Returns the `size` bytes at `data` compressed, or nothing if they do not get smaller
+static vector<char> compress(Compression compression, const char* data, size_t size)
+{
+    vector<char> rc;
+    switch (compression)
+    {
+    case Compression::NONE: break;
+    case Compression::LZ4:
+#ifdef NGRAPH_LZ4_ENABLE
+        if (size <= static_cast<size_t>(LZ4_MAX_INPUT_SIZE))
+        {
+            rc.resize(static_cast<size_t>(LZ4_compressBound(static_cast<int>(size))));
+            int compressed_size = LZ4_compress_default(
+                data, rc.data(), static_cast<int>(size), static_cast<int>(rc.size()));
+            rc.resize(compressed_size > 0 ? static_cast<size_t>(compressed_size) : 0);
+        }
+#endif
+        break;
+    case Compression::ZSTD:
+#ifdef NGRAPH_ZSTD_ENABLE
+    {
+        rc.resize(ZSTD_compressBound(size));
+        // zstd's default level
+        size_t compressed_size = ZSTD_compress(rc.data(), rc.size(), data, size, 3);
+        rc.resize(ZSTD_isError(compressed_size) ? 0 : compressed_size);
+    }
+#endif
+    break;
+    }
+    if (rc.size() >= size)
+    {
+        rc.clear();
+    }
+    return rc;
+}
+
+// Decompresses the `size` bytes at `data` into the `out_size` bytes at `out`
+static void decompress(
+    Compression compression, const char* data, size_t size, char* out, size_t out_size)
+{
+    bool decompressed = false;
+    switch (compression)
+    {
+    case Compression::NONE:
+        decompressed = size == out_size;
+        if (decompressed)
+        {
+            memcpy(out, data, size);
+        }
+        break;
+    case Compression::LZ4:
+#ifdef NGRAPH_LZ4_ENABLE
+        decompressed =
+            out_size <= static_cast<size_t>(LZ4_MAX_INPUT_SIZE) &&
+            LZ4_decompress_safe(
+                data, out, static_cast<int>(size), static_cast<int>(out_size)) ==
+                static_cast<int>(out_size);
+#endif
+        break;
+    case Compression::ZSTD:
+#ifdef NGRAPH_ZSTD_ENABLE
+    {
+        size_t decompressed_size = ZSTD_decompress(out, out_size, data, size);
+        decompressed = !ZSTD_isError(decompressed_size) && decompressed_size == out_size;
+    }
+#endif
+    break;
+    }
+    if (!decompressed)
+    {
+        throw ngraph_error("Corrupt constant data in binary model");
+    }
+}
+
+// Calls f(0), ..., f(count - 1) on up to one thread per core and rethrows the first exception
+static void parallel_for(size_t count, const function<void(size_t)>& f)
+{
+    atomic<size_t> next{0};
+    exception_ptr error;
+    mutex error_mutex;
+    auto run = [&]() {
+        try
+        {
+            for (size_t i = next++; i < count; i = next++)
+            {
+                f(i);
+            }
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(error_mutex);
+            if (!error)
+            {
+                error = current_exception();
+            }
+            next = count;
+        }
+    };
+
+    vector<thread> threads;
+    size_t thread_count = min<size_t>(max<size_t>(thread::hardware_concurrency(), 1), count);
+    for (size_t i = 1; i < thread_count; i++)
+    {
+        threads.emplace_back(run);
+    }
+    run();
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+}
+
+static bool is_binary_model(istream& in)
+{
+    auto offset = in.tellg();
+    char magic[sizeof(s_binary_magic)] = {};
+    in.read(magic, sizeof(magic));
+    bool rc = in.gcount() == sizeof(magic) && memcmp(magic, s_binary_magic, sizeof(magic)) == 0;
+    in.clear();
+    in.seekg(offset, ios_base::beg);
+    return rc;
+}
+
+void ngraph::serialize_binary(ostream& out, shared_ptr<ngraph::Function> func)
+{
+    serialize_binary(out, func, BinarySerializeOptions());
+}
+
+void ngraph::serialize_binary(ostream& out,
+                              shared_ptr<ngraph::Function> func,
+                              const BinarySerializeOptions& options)
+{
+    if (!BinarySerializeOptions::is_supported(options.compression))
+    {
+        throw ngraph_error("Constant compression is not supported by this build of nGraph");
+    }
+
+    JSONSerializer serializer;
+    serializer.set_binary_constant_data(true);
+    serializer.set_serialize_output_shapes(s_serialize_output_shapes_enabled);
+
+    vector<string> strings;
+    unordered_map<string, uint32_t> string_index;
+    auto intern = [&](const string& str) {
+        auto it = string_index.find(str);
+        if (it == string_index.end())
+        {
+            it = string_index.insert({str, static_cast<uint32_t>(strings.size())}).first;
+            strings.push_back(str);
+        }
+        return it->second;
+    };
+
+    unordered_map<const Node*, uint32_t> node_index;
+    uint32_t next_node_index = 0;
+    stringstream nodes;
+    list<shared_ptr<Node>> ops = func->get_ordered_ops(true);
+    write_binary<uint32_t>(nodes, static_cast<uint32_t>(ops.size()));
+    for (const shared_ptr<Node>& node : ops)
+    {
+        json attributes = serializer.serialize_node(*node);
+        for (const string& key : s_binary_node_keys)
+        {
+            attributes.erase(key);
+        }
+
+        const NodeTypeInfo& type_info = node->get_type_info();
+        write_binary<uint32_t>(nodes, intern(type_info.name));
+        write_binary<uint64_t>(nodes, type_info.version);
+        write_binary<uint32_t>(nodes, intern(node->get_name()));
+        write_binary<uint32_t>(nodes, intern(node->get_friendly_name()));
+        write_binary<uint32_t>(nodes, static_cast<uint32_t>(node->get_input_size()));
+        for (auto& input : node->inputs())
+        {
+            Output<Node> source = input.get_source_output();
+            write_binary<uint32_t>(nodes, node_index.at(source.get_node()));
+            write_binary<uint32_t>(nodes, static_cast<uint32_t>(source.get_index()));
+        }
+        write_binary<uint32_t>(nodes,
+                               static_cast<uint32_t>(node->get_control_dependencies().size()));
+        for (auto& control_dep : node->get_control_dependencies())
+        {
+            write_binary<uint32_t>(nodes, node_index.at(control_dep.get()));
+        }
+        write_binary<uint32_t>(nodes, static_cast<uint32_t>(node->get_output_size()));
+        for (auto& output : node->outputs())
+        {
+            write_binary<uint32_t>(nodes, intern(output.get_tensor().get_name()));
+        }
+        vector<uint8_t> cbor = json::to_cbor(attributes);
+        write_binary<uint32_t>(nodes, static_cast<uint32_t>(cbor.size()));
+        nodes.write(reinterpret_cast<const char*>(cbor.data()), cbor.size());
+
+        node_index[node.get()] = next_node_index++;
+    }
+
+    write_binary<uint32_t>(nodes, intern(func->get_name()));
+    write_binary<uint32_t>(nodes, static_cast<uint32_t>(func->get_parameters().size()));
+    for (auto& parameter : func->get_parameters())
+    {
+        write_binary<uint32_t>(nodes, node_index.at(parameter.get()));
+    }
+    write_binary<uint32_t>(nodes, static_cast<uint32_t>(func->get_results().size()));
+    for (auto& result : func->get_results())
+    {
+        write_binary<uint32_t>(nodes, node_index.at(result.get()));
+    }
+
+    const vector<const op::Constant*>& constants = serializer.get_binary_constants();
+    for (const op::Constant* constant : constants)
+    {
+        intern(constant->get_name());
+    }
+
+    stringstream header;
+    header.write(s_binary_magic, sizeof(s_binary_magic));
+    write_binary<uint32_t>(header, s_binary_version);
+    write_binary<uint32_t>(header, static_cast<uint32_t>(strings.size()));
+    for (const string& str : strings)
+    {
+        write_binary<uint32_t>(header, static_cast<uint32_t>(str.size()));
+        header.write(str.data(), str.size());
+    }
+
+    // The data as it is stored, which is the Constant's own data unless it was encoded
+    struct StoredConstant
+    {
+        const char* data;
+        size_t stored_size;
+        size_t size;
+        Compression compression;
+        bool f16;
+        vector<char> buffer;
+    };
+    vector<StoredConstant> stored(constants.size());
+    parallel_for(constants.size(), [&](size_t i) {
+        const op::Constant* constant = constants[i];
+        StoredConstant& c = stored[i];
+        c.size = shape_size(constant->get_shape()) * constant->get_element_type().size();
+        c.data = static_cast<const char*>(constant->get_data_ptr());
+        c.stored_size = c.size;
+        c.compression = Compression::NONE;
+        c.f16 = options.f16_constants && constant->get_element_type() == element::f32;
+        if (c.f16)
+        {
+            size_t count = shape_size(constant->get_shape());
+            c.buffer.resize(count * sizeof(float16));
+            const float* values = constant->get_data_ptr<float>();
+            float16* halves = reinterpret_cast<float16*>(c.buffer.data());
+            for (size_t j = 0; j < count; j++)
+            {
+                halves[j] = float16(values[j]);
+            }
+            c.data = c.buffer.data();
+            c.stored_size = c.buffer.size();
+        }
+        vector<char> compressed = compress(options.compression, c.data, c.stored_size);
+        if (!compressed.empty())
+        {
+            c.buffer = move(compressed);
+            c.data = c.buffer.data();
+            c.stored_size = c.buffer.size();
+            c.compression = options.compression;
+        }
+    });
+
+    // The constant table has a fixed size, so the data offsets are known before it is written
+    size_t table_size =
+        sizeof(uint32_t) +
+        constants.size() * (sizeof(uint32_t) + 3 * sizeof(uint64_t) + 2 * sizeof(uint8_t));
+    size_t data_offset =
+        round_up_to_page(static_cast<size_t>(header.tellp()) + table_size + nodes.tellp());
+    write_binary<uint32_t>(header, static_cast<uint32_t>(constants.size()));
+    for (size_t i = 0; i < constants.size(); i++)
+    {
+        write_binary<uint32_t>(header, string_index.at(constants[i]->get_name()));
+        write_binary<uint64_t>(header, data_offset);
+        write_binary<uint64_t>(header, stored[i].stored_size);
+        write_binary<uint64_t>(header, stored[i].size);
+        write_binary<uint8_t>(header, static_cast<uint8_t>(stored[i].compression));
+        write_binary<uint8_t>(header, stored[i].f16);
+        data_offset = round_up_to_page(data_offset + stored[i].stored_size);
+    }
+
+    out << header.rdbuf() << nodes.rdbuf();
+    string pad(s_binary_page_size, '\0');
+    for (const StoredConstant& c : stored)
+    {
+        size_t offset = static_cast<size_t>(out.tellp());
+        out.write(pad.data(), round_up_to_page(offset) - offset);
+        out.write(c.data, c.stored_size);
+    }
+}
+
+void ngraph::serialize_binary(const string& path, shared_ptr<ngraph::Function> func)
+{
+    serialize_binary(path, func, BinarySerializeOptions());
+}
+
+void ngraph::serialize_binary(const string& path,
+                              shared_ptr<ngraph::Function> func,
+                              const BinarySerializeOptions& options)
+{
+    ofstream out(path, ios_base::binary | ios_base::out);
+    serialize_binary(out, func, options);
+}
+
+// Reads a binary model from `in` one node at a time. If `path` names the file being read,
+// large constants are mapped from it instead of being copied.
+static shared_ptr<ngraph::Function> deserialize_binary(istream& in, const string& path)
+{
+    static const bool s_mmap_disabled = std::getenv("NGRAPH_DISABLE_CONSTANT_MMAP") != nullptr;
+    shared_ptr<runtime::MappedFile> mapped_file;
+    if (!path.empty() && !s_mmap_disabled)
+    {
+        mapped_file = make_shared<runtime::MappedFile>(path);
+    }
+
+    in.seekg(sizeof(s_binary_magic), ios_base::cur);
+    uint32_t version = read_binary<uint32_t>(in);
+    if (version < 1 || version > s_binary_version)
+    {
+        throw ngraph_error("Unsupported binary model version " + to_string(version));
+    }
+
+    vector<string> strings(read_binary<uint32_t>(in));
+    for (string& str : strings)
+    {
+        str.resize(read_binary<uint32_t>(in));
+        in.read(&str[0], str.size());
+    }
+    auto get_string = [&](uint32_t index) -> const string& { return strings.at(index); };
+
+    struct StoredConstant
+    {
+        uint64_t offset;
+        uint64_t stored_size;
+        uint64_t size;
+        Compression compression;
+        bool f16;
+        // The decoded data of encoded constants
+        shared_ptr<runtime::AlignedBuffer> buffer;
+    };
+    unordered_map<string, StoredConstant> constants;
+    vector<StoredConstant*> encoded;
+    uint32_t constant_count = read_binary<uint32_t>(in);
+    for (uint32_t i = 0; i < constant_count; i++)
+    {
+        const string& name = get_string(read_binary<uint32_t>(in));
+        StoredConstant& c = constants[name];
+        c.offset = read_binary<uint64_t>(in);
+        c.stored_size = read_binary<uint64_t>(in);
+        c.size = c.stored_size;
+        c.compression = Compression::NONE;
+        c.f16 = false;
+        if (version >= 2)
+        {
+            c.size = read_binary<uint64_t>(in);
+            c.compression = static_cast<Compression>(read_binary<uint8_t>(in));
+            c.f16 = read_binary<uint8_t>(in) != 0;
+        }
+        if (c.compression > Compression::ZSTD ||
+            !BinarySerializeOptions::is_supported(c.compression))
+        {
+            throw ngraph_error("Binary model has constants compressed with a codec not supported "
+                               "by this build of nGraph");
+        }
+        if (c.compression != Compression::NONE || c.f16)
+        {
+            encoded.push_back(&c);
+        }
+    }
+
+    // Encoded constants are decoded up front on several threads, each straight into the buffer
+    // its Constant will use. The stored data is read on this thread unless the file is mapped.
+    vector<vector<char>> encoded_data(mapped_file ? 0 : encoded.size());
+    if (!mapped_file && !encoded.empty())
+    {
+        auto position = in.tellg();
+        for (size_t i = 0; i < encoded.size(); i++)
+        {
+            encoded_data[i].resize(encoded[i]->stored_size);
+            in.seekg(encoded[i]->offset, ios_base::beg);
+            in.read(encoded_data[i].data(), encoded_data[i].size());
+            if (!in)
+            {
+                throw ngraph_error("Unexpected end of binary model");
+            }
+        }
+        in.seekg(position, ios_base::beg);
+    }
+    parallel_for(encoded.size(), [&](size_t i) {
+        StoredConstant& c = *encoded[i];
+        const char* data = nullptr;
+        if (mapped_file)
+        {
+            if (c.offset + c.stored_size > mapped_file->size())
+            {
+                throw ngraph_error("Unexpected end of binary model");
+            }
+            data = mapped_file->get_ptr() + c.offset;
+        }
+        else
+        {
+            data = encoded_data[i].data();
+        }
+        c.buffer = make_shared<runtime::AlignedBuffer>(c.size);
+        if (c.f16)
+        {
+            size_t count = c.size / sizeof(float);
+            vector<float16> halves(count);
+            decompress(c.compression,
+                       data,
+                       c.stored_size,
+                       reinterpret_cast<char*>(halves.data()),
+                       count * sizeof(float16));
+            float* values = c.buffer->get_ptr<float>();
+            for (size_t j = 0; j < count; j++)
+            {
+                values[j] = static_cast<float>(halves[j]);
+            }
+        }
+        else
+        {
+            decompress(c.compression, data, c.stored_size, c.buffer->get_ptr<char>(), c.size);
+        }
+    });
+
+    JSONDeserializer deserializer;
+    deserializer.set_const_data_callback(
+        [&](const string& const_name, const element::Type& et, const Shape& shape) {
+            shared_ptr<Node> const_node;
+            auto it = constants.find(const_name);
+            if (it != constants.end())
+            {
+                size_t offset = it->second.offset;
+                size_t size = it->second.stored_size;
+                // Encoded constants were decoded already
+                shared_ptr<runtime::AlignedBuffer> buffer = it->second.buffer;
+                if (buffer)
+                {
+                    it->second.buffer.reset();
+                }
+                else if (mapped_file && size >= s_min_mapped_constant_size)
+                {
+                    buffer = make_shared<runtime::MappedBuffer>(mapped_file, offset, size);
+                }
+                else
+                {
+                    buffer = make_shared<runtime::AlignedBuffer>(size);
+                    auto position = in.tellg();
+                    in.seekg(offset, ios_base::beg);
+                    in.read(buffer->get_ptr<char>(), size);
+                    if (!in)
+                    {
+                        throw ngraph_error("Unexpected end of binary model");
+                    }
+                    in.seekg(position, ios_base::beg);
+                }
+                const_node = make_shared<op::Constant>(et, shape, buffer);
+            }
+            return const_node;
+        });
+
+    // Inputs are resolved by serialized name, which can differ from the name of the new node
+    vector<string> node_names(read_binary<uint32_t>(in));
+    vector<shared_ptr<Node>> nodes(node_names.size());
+    for (size_t node_index = 0; node_index < nodes.size(); node_index++)
+    {
+        const string& type_name = get_string(read_binary<uint32_t>(in));
+        uint64_t type_version = read_binary<uint64_t>(in);
+        node_names[node_index] = get_string(read_binary<uint32_t>(in));
+        const string& friendly_name = get_string(read_binary<uint32_t>(in));
+        json inputs = json::array();
+        for (uint32_t i = read_binary<uint32_t>(in); i > 0; i--)
+        {
+            json input;
+            input["node"] = node_names.at(read_binary<uint32_t>(in));
+            input["index"] = read_binary<uint32_t>(in);
+            inputs.push_back(input);
+        }
+        json control_deps = json::array();
+        for (uint32_t i = read_binary<uint32_t>(in); i > 0; i--)
+        {
+            control_deps.push_back(node_names.at(read_binary<uint32_t>(in)));
+        }
+        json outputs = json::array();
+        for (uint32_t i = read_binary<uint32_t>(in); i > 0; i--)
+        {
+            outputs.push_back(get_string(read_binary<uint32_t>(in)));
+        }
+        vector<uint8_t> cbor(read_binary<uint32_t>(in));
+        in.read(reinterpret_cast<char*>(cbor.data()), cbor.size());
+        if (!in)
+        {
+            throw ngraph_error("Unexpected end of binary model");
+        }
+
+        json node_js = json::from_cbor(cbor);
+        node_js["type_info"] = {{"name", type_name}, {"version", type_version}};
+        node_js["op"] = type_name;
+        node_js["name"] = node_names[node_index];
+        node_js["friendly_name"] = friendly_name;
+        node_js["inputs"] = inputs;
+        node_js["control_deps"] = control_deps;
+        node_js["outputs"] = outputs;
+        nodes[node_index] = deserializer.deserialize_node(node_js);
+    }
+
+    const string& func_name = get_string(read_binary<uint32_t>(in));
+    ParameterVector parameters;
+    for (uint32_t i = read_binary<uint32_t>(in); i > 0; i--)
+    {
+        parameters.push_back(as_type_ptr<op::Parameter>(nodes.at(read_binary<uint32_t>(in))));
+    }
+    ResultVector results;
+    for (uint32_t i = read_binary<uint32_t>(in); i > 0; i--)
+    {
+        results.push_back(as_type_ptr<op::Result>(nodes.at(read_binary<uint32_t>(in))));
+    }
+    return make_shared<Function>(results, parameters, func_name);
+}
+
 static string serialize(shared_ptr<Function> func, size_t indent, bool binary_constant_data)
 {
     JSONSerializer serializer;
@@ -359,10 +1142,32 @@ std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t ind
     return ::serialize(func, indent, false);
 }
 
-shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
+std::string ngraph::serialize_node_attributes(const Node& node)
 {
+    JSONSerializer serializer;
+    // Constant data is not an attribute
+    serializer.set_binary_constant_data(true);
+    json attributes = serializer.serialize_node(node);
+    for (const string& key : s_binary_node_keys)
+    {
+        attributes.erase(key);
+    }
+    attributes.erase("op_version");
+    attributes.erase("provenance_tags");
+    return attributes.dump();
+}
+
+// Reads a cpio model from `in`. If `path` names the file being read, large aligned constants
+// are mapped from it instead of being copied.
+static shared_ptr<ngraph::Function> deserialize_cpio(istream& in, const string& path)
+{
+    static const bool s_mmap_disabled = std::getenv("NGRAPH_DISABLE_CONSTANT_MMAP") != nullptr;
+    shared_ptr<runtime::MappedFile> mapped_file;
+    if (!path.empty() && !s_mmap_disabled)
+    {
+        mapped_file = make_shared<runtime::MappedFile>(path);
+    }
     shared_ptr<Function> rc;
-    if (cpio::is_cpio(in))
     {
         cpio::Reader reader(in);
         vector<cpio::FileInfo> file_info = reader.get_file_info();
@@ -379,31 +1184,253 @@ shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
             deserializer.set_const_data_callback(
                 [&](const string& const_name, const element::Type& et, const Shape& shape) {
                     shared_ptr<Node> const_node;
-                    for (const cpio::FileInfo& info : file_info)
+                    const cpio::FileInfo* info = reader.find(const_name);
+                    if (info && mapped_file && info->get_size() >= s_min_mapped_constant_size &&
+                        info->get_offset() % s_binary_constant_alignment == 0)
                     {
-                        if (info.get_name() == const_name)
-                        {
-                            void* const_data = ngraph_malloc(info.get_size());
-                            reader.read(const_name, const_data, info.get_size());
-                            const_node = make_shared<op::Constant>(et, shape, const_data);
-                            ngraph_free(const_data);
-                            break;
-                        }
+                        auto buffer = make_shared<runtime::MappedBuffer>(
+                            mapped_file, info->get_offset(), info->get_size());
+                        const_node = make_shared<op::Constant>(et, shape, buffer);
+                    }
+                    else if (info)
+                    {
+                        void* const_data = ngraph_malloc(info->get_size());
+                        reader.read(const_name, const_data, info->get_size());
+                        const_node = make_shared<op::Constant>(et, shape, const_data);
+                        ngraph_free(const_data);
                     }
                     return const_node;
                 });
-            for (json func : js)
+            for (const json& func : js)
             {
                 rc = deserializer.deserialize_function(func);
             }
         }
     }
+    return rc;
+}
+
+template <typename T, typename U>
+static void write_constant_value(void* target, size_t index, U value)
+{
+    reinterpret_cast<T*>(target)[index] = static_cast<T>(value);
+}
+
+// Stores `value` as element `index` of a buffer of `type`, converting it like op::Constant
+// does for its value strings
+template <typename U>
+static void write_constant_value(const element::Type& type, void* target, size_t index, U value)
+{
+#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic error "-Wswitch"
+#pragma GCC diagnostic error "-Wswitch-enum"
+#endif
+    switch (type)
+    {
+    case element::Type_t::boolean: write_constant_value<char>(target, index, value); break;
+    case element::Type_t::bf16: write_constant_value<bfloat16>(target, index, value); break;
+    case element::Type_t::f16: write_constant_value<float16>(target, index, value); break;
+    case element::Type_t::f32: write_constant_value<float>(target, index, value); break;
+    case element::Type_t::f64: write_constant_value<double>(target, index, value); break;
+    case element::Type_t::i8: write_constant_value<int8_t>(target, index, value); break;
+    case element::Type_t::i16: write_constant_value<int16_t>(target, index, value); break;
+    case element::Type_t::i32: write_constant_value<int32_t>(target, index, value); break;
+    case element::Type_t::i64: write_constant_value<int64_t>(target, index, value); break;
+    case element::Type_t::u8: write_constant_value<uint8_t>(target, index, value); break;
+    case element::Type_t::u16: write_constant_value<uint16_t>(target, index, value); break;
+    case element::Type_t::u32: write_constant_value<uint32_t>(target, index, value); break;
+    case element::Type_t::u64: write_constant_value<uint64_t>(target, index, value); break;
+    case element::Type_t::u1:
+    case element::Type_t::undefined:
+    case element::Type_t::dynamic: throw runtime_error("unsupported type");
+    }
+#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
+#pragma GCC diagnostic pop
+#endif
+}
+
+JSONStreamingDeserializer::JSONStreamingDeserializer()
+{
+    set_const_data_callback([this](const string&, const element::Type& et, const Shape& shape) {
+        shared_ptr<Node> const_node = make_shared<op::Constant>(et, shape, m_constant_data);
+        m_constant_data = nullptr;
+        return const_node;
+    });
+}
+
+json::parser_callback_t JSONStreamingDeserializer::get_parser_callback()
+{
+    return [this](int depth, json::parse_event_t event, json& parsed) {
+        return handle_event(depth, event, parsed);
+    };
+}
+
+bool JSONStreamingDeserializer::handle_event(int depth, json::parse_event_t event, json& parsed)
+{
+    bool keep = true;
+    switch (event)
+    {
+    case json::parse_event_t::key:
+        if (depth == s_function_depth + 1)
+        {
+            m_function_key = parsed.get<string>();
+        }
+        else if (depth == s_node_depth + 1)
+        {
+            m_node_key = parsed.get<string>();
+        }
+        break;
+    case json::parse_event_t::object_start:
+        if (depth == s_node_depth && m_function_key == "ops")
+        {
+            m_node_key.clear();
+            m_node_op.clear();
+            m_node_element_type.clear();
+            m_node_shape.clear();
+            m_constant_data = nullptr;
+        }
+        break;
+    case json::parse_event_t::object_end:
+        if (depth == s_node_depth && m_function_key == "ops")
+        {
+            if (m_constant_data)
+            {
+                // Have the Constant use the decoded data through the const data callback
+                parsed.erase("value");
+            }
+            deserialize_node(parsed);
+            keep = false;
+        }
+        else if (depth == s_function_depth)
+        {
+            m_function = deserialize_function_signature(parsed);
+            m_function_key.clear();
+            keep = false;
+        }
+        break;
+    case json::parse_event_t::array_start:
+        if (depth == s_node_depth + 1 && m_function_key == "ops" && m_node_key == "value" &&
+            m_node_op == "Constant" && !m_node_element_type.empty())
+        {
+            for (const element::Type* t : element::Type::get_known_types())
+            {
+                if (t->c_type_string() == m_node_element_type)
+                {
+                    m_constant_element_type = *t;
+                    m_constant_element_count = shape_size(m_node_shape);
+                    m_constant_values = 0;
+                    m_constant_data = make_shared<runtime::AlignedBuffer>(
+                        ceil(m_constant_element_count * t->bitwidth() / 8.f));
+                    m_decoding_constant = true;
+                    break;
+                }
+            }
+        }
+        break;
+    case json::parse_event_t::array_end:
+        if (m_decoding_constant && depth == s_node_depth + 1)
+        {
+            m_decoding_constant = false;
+            if (m_constant_values == 1 && m_constant_element_count > 1)
+            {
+                // A single value is broadcast, as for the op::Constant constructor
+                size_t element_size = m_constant_data->size() / m_constant_element_count;
+                char* data = m_constant_data->get_ptr<char>();
+                for (size_t i = 1; i < m_constant_element_count; i++)
+                {
+                    memcpy(data + i * element_size, data, element_size);
+                }
+            }
+            else if (m_constant_values != m_constant_element_count)
+            {
+                throw ngraph_error("Did not get the expected number of literals for constant");
+            }
+        }
+        break;
+    case json::parse_event_t::value:
+        if (m_decoding_constant && depth == s_node_value_depth)
+        {
+            append_constant_value(parsed.get<string>());
+            keep = false;
+        }
+        else if (depth == s_node_depth + 1 && m_function_key == "ops")
+        {
+            if (m_node_key == "op")
+            {
+                m_node_op = parsed.get<string>();
+            }
+            else if (m_node_key == "element_type" && parsed.is_string())
+            {
+                m_node_element_type = parsed.get<string>();
+            }
+        }
+        else if (depth == s_node_depth + 2 && m_function_key == "ops" && m_node_key == "shape")
+        {
+            m_node_shape.push_back(parsed.get<size_t>());
+        }
+        break;
+    }
+    return keep;
+}
+
+void JSONStreamingDeserializer::append_constant_value(const string& value)
+{
+    if (m_constant_values >= max<size_t>(m_constant_element_count, 1))
+    {
+        throw ngraph_error("Did not get the expected number of literals for constant");
+    }
+    void* data = m_constant_data->get_ptr();
+    if (m_constant_element_type.is_integral())
+    {
+        if (m_constant_element_type.is_signed())
+        {
+            write_constant_value(
+                m_constant_element_type, data, m_constant_values, parse_string<int64_t>(value));
+        }
+        else
+        {
+            write_constant_value(
+                m_constant_element_type, data, m_constant_values, parse_string<uint64_t>(value));
+        }
+    }
+    else
+    {
+        write_constant_value(
+            m_constant_element_type, data, m_constant_values, parse_string<double>(value));
+    }
+    m_constant_values++;
+}
+
+template <typename T>
+static shared_ptr<ngraph::Function> deserialize_json(T& input)
+{
+    JSONStreamingDeserializer deserializer;
+    json js = json::parse(input, deserializer.get_parser_callback());
+    shared_ptr<Function> rc = deserializer.get_function();
+    // Functions are normally consumed while parsing, leaving nothing to do here
+    for (const json& func : js)
+    {
+        rc = deserializer.deserialize_function(func);
+    }
+    return rc;
+}
+
+shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
+{
+    shared_ptr<Function> rc;
+    if (is_binary_model(in))
+    {
+        rc = deserialize_binary(in, "");
+    }
+    else if (cpio::is_cpio(in))
+    {
+        rc = deserialize_cpio(in, "");
+    }
     else
     {
         // json file?
-        std::stringstream ss;
-        ss << in.rdbuf();
-        rc = deserialize(ss.str());
+        rc = deserialize_json(in);
     }
     return rc;
 }
@@ -415,16 +1442,22 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
     {
         // s is a file and not a json string
         ifstream in(s, ios_base::binary | ios_base::in);
-        rc = deserialize(in);
+        if (is_binary_model(in))
+        {
+            rc = deserialize_binary(in, s);
+        }
+        else if (cpio::is_cpio(in))
+        {
+            rc = deserialize_cpio(in, s);
+        }
+        else
+        {
+            rc = deserialize(in);
+        }
     }
     else
     {
-        json js = json::parse(s);
-        JSONDeserializer deserializer;
-        for (json func : js)
-        {
-            rc = deserializer.deserialize_function(func);
-        }
+        rc = deserialize_json(s);
     }
     return rc;
 }
@@ -462,7 +1495,7 @@ json JSONSerializer::serialize_function(const Function& f)
 }
 
 template <typename T>
-T get_value(json js, const string& key)
+T get_value(const json& js, const string& key)
 {
     T rc = {};
     auto it = js.find(key);
@@ -473,13 +1506,13 @@ T get_value(json js, const string& key)
     return rc;
 }
 
-shared_ptr<Node> JSONDeserializer::deserialize_node_reference(json j)
+shared_ptr<Node> JSONDeserializer::deserialize_node_reference(const json& j)
 {
     const string& name = j;
     return m_node_map.at(name);
 }
 
-Output<Node> JSONDeserializer::deserialize_output(json j)
+Output<Node> JSONDeserializer::deserialize_output(const json& j)
 {
     size_t index;
     json json_node_reference;
@@ -490,8 +1523,8 @@ Output<Node> JSONDeserializer::deserialize_output(json j)
     }
     else if (j.is_object())
     {
-        json_node_reference = j["node"];
-        index = j["index"];
+        json_node_reference = j.at("node");
+        index = j.at("index");
     }
     else
     {
@@ -500,12 +1533,12 @@ Output<Node> JSONDeserializer::deserialize_output(json j)
     return Output<Node>(deserialize_node_reference(json_node_reference), index);
 }
 
-OutputVector JSONDeserializer::deserialize_output_vector(json j)
+OutputVector JSONDeserializer::deserialize_output_vector(const json& j)
 {
     OutputVector result;
     if (j.is_array())
     {
-        for (json jelt : j)
+        for (const json& jelt : j)
         {
             result.push_back(deserialize_output(jelt));
         }
@@ -518,7 +1551,7 @@ json JSONSerializer::serialize_axis_set(const AxisSet& axis_set)
     return static_cast<set<size_t>>(axis_set);
 }
 
-AxisSet JSONDeserializer::deserialize_axis_set(json j)
+AxisSet JSONDeserializer::deserialize_axis_set(const json& j)
 {
     AxisSet result;
     if (j.is_array())
@@ -666,7 +1699,7 @@ std::shared_ptr<op::TensorIterator::OutputDescription>
     return result;
 }
 
-ParameterVector JSONDeserializer::deserialize_parameter_vector(json json_parameters)
+ParameterVector JSONDeserializer::deserialize_parameter_vector(const json& json_parameters)
 {
     std::vector<std::shared_ptr<op::Parameter>> params;
     for (auto& param_ref : json_parameters)
@@ -676,14 +1709,19 @@ ParameterVector JSONDeserializer::deserialize_parameter_vector(json json_paramet
     return params;
 }
 
-shared_ptr<Function> JSONDeserializer::deserialize_function(json func_js)
+shared_ptr<Function> JSONDeserializer::deserialize_function(const json& func_js)
 {
-    string func_name = func_js.at("name").get<string>();
-    vector<json> func_result = func_js.at("result");
-    for (json node_js : func_js.at("ops"))
+    for (const json& node_js : func_js.at("ops"))
     {
         deserialize_node(node_js);
     }
+    return deserialize_function_signature(func_js);
+}
+
+shared_ptr<Function> JSONDeserializer::deserialize_function_signature(const json& func_js)
+{
+    string func_name = func_js.at("name").get<string>();
+    vector<json> func_result = func_js.at("result");
 
     // This handles both graphs w/ `op::Result` and legacy graphs w/o it
     // If we are dealing w/ a legacy graph, add op::Result for each output node
@@ -758,7 +1796,7 @@ struct OutputVectorHelper
     OutputVector m_vector;
 };
 
-shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
+shared_ptr<Node> JSONDeserializer::deserialize_node(const json& node_js)
 {
     shared_ptr<Node> node;
     try
@@ -769,7 +1807,7 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
         string type_info_name;
         if (has_key(node_js, "type_info"))
         {
-            json jtype_info = node_js["type_info"];
+            const json& jtype_info = node_js.at("type_info");
             type_info_name = jtype_info.at("name").get<string>();
             type_info.name = type_info_name.c_str();
             type_info.version = jtype_info.at("version").get<uint64_t>();
@@ -778,7 +1816,7 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
         string friendly_name = get_value<string>(node_js, "friendly_name");
         vector<json> control_deps_inputs = get_value<vector<json>>(node_js, "control_deps");
         vector<string> node_outputs = get_value<vector<string>>(node_js, "outputs");
-        OutputVectorHelper args(deserialize_output_vector(node_js["inputs"]));
+        OutputVectorHelper args(deserialize_output_vector(get_value<json>(node_js, "inputs")));
 
 #if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
 #pragma GCC diagnostic push
@@ -799,6 +1837,15 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
             node = make_shared<op::Acos>(args[0]);
             break;
         }
+        case OP_TYPEID::AdamUpdate:
+        {
+            auto beta1 = node_js.at("beta1").get<double>();
+            auto beta2 = node_js.at("beta2").get<double>();
+            auto epsilon = node_js.at("epsilon").get<double>();
+            node = make_shared<op::AdamUpdate>(
+                args[0], args[1], args[2], args[3], args[4], beta1, beta2, epsilon);
+            break;
+        }
         case OP_TYPEID::Add:
         {
             node = make_shared<op::v0::Add>(
@@ -819,9 +1866,20 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
             node = make_shared<op::All>(args[0], reduction_axes);
             break;
         }
+        case OP_TYPEID::AllGather:
+        {
+            node = make_shared<op::AllGather>(args[0], node_js.at("num_ranks").get<int64_t>());
+            break;
+        }
         case OP_TYPEID::AllReduce:
         {
-            node = make_shared<op::AllReduce>(args[0]);
+            auto reduce_type = as_type<reduction::Type>(
+                get_or_default<string>(node_js, "reduce_type", "SUM"));
+            auto algorithm = as_type<reduction::Algorithm>(
+                get_or_default<string>(node_js, "algorithm", "FLAT"));
+            auto compression = as_type<reduction::Compression>(
+                get_or_default<string>(node_js, "compression", "NONE"));
+            node = make_shared<op::AllReduce>(args[0], reduce_type, algorithm, compression);
             break;
         }
         case OP_TYPEID::And:
@@ -1044,6 +2102,16 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
                 has_key(node_js, "element_type") ? node_js : node_js.at("value_type");
             auto element_type = read_element_type(type_node_js.at("element_type"));
             auto shape = type_node_js.at("shape");
+            if (!has_key(node_js, "value") && m_const_data_callback)
+            {
+                // The data is stored in a binary record named after the node
+                node = m_const_data_callback(node_name, element_type, shape);
+                if (!node)
+                {
+                    throw runtime_error("Missing data for constant '" + node_name + "'");
+                }
+                break;
+            }
             auto value = node_js.at("value").get<vector<string>>();
             node = make_shared<op::Constant>(element_type, shape, value);
             break;
@@ -1073,11 +2141,11 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
             json data_dilation_strides;
             if (has_key(node_js, "data_dilation_strides"))
             {
-                data_dilation_strides = node_js["data_dilation_strides"];
+                data_dilation_strides = node_js.at("data_dilation_strides");
             }
             else if (has_key(node_js, "image_dilation_strides"))
             {
-                data_dilation_strides = node_js["image_dilation_strides"];
+                data_dilation_strides = node_js.at("image_dilation_strides");
             }
 
             op::PadType pad_type = read_pad_type(node_js);
@@ -1468,7 +2536,7 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
             // For backwards compatibility, reduction_axes_count is optional.
             if (has_key(node_js, "reduction_axes_count"))
             {
-                size_t reduction_axes_count = node_js["reduction_axes_count"].get<size_t>();
+                size_t reduction_axes_count = node_js.at("reduction_axes_count").get<size_t>();
                 node = make_shared<op::Dot>(args[0], args[1], reduction_axes_count);
             }
             else
@@ -2469,7 +3537,7 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
                 node_js.at("window_dilation_strides").get<vector<size_t>>();
             auto padding_below = node_js.at("padding_below").get<vector<std::ptrdiff_t>>();
             auto padding_above = node_js.at("padding_above").get<vector<std::ptrdiff_t>>();
-            auto data_dilation_strides = node_js["data_dilation_strides"];
+            auto data_dilation_strides = get_value<json>(node_js, "data_dilation_strides");
             auto output_type = read_element_type(node_js.at("output_type"));
             auto input_axes = node_js.at("input_axes").get<set<size_t>>();
             auto filter_axes = node_js.at("filter_axes").get<set<size_t>>();
@@ -2499,7 +3567,7 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
         }
         case OP_TYPEID::QuantizedDot:
         {
-            size_t reduction_axes_count = node_js["reduction_axes_count"].get<size_t>();
+            size_t reduction_axes_count = node_js.at("reduction_axes_count").get<size_t>();
             auto output_type = read_element_type(node_js.at("output_type"));
             auto input0_axes = node_js.at("input0_axes").get<set<size_t>>();
             auto input1_axes = node_js.at("input1_axes").get<set<size_t>>();
@@ -2527,6 +3595,14 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
             node = make_shared<op::Recv>(args[0], src_id);
             break;
         }
+        case OP_TYPEID::ReduceScatter:
+        {
+            auto reduce_type = as_type<reduction::Type>(
+                get_or_default<string>(node_js, "reduce_type", "SUM"));
+            node = make_shared<op::ReduceScatter>(
+                args[0], node_js.at("num_ranks").get<int64_t>(), reduce_type);
+            break;
+        }
         case OP_TYPEID::RandomUniform:
         {
             auto fixed_seed = node_js.at("fixed_seed").get<uint64_t>();
@@ -2656,6 +3732,14 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
             node = make_shared<op::Round>(args[0]);
             break;
         }
+        case OP_TYPEID::SGDMomentumUpdate:
+        {
+            auto momentum = node_js.at("momentum").get<double>();
+            auto nesterov = node_js.at("nesterov").get<bool>();
+            node = make_shared<op::SGDMomentumUpdate>(
+                args[0], args[1], args[2], args[3], momentum, nesterov);
+            break;
+        }
         case OP_TYPEID::ScalarConstantLike:
         {
             double value = node_js.at("value").get<double>();
@@ -2896,7 +3980,7 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
         case OP_TYPEID::TensorIterator:
         {
             auto ti = make_shared<op::TensorIterator>(args);
-            json jbody = node_js["body"];
+            json jbody = node_js.at("body");
             // Serializer assumes inputs are available before users sp we
             // need to make sure the body nodes are all deserialized before
             // referencing them.
@@ -2919,13 +4003,13 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
                 results.push_back(as_type_ptr<op::Result>(deserialize_node(jresult)));
             }
             ti->set_body(make_shared<op::TensorIterator::BodyLambda>(results, parameters));
-            json jins = node_js["input_descriptions"];
+            json jins = get_value<json>(node_js, "input_descriptions");
             for (json jin : jins)
             {
                 ti->get_input_descriptions().push_back(
                     deserialize_tensor_iterator_input_description(jin));
             }
-            json jouts = node_js["output_descriptions"];
+            json jouts = get_value<json>(node_js, "output_descriptions");
             for (json jout : jouts)
             {
                 ti->get_output_descriptions().push_back(
@@ -3010,6 +4094,16 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
         }
         case OP_TYPEID::UnknownOp:
         {
+            auto& registry = FactoryRegistry<Node>::get();
+            if (has_key(node_js, "attributes") && registry.has_factory(type_info))
+            {
+                node.reset(registry.create(type_info));
+                node->set_arguments(static_cast<const OutputVector&>(args));
+                JSONAttributeDeserializer visitor(node_js.at("attributes"));
+                node->visit_attributes(visitor);
+                node->constructor_validate_and_infer_types();
+                break;
+            }
             stringstream ss;
             ss << "unsupported op " << type_info.name << ":" << type_info.version;
             throw runtime_error(ss.str());
@@ -3169,6 +4263,14 @@ json JSONSerializer::serialize_node(const Node& n)
     }
     case OP_TYPEID::Acos: { break;
     }
+    case OP_TYPEID::AdamUpdate:
+    {
+        auto tmp = static_cast<const op::AdamUpdate*>(&n);
+        node["beta1"] = tmp->get_beta1();
+        node["beta2"] = tmp->get_beta2();
+        node["epsilon"] = tmp->get_epsilon();
+        break;
+    }
     case OP_TYPEID::Add:
     {
         const op::util::BinaryElementwiseArithmetic* tmp = nullptr;
@@ -3209,7 +4311,19 @@ json JSONSerializer::serialize_node(const Node& n)
         node["reduction_axes"] = serialize_axis_set(tmp->get_reduction_axes());
         break;
     }
-    case OP_TYPEID::AllReduce: { break;
+    case OP_TYPEID::AllGather:
+    {
+        auto tmp = static_cast<const op::AllGather*>(&n);
+        node["num_ranks"] = tmp->get_num_ranks();
+        break;
+    }
+    case OP_TYPEID::AllReduce:
+    {
+        auto tmp = static_cast<const op::AllReduce*>(&n);
+        node["reduce_type"] = as_string(tmp->get_reduce_type());
+        node["algorithm"] = as_string(tmp->get_algorithm());
+        node["compression"] = as_string(tmp->get_compression());
+        break;
     }
     case OP_TYPEID::And:
     {
@@ -3369,7 +4483,13 @@ json JSONSerializer::serialize_node(const Node& n)
     case OP_TYPEID::Constant:
     {
         auto tmp = static_cast<const op::Constant*>(&n);
-        if (tmp->get_all_data_elements_bitwise_identical() && shape_size(tmp->get_shape()) > 0)
+        if (m_binary_constant_data)
+        {
+            // The data is written as a separate binary record
+            m_binary_constants.push_back(tmp);
+        }
+        else if (tmp->get_all_data_elements_bitwise_identical() &&
+                 shape_size(tmp->get_shape()) > 0)
         {
             vector<string> vs;
             vs.push_back(tmp->convert_value_to_string(0));
@@ -4340,6 +5460,13 @@ json JSONSerializer::serialize_node(const Node& n)
         node["source_id"] = tmp->get_src_id();
         break;
     }
+    case OP_TYPEID::ReduceScatter:
+    {
+        auto tmp = static_cast<const op::ReduceScatter*>(&n);
+        node["num_ranks"] = tmp->get_num_ranks();
+        node["reduce_type"] = as_string(tmp->get_reduce_type());
+        break;
+    }
     case OP_TYPEID::ReduceLogicalAnd_v1:
     {
         const auto tmp = static_cast<const op::v1::ReduceLogicalAnd*>(&n);
@@ -4412,6 +5539,13 @@ json JSONSerializer::serialize_node(const Node& n)
         node["activations_beta"] = tmp->get_activations_beta();
         break;
     }
+    case OP_TYPEID::SGDMomentumUpdate:
+    {
+        auto tmp = static_cast<const op::SGDMomentumUpdate*>(&n);
+        node["momentum"] = tmp->get_momentum();
+        node["nesterov"] = tmp->get_nesterov();
+        break;
+    }
     case OP_TYPEID::ScalarConstantLike:
     {
         auto tmp = static_cast<const op::ScalarConstantLike*>(&n);
@@ -4666,7 +5800,15 @@ json JSONSerializer::serialize_node(const Node& n)
     }
     case OP_TYPEID::VariadicSplit_v1: { break;
     }
-    case OP_TYPEID::UnknownOp: { break;
+    case OP_TYPEID::UnknownOp:
+    {
+        json attributes = json::object();
+        JSONAttributeSerializer visitor(attributes);
+        if (const_cast<Node&>(n).visit_attributes(visitor))
+        {
+            node["attributes"] = attributes;
+        }
+        break;
     }
     }
 #if !(defined(__GNUC__) && (__GNUC__ == 4 && __GNUC_MINOR__ == 8))
@@ -48,6 +48,61 @@ namespace ngraph
     ///    indent level specified.
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
+    /// \brief Serialize a Function to a binary stream
+    ///
+    /// The binary format stores the graph as flat node and string tables followed by the data
+    /// of every Constant, each starting on a page boundary. It loads much faster than json,
+    /// which remains the format to use for reading and debugging graphs. deserialize() accepts
+    /// either format.
+    /// \param out The output stream to which the data is serialized.
+    /// \param func The Function to serialize
+    void serialize_binary(std::ostream& out, std::shared_ptr<ngraph::Function> func);
+
+    /// \brief Serialize a Function to a binary file
+    ///
+    /// When the file is later loaded with deserialize(path), large constants are mapped from
+    /// the file instead of being read into memory, so their pages are loaded lazily and shared
+    /// between processes. Set NGRAPH_DISABLE_CONSTANT_MMAP to always read them.
+    /// \param path The path to the output file
+    /// \param func The Function to serialize
+    void serialize_binary(const std::string& path, std::shared_ptr<ngraph::Function> func);
+
+    /// \brief How serialize_binary stores the data of Constants
+    struct BinarySerializeOptions
+    {
+        enum class Compression
+        {
+            NONE,
+            /// Fast to decompress. Requires a build with NGRAPH_LZ4_ENABLE.
+            LZ4,
+            /// Smaller than LZ4. Requires a build with NGRAPH_ZSTD_ENABLE.
+            ZSTD,
+        };
+
+        /// Codec for the data of each Constant. Data that does not shrink is stored as it is.
+        /// Compressed Constants are decompressed on several threads when the model is loaded
+        /// and are never mapped from the file.
+        Compression compression{Compression::NONE};
+        /// Store the data of f32 Constants as f16, halving its size at the cost of precision.
+        /// The Constants are still f32 once deserialized.
+        bool f16_constants{false};
+
+        /// \returns true if this build of nGraph can read and write `compression`
+        static bool is_supported(Compression compression);
+    };
+
+    /// \brief Serialize a Function to a binary stream, compressing the data of its Constants
+    ///        as given by `options`
+    void serialize_binary(std::ostream& out,
+                          std::shared_ptr<ngraph::Function> func,
+                          const BinarySerializeOptions& options);
+
+    /// \brief Serialize a Function to a binary file, compressing the data of its Constants
+    ///        as given by `options`
+    void serialize_binary(const std::string& path,
+                          std::shared_ptr<ngraph::Function> func,
+                          const BinarySerializeOptions& options);
+
     /// \brief Deserialize a Function
     /// \param in An isteam to the input data
     std::shared_ptr<ngraph::Function> deserialize(std::istream& in);
@@ -56,6 +111,11 @@ namespace ngraph
     /// \param str The json formatted string to deseriailze.
     std::shared_ptr<ngraph::Function> deserialize(const std::string& str);
 
+    /// \brief The attributes the json serializer writes for a node, without its name, inputs,
+    ///        outputs and control dependencies
+    /// \returns a compact json object, or an empty string in builds without the serializer
+    std::string serialize_node_attributes(const Node& node);
+
     /// \brief If enabled adds output shapes to the serialized graph
     /// \param enable Set to true to enable or false otherwise
     ///
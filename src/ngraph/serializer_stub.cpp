@@ -33,6 +33,35 @@ void ngraph::serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func
     throw std::runtime_error("serializer disabled in build");
 }
 
+void ngraph::serialize_binary(std::ostream& out, std::shared_ptr<ngraph::Function> func)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
+void ngraph::serialize_binary(const std::string& path, std::shared_ptr<ngraph::Function> func)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
+void ngraph::serialize_binary(std::ostream& out,
+                              std::shared_ptr<ngraph::Function> func,
+                              const BinarySerializeOptions& options)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
+void ngraph::serialize_binary(const std::string& path,
+                              std::shared_ptr<ngraph::Function> func,
+                              const BinarySerializeOptions& options)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
+bool ngraph::BinarySerializeOptions::is_supported(Compression compression)
+{
+    return compression == Compression::NONE;
+}
+
 std::shared_ptr<ngraph::Function> ngraph::deserialize(std::istream& in)
 {
     throw std::runtime_error("serializer disabled in build");
@@ -43,6 +72,11 @@ std::shared_ptr<ngraph::Function> ngraph::deserialize(const std::string& str)
     throw std::runtime_error("serializer disabled in build");
 }
 
+std::string ngraph::serialize_node_attributes(const Node& node)
+{
+    return "";
+}
+
 void ngraph::set_serialize_output_shapes(bool enable)
 {
     throw std::runtime_error("serializer disabled in build");
@@ -29,27 +29,32 @@ std::ostream& ngraph::operator<<(std::ostream& s, const Shape& shape)
 }
 
 ngraph::Shape::Shape()
-    : std::vector<size_t>()
+    : DimensionVector()
 {
 }
 
 ngraph::Shape::Shape(const std::initializer_list<size_t>& axis_lengths)
-    : std::vector<size_t>(axis_lengths)
+    : DimensionVector(axis_lengths)
 {
 }
 
 ngraph::Shape::Shape(const std::vector<size_t>& axis_lengths)
-    : std::vector<size_t>(axis_lengths)
+    : DimensionVector(axis_lengths)
+{
+}
+
+ngraph::Shape::Shape(const DimensionVector& axis_lengths)
+    : DimensionVector(axis_lengths)
 {
 }
 
 ngraph::Shape::Shape(const Shape& axis_lengths)
-    : std::vector<size_t>(axis_lengths)
+    : DimensionVector(axis_lengths)
 {
 }
 
 ngraph::Shape::Shape(size_t n, size_t initial_value)
-    : std::vector<size_t>(n, initial_value)
+    : DimensionVector(n, initial_value)
 {
 }
 
@@ -59,13 +64,13 @@ ngraph::Shape::~Shape()
 
 ngraph::Shape& ngraph::Shape::operator=(const Shape& v)
 {
-    static_cast<std::vector<size_t>*>(this)->operator=(v);
+    static_cast<DimensionVector*>(this)->operator=(v);
     return *this;
 }
 
 ngraph::Shape& ngraph::Shape::operator=(Shape&& v) noexcept
 {
-    static_cast<std::vector<size_t>*>(this)->operator=(v);
+    static_cast<DimensionVector*>(this)->operator=(std::move(v));
     return *this;
 }
 
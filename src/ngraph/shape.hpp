@@ -22,12 +22,13 @@
 #include "ngraph/attribute_adapter.hpp"
 #include "ngraph/axis_set.hpp"
 #include "ngraph/ngraph_visibility.hpp"
+#include "ngraph/inline_vector.hpp"
 #include "ngraph/strides.hpp"
 
 namespace ngraph
 {
     /// \brief Shape for a tensor.
-    class Shape : public std::vector<size_t>
+    class Shape : public DimensionVector
     {
     public:
         NGRAPH_API Shape();
@@ -36,6 +37,8 @@ namespace ngraph
 
         NGRAPH_API Shape(const std::vector<size_t>& axis_lengths);
 
+        NGRAPH_API Shape(const DimensionVector& axis_lengths);
+
         NGRAPH_API Shape(const Shape& axis_lengths);
 
         NGRAPH_API explicit Shape(size_t n, size_t initial_value = 0);
@@ -44,7 +47,7 @@ namespace ngraph
 
         template <class InputIterator>
         Shape(InputIterator first, InputIterator last)
-            : std::vector<size_t>(first, last)
+            : DimensionVector(first, last)
         {
         }
 
@@ -21,6 +21,16 @@
 
 using namespace ngraph;
 
+static void copy_rt_info(const Node& from, Node& to)
+{
+    // Reading through a const node avoids allocating runtime info for nodes that have none
+    const auto& rt_info = from.get_rt_info();
+    if (!rt_info.empty())
+    {
+        to.get_rt_info() = rt_info;
+    }
+}
+
 std::shared_ptr<Function>
     ngraph::specialize_function(std::shared_ptr<Function> f,
                                 const std::vector<element::Type>& parameter_element_types,
@@ -43,7 +53,9 @@ std::shared_ptr<Function>
     NGRAPH_CHECK(f->get_parameters().size() == parameter_element_types.size());
     NGRAPH_CHECK(f->get_parameters().size() == parameter_values.size());
 
+    auto ordered_ops = f->get_ordered_ops();
     NodeMap m;
+    m.reserve(ordered_ops.size());
 
     for (size_t i = 0; i < parameter_shapes.size(); i++)
     {
@@ -61,10 +73,10 @@ std::shared_ptr<Function>
             m[f->get_parameters()[i].get()] =
                 std::make_shared<op::Parameter>(parameter_element_types[i], parameter_shapes[i]);
         }
-        m[f->get_parameters()[i].get()]->get_rt_info() = f->get_parameters()[i]->get_rt_info();
+        copy_rt_info(*f->get_parameters()[i], *m[f->get_parameters()[i].get()]);
     }
 
-    for (auto old_node : f->get_ordered_ops())
+    for (auto old_node : ordered_ops)
     {
         if (old_node->is_parameter())
         {
@@ -90,7 +102,7 @@ std::shared_ptr<Function>
             {
                 m[old_node.get()]->validate_and_infer_types();
             }
-            m[old_node.get()]->get_rt_info() = old_node->get_rt_info();
+            copy_rt_info(*old_node, *m[old_node.get()]);
         }
 
         m[old_node.get()]->set_friendly_name(old_node->get_friendly_name());
@@ -29,3 +29,19 @@ void ngraph::BernoulliRNGState::activate()
 void ngraph::BernoulliRNGState::deactivate()
 {
 }
+
+void ngraph::BernoulliRNGState::save(ostream& out) const
+{
+    out << m_generator << ' ' << m_distribution << ' ' << m_philox.get_seed() << ' ' << m_offset;
+}
+
+void ngraph::BernoulliRNGState::load(istream& in)
+{
+    uint64_t seed;
+    in >> m_generator >> m_distribution >> seed >> m_offset;
+    if (!in)
+    {
+        throw ngraph_error("Invalid BernoulliRNGState data");
+    }
+    m_philox = Philox4x32(seed);
+}
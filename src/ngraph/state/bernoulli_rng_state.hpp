@@ -20,6 +20,7 @@
 #include <memory>
 #include <random>
 
+#include "philox.hpp"
 #include "state.hpp"
 
 namespace ngraph
@@ -31,15 +32,33 @@ namespace ngraph
             : State()
             , m_generator(seed)
             , m_distribution(probability)
+            , m_philox(seed)
         {
         }
         virtual void activate() override;
         virtual void deactivate() override;
         virtual ~BernoulliRNGState() override {}
+        /// Saves the generator, the distribution and the Philox seed and offset
+        virtual void save(std::ostream& out) const override;
+        virtual void load(std::istream& in) override;
         std::mt19937& get_generator() { return m_generator; }
         std::bernoulli_distribution& get_distribution() { return m_distribution; }
+        /// Counter-based stream with the same seed, for kernels that split the work over
+        /// threads
+        const Philox4x32& get_philox() const { return m_philox; }
+        /// \brief Reserves the next `count` values of the Philox stream.
+        /// \returns the index of the first one
+        uint64_t reserve(uint64_t count)
+        {
+            uint64_t offset = m_offset;
+            m_offset += count;
+            return offset;
+        }
+
     protected:
         std::mt19937 m_generator;
         std::bernoulli_distribution m_distribution;
+        Philox4x32 m_philox;
+        uint64_t m_offset = 0;
     };
 }
@@ -0,0 +1,73 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace ngraph
+{
+    /// \brief The Philox4x32-10 counter-based generator of Salmon et al., "Parallel Random
+    ///        Numbers: As Easy as 1, 2, 3" (SC11).
+    ///
+    /// Value `i` of the stream for a seed is a pure function of the seed and `i`, so any part
+    /// of the stream can be generated on its own, by any thread, in any order.
+    class Philox4x32
+    {
+    public:
+        using Block = std::array<uint32_t, 4>;
+
+        explicit Philox4x32(uint64_t seed)
+            : m_key{{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)}}
+        {
+        }
+
+        /// \returns values [4 * block, 4 * block + 4) of the stream
+        Block operator()(uint64_t block) const
+        {
+            Block counter{{static_cast<uint32_t>(block), static_cast<uint32_t>(block >> 32), 0, 0}};
+            uint32_t key0 = m_key[0];
+            uint32_t key1 = m_key[1];
+            for (int round = 0; round < 10; round++)
+            {
+                uint64_t product0 = static_cast<uint64_t>(0xD2511F53) * counter[0];
+                uint64_t product1 = static_cast<uint64_t>(0xCD9E8D57) * counter[2];
+                counter = Block{{static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key0,
+                                 static_cast<uint32_t>(product1),
+                                 static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key1,
+                                 static_cast<uint32_t>(product0)}};
+                key0 += 0x9E3779B9;
+                key1 += 0xBB67AE85;
+            }
+            return counter;
+        }
+
+        /// \returns the seed the stream was constructed with
+        uint64_t get_seed() const
+        {
+            return static_cast<uint64_t>(m_key[1]) << 32 | static_cast<uint64_t>(m_key[0]);
+        }
+        /// \returns value `index` of the stream
+        uint32_t at(uint64_t index) const { return (*this)(index / 4)[index % 4]; }
+        /// \returns a uniform value in [0, 1) from the top 24 bits of `bits`
+        static float to_float(uint32_t bits) { return (bits >> 8) * (1.0f / 16777216.0f); }
+        /// \returns a uniform value in [0, 1) from all 32 bits of `bits`
+        static double to_double(uint32_t bits) { return bits * (1.0 / 4294967296.0); }
+    private:
+        std::array<uint32_t, 2> m_key;
+    };
+}
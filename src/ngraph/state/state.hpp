@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <istream>
+#include <ostream>
+
 namespace ngraph
 {
     class State
@@ -27,6 +30,10 @@ namespace ngraph
         virtual void deactivate() = 0;
         bool is_active() const { return m_is_active; }
         void set_active(bool flag) { m_is_active = flag; }
+        /// \brief Writes what load() needs to resume from this state, for checkpoints
+        virtual void save(std::ostream& /* out */) const {}
+        /// \brief Resumes from a state written by save() of a State of the same type
+        virtual void load(std::istream& /* in */) {}
         virtual ~State() {}
     protected:
         bool m_is_active = false;
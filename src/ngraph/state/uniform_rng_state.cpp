@@ -14,4 +14,21 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include "ngraph/except.hpp"
 #include "ngraph/state/uniform_rng_state.hpp"
+
+void ngraph::UniformRNGState::save(std::ostream& out) const
+{
+    out << m_generator << ' ' << m_distribution << ' ' << m_philox.get_seed() << ' ' << m_offset;
+}
+
+void ngraph::UniformRNGState::load(std::istream& in)
+{
+    uint64_t seed;
+    in >> m_generator >> m_distribution >> seed >> m_offset;
+    if (!in)
+    {
+        throw ngraph_error("Invalid UniformRNGState data");
+    }
+    m_philox = Philox4x32(seed);
+}
@@ -0,0 +1,169 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    /// \brief Walks the points of `shape` in row-major order over N tensors at once, without
+    ///        materializing coordinates.
+    ///
+    /// Tensor k is addressed as `start[k] + sum(coordinate[i] * strides[k][i])`. A stride of
+    /// zero repeats an element, which expresses broadcasts and reductions. Axes of length one
+    /// are dropped and neighbouring axes over which every tensor is contiguous are merged, so
+    /// that e.g. a slice of whole rows collapses into a single run.
+    ///
+    /// `f(offsets, count, inner_strides)` is called once per run along the innermost remaining
+    /// axis; the run covers `offsets[k] + i * inner_strides[k]` for `i < count` in every tensor.
+    template <size_t N, typename F>
+    void for_each_strided_run(const Shape& shape,
+                              const std::array<std::vector<size_t>, N>& strides,
+                              const std::array<size_t, N>& start,
+                              F&& f)
+    {
+        for (size_t k = 0; k < N; k++)
+        {
+            NGRAPH_CHECK(strides[k].size() == shape.size(),
+                         "Strides of rank ",
+                         strides[k].size(),
+                         " do not match shape ",
+                         shape);
+        }
+        if (shape_size(shape) == 0)
+        {
+            return;
+        }
+
+        // Merge from the innermost axis outwards
+        std::vector<size_t> lengths;
+        std::vector<std::array<size_t, N>> axis_strides;
+        for (size_t i = shape.size(); i > 0; i--)
+        {
+            size_t axis = i - 1;
+            if (shape[axis] == 1)
+            {
+                continue;
+            }
+            bool mergeable = !lengths.empty();
+            for (size_t k = 0; k < N && mergeable; k++)
+            {
+                mergeable = strides[k][axis] == axis_strides.back()[k] * lengths.back();
+            }
+            if (mergeable)
+            {
+                lengths.back() *= shape[axis];
+                continue;
+            }
+            std::array<size_t, N> axis_stride;
+            for (size_t k = 0; k < N; k++)
+            {
+                axis_stride[k] = strides[k][axis];
+            }
+            lengths.push_back(shape[axis]);
+            axis_strides.push_back(axis_stride);
+        }
+        if (lengths.empty())
+        {
+            lengths.push_back(1);
+            axis_strides.push_back(std::array<size_t, N>{});
+        }
+
+        // Odometer over the outer axes, stored innermost first
+        std::vector<size_t> counters(lengths.size(), 0);
+        std::array<size_t, N> offsets = start;
+        while (true)
+        {
+            f(offsets, lengths[0], axis_strides[0]);
+
+            size_t axis = 1;
+            for (; axis < lengths.size(); axis++)
+            {
+                for (size_t k = 0; k < N; k++)
+                {
+                    offsets[k] += axis_strides[axis][k];
+                }
+                if (++counters[axis] < lengths[axis])
+                {
+                    break;
+                }
+                counters[axis] = 0;
+                for (size_t k = 0; k < N; k++)
+                {
+                    offsets[k] -= axis_strides[axis][k] * lengths[axis];
+                }
+            }
+            if (axis == lengths.size())
+            {
+                return;
+            }
+        }
+    }
+
+    /// \brief Copies the elements of `in` addressed by `in_start` and `in_strides` over `shape`
+    ///        to the elements of `out` addressed by `out_start` and `out_strides`.
+    template <typename T>
+    void strided_copy(const T* in,
+                      T* out,
+                      const Shape& shape,
+                      const std::vector<size_t>& in_strides,
+                      size_t in_start,
+                      const std::vector<size_t>& out_strides,
+                      size_t out_start)
+    {
+        for_each_strided_run<2>(
+            shape,
+            {{in_strides, out_strides}},
+            {{in_start, out_start}},
+            [in, out](const std::array<size_t, 2>& offsets,
+                      size_t count,
+                      const std::array<size_t, 2>& inner_strides) {
+                const T* src = in + offsets[0];
+                T* dst = out + offsets[1];
+                if (inner_strides[0] == 1 && inner_strides[1] == 1)
+                {
+                    // Lowers to memmove for trivially copyable types
+                    std::copy(src, src + count, dst);
+                }
+                else
+                {
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        dst[i * inner_strides[1]] = src[i * inner_strides[0]];
+                    }
+                }
+            });
+    }
+
+    /// \brief Copies the elements of `in` addressed by `in_start` and `in_strides` over
+    ///        `shape` to `out` in row-major order.
+    template <typename T>
+    void strided_copy(const T* in,
+                      T* out,
+                      const Shape& shape,
+                      const std::vector<size_t>& in_strides,
+                      size_t in_start = 0)
+    {
+        strided_copy(in, out, shape, in_strides, in_start, row_major_strides(shape), 0);
+    }
+}
@@ -29,39 +29,44 @@ std::ostream& ngraph::operator<<(std::ostream& s, const Strides& strides)
 }
 
 ngraph::Strides::Strides()
-    : std::vector<size_t>()
+    : DimensionVector()
 {
 }
 
 ngraph::Strides::Strides(const std::initializer_list<size_t>& axis_strides)
-    : std::vector<size_t>(axis_strides)
+    : DimensionVector(axis_strides)
 {
 }
 
 ngraph::Strides::Strides(const std::vector<size_t>& axis_strides)
-    : std::vector<size_t>(axis_strides)
+    : DimensionVector(axis_strides)
+{
+}
+
+ngraph::Strides::Strides(const DimensionVector& axis_strides)
+    : DimensionVector(axis_strides)
 {
 }
 
 ngraph::Strides::Strides(const Strides& axis_strides)
-    : std::vector<size_t>(axis_strides)
+    : DimensionVector(axis_strides)
 {
 }
 
 ngraph::Strides::Strides(size_t n, size_t initial_value)
-    : std::vector<size_t>(n, initial_value)
+    : DimensionVector(n, initial_value)
 {
 }
 
 ngraph::Strides& ngraph::Strides::operator=(const Strides& v)
 {
-    static_cast<std::vector<size_t>*>(this)->operator=(v);
+    static_cast<DimensionVector*>(this)->operator=(v);
     return *this;
 }
 
 ngraph::Strides& ngraph::Strides::operator=(Strides&& v) noexcept
 {
-    static_cast<std::vector<size_t>*>(this)->operator=(v);
+    static_cast<DimensionVector*>(this)->operator=(std::move(v));
     return *this;
 }
 
@@ -22,11 +22,12 @@
 
 #include "ngraph/attribute_adapter.hpp"
 #include "ngraph/ngraph_visibility.hpp"
+#include "ngraph/inline_vector.hpp"
 
 namespace ngraph
 {
     /// \brief Strides for a tensor.
-    class Strides : public std::vector<size_t>
+    class Strides : public DimensionVector
     {
     public:
         NGRAPH_API Strides();
@@ -35,13 +36,15 @@ namespace ngraph
 
         NGRAPH_API Strides(const std::vector<size_t>& axis_strides);
 
+        NGRAPH_API Strides(const DimensionVector& axis_strides);
+
         NGRAPH_API Strides(const Strides& axis_strides);
 
         NGRAPH_API explicit Strides(size_t n, size_t initial_value = 0);
 
         template <class InputIterator>
         Strides(InputIterator first, InputIterator last)
-            : std::vector<size_t>(first, last)
+            : DimensionVector(first, last)
         {
         }
 
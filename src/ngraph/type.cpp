@@ -21,7 +21,13 @@ namespace std
 {
     size_t std::hash<ngraph::DiscreteTypeInfo>::operator()(const ngraph::DiscreteTypeInfo& k) const
     {
-        size_t name_hash = hash<decltype(k.name)>()(k.name);
+        // Equal type infos may have different name pointers, for example when the name was
+        // read from a serialized graph, so the characters are hashed (FNV-1a)
+        size_t name_hash = 14695981039346656037ULL;
+        for (const char* c = k.name; *c != 0; ++c)
+        {
+            name_hash = (name_hash ^ static_cast<unsigned char>(*c)) * 1099511628211ULL;
+        }
         size_t version_hash = hash<decltype(k.version)>()(k.version);
         return ngraph::hash_combine(vector<size_t>{name_hash, version_hash});
     }
@@ -15,9 +15,11 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cmath>
 #include <deque>
 #include <forward_list>
 #include <iomanip>
+#include <limits>
 #include <map>
 #include <numeric>
 #include <unordered_set>
@@ -414,47 +416,93 @@ std::ostream& operator<<(std::ostream& os, const ngraph::NodeVector& nv)
     return os;
 }
 
-void ngraph::check_fp_values_isinf(const char* name, const float* array, size_t n)
+namespace
 {
-    for (size_t i = 0; i < n; i++)
+    // The inner loop has no early exit so that it vectorizes, and a hit still ends the scan
+    // after at most one block
+    template <typename T, typename Predicate>
+    bool any_of_blocked(const T* array, size_t n, Predicate pred)
     {
-        if (std::isinf(array[i]))
+        const size_t block_size = 1024;
+        for (size_t begin = 0; begin < n; begin += block_size)
         {
-            throw std::runtime_error("Discovered Inf in '" + string(name) + "'");
+            size_t end = std::min(n, begin + block_size);
+            int found = 0;
+            for (size_t i = begin; i < end; i++)
+            {
+                found |= pred(array[i]);
+            }
+            if (found)
+            {
+                return true;
+            }
         }
+        return false;
+    }
+
+    // NaN is the only value that compares unequal to itself
+    template <typename T>
+    bool is_nan_value(T x)
+    {
+        return x != x;
+    }
+
+    template <typename T>
+    bool is_inf_value(T x)
+    {
+        return std::abs(x) == std::numeric_limits<T>::infinity();
+    }
+}
+
+bool ngraph::any_isnan(const float* array, size_t n)
+{
+    return any_of_blocked(array, n, is_nan_value<float>);
+}
+
+bool ngraph::any_isnan(const double* array, size_t n)
+{
+    return any_of_blocked(array, n, is_nan_value<double>);
+}
+
+bool ngraph::any_isinf(const float* array, size_t n)
+{
+    return any_of_blocked(array, n, is_inf_value<float>);
+}
+
+bool ngraph::any_isinf(const double* array, size_t n)
+{
+    return any_of_blocked(array, n, is_inf_value<double>);
+}
+
+void ngraph::check_fp_values_isinf(const char* name, const float* array, size_t n)
+{
+    if (any_isinf(array, n))
+    {
+        throw std::runtime_error("Discovered Inf in '" + string(name) + "'");
     }
 }
 
 void ngraph::check_fp_values_isinf(const char* name, const double* array, size_t n)
 {
-    for (size_t i = 0; i < n; i++)
+    if (any_isinf(array, n))
     {
-        if (std::isinf(array[i]))
-        {
-            throw std::runtime_error("Discovered Inf in '" + string(name) + "'");
-        }
+        throw std::runtime_error("Discovered Inf in '" + string(name) + "'");
     }
 }
 
 void ngraph::check_fp_values_isnan(const char* name, const float* array, size_t n)
 {
-    for (size_t i = 0; i < n; i++)
+    if (any_isnan(array, n))
     {
-        if (std::isnan(array[i]))
-        {
-            throw std::runtime_error("Discovered NaN in '" + string(name) + "'");
-        }
+        throw std::runtime_error("Discovered NaN in '" + string(name) + "'");
     }
 }
 
 void ngraph::check_fp_values_isnan(const char* name, const double* array, size_t n)
 {
-    for (size_t i = 0; i < n; i++)
+    if (any_isnan(array, n))
     {
-        if (std::isnan(array[i]))
-        {
-            throw std::runtime_error("Discovered NaN in '" + string(name) + "'");
-        }
+        throw std::runtime_error("Discovered NaN in '" + string(name) + "'");
     }
 }
 
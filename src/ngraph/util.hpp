@@ -186,6 +186,18 @@ namespace ngraph
         return y > x ? 0 : x - y;
     }
 
+    /// \brief Returns true if any of the \p n values is NaN. The scan is vectorized and stops
+    ///        within a block of the first hit.
+    NGRAPH_API
+    bool any_isnan(const float* array, size_t n);
+    NGRAPH_API
+    bool any_isnan(const double* array, size_t n);
+    /// \brief Returns true if any of the \p n values is +/-Inf.
+    NGRAPH_API
+    bool any_isinf(const float* array, size_t n);
+    NGRAPH_API
+    bool any_isinf(const double* array, size_t n);
+
     void check_fp_values_isinf(const char* name, const float* array, size_t n);
     void check_fp_values_isinf(const char* name, const double* array, size_t n);
     void check_fp_values_isnan(const char* name, const float* array, size_t n);
@@ -14,6 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
 #include "benchmark.hpp"
 #include "benchmark_utils.hpp"
 #include "ngraph/file_util.hpp"
@@ -26,12 +30,52 @@
 using namespace std;
 using namespace ngraph;
 
+LatencyStatistics::LatencyStatistics(vector<double> latencies, double total_microseconds)
+    : iterations(latencies.size())
+    , total_microseconds(total_microseconds)
+{
+    if (latencies.empty())
+    {
+        return;
+    }
+    sort(latencies.begin(), latencies.end());
+    // Nearest-rank percentile
+    auto percentile = [&](double p) {
+        size_t rank = static_cast<size_t>(ceil(p / 100 * latencies.size()));
+        return latencies[rank == 0 ? 0 : rank - 1];
+    };
+    throughput = total_microseconds > 0 ? iterations * 1e6 / total_microseconds : 0;
+    min = latencies.front();
+    max = latencies.back();
+    mean = accumulate(latencies.begin(), latencies.end(), 0.0) / iterations;
+    double variance = 0;
+    for (double latency : latencies)
+    {
+        variance += (latency - mean) * (latency - mean);
+    }
+    stddev = sqrt(variance / iterations);
+    p50 = percentile(50);
+    p90 = percentile(90);
+    p99 = percentile(99);
+    p999 = percentile(99.9);
+}
+
+ostream& operator<<(ostream& out, const LatencyStatistics& latency)
+{
+    out << "latency (us): min " << latency.min << ", p50 " << latency.p50 << ", p90 "
+        << latency.p90 << ", p99 " << latency.p99 << ", p99.9 " << latency.p999 << ", max "
+        << latency.max << ", mean " << latency.mean << ", stddev " << latency.stddev << endl;
+    out << "throughput: " << latency.throughput << " inferences/sec" << endl;
+    return out;
+}
+
 vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
                                                   const string& backend_name,
                                                   size_t iterations,
                                                   bool timing_detail,
                                                   size_t warmup_iterations,
-                                                  bool copy_data)
+                                                  bool copy_data,
+                                                  LatencyStatistics& latency)
 {
     stopwatch timer;
     timer.start();
@@ -78,13 +122,17 @@ vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
         }
     }
 
+    vector<double> latencies;
+    latencies.reserve(iterations);
     stopwatch t1;
+    stopwatch iteration_timer;
     for (size_t i = 0; i < iterations + warmup_iterations; i++)
     {
         if (i == warmup_iterations)
         {
             t1.start();
         }
+        iteration_timer.start();
         if (copy_data)
         {
             for (size_t arg_index = 0; arg_index < args.size(); arg_index++)
@@ -109,10 +157,17 @@ vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
                              data->get_element_count() * data->get_element_type().size());
             }
         }
+        iteration_timer.stop();
+        if (i >= warmup_iterations)
+        {
+            latencies.push_back(iteration_timer.get_nanoseconds() / 1e3);
+        }
     }
     t1.stop();
     float time = t1.get_milliseconds();
     ss << time / iterations << "ms per iteration" << endl;
+    latency = LatencyStatistics(move(latencies), t1.get_nanoseconds() / 1e3);
+    ss << latency;
     cout << ss.str();
 
     vector<runtime::PerformanceCounter> perf_data = exec->get_performance_data();
@@ -18,15 +18,43 @@
 
 #include <map>
 #include <memory>
+#include <ostream>
 #include <string>
 #include <vector>
 
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 
+/// \brief Distribution of the per-iteration latencies of a benchmark run. All latencies are in
+///        microseconds.
+class LatencyStatistics
+{
+public:
+    LatencyStatistics() = default;
+    /// \param latencies Latency of each timed iteration
+    /// \param total_microseconds Wall clock time of all timed iterations, used for throughput
+    LatencyStatistics(std::vector<double> latencies, double total_microseconds);
+
+    size_t iterations = 0;
+    double total_microseconds = 0;
+    /// \brief Iterations completed per second
+    double throughput = 0;
+    double min = 0;
+    double max = 0;
+    double mean = 0;
+    double stddev = 0;
+    double p50 = 0;
+    double p90 = 0;
+    double p99 = 0;
+    double p999 = 0;
+};
+
+std::ostream& operator<<(std::ostream& out, const LatencyStatistics& latency);
+
 std::vector<ngraph::runtime::PerformanceCounter> run_benchmark(std::shared_ptr<ngraph::Function> f,
                                                                const std::string& backend_name,
                                                                size_t iterations,
                                                                bool timing_detail,
                                                                size_t warmup_iterations,
-                                                               bool copy_data);
+                                                               bool copy_data,
+                                                               LatencyStatistics& latency);
@@ -0,0 +1,159 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+
+#include "benchmark_compile.hpp"
+#include "benchmark_utils.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/serializer.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#ifdef __linux__
+// Returns the VmHWM (peak resident set size) of this process in bytes, or zero
+static size_t get_peak_rss()
+{
+    ifstream status("/proc/self/status");
+    string line;
+    while (getline(status, line))
+    {
+        if (line.compare(0, 6, "VmHWM:") == 0)
+        {
+            return stoull(line.substr(6)) * 1024;
+        }
+    }
+    return 0;
+}
+
+// Resets VmHWM to the current resident set size. Requires Linux 4.0.
+static bool reset_peak_rss()
+{
+    ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+    clear_refs.flush();
+    return static_cast<bool>(clear_refs);
+}
+#else
+static size_t get_peak_rss()
+{
+    return 0;
+}
+
+static bool reset_peak_rss()
+{
+    return false;
+}
+#endif
+
+CompileStatistics& CompileStatistics::operator+=(const CompileStatistics& other)
+{
+    deserialize_microseconds += other.deserialize_microseconds;
+    compile_microseconds += other.compile_microseconds;
+    for (auto& p : other.pass_microseconds)
+    {
+        pass_microseconds[p.first] += p.second;
+    }
+    peak_rss_bytes = max(peak_rss_bytes, other.peak_rss_bytes);
+    memory_plan_bytes += other.memory_plan_bytes;
+    constant_bytes += other.constant_bytes;
+    executable_bytes += other.executable_bytes;
+    return *this;
+}
+
+ostream& operator<<(ostream& out, const CompileStatistics& stats)
+{
+    out << "deserialize time: " << stats.deserialize_microseconds / 1000 << "ms" << endl;
+    out << "compile time: " << stats.compile_microseconds / 1000 << "ms" << endl;
+    out << "peak RSS increase during compile: " << locale_string(stats.peak_rss_bytes)
+        << " bytes" << endl;
+    out << "memory plan size: " << locale_string(stats.memory_plan_bytes) << " bytes" << endl;
+    out << "constant size: " << locale_string(stats.constant_bytes) << " bytes" << endl;
+    out << "executable memory: " << locale_string(stats.executable_bytes) << " bytes" << endl;
+
+    multimap<size_t, string> passes;
+    size_t name_width = 0;
+    for (auto& p : stats.pass_microseconds)
+    {
+        passes.insert({p.second, p.first});
+        name_width = max(name_width, p.first.size());
+    }
+    out << "pass times:" << endl;
+    for (auto it = passes.rbegin(); it != passes.rend(); it++)
+    {
+        out << "    " << setw(static_cast<int>(name_width + 2)) << left << it->second << " "
+            << right << it->first << "us" << endl;
+    }
+    return out;
+}
+
+CompileStatistics run_compile_benchmark(const string& model, const string& backend_name)
+{
+    CompileStatistics stats;
+    stopwatch timer;
+
+    timer.start();
+    shared_ptr<Function> f = load_model(model);
+    timer.stop();
+    stats.deserialize_microseconds = timer.get_microseconds();
+
+    for (auto& node : f->get_ops())
+    {
+        if (auto constant = as_type_ptr<op::Constant>(node))
+        {
+            stats.constant_bytes +=
+                shape_size(constant->get_shape()) * constant->get_element_type().size();
+        }
+    }
+
+    auto backend = runtime::Backend::create(backend_name);
+
+    mutex pass_mutex;
+    pass::Manager::set_pass_report_callback([&](const pass::PassReport& report) {
+        lock_guard<mutex> lock(pass_mutex);
+        for (const pass::PassReportEntry& entry : report)
+        {
+            stats.pass_microseconds[entry.name] += entry.microseconds;
+        }
+    });
+    size_t rss_before = reset_peak_rss() ? get_peak_rss() : 0;
+    shared_ptr<runtime::Executable> exec;
+    try
+    {
+        timer.start();
+        exec = backend->compile(f);
+        timer.stop();
+    }
+    catch (...)
+    {
+        pass::Manager::set_pass_report_callback(nullptr);
+        throw;
+    }
+    pass::Manager::set_pass_report_callback(nullptr);
+    size_t rss_after = get_peak_rss();
+    stats.compile_microseconds = timer.get_microseconds();
+    stats.peak_rss_bytes = rss_after > rss_before ? rss_after - rss_before : 0;
+    // Backends that plan memory on the compiled function record the size of the plan there
+    stats.memory_plan_bytes = f->get_temporary_pool_size();
+    stats.executable_bytes = exec->get_memory_stats().get_total_bytes(1);
+    return stats;
+}
@@ -0,0 +1,48 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+
+/// \brief Cost of loading a model: deserialize (or ONNX import), pass and compile times plus
+///        memory use
+struct CompileStatistics
+{
+    size_t deserialize_microseconds = 0;
+    size_t compile_microseconds = 0;
+    /// \brief Time of the passes run during compile, summed by pass name
+    std::map<std::string, size_t> pass_microseconds;
+    /// \brief Increase of peak resident memory during compile, or the peak of the whole process
+    ///        where the peak cannot be reset. Zero where not available.
+    size_t peak_rss_bytes = 0;
+    /// \brief Temporary memory planned by the backend's memory layout
+    size_t memory_plan_bytes = 0;
+    size_t constant_bytes = 0;
+    /// \brief Memory held by the compiled executable with one call context, as reported by
+    ///        Executable::get_memory_stats. Zero for backends that do not report it.
+    size_t executable_bytes = 0;
+
+    CompileStatistics& operator+=(const CompileStatistics& other);
+};
+
+std::ostream& operator<<(std::ostream& out, const CompileStatistics& stats);
+
+/// \brief Loads and compiles a model, measuring each step
+CompileStatistics run_compile_benchmark(const std::string& model, const std::string& backend_name);
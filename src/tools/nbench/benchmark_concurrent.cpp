@@ -0,0 +1,236 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include "benchmark_concurrent.hpp"
+#include "benchmark_utils.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using Clock = chrono::steady_clock;
+
+namespace
+{
+    class Client
+    {
+    public:
+        Client(shared_ptr<Function> f, runtime::Backend& backend)
+        {
+            for (shared_ptr<op::Parameter> param : f->get_parameters())
+            {
+                auto tensor = backend.create_tensor(param->get_element_type(), param->get_shape());
+                auto tensor_data =
+                    make_shared<runtime::HostTensor>(param->get_element_type(), param->get_shape());
+                random_init(tensor_data);
+                tensor->write(tensor_data->get_data_ptr(),
+                              tensor_data->get_element_count() *
+                                  tensor_data->get_element_type().size());
+                args.push_back(tensor);
+                arg_data.push_back(tensor_data);
+            }
+            for (shared_ptr<Node> out : f->get_results())
+            {
+                results.push_back(
+                    backend.create_tensor(out->get_element_type(), out->get_shape()));
+                result_data.push_back(
+                    make_shared<runtime::HostTensor>(out->get_element_type(), out->get_shape()));
+            }
+        }
+
+        void run(runtime::Executable& exec, bool copy_data)
+        {
+            if (copy_data)
+            {
+                for (size_t i = 0; i < args.size(); i++)
+                {
+                    const shared_ptr<runtime::HostTensor>& data = arg_data[i];
+                    args[i]->write(data->get_data_ptr(),
+                                   data->get_element_count() * data->get_element_type().size());
+                }
+            }
+            exec.call(results, args);
+            if (copy_data)
+            {
+                for (size_t i = 0; i < results.size(); i++)
+                {
+                    const shared_ptr<runtime::HostTensor>& data = result_data[i];
+                    results[i]->read(data->get_data_ptr(),
+                                     data->get_element_count() * data->get_element_type().size());
+                }
+            }
+        }
+
+        vector<shared_ptr<runtime::HostTensor>> arg_data;
+        vector<shared_ptr<runtime::HostTensor>> result_data;
+        vector<shared_ptr<runtime::Tensor>> args;
+        vector<shared_ptr<runtime::Tensor>> results;
+        vector<double> latencies;
+    };
+}
+
+vector<runtime::PerformanceCounter> run_benchmark_concurrent(shared_ptr<Function> f,
+                                                             const string& backend_name,
+                                                             size_t iterations,
+                                                             bool timing_detail,
+                                                             size_t warmup_iterations,
+                                                             bool copy_data,
+                                                             size_t clients,
+                                                             double arrival_rate,
+                                                             LatencyStatistics& latency)
+{
+    stopwatch timer;
+    timer.start();
+    auto backend = runtime::Backend::create(backend_name);
+    auto exec = backend->compile(f, timing_detail);
+    timer.stop();
+    stringstream ss;
+    ss.imbue(locale(""));
+    ss << "compile time: " << timer.get_milliseconds() << "ms" << endl;
+    set_denormals_flush_to_zero();
+
+    clients = max(clients, size_t(1));
+    vector<Client> client_state;
+    for (size_t i = 0; i < clients; i++)
+    {
+        client_state.emplace_back(f, *backend);
+    }
+
+    // Arrival time of each request relative to the start of the timed run. With no arrival rate
+    // every request is available immediately.
+    vector<Clock::duration> arrivals(iterations, Clock::duration::zero());
+    if (arrival_rate > 0)
+    {
+        exponential_distribution<double> interval(arrival_rate);
+        double seconds = 0;
+        for (Clock::duration& arrival : arrivals)
+        {
+            seconds += interval(get_random_engine());
+            arrival = chrono::duration_cast<Clock::duration>(chrono::duration<double>(seconds));
+        }
+    }
+
+    mutex start_mutex;
+    condition_variable start_condition;
+    size_t ready = 0;
+    Clock::time_point start;
+    atomic<size_t> next_request{0};
+    mutex error_mutex;
+    exception_ptr error;
+
+    auto record_error = [&]() {
+        lock_guard<mutex> lock(error_mutex);
+        if (!error)
+        {
+            error = current_exception();
+        }
+        // Let the remaining clients stop after their current request
+        next_request = iterations;
+    };
+
+    auto client_entry = [&](Client& client) {
+        try
+        {
+            for (size_t i = 0; i < warmup_iterations; i++)
+            {
+                client.run(*exec, copy_data);
+            }
+        }
+        catch (...)
+        {
+            record_error();
+        }
+        {
+            // Wait for every client to finish warming up so the timed run starts together
+            unique_lock<mutex> lock(start_mutex);
+            if (++ready == clients)
+            {
+                start = Clock::now();
+                start_condition.notify_all();
+            }
+            else
+            {
+                start_condition.wait(lock, [&] { return ready == clients; });
+            }
+        }
+        try
+        {
+            for (size_t request = next_request++; request < iterations;
+                 request = next_request++)
+            {
+                Clock::time_point arrival = start + arrivals[request];
+                this_thread::sleep_until(arrival);
+                client.run(*exec, copy_data);
+                client.latencies.push_back(
+                    chrono::duration<double, micro>(Clock::now() - arrival).count());
+            }
+        }
+        catch (...)
+        {
+            record_error();
+        }
+    };
+
+    vector<thread> threads;
+    for (size_t i = 1; i < clients; i++)
+    {
+        threads.emplace_back(client_entry, ref(client_state[i]));
+    }
+    client_entry(client_state[0]);
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+    Clock::time_point stop = Clock::now();
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+
+    vector<double> latencies;
+    for (const Client& client : client_state)
+    {
+        latencies.insert(latencies.end(), client.latencies.begin(), client.latencies.end());
+    }
+    double total_microseconds = chrono::duration<double, micro>(stop - start).count();
+    ss << clients << " clients, ";
+    if (arrival_rate > 0)
+    {
+        ss << arrival_rate << " requests/sec offered" << endl;
+    }
+    else
+    {
+        ss << "closed loop" << endl;
+    }
+    ss << total_microseconds / 1000 / iterations << "ms per iteration" << endl;
+    latency = LatencyStatistics(move(latencies), total_microseconds);
+    ss << latency;
+    cout << ss.str();
+
+    vector<runtime::PerformanceCounter> perf_data = exec->get_performance_data();
+    return perf_data;
+}
@@ -0,0 +1,44 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
+
+/// \brief Runs f from several client threads at once, each with its own input and output
+///        tensors, all calling the same compiled executable.
+///
+/// \param clients Number of client threads
+/// \param arrival_rate Requests per second. If zero each client issues its next request as soon
+///        as the previous one completes (closed loop). Otherwise requests arrive as a Poisson
+///        process at this rate and are served by the first idle client (open loop); latency then
+///        includes the time a request waits for a client.
+std::vector<ngraph::runtime::PerformanceCounter>
+    run_benchmark_concurrent(std::shared_ptr<ngraph::Function> f,
+                             const std::string& backend_name,
+                             size_t iterations,
+                             bool timing_detail,
+                             size_t warmup_iterations,
+                             bool copy_data,
+                             size_t clients,
+                             double arrival_rate,
+                             LatencyStatistics& latency);
@@ -14,7 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <array>
+#include <algorithm>
 #include <condition_variable>
 #include <mutex>
 #include <thread>
@@ -46,9 +46,12 @@ private:
 static mutex s_mutex;
 static condition_variable s_condition;
 static size_t current_iteration = 0;
+static size_t s_pipeline_depth;
 static size_t s_iterations;
 static size_t s_warmup_iterations;
 static stopwatch s_timer;
+// Latencies of the timed iterations, one vector per pipeline stage
+static vector<vector<double>> s_latencies;
 
 static void
     thread_entry(runtime::Executable* exec, const TensorCollection& tensors, size_t pipeline_stage)
@@ -73,7 +76,7 @@ static void
             data_written = true;
         }
         unique_lock<mutex> lock(s_mutex);
-        if ((current_iteration & 1) != pipeline_stage)
+        if (current_iteration % s_pipeline_depth != pipeline_stage)
         {
             s_condition.wait(lock);
         }
@@ -84,6 +87,9 @@ static void
                 s_timer.start();
             }
             // our turn to run
+            bool timed = current_iteration >= s_warmup_iterations;
+            stopwatch iteration_timer;
+            iteration_timer.start();
             exec->call(results, args);
             current_iteration++;
             data_written = false;
@@ -96,6 +102,11 @@ static void
                 result->read(data->get_data_ptr(),
                              data->get_element_count() * data->get_element_type().size());
             }
+            iteration_timer.stop();
+            if (timed)
+            {
+                s_latencies[pipeline_stage].push_back(iteration_timer.get_nanoseconds() / 1e3);
+            }
             if (current_iteration == (s_iterations + s_warmup_iterations - 1))
             {
                 s_timer.stop();
@@ -109,17 +120,21 @@ vector<runtime::PerformanceCounter> run_benchmark_pipelined(shared_ptr<Function>
                                                             size_t iterations,
                                                             bool timing_detail,
                                                             int warmup_iterations,
-                                                            bool /* copy_data */)
+                                                            bool /* copy_data */,
+                                                            LatencyStatistics& latency)
 {
-    constexpr size_t pipeline_depth = 2;
     s_iterations = iterations;
     s_warmup_iterations = warmup_iterations;
-    array<TensorCollection, pipeline_depth> tensor_collections;
     stopwatch timer;
     timer.start();
     auto backend = runtime::Backend::create(backend_name);
     auto exec = backend->compile(f, timing_detail);
     timer.stop();
+    // Stages take turns; the backend keeps the tensors of each stage bound between calls
+    const size_t pipeline_depth = max<size_t>(exec->get_preferred_pipeline_depth(), 1);
+    s_pipeline_depth = pipeline_depth;
+    s_latencies.assign(pipeline_depth, {});
+    vector<TensorCollection> tensor_collections(pipeline_depth);
     stringstream ss;
     ss.imbue(locale(""));
     ss << "compile time: " << timer.get_milliseconds() << "ms" << endl;
@@ -149,7 +164,6 @@ vector<runtime::PerformanceCounter> run_benchmark_pipelined(shared_ptr<Function>
     }
 
     // Create input tensors for all Parameters
-    array<vector<shared_ptr<runtime::Tensor>>, pipeline_depth> input_tensors_array;
     size_t input_index = 0;
     for (shared_ptr<op::Parameter> param : f->get_parameters())
     {
@@ -161,7 +175,6 @@ vector<runtime::PerformanceCounter> run_benchmark_pipelined(shared_ptr<Function>
     }
 
     // Create output tensors for all Results
-    array<vector<shared_ptr<runtime::Tensor>>, pipeline_depth> output_tensors_array;
     size_t output_index = 0;
     for (shared_ptr<Node> result : f->get_results())
     {
@@ -172,7 +185,7 @@ vector<runtime::PerformanceCounter> run_benchmark_pipelined(shared_ptr<Function>
         }
     }
 
-    thread threads[pipeline_depth];
+    vector<thread> threads(pipeline_depth);
     for (size_t i = 0; i < pipeline_depth; i++)
     {
         threads[i] = thread(thread_entry, exec.get(), tensor_collections[i], i);
@@ -184,6 +197,13 @@ vector<runtime::PerformanceCounter> run_benchmark_pipelined(shared_ptr<Function>
     }
     float time = s_timer.get_milliseconds();
     ss << time / iterations << "ms per iteration" << endl;
+    vector<double> latencies;
+    for (const vector<double>& stage_latencies : s_latencies)
+    {
+        latencies.insert(latencies.end(), stage_latencies.begin(), stage_latencies.end());
+    }
+    latency = LatencyStatistics(move(latencies), s_timer.get_nanoseconds() / 1e3);
+    ss << latency;
     cout << ss.str();
 
     vector<runtime::PerformanceCounter> perf_data = exec->get_performance_data();
@@ -20,6 +20,9 @@
 
 #include "benchmark_utils.hpp"
 #include "ngraph/file_util.hpp"
+#ifdef NGRAPH_ONNX_IMPORT_ENABLE
+#include "ngraph/frontend/onnx_import/onnx.hpp"
+#endif
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/tensor.hpp"
@@ -29,6 +32,37 @@
 using namespace std;
 using namespace ngraph;
 
+static bool is_onnx_file(const string& path)
+{
+    string ext = file_util::get_file_ext(path);
+    return ext == ".onnx" || ext == ".prototxt";
+}
+
+bool is_model_file(const string& path)
+{
+#ifdef NGRAPH_ONNX_IMPORT_ENABLE
+    if (is_onnx_file(path))
+    {
+        return true;
+    }
+#endif
+    return file_util::get_file_ext(path) == ".json";
+}
+
+shared_ptr<Function> load_model(const string& path)
+{
+    if (is_onnx_file(path))
+    {
+#ifdef NGRAPH_ONNX_IMPORT_ENABLE
+        return onnx_import::import_onnx_model(path);
+#else
+        throw runtime_error("nbench was built without the ONNX importer, cannot load '" + path +
+                            "'");
+#endif
+    }
+    return deserialize(path);
+}
+
 template <>
 void init_int_tensor<char>(shared_ptr<runtime::Tensor> tensor, char min, char max)
 {
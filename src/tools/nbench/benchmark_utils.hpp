@@ -26,6 +26,13 @@
 
 void set_denormals_flush_to_zero();
 
+/// \brief True for the files load_model() can read: serialized nGraph models and, when the ONNX
+///        importer is built, ONNX models
+bool is_model_file(const std::string& path);
+
+/// \brief Deserializes an nGraph JSON model, or imports an ONNX .onnx or .prototxt model
+std::shared_ptr<ngraph::Function> load_model(const std::string& path);
+
 void random_init(std::shared_ptr<ngraph::runtime::Tensor> tensor);
 
 std::default_random_engine& get_random_engine();
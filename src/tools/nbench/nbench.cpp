@@ -29,8 +29,12 @@
 #include <iomanip>
 
 #include "benchmark.hpp"
+#include "benchmark_compile.hpp"
+#include "benchmark_concurrent.hpp"
 #include "benchmark_pipelined.hpp"
+#include "benchmark_utils.hpp"
 #include "ngraph/component_manager.hpp"
+#include "ngraph/cost_model.hpp"
 #include "ngraph/distributed.hpp"
 #include "ngraph/except.hpp"
 #include "ngraph/file_util.hpp"
@@ -154,6 +158,36 @@ void print_times(const multimap<size_t, string>& timing)
     }
 }
 
+void print_op_counters(const vector<PerfShape>& perf_data)
+{
+    bool has_hardware_counters = false;
+    size_t name_width = 0;
+    for (const PerfShape& p : perf_data)
+    {
+        has_hardware_counters |= p.has_hardware_counters();
+        name_width = max(name_width, p.get_node()->get_name().size());
+    }
+    cout << setw(name_width + 2) << left << "op" << right << setw(12) << "time(us)" << setw(10)
+         << "GFLOP/s" << setw(10) << "GB/s";
+    if (has_hardware_counters)
+    {
+        cout << setw(16) << "cycles" << setw(8) << "IPC" << setw(14) << "LLC misses";
+    }
+    cout << "\n";
+    for (const PerfShape& p : perf_data)
+    {
+        cout << setw(name_width + 2) << left << p.get_node()->get_name() << right << setw(12)
+             << p.total_microseconds() << fixed << setprecision(2) << setw(10)
+             << p.gflops_per_second() << setw(10) << p.gigabytes_per_second();
+        if (p.has_hardware_counters())
+        {
+            double ipc = p.cycles() == 0 ? 0 : static_cast<double>(p.instructions()) / p.cycles();
+            cout << setw(16) << p.cycles() << setw(8) << ipc << setw(14) << p.llc_misses();
+        }
+        cout << defaultfloat << "\n";
+    }
+}
+
 void print_results(vector<PerfShape> perf_data, bool timing_detail)
 {
     sort(perf_data.begin(), perf_data.end(), [](const PerfShape& p1, const PerfShape& p2) {
@@ -169,6 +203,164 @@ void print_results(vector<PerfShape> perf_data, bool timing_detail)
 
         cout << "\n---- Aggregate times per op type/shape/count ----\n";
         print_times(timing_details);
+
+        cout << "\n---- Per op counters ----\n";
+        print_op_counters(perf_data);
+    }
+}
+
+struct BenchmarkReport
+{
+    string model;
+    bool has_latency = false;
+    LatencyStatistics latency;
+    multimap<size_t, string> op_timing;
+    bool has_compile = false;
+    CompileStatistics compile;
+};
+
+static string json_escape(const string& s)
+{
+    ostringstream out;
+    for (char c : s)
+    {
+        switch (c)
+        {
+        case '"': out << "\\\""; break;
+        case '\\': out << "\\\\"; break;
+        case '\n': out << "\\n"; break;
+        case '\t': out << "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                out << "\\u" << hex << setw(4) << setfill('0') << static_cast<int>(c) << dec;
+            }
+            else
+            {
+                out << c;
+            }
+        }
+    }
+    return out.str();
+}
+
+static string csv_escape(const string& s)
+{
+    if (s.find_first_of(",\"\n") == string::npos)
+    {
+        return s;
+    }
+    string escaped = "\"";
+    for (char c : s)
+    {
+        escaped += c;
+        if (c == '"')
+        {
+            escaped += c;
+        }
+    }
+    return escaped + "\"";
+}
+
+static void write_json(const string& path,
+                       const string& backend,
+                       const vector<BenchmarkReport>& reports)
+{
+    ofstream out(path);
+    if (!out)
+    {
+        throw runtime_error("Unable to open '" + path + "' for writing");
+    }
+    out << setprecision(12);
+    out << "[";
+    for (size_t i = 0; i < reports.size(); i++)
+    {
+        const BenchmarkReport& report = reports[i];
+        out << (i == 0 ? "" : ",") << "\n  {\n";
+        out << "    \"model\": \"" << json_escape(report.model) << "\",\n";
+        out << "    \"backend\": \"" << json_escape(backend) << "\"";
+        if (report.has_latency)
+        {
+            const LatencyStatistics& latency = report.latency;
+            out << ",\n    \"iterations\": " << latency.iterations << ",\n";
+            out << "    \"total_us\": " << latency.total_microseconds << ",\n";
+            out << "    \"throughput\": " << latency.throughput << ",\n";
+            out << "    \"latency_us\": {\"min\": " << latency.min << ", \"max\": " << latency.max
+                << ", \"mean\": " << latency.mean << ", \"stddev\": " << latency.stddev
+                << ", \"p50\": " << latency.p50 << ", \"p90\": " << latency.p90
+                << ", \"p99\": " << latency.p99 << ", \"p99.9\": " << latency.p999 << "},\n";
+            out << "    \"op_us\": {";
+            bool first = true;
+            for (auto it = report.op_timing.rbegin(); it != report.op_timing.rend(); it++)
+            {
+                out << (first ? "" : ", ") << "\"" << json_escape(it->second)
+                    << "\": " << it->first;
+                first = false;
+            }
+            out << "}";
+        }
+        if (report.has_compile)
+        {
+            const CompileStatistics& compile = report.compile;
+            out << ",\n    \"compile\": {\"deserialize_us\": " << compile.deserialize_microseconds
+                << ", \"compile_us\": " << compile.compile_microseconds
+                << ", \"peak_rss_bytes\": " << compile.peak_rss_bytes
+                << ", \"memory_plan_bytes\": " << compile.memory_plan_bytes
+                << ", \"constant_bytes\": " << compile.constant_bytes
+                << ", \"executable_bytes\": " << compile.executable_bytes << ", \"pass_us\": {";
+            bool first = true;
+            for (auto& p : compile.pass_microseconds)
+            {
+                out << (first ? "" : ", ") << "\"" << json_escape(p.first) << "\": " << p.second;
+                first = false;
+            }
+            out << "}}";
+        }
+        out << "\n  }";
+    }
+    out << "\n]\n";
+}
+
+static void write_csv(const string& path,
+                      const string& backend,
+                      const vector<BenchmarkReport>& reports)
+{
+    ofstream out(path);
+    if (!out)
+    {
+        throw runtime_error("Unable to open '" + path + "' for writing");
+    }
+    out << setprecision(12);
+    out << "model,backend,iterations,total_us,throughput,min_us,max_us,mean_us,stddev_us,p50_us,"
+           "p90_us,p99_us,p99.9_us,deserialize_us,compile_us,peak_rss_bytes,memory_plan_bytes,"
+           "constant_bytes,executable_bytes\n";
+    for (const BenchmarkReport& report : reports)
+    {
+        out << csv_escape(report.model) << "," << csv_escape(backend);
+        if (report.has_latency)
+        {
+            const LatencyStatistics& latency = report.latency;
+            out << "," << latency.iterations << "," << latency.total_microseconds << ","
+                << latency.throughput << "," << latency.min << "," << latency.max << ","
+                << latency.mean << "," << latency.stddev << "," << latency.p50 << ","
+                << latency.p90 << "," << latency.p99 << "," << latency.p999;
+        }
+        else
+        {
+            out << ",,,,,,,,,,,";
+        }
+        if (report.has_compile)
+        {
+            const CompileStatistics& compile = report.compile;
+            out << "," << compile.deserialize_microseconds << "," << compile.compile_microseconds
+                << "," << compile.peak_rss_bytes << "," << compile.memory_plan_bytes << ","
+                << compile.constant_bytes << "," << compile.executable_bytes;
+        }
+        else
+        {
+            out << ",,,,,,";
+        }
+        out << "\n";
     }
 }
 
@@ -186,6 +378,11 @@ int main(int argc, char** argv)
     bool copy_data = true;
     bool dot_file = false;
     bool double_buffer = false;
+    bool compile_stats = false;
+    size_t clients = 0;
+    double arrival_rate = 0;
+    string json_file;
+    string csv_file;
 
     configure_static_backends();
     for (int i = 1; i < argc; i++)
@@ -239,6 +436,42 @@ int main(int argc, char** argv)
         {
             double_buffer = true;
         }
+        else if (arg == "--compile_stats")
+        {
+            compile_stats = true;
+        }
+        else if (arg == "--clients")
+        {
+            try
+            {
+                clients = stoul(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--arrival_rate")
+        {
+            try
+            {
+                arrival_rate = stod(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--json")
+        {
+            json_file = argv[++i];
+        }
+        else if (arg == "--csv")
+        {
+            csv_file = argv[++i];
+        }
         else if (arg == "-w" || arg == "--warmup_iterations")
         {
             try
@@ -277,23 +510,36 @@ int main(int argc, char** argv)
     {
         cout << R"###(
 DESCRIPTION
-    Benchmark nGraph JSON model with given backend.
+    Benchmark nGraph JSON or ONNX model with given backend.
 
 SYNOPSIS
         nbench [-f <filename>] [-b <backend>] [-i <iterations>]
 
 OPTIONS
-        -f|--file                 Serialized model file
+        -f|--file                 Serialized model file, or ONNX model where the ONNX importer
+                                  is built
         -b|--backend              Backend to use (default: CPU)
         -d|--directory            Directory to scan for models. All models are benchmarked.
         -i|--iterations           Iterations (default: 10)
-        -s|--statistics           Display op statistics
+        -s|--statistics           Display op statistics, and estimated FLOPs and bytes moved
         -v|--visualize            Visualize a model (WARNING: requires Graphviz installed)
-        --timing_detail           Gather detailed timing
+        --timing_detail           Gather detailed timing, with estimated GFLOP/s and GB/s per
+                                  op. Set NGRAPH_CPU_HARDWARE_COUNTERS=1 to add cycles, IPC
+                                  and LLC misses on the CPU backend.
         -w|--warmup_iterations    Number of warm-up iterations
         --no_copy_data            Disable copy of input/result data every iteration
         --dot                     Generate Graphviz dot file
         --double_buffer           Double buffer inputs and outputs
+        --compile_stats           Measure deserialize, pass and compile times, peak RSS during
+                                  compile, memory plan size, constant size and executable
+                                  memory
+        --clients <n>             Call the model from n client threads at once, each with its
+                                  own tensors. Combine with NGRAPH_CPU_CONCURRENCY to allow
+                                  concurrent calls on the CPU backend.
+        --arrival_rate <r>        Open loop: requests arrive as a Poisson process at r per
+                                  second instead of back to back. Implies --clients 1 if unset.
+        --json <file>             Write latency, throughput, per-op and compile stats as JSON
+        --csv <file>              Write latency, throughput and compile stats as CSV
 )###";
         return 1;
     }
@@ -304,7 +550,7 @@ OPTIONS
         vector<PerfShape> aggregate_perf_data;
         file_util::iterate_files(directory,
                                  [&](const string& file, bool is_dir) {
-                                     if (!is_dir)
+                                     if (!is_dir && is_model_file(file))
                                      {
                                          models.push_back(file);
                                      }
@@ -318,6 +564,8 @@ OPTIONS
     }
 
     vector<PerfShape> aggregate_perf_data;
+    vector<BenchmarkReport> reports;
+    CompileStatistics aggregate_compile_stats;
     int rc = 0;
     for (const string& model : models)
     {
@@ -325,11 +573,13 @@ OPTIONS
         cout << "============================================================================\n";
         cout << "---- Processing '" << model << "'\n";
         cout << "============================================================================\n";
+        BenchmarkReport report;
+        report.model = model;
         try
         {
             if (visualize)
             {
-                shared_ptr<Function> f = deserialize(model);
+                shared_ptr<Function> f = load_model(model);
                 auto model_file_name = ngraph::file_util::get_file_name(model) +
                                        (dot_file ? ".dot" : ngraph::file_util::get_file_ext(model));
 
@@ -340,7 +590,7 @@ OPTIONS
 
             if (statistics)
             {
-                shared_ptr<Function> f = deserialize(model);
+                shared_ptr<Function> f = load_model(model);
 
                 pass::Manager pass_manager;
                 pass_manager.register_pass<pass::Liveness>();
@@ -415,6 +665,11 @@ OPTIONS
                      << " bytes in " << total_temporary_count << " temporaries\n";
                 cout << "Temporary size with reuse : "
                      << locale_string(f->get_temporary_pool_size()) << " bytes\n";
+                FunctionCost cost = estimate_cost(*f);
+                cout << "Estimated FLOPs: " << locale_string(cost.flops) << "\n";
+                cout << "Estimated bytes moved: " << locale_string(cost.bytes) << "\n";
+                cout << "Arithmetic intensity: " << cost.arithmetic_intensity()
+                     << " FLOPs per byte\n";
                 cout << "--\n";
                 cout << "Types used:\n";
                 for (const string& type : type_list)
@@ -428,25 +683,60 @@ OPTIONS
                 }
             }
 
+            if (compile_stats && !backend.empty())
+            {
+                cout << "\n---- Compile ----\n";
+                report.compile = run_compile_benchmark(model, backend);
+                report.has_compile = true;
+                aggregate_compile_stats += report.compile;
+                cout << report.compile;
+            }
+
             if (!backend.empty())
             {
                 cout << "\n---- Benchmark ----\n";
-                shared_ptr<Function> f = deserialize(model);
+                shared_ptr<Function> f = load_model(model);
                 vector<runtime::PerformanceCounter> perf_data;
-                if (double_buffer)
+                LatencyStatistics latency;
+                if (clients > 0 || arrival_rate > 0)
+                {
+                    perf_data = run_benchmark_concurrent(f,
+                                                         backend,
+                                                         iterations,
+                                                         timing_detail,
+                                                         warmup_iterations,
+                                                         copy_data,
+                                                         clients,
+                                                         arrival_rate,
+                                                         latency);
+                }
+                else if (double_buffer)
                 {
-                    perf_data = run_benchmark_pipelined(
-                        f, backend, iterations, timing_detail, warmup_iterations, copy_data);
+                    perf_data = run_benchmark_pipelined(f,
+                                                        backend,
+                                                        iterations,
+                                                        timing_detail,
+                                                        warmup_iterations,
+                                                        copy_data,
+                                                        latency);
                 }
                 else
                 {
-                    perf_data = run_benchmark(
-                        f, backend, iterations, timing_detail, warmup_iterations, copy_data);
+                    perf_data = run_benchmark(f,
+                                              backend,
+                                              iterations,
+                                              timing_detail,
+                                              warmup_iterations,
+                                              copy_data,
+                                              latency);
                 }
                 auto perf_shape = to_perf_shape(f, perf_data);
                 aggregate_perf_data.insert(
                     aggregate_perf_data.end(), perf_shape.begin(), perf_shape.end());
                 print_results(perf_shape, timing_detail);
+                report.has_latency = true;
+                report.latency = latency;
+                report.op_timing = aggregate_timing(perf_shape);
             }
         }
         catch (ngraph::unsupported_op& ue)
@@ -459,6 +749,10 @@ OPTIONS
             cout << "Exception caught on '" << model << "'\n" << e.what() << endl;
             rc += 1;
         }
+        if (report.has_latency || report.has_compile)
+        {
+            reports.push_back(report);
+        }
     }
 
     if (models.size() > 1)
@@ -468,6 +762,28 @@ OPTIONS
         cout << "---- Aggregate over all models\n";
         cout << "============================================================================\n";
         print_results(aggregate_perf_data, timing_detail);
+        if (compile_stats)
+        {
+            cout << "\n---- Compile ----\n";
+            cout << aggregate_compile_stats;
+        }
+    }
+
+    try
+    {
+        if (!json_file.empty())
+        {
+            write_json(json_file, backend, reports);
+        }
+        if (!csv_file.empty())
+        {
+            write_csv(csv_file, backend, reports);
+        }
+    }
+    catch (exception& e)
+    {
+        cout << e.what() << endl;
+        rc += 1;
     }
 
     return rc;
@@ -0,0 +1,505 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// tool to benchmark the collectives of the DistributedInterface built into nGraph (OpenMPI or
+// MLSL). Run it on every process, for example
+// $ mpirun -np 4 ./ncollbench -c all_reduce,broadcast --max_bytes 67108864
+// Rank 0 prints the results.
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "ngraph/distributed.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    struct Collective
+    {
+        string name;
+        /// Bus bandwidth over algorithm bandwidth for `size` processes, the fraction of the
+        /// data each link carries in an optimal implementation
+        function<double(int size)> bus_factor;
+    };
+
+    struct Result
+    {
+        string collective;
+        string type;
+        size_t bytes;
+        size_t count;
+        double microseconds;
+        double algorithm_gbps;
+        double bus_gbps;
+    };
+
+    const vector<Collective>& get_collectives()
+    {
+        static const vector<Collective> collectives{
+            {"all_reduce", [](int n) { return 2.0 * (n - 1) / n; }},
+            {"all_reduce_hierarchical", [](int n) { return 2.0 * (n - 1) / n; }},
+            {"all_reduce_bf16", [](int n) { return 2.0 * (n - 1) / n; }},
+            {"all_reduce_f16", [](int n) { return 2.0 * (n - 1) / n; }},
+            {"all_reduce_start", [](int n) { return 2.0 * (n - 1) / n; }},
+            {"reduce_scatter", [](int n) { return 1.0 * (n - 1) / n; }},
+            {"all_gather", [](int n) { return 1.0 * (n - 1) / n; }},
+            {"broadcast", [](int) { return 1.0; }},
+            {"broadcast_ring", [](int) { return 1.0; }},
+            {"send_recv", [](int) { return 1.0; }}};
+        return collectives;
+    }
+
+    const map<string, element::Type_t>& get_types()
+    {
+        static const map<string, element::Type_t> types{{"f32", element::Type_t::f32},
+                                                        {"f64", element::Type_t::f64},
+                                                        {"i8", element::Type_t::i8},
+                                                        {"i16", element::Type_t::i16},
+                                                        {"i32", element::Type_t::i32},
+                                                        {"i64", element::Type_t::i64},
+                                                        {"u8", element::Type_t::u8},
+                                                        {"u16", element::Type_t::u16},
+                                                        {"u32", element::Type_t::u32},
+                                                        {"u64", element::Type_t::u64}};
+        return types;
+    }
+
+    // Waits until every process has reached this point
+    void barrier(DistributedInterface* dist)
+    {
+        float in = 0;
+        float out = 0;
+        dist->all_reduce(&in, &out, element::Type_t::f32, reduction::Type::SUM, 1);
+    }
+
+    // The largest of the values of all processes
+    double max_over_processes(DistributedInterface* dist, double value)
+    {
+        double out = 0;
+        dist->all_reduce(&value, &out, element::Type_t::f64, reduction::Type::MAX, 1);
+        return out;
+    }
+
+    // Returns a callable that runs one instance of the collective on `bytes` bytes, or an empty
+    // function if the collective does not apply. `count` is set to the values each process
+    // passes to the interface.
+    function<void()> make_run(DistributedInterface* dist,
+                              const string& collective,
+                              element::Type_t type,
+                              size_t bytes,
+                              size_t chunk_bytes,
+                              size_t& count,
+                              vector<char>& in,
+                              vector<char>& out,
+                              vector<float>& residual)
+    {
+        size_t element_size = element::Type(type).size();
+        int size = dist->get_size();
+        int rank = dist->get_rank();
+        count = max<size_t>(bytes / element_size, 1);
+        size_t chunk_count = chunk_bytes / element_size;
+
+        // The sharded collectives move `bytes` in total, `count` values per process
+        if (collective == "reduce_scatter" || collective == "all_gather")
+        {
+            count = max<size_t>(count / size, 1);
+        }
+        size_t local_bytes = count * element_size;
+        in.assign(collective == "reduce_scatter" ? local_bytes * size : local_bytes, 0);
+        out.assign(collective == "all_gather" ? local_bytes * size : local_bytes, 0);
+
+        void* in_ptr = in.data();
+        void* out_ptr = out.data();
+        if (collective == "all_reduce")
+        {
+            return [=]() { dist->all_reduce(in_ptr, out_ptr, type, reduction::Type::SUM, count); };
+        }
+        if (collective == "all_reduce_hierarchical")
+        {
+            return [=]() {
+                dist->all_reduce(in_ptr,
+                                 out_ptr,
+                                 type,
+                                 reduction::Type::SUM,
+                                 count,
+                                 reduction::Algorithm::HIERARCHICAL,
+                                 reduction::Compression::NONE,
+                                 nullptr);
+            };
+        }
+        if (collective == "all_reduce_bf16" || collective == "all_reduce_f16")
+        {
+            if (type != element::Type_t::f32)
+            {
+                return nullptr;
+            }
+            auto compression = collective == "all_reduce_bf16" ? reduction::Compression::BF16
+                                                               : reduction::Compression::F16;
+            residual.assign(count, 0);
+            float* residual_ptr = residual.data();
+            return [=]() {
+                dist->all_reduce(in_ptr,
+                                 out_ptr,
+                                 type,
+                                 reduction::Type::SUM,
+                                 count,
+                                 reduction::Algorithm::FLAT,
+                                 compression,
+                                 residual_ptr);
+            };
+        }
+        if (collective == "all_reduce_start")
+        {
+            return [=]() {
+                dist->all_reduce_start(in_ptr, out_ptr, type, reduction::Type::SUM, count)
+                    ->wait();
+            };
+        }
+        if (collective == "reduce_scatter")
+        {
+            return [=]() {
+                dist->reduce_scatter(in_ptr, out_ptr, type, reduction::Type::SUM, count);
+            };
+        }
+        if (collective == "all_gather")
+        {
+            return [=]() { dist->all_gather(in_ptr, out_ptr, type, count); };
+        }
+        if (collective == "broadcast" || collective == "broadcast_ring")
+        {
+            BroadcastOptions options = BroadcastOptions::get_default(element_size);
+            options.algorithm = collective == "broadcast_ring"
+                                    ? BroadcastOptions::Algorithm::RING
+                                    : BroadcastOptions::Algorithm::TREE;
+            if (chunk_bytes > 0)
+            {
+                options.chunk_count = chunk_count;
+            }
+            return [=]() { dist->broadcast(in_ptr, type, count, 0, options); };
+        }
+        if (collective == "send_recv")
+        {
+            // Ping-pong between ranks 0 and 1; each call is one round trip
+            if (size < 2)
+            {
+                return nullptr;
+            }
+            if (rank > 1)
+            {
+                return []() {};
+            }
+            int peer = 1 - rank;
+            return [=]() {
+                for (int step = 0; step < 2; step++)
+                {
+                    if ((step == 0) == (rank == 0))
+                    {
+                        if (chunk_count > 0)
+                        {
+                            dist->send_start(in_ptr, type, count, peer, chunk_count)->wait();
+                        }
+                        else
+                        {
+                            dist->send(in_ptr, type, count, peer);
+                        }
+                    }
+                    else
+                    {
+                        if (chunk_count > 0)
+                        {
+                            dist->recv_start(out_ptr, type, count, peer, chunk_count)->wait();
+                        }
+                        else
+                        {
+                            dist->recv(out_ptr, type, count, peer);
+                        }
+                    }
+                }
+            };
+        }
+        throw runtime_error("Unknown collective '" + collective + "'");
+    }
+
+    vector<string> split(const string& s)
+    {
+        vector<string> parts;
+        stringstream ss(s);
+        string part;
+        while (getline(ss, part, ','))
+        {
+            if (!part.empty())
+            {
+                parts.push_back(part);
+            }
+        }
+        return parts;
+    }
+
+    void print_results(ostream& out, const vector<Result>& results)
+    {
+        out << left << setw(24) << "collective" << setw(6) << "type" << right << setw(12)
+            << "bytes" << setw(12) << "count" << setw(12) << "time(us)" << setw(14)
+            << "algbw(GB/s)" << setw(14) << "busbw(GB/s)" << "\n";
+        for (const Result& result : results)
+        {
+            out << left << setw(24) << result.collective << setw(6) << result.type << right
+                << setw(12) << result.bytes << setw(12) << result.count << fixed
+                << setprecision(2) << setw(12) << result.microseconds << setw(14)
+                << result.algorithm_gbps << setw(14) << result.bus_gbps << defaultfloat << "\n";
+        }
+    }
+
+    void write_csv(const string& path, const vector<Result>& results)
+    {
+        ofstream out(path);
+        if (!out)
+        {
+            throw runtime_error("Unable to open '" + path + "' for writing");
+        }
+        out << setprecision(12);
+        out << "collective,type,bytes,count,time_us,algbw_gbps,busbw_gbps\n";
+        for (const Result& result : results)
+        {
+            out << result.collective << "," << result.type << "," << result.bytes << ","
+                << result.count << "," << result.microseconds << "," << result.algorithm_gbps
+                << "," << result.bus_gbps << "\n";
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    string collectives_arg;
+    string types_arg = "f32";
+    size_t min_bytes = 8;
+    size_t max_bytes = 64 << 20;
+    size_t step_factor = 2;
+    size_t chunk_bytes = 0;
+    int iterations = 20;
+    int warmup_iterations = 5;
+    string csv_file;
+    bool failed = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        try
+        {
+            if (arg == "-c" || arg == "--collectives")
+            {
+                collectives_arg = argv[++i];
+            }
+            else if (arg == "-t" || arg == "--types")
+            {
+                types_arg = argv[++i];
+            }
+            else if (arg == "--min_bytes")
+            {
+                min_bytes = stoull(argv[++i]);
+            }
+            else if (arg == "--max_bytes")
+            {
+                max_bytes = stoull(argv[++i]);
+            }
+            else if (arg == "--step_factor")
+            {
+                step_factor = stoull(argv[++i]);
+            }
+            else if (arg == "--chunk_bytes")
+            {
+                chunk_bytes = stoull(argv[++i]);
+            }
+            else if (arg == "-i" || arg == "--iterations")
+            {
+                iterations = stoi(argv[++i]);
+            }
+            else if (arg == "-w" || arg == "--warmup_iterations")
+            {
+                warmup_iterations = stoi(argv[++i]);
+            }
+            else if (arg == "--csv")
+            {
+                csv_file = argv[++i];
+            }
+            else
+            {
+                cout << "Unknown option: " << arg << endl;
+                failed = true;
+            }
+        }
+        catch (...)
+        {
+            cout << "Invalid Argument\n";
+            failed = true;
+        }
+    }
+
+    vector<string> collectives = split(collectives_arg);
+    if (collectives.empty())
+    {
+        for (const Collective& collective : get_collectives())
+        {
+            collectives.push_back(collective.name);
+        }
+    }
+    for (const string& name : collectives)
+    {
+        auto& all = get_collectives();
+        if (none_of(all.begin(), all.end(), [&](const Collective& c) { return c.name == name; }))
+        {
+            cout << "Unknown collective: " << name << endl;
+            failed = true;
+        }
+    }
+    vector<string> types = split(types_arg);
+    for (const string& type : types)
+    {
+        if (get_types().count(type) == 0)
+        {
+            cout << "Unsupported element type: " << type << endl;
+            failed = true;
+        }
+    }
+    if (min_bytes == 0 || min_bytes > max_bytes || step_factor < 2 || iterations < 1)
+    {
+        cout << "Invalid size range or iteration count\n";
+        failed = true;
+    }
+
+    if (failed)
+    {
+        cout << R"###(
+DESCRIPTION
+    Benchmark the collectives of nGraph's distributed interface (OpenMPI or MLSL). Run on
+    every process, e.g. with mpirun. Rank 0 prints the time of each collective, its algorithm
+    bandwidth (bytes / time) and its bus bandwidth (the algorithm bandwidth scaled by the
+    fraction of the data each link carries, e.g. 2(n-1)/n for all_reduce).
+
+SYNOPSIS
+        ncollbench [-c <collectives>] [-t <types>] [--min_bytes <n>] [--max_bytes <n>]
+
+OPTIONS
+        -c|--collectives          Comma separated collectives (default: all): all_reduce,
+                                  all_reduce_hierarchical, all_reduce_bf16, all_reduce_f16,
+                                  all_reduce_start, reduce_scatter, all_gather, broadcast,
+                                  broadcast_ring, send_recv
+        -t|--types                Comma separated element types (default: f32)
+        --min_bytes <n>           Smallest tensor size in bytes (default: 8)
+        --max_bytes <n>           Largest tensor size in bytes (default: 64 MiB)
+        --step_factor <n>         Ratio between consecutive sizes (default: 2)
+        --chunk_bytes <n>         Chunk size of broadcast and send_recv (default: library
+                                  default for broadcast, one message for send_recv)
+        -i|--iterations           Iterations per size (default: 20)
+        -w|--warmup_iterations    Warm-up iterations per size (default: 5)
+        --csv <file>              Also write the results as CSV
+
+    reduce_scatter and all_gather move the given size in total, split over the processes.
+    send_recv times one message from rank 0 to rank 1, half of a round trip.
+)###";
+        return 1;
+    }
+
+    DistributedInterface* dist = get_distributed_interface();
+    int size = dist->get_size();
+    if (size < 1)
+    {
+        cout << "ncollbench requires nGraph built with NGRAPH_DISTRIBUTED_ENABLE\n";
+        return 1;
+    }
+    bool is_root = dist->get_rank() == 0;
+    if (is_root)
+    {
+        cout << "Distributed interface: " << dist->get_name() << ", " << size << " processes\n";
+    }
+
+    vector<Result> results;
+    vector<char> in;
+    vector<char> out;
+    vector<float> residual;
+    for (const string& name : collectives)
+    {
+        auto& all = get_collectives();
+        const Collective& collective =
+            *find_if(all.begin(), all.end(), [&](const Collective& c) { return c.name == name; });
+        for (const string& type_name : types)
+        {
+            element::Type_t type = get_types().at(type_name);
+            for (size_t bytes = min_bytes; bytes <= max_bytes; bytes *= step_factor)
+            {
+                size_t count = 0;
+                auto run =
+                    make_run(dist, name, type, bytes, chunk_bytes, count, in, out, residual);
+                if (!run)
+                {
+                    break;
+                }
+                for (int i = 0; i < warmup_iterations; i++)
+                {
+                    run();
+                }
+                barrier(dist);
+                stopwatch timer;
+                timer.start();
+                for (int i = 0; i < iterations; i++)
+                {
+                    run();
+                }
+                timer.stop();
+                double microseconds = static_cast<double>(timer.get_nanoseconds()) / 1000 /
+                                      iterations / (name == "send_recv" ? 2 : 1);
+                microseconds = max_over_processes(dist, microseconds);
+
+                Result result;
+                result.collective = name;
+                result.type = type_name;
+                result.bytes = bytes;
+                result.count = count;
+                result.microseconds = microseconds;
+                result.algorithm_gbps = microseconds > 0 ? bytes / microseconds / 1000 : 0;
+                result.bus_gbps = result.algorithm_gbps * collective.bus_factor(size);
+                results.push_back(result);
+            }
+        }
+    }
+
+    if (is_root)
+    {
+        print_results(cout, results);
+        if (!csv_file.empty())
+        {
+            try
+            {
+                write_csv(csv_file, results);
+            }
+            catch (exception& e)
+            {
+                cout << e.what() << endl;
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
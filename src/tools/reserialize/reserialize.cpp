@@ -42,11 +42,12 @@ DESCRIPTION
     Reserialize a serialized model
 
 SYNOPSIS
-        reserialize [-i|--input <input file>] [-o|--output <output file>]
+        reserialize [-i|--input <input file>] [-o|--output <output file>] [-b|--binary]
 
 OPTIONS
-        -i or --input  input serialized model
+        -i or --input  input serialized model, in json or binary format
         -o or --output output serialized model
+        -b or --binary write the output in binary format instead of json
         -c or --constant_to_broacast Convert large constant constants to broadcast
 )###";
 }
@@ -56,6 +57,7 @@ int main(int argc, char** argv)
     string input;
     string output;
     bool c2b = false;
+    bool binary = false;
     for (int i = 1; i < argc; i++)
     {
         string arg = argv[i];
@@ -67,6 +69,10 @@ int main(int argc, char** argv)
         {
             input = argv[++i];
         }
+        else if (arg == "-b" || arg == "--binary")
+        {
+            binary = true;
+        }
         else if (arg == "-c" || arg == "--constant_to_broadcast")
         {
             c2b = true;
@@ -109,7 +115,14 @@ int main(int argc, char** argv)
         }
 
         timer.start();
-        ngraph::serialize(output, function, 2);
+        if (binary)
+        {
+            ngraph::serialize_binary(output, function);
+        }
+        else
+        {
+            ngraph::serialize(output, function, 2);
+        }
         timer.stop();
         cout << "serialize took   " << timer.get_milliseconds() << "ms\n";
     }
@@ -36,6 +36,7 @@
 #include "ngraph/op/log.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
+#include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
@@ -567,6 +568,114 @@ TEST(algebraic_simplification, log_no_divide)
     ASSERT_EQ(neg_inner->get_argument(0), log_mul);
 }
 
+TEST(algebraic_simplification, power_strength_reduction)
+{
+    auto run = [](double exponent) {
+        auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+        auto e = op::Constant::create(element::f32, Shape{}, {exponent});
+        auto power = make_shared<op::Power>(
+            a, make_shared<op::Broadcast>(e, Shape{2, 3}, AxisSet{0, 1}));
+        auto neg = make_shared<op::Negative>(power);
+        auto f = make_shared<Function>(NodeVector{neg}, ParameterVector{a});
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::AlgebraicSimplification>();
+        pass_manager.run_passes(f);
+        EXPECT_EQ(count_ops_of_type<op::Power>(f), 0) << exponent;
+        return neg->get_argument(0);
+    };
+
+    auto square = as_type_ptr<op::Multiply>(run(2));
+    ASSERT_TRUE(square);
+    ASSERT_EQ(square->get_argument(0), square->get_argument(1));
+    ASSERT_TRUE(is_type<op::Parameter>(run(1)));
+    ASSERT_TRUE(is_type<op::Sqrt>(run(0.5)));
+    auto rsqrt = as_type_ptr<op::Divide>(run(-0.5));
+    ASSERT_TRUE(rsqrt);
+    ASSERT_TRUE(is_type<op::Sqrt>(rsqrt->get_argument(1)));
+    auto reciprocal = as_type_ptr<op::Divide>(run(-1));
+    ASSERT_TRUE(reciprocal);
+    ASSERT_TRUE(is_type<op::Parameter>(reciprocal->get_argument(1)));
+}
+
+TEST(algebraic_simplification, power_negative_tests)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto i = make_shared<op::Parameter>(element::i32, Shape{2});
+    auto non_uniform =
+        make_shared<op::Power>(a, op::Constant::create(element::f32, Shape{2}, {2, 3}));
+    auto cube = make_shared<op::Power>(a, op::Constant::create(element::f32, Shape{2}, {3, 3}));
+    auto variable = make_shared<op::Power>(a, b);
+    auto integer_reciprocal =
+        make_shared<op::Power>(i, op::Constant::create(element::i32, Shape{2}, {-1, -1}));
+    auto f = make_shared<Function>(NodeVector{non_uniform, cube, variable, integer_reciprocal},
+                                   ParameterVector{a, b, i});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AlgebraicSimplification>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Power>(f), 4);
+}
+
+TEST(algebraic_simplification, divide_by_constant)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto c = op::Constant::create(element::f32, Shape{3}, {2.0, 4.0, 0.5});
+    auto divide =
+        make_shared<op::Divide>(a, make_shared<op::Broadcast>(c, Shape{2, 3}, AxisSet{0}));
+    auto root = make_shared<op::Divide>(
+        divide, make_shared<op::Sqrt>(op::Constant::create(element::f32, Shape{2, 3}, {4})));
+    auto neg = make_shared<op::Negative>(root);
+    auto f = make_shared<Function>(NodeVector{neg}, ParameterVector{a});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AlgebraicSimplification>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Divide>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Sqrt>(f), 0);
+
+    auto outer = as_type_ptr<op::Multiply>(neg->get_argument(0));
+    ASSERT_TRUE(outer);
+    auto rsqrt = as_type_ptr<op::Constant>(outer->get_argument(1));
+    ASSERT_TRUE(rsqrt);
+    EXPECT_EQ(rsqrt->get_vector<float>(), vector<float>(6, 0.5f));
+    auto inner = as_type_ptr<op::Multiply>(outer->get_argument(0));
+    ASSERT_TRUE(inner);
+    ASSERT_EQ(inner->get_argument(0), a);
+    auto broadcast = as_type_ptr<op::Broadcast>(inner->get_argument(1));
+    ASSERT_TRUE(broadcast);
+    auto reciprocal = as_type_ptr<op::Constant>(broadcast->get_argument(0));
+    ASSERT_TRUE(reciprocal);
+    EXPECT_EQ(reciprocal->get_vector<float>(), (vector<float>{0.5f, 0.25f, 2.0f}));
+}
+
+TEST(algebraic_simplification, divide_negative_tests)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto i = make_shared<op::Parameter>(element::i32, Shape{2});
+    auto variable = make_shared<op::Divide>(a, b);
+    auto zero = make_shared<op::Divide>(a, op::Constant::create(element::f32, Shape{2}, {1, 0}));
+    auto integer = make_shared<op::Divide>(i, op::Constant::create(element::i32, Shape{2}, {2, 2}));
+    // Left to simplify_log
+    auto log = make_shared<op::Log>(make_shared<op::Divide>(
+        make_shared<op::Exp>(a), op::Constant::create(element::f32, Shape{2}, {2, 2})));
+    auto f = make_shared<Function>(NodeVector{variable, zero, integer, log},
+                                   ParameterVector{a, b, i});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AlgebraicSimplification>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Divide>(f), 3);
+    ASSERT_EQ(count_ops_of_type<op::Multiply>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Log>(f), 1);
+
+    auto c = make_shared<op::Divide>(a, op::Constant::create(element::f32, Shape{2}, {2, 2}));
+    auto g = make_shared<Function>(NodeVector{c}, ParameterVector{a});
+    pass::Manager no_reciprocal;
+    no_reciprocal.register_pass<pass::AlgebraicSimplification>(false);
+    no_reciprocal.run_passes(g);
+    ASSERT_EQ(count_ops_of_type<op::Divide>(g), 1);
+}
+
 TEST(algebraic_simplification, pass_property)
 {
     auto pass = std::make_shared<ngraph::pass::AlgebraicSimplification>();
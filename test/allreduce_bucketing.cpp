@@ -0,0 +1,106 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(allreduce_bucketing, fuse_gradients)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto c = make_shared<op::Parameter>(element::f32, Shape{5, 1});
+    auto f = make_shared<Function>(NodeVector{make_shared<op::AllReduce>(a),
+                                              make_shared<op::AllReduce>(b),
+                                              make_shared<op::AllReduce>(c)},
+                                   ParameterVector{a, b, c});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceBucketing>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::AllReduce>(f), 1);
+    auto allreduce = f->get_results().at(1)->get_argument(0)->get_argument(0);
+    ASSERT_TRUE(is_type<op::AllReduce>(allreduce));
+    EXPECT_EQ(allreduce->get_shape(), (Shape{15}));
+    EXPECT_EQ(f->get_results().at(0)->get_shape(), (Shape{2, 3}));
+    EXPECT_EQ(f->get_results().at(1)->get_shape(), (Shape{4}));
+    EXPECT_EQ(f->get_results().at(2)->get_shape(), (Shape{5, 1}));
+}
+
+TEST(allreduce_bucketing, bucket_size)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{16});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{16});
+    auto c = make_shared<op::Parameter>(element::f32, Shape{16});
+    auto f = make_shared<Function>(NodeVector{make_shared<op::AllReduce>(a),
+                                              make_shared<op::AllReduce>(b),
+                                              make_shared<op::AllReduce>(c)},
+                                   ParameterVector{a, b, c});
+
+    // Two of the 64 byte tensors fit in a bucket
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceBucketing>(128);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::AllReduce>(f), 2);
+}
+
+TEST(allreduce_bucketing, different_types)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto b = make_shared<op::Parameter>(element::f64, Shape{4});
+    auto c = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto d = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto f = make_shared<Function>(
+        NodeVector{make_shared<op::AllReduce>(a),
+                   make_shared<op::AllReduce>(b),
+                   make_shared<op::AllReduce>(c),
+                   make_shared<op::AllReduce>(d, reduction::Type::MAX)},
+        ParameterVector{a, b, c, d});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceBucketing>();
+    pass_manager.run_passes(f);
+
+    // a and c share a bucket, b and d are reduced on their own
+    ASSERT_EQ(count_ops_of_type<op::AllReduce>(f), 3);
+}
+
+TEST(allreduce_bucketing, dependent_allreduce)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto ar_a = make_shared<op::AllReduce>(a);
+    auto ar_b = make_shared<op::AllReduce>(b);
+    auto ar_sum = make_shared<op::AllReduce>(ar_a + ar_b);
+    auto f = make_shared<Function>(NodeVector{ar_a, ar_sum}, ParameterVector{a, b});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceBucketing>();
+    pass_manager.run_passes(f);
+
+    // ar_a and ar_b are fused, ar_sum depends on them and gets a bucket of its own
+    ASSERT_EQ(count_ops_of_type<op::AllReduce>(f), 2);
+    ASSERT_EQ(count_ops_of_type<op::Concat>(f), 1);
+}
@@ -0,0 +1,109 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/op/all_gather.hpp"
+#include "ngraph/op/fused/optimizer_update.hpp"
+#include "ngraph/op/reduce_scatter.hpp"
+#include "ngraph/pass/allreduce_sharding.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(allreduce_sharding, sgd_momentum_update)
+{
+    Shape shape{4, 3};
+    auto param = make_shared<op::Parameter>(element::f32, shape);
+    auto grad = make_shared<op::Parameter>(element::f32, shape);
+    auto velocity = make_shared<op::Parameter>(element::f32, shape);
+    auto lr = make_shared<op::Parameter>(element::f32, Shape{});
+    auto update = make_shared<op::SGDMomentumUpdate>(
+        param, make_shared<op::AllReduce>(grad), velocity, lr, 0.9);
+    auto f = make_shared<Function>(OutputVector{update->output(0), update->output(1)},
+                                   ParameterVector{param, grad, velocity, lr});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceSharding>(2, 1);
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::AllReduce>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::ReduceScatter>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::AllGather>(f), 2);
+    // The param and velocity shards of rank 1
+    ASSERT_EQ(count_ops_of_type<op::Slice>(f), 2);
+    for (auto& node : f->get_ops())
+    {
+        if (auto slice = as_type_ptr<op::Slice>(node))
+        {
+            EXPECT_EQ(slice->get_lower_bounds(), (Coordinate{2, 0}));
+            EXPECT_EQ(slice->get_upper_bounds(), (Coordinate{4, 3}));
+        }
+    }
+    EXPECT_EQ(f->get_results().at(0)->get_shape(), shape);
+    EXPECT_EQ(f->get_results().at(1)->get_shape(), shape);
+}
+
+TEST(allreduce_sharding, gathers_shared_values)
+{
+    Shape shape{6};
+    auto grad = make_shared<op::Parameter>(element::f32, shape);
+    auto param = make_shared<op::Parameter>(element::f32, shape);
+    auto allreduce = make_shared<op::AllReduce>(grad);
+    auto step = make_shared<op::Multiply>(allreduce, allreduce);
+    auto f = make_shared<Function>(NodeVector{make_shared<op::Subtract>(param, step),
+                                              allreduce,
+                                              make_shared<op::Sum>(step, AxisSet{0})},
+                                   ParameterVector{grad, param});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceSharding>(3, 0);
+    pass_manager.run_passes(f);
+
+    // The reduced gradient, the step and the new param are each read outside of the update
+    EXPECT_EQ(count_ops_of_type<op::ReduceScatter>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::AllGather>(f), 3);
+    EXPECT_EQ(f->get_results().at(0)->get_shape(), shape);
+    EXPECT_EQ(f->get_results().at(1)->get_shape(), shape);
+}
+
+TEST(allreduce_sharding, indivisible_rows)
+{
+    auto grad = make_shared<op::Parameter>(element::f32, Shape{5, 2});
+    auto param = make_shared<op::Parameter>(element::f32, Shape{5, 2});
+    auto f = make_shared<Function>(
+        NodeVector{make_shared<op::Subtract>(param, make_shared<op::AllReduce>(grad))},
+        ParameterVector{grad, param});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceSharding>(2, 0);
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::AllReduce>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::ReduceScatter>(f), 0);
+}
+
+TEST(allreduce_sharding, collective_shapes)
+{
+    auto arg = make_shared<op::Parameter>(element::f32, Shape{8, 3});
+    EXPECT_EQ(make_shared<op::ReduceScatter>(arg, 4)->get_shape(), (Shape{2, 3}));
+    EXPECT_EQ(make_shared<op::AllGather>(arg, 4)->get_shape(), (Shape{32, 3}));
+    EXPECT_THROW(make_shared<op::ReduceScatter>(arg, 3), NodeValidationFailure);
+}
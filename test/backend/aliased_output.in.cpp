@@ -65,3 +65,45 @@ NGRAPH_TEST(${BACKEND_NAME}, aliased_output)
     EXPECT_TRUE(test::all_close_f(expectedE, read_vector<float>(out6), MIN_FLOAT_TOLERANCE_BITS));
     EXPECT_TRUE(test::all_close_f(expectedE, read_vector<float>(out7), MIN_FLOAT_TOLERANCE_BITS));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, aliased_output_elementwise_chain)
+{
+    // Intermediates that are last used by a same-shaped elementwise op or a reshape may share
+    // memory with that op's output; none of the results may observe the overwrite
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = A + B;
+    auto D = make_shared<op::Relu>(C - A);
+    auto E = make_shared<op::Negative>(D);
+    auto F = make_shared<op::Reshape>(E * C, AxisVector{0, 1}, Shape{3, 2});
+    auto G = make_shared<op::Abs>(F);
+    auto f = make_shared<Function>(NodeVector{G, D, C}, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> out_g = backend->create_tensor(element::f32, Shape{3, 2});
+    shared_ptr<runtime::Tensor> out_d = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> out_c = backend->create_tensor(element::f32, shape);
+
+    copy_data(a, vector<float>{0, 1, 2, 3, 4, 5});
+    copy_data(b, vector<float>{1, -2, 3, -4, 5, -6});
+
+    vector<float> expected_g{1, 0, 15, 0, 45, 0};
+    vector<float> expected_d{1, 0, 3, 0, 5, 0};
+    vector<float> expected_c{1, -1, 5, -1, 9, -1};
+
+    auto handle = backend->compile(f);
+    for (size_t i = 0; i < 2; i++)
+    {
+        handle->call_with_validate({out_g, out_d, out_c}, {a, b});
+        EXPECT_TRUE(
+            test::all_close_f(expected_g, read_vector<float>(out_g), MIN_FLOAT_TOLERANCE_BITS));
+        EXPECT_TRUE(
+            test::all_close_f(expected_d, read_vector<float>(out_d), MIN_FLOAT_TOLERANCE_BITS));
+        EXPECT_TRUE(
+            test::all_close_f(expected_c, read_vector<float>(out_c), MIN_FLOAT_TOLERANCE_BITS));
+    }
+}
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "util/all_close_f.hpp"
@@ -53,6 +55,81 @@ NGRAPH_TEST(${BACKEND_NAME}, create_tensor_1)
     EXPECT_TRUE(test::all_close_f(read_vector<float>(result), expected, MIN_FLOAT_TOLERANCE_BITS));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, create_tensor_with_deleter)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    if (!backend->is_supported_property(runtime::Backend::Property::memory_attach))
+    {
+        return;
+    }
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    size_t released = 0;
+    auto deleter = [&released](void* ptr) {
+        delete[] static_cast<float*>(ptr);
+        released++;
+    };
+    {
+        auto av = new float[4]{1, 2, 3, 4};
+        auto bv = new float[4]{5, 6, 7, 8};
+        auto rv = new float[4]{};
+        auto a = backend->create_tensor(element::f32, shape, av, deleter);
+        auto b = backend->create_tensor(element::f32, shape, bv, deleter);
+        auto result = backend->create_tensor(element::f32, shape, rv, deleter);
+
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {a, b});
+        EXPECT_TRUE(test::all_close_f(
+            (vector<float>{6, 8, 10, 12}), vector<float>(rv, rv + 4), MIN_FLOAT_TOLERANCE_BITS));
+
+        auto alias = result;
+        result.reset();
+        EXPECT_EQ(released, 0);
+    }
+    EXPECT_EQ(released, 3);
+}
+
+// Results written straight into caller buffers must stay correct when outputs alias inputs or
+// several results share one producer
+NGRAPH_TEST(${BACKEND_NAME}, result_buffer_binding)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto sum = make_shared<op::Add>(A, B);
+    auto f = make_shared<Function>(NodeVector{sum, sum, A}, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto r0 = backend->create_tensor(element::f32, shape);
+    auto r1 = backend->create_tensor(element::f32, shape);
+    auto r2 = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({r0, r1, r2}, {a, b});
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{6, 8, 10, 12}), read_vector<float>(r0), MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{6, 8, 10, 12}), read_vector<float>(r1), MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{1, 2, 3, 4}), read_vector<float>(r2), MIN_FLOAT_TOLERANCE_BITS));
+
+    // Accumulate into an input
+    auto g = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+    auto accumulate = backend->compile(g);
+    accumulate->call_with_validate({a}, {a, b});
+    accumulate->call_with_validate({a}, {a, b});
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{11, 14, 17, 20}), read_vector<float>(a), MIN_FLOAT_TOLERANCE_BITS));
+}
+
 // This tests a backend's implementation of the copy_from for tensor
 NGRAPH_TEST(${BACKEND_NAME}, tensor_copy_from)
 {
@@ -110,3 +187,72 @@ NGRAPH_TEST(${BACKEND_NAME}, get_parameters_and_results)
     //     EXPECT_NE(results[i], func_results[i]);
     // }
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, call_async)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    shared_ptr<runtime::Tensor> result = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+    atomic<bool> callback_called{false};
+    auto future = handle->call_async(
+        {result}, {a, b}, [&callback_called](bool rc) { callback_called = rc; });
+    EXPECT_TRUE(future.get());
+    EXPECT_TRUE(callback_called);
+    vector<float> expected = {6, 8, 10, 12};
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), expected, MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, call_async_pipelined)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+    size_t depth = handle->get_preferred_pipeline_depth();
+    ASSERT_GE(depth, 1);
+    auto a = handle->create_input_tensor(0, depth);
+    auto b = handle->create_input_tensor(1, depth);
+    auto result = handle->create_output_tensor(0, depth);
+
+    // Up to `depth` calls are in flight, each stage writing its inputs while the others run
+    vector<future<bool>> futures(depth);
+    for (size_t iteration = 0; iteration < 4 * depth; iteration++)
+    {
+        size_t stage = iteration % depth;
+        if (futures[stage].valid())
+        {
+            EXPECT_TRUE(futures[stage].get());
+            float x = static_cast<float>(iteration - depth);
+            EXPECT_TRUE(test::all_close_f(vector<float>{x + 1, x + 2, x + 3, x + 4},
+                                          read_vector<float>(result[stage]),
+                                          MIN_FLOAT_TOLERANCE_BITS));
+        }
+        float x = static_cast<float>(iteration);
+        copy_data(a[stage], vector<float>{x, x, x, x});
+        copy_data(b[stage], vector<float>{1, 2, 3, 4});
+        futures[stage] = handle->call_async({result[stage]}, {a[stage], b[stage]});
+    }
+    for (size_t iteration = 3 * depth; iteration < 4 * depth; iteration++)
+    {
+        size_t stage = iteration % depth;
+        EXPECT_TRUE(futures[stage].get());
+        float x = static_cast<float>(iteration);
+        EXPECT_TRUE(test::all_close_f(vector<float>{x + 1, x + 2, x + 3, x + 4},
+                                      read_vector<float>(result[stage]),
+                                      MIN_FLOAT_TOLERANCE_BITS));
+    }
+}
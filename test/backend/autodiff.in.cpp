@@ -1844,3 +1844,38 @@ NGRAPH_TEST(${BACKEND_NAME}, backwards_reverse_sequence_n4d2c3h2w2)
 #undef AUTODIFF_BACKEND_${BACKEND_NAME}
 #endif
 // clang-format on
+
+NGRAPH_TEST(${BACKEND_NAME}, backwards_shared_embedding)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    Shape weights_shape{4, 2};
+    Shape indices_shape{3};
+    Shape result_shape{3, 2};
+    auto W = make_shared<op::Parameter>(element::f32, weights_shape);
+    auto I1 = make_shared<op::Parameter>(element::i32, indices_shape);
+    auto I2 = make_shared<op::Parameter>(element::i32, indices_shape);
+    auto lookup = make_shared<op::EmbeddingLookup>(I1, W);
+    auto gather = make_shared<op::Gather>(W, I2);
+    auto f = make_shared<Function>(lookup + gather, ParameterVector{W, I1, I2});
+
+    // Both row contributions to W are accumulated by one scatter
+    auto df = autodiff::backprop_function(f);
+    EXPECT_EQ(count_ops_of_type<op::ScatterAdd>(df), 1);
+
+    auto w = backend->create_tensor(element::f32, weights_shape);
+    copy_data(w, vector<float>(shape_size(weights_shape), 0));
+    auto i1 = backend->create_tensor(element::i32, indices_shape);
+    copy_data(i1, vector<int32_t>{0, 2, 0});
+    auto i2 = backend->create_tensor(element::i32, indices_shape);
+    copy_data(i2, vector<int32_t>{1, 2, 3});
+    auto c = backend->create_tensor(element::f32, result_shape);
+    copy_data(c, vector<float>{1, 2, 3, 4, 5, 6});
+    auto dw = backend->create_tensor(element::f32, weights_shape);
+    auto di1 = backend->create_tensor(element::i32, indices_shape);
+    auto di2 = backend->create_tensor(element::i32, indices_shape);
+
+    auto handle = backend->compile(df);
+    handle->call_with_validate({dw, di1, di2}, {w, i1, i2, c});
+    EXPECT_EQ((vector<float>{6, 8, 1, 2, 6, 8, 5, 6}), read_vector<float>(dw));
+}
@@ -0,0 +1,101 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/batching/batching_executable.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+NGRAPH_TEST(${BACKEND_NAME}, batching_executable_coalesces_calls)
+{
+    Shape shape{1, 4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B) * A, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    const size_t max_batch = 4;
+    auto exec = make_shared<runtime::batching::BatchingExecutable>(
+        f, backend, max_batch, chrono::milliseconds(50));
+
+    auto make_call = [&](float base) {
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{base, base + 1, base + 2, base + 3});
+        copy_data(b, vector<float>{1, 1, 1, 1});
+        EXPECT_TRUE(exec->call_with_validate({result}, {a, b}));
+        vector<float> expected;
+        for (float x : {base, base + 1, base + 2, base + 3})
+        {
+            expected.push_back((x + 1) * x);
+        }
+        EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+    };
+
+    vector<thread> threads;
+    for (size_t i = 0; i < 2 * max_batch + 1; i++)
+    {
+        threads.emplace_back(make_call, static_cast<float>(10 * i));
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    EXPECT_EQ(exec->get_request_count(), 2 * max_batch + 1);
+    EXPECT_LE(exec->get_batch_count(), 2 * max_batch + 1);
+    EXPECT_GE(exec->get_batch_count(), 3);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, batching_executable_single_call)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Negative>(A), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    runtime::batching::BatchingExecutable exec(f, backend, 8, chrono::microseconds(100));
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    EXPECT_TRUE(exec.call_with_validate({result}, {a}));
+    EXPECT_TRUE(test::all_close_f((vector<float>{-1, -2, -3, -4, -5, -6}),
+                                  read_vector<float>(result)));
+    EXPECT_EQ(exec.get_batch_count(), 1);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, batching_executable_rejects_mixed_rows)
+{
+    // Softmax over axis 0 would normalize over the rows of every request in the batch
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Softmax>(A, AxisSet{0}), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    EXPECT_THROW(
+        runtime::batching::BatchingExecutable(f, backend, 4, chrono::microseconds(100)),
+        CheckFailure);
+}
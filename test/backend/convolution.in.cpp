@@ -137,6 +137,196 @@ NGRAPH_TEST(${BACKEND_NAME}, convolution_simple_padding)
     EXPECT_TRUE(test::all_close_f(vector<float>{expected_result}, read_vector<float>(result)));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, convolution_3x3_odd_output_asymmetric_padding)
+{
+    // A 3x3 unit-stride convolution whose output is not a whole number of 2x2 tiles
+    Shape shape_a{2, 3, 6, 8};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    Shape shape_b{4, 3, 3, 3};
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    Shape shape_r{2, 4, 5, 7};
+    auto conv1 = make_shared<op::Convolution>(A,
+                                              B,
+                                              Strides{1, 1},
+                                              Strides{1, 1},
+                                              CoordinateDiff{1, 0},
+                                              CoordinateDiff{0, 1},
+                                              Strides{1, 1});
+
+    auto f = make_shared<Function>(conv1, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    vector<float> a_data(shape_size(shape_a));
+    vector<float> b_data(shape_size(shape_b));
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = static_cast<float>(static_cast<int>(i % 11) - 5);
+    }
+    for (size_t i = 0; i < b_data.size(); i++)
+    {
+        b_data[i] = static_cast<float>(static_cast<int>(i % 7) - 3);
+    }
+    vector<float> expected_result(shape_size(shape_r), 0);
+    for (size_t n = 0; n < 2; n++)
+    {
+        for (size_t oc = 0; oc < 4; oc++)
+        {
+            for (size_t y = 0; y < 5; y++)
+            {
+                for (size_t x = 0; x < 7; x++)
+                {
+                    float sum = 0;
+                    for (size_t c = 0; c < 3; c++)
+                    {
+                        for (size_t i = 0; i < 3; i++)
+                        {
+                            for (size_t j = 0; j < 3; j++)
+                            {
+                                // Padding is one row above and one column on the right
+                                if (y + i >= 1 && y + i <= 6 && x + j < 8)
+                                {
+                                    sum += a_data[((n * 3 + c) * 6 + y + i - 1) * 8 + x + j] *
+                                           b_data[((oc * 3 + c) * 3 + i) * 3 + j];
+                                }
+                            }
+                        }
+                    }
+                    expected_result[((n * 4 + oc) * 5 + y) * 7 + x] = sum;
+                }
+            }
+        }
+    }
+
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, a_data);
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, b_data);
+    auto result = backend->create_tensor(element::f32, shape_r);
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(expected_result, read_vector<float>(result)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, convolution_backprop_strided_dilated_f64)
+{
+    // Strides and filter dilation differ per axis, so swapping them would be caught
+    Shape shape_in{3, 2, 7, 6};
+    Shape shape_filter{3, 2, 3, 2};
+    Shape shape_delta{3, 3, 3, 5};
+    Strides strides{2, 1};
+    Strides dilations{1, 2};
+    CoordinateDiff padding_below{1, 0};
+    CoordinateDiff padding_above{0, 1};
+
+    auto in = make_shared<op::Parameter>(element::f64, shape_in);
+    auto filter = make_shared<op::Parameter>(element::f64, shape_filter);
+    auto delta = make_shared<op::Parameter>(element::f64, shape_delta);
+    auto backprop_filter = make_shared<op::ConvolutionBackpropFilters>(
+        in, shape_filter, delta, strides, dilations, padding_below, padding_above, Strides{1, 1});
+    auto backprop_data = make_shared<op::ConvolutionBackpropData>(
+        shape_in, filter, delta, strides, dilations, padding_below, padding_above, Strides{1, 1});
+    auto f = make_shared<Function>(NodeVector{backprop_filter, backprop_data},
+                                   ParameterVector{in, filter, delta});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    vector<double> in_data(shape_size(shape_in));
+    vector<double> filter_data(shape_size(shape_filter));
+    vector<double> delta_data(shape_size(shape_delta));
+    for (size_t i = 0; i < in_data.size(); i++)
+    {
+        in_data[i] = static_cast<double>(static_cast<int>(i % 11) - 5);
+    }
+    for (size_t i = 0; i < filter_data.size(); i++)
+    {
+        filter_data[i] = static_cast<double>(static_cast<int>(i % 7) - 3);
+    }
+    for (size_t i = 0; i < delta_data.size(); i++)
+    {
+        delta_data[i] = static_cast<double>(static_cast<int>(i % 5) - 2);
+    }
+
+    vector<double> expected_filter(shape_size(shape_filter), 0);
+    vector<double> expected_data(shape_size(shape_in), 0);
+    for (size_t n = 0; n < 3; n++)
+    {
+        for (size_t oc = 0; oc < 3; oc++)
+        {
+            for (size_t y = 0; y < 3; y++)
+            {
+                for (size_t x = 0; x < 5; x++)
+                {
+                    double d = delta_data[((n * 3 + oc) * 3 + y) * 5 + x];
+                    for (size_t c = 0; c < 2; c++)
+                    {
+                        for (size_t i = 0; i < 3; i++)
+                        {
+                            for (size_t j = 0; j < 2; j++)
+                            {
+                                // One row of padding above, one column on the right
+                                size_t iy = y * 2 + i;
+                                size_t ix = x + j * 2;
+                                if (iy >= 1 && iy <= 7 && ix < 6)
+                                {
+                                    size_t in_index = ((n * 2 + c) * 7 + iy - 1) * 6 + ix;
+                                    size_t filter_index = ((oc * 2 + c) * 3 + i) * 2 + j;
+                                    expected_filter[filter_index] += in_data[in_index] * d;
+                                    expected_data[in_index] += filter_data[filter_index] * d;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    auto a = backend->create_tensor(element::f64, shape_in);
+    copy_data(a, in_data);
+    auto b = backend->create_tensor(element::f64, shape_filter);
+    copy_data(b, filter_data);
+    auto c = backend->create_tensor(element::f64, shape_delta);
+    copy_data(c, delta_data);
+    auto result_filter = backend->create_tensor(element::f64, shape_filter);
+    auto result_data = backend->create_tensor(element::f64, shape_in);
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result_filter, result_data}, {a, b, c});
+    EXPECT_EQ(expected_filter, read_vector<double>(result_filter));
+    EXPECT_EQ(expected_data, read_vector<double>(result_data));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, convolution_infinite_weight_padding)
+{
+    // Padded taps are skipped, so the infinite weight never meets the padding
+    Shape shape_a{1, 1, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    Shape shape_b{1, 1, 2};
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    Shape shape_r{1, 1, 4};
+    auto conv1 = make_shared<op::Convolution>(A,
+                                              B,
+                                              Strides{1},
+                                              Strides{1},
+                                              CoordinateDiff{1},
+                                              CoordinateDiff{1},
+                                              Strides{1});
+
+    auto f = make_shared<Function>(conv1, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    const float inf = numeric_limits<float>::infinity();
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1, 2, 3});
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, vector<float>{inf, 1});
+    auto result = backend->create_tensor(element::f32, shape_r);
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ((vector<float>{1, inf, inf, inf}), read_vector<float>(result));
+}
+
 // The purpose of this test is to check if we can allow
 // data_batch_shape as a node rather than argument
 NGRAPH_TEST(${BACKEND_NAME}, dyn_convolution_backprop_data)
@@ -187,3 +187,65 @@ NGRAPH_TEST(${BACKEND_NAME}, cum_sum_2dim_allmodes)
     test_cum_sum_allmodes(0, 1, 1);
     test_cum_sum_allmodes(0, 0, 1);
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, cum_sum_long_axis_allmodes)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Long contiguous axes take the blocked scan, the others split over lanes
+    for (auto shape : {Shape{3, 20000}, Shape{2, 13000, 1}, Shape{64, 5, 7}, Shape{2, 3, 9000}})
+    {
+        for (int64_t axis_val = 0; axis_val < static_cast<int64_t>(shape.size()); axis_val++)
+        {
+            size_t outer = shape_size(Shape(shape.begin(), shape.begin() + axis_val));
+            size_t length = shape[axis_val];
+            size_t inner = shape_size(Shape(shape.begin() + axis_val + 1, shape.end()));
+
+            vector<int64_t> input(shape_size(shape));
+            for (size_t i = 0; i < input.size(); i++)
+            {
+                input[i] = static_cast<int64_t>(i * 7919 % 1001) - 500;
+            }
+
+            for (bool exclusive : {false, true})
+            {
+                for (bool reverse : {false, true})
+                {
+                    vector<int64_t> expected(input.size());
+                    for (size_t o = 0; o < outer; o++)
+                    {
+                        for (size_t j = 0; j < inner; j++)
+                        {
+                            int64_t sum = 0;
+                            for (size_t p = 0; p < length; p++)
+                            {
+                                size_t k = reverse ? length - 1 - p : p;
+                                size_t index = (o * length + k) * inner + j;
+                                expected[index] = exclusive ? sum : sum + input[index];
+                                sum += input[index];
+                            }
+                        }
+                    }
+
+                    auto A = make_shared<op::Parameter>(element::i64, shape);
+                    auto axis = make_shared<op::Parameter>(element::i64, Shape{1});
+                    auto f = make_shared<Function>(
+                        make_shared<op::CumSum>(A, axis, exclusive, reverse),
+                        ParameterVector{A, axis});
+
+                    auto a = backend->create_tensor(element::i64, shape);
+                    copy_data(a, input);
+                    auto axis_tensor = backend->create_tensor(element::i64, Shape{1});
+                    copy_data(axis_tensor, vector<int64_t>{axis_val});
+                    auto result = backend->create_tensor(element::i64, shape);
+
+                    auto handle = backend->compile(f);
+                    handle->call_with_validate({result}, {a, axis_tensor});
+                    EXPECT_EQ(expected, read_vector<int64_t>(result))
+                        << "shape " << shape << " axis " << axis_val << " exclusive "
+                        << exclusive << " reverse " << reverse;
+                }
+            }
+        }
+    }
+}
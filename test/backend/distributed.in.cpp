@@ -14,7 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
 #include <fstream>
+#include <numeric>
 #include <sstream>
 
 #include "gtest/gtest.h"
@@ -22,6 +24,7 @@
 #include "ngraph/distributed.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pipeline.hpp"
 #include "ngraph/serializer.hpp"
 #include "util/all_close_f.hpp"
 #include "util/random.hpp"
@@ -32,15 +35,19 @@ using namespace ngraph;
 
 static string s_manifest = "${MANIFEST}";
 
-static void test_allreduce_common(reduction::Type reduce_type)
+static void test_allreduce_common(
+    reduction::Type reduce_type,
+    reduction::Algorithm algorithm = reduction::Algorithm::FLAT,
+    reduction::Compression compression = reduction::Compression::NONE)
 {
     auto comm_size = get_distributed_interface()->get_size();
     if (comm_size > 1)
     {
         auto shape = Shape{2, 2};
         auto A = make_shared<op::Parameter>(element::f32, shape);
-        auto f =
-            make_shared<Function>(make_shared<op::AllReduce>(A, reduce_type), ParameterVector{A});
+        auto f = make_shared<Function>(
+            make_shared<op::AllReduce>(A, reduce_type, algorithm, compression),
+            ParameterVector{A});
 
         auto backend = runtime::Backend::create("${BACKEND_NAME}");
 
@@ -98,6 +105,24 @@ NGRAPH_TEST(${BACKEND_NAME}, allreduce_sum)
     test_allreduce_common(reduction::Type::SUM);
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, allreduce_sum_hierarchical)
+{
+    test_allreduce_common(reduction::Type::SUM, reduction::Algorithm::HIERARCHICAL);
+}
+
+// The sums are small integers, which 16-bit floats represent exactly
+NGRAPH_TEST(${BACKEND_NAME}, allreduce_sum_bf16)
+{
+    test_allreduce_common(
+        reduction::Type::SUM, reduction::Algorithm::FLAT, reduction::Compression::BF16);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, allreduce_sum_f16_hierarchical)
+{
+    test_allreduce_common(
+        reduction::Type::SUM, reduction::Algorithm::HIERARCHICAL, reduction::Compression::F16);
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, allreduce_min)
 {
     test_allreduce_common(reduction::Type::MIN);
@@ -228,3 +253,46 @@ NGRAPH_TEST(${BACKEND_NAME}, send_recv_ring)
     }
 }
 #endif
+
+// MLSL does not support send recv
+#if !defined(NGRAPH_DISTRIBUTED_MLSL_ENABLE)
+NGRAPH_TEST(${BACKEND_NAME}, pipelined_send_recv)
+{
+    auto comm_size = get_distributed_interface()->get_size();
+    // this test only works for 2 nodes
+    if (comm_size != 2)
+    {
+        return;
+    }
+    auto rank = get_distributed_interface()->get_rank();
+    size_t count = 1000;
+    size_t micro_batches = 5;
+    // Small chunks so that each micro-batch takes several messages
+    size_t chunk_bytes = 256;
+    auto expected = [&](size_t micro_batch) {
+        vector<float> values(count);
+        iota(values.begin(), values.end(), static_cast<float>(micro_batch * count));
+        return values;
+    };
+    if (rank == 0)
+    {
+        pipeline::SendChannel channel(element::f32, count, 1, chunk_bytes);
+        for (size_t i = 0; i < micro_batches; i++)
+        {
+            auto values = expected(i);
+            memcpy(channel.get_buffer(), values.data(), count * sizeof(float));
+            channel.send();
+        }
+        channel.flush();
+    }
+    else
+    {
+        pipeline::RecvChannel channel(element::f32, count, 0, micro_batches, chunk_bytes);
+        for (size_t i = 0; i < micro_batches; i++)
+        {
+            auto data = static_cast<const float*>(channel.receive());
+            EXPECT_EQ(expected(i), vector<float>(data, data + count));
+        }
+    }
+}
+#endif
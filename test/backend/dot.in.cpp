@@ -793,3 +793,53 @@ NGRAPH_TEST(${BACKEND_NAME}, dot_3d_one_axis_arbitrary)
                        27,   106, 149, 126, 65,  25,   44,   6,   11,  165,  281,  52}),
         read_vector<float>(result)));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, dot_matrix_across_gemm_blocks)
+{
+    // Large enough to span several row, column and depth tiles of the reference gemm, with
+    // remainders in every dimension.
+    const size_t m = 19;
+    const size_t k = 300;
+    const size_t n = 517;
+    Shape shape_a{m, k};
+    Shape shape_b{k, n};
+    Shape shape_r{m, n};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Small integers keep every partial sum exact in float
+    vector<float> a_data(m * k);
+    vector<float> b_data(k * n);
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = static_cast<float>(static_cast<int>(i % 7) - 3);
+    }
+    for (size_t i = 0; i < b_data.size(); i++)
+    {
+        b_data[i] = static_cast<float>(static_cast<int>(i % 5) - 2);
+    }
+    vector<float> expected(m * n, 0);
+    for (size_t i = 0; i < m; i++)
+    {
+        for (size_t j = 0; j < n; j++)
+        {
+            for (size_t p = 0; p < k; p++)
+            {
+                expected[i * n + j] += a_data[i * k + p] * b_data[p * n + j];
+            }
+        }
+    }
+
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, a_data);
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, b_data);
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(expected, read_vector<float>(result));
+}
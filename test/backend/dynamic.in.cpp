@@ -14,8 +14,11 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <numeric>
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/dynamic/dynamic_backend.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_control.hpp"
 #include "util/test_tools.hpp"
@@ -292,3 +295,155 @@ NGRAPH_TEST(${BACKEND_NAME}, dynamic_reverse_shape)
                         Shape{8, 2, 8, 2},
                         Shape{2, 3, 4, 5, 2}});
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_executable_cache)
+{
+    auto a = make_shared<op::Parameter>(element::f32, PartialShape{2, Dimension::dynamic()});
+    auto b = make_shared<op::Parameter>(element::f32, PartialShape{2, Dimension::dynamic()});
+    auto f = make_shared<Function>(NodeVector{a + b}, ParameterVector{a, b});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+    auto ex = backend->compile(f);
+    auto dynamic_ex = dynamic_pointer_cast<runtime::dynamic::DynamicExecutable>(ex);
+    if (!dynamic_ex)
+    {
+        // Backend supports dynamic shapes natively
+        return;
+    }
+    dynamic_ex->set_cache_capacity(2);
+
+    auto t_r = backend->create_dynamic_tensor(element::f32, PartialShape{2, Dimension::dynamic()});
+    auto run = [&](size_t n) {
+        vector<float> inputs(2 * n);
+        iota(inputs.begin(), inputs.end(), 0.0f);
+        auto t_a = backend->create_tensor(element::f32, Shape{2, n});
+        auto t_b = backend->create_tensor(element::f32, Shape{2, n});
+        copy_data(t_a, inputs);
+        copy_data(t_b, inputs);
+        ex->call_with_validate({t_r}, {t_a, t_b});
+        ASSERT_EQ(t_r->get_shape(), (Shape{2, n}));
+        vector<float> expected(2 * n);
+        for (size_t i = 0; i < 2 * n; i++)
+        {
+            expected[i] = 2.0f * i;
+        }
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(t_r), expected));
+    };
+
+    run(2);
+    run(3);
+    run(2);
+    run(3);
+    EXPECT_EQ(dynamic_ex->get_compilation_count(), 2);
+    EXPECT_EQ(dynamic_ex->get_cache_hit_count(), 2);
+
+    // Shape 2 is the least recently used and is evicted by shape 4
+    run(4);
+    run(3);
+    run(2);
+    EXPECT_EQ(dynamic_ex->get_compilation_count(), 4);
+    EXPECT_EQ(dynamic_ex->get_cache_hit_count(), 3);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_executable_bucketing)
+{
+    // x * mask over a {2, ?} sequence; padding the mask with zeros zeroes the padded positions
+    auto x = make_shared<op::Parameter>(element::f32, PartialShape{2, Dimension::dynamic()});
+    auto mask = make_shared<op::Parameter>(element::f32, PartialShape{2, Dimension::dynamic()});
+    auto f = make_shared<Function>(NodeVector{x * mask}, ParameterVector{x, mask});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+    auto ex = backend->compile(f);
+    auto dynamic_ex = dynamic_pointer_cast<runtime::dynamic::DynamicExecutable>(ex);
+    if (!dynamic_ex)
+    {
+        return;
+    }
+    runtime::dynamic::DynamicExecutable::BucketingPolicy policy;
+    policy.buckets = {4, 8};
+    policy.input_axes = {{0, 1}, {1, 1}};
+    policy.output_axes = {{0, 1}};
+    dynamic_ex->set_bucketing_policy(policy);
+
+    auto t_r = backend->create_dynamic_tensor(element::f32, PartialShape{2, Dimension::dynamic()});
+    for (size_t n = 1; n <= 10; n++)
+    {
+        vector<float> inputs(2 * n);
+        iota(inputs.begin(), inputs.end(), 1.0f);
+        auto t_x = backend->create_tensor(element::f32, Shape{2, n});
+        auto t_mask = backend->create_tensor(element::f32, Shape{2, n});
+        copy_data(t_x, inputs);
+        copy_data(t_mask, vector<float>(2 * n, 2.0f));
+        ex->call_with_validate({t_r}, {t_x, t_mask});
+        ASSERT_EQ(t_r->get_shape(), (Shape{2, n}));
+        vector<float> expected(2 * n);
+        for (size_t i = 0; i < 2 * n; i++)
+        {
+            expected[i] = 2.0f * (i + 1);
+        }
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(t_r), expected));
+    }
+
+    // Lengths 1-4 and 5-8 share a bucket; 9 and 10 are above the largest bucket
+    EXPECT_EQ(dynamic_ex->get_compilation_count(), 4);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_executable_bucketing_upper_bounds)
+{
+    // x * mask over a {?, ?} batch of sequences, with both axes bounded
+    auto x = make_shared<op::Parameter>(element::f32, PartialShape::dynamic(2));
+    auto mask = make_shared<op::Parameter>(element::f32, PartialShape::dynamic(2));
+    auto f = make_shared<Function>(NodeVector{x * mask}, ParameterVector{x, mask});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+    auto ex = backend->compile(f);
+    auto dynamic_ex = dynamic_pointer_cast<runtime::dynamic::DynamicExecutable>(ex);
+    if (!dynamic_ex)
+    {
+        return;
+    }
+    runtime::dynamic::DynamicExecutable::BucketingPolicy batch_policy;
+    batch_policy.buckets = {3};
+    batch_policy.input_axes = {{0, 0}, {1, 0}};
+    batch_policy.output_axes = {{0, 0}};
+    batch_policy.bounded = true;
+    dynamic_ex->set_bucketing_policy(batch_policy);
+    auto sequence_policy = batch_policy;
+    sequence_policy.buckets = {6};
+    sequence_policy.input_axes = {{0, 1}, {1, 1}};
+    sequence_policy.output_axes = {{0, 1}};
+    dynamic_ex->add_bucketing_policy(sequence_policy);
+
+    auto t_r = backend->create_dynamic_tensor(element::f32, PartialShape::dynamic(2));
+    auto run = [&](size_t batch, size_t length) {
+        Shape shape{batch, length};
+        vector<float> inputs(shape_size(shape));
+        iota(inputs.begin(), inputs.end(), 1.0f);
+        auto t_x = backend->create_tensor(element::f32, shape);
+        auto t_mask = backend->create_tensor(element::f32, shape);
+        copy_data(t_x, inputs);
+        copy_data(t_mask, vector<float>(inputs.size(), 2.0f));
+        ex->call_with_validate({t_r}, {t_x, t_mask});
+        ASSERT_EQ(t_r->get_shape(), shape);
+        vector<float> expected(inputs.size());
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            expected[i] = 2.0f * inputs[i];
+        }
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(t_r), expected));
+    };
+
+    for (size_t batch = 1; batch <= 3; batch++)
+    {
+        for (size_t length = 1; length <= 6; length++)
+        {
+            run(batch, length);
+        }
+    }
+    // Every shape runs on the clone compiled for the bounds
+    EXPECT_EQ(dynamic_ex->get_compilation_count(), 1);
+    EXPECT_ANY_THROW(run(4, 2));
+    // The sequence policy is not bounded, so longer sequences are compiled exactly
+    run(2, 7);
+    EXPECT_EQ(dynamic_ex->get_compilation_count(), 2);
+}
@@ -603,6 +603,30 @@ NGRAPH_TEST(${BACKEND_NAME}, gather_nd_batch_2d_from_3d)
                                   MIN_FLOAT_TOLERANCE_BITS));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, gather_nd_batch_1d_from_2d_int8)
+{
+    Shape params_shape{3, 2};
+    Shape indices_shape{2, 1};
+    Shape out_shape{2, 2};
+    auto P = make_shared<op::Parameter>(element::i8, params_shape);
+    auto I = make_shared<op::Parameter>(element::i64, indices_shape);
+    auto G = make_shared<op::GatherND>(P, I);
+    auto f = make_shared<Function>(G, ParameterVector{P, I});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto p = backend->create_tensor(element::i8, params_shape);
+    copy_data(p, vector<int8_t>{10, 11, 20, 21, 30, 31});
+    auto i = backend->create_tensor(element::i64, indices_shape);
+    copy_data(i, vector<int64_t>{2, -3});
+    auto result = backend->create_tensor(element::i8, out_shape);
+
+    auto c = backend->compile(f);
+    c->call_with_validate({result}, {p, i});
+    EXPECT_EQ((vector<int8_t>{30, 31, 10, 11}), read_vector<int8_t>(result));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, gather_no_axis_int8)
 {
     Shape params_shape{3, 2};
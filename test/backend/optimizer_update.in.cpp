@@ -0,0 +1,117 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// clang-format off
+#ifdef ${BACKEND_NAME}_FLOAT_TOLERANCE_BITS
+#define DEFAULT_FLOAT_TOLERANCE_BITS ${BACKEND_NAME}_FLOAT_TOLERANCE_BITS
+#endif
+
+#ifdef ${BACKEND_NAME}_DOUBLE_TOLERANCE_BITS
+#define DEFAULT_DOUBLE_TOLERANCE_BITS ${BACKEND_NAME}_DOUBLE_TOLERANCE_BITS
+#endif
+// clang-format on
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close.hpp"
+#include "util/all_close_f.hpp"
+#include "util/ndarray.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+static void sgd_momentum_update_test(const string& backend_name,
+                                     bool nesterov,
+                                     const vector<float>& expected_param)
+{
+    Shape shape{4};
+    auto param = make_shared<op::Parameter>(element::f32, shape);
+    auto grad = make_shared<op::Parameter>(element::f32, shape);
+    auto velocity = make_shared<op::Parameter>(element::f32, shape);
+    auto lr = make_shared<op::Parameter>(element::f32, Shape{});
+    auto update = make_shared<op::SGDMomentumUpdate>(param, grad, velocity, lr, 0.9, nesterov);
+    auto f = make_shared<Function>(update->outputs(), ParameterVector{param, grad, velocity, lr});
+
+    auto backend = runtime::Backend::create(backend_name);
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{0.5f, -1, 2, 0});
+    auto c = backend->create_tensor(element::f32, shape);
+    copy_data(c, vector<float>{0.1f, 0.2f, -0.3f, 0.4f});
+    auto d = backend->create_tensor(element::f32, Shape{});
+    copy_data(d, vector<float>{0.1f});
+    auto param_out = backend->create_tensor(element::f32, shape);
+    auto velocity_out = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({param_out, velocity_out}, {a, b, c, d});
+    EXPECT_TRUE(test::all_close_f(expected_param, read_vector<float>(param_out)));
+    EXPECT_TRUE(test::all_close_f(vector<float>{0.59f, -0.82f, 1.73f, 0.36f},
+                                  read_vector<float>(velocity_out)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, sgd_momentum_update)
+{
+    sgd_momentum_update_test(
+        "${BACKEND_NAME}", false, vector<float>{0.941f, 2.082f, 2.827f, 3.964f});
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, sgd_momentum_update_nesterov)
+{
+    sgd_momentum_update_test(
+        "${BACKEND_NAME}", true, vector<float>{0.8969f, 2.1738f, 2.6443f, 3.9676f});
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, adam_update)
+{
+    Shape shape{4};
+    auto param = make_shared<op::Parameter>(element::f32, shape);
+    auto grad = make_shared<op::Parameter>(element::f32, shape);
+    auto m = make_shared<op::Parameter>(element::f32, shape);
+    auto v = make_shared<op::Parameter>(element::f32, shape);
+    auto lr = make_shared<op::Parameter>(element::f32, Shape{});
+    auto update = make_shared<op::AdamUpdate>(param, grad, m, v, lr);
+    auto f = make_shared<Function>(update->outputs(), ParameterVector{param, grad, m, v, lr});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{0.5f, -1, 2, 0});
+    auto c = backend->create_tensor(element::f32, shape);
+    copy_data(c, vector<float>{0.1f, 0.2f, -0.3f, 0.4f});
+    auto d = backend->create_tensor(element::f32, shape);
+    copy_data(d, vector<float>{0.01f, 0.04f, 0.09f, 0.16f});
+    auto e = backend->create_tensor(element::f32, Shape{});
+    copy_data(e, vector<float>{0.01f});
+    auto param_out = backend->create_tensor(element::f32, shape);
+    auto m_out = backend->create_tensor(element::f32, shape);
+    auto v_out = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({param_out, m_out, v_out}, {a, b, c, d, e});
+    EXPECT_TRUE(test::all_close_f(vector<float>{0.98616504f, 1.99604715f, 3.00228424f, 3.9909955f},
+                                  read_vector<float>(param_out)));
+    EXPECT_TRUE(
+        test::all_close_f(vector<float>{0.14f, 0.08f, -0.07f, 0.36f}, read_vector<float>(m_out)));
+    EXPECT_TRUE(test::all_close_f(vector<float>{0.01024f, 0.04096f, 0.09391f, 0.15984f},
+                                  read_vector<float>(v_out)));
+}
@@ -113,3 +113,71 @@ NGRAPH_TEST(${BACKEND_NAME}, quantized_dot_int32_output)
     handle->call_with_validate({result}, {a, b});
     EXPECT_EQ((vector<int32_t>{9, 14, 19}), read_vector<int32_t>(result));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, quantized_dot_3d_zero_points)
+{
+    // k and n are not multiples of the 4 x 16 blocks of a VNNI GEMM
+    Shape shape_a{2, 3, 7};
+    Shape shape_b{7, 19};
+    Shape shape_r{2, 3, 19};
+    vector<uint8_t> a_data(shape_size(shape_a));
+    vector<int8_t> b_data(shape_size(shape_b));
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = static_cast<uint8_t>((i * 37) % 251);
+    }
+    for (size_t i = 0; i < b_data.size(); i++)
+    {
+        b_data[i] = static_cast<int8_t>((i * 53) % 255 - 127);
+    }
+    uint8_t a_zero = 3;
+    int8_t b_zero = -2;
+    vector<int32_t> expected(shape_size(shape_r));
+    for (size_t i = 0; i < 6; i++)
+    {
+        for (size_t j = 0; j < 19; j++)
+        {
+            int32_t sum = 0;
+            for (size_t k = 0; k < 7; k++)
+            {
+                sum += (a_data[i * 7 + k] - a_zero) * (b_data[k * 19 + j] - b_zero);
+            }
+            expected[i * 19 + j] = sum;
+        }
+    }
+
+    auto A = make_shared<op::Parameter>(element::u8, shape_a);
+    auto B = make_shared<op::Parameter>(element::i8, shape_b);
+    auto input_scale = op::Constant::create(element::f32, Shape{}, {1});
+    auto input_zero_point = op::Constant::create(element::u8, Shape{}, {a_zero});
+    auto filter_scale = op::Constant::create(element::f32, Shape{}, {1});
+    auto filter_zero_point = op::Constant::create(element::i8, Shape{}, {b_zero});
+    auto output_scale = op::Constant::create(element::f32, Shape{}, {1});
+    auto output_zero_point = op::Constant::create(element::i32, Shape{}, {0});
+    AxisSet axes{};
+
+    auto QD = make_shared<op::QuantizedDot>(A,
+                                            B,
+                                            1,
+                                            input_scale,
+                                            input_zero_point,
+                                            filter_scale,
+                                            filter_zero_point,
+                                            output_scale,
+                                            output_zero_point,
+                                            element::i32,
+                                            axes,
+                                            axes,
+                                            axes);
+    auto f = make_shared<Function>(NodeVector{QD}, ParameterVector{A, B});
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::u8, shape_a);
+    copy_data(a, a_data);
+    auto b = backend->create_tensor(element::i8, shape_b);
+    copy_data(b, b_data);
+    auto result = backend->create_tensor(element::i32, shape_r);
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(expected, read_vector<int32_t>(result));
+}
@@ -284,3 +284,33 @@ NGRAPH_TEST(${BACKEND_NAME}, scatter_nd_add_2d_to_3d)
                                   read_vector<float>(result),
                                   MIN_FLOAT_TOLERANCE_BITS));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, scatter_nd_batch_1d_to_2d)
+{
+    Shape ref_shape{3, 3};
+    Shape indices_shape{2, 1};
+    Shape updates_shape{2, 3};
+    Shape out_shape{3, 3};
+    auto R = make_shared<op::Parameter>(element::f32, ref_shape);
+    auto I = make_shared<op::Parameter>(element::i64, indices_shape);
+    auto U = make_shared<op::Parameter>(element::f32, updates_shape);
+    auto G = make_shared<op::ScatterND>(R, I, U);
+    auto f = make_shared<Function>(G, ParameterVector{R, I, U});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto r = backend->create_tensor(element::f32, ref_shape);
+    copy_data(r, vector<float>{1, 1, 1, 2, 2, 2, 3, 3, 3});
+    auto i = backend->create_tensor(element::i64, indices_shape);
+    copy_data(i, vector<int64_t>{2, 0});
+    auto u = backend->create_tensor(element::f32, updates_shape);
+    copy_data(u, vector<float>{7, 8, 9, 4, 5, 6});
+    auto result = backend->create_tensor(element::f32, out_shape);
+
+    auto c = backend->compile(f);
+    c->call_with_validate({result}, {r, i, u});
+    EXPECT_TRUE(test::all_close_f((vector<float>{4, 5, 6, 2, 2, 2, 7, 8, 9}),
+                                  read_vector<float>(result),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+}
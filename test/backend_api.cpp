@@ -15,10 +15,16 @@
 //*****************************************************************************
 
 #include "gtest/gtest.h"
+#include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/backend_manager.hpp"
+#include "ngraph/runtime/compile_cache.hpp"
+#include "ngraph/runtime/constant_store.hpp"
+#include "ngraph/runtime/tensor_pool.hpp"
 #include "ngraph/util.hpp"
 #include "util/all_close_f.hpp"
+#include "util/random.hpp"
 #include "util/test_tools.hpp"
 
 using namespace std;
@@ -37,6 +43,14 @@ TEST(backend_api, invalid_name)
     ASSERT_ANY_THROW(ngraph::runtime::Backend::create("COMPLETELY-BOGUS-NAME"));
 }
 
+TEST(backend_api, preload)
+{
+    runtime::BackendManager::preload_backends({"INTERPRETER", "COMPLETELY-BOGUS-NAME"});
+    auto backend = runtime::Backend::create("INTERPRETER");
+    EXPECT_NE(backend, nullptr);
+    ASSERT_ANY_THROW(ngraph::runtime::Backend::create("COMPLETELY-BOGUS-NAME"));
+}
+
 TEST(backend_api, config)
 {
     auto backend = runtime::Backend::create("INTERPRETER");
@@ -59,6 +73,43 @@ TEST(backend_api, config_unsupported)
     EXPECT_FALSE(error == "");
 }
 
+TEST(backend_api, nop_cost_estimate)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{64, 128});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{128, 32});
+    auto C = make_shared<op::Parameter>(element::f32, Shape{64, 32});
+    auto dot = make_shared<op::Dot>(A, B);
+    auto f = make_shared<Function>(make_shared<op::Add>(dot, C), ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("NOP");
+    string error;
+    ASSERT_TRUE(backend->set_config({{"peak_gflops", "100"}, {"peak_gbps", "10"}}, error));
+    EXPECT_FALSE(backend->set_config({{"peak_gbps", "fast"}}, error));
+    EXPECT_FALSE(error == "");
+
+    auto exec = backend->compile(f);
+    auto perf = exec->get_performance_data();
+    ASSERT_EQ(perf.size(), 2);
+    for (auto& counter : perf)
+    {
+        if (counter.get_node() == dot)
+        {
+            // 2 * 64 * 32 * 128 flops take 5.2us and 4 * (64 * 128 + 128 * 32 + 64 * 32)
+            // bytes take 5.7us, so the Dot is memory bound
+            EXPECT_EQ(counter.flops(), 2 * 64 * 32 * 128);
+            EXPECT_EQ(counter.total_microseconds(), 6);
+        }
+        else
+        {
+            EXPECT_EQ(counter.flops(), 64 * 32);
+        }
+    }
+    // The output of the Dot is the only intermediate tensor
+    EXPECT_EQ(f->get_temporary_pool_size(), 64 * 32 * 4);
+
+    ASSERT_EQ(exec->call({}, {}), true);
+}
+
 #ifndef NGRAPH_JSON_DISABLE
 TEST(backend_api, save_load)
 {
@@ -89,8 +140,267 @@ TEST(backend_api, save_load)
         EXPECT_TRUE(test::all_close_f(read_vector<float>(result), {6.f, 8.f, 10.f, 12.f}));
     }
 }
+
+TEST(backend_api, compile_cache)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    string dir = file_util::path_join(file_util::get_temp_directory_path(), "ngraph_cache_test");
+    file_util::remove_directory(dir);
+    runtime::CompileCache cache(dir);
+    ASSERT_TRUE(cache.is_enabled());
+
+    string key = cache.get_key(f, "INTERPRETER");
+    ASSERT_FALSE(key.empty());
+    EXPECT_EQ(key, cache.get_key(f, "INTERPRETER"));
+    EXPECT_NE(key, cache.get_key(f, "INTERPRETER;other"));
+    EXPECT_EQ(cache.load(key, *backend), nullptr);
+
+    cache.store(key, *backend->compile(f));
+    auto handle = cache.load(key, *backend);
+    ASSERT_NE(handle, nullptr);
+
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> result = backend->create_tensor(element::f32, shape);
+    copy_data<float>(a, {1.f, 2.f, 3.f, 4.f});
+    copy_data<float>(b, {5.f, 6.f, 7.f, 8.f});
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), {6.f, 8.f, 10.f, 12.f}));
+    file_util::remove_directory(dir);
+}
 #endif
 
+TEST(backend_api, constant_store_shares_data)
+{
+    // 128 KiB of weights, above the default interning threshold
+    Shape shape{128, 256};
+    vector<float> weights(shape_size(shape));
+    for (size_t i = 0; i < weights.size(); i++)
+    {
+        weights[i] = static_cast<float>(i % 7);
+    }
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto W = op::Constant::create(element::f32, shape, weights);
+        return make_shared<Function>(make_shared<op::Add>(A, W), ParameterVector{A});
+    };
+
+    auto& store = runtime::ConstantStore::get();
+    auto backend = runtime::Backend::create("INTERPRETER");
+    size_t hits = store.get_hits();
+    auto exec1 = backend->compile(make_function());
+    auto exec2 = backend->compile(make_function());
+    EXPECT_GT(store.get_hits(), hits);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>(weights.size(), 1.f));
+    vector<float> expected(weights.size());
+    for (size_t i = 0; i < weights.size(); i++)
+    {
+        expected[i] = weights[i] + 1.f;
+    }
+    for (auto exec : {exec1, exec2})
+    {
+        auto result = backend->create_tensor(element::f32, shape);
+        exec->call_with_validate({result}, {a});
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(result), expected));
+    }
+}
+
+TEST(backend_api, interpreter_threads)
+{
+    // Large enough for every kernel here to be split across the threads
+    auto A = make_shared<op::Parameter>(element::f32, Shape{64, 128});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{128, 96});
+    auto C = make_shared<op::Parameter>(element::f32, Shape{256, 256});
+    auto D = make_shared<op::Parameter>(element::f32, Shape{8, 3, 16, 16});
+    auto F = make_shared<op::Parameter>(element::f32, Shape{4, 3, 3, 3});
+    auto dot = make_shared<op::Dot>(A, B);
+    auto exp = make_shared<op::Exp>(make_shared<op::Divide>(C, C));
+    auto sum = make_shared<op::Sum>(make_shared<op::Multiply>(exp, C), AxisSet{1});
+    auto conv = make_shared<op::Convolution>(D, F);
+    auto pool = make_shared<op::MaxPool>(conv, Shape{2, 2});
+    auto f = make_shared<Function>(NodeVector{dot, sum, pool}, ParameterVector{A, B, C, D, F});
+
+    auto run = [&](const string& threads) {
+        auto backend = runtime::Backend::create("INTERPRETER");
+        string error;
+        EXPECT_TRUE(backend->set_config({{"threads", threads}}, error)) << error;
+        test::Uniform<float> rng(-1.0f, 1.0f);
+        vector<shared_ptr<runtime::Tensor>> inputs;
+        for (auto& param : f->get_parameters())
+        {
+            auto tensor = backend->create_tensor(element::f32, param->get_shape());
+            vector<float> values(shape_size(param->get_shape()));
+            rng.initialize(values);
+            copy_data(tensor, values);
+            inputs.push_back(tensor);
+        }
+        vector<shared_ptr<runtime::Tensor>> outputs;
+        for (auto& result : f->get_results())
+        {
+            outputs.push_back(backend->create_tensor(element::f32, result->get_shape()));
+        }
+        backend->compile(f)->call_with_validate(outputs, inputs);
+        vector<vector<float>> values;
+        for (auto& output : outputs)
+        {
+            values.push_back(read_vector<float>(output));
+        }
+        return values;
+    };
+
+    auto expected = run("1");
+    auto actual = run("4");
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close_f(expected[i], actual[i]));
+    }
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    string error;
+    EXPECT_FALSE(backend->set_config({{"threads", "0"}}, error));
+    EXPECT_FALSE(error.empty());
+}
+
+TEST(backend_api, interpreter_call_plan)
+{
+    // One value feeding two results, a parameter and a constant as results, and an
+    // elementwise chain that runs in place
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto k = op::Constant::create(element::f32, shape, {1, 1, 1, 1, 1, 1});
+    auto sum = make_shared<op::Add>(A, B);
+    auto product = make_shared<op::Multiply>(make_shared<op::Negative>(sum), k);
+    auto f = make_shared<Function>(NodeVector{product, product, A, k}, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto handle = backend->compile(f);
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto run = [&](const vector<shared_ptr<runtime::Tensor>>& outputs, float offset) {
+        copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+        copy_data(b, vector<float>{offset, offset, offset, offset, offset, offset});
+        handle->call_with_validate(outputs, {a, b});
+        vector<float> expected{-1 - offset,
+                               -2 - offset,
+                               -3 - offset,
+                               -4 - offset,
+                               -5 - offset,
+                               -6 - offset};
+        EXPECT_EQ(read_vector<float>(outputs[0]), expected);
+        EXPECT_EQ(read_vector<float>(outputs[1]), expected);
+    };
+
+    // Repeated calls, with fresh output tensors and with an output that is also an input
+    vector<shared_ptr<runtime::Tensor>> outputs;
+    for (size_t i = 0; i < 4; i++)
+    {
+        outputs.push_back(backend->create_tensor(element::f32, shape));
+    }
+    run(outputs, 10);
+    EXPECT_EQ(read_vector<float>(outputs[2]), (vector<float>{1, 2, 3, 4, 5, 6}));
+    EXPECT_EQ(read_vector<float>(outputs[3]), (vector<float>{1, 1, 1, 1, 1, 1}));
+    outputs[0] = backend->create_tensor(element::f32, shape);
+    run(outputs, 20);
+    auto c = backend->create_tensor(element::f32, shape);
+    run({b, c, outputs[2], outputs[3]}, 30);
+}
+
+TEST(backend_api, tensor_pool)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto pool = backend->get_tensor_pool();
+    EXPECT_EQ(backend->get_tensor_pool(), pool);
+
+    runtime::Tensor* first;
+    {
+        auto a = pool->checkout(element::f32, Shape{2, 3});
+        first = a.get();
+        EXPECT_EQ(a->get_shape(), (Shape{2, 3}));
+        EXPECT_EQ(pool->get_statistics().cached_tensors, 0);
+    }
+    auto stats = pool->get_statistics();
+    EXPECT_EQ(stats.cached_tensors, 1);
+    EXPECT_EQ(stats.cached_bytes, 6 * sizeof(float));
+
+    // Only a tensor of the same type and shape is reused
+    auto b = pool->checkout(element::f32, Shape{3, 2});
+    auto c = pool->checkout(element::i32, Shape{2, 3});
+    auto d = pool->checkout(element::f32, Shape{2, 3});
+    EXPECT_NE(b.get(), first);
+    EXPECT_NE(c.get(), first);
+    EXPECT_EQ(d.get(), first);
+    stats = pool->get_statistics();
+    EXPECT_EQ(stats.checkouts, 4);
+    EXPECT_EQ(stats.reuses, 1);
+    EXPECT_EQ(stats.cached_tensors, 0);
+
+    // Tensors returned beyond the limits are freed
+    pool->set_limits(1, SIZE_MAX);
+    auto e = pool->checkout(element::f32, Shape{2, 3});
+    d = nullptr;
+    e = nullptr;
+    EXPECT_EQ(pool->get_statistics().cached_tensors, 1);
+    pool->set_limits(16, 4 * sizeof(float));
+    EXPECT_EQ(pool->get_statistics().cached_tensors, 0);
+    b = nullptr;
+    EXPECT_EQ(pool->get_statistics().cached_tensors, 0);
+    pool->set_limits(16, SIZE_MAX);
+
+    // Executable inputs and outputs, returned after the pool is cleared
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto f = make_shared<Function>(make_shared<op::Negative>(A), ParameterVector{A});
+    auto exec = backend->compile(f);
+    for (int i = 0; i < 3; i++)
+    {
+        auto input = pool->checkout_input(*exec, 0);
+        auto output = pool->checkout_output(*exec, 0);
+        copy_data(input, vector<float>{1, 2, 3, float(i)});
+        exec->call_with_validate({output}, {input});
+        EXPECT_EQ(read_vector<float>(output), (vector<float>{-1, -2, -3, float(-i)}));
+    }
+    EXPECT_EQ(pool->get_statistics().cached_tensors, 2);
+    EXPECT_EQ(pool->get_statistics().reuses, 5);
+    pool->clear();
+    EXPECT_EQ(pool->get_statistics().cached_tensors, 0);
+    EXPECT_EQ(pool->get_statistics().cached_bytes, 0);
+    c = nullptr;
+    EXPECT_EQ(pool->get_statistics().cached_tensors, 1);
+}
+
+TEST(backend_api, compile_async)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    Shape shape{3};
+    vector<shared_ptr<Function>> functions;
+    vector<future<shared_ptr<runtime::Executable>>> compiles;
+    for (size_t i = 0; i < 4; i++)
+    {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto scale = op::Constant::create(element::f32, shape, {float(i), float(i), float(i)});
+        functions.push_back(
+            make_shared<Function>(make_shared<op::Multiply>(A, scale), ParameterVector{A}));
+        compiles.push_back(backend->compile_async(functions.back()));
+    }
+    for (size_t i = 0; i < compiles.size(); i++)
+    {
+        auto exec = compiles[i].get();
+        auto a = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{1, 2, 3});
+        exec->call_with_validate({result}, {a});
+        EXPECT_EQ(read_vector<float>(result), (vector<float>{1.0f * i, 2.0f * i, 3.0f * i}));
+    }
+}
+
 #if defined(NGRAPH_INTERPRETER_ENABLE) && defined(NGRAPH_CPU_ENABLE)
 TEST(backend_api, executable_can_create_tensor)
 {
@@ -0,0 +1,139 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/broadcast_folding.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(broadcast_folding, leading_axes)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3, 4});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto broadcast = make_shared<op::Broadcast>(b, Shape{2, 3, 4}, AxisSet{0, 1});
+    auto add = make_shared<op::Add>(broadcast, a);
+    auto f = make_shared<Function>(add, ParameterVector{a, b});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::BroadcastFolding>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::Broadcast>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Reshape>(f), 0);
+    EXPECT_EQ(add->get_argument(0), b);
+    EXPECT_EQ(add->get_autob().m_type, op::AutoBroadcastType::NUMPY);
+    EXPECT_EQ(add->get_shape(), (Shape{2, 3, 4}));
+}
+
+TEST(broadcast_folding, inner_axes)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3, 4});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto multiply = make_shared<op::Multiply>(
+        a, make_shared<op::Broadcast>(b, Shape{2, 3, 4}, AxisSet{0, 2}));
+    auto f = make_shared<Function>(multiply, ParameterVector{a, b});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::BroadcastFolding>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::Broadcast>(f), 0);
+    EXPECT_EQ(multiply->get_input_shape(1), (Shape{3, 1}));
+    EXPECT_EQ(multiply->get_shape(), (Shape{2, 3, 4}));
+}
+
+TEST(broadcast_folding, keeps_axis_broadcast_by_both_inputs)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto add = make_shared<op::Add>(make_shared<op::Broadcast>(a, Shape{3, 4}, AxisSet{0}),
+                                    make_shared<op::Broadcast>(b, Shape{3, 4}, AxisSet{0}));
+    auto f = make_shared<Function>(add, ParameterVector{a, b});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::BroadcastFolding>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::Broadcast>(f), 1);
+    EXPECT_EQ(add->get_argument(0), a);
+    EXPECT_EQ(add->get_shape(), (Shape{3, 4}));
+}
+
+TEST(broadcast_folding, unsupported_op)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto add = make_shared<op::Add>(a, make_shared<op::Broadcast>(b, Shape{3, 4}, AxisSet{0}));
+    auto f = make_shared<Function>(add, ParameterVector{a, b});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::BroadcastFolding>([](const Node&) { return false; });
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::Broadcast>(f), 1);
+    EXPECT_EQ(add->get_autob().m_type, op::AutoBroadcastType::NONE);
+}
+
+#if defined(NGRAPH_INTERPRETER_ENABLE)
+TEST(broadcast_folding, interpreter_results)
+{
+    Shape shape{2, 3, 4};
+    auto a = make_shared<op::Parameter>(element::f32, shape);
+    auto b = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto c = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto b_broadcast = make_shared<op::Broadcast>(b, shape, AxisSet{0, 2});
+    auto product = make_shared<op::Multiply>(a, b_broadcast);
+    auto sum = make_shared<op::Add>(make_shared<op::Broadcast>(c, shape, AxisSet{0, 1}), product);
+    auto f = make_shared<Function>(sum, ParameterVector{a, b, c});
+
+    vector<float> a_data(shape_size(shape));
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = static_cast<float>(i);
+    }
+    vector<float> b_data{1, 2, 3};
+    vector<float> c_data{10, 20, 30, 40};
+    vector<float> expected;
+    for (size_t i = 0; i < 2; i++)
+    {
+        for (size_t j = 0; j < 3; j++)
+        {
+            for (size_t k = 0; k < 4; k++)
+            {
+                expected.push_back(a_data[(i * 3 + j) * 4 + k] * b_data[j] + c_data[k]);
+            }
+        }
+    }
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto a_tensor = backend->create_tensor(element::f32, shape);
+    copy_data(a_tensor, a_data);
+    auto b_tensor = backend->create_tensor(element::f32, Shape{3});
+    copy_data(b_tensor, b_data);
+    auto c_tensor = backend->create_tensor(element::f32, Shape{4});
+    copy_data(c_tensor, c_data);
+    auto result = backend->create_tensor(element::f32, shape);
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a_tensor, b_tensor, c_tensor});
+    EXPECT_EQ(read_vector<float>(result), expected);
+}
+#endif
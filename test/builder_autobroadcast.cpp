@@ -234,3 +234,24 @@ TEST(autobroadcast, make_node_3_args)
         ngraph::builder::make_with_numpy_broadcast<ngraph::op::Select>(predicates, lhs, rhs);
     EXPECT_NE(op, nullptr);
 }
+
+TEST(autobroadcast, make_node_2_args_implicit)
+{
+    ngraph::Shape s21{2, 1};
+    ngraph::Shape s3{3};
+    auto lhs = getParamFromShape(s21);
+    auto rhs = getParamFromShape(s3);
+
+    auto op = ngraph::builder::make_with_numpy_broadcast<ngraph::op::Add>(lhs, rhs);
+    EXPECT_EQ(op->get_autob(), ngraph::op::AutoBroadcastSpec::NUMPY);
+    EXPECT_EQ(op->get_argument(0), lhs);
+    EXPECT_EQ(op->get_argument(1), rhs);
+    EXPECT_EQ(op->get_shape(), (ngraph::Shape{2, 3}));
+
+    auto same = ngraph::builder::make_with_numpy_broadcast<ngraph::op::Add>(rhs, rhs);
+    EXPECT_EQ(same->get_autob(), ngraph::op::AutoBroadcastSpec::NONE);
+
+    EXPECT_THROW(ngraph::builder::make_with_numpy_broadcast<ngraph::op::Add>(
+                     getParamFromShape(ngraph::Shape{2, 4}), rhs),
+                 ngraph::builder::autobroadcast_incompatible_shapes);
+}
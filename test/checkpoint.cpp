@@ -0,0 +1,92 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/checkpoint.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/state/uniform_rng_state.hpp"
+
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(checkpoint, save_and_load)
+{
+    string path = file_util::path_join(file_util::get_temp_directory_path(), "checkpoint_test");
+    auto weights = make_shared<runtime::HostTensor>(element::f32, Shape{2, 3});
+    auto step = make_shared<runtime::HostTensor>(element::i64, Shape{});
+    vector<float> weights_data{1.0f, -2.0f, 3.5f, 0.0f, 1e-3f, 42.0f};
+    copy_data(weights, weights_data);
+    copy_data(step, vector<int64_t>{1000});
+    auto rng = make_shared<UniformRNGState>(7);
+    rng->get_generator()();
+    rng->reserve(12);
+
+    runtime::CheckpointWriter writer;
+    auto written = writer.save(path, {{"weights", weights}, {"step", step}}, {{"rng", rng}});
+    // The checkpoint holds the values at the time of the call
+    copy_data(weights, vector<float>(6, 0.0f));
+    auto next_value = rng->get_generator()();
+    auto next_offset = rng->reserve(1);
+    written.get();
+
+    auto loaded_weights = make_shared<runtime::HostTensor>(element::f32, Shape{2, 3});
+    auto loaded_step = make_shared<runtime::HostTensor>(element::i64, Shape{});
+    auto loaded_rng = make_shared<UniformRNGState>(1);
+    runtime::load_checkpoint(
+        path, {{"weights", loaded_weights}, {"step", loaded_step}}, {{"rng", loaded_rng}});
+    EXPECT_EQ(read_vector<float>(loaded_weights), weights_data);
+    EXPECT_EQ(read_vector<int64_t>(loaded_step), vector<int64_t>{1000});
+    EXPECT_EQ(loaded_rng->get_generator()(), next_value);
+    EXPECT_EQ(loaded_rng->reserve(1), next_offset);
+    EXPECT_EQ(loaded_rng->get_philox().at(5), rng->get_philox().at(5));
+
+    // Entries missing from the checkpoint or of another size
+    auto other = make_shared<runtime::HostTensor>(element::f32, Shape{2, 3});
+    EXPECT_THROW(runtime::load_checkpoint(path, {{"bias", other}}), ngraph_error);
+    EXPECT_THROW(runtime::load_checkpoint(path, {{"step", other}}), ngraph_error);
+    file_util::remove_file(path);
+}
+
+TEST(checkpoint, overlapping_saves)
+{
+    auto tensor = make_shared<runtime::HostTensor>(element::i32, Shape{1024});
+    runtime::CheckpointWriter writer;
+    vector<string> paths;
+    for (int i = 0; i < 5; i++)
+    {
+        paths.push_back(file_util::path_join(file_util::get_temp_directory_path(),
+                                             "checkpoint_test_" + to_string(i)));
+        copy_data(tensor, vector<int32_t>(1024, i));
+        writer.save(paths.back(), {{"tensor", tensor}});
+    }
+    writer.wait();
+
+    for (int i = 0; i < 5; i++)
+    {
+        auto loaded = make_shared<runtime::HostTensor>(element::i32, Shape{1024});
+        runtime::load_checkpoint(paths[i], {{"tensor", loaded}});
+        EXPECT_EQ(read_vector<int32_t>(loaded), vector<int32_t>(1024, i));
+        file_util::remove_file(paths[i]);
+    }
+}
@@ -102,6 +102,8 @@ TEST(constant_folding, constant_reshape)
     auto values_out = new_const->get_vector<float>();
 
     ASSERT_TRUE(test::all_close_f(values_in, values_out, MIN_FLOAT_TOLERANCE_BITS));
+    // A reshape that keeps the element order shares the data instead of copying it
+    ASSERT_EQ(new_const->get_data_ptr(), constant->get_data_ptr());
 }
 
 TEST(constant_folding, constant_reshape_permute)
@@ -129,6 +131,46 @@ TEST(constant_folding, constant_reshape_permute)
     ASSERT_TRUE(test::all_close_f(values_permute, values_out, MIN_FLOAT_TOLERANCE_BITS));
 }
 
+TEST(constant_folding, constant_reshape_permute_nchw_to_nhwc)
+{
+    // Spatial sizes that are not multiples of the transpose tile
+    Shape shape_in{2, 3, 37, 19};
+    Shape shape_out{2, 37, 19, 3};
+
+    vector<int> values_in(shape_size(shape_in));
+    iota(values_in.begin(), values_in.end(), 0);
+    auto constant = make_shared<op::Constant>(element::i32, shape_in, values_in);
+    auto reshape = make_shared<op::Reshape>(constant, AxisVector{0, 2, 3, 1}, shape_out);
+    auto f = make_shared<Function>(reshape, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Reshape>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+
+    auto new_const = as_type_ptr<op::Constant>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(new_const);
+    auto values_out = new_const->get_vector<int>();
+
+    vector<int> values_permute;
+    for (size_t n = 0; n < 2; n++)
+    {
+        for (size_t h = 0; h < 37; h++)
+        {
+            for (size_t w = 0; w < 19; w++)
+            {
+                for (size_t c = 0; c < 3; c++)
+                {
+                    values_permute.push_back(((n * 3 + c) * 37 + h) * 19 + w);
+                }
+            }
+        }
+    }
+    ASSERT_EQ(values_permute, values_out);
+}
+
 TEST(constant_folding, constant_broadcast)
 {
     Shape shape_in{2};
@@ -2201,3 +2243,79 @@ TEST(constant_folding, pass_property)
     ASSERT_FALSE(pass->get_property(pass::PassProperty::REQUIRE_STATIC_SHAPE));
     ASSERT_TRUE(pass->get_property(pass::PassProperty::CHANGE_DYNAMIC_STATE));
 }
+
+TEST(constant_folding, parallel_matches_serial)
+{
+    auto make_function = []() {
+        NodeVector results;
+        for (int i = 0; i < 8; i++)
+        {
+            auto a = op::Constant::create(element::f32, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+            auto b = op::Constant::create(element::f32, Shape{2, 3}, vector<float>(6, i));
+            auto sum = make_shared<op::Add>(a, b);
+            auto product = make_shared<op::Multiply>(sum, b);
+            auto perm = op::Constant::create(element::i64, Shape{2}, {1, 0});
+            results.push_back(make_shared<op::Transpose>(product, perm));
+        }
+        return make_shared<Function>(results, ParameterVector{});
+    };
+
+    auto serial = make_function();
+    pass::Manager serial_manager;
+    serial_manager.register_pass<pass::ConstantFolding>()->set_thread_count(1);
+    serial_manager.run_passes(serial);
+
+    auto parallel = make_function();
+    pass::Manager parallel_manager;
+    parallel_manager.register_pass<pass::ConstantFolding>()->set_thread_count(4);
+    parallel_manager.run_passes(parallel);
+
+    ASSERT_EQ(count_ops_of_type<op::Constant>(parallel), 8);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(serial), 8);
+    for (size_t i = 0; i < 8; i++)
+    {
+        auto serial_const = as_type_ptr<op::Constant>(serial->get_output_op(i)->get_argument(0));
+        auto parallel_const =
+            as_type_ptr<op::Constant>(parallel->get_output_op(i)->get_argument(0));
+        ASSERT_TRUE(serial_const);
+        ASSERT_TRUE(parallel_const);
+        EXPECT_EQ(parallel_const->get_shape(), (Shape{3, 2}));
+        EXPECT_EQ(serial_const->get_vector<float>(), parallel_const->get_vector<float>());
+    }
+}
+
+TEST(constant_folding, skip_large_result)
+{
+    auto constant = op::Constant::create(element::f32, Shape{1024}, vector<float>(1024, 1));
+    auto broadcast = make_shared<op::Broadcast>(constant, Shape{1024, 1024}, AxisSet{0});
+    auto f = make_shared<Function>(broadcast, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>()->set_max_folded_bytes(1024);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(f), 1);
+}
+
+TEST(constant_folding, pass_config_expansion_ratio)
+{
+    auto make_function = []() {
+        auto constant = op::Constant::create(element::f32, Shape{}, {1});
+        auto broadcast = make_shared<op::Broadcast>(constant, Shape{256, 256}, AxisSet{0, 1});
+        return make_shared<Function>(broadcast, ParameterVector{});
+    };
+
+    auto limited = make_function();
+    pass::Manager limited_manager;
+    limited_manager.get_pass_config().set_pass_parameter(
+        pass::ConstantFolding::s_max_expansion_ratio_parameter, 16);
+    limited_manager.register_pass<pass::ConstantFolding>();
+    limited_manager.run_passes(limited);
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(limited), 1);
+
+    auto unlimited = make_function();
+    pass::Manager unlimited_manager;
+    unlimited_manager.register_pass<pass::ConstantFolding>();
+    unlimited_manager.run_passes(unlimited);
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(unlimited), 0);
+}
@@ -14,12 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <array>
 #include <memory>
+#include <numeric>
 #include <string>
 
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
+#include "ngraph/strided_loop.hpp"
 #include "util/ndarray.hpp"
 #include "util/test_tools.hpp"
 
@@ -241,6 +244,76 @@ TEST(coordinate, axis_order)
     EXPECT_TRUE(it == ct.end());
 }
 
+TEST(coordinate, strided_run_merges_contiguous_axes)
+{
+    // A slice of whole rows is a single run; unit axes are dropped
+    Shape shape{2, 1, 3, 4};
+    vector<array<size_t, 1>> offsets;
+    vector<size_t> counts;
+    for_each_strided_run<1>(shape,
+                            {{vector<size_t>{24, 12, 4, 1}}},
+                            {{5}},
+                            [&](const array<size_t, 1>& offset,
+                                size_t count,
+                                const array<size_t, 1>& inner_strides) {
+                                offsets.push_back(offset);
+                                counts.push_back(count);
+                                EXPECT_EQ(inner_strides[0], 1);
+                            });
+    EXPECT_EQ(offsets, (vector<array<size_t, 1>>{{{5}}, {{29}}}));
+    EXPECT_EQ(counts, (vector<size_t>{12, 12}));
+
+    // A zero stride repeats the element along its axis
+    counts.clear();
+    offsets.clear();
+    for_each_strided_run<1>(Shape{3, 2},
+                            {{vector<size_t>{1, 0}}},
+                            {{0}},
+                            [&](const array<size_t, 1>& offset,
+                                size_t count,
+                                const array<size_t, 1>& inner_strides) {
+                                offsets.push_back(offset);
+                                counts.push_back(count);
+                                EXPECT_EQ(inner_strides[0], 0);
+                            });
+    EXPECT_EQ(offsets, (vector<array<size_t, 1>>{{{0}}, {{1}}, {{2}}}));
+    EXPECT_EQ(counts, (vector<size_t>{2, 2, 2}));
+}
+
+TEST(coordinate, strided_copy_matches_coordinate_transform)
+{
+    Shape in_shape{3, 4, 5};
+    vector<int> in(shape_size(in_shape));
+    iota(in.begin(), in.end(), 0);
+
+    // Transpose with axis order {2, 0, 1}, sliced with strides {2, 1, 3} from {0, 1, 1}
+    AxisVector axis_order{2, 0, 1};
+    Coordinate lower{0, 1, 1};
+    Coordinate upper{3, 4, 5};
+    Strides strides{2, 1, 3};
+    CoordinateTransform transform(in_shape, lower, upper, strides, axis_order);
+    vector<int> expected;
+    for (const Coordinate& c : transform)
+    {
+        expected.push_back(in[transform.index(c)]);
+    }
+
+    auto in_strides = row_major_strides(in_shape);
+    Shape walk_shape;
+    vector<size_t> walk_strides;
+    size_t start = 0;
+    for (size_t i = 0; i < in_shape.size(); i++)
+    {
+        size_t axis = axis_order[i];
+        walk_shape.push_back((upper[axis] - lower[axis] + strides[axis] - 1) / strides[axis]);
+        walk_strides.push_back(in_strides[axis] * strides[axis]);
+        start += lower[axis] * in_strides[axis];
+    }
+    vector<int> actual(shape_size(walk_shape));
+    strided_copy(in.data(), actual.data(), walk_shape, walk_strides, start);
+    EXPECT_EQ(actual, expected);
+}
+
 TEST(DISABLED_coordinate, padding)
 {
     Shape source_shape{10, 10};
@@ -28,6 +28,8 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/fused/batch_mat_mul_transpose.hpp"
 #include "ngraph/op/fused/group_conv.hpp"
+#include "ngraph/op/fused/layer_norm.hpp"
+#include "ngraph/op/fused/scale_shift.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/softmax.hpp"
@@ -313,6 +315,57 @@ TEST(core_fusion, reshape_softmax_reshape)
     EXPECT_TRUE(test::all_close(baseline_results.at(0), optimized_results.at(0)));
 }
 
+static std::shared_ptr<Function> generate_decomposed_softmax(const Shape& shape,
+                                                             const AxisSet& axes)
+{
+    auto input = make_shared<op::Parameter>(element::f32, shape);
+    auto max = make_shared<op::Broadcast>(make_shared<op::Max>(input, axes), shape, axes);
+    auto exp = make_shared<op::Exp>(input - max);
+    auto sum = make_shared<op::Broadcast>(make_shared<op::Sum>(exp, axes), shape, axes);
+    return make_shared<Function>(exp / sum, ParameterVector{input});
+}
+
+TEST(core_fusion, softmax)
+{
+    for (auto axes : {AxisSet{2}, AxisSet{1, 2}, AxisSet{0}})
+    {
+        auto baseline_f = generate_decomposed_softmax(Shape{3, 4, 17}, axes);
+        auto optimized_f = generate_decomposed_softmax(Shape{3, 4, 17}, axes);
+
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::CoreFusion>();
+        pass_manager.run_passes(optimized_f);
+        ASSERT_EQ(count_ops_of_type<op::Softmax>(optimized_f), 1);
+        ASSERT_EQ(count_ops_of_type<op::Exp>(optimized_f), 0);
+
+        test::Uniform<float> rng(-10.0f, 10.0f);
+        vector<vector<float>> args;
+        vector<float> tensor_val(shape_size(Shape{3, 4, 17}));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+
+        auto baseline_results = execute(baseline_f, args, "INTERPRETER");
+        auto optimized_results = execute(optimized_f, args, "INTERPRETER");
+        EXPECT_TRUE(test::all_close(baseline_results.at(0), optimized_results.at(0)));
+    }
+}
+
+TEST(core_fusion, softmax_mismatched_axes)
+{
+    Shape shape{3, 4};
+    auto input = make_shared<op::Parameter>(element::f32, shape);
+    auto max = make_shared<op::Broadcast>(
+        make_shared<op::Max>(input, AxisSet{1}), shape, AxisSet{1});
+    auto exp = make_shared<op::Exp>(input - max);
+    auto sum = make_shared<op::Broadcast>(make_shared<op::Sum>(exp, AxisSet{0}), shape, AxisSet{0});
+    auto f = make_shared<Function>(exp / sum, ParameterVector{input});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Softmax>(f), 0);
+}
+
 TEST(core_fusion, zero_padded_reshaped_conv)
 {
     auto X = make_shared<op::Parameter>(element::f32, Shape{1, 2, 2, 1});
@@ -855,17 +908,12 @@ void test_softmax_crossentropy(Shape input_shape,
     }
 
     auto cpu_results = execute(cpu_f, args, "CPU");
-    // if softlabels = flase, we will have one one hot encoding for labels
+    // hard labels run as one fused kernel, without a one hot encoding or an ignore mask
     if (!soft_label)
     {
-        size_t onehot = count_ops_of_type<op::OneHot>(cpu_f);
-        ASSERT_EQ(onehot, 1);
-    }
-    if (ignore_index >= 0 && !soft_label)
-    // check for the mask
-    {
-        size_t not_equal = count_ops_of_type<op::NotEqual>(cpu_f);
-        ASSERT_EQ(not_equal, 1);
+        ASSERT_EQ(count_ops_of_type<op::SoftmaxCrossEntropy>(cpu_f), 1);
+        ASSERT_EQ(count_ops_of_type<op::OneHot>(cpu_f), 0);
+        ASSERT_EQ(count_ops_of_type<op::NotEqual>(cpu_f), 0);
     }
 }
 
@@ -913,3 +961,169 @@ TEST(core_fusion, MLIR_DISABLE_TEST(crossentropy))
     test_crossentropy(Shape{10, 2, 4, 10}, Shape{10, 2, 4, 1}, false, 5);
     test_crossentropy(Shape{4, 3, 2, 4}, Shape{4, 3, 2, 4}, true, -1);
 }
+
+static std::shared_ptr<Function> generate_decomposed_layer_norm(const Shape& shape,
+                                                                size_t begin_norm_axis)
+{
+    AxisSet outer_axes, norm_axes;
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        if (i < begin_norm_axis)
+        {
+            outer_axes.insert(i);
+        }
+        else
+        {
+            norm_axes.insert(i);
+        }
+    }
+    Shape norm_shape(shape.begin() + begin_norm_axis, shape.end());
+    Shape stats_shape(shape.begin(), shape.begin() + begin_norm_axis);
+    auto count = static_cast<float>(shape_size(norm_shape));
+
+    auto input = make_shared<op::Parameter>(element::f32, shape);
+    auto gamma = make_shared<op::Parameter>(element::f32, norm_shape);
+    auto beta = make_shared<op::Parameter>(element::f32, norm_shape);
+    auto mean = make_shared<op::Sum>(input, norm_axes) /
+                op::Constant::create(element::f32, stats_shape, {count});
+    auto diff = input - make_shared<op::Broadcast>(mean, shape, norm_axes);
+    auto variance = make_shared<op::Sum>(diff * diff, norm_axes) /
+                    op::Constant::create(element::f32, stats_shape, {count});
+    auto epsilon = make_shared<op::Broadcast>(
+        op::Constant::create(element::f32, Shape{}, {1e-5f}), stats_shape, outer_axes);
+    auto stddev = make_shared<op::Sqrt>(variance + epsilon);
+    auto norm = diff / make_shared<op::Broadcast>(stddev, shape, norm_axes);
+    auto result = norm * make_shared<op::Broadcast>(gamma, shape, outer_axes) +
+                  make_shared<op::Broadcast>(beta, shape, outer_axes);
+    return make_shared<Function>(result, ParameterVector{input, gamma, beta});
+}
+
+TEST(core_fusion, layer_norm)
+{
+    Shape shape{5, 3, 16};
+    for (size_t begin_norm_axis : {1, 2})
+    {
+        auto baseline_f = generate_decomposed_layer_norm(shape, begin_norm_axis);
+        auto optimized_f = generate_decomposed_layer_norm(shape, begin_norm_axis);
+
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::CoreFusion>(pass::FusionType::ALL_FUSIONS);
+        pass_manager.run_passes(optimized_f);
+        ASSERT_EQ(count_ops_of_type<op::LayerNorm>(optimized_f), 1);
+        ASSERT_EQ(count_ops_of_type<op::Sqrt>(optimized_f), 0);
+
+        test::Uniform<float> rng(-5.0f, 5.0f);
+        vector<vector<float>> args;
+        for (shared_ptr<op::Parameter> param : baseline_f->get_parameters())
+        {
+            vector<float> tensor_val(shape_size(param->get_shape()));
+            rng.initialize(tensor_val);
+            args.push_back(tensor_val);
+        }
+
+        auto baseline_results = execute(baseline_f, args, "INTERPRETER");
+        auto optimized_results = execute(optimized_f, args, "INTERPRETER");
+        EXPECT_TRUE(test::all_close(baseline_results.at(0), optimized_results.at(0)));
+    }
+}
+
+TEST(core_fusion, layer_norm_regular_fusions)
+{
+    // LayerNorm is a fused op, so it is only created when FOP_FUSIONS are requested
+    auto f = generate_decomposed_layer_norm(Shape{2, 8}, 1);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::LayerNorm>(f), 0);
+}
+
+static shared_ptr<op::Constant> make_random_constant(const Shape& shape, float min, float max)
+{
+    test::Uniform<float> rng(min, max);
+    vector<float> values(shape_size(shape));
+    rng.initialize(values);
+    return op::Constant::create(element::f32, shape, values);
+}
+
+// Runs CoreFusion on a copy of `f` and checks that no op of type T is left and that the
+// results are unchanged
+template <typename T>
+static void check_weight_folding(const shared_ptr<Function>& f)
+{
+    auto folded_f = clone_function(*f);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(folded_f);
+    ASSERT_EQ(count_ops_of_type<T>(folded_f), 0);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto expected = execute(f, args, "INTERPRETER");
+    auto folded = execute(folded_f, args, "INTERPRETER");
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(expected.at(i), folded.at(i), 1e-4f, 1e-4f));
+    }
+}
+
+TEST(core_fusion, dot_batch_norm_weight_folding)
+{
+    auto input = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+    auto dot = make_shared<op::Dot>(input, make_random_constant(Shape{4, 5}, -1.0f, 1.0f));
+    auto bn = make_shared<op::BatchNormInference>(0.001,
+                                                  make_random_constant(Shape{5}, 0.5f, 2.0f),
+                                                  make_random_constant(Shape{5}, -1.0f, 1.0f),
+                                                  dot,
+                                                  make_random_constant(Shape{5}, -1.0f, 1.0f),
+                                                  make_random_constant(Shape{5}, 0.5f, 2.0f));
+    auto f = make_shared<Function>(bn, ParameterVector{input});
+    check_weight_folding<op::BatchNormInference>(f);
+}
+
+TEST(core_fusion, conv_scale_shift_weight_folding)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{1, 2, 5, 5});
+    auto conv =
+        make_shared<op::Convolution>(data, make_random_constant(Shape{3, 2, 2, 2}, -1.0f, 1.0f));
+    auto scale_shift =
+        make_shared<op::ScaleShift>(conv,
+                                    make_random_constant(Shape{3, 1, 1}, 0.5f, 2.0f),
+                                    make_random_constant(Shape{3, 1, 1}, -1.0f, 1.0f));
+    auto f = make_shared<Function>(scale_shift, ParameterVector{data});
+    check_weight_folding<op::ScaleShift>(f);
+}
+
+TEST(core_fusion, conv_bias_multiply_weight_folding)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{1, 2, 5, 5});
+    auto conv_bias =
+        make_shared<op::ConvolutionBias>(data,
+                                         make_random_constant(Shape{3, 2, 2, 2}, -1.0f, 1.0f),
+                                         make_random_constant(Shape{3}, -1.0f, 1.0f));
+    auto scale = make_shared<op::Broadcast>(make_random_constant(Shape{3}, 0.5f, 2.0f),
+                                            conv_bias->get_shape(),
+                                            AxisSet{0, 2, 3});
+    auto f = make_shared<Function>(conv_bias * scale, ParameterVector{data});
+    check_weight_folding<op::Multiply>(f);
+}
+
+TEST(core_fusion, multiply_weight_folding_not_per_channel)
+{
+    // A scale that varies along the spatial axes cannot be folded into the filters
+    auto data = make_shared<op::Parameter>(element::f32, Shape{1, 2, 5, 5});
+    auto conv =
+        make_shared<op::Convolution>(data, make_random_constant(Shape{3, 2, 2, 2}, -1.0f, 1.0f));
+    auto scale = make_random_constant(conv->get_shape(), 0.5f, 2.0f);
+    auto f = make_shared<Function>(conv * scale, ParameterVector{data});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Multiply>(f), 1);
+}
@@ -0,0 +1,110 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+
+#include "ngraph/cost_model.hpp"
+#include "ngraph/ngraph.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(cost_model, dot)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4, 8});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{8, 16});
+    auto dot = make_shared<op::Dot>(A, B);
+
+    NodeCost cost = estimate_cost(*dot);
+    EXPECT_EQ(cost.flops, 2 * 4 * 16 * 8);
+    EXPECT_EQ(cost.input_bytes, 4 * (4 * 8 + 8 * 16));
+    EXPECT_EQ(cost.output_bytes, 4 * 4 * 16);
+    EXPECT_DOUBLE_EQ(cost.arithmetic_intensity(), 1024.0 / 896);
+}
+
+TEST(cost_model, convolution)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{1, 4, 8, 8});
+    auto filters = make_shared<op::Parameter>(element::f32, Shape{16, 4, 3, 3});
+    auto conv = make_shared<op::Convolution>(data, filters);
+    // 16 x 6 x 6 outputs of 4 x 3 x 3 multiply-adds
+    EXPECT_EQ(estimate_cost(*conv).flops, 2 * 16 * 6 * 6 * 4 * 3 * 3);
+
+    auto group_filters = make_shared<op::Parameter>(element::f32, Shape{16, 2, 3, 3});
+    auto group_conv = make_shared<op::GroupConvolution>(data,
+                                                        group_filters,
+                                                        Strides{1, 1},
+                                                        Strides{1, 1},
+                                                        CoordinateDiff{0, 0},
+                                                        CoordinateDiff{0, 0},
+                                                        Strides{1, 1},
+                                                        2);
+    EXPECT_EQ(estimate_cost(*group_conv).flops, 2 * 16 * 6 * 6 * 2 * 3 * 3);
+}
+
+TEST(cost_model, lstm_cell)
+{
+    const size_t batch_size = 2;
+    const size_t input_size = 3;
+    const size_t hidden_size = 5;
+    const size_t gates_count = 4;
+
+    auto X = make_shared<op::Parameter>(element::f32, Shape{batch_size, input_size});
+    auto W =
+        make_shared<op::Parameter>(element::f32, Shape{gates_count * hidden_size, input_size});
+    auto R =
+        make_shared<op::Parameter>(element::f32, Shape{gates_count * hidden_size, hidden_size});
+    auto H_t = make_shared<op::Parameter>(element::f32, Shape{batch_size, hidden_size});
+    auto C_t = make_shared<op::Parameter>(element::f32, Shape{batch_size, hidden_size});
+    auto lstm_cell = make_shared<op::LSTMCell>(X, H_t, C_t, W, R, hidden_size);
+
+    // The gate products dominate; every gate element also adds a bias and applies an
+    // activation, and every hidden unit updates the cell and hidden state
+    size_t products = 2 * batch_size * gates_count * hidden_size * (input_size + hidden_size);
+    size_t elementwise = batch_size * hidden_size * (2 * gates_count + 5);
+    EXPECT_EQ(estimate_cost(*lstm_cell).flops, products + elementwise);
+}
+
+TEST(cost_model, function)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4, 8});
+    auto B = op::Constant::create(element::f32, Shape{8, 16}, vector<float>(8 * 16, 1));
+    auto dot = make_shared<op::Dot>(A, B);
+    auto relu = make_shared<op::Relu>(dot);
+    auto f = make_shared<Function>(relu, ParameterVector{A});
+
+    FunctionCost cost = estimate_cost(*f);
+    ASSERT_EQ(cost.nodes.size(), 2);
+    EXPECT_EQ(cost.nodes[0].first, dot);
+    EXPECT_EQ(cost.nodes[1].first, relu);
+    EXPECT_EQ(cost.flops, 2 * 4 * 16 * 8 + 4 * 16);
+    EXPECT_EQ(cost.parameter_bytes, 4 * 4 * 8);
+    EXPECT_EQ(cost.constant_bytes, 4 * 8 * 16);
+    EXPECT_EQ(cost.activation_bytes, 2 * 4 * 4 * 16);
+    EXPECT_EQ(cost.bytes, cost.nodes[0].second.bytes() + cost.nodes[1].second.bytes());
+    EXPECT_DOUBLE_EQ(cost.arithmetic_intensity(), static_cast<double>(cost.flops) / cost.bytes);
+}
+
+TEST(cost_model, dynamic_shape)
+{
+    auto A = make_shared<op::Parameter>(element::f32, PartialShape::dynamic());
+    auto relu = make_shared<op::Relu>(A);
+
+    NodeCost cost = estimate_cost(*relu);
+    EXPECT_EQ(cost.flops, 0);
+    EXPECT_EQ(cost.bytes(), 0);
+    EXPECT_EQ(cost.arithmetic_intensity(), 0);
+}
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <memory>
+#include <sstream>
 
 #include <gtest/gtest.h>
 
@@ -107,3 +108,66 @@ TEST(cpio, write)
         }
     }
 }
+
+TEST(cpio, write_aligned)
+{
+    const string test_file = "test_aligned.cpio";
+    string s1 = "this is a test";
+    string s2 = "the quick brown fox jumps over the lazy dog";
+    {
+        cpio::Writer writer(test_file);
+        writer.write("file1.txt", s1.data(), static_cast<uint32_t>(s1.size()), 64);
+        writer.write("file.txt", s2.data(), static_cast<uint32_t>(s2.size()), 64);
+    }
+    {
+        cpio::Reader reader(test_file);
+        auto file_info = reader.get_file_info();
+        ASSERT_EQ(2, file_info.size());
+        EXPECT_STREQ(file_info[0].get_name().c_str(), "file1.txt");
+        EXPECT_STREQ(file_info[1].get_name().c_str(), "file.txt");
+        EXPECT_EQ(file_info[0].get_offset() % 64, 0);
+        EXPECT_EQ(file_info[1].get_offset() % 64, 0);
+
+        vector<char> data = reader.read(file_info[1]);
+        EXPECT_EQ(string(data.data(), data.size()), s2);
+    }
+    file_util::remove_file(test_file);
+}
+
+TEST(cpio, index)
+{
+    string s1 = "this is a test";
+    string s2 = "the quick brown fox jumps over the lazy dog";
+    stringstream archive;
+    {
+        cpio::Writer writer(archive);
+        writer.write("file1.txt", s1.data(), static_cast<uint32_t>(s1.size()));
+        writer.write("file2.txt", s2.data(), static_cast<uint32_t>(s2.size()), 64);
+    }
+
+    // Records are found through the index, so a damaged first header is never read
+    string bytes = archive.str();
+    bytes[0] = 0;
+    stringstream damaged(bytes);
+    cpio::Reader reader(damaged);
+    const cpio::FileInfo* info = reader.find("file2.txt");
+    ASSERT_NE(info, nullptr);
+    EXPECT_EQ(info->get_offset() % 64, 0);
+    vector<char> data = reader.read(*info);
+    EXPECT_EQ(string(data.data(), data.size()), s2);
+    EXPECT_EQ(reader.find("file3.txt"), nullptr);
+
+    auto file_info = reader.get_file_info();
+    ASSERT_EQ(2, file_info.size());
+    EXPECT_EQ(file_info[0].get_name(), "file1.txt");
+    EXPECT_EQ(file_info[1].get_name(), "file2.txt");
+
+    // The index is not part of the archive, so a scan sees the same records
+    stringstream scanned(archive.str().substr(0, archive.str().size() - 1));
+    cpio::Reader scan_reader(scanned);
+    file_info = scan_reader.get_file_info();
+    ASSERT_EQ(2, file_info.size());
+    EXPECT_EQ(file_info[1].get_offset(), info->get_offset());
+    data = scan_reader.read(file_info[0]);
+    EXPECT_EQ(string(data.data(), data.size()), s1);
+}
@@ -124,3 +124,54 @@ TEST(cpu_debug_tracer, MLIR_DISABLE_TEST(check_flow_with_external_function))
     remove(bin_log_file.c_str());
     unset_env_vars();
 }
+
+TEST(cpu_debug_tracer, tensor_stats)
+{
+    // 19 elements exercise both the vectorized body and the tail
+    vector<float> data{3, -1, 4, 1, -5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9, 3, 2, 3, 8};
+    data[6] = numeric_limits<float>::quiet_NaN();
+    data[17] = numeric_limits<float>::quiet_NaN();
+
+    auto stats = runtime::cpu::compute_tensor_stats(data.data(), element::f32, data.size());
+    EXPECT_EQ(stats.count, 19);
+    EXPECT_EQ(stats.nan_count, 2);
+    EXPECT_EQ(stats.min, -5);
+    EXPECT_EQ(stats.max, 9);
+    EXPECT_DOUBLE_EQ(stats.mean, 76.0 / 17);
+
+    vector<int32_t> ints{7, -2, 11, 0};
+    stats = runtime::cpu::compute_tensor_stats(ints.data(), element::i32, ints.size());
+    EXPECT_EQ(stats.nan_count, 0);
+    EXPECT_EQ(stats.min, -2);
+    EXPECT_EQ(stats.max, 11);
+    EXPECT_DOUBLE_EQ(stats.mean, 4);
+}
+
+TEST(cpu_debug_tracer, sampling)
+{
+    runtime::cpu::CPU_DebugTracer tracer;
+
+    tracer.set_sampling(3, 1);
+    EXPECT_TRUE(tracer.is_sampling());
+    size_t traced = 0;
+    for (size_t i = 0; i < 9; i++)
+    {
+        traced += tracer.begin_call();
+    }
+    EXPECT_EQ(traced, 3);
+
+    tracer.set_sampling(1, 0);
+    traced = 0;
+    for (size_t i = 0; i < 9; i++)
+    {
+        traced += tracer.begin_call();
+    }
+    EXPECT_EQ(traced, 0);
+
+    tracer.set_sampling(1, 1);
+    EXPECT_FALSE(tracer.is_sampling());
+
+    tracer.set_traced_ops({"Convolution"});
+    EXPECT_TRUE(tracer.op_is_traced("Convolution"));
+    EXPECT_FALSE(tracer.op_is_traced("Add"));
+}
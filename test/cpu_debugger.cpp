@@ -28,6 +28,7 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_debug_tracer.hpp"
 #include "ngraph/runtime/cpu/cpu_debugger.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
@@ -360,6 +361,53 @@ TEST(tracer, MLIR_DISABLE_TEST(count_tracepoint))
     }
 }
 
+TEST(tracer, MLIR_DISABLE_TEST(sampled_tracepoint))
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+
+    auto add = make_shared<op::Add>(A, B);
+    auto mul = make_shared<op::Multiply>(add, B);
+
+    auto f = make_shared<Function>(mul, ParameterVector{A, B});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("CPU");
+
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{0, 1, 2, 3});
+    copy_data(b, vector<float>{1, 2, 3, 4});
+
+    shared_ptr<runtime::Executable> handle = backend->compile(f);
+    auto cf = dynamic_pointer_cast<runtime::cpu::CPU_Executable>(handle)->get_call_frame();
+
+    ngraph::runtime::cpu::CPU_Debugger dbg(*cf);
+
+    size_t add_calls = 0;
+    std::function<void(void**, const std::string&)> add_callback =
+        [&add_calls](void** values, const std::string& /* name */) {
+            auto stats = runtime::cpu::compute_tensor_stats(values[0], element::f32, 4);
+            EXPECT_EQ(stats.min, 1);
+            EXPECT_EQ(stats.max, 7);
+            EXPECT_EQ(stats.mean, 4);
+            add_calls++;
+        };
+    size_t mul_calls = 0;
+    std::function<void(void**, const std::string&)> mul_callback =
+        [&mul_calls](void** /* values */, const std::string& /* name */) { mul_calls++; };
+
+    dbg.add_tracepoint(add, ngraph::runtime::cpu::CPU_SampledTracepoint(add_callback, 1));
+    dbg.add_tracepoint(mul, ngraph::runtime::cpu::CPU_SampledTracepoint(mul_callback, 0));
+    for (size_t i = 0; i < 5; i++)
+    {
+        dbg.call({result}, {a, b});
+    }
+    EXPECT_EQ(add_calls, 5);
+    EXPECT_EQ(mul_calls, 0);
+}
+
 TEST(tracer, MLIR_DISABLE_TEST(conditional_tracepoint))
 {
     Shape shape{};
@@ -19,6 +19,7 @@
 #include <iostream>
 #include <list>
 #include <memory>
+#include <numeric>
 
 #include "gtest/gtest.h"
 #include "misc.hpp"
@@ -30,6 +31,7 @@
 #include "ngraph/op/batch_norm.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/experimental/generate_mask.hpp"
 #include "ngraph/op/experimental/quantized_conv_bias.hpp"
 #include "ngraph/op/fused/batch_mat_mul_transpose.hpp"
@@ -60,26 +62,38 @@
 #include "ngraph/pattern/op/skip.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/op/allreduce_async.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
+#include "ngraph/runtime/cpu/op/broadcast_distributed_async.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/deconv.hpp"
+#include "ngraph/runtime/cpu/op/dequantizing_dot.hpp"
 #include "ngraph/runtime/cpu/op/dropout.hpp"
+#include "ngraph/runtime/cpu/op/embedding_bag_sum.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
 #include "ngraph/runtime/cpu/op/gelu_backprop.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/quantized_add.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/rnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
+#include "ngraph/runtime/cpu/op/sparse_dot.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_async_allreduce.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_dequantizing_dot.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_dropout_mask_packing.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_elementwise_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_sparse_dot.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_workspace_insertion.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
@@ -994,6 +1008,37 @@ TEST(cpu_fusion, conv_horizontal_fusion)
     ASSERT_EQ(cpu_cb, 1);
 }
 
+TEST(cpu_fusion, dot_horizontal_fusion)
+{
+    Shape shape_a{1, 4};
+    auto make_function = [shape_a]() {
+        auto A = std::make_shared<op::Parameter>(element::f32, shape_a);
+        NodeVector dots;
+        for (size_t i = 0; i < 3; i++)
+        {
+            vector<float> weights(4 * (i + 2));
+            iota(weights.begin(), weights.end(), static_cast<float>(i));
+            auto W = op::Constant::create(element::f32, Shape{4, i + 2}, weights);
+            dots.push_back(std::make_shared<op::Dot>(A, W));
+        }
+        return make_shared<Function>(dots, ParameterVector{A});
+    };
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+
+    vector<vector<float>> args{{1.0f, -2.0f, 0.5f, 3.0f}};
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < int_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i)));
+    }
+
+    // CPUFusion turns the Dots into MatmulBias before they are fused
+    size_t cpu_matmul = count_ops_of_type<op::MatmulBias>(cpu_f);
+    ASSERT_EQ(cpu_matmul, 1);
+}
+
 // ConvolutionBiasAdd relies on an in-place fused MKLDNN kernel.
 // Need to ensure that it is fused only when in-place buffer allocation is feasible
 shared_ptr<Function> gen_conv_bias_add(bool param_input, bool result_output)
@@ -2726,6 +2771,62 @@ TEST(cpu_fusion, MLIR_DISABLE_TEST(fuse_dropout))
     }
 }
 
+TEST(cpu_fusion, MLIR_DISABLE_TEST(dropout_mask_packing))
+{
+    auto make_function = []() {
+        Shape shape{3, 5, 67};
+        auto input = std::make_shared<op::Parameter>(element::f32, shape);
+        auto delta = std::make_shared<op::Parameter>(element::f32, shape);
+        auto value = op::Constant::create(element::f32, shape, {0.7});
+        auto const1 = op::Constant::create(element::f32, Shape{}, {1});
+        auto gen_mask =
+            std::make_shared<op::GenerateMask>(const1, shape, element::f32, 17, 0.7, false);
+        auto fprop = std::make_shared<op::Divide>(std::make_shared<op::Multiply>(gen_mask, input),
+                                                  value);
+        auto bprop = std::make_shared<op::Multiply>(delta, gen_mask);
+        return make_shared<Function>(NodeVector{fprop, bprop}, ParameterVector{input, delta});
+    };
+
+    {
+        auto f = make_function();
+        pass::Manager pass_manager;
+        pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+        pass_manager.register_pass<runtime::cpu::pass::CPUDropoutMaskPacking>();
+        pass_manager.run_passes(f);
+        ASSERT_EQ(count_ops_of_type<op::Dropout>(f), 1);
+        ASSERT_EQ(count_ops_of_type<op::DropoutMaskMultiply>(f), 1);
+        for (auto& node : f->get_ops())
+        {
+            if (auto dropout = as_type_ptr<op::Dropout>(node))
+            {
+                EXPECT_TRUE(dropout->get_packed_mask());
+                EXPECT_EQ(dropout->get_output_shape(1), Shape{(3 * 5 * 67 + 31) / 32});
+            }
+        }
+    }
+
+    // The backprop must zero exactly the elements the forward dropped
+    auto f = make_function();
+    test::Uniform<float> rng(1.0f, 100.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto results = execute(f, args, "CPU");
+    size_t dropped = 0;
+    for (size_t i = 0; i < results.at(0).size(); i++)
+    {
+        bool kept = results.at(0)[i] != 0.0f;
+        dropped += !kept;
+        EXPECT_EQ(results.at(1)[i], kept ? args.at(1)[i] : 0.0f);
+    }
+    EXPECT_GT(dropped, 0);
+    EXPECT_LT(dropped, results.at(0).size());
+}
+
 TEST(cpu_fusion, MLIR_DISABLE_TEST(fuse_leaky_relu))
 {
     auto make_function = [](Shape input_shape, vector<float> alpha_val) {
@@ -2960,6 +3061,57 @@ TEST(cpu_fusion, fuse_update_slice_strided_inplace)
     }
 }
 
+TEST(cpu_fusion, fuse_embedding_bag_sum)
+{
+    Shape indices_shape{5, 4};
+    Shape weights_shape{16, 24};
+    auto make_function = [&](bool fuse = true) {
+        auto indices = std::make_shared<op::Parameter>(element::i32, indices_shape);
+        auto weights = std::make_shared<op::Parameter>(element::f32, weights_shape);
+        auto lookup = std::make_shared<op::EmbeddingLookup>(indices, weights);
+        auto sum = std::make_shared<op::Sum>(lookup, AxisSet{1});
+        NodeVector results{sum};
+        if (!fuse)
+        {
+            results.push_back(lookup);
+        }
+        return make_shared<Function>(results, ParameterVector{indices, weights});
+    };
+
+    auto fuse = make_function(true);
+    auto no_fuse = make_function(false);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.run_passes(fuse);
+    pass_manager.run_passes(no_fuse);
+    EXPECT_EQ(1, count_ops_of_type<op::EmbeddingBagSum>(fuse));
+    EXPECT_EQ(0, count_ops_of_type<op::EmbeddingLookup>(fuse));
+    EXPECT_EQ(0, count_ops_of_type<op::EmbeddingBagSum>(no_fuse));
+
+    vector<int> indices_val(shape_size(indices_shape));
+    for (size_t i = 0; i < indices_val.size(); i++)
+    {
+        indices_val[i] = static_cast<int>((i * 7) % weights_shape[0]);
+    }
+    vector<float> weights_val(shape_size(weights_shape));
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    rng.initialize(weights_val);
+
+    auto compute = [&](const string& backend_name) {
+        auto backend = runtime::Backend::create(backend_name);
+        auto indices = backend->create_tensor(element::i32, indices_shape);
+        copy_data(indices, indices_val);
+        auto weights = backend->create_tensor(element::f32, weights_shape);
+        copy_data(weights, weights_val);
+        auto result = backend->create_tensor(element::f32, Shape{5, 24});
+        auto handle = backend->compile(make_function());
+        handle->call_with_validate({result}, {indices, weights});
+        return read_vector<float>(result);
+    };
+    EXPECT_TRUE(test::all_close(compute("CPU"), compute("INTERPRETER")));
+}
+
 TEST(cpu_fusion, dot_batch_forward)
 {
     const Shape shape_a{2, 3, 2};
@@ -3375,6 +3527,87 @@ TEST(cpu_quant_fusion, dq_q)
     ASSERT_EQ(count_ops_of_type<op::Quantize>(no_fuse2), 1);
 }
 
+TEST(cpu_quant_fusion, qrelu)
+{
+    auto make_function = [](element::Type type) {
+        Shape shape_input{2, 3, 4};
+        auto input = std::make_shared<op::Parameter>(type, shape_input);
+        auto dq_scale = op::Constant::create(element::f32, Shape{}, {2.0f});
+        auto dq_zp = op::Constant::create(type, Shape{}, {0});
+        auto dq = std::make_shared<op::Dequantize>(input, dq_scale, dq_zp, element::f32, AxisSet{});
+        auto relu = std::make_shared<op::Relu>(dq);
+        return make_shared<Function>(NodeVector{relu}, ParameterVector{input});
+    };
+
+    vector<vector<int8_t>> args{{}};
+    for (int i = 0; i < 24; i++)
+    {
+        args[0].push_back(static_cast<int8_t>(i * 11 - 128));
+    }
+    auto cpu_f1 = make_function(element::i8);
+    auto cpu_f2 = make_function(element::i8);
+    set_environment("NGRAPH_PASS_ENABLES", "CPUQuantFusion:0", 1);
+    auto cpu1_results = execute<int8_t, float>(cpu_f1, args, "CPU");
+    set_environment("NGRAPH_PASS_ENABLES", "CPUQuantFusion:1", 1);
+    auto cpu2_results = execute<int8_t, float>(cpu_f2, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu1_results.at(0), cpu2_results.at(0)));
+    auto dq = cpu_f2->get_results().at(0)->get_argument(0);
+    ASSERT_TRUE(is_type<op::Dequantize>(dq));
+    EXPECT_TRUE(is_type<op::Relu>(dq->get_argument(0)));
+
+    // Relu of u8 is dropped
+    auto u8_f = make_function(element::u8);
+    auto backend = runtime::Backend::create("CPU");
+    backend->compile(u8_f);
+    EXPECT_EQ(count_ops_of_type<op::Relu>(u8_f), 0);
+}
+
+TEST(cpu_quant_fusion, qadd)
+{
+    auto make_function = [](element::Type type, float output_scale) {
+        Shape shape_input{3, 5, 7};
+        auto input0 = std::make_shared<op::Parameter>(type, shape_input);
+        auto input1 = std::make_shared<op::Parameter>(type, shape_input);
+        auto input0_scale = op::Constant::create(element::f32, Shape{}, {0.5f});
+        auto input1_scale = op::Constant::create(element::f32, Shape{}, {0.25f});
+        auto q_scale = op::Constant::create(element::f32, Shape{}, {output_scale});
+        auto zero = op::Constant::create(type, Shape{}, {0});
+        auto dq0 =
+            std::make_shared<op::Dequantize>(input0, input0_scale, zero, element::f32, AxisSet{});
+        auto dq1 =
+            std::make_shared<op::Dequantize>(input1, input1_scale, zero, element::f32, AxisSet{});
+        auto add = std::make_shared<op::Add>(dq0, dq1);
+        op::Quantize::RoundMode round_mode = op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN;
+        auto q = std::make_shared<op::Quantize>(add, q_scale, zero, type, AxisSet{}, round_mode);
+        return make_shared<Function>(NodeVector{q}, ParameterVector{input0, input1});
+    };
+
+    // The multipliers 1 and 0.5 are exact, so the sums hit ties and saturate
+    vector<vector<int8_t>> args_i8{{}, {}};
+    vector<vector<uint8_t>> args_u8{{}, {}};
+    for (int i = 0; i < 105; i++)
+    {
+        args_i8[0].push_back(static_cast<int8_t>(i * 37));
+        args_i8[1].push_back(static_cast<int8_t>(i * 91 + 3));
+        args_u8[0].push_back(static_cast<uint8_t>(i * 37));
+        args_u8[1].push_back(static_cast<uint8_t>(i * 91 + 3));
+    }
+
+    set_environment("NGRAPH_PASS_ENABLES", "CPUQuantFusion:0", 1);
+    auto expected_i8 = execute(make_function(element::i8, 0.5f), args_i8, "CPU");
+    auto expected_u8 = execute(make_function(element::u8, 0.5f), args_u8, "CPU");
+    set_environment("NGRAPH_PASS_ENABLES", "CPUQuantFusion:1", 1);
+    auto fused_i8 = make_function(element::i8, 0.5f);
+    auto fused_u8 = make_function(element::u8, 0.5f);
+    auto results_i8 = execute(fused_i8, args_i8, "CPU");
+    auto results_u8 = execute(fused_u8, args_u8, "CPU");
+    EXPECT_EQ(count_ops_of_type<op::QuantizedAdd>(fused_i8), 1);
+    EXPECT_EQ(count_ops_of_type<op::QuantizedAdd>(fused_u8), 1);
+    EXPECT_EQ(count_ops_of_type<op::Dequantize>(fused_i8), 0);
+    EXPECT_EQ(expected_i8.at(0), results_i8.at(0));
+    EXPECT_EQ(expected_u8.at(0), results_u8.at(0));
+}
+
 TEST(cpu_quant_fusion, qconvbsa)
 {
     auto make_function = []() {
@@ -3980,6 +4213,151 @@ TEST(cpu_fusion, lstm_cell)
     }
 }
 
+#if MKLDNN_VERSION_MAJOR < 1
+TEST(cpu_fusion, onnx_gru_cell)
+{
+    for (bool linear_before_reset : {false, true})
+    {
+        auto make_function = [linear_before_reset]() {
+            const size_t batch_size = 3;
+            const size_t input_size = 4;
+            const size_t hidden_size = 5;
+            const size_t gates_count = 3;
+
+            auto X = make_shared<op::Parameter>(element::f32, Shape{batch_size, input_size});
+            auto W = make_shared<op::Parameter>(element::f32,
+                                                Shape{gates_count * hidden_size, input_size});
+            auto R = make_shared<op::Parameter>(element::f32,
+                                                Shape{gates_count * hidden_size, hidden_size});
+            auto H_t = make_shared<op::Parameter>(element::f32, Shape{batch_size, hidden_size});
+            auto B = make_shared<op::Parameter>(element::f32, Shape{2 * gates_count * hidden_size});
+
+            auto gru_cell = make_shared<op::GRUCell>(X,
+                                                     W,
+                                                     R,
+                                                     H_t,
+                                                     hidden_size,
+                                                     B,
+                                                     vector<string>{"sigmoid", "tanh"},
+                                                     vector<float>{},
+                                                     vector<float>{},
+                                                     0.f,
+                                                     linear_before_reset);
+            return make_shared<Function>(NodeVector{gru_cell}, ParameterVector{X, W, R, H_t, B});
+        };
+        auto gru_function_cpu = make_function();
+        auto gru_function_inter = make_function();
+        test::Uniform<float> rng(-1.0f, 1.0f);
+        vector<vector<float>> args;
+        for (shared_ptr<op::Parameter> param : gru_function_cpu->get_parameters())
+        {
+            vector<float> tensor_val(shape_size(param->get_shape()));
+            rng.initialize(tensor_val);
+            args.push_back(tensor_val);
+        }
+
+        auto int_results = execute(gru_function_inter, args, "INTERPRETER");
+        auto cpu_results = execute(gru_function_cpu, args, "CPU");
+        EXPECT_EQ(count_ops_of_type<op::GRUCell>(gru_function_cpu), 0);
+        EXPECT_EQ(count_ops_of_type<op::Rnn>(gru_function_cpu), 1);
+        EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_fusion, onnx_rnn_cell)
+{
+    auto make_function = []() {
+        const size_t batch_size = 3;
+        const size_t input_size = 4;
+        const size_t hidden_size = 5;
+
+        auto X = make_shared<op::Parameter>(element::f32, Shape{batch_size, input_size});
+        auto H_t = make_shared<op::Parameter>(element::f32, Shape{batch_size, hidden_size});
+        auto W = make_shared<op::Parameter>(element::f32, Shape{hidden_size, input_size});
+        auto R = make_shared<op::Parameter>(element::f32, Shape{hidden_size, hidden_size});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{hidden_size});
+
+        auto rnn_cell = make_shared<op::RNNCell>(X, H_t, W, R, B, hidden_size);
+        return make_shared<Function>(NodeVector{rnn_cell}, ParameterVector{X, H_t, W, R, B});
+    };
+    auto rnn_function_cpu = make_function();
+    auto rnn_function_inter = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : rnn_function_cpu->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(rnn_function_inter, args, "INTERPRETER");
+    auto cpu_results = execute(rnn_function_cpu, args, "CPU");
+    EXPECT_EQ(count_ops_of_type<op::RNNCell>(rnn_function_cpu), 0);
+    EXPECT_EQ(count_ops_of_type<op::Rnn>(rnn_function_cpu), 1);
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+}
+#endif
+
+TEST(cpu_fusion, onnx_lstm_sequence_bidirectional)
+{
+    auto make_function = []() {
+        const size_t seq_length = 4;
+        const size_t batch_size = 3;
+        const size_t input_size = 4;
+        const size_t hidden_size = 5;
+        const size_t gates_count = 4;
+        const size_t num_directions = 2;
+
+        auto X =
+            make_shared<op::Parameter>(element::f32, Shape{seq_length, batch_size, input_size});
+        Shape state_shape{num_directions, batch_size, hidden_size};
+        auto H_init = make_shared<op::Parameter>(element::f32, state_shape);
+        auto C_init = make_shared<op::Parameter>(element::f32, state_shape);
+        auto W = make_shared<op::Parameter>(
+            element::f32, Shape{num_directions, gates_count * hidden_size, input_size});
+        auto R = make_shared<op::Parameter>(
+            element::f32, Shape{num_directions, gates_count * hidden_size, hidden_size});
+        auto B = make_shared<op::Parameter>(element::f32,
+                                            Shape{num_directions, gates_count * hidden_size});
+        auto sequence_lengths = op::Constant::create(
+            element::i32, Shape{batch_size}, vector<int32_t>(batch_size, seq_length));
+
+        auto lstm_sequence = make_shared<op::LSTMSequence>(
+            X,
+            H_init,
+            C_init,
+            sequence_lengths,
+            W,
+            R,
+            B,
+            hidden_size,
+            op::LSTMSequence::direction::BIDIRECTIONAL,
+            op::LSTMWeightsFormat::IOFC);
+        return make_shared<Function>(op::get_output_elements(lstm_sequence),
+                                     ParameterVector{X, H_init, C_init, W, R, B});
+    };
+    auto lstm_function_cpu = make_function();
+    auto lstm_function_inter = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : lstm_function_cpu->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(lstm_function_inter, args, "INTERPRETER");
+    auto cpu_results = execute(lstm_function_cpu, args, "CPU");
+    EXPECT_EQ(count_ops_of_type<op::LSTMSequence>(lstm_function_cpu), 0);
+    EXPECT_EQ(count_ops_of_type<op::Rnn>(lstm_function_cpu), 1);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
 TEST(cpu_fusion, rnn_fusion_2rnn_layer_3lstm_cell)
 {
     const std::string file_name("mxnet/2rnn_layer_3lstm_cell.json");
@@ -4025,3 +4403,346 @@ TEST(cpu_fusion, validate_fuse_gru_inputs)
     }
 }
 #endif
+
+static std::shared_ptr<Function> make_elementwise_chain_function()
+{
+    Shape shape{8, 300};
+    auto x = std::make_shared<op::Parameter>(element::f32, shape);
+    auto y = std::make_shared<op::Parameter>(element::f32, shape);
+    auto b = std::make_shared<op::Parameter>(element::f32, Shape{300});
+    auto bias = std::make_shared<op::Broadcast>(b, shape, AxisSet{0});
+    auto product = std::make_shared<op::Multiply>(x, y);
+    auto relu = std::make_shared<op::Relu>(std::make_shared<op::Add>(product, bias));
+    auto tanh = std::make_shared<op::Tanh>(std::make_shared<op::Divide>(x, bias));
+    auto out = std::make_shared<op::Subtract>(relu, tanh);
+    // `product` has a second user, so it must stay outside the fused op
+    auto exp = std::make_shared<op::Exp>(product);
+    return make_shared<Function>(NodeVector{out, exp}, ParameterVector{x, y, b});
+}
+
+TEST(cpu_fusion, elementwise_fusion_pass)
+{
+    auto f = make_elementwise_chain_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUElementwiseFusion>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::FusedElementwise>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Multiply>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Exp>(f), 1);
+
+    auto fused = as_type_ptr<op::FusedElementwise>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(fused);
+    EXPECT_EQ(fused->get_input_size(), 3);
+    EXPECT_EQ(fused->get_program().size(), 5);
+}
+
+TEST(cpu_fusion, elementwise_fusion_execute)
+{
+    auto cpu_f = make_elementwise_chain_function();
+    auto int_f = make_elementwise_chain_function();
+    test::Uniform<float> rng(1.0f, 4.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+    EXPECT_EQ(count_ops_of_type<op::FusedElementwise>(cpu_f), 1);
+}
+
+TEST(cpu_fusion, elementwise_fusion_sum)
+{
+    auto make_function = []() {
+        Shape shape{8, 3, 300};
+        auto x = std::make_shared<op::Parameter>(element::f32, shape);
+        auto b = std::make_shared<op::Parameter>(element::f32, Shape{300});
+        auto bias = std::make_shared<op::Broadcast>(b, shape, AxisSet{0, 1});
+        auto relu = std::make_shared<op::Relu>(std::make_shared<op::Multiply>(x, bias));
+        auto sum = std::make_shared<op::Sum>(relu, AxisSet{1, 2});
+        return make_shared<Function>(NodeVector{sum}, ParameterVector{x, b});
+    };
+
+    auto f = make_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUElementwiseFusion>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::FusedElementwise>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Sum>(f), 0);
+    auto fused = as_type_ptr<op::FusedElementwise>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(fused);
+    EXPECT_EQ(fused->get_reduction_axes(), (AxisSet{1, 2}));
+    EXPECT_EQ(fused->get_shape(), Shape{8});
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+    EXPECT_EQ(count_ops_of_type<op::FusedElementwise>(cpu_f), 1);
+}
+
+TEST(cpu_fusion, layer_norm_native)
+{
+    auto make_function = []() {
+        auto data = make_shared<op::Parameter>(element::f32, Shape{8, 3, 40});
+        auto scale = make_shared<op::Parameter>(element::f32, Shape{3, 40});
+        auto bias = make_shared<op::Parameter>(element::f32, Shape{3, 40});
+        auto ln = make_shared<op::LayerNorm>(data, scale, bias, true, 1, 1e-5);
+        return make_shared<Function>(ln->outputs(), ParameterVector{data, scale, bias});
+    };
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    test::Uniform<float> rng(-4.0f, 4.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+    // The CPU backend runs LayerNorm natively instead of decomposing it
+    EXPECT_EQ(count_ops_of_type<op::LayerNorm>(cpu_f), 1);
+}
+
+TEST(cpu_fusion, layer_norm_native_specialized_width)
+{
+    // 128 is one of the row lengths with a kernel specialized at compile time
+    auto make_function = []() {
+        auto data = make_shared<op::Parameter>(element::f32, Shape{6, 128});
+        auto scale = make_shared<op::Parameter>(element::f32, Shape{128});
+        auto bias = make_shared<op::Parameter>(element::f32, Shape{128});
+        auto ln = make_shared<op::LayerNorm>(data, scale, bias, true, 1, 1e-5);
+        return make_shared<Function>(ln->outputs(), ParameterVector{data, scale, bias});
+    };
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    test::Uniform<float> rng(-4.0f, 4.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_fusion, softmax_decomposed)
+{
+    auto make_function = []() {
+        Shape shape{16, 4, 33};
+        AxisSet axes{2};
+        auto input = make_shared<op::Parameter>(element::f32, shape);
+        auto max = make_shared<op::Broadcast>(make_shared<op::Max>(input, axes), shape, axes);
+        auto exp = make_shared<op::Exp>(input - max);
+        auto sum = make_shared<op::Broadcast>(make_shared<op::Sum>(exp, axes), shape, axes);
+        return make_shared<Function>(exp / sum, ParameterVector{input});
+    };
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    test::Uniform<float> rng(-20.0f, 20.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-6f));
+    EXPECT_EQ(count_ops_of_type<op::Softmax>(cpu_f), 1);
+}
+
+TEST(cpu_fusion, async_allreduce_overlap)
+{
+    Shape shape{32, 32};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    // The first gradient is ready long before the second
+    auto grad0 = make_shared<op::Multiply>(A, B);
+    auto allreduce0 = make_shared<op::AllReduce>(grad0);
+    auto dot = make_shared<op::Dot>(make_shared<op::Dot>(A, B), B);
+    auto grad1 = make_shared<op::Add>(dot, A);
+    auto allreduce1 = make_shared<op::AllReduce>(grad1);
+    auto f = make_shared<Function>(NodeVector{allreduce0, allreduce1}, ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUAsyncAllReduce>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::AllReduce>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::AllReduceStart>(f), 2);
+    ASSERT_EQ(count_ops_of_type<op::AllReduceWait>(f), 2);
+
+    // Both reductions start before either is waited on, and the first overlaps the Dots
+    map<Node*, size_t> position;
+    vector<size_t> starts;
+    vector<size_t> waits;
+    for (auto& node : f->get_ordered_ops())
+    {
+        size_t index = position.size();
+        position[node.get()] = index;
+        if (is_type<op::AllReduceStart>(node))
+        {
+            starts.push_back(index);
+        }
+        else if (is_type<op::AllReduceWait>(node))
+        {
+            waits.push_back(index);
+        }
+    }
+    ASSERT_EQ(starts.size(), 2);
+    ASSERT_EQ(waits.size(), 2);
+    EXPECT_LT(starts[1], waits[0]);
+    EXPECT_LT(starts[0], position.at(dot.get()));
+}
+
+TEST(cpu_fusion, async_broadcast_distributed)
+{
+    Shape shape{32, 32};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto broadcast0 = make_shared<op::BroadcastDistributed>(A);
+    auto broadcast1 = make_shared<op::BroadcastDistributed>(B);
+    auto f = make_shared<Function>(NodeVector{broadcast0, broadcast1}, ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUAsyncAllReduce>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::BroadcastDistributed>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::BroadcastDistributedStart>(f), 2);
+    ASSERT_EQ(count_ops_of_type<op::BroadcastDistributedWait>(f), 2);
+
+    // Both broadcasts are in flight before either is waited on
+    size_t last_start = 0;
+    size_t first_wait = 0;
+    size_t index = 0;
+    for (auto& node : f->get_ordered_ops())
+    {
+        if (is_type<op::BroadcastDistributedStart>(node))
+        {
+            last_start = index;
+        }
+        else if (is_type<op::BroadcastDistributedWait>(node) && first_wait == 0)
+        {
+            first_wait = index;
+        }
+        index++;
+    }
+    EXPECT_LT(last_start, first_wait);
+}
+
+static shared_ptr<Function> make_sparse_dot_function(float density)
+{
+    Shape weights_shape{128, 64};
+    vector<float> weights(shape_size(weights_shape), 0.0f);
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    rng.initialize(weights);
+    size_t stride = static_cast<size_t>(1.0f / density);
+    for (size_t i = 0; i < weights.size(); i++)
+    {
+        if (i % stride != 0)
+        {
+            weights[i] = 0.0f;
+        }
+    }
+
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3, 128});
+    auto W = op::Constant::create(element::f32, weights_shape, weights);
+    auto dot = make_shared<op::Dot>(A, W);
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2, 3, 64});
+    return make_shared<Function>(make_shared<op::Add>(dot, B), ParameterVector{A, B});
+}
+
+TEST(cpu_fusion, sparse_dot_pass)
+{
+    auto sparse_f = make_sparse_dot_function(0.05f);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUSparseDot>(0.9);
+    pass_manager.run_passes(sparse_f);
+    EXPECT_EQ(count_ops_of_type<op::SparseDot>(sparse_f), 1);
+    EXPECT_EQ(count_ops_of_type<op::Dot>(sparse_f), 0);
+
+    auto dense_f = make_sparse_dot_function(0.5f);
+    pass_manager.run_passes(dense_f);
+    EXPECT_EQ(count_ops_of_type<op::SparseDot>(dense_f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Dot>(dense_f), 1);
+}
+
+TEST(cpu_fusion, sparse_dot_execute)
+{
+    auto cpu_f = make_sparse_dot_function(0.05f);
+    auto int_f = make_sparse_dot_function(0.05f);
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+    EXPECT_EQ(count_ops_of_type<op::SparseDot>(cpu_f), 1);
+}
+
+TEST(cpu_fusion, dequantizing_dot_execute)
+{
+    for (auto type : {element::i8, element::f16})
+    {
+        auto cpu_f = make_sparse_dot_function(1.0f);
+        auto int_f = make_sparse_dot_function(1.0f);
+        pass::Manager pass_manager;
+        pass_manager.register_pass<runtime::cpu::pass::CPUDequantizingDot>(type);
+        pass_manager.run_passes(cpu_f);
+        ASSERT_EQ(count_ops_of_type<op::DequantizingDot>(cpu_f), 1);
+
+        test::Uniform<float> rng(-1.0f, 1.0f);
+        vector<vector<float>> args;
+        for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+        {
+            vector<float> tensor_val(shape_size(param->get_shape()));
+            rng.initialize(tensor_val);
+            args.push_back(tensor_val);
+        }
+
+        auto int_results = execute(int_f, args, "INTERPRETER");
+        auto cpu_results = execute(cpu_f, args, "CPU");
+        EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 5.0e-2f, 5.0e-2f));
+    }
+}
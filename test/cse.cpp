@@ -23,6 +23,7 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/multiply.hpp"
@@ -335,6 +336,24 @@ TEST(CSE, one_hot)
     }
 }
 
+TEST(CSE, attributes)
+{
+    Shape shape{2, 2};
+    auto A = std::make_shared<op::Parameter>(element::i32, shape);
+    auto B = std::make_shared<op::Parameter>(element::i32, shape);
+    auto concat1 = std::make_shared<op::Concat>(NodeVector{A, B}, 0);
+    auto concat2 = std::make_shared<op::Concat>(NodeVector{A, B}, 0);
+    auto concat3 = std::make_shared<op::Concat>(NodeVector{A, B}, 1);
+    auto f = std::make_shared<Function>(NodeVector{concat1, concat2, concat3},
+                                        ParameterVector{A, B});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+    ASSERT_NE(f->get_results().at(0)->get_argument(0), f->get_results().at(2)->get_argument(0));
+}
+
 TEST(CSE, pass_property)
 {
     auto pass = std::make_shared<ngraph::pass::CommonSubexpressionElimination>();
@@ -24,6 +24,8 @@
 #include "gtest/gtest.h"
 #include "ngraph/event_tracing.hpp"
 #include "ngraph/file_util.hpp"
+#include "ngraph/runtime/chrome_trace.hpp"
+#include "ngraph/runtime/trace_buffer.hpp"
 
 using namespace std;
 
@@ -111,3 +113,61 @@ TEST(event_tracing, event_writer_callback)
         EXPECT_EQ(expected_event_key->second->get_stop(), next_event.get_stop());
     }
 }
+
+TEST(event_tracing, trace_buffer_drops_when_full)
+{
+    ngraph::runtime::event::TraceBuffer buffer(3);
+    ASSERT_EQ(buffer.get_capacity(), 4);
+    for (uint64_t i = 0; i < 6; i++)
+    {
+        EXPECT_EQ(buffer.push({i, 1, 0, 0}), i < 4);
+    }
+    EXPECT_EQ(buffer.get_dropped(), 2);
+
+    vector<uint64_t> starts;
+    auto collect = [&](const ngraph::runtime::event::TraceRecord& r) { starts.push_back(r.start); };
+    EXPECT_EQ(buffer.drain(collect), 4);
+    EXPECT_EQ(starts, (vector<uint64_t>{0, 1, 2, 3}));
+
+    // The ring wraps around once drained
+    EXPECT_TRUE(buffer.push({4, 1, 0, 0}));
+    starts.clear();
+    EXPECT_EQ(buffer.drain(collect), 1);
+    EXPECT_EQ(starts, (vector<uint64_t>{4}));
+}
+
+TEST(event_tracing, buffered_duration_file)
+{
+    namespace event = ngraph::runtime::event;
+    event::Manager::enable_event_tracing();
+    vector<thread> threads;
+    for (int i = 0; i < 4; i++)
+    {
+        threads.emplace_back([] {
+            for (int j = 0; j < 10; j++)
+            {
+                event::Duration d("buffered_duration", "Test");
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    event::Manager::disable_event_tracing();
+    event::Manager::close();
+
+    auto trace = nlohmann::json::parse(
+        ngraph::file_util::read_file_to_string("runtime_event_trace.json"));
+    size_t count = 0;
+    for (auto& e : trace)
+    {
+        if (e["name"] == "buffered_duration")
+        {
+            EXPECT_EQ(e["cat"], "Test");
+            EXPECT_EQ(e["ph"], "X");
+            count++;
+        }
+    }
+    EXPECT_EQ(count, 40);
+}
@@ -0,0 +1,80 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static shared_ptr<Function> make_conv(const Strides& strides, float bias)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{1, 3, 8, 8});
+    auto filters = make_shared<op::Parameter>(element::f32, Shape{4, 3, 3, 3});
+    auto conv = make_shared<op::Convolution>(
+        data, filters, strides, Strides{1, 1}, CoordinateDiff{0, 0}, CoordinateDiff{0, 0});
+    auto b = op::Constant::create(element::f32, conv->get_shape(), {bias});
+    return make_shared<Function>(make_shared<op::Add>(conv, b), ParameterVector{data, filters});
+}
+
+TEST(fingerprint, same_graph)
+{
+    auto f = make_conv(Strides{1, 1}, 0.5f);
+    auto g = make_conv(Strides{1, 1}, 0.5f);
+    g->set_friendly_name("another name");
+    EXPECT_EQ(f->get_fingerprint(), g->get_fingerprint());
+    EXPECT_EQ(f->get_fingerprint(), f->get_fingerprint());
+}
+
+TEST(fingerprint, attributes)
+{
+    // Convolution is hashed through the serializer, Concat through visit_attributes
+    EXPECT_NE(make_conv(Strides{1, 1}, 0.5f)->get_fingerprint(),
+              make_conv(Strides{2, 2}, 0.5f)->get_fingerprint());
+
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto f = make_shared<Function>(make_shared<op::Concat>(NodeVector{A, B}, 0),
+                                   ParameterVector{A, B});
+    auto g = make_shared<Function>(make_shared<op::Concat>(NodeVector{A, B}, 1),
+                                   ParameterVector{A, B});
+    EXPECT_NE(f->get_fingerprint(), g->get_fingerprint());
+}
+
+TEST(fingerprint, topology)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto f = make_shared<Function>(make_shared<op::Subtract>(A, B), ParameterVector{A, B});
+    auto g = make_shared<Function>(make_shared<op::Subtract>(B, A), ParameterVector{A, B});
+    auto h = make_shared<Function>(make_shared<op::Subtract>(A, B), ParameterVector{B, A});
+    EXPECT_NE(f->get_fingerprint(), g->get_fingerprint());
+    EXPECT_NE(f->get_fingerprint(), h->get_fingerprint());
+    EXPECT_EQ(g->get_fingerprint(), h->get_fingerprint());
+}
+
+TEST(fingerprint, constant_data)
+{
+    auto f = make_conv(Strides{1, 1}, 0.5f);
+    auto g = make_conv(Strides{1, 1}, 0.25f);
+    EXPECT_NE(f->get_fingerprint(), g->get_fingerprint());
+    EXPECT_EQ(f->get_fingerprint(false), g->get_fingerprint(false));
+    EXPECT_NE(f->get_fingerprint(), f->get_fingerprint(false));
+}
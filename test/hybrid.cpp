@@ -0,0 +1,177 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <functional>
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/hybrid/hybrid_executable.hpp"
+#include "util/all_close_f.hpp"
+#include "util/random.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+namespace
+{
+    // An INTERPRETER that claims to support only some ops, standing in for an accelerator
+    class RestrictedBackend : public runtime::Backend
+    {
+    public:
+        RestrictedBackend(function<bool(const Node&)> supported)
+            : m_backend(runtime::Backend::create("INTERPRETER"))
+            , m_supported(supported)
+        {
+        }
+
+        shared_ptr<runtime::Tensor> create_tensor(const element::Type& element_type,
+                                                  const Shape& shape) override
+        {
+            return m_backend->create_tensor(element_type, shape);
+        }
+
+        shared_ptr<runtime::Tensor> create_tensor(const element::Type& element_type,
+                                                  const Shape& shape,
+                                                  void* memory_pointer) override
+        {
+            return m_backend->create_tensor(element_type, shape, memory_pointer);
+        }
+
+        shared_ptr<runtime::Executable> compile(shared_ptr<Function> func,
+                                                bool enable_performance_data = false) override
+        {
+            for (auto& node : func->get_ops())
+            {
+                if (!node->is_parameter() && !node->is_output() && !node->is_constant())
+                {
+                    EXPECT_TRUE(m_supported(*node)) << node->get_name();
+                }
+            }
+            return m_backend->compile(func, enable_performance_data);
+        }
+
+        bool is_supported(const Node& node) const override { return m_supported(node); }
+    private:
+        shared_ptr<runtime::Backend> m_backend;
+        function<bool(const Node&)> m_supported;
+    };
+}
+
+static shared_ptr<runtime::Backend> make_dot_backend()
+{
+    return make_shared<RestrictedBackend>([](const Node& node) { return is_type<op::Dot>(&node); });
+}
+
+// Dot -> Relu -> Dot -> Add, alternating between the two backends
+static shared_ptr<Function> make_alternating_function()
+{
+    Shape shape{32, 32};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto dot = make_shared<op::Dot>(A, B);
+    auto relu = make_shared<op::Relu>(dot);
+    auto dot2 = make_shared<op::Dot>(relu, B);
+    auto add = make_shared<op::Add>(dot2, relu);
+    return make_shared<Function>(NodeVector{add, dot}, ParameterVector{A, B});
+}
+
+TEST(hybrid, assign_placement_by_support)
+{
+    auto f = make_alternating_function();
+    vector<shared_ptr<runtime::Backend>> backends{make_dot_backend(),
+                                                  runtime::Backend::create("INTERPRETER")};
+    auto segment_backends = runtime::hybrid::assign_placement(f, backends);
+    EXPECT_EQ(segment_backends, (vector<size_t>{0, 1, 0, 1}));
+
+    auto partition = partition_by_placement(f);
+    ASSERT_EQ(partition.stages.size(), 4);
+    EXPECT_EQ(count_ops_of_type<op::Dot>(partition.stages[0]), 1);
+    EXPECT_EQ(count_ops_of_type<op::Relu>(partition.stages[1]), 1);
+    EXPECT_EQ(count_ops_of_type<op::Dot>(partition.stages[2]), 1);
+    EXPECT_EQ(count_ops_of_type<op::Add>(partition.stages[3]), 1);
+}
+
+TEST(hybrid, assign_placement_keeps_light_ops)
+{
+    Shape shape{1000};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto abs = make_shared<op::Abs>(A);
+    auto neg = make_shared<op::Negative>(abs);
+    auto f = make_shared<Function>(neg, ParameterVector{A});
+
+    // The first backend supports Negative, but moving it there would copy more bytes than
+    // it computes
+    vector<shared_ptr<runtime::Backend>> backends{
+        make_shared<RestrictedBackend>(
+            [](const Node& node) { return is_type<op::Negative>(&node); }),
+        runtime::Backend::create("INTERPRETER")};
+    EXPECT_EQ(runtime::hybrid::assign_placement(f, backends), (vector<size_t>{1}));
+
+    // Unless the threshold says any op is worth moving
+    EXPECT_EQ(runtime::hybrid::assign_placement(f, backends, 0), (vector<size_t>{1, 0}));
+}
+
+TEST(hybrid, executable_matches_single_backend)
+{
+    auto f = make_alternating_function();
+    auto host = runtime::Backend::create("INTERPRETER");
+    auto hybrid = make_shared<runtime::hybrid::HybridExecutable>(
+        f, vector<shared_ptr<runtime::Backend>>{make_dot_backend(), host});
+    EXPECT_EQ(hybrid->get_segment_backends().size(), 4);
+    auto reference = host->compile(f);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    auto make_call = [&]() {
+        vector<shared_ptr<runtime::Tensor>> inputs;
+        for (auto& parameter : f->get_parameters())
+        {
+            auto tensor =
+                host->create_tensor(parameter->get_element_type(), parameter->get_shape());
+            rng.initialize(tensor);
+            inputs.push_back(tensor);
+        }
+        vector<shared_ptr<runtime::Tensor>> outputs;
+        vector<shared_ptr<runtime::Tensor>> expected;
+        for (auto& result : f->get_results())
+        {
+            auto& type = result->get_element_type();
+            outputs.push_back(host->create_tensor(type, result->get_shape()));
+            expected.push_back(host->create_tensor(type, result->get_shape()));
+        }
+        return make_tuple(inputs, outputs, expected);
+    };
+
+    // More calls in flight than the pipeline depth
+    vector<decltype(make_call())> calls;
+    vector<future<bool>> futures;
+    for (size_t i = 0; i < 5; i++)
+    {
+        calls.push_back(make_call());
+        futures.push_back(hybrid->call_async(get<1>(calls.back()), get<0>(calls.back())));
+    }
+    for (size_t i = 0; i < calls.size(); i++)
+    {
+        EXPECT_TRUE(futures[i].get());
+        reference->call_with_validate(get<2>(calls[i]), get<0>(calls[i]));
+        for (size_t j = 0; j < f->get_results().size(); j++)
+        {
+            EXPECT_TRUE(test::all_close_f(read_vector<float>(get<2>(calls[i])[j]),
+                                          read_vector<float>(get<1>(calls[i])[j])));
+        }
+    }
+}
@@ -0,0 +1,89 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/metrics.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(metrics, counter_gauge_histogram)
+{
+    runtime::metrics::Registry registry;
+    auto& counter = registry.get_counter("test_calls_total", "Calls", "backend=\"A\"");
+    counter.increment();
+    counter.increment(2);
+    EXPECT_EQ(counter.get_value(), 3);
+    EXPECT_EQ(&registry.get_counter("test_calls_total", "Calls", "backend=\"A\""), &counter);
+    EXPECT_NE(&registry.get_counter("test_calls_total", "Calls", "backend=\"B\""), &counter);
+
+    auto& gauge = registry.get_gauge("test_bytes", "Bytes");
+    gauge.add(10);
+    gauge.add(-4);
+    EXPECT_EQ(gauge.get_value(), 6);
+
+    auto& histogram = registry.get_histogram("test_seconds", "Seconds", "", {1, 2});
+    histogram.observe(0.5);
+    histogram.observe(1.5);
+    histogram.observe(3);
+    EXPECT_EQ(histogram.get_cumulative_counts(), (vector<uint64_t>{1, 2, 3}));
+    EXPECT_DOUBLE_EQ(histogram.get_sum(), 5);
+    EXPECT_EQ(histogram.get_count(), 3);
+
+    EXPECT_THROW(registry.get_gauge("test_calls_total", "Calls"), ngraph_error);
+
+    stringstream ss;
+    registry.write_prometheus(ss);
+    string text = ss.str();
+    EXPECT_NE(text.find("# TYPE test_calls_total counter\n"), string::npos);
+    EXPECT_NE(text.find("test_calls_total{backend=\"A\"} 3\n"), string::npos);
+    EXPECT_NE(text.find("test_calls_total{backend=\"B\"} 0\n"), string::npos);
+    EXPECT_NE(text.find("test_bytes 6\n"), string::npos);
+    EXPECT_NE(text.find("test_seconds_bucket{le=\"2\"} 2\n"), string::npos);
+    EXPECT_NE(text.find("test_seconds_bucket{le=\"+Inf\"} 3\n"), string::npos);
+    EXPECT_NE(text.find("test_seconds_count 3\n"), string::npos);
+}
+
+TEST(metrics, executable_calls)
+{
+    auto& registry = runtime::metrics::Registry::get_default();
+    auto& calls = registry.get_counter(
+        "ngraph_executable_calls_total", "Executable::call invocations", "backend=\"INTERPRETER\"");
+    auto& latency = registry.get_histogram("ngraph_executable_call_seconds",
+                                           "Executable::call latency in seconds",
+                                           "backend=\"INTERPRETER\"");
+    uint64_t calls_before = calls.get_value();
+    uint64_t latency_before = latency.get_count();
+
+    Shape shape{2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Negative>(A), ParameterVector{A});
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    auto exec = backend->compile(f);
+    exec->call_with_validate({result}, {a});
+    exec->call_with_validate({result}, {a});
+
+    EXPECT_EQ(calls.get_value() - calls_before, 2);
+    EXPECT_EQ(latency.get_count() - latency_before, 2);
+}
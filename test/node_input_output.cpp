@@ -111,3 +111,28 @@ TEST(node_input_output, output_create_const)
 
     EXPECT_THROW(add->output(1), std::out_of_range);
 }
+
+TEST(node_input_output, inputs_past_inline_storage)
+{
+    ParameterVector params;
+    OutputVector args;
+    for (size_t i = 0; i < 8; i++)
+    {
+        params.push_back(make_shared<op::Parameter>(element::f32, Shape{2}));
+        args.push_back(params.back());
+    }
+    auto concat = make_shared<op::Concat>(args, 0);
+
+    ASSERT_EQ(concat->get_input_size(), 8);
+    for (size_t i = 0; i < 8; i++)
+    {
+        EXPECT_EQ(concat->input(i).get_source_output(), Output<Node>(params[i], 0));
+        EXPECT_EQ(params[i]->output(0).get_target_inputs().count(concat->input(i)), 1);
+    }
+
+    // Rewiring an input stored past the inline part updates both ends of the edge
+    concat->input(6).replace_source_output(params[0]);
+    EXPECT_EQ(concat->input(6).get_source_output(), Output<Node>(params[0], 0));
+    EXPECT_EQ(params[0]->output(0).get_target_inputs().size(), 2);
+    EXPECT_TRUE(params[6]->output(0).get_target_inputs().empty());
+}
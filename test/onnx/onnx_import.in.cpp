@@ -105,6 +105,22 @@ NGRAPH_TEST(onnx_${BACKEND_NAME}, model_binary_add_abc)
     EXPECT_TRUE(test::all_close_f(expected_outputs.front(), outputs.front()));
 }
 
+NGRAPH_TEST(onnx_${BACKEND_NAME}, model_add_abc_from_memory)
+{
+    for (const std::string model : {"onnx/add_abc.onnx", "onnx/add_abc.prototxt"})
+    {
+        const std::string data =
+            file_util::read_file_to_string(file_util::path_join(SERIALIZED_ZOO, model));
+        auto function = onnx_import::import_onnx_model(data.data(), data.size());
+
+        Inputs inputs{{1}, {2}, {3}};
+        Outputs expected_outputs{{6}};
+
+        Outputs outputs{execute(function, inputs, "${BACKEND_NAME}")};
+        EXPECT_TRUE(test::all_close_f(expected_outputs.front(), outputs.front()));
+    }
+}
+
 NGRAPH_TEST(onnx_${BACKEND_NAME}, model_add_abc_initializers)
 {
     auto function = onnx_import::import_onnx_model(
@@ -117,6 +133,18 @@ NGRAPH_TEST(onnx_${BACKEND_NAME}, model_add_abc_initializers)
     EXPECT_TRUE(test::all_close_f(expected_outputs.front(), outputs.front()));
 }
 
+NGRAPH_TEST(onnx_${BACKEND_NAME}, model_add_abc_external_data)
+{
+    auto function = onnx_import::import_onnx_model(file_util::path_join(
+        SERIALIZED_ZOO, "onnx/external_data/add_abc_initializers.prototxt"));
+
+    Inputs inputs{{1, 2, 3, 4}};
+    Outputs expected_outputs{{3, 6, 9, 12}};
+
+    Outputs outputs{execute(function, inputs, "${BACKEND_NAME}")};
+    EXPECT_TRUE(test::all_close_f(expected_outputs.front(), outputs.front()));
+}
+
 NGRAPH_TEST(onnx_${BACKEND_NAME}, model_override_op)
 {
     onnx_import::register_operator(
@@ -19,6 +19,7 @@
 #include <gtest/gtest.h>
 #include <onnx/onnxifi.h>
 
+#include "ngraph/file_util.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 
 // ===============================================[ onnxGetBackendIDs ] =======
@@ -68,3 +69,101 @@ TEST(onnxifi, get_backend_ids_consistency_check)
     EXPECT_TRUE(first_count == second_count);
     EXPECT_TRUE(std::memcmp(first_ids, second_ids, first_count) == 0);
 }
+
+// ==========================================[ onnxInitEvent, onnxSignalEvent ] =======
+
+TEST(onnxifi, signal_wait_event)
+{
+    ::onnxBackendID backendIDs[g_default_backend_ids_count];
+    std::size_t count{g_default_backend_ids_count};
+    ASSERT_TRUE(::onnxGetBackendIDs(backendIDs, &count) == ONNXIFI_STATUS_SUCCESS);
+    ASSERT_TRUE(count > 0);
+    ::onnxBackend backend;
+    ASSERT_TRUE(::onnxInitBackend(backendIDs[0], nullptr, &backend) == ONNXIFI_STATUS_SUCCESS);
+
+    ::onnxEvent event;
+    EXPECT_TRUE(::onnxInitEvent(backend, &event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxSignalEvent(event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxSignalEvent(event) == ONNXIFI_STATUS_INVALID_STATE);
+    EXPECT_TRUE(::onnxWaitEvent(event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxReleaseEvent(event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxReleaseEvent(event) == ONNXIFI_STATUS_INVALID_EVENT);
+    EXPECT_TRUE(::onnxReleaseBackend(backend) == ONNXIFI_STATUS_SUCCESS);
+}
+
+// ==============================[ onnxInitGraph, onnxSetGraphIO, onnxRunGraph ] =======
+
+namespace
+{
+    ::onnxTensorDescriptorV1 make_descriptor(const char* name, const uint64_t* shape, float* data)
+    {
+        ::onnxTensorDescriptorV1 descriptor;
+        descriptor.tag = ONNXIFI_TAG_TENSOR_DESCRIPTOR_V1;
+        descriptor.name = name;
+        descriptor.dataType = ONNXIFI_DATATYPE_FLOAT32;
+        descriptor.memoryType = ONNXIFI_MEMORY_TYPE_CPU;
+        descriptor.dimensions = 1;
+        descriptor.shape = shape;
+        descriptor.buffer = reinterpret_cast<::onnxPointer>(data);
+        return descriptor;
+    }
+}
+
+TEST(onnxifi, run_graph_with_event_fences)
+{
+    const std::vector<char> model{ngraph::file_util::read_file_contents(
+        ngraph::file_util::path_join(SERIALIZED_ZOO, "onnx/add_abc.onnx"))};
+    ::onnxBackendID backendIDs[g_default_backend_ids_count];
+    std::size_t count{g_default_backend_ids_count};
+    ASSERT_TRUE(::onnxGetBackendIDs(backendIDs, &count) == ONNXIFI_STATUS_SUCCESS);
+
+    // Backends can not be told apart, and some do not compute, so every backend is run and
+    // at least one of them must produce the sum
+    std::size_t computed{0};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        ::onnxBackend backend;
+        ASSERT_TRUE(::onnxInitBackend(backendIDs[i], nullptr, &backend) ==
+                    ONNXIFI_STATUS_SUCCESS);
+        ::onnxGraph graph;
+        ASSERT_TRUE(::onnxInitGraph(
+                        backend, nullptr, model.size(), model.data(), 0, nullptr, &graph) ==
+                    ONNXIFI_STATUS_SUCCESS);
+
+        const uint64_t shape[]{1};
+        float a{1}, b{2}, c{3}, y{0};
+        const ::onnxTensorDescriptorV1 inputs[]{make_descriptor("A", shape, &a),
+                                                make_descriptor("B", shape, &b),
+                                                make_descriptor("C", shape, &c)};
+        const ::onnxTensorDescriptorV1 outputs[]{make_descriptor("Y", shape, &y)};
+        const ::onnxTensorDescriptorV1 unknown[]{make_descriptor("Z", shape, &y)};
+        EXPECT_TRUE(::onnxSetGraphIO(graph, 3, inputs, 1, unknown) ==
+                    ONNXIFI_STATUS_UNIDENTIFIED_NAME);
+        ASSERT_TRUE(::onnxSetGraphIO(graph, 3, inputs, 1, outputs) == ONNXIFI_STATUS_SUCCESS);
+
+        ::onnxMemoryFenceV1 input_fence;
+        input_fence.tag = ONNXIFI_TAG_MEMORY_FENCE_V1;
+        input_fence.type = ONNXIFI_SYNCHRONIZATION_EVENT;
+        ASSERT_TRUE(::onnxInitEvent(backend, &input_fence.event) == ONNXIFI_STATUS_SUCCESS);
+        ::onnxMemoryFenceV1 output_fence;
+        output_fence.tag = ONNXIFI_TAG_MEMORY_FENCE_V1;
+        output_fence.type = ONNXIFI_SYNCHRONIZATION_EVENT;
+        ASSERT_TRUE(::onnxRunGraph(graph, &input_fence, &output_fence) ==
+                    ONNXIFI_STATUS_SUCCESS);
+
+        // The run waits for the input fence
+        EXPECT_TRUE(y == 0);
+        EXPECT_TRUE(::onnxSignalEvent(input_fence.event) == ONNXIFI_STATUS_SUCCESS);
+        EXPECT_TRUE(::onnxWaitEvent(output_fence.event) == ONNXIFI_STATUS_SUCCESS);
+        if (y == a + b + c)
+        {
+            ++computed;
+        }
+
+        EXPECT_TRUE(::onnxReleaseEvent(input_fence.event) == ONNXIFI_STATUS_SUCCESS);
+        EXPECT_TRUE(::onnxReleaseEvent(output_fence.event) == ONNXIFI_STATUS_SUCCESS);
+        EXPECT_TRUE(::onnxReleaseGraph(graph) == ONNXIFI_STATUS_SUCCESS);
+        EXPECT_TRUE(::onnxReleaseBackend(backend) == ONNXIFI_STATUS_SUCCESS);
+    }
+    EXPECT_TRUE(computed > 0);
+}
@@ -23,6 +23,7 @@
 
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "util/test_tools.hpp"
 
@@ -67,3 +68,46 @@ TEST(pass_manager, serialize_with_revalidate_does_not_crash)
     auto graph = make_test_graph();
     pass_manager.run_passes(graph);
 }
+
+TEST(pass_manager, pass_report)
+{
+    auto a = op::Constant::create(element::f32, Shape{2}, {1, 2});
+    auto b = op::Constant::create(element::f32, Shape{2}, {3, 4});
+    auto f = make_shared<Function>(make_shared<op::Add>(a, b), ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.set_per_pass_validation(false);
+    pass_manager.register_pass<pass::ConstantFolding>();
+    auto& report = pass_manager.run_passes(f);
+
+    ASSERT_EQ(report.size(), 1);
+    EXPECT_NE(report[0].name.find("ConstantFolding"), string::npos);
+    EXPECT_EQ(report[0].nodes_before, 4);
+    EXPECT_EQ(report[0].nodes_after, 2);
+    EXPECT_EQ(report[0].constant_bytes_before, 16);
+    EXPECT_EQ(report[0].constant_bytes_after, 8);
+}
+
+TEST(pass_manager, validate_changed_nodes)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto abs = make_shared<op::Abs>(a);
+    auto neg = make_shared<op::Negative>(abs);
+    auto other = make_shared<op::Negative>(a);
+    auto f = make_shared<Function>(NodeVector{neg, other}, ParameterVector{a});
+    EXPECT_FALSE(abs->get_needs_revalidation());
+
+    auto b = make_shared<op::Parameter>(element::f32, Shape{3});
+    abs->input(0).replace_source_output(b);
+    f->replace_parameter(0, b);
+    EXPECT_TRUE(abs->get_needs_revalidation());
+    EXPECT_FALSE(neg->get_needs_revalidation());
+
+    f->validate_changed_nodes_and_infer_types();
+    EXPECT_FALSE(abs->get_needs_revalidation());
+    EXPECT_FALSE(neg->get_needs_revalidation());
+    EXPECT_EQ(abs->get_shape(), (Shape{3}));
+    EXPECT_EQ(neg->get_shape(), (Shape{3}));
+    // Nodes that do not depend on the replaced input are not revalidated
+    EXPECT_EQ(other->get_shape(), (Shape{2}));
+}
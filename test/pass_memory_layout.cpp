@@ -214,7 +214,9 @@ TEST(memory_layout, basic)
     pass_manager.run_passes(graph);
     auto sorted = graph->get_ordered_ops();
     size_t temporary_pool_size = graph->get_temporary_pool_size();
-    EXPECT_EQ(12, temporary_pool_size);
+    // The elementwise ops reuse the buffer of an input that dies with them, only t0 and t1
+    // are live at the same time
+    EXPECT_EQ(8, temporary_pool_size);
 }
 
 TEST(memory_layout, constant)
@@ -232,3 +234,71 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+TEST(memory_packer, fragmentation)
+{
+    // First fit leaves the 8 byte hole of a unusable for c
+    pass::MemoryManager mm;
+    size_t a = mm.allocate(8);
+    size_t b = mm.allocate(32);
+    mm.free(a);
+    size_t c = mm.allocate(16);
+    mm.free(b);
+    mm.allocate(32);
+    mm.free(c);
+    EXPECT_EQ(56, mm.max_allocated());
+
+    pass::MemoryPacker packer;
+    a = packer.allocate(8);
+    b = packer.allocate(32);
+    packer.free(a);
+    c = packer.allocate(16);
+    packer.free(b);
+    size_t d = packer.allocate(32);
+    packer.free(c);
+    EXPECT_EQ(48, packer.pack());
+    EXPECT_EQ(48, packer.lower_bound());
+    EXPECT_EQ(0, packer.get_offset(b));
+    EXPECT_EQ(0, packer.get_offset(d));
+    EXPECT_EQ(32, packer.get_offset(c));
+    EXPECT_EQ(32, packer.get_offset(a));
+    EXPECT_THROW(packer.free(c), runtime_error);
+}
+
+TEST(memory_layout, packed)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(
+        1, false, pass::MemoryManager::allocation_scheme::PACKED);
+
+    auto graph = make_test_graph();
+    pass_manager.run_passes(graph);
+    EXPECT_EQ(8, graph->get_temporary_pool_size());
+}
+
+TEST(memory_layout, in_place_elementwise)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>();
+
+    auto x = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto y = make_shared<op::Parameter>(element::f32, Shape{1});
+    auto a = make_shared<op::Exp>(x);
+    auto b = make_shared<op::Negative>(a);
+    auto c = make_shared<op::Add>(b, x);
+    // s dies at d but is implicitly broadcast, so d needs its own buffer
+    auto s = make_shared<op::Negative>(y);
+    auto d = make_shared<op::Add>(s, c, op::AutoBroadcastSpec::NUMPY);
+    auto f = make_shared<Function>(NodeVector{d, c}, ParameterVector{x, y});
+    pass_manager.run_passes(f);
+
+    auto offset = [](const shared_ptr<Node>& node) {
+        return node->output(0).get_tensor().get_pool_offset();
+    };
+    EXPECT_EQ(offset(b), offset(a));
+    EXPECT_EQ(offset(c), offset(a));
+    EXPECT_NE(offset(d), offset(s));
+    EXPECT_NE(offset(d), offset(c));
+}
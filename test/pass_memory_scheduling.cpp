@@ -0,0 +1,65 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_scheduling.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static size_t get_position(const shared_ptr<Function>& f, const shared_ptr<Node>& node)
+{
+    size_t position = 0;
+    for (auto& op : f->get_ordered_ops())
+    {
+        if (op == node)
+        {
+            break;
+        }
+        position++;
+    }
+    return position;
+}
+
+TEST(memory_scheduling, large_temporary_first)
+{
+    Shape shape{1024};
+    auto p = make_shared<op::Parameter>(element::f32, Shape{});
+    auto q = make_shared<op::Parameter>(element::f32, shape);
+    // Holds 4 KiB with no temporaries
+    auto held = make_shared<op::Broadcast>(p, shape, AxisSet{0});
+    // Needs a 16 KiB temporary to produce 4 KiB
+    auto wide = make_shared<op::Broadcast>(q, Shape{4, 1024}, AxisSet{0});
+    auto sum = make_shared<op::Sum>(wide, AxisSet{0});
+    auto f = make_shared<Function>(make_shared<op::Add>(held, sum), ParameterVector{p, q});
+
+    EXPECT_LT(get_position(f, held), get_position(f, wide));
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::MemoryScheduling>();
+    pass_manager.run_passes(f);
+
+    EXPECT_LT(get_position(f, sum), get_position(f, held));
+    EXPECT_EQ(f->get_ordered_ops().size(), 7);
+
+    auto clone = clone_function(*f);
+    EXPECT_TRUE(static_cast<bool>(clone->get_topological_sort()));
+}
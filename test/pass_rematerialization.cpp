@@ -0,0 +1,85 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/rematerialization.hpp"
+
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(rematerialization, recompute_across_peak)
+{
+    Shape shape{1024};
+    auto x = make_shared<op::Parameter>(element::f32, shape);
+    auto a = make_shared<op::Relu>(x);
+    auto b = make_shared<op::Exp>(a);
+    auto wide = make_shared<op::Broadcast>(b, Shape{4, 1024}, AxisSet{0});
+    auto s = make_shared<op::Sum>(wide, AxisSet{0});
+    auto e = make_shared<op::Multiply>(s, a);
+    auto f = make_shared<Function>(e, ParameterVector{x});
+
+    // a, b and wide are live together: 24 KiB. Recomputing a after the Sum leaves 20 KiB.
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Rematerialization>(20 * 1024);
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::Relu>(f), 2);
+    EXPECT_EQ(b->get_argument(0), a);
+    auto recomputed = e->get_argument(1);
+    ASSERT_TRUE(is_type<op::Relu>(recomputed));
+    EXPECT_NE(recomputed, a);
+    EXPECT_EQ(recomputed->get_argument(0), x);
+
+    size_t position = 0;
+    size_t sum_position = 0;
+    size_t recomputed_position = 0;
+    for (auto& node : f->get_ordered_ops())
+    {
+        if (node == s)
+        {
+            sum_position = position;
+        }
+        else if (node == recomputed)
+        {
+            recomputed_position = position;
+        }
+        position++;
+    }
+    EXPECT_GT(recomputed_position, sum_position);
+}
+
+TEST(rematerialization, within_budget)
+{
+    Shape shape{1024};
+    auto x = make_shared<op::Parameter>(element::f32, shape);
+    auto a = make_shared<op::Relu>(x);
+    auto b = make_shared<op::Exp>(a);
+    auto e = make_shared<op::Multiply>(b, a);
+    auto f = make_shared<Function>(e, ParameterVector{x});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Rematerialization>(1024 * 1024);
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::Relu>(f), 1);
+}
@@ -0,0 +1,137 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/tensor_iterator_hoisting.hpp"
+
+#include "util/all_close_f.hpp"
+#include "util/random.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// A simple RNN over the four rows of X: H = tanh(X_t W^T + H R + b)
+static shared_ptr<Function> make_rnn()
+{
+    auto X = make_shared<op::Parameter>(element::f32, Shape{4, 2, 3});
+    auto H_init = make_shared<op::Parameter>(element::f32, Shape{2, 5});
+    auto W = make_shared<op::Parameter>(element::f32, Shape{5, 3});
+    auto R = make_shared<op::Parameter>(element::f32, Shape{5, 5});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{5});
+
+    auto Xi = make_shared<op::Parameter>(element::f32, Shape{1, 2, 3});
+    auto Hi = make_shared<op::Parameter>(element::f32, Shape{2, 5});
+    auto Wi = make_shared<op::Parameter>(element::f32, Shape{5, 3});
+    auto Ri = make_shared<op::Parameter>(element::f32, Shape{5, 5});
+    auto Bi = make_shared<op::Parameter>(element::f32, Shape{5});
+    auto x = make_shared<op::Reshape>(Xi, AxisVector{0, 1, 2}, Shape{2, 3});
+    auto w = make_shared<op::Reshape>(Wi, AxisVector{1, 0}, Shape{3, 5});
+    auto b = make_shared<op::Broadcast>(Bi, Shape{2, 5}, AxisSet{0});
+    auto sum = make_shared<op::Add>(make_shared<op::Dot>(x, w), make_shared<op::Dot>(Hi, Ri));
+    auto Ho = make_shared<op::Tanh>(make_shared<op::Add>(sum, b));
+    auto Yo = make_shared<op::Reshape>(Ho, AxisVector{0, 1}, Shape{1, 2, 5});
+    auto body = make_shared<op::TensorIterator::BodyLambda>(OutputVector{Ho, Yo},
+                                                            ParameterVector{Xi, Hi, Wi, Ri, Bi});
+
+    auto tensor_iterator = make_shared<op::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(Xi, X, 0, 1, 1, -1, 0);
+    tensor_iterator->set_merged_input(Hi, H_init, Ho);
+    tensor_iterator->set_invariant_input(Wi, W);
+    tensor_iterator->set_invariant_input(Ri, R);
+    tensor_iterator->set_invariant_input(Bi, B);
+    auto last_h = tensor_iterator->get_iter_value(Ho, -1);
+    auto all_y = tensor_iterator->get_concatenated_slices(Yo, 0, 1, 1, -1, 0);
+
+    return make_shared<Function>(
+        ResultVector{make_shared<op::Result>(last_h), make_shared<op::Result>(all_y)},
+        ParameterVector{X, H_init, W, R, B});
+}
+
+TEST(tensor_iterator_hoisting, rnn)
+{
+    auto f = make_rnn();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::TensorIteratorHoisting>();
+    pass_manager.run_passes(f);
+
+    shared_ptr<op::TensorIterator> tensor_iterator;
+    for (auto& node : f->get_ops())
+    {
+        if (auto ti = as_type_ptr<op::TensorIterator>(node))
+        {
+            tensor_iterator = ti;
+        }
+    }
+    ASSERT_TRUE(tensor_iterator);
+    auto body = tensor_iterator->get_body();
+    auto body_function = make_shared<Function>(body->get_results(), body->get_parameters());
+    // Only the hidden-to-hidden Dot is left in the body; the broadcast bias and the Dot of all
+    // the rows of X by W^T are computed once outside
+    EXPECT_EQ(count_ops_of_type<op::Dot>(body_function), 1);
+    EXPECT_EQ(count_ops_of_type<op::Broadcast>(body_function), 0);
+    EXPECT_EQ(count_ops_of_type<op::Dot>(f), 1);
+    // H_init, R, the broadcast bias and the sliced Dot; X, W and B are no longer read
+    EXPECT_EQ(tensor_iterator->get_input_size(), 4);
+    EXPECT_EQ(body->get_parameters().size(), 4);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (auto& param : f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto expected = execute(make_rnn(), args, "INTERPRETER");
+    auto results = execute(f, args, "INTERPRETER");
+    ASSERT_EQ(results.size(), expected.size());
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close_f(expected.at(i), results.at(i)));
+    }
+}
+
+TEST(tensor_iterator_hoisting, nothing_invariant)
+{
+    auto X = make_shared<op::Parameter>(element::f32, Shape{3, 2, 2});
+    auto H_init = make_shared<op::Parameter>(element::f32, Shape{1, 2, 2});
+    auto Xi = make_shared<op::Parameter>(element::f32, Shape{1, 2, 2});
+    auto Hi = make_shared<op::Parameter>(element::f32, Shape{1, 2, 2});
+    auto Ho = make_shared<op::Add>(Hi, Xi);
+    auto body = make_shared<op::TensorIterator::BodyLambda>(OutputVector{Ho},
+                                                            ParameterVector{Xi, Hi});
+    auto tensor_iterator = make_shared<op::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(Xi, X, 0, 1, 1, -1, 0);
+    tensor_iterator->set_merged_input(Hi, H_init, Ho);
+    auto last_h = tensor_iterator->get_iter_value(Ho, -1);
+    auto f = make_shared<Function>(OutputVector{last_h}, ParameterVector{X, H_init});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::TensorIteratorHoisting>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(f->get_results().at(0)->get_argument(0), tensor_iterator);
+    EXPECT_EQ(tensor_iterator->get_body(), body);
+}
@@ -292,6 +292,41 @@ TEST(pattern, graph_rewrite)
     }
 }
 
+TEST(pattern, graph_rewrite_matcher_index)
+{
+    class CountingGraphRewrite : public pass::GraphRewrite
+    {
+    public:
+        CountingGraphRewrite()
+        {
+            auto label = make_shared<pattern::op::Label>(element::i32, Shape{});
+            auto add = make_shared<pattern::Matcher>(label + label, "CountingAdd");
+            add_matcher(add, [](pattern::Matcher&) { return false; });
+            auto multiply = make_shared<pattern::Matcher>(label * label, "CountingMultiply");
+            add_matcher(multiply, [](pattern::Matcher&) { return false; });
+            add_matcher(make_shared<pattern::Matcher>(label, "CountingLabel"),
+                        [](pattern::Matcher&) { return false; });
+            set_matcher_profiling(true);
+        }
+    };
+
+    auto a = make_shared<op::Parameter>(element::i32, Shape{});
+    auto b = make_shared<op::Parameter>(element::i32, Shape{});
+    auto graph = (a + b) + (a * b);
+    auto f = make_shared<Function>(graph, ParameterVector{a, b});
+
+    pass::Manager pass_manager;
+    auto rewrite = pass_manager.register_pass<CountingGraphRewrite>();
+    pass_manager.run_passes(f);
+
+    auto& stats = rewrite->get_matcher_stats();
+    // Each matcher is only tried on the nodes of the type of its root, except the wildcard
+    EXPECT_EQ(stats.at("CountingAdd").attempts, size_t{2});
+    EXPECT_EQ(stats.at("CountingAdd").rewrites, size_t{0});
+    EXPECT_EQ(stats.at("CountingMultiply").attempts, size_t{1});
+    EXPECT_EQ(stats.at("CountingLabel").attempts, f->get_ordered_ops().size());
+}
+
 TEST(pattern, matcher)
 {
     Shape shape{};
@@ -696,6 +731,65 @@ TEST(pattern, recurrent_graph_rewrite)
     }
 }
 
+class ProfiledRecurrentGraphRewrite : public TestRecurrentGraphRewrite
+{
+public:
+    ProfiledRecurrentGraphRewrite() { set_matcher_profiling(true); }
+};
+
+TEST(pattern, recurrent_graph_rewrite_memoization)
+{
+    // A chain of adds of a non-zero constant, which the callback rejects at every root
+    Shape shape{};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    auto iconst1 = construct_constant_node(1);
+    const size_t chain_length = 64;
+    shared_ptr<Node> chain = a;
+    for (size_t i = 0; i < chain_length; i++)
+    {
+        chain = iconst1 + chain;
+    }
+    auto f = make_shared<Function>(NodeVector{chain}, ParameterVector{a});
+
+    pass::Manager pass_manager;
+    auto rewrite = pass_manager.register_pass<ProfiledRecurrentGraphRewrite>();
+    pass_manager.run_passes(f);
+
+    auto& stats = rewrite->get_matcher_stats().at(0);
+    EXPECT_EQ(stats.matches, chain_length);
+    EXPECT_EQ(stats.rewrites, 0);
+    // Each cell is matched once and the roots above it take it from the cache
+    EXPECT_LT(stats.node_visits, 10 * chain_length);
+    EXPECT_GE(stats.memo_hits, chain_length * (chain_length - 1) / 2);
+}
+
+TEST(pattern, matcher_memoization)
+{
+    Shape shape{};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    auto abs = make_shared<op::Abs>(a);
+    auto neg1 = make_shared<op::Negative>(abs);
+    auto neg2 = make_shared<op::Negative>(abs);
+
+    auto label = make_shared<pattern::op::Label>(element::i32, shape);
+    auto pattern = make_shared<op::Negative>(make_shared<op::Negative>(label));
+    pattern::Matcher m(pattern);
+    m.set_memoization(true);
+    EXPECT_FALSE(m.match(neg1));
+    EXPECT_EQ(m.get_statistics().memo_hits, 0);
+    // The inner Negative already failed to match abs
+    EXPECT_FALSE(m.match(neg2));
+    EXPECT_EQ(m.get_statistics().memo_hits, 1);
+
+    // Only valid until the graph changes
+    auto neg_a = make_shared<op::Negative>(a);
+    neg2->input(0).replace_source_output(neg_a->output(0));
+    m.clear_memo();
+    EXPECT_TRUE(m.match(neg2));
+    EXPECT_EQ(m.get_pattern_map()[label], a);
+    EXPECT_EQ(m.get_statistics().memo_hits, 1);
+}
+
 TEST(pattern, label_on_skip)
 {
     Shape shape{2, 2};
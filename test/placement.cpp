@@ -0,0 +1,86 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/placement.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(placement, partition_by_placement)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<op::Add>(A, B);
+    auto relu = make_shared<op::Relu>(add);
+    // B is used by both stages
+    auto mul = make_shared<op::Multiply>(relu, B);
+    auto neg = make_shared<op::Negative>(mul);
+    add->set_placement_index(0);
+    relu->set_placement_index(0);
+    mul->set_placement_index(1);
+    neg->set_placement_index(1);
+    auto f = make_shared<Function>(NodeVector{neg, relu}, ParameterVector{A, B});
+
+    auto partition = partition_by_placement(f);
+    ASSERT_EQ(partition.stages.size(), 2);
+    EXPECT_EQ(partition.placement_indices, (vector<size_t>{0, 1}));
+    EXPECT_EQ(count_ops_of_type<op::Add>(partition.stages[0]), 1);
+    EXPECT_EQ(count_ops_of_type<op::Multiply>(partition.stages[0]), 0);
+    EXPECT_EQ(count_ops_of_type<op::Multiply>(partition.stages[1]), 1);
+
+    // A feeds stage 0 only, B feeds both
+    EXPECT_EQ(partition.parameters[0].size(), 1);
+    EXPECT_EQ(partition.parameters[1].size(), 2);
+
+    // relu crosses once, even though it is also a result of stage 0
+    ASSERT_EQ(partition.edges.size(), 1);
+    auto& edge = partition.edges[0];
+    EXPECT_EQ(edge.src_stage, 0);
+    EXPECT_EQ(edge.dst_stage, 1);
+    auto exported = partition.stages[0]->get_results().at(edge.src_result)->input_value(0);
+    EXPECT_TRUE(is_type<op::Relu>(exported.get_node()));
+    auto imported = partition.stages[1]->get_parameters().at(edge.dst_parameter);
+    EXPECT_EQ(imported->get_shape(), shape);
+
+    ASSERT_EQ(partition.results.size(), 2);
+    EXPECT_EQ(partition.results[0].first, 1);
+    EXPECT_EQ(partition.results[1].first, 0);
+}
+
+TEST(placement, partition_by_placement_backward_edge)
+{
+    Shape shape{2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto neg = make_shared<op::Negative>(A);
+    auto abs = make_shared<op::Abs>(neg);
+    neg->set_placement_index(1);
+    abs->set_placement_index(0);
+    auto f = make_shared<Function>(abs, ParameterVector{A});
+    EXPECT_THROW(partition_by_placement(f), CheckFailure);
+}
+
+TEST(placement, partition_by_placement_unplaced)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto f = make_shared<Function>(make_shared<op::Negative>(A), ParameterVector{A});
+    EXPECT_THROW(partition_by_placement(f), CheckFailure);
+}
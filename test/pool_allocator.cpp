@@ -0,0 +1,150 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/pool_allocator.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(pool_allocator, alignment)
+{
+    runtime::PoolAllocator allocator;
+    for (size_t alignment : {1, 16, 64, 128, 4096})
+    {
+        for (size_t size : {1, 63, 64, 65, 1000, 100000})
+        {
+            void* ptr = allocator.malloc(size, alignment);
+            EXPECT_EQ(reinterpret_cast<size_t>(ptr) % max<size_t>(alignment, 64), 0);
+            memset(ptr, 0xA5, size);
+            allocator.free(ptr);
+        }
+    }
+}
+
+TEST(pool_allocator, reuse_and_statistics)
+{
+    runtime::PoolAllocator allocator;
+    void* a = allocator.malloc(1000, 64);
+    void* b = allocator.malloc(2000, 64);
+    auto stats = allocator.get_statistics();
+    EXPECT_EQ(stats.live_bytes, 3000);
+    EXPECT_EQ(stats.peak_live_bytes, 3000);
+    EXPECT_GE(stats.reserved_bytes, 3000);
+    EXPECT_EQ(stats.reuse_count, 0);
+
+    allocator.free(a);
+    void* c = allocator.malloc(990, 64);
+    EXPECT_EQ(c, a);
+    stats = allocator.get_statistics();
+    EXPECT_EQ(stats.reuse_count, 1);
+    EXPECT_EQ(stats.live_bytes, 2990);
+    EXPECT_EQ(stats.peak_live_bytes, 3000);
+
+    allocator.free(b);
+    allocator.free(c);
+    stats = allocator.get_statistics();
+    EXPECT_EQ(stats.live_bytes, 0);
+    EXPECT_GT(stats.reserved_bytes, 0);
+    EXPECT_DOUBLE_EQ(stats.fragmentation(), 1.0);
+
+    allocator.trim();
+    EXPECT_EQ(allocator.get_statistics().reserved_bytes, 0);
+}
+
+TEST(pool_allocator, cache_limit)
+{
+    runtime::PoolAllocator allocator(false, 0);
+    void* a = allocator.malloc(1000, 64);
+    allocator.free(a);
+    EXPECT_EQ(allocator.get_statistics().reserved_bytes, 0);
+}
+
+TEST(pool_allocator, cache_limit_threads)
+{
+    const size_t max_cached_bytes = 64 * 1024;
+    runtime::PoolAllocator allocator(false, max_cached_bytes);
+    auto worker = [&allocator]() {
+        vector<void*> ptrs;
+        for (size_t i = 0; i < 100; i++)
+        {
+            ptrs.push_back(allocator.malloc(1000 + (i % 4) * 1000, 64));
+        }
+        for (void* p : ptrs)
+        {
+            allocator.free(p);
+        }
+    };
+    vector<thread> threads;
+    for (size_t i = 0; i < 4; i++)
+    {
+        threads.emplace_back(worker);
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    // Everything still reserved is parked in the free lists
+    EXPECT_LE(allocator.get_statistics().reserved_bytes, max_cached_bytes);
+}
+
+TEST(pool_allocator, aligned_buffer)
+{
+    runtime::PoolAllocator allocator;
+    {
+        runtime::AlignedBuffer buffer(100, 64, &allocator);
+        EXPECT_EQ(reinterpret_cast<size_t>(buffer.get_ptr()) % 64, 0);
+        EXPECT_GE(allocator.get_statistics().live_bytes, 100);
+    }
+    EXPECT_EQ(allocator.get_statistics().live_bytes, 0);
+}
+
+TEST(pool_allocator, threads)
+{
+    runtime::PoolAllocator allocator;
+    auto worker = [&allocator](size_t seed) {
+        vector<void*> ptrs;
+        for (size_t i = 0; i < 1000; i++)
+        {
+            ptrs.push_back(allocator.malloc((seed * 131 + i * 17) % 10000 + 1, 64));
+            if (i % 3 == 0)
+            {
+                allocator.free(ptrs.back());
+                ptrs.pop_back();
+            }
+        }
+        for (void* p : ptrs)
+        {
+            allocator.free(p);
+        }
+    };
+    vector<thread> threads;
+    for (size_t i = 0; i < 4; i++)
+    {
+        threads.emplace_back(worker, i);
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    EXPECT_EQ(allocator.get_statistics().live_bytes, 0);
+}
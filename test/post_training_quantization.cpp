@@ -0,0 +1,120 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/op/experimental/quantized_conv_bias.hpp"
+#include "ngraph/op/quantized_convolution.hpp"
+#include "ngraph/op/quantized_dot.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/post_training_quantization.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+static shared_ptr<Node> make_filters(const Shape& shape)
+{
+    vector<float> values(shape_size(shape));
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = static_cast<float>(i % 5) - 2.0f;
+    }
+    return op::Constant::create(element::f32, shape, values);
+}
+
+static pass::PostTrainingQuantization::RangeMap calibrate(const shared_ptr<Function>& f,
+                                                          const vector<vector<float>>& samples)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    vector<vector<shared_ptr<runtime::Tensor>>> inputs;
+    for (auto& sample : samples)
+    {
+        auto& parameter = f->get_parameters().at(0);
+        auto tensor = backend->create_tensor(element::f32, parameter->get_shape());
+        copy_data(tensor, sample);
+        inputs.push_back({tensor});
+    }
+    return pass::PostTrainingQuantization::calibrate(f, *backend, inputs);
+}
+
+TEST(post_training_quantization, convolution_chain)
+{
+    Shape shape{1, 2, 3, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto conv1 = make_shared<op::Convolution>(A, make_filters(Shape{4, 2, 1, 1}));
+    auto bias = op::Constant::create(element::f32, Shape{4}, {0.5f, -0.5f, 1.0f, 0.0f});
+    auto add = conv1 + make_shared<op::Broadcast>(bias, conv1->get_shape(), AxisSet{0, 2, 3});
+    auto relu = make_shared<op::Relu>(add);
+    auto conv2 = make_shared<op::Convolution>(relu, make_filters(Shape{2, 4, 1, 1}));
+    auto f = make_shared<Function>(conv2, ParameterVector{A});
+
+    vector<float> sample0(shape_size(shape)), sample1(shape_size(shape));
+    for (size_t i = 0; i < sample0.size(); i++)
+    {
+        sample0[i] = static_cast<float>(i);
+        sample1[i] = static_cast<float>(i) * 0.5f + 1.0f;
+    }
+    auto ranges = calibrate(f, {sample0, sample1});
+    auto range = ranges.at(pass::PostTrainingQuantization::get_range_key(A));
+    EXPECT_EQ(range.min, 0.0f);
+    EXPECT_EQ(range.max, 17.0f);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::PostTrainingQuantization>(ranges);
+    pass_manager.run_passes(f);
+
+    // Bias and Relu fold into the first convolution, whose u8 result feeds the second one
+    // without a Dequantize and Quantize in between.
+    ASSERT_EQ(count_ops_of_type<op::QuantizedConvolutionBias>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::QuantizedConvolution>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::Dequantize>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::Relu>(f), 0);
+    auto qconv = f->get_results().at(0)->get_argument(0)->get_argument(0);
+    ASSERT_TRUE(is_type<op::QuantizedConvolution>(qconv));
+    EXPECT_TRUE(is_type<op::QuantizedConvolutionBias>(qconv->get_argument(0)));
+    EXPECT_EQ(qconv->get_input_element_type(0), element::u8);
+    EXPECT_EQ(f->get_results().at(0)->get_element_type(), element::f32);
+}
+
+TEST(post_training_quantization, dot)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto dot = make_shared<op::Dot>(A, make_filters(Shape{3, 4}));
+    auto f = make_shared<Function>(dot, ParameterVector{A});
+
+    // Nothing is calibrated, so nothing is quantized
+    pass::Manager empty_pass_manager;
+    empty_pass_manager.register_pass<pass::PostTrainingQuantization>(
+        pass::PostTrainingQuantization::RangeMap{});
+    empty_pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 1);
+
+    auto ranges = calibrate(f, {{-1.0f, 2.0f, -3.0f, 4.0f, -5.0f, 6.0f}});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::PostTrainingQuantization>(ranges);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::QuantizedDot>(f), 1);
+    auto qdot = f->get_results().at(0)->get_argument(0)->get_argument(0);
+    ASSERT_TRUE(is_type<op::QuantizedDot>(qdot));
+    // Negative data is quantized to i8
+    EXPECT_EQ(qdot->get_input_element_type(0), element::i8);
+    EXPECT_EQ(qdot->get_input_element_type(1), element::i8);
+}
@@ -0,0 +1,99 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/quantization_folding.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+static shared_ptr<Node> dequantize(const shared_ptr<Node>& input, float scale)
+{
+    return make_shared<op::Dequantize>(input,
+                                       op::Constant::create(element::f32, Shape{}, {scale}),
+                                       op::Constant::create(element::i8, Shape{}, {0}),
+                                       element::f32,
+                                       AxisSet{});
+}
+
+static shared_ptr<Node> quantize(const shared_ptr<Node>& input, float scale)
+{
+    return make_shared<op::Quantize>(input,
+                                     op::Constant::create(element::f32, Shape{}, {scale}),
+                                     op::Constant::create(element::i8, Shape{}, {0}),
+                                     element::i8,
+                                     AxisSet{},
+                                     op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+}
+
+TEST(quantization_folding, int8_chain)
+{
+    Shape shape{1, 1, 4, 4};
+    auto A = make_shared<op::Parameter>(element::i8, shape);
+    auto max_pool = make_shared<op::MaxPool>(dequantize(A, 0.5f), Shape{2, 2}, Strides{2, 2});
+    auto reshape = make_shared<op::Reshape>(max_pool, AxisVector{0, 1, 2, 3}, Shape{2, 2});
+    auto relu = make_shared<op::Relu>(reshape);
+    auto f = make_shared<Function>(quantize(relu, 0.5f), ParameterVector{A});
+    auto reference = clone_function(*f);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::QuantizationFolding>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::Dequantize>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Quantize>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::MaxPool>(f), 1);
+    EXPECT_EQ(f->get_results().at(0)->get_element_type(), element::i8);
+
+    vector<int8_t> data{-8, 3, 5, -1, 7, -2, -6, -7, 0, 1, -3, -4, 2, -5, -9, -10};
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto compute = [&](const shared_ptr<Function>& function) {
+        auto a = backend->create_tensor(element::i8, shape);
+        copy_data(a, data);
+        auto result = backend->create_tensor(element::i8, Shape{2, 2});
+        auto handle = backend->compile(function);
+        handle->call_with_validate({result}, {a});
+        return read_vector<int8_t>(result);
+    };
+    EXPECT_EQ((vector<int8_t>{7, 5, 2, 0}), compute(reference));
+    EXPECT_EQ(compute(reference), compute(f));
+}
+
+TEST(quantization_folding, concat_scales)
+{
+    auto A = make_shared<op::Parameter>(element::i8, Shape{2});
+    auto B = make_shared<op::Parameter>(element::i8, Shape{2});
+    auto same = make_shared<op::Concat>(NodeVector{dequantize(A, 0.5f), dequantize(B, 0.5f)}, 0);
+    auto different =
+        make_shared<op::Concat>(NodeVector{dequantize(A, 0.5f), dequantize(B, 0.25f)}, 0);
+    auto f = make_shared<Function>(NodeVector{same, different}, ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::QuantizationFolding>();
+    pass_manager.run_passes(f);
+
+    // Only the inputs with matching scales are concatenated as int8
+    auto first = f->get_results().at(0)->get_argument(0);
+    ASSERT_TRUE(is_type<op::Dequantize>(first));
+    EXPECT_TRUE(is_type<op::Concat>(first->get_argument(0)));
+    EXPECT_EQ(first->get_input_element_type(0), element::i8);
+    EXPECT_TRUE(is_type<op::Concat>(f->get_results().at(1)->get_argument(0)));
+}
@@ -38,6 +38,7 @@
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "util/all_close.hpp"
+#include "util/all_close_f.hpp"
 #include "util/autodiff/backprop_function.hpp"
 #include "util/autodiff/numeric_compare.hpp"
 #include "util/ndarray.hpp"
@@ -49,7 +50,7 @@ using namespace std;
 
 TEST(reshape_sinking, edge_splitting)
 {
-    // checks if Reshapes are pushed through op::Abs, but stopped by Sum
+    // checks if Reshapes are pushed through op::Abs and absorbed by a full Sum
     Shape shape_nhwc{16, 28, 28, 1};
     Shape shape_nchw{16, 1, 28, 28};
     auto a = make_shared<op::Parameter>(element::i32, shape_nhwc);
@@ -265,6 +266,66 @@ TEST(reshape_sinking, concat)
     ASSERT_LE(before_after, before_count);
 }
 
+TEST(reshape_sinking, reduction)
+{
+    Shape shape_nhwc{2, 4, 5, 3};
+    Shape shape_nchw{2, 3, 4, 5};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape_nhwc);
+        auto reshape1 = make_shared<op::Reshape>(A, AxisVector{0, 3, 1, 2}, shape_nchw);
+        auto sum = make_shared<op::Sum>(reshape1, AxisSet{1});
+        auto broadcast = make_shared<op::Broadcast>(sum, shape_nchw, AxisSet{1});
+        auto mul = make_shared<op::Multiply>(reshape1, broadcast);
+        auto reshape2 = make_shared<op::Reshape>(mul, AxisVector{0, 2, 3, 1}, shape_nhwc);
+        return make_shared<Function>(reshape2, ParameterVector{A});
+    };
+    auto f = make_function();
+    auto ref_f = make_function();
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ReshapeSinking>();
+    pass_manager.register_pass<pass::ReshapeElimination>();
+    pass_manager.register_pass<pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Reshape>(f), 0);
+
+    vector<vector<float>> args{vector<float>(shape_size(shape_nhwc))};
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    rng.initialize(args.at(0));
+    auto results = execute(f, args, "INTERPRETER");
+    auto ref_results = execute(ref_f, args, "INTERPRETER");
+    EXPECT_TRUE(test::all_close_f(ref_results.at(0), results.at(0)));
+}
+
+TEST(reshape_sinking, broadcast)
+{
+    Shape shape_a{2, 4, 3};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape_a);
+        auto reshape1 = make_shared<op::Reshape>(A, AxisVector{0, 2, 1}, Shape{2, 3, 4});
+        auto broadcast = make_shared<op::Broadcast>(reshape1, Shape{2, 3, 4, 5}, AxisSet{3});
+        auto reshape2 =
+            make_shared<op::Reshape>(broadcast, AxisVector{0, 2, 1, 3}, Shape{2, 4, 3, 5});
+        return make_shared<Function>(reshape2, ParameterVector{A});
+    };
+    auto f = make_function();
+    auto ref_f = make_function();
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ReshapeSinking>();
+    pass_manager.register_pass<pass::ReshapeElimination>();
+    pass_manager.register_pass<pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Reshape>(f), 0);
+
+    vector<vector<float>> args{vector<float>(shape_size(shape_a))};
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    rng.initialize(args.at(0));
+    auto results = execute(f, args, "INTERPRETER");
+    auto ref_results = execute(ref_f, args, "INTERPRETER");
+    EXPECT_TRUE(test::all_close_f(ref_results.at(0), results.at(0)));
+}
+
 TEST(reshape_sinking, pass_property)
 {
     auto pass = std::make_shared<ngraph::pass::ReshapeSinking>();
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <fstream>
+#include <numeric>
 #include <sstream>
 
 #include "gmock/gmock.h"
@@ -194,6 +195,157 @@ TEST(serialize, constant)
     EXPECT_TRUE(found);
 }
 
+TEST(serialize, json_constant_values)
+{
+    auto A = op::Constant::create(element::f32, Shape{2, 3}, vector<float>{1.5f, -2, 3, 4, 5, 6});
+    auto B = op::Constant::create(element::i32, Shape{4}, {7, 7, 7, 7});
+    auto C = op::Constant::create(element::u8, Shape{3}, {0, 128, 255});
+    auto D = op::Constant::create(element::i64, Shape{}, {-9});
+    auto f = make_shared<Function>(NodeVector{A, B, C, D}, ParameterVector{});
+
+    stringstream ss;
+    serialize(ss, f);
+    auto g = deserialize(ss);
+    ASSERT_NE(g, nullptr);
+    ASSERT_EQ(g->get_results().size(), 4);
+    auto get_constant = [&](size_t i) {
+        return as_type_ptr<op::Constant>(g->get_results().at(i)->get_argument(0));
+    };
+    EXPECT_EQ((vector<float>{1.5f, -2, 3, 4, 5, 6}), get_constant(0)->get_vector<float>());
+    EXPECT_EQ((vector<int32_t>{7, 7, 7, 7}), get_constant(1)->get_vector<int32_t>());
+    EXPECT_EQ((vector<uint8_t>{0, 128, 255}), get_constant(2)->get_vector<uint8_t>());
+    EXPECT_EQ((vector<int64_t>{-9}), get_constant(3)->get_vector<int64_t>());
+}
+
+TEST(serialize, binary_mapped_constant)
+{
+    const string tmp_file = "serialize_binary_constant.bin";
+    Shape shape{64, 64};
+    vector<float> values(shape_size(shape));
+    iota(values.begin(), values.end(), 0.f);
+    auto A = op::Constant::create(element::f32, shape, values);
+    auto B = op::Constant::create(element::f32, Shape{2}, {1, 2});
+    auto f = make_shared<Function>(NodeVector{A, B}, ParameterVector{});
+
+    serialize_binary(tmp_file, f);
+    auto g = deserialize(tmp_file);
+    ASSERT_NE(g, nullptr);
+    auto c = as_type_ptr<op::Constant>(g->get_results().at(0)->get_argument(0));
+    ASSERT_NE(c, nullptr);
+    EXPECT_EQ(values, c->get_vector<float>());
+    c = as_type_ptr<op::Constant>(g->get_results().at(1)->get_argument(0));
+    ASSERT_NE(c, nullptr);
+    EXPECT_EQ((vector<float>{1, 2}), c->get_vector<float>());
+
+    // The mapping outlives the file name, so the data stays valid once the file is removed
+    file_util::remove_file(tmp_file);
+    EXPECT_EQ(values, as_type_ptr<op::Constant>(g->get_results().at(0)->get_argument(0))
+                          ->get_vector<float>());
+}
+
+TEST(serialize, binary_compressed_constants)
+{
+    const string tmp_file = "serialize_binary_compressed_constants.bin";
+    Shape shape{64, 64};
+    // Exact in f16, and repetitive enough to compress
+    vector<float> values(shape_size(shape));
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = static_cast<float>(i % 256) * 0.5f;
+    }
+    vector<int32_t> indices(shape_size(shape), 7);
+    auto A = op::Constant::create(element::f32, shape, values);
+    auto B = op::Constant::create(element::i32, shape, indices);
+    auto C = op::Constant::create(element::f32, Shape{2}, {1, 2});
+    auto f = make_shared<Function>(NodeVector{A, B, C}, ParameterVector{});
+
+    stringstream plain;
+    serialize_binary(plain, f);
+
+    for (auto compression : {BinarySerializeOptions::Compression::NONE,
+                             BinarySerializeOptions::Compression::LZ4,
+                             BinarySerializeOptions::Compression::ZSTD})
+    {
+        for (bool f16_constants : {false, true})
+        {
+            BinarySerializeOptions options;
+            options.compression = compression;
+            options.f16_constants = f16_constants;
+            if (!BinarySerializeOptions::is_supported(compression))
+            {
+                stringstream binary;
+                EXPECT_THROW(serialize_binary(binary, f, options), ngraph_error);
+                continue;
+            }
+
+            stringstream binary;
+            serialize_binary(binary, f, options);
+            if (compression != BinarySerializeOptions::Compression::NONE || f16_constants)
+            {
+                EXPECT_LT(binary.str().size(), plain.str().size());
+            }
+            serialize_binary(tmp_file, f, options);
+            for (auto g : {deserialize(binary), deserialize(tmp_file)})
+            {
+                ASSERT_NE(g, nullptr);
+                auto get_constant = [&](size_t i) {
+                    return as_type_ptr<op::Constant>(g->get_results().at(i)->get_argument(0));
+                };
+                EXPECT_EQ(element::f32, get_constant(0)->get_element_type());
+                EXPECT_EQ(values, get_constant(0)->get_vector<float>());
+                EXPECT_EQ(indices, get_constant(1)->get_vector<int32_t>());
+                EXPECT_EQ((vector<float>{1, 2}), get_constant(2)->get_vector<float>());
+            }
+            file_util::remove_file(tmp_file);
+        }
+    }
+}
+
+TEST(serialize, binary_existing_models)
+{
+    vector<string> models = {"mxnet/mnist_mlp_forward.json",
+                             "mxnet/10_bucket_LSTM.json",
+                             "mxnet/LSTM_backward.json",
+                             "mxnet/LSTM_forward.json"};
+
+    for (const string& model : models)
+    {
+        const string json_path = file_util::path_join(SERIALIZED_ZOO, model);
+        shared_ptr<Function> f = deserialize(file_util::read_file_to_string(json_path));
+
+        stringstream binary;
+        serialize_binary(binary, f);
+        shared_ptr<Function> g = deserialize(binary);
+        ASSERT_NE(g, nullptr);
+        EXPECT_EQ(f->get_name(), g->get_name());
+        EXPECT_EQ(f->get_parameters().size(), g->get_parameters().size());
+        EXPECT_EQ(f->get_results().size(), g->get_results().size());
+
+        auto f_ops = f->get_ordered_ops();
+        auto g_ops = g->get_ordered_ops();
+        ASSERT_EQ(f_ops.size(), g_ops.size());
+        for (auto f_it = f_ops.begin(), g_it = g_ops.begin(); f_it != f_ops.end(); ++f_it, ++g_it)
+        {
+            EXPECT_EQ((*f_it)->description(), (*g_it)->description());
+            EXPECT_EQ((*f_it)->get_friendly_name(), (*g_it)->get_friendly_name());
+            ASSERT_EQ((*f_it)->get_output_size(), (*g_it)->get_output_size());
+            for (size_t i = 0; i < (*f_it)->get_output_size(); i++)
+            {
+                EXPECT_EQ((*f_it)->get_output_element_type(i),
+                          (*g_it)->get_output_element_type(i));
+                EXPECT_TRUE((*f_it)->get_output_partial_shape(i).same_scheme(
+                    (*g_it)->get_output_partial_shape(i)));
+            }
+            if (auto c = as_type_ptr<op::Constant>(*f_it))
+            {
+                auto d = as_type_ptr<op::Constant>(*g_it);
+                ASSERT_NE(d, nullptr);
+                EXPECT_EQ(c->get_value_strings(), d->get_value_strings());
+            }
+        }
+    }
+}
+
 TEST(benchmark, serialize)
 {
     stopwatch timer;
@@ -852,3 +1004,80 @@ TEST(serialize, deformable_psroi_pooling)
     EXPECT_EQ(def_psroi_pool_out->get_trans_std(), trans_std);
     EXPECT_EQ(def_psroi_pool_out->get_part_size(), part_size);
 }
+
+// An op the serializer has no case for, written and read back through its attributes
+class SerializeUserOp : public op::Op
+{
+public:
+    static constexpr NodeTypeInfo type_info{"SerializeUserOp", 0};
+    const NodeTypeInfo& get_type_info() const override { return type_info; }
+    SerializeUserOp() = default;
+    SerializeUserOp(const Output<Node>& arg,
+                    const element::Type& output_type,
+                    const Shape& output_shape,
+                    const string& tag,
+                    bool flag,
+                    double scale)
+        : Op({arg})
+        , m_output_type(output_type)
+        , m_output_shape(output_shape)
+        , m_tag(tag)
+        , m_flag(flag)
+        , m_scale(scale)
+    {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override
+    {
+        set_output_type(0, m_output_type, m_output_shape);
+    }
+    shared_ptr<Node> copy_with_new_args(const NodeVector& args) const override
+    {
+        return make_shared<SerializeUserOp>(
+            args.at(0), m_output_type, m_output_shape, m_tag, m_flag, m_scale);
+    }
+    bool visit_attributes(AttributeVisitor& visitor) override
+    {
+        visitor.on_attribute("output_type", m_output_type);
+        visitor.on_attribute("output_shape", m_output_shape);
+        visitor.on_attribute("tag", m_tag);
+        visitor.on_attribute("flag", m_flag);
+        visitor.on_attribute("scale", m_scale);
+        return true;
+    }
+
+    element::Type m_output_type;
+    Shape m_output_shape;
+    string m_tag;
+    bool m_flag = false;
+    double m_scale = 0;
+};
+
+constexpr NodeTypeInfo SerializeUserOp::type_info;
+
+TEST(serialize, visit_attributes_fallback)
+{
+    auto arg = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto user_op =
+        make_shared<SerializeUserOp>(arg, element::i64, Shape{6, 1}, "tagged", true, 0.25);
+    auto f = make_shared<Function>(user_op, ParameterVector{arg});
+    string s = serialize(f);
+
+    // Without a factory the op cannot be made again
+    EXPECT_THROW(deserialize(s), runtime_error);
+
+    FactoryRegistry<Node>::get().register_factory<SerializeUserOp>();
+    shared_ptr<Function> g = deserialize(s);
+    auto g_op = as_type_ptr<SerializeUserOp>(
+        g->get_results().at(0)->input_value(0).get_node_shared_ptr());
+    ASSERT_TRUE(g_op);
+    EXPECT_EQ(g_op->m_output_type, element::i64);
+    EXPECT_EQ(g_op->m_output_shape, (Shape{6, 1}));
+    EXPECT_EQ(g_op->m_tag, "tagged");
+    EXPECT_TRUE(g_op->m_flag);
+    EXPECT_EQ(g_op->m_scale, 0.25);
+    EXPECT_EQ(g_op->get_output_element_type(0), element::i64);
+    EXPECT_EQ(g_op->input_value(0).get_node_shared_ptr()->get_friendly_name(),
+              arg->get_friendly_name());
+}
@@ -36,3 +36,55 @@ TEST(shape, test_shape_strides)
     ASSERT_EQ((Strides{7, 1}), row_major_strides(Shape{2, 7}));
     ASSERT_EQ((Strides{84, 12, 1}), row_major_strides(Shape{5, 7, 12}));
 }
+
+TEST(shape, inline_and_heap_storage)
+{
+    Shape small{2, 3, 5};
+    EXPECT_EQ(small.capacity(), 6);
+
+    // Growing past the inline dimensions moves the elements to the heap
+    Shape large = small;
+    for (size_t i = 0; i < 5; i++)
+    {
+        large.push_back(i + 7);
+    }
+    EXPECT_EQ(large, (Shape{2, 3, 5, 7, 8, 9, 10, 11}));
+    EXPECT_EQ(small, (Shape{2, 3, 5}));
+
+    Shape moved = std::move(large);
+    EXPECT_EQ(moved.size(), 8);
+    EXPECT_TRUE(large.empty());
+    EXPECT_EQ(moved.back(), 11);
+
+    moved.erase(moved.begin() + 1, moved.begin() + 7);
+    EXPECT_EQ(moved, (Shape{2, 11}));
+    moved.insert(moved.begin() + 1, small.begin(), small.end());
+    EXPECT_EQ(moved, (Shape{2, 2, 3, 5, 11}));
+    moved.insert(moved.end(), moved.begin(), moved.end());
+    EXPECT_EQ(moved, (Shape{2, 2, 3, 5, 11, 2, 2, 3, 5, 11}));
+}
+
+TEST(shape, std_vector_interop)
+{
+    vector<size_t> dims{4, 1, 8};
+    Shape shape(dims);
+    EXPECT_EQ(shape, dims);
+    EXPECT_EQ(dims, shape);
+    EXPECT_NE(shape, (vector<size_t>{4, 1}));
+
+    vector<size_t> copy = shape;
+    EXPECT_EQ(copy, dims);
+    EXPECT_LT((Shape{1, 2}), (Shape{1, 3}));
+    EXPECT_EQ(Shape(2, 3), (Shape{3, 3}));
+}
+
+TEST(shape, ranges_of_itself)
+{
+    Shape shape{1, 2, 3};
+    shape.insert(shape.begin() + 1, shape.rbegin(), shape.rend());
+    EXPECT_EQ(shape, (Shape{1, 3, 2, 1, 2, 3}));
+    shape.assign(shape.begin() + 2, shape.end() - 1);
+    EXPECT_EQ(shape, (Shape{2, 1, 2}));
+    shape = Shape(shape.rbegin(), shape.rend() - 1);
+    EXPECT_EQ(shape, (Shape{2, 1}));
+}
@@ -25,6 +25,7 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
 #include "util/test_tools.hpp"
 
 using namespace std;
@@ -89,3 +90,33 @@ TEST(tensor, output_flag)
         EXPECT_TRUE(f0->get_output_op(i)->is_output());
     }
 }
+
+TEST(tensor, streaming_write)
+{
+    auto tensor = make_shared<runtime::HostTensor>(element::f32, Shape{4});
+    auto fence = tensor->begin_streaming_write();
+    EXPECT_EQ(tensor->get_fence(), fence);
+    EXPECT_FALSE(fence->is_ready());
+
+    vector<float> data{1, 2, 3, 4};
+    auto second = tensor->write_async(&data[2], 2 * sizeof(float), 2 * sizeof(float));
+    second.get();
+    EXPECT_EQ(fence->get_ready_bytes(), 2 * sizeof(float));
+    EXPECT_FALSE(fence->is_ready());
+    auto first = tensor->write_async(&data[0], 0, 2 * sizeof(float));
+    fence->wait();
+    first.get();
+    EXPECT_TRUE(fence->is_ready());
+    EXPECT_EQ(read_vector<float>(tensor), data);
+
+    EXPECT_THROW(tensor->write_async(data.data(), sizeof(float), 4 * sizeof(float)),
+                 std::out_of_range);
+}
+
+TEST(tensor, streaming_write_error)
+{
+    runtime::TensorFence fence(8);
+    fence.add_ready(4);
+    fence.set_error(make_exception_ptr(ngraph_error("decode failed")));
+    EXPECT_THROW(fence.wait(), ngraph_error);
+}
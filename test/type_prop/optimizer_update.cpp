@@ -0,0 +1,96 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/type_prop.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(type_prop, sgd_momentum_update)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto grad = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto velocity = make_shared<op::Parameter>(element::f32, PartialShape::dynamic());
+    auto lr = make_shared<op::Parameter>(element::f32, Shape{});
+    auto update = make_shared<op::SGDMomentumUpdate>(param, grad, velocity, lr, 0.9);
+    ASSERT_EQ(update->get_output_size(), 2);
+    EXPECT_EQ(update->get_output_element_type(0), element::f32);
+    EXPECT_TRUE(update->get_output_partial_shape(0).same_scheme(PartialShape{2, 4}));
+    EXPECT_TRUE(update->get_output_partial_shape(1).same_scheme(PartialShape{2, 4}));
+}
+
+TEST(type_prop, adam_update)
+{
+    auto param = make_shared<op::Parameter>(element::f64, Shape{3});
+    auto grad = make_shared<op::Parameter>(element::f64, Shape{3});
+    auto m = make_shared<op::Parameter>(element::f64, Shape{3});
+    auto v = make_shared<op::Parameter>(element::f64, Shape{3});
+    auto lr = make_shared<op::Parameter>(element::f64, Shape{});
+    auto update = make_shared<op::AdamUpdate>(param, grad, m, v, lr);
+    ASSERT_EQ(update->get_output_size(), 3);
+    for (size_t i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(update->get_output_element_type(i), element::f64);
+        EXPECT_EQ(update->get_output_shape(i), (Shape{3}));
+    }
+}
+
+TEST(type_prop, adam_update_shape_mismatch)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto grad = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto m = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto v = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto lr = make_shared<op::Parameter>(element::f32, Shape{});
+    try
+    {
+        auto update = make_shared<op::AdamUpdate>(param, grad, m, v, lr);
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Inconsistent shapes not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), std::string("Argument shapes are inconsistent"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, sgd_momentum_update_learning_rate_not_scalar)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto grad = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto velocity = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto lr = make_shared<op::Parameter>(element::f32, Shape{3});
+    try
+    {
+        auto update = make_shared<op::SGDMomentumUpdate>(param, grad, velocity, lr, 0.9);
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Non-scalar learning rate not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), std::string("Learning rate must be a scalar"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
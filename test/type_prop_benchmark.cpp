@@ -14,6 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
+#if defined(__linux__)
+#include <malloc.h>
+#endif
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "util/type_prop.hpp"
@@ -73,3 +77,35 @@ TEST(type_prop, DISABLED_benchmark_type_prop_convolution)
     std::cout << "Constructed " << std::fixed << num_iterations << " Convolution ops in "
               << std::fixed << total_nanosec << " ns" << std::endl;
 }
+
+#if defined(__linux__)
+static size_t heap_bytes_in_use()
+{
+#if __GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33)
+    return mallinfo2().uordblks;
+#else
+    return static_cast<unsigned int>(mallinfo().uordblks);
+#endif
+}
+
+TEST(type_prop, DISABLED_benchmark_node_memory_footprint)
+{
+    constexpr size_t num_nodes = 100000;
+
+    auto p = make_shared<op::Parameter>(element::f32, Shape{1, 2, 3, 4});
+    NodeVector nodes;
+    nodes.reserve(num_nodes);
+
+    size_t before = heap_bytes_in_use();
+    shared_ptr<Node> last = p;
+    for (size_t i = 0; i < num_nodes; i++)
+    {
+        last = make_shared<op::Add>(last, p);
+        nodes.push_back(last);
+    }
+    size_t after = heap_bytes_in_use();
+
+    std::cout << "sizeof(op::Add) is " << sizeof(op::Add) << " bytes, each Add uses "
+              << (after - before) / num_nodes << " heap bytes" << std::endl;
+}
+#endif
@@ -28,6 +28,7 @@
 #include "ngraph/op/util/op_annotations.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
 #include "ngraph/serializer.hpp"
 #include "util/all_close.hpp"
 #include "util/autodiff/backprop_function.hpp"
@@ -277,6 +278,24 @@ TEST(graph_util, clone_multiple_results)
     auto copy = clone_function(*f);
 }
 
+TEST(graph_util, clone_function_shares_constant_data)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto K = op::Constant::create(element::f32, shape, {3, 3, 3, 3});
+    auto f = make_shared<Function>(make_shared<op::Add>(A, K), ParameterVector{A});
+
+    NodeMap node_map;
+    auto copy = clone_function(*f, node_map);
+    auto cloned_K = as_type_ptr<op::Constant>(node_map.at(K.get()));
+    ASSERT_TRUE(cloned_K);
+    EXPECT_NE(cloned_K, K);
+    EXPECT_EQ(cloned_K->get_data_ptr(), K->get_data_ptr());
+    EXPECT_TRUE(cloned_K->get_all_data_elements_bitwise_identical());
+    EXPECT_EQ(cloned_K->get_shape(), shape);
+    EXPECT_EQ(copy->get_results().at(0)->get_shape(), shape);
+}
+
 TEST(util, round_up)
 {
     EXPECT_EQ(0, round_up(0, 4));
@@ -395,6 +414,38 @@ TEST(graph_util, test_subgraph_topological_sort_control_dependencies)
     ASSERT_EQ(expected, sorted);
 }
 
+TEST(graph_util, test_ordered_ops_follow_graph_changes)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = A + B;
+    auto abs = make_shared<op::Abs>(add);
+    auto f = make_shared<Function>(abs, ParameterVector{A, B});
+    auto sort_function = [&](bool include_control_deps) {
+        NodeVector roots{f->get_results().at(0), A, B};
+        return topological_sort(roots, include_control_deps);
+    };
+
+    auto ordered = f->get_ordered_ops();
+    EXPECT_EQ(ordered, f->get_ordered_ops());
+    EXPECT_EQ(ordered, sort_function(true));
+
+    // Rewiring an edge must not return the order computed before the change
+    auto neg = make_shared<op::Negative>(A);
+    abs->input(0).replace_source_output(neg);
+    ordered = f->get_ordered_ops();
+    EXPECT_EQ(ordered, sort_function(true));
+    EXPECT_EQ(count(ordered.begin(), ordered.end(), add), 0);
+    EXPECT_EQ(count(ordered.begin(), ordered.end(), neg), 1);
+
+    // So must adding a control dependency
+    neg->add_control_dependency(add);
+    ordered = f->get_ordered_ops();
+    EXPECT_EQ(count(ordered.begin(), ordered.end(), add), 1);
+    EXPECT_EQ(ordered, sort_function(true));
+}
+
 TEST(util, enum_mask_construction)
 {
     enum class Type : uint32_t
@@ -691,3 +742,40 @@ TEST(util, clone_function_op_annotations)
     EXPECT_TRUE(found_A);
     EXPECT_TRUE(found_B);
 }
+
+TEST(util, performance_counter_estimates)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4, 8});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{8, 16});
+    auto dot = make_shared<op::Dot>(A, B);
+    auto add = make_shared<op::Add>(dot, dot);
+
+    runtime::PerformanceCounter dot_counter(dot, 10, 2);
+    EXPECT_EQ(dot_counter.flops(), 2 * 4 * 16 * 8);
+    EXPECT_EQ(dot_counter.bytes(), (4 * 8 + 8 * 16 + 4 * 16) * sizeof(float));
+    EXPECT_DOUBLE_EQ(dot_counter.gflops_per_second(), 2 * 2 * 4 * 16 * 8 / 10.0 / 1e3);
+
+    runtime::PerformanceCounter add_counter(add, 0, 0);
+    EXPECT_EQ(add_counter.flops(), 4 * 16);
+    EXPECT_EQ(add_counter.gflops_per_second(), 0);
+    EXPECT_FALSE(add_counter.has_hardware_counters());
+}
+
+TEST(util, any_isnan_any_isinf)
+{
+    // Longer than one scan block, with the special value in the tail
+    vector<float> data(2500, 1.0f);
+    EXPECT_FALSE(any_isnan(data.data(), data.size()));
+    EXPECT_FALSE(any_isinf(data.data(), data.size()));
+
+    data[2400] = numeric_limits<float>::quiet_NaN();
+    EXPECT_TRUE(any_isnan(data.data(), data.size()));
+    EXPECT_FALSE(any_isinf(data.data(), data.size()));
+    EXPECT_FALSE(any_isnan(data.data(), 2400));
+
+    vector<double> doubles{1, -numeric_limits<double>::infinity(), 3};
+    EXPECT_TRUE(any_isinf(doubles.data(), doubles.size()));
+    EXPECT_FALSE(any_isnan(doubles.data(), doubles.size()));
+    EXPECT_THROW(check_fp_values_isinf("doubles", doubles.data(), doubles.size()),
+                 std::runtime_error);
+}